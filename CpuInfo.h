@@ -0,0 +1,81 @@
+#pragma once
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// Marks a kernel that uses instructions past SSE2, so that it is only called once CpuInfo reports them.
+// MSVC accepts any intrinsic anywhere; GCC and Clang are told per function and build the rest for plain x64.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CPU_TARGET_SSE41
+#define CPU_TARGET_AVX2
+#else
+#define CPU_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define CPU_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#endif
+
+// x64 CPU features the SIMD kernels pick their variant by. SSE2 is part of x64 and needs no check.
+namespace CpuInfo
+{
+	// CPUID leaf [leaf], subleaf [subleaf]: EAX, EBX, ECX, EDX, or zeros past the highest leaf
+	inline void Query(unsigned leaf, unsigned subleaf, unsigned info[4])
+	{
+#ifdef _MSC_VER
+		int registers[4];
+		__cpuid(registers, 0);
+		if ((unsigned)registers[0] < leaf)
+		{
+			info[0] = info[1] = info[2] = info[3] = 0;
+			return;
+		}
+		__cpuidex(registers, (int)leaf, (int)subleaf);
+		for (int i = 0; i < 4; ++i)
+			info[i] = (unsigned)registers[i];
+#else
+		if (!__get_cpuid_count(leaf, subleaf, &info[0], &info[1], &info[2], &info[3]))
+			info[0] = info[1] = info[2] = info[3] = 0;
+#endif
+	}
+
+	// Whether the OS saves the YMM registers, which AVX needs besides the CPU flag
+	inline bool OSSavesYMM()
+	{
+		unsigned info[4];
+		Query(1, 0, info);
+		const bool osxsave = (info[2] & (1u << 27)) != 0;
+		const bool avx = (info[2] & (1u << 28)) != 0;
+		if (!osxsave || !avx)
+			return false;
+#ifdef _MSC_VER
+		const unsigned long long xcr0 = _xgetbv(0);
+#else
+		unsigned eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		const unsigned long long xcr0 = ((unsigned long long)edx << 32) | eax;
+#endif
+		return (xcr0 & 0x6) == 0x6;
+	}
+
+	inline bool HasSSE41()
+	{
+		unsigned info[4];
+		Query(1, 0, info);
+		return (info[2] & (1u << 19)) != 0;
+	}
+
+	inline bool HasAVX2()
+	{
+		unsigned info[4];
+		Query(7, 0, info);
+		return (info[1] & (1u << 5)) != 0 && OSSavesYMM();
+	}
+
+	inline bool HasF16C()
+	{
+		unsigned info[4];
+		Query(1, 0, info);
+		return (info[2] & (1u << 29)) != 0 && OSSavesYMM();
+	}
+}
@@ -1,8 +1,10 @@
 #include "stdafx.h"
 #include "D3D12Engine.h"
+#include "VertexPacking.h"
 
 #include <array>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <windowsx.h>
 
@@ -36,6 +38,7 @@ void D3D12Engine::OnInit()
 
 	// Load any assets here.
 	LoadAssets();
+	auto IBLStart = std::chrono::high_resolution_clock::now();
 	//LoadIBL("resources/hdris/little_paris_eiffel_tower_2k.exr");
 	//LoadIBL("resources/hdris/veranda_4k.exr");
 	//LoadIBL("resources/hdris/illovo_beach_balcony_4k.exr");
@@ -50,17 +53,25 @@ void D3D12Engine::OnInit()
 
 	// Release upload heaps after the command list has been executed.
 	m_presentTriangle.ReleaseUploadHeaps();
-	for (auto& m : m_meshes)
-	{
-		m.ReleaseUploadHeaps();
-	}
+	m_meshRegistry.ReleaseUploadHeaps();
 
 	m_sphericalTexture.ReleaseUploadHeaps();
+	m_BRDFTexture.ReleaseUploadHeaps();
+	m_compressedIBL.ReleaseUploadHeaps();
+	m_compressedIBL.ReleaseCPUData();
 	for (auto& t : m_textures)
 	{
 		t.ReleaseUploadHeaps();
 	}
 
+	// A fresh bake is compressed once it is done, for the cache and for this run
+	if (m_IBLBaked)
+		CompressIBL();
+
+	// Cold and warm starts differ by the bake; the submission waited for includes the other asset uploads
+	std::chrono::duration<double, std::milli> IBLTime = std::chrono::high_resolution_clock::now() - IBLStart;
+	OutputDebugStringA(string_format("D3D12Engine: IBL ready %.2f ms after LoadIBL (%s start)\n", IBLTime.count(), m_IBLCacheHit ? "warm" : "cold").c_str());
+
 	// Any other initialization logic goes here.
 	InitCamera();
 }
@@ -434,6 +445,17 @@ void D3D12Engine::CreatePipelines()
 		//assert(OutPipelines.size() == PSO_Test);
 
 		AddGraphicsPipeline(PSO_Render, psoDesc, "render.hlsl.vs.cso", "render.hlsl.ps.cso");
+
+		// PSO_RenderPacked: same pipeline for SPackedVertex
+		const D3D12_INPUT_ELEMENT_DESC packedInputElementDescs[] =
+		{
+			{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+		};
+		psoDesc.InputLayout = { packedInputElementDescs, _countof(packedInputElementDescs) };
+		AddGraphicsPipeline(PSO_RenderPacked, psoDesc, "renderPacked.hlsl.vs.cso", "render.hlsl.ps.cso");
 	}
 
 	// PSO_Present8bit
@@ -497,26 +519,6 @@ void D3D12Engine::CreatePipelines()
 		AddGraphicsPipeline(PSO_SampleEnvMap, psoDesc, "sampleEnvMap.hlsl.vs.cso", "sampleEnvMap.hlsl.ps.cso");
 	}
 
-	// PSO_CreateIrradianceMap
-	{
-		D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-		psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-		psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
-		psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
-		//psoDesc.RasterizerState.MultisampleEnable = NumSamples > 1 ? TRUE : FALSE;
-		psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
-		psoDesc.DepthStencilState = CD3DX12_DEPTH_STENCIL_DESC(D3D12_DEFAULT);
-		psoDesc.DepthStencilState.DepthEnable = FALSE;
-		//psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
-		psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-		psoDesc.NumRenderTargets = 1;
-		psoDesc.RTVFormats[0] = DXGI_FORMAT_R16G16B16A16_FLOAT;
-		psoDesc.SampleMask = UINT32_MAX;
-		psoDesc.SampleDesc.Count = 1;
-		//EA_ASSERT(OutPipelines.size() == PSO_SampleEnvMap);
-		AddGraphicsPipeline(PSO_CreateIrradianceMap, psoDesc, "createIrradianceMap.hlsl.vs.cso", "createIrradianceMap.hlsl.ps.cso");
-	}
-
 	// PSO_PrefilterEnvMap
 	{
 		D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
@@ -537,11 +539,6 @@ void D3D12Engine::CreatePipelines()
 		AddGraphicsPipeline(PSO_PrefilterEnvMap, psoDesc, "prefilterEnvMap.hlsl.vs.cso", "prefilterEnvMap.hlsl.ps.cso");
 	}
 
-	// PSO_CreateBRDFMap
-	{
-		AddComputePipeline(PSO_CreateBRDFMap, "createBRDFMap.hlsl.cs.cso");
-	}
-
 	// PSO_GenerateMips
 	{
 		AddComputePipeline(PSO_GenerateMips, "generateMipmaps.hlsl.cs.cso");
@@ -572,29 +569,27 @@ void D3D12Engine::LoadAssets()
 	// /*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*/
 	// Meshes
 	m_presentTriangle.Load(PresentVertices, PresentIndicies);
-	m_presentTriangle.CreateConstants(m_HH);
 	m_presentTriangle.CopyToUploadHeap(m_device.Get(), m_commandList.Get());
 	m_presentTriangle.ReleaseCPUData();
 
 	m_cube.Load(CubeVertices, CubeIndicies);
-	m_cube.CreateConstants(m_HH);
 	m_cube.CopyToUploadHeap(m_device.Get(), m_commandList.Get());
 	m_cube.ReleaseCPUData();
 
 	m_cubeInsideFacing.Load(CubeInVertices, CubeInIndicies);
-	m_cubeInsideFacing.CreateConstants(m_HH);
 	m_cubeInsideFacing.CopyToUploadHeap(m_device.Get(), m_commandList.Get());
 	m_cubeInsideFacing.ReleaseCPUData();
 
-	//SMesh floor;
-	//floor.Load(SquareVertices, SquareIndicies);
-	//floor.CreateConstants(m_HH);
-	//floor.MoveTo(XMFLOAT3(0.0f, -1.0f, 0.0f));
-	//floor.RotateBy(XMFLOAT3(-1.0f * XM_PI / 2.0f, 0.0f, 0.0f));
-	//floor.SetScale(20.0f);
-	//floor.CopyToUploadHeap(m_device.Get(), m_commandList.Get());
-	//floor.ReleaseCPUData();
-	//m_meshes.push_back(floor);
+	//auto floorMesh = std::make_shared<SMesh>();
+	//floorMesh->Load(SquareVertices, SquareIndicies);
+	//floorMesh->CopyToUploadHeap(m_device.Get(), m_commandList.Get());
+	//floorMesh->ReleaseCPUData();
+	//SMeshInstance floor(floorMesh, m_transforms.Create());
+	//floor.SetMaterialIndex(0);
+	//m_transforms.SetPosition(floor.GetTransform(), XMFLOAT3(0.0f, -1.0f, 0.0f));
+	//m_transforms.SetRotation(floor.GetTransform(), XMQuaternionRotationRollPitchYaw(-1.0f * XM_PI / 2.0f, 0.0f, 0.0f));
+	//m_transforms.SetScale(floor.GetTransform(), 20.0f);
+	//m_instances.push_back(floor);
 
 	// /*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*//*-+-*/
 	// Textures
@@ -617,77 +612,130 @@ void D3D12Engine::LoadAssets()
 	//	"glow",
 	//};
 
+	// Block compressed material textures. Normals keep X and Y only, the shader reconstructs Z.
+	STextureCache::Settings diffuseSettings, normalSettings, armSettings, emissionSettings;
+	diffuseSettings.compression = STextureCache::Compression::BC7;
+	normalSettings.compression = STextureCache::Compression::BC5;
+	armSettings.compression = STextureCache::Compression::BC7;
+	emissionSettings.compression = STextureCache::Compression::BC1;
+
 	for (std::string s : textureNames)
 	{
 		STexture t;
-		t.AddTexture("resources/" + s + "/textures/" + s + "_diff_1k.jpg");
-		t.AddTexture("resources/" + s + "/textures/" + s + "_nor_dx_1k.exr");
-		t.AddTexture("resources/" + s + "/textures/" + s + "_arm_1k.exr");
-		t.AddTexture("resources/" + s + "/textures/" + s + "_emission_1k.jpg");
+		t.AddTexture("resources/" + s + "/textures/" + s + "_diff_1k.jpg", diffuseSettings);
+		t.AddTexture("resources/" + s + "/textures/" + s + "_nor_dx_1k.exr", normalSettings);
+		t.AddTexture("resources/" + s + "/textures/" + s + "_arm_1k.exr", armSettings);
+		t.AddTexture("resources/" + s + "/textures/" + s + "_emission_1k.jpg", emissionSettings);
 		m_textures.push_back(t);
 	}
 
-	for (uint32_t i = 0; i < m_textures.size(); ++i)
-	{
-		STexture& t = m_textures[i];
+	// Decode the files of all materials at once
+	std::vector<STexture*> texturesToLoad;
+	for (STexture& t : m_textures)
+		texturesToLoad.push_back(&t);
+	STexture::LoadTextures(texturesToLoad.data(), texturesToLoad.size());
 
-		// Load texture
-		t.LoadTextures();
+	// Mip chains are cooked into the .stex caches, nothing to generate on the GPU
+	for (STexture& t : m_textures)
+	{
 		t.CopyToUploadHeap(m_device.Get(), m_commandList.Get(), m_HH);
 		t.ReleaseCPUData();
-		for (uint32_t i = 0; i < t.size(); ++i)
+	}
+
+	// Material table: the SRVs of every texture set, back to back, indexed by InstanceData::materialIndex
+	CD3DX12_CPU_DESCRIPTOR_HANDLE materialCPUHandle;
+	m_HH.AllocateGPUDescriptors((UINT32)m_textures.size() * MATERIAL_TEXTURE_COUNT, materialCPUHandle, m_SRV_materials);
+	for (STexture& t : m_textures)
+	{
+		for (uint32_t i = 0; i < MATERIAL_TEXTURE_COUNT; ++i)
 		{
-			auto texRes = t.GetTextureResource(i);
-			auto texSRV = t.GetSRV(i);
-			m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-				texRes.Get(),
-				D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-				D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE));
-			GenerateMips(texRes, texSRV, (uint16_t)-1);
-			m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-				texRes.Get(),
-				D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
-				D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+			m_device->CopyDescriptorsSimple(1, materialCPUHandle, t.GetCPUSRV(i), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			materialCPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
 		}
 	}
 
 	uint32_t sphereCount = m_textures.size();
 	for (uint32_t i = 0; i < sphereCount; ++i)
 	{
-		// Create sphere model for the texture
-		SMesh sphere;
-		sphere.Load("resources/meshes/Sphere.obj");
-		sphere.GenerateTangents();
-		sphere.CreateConstants(m_HH);
-		sphere.MoveTo(XMFLOAT3(-1.0f * sphereCount / 2.0f + i * 1.0f, 0.0f, 0.0f));
-		sphere.CopyToUploadHeap(m_device.Get(), m_commandList.Get());
-		sphere.ReleaseCPUData();
-		m_meshes.push_back(sphere);
+		// One sphere per texture, all sharing the mesh loaded for the first one
+		const uint32_t transform = m_transforms.Create();
+		m_transforms.SetPosition(transform, XMFLOAT3(-1.0f * sphereCount / 2.0f + i * 1.0f, 0.0f, 0.0f));
+		SMeshInstance sphere(m_meshRegistry.Load("resources/meshes/Sphere.obj", PACKED_VERTICES, m_device.Get(), m_commandList.Get()), transform);
+		sphere.SetMaterialIndex(i);
+		m_instances.push_back(sphere);
 	}
 }
 
 void D3D12Engine::LoadIBL(const char* filename)
 {
-	m_sphericalTexture.AddTexture(filename);
+	auto start = std::chrono::high_resolution_clock::now();
+	m_IBLSource = filename;
+	m_IBLSourceHash = SIBLBaker::HashSource(filename, m_IBLSettings);
+	m_IBLCachePath = SIBLCache::GetCachePath(SIBLCache::DEFAULT_DIRECTORY, m_IBLSourceHash);
+	std::chrono::duration<double, std::milli> hashTime = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("D3D12Engine: %s hashed in %.2f ms\n", filename, hashTime.count()).c_str());
+
+	m_IBLCacheHit = m_IBLSourceHash != 0 && LoadCachedIBL();
+	if (m_IBLCacheHit)
+	{
+		SetIBLDescriptors(m_compressedIBL.GetCPUSRV(SIBLCache::MAP_PREFILTERED));
+		return;
+	}
+
+	D3D12_CPU_DESCRIPTOR_HANDLE SRV_envMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
+	D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
+	BakeIBL(SRV_envMap, SRV_prefilteredEnvMap);
+	m_IBLBaked = m_IBLSourceHash != 0;
+
+	// \=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/ +
+	// Integrated BRDF Map
+	// /=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\ +
+	{
+		// From the table compiled in or the analytic fit, nothing left to integrate
+		start = std::chrono::high_resolution_clock::now();
+		std::vector<XMFLOAT2> LUT;
+		SBRDFLUT::Generate(m_IBLSettings.BRDFResolution, m_IBLSettings.BRDFMode, LUT);
+		STextureCache::Texture texture;
+		texture.name = "BRDF Integration Map";
+		SIBLBaker::CookBRDF(m_IBLSettings, LUT, m_IBLSourceHash, texture.image);
+		if (!STextureCache::Validate(texture.image.data(), texture.image.size(), m_IBLSourceHash,
+			STextureCache::HashSettings(SIBLCache::GetMapSettings(SIBLCache::MAP_BRDF)), texture.view))
+			throw std::runtime_error("Failed to cook the BRDF map");
+
+		m_BRDFTexture = STexture();
+		m_BRDFTexture.AddCooked(std::move(texture));
+		m_BRDFTexture.CopyToUploadHeap(m_device.Get(), m_commandList.Get(), m_HH);
+		m_BRDFTexture.ReleaseCPUData();
+		m_BRDFMap = m_BRDFTexture.GetTextureResource(0);
+		m_SRV_BRDFMap = m_BRDFTexture.GetSRV(0);
+		m_SRVCPU_BRDFMap = m_BRDFTexture.GetCPUSRV(0);
+
+		std::chrono::duration<double, std::milli> BRDFTime = std::chrono::high_resolution_clock::now() - start;
+		OutputDebugStringA(string_format("D3D12Engine: %u x %u BRDF map generated in %.2f ms\n", m_IBLSettings.BRDFResolution,
+			m_IBLSettings.BRDFResolution, BRDFTime.count()).c_str());
+	}
+
+	SetIBLDescriptors(SRV_prefilteredEnvMap);
+}
+
+void D3D12Engine::BakeIBL(D3D12_CPU_DESCRIPTOR_HANDLE SRV_envMap, D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap)
+{
+	// Only mip 0 of the panorama is sampled when it is projected onto the cube
+	STextureCache::Settings cookSettings;
+	cookSettings.generateMips = 0;
+	m_sphericalTexture.AddTexture(m_IBLSource, cookSettings);
 	m_sphericalTexture.LoadTextures();
 	m_sphericalTexture.CopyToUploadHeap(m_device.Get(), m_commandList.Get(), m_HH);
 	m_sphericalTexture.ReleaseCPUData();
 
-	const uint32_t resolution_envMap = 2048;
-	const uint32_t resolution_irradianceMap = 256;
-	const uint32_t resolution_prefilteredEnvMap = 256;
-	const uint32_t resolution_BRDFMap = 256;
-
-	D3D12_CPU_DESCRIPTOR_HANDLE SRV_envMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
-	D3D12_CPU_DESCRIPTOR_HANDLE SRV_irradianceMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
-	D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
-	D3D12_CPU_DESCRIPTOR_HANDLE SRV_BRDFMap = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
+	const uint32_t resolution_envMap = m_IBLSettings.envMapResolution;
+	const uint32_t resolution_prefilteredEnvMap = m_IBLSettings.prefilteredResolution;
 
 	// \=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/ +
 	// Environment map
 	// /=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\ +
 	{
-		uint32_t mipLevels = 9;
+		uint32_t mipLevels = m_IBLSettings.envMapMips;
 		auto Desc = CD3DX12_RESOURCE_DESC::Tex2D(
 			DXGI_FORMAT_R16G16B16A16_FLOAT,
 			resolution_envMap,
@@ -798,96 +846,11 @@ void D3D12Engine::LoadIBL(const char* filename)
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
 	}
 
-	// \=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/ +
-	// Irradiance Map
-	// /=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\ +
-	{
-		auto Desc = CD3DX12_RESOURCE_DESC::Tex2D(
-			DXGI_FORMAT_R16G16B16A16_FLOAT,
-			resolution_irradianceMap,
-			resolution_irradianceMap,
-			6,  // ArraySize (Cubemap has 6 faces)
-			1,  // MipLevels
-			1,  // SampleCount
-			0,  // SampleQuality
-			D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET  // Allow render target
-		);
-
-		CD3DX12_CLEAR_VALUE clearValue = {};
-		clearValue.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
-		memcpy(clearValue.Color, CLEAR_COLOR, sizeof(CLEAR_COLOR));
-
-		ThrowIfFailed(m_device->CreateCommittedResource(
-			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-			D3D12_HEAP_FLAG_NONE,
-			&Desc,
-			D3D12_RESOURCE_STATE_RENDER_TARGET,
-			&clearValue,
-			IID_PPV_ARGS(&m_irradianceMap)));
-		m_irradianceMap->SetName(L"Irradiance Map");
-
-		// Shader resource
-		D3D12_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
-		SRVDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
-		SRVDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		SRVDesc.TextureCube.MipLevels = (uint32_t)-1;
-		m_device->CreateShaderResourceView(m_irradianceMap.Get(), &SRVDesc, SRV_irradianceMap);
-		m_SRV_irradianceMap = m_HH.CopyDescriptorsToGPUHeap(1, SRV_irradianceMap);
-
-		// RTV for six faces
-		const D3D12_CPU_DESCRIPTOR_HANDLE RTVs = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 6);
-		D3D12_CPU_DESCRIPTOR_HANDLE currentRTV = RTVs;
-		for (uint32_t i = 0; i < 6; ++i)
-		{
-			D3D12_RENDER_TARGET_VIEW_DESC RTVDesc = {};
-			RTVDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
-			RTVDesc.Texture2DArray.ArraySize = 1;
-			RTVDesc.Texture2DArray.FirstArraySlice = i;
-			m_device->CreateRenderTargetView(m_irradianceMap.Get(), &RTVDesc, currentRTV);
-			currentRTV.ptr += m_HH.GetDescriptorSizeRTV();
-		}
-
-		D3D12_GPU_VIRTUAL_ADDRESS constMatrices_GPUAddr;
-		auto* constMatrices_CPUAddr = (CameraConstants*)m_HH.AllocateGPUMemory(6 * sizeof(CameraConstants), constMatrices_GPUAddr);
-
-		m_commandList->RSSetViewports(1, &CD3DX12_VIEWPORT(0.0f, 0.0f, static_cast<float>(resolution_irradianceMap), static_cast<float>(resolution_irradianceMap)));
-		m_commandList->RSSetScissorRects(1, &CD3DX12_RECT(0, 0, static_cast<LONG>(resolution_irradianceMap), static_cast<LONG>(resolution_irradianceMap)));
-		m_commandList->SetGraphicsRootSignature(m_rootSignatures[PSO_CreateIrradianceMap].Get());
-		m_commandList->SetPipelineState(m_pipelineStates[PSO_CreateIrradianceMap].Get());
-		m_HH.BindDescriptorHeaps(m_commandList.Get());
-
-		// Render six times
-		currentRTV = RTVs;
-		for (uint32_t i = 0; i < 6; ++i)
-		{
-			m_commandList->OMSetRenderTargets(1, &currentRTV, TRUE, nullptr);
-			m_commandList->ClearRenderTargetView(currentRTV, CLEAR_COLOR, 0, nullptr);
-
-			XMStoreFloat4x4(&constMatrices_CPUAddr->view, CubeViewTransforms[i]);
-			XMStoreFloat4x4(&constMatrices_CPUAddr->projection, CubeProjectionTransform);
-
-			// createIrradianceMap.hlsl
-			m_commandList->SetGraphicsRootConstantBufferView(0, constMatrices_GPUAddr);
-			m_commandList->SetGraphicsRootDescriptorTable(1, m_SRV_envMap);
-			m_cubeInsideFacing.ScheduleDraw(m_commandList.Get());
-
-			currentRTV.ptr += m_HH.GetDescriptorSizeRTV();
-			constMatrices_GPUAddr += sizeof(CameraConstants);
-			constMatrices_CPUAddr++;
-		}
-
-		// Transition the cube map to a shader resource
-		m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-			m_irradianceMap.Get(),
-			D3D12_RESOURCE_STATE_RENDER_TARGET,
-			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
-	}
-
 	// \=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/ +
 	// Pre-filtered Environment Map
 	// /=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\ +
 	{
-		uint32_t n_mipLevels = 6;  // 256, 128, 64, 32, 16, 8
+		uint32_t n_mipLevels = m_IBLSettings.prefilteredMips;  // 256, 128, 64, 32, 16, 8
 		auto Desc = CD3DX12_RESOURCE_DESC::Tex2D(
 			DXGI_FORMAT_R16G16B16A16_FLOAT,
 			resolution_prefilteredEnvMap,
@@ -985,61 +948,172 @@ void D3D12Engine::LoadIBL(const char* filename)
 			D3D12_RESOURCE_STATE_RENDER_TARGET,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
 	}
+}
 
-	// \=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/ +
-	// Integrated BRDF Map
-	// /=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\=/=\ +
+void D3D12Engine::SetIBLDescriptors(D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap)
+{
+	// IBL textures descriptor
+	CD3DX12_CPU_DESCRIPTOR_HANDLE CPUHandle;
+	m_HH.AllocateGPUDescriptors(2, CPUHandle, m_SRV_IBL);
+	//m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_envMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	//CPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
+	m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_prefilteredEnvMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	CPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
+	m_device->CopyDescriptorsSimple(1, CPUHandle, m_SRVCPU_BRDFMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+bool D3D12Engine::LoadCachedIBL()
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	SIBLCache::Touch(m_IBLCachePath.c_str());
+	MappedFile file;
+	if (!file.Open(m_IBLCachePath.c_str()))
+		return false;
+	SIBLCache::View view;
+	if (!SIBLCache::Validate(file.data(), file.size(), m_IBLSourceHash, view))
 	{
-		auto Desc = CD3DX12_RESOURCE_DESC::Tex2D(
-			DXGI_FORMAT_R16G16_FLOAT,
-			resolution_BRDFMap,
-			resolution_BRDFMap,
-			1,  // ArraySize
-			1,  // MipLevels
-			1,  // SampleCount
-			0,  // SampleQuality
-			D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS
-		);
+		OutputDebugStringA(string_format("D3D12Engine: %s is stale or corrupt, baking again\n", m_IBLCachePath.c_str()).c_str());
+		return false;
+	}
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("D3D12Engine: IBL cache %s hit, %.1f MB mapped and verified in %.2f ms\n", m_IBLCachePath.c_str(),
+		file.size() / (1024.0 * 1024.0), elapsed.count()).c_str());
+
+	// The maps point into one mapping, owned by the first of them
+	const char* const names[SIBLCache::MAP_COUNT] = { "environment", "prefiltered", "BRDF" };
+	std::vector<STextureCache::Texture> textures(SIBLCache::MAP_COUNT);
+	for (uint32_t i = 0; i < SIBLCache::MAP_COUNT; ++i)
+	{
+		textures[i].name = m_IBLCachePath + " " + names[i];
+		textures[i].view = view.maps[i];
+	}
+	textures[0].file = std::move(file);
+	UseCachedIBL(std::move(textures), view.irradianceSH);
+	return true;
+}
+
+void D3D12Engine::UseCachedIBL(std::vector<STextureCache::Texture> textures, const XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS])
+{
+	for (uint32_t i = 0; i < SSphericalHarmonics::IRRADIANCE_COEFFICIENTS; ++i)
+		m_pbrConstants->irradianceSH[i] = XMFLOAT4(irradianceSH[i].x, irradianceSH[i].y, irradianceSH[i].z, 0.0f);
+
+	m_compressedIBL = STexture();
+	for (STextureCache::Texture& texture : textures)
+		m_compressedIBL.AddCooked(std::move(texture));
+	m_compressedIBL.CopyToUploadHeap(m_device.Get(), m_commandList.Get(), m_HH);
+
+	m_envMap = m_compressedIBL.GetTextureResource(SIBLCache::MAP_ENVIRONMENT);
+	m_prefilteredEnvMap = m_compressedIBL.GetTextureResource(SIBLCache::MAP_PREFILTERED);
+	m_BRDFMap = m_compressedIBL.GetTextureResource(SIBLCache::MAP_BRDF);
+	m_SRV_envMap = m_compressedIBL.GetSRV(SIBLCache::MAP_ENVIRONMENT);
+	m_SRV_prefilteredEnvMap = m_compressedIBL.GetSRV(SIBLCache::MAP_PREFILTERED);
+	m_SRV_BRDFMap = m_compressedIBL.GetSRV(SIBLCache::MAP_BRDF);
+	m_SRVCPU_BRDFMap = m_compressedIBL.GetCPUSRV(SIBLCache::MAP_BRDF);
+}
+
+void D3D12Engine::CompressIBL()
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	// Copy every subresource of the baked maps into readback buffers
+	ID3D12Resource* const maps[SIBLCache::MAP_COUNT] = { m_envMap.Get(), m_prefilteredEnvMap.Get(), m_BRDFMap.Get() };
+	struct Readback
+	{
+		D3D12_RESOURCE_DESC desc;
+		std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints;
+		UINT64 size;
+		ComPtr<ID3D12Resource> buffer;
+	};
+	Readback readbacks[_countof(maps)];
+
+	ThrowIfFailed(m_commandAllocators[m_frameIndex]->Reset());
+	ThrowIfFailed(m_commandList->Reset(m_commandAllocators[m_frameIndex].Get(), nullptr));
+	for (uint32_t i = 0; i < _countof(maps); ++i)
+	{
+		Readback& readback = readbacks[i];
+		readback.desc = maps[i]->GetDesc();
+		const UINT subresourceCount = readback.desc.MipLevels * readback.desc.DepthOrArraySize;
+		readback.footprints.resize(subresourceCount);
+		m_device->GetCopyableFootprints(&readback.desc, 0, subresourceCount, 0, readback.footprints.data(), nullptr, nullptr, &readback.size);
 
 		ThrowIfFailed(m_device->CreateCommittedResource(
-			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK),
 			D3D12_HEAP_FLAG_NONE,
-			&Desc,
-			D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+			&CD3DX12_RESOURCE_DESC::Buffer(readback.size),
+			D3D12_RESOURCE_STATE_COPY_DEST,
 			nullptr,
-			IID_PPV_ARGS(&m_BRDFMap)));
-		m_BRDFMap->SetName(L"BRDF Integration Map");
+			IID_PPV_ARGS(&readback.buffer)));
 
-		// Shader resource
-		m_device->CreateShaderResourceView(m_BRDFMap.Get(), nullptr, SRV_BRDFMap);
-		m_SRV_BRDFMap = m_HH.CopyDescriptorsToGPUHeap(1, SRV_BRDFMap);
+		m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(maps[i], D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_SOURCE));
+		for (UINT s = 0; s < subresourceCount; ++s)
+		{
+			CD3DX12_TEXTURE_COPY_LOCATION dst(readback.buffer.Get(), readback.footprints[s]);
+			CD3DX12_TEXTURE_COPY_LOCATION src(maps[i], s);
+			m_commandList->CopyTextureRegion(&dst, 0, 0, 0, &src, nullptr);
+		}
+		m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(maps[i], D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+	}
+	ThrowIfFailed(m_commandList->Close());
+	ID3D12CommandList* readbackLists[] = { m_commandList.Get() };
+	m_commandQueue->ExecuteCommandLists(_countof(readbackLists), readbackLists);
+	WaitForPreviousFrame();
 
-		const D3D12_CPU_DESCRIPTOR_HANDLE UAV = m_HH.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
-		m_device->CreateUnorderedAccessView(m_BRDFMap.Get(), nullptr, nullptr, UAV);
-		D3D12_GPU_DESCRIPTOR_HANDLE UAV_GPU = m_HH.CopyDescriptorsToGPUHeap(1, UAV);
+	// Compress on the CPU, the encoder spreads block rows over every core
+	std::vector<STextureCache::Texture> textures(_countof(maps));
+	for (uint32_t i = 0; i < _countof(maps); ++i)
+	{
+		const STextureCache::Settings settings = SIBLCache::GetMapSettings(i);
+		Readback& readback = readbacks[i];
+		void* mapped;
+		CD3DX12_RANGE readRange(0, (SIZE_T)readback.size);
+		ThrowIfFailed(readback.buffer->Map(0, &readRange, &mapped));
+		std::vector<STextureCache::Subresource> subresources;
+		for (const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint : readback.footprints)
+			subresources.push_back({ (const uint8_t*)mapped + footprint.Offset, footprint.Footprint.RowPitch });
+
+		STextureCache::Texture& texture = textures[i];
+		texture.name = string_format("%s map %u", m_IBLCachePath.c_str(), i);
+		STextureCache::CookSubresources(subresources.data(), readback.desc.Format, (uint32_t)readback.desc.Width, readback.desc.Height,
+			readback.desc.MipLevels, readback.desc.DepthOrArraySize, i != SIBLCache::MAP_BRDF, settings, m_IBLSourceHash, texture.image);
+		CD3DX12_RANGE writeRange(0, 0);
+		readback.buffer->Unmap(0, &writeRange);
+
+		if (!STextureCache::Validate(texture.image.data(), texture.image.size(), m_IBLSourceHash, STextureCache::HashSettings(settings), texture.view))
+			throw std::runtime_error(string_format("Failed to compress %s", texture.name.c_str()));
+	}
+	std::chrono::duration<double, std::milli> compressTime = std::chrono::high_resolution_clock::now() - start;
 
-		// Create BRDFIntegrationMap.
-		m_commandList->SetComputeRootSignature(m_rootSignatures[PSO_CreateBRDFMap].Get());
-		m_commandList->SetPipelineState(m_pipelineStates[PSO_CreateBRDFMap].Get());
-		m_commandList->SetComputeRootDescriptorTable(0, UAV_GPU);
-		m_commandList->Dispatch(resolution_BRDFMap / 8, resolution_BRDFMap / 8, 1);
+	// The irradiance of the compressed environment map, as the cache will hand it back
+	XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+	SIBLBaker::ProjectIrradiance(textures[SIBLCache::MAP_ENVIRONMENT].view, m_IBLSettings.irradianceResolution, irradianceSH);
 
-		m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(
-			m_BRDFMap.Get(),
-			D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
-	}
+	auto writeStart = std::chrono::high_resolution_clock::now();
+	const std::vector<uint8_t>* const images[SIBLCache::MAP_COUNT] = { &textures[0].image, &textures[1].image, &textures[2].image };
+	if (SIBLCache::Write(m_IBLCachePath.c_str(), m_IBLSourceHash, images, irradianceSH))
+		SIBLCache::Evict(SIBLCache::DEFAULT_DIRECTORY, SIBLCache::DEFAULT_CAPACITY, m_IBLCachePath.c_str());
+	else
+		OutputDebugStringA(string_format("D3D12Engine: failed to write %s\n", m_IBLCachePath.c_str()).c_str());
+	std::chrono::duration<double, std::milli> writeTime = std::chrono::high_resolution_clock::now() - writeStart;
 
-	// IBL textures descriptor
-	CD3DX12_CPU_DESCRIPTOR_HANDLE CPUHandle;
-	m_HH.AllocateGPUDescriptors(3, CPUHandle, m_SRV_IBL);
-	//m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_envMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	//CPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
-	m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_irradianceMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	CPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
-	m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_prefilteredEnvMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	CPUHandle.Offset(1, m_HH.GetDescriptorSizeCBV_SRV_UAV());
-	m_device->CopyDescriptorsSimple(1, CPUHandle, SRV_BRDFMap, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	// Swap the baked maps for the cached ones. The GPU is idle, so the old ones can go right away.
+	ThrowIfFailed(m_commandAllocators[m_frameIndex]->Reset());
+	ThrowIfFailed(m_commandList->Reset(m_commandAllocators[m_frameIndex].Get(), nullptr));
+	UseCachedIBL(std::move(textures), irradianceSH);
+	SetIBLDescriptors(m_compressedIBL.GetCPUSRV(SIBLCache::MAP_PREFILTERED));
+	ThrowIfFailed(m_commandList->Close());
+	ID3D12CommandList* uploadLists[] = { m_commandList.Get() };
+	m_commandQueue->ExecuteCommandLists(_countof(uploadLists), uploadLists);
+	WaitForPreviousFrame();
+
+	m_compressedIBL.ReleaseUploadHeaps();
+	m_compressedIBL.ReleaseCPUData();
+	m_sphericalTexture.ReleaseGPUData();  // Only the bake samples the panorama
+	m_BRDFTexture.ReleaseGPUData();
+	m_IBLBaked = false;
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("D3D12Engine: IBL read back and compressed in %.2f ms, cache written in %.2f ms, %.2f ms in all\n",
+		compressTime.count(), writeTime.count(), elapsed.count()).c_str());
 }
 
 // This function expect the texture to be in NON_PIXEL_RESOURCE state.
@@ -1362,6 +1436,7 @@ void D3D12Engine::OnUpdate()
 	// #DXR Extra: Perspective Camera
 	UpdateCameraBuffer(elapsedTime);
 	RotateObject(elapsedTime);
+	m_transforms.Update();
 }
 
 // Render the scene.
@@ -1401,7 +1476,6 @@ void D3D12Engine::OnRender()
 	m_HH.BindDescriptorHeaps(m_commandList.Get());
 	m_commandList->SetGraphicsRootConstantBufferView(0, m_cameraConstants_GPUAddr);
 	m_commandList->SetGraphicsRootDescriptorTable(1, m_SRV_envMap);
-	//m_commandList->SetGraphicsRootDescriptorTable(1, m_SRV_irradianceMap);
 	m_cubeInsideFacing.ScheduleDraw(m_commandList.Get());
 
 	// ==--==--==--==--==--==--==--==--==--==--==--==--==--==--==--==
@@ -1418,12 +1492,75 @@ void D3D12Engine::OnRender()
 	m_commandList->SetGraphicsRootConstantBufferView(0, m_cameraConstants_GPUAddr);
 	m_commandList->SetGraphicsRootConstantBufferView(2, m_pbrConstants_GPUAddr);
 	m_commandList->SetGraphicsRootDescriptorTable(3, m_SRV_IBL);
+	m_commandList->SetGraphicsRootDescriptorTable(4, m_SRV_materials);
+
+	XMMATRIX viewProjection = XMLoadFloat4x4(&m_viewProjection);
 
-	for (uint32_t i = 0; i < m_meshes.size(); ++i)
+	// Frustum cull the sections of all instances at once
+	m_sceneBounds.clear();
+	for (uint32_t i = 0; i < m_instances.size(); ++i)
 	{
-		m_commandList->SetGraphicsRootConstantBufferView(1, m_meshes[i].GetGPUAddr());
-		m_commandList->SetGraphicsRootDescriptorTable(4, m_textures[i].GetCombinedSRV());
-		m_meshes[i].ScheduleDraw(m_commandList.Get());
+		XMMATRIX model = m_transforms.LoadWorldMatrix(m_instances[i].GetTransform());
+		const std::vector<SMeshSectionBounds>& sectionBounds = m_instances[i].GetMesh()->GetSectionBounds();
+		for (uint32_t s = 0; s < sectionBounds.size(); ++s)
+		{
+			m_sceneBounds.Add(i, s, sectionBounds[s], model);
+		}
+	}
+	XMFLOAT4 frustumPlanes[6];
+	SFrustumCulling::ExtractPlanes(viewProjection, frustumPlanes);
+	SFrustumCulling::Cull(m_sceneBounds, frustumPlanes, m_visibleDraws);
+
+	// Group the visible sections by mesh, section and LOD, each group becomes a single instanced draw
+	m_instanceBatcher.Clear();
+	m_batchMeshes.clear();
+	m_batchMeshIds.clear();
+	for (size_t v = 0; v < m_visibleDraws.size();)
+	{
+		const uint32_t i = m_sceneBounds.meshIndex[m_visibleDraws[v]];
+		SMesh* mesh = m_instances[i].GetMesh();
+		auto meshId = m_batchMeshIds.emplace(mesh, (uint32_t)m_batchMeshes.size());
+		if (meshId.second)
+			m_batchMeshes.push_back(mesh);
+
+		const uint32_t transform = m_instances[i].GetTransform();
+		float scale;
+		const float distance = mesh->GetLODDistance(m_transforms.LoadWorldMatrix(transform), cameraPosition, scale);
+		for (; v < m_visibleDraws.size() && m_sceneBounds.meshIndex[m_visibleDraws[v]] == i; ++v)
+		{
+			const uint32_t section = m_sceneBounds.sectionIndex[m_visibleDraws[v]];
+			const uint32_t lod = mesh->SelectLOD(section, distance, m_pixelsPerUnit * scale);
+			m_instanceBatcher.Add(meshId.first->second, section, lod, m_transforms.GetWorldMatrix(transform), m_transforms.GetNormalMatrix(transform),
+				m_instances[i].GetMaterialIndex());
+		}
+	}
+	m_instanceBatcher.Build();
+
+	m_commandList->SetGraphicsRootShaderResourceView(5, UploadInstances(m_instanceBatcher));
+
+	static_assert(sizeof(DrawConstants) == 9 * sizeof(UINT32), "Must match the RootConstants of render.hlsl");
+	for (const SInstanceBatch& batch : m_instanceBatcher.GetBatches())
+	{
+		SMesh* mesh = m_batchMeshes[batch.mesh];
+
+		DrawConstants drawConstants = {};
+		VertexPacking::GetDequantization(mesh->GetBoundsMin(), mesh->GetBoundsMax(), drawConstants.positionScale, drawConstants.positionOffset);
+		drawConstants.firstInstance = batch.firstInstance;
+
+		// Both pipelines share the root signature of render.hlsl, so the bindings above stay valid
+		m_commandList->SetPipelineState(m_pipelineStates[mesh->UsesPackedVertices() ? PSO_RenderPacked : PSO_Render].Get());
+		m_commandList->SetGraphicsRoot32BitConstants(1, sizeof(DrawConstants) / sizeof(UINT32), &drawConstants, 0);
+
+		// A lone instance at full detail keeps the meshlet culling of SMesh::ScheduleDraw
+		if (batch.instanceCount == 1 && batch.lod == 0)
+		{
+			XMMATRIX model = XMLoadFloat4x4(&m_instanceBatcher.GetInstance(batch.firstInstance).model);
+			mesh->ScheduleDraw(m_commandList.Get(), model, viewProjection, cameraPosition, m_pixelsPerUnit, &batch.section, 1);
+		}
+		else
+		{
+			mesh->ScheduleDrawInstanced(m_commandList.Get(), batch.section, batch.lod, batch.instanceCount);
+		}
 	}
 
 	// ==--==--==--==--==--==--==--==--==--==--==--==--==--==--==--==
@@ -1666,16 +1803,39 @@ void D3D12Engine::UpdateCameraBuffer(float deltaTime) {
 	memcpy(&m_cameraConstants->view, &view, sizeof(XMMATRIX));
 	memcpy(&m_cameraConstants->projection, &projection, sizeof(XMMATRIX));
 	memcpy(&m_pbrConstants->eyePosition, &cameraPosition, sizeof(XMFLOAT3));
+	XMStoreFloat4x4(&m_viewProjection, view * projection);
+	m_pixelsPerUnit = 0.5f * m_height / tanf(0.5f * fovAngleY);
 }
 
 void D3D12Engine::RotateObject(float deltaTime)
 {
 	// Rotate the object
 	static const float rotationRate = 0.02f;
-	for (int i = 0; i < m_meshes.size(); ++i)
+	m_transforms.RotateAll(XMQuaternionRotationRollPitchYaw(0.0f, rotationRate * deltaTime, 0.0f));
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12Engine::UploadInstances(const SInstanceBatcher& batcher)
+{
+	// WaitForPreviousFrame has finished the last frame that read this buffer, so it can be rewritten or replaced
+	ComPtr<ID3D12Resource>& buffer = m_instanceBuffers[m_frameIndex];
+	if (!buffer || m_instanceBufferCapacity[m_frameIndex] < batcher.size())
 	{
-		m_meshes[i].RotateBy(XMFLOAT3(0.0f, rotationRate * deltaTime, 0.0f));
+		const size_t capacity = std::max<size_t>(std::max(batcher.size(), 2 * m_instanceBufferCapacity[m_frameIndex]), 256);
+		buffer = nullptr;
+		ThrowIfFailed(m_device->CreateCommittedResource(
+			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+			D3D12_HEAP_FLAG_NONE,
+			&CD3DX12_RESOURCE_DESC::Buffer(capacity * sizeof(InstanceData)),
+			D3D12_RESOURCE_STATE_GENERIC_READ,
+			nullptr,
+			IID_PPV_ARGS(&buffer)));
+		ThrowIfFailed(buffer->Map(0, &CD3DX12_RANGE(0, 0), (void**)&m_instanceBufferData[m_frameIndex]));
+		m_instanceBufferCapacity[m_frameIndex] = capacity;
 	}
+
+	// One streaming pass straight into the upload heap
+	batcher.WriteInstances(m_instanceBufferData[m_frameIndex]);
+	return buffer->GetGPUVirtualAddress();
 }
 
 // #DXR Extra: Perspective Camera++
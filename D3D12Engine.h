@@ -5,6 +5,7 @@
 #include <dxcapi.h>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <Windows.h>
 #include <memory>
 #include "StepTimer.h"
@@ -14,7 +15,13 @@
 #include "ShaderSharedStructs.h"
 #include "HelperFunctions.h"
 #include "SMesh.h"
+#include "SMeshInstance.h"
+#include "SMeshRegistry.h"
+#include "SFrustumCulling.h"
+#include "SInstanceBatcher.h"
+#include "STransformStore.h"
 #include "STexture.h"
+#include "SIBLBaker.h"
 
 // Note that while ComPtr is used to manage the lifetime of resources on the CPU,
 // it has no understanding of the lifetime of resources on the GPU. Apps must account
@@ -40,6 +47,9 @@ namespace
 	// HDR rendering configurations
 	constexpr DXGI_FORMAT HDR_FORMAT = DXGI_FORMAT_R16G16B16A16_FLOAT;
 
+	// Upload scene meshes as 20 byte SPackedVertex instead of 56 byte SVertex
+	constexpr bool PACKED_VERTICES = false;
+
 	// Camera parameters
 	constexpr float CAMERA_SENSITIVITY = 0.05f;   // Mouse movement sensitivity
 	constexpr float CAMERA_SPEED = 2.0f;      // Keyboard movement speed (units per second)
@@ -48,12 +58,11 @@ namespace
 	enum
 	{
 		PSO_Render = 0,
+		PSO_RenderPacked,
 		PSO_Present8bit,
 		PSO_Spherical2Cube,
 		PSO_SampleEnvMap,
-		PSO_CreateIrradianceMap,
 		PSO_PrefilterEnvMap,
-		PSO_CreateBRDFMap,
 		PSO_GenerateMips,
 		PSO_Thresholding,
 		PSO_UpsampleBlend,
@@ -142,6 +151,8 @@ private:
 	DirectX::XMFLOAT3 cameraRight;    // Initial right vector
 	float cameraYaw;    // Horizontal rotation
 	float cameraPitch;  // Vertical rotation
+	DirectX::XMFLOAT4X4 m_viewProjection; // view * projection of the current frame, for culling
+	float m_pixelsPerUnit;                // Pixels covered by one world unit at distance 1, for LOD selection
 
 	StepTimer m_timer;
 	bool keyStates[256] = { false };
@@ -170,26 +181,65 @@ private:
 	SMesh m_presentTriangle;
 	SMesh m_cube;
 	SMesh m_cubeInsideFacing;
-	std::vector<SMesh> m_meshes;
-
-	// Object textures
+	SMeshRegistry m_meshRegistry;
+	std::vector<SMeshInstance> m_instances;
+	STransformStore m_transforms;
+
+	// World space bounds of every section of [m_instances], rebuilt and frustum culled each frame
+	SSceneBounds m_sceneBounds;
+	std::vector<uint32_t> m_visibleDraws;  // Indices into [m_sceneBounds], grouped by instance
+
+	// Visible sections grouped into instanced draws. Meshes are identified by their index in [m_batchMeshes].
+	SInstanceBatcher m_instanceBatcher;
+	std::vector<SMesh*> m_batchMeshes;
+	std::unordered_map<const SMesh*, uint32_t> m_batchMeshIds;
+
+	// InstanceData read by render.hlsl, one persistently mapped upload buffer per frame in flight
+	ComPtr<ID3D12Resource> m_instanceBuffers[FRAME_COUNT];
+	InstanceData* m_instanceBufferData[FRAME_COUNT] = {};
+	size_t m_instanceBufferCapacity[FRAME_COUNT] = {};
+	D3D12_GPU_VIRTUAL_ADDRESS UploadInstances(const SInstanceBatcher& batcher);
+
+	// Object textures, the material index of an instance selects one of them
 	std::vector<STexture> m_textures;
+	// SRVs of all [m_textures], MATERIAL_TEXTURE_COUNT per material
+	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_materials;
 
 	// -------------------------------------------------------
 	// Environment Map
 	// -------------------------------------------------------
 	STexture m_sphericalTexture;
 	ComPtr<ID3D12Resource> m_envMap;
-	ComPtr<ID3D12Resource> m_irradianceMap;
 	ComPtr<ID3D12Resource> m_prefilteredEnvMap;
 	ComPtr<ID3D12Resource> m_BRDFMap;
 	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_envMap;
-	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_irradianceMap;
 	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_prefilteredEnvMap;
 	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_BRDFMap;
+	D3D12_CPU_DESCRIPTOR_HANDLE m_SRVCPU_BRDFMap;
 	D3D12_GPU_DESCRIPTOR_HANDLE m_SRV_IBL;
 
+	// Everything baked from the HDRI is cached in one .sibl file, keyed on its contents and [m_IBLSettings].
+	// A first launch bakes on the GPU and compresses after the bake, later ones only map the cache and upload it.
+	// Diffuse lighting needs no map: it is the SH9 irradiance in [m_pbrConstants], projected on the CPU.
+	// The cache is that of SIBLBaker, so D3D12Engine.exe -bakeibl can write it ahead of time.
+	STexture m_compressedIBL;  // Maps in SIBLCache::Map order
+	STexture m_BRDFTexture;  // The LUT of a bake, from SBRDFLUT, until CompressIBL swaps the cached one in
+	SIBLBaker::Settings m_IBLSettings;
+	std::string m_IBLSource;
+	uint64_t m_IBLSourceHash = 0;
+	std::string m_IBLCachePath;
+	bool m_IBLCacheHit = false;
+	bool m_IBLBaked = false;  // Baked this launch, CompressIBL still has to run
+
 	void LoadIBL(const char* filename);
+	void BakeIBL(D3D12_CPU_DESCRIPTOR_HANDLE SRV_envMap, D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap);
+	// Maps [m_IBLCachePath] and schedules its upload; false if it is missing, stale or corrupt
+	bool LoadCachedIBL();
+	// Reads the baked maps back, compresses the cubemaps, projects the irradiance, writes the cache and swaps the
+	// cached maps in. Submits and waits for its own command lists.
+	void CompressIBL();
+	void UseCachedIBL(std::vector<STextureCache::Texture> textures, const DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS]);
+	void SetIBLDescriptors(D3D12_CPU_DESCRIPTOR_HANDLE SRV_prefilteredEnvMap);
 
 	// -------------------------------------------------------
 	// Mipmaps
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// xxHash64-style hash, used to key caches on the content of their source file and to checksum them.
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+// HashBytes of the whole file through a MappedFile. Returns 0 if the file can't be read.
+uint64_t HashFile(const char* filename);
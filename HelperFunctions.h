@@ -1,10 +1,12 @@
 #pragma once
 
 #include "stdafx.h"
+#include "MappedFile.h"
+#include "ParallelFor.h"
+#include "StringFormat.h"
 #include <string>
 #include <vector>
-#include <memory>
-#include <stdexcept>
+#include <algorithm>
 
 // String endswith function
 inline bool ends_with(std::string const& value, std::string const& ending)
@@ -19,16 +21,5 @@ inline UINT AlignAs256(UINT size) {
 	return (size + alignment - 1) & ~(alignment - 1);
 }
 
-template<typename ... Args>
-std::string string_format(const std::string& format, Args ... args)
-{
-    int size_s = std::snprintf(nullptr, 0, format.c_str(), args ...) + 1; // Extra space for '\0'
-    if (size_s <= 0) { throw std::runtime_error("Error during formatting."); }
-    auto size = static_cast<size_t>(size_s);
-    std::unique_ptr<char[]> buf(new char[size]);
-    std::snprintf(buf.get(), size, format.c_str(), args ...);
-    return std::string(buf.get(), buf.get() + size - 1); // We don't want the '\0' inside
-}
-
 std::vector<uint8_t> LoadBytecodeFromFile(const char* name);
 DXGI_FORMAT GetCompatableFormat(DXGI_FORMAT f, int& sRGB);
\ No newline at end of file
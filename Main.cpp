@@ -11,10 +11,245 @@
 
 #include "stdafx.h"
 #include "D3D12Engine.h"
+#include "SBRDFLUT.h"
+#include "SIBLBaker.h"
+#include "SMeshCache.h"
+#include "STexture.h"
+#include "STextureCompression.h"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace DirectX;
+
+// D3D12Engine.exe -cookmesh <source> [<output.smesh>]
+// Converts a mesh into a .smesh cache without creating a window.
+// The output defaults to the cache path SMesh::Load looks for.
+static int CookMesh(LPWSTR* argv, int argc)
+{
+	char source[MAX_PATH];
+	char output[MAX_PATH];
+	WideCharToMultiByte(CP_ACP, 0, argv[2], -1, source, MAX_PATH, nullptr, nullptr);
+	if (argc > 3)
+		WideCharToMultiByte(CP_ACP, 0, argv[3], -1, output, MAX_PATH, nullptr, nullptr);
+	else
+		strcpy_s(output, SMeshCache::GetCachePath(source).c_str());
+
+	uint64_t sourceHash = SMeshCache::HashSource(source);
+	if (sourceHash == 0)
+	{
+		fprintf(stderr, "Failed to read %s\n", source);
+		return 1;
+	}
+
+	try
+	{
+		SMesh mesh;
+		mesh.Load(source);
+		return mesh.SaveCache(output, sourceHash) ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+}
+
+// D3D12Engine.exe -cooktexture <source> [<output.stex>] [-nomips] [-bc1|-bc4|-bc5|-bc6h|-bc7] [-fast|-high]
+// Decodes a texture and writes it with its mip chain as a .stex cache without creating a window.
+// The output defaults to the cache path STexture::LoadTextures looks for.
+static int CookTexture(LPWSTR* argv, int argc)
+{
+	STextureCache::Settings settings;
+	char source[MAX_PATH];
+	char output[MAX_PATH];
+	WideCharToMultiByte(CP_ACP, 0, argv[2], -1, source, MAX_PATH, nullptr, nullptr);
+	strcpy_s(output, STextureCache::GetCachePath(source).c_str());
+	for (int i = 3; i < argc; ++i)
+	{
+		if (_wcsicmp(argv[i], L"-nomips") == 0)
+			settings.generateMips = 0;
+		else if (_wcsicmp(argv[i], L"-bc1") == 0)
+			settings.compression = STextureCache::Compression::BC1;
+		else if (_wcsicmp(argv[i], L"-bc4") == 0)
+			settings.compression = STextureCache::Compression::BC4;
+		else if (_wcsicmp(argv[i], L"-bc5") == 0)
+			settings.compression = STextureCache::Compression::BC5;
+		else if (_wcsicmp(argv[i], L"-bc6h") == 0)
+			settings.compression = STextureCache::Compression::BC6H;
+		else if (_wcsicmp(argv[i], L"-bc7") == 0)
+			settings.compression = STextureCache::Compression::BC7;
+		else if (_wcsicmp(argv[i], L"-fast") == 0)
+			settings.quality = STextureCompression::Quality::Fast;
+		else if (_wcsicmp(argv[i], L"-high") == 0)
+			settings.quality = STextureCompression::Quality::High;
+		else
+			WideCharToMultiByte(CP_ACP, 0, argv[i], -1, output, MAX_PATH, nullptr, nullptr);
+	}
+
+	try
+	{
+		return STexture::CookFile(source, output, settings) ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+}
+
+// D3D12Engine.exe -bakeibl <hdri> [-samples <n>] [-threads <n>] [-mis]
+// Bakes the image based lighting of an equirectangular HDRI on the CPU and writes the .sibl cache the engine loads at
+// startup, without creating a window or a device. [samples] are the GGX samples per pre-filtered texel; the engine only
+// loads caches baked with the shader's count, the default. -mis pre-filters with SIBLBaker::PrefilterMIS instead,
+// 1/32 of the shader's count unless [samples] says otherwise. Prints the time of each stage of this cold start, and
+// that of the warm one that follows: hashing the HDRI, then mapping and verifying the cache.
+static int BakeIBL(LPWSTR* argv, int argc)
+{
+	SIBLBaker::Settings settings;
+	char source[MAX_PATH];
+	WideCharToMultiByte(CP_ACP, 0, argv[2], -1, source, MAX_PATH, nullptr, nullptr);
+	bool samplesGiven = false;
+	for (int i = 3; i < argc; ++i)
+	{
+		if (_wcsicmp(argv[i], L"-mis") == 0)
+			settings.prefilterMIS = true;
+		else if (_wcsicmp(argv[i], L"-samples") == 0 && i + 1 < argc)
+		{
+			settings.prefilterSamples = std::max(1, _wtoi(argv[++i]));
+			samplesGiven = true;
+		}
+		else if (_wcsicmp(argv[i], L"-threads") == 0 && i + 1 < argc)
+			settings.maxThreads = std::max(0, _wtoi(argv[++i]));
+	}
+	if (settings.prefilterMIS && !samplesGiven)
+		settings.prefilterSamples /= 32;
+
+	try
+	{
+		// Both starts hash the HDRI to find the cache
+		auto start = std::chrono::high_resolution_clock::now();
+		const uint64_t key = SIBLBaker::HashSource(source, settings);
+		std::chrono::duration<double, std::milli> hash = std::chrono::high_resolution_clock::now() - start;
+		if (key == 0)
+		{
+			fprintf(stderr, "Failed to read %s\n", source);
+			return 1;
+		}
+		const std::string path = SIBLCache::GetCachePath(SIBLCache::DEFAULT_DIRECTORY, key);
+
+		SIBLBaker::Result result;
+		start = std::chrono::high_resolution_clock::now();
+		{
+			uint32_t width, height;
+			const std::vector<uint16_t> panorama = STexture::DecodeHalfRGBA(source, width, height);
+			result.timings.decode = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+			SIBLBaker::Bake(panorama.data(), width, height, settings, result);
+		}
+		std::chrono::duration<double, std::milli> bake = std::chrono::high_resolution_clock::now() - start;
+
+		start = std::chrono::high_resolution_clock::now();
+		const bool written = SIBLBaker::WriteCache(path.c_str(), key, settings, result);
+		if (written)
+			SIBLCache::Evict(SIBLCache::DEFAULT_DIRECTORY, SIBLCache::DEFAULT_CAPACITY, path.c_str());
+		std::chrono::duration<double, std::milli> write = std::chrono::high_resolution_clock::now() - start;
+
+		const SIBLBaker::Timings& t = result.timings;
+		printf("IBL cold start of %s: hash %.1f ms, decode %.1f ms, environment map %.1f ms, mips %.1f ms, "
+			"irradiance %.1f ms, pre-filter (%u samples%s) %.1f ms, BRDF LUT %.1f ms, bake %.1f ms; BC6H and cache %.1f ms%s\n", source, hash.count(),
+			t.decode, t.envMap, t.mips, t.irradiance, settings.prefilterSamples, settings.prefilterMIS ? ", MIS" : "", t.prefilter, t.BRDF, bake.count(), write.count(),
+			written ? "" : ", NOT WRITTEN");
+		if (!written)
+			return 1;
+
+		start = std::chrono::high_resolution_clock::now();
+		MappedFile file;
+		SIBLCache::View view;
+		const bool valid = file.Open(path.c_str()) && SIBLCache::Validate(file.data(), file.size(), key, view);
+		std::chrono::duration<double, std::milli> load = std::chrono::high_resolution_clock::now() - start;
+		printf("IBL warm start of %s: hash %.1f ms, %s (%.1f MB) mapped and verified in %.1f ms%s\n", source, hash.count(),
+			path.c_str(), file.size() / (1024.0 * 1024.0), load.count(), valid ? "" : ", INVALID");
+		return valid ? 0 : 1;
+	}
+	catch (const std::exception& e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+}
+
+// D3D12Engine.exe -genbrdf <output.h> [<resolution>] [<samples>]
+// Integrates the split sum BRDF LUT on the CPU with SIBLBaker::IntegrateBRDF, 256 x 256 texels of 65536 samples by
+// default, and writes it as the table header SBRDFLUT compiles in (SBRDFLUTTable.h). Run it again after changing
+// the integral, along with SIBLBaker::BAKE_VERSION.
+static int GenerateBRDFTable(LPWSTR* argv, int argc)
+{
+	char output[MAX_PATH];
+	WideCharToMultiByte(CP_ACP, 0, argv[2], -1, output, MAX_PATH, nullptr, nullptr);
+	const uint32_t resolution = argc > 3 ? std::max(1, _wtoi(argv[3])) : 256;
+	const uint32_t samples = argc > 4 ? std::max(1, _wtoi(argv[4])) : 65536;
+
+	auto start = std::chrono::high_resolution_clock::now();
+	std::vector<XMFLOAT2> LUT;
+	SIBLBaker::IntegrateBRDF(resolution, samples, LUT);
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	if (!SBRDFLUT::WriteTable(output, LUT, resolution, samples))
+	{
+		fprintf(stderr, "Failed to write %s\n", output);
+		return 1;
+	}
+	printf("%s: %u x %u BRDF LUT, %u samples integrated in %.1f ms\n", output, resolution, resolution, samples, elapsed.count());
+	return 0;
+}
+
+// Command line tools, which run instead of the demo
+struct Tool
+{
+	const wchar_t* name;
+	int (*run)(LPWSTR* argv, int argc);
+	int requiredArguments;  // After the name
+	const char* usage;
+};
+
+static const Tool TOOLS[] =
+{
+	{ L"-cookmesh", CookMesh, 1, "-cookmesh <source> [<output.smesh>]" },
+	{ L"-cooktexture", CookTexture, 1, "-cooktexture <source> [<output.stex>] [-nomips] [-bc1|-bc4|-bc5|-bc6h|-bc7] [-fast|-high]" },
+	{ L"-bakeibl", BakeIBL, 1, "-bakeibl <hdri> [-samples <n>] [-threads <n>] [-mis]" },
+	{ L"-genbrdf", GenerateBRDFTable, 1, "-genbrdf <output.h> [<resolution>] [<samples>]" },
+};
+
+// A Windows subsystem program starts without standard streams. Tools print to the console they were started from,
+// if any.
+static void AttachParentConsole()
+{
+	if (!AttachConsole(ATTACH_PARENT_PROCESS))
+		return;
+	FILE* stream;
+	freopen_s(&stream, "CONOUT$", "w", stdout);
+	freopen_s(&stream, "CONOUT$", "w", stderr);
+}
 
 _Use_decl_annotations_
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow)
 {
+	int argc;
+	LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+	for (const Tool& tool : TOOLS)
+	{
+		if (argc < 2 || _wcsicmp(argv[1], tool.name) != 0)
+			continue;
+		AttachParentConsole();
+		int result = 1;
+		if (argc - 2 < tool.requiredArguments)
+			fprintf(stderr, "Usage: D3D12Engine.exe %s\n", tool.usage);
+		else
+			result = tool.run(argv, argc);
+		LocalFree(argv);
+		return result;
+	}
+	LocalFree(argv);
+
 	D3D12Engine sample(1280, 720, L"D3D12 Engine Demo");
 	return Win32Application::Run(&sample, hInstance, nCmdShow);
 }
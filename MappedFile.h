@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+// Read-only memory mapping of an entire file.
+class MappedFile
+{
+private:
+#ifdef _WIN32
+	void* m_file = nullptr;     // HANDLE, null when closed
+	void* m_mapping = nullptr;  // HANDLE
+#else
+	int m_file = -1;
+#endif
+	const uint8_t* m_data = nullptr;
+	uint64_t m_size = 0;
+
+public:
+	MappedFile() = default;
+	~MappedFile() { Close(); }
+
+	// Copying is not allowed
+	MappedFile(const MappedFile& other) = delete;
+	MappedFile& operator=(const MappedFile& other) = delete;
+
+	MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			std::swap(m_file, other.m_file);
+#ifdef _WIN32
+			std::swap(m_mapping, other.m_mapping);
+#endif
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+		}
+		return *this;
+	}
+
+	// Returns false if the file does not exist or is empty.
+	bool Open(const char* filename);
+	void Close();
+
+	inline const uint8_t* data() const { return m_data; }
+	inline uint64_t size() const { return m_size; }
+	inline bool loaded() const { return m_data != nullptr; }
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Calls func(i) for every i in [0, count) from up to [maxThreads] threads (0: one per core).
+// Items are handed out one at a time, so each call should carry a reasonable amount of work.
+template<typename Func>
+void ParallelFor(uint32_t count, Func&& func, uint32_t maxThreads = 0)
+{
+	if (maxThreads == 0)
+		maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	uint32_t threadCount = std::min(maxThreads, count);
+	if (threadCount <= 1)
+	{
+		for (uint32_t i = 0; i < count; ++i)
+			func(i);
+		return;
+	}
+
+	std::atomic<uint32_t> next(0);
+	auto worker = [&]()
+	{
+		for (uint32_t i = next++; i < count; i = next++)
+			func(i);
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+	for (uint32_t t = 1; t < threadCount; ++t)
+		threads.emplace_back(worker);
+	worker();
+	for (std::thread& t : threads)
+		t.join();
+}
+
+// ParallelFor for items that may throw. Every item runs; afterwards the exception of the first item that threw,
+// in item order, is rethrown on the calling thread, so errors don't depend on how the threads were scheduled.
+template<typename Func>
+void ParallelForRethrow(uint32_t count, Func&& func, uint32_t maxThreads = 0)
+{
+	std::vector<std::exception_ptr> errors(count);
+	ParallelFor(count, [&](uint32_t i)
+	{
+		try
+		{
+			func(i);
+		}
+		catch (...)
+		{
+			errors[i] = std::current_exception();
+		}
+	}, maxThreads);
+
+	for (const std::exception_ptr& error : errors)
+	{
+		if (error)
+			std::rethrow_exception(error);
+	}
+}
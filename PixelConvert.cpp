@@ -0,0 +1,823 @@
+#include "PixelConvert.h"
+
+#include "CpuInfo.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
+
+using namespace PixelConvert;
+
+namespace
+{
+	inline uint32_t FloatBits(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	inline float BitsFloat(uint32_t bits)
+	{
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	// -------------------------------------------------------
+	// Tables
+	// -------------------------------------------------------
+
+	// sRGB decoding, and encoding by bucket: linear values from 2^-13 up to 1 are split into buckets of
+	// 1/128 of an octave (the top 7 mantissa bits), narrower than the gap between two encoded bytes, so a
+	// bucket holds at most one threshold and encoding is one lookup and one compare.
+	constexpr uint32_t SRGB_BUCKET_FIRST = 114u << 23;  // 2^-13, below the first threshold
+	constexpr uint32_t SRGB_BUCKET_SHIFT = 16;
+	constexpr uint32_t SRGB_BUCKET_COUNT = ((127u << 23) - SRGB_BUCKET_FIRST) >> SRGB_BUCKET_SHIFT;
+
+	struct SRGBTables
+	{
+		float toLinear[512];  // 256 sRGB bytes, then 256 UNORM bytes for alpha
+		float thresholds[256];  // Linear values half way between two consecutive bytes, then infinity
+		int32_t bucketBase[SRGB_BUCKET_COUNT];  // Thresholds at or below the start of each bucket
+
+		SRGBTables()
+		{
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				const float c = i / 255.0f;
+				toLinear[i] = c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+				toLinear[256 + i] = c;
+			}
+			for (uint32_t i = 0; i < 255; ++i)
+				thresholds[i] = 0.5f * (toLinear[i] + toLinear[i + 1]);
+			thresholds[255] = INFINITY;
+			assert(thresholds[0] > BitsFloat(SRGB_BUCKET_FIRST));
+
+			for (uint32_t b = 0; b < SRGB_BUCKET_COUNT; ++b)
+			{
+				const float begin = BitsFloat(SRGB_BUCKET_FIRST + (b << SRGB_BUCKET_SHIFT));
+				const float end = BitsFloat(SRGB_BUCKET_FIRST + ((b + 1) << SRGB_BUCKET_SHIFT));
+				bucketBase[b] = (int32_t)(std::upper_bound(thresholds, thresholds + 255, begin) - thresholds);
+				assert(thresholds[bucketBase[b] + 1] >= end || bucketBase[b] == 255);
+				(void)end;
+			}
+		}
+	};
+
+	const SRGBTables& GetSRGBTables()
+	{
+		static const SRGBTables tables;
+		return tables;
+	}
+
+	// -------------------------------------------------------
+	// Scalar kernels, the reference for the others
+	// -------------------------------------------------------
+
+	inline uint16_t FloatToHalfScalar(float value)
+	{
+		uint32_t f = FloatBits(value);
+		const uint32_t sign = (f >> 16) & 0x8000;
+		f &= 0x7FFFFFFF;
+
+		uint32_t h;
+		if (f > 0x7F800000)
+			h = 0x7E00 | ((f >> 13) & 0x3FF);  // NaN, quieted
+		else if (f >= 0x477FF000)
+			h = 0x7C00;  // Rounds past 65504, or infinity
+		else if (f >= 0x38800000)
+			h = (f - 0x38000000 + 0xFFF + ((f >> 13) & 1)) >> 13;  // Normal: rebias, round to nearest even
+		else
+		{
+			// Denormal: the mantissa with its implicit bit, in units of 2^-24
+			const uint32_t shift = 126 - (f >> 23);
+			const uint32_t mantissa = (f & 0x7FFFFF) | 0x800000;
+			if (shift > 24)
+				h = 0;
+			else
+			{
+				const uint32_t halfway = 1u << (shift - 1);
+				const uint32_t remainder = mantissa & ((1u << shift) - 1);
+				h = mantissa >> shift;
+				h += remainder > halfway || (remainder == halfway && (h & 1)) ? 1 : 0;
+			}
+		}
+		return (uint16_t)(sign | h);
+	}
+
+	inline float HalfToFloatScalar(uint16_t h)
+	{
+		const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+		const uint32_t exponent = (h >> 10) & 0x1F;
+		const uint32_t mantissa = h & 0x3FF;
+		if (exponent == 0x1F)
+			return BitsFloat(sign | 0x7F800000 | (mantissa << 13) | (mantissa ? 0x400000 : 0));
+		if (exponent == 0)
+			return BitsFloat(sign | FloatBits(mantissa * (1.0f / 16777216.0f)));
+		return BitsFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+	}
+
+	inline uint8_t FloatToUNorm8Scalar(float value)
+	{
+		float c = value > 0.0f ? value : 0.0f;
+		c = c < 1.0f ? c : 1.0f;
+		return (uint8_t)(c * 255.0f + 0.5f);
+	}
+
+	inline uint8_t LinearToSRGBScalar(const SRGBTables& tables, float value)
+	{
+		if (value >= 1.0f)
+			return 255;
+		if (!(value >= BitsFloat(SRGB_BUCKET_FIRST)))
+			return 0;
+		const int32_t base = tables.bucketBase[(FloatBits(value) - SRGB_BUCKET_FIRST) >> SRGB_BUCKET_SHIFT];
+		return (uint8_t)(base + (value >= tables.thresholds[base] ? 1 : 0));
+	}
+
+	// One channel of R11G11B10: [mantissaBits] 6 for red and green, 5 for blue
+	inline uint32_t ToPackedFloatScalar(float value, uint32_t mantissaBits)
+	{
+		uint32_t f = FloatBits(value);
+		const uint32_t shift = 23 - mantissaBits;
+		const uint32_t infinity = 0x1Fu << mantissaBits;
+		const uint32_t mask = (1u << (mantissaBits + 5)) - 1;
+		const uint32_t maxFinite = mantissaBits == 6 ? 0x477E0000 : 0x477C0000;
+		const uint32_t minDenormal = mantissaBits == 6 ? 0x35800000 : 0x36000000;
+
+		if ((f & 0x7F800000) == 0x7F800000)
+		{
+			if (f & 0x7FFFFF)
+				return mask;  // NaN
+			return f & 0x80000000 ? 0 : infinity;
+		}
+		if ((f & 0x80000000) || f < minDenormal)
+			return 0;
+		if (f > maxFinite)
+			return infinity - 1;
+
+		if (f < 0x38800000)
+			f = (0x800000 | (f & 0x7FFFFF)) >> (113 - (f >> 23));
+		else
+			f += 0xC8000000;  // Rebias the exponent
+		return ((f + (1u << (shift - 1)) - 1 + ((f >> shift) & 1)) >> shift) & mask;
+	}
+
+	// Round to nearest even of a non-negative float below 2^23
+	inline uint32_t RoundScalar(float value)
+	{
+		const float integer = floorf(value);
+		const float fraction = value - integer;
+		const uint32_t result = (uint32_t)integer;
+		return result + (fraction > 0.5f || (fraction == 0.5f && (result & 1)) ? 1 : 0);
+	}
+
+	constexpr float RGB9E5_MAX = (float)(0x1FF << 7);
+	constexpr float RGB9E5_MIN = 1.0f / (1 << 16);
+
+	inline uint32_t ToRGB9E5Scalar(const float* rgb)
+	{
+		float c[3];
+		for (uint32_t i = 0; i < 3; ++i)
+			c[i] = rgb[i] >= 0.0f ? (rgb[i] > RGB9E5_MAX ? RGB9E5_MAX : rgb[i]) : 0.0f;
+
+		const float maxXY = c[0] > c[1] ? c[0] : c[1];
+		const float maxXYZ = maxXY > c[2] ? maxXY : c[2];
+		const float maxColor = maxXYZ > RGB9E5_MIN ? maxXYZ : RGB9E5_MIN;
+
+		// Round the largest channel up to 9 bits of mantissa, which sets the shared exponent
+		const uint32_t exponent = (FloatBits(maxColor) + 0x4000) >> 23;
+		const float scale = BitsFloat(0x83000000 - (exponent << 23));
+		return RoundScalar(c[0] * scale) | (RoundScalar(c[1] * scale) << 9) | (RoundScalar(c[2] * scale) << 18) | ((exponent - 0x6F) << 27);
+	}
+
+	void SwizzleScalar(const uint8_t* src, uint32_t srcChannels, uint8_t* dst, uint32_t dstChannels, uint32_t channelSize,
+		const uint8_t map[4], const uint32_t fill[4], size_t begin, size_t count)
+	{
+		const size_t srcStride = (size_t)srcChannels * channelSize;
+		const size_t dstStride = (size_t)dstChannels * channelSize;
+		for (size_t i = begin; i < count; ++i)
+		{
+			const uint8_t* in = src + i * srcStride;
+			uint8_t* out = dst + i * dstStride;
+			for (uint32_t c = 0; c < dstChannels; ++c)
+			{
+				const void* from = map[c] == FILL ? (const void*)&fill[c] : (const void*)(in + map[c] * channelSize);
+				memcpy(out + c * channelSize, from, channelSize);
+			}
+		}
+	}
+
+	// -------------------------------------------------------
+	// Swizzles through byte shuffles
+	// -------------------------------------------------------
+
+	// One 16 byte shuffle moves [pixels] whole pixels. Lanes past them are zero.
+	struct ShuffleMask
+	{
+		size_t pixels;
+		alignas(16) uint8_t shuffle[16];
+		alignas(16) uint8_t fill[16];
+
+		ShuffleMask(uint32_t srcChannels, uint32_t dstChannels, uint32_t channelSize, const uint8_t map[4], const uint32_t fill4[4])
+		{
+			const uint32_t srcStride = srcChannels * channelSize;
+			const uint32_t dstStride = dstChannels * channelSize;
+			pixels = std::min(16 / srcStride, 16 / dstStride);
+			memset(shuffle, 0x80, sizeof(shuffle));
+			memset(fill, 0, sizeof(fill));
+			for (uint32_t p = 0; p < pixels; ++p)
+			{
+				for (uint32_t c = 0; c < dstChannels; ++c)
+				{
+					for (uint32_t k = 0; k < channelSize; ++k)
+					{
+						const uint32_t lane = p * dstStride + c * channelSize + k;
+						if (map[c] == FILL)
+							fill[lane] = (uint8_t)(fill4[c] >> (8 * k));
+						else
+							shuffle[lane] = (uint8_t)(p * srcStride + map[c] * channelSize + k);
+					}
+				}
+			}
+		}
+	};
+
+	// Loads and stores are 16 bytes wide, past the pixels a shuffle moves: the loops stop where they would leave
+	// the buffers, and bytes written past the pixels belong to later ones that are written again afterwards.
+	CPU_TARGET_SSE41 size_t SwizzleSSE4(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, const ShuffleMask& mask, size_t count)
+	{
+		const __m128i shuffle = _mm_load_si128((const __m128i*)mask.shuffle);
+		const __m128i fill = _mm_load_si128((const __m128i*)mask.fill);
+		const size_t srcEnd = count * srcStride;
+		const size_t dstEnd = count * dstStride;
+		size_t i = 0;
+		for (; i + mask.pixels <= count && i * srcStride + 16 <= srcEnd && i * dstStride + 16 <= dstEnd; i += mask.pixels)
+		{
+			const __m128i in = _mm_loadu_si128((const __m128i*)(src + i * srcStride));
+			_mm_storeu_si128((__m128i*)(dst + i * dstStride), _mm_or_si128(_mm_shuffle_epi8(in, shuffle), fill));
+		}
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t SwizzleAVX2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride, const ShuffleMask& mask, size_t count)
+	{
+		const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)mask.shuffle));
+		const __m256i fill = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)mask.fill));
+		const size_t srcEnd = count * srcStride;
+		const size_t dstEnd = count * dstStride;
+		const size_t step = mask.pixels * 2;
+		const size_t srcHalf = mask.pixels * srcStride;
+		const size_t dstHalf = mask.pixels * dstStride;
+		size_t i = 0;
+		for (; i + step <= count && i * srcStride + srcHalf + 16 <= srcEnd && i * dstStride + dstHalf + 16 <= dstEnd; i += step)
+		{
+			const uint8_t* in = src + i * srcStride;
+			uint8_t* out = dst + i * dstStride;
+			const __m256i pair = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)in)), _mm_loadu_si128((const __m128i*)(in + srcHalf)), 1);
+			const __m256i result = _mm256_or_si256(_mm256_shuffle_epi8(pair, shuffle), fill);
+			if (dstHalf == 16)
+				_mm256_storeu_si256((__m256i*)out, result);
+			else
+			{
+				_mm_storeu_si128((__m128i*)out, _mm256_castsi256_si128(result));
+				_mm_storeu_si128((__m128i*)(out + dstHalf), _mm256_extracti128_si256(result, 1));
+			}
+		}
+		return i;
+	}
+
+	// -------------------------------------------------------
+	// Float and half
+	// -------------------------------------------------------
+
+	CPU_TARGET_SSE41 inline __m128i FloatToHalf4(__m128 value)
+	{
+		const __m128i bits = _mm_castps_si128(value);
+		const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32((int)0x80000000));
+		const __m128i f = _mm_xor_si128(bits, sign);
+
+		// Normal: rebias, round to nearest even
+		const __m128i odd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+		const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32((int)(0xFFF - 0x38000000))), odd), 13);
+
+		// Denormal: adding 0.5 leaves the mantissa in units of 2^-24, rounded by the FPU
+		const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(126 << 23));
+		const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), magic)), _mm_castps_si128(magic));
+
+		__m128i h = _mm_blendv_epi8(normal, denormal, _mm_cmplt_epi32(f, _mm_set1_epi32(0x38800000)));
+		h = _mm_blendv_epi8(h, _mm_set1_epi32(0x7C00), _mm_cmpgt_epi32(f, _mm_set1_epi32(0x477FEFFF)));
+		const __m128i nan = _mm_or_si128(_mm_set1_epi32(0x7E00), _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(0x3FF)));
+		h = _mm_blendv_epi8(h, nan, _mm_cmpgt_epi32(f, _mm_set1_epi32(0x7F800000)));
+		return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+	}
+
+	CPU_TARGET_SSE41 inline __m128 HalfToFloat4(__m128i h)
+	{
+		const __m128i expMantissa = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+		const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expMantissa), 16);
+		const __m128i exponent = _mm_and_si128(h, _mm_set1_epi32(0x7C00));
+		const __m128i mantissa = _mm_and_si128(h, _mm_set1_epi32(0x3FF));
+
+		const __m128i shifted = _mm_slli_epi32(expMantissa, 13);
+		const __m128i normal = _mm_add_epi32(shifted, _mm_set1_epi32(112 << 23));
+		const __m128i denormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(mantissa), _mm_set1_ps(1.0f / 16777216.0f)));
+		const __m128i quiet = _mm_andnot_si128(_mm_cmpeq_epi32(mantissa, _mm_setzero_si128()), _mm_set1_epi32(0x400000));
+		const __m128i infNaN = _mm_or_si128(_mm_or_si128(shifted, _mm_set1_epi32(0x7F800000)), quiet);
+
+		__m128i f = _mm_blendv_epi8(normal, denormal, _mm_cmpeq_epi32(exponent, _mm_setzero_si128()));
+		f = _mm_blendv_epi8(f, infNaN, _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7C00)));
+		return _mm_castsi128_ps(_mm_or_si128(f, sign));
+	}
+
+	CPU_TARGET_SSE41 size_t FloatToHalfSSE4(const float* src, uint16_t* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i lo = FloatToHalf4(_mm_loadu_ps(src + i));
+			const __m128i hi = FloatToHalf4(_mm_loadu_ps(src + i + 4));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi32(lo, hi));
+		}
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t FloatToHalfAVX2(const float* src, uint16_t* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+		return i;
+	}
+
+	CPU_TARGET_SSE41 size_t HalfToFloatSSE4(const uint16_t* src, float* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dst + i, HalfToFloat4(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)(src + i)))));
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t HalfToFloatAVX2(const uint16_t* src, float* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+		return i;
+	}
+
+	// -------------------------------------------------------
+	// UNORM and sRGB
+	// -------------------------------------------------------
+
+	// clamp(v, 0, 1) * 255 + 0.5; max returns its second operand for NaN, so NaN becomes 0
+	inline __m128i ToUNorm8x4(__m128 value)
+	{
+		const __m128 c = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+		return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(c, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+	}
+
+	CPU_TARGET_AVX2 inline __m256i ToUNorm8x8(__m256 value)
+	{
+		const __m256 c = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+		return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(c, _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f)));
+	}
+
+	// 16 32-bit lanes holding bytes down to 16 bytes
+	CPU_TARGET_SSE41 inline __m128i PackBytes(__m128i a, __m128i b, __m128i c, __m128i d)
+	{
+		return _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+	}
+
+	CPU_TARGET_SSE41 size_t UNorm8ToFloatSSE4(const uint8_t* src, float* dst, size_t count)
+	{
+		const __m128 scale = _mm_set1_ps(255.0f);
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			int32_t packed;
+			memcpy(&packed, src + i, sizeof(packed));
+			_mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed))), scale));
+		}
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t UNorm8ToFloatAVX2(const uint8_t* src, float* dst, size_t count)
+	{
+		const __m256 scale = _mm256_set1_ps(255.0f);
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i)))), scale));
+		return i;
+	}
+
+	CPU_TARGET_SSE41 size_t FloatToUNorm8SSE4(const float* src, uint8_t* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			_mm_storeu_si128((__m128i*)(dst + i), PackBytes(ToUNorm8x4(_mm_loadu_ps(src + i)), ToUNorm8x4(_mm_loadu_ps(src + i + 4)),
+				ToUNorm8x4(_mm_loadu_ps(src + i + 8)), ToUNorm8x4(_mm_loadu_ps(src + i + 12))));
+		}
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t FloatToUNorm8AVX2(const float* src, uint8_t* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i lo = ToUNorm8x8(_mm256_loadu_ps(src + i));
+			const __m256i hi = ToUNorm8x8(_mm256_loadu_ps(src + i + 8));
+			// Packs work within 128-bit lanes: restore the order after them
+			const __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+			const __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+			_mm_storeu_si128((__m128i*)(dst + i), bytes);
+		}
+		return i;
+	}
+
+	// Pixel by pixel: without gathers a lookup per channel is all there is to do
+	CPU_TARGET_SSE41 size_t SRGBA8ToLinearSSE4(const SRGBTables& tables, const uint8_t* src, float* dst, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			const uint8_t* in = src + i * 4;
+			_mm_storeu_ps(dst + i * 4, _mm_setr_ps(tables.toLinear[in[0]], tables.toLinear[in[1]], tables.toLinear[in[2]], tables.toLinear[256 + in[3]]));
+		}
+		return count;
+	}
+
+	CPU_TARGET_AVX2 size_t SRGBA8ToLinearAVX2(const SRGBTables& tables, const uint8_t* src, float* dst, size_t count)
+	{
+		const __m256i alphaOffset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+		size_t i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			const __m256i index = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i * 4))), alphaOffset);
+			_mm256_storeu_ps(dst + i * 4, _mm256_i32gather_ps(tables.toLinear, index, 4));
+		}
+		return i;
+	}
+
+	// Bucket of each lane, clamped into the table; lanes outside [2^-13, 1) are fixed up by the caller
+	inline __m128i SRGBBucket4(__m128 value)
+	{
+		const __m128 first = _mm_castsi128_ps(_mm_set1_epi32((int)SRGB_BUCKET_FIRST));
+		const __m128 last = _mm_castsi128_ps(_mm_set1_epi32(0x3F7FFFFF));
+		const __m128i bits = _mm_castps_si128(_mm_min_ps(_mm_max_ps(value, first), last));
+		return _mm_srli_epi32(_mm_sub_epi32(bits, _mm_set1_epi32((int)SRGB_BUCKET_FIRST)), SRGB_BUCKET_SHIFT);
+	}
+
+	CPU_TARGET_AVX2 inline __m256i SRGBBucket8(__m256 value)
+	{
+		const __m256 first = _mm256_castsi256_ps(_mm256_set1_epi32((int)SRGB_BUCKET_FIRST));
+		const __m256 last = _mm256_castsi256_ps(_mm256_set1_epi32(0x3F7FFFFF));
+		const __m256i bits = _mm256_castps_si256(_mm256_min_ps(_mm256_max_ps(value, first), last));
+		return _mm256_srli_epi32(_mm256_sub_epi32(bits, _mm256_set1_epi32((int)SRGB_BUCKET_FIRST)), SRGB_BUCKET_SHIFT);
+	}
+
+	CPU_TARGET_SSE41 size_t LinearToSRGBA8SSE4(const SRGBTables& tables, const float* src, uint8_t* dst, size_t count)
+	{
+		const __m128 first = _mm_castsi128_ps(_mm_set1_epi32((int)SRGB_BUCKET_FIRST));
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128i alphaLane = _mm_setr_epi32(0, 0, 0, -1);
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i pixels[4];
+			for (uint32_t p = 0; p < 4; ++p)
+			{
+				const __m128 value = _mm_loadu_ps(src + (i + p) * 4);
+				alignas(16) int32_t bucket[4];
+				_mm_store_si128((__m128i*)bucket, SRGBBucket4(value));
+				const int32_t b0 = tables.bucketBase[bucket[0]], b1 = tables.bucketBase[bucket[1]], b2 = tables.bucketBase[bucket[2]];
+				const __m128i base = _mm_setr_epi32(b0, b1, b2, 0);
+				const __m128 threshold = _mm_setr_ps(tables.thresholds[b0], tables.thresholds[b1], tables.thresholds[b2], 0.0f);
+
+				// base + (value >= threshold), then 255 at or above 1 and 0 below the first bucket or NaN
+				__m128i encoded = _mm_sub_epi32(base, _mm_castps_si128(_mm_cmpge_ps(value, threshold)));
+				encoded = _mm_blendv_epi8(encoded, _mm_set1_epi32(255), _mm_castps_si128(_mm_cmpge_ps(value, one)));
+				encoded = _mm_and_si128(encoded, _mm_castps_si128(_mm_cmpge_ps(value, first)));
+				pixels[p] = _mm_blendv_epi8(encoded, ToUNorm8x4(value), alphaLane);
+			}
+			_mm_storeu_si128((__m128i*)(dst + i * 4), PackBytes(pixels[0], pixels[1], pixels[2], pixels[3]));
+		}
+		return i;
+	}
+
+	CPU_TARGET_AVX2 size_t LinearToSRGBA8AVX2(const SRGBTables& tables, const float* src, uint8_t* dst, size_t count)
+	{
+		const __m256 first = _mm256_castsi256_ps(_mm256_set1_epi32((int)SRGB_BUCKET_FIRST));
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256i alphaLane = _mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1);
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m256i pairs[2];
+			for (uint32_t p = 0; p < 2; ++p)
+			{
+				// Loads of the 6 color lanes: faster than gathers, which wait for the bucket and then the threshold
+				const __m256 value = _mm256_loadu_ps(src + (i + p * 2) * 4);
+				alignas(32) int32_t bucket[8];
+				_mm256_store_si256((__m256i*)bucket, SRGBBucket8(value));
+				const int32_t b0 = tables.bucketBase[bucket[0]], b1 = tables.bucketBase[bucket[1]], b2 = tables.bucketBase[bucket[2]];
+				const int32_t b4 = tables.bucketBase[bucket[4]], b5 = tables.bucketBase[bucket[5]], b6 = tables.bucketBase[bucket[6]];
+				const __m256i base = _mm256_setr_epi32(b0, b1, b2, 0, b4, b5, b6, 0);
+				const __m256 threshold = _mm256_setr_ps(tables.thresholds[b0], tables.thresholds[b1], tables.thresholds[b2], 0.0f,
+					tables.thresholds[b4], tables.thresholds[b5], tables.thresholds[b6], 0.0f);
+
+				__m256i encoded = _mm256_sub_epi32(base, _mm256_castps_si256(_mm256_cmp_ps(value, threshold, _CMP_GE_OQ)));
+				encoded = _mm256_blendv_epi8(encoded, _mm256_set1_epi32(255), _mm256_castps_si256(_mm256_cmp_ps(value, one, _CMP_GE_OQ)));
+				encoded = _mm256_and_si256(encoded, _mm256_castps_si256(_mm256_cmp_ps(value, first, _CMP_GE_OQ)));
+				pairs[p] = _mm256_blendv_epi8(encoded, ToUNorm8x8(value), alphaLane);
+			}
+			const __m128i bytes = PackBytes(_mm256_castsi256_si128(pairs[0]), _mm256_extracti128_si256(pairs[0], 1),
+				_mm256_castsi256_si128(pairs[1]), _mm256_extracti128_si256(pairs[1], 1));
+			_mm_storeu_si128((__m128i*)(dst + i * 4), bytes);
+		}
+		return i;
+	}
+
+	// -------------------------------------------------------
+	// Packed HDR formats
+	// -------------------------------------------------------
+
+	// mantissa >> (113 - exponent) per lane, in one instruction on AVX2
+	CPU_TARGET_AVX2 inline __m128i ShiftDenormalsAVX2(__m128i mantissa, __m128i exponent)
+	{
+		return _mm_srlv_epi32(mantissa, _mm_sub_epi32(_mm_set1_epi32(113), exponent));
+	}
+
+	// One channel of R11G11B10 for 4 values, the same steps as ToPackedFloatScalar. Finite values past the largest
+	// one clamp to it before rounding; denormals and infinities or NaNs only cost anything when a lane has one.
+	template<uint32_t MANTISSA_BITS, bool VARIABLE_SHIFT>
+	CPU_TARGET_SSE41 inline __m128i ToPackedFloat4(__m128 value)
+	{
+		constexpr int SHIFT = 23 - MANTISSA_BITS;
+		constexpr int INFINITY_BITS = 0x1F << MANTISSA_BITS;
+		constexpr int MASK = (1 << (MANTISSA_BITS + 5)) - 1;
+		const __m128i f = _mm_castps_si128(value);
+		// Signed: negative values, as integers, are below every threshold
+		const __m128i clamped = _mm_min_epi32(f, _mm_set1_epi32(MANTISSA_BITS == 6 ? 0x477E0000 : 0x477C0000));
+
+		__m128i v = _mm_add_epi32(clamped, _mm_set1_epi32((int)0xC8000000));  // Rebias the exponent
+		const __m128i isDenormal = _mm_cmplt_epi32(f, _mm_set1_epi32(0x38800000));
+		if (_mm_movemask_epi8(isDenormal))
+		{
+			const __m128i exponent = _mm_srli_epi32(clamped, 23);
+			const __m128i mantissa = _mm_or_si128(_mm_and_si128(clamped, _mm_set1_epi32(0x7FFFFF)), _mm_set1_epi32(0x800000));
+			__m128i denormal;
+			if constexpr (VARIABLE_SHIFT)
+				denormal = ShiftDenormalsAVX2(mantissa, exponent);
+			else
+			{
+				// mantissa / 2^(113 - exponent), truncated; exact in float since the mantissa has 24 bits
+				const __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(14)), 23));
+				denormal = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(mantissa), scale));
+			}
+			v = _mm_blendv_epi8(v, denormal, isDenormal);
+		}
+		v = _mm_add_epi32(_mm_add_epi32(v, _mm_set1_epi32((1 << (SHIFT - 1)) - 1)), _mm_and_si128(_mm_srli_epi32(v, SHIFT), _mm_set1_epi32(1)));
+		v = _mm_and_si128(_mm_srli_epi32(v, SHIFT), _mm_set1_epi32(MASK));
+		v = _mm_andnot_si128(_mm_cmplt_epi32(f, _mm_set1_epi32(MANTISSA_BITS == 6 ? 0x35800000 : 0x36000000)), v);
+
+		const __m128i special = _mm_cmpeq_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7F800000)), _mm_set1_epi32(0x7F800000));
+		if (_mm_movemask_epi8(special))
+		{
+			const __m128i isNaN = _mm_cmpgt_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+			const __m128i positiveInfinity = _mm_cmpeq_epi32(f, _mm_set1_epi32(0x7F800000));
+			v = _mm_andnot_si128(special, v);
+			v = _mm_or_si128(v, _mm_and_si128(positiveInfinity, _mm_set1_epi32(INFINITY_BITS)));
+			v = _mm_or_si128(v, _mm_and_si128(isNaN, _mm_set1_epi32(MASK)));
+		}
+		return v;
+	}
+
+	// 4 RGB triples, split into one vector per channel
+	inline void LoadRGB4(const float* src, __m128& r, __m128& g, __m128& b)
+	{
+		const __m128 a = _mm_loadu_ps(src);      // r0 g0 b0 r1
+		const __m128 c = _mm_loadu_ps(src + 4);  // g1 b1 r2 g2
+		const __m128 d = _mm_loadu_ps(src + 8);  // b2 r3 g3 b3
+		const __m128 r0r1g1b1 = _mm_shuffle_ps(a, c, _MM_SHUFFLE(1, 0, 3, 0));
+		const __m128 r2g2r3g3 = _mm_shuffle_ps(c, d, _MM_SHUFFLE(2, 1, 3, 2));
+		r = _mm_shuffle_ps(r0r1g1b1, r2g2r3g3, _MM_SHUFFLE(2, 0, 1, 0));
+		g = _mm_shuffle_ps(_mm_shuffle_ps(a, c, _MM_SHUFFLE(0, 0, 0, 1)), r2g2r3g3, _MM_SHUFFLE(3, 1, 2, 0));
+		b = _mm_shuffle_ps(_mm_shuffle_ps(a, c, _MM_SHUFFLE(1, 1, 2, 2)), d, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	template<bool VARIABLE_SHIFT>
+	CPU_TARGET_SSE41 size_t RGB32FToR11G11B10SIMD(const float* src, uint32_t* dst, size_t count)
+	{
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 r, g, b;
+			LoadRGB4(src + i * 3, r, g, b);
+			const __m128i packed = _mm_or_si128(_mm_or_si128(ToPackedFloat4<6, VARIABLE_SHIFT>(r), _mm_slli_epi32(ToPackedFloat4<6, VARIABLE_SHIFT>(g), 11)),
+				_mm_slli_epi32(ToPackedFloat4<5, VARIABLE_SHIFT>(b), 22));
+			_mm_storeu_si128((__m128i*)(dst + i), packed);
+		}
+		return i;
+	}
+
+	CPU_TARGET_SSE41 size_t RGB32FToRGB9E5SSE4(const float* src, uint32_t* dst, size_t count)
+	{
+		const __m128 maxValue = _mm_set1_ps(RGB9E5_MAX);
+		const __m128 minValue = _mm_set1_ps(RGB9E5_MIN);
+		const __m128 zero = _mm_setzero_ps();
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 c[3];
+			LoadRGB4(src + i * 3, c[0], c[1], c[2]);
+
+			// v >= 0 ? min(v, max) : 0, NaN included in the zeros
+			for (uint32_t k = 0; k < 3; ++k)
+				c[k] = _mm_and_ps(_mm_min_ps(c[k], maxValue), _mm_cmpge_ps(c[k], zero));
+			const __m128 maxColor = _mm_max_ps(_mm_max_ps(_mm_max_ps(c[0], c[1]), c[2]), minValue);
+
+			const __m128i exponent = _mm_srli_epi32(_mm_add_epi32(_mm_castps_si128(maxColor), _mm_set1_epi32(0x4000)), 23);
+			const __m128 scale = _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int)0x83000000), _mm_slli_epi32(exponent, 23)));
+			__m128i packed = _mm_slli_epi32(_mm_sub_epi32(exponent, _mm_set1_epi32(0x6F)), 27);
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const __m128 rounded = _mm_round_ps(_mm_mul_ps(c[k], scale), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_cvttps_epi32(rounded), 9 * k));
+			}
+			_mm_storeu_si128((__m128i*)(dst + i), packed);
+		}
+		return i;
+	}
+}
+
+PixelConvert::Kernel PixelConvert::GetBestKernel()
+{
+	static const Kernel best = []()
+	{
+		if (!CpuInfo::HasSSE41())
+			return Kernel::Scalar;
+		return CpuInfo::HasAVX2() && CpuInfo::HasF16C() ? Kernel::AVX2 : Kernel::SSE4;
+	}();
+	return best;
+}
+
+const char* PixelConvert::GetKernelName(Kernel kernel)
+{
+	switch (kernel)
+	{
+	case Kernel::SSE4:
+		return "SSE4";
+	case Kernel::AVX2:
+		return "AVX2";
+	default:
+		return "Scalar";
+	}
+}
+
+void PixelConvert::Swizzle(const void* src, uint32_t srcChannels, void* dst, uint32_t dstChannels, uint32_t channelSize,
+	const uint8_t map[4], const uint32_t fill[4], size_t count, Kernel kernel)
+{
+	assert(srcChannels >= 1 && srcChannels <= 4 && dstChannels >= 1 && dstChannels <= 4);
+	assert(channelSize == 1 || channelSize == 2 || channelSize == 4);
+
+	const uint8_t* in = (const uint8_t*)src;
+	uint8_t* out = (uint8_t*)dst;
+	size_t done = 0;
+	if (kernel != Kernel::Scalar)
+	{
+		const ShuffleMask mask(srcChannels, dstChannels, channelSize, map, fill);
+		const size_t srcStride = (size_t)srcChannels * channelSize;
+		const size_t dstStride = (size_t)dstChannels * channelSize;
+		done = kernel == Kernel::AVX2 ? SwizzleAVX2(in, srcStride, out, dstStride, mask, count) : 0;
+		done += SwizzleSSE4(in + done * srcStride, srcStride, out + done * dstStride, dstStride, mask, count - done);
+	}
+	SwizzleScalar(in, srcChannels, out, dstChannels, channelSize, map, fill, done, count);
+}
+
+void PixelConvert::RGB8ToRGBA8(const uint8_t* src, uint8_t* dst, size_t count, uint8_t alpha, Kernel kernel)
+{
+	const uint8_t map[4] = { 0, 1, 2, FILL };
+	const uint32_t fill[4] = { 0, 0, 0, alpha };
+	Swizzle(src, 3, dst, 4, 1, map, fill, count, kernel);
+}
+
+void PixelConvert::ToRGBA8(const uint8_t* src, uint32_t srcChannels, uint8_t* dst, size_t count, Kernel kernel)
+{
+	assert(srcChannels >= 1 && srcChannels <= 4);
+	static const uint8_t maps[4][4] = {
+		{ 0, 0, 0, FILL },
+		{ 0, 0, 0, 1 },
+		{ 0, 1, 2, FILL },
+		{ 0, 1, 2, 3 },
+	};
+	const uint32_t fill[4] = { 0, 0, 0, 255 };
+	Swizzle(src, srcChannels, dst, 4, 1, maps[srcChannels - 1], fill, count, kernel);
+}
+
+void PixelConvert::FloatToHalf(const float* src, uint16_t* dst, size_t count, Kernel kernel)
+{
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = FloatToHalfAVX2(src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = FloatToHalfSSE4(src, dst, count);
+	for (; i < count; ++i)
+		dst[i] = FloatToHalfScalar(src[i]);
+}
+
+void PixelConvert::HalfToFloat(const uint16_t* src, float* dst, size_t count, Kernel kernel)
+{
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = HalfToFloatAVX2(src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = HalfToFloatSSE4(src, dst, count);
+	for (; i < count; ++i)
+		dst[i] = HalfToFloatScalar(src[i]);
+}
+
+void PixelConvert::UNorm8ToFloat(const uint8_t* src, float* dst, size_t count, Kernel kernel)
+{
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = UNorm8ToFloatAVX2(src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = UNorm8ToFloatSSE4(src, dst, count);
+	for (; i < count; ++i)
+		dst[i] = src[i] / 255.0f;
+}
+
+void PixelConvert::FloatToUNorm8(const float* src, uint8_t* dst, size_t count, Kernel kernel)
+{
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = FloatToUNorm8AVX2(src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = FloatToUNorm8SSE4(src, dst, count);
+	for (; i < count; ++i)
+		dst[i] = FloatToUNorm8Scalar(src[i]);
+}
+
+void PixelConvert::SRGBA8ToLinear(const uint8_t* src, float* dst, size_t count, Kernel kernel)
+{
+	const SRGBTables& tables = GetSRGBTables();
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = SRGBA8ToLinearAVX2(tables, src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = SRGBA8ToLinearSSE4(tables, src, dst, count);
+	for (; i < count; ++i)
+	{
+		for (uint32_t c = 0; c < 4; ++c)
+			dst[i * 4 + c] = tables.toLinear[(c == 3 ? 256 : 0) + src[i * 4 + c]];
+	}
+}
+
+void PixelConvert::LinearToSRGBA8(const float* src, uint8_t* dst, size_t count, Kernel kernel)
+{
+	const SRGBTables& tables = GetSRGBTables();
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = LinearToSRGBA8AVX2(tables, src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = LinearToSRGBA8SSE4(tables, src, dst, count);
+	for (; i < count; ++i)
+	{
+		for (uint32_t c = 0; c < 3; ++c)
+			dst[i * 4 + c] = LinearToSRGBScalar(tables, src[i * 4 + c]);
+		dst[i * 4 + 3] = FloatToUNorm8Scalar(src[i * 4 + 3]);
+	}
+}
+
+float PixelConvert::SRGBToLinear(uint8_t value)
+{
+	return GetSRGBTables().toLinear[value];
+}
+
+void PixelConvert::RGB32FToR11G11B10(const float* src, uint32_t* dst, size_t count, Kernel kernel)
+{
+	size_t i = 0;
+	if (kernel == Kernel::AVX2)
+		i = RGB32FToR11G11B10SIMD<true>(src, dst, count);
+	else if (kernel == Kernel::SSE4)
+		i = RGB32FToR11G11B10SIMD<false>(src, dst, count);
+	for (; i < count; ++i)
+	{
+		const float* rgb = src + i * 3;
+		dst[i] = ToPackedFloatScalar(rgb[0], 6) | (ToPackedFloatScalar(rgb[1], 6) << 11) | (ToPackedFloatScalar(rgb[2], 5) << 22);
+	}
+}
+
+void PixelConvert::RGB32FToRGB9E5(const float* src, uint32_t* dst, size_t count, Kernel kernel)
+{
+	// The 4-wide kernel is all the work there is per pixel, AVX2 runs it too
+	size_t i = 0;
+	if (kernel != Kernel::Scalar)
+		i = RGB32FToRGB9E5SSE4(src, dst, count);
+	for (; i < count; ++i)
+		dst[i] = ToRGB9E5Scalar(src + i * 3);
+}
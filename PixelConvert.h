@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Pixel format conversions of the texture load path: channel swizzles, float <-> half, sRGB <-> linear,
+// 8-bit UNORM <-> float, and the packed R11G11B10 and RGB9E5 HDR formats.
+//
+// Every function has a scalar kernel and SSE4.1 and AVX2 kernels (AVX2 with F16C for the half conversions).
+// All kernels return the same bits for every input, NaNs included, so callers can pick any of them.
+// Conversions work on [count] values or pixels; source and destination must not overlap.
+namespace PixelConvert
+{
+	enum class Kernel
+	{
+		Scalar,
+		SSE4,  // SSE4.1
+		AVX2,  // AVX2 and F16C
+	};
+
+	// Fastest kernel this CPU and OS support
+	Kernel GetBestKernel();
+	const char* GetKernelName(Kernel kernel);
+
+	// Swizzle map entry for a destination channel that takes its fill value instead of a source channel
+	constexpr uint8_t FILL = 0xFF;
+
+	// Rearranges [count] pixels of [srcChannels] channels into pixels of [dstChannels] channels (1 to 4 each),
+	// every channel [channelSize] bytes (1, 2 or 4). Destination channel c copies source channel [map[c]],
+	// or the low [channelSize] bytes of [fill[c]] if map[c] is FILL.
+	void Swizzle(const void* src, uint32_t srcChannels, void* dst, uint32_t dstChannels, uint32_t channelSize,
+		const uint8_t map[4], const uint32_t fill[4], size_t count, Kernel kernel = GetBestKernel());
+
+	// 8-bit RGB to RGBA with a constant alpha
+	void RGB8ToRGBA8(const uint8_t* src, uint8_t* dst, size_t count, uint8_t alpha = 255, Kernel kernel = GetBestKernel());
+	// 8-bit gray, gray and alpha, RGB or RGBA ([srcChannels] 1 to 4) to RGBA as stb_image expands them:
+	// gray is spread over RGB, a missing alpha is opaque.
+	void ToRGBA8(const uint8_t* src, uint32_t srcChannels, uint8_t* dst, size_t count, Kernel kernel = GetBestKernel());
+
+	// IEEE half conversions as F16C does them: round to nearest even, overflow to infinity,
+	// half denormals kept, NaNs quieted with their payload's high bits kept.
+	void FloatToHalf(const float* src, uint16_t* dst, size_t count, Kernel kernel = GetBestKernel());
+	void HalfToFloat(const uint16_t* src, float* dst, size_t count, Kernel kernel = GetBestKernel());
+
+	// UNORM: v / 255, and clamp(v, 0, 1) * 255 rounded half up; NaN gives 0.
+	void UNorm8ToFloat(const uint8_t* src, float* dst, size_t count, Kernel kernel = GetBestKernel());
+	void FloatToUNorm8(const float* src, uint8_t* dst, size_t count, Kernel kernel = GetBestKernel());
+
+	// sRGB RGBA8 pixels to linear float RGBA and back; alpha is linear UNORM in both.
+	// Encoding picks the byte whose decoded value is nearest in linear space, so decoding and
+	// re-encoding gives the original byte back. NaN gives 0.
+	void SRGBA8ToLinear(const uint8_t* src, float* dst, size_t count, Kernel kernel = GetBestKernel());
+	void LinearToSRGBA8(const float* src, uint8_t* dst, size_t count, Kernel kernel = GetBestKernel());
+	// The decoded value of an sRGB byte
+	float SRGBToLinear(uint8_t value);
+
+	// Float RGB triples to DXGI_FORMAT_R11G11B10_FLOAT, as XMStoreFloat3PK: negatives and -Inf are 0,
+	// finite values past the largest one clamp to it, rounding is to nearest even.
+	void RGB32FToR11G11B10(const float* src, uint32_t* dst, size_t count, Kernel kernel = GetBestKernel());
+	// Float RGB triples to DXGI_FORMAT_R9G9B9E5_SHAREDEXP, as XMStoreFloat3SE: negatives and NaN are 0,
+	// values clamp to the largest one, mantissas round to nearest even.
+	void RGB32FToRGB9E5(const float* src, uint32_t* dst, size_t count, Kernel kernel = GetBestKernel());
+}
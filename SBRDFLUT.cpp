@@ -0,0 +1,161 @@
+#include "SBRDFLUT.h"
+#include "SBRDFLUTTable.h"
+
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+#include "SIBLBaker.h"
+#include "StringFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace DirectX;
+
+uint32_t SBRDFLUT::GetTableResolution()
+{
+	return TABLE_RESOLUTION;
+}
+
+uint32_t SBRDFLUT::GetTableSamples()
+{
+	return TABLE_SAMPLES;
+}
+
+XMFLOAT2 SBRDFLUT::EnvBRDFApprox(float NoV, float roughness)
+{
+	const XMFLOAT4 c0(-1.0f, -0.0275f, -0.572f, 0.022f);
+	const XMFLOAT4 c1(1.0f, 0.0425f, 1.04f, -0.04f);
+	const XMFLOAT4 r(roughness * c0.x + c1.x, roughness * c0.y + c1.y, roughness * c0.z + c1.z, roughness * c0.w + c1.w);
+	const float a004 = std::min(r.x * r.x, exp2f(-9.28f * NoV)) * r.x + r.y;
+	return XMFLOAT2(-1.04f * a004 + r.z, 1.04f * a004 + r.w);
+}
+
+void SBRDFLUT::Generate(uint32_t resolution, Mode mode, std::vector<XMFLOAT2>& outLUT)
+{
+	outLUT.resize((size_t)resolution * resolution);
+	if (mode == Mode::Analytic)
+	{
+		for (uint32_t y = 0; y < resolution; ++y)
+		{
+			for (uint32_t x = 0; x < resolution; ++x)
+				outLUT[(size_t)y * resolution + x] = EnvBRDFApprox((x + 1) / (float)resolution, (y + 1) / (float)resolution);
+		}
+		return;
+	}
+
+	std::vector<XMFLOAT2> table((size_t)TABLE_RESOLUTION * TABLE_RESOLUTION);
+	PixelConvert::HalfToFloat(TABLE, &table[0].x, table.size() * 2);
+	if (resolution == TABLE_RESOLUTION)
+	{
+		outLUT = std::move(table);
+		return;
+	}
+
+	// Texel i of the table holds (i + 1) / TABLE_RESOLUTION
+	for (uint32_t y = 0; y < resolution; ++y)
+	{
+		const float v = std::clamp((y + 1) * TABLE_RESOLUTION / (float)resolution - 1.0f, 0.0f, TABLE_RESOLUTION - 1.0f);
+		const uint32_t y0 = (uint32_t)v, y1 = std::min(y0 + 1, TABLE_RESOLUTION - 1);
+		const float fy = v - y0;
+		for (uint32_t x = 0; x < resolution; ++x)
+		{
+			const float u = std::clamp((x + 1) * TABLE_RESOLUTION / (float)resolution - 1.0f, 0.0f, TABLE_RESOLUTION - 1.0f);
+			const uint32_t x0 = (uint32_t)u, x1 = std::min(x0 + 1, TABLE_RESOLUTION - 1);
+			const float fx = u - x0;
+			const XMFLOAT2& a = table[(size_t)y0 * TABLE_RESOLUTION + x0];
+			const XMFLOAT2& b = table[(size_t)y0 * TABLE_RESOLUTION + x1];
+			const XMFLOAT2& c = table[(size_t)y1 * TABLE_RESOLUTION + x0];
+			const XMFLOAT2& d = table[(size_t)y1 * TABLE_RESOLUTION + x1];
+			outLUT[(size_t)y * resolution + x] = XMFLOAT2(
+				(a.x + (b.x - a.x) * fx) * (1.0f - fy) + (c.x + (d.x - c.x) * fx) * fy,
+				(a.y + (b.y - a.y) * fx) * (1.0f - fy) + (c.y + (d.y - c.y) * fx) * fy);
+		}
+	}
+}
+
+void SBRDFLUT::Encode(const std::vector<XMFLOAT2>& LUT, DXGI_FORMAT format, std::vector<uint8_t>& outTexels)
+{
+	const size_t count = LUT.size() * 2;
+	switch (format)
+	{
+	case DXGI_FORMAT_R16G16_FLOAT:
+		outTexels.resize(count * sizeof(uint16_t));
+		PixelConvert::FloatToHalf(&LUT[0].x, (uint16_t*)outTexels.data(), count);
+		break;
+	case DXGI_FORMAT_R32G32_FLOAT:
+		outTexels.resize(count * sizeof(float));
+		memcpy(outTexels.data(), LUT.data(), outTexels.size());
+		break;
+	case DXGI_FORMAT_R8G8_UNORM:
+		outTexels.resize(count);
+		PixelConvert::FloatToUNorm8(&LUT[0].x, outTexels.data(), count);
+		break;
+	default:
+		throw std::runtime_error(string_format("Unsupported BRDF LUT format %d", (int)format));
+	}
+}
+
+void SBRDFLUT::IntegrateSplitSum(uint32_t resolution, uint32_t samples, std::vector<XMFLOAT2>& outLUT, uint32_t maxThreads)
+{
+	outLUT.resize((size_t)resolution * resolution);
+	std::vector<XMFLOAT2> sequence(samples);
+	for (uint32_t i = 0; i < samples; ++i)
+		sequence[i] = SIBLBaker::Hammersley(i, samples);
+
+	// Karis 2013, IntegrateBRDF, with N = +Y as SIBLBaker::IntegrateBRDF has it
+	ParallelFor(resolution, [&](uint32_t y)
+	{
+		const float roughness = (y + 1) / (float)resolution;
+		const float k = roughness * roughness / 2.0f;
+		const XMFLOAT3 N(0.0f, 1.0f, 0.0f);
+		std::vector<XMFLOAT3> halfVectors(samples);
+		for (uint32_t i = 0; i < samples; ++i)
+			halfVectors[i] = SIBLBaker::ImportanceSampleGGX(sequence[i], roughness, N);
+
+		for (uint32_t x = 0; x < resolution; ++x)
+		{
+			const float NoV = (x + 1) / (float)resolution;
+			const XMFLOAT3 V(0.0f, NoV, sqrtf(1.0f - NoV * NoV));
+			const float G_V = NoV / (NoV * (1.0f - k) + k);
+			float A = 0.0f, B = 0.0f;
+			for (const XMFLOAT3& H : halfVectors)
+			{
+				const float VoH = V.x * H.x + V.y * H.y + V.z * H.z;
+				const float NoL = 2.0f * VoH * H.y - V.y;
+				const float NoH = std::clamp(H.y, 0.0f, 1.0f);
+				if (NoL > 0.0f && NoH > 0.0f)
+				{
+					const float G = G_V * NoL / (NoL * (1.0f - k) + k);
+					const float G_Vis = G * std::clamp(VoH, 0.0f, 1.0f) / (NoH * NoV);
+					const float c = 1.0f - std::clamp(VoH, 0.0f, 1.0f);
+					const float Fc = c * c * c * c * c;
+					A += (1.0f - Fc) * G_Vis;
+					B += Fc * G_Vis;
+				}
+			}
+			outLUT[(size_t)y * resolution + x] = XMFLOAT2(A / samples, B / samples);
+		}
+	}, maxThreads);
+}
+
+bool SBRDFLUT::WriteTable(const char* filename, const std::vector<XMFLOAT2>& LUT, uint32_t resolution, uint32_t samples)
+{
+	std::vector<uint16_t> halves(LUT.size() * 2);
+	PixelConvert::FloatToHalf(&LUT[0].x, halves.data(), halves.size());
+
+	FILE* file = fopen(filename, "w");
+	if (!file)
+		return false;
+	fprintf(file, "#pragma once\n\n#include <cstdint>\n\n");
+	fprintf(file, "// Generated by D3D12Engine.exe -genbrdf %s %u %u, do not edit.\n", filename, resolution, samples);
+	fprintf(file, "// SIBLBaker::IntegrateBRDF as half floats, scale then bias, rows of increasing roughness.\n");
+	fprintf(file, "namespace SBRDFLUT\n{\n");
+	fprintf(file, "\tconstexpr uint32_t TABLE_RESOLUTION = %u;\n", resolution);
+	fprintf(file, "\tconstexpr uint32_t TABLE_SAMPLES = %u;\n\n", samples);
+	fprintf(file, "\tconstexpr uint16_t TABLE[TABLE_RESOLUTION * TABLE_RESOLUTION * 2] =\n\t{\n");
+	for (size_t i = 0; i < halves.size(); ++i)
+		fprintf(file, "%s%u,%s", i % 16 == 0 ? "\t\t" : "", halves[i], i % 16 == 15 || i + 1 == halves.size() ? "\n" : " ");
+	fprintf(file, "\t};\n}\n");
+	return fclose(file) == 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <dxgiformat.h>
+
+#include <cstdint>
+#include <vector>
+
+// The split sum BRDF LUT render.hlsl looks up: scale and bias of F0, per NoV and roughness.
+//
+// Table mode reads SBRDFLUTTable.h, the integral of SIBLBaker::IntegrateBRDF generated ahead of time with
+// D3D12Engine.exe -genbrdf, so nothing is integrated at start-up. Analytic mode evaluates Karis' fit for mobile,
+// which needs no table but approximates the conventional split sum (G VoH / (NoH NoV) weights) rather than the
+// V_SmithGGXCorrelated integral of the table, and so shades differently.
+//
+// Texel (x, y) of a [resolution]^2 LUT holds NoV = (x + 1) / resolution and roughness = (y + 1) / resolution.
+namespace SBRDFLUT
+{
+	enum class Mode
+	{
+		Table,     // Exact at TABLE_RESOLUTION, bilinear otherwise
+		Analytic,  // Karis' EnvBRDFApprox, values within [0, 1]
+	};
+
+	// Resolution and sample count of the integral SBRDFLUTTable.h holds
+	uint32_t GetTableResolution();
+	uint32_t GetTableSamples();
+
+	// Karis, "Physically Based Shading on Mobile", 2014
+	DirectX::XMFLOAT2 EnvBRDFApprox(float NoV, float roughness);
+
+	// The [resolution]^2 LUT of [mode]
+	void Generate(uint32_t resolution, Mode mode, std::vector<DirectX::XMFLOAT2>& outLUT);
+	// Texels of [LUT] in [format], rows tightly packed: R16G16_FLOAT, R32G32_FLOAT, or R8G8_UNORM, which clamps
+	// to [0, 1] and so only suits Analytic. Throws for other formats.
+	void Encode(const std::vector<DirectX::XMFLOAT2>& LUT, DXGI_FORMAT format, std::vector<uint8_t>& outTexels);
+
+	// The conventional split sum with Schlick-Smith G, k = roughness^2 / 2, that EnvBRDFApprox is fitted to.
+	// The reference of the Analytic error reports.
+	void IntegrateSplitSum(uint32_t resolution, uint32_t samples, std::vector<DirectX::XMFLOAT2>& outLUT, uint32_t maxThreads = 0);
+
+	// Writes [LUT], [resolution]^2 texels integrated with [samples] samples, as a table header like SBRDFLUTTable.h
+	bool WriteTable(const char* filename, const std::vector<DirectX::XMFLOAT2>& LUT, uint32_t resolution, uint32_t samples);
+}
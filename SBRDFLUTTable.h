@@ -0,0 +1,8207 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by D3D12Engine.exe -genbrdf SBRDFLUTTable.h 256 65536, do not edit.
+// SIBLBaker::IntegrateBRDF as half floats, scale then bias, rows of increasing roughness.
+namespace SBRDFLUT
+{
+	constexpr uint32_t TABLE_RESOLUTION = 256;
+	constexpr uint32_t TABLE_SAMPLES = 65536;
+
+	constexpr uint16_t TABLE[TABLE_RESOLUTION * TABLE_RESOLUTION * 2] =
+	{
+		23296, 29065, 22629, 27360, 22061, 26202, 21683, 25386, 21386, 24716, 21062, 24122, 20826, 23680, 20648, 23238,
+		20509, 22848, 20318, 22572, 20134, 22210, 19981, 21906, 19850, 21672, 19739, 21470, 19643, 21176, 19560, 20936,
+		19485, 20741, 19382, 20577, 19264, 20406, 19158, 20176, 19062, 19979, 18975, 19813, 18895, 19669, 18822, 19544,
+		18754, 19414, 18693, 19224, 18637, 19055, 18584, 18905, 18533, 18775, 18488, 18656, 18445, 18552, 18378, 18457,
+		18304, 18314, 18232, 18162, 18166, 18024, 18104, 17901, 18042, 17787, 17986, 17685, 17935, 17591, 17883, 17504,
+		17837, 17427, 17791, 17302, 17747, 17168, 17706, 17048, 17667, 16936, 17629, 16832, 17593, 16736, 17560, 16648,
+		17527, 16568, 17496, 16492, 17465, 16421, 17436, 16328, 17408, 16208, 17358, 16096, 17304, 15991, 17256, 15894,
+		17208, 15801, 17162, 15717, 17120, 15637, 17078, 15561, 17038, 15492, 16998, 15427, 16959, 15365, 16921, 15256,
+		16887, 15146, 16851, 15047, 16818, 14952, 16786, 14862, 16755, 14777, 16726, 14698, 16696, 14624, 16667, 14553,
+		16640, 14488, 16613, 14424, 16587, 14365, 16563, 14286, 16539, 14178, 16515, 14080, 16492, 13986, 16469, 13898,
+		16448, 13815, 16427, 13736, 16405, 13661, 16385, 13591, 16350, 13523, 16312, 13459, 16274, 13400, 16240, 13343,
+		16202, 13264, 16169, 13162, 16136, 13066, 16104, 12976, 16072, 12888, 16041, 12806, 16010, 12728, 15984, 12653,
+		15954, 12583, 15927, 12515, 15898, 12451, 15872, 12392, 15847, 12335, 15822, 12272, 15797, 12168, 15773, 12072,
+		15750, 11978, 15726, 11889, 15704, 11806, 15681, 11727, 15659, 11650, 15639, 11578, 15618, 11511, 15599, 11445,
+		15579, 11384, 15560, 11324, 15541, 11268, 15521, 11168, 15504, 11066, 15487, 10970, 15469, 10880, 15452, 10793,
+		15435, 10712, 15419, 10633, 15403, 10560, 15388, 10488, 15372, 10421, 15354, 10357, 15326, 10297, 15296, 10240,
+		15266, 10130, 15240, 10026, 15214, 9928, 15186, 9834, 15160, 9746, 15136, 9662, 15110, 9582, 15086, 9505,
+		15062, 9433, 15038, 9365, 15014, 9300, 14992, 9239, 14968, 9144, 14946, 9032, 14926, 8928, 14904, 8826,
+		14882, 8734, 14864, 8643, 14843, 8559, 14824, 8479, 14805, 8401, 14785, 8329, 14767, 8261, 14749, 8196,
+		14730, 8080, 14712, 7962, 14696, 7854, 14679, 7750, 14662, 7651, 14646, 7559, 14629, 7471, 14613, 7389,
+		14597, 7311, 14582, 7236, 14567, 7166, 14552, 7034, 14537, 6912, 14523, 6794, 14509, 6685, 14496, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6008, 14404, 5874, 14392, 5750,
+		14380, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14330, 5228, 14310, 5143, 14288, 5008, 14266, 4857,
+		14246, 4720, 14224, 4591, 14206, 4470, 14184, 4357, 14166, 4253, 14144, 4156, 14126, 4034, 14106, 3870,
+		14088, 3712, 14070, 3569, 14050, 3437, 14033, 3313, 14016, 3200, 14000, 3095, 13982, 2922, 13966, 2744,
+		13950, 2582, 13930, 2431, 13915, 2293, 13899, 2165, 13885, 2051, 13870, 1840, 13854, 1648, 13839, 1472,
+		13824, 1312, 13809, 1168, 13795, 1036, 13781, 917, 13767, 811, 13753, 713, 13739, 627, 13727, 548,
+		13713, 479, 13699, 417, 13688, 361, 13674, 312, 13662, 269, 13649, 230, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13504, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13433, 2, 13424, 2, 13416, 1, 13407, 1, 13397, 0, 13388, 0, 13380, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		22639, 28417, 22262, 26992, 21866, 26003, 21589, 25246, 21282, 24655, 21000, 24062, 20787, 23648, 20623, 23200,
+		20492, 22824, 20288, 22556, 20112, 22192, 19965, 21893, 19839, 21661, 19729, 21456, 19635, 21162, 19552, 20928,
+		19480, 20734, 19374, 20573, 19256, 20398, 19152, 20168, 19056, 19975, 18969, 19808, 18890, 19665, 18818, 19541,
+		18752, 19408, 18690, 19218, 18633, 19050, 18581, 18904, 18532, 18771, 18487, 18655, 18444, 18551, 18376, 18456,
+		18302, 18312, 18230, 18160, 18162, 18024, 18102, 17898, 18041, 17785, 17985, 17683, 17933, 17589, 17882, 17504,
+		17834, 17425, 17790, 17298, 17746, 17168, 17705, 17046, 17666, 16935, 17629, 16832, 17592, 16736, 17559, 16648,
+		17527, 16567, 17495, 16491, 17464, 16421, 17436, 16328, 17408, 16208, 17354, 16096, 17304, 15990, 17256, 15893,
+		17208, 15800, 17162, 15715, 17119, 15635, 17078, 15561, 17034, 15491, 16995, 15427, 16958, 15364, 16921, 15256,
+		16886, 15146, 16851, 15046, 16818, 14952, 16786, 14862, 16754, 14777, 16725, 14697, 16696, 14624, 16667, 14553,
+		16640, 14487, 16613, 14424, 16587, 14365, 16563, 14286, 16537, 14178, 16515, 14080, 16491, 13986, 16469, 13898,
+		16448, 13815, 16427, 13736, 16405, 13661, 16385, 13590, 16350, 13523, 16312, 13459, 16274, 13400, 16239, 13343,
+		16202, 13264, 16168, 13162, 16136, 13066, 16104, 12976, 16072, 12888, 16041, 12806, 16010, 12727, 15983, 12653,
+		15953, 12583, 15927, 12515, 15898, 12451, 15872, 12392, 15847, 12335, 15822, 12272, 15797, 12168, 15773, 12072,
+		15749, 11978, 15726, 11889, 15704, 11806, 15681, 11727, 15659, 11650, 15639, 11578, 15618, 11510, 15598, 11445,
+		15579, 11384, 15559, 11324, 15541, 11268, 15521, 11168, 15504, 11066, 15485, 10970, 15469, 10880, 15452, 10793,
+		15435, 10712, 15419, 10633, 15403, 10559, 15388, 10488, 15372, 10421, 15352, 10357, 15326, 10297, 15296, 10240,
+		15266, 10130, 15240, 10026, 15214, 9928, 15186, 9834, 15160, 9746, 15136, 9662, 15110, 9582, 15086, 9505,
+		15062, 9433, 15038, 9365, 15014, 9300, 14992, 9239, 14968, 9144, 14946, 9032, 14926, 8928, 14904, 8826,
+		14882, 8734, 14864, 8643, 14842, 8559, 14824, 8479, 14803, 8401, 14785, 8329, 14767, 8261, 14749, 8196,
+		14730, 8079, 14712, 7962, 14696, 7854, 14679, 7750, 14662, 7650, 14645, 7559, 14629, 7471, 14613, 7389,
+		14597, 7311, 14582, 7236, 14567, 7166, 14552, 7034, 14537, 6912, 14523, 6794, 14509, 6685, 14496, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6008, 14404, 5874, 14392, 5750,
+		14380, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14330, 5228, 14310, 5143, 14288, 5008, 14266, 4857,
+		14246, 4720, 14224, 4591, 14206, 4470, 14184, 4357, 14166, 4253, 14144, 4156, 14126, 4034, 14106, 3870,
+		14088, 3712, 14070, 3569, 14050, 3437, 14033, 3313, 14016, 3200, 14000, 3095, 13982, 2922, 13966, 2744,
+		13950, 2582, 13930, 2431, 13915, 2293, 13899, 2165, 13885, 2051, 13870, 1840, 13854, 1648, 13839, 1472,
+		13824, 1312, 13809, 1168, 13795, 1036, 13781, 917, 13767, 811, 13753, 713, 13739, 627, 13727, 548,
+		13712, 479, 13699, 417, 13688, 361, 13674, 312, 13662, 269, 13649, 230, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13504, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13433, 2, 13424, 2, 13416, 1, 13407, 1, 13397, 0, 13388, 0, 13380, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		22085, 27893, 21877, 26692, 21659, 25789, 21440, 25065, 21144, 24562, 20912, 23974, 20728, 23597, 20581, 23138,
+		20442, 22787, 20246, 22532, 20080, 22158, 19939, 21869, 19818, 21645, 19714, 21431, 19623, 21144, 19543, 20913,
+		19471, 20723, 19359, 20564, 19242, 20384, 19142, 20159, 19048, 19967, 18961, 19801, 18883, 19659, 18813, 19536,
+		18746, 19400, 18686, 19214, 18629, 19046, 18577, 18898, 18528, 18768, 18484, 18651, 18440, 18547, 18370, 18453,
+		18296, 18306, 18225, 18158, 18160, 18018, 18096, 17896, 18040, 17784, 17984, 17680, 17930, 17587, 17880, 17501,
+		17832, 17424, 17787, 17296, 17744, 17166, 17704, 17042, 17664, 16933, 17627, 16830, 17592, 16735, 17557, 16647,
+		17525, 16565, 17493, 16491, 17464, 16420, 17435, 16328, 17408, 16206, 17353, 16094, 17304, 15990, 17254, 15890,
+		17208, 15800, 17160, 15714, 17118, 15635, 17074, 15560, 17034, 15491, 16994, 15425, 16958, 15364, 16920, 15254,
+		16885, 15146, 16850, 15046, 16817, 14950, 16785, 14861, 16754, 14776, 16725, 14697, 16695, 14623, 16667, 14552,
+		16640, 14487, 16613, 14424, 16587, 14365, 16561, 14282, 16537, 14178, 16513, 14080, 16491, 13985, 16468, 13897,
+		16447, 13814, 16425, 13735, 16405, 13661, 16385, 13589, 16350, 13523, 16312, 13459, 16272, 13400, 16238, 13343,
+		16202, 13264, 16168, 13162, 16136, 13065, 16104, 12975, 16072, 12888, 16040, 12805, 16010, 12727, 15983, 12653,
+		15953, 12582, 15926, 12515, 15898, 12451, 15872, 12392, 15847, 12335, 15821, 12272, 15797, 12168, 15773, 12072,
+		15749, 11977, 15726, 11889, 15704, 11806, 15681, 11726, 15659, 11650, 15639, 11578, 15617, 11510, 15598, 11445,
+		15578, 11383, 15559, 11324, 15539, 11268, 15521, 11168, 15504, 11066, 15485, 10970, 15468, 10880, 15451, 10792,
+		15435, 10712, 15419, 10632, 15403, 10559, 15388, 10488, 15372, 10421, 15352, 10357, 15326, 10297, 15296, 10240,
+		15266, 10130, 15240, 10026, 15214, 9928, 15186, 9834, 15160, 9745, 15135, 9662, 15110, 9582, 15086, 9505,
+		15062, 9433, 15038, 9365, 15014, 9300, 14992, 9239, 14968, 9144, 14946, 9032, 14926, 8928, 14904, 8826,
+		14882, 8734, 14863, 8643, 14842, 8559, 14824, 8478, 14803, 8401, 14784, 8329, 14767, 8261, 14749, 8196,
+		14730, 8079, 14712, 7962, 14696, 7854, 14679, 7750, 14662, 7650, 14645, 7559, 14629, 7471, 14613, 7389,
+		14597, 7309, 14582, 7236, 14567, 7166, 14552, 7034, 14537, 6912, 14523, 6793, 14509, 6685, 14496, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6008, 14404, 5874, 14392, 5750,
+		14380, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14330, 5228, 14310, 5143, 14288, 5007, 14266, 4857,
+		14246, 4720, 14224, 4591, 14206, 4470, 14184, 4357, 14166, 4253, 14144, 4156, 14126, 4034, 14106, 3870,
+		14088, 3712, 14070, 3569, 14050, 3437, 14033, 3313, 14016, 3200, 14000, 3095, 13982, 2922, 13966, 2744,
+		13950, 2582, 13930, 2431, 13915, 2293, 13899, 2165, 13885, 2051, 13870, 1840, 13854, 1648, 13839, 1472,
+		13824, 1312, 13809, 1168, 13795, 1036, 13781, 917, 13767, 811, 13753, 713, 13739, 627, 13727, 548,
+		13712, 479, 13699, 417, 13688, 361, 13674, 312, 13662, 269, 13649, 230, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13504, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13433, 2, 13424, 2, 13416, 1, 13405, 1, 13397, 0, 13388, 0, 13380, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		21706, 27552, 21606, 26340, 21455, 25607, 21209, 24891, 20993, 24385, 20811, 23874, 20659, 23528, 20532, 23068,
+		20370, 22741, 20191, 22475, 20038, 22115, 19906, 21840, 19792, 21623, 19693, 21399, 19605, 21121, 19528, 20896,
+		19459, 20709, 19338, 20553, 19227, 20366, 19127, 20144, 19034, 19955, 18951, 19792, 18874, 19652, 18805, 19530,
+		18739, 19391, 18680, 19203, 18624, 19038, 18573, 18892, 18524, 18762, 18480, 18647, 18437, 18544, 18363, 18451,
+		18289, 18302, 18221, 18152, 18154, 18016, 18093, 17891, 18034, 17779, 17979, 17678, 17927, 17584, 17877, 17500,
+		17830, 17421, 17785, 17293, 17743, 17161, 17701, 17041, 17663, 16929, 17625, 16827, 17590, 16733, 17556, 16645,
+		17524, 16564, 17492, 16488, 17463, 16419, 17433, 16323, 17405, 16203, 17352, 16091, 17301, 15986, 17251, 15889,
+		17205, 15799, 17160, 15713, 17115, 15633, 17073, 15560, 17033, 15489, 16993, 15424, 16955, 15364, 16919, 15253,
+		16883, 15145, 16849, 15043, 16816, 14949, 16784, 14859, 16753, 14776, 16723, 14696, 16695, 14622, 16665, 14552,
+		16639, 14486, 16612, 14424, 16586, 14364, 16561, 14282, 16536, 14177, 16513, 14079, 16490, 13985, 16468, 13896,
+		16447, 13814, 16425, 13735, 16405, 13659, 16385, 13589, 16347, 13521, 16310, 13459, 16272, 13399, 16238, 13341,
+		16202, 13264, 16168, 13161, 16135, 13065, 16103, 12974, 16071, 12887, 16040, 12805, 16011, 12727, 15982, 12651,
+		15953, 12582, 15926, 12515, 15898, 12451, 15872, 12391, 15846, 12334, 15821, 12272, 15796, 12168, 15772, 12071,
+		15749, 11977, 15726, 11889, 15703, 11806, 15680, 11726, 15659, 11649, 15639, 11577, 15617, 11509, 15598, 11445,
+		15577, 11383, 15559, 11324, 15540, 11268, 15521, 11167, 15503, 11065, 15486, 10970, 15468, 10880, 15451, 10793,
+		15435, 10711, 15419, 10632, 15403, 10559, 15387, 10488, 15372, 10421, 15353, 10357, 15323, 10297, 15295, 10240,
+		15267, 10130, 15239, 10026, 15213, 9928, 15185, 9834, 15160, 9745, 15135, 9662, 15110, 9582, 15085, 9505,
+		15061, 9433, 15037, 9365, 15014, 9300, 14991, 9239, 14968, 9144, 14946, 9032, 14925, 8928, 14904, 8827,
+		14883, 8733, 14863, 8643, 14843, 8559, 14823, 8478, 14804, 8401, 14784, 8329, 14767, 8261, 14748, 8196,
+		14729, 8079, 14712, 7962, 14695, 7853, 14678, 7749, 14662, 7651, 14645, 7559, 14629, 7471, 14613, 7388,
+		14597, 7310, 14582, 7236, 14567, 7166, 14552, 7034, 14537, 6911, 14523, 6793, 14509, 6683, 14495, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6009, 14404, 5874, 14392, 5749,
+		14380, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14331, 5228, 14310, 5143, 14288, 5007, 14266, 4857,
+		14246, 4720, 14224, 4590, 14206, 4470, 14184, 4357, 14166, 4253, 14144, 4156, 14126, 4035, 14106, 3869,
+		14088, 3713, 14070, 3569, 14051, 3437, 14032, 3313, 14016, 3200, 13999, 3095, 13982, 2923, 13966, 2745,
+		13949, 2582, 13932, 2431, 13916, 2293, 13900, 2166, 13885, 2051, 13869, 1841, 13854, 1648, 13839, 1472,
+		13824, 1312, 13809, 1168, 13795, 1036, 13781, 917, 13767, 810, 13752, 713, 13739, 627, 13727, 549,
+		13712, 479, 13700, 417, 13688, 361, 13674, 312, 13662, 269, 13649, 230, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13504, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13416, 1, 13406, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		21430, 27177, 21323, 26042, 21169, 25321, 21005, 24737, 20848, 24210, 20707, 23771, 20583, 23402, 20472, 22987,
+		20287, 22688, 20127, 22402, 19987, 22065, 19867, 21802, 19761, 21597, 19667, 21359, 19584, 21092, 19511, 20873,
+		19433, 20691, 19313, 20540, 19206, 20344, 19108, 20126, 19019, 19940, 18937, 19781, 18863, 19642, 18793, 19522,
+		18730, 19377, 18671, 19192, 18617, 19029, 18566, 18884, 18519, 18756, 18474, 18641, 18433, 18539, 18355, 18446,
+		18282, 18295, 18214, 18145, 18149, 18009, 18088, 17887, 18030, 17776, 17975, 17674, 17922, 17581, 17873, 17497,
+		17826, 17419, 17782, 17288, 17739, 17158, 17698, 17038, 17660, 16927, 17623, 16824, 17588, 16729, 17553, 16643,
+		17521, 16561, 17490, 16487, 17461, 16417, 17432, 16321, 17401, 16201, 17349, 16089, 17298, 15984, 17249, 15888,
+		17202, 15797, 17158, 15712, 17113, 15632, 17071, 15558, 17031, 15488, 16992, 15424, 16954, 15363, 16918, 15250,
+		16882, 15143, 16848, 15042, 16815, 14947, 16783, 14858, 16752, 14775, 16722, 14696, 16693, 14621, 16664, 14551,
+		16638, 14485, 16611, 14423, 16585, 14364, 16560, 14281, 16536, 14176, 16512, 14078, 16489, 13984, 16467, 13896,
+		16446, 13813, 16425, 13733, 16404, 13659, 16384, 13588, 16346, 13521, 16309, 13458, 16272, 13399, 16237, 13341,
+		16201, 13263, 16167, 13161, 16135, 13064, 16102, 12973, 16071, 12886, 16040, 12803, 16010, 12726, 15981, 12651,
+		15952, 12581, 15925, 12514, 15897, 12451, 15871, 12391, 15846, 12333, 15821, 12271, 15795, 12168, 15771, 12070,
+		15748, 11977, 15725, 11888, 15703, 11805, 15680, 11725, 15659, 11649, 15638, 11577, 15617, 11509, 15597, 11444,
+		15577, 11383, 15559, 11324, 15539, 11268, 15521, 11167, 15503, 11065, 15485, 10969, 15468, 10879, 15451, 10792,
+		15435, 10711, 15418, 10632, 15403, 10559, 15387, 10488, 15371, 10421, 15352, 10357, 15323, 10297, 15295, 10239,
+		15266, 10129, 15239, 10026, 15212, 9928, 15185, 9834, 15159, 9745, 15134, 9661, 15109, 9581, 15085, 9505,
+		15061, 9433, 15037, 9365, 15014, 9300, 14991, 9238, 14968, 9143, 14946, 9032, 14925, 8927, 14904, 8827,
+		14883, 8733, 14863, 8643, 14842, 8559, 14823, 8478, 14804, 8401, 14784, 8329, 14766, 8261, 14748, 8196,
+		14729, 8078, 14712, 7961, 14695, 7853, 14678, 7749, 14661, 7650, 14645, 7558, 14629, 7471, 14613, 7388,
+		14597, 7310, 14582, 7236, 14567, 7166, 14552, 7033, 14537, 6911, 14523, 6793, 14509, 6683, 14495, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6009, 14404, 5874, 14392, 5749,
+		14380, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14332, 5228, 14310, 5143, 14288, 5007, 14266, 4857,
+		14246, 4720, 14224, 4590, 14205, 4470, 14184, 4357, 14165, 4253, 14144, 4156, 14126, 4035, 14106, 3869,
+		14088, 3713, 14070, 3569, 14051, 3437, 14033, 3313, 14016, 3199, 13999, 3095, 13982, 2923, 13965, 2745,
+		13949, 2581, 13932, 2431, 13916, 2293, 13900, 2166, 13885, 2051, 13869, 1841, 13854, 1648, 13839, 1472,
+		13824, 1312, 13808, 1168, 13794, 1036, 13781, 917, 13767, 810, 13752, 713, 13739, 627, 13727, 549,
+		13712, 479, 13700, 417, 13687, 361, 13674, 312, 13662, 269, 13649, 230, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13503, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13416, 1, 13406, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		21091, 26912, 21041, 25825, 20943, 25092, 20831, 24605, 20716, 24053, 20608, 23674, 20508, 23276, 20357, 22905,
+		20198, 22632, 20057, 22325, 19933, 22010, 19823, 21763, 19725, 21567, 19638, 21315, 19560, 21058, 19490, 20846,
+		19399, 20671, 19285, 20523, 19181, 20318, 19087, 20106, 19001, 19924, 18922, 19767, 18849, 19631, 18782, 19513,
+		18720, 19362, 18662, 19179, 18608, 19018, 18558, 18875, 18512, 18748, 18468, 18634, 18423, 18533, 18346, 18441,
+		18273, 18286, 18206, 18137, 18141, 18003, 18081, 17881, 18023, 17770, 17969, 17670, 17917, 17577, 17868, 17493,
+		17822, 17416, 17778, 17283, 17735, 17153, 17695, 17033, 17657, 16923, 17620, 16821, 17585, 16727, 17551, 16640,
+		17519, 16559, 17488, 16485, 17458, 16415, 17430, 16318, 17398, 16198, 17345, 16086, 17295, 15982, 17246, 15885,
+		17199, 15794, 17155, 15710, 17111, 15631, 17069, 15557, 17029, 15487, 16990, 15422, 16952, 15361, 16916, 15248,
+		16880, 15141, 16846, 15040, 16814, 14946, 16782, 14857, 16751, 14773, 16721, 14694, 16692, 14620, 16664, 14550,
+		16637, 14484, 16610, 14422, 16584, 14363, 16559, 14279, 16535, 14175, 16512, 14076, 16489, 13983, 16467, 13895,
+		16445, 13811, 16424, 13733, 16403, 13658, 16383, 13587, 16345, 13521, 16307, 13457, 16271, 13397, 16235, 13341,
+		16200, 13262, 16166, 13160, 16133, 13064, 16101, 12972, 16070, 12885, 16039, 12803, 16009, 12725, 15981, 12651,
+		15951, 12580, 15924, 12514, 15897, 12450, 15870, 12390, 15845, 12333, 15820, 12270, 15795, 12167, 15771, 12069,
+		15747, 11976, 15725, 11888, 15702, 11804, 15680, 11725, 15658, 11649, 15638, 11577, 15617, 11509, 15597, 11444,
+		15577, 11382, 15558, 11324, 15539, 11268, 15520, 11166, 15503, 11065, 15485, 10969, 15468, 10879, 15451, 10792,
+		15434, 10710, 15418, 10632, 15402, 10558, 15387, 10488, 15371, 10421, 15352, 10357, 15323, 10297, 15294, 10239,
+		15266, 10129, 15239, 10026, 15212, 9928, 15185, 9834, 15159, 9745, 15134, 9661, 15109, 9581, 15084, 9505,
+		15060, 9433, 15037, 9365, 15013, 9300, 14990, 9238, 14968, 9143, 14946, 9032, 14925, 8927, 14903, 8827,
+		14883, 8733, 14862, 8643, 14842, 8558, 14823, 8478, 14804, 8401, 14784, 8329, 14766, 8261, 14748, 8196,
+		14729, 8078, 14712, 7962, 14695, 7852, 14678, 7749, 14661, 7650, 14645, 7558, 14629, 7471, 14613, 7388,
+		14597, 7310, 14582, 7236, 14567, 7165, 14551, 7034, 14537, 6910, 14523, 6794, 14509, 6684, 14495, 6581,
+		14481, 6483, 14468, 6392, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6009, 14404, 5875, 14392, 5749,
+		14379, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14332, 5228, 14310, 5143, 14287, 5006, 14266, 4858,
+		14246, 4719, 14224, 4590, 14205, 4470, 14183, 4357, 14165, 4253, 14144, 4156, 14126, 4036, 14106, 3869,
+		14087, 3713, 14070, 3569, 14052, 3436, 14033, 3313, 14015, 3199, 13999, 3094, 13982, 2923, 13965, 2745,
+		13949, 2581, 13932, 2431, 13916, 2293, 13900, 2166, 13885, 2050, 13869, 1841, 13854, 1648, 13839, 1472,
+		13824, 1313, 13809, 1168, 13795, 1036, 13781, 917, 13767, 810, 13752, 714, 13740, 627, 13727, 549,
+		13712, 479, 13700, 417, 13687, 362, 13674, 312, 13662, 269, 13649, 231, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13503, 18, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13407, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13361, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		20844, 26718, 20827, 25659, 20764, 24909, 20684, 24413, 20600, 23914, 20515, 23584, 20391, 23156, 20242, 22823,
+		20107, 22575, 19985, 22245, 19874, 21951, 19775, 21720, 19686, 21535, 19606, 21267, 19533, 21021, 19468, 20818,
+		19361, 20648, 19252, 20506, 19153, 20289, 19063, 20082, 18980, 19905, 18903, 19751, 18833, 19618, 18768, 19502,
+		18707, 19344, 18651, 19164, 18599, 19005, 18550, 18864, 18504, 18739, 18461, 18626, 18410, 18526, 18334, 18435,
+		18263, 18276, 18196, 18129, 18133, 17996, 18073, 17875, 18016, 17765, 17962, 17665, 17911, 17573, 17863, 17489,
+		17817, 17413, 17773, 17276, 17731, 17147, 17691, 17028, 17653, 16918, 17616, 16817, 17582, 16723, 17548, 16637,
+		17516, 16556, 17485, 16482, 17456, 16413, 17428, 16313, 17393, 16194, 17341, 16082, 17291, 15979, 17243, 15883,
+		17196, 15792, 17151, 15708, 17108, 15629, 17067, 15555, 17026, 15486, 16987, 15421, 16950, 15360, 16914, 15246,
+		16878, 15139, 16845, 15039, 16812, 14944, 16780, 14855, 16749, 14771, 16719, 14693, 16690, 14618, 16662, 14549,
+		16635, 14483, 16608, 14421, 16583, 14362, 16558, 14278, 16534, 14173, 16511, 14075, 16488, 13982, 16466, 13893,
+		16444, 13810, 16423, 13731, 16403, 13657, 16382, 13587, 16343, 13520, 16306, 13457, 16269, 13397, 16234, 13340,
+		16199, 13261, 16165, 13159, 16132, 13063, 16100, 12971, 16069, 12884, 16038, 12802, 16008, 12724, 15979, 12650,
+		15951, 12580, 15923, 12513, 15896, 12450, 15870, 12390, 15844, 12333, 15819, 12269, 15794, 12166, 15770, 12068,
+		15747, 11976, 15724, 11887, 15701, 11804, 15679, 11724, 15658, 11648, 15637, 11577, 15616, 11508, 15597, 11443,
+		15576, 11382, 15558, 11323, 15538, 11268, 15520, 11165, 15502, 11065, 15485, 10969, 15467, 10878, 15450, 10792,
+		15434, 10710, 15418, 10632, 15402, 10558, 15386, 10487, 15371, 10421, 15352, 10357, 15323, 10296, 15294, 10238,
+		15265, 10129, 15238, 10025, 15211, 9927, 15184, 9834, 15158, 9745, 15133, 9661, 15108, 9581, 15084, 9505,
+		15060, 9433, 15036, 9364, 15013, 9299, 14990, 9238, 14967, 9143, 14945, 9032, 14925, 8927, 14903, 8827,
+		14882, 8733, 14862, 8643, 14842, 8558, 14822, 8478, 14803, 8401, 14784, 8329, 14766, 8261, 14748, 8196,
+		14729, 8078, 14712, 7962, 14694, 7852, 14678, 7749, 14661, 7650, 14645, 7558, 14629, 7470, 14613, 7388,
+		14597, 7310, 14582, 7236, 14566, 7165, 14551, 7034, 14537, 6910, 14522, 6794, 14509, 6684, 14495, 6581,
+		14481, 6483, 14467, 6391, 14455, 6305, 14441, 6224, 14429, 6148, 14416, 6009, 14404, 5875, 14391, 5749,
+		14379, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14332, 5228, 14310, 5143, 14287, 5006, 14266, 4858,
+		14245, 4719, 14224, 4590, 14204, 4470, 14183, 4358, 14165, 4253, 14144, 4156, 14125, 4036, 14106, 3868,
+		14087, 3713, 14070, 3569, 14051, 3436, 14033, 3313, 14015, 3199, 13998, 3095, 13982, 2923, 13965, 2745,
+		13949, 2581, 13932, 2431, 13916, 2293, 13900, 2166, 13885, 2051, 13869, 1841, 13854, 1648, 13839, 1473,
+		13824, 1313, 13809, 1168, 13795, 1036, 13781, 918, 13767, 810, 13752, 714, 13740, 627, 13726, 549,
+		13712, 479, 13700, 417, 13687, 362, 13674, 312, 13662, 269, 13649, 231, 13638, 197, 13625, 167,
+		13614, 141, 13601, 119, 13591, 100, 13579, 83, 13568, 68, 13557, 56, 13545, 46, 13535, 37,
+		13525, 30, 13513, 24, 13503, 19, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13407, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		20646, 26491, 20659, 25460, 20618, 24761, 20561, 24228, 20497, 23792, 20384, 23453, 20255, 23044, 20133, 22745,
+		20018, 22511, 19912, 22164, 19815, 21892, 19726, 21676, 19645, 21499, 19572, 21215, 19505, 20981, 19431, 20787,
+		19319, 20624, 19217, 20486, 19123, 20258, 19036, 20057, 18957, 19884, 18883, 19734, 18815, 19604, 18752, 19490,
+		18693, 19324, 18639, 19147, 18588, 18991, 18540, 18852, 18495, 18728, 18453, 18617, 18395, 18518, 18321, 18426,
+		18251, 18265, 18185, 18119, 18123, 17987, 18064, 17868, 18008, 17759, 17955, 17659, 17904, 17568, 17856, 17485,
+		17811, 17409, 17767, 17270, 17726, 17141, 17686, 17023, 17649, 16914, 17613, 16813, 17578, 16720, 17545, 16633,
+		17513, 16553, 17482, 16479, 17453, 16410, 17425, 16309, 17388, 16190, 17337, 16079, 17287, 15976, 17239, 15879,
+		17192, 15789, 17148, 15705, 17105, 15626, 17063, 15553, 17023, 15484, 16984, 15419, 16947, 15357, 16911, 15243,
+		16876, 15136, 16842, 15036, 16809, 14942, 16778, 14853, 16747, 14769, 16717, 14691, 16688, 14617, 16661, 14547,
+		16634, 14482, 16607, 14420, 16582, 14361, 16557, 14276, 16533, 14172, 16510, 14074, 16487, 13980, 16465, 13892,
+		16443, 13809, 16422, 13731, 16402, 13656, 16380, 13586, 16342, 13519, 16304, 13456, 16268, 13396, 16232, 13340,
+		16197, 13260, 16164, 13158, 16131, 13062, 16099, 12970, 16068, 12884, 16037, 12801, 16007, 12723, 15978, 12649,
+		15950, 12579, 15922, 12513, 15895, 12449, 15869, 12389, 15843, 12332, 15818, 12268, 15793, 12165, 15769, 12068,
+		15746, 11975, 15723, 11887, 15701, 11803, 15679, 11724, 15657, 11648, 15636, 11576, 15616, 11508, 15596, 11443,
+		15576, 11381, 15557, 11323, 15538, 11267, 15520, 11165, 15502, 11064, 15484, 10969, 15467, 10878, 15450, 10792,
+		15433, 10710, 15417, 10632, 15401, 10558, 15386, 10487, 15371, 10420, 15351, 10357, 15322, 10296, 15293, 10238,
+		15265, 10129, 15238, 10025, 15211, 9927, 15184, 9834, 15158, 9745, 15133, 9661, 15108, 9581, 15083, 9505,
+		15059, 9433, 15036, 9364, 15013, 9299, 14989, 9238, 14967, 9143, 14945, 9032, 14924, 8927, 14903, 8827,
+		14882, 8732, 14862, 8643, 14841, 8558, 14822, 8477, 14803, 8401, 14784, 8329, 14765, 8261, 14747, 8196,
+		14729, 8078, 14711, 7962, 14694, 7852, 14677, 7748, 14661, 7651, 14644, 7558, 14628, 7470, 14612, 7388,
+		14597, 7310, 14581, 7236, 14566, 7165, 14551, 7034, 14536, 6910, 14522, 6794, 14509, 6684, 14495, 6581,
+		14481, 6483, 14467, 6391, 14454, 6305, 14441, 6224, 14429, 6148, 14416, 6009, 14403, 5875, 14391, 5749,
+		14379, 5631, 14368, 5520, 14356, 5416, 14345, 5319, 14331, 5228, 14309, 5143, 14287, 5007, 14265, 4858,
+		14245, 4720, 14224, 4590, 14204, 4470, 14183, 4358, 14164, 4253, 14144, 4156, 14125, 4036, 14106, 3869,
+		14087, 3714, 14069, 3570, 14051, 3437, 14033, 3313, 14015, 3200, 13998, 3095, 13981, 2924, 13965, 2746,
+		13948, 2582, 13932, 2431, 13916, 2293, 13900, 2166, 13885, 2051, 13869, 1842, 13854, 1649, 13839, 1473,
+		13823, 1313, 13809, 1168, 13795, 1037, 13781, 918, 13767, 811, 13752, 714, 13740, 627, 13726, 549,
+		13712, 479, 13700, 417, 13687, 362, 13674, 313, 13662, 269, 13649, 231, 13638, 197, 13625, 167,
+		13614, 142, 13601, 119, 13591, 100, 13579, 83, 13567, 68, 13557, 56, 13545, 46, 13535, 37,
+		13524, 30, 13513, 24, 13503, 19, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13407, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		20486, 26224, 20522, 25247, 20498, 24640, 20434, 24072, 20337, 23687, 20235, 23307, 20131, 22941, 20029, 22671,
+		19932, 22404, 19841, 22085, 19756, 21833, 19676, 21631, 19604, 21431, 19536, 21162, 19475, 20940, 19380, 20754,
+		19275, 20598, 19179, 20450, 19090, 20224, 19008, 20030, 18932, 19862, 18862, 19716, 18796, 19589, 18735, 19477,
+		18678, 19303, 18625, 19129, 18575, 18976, 18529, 18839, 18485, 18717, 18444, 18608, 18380, 18510, 18307, 18412,
+		18238, 18252, 18173, 18108, 18112, 17978, 18054, 17859, 17999, 17751, 17946, 17652, 17897, 17562, 17849, 17480,
+		17804, 17401, 17761, 17262, 17720, 17134, 17681, 17017, 17644, 16908, 17608, 16808, 17574, 16716, 17541, 16630,
+		17509, 16550, 17479, 16476, 17450, 16408, 17422, 16305, 17383, 16186, 17332, 16075, 17282, 15972, 17234, 15876,
+		17188, 15786, 17144, 15703, 17101, 15624, 17060, 15551, 17020, 15482, 16981, 15417, 16944, 15354, 16908, 15240,
+		16873, 15134, 16840, 15033, 16807, 14939, 16775, 14851, 16745, 14768, 16715, 14689, 16687, 14615, 16659, 14546,
+		16632, 14480, 16606, 14418, 16580, 14360, 16555, 14274, 16531, 14170, 16508, 14071, 16485, 13978, 16463, 13891,
+		16442, 13808, 16421, 13729, 16401, 13655, 16378, 13584, 16340, 13518, 16302, 13455, 16266, 13395, 16230, 13339,
+		16196, 13258, 16162, 13156, 16129, 13060, 16098, 12971, 16066, 12884, 16036, 12802, 16006, 12723, 15977, 12649,
+		15949, 12579, 15921, 12512, 15894, 12449, 15868, 12389, 15842, 12332, 15817, 12268, 15792, 12165, 15768, 12067,
+		15745, 11975, 15722, 11887, 15700, 11803, 15678, 11723, 15656, 11648, 15636, 11576, 15615, 11508, 15595, 11443,
+		15575, 11381, 15557, 11323, 15537, 11267, 15519, 11164, 15501, 11064, 15484, 10968, 15466, 10878, 15449, 10791,
+		15433, 10709, 15417, 10631, 15401, 10557, 15385, 10487, 15370, 10420, 15350, 10357, 15321, 10296, 15293, 10238,
+		15264, 10129, 15237, 10025, 15210, 9927, 15183, 9833, 15157, 9745, 15132, 9661, 15107, 9581, 15083, 9505,
+		15058, 9433, 15035, 9364, 15012, 9299, 14989, 9238, 14967, 9143, 14945, 9032, 14924, 8927, 14902, 8827,
+		14881, 8732, 14861, 8643, 14841, 8558, 14822, 8478, 14802, 8401, 14783, 8329, 14765, 8261, 14747, 8196,
+		14729, 8078, 14711, 7962, 14694, 7852, 14677, 7749, 14661, 7651, 14644, 7558, 14628, 7471, 14612, 7388,
+		14597, 7310, 14581, 7236, 14566, 7165, 14551, 7034, 14536, 6911, 14522, 6794, 14508, 6684, 14494, 6581,
+		14480, 6483, 14467, 6392, 14454, 6305, 14441, 6224, 14429, 6148, 14416, 6010, 14403, 5875, 14391, 5749,
+		14379, 5631, 14368, 5520, 14356, 5416, 14344, 5319, 14331, 5228, 14309, 5143, 14287, 5007, 14265, 4859,
+		14245, 4720, 14224, 4591, 14204, 4470, 14183, 4358, 14164, 4254, 14144, 4157, 14125, 4037, 14106, 3869,
+		14087, 3714, 14069, 3570, 14051, 3437, 14033, 3314, 14015, 3200, 13998, 3095, 13981, 2925, 13965, 2746,
+		13948, 2582, 13932, 2432, 13916, 2294, 13900, 2167, 13884, 2051, 13869, 1843, 13854, 1650, 13838, 1474,
+		13823, 1314, 13809, 1169, 13795, 1037, 13781, 918, 13767, 811, 13752, 714, 13740, 627, 13726, 549,
+		13712, 480, 13700, 417, 13687, 362, 13674, 313, 13662, 269, 13649, 231, 13637, 197, 13625, 167,
+		13614, 142, 13601, 119, 13590, 100, 13579, 83, 13567, 69, 13557, 56, 13545, 46, 13535, 37,
+		13524, 30, 13513, 24, 13503, 19, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13407, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		20233, 26002, 20337, 25070, 20314, 24498, 20256, 23939, 20183, 23596, 20101, 23177, 20017, 22847, 19932, 22602,
+		19850, 22302, 19772, 22008, 19697, 21775, 19627, 21587, 19561, 21362, 19501, 21109, 19432, 20898, 19327, 20721,
+		19230, 20571, 19139, 20407, 19056, 20189, 18978, 20001, 18905, 19838, 18838, 19696, 18775, 19572, 18717, 19464,
+		18662, 19279, 18611, 19110, 18563, 18960, 18517, 18825, 18475, 18705, 18435, 18598, 18362, 18501, 18291, 18396,
+		18224, 18239, 18161, 18097, 18100, 17968, 18043, 17850, 17989, 17744, 17937, 17646, 17888, 17556, 17842, 17475,
+		17797, 17391, 17755, 17253, 17714, 17127, 17675, 17010, 17638, 16902, 17603, 16803, 17569, 16711, 17537, 16625,
+		17505, 16546, 17475, 16473, 17447, 16405, 17419, 16299, 17377, 16181, 17326, 16071, 17277, 15968, 17229, 15873,
+		17184, 15784, 17140, 15700, 17097, 15622, 17056, 15548, 17016, 15480, 16978, 15415, 16941, 15350, 16905, 15238,
+		16871, 15131, 16837, 15031, 16805, 14937, 16773, 14849, 16743, 14766, 16713, 14688, 16685, 14614, 16657, 14544,
+		16630, 14479, 16604, 14417, 16578, 14359, 16554, 14272, 16530, 14168, 16507, 14070, 16484, 13977, 16462, 13889,
+		16441, 13806, 16420, 13728, 16400, 13654, 16376, 13583, 16337, 13517, 16300, 13454, 16264, 13394, 16229, 13338,
+		16194, 13257, 16160, 13155, 16128, 13059, 16096, 12968, 16064, 12882, 16034, 12799, 16005, 12722, 15975, 12648,
+		15947, 12578, 15920, 12511, 15893, 12448, 15867, 12388, 15841, 12331, 15816, 12266, 15791, 12164, 15767, 12066,
+		15744, 11973, 15721, 11885, 15699, 11802, 15677, 11722, 15656, 11647, 15635, 11577, 15615, 11509, 15595, 11444,
+		15575, 11382, 15556, 11323, 15537, 11268, 15519, 11165, 15501, 11065, 15483, 10969, 15466, 10878, 15449, 10792,
+		15432, 10710, 15416, 10632, 15400, 10558, 15385, 10487, 15370, 10420, 15350, 10357, 15320, 10296, 15292, 10238,
+		15264, 10129, 15236, 10026, 15209, 9927, 15183, 9834, 15157, 9745, 15132, 9661, 15106, 9581, 15082, 9505,
+		15058, 9433, 15034, 9364, 15011, 9299, 14989, 9238, 14966, 9143, 14944, 9032, 14923, 8927, 14902, 8827,
+		14881, 8733, 14861, 8643, 14841, 8558, 14821, 8478, 14802, 8402, 14783, 8329, 14765, 8261, 14746, 8196,
+		14728, 8078, 14711, 7962, 14694, 7853, 14677, 7749, 14660, 7651, 14644, 7558, 14628, 7471, 14612, 7388,
+		14596, 7310, 14581, 7237, 14566, 7166, 14551, 7035, 14536, 6911, 14522, 6794, 14508, 6685, 14494, 6581,
+		14480, 6484, 14467, 6392, 14454, 6306, 14441, 6225, 14428, 6149, 14416, 6010, 14403, 5876, 14391, 5750,
+		14379, 5631, 14367, 5521, 14356, 5417, 14344, 5320, 14331, 5229, 14309, 5143, 14287, 5008, 14265, 4859,
+		14245, 4721, 14223, 4591, 14204, 4471, 14183, 4359, 14164, 4254, 14144, 4157, 14125, 4038, 14106, 3870,
+		14087, 3715, 14069, 3571, 14051, 3438, 14033, 3315, 14015, 3201, 13998, 3096, 13981, 2926, 13965, 2747,
+		13948, 2583, 13932, 2433, 13916, 2294, 13900, 2168, 13884, 2052, 13869, 1844, 13853, 1651, 13838, 1475,
+		13823, 1315, 13809, 1170, 13795, 1038, 13781, 919, 13767, 812, 13752, 715, 13739, 628, 13726, 550,
+		13712, 480, 13700, 418, 13687, 362, 13674, 313, 13662, 270, 13649, 231, 13637, 197, 13625, 168,
+		13614, 142, 13601, 119, 13590, 100, 13579, 83, 13567, 69, 13557, 56, 13545, 46, 13535, 37,
+		13524, 30, 13513, 24, 13503, 19, 13493, 14, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13406, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		20014, 25808, 20144, 24916, 20143, 24323, 20103, 23824, 20047, 23479, 19982, 23062, 19913, 22763, 19843, 22539,
+		19773, 22206, 19705, 21935, 19640, 21719, 19578, 21543, 19520, 21294, 19464, 21055, 19370, 20855, 19273, 20687,
+		19183, 20543, 19098, 20362, 19020, 20152, 18946, 19971, 18878, 19813, 18814, 19676, 18753, 19555, 18697, 19442,
+		18645, 19255, 18595, 19090, 18549, 18942, 18505, 18810, 18464, 18692, 18417, 18587, 18344, 18492, 18275, 18380,
+		18209, 18225, 18147, 18085, 18088, 17957, 18032, 17841, 17978, 17735, 17927, 17638, 17879, 17550, 17833, 17469,
+		17790, 17382, 17748, 17245, 17708, 17119, 17670, 17004, 17633, 16896, 17598, 16797, 17564, 16706, 17532, 16621,
+		17501, 16542, 17471, 16469, 17443, 16401, 17415, 16293, 17370, 16175, 17320, 16066, 17271, 15964, 17224, 15868,
+		17178, 15779, 17134, 15696, 17092, 15618, 17051, 15545, 17012, 15477, 16974, 15413, 16937, 15346, 16902, 15233,
+		16867, 15128, 16834, 15028, 16802, 14935, 16771, 14847, 16740, 14764, 16711, 14686, 16682, 14612, 16655, 14543,
+		16628, 14478, 16602, 14416, 16576, 14358, 16552, 14270, 16528, 14167, 16505, 14069, 16483, 13976, 16461, 13888,
+		16439, 13805, 16419, 13727, 16398, 13653, 16374, 13583, 16335, 13516, 16298, 13453, 16262, 13394, 16227, 13337,
+		16192, 13256, 16159, 13155, 16126, 13058, 16094, 12967, 16063, 12881, 16033, 12799, 16003, 12721, 15974, 12647,
+		15946, 12577, 15918, 12511, 15892, 12448, 15865, 12388, 15840, 12331, 15815, 12266, 15790, 12163, 15766, 12066,
+		15743, 11973, 15720, 11885, 15698, 11801, 15676, 11722, 15655, 11647, 15634, 11575, 15614, 11507, 15594, 11442,
+		15574, 11381, 15555, 11322, 15536, 11266, 15518, 11163, 15500, 11063, 15482, 10967, 15465, 10877, 15448, 10791,
+		15432, 10709, 15416, 10631, 15400, 10557, 15384, 10486, 15369, 10420, 15349, 10356, 15319, 10296, 15291, 10237,
+		15263, 10128, 15236, 10030, 15209, 9931, 15182, 9837, 15157, 9748, 15131, 9663, 15106, 9583, 15081, 9507,
+		15057, 9434, 15034, 9366, 15011, 9301, 14988, 9239, 14966, 9145, 14944, 9034, 14923, 8928, 14902, 8829,
+		14881, 8734, 14861, 8644, 14840, 8559, 14821, 8479, 14802, 8402, 14783, 8330, 14765, 8262, 14746, 8197,
+		14728, 8079, 14711, 7963, 14693, 7854, 14677, 7750, 14660, 7652, 14643, 7559, 14627, 7472, 14611, 7389,
+		14596, 7311, 14581, 7237, 14566, 7167, 14551, 7036, 14536, 6912, 14522, 6796, 14508, 6686, 14494, 6582,
+		14480, 6485, 14467, 6393, 14454, 6307, 14441, 6226, 14428, 6149, 14415, 6011, 14403, 5877, 14391, 5751,
+		14379, 5633, 14367, 5522, 14356, 5418, 14344, 5320, 14330, 5229, 14309, 5144, 14287, 5009, 14265, 4861,
+		14245, 4722, 14223, 4593, 14203, 4472, 14183, 4360, 14163, 4255, 14143, 4158, 14125, 4039, 14105, 3872,
+		14087, 3716, 14069, 3572, 14051, 3439, 14033, 3316, 14015, 3202, 13998, 3097, 13981, 2927, 13964, 2749,
+		13948, 2585, 13931, 2434, 13915, 2296, 13900, 2169, 13884, 2053, 13869, 1846, 13853, 1653, 13838, 1477,
+		13823, 1317, 13809, 1171, 13795, 1040, 13781, 920, 13766, 813, 13753, 716, 13739, 629, 13726, 551,
+		13712, 481, 13700, 418, 13687, 363, 13674, 314, 13662, 270, 13649, 232, 13637, 198, 13625, 168,
+		13614, 142, 13601, 120, 13590, 100, 13579, 83, 13567, 69, 13557, 57, 13545, 46, 13535, 37,
+		13524, 30, 13513, 24, 13503, 19, 13493, 15, 13483, 11, 13472, 8, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13406, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		19829, 25641, 19977, 24780, 19994, 24170, 19969, 23723, 19927, 23337, 19876, 22959, 19819, 22686, 19761, 22434,
+		19701, 22117, 19643, 21867, 19586, 21666, 19531, 21498, 19479, 21228, 19402, 21002, 19307, 20813, 19219, 20653,
+		19135, 20516, 19057, 20317, 18983, 20115, 18914, 19940, 18849, 19788, 18788, 19654, 18731, 19538, 18677, 19412,
+		18626, 19230, 18579, 19068, 18534, 18924, 18491, 18794, 18452, 18679, 18396, 18575, 18324, 18482, 18257, 18363,
+		18193, 18210, 18132, 18071, 18074, 17946, 18019, 17831, 17967, 17727, 17917, 17631, 17870, 17544, 17825, 17463,
+		17781, 17372, 17740, 17236, 17701, 17111, 17663, 16996, 17627, 16890, 17592, 16792, 17559, 16701, 17527, 16616,
+		17497, 16538, 17467, 16466, 17439, 16398, 17412, 16288, 17364, 16171, 17313, 16061, 17265, 15960, 17218, 15865,
+		17173, 15776, 17129, 15693, 17087, 15615, 17047, 15543, 17008, 15475, 16970, 15411, 16933, 15342, 16898, 15230,
+		16864, 15124, 16831, 15025, 16798, 14932, 16767, 14844, 16737, 14761, 16708, 14683, 16680, 14610, 16652, 14541,
+		16626, 14476, 16600, 14415, 16574, 14356, 16550, 14267, 16526, 14165, 16503, 14067, 16481, 13975, 16459, 13887,
+		16438, 13805, 16417, 13726, 16397, 13652, 16371, 13582, 16333, 13516, 16296, 13453, 16260, 13393, 16224, 13337,
+		16190, 13255, 16157, 13154, 16124, 13059, 16093, 12968, 16062, 12881, 16031, 12799, 16002, 12721, 15973, 12647,
+		15945, 12577, 15917, 12511, 15890, 12448, 15864, 12388, 15839, 12331, 15814, 12266, 15789, 12163, 15765, 12066,
+		15742, 11973, 15719, 11885, 15697, 11801, 15675, 11722, 15654, 11647, 15633, 11575, 15613, 11507, 15593, 11442,
+		15573, 11381, 15554, 11322, 15535, 11267, 15517, 11163, 15499, 11063, 15482, 10968, 15465, 10877, 15448, 10791,
+		15431, 10709, 15415, 10631, 15399, 10557, 15384, 10487, 15369, 10420, 15348, 10356, 15319, 10296, 15290, 10237,
+		15262, 10128, 15235, 10025, 15208, 9927, 15181, 9833, 15155, 9745, 15130, 9661, 15105, 9581, 15081, 9505,
+		15057, 9433, 15033, 9364, 15010, 9299, 14987, 9238, 14965, 9143, 14943, 9032, 14922, 8927, 14901, 8827,
+		14880, 8733, 14860, 8643, 14840, 8558, 14821, 8478, 14801, 8402, 14782, 8330, 14764, 8266, 14746, 8201,
+		14728, 8086, 14711, 7970, 14693, 7859, 14676, 7755, 14660, 7656, 14643, 7563, 14627, 7475, 14611, 7392,
+		14596, 7313, 14581, 7239, 14565, 7170, 14551, 7040, 14536, 6915, 14522, 6799, 14508, 6688, 14494, 6585,
+		14480, 6487, 14467, 6395, 14454, 6309, 14441, 6227, 14428, 6151, 14415, 6014, 14403, 5880, 14391, 5753,
+		14379, 5635, 14367, 5524, 14356, 5420, 14344, 5322, 14330, 5231, 14308, 5146, 14286, 5012, 14265, 4863,
+		14244, 4724, 14223, 4595, 14203, 4474, 14183, 4362, 14163, 4257, 14143, 4160, 14125, 4043, 14105, 3875,
+		14087, 3719, 14069, 3575, 14050, 3441, 14032, 3318, 14015, 3204, 13998, 3099, 13981, 2931, 13964, 2752,
+		13948, 2588, 13931, 2437, 13915, 2298, 13899, 2171, 13884, 2055, 13869, 1850, 13853, 1656, 13838, 1480,
+		13823, 1319, 13809, 1174, 13795, 1042, 13781, 923, 13766, 815, 13753, 718, 13739, 631, 13726, 552,
+		13712, 482, 13700, 420, 13687, 364, 13674, 315, 13662, 271, 13649, 232, 13637, 198, 13625, 169,
+		13614, 143, 13601, 120, 13590, 101, 13579, 84, 13567, 69, 13557, 57, 13545, 46, 13535, 38,
+		13524, 30, 13513, 24, 13503, 19, 13493, 15, 13483, 11, 13472, 9, 13463, 6, 13453, 5,
+		13443, 3, 13434, 2, 13424, 2, 13415, 1, 13406, 1, 13397, 0, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		19674, 25395, 19832, 24659, 19863, 24032, 19851, 23634, 19821, 23211, 19780, 22865, 19734, 22615, 19685, 22326,
+		19634, 22034, 19584, 21802, 19534, 21614, 19485, 21417, 19421, 21163, 19331, 20950, 19246, 20771, 19164, 20619,
+		19087, 20488, 19014, 20272, 18946, 20078, 18881, 19909, 18819, 19762, 18762, 19633, 18707, 19519, 18656, 19382,
+		18608, 19204, 18562, 19045, 18519, 18904, 18478, 18778, 18439, 18665, 18373, 18563, 18304, 18471, 18238, 18345,
+		18175, 18194, 18116, 18057, 18060, 17934, 18006, 17821, 17955, 17717, 17906, 17623, 17859, 17536, 17815, 17457,
+		17772, 17360, 17732, 17226, 17693, 17103, 17656, 16988, 17620, 16883, 17586, 16786, 17553, 16696, 17522, 16612,
+		17492, 16534, 17463, 16462, 17435, 16395, 17408, 16281, 17356, 16164, 17306, 16056, 17258, 15955, 17212, 15861,
+		17167, 15773, 17124, 15690, 17082, 15613, 17042, 15540, 17003, 15473, 16966, 15409, 16929, 15339, 16894, 15227,
+		16860, 15121, 16827, 15022, 16795, 14929, 16764, 14841, 16734, 14759, 16705, 14681, 16677, 14608, 16650, 14539,
+		16623, 14474, 16597, 14413, 16572, 14355, 16548, 14265, 16524, 14162, 16501, 14064, 16479, 13972, 16457, 13884,
+		16436, 13802, 16415, 13724, 16395, 13650, 16368, 13580, 16330, 13515, 16293, 13452, 16257, 13392, 16222, 13336,
+		16188, 13253, 16154, 13152, 16122, 13057, 16091, 12967, 16060, 12881, 16030, 12799, 16000, 12721, 15971, 12647,
+		15943, 12577, 15916, 12511, 15889, 12448, 15863, 12388, 15837, 12331, 15813, 12265, 15788, 12163, 15764, 12065,
+		15741, 11973, 15718, 11885, 15696, 11803, 15675, 11723, 15653, 11648, 15632, 11576, 15612, 11508, 15592, 11443,
+		15573, 11381, 15554, 11323, 15535, 11267, 15517, 11165, 15499, 11064, 15481, 10969, 15464, 10878, 15447, 10792,
+		15431, 10710, 15415, 10632, 15399, 10558, 15383, 10487, 15368, 10420, 15347, 10357, 15318, 10297, 15289, 10238,
+		15261, 10129, 15234, 10026, 15207, 9928, 15181, 9834, 15155, 9745, 15129, 9661, 15104, 9581, 15080, 9505,
+		15056, 9433, 15033, 9365, 15009, 9300, 14987, 9238, 14965, 9144, 14943, 9033, 14921, 8928, 14900, 8828,
+		14880, 8734, 14860, 8644, 14840, 8559, 14820, 8479, 14801, 8402, 14782, 8330, 14764, 8262, 14745, 8197,
+		14727, 8080, 14710, 7964, 14693, 7854, 14676, 7750, 14659, 7652, 14643, 7560, 14627, 7472, 14611, 7389,
+		14595, 7311, 14580, 7238, 14565, 7168, 14550, 7037, 14536, 6913, 14521, 6796, 14507, 6687, 14494, 6583,
+		14480, 6486, 14466, 6394, 14454, 6320, 14441, 6237, 14428, 6159, 14415, 6029, 14403, 5892, 14391, 5764,
+		14379, 5644, 14367, 5532, 14356, 5427, 14344, 5329, 14330, 5237, 14308, 5151, 14286, 5021, 14265, 4871,
+		14244, 4732, 14223, 4601, 14203, 4480, 14183, 4367, 14163, 4262, 14143, 4164, 14124, 4050, 14105, 3882,
+		14087, 3726, 14069, 3581, 14050, 3447, 14032, 3323, 14015, 3208, 13998, 3103, 13981, 2938, 13964, 2759,
+		13948, 2594, 13931, 2442, 13915, 2303, 13899, 2176, 13884, 2059, 13868, 1858, 13853, 1663, 13838, 1486,
+		13823, 1325, 13809, 1179, 13795, 1047, 13781, 927, 13766, 819, 13753, 721, 13739, 634, 13726, 555,
+		13712, 485, 13700, 422, 13687, 366, 13674, 317, 13662, 273, 13649, 234, 13637, 200, 13625, 170,
+		13613, 144, 13601, 121, 13590, 102, 13579, 85, 13567, 70, 13557, 58, 13545, 47, 13535, 38,
+		13524, 31, 13513, 24, 13503, 19, 13493, 15, 13483, 12, 13472, 9, 13463, 7, 13453, 5,
+		13443, 4, 13434, 3, 13424, 2, 13415, 1, 13406, 1, 13397, 1, 13388, 0, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13344, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		19544, 25156, 19705, 24526, 19748, 23911, 19747, 23554, 19725, 23097, 19694, 22781, 19656, 22552, 19615, 22227,
+		19572, 21957, 19528, 21741, 19485, 21566, 19427, 21340, 19344, 21101, 19263, 20900, 19185, 20730, 19110, 20585,
+		19040, 20441, 18972, 20226, 18908, 20040, 18847, 19878, 18789, 19735, 18735, 19611, 18683, 19501, 18634, 19350,
+		18588, 19177, 18544, 19023, 18503, 18885, 18463, 18762, 18420, 18651, 18349, 18550, 18282, 18460, 18218, 18326,
+		18157, 18178, 18099, 18044, 18044, 17922, 17992, 17810, 17942, 17708, 17894, 17614, 17848, 17529, 17805, 17451,
+		17763, 17349, 17723, 17216, 17685, 17093, 17648, 16980, 17613, 16876, 17580, 16779, 17547, 16689, 17516, 16607,
+		17486, 16529, 17458, 16458, 17430, 16391, 17399, 16274, 17348, 16160, 17299, 16052, 17251, 15951, 17205, 15857,
+		17161, 15769, 17118, 15687, 17077, 15610, 17037, 15537, 16998, 15470, 16961, 15406, 16925, 15334, 16890, 15223,
+		16856, 15118, 16824, 15019, 16792, 14926, 16761, 14839, 16731, 14757, 16702, 14679, 16674, 14607, 16647, 14538,
+		16621, 14473, 16595, 14412, 16570, 14354, 16546, 14263, 16522, 14160, 16499, 14062, 16477, 13970, 16455, 13883,
+		16434, 13801, 16414, 13723, 16394, 13649, 16365, 13579, 16327, 13513, 16291, 13451, 16255, 13392, 16220, 13335,
+		16185, 13252, 16152, 13151, 16120, 13055, 16088, 12964, 16057, 12878, 16027, 12796, 15998, 12719, 15969, 12645,
+		15941, 12575, 15914, 12510, 15887, 12447, 15861, 12387, 15836, 12330, 15811, 12264, 15787, 12162, 15763, 12065,
+		15740, 11974, 15718, 11887, 15695, 11803, 15674, 11724, 15652, 11648, 15632, 11576, 15611, 11508, 15591, 11443,
+		15572, 11382, 15553, 11323, 15534, 11267, 15516, 11165, 15498, 11064, 15481, 10969, 15463, 10878, 15447, 10792,
+		15430, 10710, 15414, 10632, 15398, 10558, 15383, 10490, 15368, 10422, 15346, 10359, 15317, 10298, 15289, 10241,
+		15261, 10132, 15233, 10028, 15206, 9930, 15180, 9836, 15154, 9748, 15129, 9663, 15104, 9583, 15079, 9507,
+		15056, 9435, 15032, 9366, 15009, 9301, 14986, 9240, 14964, 9146, 14942, 9035, 14921, 8930, 14900, 8830,
+		14879, 8735, 14859, 8646, 14839, 8561, 14820, 8480, 14800, 8404, 14782, 8332, 14763, 8263, 14745, 8198,
+		14727, 8082, 14710, 7966, 14692, 7856, 14675, 7752, 14659, 7654, 14642, 7561, 14626, 7474, 14611, 7391,
+		14595, 7313, 14580, 7239, 14565, 7169, 14550, 7039, 14535, 6915, 14521, 6799, 14507, 6689, 14493, 6585,
+		14480, 6487, 14466, 6395, 14453, 6309, 14440, 6228, 14428, 6151, 14415, 6016, 14403, 5881, 14391, 5755,
+		14379, 5636, 14367, 5525, 14355, 5421, 14344, 5323, 14330, 5232, 14308, 5147, 14286, 5014, 14264, 4865,
+		14244, 4726, 14223, 4597, 14202, 4476, 14182, 4363, 14163, 4259, 14144, 4188, 14125, 4091, 14106, 3917,
+		14087, 3755, 14069, 3606, 14051, 3469, 14033, 3342, 14015, 3225, 13998, 3117, 13981, 2963, 13964, 2781,
+		13948, 2613, 13931, 2459, 13915, 2318, 13899, 2189, 13884, 2071, 13868, 1879, 13853, 1682, 13838, 1503,
+		13823, 1340, 13809, 1193, 13795, 1059, 13781, 938, 13766, 829, 13753, 730, 13739, 642, 13726, 562,
+		13712, 491, 13700, 428, 13687, 371, 13674, 321, 13662, 277, 13649, 238, 13637, 203, 13625, 173,
+		13614, 147, 13602, 124, 13590, 104, 13579, 86, 13567, 72, 13557, 59, 13545, 48, 13535, 39,
+		13524, 32, 13513, 25, 13503, 20, 13493, 16, 13483, 12, 13473, 9, 13463, 7, 13453, 5,
+		13443, 4, 13434, 3, 13424, 2, 13415, 1, 13406, 1, 13397, 1, 13388, 1, 13379, 0,
+		13371, 0, 13362, 0, 13353, 0, 13345, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		19413, 24951, 19592, 24330, 19645, 23799, 19652, 23408, 19639, 22993, 19615, 22704, 19585, 22458, 19550, 22136,
+		19514, 21884, 19476, 21683, 19420, 21520, 19344, 21266, 19269, 21040, 19196, 20851, 19126, 20690, 19057, 20552,
+		18992, 20386, 18930, 20181, 18870, 20002, 18813, 19846, 18759, 19709, 18708, 19588, 18659, 19482, 18612, 19318,
+		18568, 19150, 18526, 18999, 18486, 18865, 18448, 18744, 18393, 18636, 18325, 18538, 18260, 18450, 18198, 18307,
+		18138, 18161, 18082, 18029, 18028, 17908, 17977, 17799, 17928, 17698, 17882, 17606, 17837, 17521, 17794, 17444,
+		17753, 17337, 17714, 17205, 17677, 17084, 17640, 16972, 17606, 16868, 17573, 16773, 17541, 16684, 17511, 16602,
+		17481, 16525, 17453, 16454, 17425, 16388, 17390, 16268, 17339, 16153, 17291, 16045, 17244, 15946, 17198, 15852,
+		17154, 15765, 17112, 15683, 17071, 15607, 17032, 15535, 16993, 15468, 16956, 15405, 16921, 15331, 16886, 15220,
+		16852, 15115, 16820, 15017, 16788, 14924, 16758, 14837, 16728, 14755, 16699, 14677, 16671, 14605, 16644, 14536,
+		16618, 14472, 16592, 14410, 16568, 14353, 16544, 14261, 16520, 14158, 16497, 14061, 16475, 13969, 16454, 13882,
+		16433, 13801, 16412, 13723, 16392, 13649, 16362, 13579, 16325, 13513, 16288, 13450, 16252, 13391, 16217, 13335,
+		16183, 13251, 16150, 13150, 16118, 13054, 16086, 12964, 16055, 12878, 16025, 12796, 15996, 12718, 15967, 12645,
+		15940, 12575, 15912, 12510, 15886, 12447, 15860, 12387, 15834, 12330, 15810, 12264, 15785, 12162, 15762, 12064,
+		15739, 11972, 15716, 11884, 15694, 11801, 15672, 11721, 15651, 11646, 15630, 11574, 15610, 11508, 15590, 11443,
+		15571, 11381, 15552, 11323, 15533, 11267, 15515, 11165, 15497, 11064, 15480, 10969, 15463, 10878, 15446, 10796,
+		15430, 10714, 15414, 10635, 15398, 10561, 15383, 10490, 15368, 10423, 15345, 10359, 15316, 10299, 15288, 10241,
+		15260, 10133, 15232, 10030, 15206, 9931, 15179, 9837, 15153, 9749, 15128, 9664, 15103, 9584, 15079, 9508,
+		15055, 9436, 15031, 9367, 15008, 9302, 14986, 9240, 14964, 9153, 14942, 9041, 14921, 8935, 14900, 8835,
+		14879, 8740, 14859, 8650, 14839, 8565, 14820, 8484, 14800, 8407, 14782, 8335, 14763, 8266, 14745, 8201,
+		14727, 8087, 14710, 7970, 14692, 7860, 14675, 7756, 14659, 7658, 14642, 7565, 14626, 7477, 14610, 7394,
+		14595, 7316, 14580, 7242, 14565, 7172, 14550, 7044, 14535, 6920, 14521, 6803, 14507, 6692, 14493, 6588,
+		14480, 6491, 14466, 6399, 14453, 6312, 14440, 6231, 14427, 6154, 14415, 6020, 14403, 5886, 14391, 5759,
+		14379, 5640, 14367, 5529, 14355, 5424, 14344, 5327, 14330, 5235, 14308, 5150, 14286, 5020, 14264, 4871,
+		14244, 4731, 14223, 4602, 14202, 4480, 14182, 4368, 14163, 4263, 14143, 4165, 14124, 4053, 14105, 3884,
+		14086, 3728, 14068, 3583, 14050, 3449, 14032, 3325, 14015, 3211, 13998, 3105, 13981, 2943, 13964, 2764,
+		13947, 2599, 13931, 2447, 13915, 2308, 13899, 2180, 13884, 2063, 13868, 1866, 13854, 1797, 13839, 1599,
+		13824, 1421, 13809, 1261, 13795, 1116, 13781, 987, 13767, 870, 13753, 766, 13739, 672, 13726, 589,
+		13713, 514, 13700, 448, 13687, 389, 13674, 336, 13662, 290, 13649, 249, 13638, 214, 13625, 182,
+		13614, 155, 13602, 131, 13590, 110, 13579, 92, 13568, 77, 13557, 64, 13545, 52, 13535, 43,
+		13524, 35, 13513, 28, 13503, 23, 13493, 18, 13483, 14, 13473, 11, 13463, 9, 13453, 7,
+		13444, 5, 13434, 4, 13425, 3, 13415, 3, 13406, 2, 13397, 2, 13388, 1, 13379, 1,
+		13371, 1, 13362, 1, 13353, 1, 13345, 1, 13336, 1, 13328, 1, 13320, 1, 13312, 0,
+		19227, 24778, 19492, 24153, 19552, 23697, 19568, 23276, 19561, 22899, 19544, 22634, 19519, 22350, 19491, 22051,
+		19460, 21817, 19398, 21630, 19331, 21449, 19264, 21195, 19197, 20983, 19132, 20803, 19068, 20651, 19005, 20519,
+		18946, 20332, 18888, 20136, 18832, 19965, 18779, 19814, 18728, 19682, 18680, 19566, 18634, 19463, 18590, 19286,
+		18548, 19122, 18508, 18976, 18470, 18845, 18433, 18727, 18365, 18621, 18299, 18525, 18236, 18438, 18176, 18287,
+		18119, 18144, 18064, 18015, 18012, 17896, 17962, 17787, 17914, 17688, 17869, 17597, 17825, 17513, 17783, 17437,
+		17743, 17324, 17705, 17194, 17668, 17074, 17632, 16963, 17598, 16861, 17566, 16766, 17534, 16677, 17504, 16596,
+		17475, 16520, 17447, 16449, 17420, 16382, 17380, 16260, 17330, 16147, 17282, 16041, 17236, 15941, 17191, 15848,
+		17147, 15761, 17105, 15679, 17065, 15603, 17025, 15531, 16988, 15465, 16951, 15402, 16915, 15326, 16881, 15215,
+		16848, 15112, 16816, 15013, 16784, 14921, 16754, 14835, 16725, 14753, 16696, 14676, 16668, 14604, 16641, 14535,
+		16615, 14471, 16590, 14410, 16565, 14352, 16541, 14259, 16518, 14156, 16495, 14059, 16473, 13967, 16452, 13880,
+		16431, 13799, 16410, 13721, 16391, 13647, 16359, 13578, 16321, 13512, 16285, 13450, 16249, 13390, 16214, 13334,
+		16180, 13250, 16147, 13149, 16115, 13054, 16084, 12965, 16053, 12878, 16023, 12797, 15994, 12719, 15966, 12645,
+		15938, 12576, 15911, 12509, 15884, 12446, 15858, 12386, 15833, 12330, 15808, 12264, 15784, 12161, 15760, 12064,
+		15737, 11972, 15715, 11884, 15692, 11800, 15671, 11721, 15650, 11646, 15629, 11576, 15609, 11507, 15589, 11443,
+		15570, 11381, 15551, 11323, 15532, 11267, 15514, 11164, 15496, 11064, 15479, 10969, 15462, 10878, 15445, 10792,
+		15429, 10710, 15413, 10632, 15397, 10558, 15382, 10488, 15367, 10423, 15344, 10359, 15315, 10298, 15286, 10241,
+		15258, 10133, 15231, 10029, 15204, 9930, 15178, 9837, 15152, 9748, 15127, 9667, 15102, 9586, 15078, 9513,
+		15055, 9440, 15031, 9371, 15008, 9305, 14985, 9243, 14963, 9153, 14941, 9042, 14920, 8936, 14899, 8835,
+		14878, 8740, 14858, 8650, 14838, 8565, 14819, 8484, 14800, 8407, 14781, 8335, 14762, 8266, 14744, 8201,
+		14726, 8087, 14709, 7971, 14692, 7861, 14675, 7757, 14658, 7658, 14642, 7565, 14626, 7484, 14610, 7400,
+		14595, 7321, 14579, 7246, 14564, 7176, 14550, 7052, 14535, 6927, 14521, 6809, 14507, 6698, 14493, 6594,
+		14479, 6495, 14466, 6403, 14453, 6316, 14440, 6234, 14427, 6157, 14415, 6026, 14402, 5891, 14390, 5764,
+		14378, 5645, 14367, 5533, 14355, 5428, 14344, 5330, 14329, 5238, 14307, 5153, 14286, 5025, 14264, 4875,
+		14243, 4736, 14223, 4605, 14202, 4484, 14182, 4371, 14162, 4265, 14143, 4168, 14124, 4057, 14105, 3888,
+		14086, 3732, 14068, 3587, 14050, 3452, 14032, 3328, 14015, 3213, 13997, 3107, 13980, 2947, 13964, 2767,
+		13947, 2602, 13931, 2449, 13915, 2310, 13899, 2182, 13883, 2065, 13868, 1868, 13853, 1673, 13838, 1495,
+		13823, 1334, 13809, 1187, 13794, 1054, 13780, 933, 13766, 825, 13752, 727, 13739, 639, 13726, 560,
+		13712, 489, 13700, 426, 13687, 370, 13674, 320, 13662, 275, 13650, 306, 13638, 259, 13625, 219,
+		13614, 184, 13602, 154, 13590, 129, 13579, 107, 13568, 89, 13557, 73, 13546, 60, 13535, 49,
+		13524, 40, 13513, 32, 13503, 26, 13493, 20, 13483, 16, 13473, 13, 13463, 10, 13453, 8,
+		13444, 6, 13434, 4, 13425, 3, 13415, 2, 13406, 2, 13397, 1, 13388, 1, 13379, 1,
+		13371, 1, 13362, 0, 13353, 0, 13345, 0, 13336, 0, 13328, 0, 13320, 0, 13312, 0,
+		19069, 24632, 19352, 23994, 19468, 23603, 19490, 23151, 19490, 22812, 19478, 22569, 19459, 22249, 19415, 21972,
+		19362, 21755, 19306, 21579, 19247, 21366, 19188, 21128, 19128, 20927, 19070, 20758, 19012, 20613, 18955, 20488,
+		18900, 20280, 18846, 20092, 18795, 19927, 18745, 19783, 18698, 19656, 18652, 19544, 18609, 19430, 18567, 19253,
+		18527, 19094, 18489, 18952, 18452, 18824, 18403, 18709, 18336, 18605, 18273, 18511, 18212, 18421, 18154, 18267,
+		18099, 18126, 18046, 17999, 17995, 17882, 17946, 17775, 17900, 17677, 17855, 17588, 17813, 17506, 17772, 17430,
+		17732, 17312, 17695, 17183, 17658, 17064, 17624, 16954, 17590, 16852, 17558, 16759, 17527, 16671, 17498, 16590,
+		17469, 16515, 17441, 16445, 17415, 16375, 17371, 16254, 17321, 16140, 17274, 16034, 17227, 15935, 17183, 15843,
+		17140, 15756, 17098, 15675, 17058, 15600, 17020, 15529, 16982, 15463, 16946, 15400, 16910, 15322, 16876, 15211,
+		16843, 15107, 16811, 15010, 16780, 14918, 16750, 14831, 16721, 14750, 16692, 14674, 16665, 14601, 16638, 14533,
+		16612, 14469, 16587, 14408, 16562, 14351, 16539, 14257, 16516, 14155, 16493, 14058, 16471, 13966, 16450, 13880,
+		16429, 13798, 16409, 13721, 16389, 13647, 16356, 13578, 16318, 13512, 16282, 13449, 16246, 13390, 16211, 13334,
+		16178, 13249, 16145, 13149, 16113, 13054, 16081, 12963, 16051, 12877, 16021, 12796, 15992, 12719, 15964, 12645,
+		15936, 12575, 15909, 12509, 15882, 12446, 15856, 12386, 15831, 12330, 15807, 12265, 15783, 12164, 15759, 12067,
+		15736, 11974, 15714, 11886, 15691, 11802, 15670, 11723, 15649, 11648, 15628, 11576, 15608, 11508, 15588, 11443,
+		15569, 11381, 15550, 11323, 15531, 11267, 15513, 11165, 15495, 11065, 15478, 10969, 15461, 10879, 15444, 10792,
+		15428, 10710, 15412, 10633, 15397, 10560, 15381, 10490, 15366, 10423, 15343, 10359, 15314, 10299, 15285, 10241,
+		15257, 10133, 15230, 10030, 15203, 9931, 15177, 9838, 15151, 9749, 15126, 9664, 15101, 9584, 15077, 9508,
+		15053, 9436, 15030, 9367, 15007, 9305, 14984, 9243, 14962, 9152, 14941, 9041, 14919, 8935, 14898, 8835,
+		14878, 8740, 14857, 8650, 14838, 8565, 14818, 8484, 14799, 8411, 14781, 8338, 14762, 8269, 14744, 8208,
+		14726, 8099, 14709, 7981, 14692, 7870, 14675, 7765, 14658, 7666, 14642, 7572, 14626, 7484, 14610, 7400,
+		14594, 7321, 14579, 7247, 14564, 7177, 14549, 7053, 14535, 6928, 14521, 6810, 14507, 6699, 14493, 6595,
+		14479, 6497, 14466, 6404, 14453, 6317, 14440, 6235, 14427, 6158, 14415, 6029, 14402, 5893, 14390, 5766,
+		14378, 5646, 14367, 5548, 14355, 5442, 14344, 5343, 14329, 5250, 14307, 5163, 14286, 5044, 14264, 4892,
+		14243, 4751, 14223, 4619, 14202, 4496, 14182, 4382, 14162, 4276, 14143, 4177, 14124, 4074, 14105, 3904,
+		14086, 3746, 14068, 3600, 14050, 3464, 14032, 3339, 14015, 3223, 13997, 3116, 13980, 2964, 13964, 2782,
+		13947, 2615, 13931, 2462, 13915, 2322, 13899, 2193, 13883, 2075, 13868, 1886, 13853, 1689, 13838, 1510,
+		13823, 1347, 13809, 1199, 13794, 1065, 13780, 944, 13766, 834, 13753, 736, 13739, 647, 13726, 567,
+		13712, 496, 13700, 432, 13687, 375, 13674, 325, 13662, 280, 13649, 241, 13637, 206, 13625, 175,
+		13613, 149, 13602, 125, 13590, 105, 13579, 88, 13568, 73, 13557, 60, 13545, 49, 13535, 40,
+		13524, 32, 13513, 26, 13504, 54, 13494, 42, 13483, 33, 13473, 26, 13463, 20, 13454, 16,
+		13444, 12, 13434, 9, 13425, 7, 13416, 5, 13407, 4, 13397, 3, 13388, 2, 13379, 2,
+		13371, 1, 13362, 1, 13353, 1, 13345, 1, 13337, 0, 13328, 0, 13320, 0, 13312, 0,
+		18934, 24440, 19197, 23853, 19329, 23480, 19383, 23037, 19393, 22730, 19379, 22488, 19351, 22156, 19312, 21899,
+		19268, 21696, 19219, 21531, 19168, 21288, 19116, 21064, 19063, 20875, 19010, 20714, 18957, 20576, 18906, 20435,
+		18855, 20228, 18806, 20048, 18758, 19891, 18712, 19752, 18667, 19629, 18625, 19521, 18583, 19392, 18544, 19220,
+		18506, 19066, 18470, 18927, 18435, 18803, 18371, 18691, 18308, 18590, 18246, 18498, 18188, 18397, 18132, 18246,
+		18078, 18109, 18027, 17983, 17977, 17868, 17930, 17763, 17885, 17667, 17841, 17578, 17800, 17497, 17760, 17422,
+		17721, 17299, 17684, 17172, 17649, 17055, 17615, 16946, 17582, 16845, 17551, 16752, 17520, 16665, 17491, 16584,
+		17463, 16510, 17435, 16440, 17409, 16367, 17360, 16247, 17311, 16134, 17264, 16029, 17219, 15931, 17175, 15839,
+		17132, 15753, 17091, 15672, 17052, 15597, 17013, 15526, 16976, 15459, 16940, 15397, 16905, 15317, 16871, 15207,
+		16838, 15104, 16807, 15007, 16776, 14916, 16746, 14830, 16717, 14749, 16689, 14672, 16661, 14600, 16635, 14532,
+		16609, 14467, 16584, 14407, 16560, 14349, 16536, 14254, 16513, 14152, 16491, 14057, 16469, 13965, 16447, 13878,
+		16427, 13797, 16407, 13720, 16387, 13646, 16352, 13577, 16315, 13511, 16279, 13449, 16243, 13390, 16209, 13334,
+		16175, 13250, 16142, 13150, 16110, 13054, 16079, 12964, 16049, 12878, 16019, 12797, 15990, 12719, 15962, 12646,
+		15934, 12576, 15907, 12509, 15881, 12447, 15855, 12387, 15830, 12330, 15805, 12266, 15781, 12163, 15758, 12066,
+		15735, 11975, 15712, 11887, 15690, 11803, 15669, 11724, 15648, 11648, 15627, 11577, 15607, 11508, 15587, 11444,
+		15568, 11383, 15549, 11326, 15531, 11270, 15513, 11170, 15495, 11069, 15478, 10973, 15461, 10882, 15444, 10796,
+		15428, 10714, 15412, 10635, 15396, 10561, 15381, 10491, 15365, 10424, 15341, 10360, 15313, 10300, 15284, 10242,
+		15256, 10135, 15229, 10031, 15202, 9933, 15176, 9839, 15150, 9750, 15125, 9666, 15100, 9586, 15076, 9512,
+		15053, 9440, 15029, 9371, 15006, 9306, 14984, 9244, 14962, 9154, 14940, 9042, 14919, 8937, 14898, 8836,
+		14877, 8741, 14857, 8651, 14837, 8566, 14818, 8485, 14799, 8409, 14780, 8336, 14761, 8267, 14743, 8202,
+		14726, 8097, 14708, 7979, 14691, 7869, 14674, 7764, 14658, 7665, 14641, 7571, 14625, 7483, 14609, 7400,
+		14594, 7321, 14579, 7247, 14564, 7182, 14549, 7062, 14535, 6937, 14520, 6818, 14506, 6706, 14493, 6601,
+		14479, 6511, 14466, 6417, 14453, 6329, 14440, 6246, 14427, 6168, 14415, 6046, 14402, 5909, 14390, 5781,
+		14378, 5660, 14367, 5547, 14355, 5441, 14344, 5342, 14329, 5249, 14307, 5163, 14286, 5044, 14264, 4893,
+		14243, 4752, 14222, 4620, 14202, 4498, 14182, 4383, 14162, 4277, 14143, 4178, 14124, 4077, 14105, 3907,
+		14086, 3749, 14068, 3603, 14050, 3467, 14033, 3372, 14015, 3253, 13998, 3143, 13981, 3011, 13964, 2825,
+		13947, 2654, 13931, 2497, 13915, 2352, 13899, 2220, 13884, 2100, 13868, 1931, 13853, 1730, 13838, 1547,
+		13823, 1380, 13809, 1229, 13795, 1092, 13781, 968, 13767, 856, 13753, 756, 13739, 665, 13726, 584,
+		13713, 511, 13700, 446, 13687, 387, 13674, 336, 13662, 290, 13649, 250, 13637, 214, 13625, 183,
+		13614, 156, 13602, 132, 13590, 111, 13579, 93, 13568, 78, 13557, 65, 13546, 53, 13535, 44,
+		13524, 36, 13514, 29, 13503, 23, 13493, 19, 13483, 15, 13473, 12, 13463, 9, 13454, 7,
+		13444, 6, 13434, 5, 13425, 4, 13416, 24, 13407, 18, 13398, 13, 13389, 10, 13380, 7,
+		13371, 5, 13362, 4, 13354, 3, 13345, 2, 13337, 2, 13329, 1, 13320, 1, 13313, 1,
+		18817, 24228, 19058, 23727, 19191, 23321, 19253, 22930, 19273, 22654, 19268, 22375, 19247, 22069, 19217, 21830,
+		19180, 21640, 19138, 21468, 19093, 21214, 19047, 21002, 19000, 20824, 18952, 20671, 18905, 20541, 18858, 20375,
+		18811, 20178, 18766, 20006, 18722, 19855, 18679, 19721, 18637, 19603, 18597, 19498, 18558, 19354, 18521, 19187,
+		18485, 19037, 18451, 18903, 18403, 18782, 18339, 18673, 18278, 18574, 18219, 18484, 18163, 18373, 18109, 18225,
+		18057, 18090, 18007, 17967, 17959, 17854, 17913, 17750, 17869, 17656, 17827, 17569, 17787, 17489, 17748, 17415,
+		17710, 17286, 17674, 17160, 17639, 17044, 17606, 16936, 17574, 16837, 17543, 16745, 17513, 16659, 17484, 16580,
+		17456, 16505, 17430, 16436, 17399, 16359, 17350, 16239, 17301, 16127, 17255, 16022, 17210, 15925, 17166, 15833,
+		17124, 15748, 17084, 15668, 17045, 15593, 17007, 15523, 16970, 15457, 16934, 15395, 16900, 15314, 16866, 15204,
+		16834, 15101, 16802, 15004, 16771, 14913, 16742, 14827, 16713, 14746, 16685, 14669, 16658, 14597, 16631, 14529,
+		16606, 14466, 16581, 14406, 16557, 14349, 16533, 14254, 16510, 14152, 16488, 14055, 16466, 13964, 16445, 13877,
+		16425, 13796, 16404, 13718, 16385, 13645, 16348, 13576, 16311, 13510, 16275, 13449, 16240, 13390, 16206, 13334,
+		16172, 13250, 16140, 13150, 16108, 13055, 16077, 12964, 16046, 12878, 16017, 12797, 15988, 12720, 15960, 12647,
+		15932, 12577, 15905, 12511, 15879, 12448, 15853, 12388, 15828, 12332, 15804, 12267, 15780, 12165, 15756, 12067,
+		15733, 11975, 15711, 11887, 15689, 11803, 15668, 11725, 15647, 11649, 15626, 11578, 15606, 11510, 15586, 11445,
+		15567, 11384, 15548, 11326, 15530, 11270, 15512, 11172, 15494, 11071, 15477, 10975, 15460, 10884, 15443, 10798,
+		15427, 10715, 15411, 10637, 15395, 10563, 15380, 10494, 15365, 10427, 15341, 10364, 15312, 10304, 15284, 10246,
+		15256, 10142, 15229, 10038, 15202, 9939, 15176, 9845, 15150, 9755, 15125, 9671, 15100, 9590, 15076, 9514,
+		15052, 9441, 15029, 9373, 15006, 9307, 14983, 9245, 14961, 9157, 14939, 9046, 14918, 8940, 14897, 8840,
+		14877, 8744, 14857, 8654, 14837, 8569, 14817, 8488, 14799, 8415, 14780, 8342, 14761, 8273, 14743, 8207,
+		14726, 8099, 14708, 7982, 14691, 7871, 14674, 7767, 14657, 7668, 14641, 7574, 14625, 7486, 14609, 7402,
+		14594, 7323, 14578, 7249, 14564, 7179, 14549, 7057, 14534, 6932, 14520, 6815, 14506, 6713, 14493, 6607,
+		14479, 6508, 14466, 6415, 14453, 6327, 14440, 6245, 14427, 6167, 14415, 6045, 14402, 5908, 14390, 5780,
+		14378, 5660, 14367, 5560, 14355, 5453, 14344, 5353, 14329, 5260, 14307, 5172, 14286, 5061, 14264, 4909,
+		14243, 4766, 14223, 4654, 14203, 4528, 14183, 4411, 14163, 4303, 14143, 4202, 14124, 4108, 14105, 3946,
+		14087, 3785, 14068, 3635, 14050, 3497, 14033, 3369, 14015, 3251, 13998, 3143, 13981, 3012, 13964, 2828,
+		13948, 2658, 13931, 2501, 13915, 2358, 13899, 2227, 13884, 2107, 13868, 1945, 13853, 1745, 13838, 1562,
+		13824, 1396, 13809, 1245, 13795, 1108, 13781, 984, 13767, 936, 13753, 827, 13740, 729, 13727, 641,
+		13713, 562, 13700, 492, 13687, 429, 13675, 374, 13662, 324, 13650, 281, 13638, 243, 13626, 209,
+		13614, 179, 13602, 153, 13591, 131, 13579, 111, 13568, 95, 13557, 80, 13546, 68, 13535, 57,
+		13525, 48, 13514, 40, 13504, 34, 13494, 29, 13483, 24, 13473, 21, 13464, 17, 13454, 15,
+		13444, 13, 13435, 11, 13425, 10, 13416, 9, 13407, 8, 13398, 7, 13389, 6, 13380, 6,
+		13371, 6, 13363, 5, 13354, 15, 13346, 11, 13337, 8, 13329, 6, 13321, 5, 13313, 4,
+		18716, 24047, 18935, 23614, 19067, 23175, 19135, 22831, 19162, 22583, 19164, 22267, 19151, 21986, 19127, 21765,
+		19097, 21588, 19061, 21383, 19022, 21144, 18982, 20944, 18940, 20775, 18897, 20631, 18854, 20506, 18811, 20317,
+		18769, 20129, 18727, 19964, 18686, 19819, 18646, 19691, 18607, 19577, 18570, 19476, 18533, 19316, 18498, 19154,
+		18464, 19009, 18430, 18878, 18367, 18761, 18306, 18654, 18248, 18557, 18192, 18470, 18137, 18349, 18085, 18204,
+		18035, 18071, 17987, 17950, 17941, 17839, 17896, 17738, 17853, 17644, 17812, 17559, 17773, 17480, 17735, 17406,
+		17698, 17272, 17663, 17148, 17629, 17033, 17596, 16927, 17565, 16829, 17534, 16737, 17505, 16652, 17477, 16573,
+		17449, 16499, 17423, 16431, 17387, 16351, 17338, 16232, 17291, 16122, 17245, 16018, 17201, 15920, 17158, 15829,
+		17116, 15744, 17076, 15665, 17037, 15590, 16999, 15519, 16963, 15454, 16928, 15392, 16893, 15308, 16860, 15200,
+		16828, 15097, 16797, 15001, 16767, 14910, 16737, 14825, 16709, 14744, 16681, 14668, 16654, 14596, 16628, 14529,
+		16602, 14465, 16578, 14405, 16554, 14347, 16530, 14251, 16507, 14148, 16485, 14053, 16464, 13961, 16443, 13876,
+		16422, 13794, 16402, 13717, 16382, 13645, 16344, 13576, 16307, 13510, 16271, 13448, 16236, 13389, 16202, 13333,
+		16169, 13249, 16136, 13148, 16104, 13052, 16074, 12963, 16043, 12877, 16014, 12795, 15985, 12719, 15957, 12646,
+		15930, 12577, 15903, 12510, 15877, 12448, 15851, 12388, 15826, 12332, 15802, 12268, 15778, 12165, 15755, 12069,
+		15732, 11978, 15709, 11889, 15688, 11806, 15666, 11726, 15645, 11651, 15625, 11580, 15605, 11511, 15585, 11446,
+		15566, 11385, 15547, 11326, 15529, 11270, 15511, 11171, 15493, 11070, 15476, 10974, 15459, 10883, 15442, 10797,
+		15426, 10715, 15410, 10637, 15394, 10564, 15379, 10495, 15364, 10427, 15339, 10365, 15311, 10304, 15282, 10246,
+		15255, 10143, 15227, 10039, 15201, 9940, 15174, 9846, 15149, 9756, 15124, 9672, 15099, 9591, 15075, 9517,
+		15051, 9444, 15028, 9375, 15005, 9312, 14983, 9249, 14961, 9164, 14939, 9052, 14918, 8946, 14897, 8845,
+		14876, 8749, 14856, 8659, 14836, 8573, 14817, 8492, 14798, 8415, 14779, 8342, 14761, 8273, 14743, 8207,
+		14725, 8099, 14707, 7982, 14690, 7871, 14673, 7767, 14657, 7668, 14640, 7574, 14624, 7486, 14609, 7402,
+		14593, 7329, 14578, 7254, 14563, 7183, 14549, 7065, 14534, 6939, 14520, 6821, 14506, 6709, 14492, 6604,
+		14479, 6505, 14465, 6412, 14452, 6325, 14439, 6242, 14426, 6165, 14414, 6041, 14402, 5904, 14390, 5776,
+		14378, 5656, 14366, 5544, 14355, 5439, 14343, 5353, 14329, 5259, 14307, 5171, 14285, 5059, 14264, 4907,
+		14243, 4764, 14222, 4631, 14202, 4508, 14182, 4393, 14162, 4285, 14142, 4186, 14124, 4112, 14105, 3953,
+		14086, 3790, 14068, 3639, 14050, 3499, 14032, 3370, 14015, 3251, 13997, 3141, 13980, 3009, 13963, 2823,
+		13947, 2652, 13931, 2543, 13915, 2394, 13899, 2257, 13884, 2132, 13868, 1989, 13853, 1781, 13838, 1592,
+		13823, 1420, 13809, 1264, 13795, 1123, 13781, 996, 13767, 880, 13753, 777, 13739, 683, 13726, 600,
+		13713, 525, 13700, 458, 13687, 398, 13674, 345, 13662, 298, 13649, 257, 13637, 220, 13625, 188,
+		13614, 160, 13602, 135, 13590, 114, 13579, 129, 13568, 108, 13557, 90, 13546, 75, 13535, 62,
+		13525, 51, 13514, 42, 13504, 34, 13494, 28, 13483, 22, 13473, 18, 13463, 14, 13454, 11,
+		13444, 9, 13434, 7, 13425, 6, 13416, 4, 13407, 3, 13398, 3, 13389, 2, 13380, 2,
+		13371, 1, 13362, 1, 13354, 1, 13345, 1, 13337, 0, 13329, 0, 13321, 5, 13313, 1,
+		18627, 23891, 18827, 23477, 18954, 23040, 19026, 22738, 19059, 22503, 19068, 22168, 19061, 21908, 19043, 21703,
+		19019, 21538, 18989, 21301, 18955, 21077, 18920, 20888, 18882, 20728, 18844, 20591, 18805, 20466, 18766, 20261,
+		18727, 20081, 18689, 19923, 18651, 19784, 18614, 19661, 18578, 19552, 18543, 19453, 18508, 19278, 18475, 19122,
+		18443, 18980, 18392, 18854, 18331, 18739, 18273, 18635, 18217, 18541, 18163, 18456, 18111, 18323, 18061, 18182,
+		18013, 18053, 17967, 17933, 17922, 17825, 17879, 17725, 17837, 17633, 17797, 17549, 17759, 17471, 17722, 17391,
+		17686, 17258, 17652, 17136, 17618, 17023, 17586, 16917, 17556, 16820, 17526, 16729, 17497, 16645, 17469, 16567,
+		17442, 16494, 17417, 16426, 17375, 16342, 17327, 16224, 17280, 16114, 17235, 16011, 17191, 15915, 17149, 15824,
+		17108, 15740, 17068, 15661, 17030, 15587, 16993, 15517, 16957, 15452, 16922, 15390, 16888, 15305, 16855, 15196,
+		16823, 15094, 16792, 14997, 16762, 14906, 16733, 14822, 16704, 14742, 16677, 14666, 16650, 14595, 16624, 14527,
+		16599, 14463, 16574, 14403, 16550, 14347, 16527, 14250, 16505, 14149, 16483, 14052, 16461, 13962, 16440, 13876,
+		16420, 13795, 16400, 13717, 16378, 13644, 16340, 13575, 16303, 13509, 16267, 13447, 16233, 13388, 16199, 13333,
+		16166, 13248, 16133, 13148, 16102, 13055, 16071, 12965, 16041, 12879, 16012, 12797, 15983, 12720, 15955, 12646,
+		15927, 12576, 15901, 12510, 15874, 12447, 15849, 12387, 15824, 12331, 15800, 12267, 15776, 12165, 15753, 12070,
+		15730, 11977, 15708, 11889, 15686, 11807, 15665, 11728, 15644, 11652, 15624, 11581, 15604, 11513, 15584, 11448,
+		15565, 11387, 15546, 11328, 15528, 11273, 15510, 11176, 15492, 11075, 15475, 10979, 15458, 10888, 15442, 10803,
+		15425, 10720, 15409, 10642, 15394, 10567, 15379, 10496, 15364, 10429, 15338, 10365, 15309, 10304, 15281, 10246,
+		15253, 10143, 15226, 10039, 15199, 9940, 15173, 9846, 15148, 9757, 15122, 9672, 15098, 9594, 15074, 9517,
+		15050, 9447, 15027, 9378, 15004, 9312, 14982, 9250, 14960, 9168, 14938, 9056, 14917, 8949, 14896, 8848,
+		14876, 8753, 14856, 8662, 14836, 8579, 14817, 8498, 14798, 8420, 14779, 8347, 14761, 8281, 14743, 8215,
+		14725, 8112, 14707, 7994, 14690, 7883, 14673, 7777, 14657, 7677, 14640, 7583, 14624, 7494, 14609, 7410,
+		14593, 7331, 14578, 7256, 14563, 7185, 14548, 7069, 14534, 6943, 14520, 6824, 14506, 6713, 14492, 6607,
+		14478, 6508, 14465, 6415, 14452, 6328, 14439, 6245, 14426, 6168, 14414, 6060, 14402, 5922, 14390, 5793,
+		14378, 5671, 14366, 5557, 14355, 5451, 14343, 5351, 14328, 5258, 14306, 5171, 14285, 5059, 14263, 4906,
+		14242, 4764, 14222, 4632, 14201, 4508, 14181, 4394, 14162, 4287, 14142, 4187, 14123, 4093, 14104, 3922,
+		14086, 3797, 14068, 3645, 14050, 3505, 14032, 3376, 14015, 3257, 13997, 3147, 13980, 3018, 13963, 2831,
+		13947, 2660, 13931, 2502, 13915, 2358, 13899, 2274, 13884, 2147, 13868, 2014, 13853, 1803, 13838, 1611,
+		13823, 1436, 13809, 1278, 13795, 1135, 13781, 1006, 13767, 889, 13753, 784, 13739, 690, 13726, 605,
+		13713, 530, 13700, 510, 13687, 444, 13675, 385, 13662, 333, 13650, 287, 13638, 246, 13626, 211,
+		13614, 180, 13602, 153, 13591, 129, 13579, 109, 13568, 91, 13557, 76, 13546, 63, 13535, 52,
+		13525, 43, 13514, 35, 13504, 28, 13494, 23, 13483, 18, 13473, 14, 13463, 11, 13454, 27,
+		13444, 22, 13435, 18, 13425, 14, 13416, 11, 13407, 9, 13398, 7, 13389, 5, 13380, 4,
+		13371, 3, 13363, 2, 13354, 2, 13345, 1, 13337, 1, 13329, 1, 13321, 0, 13313, 4,
+		18550, 23757, 18730, 23299, 18853, 22919, 18925, 22651, 18964, 22377, 18978, 22072, 18977, 21834, 18964, 21644,
+		18945, 21477, 18920, 21224, 18892, 21013, 18860, 20835, 18827, 20683, 18793, 20554, 18758, 20402, 18722, 20206,
+		18687, 20034, 18652, 19884, 18617, 19750, 18582, 19632, 18549, 19527, 18516, 19409, 18484, 19240, 18452, 19089,
+		18412, 18952, 18353, 18830, 18296, 18718, 18241, 18617, 18187, 18525, 18135, 18442, 18085, 18299, 18037, 18161,
+		17991, 18033, 17946, 17916, 17903, 17810, 17861, 17712, 17821, 17622, 17782, 17539, 17745, 17462, 17708, 17375,
+		17674, 17244, 17640, 17123, 17608, 17012, 17576, 16908, 17546, 16811, 17517, 16722, 17489, 16639, 17461, 16561,
+		17435, 16489, 17410, 16422, 17362, 16334, 17315, 16216, 17269, 16107, 17224, 16005, 17181, 15909, 17139, 15820,
+		17099, 15735, 17060, 15657, 17022, 15583, 16985, 15514, 16950, 15449, 16915, 15388, 16881, 15301, 16849, 15194,
+		16818, 15092, 16787, 14996, 16757, 14905, 16728, 14820, 16700, 14740, 16673, 14664, 16646, 14593, 16620, 14525,
+		16595, 14461, 16571, 14402, 16547, 14346, 16524, 14248, 16502, 14147, 16480, 14051, 16458, 13961, 16438, 13875,
+		16418, 13794, 16398, 13716, 16374, 13645, 16336, 13576, 16300, 13510, 16264, 13448, 16229, 13389, 16196, 13334,
+		16163, 13250, 16130, 13149, 16099, 13054, 16068, 12963, 16038, 12878, 16009, 12797, 15980, 12719, 15952, 12646,
+		15925, 12577, 15899, 12512, 15873, 12449, 15847, 12390, 15823, 12334, 15798, 12271, 15774, 12168, 15751, 12071,
+		15728, 11978, 15706, 11890, 15684, 11806, 15663, 11727, 15642, 11651, 15622, 11580, 15602, 11511, 15582, 11447,
+		15564, 11388, 15545, 11329, 15527, 11274, 15509, 11177, 15491, 11077, 15474, 10983, 15457, 10891, 15441, 10804,
+		15425, 10723, 15409, 10644, 15393, 10571, 15378, 10500, 15363, 10434, 15337, 10370, 15308, 10308, 15280, 10250,
+		15252, 10151, 15226, 10048, 15199, 9949, 15173, 9854, 15147, 9764, 15122, 9679, 15097, 9598, 15073, 9521,
+		15050, 9448, 15026, 9379, 15003, 9313, 14981, 9251, 14959, 9168, 14937, 9056, 14916, 8949, 14895, 8848,
+		14875, 8753, 14855, 8662, 14835, 8579, 14816, 8501, 14797, 8423, 14778, 8350, 14760, 8280, 14742, 8215,
+		14724, 8112, 14707, 7994, 14689, 7883, 14673, 7777, 14656, 7678, 14640, 7584, 14624, 7499, 14609, 7419,
+		14593, 7339, 14578, 7263, 14563, 7192, 14548, 7089, 14534, 6962, 14520, 6842, 14506, 6729, 14492, 6622,
+		14479, 6522, 14465, 6428, 14452, 6339, 14439, 6256, 14426, 6178, 14414, 6065, 14402, 5927, 14390, 5797,
+		14378, 5676, 14366, 5562, 14355, 5455, 14343, 5355, 14328, 5262, 14306, 5175, 14284, 5066, 14263, 4914,
+		14242, 4771, 14222, 4658, 14202, 4532, 14182, 4415, 14162, 4306, 14143, 4205, 14123, 4111, 14104, 3951,
+		14086, 3789, 14068, 3639, 14050, 3500, 14032, 3372, 14014, 3254, 13997, 3144, 13980, 3015, 13963, 2830,
+		13947, 2659, 13931, 2502, 13915, 2358, 13899, 2226, 13884, 2151, 13868, 2022, 13853, 1811, 13838, 1619,
+		13824, 1444, 13809, 1285, 13795, 1142, 13781, 1012, 13767, 895, 13753, 790, 13739, 695, 13726, 670,
+		13713, 586, 13700, 511, 13687, 444, 13675, 385, 13662, 332, 13650, 286, 13638, 246, 13626, 210,
+		13614, 179, 13602, 152, 13591, 128, 13579, 108, 13568, 90, 13557, 75, 13546, 89, 13536, 74,
+		13525, 62, 13514, 51, 13504, 42, 13494, 34, 13484, 28, 13473, 23, 13464, 18, 13454, 15,
+		13444, 12, 13435, 9, 13425, 7, 13416, 6, 13407, 5, 13398, 4, 13389, 3, 13380, 2,
+		13371, 2, 13363, 9, 13354, 6, 13346, 4, 13337, 3, 13329, 2, 13321, 1, 13313, 2,
+		18482, 23641, 18644, 23140, 18760, 22807, 18833, 22571, 18875, 22258, 18894, 21982, 18898, 21764, 18891, 21589,
+		18876, 21387, 18856, 21150, 18831, 20952, 18804, 20784, 18775, 20641, 18744, 20517, 18713, 20340, 18680, 20153,
+		18648, 19989, 18616, 19845, 18583, 19717, 18551, 19603, 18520, 19502, 18489, 19366, 18459, 19203, 18427, 19056,
+		18370, 18924, 18315, 18805, 18260, 18696, 18207, 18598, 18156, 18509, 18107, 18423, 18059, 18274, 18013, 18138,
+		17968, 18014, 17925, 17899, 17883, 17795, 17843, 17699, 17804, 17610, 17766, 17529, 17730, 17453, 17695, 17359,
+		17661, 17230, 17628, 17110, 17596, 17000, 17566, 16897, 17536, 16802, 17508, 16713, 17480, 16632, 17454, 16555,
+		17428, 16483, 17398, 16417, 17349, 16326, 17303, 16209, 17257, 16100, 17213, 15999, 17171, 15904, 17130, 15815,
+		17090, 15731, 17051, 15653, 17014, 15580, 16978, 15511, 16942, 15446, 16908, 15385, 16875, 15297, 16843, 15188,
+		16812, 15088, 16781, 14993, 16752, 14903, 16723, 14818, 16696, 14739, 16669, 14664, 16642, 14593, 16617, 14525,
+		16592, 14462, 16568, 14402, 16544, 14345, 16521, 14248, 16499, 14146, 16477, 14050, 16456, 13959, 16435, 13873,
+		16415, 13792, 16395, 13716, 16369, 13644, 16332, 13575, 16295, 13510, 16260, 13448, 16226, 13389, 16192, 13334,
+		16159, 13250, 16127, 13151, 16096, 13056, 16065, 12966, 16036, 12880, 16006, 12799, 15978, 12722, 15950, 12648,
+		15923, 12579, 15897, 12513, 15871, 12450, 15845, 12390, 15820, 12334, 15796, 12271, 15772, 12168, 15749, 12072,
+		15727, 11980, 15705, 11892, 15683, 11809, 15662, 11731, 15641, 11656, 15621, 11585, 15601, 11516, 15582, 11451,
+		15563, 11389, 15544, 11330, 15526, 11274, 15508, 11178, 15490, 11077, 15473, 10981, 15456, 10890, 15440, 10803,
+		15423, 10721, 15408, 10644, 15392, 10570, 15377, 10499, 15362, 10433, 15335, 10369, 15307, 10310, 15279, 10252,
+		15251, 10154, 15224, 10051, 15198, 9954, 15172, 9859, 15147, 9771, 15122, 9685, 15097, 9606, 15073, 9528,
+		15049, 9455, 15026, 9385, 15003, 9319, 14981, 9258, 14959, 9181, 14937, 9068, 14916, 8961, 14895, 8859,
+		14875, 8763, 14855, 8672, 14835, 8585, 14816, 8503, 14796, 8425, 14778, 8352, 14759, 8282, 14741, 8216,
+		14724, 8116, 14706, 7998, 14689, 7886, 14672, 7781, 14656, 7681, 14640, 7587, 14624, 7507, 14608, 7422,
+		14593, 7342, 14578, 7266, 14563, 7195, 14548, 7086, 14533, 6959, 14519, 6840, 14505, 6727, 14492, 6621,
+		14478, 6521, 14465, 6434, 14452, 6345, 14439, 6261, 14426, 6182, 14414, 6073, 14402, 5934, 14390, 5816,
+		14378, 5693, 14366, 5578, 14355, 5470, 14343, 5368, 14328, 5274, 14307, 5193, 14285, 5099, 14264, 4944,
+		14243, 4799, 14222, 4664, 14202, 4538, 14182, 4421, 14162, 4312, 14143, 4211, 14123, 4117, 14105, 3963,
+		14086, 3800, 14068, 3650, 14050, 3511, 14032, 3382, 14015, 3291, 13998, 3178, 13981, 3074, 13964, 2884,
+		13947, 2708, 13931, 2546, 13915, 2398, 13899, 2262, 13884, 2138, 13868, 2000, 13853, 1793, 13838, 1604,
+		13824, 1432, 13809, 1276, 13795, 1135, 13781, 1007, 13767, 891, 13753, 787, 13739, 693, 13726, 609,
+		13713, 587, 13700, 512, 13687, 446, 13675, 387, 13662, 334, 13650, 288, 13638, 247, 13626, 212,
+		13614, 181, 13602, 153, 13591, 165, 13580, 139, 13568, 117, 13558, 98, 13546, 81, 13536, 67,
+		13525, 56, 13514, 46, 13504, 37, 13494, 30, 13484, 25, 13474, 20, 13464, 16, 13454, 13,
+		13444, 10, 13435, 22, 13426, 18, 13416, 14, 13407, 11, 13398, 9, 13389, 7, 13380, 5,
+		13372, 4, 13363, 3, 13354, 3, 13346, 2, 13338, 1, 13329, 1, 13322, 5, 13313, 1,
+		18408, 23522, 18567, 22999, 18676, 22705, 18749, 22465, 18793, 22147, 18816, 21897, 18824, 21697, 18821, 21535,
+		18811, 21301, 18794, 21080, 18774, 20893, 18750, 20734, 18724, 20599, 18697, 20482, 18669, 20280, 18640, 20102,
+		18610, 19945, 18580, 19807, 18551, 19684, 18521, 19575, 18492, 19478, 18463, 19323, 18435, 19166, 18383, 19024,
+		18329, 18896, 18276, 18781, 18224, 18675, 18174, 18579, 18126, 18492, 18079, 18394, 18033, 18249, 17988, 18116,
+		17945, 17994, 17904, 17882, 17863, 17780, 17825, 17685, 17787, 17598, 17750, 17518, 17715, 17444, 17681, 17342,
+		17648, 17215, 17616, 17098, 17585, 16989, 17555, 16887, 17526, 16793, 17499, 16706, 17471, 16624, 17445, 16548,
+		17420, 16478, 17383, 16411, 17336, 16316, 17290, 16201, 17245, 16093, 17202, 15993, 17160, 15898, 17120, 15810,
+		17081, 15727, 17043, 15650, 17006, 15576, 16970, 15508, 16935, 15444, 16901, 15383, 16868, 15293, 16837, 15186,
+		16806, 15084, 16776, 14990, 16747, 14900, 16718, 14816, 16691, 14736, 16664, 14661, 16638, 14590, 16612, 14524,
+		16588, 14460, 16564, 14401, 16541, 14345, 16518, 14248, 16496, 14147, 16474, 14051, 16453, 13960, 16433, 13875,
+		16413, 13794, 16393, 13717, 16364, 13644, 16327, 13575, 16291, 13509, 16256, 13447, 16221, 13389, 16188, 13334,
+		16156, 13250, 16124, 13150, 16093, 13056, 16062, 12966, 16033, 12880, 16004, 12800, 15975, 12722, 15948, 12649,
+		15921, 12580, 15894, 12514, 15869, 12452, 15843, 12392, 15819, 12335, 15795, 12276, 15771, 12174, 15748, 12076,
+		15725, 11984, 15703, 11896, 15682, 11812, 15660, 11732, 15640, 11656, 15620, 11585, 15600, 11516, 15580, 11451,
+		15561, 11390, 15543, 11332, 15524, 11276, 15507, 11183, 15489, 11083, 15472, 10988, 15456, 10898, 15439, 10811,
+		15423, 10728, 15407, 10649, 15392, 10574, 15376, 10503, 15362, 10435, 15334, 10371, 15305, 10310, 15277, 10252,
+		15249, 10154, 15222, 10049, 15196, 9952, 15170, 9857, 15145, 9769, 15120, 9684, 15095, 9603, 15071, 9527,
+		15048, 9456, 15025, 9386, 15002, 9320, 14980, 9257, 14958, 9180, 14936, 9070, 14916, 8972, 14895, 8869,
+		14875, 8775, 14855, 8683, 14835, 8596, 14816, 8513, 14797, 8435, 14778, 8363, 14760, 8293, 14742, 8226,
+		14724, 8134, 14706, 8015, 14689, 7902, 14672, 7795, 14656, 7695, 14640, 7599, 14624, 7509, 14608, 7424,
+		14593, 7344, 14577, 7268, 14562, 7197, 14548, 7091, 14533, 6964, 14519, 6844, 14505, 6731, 14491, 6625,
+		14478, 6525, 14465, 6445, 14452, 6355, 14439, 6270, 14426, 6191, 14414, 6089, 14402, 5949, 14390, 5818,
+		14378, 5695, 14366, 5580, 14354, 5472, 14343, 5371, 14328, 5287, 14306, 5197, 14285, 5107, 14263, 4951,
+		14242, 4806, 14222, 4670, 14201, 4544, 14182, 4442, 14162, 4331, 14143, 4228, 14124, 4132, 14105, 3990,
+		14086, 3825, 14068, 3672, 14050, 3531, 14032, 3400, 14015, 3279, 13997, 3168, 13980, 3058, 13964, 2869,
+		13947, 2695, 13931, 2535, 13915, 2388, 13899, 2281, 13884, 2155, 13869, 2034, 13853, 1824, 13839, 1707,
+		13824, 1525, 13810, 1359, 13795, 1209, 13781, 1073, 13767, 950, 13753, 840, 13740, 740, 13727, 651,
+		13713, 571, 13700, 499, 13688, 435, 13675, 379, 13663, 328, 13650, 284, 13638, 244, 13626, 209,
+		13614, 179, 13602, 152, 13591, 164, 13580, 138, 13569, 117, 13558, 98, 13547, 82, 13536, 68,
+		13525, 56, 13515, 46, 13504, 38, 13494, 53, 13484, 43, 13474, 35, 13464, 29, 13455, 23,
+		13445, 19, 13435, 15, 13426, 12, 13417, 9, 13407, 8, 13398, 6, 13389, 5, 13381, 4,
+		13372, 3, 13363, 10, 13355, 7, 13346, 5, 13338, 4, 13330, 4, 13321, 2, 13313, 1,
+		18299, 23345, 18498, 22875, 18600, 22613, 18671, 22327, 18717, 22042, 18743, 21816, 18754, 21634, 18755, 21466,
+		18748, 21218, 18736, 21011, 18719, 20836, 18699, 20687, 18676, 20559, 18652, 20415, 18627, 20222, 18600, 20052,
+		18573, 19902, 18546, 19770, 18519, 19652, 18492, 19547, 18464, 19450, 18438, 19281, 18391, 19130, 18338, 18992,
+		18287, 18868, 18238, 18756, 18189, 18654, 18141, 18561, 18095, 18476, 18050, 18365, 18006, 18224, 17964, 18094,
+		17922, 17975, 17882, 17865, 17843, 17764, 17806, 17672, 17769, 17586, 17734, 17507, 17700, 17434, 17667, 17325,
+		17635, 17200, 17604, 17085, 17574, 16977, 17544, 16876, 17516, 16784, 17489, 16698, 17463, 16617, 17437, 16542,
+		17412, 16472, 17368, 16406, 17322, 16307, 17277, 16193, 17233, 16086, 17190, 15986, 17149, 15893, 17110, 15805,
+		17071, 15723, 17033, 15646, 16997, 15573, 16962, 15506, 16928, 15441, 16894, 15381, 16862, 15289, 16830, 15182,
+		16800, 15081, 16770, 14987, 16741, 14898, 16713, 14814, 16686, 14735, 16659, 14660, 16633, 14589, 16608, 14523,
+		16584, 14459, 16560, 14400, 16537, 14344, 16514, 14245, 16492, 14145, 16471, 14050, 16450, 13959, 16430, 13874,
+		16410, 13794, 16391, 13718, 16360, 13645, 16323, 13576, 16287, 13511, 16252, 13449, 16218, 13391, 16185, 13335,
+		16152, 13253, 16121, 13153, 16089, 13057, 16059, 12967, 16029, 12881, 16001, 12800, 15973, 12723, 15945, 12650,
+		15918, 12581, 15892, 12515, 15866, 12452, 15841, 12393, 15817, 12337, 15793, 12278, 15769, 12175, 15746, 12078,
+		15724, 11986, 15702, 11899, 15680, 11816, 15659, 11736, 15639, 11660, 15618, 11588, 15599, 11521, 15579, 11456,
+		15560, 11394, 15542, 11335, 15524, 11279, 15506, 11187, 15488, 11086, 15471, 10990, 15454, 10899, 15438, 10811,
+		15422, 10730, 15406, 10651, 15391, 10577, 15376, 10507, 15361, 10439, 15333, 10376, 15305, 10316, 15276, 10257,
+		15249, 10164, 15222, 10060, 15196, 9960, 15170, 9865, 15144, 9775, 15119, 9689, 15095, 9607, 15071, 9530,
+		15047, 9457, 15024, 9387, 15001, 9321, 14979, 9258, 14957, 9185, 14936, 9075, 14914, 8968, 14894, 8866,
+		14873, 8769, 14853, 8680, 14834, 8593, 14814, 8511, 14796, 8435, 14777, 8361, 14759, 8291, 14741, 8224,
+		14723, 8141, 14706, 8021, 14689, 7908, 14672, 7809, 14656, 7707, 14640, 7611, 14624, 7520, 14608, 7438,
+		14593, 7361, 14578, 7284, 14563, 7211, 14548, 7117, 14534, 6988, 14519, 6867, 14505, 6752, 14492, 6644,
+		14478, 6543, 14465, 6447, 14452, 6358, 14439, 6273, 14426, 6194, 14414, 6095, 14402, 5955, 14389, 5824,
+		14378, 5701, 14366, 5585, 14354, 5477, 14343, 5376, 14328, 5291, 14307, 5210, 14285, 5126, 14264, 4974,
+		14243, 4827, 14222, 4690, 14202, 4562, 14182, 4443, 14162, 4332, 14143, 4229, 14124, 4149, 14105, 4021,
+		14086, 3853, 14068, 3698, 14050, 3554, 14032, 3422, 14015, 3299, 13998, 3186, 13981, 3082, 13964, 2941,
+		13948, 2760, 13931, 2593, 13915, 2441, 13900, 2301, 13884, 2173, 13869, 2057, 13854, 1852, 13839, 1658,
+		13824, 1481, 13809, 1320, 13795, 1175, 13781, 1043, 13767, 924, 13753, 816, 13740, 720, 13727, 633,
+		13713, 555, 13701, 534, 13688, 465, 13675, 404, 13663, 350, 13650, 302, 13638, 260, 13626, 223,
+		13614, 190, 13603, 183, 13592, 156, 13580, 133, 13569, 113, 13558, 95, 13547, 80, 13536, 67,
+		13525, 56, 13515, 47, 13505, 64, 13495, 53, 13484, 44, 13474, 36, 13465, 29, 13455, 24,
+		13445, 19, 13435, 16, 13426, 28, 13417, 22, 13408, 18, 13399, 14, 13390, 11, 13381, 9,
+		13372, 7, 13364, 6, 13355, 4, 13346, 3, 13338, 2, 13330, 2, 13322, 5, 13314, 4,
+		18200, 23185, 18436, 22763, 18531, 22529, 18600, 22200, 18646, 21945, 18674, 21740, 18689, 21574, 18693, 21368,
+		18690, 21139, 18680, 20945, 18666, 20781, 18649, 20641, 18630, 20520, 18609, 20349, 18586, 20165, 18562, 20003,
+		18538, 19860, 18513, 19734, 18488, 19621, 18463, 19520, 18437, 19403, 18393, 19240, 18343, 19094, 18295, 18961,
+		18247, 18841, 18199, 18732, 18153, 18633, 18108, 18542, 18064, 18460, 18021, 18336, 17980, 18198, 17939, 18071,
+		17899, 17955, 17861, 17848, 17823, 17749, 17787, 17658, 17752, 17574, 17718, 17496, 17685, 17425, 17652, 17309,
+		17621, 17185, 17591, 17071, 17562, 16965, 17533, 16866, 17506, 16775, 17479, 16689, 17453, 16609, 17428, 16535,
+		17400, 16466, 17354, 16402, 17308, 16299, 17263, 16185, 17220, 16079, 17179, 15980, 17138, 15887, 17099, 15800,
+		17061, 15718, 17024, 15641, 16988, 15569, 16953, 15502, 16919, 15438, 16886, 15378, 16855, 15285, 16824, 15178,
+		16794, 15079, 16764, 14985, 16735, 14895, 16708, 14812, 16681, 14733, 16654, 14659, 16629, 14588, 16604, 14521,
+		16580, 14459, 16556, 14400, 16533, 14344, 16511, 14244, 16489, 14144, 16468, 14050, 16447, 13959, 16427, 13874,
+		16407, 13793, 16388, 13717, 16355, 13645, 16318, 13576, 16283, 13511, 16248, 13449, 16214, 13390, 16181, 13337,
+		16149, 13255, 16117, 13155, 16086, 13060, 16056, 12970, 16027, 12885, 15998, 12803, 15970, 12726, 15943, 12653,
+		15916, 12583, 15889, 12517, 15864, 12453, 15839, 12394, 15814, 12337, 15791, 12281, 15767, 12178, 15744, 12080,
+		15722, 11988, 15700, 11901, 15678, 11817, 15657, 11737, 15637, 11664, 15617, 11591, 15597, 11523, 15578, 11458,
+		15559, 11396, 15541, 11338, 15523, 11282, 15505, 11195, 15488, 11093, 15470, 10996, 15454, 10906, 15437, 10819,
+		15422, 10737, 15406, 10657, 15390, 10582, 15375, 10510, 15360, 10442, 15332, 10379, 15303, 10317, 15275, 10259,
+		15248, 10167, 15221, 10064, 15194, 9963, 15168, 9868, 15143, 9781, 15119, 9697, 15094, 9615, 15070, 9539,
+		15047, 9465, 15024, 9395, 15001, 9328, 14979, 9267, 14957, 9197, 14935, 9084, 14914, 8976, 14893, 8873,
+		14873, 8776, 14853, 8684, 14833, 8597, 14814, 8514, 14795, 8436, 14777, 8365, 14758, 8294, 14740, 8230,
+		14723, 8142, 14705, 8022, 14688, 7914, 14672, 7807, 14655, 7705, 14639, 7609, 14623, 7519, 14607, 7433,
+		14592, 7352, 14577, 7280, 14562, 7211, 14548, 7124, 14533, 6995, 14519, 6880, 14505, 6764, 14492, 6655,
+		14478, 6559, 14465, 6462, 14452, 6377, 14439, 6291, 14426, 6210, 14414, 6125, 14402, 5983, 14390, 5849,
+		14378, 5724, 14366, 5607, 14355, 5504, 14343, 5401, 14329, 5304, 14307, 5214, 14285, 5129, 14264, 4981,
+		14243, 4834, 14222, 4697, 14202, 4569, 14182, 4450, 14162, 4339, 14143, 4236, 14124, 4154, 14105, 4031,
+		14087, 3888, 14069, 3731, 14051, 3584, 14033, 3449, 14015, 3324, 13998, 3209, 13981, 3103, 13964, 2938,
+		13948, 2803, 13932, 2633, 13916, 2477, 13900, 2334, 13884, 2203, 13869, 2083, 13854, 1900, 13839, 1701,
+		13824, 1521, 13810, 1418, 13796, 1263, 13782, 1121, 13768, 994, 13754, 879, 13740, 775, 13727, 682,
+		13714, 599, 13701, 524, 13688, 458, 13675, 399, 13663, 346, 13651, 299, 13639, 258, 13626, 222,
+		13615, 190, 13603, 200, 13592, 170, 13580, 144, 13569, 121, 13558, 102, 13547, 85, 13536, 71,
+		13526, 59, 13515, 49, 13505, 40, 13495, 33, 13484, 27, 13474, 22, 13465, 18, 13455, 14,
+		13445, 12, 13436, 9, 13427, 30, 13418, 24, 13409, 20, 13400, 16, 13390, 13, 13381, 10,
+		13373, 17, 13364, 13, 13355, 10, 13347, 7, 13339, 6, 13330, 5, 13322, 2, 13314, 5,
+		18112, 23047, 18328, 22662, 18468, 22378, 18534, 22083, 18580, 21852, 18610, 21668, 18627, 21516, 18634, 21275,
+		18634, 21062, 18628, 20883, 18617, 20729, 18602, 20596, 18586, 20482, 18567, 20285, 18547, 20110, 18526, 19956,
+		18503, 19819, 18481, 19698, 18457, 19590, 18434, 19493, 18390, 19356, 18343, 19199, 18297, 19058, 18251, 18930,
+		18206, 18814, 18162, 18708, 18118, 18612, 18075, 18523, 18034, 18443, 17993, 18307, 17953, 18173, 17914, 18049,
+		17876, 17935, 17839, 17830, 17803, 17733, 17768, 17645, 17734, 17562, 17701, 17486, 17669, 17415, 17638, 17292,
+		17608, 17170, 17578, 17058, 17550, 16953, 17522, 16855, 17495, 16765, 17469, 16681, 17444, 16602, 17420, 16529,
+		17384, 16460, 17338, 16396, 17293, 16288, 17250, 16177, 17208, 16072, 17167, 15974, 17127, 15882, 17088, 15795,
+		17051, 15714, 17014, 15638, 16979, 15566, 16945, 15499, 16911, 15436, 16879, 15376, 16847, 15279, 16817, 15175,
+		16787, 15075, 16758, 14982, 16730, 14893, 16702, 14810, 16675, 14731, 16650, 14657, 16624, 14587, 16600, 14521,
+		16576, 14459, 16552, 14399, 16529, 14343, 16507, 14244, 16486, 14144, 16464, 14049, 16444, 13960, 16424, 13875,
+		16405, 13794, 16385, 13717, 16350, 13645, 16313, 13577, 16278, 13512, 16243, 13450, 16210, 13391, 16177, 13336,
+		16145, 13256, 16114, 13157, 16083, 13061, 16053, 12971, 16024, 12885, 15995, 12806, 15968, 12730, 15940, 12656,
+		15914, 12586, 15887, 12519, 15862, 12457, 15837, 12398, 15813, 12341, 15789, 12286, 15766, 12183, 15743, 12085,
+		15720, 11992, 15698, 11903, 15677, 11819, 15656, 11740, 15635, 11664, 15615, 11594, 15596, 11525, 15577, 11460,
+		15558, 11398, 15539, 11339, 15521, 11283, 15503, 11194, 15486, 11096, 15469, 11000, 15453, 10909, 15437, 10824,
+		15421, 10740, 15405, 10662, 15390, 10588, 15375, 10516, 15360, 10448, 15331, 10383, 15302, 10323, 15274, 10265,
+		15247, 10178, 15220, 10074, 15194, 9973, 15168, 9877, 15143, 9786, 15118, 9700, 15093, 9620, 15069, 9542,
+		15046, 9468, 15023, 9399, 15000, 9332, 14978, 9269, 14956, 9202, 14935, 9094, 14914, 8988, 14893, 8885,
+		14873, 8790, 14853, 8697, 14833, 8609, 14814, 8526, 14795, 8447, 14776, 8372, 14758, 8303, 14740, 8236,
+		14723, 8153, 14705, 8033, 14688, 7919, 14671, 7812, 14655, 7710, 14639, 7614, 14623, 7528, 14607, 7441,
+		14592, 7360, 14577, 7287, 14562, 7215, 14547, 7124, 14533, 7002, 14519, 6879, 14505, 6764, 14491, 6656,
+		14478, 6553, 14464, 6457, 14451, 6367, 14439, 6288, 14426, 6208, 14414, 6120, 14402, 5997, 14390, 5873,
+		14378, 5746, 14366, 5627, 14355, 5516, 14343, 5412, 14329, 5323, 14307, 5231, 14286, 5152, 14264, 5023,
+		14243, 4872, 14223, 4731, 14202, 4600, 14182, 4479, 14163, 4365, 14143, 4260, 14124, 4162, 14105, 4046,
+		14087, 3877, 14068, 3721, 14050, 3576, 14033, 3442, 14015, 3318, 13998, 3204, 13981, 3113, 13965, 3002,
+		13948, 2816, 13932, 2646, 13916, 2490, 13901, 2380, 13885, 2245, 13870, 2122, 13854, 1972, 13840, 1767,
+		13825, 1580, 13810, 1411, 13796, 1316, 13782, 1170, 13768, 1037, 13754, 918, 13741, 811, 13728, 714,
+		13714, 628, 13701, 550, 13689, 481, 13676, 419, 13664, 401, 13651, 348, 13639, 301, 13627, 260,
+		13615, 223, 13604, 192, 13592, 164, 13581, 139, 13570, 118, 13558, 100, 13547, 84, 13537, 71,
+		13526, 59, 13516, 73, 13505, 61, 13495, 50, 13485, 42, 13475, 34, 13465, 28, 13456, 23,
+		13446, 19, 13436, 15, 13427, 12, 13417, 10, 13408, 8, 13399, 7, 13390, 6, 13382, 15,
+		13373, 11, 13364, 9, 13355, 6, 13347, 4, 13339, 8, 13331, 9, 13323, 6, 13314, 3,
+		18031, 22923, 18227, 22573, 18390, 22239, 18474, 21974, 18519, 21767, 18550, 21599, 18569, 21418, 18579, 21186,
+		18581, 20989, 18577, 20822, 18569, 20678, 18558, 20554, 18543, 20411, 18527, 20222, 18509, 20056, 18490, 19910,
+		18470, 19779, 18449, 19663, 18424, 19560, 18382, 19467, 18338, 19310, 18295, 19159, 18252, 19023, 18209, 18898,
+		18166, 18786, 18125, 18684, 18084, 18591, 18043, 18505, 18003, 18422, 17964, 18278, 17926, 18147, 17889, 18026,
+		17852, 17915, 17817, 17812, 17782, 17717, 17749, 17630, 17716, 17549, 17684, 17475, 17653, 17404, 17623, 17275,
+		17594, 17155, 17565, 17045, 17538, 16941, 17511, 16845, 17485, 16756, 17459, 16673, 17435, 16594, 17411, 16522,
+		17367, 16455, 17322, 16391, 17278, 16279, 17236, 16169, 17194, 16064, 17154, 15967, 17115, 15875, 17077, 15790,
+		17040, 15709, 17005, 15634, 16970, 15563, 16936, 15496, 16903, 15433, 16871, 15374, 16840, 15276, 16810, 15171,
+		16780, 15072, 16751, 14979, 16724, 14891, 16696, 14808, 16670, 14730, 16644, 14656, 16619, 14586, 16595, 14520,
+		16571, 14458, 16548, 14398, 16525, 14343, 16504, 14245, 16482, 14144, 16461, 14050, 16441, 13960, 16421, 13875,
+		16402, 13795, 16381, 13718, 16344, 13646, 16308, 13578, 16274, 13513, 16239, 13452, 16206, 13393, 16173, 13337,
+		16141, 13258, 16110, 13158, 16079, 13063, 16050, 12974, 16020, 12887, 15992, 12807, 15964, 12730, 15937, 12658,
+		15911, 12588, 15885, 12522, 15859, 12459, 15834, 12399, 15811, 12344, 15787, 12290, 15764, 12188, 15741, 12091,
+		15719, 11997, 15697, 11909, 15676, 11826, 15655, 11746, 15634, 11671, 15614, 11599, 15595, 11529, 15575, 11464,
+		15557, 11401, 15538, 11342, 15520, 11285, 15502, 11200, 15485, 11101, 15468, 11005, 15452, 10912, 15436, 10826,
+		15419, 10742, 15404, 10664, 15389, 10588, 15373, 10516, 15358, 10450, 15329, 10386, 15300, 10324, 15273, 10267,
+		15246, 10183, 15219, 10080, 15193, 9981, 15167, 9884, 15142, 9793, 15117, 9706, 15093, 9625, 15069, 9549,
+		15045, 9476, 15022, 9405, 15000, 9341, 14978, 9277, 14956, 9216, 14934, 9101, 14913, 8995, 14893, 8892,
+		14872, 8794, 14852, 8701, 14833, 8615, 14814, 8532, 14795, 8452, 14776, 8377, 14758, 8309, 14740, 8246,
+		14723, 8171, 14705, 8054, 14688, 7939, 14672, 7830, 14655, 7727, 14639, 7630, 14623, 7538, 14607, 7451,
+		14592, 7369, 14577, 7292, 14562, 7222, 14547, 7139, 14533, 7009, 14519, 6886, 14505, 6771, 14491, 6669,
+		14478, 6566, 14465, 6469, 14451, 6378, 14439, 6297, 14426, 6217, 14414, 6146, 14402, 6004, 14390, 5869,
+		14378, 5743, 14366, 5625, 14355, 5514, 14343, 5410, 14328, 5313, 14307, 5230, 14285, 5145, 14264, 5009,
+		14243, 4875, 14223, 4749, 14202, 4617, 14182, 4494, 14163, 4390, 14144, 4297, 14125, 4196, 14106, 4102,
+		14087, 3933, 14069, 3772, 14051, 3623, 14033, 3485, 14016, 3375, 13999, 3255, 13982, 3146, 13965, 3017,
+		13949, 2830, 13932, 2659, 13916, 2502, 13900, 2358, 13885, 2226, 13870, 2105, 13854, 1942, 13839, 1741,
+		13825, 1622, 13811, 1448, 13796, 1290, 13782, 1147, 13768, 1018, 13755, 947, 13741, 837, 13728, 738,
+		13715, 649, 13702, 596, 13690, 568, 13677, 497, 13664, 433, 13652, 377, 13640, 327, 13628, 283,
+		13616, 244, 13604, 210, 13593, 180, 13581, 154, 13570, 131, 13559, 136, 13548, 115, 13538, 98,
+		13527, 83, 13516, 70, 13506, 58, 13496, 49, 13485, 41, 13475, 34, 13465, 29, 13456, 24,
+		13446, 35, 13437, 29, 13427, 24, 13418, 18, 13409, 15, 13400, 12, 13391, 10, 13382, 8,
+		13373, 6, 13364, 5, 13356, 4, 13347, 4, 13339, 8, 13331, 6, 13323, 3, 13315, 4,
+		17957, 22811, 18135, 22457, 18285, 22113, 18405, 21874, 18463, 21687, 18495, 21536, 18515, 21314, 18526, 21100,
+		18531, 20919, 18529, 20763, 18524, 20629, 18514, 20512, 18503, 20341, 18489, 20162, 18473, 20004, 18456, 19864,
+		18438, 19740, 18406, 19629, 18367, 19530, 18327, 19425, 18288, 19265, 18247, 19119, 18207, 18987, 18167, 18868,
+		18127, 18759, 18088, 18660, 18049, 18569, 18010, 18486, 17973, 18389, 17936, 18250, 17900, 18122, 17864, 18003,
+		17829, 17895, 17795, 17794, 17762, 17702, 17730, 17616, 17698, 17537, 17667, 17464, 17637, 17383, 17608, 17257,
+		17580, 17139, 17552, 17031, 17525, 16929, 17499, 16834, 17474, 16746, 17449, 16664, 17425, 16587, 17396, 16516,
+		17350, 16449, 17306, 16386, 17263, 16270, 17221, 16160, 17181, 16057, 17141, 15960, 17103, 15869, 17066, 15785,
+		17030, 15704, 16995, 15630, 16960, 15559, 16927, 15493, 16895, 15430, 16863, 15372, 16833, 15274, 16802, 15168,
+		16773, 15069, 16745, 14976, 16718, 14889, 16691, 14806, 16664, 14728, 16639, 14654, 16614, 14585, 16590, 14519,
+		16567, 14457, 16544, 14398, 16521, 14342, 16500, 14243, 16478, 14144, 16458, 14050, 16437, 13960, 16418, 13876,
+		16398, 13794, 16376, 13719, 16339, 13646, 16303, 13579, 16269, 13514, 16235, 13453, 16201, 13394, 16169, 13338,
+		16137, 13260, 16106, 13160, 16076, 13067, 16046, 12977, 16018, 12892, 15989, 12810, 15962, 12733, 15935, 12660,
+		15908, 12590, 15882, 12524, 15857, 12461, 15832, 12401, 15808, 12344, 15785, 12291, 15762, 12192, 15739, 12094,
+		15717, 12001, 15695, 11913, 15674, 11830, 15653, 11751, 15633, 11675, 15613, 11603, 15594, 11534, 15574, 11468,
+		15556, 11406, 15537, 11348, 15519, 11291, 15502, 11211, 15485, 11110, 15468, 11013, 15451, 10920, 15435, 10832,
+		15419, 10748, 15403, 10668, 15388, 10593, 15373, 10522, 15357, 10456, 15328, 10390, 15299, 10329, 15272, 10270,
+		15244, 10188, 15218, 10084, 15191, 9982, 15165, 9886, 15141, 9798, 15116, 9711, 15092, 9630, 15068, 9553,
+		15044, 9480, 15022, 9411, 14999, 9345, 14977, 9281, 14955, 9221, 14934, 9111, 14913, 9001, 14892, 8900,
+		14872, 8804, 14852, 8710, 14833, 8626, 14813, 8542, 14795, 8462, 14776, 8386, 14758, 8315, 14740, 8249,
+		14722, 8178, 14705, 8056, 14688, 7941, 14671, 7836, 14655, 7733, 14638, 7635, 14623, 7543, 14607, 7460,
+		14592, 7385, 14577, 7306, 14562, 7236, 14548, 7164, 14533, 7032, 14519, 6911, 14505, 6794, 14491, 6684,
+		14478, 6580, 14465, 6482, 14452, 6390, 14439, 6304, 14426, 6223, 14414, 6151, 14402, 6014, 14390, 5879,
+		14378, 5762, 14366, 5642, 14355, 5530, 14343, 5425, 14329, 5336, 14307, 5243, 14286, 5165, 14264, 5047,
+		14243, 4895, 14223, 4753, 14203, 4621, 14182, 4498, 14163, 4383, 14143, 4276, 14125, 4190, 14106, 4097,
+		14087, 3926, 14069, 3766, 14051, 3617, 14034, 3521, 14016, 3391, 13999, 3270, 13982, 3180, 13966, 3075,
+		13949, 2886, 13933, 2739, 13917, 2574, 13901, 2423, 13886, 2285, 13870, 2159, 13855, 2039, 13840, 1828,
+		13826, 1637, 13811, 1506, 13797, 1344, 13783, 1197, 13769, 1064, 13755, 944, 13742, 836, 13728, 738,
+		13715, 698, 13702, 614, 13690, 538, 13677, 470, 13664, 410, 13652, 357, 13640, 342, 13628, 296,
+		13616, 255, 13605, 220, 13594, 220, 13582, 188, 13571, 161, 13560, 137, 13548, 116, 13538, 98,
+		13527, 83, 13516, 70, 13506, 71, 13496, 60, 13486, 51, 13476, 58, 13466, 49, 13456, 41,
+		13447, 34, 13437, 29, 13428, 24, 13418, 20, 13409, 17, 13400, 25, 13391, 20, 13383, 16,
+		13374, 13, 13365, 11, 13356, 8, 13348, 6, 13339, 5, 13331, 5, 13323, 5, 13315, 5,
+		17889, 22712, 18051, 22314, 18190, 21999, 18303, 21782, 18390, 21613, 18442, 21447, 18464, 21215, 18477, 21020,
+		18483, 20851, 18484, 20707, 18480, 20581, 18473, 20464, 18463, 20271, 18452, 20103, 18438, 19953, 18413, 19820,
+		18381, 19702, 18347, 19596, 18311, 19501, 18275, 19374, 18238, 19220, 18201, 19080, 18163, 18954, 18126, 18838,
+		18088, 18732, 18051, 18636, 18015, 18548, 17978, 18468, 17942, 18356, 17907, 18220, 17873, 18096, 17839, 17980,
+		17806, 17875, 17773, 17776, 17741, 17686, 17710, 17602, 17680, 17524, 17650, 17452, 17621, 17363, 17593, 17239,
+		17566, 17124, 17539, 17016, 17513, 16916, 17487, 16823, 17463, 16736, 17439, 16655, 17415, 16579, 17377, 16508,
+		17333, 16442, 17289, 16376, 17248, 16260, 17207, 16152, 17167, 16049, 17128, 15953, 17091, 15863, 17054, 15779,
+		17019, 15700, 16984, 15625, 16951, 15556, 16918, 15490, 16886, 15427, 16855, 15369, 16824, 15267, 16795, 15165,
+		16766, 15067, 16739, 14974, 16712, 14888, 16685, 14805, 16659, 14727, 16634, 14653, 16609, 14584, 16585, 14518,
+		16562, 14456, 16539, 14397, 16517, 14342, 16496, 14243, 16475, 14143, 16454, 14050, 16434, 13961, 16415, 13876,
+		16396, 13796, 16370, 13720, 16334, 13649, 16298, 13580, 16264, 13515, 16230, 13454, 16197, 13396, 16164, 13340,
+		16133, 13264, 16102, 13163, 16072, 13068, 16043, 12978, 16014, 12893, 15985, 12811, 15958, 12734, 15931, 12662,
+		15906, 12594, 15880, 12527, 15855, 12465, 15830, 12404, 15806, 12348, 15783, 12294, 15759, 12196, 15737, 12099,
+		15715, 12005, 15693, 11917, 15672, 11833, 15651, 11753, 15631, 11679, 15612, 11606, 15592, 11537, 15573, 11472,
+		15554, 11409, 15536, 11352, 15519, 11296, 15501, 11220, 15484, 11117, 15467, 11020, 15450, 10928, 15434, 10840,
+		15418, 10758, 15403, 10678, 15388, 10602, 15372, 10530, 15356, 10462, 15327, 10396, 15298, 10334, 15271, 10275,
+		15243, 10198, 15217, 10091, 15190, 9991, 15165, 9898, 15140, 9807, 15115, 9720, 15091, 9638, 15067, 9559,
+		15044, 9484, 15021, 9415, 14998, 9347, 14976, 9283, 14954, 9225, 14933, 9118, 14912, 9008, 14892, 8909,
+		14872, 8812, 14852, 8721, 14832, 8634, 14813, 8549, 14794, 8469, 14776, 8393, 14757, 8321, 14740, 8255,
+		14722, 8192, 14705, 8069, 14688, 7957, 14671, 7855, 14655, 7750, 14639, 7652, 14623, 7559, 14607, 7474,
+		14592, 7391, 14577, 7312, 14562, 7238, 14547, 7172, 14533, 7043, 14519, 6918, 14505, 6801, 14491, 6690,
+		14478, 6597, 14465, 6498, 14452, 6410, 14439, 6327, 14427, 6244, 14414, 6166, 14402, 6042, 14390, 5905,
+		14378, 5776, 14366, 5656, 14355, 5543, 14343, 5437, 14329, 5338, 14307, 5245, 14285, 5159, 14264, 5036,
+		14243, 4898, 14223, 4771, 14203, 4638, 14183, 4513, 14163, 4398, 14144, 4290, 14125, 4202, 14106, 4120,
+		14088, 3967, 14069, 3804, 14051, 3652, 14034, 3512, 14016, 3382, 13999, 3273, 13982, 3162, 13966, 3079,
+		13949, 2894, 13933, 2718, 13917, 2556, 13901, 2407, 13886, 2302, 13871, 2203, 13856, 2083, 13841, 1960,
+		13826, 1755, 13812, 1569, 13798, 1400, 13783, 1247, 13770, 1108, 13756, 983, 13743, 906, 13729, 801,
+		13716, 707, 13703, 622, 13690, 547, 13678, 479, 13665, 419, 13652, 365, 13641, 343, 13629, 298,
+		13617, 292, 13605, 252, 13594, 217, 13582, 187, 13571, 160, 13560, 137, 13549, 140, 13538, 119,
+		13528, 102, 13517, 108, 13507, 91, 13497, 77, 13486, 65, 13476, 55, 13466, 46, 13457, 39,
+		13447, 33, 13437, 27, 13428, 23, 13419, 31, 13410, 25, 13401, 20, 13391, 15, 13382, 12,
+		13374, 14, 13365, 20, 13357, 15, 13348, 11, 13340, 8, 13332, 6, 13323, 5, 13315, 5,
+		17828, 22625, 17974, 22181, 18102, 21895, 18209, 21697, 18292, 21543, 18355, 21332, 18399, 21122, 18428, 20942,
+		18438, 20787, 18440, 20653, 18438, 20535, 18434, 20385, 18419, 20204, 18399, 20045, 18376, 19904, 18349, 19777,
+		18319, 19664, 18289, 19563, 18257, 19472, 18223, 19324, 18189, 19176, 18155, 19042, 18120, 18918, 18085, 18808,
+		18050, 18705, 18015, 18613, 17981, 18528, 17947, 18449, 17913, 18323, 17879, 18191, 17846, 18069, 17814, 17957,
+		17782, 17854, 17751, 17758, 17721, 17670, 17691, 17588, 17661, 17511, 17633, 17441, 17605, 17343, 17578, 17221,
+		17551, 17108, 17525, 17002, 17500, 16903, 17475, 16812, 17451, 16726, 17428, 16646, 17402, 16571, 17358, 16501,
+		17315, 16436, 17273, 16365, 17232, 16250, 17192, 16143, 17153, 16042, 17115, 15946, 17078, 15858, 17043, 15774,
+		17008, 15695, 16973, 15621, 16940, 15552, 16908, 15486, 16877, 15424, 16846, 15367, 16817, 15265, 16788, 15161,
+		16759, 15063, 16731, 14971, 16705, 14884, 16679, 14803, 16653, 14726, 16628, 14652, 16604, 14584, 16581, 14519,
+		16558, 14456, 16535, 14397, 16513, 14342, 16492, 14244, 16471, 14144, 16451, 14050, 16431, 13961, 16411, 13876,
+		16392, 13796, 16364, 13720, 16328, 13649, 16293, 13581, 16259, 13517, 16225, 13455, 16192, 13397, 16160, 13342,
+		16129, 13266, 16098, 13166, 16068, 13072, 16039, 12981, 16011, 12897, 15983, 12815, 15956, 12739, 15929, 12665,
+		15903, 12596, 15877, 12529, 15852, 12466, 15827, 12405, 15803, 12349, 15780, 12294, 15757, 12202, 15735, 12103,
+		15713, 12011, 15692, 11922, 15671, 11839, 15650, 11758, 15630, 11683, 15610, 11609, 15591, 11541, 15572, 11475,
+		15553, 11412, 15535, 11354, 15517, 11298, 15500, 11226, 15483, 11124, 15466, 11026, 15449, 10934, 15433, 10846,
+		15418, 10764, 15402, 10686, 15387, 10610, 15372, 10537, 15354, 10468, 15326, 10402, 15298, 10341, 15270, 10283,
+		15243, 10214, 15216, 10108, 15190, 10005, 15165, 9909, 15139, 9816, 15115, 9728, 15090, 9645, 15066, 9566,
+		15043, 9490, 15020, 9420, 14998, 9354, 14976, 9292, 14954, 9232, 14933, 9131, 14912, 9023, 14891, 8918,
+		14871, 8819, 14851, 8724, 14832, 8637, 14812, 8552, 14794, 8474, 14775, 8400, 14757, 8328, 14739, 8261,
+		14722, 8196, 14705, 8089, 14688, 7976, 14671, 7865, 14655, 7760, 14639, 7661, 14623, 7567, 14607, 7482,
+		14592, 7399, 14577, 7320, 14562, 7245, 14547, 7175, 14533, 7070, 14519, 6944, 14505, 6825, 14492, 6718,
+		14478, 6612, 14465, 6512, 14452, 6418, 14439, 6335, 14427, 6252, 14414, 6174, 14402, 6056, 14390, 5918,
+		14378, 5789, 14367, 5685, 14355, 5570, 14344, 5470, 14330, 5376, 14308, 5281, 14287, 5191, 14265, 5096,
+		14244, 4941, 14224, 4796, 14203, 4660, 14183, 4534, 14164, 4417, 14144, 4308, 14125, 4207, 14106, 4113,
+		14088, 3955, 14070, 3817, 14052, 3664, 14034, 3524, 14017, 3410, 14000, 3289, 13983, 3176, 13967, 3110,
+		13950, 2949, 13934, 2768, 13918, 2601, 13902, 2448, 13886, 2308, 13871, 2180, 13856, 2063, 13841, 1923,
+		13827, 1723, 13812, 1540, 13798, 1374, 13784, 1224, 13769, 1087, 13756, 1008, 13743, 933, 13730, 869,
+		13716, 766, 13703, 673, 13690, 591, 13678, 518, 13665, 452, 13653, 394, 13641, 342, 13629, 297,
+		13617, 257, 13605, 221, 13594, 211, 13582, 182, 13571, 156, 13560, 134, 13549, 125, 13539, 130,
+		13528, 112, 13518, 108, 13507, 92, 13497, 79, 13487, 67, 13477, 72, 13467, 61, 13457, 67,
+		13448, 56, 13438, 46, 13428, 38, 13419, 32, 13410, 26, 13401, 22, 13392, 18, 13383, 14,
+		13374, 19, 13366, 15, 13357, 12, 13349, 9, 13340, 7, 13332, 9, 13324, 7, 13316, 5,
+		17770, 22542, 17904, 22063, 18023, 21800, 18122, 21620, 18202, 21455, 18263, 21225, 18309, 21033, 18339, 20868,
+		18358, 20725, 18366, 20600, 18366, 20491, 18359, 20310, 18347, 20140, 18331, 19990, 18310, 19855, 18287, 19736,
+		18261, 19628, 18233, 19531, 18204, 19432, 18173, 19275, 18142, 19133, 18110, 19003, 18078, 18885, 18045, 18777,
+		18013, 18679, 17980, 18589, 17947, 18507, 17915, 18430, 17883, 18290, 17851, 18162, 17820, 18044, 17789, 17934,
+		17759, 17833, 17729, 17739, 17700, 17653, 17671, 17573, 17643, 17499, 17616, 17430, 17589, 17322, 17563, 17203,
+		17537, 17092, 17512, 16987, 17487, 16891, 17463, 16800, 17440, 16716, 17417, 16637, 17382, 16563, 17339, 16494,
+		17297, 16429, 17256, 16354, 17216, 16240, 17177, 16134, 17139, 16034, 17102, 15940, 17066, 15852, 17030, 15769,
+		16996, 15690, 16963, 15617, 16930, 15549, 16898, 15483, 16868, 15422, 16837, 15364, 16808, 15260, 16780, 15157,
+		16752, 15059, 16725, 14968, 16698, 14883, 16673, 14802, 16647, 14724, 16623, 14651, 16598, 14581, 16575, 14517,
+		16553, 14456, 16531, 14397, 16509, 14342, 16488, 14245, 16467, 14146, 16447, 14051, 16427, 13962, 16408, 13877,
+		16389, 13798, 16358, 13722, 16322, 13651, 16287, 13582, 16253, 13518, 16220, 13456, 16187, 13397, 16156, 13343,
+		16124, 13269, 16094, 13170, 16065, 13076, 16035, 12985, 16007, 12900, 15980, 12820, 15952, 12741, 15926, 12669,
+		15900, 12599, 15874, 12532, 15849, 12469, 15825, 12410, 15802, 12354, 15778, 12299, 15755, 12207, 15733, 12109,
+		15711, 12015, 15689, 11925, 15668, 11841, 15648, 11761, 15628, 11686, 15608, 11614, 15589, 11546, 15570, 11480,
+		15552, 11416, 15534, 11358, 15516, 11302, 15498, 11231, 15481, 11130, 15465, 11032, 15448, 10939, 15432, 10850,
+		15416, 10767, 15401, 10688, 15386, 10614, 15371, 10541, 15353, 10472, 15324, 10408, 15296, 10346, 15269, 10288,
+		15242, 10225, 15216, 10120, 15190, 10017, 15164, 9919, 15139, 9826, 15114, 9739, 15090, 9657, 15067, 9580,
+		15043, 9506, 15020, 9433, 14998, 9366, 14976, 9301, 14954, 9239, 14932, 9144, 14911, 9033, 14891, 8928,
+		14871, 8828, 14851, 8735, 14832, 8650, 14813, 8567, 14794, 8485, 14776, 8412, 14757, 8339, 14739, 8270,
+		14722, 8205, 14704, 8094, 14688, 7980, 14671, 7869, 14655, 7768, 14639, 7672, 14623, 7577, 14607, 7492,
+		14592, 7408, 14577, 7334, 14562, 7265, 14548, 7193, 14533, 7083, 14519, 6956, 14505, 6836, 14492, 6723,
+		14478, 6622, 14465, 6522, 14452, 6427, 14439, 6338, 14427, 6260, 14414, 6181, 14402, 6086, 14390, 5946,
+		14379, 5823, 14367, 5706, 14356, 5590, 14344, 5481, 14330, 5387, 14309, 5291, 14287, 5201, 14266, 5114,
+		14245, 4958, 14224, 4826, 14204, 4701, 14184, 4572, 14165, 4464, 14146, 4363, 14127, 4257, 14108, 4159,
+		14089, 4039, 14071, 3871, 14053, 3714, 14035, 3570, 14018, 3436, 14000, 3313, 13984, 3199, 13967, 3094,
+		13950, 2922, 13934, 2780, 13918, 2613, 13903, 2460, 13887, 2319, 13871, 2191, 13856, 2073, 13842, 2038,
+		13827, 1827, 13813, 1635, 13798, 1461, 13784, 1303, 13770, 1159, 13756, 1030, 13743, 913, 13730, 850,
+		13717, 751, 13703, 657, 13690, 577, 13678, 506, 13665, 442, 13653, 416, 13641, 396, 13630, 371,
+		13618, 322, 13606, 278, 13594, 240, 13583, 207, 13571, 177, 13560, 151, 13549, 129, 13539, 110,
+		13528, 93, 13517, 78, 13507, 66, 13497, 56, 13486, 47, 13477, 66, 13467, 56, 13457, 47,
+		13448, 39, 13438, 32, 13429, 27, 13420, 40, 13411, 44, 13402, 36, 13393, 29, 13384, 23,
+		13375, 18, 13366, 15, 13358, 12, 13349, 10, 13341, 15, 13333, 11, 13325, 9, 13317, 8,
+		17718, 22414, 17839, 21955, 17949, 21713, 18042, 21548, 18118, 21335, 18179, 21126, 18224, 20950, 18256, 20798,
+		18276, 20665, 18287, 20550, 18290, 20416, 18287, 20236, 18278, 20077, 18264, 19935, 18247, 19808, 18226, 19694,
+		18204, 19592, 18178, 19499, 18152, 19378, 18125, 19227, 18096, 19090, 18066, 18965, 18037, 18852, 18006, 18747,
+		17976, 18653, 17945, 18566, 17914, 18486, 17884, 18394, 17854, 18258, 17823, 18132, 17794, 18017, 17765, 17911,
+		17736, 17813, 17707, 17722, 17679, 17637, 17652, 17558, 17624, 17485, 17598, 17418, 17572, 17302, 17547, 17185,
+		17522, 17074, 17498, 16973, 17474, 16877, 17451, 16788, 17428, 16705, 17405, 16627, 17361, 16555, 17320, 16487,
+		17278, 16423, 17238, 16342, 17199, 16229, 17161, 16123, 17124, 16025, 17088, 15932, 17052, 15845, 17018, 15763,
+		16984, 15686, 16952, 15613, 16920, 15545, 16889, 15480, 16858, 15419, 16829, 15362, 16800, 15256, 16772, 15153,
+		16744, 15057, 16717, 14966, 16691, 14880, 16666, 14799, 16641, 14722, 16617, 14649, 16593, 14581, 16570, 14517,
+		16548, 14455, 16526, 14397, 16504, 14341, 16483, 14242, 16463, 14145, 16443, 14052, 16424, 13963, 16405, 13880,
+		16386, 13801, 16352, 13724, 16316, 13652, 16282, 13584, 16248, 13519, 16215, 13459, 16183, 13400, 16151, 13345,
+		16120, 13273, 16090, 13173, 16060, 13078, 16031, 12987, 16003, 12903, 15976, 12823, 15949, 12745, 15923, 12672,
+		15897, 12602, 15871, 12536, 15847, 12474, 15823, 12414, 15799, 12356, 15776, 12303, 15753, 12213, 15731, 12115,
+		15709, 12021, 15688, 11934, 15667, 11851, 15647, 11770, 15627, 11693, 15607, 11620, 15588, 11550, 15569, 11483,
+		15550, 11421, 15532, 11361, 15515, 11305, 15497, 11240, 15480, 11137, 15464, 11040, 15447, 10947, 15431, 10859,
+		15416, 10776, 15400, 10695, 15385, 10618, 15370, 10546, 15351, 10477, 15322, 10411, 15294, 10349, 15267, 10290,
+		15240, 10229, 15214, 10125, 15188, 10023, 15162, 9924, 15138, 9834, 15113, 9746, 15090, 9668, 15066, 9589,
+		15043, 9515, 15020, 9442, 14997, 9373, 14975, 9307, 14953, 9245, 14932, 9158, 14912, 9054, 14891, 8949,
+		14871, 8850, 14851, 8754, 14832, 8665, 14813, 8578, 14794, 8498, 14775, 8420, 14757, 8347, 14739, 8277,
+		14722, 8213, 14704, 8110, 14688, 7999, 14671, 7891, 14655, 7784, 14639, 7687, 14623, 7592, 14607, 7502,
+		14592, 7420, 14577, 7340, 14562, 7264, 14548, 7196, 14533, 7094, 14519, 6972, 14505, 6851, 14492, 6743,
+		14478, 6635, 14465, 6544, 14453, 6453, 14440, 6362, 14427, 6281, 14415, 6201, 14403, 6108, 14391, 5967,
+		14379, 5842, 14367, 5717, 14356, 5600, 14344, 5491, 14330, 5388, 14309, 5300, 14287, 5209, 14266, 5131,
+		14246, 4998, 14225, 4860, 14205, 4720, 14185, 4590, 14166, 4481, 14146, 4367, 14127, 4262, 14108, 4171,
+		14090, 4064, 14072, 3915, 14054, 3776, 14036, 3626, 14019, 3507, 14001, 3377, 13985, 3275, 13968, 3163,
+		13951, 3049, 13935, 2857, 13919, 2684, 13903, 2525, 13887, 2379, 13872, 2245, 13857, 2123, 13842, 1975,
+		13827, 1772, 13813, 1638, 13798, 1464, 13784, 1306, 13770, 1163, 13757, 1034, 13743, 961, 13730, 891,
+		13717, 787, 13704, 724, 13691, 637, 13679, 560, 13666, 490, 13654, 428, 13642, 406, 13630, 353,
+		13618, 307, 13606, 266, 13595, 229, 13583, 198, 13572, 193, 13561, 189, 13550, 162, 13540, 157,
+		13529, 134, 13518, 114, 13508, 97, 13498, 82, 13487, 69, 13477, 59, 13468, 49, 13458, 41,
+		13448, 35, 13439, 29, 13429, 36, 13420, 30, 13411, 25, 13402, 27, 13393, 23, 13384, 19,
+		13376, 30, 13367, 24, 13359, 23, 13350, 18, 13342, 13, 13333, 9, 13325, 10, 13317, 6,
+		17669, 22283, 17780, 21858, 17881, 21634, 17968, 21458, 18041, 21224, 18099, 21033, 18144, 20871, 18176, 20730,
+		18199, 20608, 18212, 20501, 18218, 20333, 18217, 20166, 18211, 20015, 18200, 19881, 18186, 19762, 18168, 19654,
+		18148, 19557, 18126, 19469, 18102, 19322, 18077, 19179, 18051, 19048, 18024, 18928, 17996, 18819, 17968, 18718,
+		17939, 18627, 17911, 18543, 17882, 18465, 17853, 18357, 17824, 18225, 17796, 18104, 17768, 17991, 17740, 17888,
+		17712, 17792, 17685, 17703, 17658, 17620, 17632, 17544, 17606, 17472, 17581, 17404, 17556, 17280, 17532, 17166,
+		17507, 17058, 17484, 16958, 17461, 16864, 17439, 16776, 17417, 16695, 17383, 16618, 17341, 16546, 17300, 16479,
+		17260, 16416, 17221, 16330, 17183, 16219, 17145, 16115, 17109, 16017, 17073, 15924, 17039, 15838, 17005, 15756,
+		16972, 15680, 16940, 15609, 16909, 15541, 16879, 15477, 16849, 15416, 16820, 15359, 16791, 15251, 16763, 15149,
+		16737, 15054, 16710, 14964, 16685, 14879, 16659, 14797, 16635, 14721, 16611, 14649, 16588, 14580, 16565, 14516,
+		16542, 14454, 16521, 14396, 16500, 14342, 16479, 14244, 16459, 14145, 16439, 14052, 16420, 13963, 16401, 13879,
+		16381, 13800, 16345, 13725, 16310, 13654, 16276, 13586, 16243, 13522, 16210, 13461, 16178, 13402, 16146, 13347,
+		16116, 13277, 16086, 13177, 16057, 13083, 16028, 12992, 16000, 12907, 15972, 12825, 15946, 12749, 15919, 12675,
+		15894, 12605, 15868, 12539, 15844, 12477, 15820, 12416, 15797, 12360, 15774, 12306, 15751, 12219, 15729, 12121,
+		15707, 12030, 15686, 11940, 15665, 11856, 15645, 11776, 15625, 11698, 15605, 11625, 15586, 11555, 15567, 11490,
+		15550, 11429, 15531, 11369, 15514, 11312, 15496, 11252, 15479, 11147, 15463, 11047, 15446, 10954, 15430, 10865,
+		15415, 10782, 15399, 10702, 15384, 10626, 15370, 10554, 15350, 10484, 15322, 10420, 15294, 10357, 15266, 10298,
+		15239, 10240, 15213, 10133, 15187, 10031, 15161, 9932, 15136, 9840, 15112, 9751, 15088, 9667, 15064, 9590,
+		15041, 9517, 15018, 9444, 14996, 9376, 14974, 9313, 14953, 9250, 14932, 9177, 14911, 9066, 14891, 8963,
+		14871, 8865, 14851, 8768, 14832, 8676, 14812, 8589, 14794, 8507, 14776, 8435, 14757, 8362, 14740, 8294,
+		14722, 8228, 14705, 8142, 14688, 8022, 14671, 7908, 14655, 7801, 14639, 7700, 14623, 7604, 14607, 7513,
+		14592, 7431, 14577, 7353, 14562, 7280, 14548, 7210, 14534, 7121, 14520, 6991, 14506, 6869, 14492, 6755,
+		14478, 6646, 14465, 6545, 14452, 6449, 14440, 6363, 14427, 6286, 14415, 6213, 14403, 6139, 14391, 5996,
+		14379, 5861, 14368, 5751, 14356, 5632, 14345, 5527, 14332, 5422, 14310, 5330, 14289, 5238, 14268, 5159,
+		14247, 5035, 14226, 4883, 14206, 4742, 14186, 4610, 14165, 4488, 14146, 4385, 14127, 4278, 14108, 4190,
+		14090, 4107, 14072, 3943, 14054, 3782, 14036, 3668, 14019, 3526, 14002, 3396, 13985, 3275, 13968, 3164,
+		13951, 3052, 13935, 2895, 13920, 2749, 13904, 2615, 13889, 2481, 13873, 2339, 13858, 2208, 13843, 2113,
+		13829, 1956, 13814, 1754, 13800, 1571, 13785, 1403, 13771, 1251, 13758, 1114, 13744, 990, 13731, 878,
+		13718, 817, 13705, 722, 13692, 636, 13679, 560, 13667, 491, 13654, 463, 13642, 405, 13631, 380,
+		13619, 331, 13607, 287, 13595, 249, 13584, 234, 13573, 202, 13562, 197, 13551, 170, 13540, 146,
+		13530, 125, 13519, 107, 13509, 109, 13499, 110, 13489, 94, 13478, 80, 13469, 80, 13459, 68,
+		13449, 57, 13440, 48, 13430, 41, 13421, 32, 13411, 25, 13402, 20, 13393, 25, 13384, 20,
+		13376, 16, 13367, 13, 13358, 9, 13350, 17, 13342, 16, 13334, 11, 13326, 10, 13317, 8,
+		17622, 22161, 17725, 21770, 17818, 21561, 17899, 21337, 17969, 21122, 18025, 20945, 18069, 20796, 18102, 20667,
+		18126, 20555, 18141, 20430, 18149, 20254, 18151, 20097, 18147, 19956, 18138, 19829, 18127, 19717, 18112, 19615,
+		18094, 19522, 18075, 19421, 18054, 19270, 18030, 19131, 18007, 19006, 17982, 18890, 17956, 18786, 17930, 18690,
+		17903, 18601, 17877, 18520, 17849, 18445, 17823, 18320, 17795, 18192, 17769, 18075, 17742, 17965, 17715, 17865,
+		17689, 17771, 17663, 17684, 17638, 17604, 17612, 17529, 17588, 17459, 17563, 17381, 17539, 17259, 17516, 17146,
+		17492, 17040, 17470, 16942, 17448, 16850, 17426, 16765, 17402, 16684, 17360, 16608, 17319, 16537, 17280, 16471,
+		17241, 16409, 17203, 16317, 17165, 16207, 17129, 16105, 17094, 16008, 17059, 15917, 17026, 15832, 16993, 15751,
+		16960, 15675, 16929, 15604, 16898, 15536, 16868, 15473, 16839, 15413, 16810, 15353, 16782, 15247, 16755, 15146,
+		16729, 15051, 16703, 14961, 16677, 14876, 16652, 14795, 16628, 14720, 16605, 14648, 16582, 14580, 16559, 14515,
+		16537, 14454, 16516, 14397, 16495, 14342, 16475, 14244, 16454, 14146, 16435, 14053, 16416, 13964, 16397, 13881,
+		16374, 13802, 16338, 13726, 16304, 13655, 16269, 13586, 16236, 13522, 16204, 13461, 16173, 13404, 16141, 13349,
+		16111, 13281, 16081, 13182, 16053, 13088, 16024, 12997, 15996, 12911, 15969, 12830, 15942, 12753, 15916, 12680,
+		15891, 12609, 15866, 12543, 15841, 12480, 15817, 12420, 15794, 12363, 15771, 12308, 15748, 12225, 15726, 12127,
+		15705, 12034, 15684, 11944, 15663, 11861, 15643, 11781, 15623, 11703, 15604, 11631, 15585, 11562, 15566, 11495,
+		15548, 11433, 15530, 11373, 15512, 11315, 15495, 11257, 15478, 11154, 15462, 11056, 15446, 10967, 15430, 10877,
+		15414, 10794, 15399, 10713, 15384, 10635, 15369, 10561, 15348, 10490, 15320, 10424, 15292, 10362, 15265, 10304,
+		15238, 10248, 15212, 10147, 15186, 10044, 15161, 9944, 15136, 9854, 15112, 9765, 15088, 9683, 15064, 9601,
+		15041, 9525, 15018, 9453, 14996, 9384, 14974, 9319, 14952, 9257, 14931, 9179, 14910, 9069, 14890, 8963,
+		14870, 8866, 14850, 8769, 14831, 8681, 14812, 8594, 14793, 8519, 14775, 8443, 14757, 8372, 14740, 8305,
+		14722, 8239, 14705, 8157, 14688, 8037, 14671, 7922, 14655, 7818, 14639, 7721, 14624, 7633, 14608, 7540,
+		14593, 7456, 14578, 7376, 14563, 7298, 14548, 7225, 14534, 7143, 14520, 7013, 14506, 6890, 14492, 6779,
+		14479, 6669, 14466, 6575, 14453, 6482, 14440, 6390, 14428, 6308, 14415, 6226, 14403, 6149, 14391, 6010,
+		14379, 5875, 14367, 5748, 14356, 5629, 14345, 5525, 14331, 5428, 14310, 5336, 14288, 5250, 14267, 5163,
+		14247, 5066, 14226, 4925, 14206, 4781, 14186, 4657, 14166, 4531, 14147, 4414, 14128, 4305, 14109, 4223,
+		14091, 4128, 14073, 3982, 14054, 3818, 14037, 3666, 14019, 3525, 14002, 3412, 13985, 3291, 13969, 3195,
+		13952, 3090, 13936, 2958, 13920, 2809, 13905, 2640, 13889, 2485, 13874, 2365, 13859, 2233, 13844, 2112,
+		13829, 2007, 13815, 1801, 13800, 1658, 13786, 1527, 13773, 1363, 13759, 1216, 13745, 1082, 13732, 961,
+		13719, 910, 13706, 800, 13693, 707, 13680, 624, 13668, 550, 13655, 483, 13643, 455, 13631, 399,
+		13619, 348, 13608, 303, 13596, 264, 13585, 254, 13574, 220, 13563, 212, 13552, 183, 13541, 155,
+		13530, 133, 13519, 114, 13509, 97, 13499, 111, 13489, 94, 13479, 80, 13469, 68, 13459, 57,
+		13450, 73, 13440, 61, 13431, 50, 13421, 42, 13412, 42, 13403, 35, 13394, 28, 13385, 23,
+		13376, 18, 13367, 14, 13359, 17, 13351, 13, 13342, 10, 13334, 7, 13326, 12, 13318, 10,
+		17580, 22054, 17674, 21690, 17760, 21487, 17836, 21226, 17901, 21027, 17955, 20864, 17998, 20726, 18032, 20608,
+		18057, 20503, 18074, 20342, 18083, 20177, 18086, 20030, 18085, 19898, 18079, 19779, 18070, 19673, 18057, 19576,
+		18042, 19488, 18025, 19362, 18006, 19217, 17985, 19085, 17964, 18965, 17941, 18854, 17917, 18753, 17893, 18661,
+		17868, 18576, 17843, 18497, 17818, 18416, 17792, 18283, 17767, 18160, 17741, 18045, 17716, 17939, 17691, 17841,
+		17666, 17750, 17642, 17666, 17617, 17587, 17593, 17514, 17569, 17446, 17546, 17356, 17523, 17238, 17500, 17127,
+		17478, 17023, 17456, 16927, 17435, 16836, 17413, 16751, 17378, 16673, 17338, 16598, 17299, 16529, 17260, 16464,
+		17221, 16402, 17184, 16304, 17148, 16196, 17113, 16095, 17078, 15999, 17045, 15909, 17012, 15825, 16979, 15745,
+		16948, 15670, 16917, 15599, 16887, 15532, 16858, 15470, 16829, 15410, 16801, 15347, 16773, 15242, 16747, 15141,
+		16721, 15048, 16695, 14959, 16670, 14874, 16646, 14794, 16622, 14718, 16599, 14647, 16576, 14579, 16554, 14515,
+		16532, 14454, 16511, 14397, 16490, 14342, 16470, 14244, 16450, 14147, 16431, 14054, 16412, 13966, 16394, 13882,
+		16367, 13803, 16332, 13728, 16297, 13657, 16264, 13590, 16231, 13525, 16199, 13463, 16167, 13405, 16136, 13350,
+		16106, 13281, 16076, 13184, 16048, 13090, 16020, 13001, 15992, 12915, 15965, 12835, 15939, 12758, 15913, 12685,
+		15888, 12614, 15863, 12548, 15839, 12485, 15815, 12424, 15791, 12367, 15769, 12313, 15746, 12234, 15724, 12135,
+		15703, 12042, 15682, 11952, 15661, 11867, 15641, 11785, 15622, 11710, 15602, 11637, 15583, 11567, 15565, 11502,
+		15546, 11437, 15529, 11378, 15511, 11321, 15494, 11267, 15477, 11167, 15461, 11067, 15445, 10974, 15429, 10885,
+		15413, 10799, 15398, 10718, 15383, 10641, 15368, 10568, 15347, 10499, 15319, 10434, 15292, 10373, 15265, 10312,
+		15238, 10255, 15211, 10159, 15185, 10054, 15160, 9955, 15135, 9860, 15111, 9774, 15087, 9691, 15063, 9612,
+		15040, 9537, 15018, 9463, 14995, 9395, 14973, 9329, 14952, 9268, 14931, 9200, 14910, 9088, 14890, 8982,
+		14870, 8881, 14850, 8783, 14831, 8693, 14812, 8607, 14793, 8523, 14774, 8446, 14756, 8373, 14739, 8304,
+		14721, 8240, 14704, 8160, 14687, 8039, 14671, 7935, 14655, 7828, 14639, 7733, 14624, 7646, 14608, 7556,
+		14593, 7468, 14578, 7385, 14563, 7307, 14548, 7235, 14534, 7168, 14520, 7046, 14507, 6925, 14493, 6812,
+		14480, 6700, 14466, 6598, 14453, 6503, 14441, 6409, 14428, 6321, 14415, 6239, 14403, 6166, 14391, 6046,
+		14380, 5916, 14368, 5794, 14357, 5680, 14346, 5572, 14333, 5464, 14311, 5363, 14289, 5269, 14268, 5181,
+		14247, 5077, 14226, 4923, 14206, 4780, 14186, 4647, 14167, 4543, 14148, 4444, 14128, 4333, 14110, 4230,
+		14092, 4154, 14073, 4031, 14055, 3863, 14037, 3724, 14020, 3591, 14003, 3456, 13986, 3348, 13969, 3231,
+		13953, 3137, 13937, 3001, 13921, 2817, 13905, 2647, 13889, 2492, 13874, 2375, 13859, 2268, 13844, 2144,
+		13829, 2013, 13815, 1856, 13801, 1701, 13787, 1522, 13773, 1360, 13759, 1213, 13746, 1111, 13732, 1026,
+		13719, 910, 13706, 836, 13694, 772, 13681, 681, 13668, 599, 13656, 526, 13644, 461, 13632, 429,
+		13620, 374, 13608, 326, 13597, 284, 13585, 246, 13574, 252, 13563, 228, 13552, 197, 13542, 171,
+		13531, 147, 13521, 145, 13510, 125, 13500, 123, 13490, 105, 13480, 89, 13470, 76, 13460, 65,
+		13450, 67, 13441, 56, 13431, 55, 13422, 46, 13413, 39, 13404, 48, 13395, 39, 13386, 32,
+		13377, 32, 13369, 26, 13360, 20, 13352, 16, 13344, 18, 13335, 13, 13327, 9, 13319, 10,
+		17540, 21955, 17626, 21614, 17706, 21365, 17776, 21120, 17839, 20938, 17890, 20787, 17932, 20660, 17966, 20551,
+		17991, 20427, 18009, 20256, 18020, 20103, 18025, 19966, 18026, 19842, 18022, 19730, 18015, 19630, 18005, 19538,
+		17992, 19454, 17977, 19303, 17960, 19165, 17941, 19039, 17921, 18924, 17901, 18818, 17879, 18721, 17857, 18632,
+		17834, 18550, 17810, 18474, 17786, 18376, 17763, 18246, 17739, 18127, 17715, 18016, 17691, 17913, 17667, 17818,
+		17643, 17729, 17620, 17647, 17597, 17570, 17574, 17499, 17551, 17432, 17528, 17332, 17506, 17216, 17484, 17107,
+		17463, 17006, 17442, 16911, 17421, 16823, 17393, 16738, 17354, 16661, 17315, 16588, 17276, 16519, 17239, 16455,
+		17202, 16395, 17167, 16293, 17131, 16185, 17096, 16084, 17063, 15990, 17030, 15901, 16998, 15818, 16966, 15738,
+		16935, 15664, 16905, 15594, 16875, 15528, 16847, 15466, 16819, 15407, 16791, 15342, 16764, 15237, 16738, 15138,
+		16712, 15043, 16687, 14954, 16663, 14871, 16638, 14791, 16615, 14717, 16592, 14646, 16570, 14578, 16548, 14514,
+		16527, 14454, 16506, 14396, 16485, 14342, 16465, 14245, 16446, 14147, 16427, 14056, 16408, 13968, 16390, 13883,
+		16360, 13805, 16325, 13730, 16291, 13659, 16258, 13591, 16225, 13527, 16193, 13465, 16162, 13408, 16131, 13353,
+		16102, 13290, 16072, 13190, 16043, 13094, 16015, 13004, 15988, 12918, 15961, 12836, 15935, 12760, 15909, 12687,
+		15884, 12619, 15859, 12551, 15836, 12489, 15812, 12429, 15789, 12372, 15766, 12317, 15744, 12242, 15722, 12143,
+		15701, 12049, 15680, 11959, 15660, 11875, 15640, 11794, 15620, 11717, 15601, 11643, 15582, 11574, 15563, 11507,
+		15545, 11443, 15527, 11384, 15510, 11326, 15493, 11272, 15476, 11176, 15460, 11079, 15443, 10982, 15428, 10893,
+		15412, 10808, 15397, 10728, 15382, 10651, 15368, 10578, 15346, 10509, 15318, 10441, 15290, 10377, 15263, 10318,
+		15236, 10260, 15210, 10171, 15184, 10068, 15159, 9970, 15135, 9879, 15111, 9791, 15087, 9706, 15063, 9623,
+		15040, 9545, 15017, 9473, 14995, 9402, 14973, 9337, 14952, 9277, 14931, 9216, 14910, 9106, 14890, 9000,
+		14870, 8896, 14850, 8802, 14831, 8710, 14812, 8625, 14793, 8540, 14775, 8461, 14757, 8387, 14739, 8318,
+		14722, 8252, 14704, 8182, 14688, 8064, 14671, 7948, 14655, 7841, 14639, 7741, 14623, 7643, 14607, 7556,
+		14592, 7470, 14577, 7387, 14563, 7317, 14548, 7242, 14534, 7174, 14520, 7047, 14506, 6940, 14493, 6824,
+		14479, 6716, 14466, 6613, 14453, 6517, 14441, 6427, 14428, 6346, 14416, 6262, 14404, 6187, 14392, 6088,
+		14380, 5947, 14368, 5816, 14357, 5692, 14345, 5577, 14333, 5474, 14311, 5379, 14289, 5284, 14268, 5201,
+		14247, 5123, 14227, 4980, 14207, 4850, 14187, 4711, 14167, 4582, 14148, 4461, 14129, 4349, 14110, 4244,
+		14091, 4148, 14073, 4031, 14055, 3864, 14038, 3726, 14021, 3614, 14004, 3493, 13987, 3365, 13970, 3278,
+		13954, 3167, 13937, 3056, 13921, 2865, 13905, 2716, 13890, 2555, 13875, 2433, 13860, 2304, 13845, 2177,
+		13830, 2062, 13816, 1932, 13802, 1734, 13787, 1553, 13774, 1472, 13760, 1315, 13746, 1172, 13733, 1043,
+		13720, 963, 13707, 854, 13694, 784, 13682, 693, 13669, 611, 13657, 569, 13645, 500, 13633, 487,
+		13621, 453, 13610, 396, 13598, 346, 13587, 301, 13575, 262, 13564, 228, 13553, 215, 13542, 186,
+		13532, 161, 13521, 138, 13511, 136, 13500, 116, 13490, 99, 13480, 85, 13470, 94, 13461, 80,
+		13451, 68, 13441, 68, 13432, 57, 13423, 48, 13414, 49, 13405, 41, 13396, 34, 13387, 28,
+		13378, 35, 13370, 34, 13361, 30, 13353, 24, 13344, 21, 13336, 16, 13328, 15, 13319, 11,
+		17503, 21863, 17582, 21546, 17655, 21251, 17722, 21025, 17780, 20854, 17829, 20716, 17871, 20599, 17904, 20497,
+		17929, 20334, 17947, 20174, 17960, 20032, 17967, 19904, 17969, 19788, 17968, 19683, 17962, 19588, 17954, 19501,
+		17943, 19390, 17930, 19246, 17915, 19114, 17898, 18994, 17880, 18884, 17861, 18783, 17841, 18689, 17821, 18603,
+		17800, 18525, 17778, 18451, 17756, 18336, 17733, 18210, 17711, 18094, 17688, 17987, 17666, 17888, 17643, 17794,
+		17621, 17708, 17598, 17628, 17576, 17553, 17554, 17484, 17532, 17418, 17511, 17308, 17489, 17193, 17469, 17087,
+		17448, 16988, 17428, 16895, 17408, 16808, 17368, 16726, 17330, 16650, 17292, 16578, 17255, 16510, 17218, 16447,
+		17182, 16387, 17148, 16279, 17113, 16173, 17080, 16075, 17047, 15981, 17015, 15893, 16983, 15810, 16952, 15732,
+		16922, 15658, 16893, 15589, 16864, 15523, 16835, 15461, 16808, 15403, 16781, 15336, 16755, 15232, 16729, 15133,
+		16704, 15040, 16679, 14951, 16655, 14868, 16631, 14789, 16608, 14714, 16586, 14644, 16564, 14577, 16542, 14513,
+		16521, 14454, 16500, 14396, 16480, 14342, 16461, 14246, 16441, 14149, 16422, 14056, 16404, 13968, 16386, 13886,
+		16353, 13807, 16318, 13732, 16284, 13661, 16251, 13593, 16219, 13528, 16187, 13468, 16156, 13410, 16126, 13356,
+		16096, 13293, 16067, 13194, 16039, 13099, 16011, 13010, 15984, 12926, 15958, 12844, 15931, 12766, 15906, 12692,
+		15881, 12622, 15856, 12554, 15832, 12490, 15809, 12432, 15786, 12374, 15764, 12321, 15741, 12248, 15720, 12152,
+		15699, 12057, 15678, 11968, 15658, 11883, 15638, 11802, 15618, 11724, 15599, 11650, 15580, 11580, 15562, 11513,
+		15544, 11449, 15526, 11390, 15509, 11332, 15492, 11279, 15475, 11187, 15459, 11088, 15442, 10992, 15427, 10904,
+		15411, 10820, 15396, 10738, 15381, 10659, 15367, 10587, 15345, 10516, 15317, 10448, 15289, 10386, 15262, 10326,
+		15236, 10269, 15210, 10188, 15184, 10084, 15159, 9984, 15134, 9888, 15109, 9797, 15086, 9712, 15062, 9633,
+		15039, 9558, 15017, 9484, 14995, 9415, 14973, 9350, 14952, 9287, 14931, 9228, 14910, 9123, 14889, 9012,
+		14869, 8910, 14849, 8813, 14830, 8722, 14812, 8636, 14793, 8553, 14775, 8477, 14757, 8402, 14739, 8333,
+		14722, 8264, 14705, 8202, 14688, 8092, 14671, 7974, 14655, 7866, 14639, 7761, 14623, 7665, 14608, 7574,
+		14592, 7485, 14577, 7406, 14563, 7329, 14548, 7253, 14534, 7185, 14520, 7068, 14506, 6951, 14492, 6831,
+		14479, 6727, 14466, 6629, 14453, 6528, 14441, 6437, 14428, 6347, 14416, 6267, 14404, 6198, 14392, 6102,
+		14380, 5967, 14368, 5841, 14357, 5723, 14346, 5618, 14334, 5518, 14312, 5413, 14291, 5327, 14270, 5235,
+		14249, 5148, 14228, 5016, 14208, 4866, 14188, 4726, 14168, 4605, 14149, 4492, 14130, 4387, 14111, 4290,
+		14093, 4199, 14075, 4114, 14056, 3957, 14039, 3794, 14021, 3644, 14004, 3504, 13987, 3376, 13970, 3257,
+		13953, 3148, 13937, 3021, 13922, 2892, 13906, 2742, 13891, 2617, 13876, 2490, 13861, 2372, 13846, 2239,
+		13831, 2117, 13816, 1964, 13802, 1762, 13788, 1637, 13775, 1504, 13761, 1343, 13747, 1198, 13734, 1067,
+		13720, 948, 13707, 841, 13695, 804, 13683, 741, 13670, 674, 13658, 594, 13646, 552, 13634, 485,
+		13622, 425, 13610, 393, 13598, 344, 13587, 323, 13576, 281, 13565, 265, 13554, 249, 13544, 230,
+		13533, 199, 13522, 172, 13511, 148, 13501, 127, 13491, 109, 13481, 105, 13471, 90, 13462, 88,
+		13452, 75, 13442, 63, 13433, 65, 13424, 54, 13414, 45, 13406, 46, 13397, 38, 13388, 36,
+		13379, 35, 13370, 28, 13361, 22, 13353, 24, 13345, 26, 13337, 19, 13329, 18, 13320, 12,
+		17467, 21778, 17541, 21462, 17609, 21147, 17671, 20938, 17725, 20778, 17772, 20649, 17812, 20540, 17845, 20412,
+		17870, 20245, 17889, 20097, 17903, 19964, 17911, 19844, 17914, 19735, 17915, 19637, 17911, 19547, 17905, 19466,
+		17896, 19326, 17884, 19190, 17871, 19065, 17856, 18949, 17841, 18844, 17823, 18747, 17805, 18658, 17786, 18575,
+		17766, 18499, 17746, 18425, 17725, 18294, 17705, 18175, 17683, 18062, 17662, 17958, 17641, 17861, 17619, 17771,
+		17598, 17687, 17577, 17609, 17555, 17536, 17535, 17468, 17514, 17401, 17493, 17282, 17473, 17171, 17453, 17068,
+		17433, 16970, 17413, 16879, 17380, 16793, 17343, 16713, 17305, 16638, 17269, 16567, 17233, 16501, 17198, 16438,
+		17163, 16375, 17129, 16265, 17095, 16160, 17063, 16063, 17031, 15970, 16999, 15884, 16969, 15803, 16939, 15726,
+		16909, 15652, 16880, 15583, 16852, 15519, 16824, 15457, 16797, 15400, 16771, 15330, 16745, 15225, 16720, 15128,
+		16695, 15035, 16671, 14948, 16647, 14865, 16624, 14787, 16601, 14712, 16579, 14643, 16557, 14576, 16536, 14512,
+		16515, 14452, 16495, 14396, 16475, 14342, 16455, 14245, 16437, 14150, 16418, 14056, 16400, 13970, 16380, 13888,
+		16345, 13809, 16311, 13734, 16277, 13662, 16245, 13595, 16213, 13531, 16181, 13470, 16151, 13413, 16121, 13357,
+		16091, 13299, 16063, 13199, 16035, 13105, 16007, 13015, 15980, 12929, 15953, 12848, 15928, 12770, 15902, 12697,
+		15878, 12628, 15854, 12562, 15830, 12498, 15806, 12437, 15783, 12379, 15761, 12324, 15739, 12254, 15717, 12156,
+		15696, 12063, 15675, 11972, 15656, 11890, 15636, 11807, 15616, 11731, 15597, 11657, 15579, 11587, 15560, 11521,
+		15543, 11458, 15525, 11397, 15508, 11339, 15491, 11284, 15474, 11200, 15458, 11099, 15442, 11005, 15426, 10914,
+		15410, 10828, 15395, 10747, 15380, 10668, 15366, 10595, 15343, 10523, 15316, 10458, 15288, 10395, 15261, 10334,
+		15234, 10275, 15208, 10202, 15183, 10097, 15157, 9995, 15133, 9903, 15109, 9813, 15085, 9729, 15062, 9646,
+		15039, 9570, 15016, 9496, 14994, 9424, 14972, 9356, 14951, 9292, 14930, 9234, 14909, 9140, 14889, 9033,
+		14870, 8933, 14850, 8834, 14831, 8742, 14812, 8653, 14793, 8567, 14775, 8489, 14757, 8414, 14739, 8340,
+		14722, 8274, 14705, 8212, 14688, 8109, 14671, 7994, 14655, 7888, 14639, 7784, 14623, 7689, 14608, 7594,
+		14593, 7509, 14578, 7428, 14563, 7347, 14549, 7273, 14534, 7201, 14520, 7103, 14507, 6979, 14493, 6862,
+		14479, 6747, 14466, 6644, 14453, 6545, 14441, 6453, 14428, 6363, 14416, 6285, 14404, 6205, 14392, 6129,
+		14380, 6000, 14369, 5865, 14357, 5738, 14346, 5626, 14334, 5521, 14312, 5422, 14291, 5329, 14270, 5242,
+		14249, 5161, 14228, 5051, 14209, 4918, 14189, 4784, 14169, 4660, 14150, 4541, 14131, 4432, 14112, 4321,
+		14094, 4219, 14075, 4130, 14057, 3986, 14040, 3839, 14023, 3702, 14005, 3559, 13988, 3441, 13972, 3344,
+		13956, 3242, 13939, 3134, 13923, 2995, 13907, 2811, 13892, 2643, 13876, 2488, 13861, 2346, 13846, 2216,
+		13831, 2097, 13817, 2014, 13803, 1808, 13789, 1737, 13775, 1555, 13762, 1426, 13748, 1273, 13735, 1134,
+		13722, 1008, 13708, 894, 13696, 851, 13683, 753, 13670, 665, 13658, 586, 13646, 529, 13634, 465,
+		13622, 434, 13611, 380, 13600, 370, 13588, 324, 13577, 303, 13566, 273, 13555, 238, 13544, 218,
+		13534, 204, 13523, 193, 13513, 167, 13503, 174, 13492, 150, 13482, 129, 13472, 111, 13463, 104,
+		13453, 89, 13443, 75, 13434, 73, 13425, 71, 13416, 60, 13406, 51, 13397, 48, 13388, 40,
+		13379, 31, 13370, 30, 13362, 24, 13353, 21, 13345, 19, 13337, 17, 13329, 15, 13321, 13,
+		17435, 21704, 17502, 21346, 17565, 21054, 17623, 20855, 17674, 20707, 17719, 20587, 17757, 20486, 17789, 20316,
+		17815, 20162, 17834, 20023, 17848, 19898, 17858, 19787, 17863, 19685, 17864, 19593, 17862, 19508, 17857, 19405,
+		17850, 19264, 17840, 19134, 17829, 19015, 17816, 18906, 17801, 18805, 17786, 18713, 17769, 18627, 17752, 18547,
+		17734, 18475, 17715, 18380, 17696, 18255, 17676, 18138, 17656, 18029, 17636, 17928, 17616, 17835, 17596, 17747,
+		17576, 17666, 17555, 17590, 17535, 17519, 17515, 17452, 17495, 17372, 17476, 17257, 17456, 17148, 17437, 17046,
+		17418, 16952, 17390, 16862, 17353, 16778, 17316, 16699, 17281, 16625, 17246, 16557, 17211, 16491, 17177, 16430,
+		17143, 16359, 17110, 16251, 17077, 16148, 17046, 16052, 17014, 15961, 16984, 15875, 16954, 15794, 16924, 15717,
+		16896, 15646, 16868, 15579, 16840, 15514, 16813, 15453, 16786, 15395, 16761, 15323, 16735, 15221, 16710, 15124,
+		16686, 15032, 16662, 14944, 16639, 14862, 16616, 14784, 16594, 14710, 16572, 14640, 16550, 14574, 16530, 14511,
+		16509, 14452, 16489, 14395, 16470, 14342, 16450, 14246, 16431, 14149, 16413, 14058, 16395, 13970, 16371, 13888,
+		16337, 13810, 16303, 13735, 16270, 13664, 16238, 13598, 16206, 13534, 16175, 13472, 16145, 13415, 16115, 13360,
+		16086, 13303, 16057, 13203, 16030, 13111, 16002, 13019, 15976, 12934, 15949, 12852, 15924, 12775, 15899, 12703,
+		15874, 12633, 15850, 12565, 15826, 12502, 15803, 12441, 15780, 12383, 15758, 12330, 15737, 12269, 15715, 12170,
+		15694, 12074, 15674, 11982, 15653, 11897, 15633, 11813, 15614, 11736, 15595, 11663, 15577, 11593, 15559, 11527,
+		15541, 11463, 15523, 11402, 15506, 11345, 15489, 11290, 15473, 11209, 15457, 11112, 15441, 11017, 15425, 10927,
+		15410, 10841, 15394, 10758, 15380, 10679, 15365, 10605, 15342, 10534, 15314, 10466, 15287, 10403, 15259, 10341,
+		15233, 10282, 15207, 10213, 15181, 10108, 15156, 10009, 15132, 9917, 15108, 9825, 15084, 9740, 15061, 9657,
+		15038, 9579, 15016, 9507, 14994, 9436, 14972, 9370, 14951, 9308, 14930, 9247, 14909, 9163, 14889, 9054,
+		14869, 8948, 14849, 8846, 14830, 8752, 14811, 8663, 14793, 8582, 14775, 8503, 14757, 8428, 14739, 8360,
+		14722, 8293, 14705, 8226, 14688, 8136, 14671, 8016, 14655, 7906, 14639, 7804, 14624, 7705, 14608, 7614,
+		14593, 7525, 14578, 7441, 14564, 7367, 14549, 7289, 14535, 7223, 14521, 7140, 14507, 7014, 14493, 6895,
+		14480, 6782, 14467, 6672, 14454, 6572, 14441, 6475, 14429, 6390, 14416, 6308, 14404, 6228, 14392, 6155,
+		14381, 6021, 14369, 5885, 14357, 5764, 14346, 5650, 14335, 5543, 14313, 5442, 14292, 5361, 14271, 5266,
+		14250, 5183, 14230, 5091, 14209, 4936, 14189, 4801, 14170, 4666, 14150, 4549, 14132, 4448, 14113, 4354,
+		14095, 4259, 14077, 4160, 14059, 4059, 14041, 3919, 14024, 3759, 14006, 3611, 13990, 3487, 13973, 3371,
+		13956, 3253, 13940, 3158, 13924, 3041, 13909, 2880, 13893, 2706, 13878, 2585, 13863, 2481, 13848, 2340,
+		13834, 2227, 13819, 2103, 13804, 1939, 13790, 1740, 13776, 1559, 13762, 1395, 13749, 1246, 13736, 1179,
+		13722, 1050, 13709, 966, 13697, 912, 13684, 837, 13672, 741, 13659, 654, 13647, 576, 13635, 533,
+		13623, 491, 13612, 430, 13600, 377, 13588, 325, 13577, 283, 13566, 246, 13555, 231, 13544, 200,
+		13534, 187, 13523, 190, 13513, 162, 13502, 139, 13492, 119, 13482, 115, 13473, 114, 13463, 97,
+		13454, 109, 13444, 92, 13434, 77, 13425, 69, 13416, 58, 13407, 54, 13398, 53, 13389, 49,
+		13380, 39, 13372, 38, 13363, 29, 13354, 23, 13346, 21, 13338, 18, 13329, 13, 13321, 13,
+		17398, 21633, 17466, 21240, 17524, 20964, 17578, 20779, 17626, 20640, 17669, 20528, 17706, 20389, 17737, 20226,
+		17761, 20081, 17781, 19952, 17796, 19837, 17806, 19732, 17813, 19636, 17815, 19549, 17815, 19470, 17812, 19338,
+		17806, 19204, 17798, 19081, 17788, 18968, 17776, 18863, 17764, 18767, 17749, 18678, 17734, 18596, 17718, 18520,
+		17702, 18450, 17684, 18336, 17666, 18215, 17648, 18102, 17630, 17998, 17611, 17899, 17592, 17809, 17573, 17724,
+		17554, 17645, 17534, 17571, 17515, 17501, 17496, 17437, 17477, 17344, 17458, 17231, 17440, 17125, 17421, 17026,
+		17398, 16933, 17362, 16845, 17326, 16763, 17291, 16686, 17256, 16613, 17222, 16545, 17188, 16481, 17155, 16420,
+		17123, 16344, 17091, 16237, 17059, 16135, 17028, 16040, 16998, 15951, 16968, 15866, 16939, 15786, 16910, 15710,
+		16882, 15639, 16855, 15572, 16828, 15508, 16802, 15449, 16776, 15393, 16750, 15317, 16725, 15214, 16701, 15118,
+		16677, 15027, 16654, 14941, 16631, 14860, 16608, 14782, 16586, 14708, 16565, 14639, 16544, 14573, 16523, 14510,
+		16503, 14451, 16483, 14394, 16464, 14342, 16445, 14245, 16427, 14150, 16409, 14059, 16391, 13971, 16362, 13889,
+		16328, 13810, 16295, 13736, 16262, 13664, 16230, 13598, 16199, 13536, 16169, 13474, 16139, 13417, 16110, 13363,
+		16081, 13309, 16052, 13208, 16025, 13115, 15998, 13025, 15971, 12940, 15945, 12858, 15920, 12781, 15895, 12707,
+		15870, 12636, 15847, 12570, 15823, 12507, 15800, 12447, 15778, 12390, 15755, 12334, 15734, 12275, 15713, 12176,
+		15692, 12080, 15671, 11991, 15652, 11907, 15632, 11827, 15613, 11747, 15594, 11672, 15575, 11601, 15557, 11533,
+		15539, 11468, 15521, 11407, 15504, 11350, 15488, 11295, 15471, 11220, 15455, 11121, 15439, 11027, 15424, 10938,
+		15409, 10850, 15393, 10766, 15379, 10688, 15364, 10615, 15341, 10544, 15313, 10477, 15286, 10413, 15259, 10352,
+		15232, 10292, 15207, 10235, 15181, 10128, 15156, 10026, 15132, 9930, 15107, 9839, 15083, 9751, 15060, 9667,
+		15037, 9591, 15015, 9517, 14993, 9447, 14971, 9378, 14950, 9315, 14929, 9254, 14909, 9178, 14889, 9070,
+		14869, 8966, 14849, 8868, 14831, 8777, 14812, 8687, 14793, 8602, 14775, 8522, 14757, 8443, 14739, 8368,
+		14722, 8299, 14704, 8233, 14688, 8158, 14671, 8040, 14655, 7931, 14640, 7830, 14624, 7733, 14609, 7637,
+		14593, 7546, 14578, 7459, 14564, 7379, 14549, 7302, 14535, 7233, 14521, 7169, 14507, 7038, 14494, 6918,
+		14481, 6808, 14468, 6704, 14455, 6603, 14442, 6511, 14430, 6421, 14417, 6332, 14405, 6252, 14393, 6177,
+		14381, 6069, 14370, 5929, 14358, 5806, 14347, 5689, 14336, 5580, 14314, 5471, 14293, 5376, 14271, 5280,
+		14250, 5197, 14230, 5106, 14210, 4960, 14190, 4814, 14171, 4713, 14152, 4593, 14133, 4478, 14114, 4365,
+		14096, 4276, 14077, 4177, 14059, 4089, 14042, 3918, 14025, 3789, 14007, 3653, 13991, 3542, 13974, 3423,
+		13958, 3301, 13942, 3214, 13926, 3108, 13910, 2943, 13894, 2782, 13879, 2637, 13863, 2482, 13849, 2363,
+		13834, 2232, 13820, 2147, 13805, 2021, 13791, 1853, 13778, 1736, 13764, 1554, 13750, 1390, 13736, 1240,
+		13723, 1105, 13711, 1025, 13698, 912, 13685, 809, 13672, 746, 13660, 686, 13648, 606, 13636, 559,
+		13625, 559, 13613, 490, 13601, 430, 13590, 376, 13578, 328, 13567, 305, 13556, 265, 13546, 245,
+		13535, 211, 13524, 182, 13514, 173, 13503, 149, 13493, 127, 13483, 133, 13473, 113, 13463, 105,
+		13454, 89, 13444, 75, 13435, 72, 13426, 67, 13417, 72, 13408, 59, 13399, 48, 13390, 43,
+		13381, 35, 13373, 42, 13364, 38, 13355, 29, 13347, 26, 13339, 22, 13331, 19, 13322, 15,
+		17339, 21568, 17432, 21143, 17486, 20883, 17536, 20708, 17582, 20578, 17622, 20469, 17657, 20292, 17687, 20141,
+		17712, 20005, 17731, 19885, 17746, 19777, 17758, 19679, 17765, 19590, 17768, 19507, 17769, 19409, 17767, 19271,
+		17763, 19145, 17756, 19028, 17748, 18920, 17738, 18821, 17726, 18729, 17714, 18644, 17700, 18566, 17685, 18493,
+		17670, 18418, 17654, 18292, 17637, 18175, 17620, 18066, 17603, 17965, 17585, 17870, 17567, 17782, 17550, 17700,
+		17531, 17623, 17513, 17551, 17495, 17484, 17477, 17421, 17459, 17317, 17441, 17206, 17423, 17102, 17403, 17006,
+		17368, 16914, 17333, 16828, 17299, 16748, 17265, 16672, 17231, 16601, 17198, 16534, 17165, 16470, 17134, 16412,
+		17102, 16328, 17071, 16222, 17041, 16123, 17011, 16029, 16981, 15941, 16952, 15857, 16924, 15778, 16896, 15704,
+		16869, 15633, 16842, 15566, 16815, 15503, 16790, 15444, 16764, 15387, 16739, 15308, 16715, 15209, 16691, 15114,
+		16668, 15023, 16645, 14936, 16622, 14856, 16600, 14779, 16579, 14706, 16558, 14638, 16537, 14572, 16517, 14510,
+		16497, 14450, 16477, 14394, 16458, 14341, 16440, 14246, 16421, 14149, 16404, 14059, 16386, 13973, 16354, 13890,
+		16320, 13812, 16287, 13739, 16255, 13668, 16223, 13600, 16192, 13537, 16162, 13476, 16132, 13418, 16103, 13364,
+		16075, 13312, 16047, 13212, 16019, 13118, 15993, 13030, 15967, 12945, 15941, 12862, 15915, 12785, 15891, 12712,
+		15867, 12642, 15843, 12575, 15820, 12512, 15797, 12452, 15774, 12393, 15753, 12339, 15731, 12284, 15710, 12186,
+		15689, 12092, 15669, 12001, 15649, 11914, 15630, 11833, 15610, 11754, 15592, 11680, 15573, 11609, 15556, 11543,
+		15538, 11480, 15520, 11417, 15503, 11359, 15487, 11303, 15470, 11234, 15454, 11132, 15438, 11036, 15423, 10946,
+		15407, 10858, 15392, 10776, 15378, 10698, 15363, 10624, 15339, 10554, 15311, 10486, 15284, 10420, 15257, 10358,
+		15231, 10300, 15205, 10244, 15180, 10144, 15155, 10042, 15131, 9946, 15106, 9854, 15083, 9769, 15060, 9686,
+		15037, 9605, 15015, 9531, 14993, 9459, 14971, 9389, 14950, 9325, 14929, 9264, 14908, 9197, 14888, 9090,
+		14868, 8983, 14849, 8883, 14830, 8788, 14811, 8697, 14792, 8610, 14774, 8531, 14756, 8456, 14739, 8384,
+		14722, 8316, 14705, 8253, 14688, 8191, 14672, 8071, 14656, 7957, 14640, 7847, 14624, 7746, 14608, 7650,
+		14593, 7562, 14578, 7476, 14564, 7394, 14550, 7322, 14536, 7254, 14522, 7185, 14508, 7067, 14494, 6940,
+		14481, 6825, 14468, 6716, 14455, 6623, 14442, 6530, 14430, 6438, 14417, 6348, 14405, 6270, 14394, 6201,
+		14382, 6120, 14371, 5984, 14359, 5856, 14348, 5735, 14337, 5623, 14316, 5511, 14294, 5413, 14273, 5320,
+		14252, 5234, 14232, 5153, 14212, 5035, 14192, 4883, 14172, 4752, 14153, 4620, 14133, 4497, 14115, 4391,
+		14096, 4292, 14078, 4192, 14060, 4107, 14043, 3990, 14025, 3825, 14008, 3672, 13991, 3531, 13974, 3414,
+		13958, 3327, 13942, 3212, 13926, 3119, 13911, 3006, 13895, 2870, 13880, 2717, 13865, 2556, 13850, 2448,
+		13836, 2329, 13821, 2200, 13806, 2083, 13792, 1904, 13779, 1769, 13765, 1622, 13751, 1453, 13738, 1331,
+		13725, 1188, 13712, 1087, 13699, 1025, 13687, 930, 13674, 825, 13661, 731, 13649, 646, 13637, 570,
+		13625, 501, 13613, 457, 13602, 422, 13591, 389, 13580, 372, 13569, 325, 13558, 333, 13547, 290,
+		13536, 252, 13525, 218, 13515, 203, 13505, 175, 13494, 162, 13484, 139, 13474, 119, 13465, 113,
+		13455, 96, 13446, 101, 13436, 85, 13427, 71, 13417, 59, 13409, 63, 13400, 52, 13391, 49,
+		13382, 50, 13373, 39, 13365, 32, 13356, 25, 13348, 27, 13340, 27, 13331, 19, 13323, 17,
+		17284, 21508, 17391, 21051, 17450, 20808, 17497, 20643, 17540, 20521, 17578, 20365, 17611, 20201, 17640, 20059,
+		17664, 19933, 17684, 19820, 17699, 19720, 17711, 19628, 17719, 19545, 17724, 19467, 17725, 19336, 17724, 19206,
+		17721, 19087, 17716, 18976, 17709, 18874, 17700, 18780, 17690, 18692, 17679, 18611, 17666, 18535, 17653, 18466,
+		17639, 18369, 17624, 18248, 17609, 18135, 17593, 18031, 17577, 17933, 17561, 17841, 17544, 17756, 17527, 17677,
+		17510, 17602, 17493, 17532, 17475, 17467, 17458, 17403, 17441, 17287, 17424, 17180, 17405, 17079, 17371, 16984,
+		17338, 16895, 17305, 16811, 17271, 16732, 17239, 16658, 17206, 16588, 17175, 16523, 17143, 16460, 17112, 16402,
+		17081, 16309, 17052, 16207, 17022, 16109, 16993, 16016, 16964, 15929, 16936, 15847, 16909, 15770, 16881, 15695,
+		16855, 15626, 16829, 15561, 16803, 15498, 16778, 15440, 16753, 15383, 16728, 15301, 16705, 15202, 16681, 15106,
+		16658, 15017, 16636, 14934, 16614, 14853, 16592, 14777, 16571, 14703, 16550, 14635, 16530, 14570, 16510, 14508,
+		16491, 14450, 16471, 14393, 16453, 14341, 16434, 14245, 16416, 14150, 16399, 14059, 16379, 13973, 16345, 13892,
+		16311, 13813, 16279, 13740, 16247, 13669, 16216, 13602, 16185, 13539, 16155, 13479, 16126, 13421, 16097, 13366,
+		16069, 13314, 16041, 13217, 16014, 13122, 15987, 13032, 15962, 12949, 15936, 12866, 15911, 12789, 15886, 12716,
+		15863, 12646, 15839, 12579, 15816, 12515, 15793, 12455, 15771, 12398, 15749, 12343, 15728, 12291, 15707, 12196,
+		15687, 12099, 15666, 12008, 15646, 11921, 15627, 11840, 15608, 11762, 15590, 11689, 15572, 11618, 15554, 11549,
+		15536, 11486, 15519, 11423, 15502, 11365, 15485, 11309, 15469, 11252, 15453, 11152, 15437, 11054, 15422, 10963,
+		15407, 10874, 15392, 10789, 15377, 10708, 15362, 10633, 15337, 10562, 15309, 10492, 15282, 10428, 15255, 10366,
+		15229, 10307, 15204, 10253, 15179, 10161, 15154, 10056, 15129, 9958, 15105, 9866, 15082, 9779, 15059, 9695,
+		15036, 9618, 15014, 9544, 14992, 9473, 14971, 9403, 14950, 9341, 14928, 9277, 14908, 9220, 14888, 9111,
+		14868, 9005, 14849, 8901, 14829, 8803, 14811, 8716, 14792, 8630, 14775, 8552, 14757, 8473, 14739, 8398,
+		14722, 8328, 14705, 8261, 14688, 8197, 14672, 8084, 14655, 7972, 14639, 7864, 14624, 7765, 14609, 7680,
+		14594, 7589, 14579, 7502, 14564, 7417, 14550, 7339, 14535, 7263, 14522, 7197, 14508, 7098, 14494, 6974,
+		14481, 6857, 14468, 6754, 14455, 6653, 14443, 6557, 14430, 6460, 14418, 6369, 14406, 6284, 14394, 6207,
+		14382, 6125, 14371, 6005, 14359, 5870, 14348, 5743, 14337, 5630, 14317, 5539, 14296, 5454, 14275, 5361,
+		14254, 5267, 14234, 5188, 14214, 5100, 14193, 4944, 14174, 4804, 14155, 4686, 14136, 4559, 14117, 4448,
+		14099, 4354, 14080, 4249, 14062, 4160, 14044, 4043, 14027, 3875, 14010, 3733, 13993, 3602, 13976, 3466,
+		13960, 3355, 13944, 3263, 13928, 3165, 13912, 3054, 13896, 2866, 13881, 2716, 13865, 2555, 13851, 2428,
+		13836, 2329, 13822, 2219, 13808, 2152, 13794, 2029, 13780, 1854, 13766, 1698, 13753, 1580, 13739, 1413,
+		13726, 1262, 13713, 1143, 13700, 1048, 13688, 956, 13675, 877, 13663, 797, 13651, 706, 13639, 695,
+		13627, 614, 13615, 541, 13603, 476, 13592, 418, 13581, 379, 13569, 332, 13558, 309, 13548, 270,
+		13537, 250, 13527, 243, 13516, 211, 13506, 208, 13496, 190, 13486, 164, 13476, 159, 13466, 136,
+		13456, 117, 13447, 108, 13437, 92, 13428, 86, 13419, 73, 13410, 75, 13401, 63, 13392, 52,
+		13383, 49, 13375, 43, 13366, 43, 13357, 37, 13349, 29, 13340, 24, 13332, 18, 13324, 18,
+		17231, 21402, 17330, 20967, 17416, 20737, 17460, 20582, 17500, 20454, 17536, 20269, 17568, 20116, 17596, 19983,
+		17620, 19865, 17639, 19761, 17655, 19666, 17667, 19580, 17675, 19501, 17680, 19400, 17683, 19267, 17683, 19144,
+		17681, 19031, 17677, 18926, 17672, 18829, 17664, 18739, 17655, 18656, 17645, 18578, 17634, 18506, 17622, 18439,
+		17609, 18321, 17595, 18205, 17581, 18096, 17567, 17995, 17551, 17900, 17536, 17813, 17520, 17730, 17504, 17652,
+		17488, 17580, 17472, 17512, 17456, 17449, 17439, 17370, 17423, 17259, 17405, 17154, 17372, 17055, 17340, 16963,
+		17308, 16875, 17276, 16794, 17244, 16716, 17213, 16644, 17182, 16575, 17151, 16511, 17120, 16449, 17091, 16393,
+		17061, 16293, 17032, 16191, 17004, 16095, 16975, 16004, 16947, 15917, 16920, 15837, 16893, 15760, 16867, 15688,
+		16841, 15619, 16815, 15554, 16790, 15492, 16765, 15435, 16741, 15379, 16718, 15294, 16694, 15196, 16671, 15101,
+		16649, 15012, 16627, 14928, 16605, 14847, 16584, 14772, 16563, 14702, 16543, 14634, 16523, 14569, 16503, 14507,
+		16484, 14448, 16465, 14393, 16447, 14340, 16428, 14244, 16411, 14150, 16394, 14060, 16369, 13974, 16336, 13893,
+		16303, 13815, 16270, 13741, 16239, 13671, 16208, 13605, 16178, 13541, 16148, 13481, 16119, 13423, 16091, 13369,
+		16063, 13317, 16036, 13223, 16009, 13128, 15982, 13039, 15956, 12953, 15931, 12871, 15906, 12793, 15882, 12720,
+		15859, 12652, 15835, 12584, 15812, 12520, 15789, 12459, 15768, 12402, 15746, 12347, 15725, 12294, 15704, 12201,
+		15684, 12106, 15664, 12017, 15644, 11930, 15625, 11849, 15606, 11771, 15588, 11695, 15569, 11623, 15552, 11556,
+		15534, 11492, 15517, 11431, 15500, 11372, 15484, 11317, 15467, 11261, 15451, 11160, 15436, 11064, 15420, 10972,
+		15405, 10884, 15391, 10804, 15376, 10726, 15362, 10648, 15336, 10576, 15308, 10506, 15281, 10440, 15254, 10376,
+		15228, 10316, 15202, 10261, 15177, 10173, 15152, 10071, 15128, 9973, 15104, 9881, 15081, 9795, 15058, 9715,
+		15035, 9632, 15013, 9555, 14991, 9482, 14970, 9413, 14948, 9347, 14927, 9285, 14907, 9228, 14887, 9128,
+		14868, 9023, 14849, 8922, 14830, 8829, 14811, 8735, 14793, 8650, 14774, 8566, 14757, 8488, 14739, 8411,
+		14722, 8340, 14705, 8275, 14688, 8213, 14672, 8118, 14656, 8004, 14640, 7894, 14624, 7790, 14609, 7693,
+		14594, 7600, 14579, 7514, 14564, 7431, 14550, 7354, 14536, 7279, 14522, 7215, 14509, 7139, 14495, 7016,
+		14482, 6892, 14469, 6775, 14456, 6672, 14443, 6576, 14431, 6485, 14419, 6395, 14406, 6312, 14395, 6239,
+		14383, 6171, 14371, 6051, 14360, 5917, 14349, 5792, 14338, 5670, 14318, 5562, 14296, 5460, 14275, 5370,
+		14254, 5275, 14234, 5195, 14214, 5103, 14194, 4956, 14175, 4854, 14156, 4732, 14137, 4601, 14118, 4494,
+		14100, 4393, 14082, 4293, 14064, 4193, 14046, 4107, 14029, 3973, 14011, 3810, 13995, 3686, 13977, 3544,
+		13961, 3425, 13945, 3303, 13928, 3191, 13913, 3111, 13897, 2954, 13882, 2775, 13867, 2653, 13852, 2528,
+		13837, 2383, 13823, 2268, 13808, 2145, 13794, 2050, 13780, 1845, 13767, 1688, 13753, 1545, 13740, 1470,
+		13727, 1344, 13714, 1200, 13701, 1098, 13689, 1018, 13676, 930, 13664, 826, 13652, 751, 13640, 689,
+		13628, 609, 13616, 559, 13604, 509, 13593, 448, 13582, 463, 13571, 413, 13560, 371, 13549, 325,
+		13539, 284, 13528, 248, 13517, 216, 13507, 202, 13497, 183, 13487, 182, 13477, 158, 13468, 164,
+		13458, 150, 13449, 129, 13439, 119, 13429, 100, 13420, 85, 13411, 76, 13402, 74, 13393, 61,
+		13384, 56, 13375, 48, 13367, 39, 13358, 35, 13350, 34, 13342, 31, 13333, 22, 13325, 19,
+		17180, 21296, 17272, 20887, 17360, 20669, 17425, 20525, 17463, 20355, 17497, 20181, 17527, 20035, 17554, 19910,
+		17577, 19801, 17596, 19702, 17612, 19614, 17624, 19532, 17633, 19458, 17639, 19324, 17643, 19200, 17644, 19083,
+		17643, 18977, 17640, 18877, 17635, 18785, 17629, 18699, 17621, 18620, 17612, 18546, 17602, 18477, 17591, 18393,
+		17579, 18273, 17567, 18162, 17554, 18057, 17540, 17960, 17526, 17869, 17512, 17783, 17497, 17703, 17482, 17628,
+		17467, 17558, 17451, 17493, 17436, 17432, 17420, 17337, 17402, 17230, 17371, 17127, 17340, 17032, 17309, 16941,
+		17278, 16856, 17247, 16775, 17217, 16700, 17187, 16629, 17157, 16562, 17127, 16499, 17098, 16439, 17069, 16382,
+		17040, 16275, 17012, 16176, 16984, 16080, 16957, 15991, 16930, 15907, 16903, 15826, 16877, 15751, 16852, 15679,
+		16826, 15611, 16802, 15548, 16777, 15486, 16753, 15430, 16729, 15374, 16706, 15286, 16683, 15188, 16661, 15096,
+		16639, 15008, 16618, 14924, 16596, 14844, 16575, 14769, 16555, 14698, 16535, 14629, 16515, 14565, 16496, 14505,
+		16478, 14448, 16459, 14393, 16441, 14340, 16423, 14244, 16405, 14149, 16388, 14060, 16359, 13974, 16326, 13894,
+		16293, 13816, 16262, 13743, 16231, 13672, 16200, 13607, 16171, 13543, 16141, 13483, 16113, 13426, 16084, 13371,
+		16057, 13320, 16030, 13229, 16003, 13133, 15977, 13044, 15952, 12959, 15926, 12877, 15902, 12800, 15878, 12726,
+		15854, 12656, 15831, 12589, 15808, 12525, 15786, 12464, 15764, 12408, 15743, 12352, 15722, 12299, 15701, 12210,
+		15681, 12117, 15661, 12026, 15642, 11938, 15622, 11855, 15604, 11776, 15585, 11703, 15567, 11632, 15550, 11564,
+		15532, 11500, 15515, 11438, 15498, 11379, 15482, 11323, 15466, 11270, 15450, 11173, 15435, 11078, 15419, 10987,
+		15404, 10897, 15389, 10812, 15375, 10734, 15361, 10657, 15333, 10584, 15306, 10516, 15280, 10452, 15254, 10391,
+		15227, 10330, 15202, 10273, 15176, 10197, 15152, 10092, 15127, 9990, 15103, 9896, 15080, 9808, 15057, 9723,
+		15034, 9643, 15012, 9567, 14990, 9494, 14969, 9425, 14948, 9362, 14928, 9301, 14907, 9239, 14887, 9147,
+		14868, 9044, 14848, 8939, 14829, 8844, 14811, 8750, 14792, 8663, 14774, 8584, 14757, 8504, 14739, 8430,
+		14722, 8359, 14705, 8292, 14689, 8231, 14672, 8142, 14656, 8025, 14640, 7911, 14625, 7810, 14609, 7715,
+		14594, 7620, 14579, 7535, 14565, 7457, 14551, 7378, 14536, 7300, 14523, 7231, 14509, 7163, 14496, 7039,
+		14482, 6914, 14469, 6800, 14456, 6699, 14444, 6605, 14431, 6508, 14419, 6427, 14407, 6338, 14395, 6254,
+		14383, 6181, 14372, 6087, 14361, 5953, 14349, 5821, 14338, 5708, 14319, 5611, 14298, 5511, 14277, 5412,
+		14256, 5314, 14235, 5223, 14215, 5142, 14195, 5013, 14176, 4873, 14157, 4750, 14137, 4623, 14118, 4500,
+		14100, 4392, 14082, 4293, 14064, 4221, 14047, 4146, 14030, 4044, 14013, 3875, 13995, 3719, 13979, 3609,
+		13962, 3473, 13946, 3359, 13930, 3254, 13915, 3175, 13899, 3084, 13884, 2904, 13869, 2750, 13854, 2587,
+		13839, 2438, 13824, 2339, 13810, 2210, 13796, 2111, 13782, 1990, 13768, 1820, 13754, 1633, 13741, 1490,
+		13728, 1333, 13715, 1217, 13702, 1086, 13689, 1017, 13677, 905, 13665, 874, 13653, 794, 13641, 703,
+		13629, 642, 13617, 594, 13606, 542, 13595, 491, 13584, 466, 13572, 409, 13561, 376, 13550, 329,
+		13539, 298, 13529, 302, 13519, 263, 13508, 236, 13498, 205, 13488, 181, 13478, 155, 13468, 143,
+		13458, 123, 13449, 127, 13439, 108, 13430, 112, 13421, 95, 13412, 98, 13403, 81, 13394, 67,
+		13385, 55, 13377, 54, 13368, 49, 13360, 45, 13351, 35, 13343, 31, 13335, 29, 13326, 21,
+		17132, 21196, 17218, 20814, 17300, 20608, 17377, 20465, 17428, 20260, 17460, 20097, 17489, 19961, 17515, 19843,
+		17537, 19740, 17556, 19648, 17571, 19564, 17584, 19488, 17593, 19380, 17600, 19253, 17604, 19135, 17606, 19025,
+		17605, 18923, 17604, 18829, 17600, 18742, 17595, 18661, 17588, 18584, 17580, 18514, 17571, 18448, 17561, 18341,
+		17551, 18227, 17539, 18119, 17527, 18019, 17514, 17924, 17502, 17838, 17488, 17754, 17474, 17677, 17460, 17605,
+		17446, 17537, 17431, 17474, 17417, 17413, 17396, 17306, 17367, 17201, 17337, 17101, 17307, 17007, 17277, 16919,
+		17248, 16836, 17219, 16758, 17189, 16684, 17160, 16614, 17132, 16549, 17104, 16487, 17075, 16428, 17047, 16362,
+		17020, 16257, 16993, 16160, 16965, 16066, 16939, 15978, 16913, 15894, 16887, 15816, 16862, 15741, 16836, 15670,
+		16812, 15604, 16788, 15540, 16764, 15481, 16740, 15423, 16717, 15370, 16695, 15278, 16673, 15181, 16651, 15088,
+		16629, 15002, 16608, 14919, 16587, 14841, 16567, 14766, 16547, 14695, 16527, 14627, 16508, 14564, 16489, 14503,
+		16470, 14445, 16452, 14390, 16434, 14339, 16417, 14245, 16400, 14150, 16382, 14061, 16348, 13975, 16316, 13894,
+		16284, 13816, 16253, 13744, 16222, 13675, 16192, 13608, 16163, 13545, 16134, 13485, 16105, 13428, 16078, 13373,
+		16050, 13321, 16023, 13231, 15998, 13139, 15971, 13048, 15946, 12964, 15922, 12884, 15897, 12805, 15874, 12732,
+		15850, 12662, 15827, 12594, 15805, 12532, 15783, 12470, 15761, 12412, 15739, 12357, 15719, 12304, 15698, 12221,
+		15678, 12126, 15659, 12036, 15639, 11949, 15620, 11865, 15602, 11788, 15584, 11714, 15565, 11640, 15548, 11572,
+		15530, 11505, 15513, 11445, 15497, 11387, 15480, 11329, 15464, 11277, 15448, 11188, 15433, 11088, 15418, 10996,
+		15403, 10908, 15388, 10824, 15374, 10745, 15359, 10669, 15332, 10598, 15304, 10526, 15277, 10460, 15251, 10397,
+		15225, 10336, 15200, 10279, 15175, 10214, 15151, 10111, 15127, 10017, 15103, 9921, 15080, 9831, 15057, 9745,
+		15035, 9663, 15012, 9584, 14990, 9509, 14969, 9440, 14948, 9374, 14927, 9310, 14907, 9251, 14887, 9168,
+		14867, 9062, 14848, 8961, 14830, 8868, 14811, 8772, 14792, 8682, 14774, 8600, 14757, 8520, 14739, 8443,
+		14722, 8371, 14705, 8302, 14688, 8237, 14672, 8168, 14656, 8052, 14641, 7944, 14625, 7841, 14610, 7742,
+		14595, 7648, 14580, 7558, 14565, 7472, 14551, 7390, 14537, 7321, 14523, 7246, 14509, 7182, 14496, 7065,
+		14483, 6952, 14470, 6841, 14457, 6727, 14444, 6627, 14432, 6536, 14420, 6444, 14408, 6357, 14395, 6272,
+		14384, 6201, 14373, 6129, 14361, 5987, 14350, 5872, 14339, 5750, 14321, 5635, 14299, 5528, 14278, 5438,
+		14257, 5343, 14237, 5254, 14217, 5180, 14197, 5094, 14178, 4956, 14158, 4818, 14139, 4681, 14120, 4554,
+		14102, 4441, 14084, 4346, 14066, 4256, 14048, 4166, 14031, 4053, 14013, 3885, 13996, 3729, 13980, 3610,
+		13964, 3509, 13948, 3414, 13932, 3304, 13916, 3200, 13901, 3121, 13885, 2975, 13870, 2833, 13856, 2700,
+		13841, 2542, 13826, 2416, 13812, 2313, 13798, 2205, 13784, 2088, 13770, 1937, 13756, 1773, 13743, 1621,
+		13730, 1483, 13717, 1356, 13704, 1236, 13691, 1103, 13679, 983, 13666, 896, 13654, 818, 13642, 726,
+		13630, 684, 13618, 623, 13607, 569, 13595, 517, 13584, 487, 13573, 428, 13562, 375, 13551, 355,
+		13540, 310, 13530, 284, 13520, 272, 13509, 244, 13499, 211, 13489, 227, 13479, 195, 13469, 167,
+		13459, 143, 13450, 133, 13440, 120, 13431, 99, 13422, 91, 13413, 82, 13404, 74, 13395, 66,
+		13386, 64, 13378, 58, 13369, 48, 13360, 45, 13352, 39, 13343, 30, 13335, 25, 13327, 23,
+		17087, 21111, 17167, 20747, 17244, 20553, 17315, 20365, 17381, 20171, 17425, 20018, 17453, 19890, 17477, 19779,
+		17499, 19682, 17517, 19595, 17532, 19517, 17545, 19436, 17554, 19303, 17561, 19182, 17566, 19072, 17569, 18968,
+		17570, 18872, 17568, 18783, 17566, 18700, 17561, 18622, 17556, 18550, 17549, 18483, 17541, 18408, 17532, 18290,
+		17522, 18180, 17512, 18077, 17501, 17980, 17489, 17890, 17477, 17805, 17464, 17726, 17452, 17651, 17438, 17581,
+		17425, 17515, 17411, 17453, 17387, 17383, 17359, 17273, 17331, 17170, 17303, 17075, 17274, 16982, 17246, 16897,
+		17218, 16816, 17190, 16739, 17162, 16668, 17134, 16599, 17107, 16535, 17079, 16474, 17052, 16417, 17026, 16342,
+		16999, 16239, 16973, 16143, 16946, 16051, 16921, 15965, 16895, 15882, 16870, 15804, 16846, 15732, 16821, 15662,
+		16797, 15595, 16774, 15533, 16750, 15474, 16728, 15418, 16705, 15365, 16683, 15268, 16661, 15172, 16640, 15081,
+		16619, 14996, 16598, 14913, 16578, 14835, 16558, 14762, 16538, 14691, 16519, 14625, 16500, 14562, 16482, 14501,
+		16463, 14444, 16446, 14390, 16428, 14338, 16411, 14241, 16394, 14147, 16370, 14059, 16338, 13976, 16307, 13896,
+		16275, 13819, 16244, 13745, 16214, 13675, 16184, 13609, 16155, 13547, 16126, 13487, 16098, 13430, 16071, 13375,
+		16044, 13325, 16017, 13237, 15992, 13144, 15966, 13054, 15941, 12968, 15917, 12888, 15893, 12811, 15869, 12736,
+		15846, 12668, 15823, 12601, 15801, 12536, 15779, 12476, 15758, 12418, 15736, 12362, 15716, 12310, 15695, 12232,
+		15675, 12135, 15655, 12044, 15636, 11957, 15617, 11874, 15599, 11796, 15581, 11721, 15563, 11650, 15545, 11580,
+		15528, 11516, 15512, 11454, 15495, 11395, 15479, 11338, 15463, 11283, 15447, 11197, 15432, 11103, 15416, 11010,
+		15402, 10921, 15387, 10838, 15373, 10758, 15357, 10678, 15330, 10606, 15302, 10535, 15276, 10469, 15250, 10407,
+		15224, 10346, 15199, 10291, 15174, 10230, 15149, 10125, 15125, 10025, 15102, 9931, 15079, 9841, 15056, 9758,
+		15034, 9678, 15012, 9605, 14991, 9530, 14969, 9459, 14948, 9393, 14928, 9327, 14907, 9265, 14887, 9198,
+		14868, 9088, 14849, 8986, 14829, 8886, 14811, 8791, 14793, 8702, 14775, 8618, 14757, 8538, 14740, 8466,
+		14723, 8392, 14706, 8322, 14689, 8256, 14673, 8196, 14657, 8078, 14641, 7966, 14626, 7862, 14610, 7760,
+		14595, 7669, 14581, 7581, 14566, 7495, 14552, 7414, 14538, 7342, 14524, 7271, 14510, 7199, 14496, 7097,
+		14483, 6972, 14470, 6861, 14458, 6760, 14445, 6651, 14432, 6558, 14420, 6465, 14408, 6382, 14396, 6299,
+		14384, 6217, 14373, 6151, 14362, 6036, 14350, 5899, 14339, 5776, 14321, 5660, 14300, 5562, 14279, 5463,
+		14258, 5362, 14237, 5277, 14217, 5192, 14198, 5120, 14178, 4979, 14159, 4852, 14140, 4720, 14121, 4590,
+		14103, 4500, 14086, 4407, 14068, 4304, 14050, 4210, 14033, 4122, 14015, 3973, 13998, 3824, 13982, 3685,
+		13965, 3568, 13949, 3445, 13933, 3319, 13917, 3211, 13901, 3106, 13886, 3030, 13871, 2845, 13856, 2764,
+		13842, 2600, 13827, 2450, 13812, 2327, 13798, 2212, 13785, 2155, 13771, 2036, 13757, 1861, 13744, 1693,
+		13731, 1614, 13718, 1446, 13705, 1292, 13692, 1180, 13680, 1076, 13667, 983, 13655, 897, 13643, 831,
+		13631, 736, 13620, 652, 13608, 576, 13597, 541, 13585, 495, 13574, 450, 13563, 427, 13552, 374,
+		13541, 339, 13531, 309, 13520, 279, 13510, 242, 13500, 219, 13490, 209, 13480, 191, 13470, 164,
+		13460, 147, 13451, 151, 13442, 140, 13432, 118, 13423, 100, 13414, 82, 13405, 79, 13396, 71,
+		13387, 62, 13378, 55, 13370, 48, 13361, 43, 13353, 35, 13345, 36, 13337, 30, 13328, 25,
+		17044, 21027, 17118, 20683, 17189, 20499, 17256, 20272, 17319, 20089, 17377, 19944, 17419, 19823, 17442, 19719,
+		17463, 19628, 17480, 19546, 17495, 19472, 17508, 19353, 17518, 19230, 17525, 19117, 17530, 19011, 17533, 18913,
+		17535, 18822, 17535, 18738, 17532, 18659, 17529, 18585, 17524, 18516, 17518, 18452, 17511, 18352, 17504, 18240,
+		17495, 18134, 17485, 18035, 17475, 17942, 17464, 17855, 17453, 17774, 17442, 17698, 17429, 17625, 17417, 17558,
+		17401, 17494, 17375, 17434, 17349, 17348, 17323, 17242, 17296, 17142, 17269, 17047, 17242, 16958, 17216, 16875,
+		17188, 16795, 17162, 16721, 17135, 16650, 17108, 16584, 17082, 16521, 17055, 16462, 17029, 16405, 17003, 16321,
+		16978, 16221, 16953, 16126, 16927, 16035, 16903, 15951, 16878, 15870, 16854, 15794, 16829, 15720, 16806, 15652,
+		16783, 15588, 16760, 15526, 16737, 15468, 16715, 15412, 16693, 15357, 16671, 15259, 16650, 15163, 16629, 15074,
+		16608, 14988, 16588, 14907, 16569, 14830, 16549, 14758, 16530, 14688, 16511, 14622, 16493, 14560, 16474, 14499,
+		16457, 14443, 16439, 14389, 16422, 14337, 16404, 14240, 16388, 14147, 16360, 14060, 16327, 13974, 16295, 13894,
+		16264, 13817, 16235, 13746, 16205, 13678, 16176, 13612, 16147, 13549, 16119, 13489, 16091, 13432, 16064, 13377,
+		16037, 13326, 16011, 13243, 15985, 13147, 15960, 13060, 15936, 12974, 15911, 12893, 15888, 12816, 15864, 12743,
+		15841, 12672, 15819, 12606, 15797, 12541, 15775, 12480, 15754, 12424, 15733, 12369, 15712, 12315, 15692, 12242,
+		15672, 12147, 15653, 12054, 15634, 11967, 15615, 11884, 15597, 11805, 15579, 11729, 15561, 11657, 15543, 11588,
+		15526, 11524, 15510, 11462, 15493, 11402, 15477, 11345, 15461, 11291, 15446, 11216, 15430, 11121, 15415, 11025,
+		15400, 10935, 15386, 10848, 15371, 10767, 15355, 10693, 15328, 10618, 15301, 10550, 15274, 10482, 15248, 10418,
+		15223, 10358, 15197, 10299, 15172, 10243, 15148, 10143, 15124, 10044, 15100, 9947, 15078, 9859, 15055, 9772,
+		15032, 9689, 15011, 9611, 14989, 9537, 14968, 9467, 14947, 9403, 14927, 9339, 14908, 9282, 14888, 9223,
+		14868, 9117, 14849, 9016, 14830, 8914, 14811, 8816, 14793, 8724, 14775, 8640, 14757, 8560, 14740, 8481,
+		14723, 8406, 14706, 8337, 14689, 8269, 14673, 8207, 14657, 8112, 14642, 8006, 14626, 7893, 14611, 7789,
+		14596, 7696, 14581, 7605, 14567, 7520, 14552, 7435, 14538, 7358, 14524, 7284, 14510, 7219, 14497, 7138,
+		14484, 7018, 14471, 6897, 14458, 6794, 14446, 6692, 14433, 6587, 14421, 6492, 14408, 6402, 14397, 6323,
+		14385, 6245, 14374, 6180, 14362, 6068, 14351, 5935, 14340, 5824, 14322, 5700, 14301, 5584, 14280, 5494,
+		14259, 5400, 14239, 5307, 14219, 5224, 14199, 5147, 14180, 5031, 14160, 4886, 14141, 4760, 14123, 4634,
+		14104, 4510, 14086, 4408, 14068, 4327, 14051, 4225, 14033, 4134, 14016, 4019, 13999, 3889, 13983, 3775,
+		13966, 3626, 13950, 3499, 13934, 3372, 13918, 3261, 13902, 3173, 13887, 3081, 13872, 2918, 13857, 2742,
+		13842, 2593, 13827, 2443, 13813, 2358, 13799, 2244, 13785, 2155, 13772, 2079, 13758, 1935, 13745, 1767,
+		13732, 1585, 13719, 1485, 13706, 1351, 13694, 1251, 13681, 1133, 13669, 1055, 13657, 957, 13645, 865,
+		13633, 797, 13621, 726, 13610, 661, 13598, 602, 13587, 547, 13576, 490, 13564, 431, 13553, 378,
+		13543, 372, 13533, 333, 13522, 315, 13512, 286, 13502, 248, 13492, 236, 13481, 202, 13472, 182,
+		13462, 174, 13452, 156, 13443, 140, 13434, 119, 13424, 107, 13415, 107, 13406, 94, 13397, 77,
+		13389, 72, 13380, 58, 13371, 58, 13363, 49, 13354, 42, 13346, 37, 13338, 29, 13330, 27,
+		17002, 20948, 17072, 20624, 17138, 20418, 17201, 20186, 17260, 20011, 17315, 19874, 17364, 19759, 17408, 19661,
+		17429, 19576, 17446, 19499, 17460, 19402, 17472, 19275, 17482, 19159, 17490, 19052, 17496, 18952, 17500, 18860,
+		17501, 18774, 17502, 18694, 17500, 18619, 17498, 18549, 17494, 18483, 17489, 18412, 17483, 18297, 17476, 18190,
+		17468, 18089, 17459, 17995, 17450, 17904, 17440, 17821, 17429, 17742, 17419, 17669, 17407, 17599, 17384, 17534,
+		17360, 17473, 17336, 17414, 17311, 17311, 17286, 17208, 17261, 17111, 17236, 17019, 17210, 16933, 17184, 16852,
+		17159, 16775, 17133, 16702, 17108, 16633, 17082, 16568, 17057, 16507, 17032, 16449, 17007, 16394, 16981, 16300,
+		16956, 16201, 16932, 16108, 16908, 16020, 16884, 15937, 16860, 15857, 16837, 15782, 16813, 15710, 16790, 15643,
+		16768, 15579, 16745, 15518, 16723, 15460, 16702, 15405, 16681, 15348, 16659, 15249, 16639, 15156, 16618, 15066,
+		16598, 14982, 16579, 14901, 16559, 14825, 16540, 14752, 16521, 14684, 16503, 14618, 16485, 14557, 16467, 14497,
+		16449, 14441, 16432, 14387, 16415, 14336, 16398, 14239, 16380, 14148, 16348, 14059, 16316, 13974, 16285, 13895,
+		16255, 13820, 16225, 13746, 16195, 13677, 16166, 13611, 16138, 13550, 16111, 13491, 16084, 13434, 16057, 13381,
+		16030, 13329, 16004, 13246, 15979, 13153, 15954, 13063, 15930, 12979, 15906, 12898, 15882, 12821, 15859, 12748,
+		15836, 12677, 15814, 12611, 15792, 12547, 15771, 12486, 15750, 12428, 15729, 12373, 15709, 12320, 15688, 12249,
+		15669, 12156, 15650, 12066, 15631, 11978, 15613, 11895, 15594, 11816, 15576, 11739, 15558, 11666, 15541, 11597,
+		15524, 11533, 15508, 11469, 15491, 11409, 15475, 11353, 15459, 11299, 15444, 11233, 15429, 11133, 15414, 11038,
+		15399, 10947, 15385, 10865, 15371, 10784, 15354, 10706, 15326, 10631, 15299, 10559, 15272, 10490, 15246, 10428,
+		15221, 10369, 15196, 10309, 15172, 10257, 15147, 10164, 15123, 10062, 15100, 9966, 15077, 9878, 15054, 9789,
+		15032, 9707, 15010, 9628, 14989, 9553, 14968, 9483, 14947, 9413, 14926, 9348, 14906, 9285, 14886, 9227,
+		14867, 9131, 14848, 9032, 14829, 8931, 14811, 8839, 14793, 8751, 14775, 8664, 14758, 8582, 14740, 8503,
+		14723, 8426, 14706, 8355, 14690, 8291, 14674, 8227, 14658, 8144, 14642, 8026, 14626, 7917, 14611, 7813,
+		14596, 7715, 14581, 7626, 14567, 7542, 14553, 7462, 14538, 7380, 14525, 7305, 14511, 7240, 14498, 7173,
+		14484, 7054, 14471, 6928, 14458, 6818, 14446, 6716, 14434, 6622, 14421, 6524, 14409, 6438, 14398, 6359,
+		14386, 6282, 14374, 6202, 14363, 6114, 14352, 5977, 14341, 5854, 14324, 5743, 14302, 5633, 14281, 5526,
+		14260, 5426, 14240, 5334, 14221, 5261, 14201, 5173, 14181, 5071, 14162, 4949, 14143, 4810, 14124, 4682,
+		14106, 4568, 14088, 4470, 14070, 4357, 14052, 4259, 14035, 4172, 14017, 4088, 14000, 3929, 13984, 3791,
+		13968, 3674, 13951, 3533, 13935, 3415, 13920, 3332, 13905, 3247, 13889, 3148, 13874, 3023, 13859, 2856,
+		13844, 2684, 13829, 2562, 13815, 2432, 13801, 2321, 13787, 2204, 13773, 2087, 13759, 1914, 13746, 1826,
+		13733, 1665, 13720, 1520, 13708, 1406, 13695, 1278, 13682, 1164, 13670, 1055, 13658, 982, 13646, 906,
+		13634, 821, 13622, 742, 13611, 692, 13600, 639, 13588, 581, 13577, 524, 13566, 497, 13555, 451,
+		13545, 409, 13534, 357, 13523, 312, 13513, 271, 13503, 258, 13493, 232, 13483, 220, 13473, 203,
+		13463, 184, 13454, 169, 13444, 148, 13435, 125, 13426, 124, 13417, 116, 13408, 97, 13399, 94,
+		13390, 86, 13381, 74, 13373, 64, 13364, 52, 13356, 49, 13347, 39, 13339, 33, 13331, 29,
+		16963, 20877, 17028, 20569, 17090, 20326, 17149, 20105, 17204, 19940, 17256, 19810, 17303, 19701, 17346, 19608,
+		17383, 19527, 17412, 19452, 17427, 19321, 17439, 19202, 17449, 19091, 17457, 18990, 17463, 18896, 17467, 18808,
+		17469, 18727, 17470, 18651, 17470, 18580, 17468, 18513, 17464, 18451, 17460, 18352, 17455, 18244, 17448, 18140,
+		17441, 18044, 17434, 17953, 17425, 17868, 17416, 17787, 17405, 17712, 17385, 17641, 17364, 17573, 17342, 17510,
+		17320, 17451, 17297, 17382, 17274, 17277, 17251, 17176, 17227, 17082, 17203, 16993, 17179, 16909, 17154, 16830,
+		17130, 16754, 17105, 16683, 17081, 16617, 17056, 16552, 17032, 16493, 17007, 16435, 16983, 16379, 16959, 16278,
+		16935, 16181, 16912, 16090, 16888, 16003, 16865, 15922, 16842, 15843, 16820, 15770, 16797, 15699, 16775, 15633,
+		16753, 15570, 16731, 15510, 16710, 15454, 16689, 15400, 16668, 15335, 16648, 15239, 16627, 15147, 16607, 15058,
+		16588, 14975, 16568, 14895, 16549, 14820, 16531, 14747, 16512, 14680, 16494, 14614, 16476, 14552, 16459, 14494,
+		16442, 14438, 16425, 14385, 16408, 14332, 16392, 14236, 16368, 14145, 16336, 14057, 16305, 13974, 16275, 13897,
+		16245, 13820, 16215, 13747, 16186, 13679, 16158, 13614, 16130, 13551, 16102, 13491, 16075, 13434, 16048, 13380,
+		16023, 13330, 15998, 13252, 15973, 13159, 15948, 13069, 15924, 12984, 15900, 12903, 15877, 12825, 15854, 12752,
+		15832, 12682, 15810, 12616, 15788, 12551, 15767, 12491, 15746, 12433, 15725, 12378, 15705, 12325, 15685, 12260,
+		15666, 12164, 15647, 12074, 15628, 11986, 15609, 11901, 15592, 11824, 15574, 11749, 15556, 11676, 15539, 11608,
+		15523, 11543, 15506, 11479, 15490, 11419, 15474, 11361, 15458, 11307, 15442, 11246, 15427, 11146, 15412, 11051,
+		15398, 10962, 15384, 10878, 15370, 10796, 15351, 10718, 15324, 10641, 15297, 10573, 15271, 10506, 15246, 10443,
+		15220, 10380, 15195, 10322, 15170, 10264, 15146, 10182, 15122, 10080, 15099, 9986, 15076, 9895, 15054, 9809,
+		15031, 9723, 15009, 9641, 14988, 9568, 14967, 9497, 14946, 9428, 14926, 9365, 14906, 9303, 14887, 9245,
+		14867, 9161, 14848, 9054, 14829, 8950, 14810, 8850, 14792, 8758, 14774, 8671, 14757, 8592, 14740, 8517,
+		14723, 8447, 14707, 8380, 14691, 8312, 14674, 8248, 14658, 8177, 14642, 8059, 14627, 7947, 14612, 7848,
+		14597, 7748, 14582, 7657, 14567, 7567, 14553, 7484, 14539, 7403, 14525, 7326, 14511, 7254, 14498, 7193,
+		14485, 7092, 14472, 6973, 14459, 6855, 14447, 6753, 14434, 6650, 14422, 6554, 14410, 6460, 14398, 6372,
+		14386, 6295, 14375, 6221, 14364, 6152, 14352, 6026, 14342, 5907, 14326, 5792, 14305, 5683, 14284, 5571,
+		14263, 5467, 14242, 5374, 14222, 5292, 14202, 5206, 14183, 5134, 14164, 4997, 14144, 4848, 14125, 4717,
+		14107, 4607, 14089, 4498, 14072, 4414, 14054, 4311, 14037, 4222, 14019, 4134, 14003, 4031, 13986, 3864,
+		13969, 3729, 13953, 3595, 13937, 3460, 13921, 3365, 13906, 3258, 13891, 3175, 13875, 3081, 13861, 2934,
+		13846, 2775, 13832, 2675, 13818, 2562, 13803, 2415, 13789, 2295, 13775, 2171, 13762, 2086, 13749, 1938,
+		13735, 1768, 13722, 1586, 13709, 1420, 13696, 1270, 13684, 1242, 13672, 1125, 13659, 1034, 13647, 958,
+		13636, 869, 13624, 790, 13612, 737, 13601, 665, 13590, 603, 13578, 545, 13567, 494, 13557, 447,
+		13546, 416, 13535, 382, 13525, 367, 13515, 332, 13505, 307, 13495, 267, 13484, 230, 13474, 198,
+		13465, 188, 13455, 177, 13446, 165, 13436, 140, 13427, 126, 13418, 110, 13409, 98, 13400, 94,
+		13391, 84, 13383, 77, 13374, 68, 13365, 57, 13357, 50, 13349, 42, 13340, 37, 13332, 30,
+		16925, 20809, 16985, 20516, 17044, 20238, 17100, 20031, 17151, 19871, 17200, 19749, 17244, 19645, 17285, 19557,
+		17322, 19480, 17354, 19367, 17382, 19243, 17405, 19130, 17417, 19026, 17425, 18930, 17431, 18841, 17435, 18759,
+		17438, 18682, 17439, 18609, 17440, 18542, 17438, 18479, 17436, 18407, 17432, 18296, 17427, 18190, 17422, 18092,
+		17416, 18000, 17409, 17914, 17394, 17832, 17377, 17754, 17359, 17681, 17341, 17613, 17322, 17548, 17301, 17487,
+		17280, 17429, 17259, 17343, 17237, 17240, 17215, 17144, 17193, 17052, 17170, 16965, 17147, 16883, 17123, 16806,
+		17100, 16733, 17077, 16665, 17053, 16598, 17030, 16536, 17007, 16479, 16983, 16422, 16960, 16355, 16937, 16256,
+		16914, 16161, 16891, 16072, 16869, 15986, 16846, 15906, 16824, 15829, 16802, 15757, 16780, 15688, 16759, 15623,
+		16738, 15561, 16717, 15502, 16696, 15446, 16675, 15392, 16655, 15325, 16635, 15227, 16615, 15136, 16596, 15050,
+		16577, 14966, 16558, 14889, 16540, 14814, 16522, 14744, 16503, 14675, 16486, 14611, 16468, 14549, 16451, 14492,
+		16434, 14435, 16417, 14383, 16401, 14329, 16385, 14233, 16355, 14143, 16323, 14055, 16293, 13973, 16263, 13894,
+		16234, 13819, 16205, 13747, 16177, 13681, 16149, 13616, 16121, 13552, 16094, 13494, 16068, 13437, 16042, 13384,
+		16016, 13332, 15990, 13253, 15965, 13159, 15941, 13072, 15918, 12988, 15894, 12908, 15872, 12832, 15849, 12757,
+		15826, 12687, 15805, 12621, 15783, 12556, 15762, 12496, 15742, 12439, 15721, 12382, 15701, 12330, 15681, 12270,
+		15662, 12175, 15644, 12084, 15625, 11996, 15607, 11912, 15589, 11832, 15571, 11757, 15554, 11684, 15536, 11613,
+		15520, 11550, 15504, 11487, 15487, 11426, 15472, 11371, 15456, 11317, 15441, 11262, 15426, 11165, 15411, 11068,
+		15397, 10979, 15382, 10891, 15368, 10809, 15349, 10729, 15322, 10657, 15296, 10586, 15269, 10517, 15244, 10453,
+		15218, 10391, 15193, 10330, 15169, 10276, 15146, 10209, 15122, 10107, 15099, 10009, 15076, 9915, 15053, 9823,
+		15031, 9741, 15009, 9661, 14988, 9584, 14967, 9515, 14946, 9446, 14926, 9379, 14906, 9314, 14886, 9256,
+		14867, 9183, 14848, 9077, 14829, 8976, 14811, 8880, 14793, 8788, 14775, 8699, 14757, 8616, 14740, 8536,
+		14723, 8457, 14706, 8385, 14689, 8317, 14673, 8255, 14657, 8192, 14642, 8081, 14627, 7986, 14612, 7882,
+		14597, 7786, 14582, 7687, 14568, 7595, 14554, 7508, 14540, 7432, 14526, 7353, 14512, 7281, 14499, 7212,
+		14486, 7131, 14473, 7007, 14460, 6892, 14447, 6782, 14435, 6684, 14423, 6588, 14411, 6490, 14399, 6410,
+		14388, 6330, 14376, 6250, 14365, 6181, 14353, 6075, 14342, 5944, 14327, 5817, 14306, 5708, 14285, 5600,
+		14264, 5499, 14244, 5411, 14224, 5326, 14204, 5245, 14185, 5162, 14165, 5048, 14146, 4911, 14128, 4789,
+		14109, 4666, 14092, 4567, 14074, 4454, 14055, 4343, 14038, 4246, 14020, 4149, 14004, 4068, 13987, 3922,
+		13971, 3784, 13955, 3649, 13939, 3541, 13924, 3455, 13908, 3331, 13892, 3217, 13877, 3130, 13862, 3004,
+		13848, 2839, 13833, 2717, 13819, 2589, 13805, 2441, 13791, 2333, 13777, 2247, 13764, 2163, 13751, 2087,
+		13737, 1914, 13724, 1764, 13711, 1609, 13699, 1490, 13686, 1357, 13674, 1213, 13661, 1082, 13649, 964,
+		13637, 878, 13626, 833, 13614, 757, 13603, 683, 13592, 644, 13580, 598, 13569, 543, 13558, 489,
+		13548, 460, 13537, 403, 13527, 375, 13516, 338, 13506, 305, 13496, 282, 13486, 262, 13476, 234,
+		13466, 215, 13457, 194, 13447, 166, 13438, 155, 13428, 138, 13420, 133, 13410, 111, 13401, 96,
+		13392, 82, 13383, 71, 13375, 64, 13366, 57, 13358, 54, 13350, 43, 13342, 39, 13333, 32,
+		16888, 20744, 16945, 20456, 17000, 20156, 17052, 19956, 17101, 19808, 17147, 19690, 17189, 19593, 17228, 19509,
+		17263, 19417, 17294, 19287, 17321, 19170, 17344, 19062, 17364, 18965, 17380, 18873, 17392, 18789, 17402, 18711,
+		17409, 18639, 17410, 18570, 17411, 18506, 17410, 18446, 17408, 18346, 17402, 18240, 17394, 18140, 17385, 18046,
+		17373, 17957, 17360, 17874, 17347, 17796, 17332, 17721, 17315, 17651, 17298, 17585, 17280, 17522, 17262, 17464,
+		17242, 17409, 17222, 17304, 17201, 17205, 17180, 17110, 17159, 17023, 17138, 16938, 17116, 16859, 17093, 16783,
+		17072, 16713, 17049, 16645, 17027, 16581, 17004, 16520, 16982, 16463, 16959, 16409, 16938, 16332, 16915, 16233,
+		16893, 16141, 16871, 16053, 16849, 15969, 16828, 15891, 16806, 15815, 16785, 15744, 16764, 15676, 16743, 15612,
+		16722, 15550, 16702, 15493, 16682, 15438, 16662, 15385, 16642, 15312, 16623, 15216, 16604, 15126, 16585, 15041,
+		16566, 14959, 16548, 14881, 16530, 14808, 16512, 14738, 16494, 14670, 16477, 14607, 16460, 14546, 16443, 14488,
+		16426, 14433, 16410, 14381, 16394, 14326, 16373, 14230, 16342, 14139, 16311, 14053, 16281, 13971, 16252, 13894,
+		16223, 13818, 16195, 13748, 16167, 13680, 16139, 13615, 16112, 13553, 16085, 13495, 16060, 13440, 16034, 13385,
+		16008, 13334, 15983, 13259, 15960, 13168, 15935, 13077, 15911, 12992, 15888, 12911, 15865, 12834, 15843, 12762,
+		15821, 12693, 15800, 12626, 15778, 12562, 15758, 12501, 15737, 12443, 15717, 12387, 15697, 12334, 15678, 12281,
+		15659, 12185, 15640, 12094, 15622, 12006, 15603, 11921, 15586, 11842, 15569, 11768, 15551, 11694, 15534, 11625,
+		15518, 11558, 15502, 11495, 15485, 11435, 15469, 11375, 15454, 11323, 15439, 11271, 15424, 11177, 15410, 11082,
+		15395, 10994, 15381, 10905, 15367, 10823, 15347, 10743, 15320, 10671, 15294, 10598, 15268, 10530, 15242, 10463,
+		15216, 10400, 15192, 10344, 15168, 10287, 15144, 10224, 15120, 10123, 15097, 10022, 15074, 9932, 15052, 9843,
+		15031, 9763, 15009, 9682, 14988, 9606, 14966, 9530, 14946, 9459, 14925, 9393, 14906, 9332, 14886, 9270,
+		14867, 9216, 14848, 9105, 14829, 8999, 14810, 8901, 14792, 8810, 14775, 8719, 14757, 8636, 14740, 8557,
+		14723, 8483, 14707, 8410, 14690, 8341, 14674, 8275, 14658, 8212, 14642, 8108, 14627, 7995, 14612, 7891,
+		14597, 7796, 14582, 7699, 14568, 7609, 14554, 7526, 14541, 7458, 14527, 7382, 14513, 7309, 14500, 7234,
+		14486, 7164, 14474, 7056, 14461, 6934, 14448, 6821, 14436, 6717, 14424, 6619, 14411, 6521, 14400, 6437,
+		14388, 6349, 14377, 6280, 14365, 6202, 14354, 6123, 14343, 5993, 14329, 5877, 14308, 5762, 14287, 5656,
+		14266, 5547, 14246, 5449, 14226, 5353, 14206, 5271, 14186, 5191, 14167, 5095, 14148, 4969, 14130, 4850,
+		14111, 4717, 14093, 4600, 14075, 4488, 14058, 4397, 14040, 4302, 14023, 4208, 14007, 4142, 13990, 4021,
+		13973, 3855, 13957, 3712, 13941, 3570, 13925, 3457, 13910, 3370, 13894, 3266, 13879, 3165, 13864, 3082,
+		13850, 2981, 13835, 2801, 13820, 2635, 13807, 2522, 13793, 2405, 13779, 2287, 13765, 2189, 13752, 2110,
+		13739, 1953, 13726, 1781, 13713, 1691, 13701, 1568, 13688, 1447, 13676, 1313, 13664, 1193, 13652, 1132,
+		13640, 1029, 13628, 934, 13616, 830, 13604, 737, 13593, 666, 13582, 632, 13570, 571, 13559, 502,
+		13548, 441, 13538, 418, 13528, 397, 13518, 376, 13507, 327, 13497, 294, 13487, 261, 13477, 241,
+		13467, 215, 13458, 204, 13449, 194, 13439, 171, 13430, 144, 13420, 121, 13412, 120, 13403, 108,
+		13394, 102, 13385, 86, 13377, 73, 13368, 61, 13359, 53, 13351, 48, 13343, 39, 13335, 35,
+		16854, 20685, 16907, 20364, 16958, 20079, 17007, 19889, 17054, 19749, 17097, 19636, 17137, 19543, 17174, 19464,
+		17207, 19334, 17236, 19209, 17263, 19099, 17286, 18998, 17305, 18905, 17321, 18819, 17334, 18740, 17344, 18665,
+		17352, 18597, 17355, 18531, 17358, 18470, 17357, 18395, 17354, 18286, 17350, 18185, 17343, 18090, 17334, 17999,
+		17324, 17915, 17313, 17835, 17300, 17760, 17287, 17688, 17272, 17622, 17256, 17558, 17239, 17498, 17222, 17441,
+		17204, 17367, 17185, 17265, 17166, 17169, 17146, 17078, 17126, 16992, 17105, 16910, 17085, 16834, 17064, 16760,
+		17042, 16691, 17021, 16625, 17000, 16563, 16979, 16505, 16958, 16449, 16936, 16396, 16914, 16306, 16893, 16211,
+		16872, 16121, 16850, 16033, 16830, 15953, 16809, 15875, 16788, 15801, 16768, 15731, 16747, 15665, 16727, 15602,
+		16707, 15541, 16687, 15484, 16668, 15430, 16648, 15378, 16629, 15299, 16610, 15205, 16592, 15116, 16573, 15031,
+		16555, 14950, 16537, 14875, 16520, 14801, 16502, 14731, 16485, 14665, 16468, 14602, 16451, 14542, 16435, 14485,
+		16419, 14431, 16403, 14378, 16387, 14323, 16359, 14226, 16329, 14138, 16299, 14052, 16269, 13969, 16240, 13892,
+		16212, 13817, 16184, 13747, 16156, 13680, 16129, 13615, 16103, 13554, 16077, 13496, 16051, 13439, 16025, 13385,
+		16000, 13335, 15976, 13264, 15952, 13170, 15928, 13081, 15905, 12998, 15882, 12918, 15860, 12840, 15838, 12767,
+		15816, 12696, 15794, 12628, 15773, 12565, 15753, 12506, 15733, 12448, 15713, 12394, 15694, 12340, 15674, 12289,
+		15655, 12195, 15637, 12102, 15618, 12013, 15600, 11931, 15583, 11851, 15566, 11775, 15549, 11702, 15532, 11631,
+		15515, 11567, 15500, 11505, 15483, 11443, 15468, 11386, 15452, 11330, 15437, 11279, 15423, 11192, 15408, 11094,
+		15394, 11005, 15379, 10918, 15366, 10836, 15344, 10757, 15318, 10684, 15291, 10610, 15265, 10541, 15240, 10475,
+		15215, 10414, 15191, 10355, 15166, 10297, 15142, 10243, 15119, 10140, 15096, 10042, 15073, 9952, 15051, 9861,
+		15029, 9779, 15007, 9695, 14986, 9615, 14965, 9546, 14945, 9477, 14925, 9410, 14905, 9348, 14886, 9287,
+		14866, 9227, 14847, 9130, 14829, 9027, 14811, 8928, 14793, 8836, 14775, 8747, 14757, 8659, 14740, 8573,
+		14723, 8499, 14707, 8428, 14691, 8360, 14674, 8294, 14659, 8231, 14643, 8154, 14628, 8037, 14613, 7931,
+		14598, 7830, 14583, 7730, 14568, 7633, 14554, 7546, 14540, 7468, 14527, 7393, 14513, 7318, 14499, 7246,
+		14487, 7185, 14474, 7079, 14462, 6978, 14449, 6862, 14437, 6752, 14424, 6649, 14413, 6563, 14401, 6471,
+		14389, 6389, 14377, 6305, 14366, 6232, 14355, 6158, 14344, 6031, 14330, 5899, 14310, 5804, 14289, 5689,
+		14268, 5578, 14247, 5482, 14228, 5396, 14207, 5299, 14189, 5230, 14169, 5151, 14150, 5029, 14131, 4891,
+		14113, 4775, 14095, 4648, 14077, 4529, 14060, 4444, 14042, 4351, 14025, 4249, 14008, 4164, 13991, 4050,
+		13975, 3920, 13959, 3782, 13943, 3668, 13927, 3557, 13911, 3435, 13896, 3320, 13881, 3216, 13865, 3111,
+		13851, 2997, 13837, 2862, 13822, 2716, 13808, 2586, 13794, 2467, 13781, 2369, 13767, 2239, 13753, 2119,
+		13740, 2038, 13727, 1871, 13714, 1702, 13701, 1565, 13689, 1441, 13677, 1357, 13665, 1259, 13653, 1178,
+		13641, 1051, 13629, 982, 13617, 888, 13606, 837, 13595, 757, 13584, 685, 13573, 615, 13562, 550,
+		13551, 497, 13540, 473, 13529, 426, 13519, 377, 13509, 329, 13499, 314, 13489, 306, 13479, 274,
+		13469, 235, 13460, 215, 13450, 197, 13441, 180, 13432, 158, 13423, 150, 13413, 131, 13404, 112,
+		13395, 100, 13387, 90, 13379, 90, 13370, 75, 13362, 67, 13353, 57, 13344, 42, 13336, 37,
+		16820, 20630, 16870, 20278, 16918, 20007, 16964, 19826, 17008, 19692, 17049, 19585, 17087, 19497, 17122, 19386,
+		17153, 19254, 17182, 19137, 17208, 19032, 17230, 18937, 17248, 18847, 17265, 18768, 17278, 18692, 17288, 18621,
+		17296, 18555, 17301, 18494, 17303, 18436, 17304, 18330, 17302, 18228, 17298, 18131, 17293, 18040, 17286, 17955,
+		17277, 17874, 17267, 17797, 17255, 17724, 17243, 17656, 17229, 17591, 17214, 17530, 17199, 17473, 17183, 17418,
+		17166, 17325, 17148, 17226, 17131, 17134, 17112, 17045, 17093, 16962, 17074, 16883, 17054, 16808, 17034, 16738,
+		17014, 16670, 16994, 16606, 16974, 16546, 16953, 16488, 16933, 16434, 16912, 16380, 16892, 16282, 16871, 16188,
+		16851, 16098, 16831, 16015, 16810, 15935, 16790, 15859, 16770, 15787, 16750, 15718, 16731, 15652, 16711, 15590,
+		16692, 15531, 16672, 15475, 16653, 15421, 16635, 15371, 16616, 15284, 16598, 15193, 16580, 15105, 16562, 15022,
+		16544, 14942, 16527, 14867, 16509, 14794, 16492, 14724, 16475, 14660, 16459, 14597, 16443, 14537, 16427, 14481,
+		16411, 14428, 16395, 14376, 16376, 14318, 16346, 14224, 16315, 14134, 16286, 14050, 16257, 13967, 16229, 13892,
+		16201, 13818, 16173, 13746, 16146, 13680, 16119, 13615, 16093, 13555, 16068, 13496, 16042, 13440, 16017, 13388,
+		15992, 13337, 15968, 13265, 15944, 13172, 15921, 13084, 15898, 13001, 15876, 12922, 15854, 12845, 15832, 12772,
+		15811, 12702, 15790, 12637, 15769, 12572, 15748, 12509, 15728, 12452, 15708, 12396, 15689, 12344, 15670, 12295,
+		15652, 12204, 15633, 12113, 15615, 12026, 15597, 11941, 15580, 11862, 15563, 11784, 15546, 11711, 15529, 11643,
+		15513, 11575, 15497, 11511, 15481, 11451, 15465, 11392, 15451, 11339, 15436, 11286, 15421, 11209, 15407, 11114,
+		15392, 11021, 15378, 10935, 15365, 10852, 15341, 10769, 15315, 10695, 15289, 10621, 15263, 10553, 15238, 10487,
+		15213, 10426, 15189, 10366, 15164, 10307, 15141, 10254, 15117, 10163, 15095, 10069, 15072, 9970, 15050, 9881,
+		15028, 9793, 15006, 9712, 14985, 9636, 14965, 9562, 14945, 9493, 14924, 9424, 14904, 9357, 14885, 9297,
+		14866, 9242, 14847, 9161, 14829, 9056, 14811, 8956, 14793, 8860, 14775, 8769, 14758, 8683, 14740, 8599,
+		14724, 8524, 14707, 8451, 14691, 8380, 14675, 8312, 14659, 8246, 14643, 8176, 14628, 8068, 14613, 7965,
+		14599, 7864, 14584, 7765, 14569, 7672, 14555, 7587, 14541, 7502, 14528, 7422, 14514, 7343, 14500, 7270,
+		14487, 7200, 14474, 7108, 14462, 6994, 14449, 6885, 14437, 6772, 14425, 6674, 14413, 6580, 14401, 6503,
+		14390, 6411, 14378, 6330, 14367, 6251, 14356, 6188, 14345, 6091, 14332, 5965, 14311, 5843, 14290, 5731,
+		14269, 5622, 14248, 5509, 14228, 5417, 14209, 5337, 14189, 5248, 14170, 5170, 14151, 5080, 14133, 4945,
+		14114, 4816, 14096, 4706, 14079, 4588, 14061, 4479, 14043, 4372, 14027, 4295, 14009, 4198, 13992, 4105,
+		13976, 3993, 13960, 3858, 13944, 3713, 13928, 3579, 13913, 3469, 13898, 3363, 13882, 3255, 13868, 3184,
+		13853, 3104, 13839, 2970, 13824, 2790, 13810, 2652, 13796, 2513, 13782, 2397, 13768, 2301, 13755, 2188,
+		13742, 2109, 13729, 2001, 13716, 1821, 13703, 1662, 13690, 1512, 13678, 1393, 13666, 1275, 13654, 1171,
+		13642, 1062, 13630, 978, 13619, 887, 13607, 852, 13596, 791, 13585, 723, 13574, 663, 13564, 623,
+		13553, 573, 13542, 515, 13531, 452, 13521, 403, 13511, 373, 13501, 343, 13491, 312, 13480, 269,
+		13471, 240, 13461, 228, 13452, 221, 13442, 188, 13433, 165, 13424, 149, 13415, 139, 13406, 127,
+		13397, 117, 13388, 96, 13380, 84, 13371, 72, 13362, 62, 13354, 57, 13346, 46, 13338, 40,
+		16788, 20576, 16835, 20196, 16880, 19939, 16923, 19766, 16964, 19638, 17002, 19535, 17039, 19448, 17073, 19306,
+		17103, 19180, 17130, 19069, 17155, 18969, 17177, 18878, 17195, 18793, 17211, 18717, 17224, 18645, 17235, 18579,
+		17243, 18516, 17248, 18457, 17252, 18374, 17252, 18268, 17251, 18171, 17249, 18079, 17245, 17993, 17238, 17910,
+		17230, 17832, 17222, 17760, 17211, 17690, 17200, 17624, 17187, 17562, 17174, 17503, 17160, 17448, 17145, 17382,
+		17129, 17283, 17112, 17187, 17096, 17098, 17078, 17013, 17060, 16932, 17042, 16856, 17024, 16783, 17005, 16714,
+		16986, 16648, 16967, 16587, 16947, 16527, 16928, 16471, 16908, 16418, 16889, 16352, 16869, 16256, 16850, 16166,
+		16830, 16078, 16810, 15996, 16790, 15916, 16772, 15844, 16752, 15772, 16733, 15704, 16714, 15641, 16695, 15579,
+		16676, 15521, 16657, 15465, 16639, 15413, 16621, 15363, 16603, 15271, 16585, 15180, 16567, 15093, 16550, 15011,
+		16533, 14932, 16516, 14858, 16499, 14786, 16482, 14719, 16466, 14654, 16450, 14592, 16434, 14534, 16418, 14477,
+		16403, 14424, 16387, 14373, 16361, 14312, 16331, 14221, 16302, 14131, 16273, 14048, 16245, 13966, 16217, 13890,
+		16189, 13816, 16162, 13746, 16136, 13681, 16110, 13616, 16083, 13555, 16058, 13498, 16033, 13441, 16008, 13389,
+		15985, 13339, 15960, 13267, 15937, 13175, 15914, 13088, 15892, 13005, 15869, 12924, 15847, 12847, 15826, 12776,
+		15805, 12705, 15784, 12639, 15764, 12576, 15743, 12515, 15724, 12459, 15704, 12403, 15685, 12349, 15666, 12297,
+		15647, 12212, 15629, 12119, 15612, 12033, 15594, 11950, 15577, 11871, 15560, 11795, 15543, 11720, 15527, 11651,
+		15511, 11584, 15495, 11520, 15479, 11460, 15464, 11403, 15448, 11347, 15434, 11293, 15419, 11224, 15405, 11126,
+		15390, 11035, 15376, 10947, 15363, 10865, 15339, 10787, 15313, 10709, 15287, 10636, 15261, 10567, 15236, 10500,
+		15211, 10437, 15186, 10376, 15162, 10319, 15139, 10263, 15116, 10184, 15093, 10089, 15071, 9989, 15048, 9899,
+		15027, 9811, 15006, 9735, 14985, 9656, 14964, 9579, 14943, 9507, 14923, 9437, 14904, 9374, 14885, 9315,
+		14865, 9255, 14847, 9185, 14828, 9075, 14810, 8969, 14792, 8880, 14775, 8792, 14758, 8704, 14741, 8624,
+		14724, 8544, 14707, 8468, 14691, 8399, 14675, 8331, 14660, 8268, 14644, 8209, 14629, 8111, 14613, 7995,
+		14599, 7890, 14584, 7791, 14570, 7694, 14555, 7604, 14542, 7525, 14528, 7447, 14515, 7372, 14501, 7303,
+		14488, 7235, 14476, 7171, 14463, 7047, 14450, 6924, 14437, 6812, 14425, 6703, 14413, 6610, 14401, 6521,
+		14390, 6433, 14378, 6348, 14367, 6276, 14356, 6200, 14345, 6141, 14333, 6005, 14311, 5870, 14291, 5767,
+		14271, 5666, 14250, 5556, 14230, 5464, 14210, 5370, 14191, 5291, 14172, 5209, 14153, 5127, 14135, 5011,
+		14116, 4868, 14097, 4738, 14079, 4613, 14062, 4514, 14044, 4413, 14027, 4316, 14011, 4235, 13994, 4148,
+		13978, 4039, 13961, 3892, 13946, 3778, 13930, 3642, 13914, 3522, 13899, 3429, 13884, 3322, 13869, 3214,
+		13854, 3123, 13840, 3023, 13825, 2854, 13811, 2712, 13797, 2594, 13784, 2482, 13770, 2361, 13757, 2251,
+		13744, 2152, 13731, 2061, 13717, 1888, 13705, 1756, 13693, 1646, 13680, 1512, 13668, 1391, 13656, 1243,
+		13644, 1142, 13632, 1051, 13620, 951, 13609, 860, 13597, 762, 13586, 702, 13575, 654, 13564, 601,
+		13553, 550, 13543, 517, 13533, 475, 13523, 450, 13513, 426, 13502, 370, 13492, 325, 13483, 303,
+		13473, 283, 13463, 251, 13453, 214, 13444, 183, 13435, 188, 13426, 168, 13417, 150, 13407, 123,
+		13398, 109, 13389, 97, 13381, 91, 13372, 77, 13364, 62, 13356, 57, 13347, 47, 13339, 42,
+		16757, 20525, 16802, 20122, 16844, 19875, 16885, 19710, 16922, 19586, 16959, 19490, 16994, 19365, 17026, 19228,
+		17054, 19109, 17081, 19003, 17105, 18909, 17125, 18822, 17144, 18742, 17159, 18668, 17172, 18601, 17183, 18537,
+		17191, 18478, 17197, 18412, 17201, 18308, 17203, 18209, 17203, 18117, 17201, 18029, 17197, 17946, 17192, 17867,
+		17186, 17793, 17177, 17722, 17169, 17657, 17158, 17593, 17147, 17533, 17134, 17477, 17121, 17423, 17107, 17337,
+		17092, 17240, 17077, 17149, 17061, 17062, 17045, 16980, 17028, 16902, 17011, 16828, 16994, 16758, 16976, 16690,
+		16958, 16627, 16939, 16567, 16921, 16510, 16903, 16455, 16884, 16403, 16865, 16324, 16846, 16230, 16827, 16140,
+		16809, 16057, 16790, 15976, 16771, 15899, 16753, 15826, 16734, 15756, 16716, 15692, 16697, 15628, 16679, 15567,
+		16661, 15511, 16643, 15456, 16625, 15404, 16607, 15350, 16590, 15257, 16572, 15167, 16555, 15082, 16538, 15001,
+		16521, 14923, 16505, 14848, 16488, 14779, 16472, 14712, 16456, 14647, 16441, 14587, 16425, 14528, 16410, 14473,
+		16394, 14420, 16375, 14370, 16346, 14306, 16316, 14214, 16288, 14127, 16260, 14043, 16232, 13964, 16204, 13886,
+		16178, 13816, 16151, 13746, 16125, 13680, 16099, 13616, 16073, 13554, 16049, 13499, 16024, 13443, 16000, 13389,
+		15976, 13340, 15953, 13270, 15930, 13180, 15907, 13093, 15885, 13008, 15862, 12927, 15841, 12852, 15820, 12780,
+		15799, 12709, 15778, 12643, 15758, 12580, 15738, 12520, 15719, 12461, 15699, 12406, 15681, 12354, 15662, 12304,
+		15644, 12226, 15626, 12132, 15608, 12042, 15590, 11958, 15573, 11877, 15556, 11801, 15540, 11729, 15524, 11659,
+		15508, 11593, 15492, 11530, 15476, 11468, 15461, 11411, 15446, 11354, 15431, 11301, 15417, 11238, 15403, 11142,
+		15389, 11050, 15375, 10961, 15361, 10876, 15335, 10796, 15310, 10721, 15283, 10647, 15258, 10577, 15233, 10513,
+		15209, 10449, 15184, 10388, 15161, 10331, 15137, 10274, 15114, 10206, 15092, 10108, 15069, 10010, 15047, 9919,
+		15026, 9831, 15005, 9754, 14984, 9671, 14963, 9596, 14943, 9523, 14923, 9456, 14904, 9393, 14884, 9331,
+		14865, 9271, 14846, 9207, 14828, 9101, 14810, 9003, 14792, 8907, 14775, 8816, 14757, 8725, 14740, 8636,
+		14723, 8558, 14707, 8485, 14691, 8414, 14675, 8348, 14659, 8285, 14644, 8222, 14629, 8135, 14614, 8026,
+		14599, 7918, 14584, 7822, 14570, 7732, 14556, 7643, 14542, 7552, 14528, 7469, 14515, 7392, 14501, 7316,
+		14489, 7250, 14476, 7189, 14463, 7087, 14451, 6973, 14439, 6862, 14427, 6762, 14415, 6663, 14403, 6565,
+		14391, 6471, 14379, 6384, 14368, 6305, 14357, 6232, 14346, 6160, 14335, 6046, 14313, 5917, 14293, 5807,
+		14272, 5697, 14252, 5599, 14232, 5493, 14212, 5397, 14193, 5317, 14174, 5242, 14155, 5168, 14136, 5066,
+		14118, 4919, 14100, 4805, 14082, 4681, 14064, 4558, 14047, 4468, 14030, 4361, 14013, 4274, 13996, 4191,
+		13980, 4104, 13963, 3957, 13947, 3832, 13932, 3696, 13916, 3580, 13901, 3455, 13886, 3361, 13871, 3265,
+		13856, 3162, 13842, 3091, 13828, 2962, 13814, 2808, 13800, 2662, 13786, 2533, 13772, 2426, 13759, 2303,
+		13746, 2227, 13733, 2131, 13720, 2032, 13707, 1824, 13694, 1674, 13682, 1555, 13670, 1424, 13658, 1322,
+		13646, 1232, 13634, 1163, 13622, 1050, 13611, 941, 13599, 850, 13588, 792, 13577, 714, 13566, 642,
+		13555, 565, 13545, 519, 13534, 497, 13524, 434, 13514, 402, 13503, 357, 13494, 351, 13484, 332,
+		13474, 298, 13464, 255, 13455, 232, 13446, 214, 13436, 190, 13427, 165, 13418, 149, 13409, 144,
+		13400, 122, 13391, 106, 13383, 96, 13374, 86, 13366, 77, 13357, 62, 13349, 56, 13341, 45,
+		16728, 20479, 16770, 20052, 16809, 19815, 16847, 19657, 16885, 19542, 16918, 19438, 16951, 19286, 16981, 19155,
+		17008, 19041, 17033, 18940, 17056, 18851, 17077, 18769, 17094, 18693, 17109, 18622, 17123, 18558, 17133, 18498,
+		17142, 18442, 17148, 18345, 17152, 18245, 17155, 18151, 17156, 18063, 17155, 17979, 17152, 17900, 17147, 17824,
+		17142, 17754, 17134, 17686, 17127, 17624, 17117, 17563, 17106, 17505, 17095, 17451, 17083, 17391, 17070, 17293,
+		17057, 17200, 17043, 17111, 17028, 17028, 17013, 16949, 16997, 16873, 16981, 16801, 16964, 16733, 16947, 16667,
+		16930, 16606, 16913, 16547, 16895, 16491, 16877, 16438, 16860, 16388, 16842, 16296, 16824, 16204, 16806, 16117,
+		16788, 16035, 16770, 15955, 16752, 15880, 16734, 15810, 16716, 15741, 16698, 15677, 16680, 15613, 16663, 15557,
+		16645, 15500, 16628, 15446, 16610, 15395, 16593, 15334, 16576, 15242, 16560, 15154, 16543, 15069, 16526, 14989,
+		16510, 14913, 16494, 14840, 16478, 14771, 16462, 14704, 16447, 14641, 16431, 14581, 16416, 14523, 16401, 14469,
+		16386, 14416, 16359, 14367, 16330, 14300, 16302, 14210, 16274, 14122, 16246, 14039, 16219, 13960, 16192, 13885,
+		16166, 13813, 16140, 13745, 16114, 13677, 16089, 13615, 16064, 13555, 16039, 13498, 16015, 13443, 15991, 13390,
+		15968, 13341, 15945, 13275, 15922, 13182, 15900, 13096, 15878, 13012, 15856, 12932, 15835, 12857, 15814, 12783,
+		15793, 12713, 15773, 12648, 15753, 12584, 15733, 12523, 15714, 12466, 15695, 12411, 15676, 12359, 15658, 12308,
+		15639, 12230, 15622, 12140, 15604, 12052, 15587, 11970, 15570, 11889, 15553, 11811, 15537, 11736, 15521, 11666,
+		15505, 11599, 15489, 11537, 15474, 11476, 15459, 11419, 15444, 11363, 15429, 11309, 15415, 11254, 15401, 11157,
+		15387, 11064, 15373, 10974, 15359, 10891, 15333, 10813, 15307, 10735, 15281, 10662, 15255, 10590, 15230, 10523,
+		15206, 10460, 15182, 10398, 15158, 10340, 15135, 10286, 15112, 10226, 15089, 10122, 15067, 10029, 15045, 9935,
+		15024, 9851, 15003, 9768, 14982, 9688, 14962, 9610, 14942, 9540, 14922, 9475, 14903, 9407, 14883, 9342,
+		14864, 9282, 14846, 9228, 14827, 9129, 14809, 9028, 14792, 8931, 14774, 8835, 14757, 8746, 14740, 8663,
+		14723, 8585, 14707, 8510, 14691, 8438, 14675, 8364, 14659, 8299, 14644, 8236, 14629, 8166, 14614, 8055,
+		14599, 7951, 14585, 7851, 14570, 7750, 14556, 7661, 14542, 7575, 14529, 7491, 14516, 7423, 14503, 7352,
+		14489, 7279, 14476, 7209, 14464, 7124, 14451, 7002, 14439, 6882, 14427, 6784, 14415, 6694, 14403, 6593,
+		14392, 6506, 14381, 6425, 14370, 6348, 14359, 6275, 14347, 6197, 14337, 6106, 14316, 5977, 14295, 5852,
+		14274, 5743, 14254, 5635, 14234, 5531, 14214, 5440, 14195, 5352, 14176, 5275, 14157, 5196, 14138, 5118,
+		14120, 4980, 14102, 4857, 14084, 4735, 14067, 4626, 14049, 4521, 14032, 4416, 14015, 4329, 13998, 4226,
+		13982, 4154, 13966, 4052, 13950, 3899, 13934, 3760, 13918, 3647, 13903, 3517, 13888, 3419, 13873, 3306,
+		13859, 3225, 13844, 3134, 13830, 3027, 13816, 2896, 13802, 2723, 13788, 2590, 13774, 2507, 13761, 2383,
+		13748, 2262, 13735, 2173, 13722, 2091, 13709, 1937, 13696, 1800, 13684, 1672, 13672, 1527, 13659, 1366,
+		13648, 1269, 13636, 1159, 13624, 1060, 13613, 966, 13602, 911, 13591, 876, 13580, 800, 13569, 707,
+		13558, 648, 13547, 603, 13537, 540, 13526, 473, 13516, 433, 13506, 400, 13496, 363, 13486, 322,
+		13475, 284, 13466, 284, 13457, 254, 13447, 232, 13438, 208, 13429, 184, 13420, 169, 13411, 141,
+		13402, 127, 13393, 119, 13384, 102, 13376, 83, 13367, 78, 13359, 70, 13351, 57, 13342, 48,
+		16700, 20400, 16738, 19981, 16776, 19758, 16812, 19607, 16845, 19493, 16879, 19357, 16909, 19209, 16938, 19086,
+		16964, 18977, 16988, 18882, 17010, 18795, 17030, 18717, 17047, 18645, 17062, 18579, 17074, 18517, 17085, 18460,
+		17095, 18381, 17101, 18280, 17106, 18185, 17108, 18094, 17110, 18010, 17109, 17930, 17107, 17855, 17104, 17785,
+		17099, 17715, 17093, 17651, 17086, 17590, 17077, 17532, 17068, 17478, 17057, 17425, 17046, 17342, 17035, 17249,
+		17022, 17159, 17009, 17074, 16995, 16993, 16980, 16916, 16966, 16843, 16951, 16773, 16935, 16707, 16919, 16644,
+		16903, 16585, 16886, 16527, 16869, 16473, 16853, 16421, 16836, 16360, 16819, 16267, 16802, 16178, 16784, 16093,
+		16767, 16012, 16749, 15935, 16732, 15861, 16715, 15792, 16697, 15724, 16681, 15662, 16663, 15601, 16647, 15544,
+		16629, 15487, 16613, 15437, 16596, 15386, 16579, 15317, 16563, 15226, 16547, 15139, 16531, 15057, 16514, 14978,
+		16498, 14902, 16483, 14831, 16467, 14762, 16452, 14696, 16437, 14634, 16422, 14575, 16407, 14518, 16392, 14464,
+		16372, 14412, 16343, 14362, 16315, 14295, 16287, 14204, 16260, 14118, 16232, 14036, 16206, 13957, 16179, 13882,
+		16153, 13809, 16128, 13742, 16102, 13675, 16078, 13615, 16053, 13555, 16029, 13497, 16006, 13443, 15982, 13391,
+		15959, 13342, 15937, 13276, 15914, 13183, 15892, 13099, 15871, 13016, 15849, 12936, 15828, 12860, 15808, 12788,
+		15787, 12717, 15767, 12653, 15747, 12588, 15728, 12528, 15709, 12471, 15690, 12415, 15672, 12363, 15653, 12311,
+		15635, 12240, 15618, 12151, 15601, 12061, 15583, 11975, 15566, 11895, 15550, 11820, 15534, 11748, 15518, 11678,
+		15502, 11611, 15487, 11546, 15471, 11485, 15456, 11426, 15441, 11369, 15427, 11316, 15412, 11266, 15399, 11171,
+		15385, 11080, 15371, 10991, 15356, 10905, 15330, 10826, 15303, 10747, 15278, 10672, 15253, 10603, 15228, 10537,
+		15204, 10473, 15180, 10413, 15156, 10352, 15133, 10297, 15110, 10243, 15088, 10145, 15066, 10048, 15045, 9959,
+		15023, 9869, 15002, 9785, 14981, 9705, 14961, 9627, 14941, 9556, 14921, 9487, 14902, 9420, 14883, 9358,
+		14864, 9297, 14846, 9243, 14827, 9163, 14809, 9055, 14791, 8954, 14774, 8859, 14757, 8775, 14740, 8688,
+		14724, 8610, 14707, 8530, 14691, 8453, 14675, 8387, 14660, 8320, 14644, 8258, 14629, 8200, 14614, 8091,
+		14599, 7978, 14585, 7874, 14570, 7777, 14556, 7687, 14543, 7604, 14529, 7520, 14515, 7437, 14502, 7364,
+		14489, 7294, 14476, 7225, 14464, 7163, 14452, 7051, 14440, 6943, 14428, 6824, 14416, 6723, 14404, 6623,
+		14392, 6527, 14381, 6441, 14370, 6367, 14359, 6291, 14348, 6220, 14337, 6152, 14318, 6034, 14297, 5917,
+		14277, 5807, 14256, 5688, 14236, 5584, 14217, 5489, 14197, 5390, 14178, 5304, 14159, 5226, 14140, 5147,
+		14122, 5038, 14103, 4899, 14085, 4774, 14068, 4666, 14050, 4545, 14033, 4454, 14017, 4362, 14000, 4268,
+		13984, 4188, 13968, 4101, 13952, 3991, 13936, 3843, 13921, 3710, 13906, 3599, 13891, 3480, 13875, 3360,
+		13861, 3281, 13847, 3194, 13832, 3098, 13818, 2972, 13803, 2791, 13790, 2686, 13776, 2563, 13763, 2461,
+		13749, 2323, 13737, 2234, 13724, 2136, 13711, 2043, 13698, 1868, 13686, 1732, 13674, 1618, 13662, 1480,
+		13650, 1384, 13638, 1285, 13627, 1146, 13615, 1034, 13604, 948, 13593, 879, 13581, 779, 13570, 716,
+		13560, 678, 13549, 642, 13539, 600, 13528, 535, 13518, 488, 13508, 451, 13498, 392, 13487, 355,
+		13478, 326, 13468, 294, 13459, 258, 13449, 233, 13440, 220, 13431, 199, 13422, 173, 13413, 165,
+		13404, 147, 13395, 122, 13386, 101, 13378, 95, 13369, 80, 13361, 69, 13352, 61, 13344, 50,
+		16672, 20311, 16709, 19919, 16744, 19705, 16778, 19560, 16810, 19447, 16841, 19278, 16870, 19140, 16897, 19021,
+		16922, 18917, 16945, 18825, 16967, 18744, 16985, 18669, 17002, 18601, 17017, 18537, 17029, 18478, 17040, 18415,
+		17049, 18314, 17056, 18217, 17061, 18126, 17064, 18041, 17065, 17960, 17066, 17885, 17064, 17811, 17061, 17743,
+		17058, 17679, 17052, 17617, 17045, 17558, 17038, 17503, 17030, 17450, 17021, 17392, 17010, 17296, 16999, 17206,
+		16987, 17118, 16975, 17037, 16962, 16958, 16949, 16884, 16935, 16813, 16921, 16746, 16906, 16681, 16891, 16621,
+		16876, 16563, 16860, 16507, 16844, 16454, 16828, 16404, 16812, 16329, 16795, 16238, 16779, 16150, 16763, 16068,
+		16746, 15990, 16729, 15914, 16713, 15843, 16696, 15774, 16679, 15708, 16663, 15647, 16647, 15587, 16631, 15532,
+		16614, 15477, 16598, 15426, 16581, 15376, 16566, 15301, 16550, 15211, 16534, 15125, 16518, 15044, 16502, 14966,
+		16487, 14892, 16472, 14821, 16456, 14753, 16441, 14689, 16427, 14627, 16412, 14568, 16398, 14512, 16383, 14459,
+		16354, 14407, 16326, 14358, 16299, 14288, 16272, 14199, 16245, 14113, 16218, 14030, 16192, 13954, 16166, 13879,
+		16141, 13808, 16116, 13739, 16091, 13675, 16067, 13612, 16043, 13554, 16019, 13495, 15996, 13443, 15973, 13391,
+		15950, 13341, 15928, 13278, 15906, 13186, 15885, 13102, 15863, 13017, 15842, 12938, 15821, 12863, 15801, 12792,
+		15781, 12723, 15761, 12656, 15742, 12593, 15722, 12532, 15704, 12476, 15685, 12421, 15667, 12367, 15649, 12317,
+		15631, 12249, 15614, 12158, 15596, 12068, 15579, 11985, 15563, 11905, 15547, 11829, 15530, 11755, 15514, 11684,
+		15499, 11618, 15484, 11555, 15469, 11495, 15454, 11436, 15439, 11380, 15425, 11325, 15410, 11274, 15396, 11185,
+		15383, 11093, 15369, 11004, 15352, 10919, 15326, 10840, 15301, 10763, 15275, 10688, 15250, 10616, 15226, 10549,
+		15201, 10485, 15178, 10423, 15154, 10364, 15131, 10308, 15109, 10255, 15087, 10171, 15064, 10070, 15043, 9975,
+		15022, 9888, 15001, 9804, 14980, 9722, 14960, 9647, 14940, 9575, 14920, 9504, 14901, 9437, 14882, 9373,
+		14863, 9312, 14845, 9254, 14827, 9183, 14809, 9079, 14791, 8980, 14774, 8890, 14757, 8802, 14741, 8714,
+		14724, 8628, 14707, 8549, 14691, 8480, 14675, 8408, 14660, 8342, 14645, 8280, 14629, 8214, 14614, 8123,
+		14600, 8016, 14585, 7910, 14572, 7819, 14558, 7726, 14544, 7633, 14530, 7547, 14516, 7466, 14503, 7391,
+		14491, 7324, 14478, 7256, 14465, 7188, 14452, 7079, 14440, 6965, 14428, 6859, 14416, 6749, 14405, 6663,
+		14393, 6574, 14382, 6480, 14370, 6394, 14360, 6320, 14349, 6244, 14338, 6166, 14319, 6069, 14298, 5949,
+		14278, 5831, 14258, 5725, 14238, 5621, 14218, 5528, 14199, 5446, 14180, 5351, 14161, 5263, 14142, 5188,
+		14124, 5113, 14106, 4975, 14088, 4850, 14071, 4726, 14053, 4607, 14036, 4496, 14019, 4411, 14003, 4308,
+		13986, 4216, 13970, 4147, 13955, 4060, 13938, 3899, 13923, 3775, 13908, 3650, 13892, 3534, 13877, 3433,
+		13862, 3317, 13848, 3239, 13833, 3132, 13819, 3030, 13806, 2906, 13792, 2756, 13778, 2626, 13765, 2498,
+		13751, 2374, 13738, 2254, 13726, 2192, 13713, 2091, 13701, 1965, 13688, 1831, 13676, 1694, 13664, 1552,
+		13652, 1388, 13640, 1313, 13629, 1217, 13617, 1100, 13606, 1051, 13595, 959, 13583, 850, 13572, 774,
+		13561, 714, 13550, 639, 13540, 569, 13530, 539, 13519, 494, 13509, 455, 13499, 408, 13490, 394,
+		13480, 358, 13470, 313, 13460, 282, 13451, 259, 13441, 221, 13432, 196, 13423, 179, 13414, 166,
+		13405, 145, 13396, 128, 13388, 122, 13380, 101, 13371, 90, 13363, 80, 13355, 67, 13346, 53,
+		16646, 20232, 16680, 19858, 16713, 19653, 16745, 19514, 16776, 19367, 16805, 19206, 16832, 19072, 16858, 18959,
+		16882, 18859, 16904, 18772, 16924, 18694, 16942, 18622, 16959, 18557, 16973, 18497, 16986, 18442, 16996, 18346,
+		17005, 18248, 17012, 18156, 17017, 18070, 17020, 17988, 17023, 17912, 17023, 17839, 17022, 17769, 17020, 17704,
+		17017, 17641, 17013, 17583, 17007, 17527, 17000, 17473, 16993, 17423, 16984, 17341, 16975, 17250, 16965, 17162,
+		16954, 17079, 16943, 17000, 16930, 16924, 16918, 16853, 16905, 16783, 16891, 16719, 16877, 16657, 16863, 16598,
+		16848, 16541, 16834, 16488, 16819, 16437, 16804, 16388, 16788, 16298, 16772, 16208, 16757, 16124, 16741, 16043,
+		16725, 15966, 16709, 15893, 16694, 15823, 16678, 15757, 16662, 15693, 16646, 15632, 16629, 15573, 16614, 15518,
+		16598, 15465, 16583, 15415, 16567, 15367, 16551, 15283, 16535, 15192, 16521, 15112, 16505, 15030, 16490, 14954,
+		16475, 14881, 16460, 14811, 16446, 14744, 16431, 14681, 16417, 14619, 16403, 14562, 16388, 14506, 16365, 14454,
+		16337, 14403, 16310, 14354, 16283, 14281, 16256, 14191, 16230, 14107, 16204, 14026, 16179, 13950, 16153, 13876,
+		16128, 13805, 16104, 13737, 16079, 13672, 16056, 13612, 16032, 13553, 16009, 13496, 15986, 13442, 15964, 13392,
+		15941, 13341, 15919, 13278, 15897, 13187, 15876, 13101, 15855, 13020, 15834, 12940, 15814, 12867, 15794, 12794,
+		15774, 12724, 15755, 12659, 15736, 12597, 15717, 12537, 15698, 12479, 15680, 12424, 15662, 12371, 15644, 12322,
+		15627, 12261, 15609, 12167, 15592, 12077, 15576, 11995, 15559, 11915, 15543, 11837, 15527, 11762, 15511, 11693,
+		15496, 11628, 15481, 11563, 15466, 11500, 15451, 11442, 15436, 11386, 15423, 11334, 15409, 11283, 15395, 11205,
+		15381, 11111, 15368, 11020, 15349, 10935, 15322, 10850, 15297, 10775, 15272, 10700, 15248, 10631, 15223, 10561,
+		15199, 10498, 15176, 10436, 15153, 10377, 15129, 10319, 15107, 10267, 15084, 10187, 15063, 10090, 15042, 9999,
+		15020, 9909, 15000, 9827, 14979, 9743, 14959, 9664, 14939, 9592, 14920, 9522, 14900, 9452, 14882, 9391,
+		14863, 9330, 14845, 9271, 14826, 9215, 14809, 9109, 14791, 9008, 14774, 8913, 14756, 8820, 14740, 8734,
+		14723, 8649, 14707, 8573, 14692, 8502, 14676, 8431, 14660, 8363, 14645, 8294, 14630, 8234, 14615, 8163,
+		14600, 8051, 14586, 7949, 14572, 7846, 14558, 7752, 14544, 7662, 14531, 7577, 14517, 7498, 14504, 7420,
+		14491, 7347, 14478, 7277, 14466, 7211, 14453, 7126, 14441, 7011, 14429, 6903, 14417, 6794, 14406, 6695,
+		14394, 6599, 14383, 6508, 14372, 6426, 14361, 6352, 14350, 6282, 14339, 6208, 14321, 6128, 14300, 6001,
+		14280, 5877, 14259, 5753, 14239, 5652, 14220, 5570, 14201, 5468, 14182, 5379, 14163, 5296, 14145, 5222,
+		14126, 5151, 14108, 5037, 14090, 4901, 14073, 4785, 14056, 4671, 14038, 4558, 14021, 4450, 14004, 4356,
+		13988, 4272, 13972, 4189, 13956, 4114, 13940, 3974, 13924, 3820, 13909, 3701, 13894, 3594, 13879, 3480,
+		13865, 3388, 13850, 3283, 13836, 3197, 13822, 3119, 13808, 2981, 13794, 2838, 13780, 2690, 13767, 2563,
+		13754, 2459, 13741, 2352, 13728, 2241, 13715, 2140, 13702, 2033, 13690, 1862, 13678, 1758, 13666, 1633,
+		13653, 1477, 13641, 1351, 13630, 1246, 13618, 1149, 13607, 1050, 13596, 970, 13585, 882, 13574, 811,
+		13564, 791, 13553, 697, 13542, 625, 13532, 589, 13521, 524, 13511, 458, 13501, 433, 13492, 403,
+		13482, 367, 13472, 330, 13462, 301, 13453, 278, 13444, 251, 13435, 223, 13426, 202, 13416, 177,
+		13407, 158, 13399, 141, 13390, 119, 13381, 102, 13373, 93, 13364, 74, 13356, 66, 13348, 56,
+		16620, 20160, 16652, 19800, 16684, 19605, 16714, 19472, 16743, 19292, 16771, 19138, 16797, 19011, 16821, 18900,
+		16844, 18805, 16865, 18721, 16884, 18647, 16902, 18579, 16918, 18517, 16931, 18459, 16943, 18378, 16953, 18278,
+		16962, 18185, 16970, 18099, 16975, 18016, 16979, 17938, 16982, 17865, 16982, 17794, 16982, 17729, 16981, 17667,
+		16978, 17607, 16974, 17549, 16969, 17496, 16963, 17445, 16956, 17385, 16949, 17292, 16940, 17203, 16931, 17120,
+		16921, 17039, 16910, 16964, 16899, 16890, 16887, 16821, 16875, 16755, 16862, 16691, 16849, 16632, 16836, 16574,
+		16822, 16520, 16808, 16467, 16794, 16418, 16779, 16357, 16765, 16266, 16750, 16180, 16735, 16098, 16720, 16019,
+		16704, 15943, 16689, 15871, 16674, 15803, 16659, 15738, 16644, 15676, 16628, 15617, 16613, 15560, 16598, 15506,
+		16582, 15452, 16567, 15404, 16552, 15354, 16537, 15263, 16522, 15178, 16507, 15095, 16492, 15014, 16478, 14942,
+		16463, 14869, 16449, 14800, 16435, 14735, 16421, 14672, 16407, 14612, 16393, 14555, 16374, 14500, 16347, 14447,
+		16320, 14398, 16293, 14350, 16267, 14271, 16241, 14184, 16215, 14101, 16190, 14021, 16165, 13944, 16140, 13871,
+		16116, 13802, 16092, 13735, 16068, 13671, 16044, 13610, 16021, 13551, 15999, 13496, 15976, 13442, 15954, 13390,
+		15932, 13342, 15910, 13277, 15889, 13189, 15867, 13101, 15848, 13023, 15827, 12942, 15807, 12869, 15787, 12796,
+		15767, 12727, 15749, 12663, 15729, 12600, 15711, 12540, 15693, 12483, 15675, 12428, 15657, 12376, 15639, 12325,
+		15622, 12266, 15605, 12174, 15588, 12087, 15572, 12005, 15555, 11924, 15539, 11845, 15524, 11774, 15508, 11703,
+		15493, 11636, 15477, 11570, 15463, 11508, 15448, 11450, 15434, 11394, 15420, 11341, 15406, 11289, 15392, 11215,
+		15379, 11124, 15366, 11037, 15345, 10949, 15320, 10869, 15294, 10790, 15269, 10715, 15244, 10642, 15220, 10573,
+		15196, 10509, 15173, 10447, 15150, 10389, 15127, 10332, 15105, 10278, 15083, 10213, 15062, 10118, 15040, 10019,
+		15019, 9929, 14998, 9843, 14978, 9761, 14958, 9685, 14938, 9610, 14919, 9539, 14899, 9469, 14880, 9404,
+		14862, 9343, 14844, 9285, 14826, 9229, 14808, 9141, 14791, 9037, 14774, 8939, 14757, 8848, 14740, 8760,
+		14724, 8676, 14707, 8596, 14692, 8522, 14676, 8448, 14660, 8379, 14645, 8313, 14630, 8252, 14616, 8199,
+		14601, 8092, 14586, 7976, 14572, 7879, 14559, 7785, 14545, 7693, 14532, 7609, 14518, 7523, 14505, 7443,
+		14492, 7374, 14479, 7304, 14467, 7235, 14455, 7176, 14442, 7057, 14430, 6945, 14418, 6837, 14407, 6733,
+		14395, 6637, 14384, 6551, 14373, 6463, 14362, 6378, 14351, 6302, 14340, 6230, 14322, 6156, 14302, 6047,
+		14282, 5942, 14262, 5829, 14242, 5710, 14222, 5609, 14203, 5512, 14183, 5411, 14164, 5314, 14146, 5244,
+		14127, 5169, 14110, 5088, 14093, 4967, 14075, 4842, 14057, 4725, 14040, 4610, 14023, 4504, 14007, 4406,
+		13990, 4321, 13974, 4227, 13958, 4145, 13942, 4054, 13927, 3918, 13911, 3768, 13896, 3652, 13881, 3524,
+		13867, 3420, 13852, 3325, 13838, 3238, 13824, 3143, 13810, 3060, 13796, 2902, 13782, 2771, 13770, 2680,
+		13756, 2525, 13743, 2427, 13730, 2301, 13717, 2186, 13705, 2115, 13692, 2027, 13680, 1888, 13668, 1706,
+		13655, 1529, 13643, 1394, 13632, 1324, 13621, 1229, 13609, 1133, 13598, 1042, 13587, 936, 13576, 839,
+		13565, 780, 13554, 718, 13544, 650, 13534, 622, 13524, 575, 13513, 501, 13503, 468, 13493, 413,
+		13483, 361, 13474, 338, 13464, 304, 13454, 280, 13445, 252, 13436, 227, 13427, 199, 13418, 187,
+		13409, 166, 13400, 138, 13391, 126, 13383, 114, 13375, 100, 13366, 84, 13358, 71, 13349, 60,
+		16596, 20095, 16626, 19746, 16655, 19559, 16684, 19409, 16711, 19220, 16738, 19071, 16762, 18947, 16785, 18843,
+		16807, 18753, 16827, 18673, 16845, 18601, 16862, 18536, 16877, 18476, 16891, 18411, 16903, 18310, 16913, 18215,
+		16922, 18126, 16929, 18043, 16935, 17963, 16939, 17888, 16942, 17819, 16943, 17752, 16943, 17688, 16942, 17629,
+		16940, 17572, 16937, 17518, 16933, 17467, 16927, 17417, 16921, 17332, 16914, 17244, 16906, 17159, 16898, 17078,
+		16889, 17001, 16879, 16928, 16868, 16857, 16857, 16790, 16846, 16726, 16834, 16665, 16822, 16607, 16809, 16551,
+		16796, 16498, 16783, 16448, 16769, 16399, 16755, 16322, 16742, 16235, 16727, 16151, 16713, 16071, 16699, 15994,
+		16684, 15920, 16670, 15851, 16655, 15784, 16640, 15719, 16625, 15659, 16611, 15601, 16596, 15545, 16582, 15492,
+		16567, 15441, 16552, 15393, 16537, 15332, 16523, 15243, 16509, 15160, 16494, 15079, 16480, 15002, 16466, 14929,
+		16451, 14855, 16438, 14789, 16424, 14725, 16410, 14662, 16396, 14604, 16382, 14547, 16355, 14493, 16328, 14441,
+		16302, 14392, 16277, 14345, 16251, 14263, 16225, 14177, 16200, 14094, 16176, 14015, 16151, 13941, 16127, 13867,
+		16103, 13798, 16080, 13732, 16056, 13668, 16033, 13608, 16010, 13550, 15988, 13494, 15966, 13441, 15944, 13390,
+		15922, 13342, 15901, 13279, 15880, 13189, 15859, 13103, 15839, 13022, 15819, 12945, 15799, 12870, 15780, 12801,
+		15761, 12730, 15742, 12666, 15723, 12602, 15705, 12542, 15687, 12487, 15669, 12431, 15651, 12378, 15634, 12329,
+		15617, 12275, 15600, 12184, 15584, 12096, 15567, 12012, 15551, 11931, 15535, 11853, 15520, 11783, 15505, 11712,
+		15490, 11644, 15475, 11579, 15460, 11518, 15446, 11460, 15431, 11403, 15417, 11348, 15403, 11297, 15390, 11236,
+		15377, 11139, 15363, 11048, 15341, 10962, 15315, 10878, 15290, 10802, 15266, 10729, 15242, 10659, 15218, 10590,
+		15194, 10524, 15171, 10460, 15148, 10400, 15125, 10342, 15103, 10288, 15081, 10232, 15060, 10135, 15038, 10039,
+		15017, 9948, 14997, 9863, 14977, 9782, 14957, 9703, 14937, 9627, 14918, 9556, 14899, 9487, 14880, 9424,
+		14861, 9360, 14843, 9302, 14825, 9245, 14808, 9165, 14790, 9063, 14773, 8964, 14756, 8869, 14740, 8785,
+		14723, 8701, 14707, 8620, 14691, 8542, 14676, 8469, 14660, 8400, 14645, 8335, 14630, 8272, 14616, 8213,
+		14601, 8119, 14587, 8014, 14573, 7912, 14559, 7811, 14546, 7726, 14532, 7634, 14519, 7554, 14506, 7475,
+		14493, 7398, 14480, 7325, 14468, 7259, 14455, 7195, 14443, 7102, 14431, 6990, 14419, 6878, 14408, 6781,
+		14396, 6675, 14385, 6582, 14374, 6498, 14363, 6414, 14352, 6335, 14341, 6265, 14325, 6196, 14304, 6106,
+		14284, 5983, 14263, 5860, 14243, 5750, 14224, 5637, 14205, 5555, 14186, 5472, 14167, 5379, 14148, 5290,
+		14130, 5212, 14111, 5133, 14093, 4992, 14076, 4871, 14058, 4755, 14041, 4633, 14024, 4532, 14009, 4452,
+		13992, 4366, 13976, 4277, 13960, 4182, 13944, 4102, 13929, 3975, 13913, 3839, 13899, 3722, 13884, 3597,
+		13869, 3491, 13854, 3376, 13840, 3291, 13826, 3190, 13812, 3101, 13798, 2985, 13785, 2856, 13771, 2696,
+		13758, 2569, 13745, 2451, 13732, 2369, 13719, 2273, 13707, 2185, 13694, 2084, 13682, 1922, 13670, 1771,
+		13658, 1649, 13646, 1538, 13635, 1419, 13623, 1287, 13611, 1166, 13600, 1088, 13589, 988, 13579, 912,
+		13568, 855, 13557, 764, 13546, 688, 13536, 639, 13526, 584, 13516, 533, 13506, 495, 13496, 455,
+		13485, 411, 13476, 378, 13466, 330, 13456, 288, 13447, 266, 13438, 233, 13429, 216, 13420, 192,
+		13411, 171, 13402, 150, 13394, 135, 13385, 118, 13376, 102, 13368, 86, 13360, 77, 13351, 63,
+		16572, 20024, 16601, 19697, 16628, 19515, 16655, 19331, 16681, 19151, 16705, 19007, 16729, 18890, 16751, 18791,
+		16772, 18703, 16791, 18627, 16809, 18558, 16825, 18496, 16839, 18438, 16852, 18340, 16864, 18244, 16874, 18153,
+		16883, 18068, 16890, 17988, 16896, 17913, 16900, 17842, 16903, 17774, 16905, 17711, 16906, 17651, 16905, 17593,
+		16904, 17539, 16900, 17486, 16897, 17437, 16892, 17371, 16886, 17282, 16880, 17195, 16873, 17115, 16865, 17037,
+		16857, 16963, 16848, 16892, 16838, 16824, 16828, 16759, 16817, 16698, 16806, 16638, 16794, 16582, 16783, 16528,
+		16770, 16477, 16757, 16428, 16745, 16378, 16732, 16288, 16719, 16203, 16705, 16121, 16691, 16042, 16678, 15968,
+		16664, 15897, 16650, 15830, 16636, 15763, 16622, 15701, 16608, 15642, 16594, 15585, 16579, 15530, 16565, 15479,
+		16551, 15429, 16537, 15382, 16523, 15312, 16509, 15225, 16495, 15142, 16481, 15062, 16467, 14986, 16453, 14914,
+		16440, 14845, 16426, 14779, 16412, 14713, 16399, 14653, 16386, 14596, 16362, 14539, 16335, 14485, 16310, 14435,
+		16284, 14386, 16259, 14340, 16235, 14256, 16209, 14169, 16185, 14087, 16160, 14008, 16137, 13935, 16113, 13862,
+		16089, 13794, 16067, 13729, 16044, 13665, 16021, 13605, 15999, 13548, 15977, 13493, 15955, 13440, 15934, 13390,
+		15913, 13341, 15892, 13278, 15871, 13189, 15851, 13105, 15831, 13024, 15812, 12947, 15792, 12871, 15773, 12802,
+		15754, 12733, 15735, 12667, 15717, 12608, 15699, 12546, 15681, 12490, 15663, 12434, 15646, 12382, 15629, 12333,
+		15612, 12282, 15595, 12188, 15579, 12102, 15563, 12017, 15547, 11939, 15532, 11863, 15516, 11789, 15501, 11717,
+		15486, 11651, 15471, 11587, 15457, 11527, 15443, 11466, 15428, 11409, 15415, 11357, 15401, 11306, 15388, 11250,
+		15374, 11152, 15361, 11062, 15337, 10977, 15312, 10896, 15287, 10815, 15262, 10739, 15237, 10666, 15214, 10598,
+		15191, 10537, 15168, 10472, 15146, 10414, 15123, 10357, 15101, 10301, 15079, 10249, 15057, 10154, 15036, 10059,
+		15015, 9966, 14995, 9881, 14975, 9799, 14955, 9720, 14935, 9643, 14916, 9571, 14898, 9505, 14879, 9438,
+		14861, 9377, 14842, 9316, 14825, 9260, 14807, 9197, 14790, 9093, 14773, 8995, 14756, 8899, 14739, 8807,
+		14723, 8724, 14707, 8639, 14691, 8562, 14676, 8492, 14660, 8422, 14645, 8355, 14630, 8291, 14616, 8230,
+		14601, 8153, 14587, 8047, 14573, 7938, 14559, 7846, 14545, 7750, 14532, 7663, 14519, 7578, 14506, 7496,
+		14493, 7422, 14480, 7349, 14468, 7283, 14456, 7221, 14444, 7146, 14432, 7029, 14420, 6916, 14408, 6810,
+		14397, 6713, 14385, 6616, 14374, 6531, 14364, 6450, 14353, 6367, 14342, 6287, 14327, 6216, 14306, 6152,
+		14286, 6033, 14265, 5916, 14246, 5815, 14226, 5700, 14207, 5594, 14188, 5500, 14169, 5411, 14150, 5319,
+		14132, 5247, 14115, 5182, 14097, 5112, 14079, 4967, 14062, 4835, 14045, 4717, 14027, 4587, 14010, 4486,
+		13994, 4398, 13978, 4300, 13962, 4212, 13946, 4126, 13932, 4061, 13917, 3925, 13901, 3773, 13886, 3653,
+		13871, 3545, 13857, 3431, 13842, 3339, 13828, 3247, 13815, 3171, 13801, 3075, 13787, 2946, 13774, 2786,
+		13760, 2637, 13747, 2533, 13734, 2427, 13722, 2315, 13709, 2205, 13696, 2109, 13684, 2017, 13672, 1868,
+		13661, 1772, 13649, 1615, 13637, 1444, 13625, 1361, 13614, 1248, 13603, 1177, 13592, 1066, 13581, 953,
+		13570, 884, 13559, 800, 13549, 742, 13538, 682, 13528, 622, 13517, 556, 13507, 513, 13497, 460,
+		13488, 426, 13478, 392, 13469, 364, 13460, 328, 13450, 302, 13440, 255, 13431, 234, 13422, 200,
+		13413, 179, 13404, 161, 13396, 146, 13387, 127, 13378, 104, 13370, 97, 13362, 79, 13353, 67,
+		16548, 19955, 16576, 19645, 16602, 19474, 16627, 19259, 16652, 19086, 16675, 18949, 16697, 18836, 16718, 18739,
+		16738, 18656, 16756, 18583, 16773, 18517, 16789, 18458, 16803, 18374, 16816, 18274, 16827, 18181, 16837, 18094,
+		16845, 18012, 16852, 17936, 16858, 17863, 16863, 17797, 16866, 17732, 16867, 17670, 16869, 17614, 16869, 17558,
+		16867, 17505, 16865, 17456, 16862, 17408, 16858, 17318, 16853, 17232, 16847, 17150, 16841, 17071, 16834, 16996,
+		16826, 16925, 16818, 16857, 16808, 16790, 16799, 16728, 16789, 16669, 16779, 16612, 16768, 16558, 16756, 16506,
+		16745, 16456, 16733, 16408, 16721, 16342, 16708, 16253, 16696, 16170, 16683, 16091, 16670, 16016, 16657, 15944,
+		16644, 15874, 16631, 15808, 16617, 15744, 16604, 15683, 16590, 15625, 16577, 15570, 16563, 15516, 16549, 15465,
+		16535, 15417, 16522, 15370, 16508, 15291, 16495, 15207, 16481, 15124, 16468, 15046, 16455, 14972, 16441, 14899,
+		16428, 14831, 16415, 14766, 16402, 14704, 16389, 14645, 16367, 14585, 16341, 14530, 16316, 14479, 16291, 14429,
+		16266, 14381, 16242, 14333, 16218, 14245, 16193, 14160, 16169, 14079, 16146, 14003, 16122, 13928, 16099, 13858,
+		16076, 13789, 16053, 13724, 16031, 13662, 16009, 13603, 15988, 13546, 15966, 13491, 15945, 13439, 15924, 13389,
+		15903, 13341, 15883, 13279, 15862, 13190, 15842, 13106, 15823, 13025, 15803, 12947, 15784, 12874, 15766, 12804,
+		15747, 12736, 15728, 12669, 15710, 12610, 15692, 12549, 15675, 12493, 15658, 12438, 15640, 12386, 15624, 12336,
+		15607, 12288, 15590, 12196, 15574, 12111, 15558, 12025, 15543, 11945, 15527, 11869, 15512, 11795, 15497, 11725,
+		15482, 11659, 15468, 11594, 15453, 11532, 15439, 11472, 15426, 11418, 15412, 11365, 15398, 11312, 15385, 11260,
+		15372, 11169, 15358, 11078, 15333, 10992, 15307, 10908, 15282, 10827, 15258, 10753, 15235, 10685, 15211, 10614,
+		15187, 10546, 15164, 10482, 15141, 10420, 15119, 10363, 15098, 10312, 15076, 10258, 15055, 10180, 15034, 10082,
+		15013, 9989, 14993, 9903, 14973, 9820, 14953, 9738, 14934, 9659, 14915, 9590, 14896, 9521, 14878, 9455,
+		14859, 9389, 14841, 9331, 14824, 9273, 14806, 9219, 14789, 9117, 14772, 9019, 14755, 8923, 14739, 8833,
+		14723, 8751, 14707, 8667, 14691, 8589, 14676, 8513, 14661, 8445, 14645, 8373, 14630, 8308, 14616, 8249,
+		14602, 8194, 14587, 8082, 14573, 7975, 14559, 7875, 14546, 7778, 14532, 7691, 14519, 7602, 14506, 7525,
+		14493, 7442, 14481, 7374, 14468, 7305, 14456, 7238, 14444, 7176, 14432, 7063, 14420, 6952, 14409, 6854,
+		14398, 6752, 14386, 6654, 14375, 6561, 14364, 6474, 14353, 6397, 14343, 6323, 14329, 6251, 14308, 6184,
+		14288, 6092, 14267, 5955, 14248, 5851, 14228, 5736, 14209, 5638, 14189, 5542, 14171, 5456, 14152, 5365,
+		14134, 5282, 14116, 5208, 14098, 5127, 14080, 4995, 14064, 4889, 14047, 4785, 14030, 4669, 14014, 4568,
+		13997, 4460, 13981, 4365, 13964, 4263, 13949, 4182, 13933, 4106, 13918, 3964, 13903, 3831, 13888, 3694,
+		13873, 3591, 13859, 3499, 13844, 3376, 13830, 3281, 13816, 3194, 13802, 3107, 13789, 2992, 13776, 2866,
+		13763, 2750, 13750, 2617, 13737, 2501, 13724, 2367, 13711, 2269, 13698, 2162, 13687, 2090, 13674, 1946,
+		13662, 1768, 13651, 1674, 13639, 1520, 13628, 1431, 13617, 1331, 13605, 1206, 13594, 1096, 13583, 1001,
+		13572, 945, 13561, 870, 13550, 767, 13540, 731, 13530, 646, 13520, 604, 13510, 550, 13500, 498,
+		13490, 443, 13480, 393, 13470, 359, 13460, 329, 13451, 299, 13443, 284, 13434, 260, 13424, 217,
+		13415, 198, 13406, 165, 13398, 155, 13389, 131, 13381, 118, 13372, 98, 13364, 85, 13355, 70,
+		16526, 19899, 16552, 19599, 16577, 19415, 16601, 19190, 16624, 19023, 16646, 18890, 16667, 18784, 16687, 18692,
+		16706, 18611, 16723, 18541, 16739, 18478, 16754, 18410, 16767, 18304, 16780, 18209, 16791, 18119, 16800, 18036,
+		16809, 17959, 16816, 17887, 16822, 17817, 16826, 17751, 16830, 17692, 16832, 17631, 16833, 17577, 16834, 17525,
+		16832, 17474, 16830, 17426, 16828, 17352, 16824, 17265, 16820, 17183, 16815, 17104, 16809, 17029, 16802, 16956,
+		16795, 16888, 16788, 16822, 16779, 16759, 16770, 16698, 16761, 16641, 16752, 16586, 16741, 16532, 16731, 16483,
+		16720, 16434, 16709, 16389, 16697, 16305, 16685, 16220, 16674, 16140, 16661, 16062, 16649, 15988, 16636, 15917,
+		16624, 15850, 16611, 15785, 16598, 15722, 16585, 15664, 16572, 15608, 16559, 15553, 16546, 15501, 16533, 15452,
+		16520, 15403, 16507, 15356, 16494, 15269, 16481, 15186, 16468, 15105, 16455, 15030, 16442, 14956, 16429, 14886,
+		16416, 14819, 16403, 14753, 16390, 14692, 16371, 14633, 16347, 14578, 16322, 14524, 16296, 14470, 16272, 14421,
+		16249, 14375, 16225, 14323, 16200, 14234, 16177, 14151, 16154, 14072, 16130, 13995, 16107, 13921, 16085, 13852,
+		16063, 13784, 16041, 13720, 16019, 13658, 15997, 13599, 15976, 13543, 15955, 13488, 15934, 13436, 15913, 13387,
+		15893, 13340, 15873, 13276, 15853, 13190, 15834, 13107, 15814, 13026, 15795, 12950, 15777, 12876, 15758, 12806,
+		15739, 12738, 15722, 12673, 15704, 12611, 15686, 12552, 15668, 12494, 15652, 12442, 15634, 12388, 15618, 12339,
+		15602, 12292, 15585, 12204, 15570, 12118, 15554, 12033, 15538, 11952, 15523, 11877, 15508, 11803, 15493, 11732,
+		15479, 11665, 15464, 11600, 15450, 11539, 15436, 11481, 15422, 11425, 15408, 11369, 15395, 11317, 15382, 11268,
+		15369, 11182, 15353, 11090, 15328, 11004, 15303, 10921, 15278, 10843, 15255, 10769, 15231, 10695, 15207, 10624,
+		15184, 10558, 15161, 10496, 15139, 10436, 15117, 10377, 15095, 10321, 15073, 10267, 15052, 10192, 15031, 10098,
+		15011, 10008, 14991, 9918, 14971, 9836, 14952, 9759, 14933, 9682, 14914, 9608, 14895, 9538, 14877, 9471,
+		14858, 9405, 14841, 9347, 14823, 9289, 14805, 9233, 14788, 9142, 14772, 9046, 14755, 8946, 14739, 8860,
+		14722, 8770, 14706, 8688, 14691, 8608, 14675, 8534, 14660, 8465, 14645, 8395, 14631, 8332, 14616, 8270,
+		14602, 8213, 14588, 8116, 14574, 8009, 14560, 7908, 14547, 7818, 14533, 7726, 14520, 7636, 14507, 7552,
+		14494, 7473, 14481, 7399, 14468, 7323, 14457, 7262, 14445, 7197, 14433, 7106, 14421, 6997, 14409, 6888,
+		14398, 6784, 14387, 6682, 14376, 6592, 14365, 6513, 14354, 6428, 14343, 6350, 14330, 6275, 14309, 6204,
+		14289, 6136, 14268, 6007, 14249, 5892, 14229, 5785, 14210, 5680, 14191, 5573, 14173, 5486, 14154, 5395,
+		14136, 5320, 14118, 5239, 14101, 5169, 14083, 5070, 14066, 4946, 14048, 4815, 14032, 4699, 14015, 4581,
+		13999, 4495, 13983, 4404, 13967, 4323, 13952, 4243, 13936, 4157, 13921, 4060, 13905, 3909, 13891, 3787,
+		13876, 3663, 13861, 3536, 13846, 3431, 13832, 3325, 13818, 3240, 13805, 3172, 13791, 3074, 13778, 2940,
+		13765, 2799, 13752, 2667, 13738, 2520, 13726, 2426, 13713, 2322, 13702, 2254, 13689, 2139, 13677, 2039,
+		13665, 1915, 13653, 1758, 13641, 1622, 13629, 1474, 13618, 1353, 13607, 1237, 13595, 1131, 13584, 1043,
+		13573, 950, 13563, 891, 13552, 812, 13542, 751, 13532, 698, 13522, 610, 13512, 572, 13502, 508,
+		13492, 486, 13482, 429, 13472, 390, 13463, 353, 13453, 305, 13444, 274, 13435, 244, 13426, 222,
+		13417, 204, 13408, 180, 13399, 158, 13391, 135, 13382, 120, 13374, 102, 13366, 87, 13357, 74,
+		16505, 19846, 16529, 19557, 16553, 19341, 16576, 19127, 16597, 18965, 16618, 18839, 16638, 18736, 16656, 18644,
+		16675, 18569, 16691, 18501, 16707, 18441, 16721, 18338, 16734, 18239, 16746, 18148, 16756, 18061, 16766, 17982,
+		16774, 17907, 16781, 17838, 16786, 17771, 16791, 17709, 16795, 17651, 16798, 17595, 16799, 17541, 16799, 17491,
+		16799, 17443, 16797, 17386, 16796, 17300, 16792, 17215, 16788, 17135, 16784, 17059, 16778, 16988, 16772, 16918,
+		16766, 16851, 16759, 16788, 16751, 16727, 16742, 16668, 16734, 16613, 16725, 16560, 16715, 16509, 16706, 16461,
+		16695, 16414, 16685, 16354, 16674, 16268, 16663, 16187, 16651, 16109, 16640, 16033, 16628, 15961, 16616, 15893,
+		16604, 15826, 16592, 15764, 16580, 15703, 16567, 15645, 16555, 15590, 16542, 15537, 16530, 15487, 16517, 15437,
+		16504, 15390, 16492, 15333, 16479, 15246, 16466, 15164, 16454, 15086, 16441, 15011, 16429, 14940, 16416, 14871,
+		16404, 14805, 16391, 14742, 16374, 14681, 16349, 14623, 16325, 14567, 16301, 14514, 16277, 14463, 16254, 14415,
+		16230, 14368, 16206, 14308, 16184, 14225, 16161, 14142, 16138, 14062, 16115, 13987, 16093, 13914, 16071, 13845,
+		16049, 13779, 16028, 13716, 16006, 13654, 15985, 13596, 15964, 13540, 15943, 13486, 15923, 13435, 15902, 13385,
+		15883, 13338, 15863, 13274, 15844, 13187, 15824, 13104, 15805, 13024, 15786, 12948, 15768, 12875, 15750, 12807,
+		15732, 12739, 15714, 12675, 15697, 12614, 15679, 12555, 15662, 12499, 15645, 12444, 15629, 12392, 15612, 12342,
+		15596, 12295, 15580, 12210, 15565, 12124, 15549, 12040, 15534, 11960, 15519, 11885, 15504, 11810, 15489, 11739,
+		15475, 11674, 15461, 11609, 15447, 11547, 15433, 11488, 15419, 11431, 15405, 11376, 15392, 11325, 15379, 11276,
+		15367, 11194, 15347, 11102, 15322, 11013, 15298, 10932, 15274, 10854, 15250, 10777, 15226, 10704, 15204, 10639,
+		15180, 10571, 15158, 10508, 15135, 10445, 15114, 10388, 15092, 10333, 15072, 10283, 15051, 10221, 15030, 10124,
+		15009, 10026, 14989, 9936, 14968, 9849, 14950, 9773, 14931, 9697, 14912, 9622, 14893, 9553, 14875, 9488,
+		14857, 9423, 14839, 9361, 14822, 9303, 14805, 9247, 14787, 9170, 14771, 9073, 14754, 8978, 14738, 8883,
+		14722, 8795, 14706, 8715, 14690, 8631, 14675, 8557, 14660, 8485, 14645, 8412, 14630, 8348, 14616, 8287,
+		14602, 8230, 14587, 8150, 14574, 8046, 14560, 7943, 14547, 7851, 14533, 7751, 14520, 7663, 14507, 7579,
+		14495, 7505, 14482, 7427, 14470, 7359, 14458, 7289, 14446, 7225, 14434, 7160, 14422, 7035, 14410, 6922,
+		14399, 6822, 14387, 6725, 14376, 6630, 14366, 6545, 14355, 6461, 14344, 6375, 14331, 6301, 14311, 6235,
+		14291, 6171, 14271, 6067, 14251, 5940, 14231, 5821, 14212, 5721, 14193, 5616, 14174, 5530, 14156, 5434,
+		14138, 5351, 14120, 5266, 14102, 5196, 14084, 5122, 14067, 4994, 14051, 4874, 14034, 4758, 14017, 4645,
+		14001, 4536, 13985, 4439, 13969, 4343, 13952, 4243, 13937, 4176, 13922, 4109, 13908, 4003, 13894, 3884,
+		13879, 3760, 13864, 3623, 13849, 3498, 13835, 3407, 13821, 3298, 13807, 3201, 13794, 3123, 13780, 2992,
+		13767, 2882, 13754, 2744, 13741, 2616, 13728, 2496, 13716, 2390, 13703, 2271, 13691, 2175, 13679, 2096,
+		13667, 1994, 13655, 1840, 13643, 1675, 13632, 1558, 13620, 1434, 13609, 1321, 13598, 1213, 13587, 1111,
+		13577, 1034, 13566, 943, 13555, 859, 13544, 778, 13534, 713, 13524, 651, 13514, 617, 13504, 553,
+		13494, 499, 13484, 446, 13474, 387, 13466, 385, 13456, 336, 13447, 310, 13438, 269, 13428, 236,
+		13419, 205, 13411, 190, 13402, 168, 13393, 145, 13384, 122, 13376, 109, 13368, 92, 13359, 77,
+		16484, 19791, 16507, 19516, 16529, 19271, 16551, 19064, 16571, 18909, 16591, 18787, 16610, 18687, 16628, 18602,
+		16645, 18528, 16661, 18464, 16675, 18377, 16689, 18271, 16702, 18176, 16712, 18086, 16723, 18006, 16732, 17928,
+		16740, 17858, 16747, 17791, 16753, 17729, 16757, 17667, 16761, 17612, 16764, 17558, 16766, 17508, 16766, 17459,
+		16766, 17412, 16766, 17332, 16763, 17246, 16761, 17166, 16758, 17091, 16753, 17017, 16748, 16945, 16743, 16880,
+		16737, 16816, 16730, 16754, 16723, 16695, 16715, 16640, 16707, 16585, 16699, 16534, 16690, 16485, 16680, 16438,
+		16671, 16393, 16661, 16314, 16651, 16232, 16640, 16153, 16630, 16077, 16618, 16003, 16607, 15935, 16596, 15866,
+		16585, 15803, 16573, 15741, 16561, 15682, 16549, 15626, 16537, 15572, 16525, 15520, 16513, 15470, 16501, 15423,
+		16489, 15378, 16477, 15308, 16464, 15225, 16452, 15144, 16440, 15068, 16428, 14993, 16415, 14922, 16404, 14855,
+		16392, 14791, 16376, 14730, 16352, 14670, 16328, 14613, 16304, 14558, 16280, 14505, 16257, 14454, 16234, 14407,
+		16211, 14360, 16189, 14298, 16166, 14213, 16143, 14130, 16121, 14052, 16100, 13980, 16078, 13907, 16056, 13838,
+		16035, 13772, 16014, 13710, 15993, 13650, 15972, 13592, 15952, 13537, 15932, 13484, 15912, 13433, 15892, 13383,
+		15872, 13336, 15853, 13272, 15834, 13186, 15815, 13103, 15796, 13023, 15778, 12949, 15760, 12876, 15742, 12806,
+		15724, 12740, 15707, 12675, 15690, 12615, 15672, 12556, 15656, 12500, 15639, 12447, 15623, 12395, 15607, 12345,
+		15591, 12298, 15575, 12218, 15560, 12129, 15544, 12047, 15529, 11967, 15514, 11890, 15500, 11817, 15485, 11748,
+		15471, 11682, 15457, 11616, 15443, 11555, 15430, 11496, 15416, 11439, 15403, 11385, 15390, 11333, 15376, 11283,
+		15364, 11206, 15342, 11116, 15318, 11030, 15294, 10948, 15269, 10866, 15246, 10791, 15222, 10717, 15199, 10649,
+		15176, 10581, 15154, 10516, 15132, 10456, 15111, 10400, 15090, 10345, 15069, 10291, 15048, 10239, 15027, 10141,
+		15007, 10049, 14988, 9967, 14968, 9877, 14949, 9796, 14929, 9716, 14910, 9639, 14892, 9568, 14874, 9503,
+		14856, 9438, 14838, 9376, 14821, 9318, 14804, 9263, 14787, 9202, 14770, 9098, 14754, 9004, 14738, 8908,
+		14722, 8822, 14706, 8736, 14691, 8658, 14675, 8578, 14660, 8505, 14645, 8437, 14630, 8368, 14616, 8307,
+		14602, 8248, 14588, 8183, 14574, 8075, 14560, 7971, 14547, 7882, 14534, 7781, 14521, 7694, 14508, 7611,
+		14495, 7532, 14483, 7453, 14470, 7380, 14458, 7308, 14446, 7249, 14434, 7184, 14422, 7083, 14411, 6970,
+		14400, 6871, 14388, 6768, 14377, 6669, 14366, 6576, 14355, 6484, 14345, 6413, 14333, 6334, 14313, 6267,
+		14293, 6198, 14272, 6108, 14253, 5991, 14234, 5882, 14215, 5776, 14196, 5673, 14177, 5569, 14158, 5474,
+		14140, 5394, 14122, 5308, 14105, 5237, 14087, 5163, 14070, 5056, 14053, 4925, 14036, 4808, 14020, 4692,
+		14003, 4593, 13987, 4489, 13971, 4390, 13956, 4314, 13940, 4223, 13925, 4138, 13910, 4027, 13894, 3887,
+		13880, 3770, 13865, 3643, 13851, 3547, 13838, 3455, 13824, 3371, 13810, 3261, 13797, 3177, 13783, 3103,
+		13770, 2965, 13756, 2812, 13743, 2686, 13730, 2563, 13718, 2443, 13705, 2325, 13693, 2242, 13681, 2147,
+		13669, 2060, 13657, 1893, 13645, 1747, 13634, 1621, 13623, 1507, 13612, 1382, 13600, 1264, 13589, 1159,
+		13579, 1068, 13568, 963, 13557, 895, 13547, 821, 13537, 772, 13526, 691, 13516, 627, 13507, 578,
+		13497, 526, 13487, 495, 13477, 431, 13468, 393, 13458, 339, 13449, 308, 13440, 286, 13431, 258,
+		13422, 229, 13413, 201, 13404, 169, 13396, 155, 13387, 131, 13378, 114, 13370, 99, 13362, 81,
+		16464, 19742, 16485, 19475, 16506, 19200, 16527, 19005, 16546, 18855, 16565, 18739, 16583, 18642, 16600, 18560,
+		16616, 18489, 16631, 18422, 16645, 18309, 16658, 18207, 16671, 18116, 16681, 18031, 16691, 17953, 16700, 17879,
+		16708, 17810, 16715, 17747, 16720, 17686, 16725, 17629, 16729, 17575, 16731, 17523, 16734, 17475, 16735, 17428,
+		16734, 17359, 16734, 17276, 16732, 17195, 16730, 17119, 16727, 17045, 16724, 16975, 16719, 16907, 16714, 16842,
+		16709, 16781, 16703, 16722, 16696, 16665, 16689, 16611, 16681, 16558, 16673, 16509, 16665, 16462, 16656, 16416,
+		16647, 16360, 16638, 16276, 16628, 16196, 16618, 16119, 16608, 16045, 16598, 15975, 16587, 15907, 16576, 15842,
+		16565, 15779, 16554, 15720, 16543, 15663, 16531, 15607, 16520, 15554, 16508, 15504, 16497, 15456, 16485, 15409,
+		16473, 15364, 16461, 15283, 16450, 15202, 16438, 15124, 16426, 15048, 16415, 14976, 16403, 14906, 16391, 14841,
+		16375, 14776, 16352, 14716, 16329, 14657, 16306, 14601, 16283, 14548, 16260, 14496, 16238, 14447, 16215, 14399,
+		16192, 14353, 16171, 14284, 16148, 14199, 16127, 14121, 16106, 14044, 16084, 13969, 16063, 13899, 16042, 13832,
+		16021, 13767, 16000, 13705, 15980, 13645, 15960, 13588, 15939, 13532, 15920, 13479, 15900, 13429, 15881, 13381,
+		15862, 13334, 15843, 13268, 15824, 13184, 15806, 13101, 15787, 13022, 15769, 12949, 15752, 12877, 15734, 12807,
+		15716, 12740, 15699, 12676, 15682, 12615, 15665, 12557, 15649, 12502, 15633, 12448, 15617, 12397, 15601, 12348,
+		15585, 12301, 15570, 12224, 15554, 12136, 15539, 12053, 15525, 11974, 15510, 11897, 15495, 11824, 15481, 11754,
+		15467, 11687, 15453, 11622, 15439, 11561, 15426, 11503, 15413, 11446, 15399, 11392, 15387, 11341, 15374, 11291,
+		15361, 11220, 15337, 11132, 15313, 11045, 15288, 10959, 15265, 10880, 15242, 10805, 15219, 10732, 15196, 10661,
+		15173, 10594, 15151, 10529, 15130, 10470, 15108, 10410, 15086, 10354, 15065, 10298, 15045, 10249, 15025, 10161,
+		15005, 10071, 14985, 9979, 14966, 9893, 14946, 9811, 14928, 9737, 14910, 9665, 14891, 9592, 14873, 9523,
+		14855, 9455, 14837, 9389, 14820, 9331, 14803, 9277, 14786, 9223, 14770, 9128, 14753, 9030, 14738, 8941,
+		14721, 8846, 14705, 8761, 14690, 8680, 14675, 8599, 14660, 8528, 14645, 8459, 14631, 8391, 14616, 8326,
+		14602, 8269, 14588, 8209, 14574, 8112, 14561, 8012, 14547, 7913, 14534, 7814, 14521, 7725, 14508, 7640,
+		14495, 7559, 14482, 7476, 14470, 7403, 14458, 7336, 14446, 7272, 14435, 7207, 14423, 7125, 14411, 7010,
+		14400, 6912, 14389, 6804, 14378, 6704, 14367, 6612, 14357, 6532, 14346, 6446, 14335, 6368, 14315, 6293,
+		14294, 6219, 14275, 6155, 14255, 6049, 14237, 5943, 14217, 5821, 14197, 5703, 14179, 5608, 14161, 5519,
+		14143, 5438, 14125, 5348, 14108, 5273, 14090, 5192, 14073, 5125, 14055, 4989, 14039, 4885, 14022, 4760,
+		14006, 4642, 13990, 4532, 13974, 4434, 13958, 4344, 13943, 4282, 13928, 4194, 13913, 4114, 13898, 4003,
+		13883, 3857, 13868, 3709, 13854, 3584, 13839, 3473, 13825, 3385, 13811, 3287, 13798, 3206, 13785, 3134,
+		13771, 3036, 13758, 2884, 13746, 2779, 13733, 2653, 13720, 2501, 13708, 2402, 13696, 2291, 13684, 2211,
+		13672, 2112, 13660, 2007, 13649, 1872, 13637, 1718, 13625, 1557, 13614, 1446, 13603, 1317, 13592, 1230,
+		13581, 1128, 13571, 1048, 13560, 951, 13550, 878, 13538, 776, 13529, 724, 13519, 657, 13509, 614,
+		13499, 550, 13489, 492, 13479, 448, 13470, 412, 13460, 367, 13451, 333, 13442, 284, 13433, 263,
+		13424, 233, 13415, 208, 13406, 185, 13398, 162, 13389, 144, 13381, 120, 13372, 99, 13364, 86,
+		16444, 19693, 16465, 19421, 16485, 19138, 16504, 18947, 16522, 18805, 16540, 18691, 16557, 18599, 16574, 18521,
+		16589, 18453, 16603, 18351, 16616, 18243, 16629, 18147, 16641, 18060, 16651, 17977, 16661, 17902, 16669, 17832,
+		16676, 17764, 16683, 17704, 16689, 17646, 16693, 17590, 16698, 17539, 16700, 17489, 16702, 17442, 16704, 17389,
+		16704, 17303, 16703, 17221, 16702, 17145, 16700, 17071, 16698, 16999, 16695, 16933, 16691, 16867, 16686, 16805,
+		16681, 16745, 16676, 16690, 16669, 16635, 16663, 16582, 16656, 16532, 16648, 16484, 16640, 16438, 16632, 16394,
+		16624, 16320, 16615, 16238, 16605, 16160, 16596, 16085, 16586, 16014, 16576, 15945, 16566, 15879, 16556, 15817,
+		16546, 15755, 16535, 15697, 16524, 15641, 16514, 15588, 16502, 15536, 16491, 15487, 16480, 15440, 16469, 15394,
+		16458, 15342, 16447, 15259, 16435, 15179, 16424, 15102, 16413, 15029, 16401, 14957, 16390, 14890, 16374, 14825,
+		16351, 14762, 16328, 14702, 16306, 14645, 16284, 14589, 16262, 14537, 16239, 14486, 16218, 14438, 16196, 14391,
+		16175, 14347, 16153, 14271, 16131, 14188, 16110, 14109, 16089, 14032, 16068, 13961, 16048, 13892, 16026, 13823,
+		16006, 13759, 15987, 13699, 15967, 13641, 15947, 13583, 15927, 13529, 15908, 13476, 15889, 13426, 15870, 13379,
+		15851, 13333, 15833, 13265, 15814, 13180, 15796, 13100, 15778, 13021, 15760, 12947, 15743, 12876, 15725, 12806,
+		15708, 12741, 15692, 12678, 15675, 12617, 15658, 12559, 15642, 12503, 15626, 12450, 15610, 12398, 15595, 12350,
+		15579, 12303, 15564, 12228, 15549, 12140, 15534, 12057, 15520, 11980, 15505, 11903, 15491, 11830, 15477, 11761,
+		15463, 11694, 15449, 11629, 15435, 11567, 15422, 11508, 15409, 11452, 15396, 11398, 15383, 11347, 15371, 11297,
+		15356, 11235, 15332, 11143, 15308, 11058, 15284, 10973, 15260, 10894, 15238, 10820, 15214, 10744, 15191, 10672,
+		15169, 10607, 15148, 10543, 15126, 10481, 15104, 10421, 15083, 10365, 15063, 10312, 15042, 10261, 15022, 10179,
+		15002, 10085, 14982, 9996, 14963, 9909, 14945, 9831, 14926, 9751, 14907, 9675, 14889, 9603, 14872, 9537,
+		14855, 9476, 14837, 9413, 14820, 9354, 14802, 9294, 14786, 9238, 14769, 9153, 14752, 9055, 14737, 8961,
+		14721, 8871, 14705, 8785, 14690, 8703, 14675, 8628, 14660, 8550, 14645, 8480, 14630, 8410, 14616, 8344,
+		14602, 8286, 14588, 8230, 14574, 8150, 14561, 8043, 14547, 7947, 14534, 7846, 14521, 7756, 14508, 7670,
+		14496, 7587, 14483, 7506, 14471, 7435, 14459, 7364, 14447, 7296, 14435, 7230, 14423, 7165, 14412, 7055,
+		14401, 6951, 14390, 6843, 14379, 6747, 14368, 6649, 14358, 6567, 14347, 6483, 14337, 6399, 14317, 6322,
+		14297, 6257, 14277, 6188, 14258, 6104, 14238, 5975, 14219, 5859, 14200, 5753, 14181, 5655, 14164, 5569,
+		14145, 5473, 14127, 5381, 14109, 5300, 14092, 5227, 14075, 5164, 14058, 5071, 14041, 4932, 14025, 4808,
+		14008, 4698, 13992, 4595, 13977, 4508, 13961, 4407, 13945, 4306, 13930, 4225, 13915, 4139, 13900, 4038,
+		13885, 3936, 13871, 3802, 13856, 3674, 13843, 3576, 13828, 3459, 13814, 3345, 13800, 3245, 13787, 3156,
+		13774, 3081, 13761, 2959, 13748, 2810, 13735, 2688, 13722, 2547, 13711, 2472, 13699, 2362, 13686, 2255,
+		13675, 2172, 13663, 2071, 13651, 1954, 13639, 1774, 13628, 1657, 13617, 1536, 13605, 1403, 13594, 1282,
+		13584, 1195, 13573, 1071, 13562, 1005, 13552, 898, 13541, 821, 13531, 778, 13521, 693, 13511, 622,
+		13500, 563, 13491, 523, 13481, 468, 13472, 422, 13463, 380, 13454, 352, 13444, 318, 13435, 284,
+		13426, 239, 13417, 211, 13409, 194, 13399, 163, 13391, 149, 13383, 127, 13374, 107, 13366, 90,
+		16426, 19649, 16445, 19350, 16464, 19080, 16482, 18893, 16499, 18757, 16516, 18648, 16532, 18558, 16548, 18482,
+		16562, 18399, 16576, 18285, 16589, 18182, 16600, 18088, 16612, 18004, 16622, 17925, 16631, 17853, 16639, 17784,
+		16646, 17721, 16653, 17662, 16658, 17606, 16663, 17554, 16667, 17504, 16670, 17456, 16673, 17412, 16673, 17329,
+		16674, 17248, 16674, 17171, 16673, 17096, 16671, 17024, 16669, 16957, 16666, 16891, 16663, 16830, 16659, 16770,
+		16654, 16712, 16649, 16657, 16643, 16605, 16637, 16554, 16630, 16506, 16623, 16459, 16616, 16415, 16609, 16361,
+		16601, 16280, 16592, 16200, 16583, 16124, 16575, 16053, 16565, 15983, 16556, 15916, 16547, 15853, 16537, 15791,
+		16527, 15732, 16517, 15675, 16506, 15621, 16496, 15569, 16485, 15519, 16475, 15471, 16464, 15425, 16454, 15381,
+		16443, 15315, 16432, 15233, 16421, 15154, 16410, 15080, 16399, 15007, 16388, 14939, 16371, 14873, 16349, 14808,
+		16327, 14748, 16305, 14689, 16284, 14632, 16262, 14578, 16240, 14526, 16219, 14476, 16198, 14428, 16177, 14382,
+		16156, 14340, 16135, 14257, 16114, 14177, 16094, 14099, 16073, 14023, 16052, 13952, 16032, 13882, 16012, 13817,
+		15993, 13754, 15973, 13692, 15953, 13633, 15934, 13577, 15915, 13524, 15896, 13473, 15877, 13423, 15859, 13376,
+		15840, 13330, 15822, 13261, 15804, 13176, 15786, 13096, 15768, 13018, 15751, 12945, 15734, 12874, 15717, 12806,
+		15700, 12741, 15684, 12679, 15667, 12618, 15651, 12560, 15635, 12505, 15619, 12451, 15604, 12401, 15588, 12351,
+		15573, 12305, 15558, 12231, 15543, 12146, 15529, 12063, 15514, 11984, 15500, 11907, 15486, 11834, 15472, 11767,
+		15458, 11699, 15445, 11635, 15432, 11574, 15418, 11515, 15405, 11459, 15392, 11403, 15380, 11353, 15367, 11302,
+		15350, 11245, 15326, 11157, 15302, 11070, 15279, 10985, 15255, 10903, 15232, 10829, 15210, 10756, 15187, 10685,
+		15166, 10621, 15144, 10554, 15122, 10492, 15101, 10433, 15080, 10376, 15060, 10323, 15040, 10271, 15020, 10204,
+		15000, 10109, 14981, 10020, 14961, 9932, 14942, 9847, 14924, 9768, 14906, 9694, 14887, 9621, 14870, 9554,
+		14852, 9484, 14834, 9420, 14817, 9361, 14801, 9307, 14785, 9257, 14768, 9189, 14752, 9090, 14736, 8992,
+		14720, 8896, 14704, 8809, 14689, 8725, 14674, 8647, 14659, 8569, 14644, 8502, 14630, 8432, 14615, 8365,
+		14602, 8306, 14588, 8248, 14574, 8182, 14561, 8078, 14547, 7975, 14534, 7880, 14521, 7785, 14508, 7695,
+		14496, 7618, 14484, 7534, 14471, 7458, 14460, 7389, 14448, 7319, 14436, 7254, 14425, 7196, 14413, 7106,
+		14402, 6986, 14391, 6881, 14380, 6776, 14369, 6680, 14358, 6597, 14348, 6509, 14338, 6430, 14319, 6360,
+		14299, 6284, 14279, 6219, 14259, 6149, 14240, 6036, 14221, 5920, 14202, 5803, 14183, 5702, 14164, 5596,
+		14146, 5504, 14129, 5416, 14111, 5336, 14094, 5268, 14076, 5184, 14060, 5116, 14043, 4977, 14026, 4860,
+		14010, 4749, 13994, 4639, 13978, 4533, 13962, 4433, 13947, 4345, 13932, 4274, 13918, 4210, 13903, 4124,
+		13888, 3989, 13873, 3859, 13858, 3715, 13845, 3615, 13831, 3515, 13817, 3413, 13804, 3325, 13791, 3250,
+		13777, 3141, 13764, 3044, 13750, 2883, 13738, 2758, 13725, 2608, 13713, 2504, 13701, 2396, 13689, 2296,
+		13676, 2196, 13665, 2108, 13653, 2032, 13641, 1853, 13630, 1716, 13619, 1600, 13608, 1442, 13597, 1342,
+		13586, 1234, 13575, 1139, 13565, 1037, 13554, 964, 13544, 885, 13534, 812, 13523, 730, 13513, 662,
+		13504, 617, 13494, 553, 13485, 500, 13475, 458, 13465, 409, 13456, 363, 13446, 317, 13438, 295,
+		13429, 263, 13420, 236, 13411, 203, 13402, 174, 13394, 153, 13385, 135, 13377, 113, 13368, 94,
+		16407, 19609, 16425, 19282, 16443, 19019, 16461, 18844, 16477, 18711, 16493, 18606, 16508, 18519, 16522, 18444,
+		16537, 18333, 16549, 18220, 16562, 18122, 16573, 18031, 16584, 17949, 16593, 17874, 16603, 17805, 16610, 17740,
+		16618, 17680, 16623, 17621, 16629, 17569, 16634, 17518, 16638, 17470, 16641, 17425, 16643, 17356, 16644, 17272,
+		16645, 17194, 16646, 17121, 16645, 17048, 16643, 16979, 16641, 16914, 16639, 16851, 16635, 16791, 16632, 16734,
+		16628, 16679, 16623, 16626, 16617, 16575, 16612, 16527, 16606, 16480, 16600, 16436, 16593, 16392, 16585, 16318,
+		16578, 16239, 16570, 16162, 16561, 16089, 16554, 16020, 16544, 15951, 16536, 15887, 16527, 15825, 16517, 15765,
+		16508, 15708, 16498, 15653, 16489, 15601, 16478, 15549, 16468, 15500, 16458, 15453, 16448, 15409, 16438, 15365,
+		16427, 15287, 16417, 15209, 16407, 15132, 16396, 15059, 16385, 14988, 16366, 14920, 16345, 14854, 16324, 14792,
+		16303, 14733, 16282, 14675, 16261, 14620, 16241, 14567, 16219, 14515, 16199, 14467, 16178, 14419, 16157, 14374,
+		16136, 14324, 16116, 14241, 16097, 14163, 16077, 14087, 16057, 14013, 16037, 13942, 16016, 13872, 15997, 13809,
+		15978, 13745, 15959, 13685, 15940, 13630, 15921, 13573, 15902, 13519, 15883, 13468, 15865, 13420, 15847, 13373,
+		15829, 13328, 15811, 13256, 15794, 13173, 15776, 13093, 15759, 13017, 15742, 12944, 15725, 12872, 15709, 12804,
+		15693, 12741, 15676, 12678, 15660, 12618, 15644, 12560, 15628, 12505, 15613, 12453, 15597, 12402, 15582, 12355,
+		15567, 12307, 15553, 12237, 15538, 12150, 15523, 12069, 15509, 11989, 15495, 11914, 15481, 11841, 15467, 11771,
+		15454, 11703, 15440, 11640, 15427, 11579, 15414, 11521, 15402, 11465, 15389, 11410, 15376, 11359, 15364, 11310,
+		15344, 11259, 15320, 11169, 15297, 11081, 15273, 10994, 15250, 10917, 15228, 10841, 15205, 10766, 15183, 10695,
+		15161, 10630, 15140, 10564, 15118, 10502, 15098, 10445, 15078, 10389, 15057, 10333, 15037, 10281, 15017, 10225,
+		14998, 10129, 14978, 10039, 14959, 9950, 14940, 9867, 14922, 9791, 14904, 9714, 14886, 9639, 14868, 9567,
+		14850, 9502, 14833, 9438, 14816, 9379, 14799, 9321, 14782, 9264, 14766, 9201, 14750, 9103, 14735, 9014,
+		14720, 8930, 14704, 8840, 14689, 8755, 14674, 8673, 14658, 8594, 14644, 8521, 14629, 8453, 14615, 8385,
+		14601, 8321, 14587, 8262, 14574, 8208, 14560, 8110, 14547, 8010, 14535, 7915, 14521, 7813, 14509, 7726,
+		14496, 7642, 14484, 7563, 14472, 7483, 14460, 7411, 14448, 7344, 14436, 7275, 14425, 7211, 14414, 7143,
+		14402, 7024, 14391, 6920, 14381, 6822, 14370, 6732, 14359, 6629, 14349, 6545, 14338, 6463, 14320, 6378,
+		14300, 6306, 14280, 6236, 14260, 6172, 14242, 6085, 14223, 5961, 14204, 5849, 14185, 5742, 14167, 5649,
+		14150, 5562, 14131, 5464, 14114, 5381, 14096, 5295, 14079, 5222, 14062, 5147, 14045, 5056, 14029, 4926,
+		14012, 4791, 13996, 4689, 13980, 4583, 13965, 4490, 13950, 4399, 13934, 4301, 13919, 4222, 13904, 4142,
+		13890, 4048, 13876, 3932, 13861, 3803, 13847, 3681, 13833, 3564, 13819, 3439, 13806, 3351, 13793, 3272,
+		13780, 3191, 13766, 3095, 13754, 3003, 13742, 2864, 13729, 2717, 13716, 2590, 13703, 2467, 13691, 2353,
+		13679, 2254, 13667, 2161, 13656, 2072, 13644, 1945, 13633, 1795, 13622, 1645, 13611, 1527, 13599, 1402,
+		13588, 1296, 13577, 1164, 13567, 1085, 13556, 979, 13546, 906, 13536, 836, 13526, 752, 13516, 703,
+		13506, 626, 13496, 568, 13487, 536, 13477, 464, 13468, 425, 13458, 381, 13449, 350, 13440, 305,
+		13430, 260, 13422, 235, 13414, 218, 13405, 186, 13396, 159, 13388, 141, 13379, 119, 13371, 99,
+		16389, 19563, 16407, 19217, 16423, 18965, 16440, 18793, 16455, 18666, 16471, 18566, 16485, 18482, 16499, 18391,
+		16512, 18269, 16525, 18162, 16536, 18066, 16547, 17977, 16557, 17898, 16566, 17826, 16575, 17760, 16583, 17697,
+		16589, 17638, 16596, 17584, 16601, 17533, 16606, 17484, 16609, 17437, 16613, 17382, 16615, 17298, 16616, 17218,
+		16617, 17142, 16617, 17071, 16617, 17002, 16616, 16936, 16614, 16873, 16612, 16814, 16609, 16755, 16605, 16699,
+		16602, 16647, 16598, 16596, 16593, 16547, 16588, 16500, 16582, 16455, 16576, 16411, 16570, 16356, 16563, 16276,
+		16556, 16199, 16548, 16125, 16541, 16055, 16532, 15986, 16524, 15922, 16516, 15859, 16507, 15798, 16498, 15740,
+		16489, 15684, 16480, 15631, 16470, 15579, 16461, 15530, 16451, 15482, 16442, 15437, 16432, 15394, 16422, 15342,
+		16413, 15263, 16402, 15184, 16392, 15108, 16380, 15036, 16360, 14967, 16340, 14901, 16320, 14837, 16299, 14776,
+		16279, 14717, 16259, 14660, 16239, 14607, 16218, 14555, 16198, 14504, 16178, 14457, 16158, 14410, 16138, 14366,
+		16118, 14309, 16098, 14227, 16078, 14148, 16059, 14072, 16040, 14000, 16021, 13932, 16002, 13865, 15983, 13801,
+		15964, 13738, 15945, 13679, 15926, 13621, 15908, 13566, 15890, 13515, 15872, 13465, 15853, 13416, 15836, 13369,
+		15818, 13324, 15801, 13252, 15784, 13170, 15766, 13089, 15750, 13013, 15733, 12941, 15716, 12871, 15700, 12804,
+		15684, 12739, 15668, 12677, 15652, 12617, 15636, 12561, 15621, 12507, 15606, 12454, 15591, 12405, 15576, 12355,
+		15561, 12309, 15546, 12241, 15532, 12157, 15518, 12073, 15504, 11995, 15490, 11918, 15476, 11847, 15463, 11777,
+		15450, 11711, 15436, 11646, 15423, 11585, 15410, 11525, 15398, 11471, 15385, 11417, 15373, 11364, 15361, 11316,
+		15338, 11267, 15314, 11179, 15291, 11094, 15267, 11008, 15245, 10929, 15222, 10851, 15200, 10777, 15178, 10706,
+		15157, 10641, 15136, 10577, 15114, 10513, 15094, 10454, 15073, 10398, 15053, 10342, 15033, 10290, 15014, 10243,
+		14995, 10149, 14975, 10054, 14957, 9969, 14938, 9887, 14919, 9805, 14901, 9729, 14883, 9653, 14866, 9587,
+		14849, 9522, 14832, 9456, 14815, 9393, 14798, 9335, 14781, 9280, 14765, 9227, 14749, 9138, 14733, 9037,
+		14717, 8941, 14702, 8851, 14687, 8769, 14672, 8689, 14659, 8625, 14644, 8549, 14630, 8477, 14615, 8410,
+		14601, 8344, 14587, 8283, 14574, 8225, 14560, 8144, 14547, 8041, 14535, 7944, 14522, 7850, 14509, 7757,
+		14497, 7678, 14485, 7591, 14472, 7512, 14461, 7438, 14449, 7370, 14437, 7302, 14425, 7233, 14414, 7176,
+		14403, 7068, 14392, 6962, 14381, 6860, 14371, 6766, 14360, 6664, 14349, 6573, 14339, 6498, 14323, 6421,
+		14302, 6344, 14282, 6268, 14262, 6202, 14243, 6126, 14224, 6010, 14205, 5894, 14187, 5784, 14169, 5690,
+		14151, 5594, 14132, 5492, 14115, 5411, 14098, 5335, 14081, 5259, 14064, 5186, 14047, 5100, 14030, 4975,
+		14015, 4864, 13998, 4739, 13983, 4647, 13968, 4537, 13952, 4437, 13937, 4345, 13922, 4263, 13907, 4191,
+		13892, 4116, 13878, 3982, 13863, 3845, 13849, 3720, 13836, 3615, 13823, 3532, 13809, 3412, 13795, 3305,
+		13782, 3222, 13768, 3123, 13756, 3053, 13743, 2909, 13730, 2759, 13718, 2649, 13706, 2550, 13694, 2436,
+		13682, 2318, 13670, 2218, 13658, 2132, 13647, 2046, 13635, 1876, 13623, 1695, 13612, 1587, 13601, 1460,
+		13591, 1352, 13580, 1240, 13569, 1144, 13559, 1042, 13549, 944, 13539, 875, 13528, 790, 13518, 712,
+		13508, 662, 13499, 600, 13489, 534, 13480, 500, 13470, 453, 13460, 395, 13451, 349, 13442, 316,
+		13434, 289, 13424, 252, 13415, 218, 13407, 185, 13398, 168, 13390, 141, 13381, 120, 13373, 104,
+		16360, 19522, 16388, 19153, 16404, 18913, 16420, 18748, 16435, 18624, 16449, 18527, 16463, 18447, 16475, 18322,
+		16489, 18207, 16500, 18104, 16511, 18011, 16522, 17927, 16531, 17850, 16540, 17781, 16549, 17716, 16556, 17655,
+		16563, 17600, 16569, 17548, 16573, 17497, 16578, 17451, 16582, 17404, 16585, 17321, 16587, 17240, 16589, 17166,
+		16590, 17094, 16591, 17024, 16590, 16957, 16589, 16894, 16588, 16833, 16586, 16775, 16584, 16721, 16580, 16666,
+		16577, 16615, 16573, 16566, 16569, 16519, 16564, 16474, 16558, 16430, 16553, 16389, 16547, 16312, 16540, 16234,
+		16534, 16161, 16527, 16089, 16520, 16020, 16512, 15955, 16504, 15891, 16496, 15830, 16488, 15772, 16479, 15715,
+		16471, 15661, 16462, 15609, 16453, 15558, 16444, 15511, 16435, 15464, 16426, 15420, 16416, 15378, 16407, 15312,
+		16397, 15232, 16388, 15157, 16373, 15085, 16353, 15014, 16334, 14947, 16314, 14882, 16294, 14819, 16274, 14759,
+		16255, 14701, 16235, 14646, 16216, 14593, 16196, 14542, 16177, 14493, 16157, 14446, 16138, 14400, 16119, 14357,
+		16099, 14293, 16080, 14213, 16061, 14136, 16042, 14060, 16023, 13989, 16004, 13920, 15986, 13854, 15968, 13792,
+		15949, 13730, 15931, 13673, 15912, 13615, 15894, 13561, 15877, 13509, 15859, 13459, 15842, 13412, 15824, 13366,
+		15807, 13321, 15790, 13244, 15773, 13163, 15756, 13086, 15740, 13011, 15724, 12939, 15707, 12870, 15691, 12802,
+		15675, 12738, 15659, 12676, 15644, 12618, 15629, 12561, 15613, 12506, 15599, 12455, 15584, 12404, 15569, 12356,
+		15555, 12311, 15541, 12245, 15526, 12159, 15512, 12076, 15498, 11999, 15485, 11925, 15472, 11853, 15458, 11782,
+		15445, 11715, 15432, 11652, 15419, 11591, 15407, 11533, 15394, 11476, 15382, 11422, 15369, 11369, 15355, 11322,
+		15331, 11273, 15308, 11191, 15285, 11106, 15262, 11020, 15239, 10940, 15218, 10865, 15195, 10790, 15173, 10719,
+		15152, 10652, 15131, 10585, 15110, 10522, 15090, 10465, 15070, 10408, 15050, 10354, 15030, 10301, 15010, 10251,
+		14991, 10165, 14972, 10072, 14954, 9987, 14935, 9904, 14917, 9822, 14899, 9744, 14881, 9672, 14864, 9604,
+		14846, 9535, 14829, 9468, 14813, 9410, 14797, 9353, 14780, 9298, 14764, 9241, 14748, 9161, 14732, 9065,
+		14717, 8972, 14702, 8886, 14687, 8798, 14672, 8714, 14656, 8632, 14642, 8560, 14628, 8491, 14614, 8420,
+		14601, 8365, 14587, 8303, 14574, 8245, 14561, 8186, 14548, 8077, 14535, 7978, 14522, 7882, 14509, 7788,
+		14497, 7701, 14485, 7623, 14473, 7539, 14461, 7462, 14449, 7394, 14438, 7324, 14426, 7261, 14415, 7201,
+		14404, 7120, 14393, 7008, 14382, 6893, 14371, 6799, 14360, 6699, 14350, 6611, 14340, 6530, 14323, 6448,
+		14303, 6371, 14284, 6296, 14264, 6232, 14245, 6166, 14226, 6058, 14208, 5948, 14189, 5837, 14171, 5728,
+		14152, 5625, 14135, 5534, 14117, 5447, 14100, 5364, 14083, 5295, 14066, 5209, 14050, 5145, 14034, 5049,
+		14017, 4920, 14001, 4800, 13985, 4675, 13970, 4582, 13954, 4490, 13940, 4406, 13924, 4309, 13909, 4221,
+		13895, 4148, 13880, 4048, 13866, 3921, 13853, 3803, 13838, 3671, 13825, 3566, 13811, 3448, 13797, 3355,
+		13784, 3276, 13771, 3196, 13758, 3107, 13745, 2973, 13732, 2812, 13720, 2690, 13707, 2566, 13695, 2453,
+		13684, 2372, 13672, 2262, 13660, 2164, 13649, 2089, 13638, 1957, 13626, 1790, 13615, 1661, 13604, 1533,
+		13593, 1380, 13583, 1305, 13573, 1201, 13562, 1074, 13552, 1000, 13541, 925, 13531, 819, 13521, 765,
+		13511, 694, 13501, 612, 13491, 564, 13482, 511, 13472, 459, 13463, 421, 13454, 382, 13445, 338,
+		13436, 297, 13427, 268, 13418, 233, 13410, 207, 13401, 176, 13392, 152, 13384, 128, 13375, 108,
+		16326, 19485, 16357, 19092, 16386, 18861, 16401, 18704, 16415, 18584, 16428, 18490, 16441, 18394, 16454, 18263,
+		16466, 18149, 16476, 18045, 16487, 17957, 16497, 17876, 16506, 17803, 16515, 17736, 16523, 17675, 16530, 17615,
+		16536, 17562, 16542, 17512, 16547, 17464, 16552, 17420, 16556, 17345, 16559, 17264, 16561, 17186, 16563, 17116,
+		16564, 17045, 16564, 16977, 16564, 16913, 16564, 16853, 16563, 16795, 16561, 16739, 16559, 16686, 16556, 16634,
+		16553, 16584, 16549, 16536, 16545, 16491, 16540, 16448, 16536, 16405, 16530, 16346, 16524, 16268, 16519, 16194,
+		16512, 16122, 16506, 16053, 16499, 15986, 16492, 15923, 16484, 15861, 16477, 15802, 16469, 15745, 16461, 15690,
+		16453, 15638, 16445, 15587, 16436, 15538, 16427, 15491, 16418, 15446, 16409, 15403, 16401, 15361, 16392, 15282,
+		16381, 15205, 16363, 15133, 16344, 15060, 16326, 14992, 16307, 14925, 16288, 14861, 16269, 14801, 16251, 14743,
+		16232, 14686, 16213, 14632, 16193, 14579, 16174, 14529, 16156, 14481, 16137, 14435, 16118, 14390, 16099, 14347,
+		16081, 14276, 16062, 14197, 16044, 14121, 16025, 14049, 16006, 13977, 15988, 13910, 15970, 13844, 15952, 13781,
+		15934, 13720, 15917, 13665, 15898, 13608, 15881, 13555, 15864, 13505, 15846, 13454, 15830, 13407, 15812, 13361,
+		15795, 13317, 15779, 13240, 15763, 13160, 15746, 13081, 15730, 13006, 15714, 12934, 15698, 12866, 15682, 12800,
+		15667, 12737, 15651, 12676, 15636, 12616, 15621, 12562, 15606, 12506, 15591, 12455, 15577, 12405, 15562, 12357,
+		15548, 12312, 15534, 12245, 15520, 12162, 15507, 12081, 15493, 12003, 15480, 11928, 15466, 11855, 15453, 11786,
+		15440, 11720, 15428, 11658, 15415, 11596, 15402, 11537, 15390, 11482, 15378, 11429, 15366, 11375, 15348, 11326,
+		15325, 11280, 15301, 11200, 15278, 11116, 15256, 11031, 15234, 10952, 15212, 10875, 15190, 10799, 15168, 10729,
+		15147, 10662, 15127, 10597, 15106, 10534, 15086, 10476, 15065, 10416, 15045, 10362, 15026, 10311, 15007, 10261,
+		14988, 10184, 14969, 10093, 14950, 10005, 14932, 9918, 14914, 9838, 14896, 9763, 14879, 9691, 14861, 9618,
+		14844, 9550, 14828, 9487, 14811, 9424, 14795, 9365, 14778, 9307, 14762, 9253, 14747, 9189, 14732, 9096,
+		14716, 9000, 14701, 8906, 14686, 8822, 14671, 8739, 14657, 8663, 14643, 8590, 14628, 8516, 14614, 8446,
+		14600, 8378, 14587, 8316, 14573, 8257, 14560, 8202, 14548, 8115, 14535, 8014, 14522, 7914, 14510, 7822,
+		14498, 7733, 14485, 7649, 14473, 7565, 14461, 7491, 14449, 7417, 14438, 7353, 14427, 7287, 14415, 7223,
+		14404, 7159, 14393, 7042, 14383, 6943, 14372, 6841, 14362, 6746, 14351, 6648, 14341, 6562, 14325, 6481,
+		14305, 6403, 14286, 6326, 14267, 6261, 14247, 6192, 14228, 6115, 14210, 6005, 14191, 5886, 14173, 5780,
+		14155, 5671, 14138, 5588, 14120, 5491, 14103, 5407, 14085, 5318, 14069, 5251, 14052, 5180, 14036, 5108,
+		14019, 4966, 14004, 4849, 13988, 4742, 13973, 4641, 13957, 4540, 13942, 4431, 13927, 4344, 13912, 4267,
+		13898, 4190, 13884, 4120, 13868, 3972, 13855, 3857, 13841, 3732, 13827, 3627, 13814, 3523, 13800, 3419,
+		13787, 3312, 13774, 3221, 13761, 3140, 13748, 3065, 13736, 2945, 13723, 2790, 13711, 2660, 13698, 2507,
+		13686, 2406, 13674, 2300, 13663, 2207, 13652, 2117, 13640, 2037, 13629, 1888, 13618, 1738, 13608, 1605,
+		13597, 1479, 13586, 1362, 13575, 1239, 13564, 1133, 13554, 1044, 13543, 946, 13533, 869, 13524, 808,
+		13514, 728, 13504, 663, 13494, 610, 13485, 533, 13475, 481, 13466, 441, 13456, 388, 13447, 344,
+		13438, 317, 13429, 280, 13420, 236, 13412, 211, 13403, 184, 13395, 158, 13386, 136, 13378, 113,
+		16294, 19440, 16323, 19038, 16352, 18813, 16380, 18661, 16395, 18547, 16408, 18455, 16420, 18326, 16432, 18200,
+		16443, 18090, 16454, 17995, 16464, 17908, 16474, 17830, 16483, 17759, 16491, 17693, 16498, 17633, 16505, 17579,
+		16511, 17526, 16517, 17477, 16522, 17432, 16526, 17367, 16530, 17287, 16533, 17208, 16535, 17135, 16538, 17065,
+		16539, 16997, 16539, 16933, 16539, 16871, 16539, 16814, 16538, 16758, 16537, 16704, 16534, 16652, 16532, 16602,
+		16529, 16554, 16526, 16509, 16521, 16463, 16518, 16422, 16513, 16379, 16508, 16301, 16503, 16226, 16497, 16154,
+		16491, 16084, 16485, 16018, 16479, 15952, 16472, 15891, 16465, 15831, 16458, 15774, 16450, 15719, 16443, 15665,
+		16435, 15615, 16427, 15565, 16419, 15517, 16411, 15472, 16402, 15428, 16394, 15386, 16385, 15331, 16369, 15253,
+		16352, 15178, 16333, 15104, 16316, 15035, 16298, 14968, 16280, 14904, 16263, 14843, 16244, 14783, 16226, 14725,
+		16207, 14670, 16189, 14617, 16171, 14566, 16153, 14517, 16134, 14469, 16116, 14424, 16098, 14380, 16080, 14338,
+		16061, 14257, 16043, 14180, 16025, 14106, 16007, 14033, 15990, 13964, 15972, 13899, 15954, 13833, 15937, 13772,
+		15919, 13712, 15902, 13655, 15884, 13599, 15867, 13548, 15850, 13496, 15834, 13449, 15817, 13402, 15800, 13357,
+		15784, 13314, 15768, 13232, 15751, 13150, 15736, 13076, 15720, 13004, 15704, 12932, 15688, 12862, 15673, 12796,
+		15658, 12734, 15643, 12674, 15628, 12614, 15613, 12561, 15599, 12507, 15584, 12454, 15570, 12405, 15556, 12358,
+		15541, 12312, 15528, 12248, 15514, 12163, 15500, 12083, 15487, 12006, 15474, 11931, 15461, 11862, 15448, 11790,
+		15435, 11724, 15423, 11661, 15410, 11600, 15398, 11542, 15386, 11487, 15374, 11433, 15362, 11381, 15340, 11332,
+		15318, 11285, 15294, 11213, 15272, 11126, 15250, 11044, 15227, 10960, 15206, 10886, 15184, 10810, 15164, 10741,
+		15143, 10674, 15122, 10607, 15101, 10545, 15082, 10486, 15061, 10427, 15042, 10373, 15023, 10322, 15003, 10270,
+		14984, 10203, 14966, 10114, 14948, 10024, 14929, 9937, 14911, 9857, 14893, 9778, 14876, 9704, 14859, 9632,
+		14842, 9565, 14826, 9502, 14809, 9439, 14792, 9376, 14777, 9323, 14761, 9268, 14745, 9217, 14730, 9116,
+		14714, 9017, 14700, 8931, 14685, 8848, 14671, 8766, 14656, 8685, 14642, 8608, 14628, 8537, 14614, 8470,
+		14601, 8406, 14588, 8343, 14574, 8282, 14560, 8220, 14547, 8139, 14535, 8037, 14522, 7939, 14509, 7845,
+		14497, 7758, 14486, 7680, 14473, 7595, 14461, 7517, 14450, 7444, 14438, 7377, 14427, 7306, 14416, 7243,
+		14405, 7186, 14394, 7086, 14383, 6974, 14373, 6880, 14362, 6778, 14352, 6685, 14342, 6597, 14327, 6517,
+		14308, 6443, 14287, 6359, 14268, 6285, 14249, 6221, 14230, 6153, 14211, 6048, 14193, 5932, 14175, 5824,
+		14157, 5717, 14140, 5632, 14122, 5529, 14105, 5448, 14088, 5363, 14071, 5286, 14054, 5210, 14038, 5139,
+		14022, 5019, 14006, 4909, 13991, 4798, 13975, 4685, 13959, 4568, 13944, 4483, 13930, 4401, 13915, 4313,
+		13900, 4226, 13885, 4143, 13870, 4041, 13857, 3923, 13844, 3815, 13829, 3676, 13816, 3564, 13803, 3463,
+		13790, 3369, 13777, 3279, 13764, 3193, 13751, 3110, 13738, 2975, 13726, 2833, 13714, 2718, 13702, 2611,
+		13690, 2507, 13678, 2390, 13667, 2273, 13655, 2173, 13643, 2079, 13632, 1928, 13621, 1815, 13609, 1656,
+		13599, 1533, 13588, 1395, 13577, 1297, 13567, 1202, 13557, 1107, 13546, 979, 13536, 911, 13526, 832,
+		13516, 750, 13506, 680, 13497, 624, 13487, 565, 13478, 515, 13468, 451, 13459, 405, 13450, 366,
+		13441, 323, 13432, 287, 13423, 255, 13414, 222, 13405, 185, 13397, 165, 13389, 140, 13380, 118,
+		16262, 19369, 16290, 18984, 16317, 18768, 16343, 18619, 16369, 18510, 16389, 18412, 16400, 18266, 16412, 18142,
+		16423, 18038, 16432, 17943, 16442, 17860, 16451, 17784, 16460, 17717, 16467, 17653, 16474, 17595, 16481, 17542,
+		16487, 17492, 16492, 17444, 16498, 17393, 16502, 17309, 16505, 17230, 16508, 17154, 16511, 17084, 16513, 17016,
+		16514, 16952, 16515, 16890, 16515, 16831, 16514, 16774, 16514, 16720, 16512, 16668, 16511, 16619, 16508, 16570,
+		16506, 16525, 16503, 16481, 16500, 16439, 16495, 16397, 16491, 16331, 16486, 16256, 16482, 16184, 16476, 16114,
+		16471, 16047, 16465, 15981, 16459, 15920, 16452, 15859, 16446, 15802, 16439, 15745, 16432, 15692, 16425, 15641,
+		16417, 15591, 16410, 15543, 16402, 15497, 16394, 15453, 16386, 15411, 16372, 15369, 16356, 15299, 16339, 15222,
+		16322, 15149, 16305, 15079, 16288, 15011, 16271, 14945, 16254, 14882, 16236, 14822, 16219, 14763, 16201, 14708,
+		16184, 14654, 16166, 14602, 16149, 14552, 16131, 14503, 16113, 14457, 16096, 14413, 16078, 14369, 16059, 14318,
+		16042, 14239, 16025, 14164, 16007, 14088, 15990, 14019, 15973, 13951, 15955, 13885, 15938, 13822, 15921, 13762,
+		15904, 13703, 15887, 13647, 15870, 13592, 15854, 13541, 15837, 13490, 15821, 13443, 15804, 13396, 15789, 13352,
+		15773, 13308, 15757, 13225, 15741, 13148, 15725, 13071, 15709, 12995, 15694, 12926, 15679, 12859, 15664, 12795,
+		15649, 12731, 15634, 12671, 15619, 12613, 15605, 12559, 15590, 12505, 15576, 12454, 15562, 12405, 15548, 12357,
+		15535, 12313, 15521, 12250, 15508, 12166, 15494, 12086, 15481, 12008, 15468, 11934, 15455, 11861, 15442, 11792,
+		15430, 11728, 15418, 11667, 15406, 11604, 15394, 11547, 15382, 11491, 15370, 11437, 15356, 11385, 15333, 11337,
+		15310, 11289, 15288, 11224, 15265, 11137, 15244, 11054, 15221, 10971, 15200, 10895, 15179, 10821, 15157, 10748,
+		15137, 10683, 15116, 10616, 15097, 10555, 15077, 10496, 15057, 10438, 15037, 10382, 15019, 10331, 14999, 10279,
+		14981, 10222, 14963, 10131, 14944, 10041, 14926, 9953, 14909, 9873, 14891, 9796, 14874, 9723, 14857, 9649,
+		14840, 9581, 14823, 9516, 14807, 9453, 14791, 9393, 14775, 9338, 14759, 9282, 14744, 9227, 14728, 9140,
+		14714, 9049, 14699, 8956, 14684, 8868, 14669, 8782, 14655, 8703, 14641, 8629, 14627, 8559, 14614, 8487,
+		14600, 8422, 14587, 8358, 14574, 8299, 14561, 8245, 14548, 8187, 14535, 8082, 14522, 7979, 14510, 7881,
+		14497, 7787, 14485, 7698, 14473, 7620, 14461, 7540, 14450, 7471, 14439, 7401, 14428, 7334, 14416, 7269,
+		14405, 7208, 14394, 7129, 14384, 7021, 14373, 6915, 14363, 6822, 14352, 6723, 14342, 6634, 14328, 6545,
+		14308, 6462, 14289, 6386, 14270, 6318, 14251, 6252, 14232, 6184, 14214, 6104, 14195, 5979, 14177, 5871,
+		14159, 5769, 14142, 5666, 14124, 5574, 14106, 5477, 14090, 5403, 14073, 5323, 14057, 5248, 14040, 5170,
+		14025, 5102, 14009, 4978, 13993, 4845, 13977, 4728, 13961, 4623, 13946, 4529, 13931, 4436, 13916, 4338,
+		13902, 4254, 13888, 4189, 13874, 4118, 13860, 4000, 13845, 3852, 13832, 3730, 13818, 3620, 13805, 3516,
+		13792, 3412, 13779, 3310, 13766, 3223, 13753, 3147, 13741, 3066, 13729, 2939, 13717, 2790, 13704, 2636,
+		13692, 2516, 13681, 2420, 13669, 2318, 13658, 2246, 13646, 2145, 13635, 2061, 13623, 1900, 13612, 1742,
+		13601, 1584, 13591, 1475, 13580, 1348, 13570, 1248, 13559, 1121, 13549, 1036, 13539, 964, 13529, 863,
+		13519, 792, 13509, 713, 13499, 646, 13490, 580, 13480, 532, 13471, 484, 13462, 435, 13453, 383,
+		13444, 342, 13435, 302, 13426, 261, 13417, 229, 13409, 208, 13399, 169, 13392, 150, 13383, 123,
+		16231, 19305, 16258, 18934, 16283, 18723, 16309, 18582, 16332, 18473, 16356, 18347, 16378, 18205, 16392, 18088,
+		16402, 17986, 16412, 17896, 16421, 17814, 16429, 17742, 16437, 17675, 16445, 17614, 16452, 17560, 16458, 17506,
+		16464, 17458, 16469, 17413, 16474, 17333, 16478, 17253, 16481, 17176, 16484, 17104, 16487, 17035, 16488, 16969,
+		16490, 16907, 16491, 16850, 16491, 16792, 16491, 16736, 16490, 16684, 16489, 16634, 16488, 16586, 16486, 16540,
+		16483, 16495, 16480, 16453, 16477, 16412, 16474, 16363, 16469, 16285, 16465, 16212, 16461, 16143, 16456, 16075,
+		16451, 16010, 16445, 15948, 16439, 15887, 16433, 15829, 16427, 15772, 16421, 15719, 16414, 15667, 16407, 15616,
+		16400, 15569, 16393, 15523, 16386, 15477, 16372, 15434, 16357, 15393, 16341, 15345, 16326, 15269, 16309, 15193,
+		16294, 15123, 16277, 15054, 16261, 14986, 16244, 14923, 16227, 14861, 16211, 14802, 16194, 14745, 16177, 14689,
+		16160, 14637, 16143, 14586, 16126, 14537, 16108, 14489, 16092, 14445, 16074, 14401, 16057, 14358, 16040, 14300,
+		16023, 14221, 16006, 14146, 15989, 14074, 15972, 14005, 15955, 13936, 15939, 13873, 15922, 13810, 15906, 13751,
+		15889, 13693, 15873, 13639, 15856, 13585, 15840, 13534, 15824, 13484, 15808, 13437, 15792, 13390, 15776, 13347,
+		15760, 13296, 15745, 13216, 15730, 13140, 15714, 13063, 15699, 12991, 15685, 12924, 15669, 12854, 15654, 12789,
+		15640, 12728, 15625, 12670, 15611, 12613, 15597, 12557, 15582, 12503, 15569, 12453, 15555, 12405, 15541, 12357,
+		15528, 12313, 15515, 12251, 15501, 12166, 15488, 12087, 15475, 12010, 15463, 11936, 15450, 11866, 15437, 11797,
+		15425, 11733, 15413, 11669, 15401, 11608, 15389, 11550, 15377, 11496, 15366, 11442, 15347, 11390, 15325, 11341,
+		15302, 11294, 15280, 11233, 15258, 11146, 15236, 11062, 15215, 10982, 15194, 10904, 15173, 10834, 15152, 10761,
+		15132, 10693, 15112, 10628, 15091, 10562, 15072, 10505, 15052, 10445, 15033, 10392, 15015, 10340, 14996, 10289,
+		14977, 10240, 14959, 10148, 14941, 10056, 14923, 9969, 14906, 9893, 14888, 9813, 14871, 9738, 14854, 9665,
+		14838, 9596, 14821, 9531, 14805, 9468, 14789, 9408, 14773, 9351, 14758, 9295, 14742, 9240, 14728, 9172,
+		14713, 9075, 14698, 8981, 14683, 8887, 14669, 8807, 14654, 8727, 14640, 8649, 14626, 8575, 14612, 8504,
+		14599, 8440, 14586, 8380, 14573, 8317, 14559, 8255, 14546, 8200, 14534, 8103, 14522, 8007, 14510, 7915,
+		14498, 7826, 14486, 7741, 14473, 7649, 14462, 7571, 14450, 7494, 14439, 7421, 14427, 7353, 14416, 7285,
+		14406, 7230, 14395, 7170, 14384, 7059, 14373, 6951, 14363, 6853, 14353, 6758, 14343, 6664, 14329, 6575,
+		14310, 6497, 14290, 6417, 14271, 6347, 14251, 6271, 14233, 6204, 14214, 6139, 14196, 6022, 14178, 5919,
+		14161, 5816, 14143, 5705, 14126, 5610, 14108, 5516, 14092, 5435, 14075, 5353, 14059, 5272, 14042, 5203,
+		14026, 5136, 14010, 5025, 13994, 4890, 13979, 4787, 13963, 4678, 13949, 4580, 13933, 4471, 13919, 4385,
+		13904, 4305, 13890, 4230, 13876, 4143, 13861, 4039, 13848, 3903, 13835, 3805, 13821, 3687, 13808, 3558,
+		13795, 3466, 13782, 3358, 13769, 3282, 13755, 3176, 13743, 3097, 13730, 2950, 13719, 2844, 13707, 2718,
+		13694, 2588, 13683, 2481, 13670, 2348, 13659, 2240, 13647, 2159, 13636, 2064, 13626, 1996, 13615, 1830,
+		13604, 1690, 13594, 1549, 13583, 1422, 13572, 1297, 13562, 1178, 13552, 1091, 13541, 987, 13531, 901,
+		13521, 814, 13511, 744, 13502, 671, 13492, 610, 13483, 547, 13474, 497, 13465, 442, 13455, 395,
+		13446, 355, 13437, 308, 13428, 280, 13420, 242, 13410, 203, 13402, 179, 13394, 153, 13385, 129,
+		16201, 19246, 16226, 18883, 16251, 18680, 16274, 18542, 16297, 18440, 16320, 18286, 16340, 18148, 16361, 18034,
+		16380, 17935, 16391, 17848, 16400, 17770, 16408, 17700, 16416, 17637, 16423, 17578, 16430, 17523, 16436, 17473,
+		16441, 17426, 16446, 17358, 16450, 17274, 16455, 17198, 16458, 17124, 16461, 17054, 16464, 16988, 16465, 16924,
+		16467, 16865, 16468, 16808, 16468, 16754, 16468, 16700, 16467, 16649, 16466, 16601, 16465, 16555, 16463, 16510,
+		16461, 16468, 16458, 16426, 16456, 16387, 16452, 16314, 16449, 16242, 16445, 16170, 16440, 16102, 16436, 16037,
+		16431, 15974, 16426, 15913, 16420, 15854, 16414, 15798, 16409, 15743, 16403, 15691, 16396, 15640, 16390, 15593,
+		16382, 15545, 16368, 15500, 16354, 15457, 16340, 15415, 16326, 15375, 16311, 15311, 16295, 15235, 16280, 15164,
+		16265, 15094, 16249, 15027, 16233, 14961, 16217, 14900, 16201, 14839, 16185, 14782, 16169, 14726, 16152, 14672,
+		16136, 14619, 16119, 14570, 16103, 14522, 16087, 14477, 16070, 14432, 16053, 14388, 16037, 14348, 16021, 14280,
+		16004, 14203, 15988, 14129, 15971, 14058, 15955, 13989, 15938, 13923, 15923, 13861, 15906, 13797, 15890, 13739,
+		15874, 13683, 15858, 13629, 15842, 13575, 15826, 13526, 15811, 13477, 15795, 13431, 15780, 13386, 15764, 13342,
+		15748, 13287, 15733, 13207, 15718, 13130, 15703, 13054, 15688, 12984, 15674, 12916, 15659, 12850, 15645, 12787,
+		15631, 12725, 15616, 12664, 15603, 12610, 15589, 12555, 15575, 12503, 15561, 12453, 15548, 12404, 15534, 12357,
+		15521, 12312, 15508, 12250, 15495, 12169, 15482, 12089, 15469, 12012, 15457, 11938, 15444, 11868, 15432, 11800,
+		15420, 11735, 15408, 11672, 15396, 11613, 15384, 11555, 15373, 11500, 15361, 11445, 15339, 11394, 15316, 11345,
+		15294, 11298, 15272, 11239, 15251, 11154, 15229, 11071, 15208, 10992, 15187, 10913, 15166, 10838, 15146, 10768,
+		15125, 10699, 15106, 10637, 15086, 10573, 15067, 10514, 15048, 10457, 15028, 10399, 15010, 10348, 14991, 10295,
+		14973, 10247, 14955, 10163, 14937, 10073, 14920, 9990, 14903, 9909, 14885, 9828, 14868, 9752, 14852, 9681,
+		14836, 9613, 14819, 9547, 14803, 9483, 14787, 9422, 14772, 9365, 14757, 9310, 14742, 9258, 14726, 9196,
+		14711, 9098, 14696, 9002, 14682, 8913, 14668, 8836, 14654, 8753, 14639, 8672, 14625, 8597, 14612, 8529,
+		14599, 8463, 14585, 8397, 14572, 8330, 14559, 8275, 14546, 8221, 14534, 8144, 14522, 8040, 14509, 7936,
+		14497, 7849, 14485, 7760, 14474, 7680, 14462, 7596, 14450, 7523, 14439, 7450, 14428, 7381, 14417, 7313,
+		14406, 7248, 14395, 7191, 14384, 7093, 14374, 6993, 14364, 6893, 14353, 6794, 14343, 6703, 14331, 6616,
+		14311, 6528, 14291, 6448, 14272, 6373, 14254, 6305, 14235, 6235, 14216, 6173, 14198, 6078, 14180, 5955,
+		14162, 5844, 14145, 5742, 14128, 5651, 14110, 5558, 14094, 5470, 14076, 5384, 14060, 5303, 14044, 5237,
+		14028, 5166, 14012, 5083, 13997, 4954, 13981, 4839, 13966, 4731, 13951, 4615, 13936, 4521, 13922, 4433,
+		13907, 4344, 13893, 4263, 13879, 4184, 13865, 4109, 13851, 3997, 13837, 3863, 13823, 3727, 13810, 3605,
+		13797, 3512, 13784, 3413, 13771, 3310, 13758, 3225, 13746, 3135, 13734, 3086, 13721, 2918, 13709, 2777,
+		13697, 2622, 13686, 2538, 13674, 2427, 13662, 2328, 13651, 2229, 13639, 2116, 13628, 1996, 13617, 1846,
+		13606, 1709, 13596, 1587, 13586, 1466, 13575, 1352, 13564, 1236, 13554, 1121, 13544, 1033, 13534, 940,
+		13524, 863, 13514, 767, 13504, 684, 13495, 637, 13486, 574, 13476, 515, 13467, 459, 13458, 417,
+		13449, 363, 13440, 332, 13431, 290, 13422, 251, 13414, 222, 13405, 188, 13397, 161, 13388, 135,
+		16172, 19181, 16196, 18834, 16219, 18640, 16241, 18507, 16263, 18385, 16284, 18224, 16305, 18096, 16324, 17984,
+		16342, 17888, 16359, 17803, 16376, 17728, 16388, 17660, 16395, 17597, 16402, 17542, 16408, 17489, 16414, 17441,
+		16420, 17384, 16424, 17299, 16429, 17220, 16432, 17144, 16436, 17075, 16439, 17007, 16441, 16943, 16443, 16882,
+		16444, 16824, 16445, 16768, 16446, 16715, 16446, 16664, 16445, 16616, 16445, 16569, 16444, 16525, 16442, 16481,
+		16440, 16440, 16437, 16401, 16435, 16340, 16431, 16266, 16428, 16196, 16425, 16129, 16420, 16062, 16416, 15998,
+		16412, 15939, 16406, 15878, 16402, 15823, 16396, 15767, 16391, 15715, 16385, 15664, 16373, 15616, 16361, 15568,
+		16348, 15522, 16335, 15479, 16322, 15437, 16308, 15396, 16295, 15354, 16281, 15279, 16266, 15205, 16252, 15135,
+		16237, 15066, 16222, 15002, 16206, 14937, 16192, 14878, 16176, 14818, 16160, 14761, 16144, 14707, 16129, 14654,
+		16113, 14604, 16098, 14556, 16081, 14508, 16065, 14462, 16049, 14419, 16033, 14377, 16017, 14337, 16001, 14258,
+		15985, 14183, 15969, 14111, 15954, 14042, 15938, 13975, 15922, 13909, 15906, 13847, 15890, 13786, 15875, 13729,
+		15859, 13672, 15843, 13619, 15828, 13567, 15812, 13517, 15797, 13469, 15782, 13424, 15766, 13378, 15752, 13337,
+		15737, 13278, 15722, 13201, 15707, 13122, 15693, 13049, 15678, 12978, 15664, 12909, 15650, 12844, 15635, 12781,
+		15621, 12720, 15608, 12664, 15594, 12609, 15580, 12552, 15566, 12500, 15553, 12451, 15540, 12403, 15527, 12357,
+		15514, 12313, 15501, 12251, 15488, 12168, 15476, 12091, 15463, 12012, 15451, 11940, 15439, 11871, 15426, 11803,
+		15414, 11738, 15402, 11675, 15391, 11614, 15379, 11558, 15368, 11502, 15353, 11450, 15330, 11397, 15308, 11349,
+		15285, 11301, 15265, 11250, 15243, 11162, 15222, 11080, 15200, 10996, 15180, 10921, 15160, 10848, 15140, 10780,
+		15120, 10710, 15100, 10644, 15081, 10581, 15061, 10520, 15043, 10465, 15024, 10409, 15006, 10357, 14987, 10306,
+		14968, 10255, 14951, 10181, 14933, 10088, 14916, 10002, 14899, 9921, 14882, 9842, 14866, 9769, 14850, 9698,
+		14833, 9626, 14817, 9560, 14801, 9495, 14785, 9435, 14769, 9376, 14754, 9322, 14739, 9268, 14724, 9217,
+		14709, 9121, 14695, 9033, 14681, 8942, 14666, 8854, 14652, 8771, 14638, 8693, 14625, 8622, 14611, 8551,
+		14597, 8478, 14585, 8416, 14572, 8356, 14559, 8296, 14546, 8239, 14533, 8171, 14521, 8070, 14509, 7972,
+		14497, 7885, 14485, 7793, 14473, 7704, 14461, 7618, 14450, 7541, 14439, 7474, 14428, 7404, 14417, 7337,
+		14406, 7275, 14395, 7214, 14385, 7150, 14374, 7028, 14364, 6926, 14354, 6824, 14344, 6737, 14332, 6644,
+		14313, 6563, 14293, 6480, 14274, 6408, 14255, 6333, 14237, 6264, 14219, 6199, 14200, 6124, 14183, 6014,
+		14165, 5906, 14147, 5797, 14130, 5694, 14113, 5599, 14095, 5501, 14079, 5423, 14063, 5346, 14047, 5274,
+		14030, 5194, 14014, 5125, 13999, 5005, 13983, 4881, 13968, 4776, 13953, 4663, 13939, 4571, 13924, 4476,
+		13910, 4390, 13895, 4300, 13881, 4221, 13867, 4146, 13853, 4044, 13840, 3911, 13826, 3792, 13814, 3691,
+		13800, 3565, 13787, 3460, 13774, 3351, 13761, 3268, 13748, 3182, 13736, 3110, 13724, 2987, 13712, 2847,
+		13700, 2747, 13688, 2596, 13677, 2485, 13665, 2340, 13654, 2266, 13643, 2181, 13632, 2102, 13621, 1964,
+		13610, 1804, 13598, 1643, 13588, 1506, 13577, 1395, 13566, 1252, 13557, 1174, 13547, 1076, 13537, 990,
+		13527, 892, 13517, 813, 13507, 732, 13498, 670, 13488, 595, 13479, 542, 13470, 485, 13461, 433,
+		13452, 382, 13443, 339, 13434, 297, 13425, 263, 13416, 222, 13407, 192, 13399, 165, 13391, 141,
+		16144, 19128, 16166, 18790, 16188, 18602, 16210, 18474, 16230, 18322, 16250, 18169, 16269, 18042, 16287, 17933,
+		16305, 17842, 16321, 17760, 16337, 17686, 16352, 17622, 16366, 17562, 16379, 17507, 16388, 17456, 16393, 17409,
+		16398, 17325, 16403, 17243, 16407, 17166, 16410, 17091, 16414, 17025, 16417, 16960, 16419, 16898, 16421, 16841,
+		16422, 16783, 16423, 16730, 16424, 16679, 16424, 16630, 16424, 16584, 16424, 16539, 16422, 16495, 16421, 16453,
+		16419, 16413, 16417, 16368, 16414, 16292, 16411, 16219, 16408, 16153, 16404, 16086, 16401, 16024, 16397, 15962,
+		16392, 15902, 16388, 15847, 16382, 15791, 16372, 15739, 16361, 15687, 16351, 15639, 16339, 15591, 16327, 15544,
+		16316, 15501, 16303, 15458, 16290, 15416, 16277, 15377, 16264, 15319, 16251, 15245, 16237, 15174, 16223, 15105,
+		16209, 15038, 16194, 14975, 16180, 14913, 16165, 14854, 16150, 14796, 16135, 14741, 16120, 14688, 16105, 14636,
+		16090, 14587, 16075, 14540, 16059, 14494, 16044, 14449, 16028, 14406, 16013, 14365, 15997, 14314, 15982, 14237,
+		15966, 14164, 15951, 14093, 15936, 14024, 15920, 13958, 15905, 13894, 15890, 13833, 15874, 13774, 15859, 13717,
+		15844, 13662, 15829, 13610, 15813, 13558, 15798, 13509, 15783, 13461, 15769, 13417, 15754, 13372, 15739, 13331,
+		15725, 13266, 15711, 13191, 15696, 13114, 15682, 13043, 15668, 12972, 15654, 12905, 15640, 12840, 15626, 12775,
+		15612, 12716, 15599, 12659, 15585, 12603, 15572, 12549, 15559, 12500, 15546, 12450, 15532, 12400, 15519, 12354,
+		15507, 12312, 15494, 12251, 15482, 12168, 15469, 12090, 15457, 12014, 15445, 11942, 15433, 11872, 15421, 11805,
+		15409, 11739, 15397, 11678, 15386, 11618, 15374, 11561, 15363, 11507, 15344, 11453, 15322, 11402, 15299, 11353,
+		15278, 11307, 15257, 11258, 15235, 11170, 15215, 11086, 15195, 11011, 15174, 10930, 15154, 10859, 15133, 10785,
+		15114, 10717, 15094, 10652, 15076, 10591, 15056, 10530, 15038, 10474, 15019, 10418, 15001, 10364, 14983, 10314,
+		14965, 10264, 14948, 10196, 14931, 10109, 14913, 10017, 14896, 9939, 14879, 9857, 14863, 9781, 14846, 9711,
+		14830, 9639, 14814, 9574, 14799, 9512, 14783, 9449, 14767, 9389, 14752, 9335, 14737, 9281, 14722, 9228,
+		14707, 9144, 14693, 9052, 14678, 8959, 14664, 8873, 14651, 8795, 14637, 8717, 14624, 8642, 14610, 8568,
+		14597, 8498, 14584, 8439, 14571, 8372, 14558, 8313, 14546, 8255, 14533, 8201, 14521, 8106, 14509, 8006,
+		14497, 7910, 14485, 7819, 14473, 7733, 14462, 7656, 14450, 7575, 14439, 7498, 14428, 7426, 14417, 7354,
+		14406, 7289, 14396, 7233, 14385, 7176, 14375, 7071, 14365, 6971, 14355, 6875, 14345, 6772, 14333, 6679,
+		14314, 6595, 14294, 6506, 14275, 6434, 14257, 6360, 14238, 6290, 14220, 6225, 14201, 6158, 14184, 6063,
+		14166, 5950, 14149, 5839, 14131, 5733, 14115, 5640, 14098, 5546, 14082, 5463, 14065, 5383, 14049, 5298,
+		14033, 5225, 14017, 5161, 14003, 5090, 13986, 4944, 13971, 4825, 13956, 4716, 13941, 4609, 13926, 4515,
+		13912, 4423, 13898, 4338, 13883, 4246, 13870, 4182, 13856, 4111, 13843, 3985, 13830, 3863, 13816, 3725,
+		13802, 3604, 13789, 3510, 13776, 3415, 13763, 3311, 13751, 3230, 13739, 3139, 13727, 3066, 13715, 2920,
+		13703, 2768, 13691, 2627, 13679, 2520, 13668, 2430, 13656, 2315, 13645, 2215, 13634, 2114, 13623, 2029,
+		13612, 1875, 13602, 1754, 13591, 1594, 13580, 1459, 13570, 1333, 13560, 1209, 13549, 1103, 13539, 1009,
+		13530, 923, 13520, 850, 13510, 757, 13500, 695, 13491, 621, 13482, 561, 13472, 505, 13464, 451,
+		13454, 408, 13445, 354, 13437, 316, 13428, 271, 13419, 239, 13411, 207, 13402, 175, 13393, 146,
+		16117, 19078, 16138, 18750, 16159, 18567, 16179, 18442, 16198, 18261, 16217, 18115, 16235, 17990, 16252, 17887,
+		16269, 17798, 16285, 17719, 16300, 17649, 16313, 17582, 16327, 17526, 16340, 17474, 16351, 17424, 16362, 17351,
+		16371, 17266, 16381, 17189, 16386, 17115, 16390, 17044, 16393, 16977, 16396, 16914, 16399, 16857, 16400, 16800,
+		16401, 16745, 16403, 16694, 16403, 16644, 16403, 16597, 16403, 16551, 16403, 16508, 16402, 16466, 16400, 16426,
+		16399, 16388, 16396, 16316, 16394, 16247, 16392, 16177, 16388, 16109, 16385, 16046, 16379, 15984, 16372, 15926,
+		16364, 15868, 16355, 15812, 16347, 15762, 16336, 15708, 16327, 15660, 16316, 15612, 16305, 15566, 16294, 15521,
+		16283, 15478, 16271, 15437, 16259, 15397, 16247, 15358, 16234, 15282, 16221, 15211, 16208, 15143, 16195, 15076,
+		16181, 15011, 16167, 14949, 16154, 14889, 16139, 14830, 16125, 14775, 16110, 14720, 16096, 14669, 16081, 14619,
+		16067, 14570, 16052, 14524, 16037, 14479, 16022, 14435, 16007, 14393, 15992, 14352, 15977, 14291, 15962, 14216,
+		15948, 14144, 15933, 14074, 15917, 14006, 15903, 13942, 15888, 13879, 15873, 13820, 15858, 13761, 15844, 13706,
+		15829, 13651, 15814, 13599, 15799, 13549, 15785, 13501, 15770, 13454, 15756, 13409, 15741, 13366, 15727, 13324,
+		15712, 13255, 15699, 13179, 15685, 13104, 15671, 13032, 15657, 12963, 15643, 12897, 15630, 12835, 15616, 12771,
+		15603, 12714, 15589, 12654, 15576, 12600, 15563, 12547, 15550, 12496, 15537, 12446, 15525, 12401, 15512, 12355,
+		15499, 12310, 15487, 12247, 15474, 12167, 15462, 12088, 15450, 12014, 15438, 11943, 15426, 11872, 15415, 11806,
+		15404, 11743, 15392, 11679, 15381, 11621, 15369, 11563, 15356, 11509, 15334, 11456, 15312, 11405, 15291, 11356,
+		15270, 11310, 15249, 11265, 15228, 11180, 15208, 11097, 15187, 11017, 15167, 10939, 15147, 10864, 15128, 10797,
+		15109, 10729, 15089, 10663, 15070, 10598, 15051, 10539, 15033, 10482, 15014, 10425, 14997, 10373, 14979, 10322,
+		14961, 10273, 14944, 10214, 14927, 10124, 14910, 10037, 14893, 9953, 14876, 9875, 14860, 9798, 14844, 9727,
+		14827, 9654, 14812, 9588, 14796, 9526, 14780, 9462, 14765, 9403, 14750, 9350, 14735, 9293, 14720, 9240,
+		14706, 9171, 14692, 9077, 14677, 8981, 14663, 8895, 14649, 8815, 14636, 8736, 14622, 8658, 14609, 8586,
+		14596, 8519, 14583, 8452, 14570, 8387, 14557, 8327, 14545, 8271, 14532, 8217, 14520, 8136, 14508, 8032,
+		14496, 7939, 14485, 7849, 14474, 7765, 14462, 7682, 14451, 7598, 14440, 7526, 14429, 7454, 14418, 7393,
+		14407, 7319, 14396, 7257, 14385, 7193, 14375, 7101, 14365, 6998, 14355, 6903, 14345, 6807, 14335, 6714,
+		14315, 6626, 14296, 6548, 14277, 6466, 14259, 6394, 14239, 6314, 14221, 6250, 14203, 6185, 14185, 6105,
+		14168, 5990, 14151, 5884, 14134, 5779, 14117, 5678, 14100, 5586, 14083, 5498, 14067, 5412, 14051, 5339,
+		14035, 5260, 14019, 5192, 14004, 5123, 13988, 4983, 13973, 4878, 13958, 4768, 13943, 4661, 13929, 4562,
+		13914, 4465, 13900, 4373, 13886, 4290, 13872, 4212, 13858, 4142, 13844, 4036, 13830, 3896, 13817, 3779,
+		13805, 3677, 13792, 3566, 13778, 3446, 13766, 3351, 13754, 3269, 13742, 3191, 13729, 3097, 13717, 2981,
+		13705, 2835, 13694, 2711, 13682, 2589, 13670, 2462, 13659, 2352, 13648, 2261, 13637, 2177, 13626, 2082,
+		13614, 1906, 13604, 1773, 13594, 1640, 13583, 1524, 13573, 1383, 13563, 1278, 13553, 1170, 13542, 1059,
+		13532, 962, 13522, 876, 13513, 798, 13504, 732, 13494, 650, 13485, 588, 13475, 521, 13466, 472,
+		13457, 411, 13448, 371, 13439, 324, 13430, 283, 13421, 246, 13413, 209, 13405, 181, 13396, 152,
+		16090, 19027, 16110, 18710, 16130, 18531, 16148, 18385, 16167, 18207, 16185, 18063, 16202, 17944, 16219, 17843,
+		16234, 17755, 16249, 17678, 16263, 17610, 16278, 17550, 16290, 17494, 16301, 17441, 16313, 17383, 16323, 17293,
+		16332, 17213, 16340, 17134, 16349, 17064, 16356, 16998, 16361, 16931, 16367, 16871, 16371, 16814, 16375, 16759,
+		16378, 16708, 16380, 16658, 16382, 16610, 16382, 16564, 16381, 16520, 16380, 16478, 16379, 16438, 16377, 16400,
+		16373, 16339, 16369, 16267, 16365, 16199, 16361, 16133, 16356, 16070, 16350, 16009, 16342, 15948, 16335, 15890,
+		16328, 15835, 16319, 15781, 16310, 15729, 16303, 15682, 16292, 15632, 16283, 15587, 16272, 15541, 16262, 15498,
+		16251, 15457, 16240, 15416, 16228, 15378, 16216, 15320, 16204, 15248, 16192, 15179, 16179, 15110, 16166, 15045,
+		16153, 14982, 16140, 14922, 16127, 14864, 16114, 14809, 16100, 14753, 16086, 14700, 16072, 14649, 16058, 14600,
+		16043, 14553, 16029, 14507, 16015, 14464, 16001, 14422, 15987, 14380, 15972, 14341, 15958, 14270, 15943, 14195,
+		15928, 14122, 15914, 14055, 15900, 13990, 15885, 13926, 15871, 13864, 15856, 13805, 15842, 13748, 15827, 13692,
+		15813, 13639, 15799, 13590, 15785, 13539, 15771, 13492, 15757, 13446, 15743, 13402, 15729, 13360, 15715, 13319,
+		15701, 13245, 15687, 13170, 15673, 13094, 15660, 13023, 15646, 12955, 15633, 12891, 15620, 12827, 15606, 12766,
+		15593, 12707, 15580, 12650, 15567, 12596, 15555, 12545, 15542, 12493, 15529, 12444, 15516, 12397, 15504, 12352,
+		15492, 12309, 15480, 12251, 15468, 12168, 15456, 12088, 15444, 12012, 15432, 11942, 15421, 11874, 15409, 11807,
+		15398, 11743, 15386, 11682, 15375, 11622, 15364, 11567, 15346, 11510, 15325, 11460, 15304, 11408, 15282, 11359,
+		15261, 11313, 15241, 11268, 15220, 11186, 15200, 11104, 15180, 11023, 15161, 10949, 15141, 10874, 15122, 10805,
+		15102, 10735, 15083, 10669, 15065, 10608, 15047, 10549, 15028, 10490, 15010, 10433, 14992, 10381, 14975, 10330,
+		14957, 10281, 14940, 10228, 14922, 10137, 14906, 10052, 14889, 9970, 14873, 9890, 14856, 9813, 14840, 9740,
+		14824, 9669, 14809, 9604, 14794, 9541, 14777, 9475, 14762, 9416, 14748, 9362, 14733, 9306, 14718, 9253,
+		14704, 9197, 14690, 9098, 14676, 9005, 14662, 8919, 14648, 8839, 14634, 8757, 14621, 8680, 14608, 8608,
+		14595, 8539, 14581, 8467, 14569, 8406, 14557, 8347, 14544, 8288, 14532, 8233, 14520, 8165, 14508, 8062,
+		14496, 7972, 14484, 7876, 14473, 7785, 14462, 7705, 14451, 7625, 14440, 7554, 14429, 7482, 14418, 7406,
+		14407, 7339, 14396, 7277, 14387, 7224, 14376, 7162, 14366, 7050, 14356, 6944, 14345, 6837, 14335, 6744,
+		14316, 6656, 14297, 6577, 14278, 6492, 14259, 6417, 14241, 6347, 14223, 6279, 14206, 6217, 14187, 6150,
+		14170, 6041, 14152, 5930, 14135, 5816, 14118, 5716, 14102, 5623, 14085, 5530, 14069, 5449, 14053, 5367,
+		14037, 5293, 14021, 5216, 14006, 5156, 13991, 5062, 13975, 4930, 13961, 4822, 13946, 4703, 13931, 4601,
+		13917, 4509, 13902, 4416, 13888, 4332, 13874, 4247, 13860, 4165, 13846, 4095, 13833, 3961, 13820, 3838,
+		13807, 3730, 13794, 3597, 13781, 3495, 13769, 3408, 13757, 3318, 13744, 3212, 13732, 3136, 13720, 3045,
+		13708, 2915, 13696, 2766, 13685, 2637, 13673, 2528, 13662, 2413, 13651, 2309, 13639, 2200, 13628, 2107,
+		13618, 2031, 13607, 1873, 13596, 1709, 13586, 1563, 13575, 1407, 13564, 1281, 13555, 1203, 13545, 1092,
+		13535, 999, 13525, 906, 13515, 813, 13506, 746, 13496, 664, 13487, 614, 13478, 538, 13469, 489,
+		13459, 427, 13451, 385, 13442, 339, 13433, 297, 13425, 257, 13416, 225, 13408, 189, 13399, 158,
+		16063, 18973, 16082, 18666, 16101, 18496, 16119, 18326, 16137, 18151, 16154, 18012, 16170, 17897, 16186, 17799,
+		16200, 17714, 16216, 17643, 16228, 17573, 16241, 17515, 16253, 17461, 16265, 17411, 16276, 17324, 16285, 17238,
+		16294, 17159, 16302, 17085, 16309, 17015, 16317, 16951, 16323, 16889, 16327, 16829, 16331, 16774, 16336, 16722,
+		16339, 16672, 16341, 16624, 16342, 16577, 16342, 16532, 16342, 16490, 16341, 16450, 16340, 16411, 16338, 16362,
+		16335, 16291, 16331, 16221, 16328, 16154, 16323, 16090, 16318, 16028, 16313, 15970, 16307, 15912, 16299, 15856,
+		16292, 15802, 16285, 15751, 16277, 15701, 16267, 15650, 16260, 15607, 16249, 15560, 16240, 15517, 16230, 15476,
+		16220, 15435, 16209, 15396, 16198, 15357, 16186, 15283, 16175, 15213, 16163, 15145, 16151, 15080, 16139, 15017,
+		16126, 14955, 16114, 14897, 16101, 14839, 16088, 14784, 16075, 14731, 16062, 14680, 16048, 14630, 16035, 14583,
+		16021, 14536, 16007, 14491, 15994, 14448, 15980, 14407, 15966, 14366, 15952, 14321, 15938, 14246, 15924, 14174,
+		15910, 14104, 15896, 14037, 15882, 13972, 15868, 13909, 15854, 13849, 15840, 13792, 15826, 13734, 15812, 13680,
+		15798, 13628, 15784, 13577, 15770, 13528, 15757, 13483, 15743, 13437, 15729, 13394, 15715, 13352, 15702, 13311,
+		15689, 13233, 15675, 13158, 15662, 13084, 15649, 13016, 15635, 12948, 15622, 12882, 15609, 12820, 15596, 12759,
+		15583, 12701, 15570, 12644, 15558, 12592, 15545, 12540, 15533, 12489, 15521, 12443, 15508, 12395, 15496, 12350,
+		15484, 12308, 15472, 12241, 15460, 12162, 15449, 12089, 15438, 12017, 15426, 11941, 15414, 11874, 15403, 11808,
+		15392, 11743, 15381, 11683, 15370, 11625, 15358, 11567, 15336, 11513, 15315, 11462, 15294, 11411, 15273, 11363,
+		15253, 11317, 15233, 11272, 15212, 11193, 15192, 11108, 15172, 11031, 15153, 10954, 15134, 10881, 15114, 10809,
+		15096, 10743, 15077, 10677, 15059, 10615, 15040, 10555, 15022, 10496, 15004, 10441, 14987, 10389, 14970, 10338,
+		14952, 10287, 14935, 10241, 14918, 10154, 14902, 10068, 14885, 9983, 14869, 9903, 14852, 9825, 14837, 9756,
+		14821, 9684, 14806, 9618, 14790, 9551, 14775, 9490, 14760, 9431, 14746, 9376, 14730, 9318, 14716, 9265,
+		14702, 9218, 14688, 9122, 14673, 9026, 14660, 8943, 14646, 8857, 14633, 8777, 14619, 8700, 14607, 8629,
+		14594, 8557, 14581, 8490, 14568, 8427, 14556, 8366, 14543, 8303, 14531, 8247, 14519, 8195, 14507, 8095,
+		14496, 7999, 14484, 7904, 14472, 7814, 14462, 7736, 14450, 7651, 14439, 7567, 14428, 7498, 14417, 7425,
+		14407, 7363, 14396, 7299, 14386, 7238, 14376, 7179, 14366, 7081, 14356, 6985, 14346, 6887, 14337, 6793,
+		14318, 6700, 14298, 6608, 14279, 6524, 14261, 6447, 14242, 6369, 14224, 6302, 14206, 6239, 14189, 6178,
+		14171, 6084, 14154, 5974, 14137, 5860, 14120, 5762, 14104, 5670, 14088, 5574, 14071, 5485, 14056, 5407,
+		14039, 5326, 14024, 5252, 14008, 5183, 13993, 5109, 13977, 4983, 13962, 4867, 13948, 4761, 13933, 4649,
+		13919, 4557, 13905, 4461, 13891, 4372, 13877, 4293, 13863, 4215, 13849, 4133, 13837, 4043, 13823, 3895,
+		13810, 3769, 13797, 3648, 13784, 3547, 13772, 3458, 13758, 3338, 13747, 3251, 13735, 3176, 13723, 3109,
+		13711, 2973, 13699, 2825, 13688, 2716, 13676, 2573, 13665, 2454, 13654, 2355, 13642, 2254, 13631, 2158,
+		13621, 2077, 13610, 1905, 13599, 1778, 13589, 1660, 13578, 1518, 13568, 1381, 13558, 1245, 13548, 1126,
+		13538, 1035, 13528, 941, 13518, 844, 13509, 779, 13499, 695, 13490, 632, 13481, 564, 13472, 515,
+		13463, 453, 13453, 396, 13445, 351, 13436, 307, 13427, 269, 13418, 226, 13410, 198, 13402, 164,
+		16037, 18919, 16056, 18629, 16073, 18462, 16091, 18270, 16107, 18098, 16124, 17963, 16139, 17853, 16154, 17759,
+		16168, 17675, 16182, 17604, 16195, 17540, 16207, 17482, 16217, 17428, 16229, 17354, 16240, 17268, 16248, 17183,
+		16257, 17108, 16265, 17037, 16272, 16969, 16279, 16907, 16285, 16848, 16289, 16789, 16293, 16736, 16297, 16685,
+		16300, 16636, 16302, 16589, 16304, 16546, 16304, 16502, 16304, 16462, 16304, 16422, 16302, 16385, 16300, 16312,
+		16298, 16244, 16295, 16176, 16291, 16112, 16286, 16048, 16282, 15988, 16276, 15931, 16271, 15876, 16265, 15822,
+		16257, 15769, 16250, 15719, 16243, 15672, 16235, 15624, 16225, 15578, 16218, 15537, 16208, 15493, 16199, 15453,
+		16189, 15414, 16179, 15376, 16168, 15319, 16157, 15247, 16146, 15179, 16135, 15114, 16124, 15050, 16112, 14987,
+		16100, 14928, 16088, 14870, 16075, 14814, 16063, 14761, 16051, 14710, 16037, 14658, 16025, 14611, 16011, 14564,
+		15999, 14519, 15985, 14475, 15972, 14433, 15959, 14392, 15946, 14354, 15932, 14295, 15919, 14222, 15905, 14152,
+		15892, 14084, 15878, 14018, 15864, 13954, 15851, 13892, 15837, 13834, 15824, 13776, 15810, 13720, 15797, 13668,
+		15783, 13617, 15769, 13566, 15756, 13519, 15742, 13472, 15729, 13428, 15716, 13386, 15702, 13343, 15690, 13298,
+		15676, 13219, 15663, 13146, 15650, 13074, 15638, 13007, 15624, 12938, 15612, 12876, 15599, 12813, 15586, 12753,
+		15573, 12694, 15561, 12640, 15549, 12587, 15536, 12534, 15524, 12486, 15512, 12437, 15500, 12393, 15489, 12350,
+		15477, 12305, 15465, 12241, 15453, 12162, 15442, 12086, 15430, 12009, 15419, 11939, 15408, 11875, 15397, 11810,
+		15386, 11745, 15375, 11682, 15364, 11625, 15347, 11569, 15326, 11515, 15305, 11463, 15285, 11413, 15264, 11365,
+		15243, 11318, 15224, 11274, 15204, 11199, 15184, 11117, 15165, 11038, 15146, 10963, 15127, 10888, 15108, 10816,
+		15090, 10750, 15071, 10685, 15052, 10620, 15034, 10562, 15017, 10505, 14999, 10450, 14982, 10396, 14964, 10344,
+		14947, 10295, 14930, 10248, 14913, 10166, 14897, 10078, 14880, 9994, 14865, 9918, 14849, 9841, 14833, 9767,
+		14817, 9696, 14801, 9625, 14787, 9563, 14772, 9501, 14758, 9445, 14742, 9386, 14728, 9330, 14714, 9279,
+		14700, 9230, 14686, 9145, 14671, 9049, 14658, 8966, 14645, 8879, 14631, 8796, 14618, 8722, 14605, 8648,
+		14592, 8575, 14580, 8506, 14567, 8444, 14555, 8382, 14543, 8323, 14531, 8268, 14519, 8215, 14507, 8127,
+		14495, 8030, 14484, 7935, 14473, 7846, 14461, 7762, 14450, 7674, 14439, 7598, 14428, 7527, 14418, 7455,
+		14407, 7383, 14396, 7319, 14386, 7257, 14376, 7200, 14366, 7124, 14355, 7007, 14346, 6907, 14336, 6810,
+		14318, 6726, 14299, 6644, 14281, 6565, 14262, 6480, 14244, 6406, 14226, 6334, 14208, 6265, 14190, 6198,
+		14172, 6124, 14156, 6017, 14138, 5906, 14121, 5801, 14105, 5704, 14088, 5603, 14072, 5518, 14056, 5435,
+		14040, 5354, 14025, 5278, 14010, 5214, 13994, 5142, 13980, 5045, 13965, 4925, 13950, 4806, 13936, 4698,
+		13921, 4593, 13907, 4502, 13893, 4407, 13879, 4323, 13866, 4243, 13852, 4167, 13839, 4101, 13826, 3957,
+		13813, 3836, 13800, 3716, 13787, 3604, 13775, 3496, 13762, 3397, 13750, 3302, 13738, 3226, 13725, 3128,
+		13714, 3041, 13702, 2909, 13691, 2769, 13679, 2633, 13668, 2513, 13657, 2416, 13645, 2297, 13633, 2178,
+		13623, 2118, 13612, 1998, 13602, 1851, 13591, 1680, 13581, 1538, 13571, 1413, 13561, 1329, 13551, 1198,
+		13541, 1084, 13531, 984, 13521, 889, 13512, 814, 13502, 726, 13493, 659, 13484, 593, 13474, 526,
+		13465, 464, 13456, 412, 13448, 374, 13439, 315, 13430, 278, 13422, 241, 13413, 205, 13405, 171,
+		16013, 18876, 16030, 18590, 16047, 18432, 16063, 18214, 16079, 18049, 16094, 17916, 16109, 17809, 16123, 17718,
+		16136, 17637, 16150, 17569, 16162, 17507, 16173, 17450, 16185, 17394, 16195, 17299, 16204, 17212, 16213, 17133,
+		16221, 17060, 16229, 16990, 16236, 16926, 16242, 16864, 16247, 16806, 16252, 16751, 16256, 16698, 16260, 16649,
+		16263, 16603, 16264, 16557, 16266, 16515, 16267, 16473, 16267, 16434, 16266, 16395, 16265, 16333, 16264, 16264,
+		16262, 16197, 16259, 16132, 16255, 16068, 16252, 16010, 16247, 15951, 16241, 15894, 16236, 15840, 16230, 15788,
+		16224, 15739, 16217, 15689, 16210, 15642, 16203, 15598, 16194, 15553, 16185, 15511, 16177, 15471, 16168, 15431,
+		16159, 15393, 16149, 15352, 16139, 15281, 16129, 15213, 16118, 15146, 16107, 15081, 16096, 15019, 16085, 14959,
+		16074, 14901, 16062, 14845, 16050, 14791, 16038, 14738, 16026, 14688, 16013, 14638, 16001, 14591, 15989, 14546,
+		15976, 14502, 15964, 14459, 15951, 14418, 15938, 14379, 15925, 14340, 15913, 14271, 15899, 14198, 15886, 14129,
+		15873, 14061, 15860, 13998, 15846, 13935, 15834, 13877, 15821, 13818, 15807, 13761, 15794, 13708, 15781, 13655,
+		15767, 13604, 15755, 13556, 15742, 13509, 15728, 13463, 15716, 13420, 15702, 13377, 15689, 13336, 15677, 13284,
+		15664, 13205, 15651, 13133, 15638, 13063, 15626, 12995, 15613, 12929, 15601, 12867, 15588, 12804, 15576, 12747,
+		15564, 12689, 15552, 12635, 15539, 12581, 15527, 12530, 15516, 12482, 15504, 12434, 15492, 12390, 15480, 12345,
+		15468, 12302, 15457, 12236, 15446, 12159, 15435, 12082, 15424, 12010, 15413, 11941, 15401, 11871, 15390, 11804,
+		15380, 11744, 15370, 11687, 15357, 11627, 15337, 11571, 15315, 11516, 15295, 11464, 15275, 11415, 15255, 11368,
+		15235, 11321, 15215, 11276, 15195, 11203, 15176, 11121, 15157, 11042, 15138, 10966, 15119, 10892, 15101, 10823,
+		15083, 10757, 15064, 10693, 15046, 10629, 15029, 10570, 15011, 10512, 14993, 10456, 14976, 10403, 14959, 10352,
+		14942, 10303, 14926, 10257, 14909, 10182, 14893, 10093, 14876, 10010, 14861, 9933, 14845, 9853, 14829, 9778,
+		14814, 9709, 14799, 9642, 14784, 9577, 14769, 9514, 14754, 9453, 14740, 9397, 14725, 9339, 14711, 9290,
+		14697, 9241, 14683, 9165, 14670, 9074, 14657, 8988, 14643, 8899, 14630, 8816, 14617, 8743, 14604, 8667,
+		14591, 8594, 14579, 8528, 14567, 8464, 14554, 8401, 14542, 8337, 14530, 8282, 14518, 8228, 14506, 8158,
+		14495, 8060, 14484, 7967, 14472, 7873, 14461, 7785, 14450, 7709, 14439, 7629, 14429, 7552, 14418, 7477,
+		14407, 7408, 14397, 7347, 14387, 7286, 14376, 7222, 14366, 7158, 14356, 7050, 14346, 6950, 14337, 6859,
+		14318, 6757, 14299, 6665, 14280, 6581, 14262, 6501, 14244, 6428, 14227, 6359, 14209, 6293, 14192, 6231,
+		14175, 6165, 14157, 6065, 14140, 5957, 14123, 5838, 14107, 5745, 14090, 5649, 14074, 5554, 14058, 5474,
+		14042, 5386, 14027, 5312, 14012, 5241, 13996, 5167, 13981, 5088, 13967, 4973, 13952, 4848, 13938, 4750,
+		13924, 4643, 13910, 4541, 13896, 4455, 13882, 4362, 13868, 4278, 13855, 4202, 13841, 4124, 13828, 4016,
+		13815, 3881, 13803, 3778, 13789, 3648, 13776, 3536, 13765, 3452, 13752, 3343, 13739, 3240, 13728, 3164,
+		13716, 3097, 13704, 2954, 13692, 2812, 13681, 2675, 13669, 2561, 13658, 2447, 13647, 2332, 13637, 2259,
+		13626, 2143, 13615, 2054, 13604, 1876, 13594, 1754, 13584, 1604, 13573, 1445, 13563, 1318, 13553, 1202,
+		13543, 1117, 13534, 1021, 13524, 936, 13514, 835, 13505, 753, 13496, 684, 13486, 610, 13477, 542,
+		13468, 491, 13459, 431, 13450, 377, 13442, 334, 13432, 281, 13424, 248, 13416, 209, 13407, 178,
+		15989, 18832, 16005, 18556, 16021, 18372, 16037, 18160, 16052, 18003, 16066, 17873, 16080, 17768, 16093, 17679,
+		16106, 17602, 16118, 17535, 16129, 17474, 16141, 17421, 16151, 17334, 16161, 17244, 16170, 17161, 16179, 17083,
+		16187, 17012, 16194, 16945, 16201, 16881, 16206, 16822, 16212, 16767, 16217, 16714, 16220, 16663, 16223, 16615,
+		16226, 16570, 16229, 16526, 16230, 16484, 16231, 16444, 16231, 16406, 16231, 16354, 16229, 16283, 16228, 16215,
+		16225, 16149, 16223, 16087, 16220, 16027, 16217, 15970, 16212, 15913, 16208, 15859, 16202, 15806, 16197, 15755,
+		16191, 15708, 16185, 15661, 16178, 15614, 16170, 15571, 16163, 15529, 16155, 15487, 16147, 15448, 16138, 15409,
+		16129, 15373, 16119, 15311, 16110, 15244, 16100, 15176, 16090, 15112, 16080, 15050, 16070, 14990, 16059, 14931,
+		16048, 14874, 16036, 14819, 16025, 14767, 16014, 14716, 16002, 14666, 15990, 14618, 15978, 14573, 15967, 14529,
+		15954, 14485, 15942, 14444, 15930, 14403, 15918, 14364, 15905, 14317, 15892, 14245, 15880, 14175, 15867, 14107,
+		15854, 14041, 15842, 13978, 15829, 13918, 15816, 13858, 15803, 13801, 15791, 13747, 15778, 13693, 15765, 13641,
+		15753, 13592, 15740, 13544, 15727, 13498, 15714, 13453, 15702, 13411, 15689, 13369, 15677, 13329, 15664, 13268,
+		15651, 13192, 15639, 13121, 15626, 13050, 15614, 12984, 15602, 12919, 15590, 12856, 15578, 12797, 15566, 12739,
+		15554, 12683, 15542, 12630, 15530, 12577, 15519, 12526, 15507, 12479, 15495, 12431, 15484, 12387, 15472, 12342,
+		15461, 12300, 15450, 12233, 15438, 12153, 15428, 12079, 15417, 12010, 15406, 11938, 15395, 11871, 15384, 11807,
+		15374, 11744, 15363, 11682, 15345, 11625, 15326, 11572, 15305, 11519, 15285, 11467, 15265, 11416, 15245, 11367,
+		15225, 11323, 15206, 11279, 15187, 11208, 15168, 11127, 15149, 11048, 15130, 10973, 15111, 10897, 15093, 10829,
+		15075, 10763, 15057, 10696, 15040, 10637, 15022, 10575, 15005, 10519, 14987, 10462, 14970, 10410, 14953, 10358,
+		14937, 10309, 14920, 10261, 14904, 10194, 14888, 10106, 14872, 10025, 14857, 9946, 14841, 9868, 14825, 9793,
+		14810, 9723, 14795, 9655, 14780, 9587, 14766, 9526, 14751, 9465, 14737, 9409, 14723, 9354, 14709, 9301,
+		14695, 9251, 14681, 9184, 14667, 9090, 14655, 9009, 14641, 8919, 14628, 8838, 14615, 8761, 14603, 8687,
+		14590, 8611, 14578, 8547, 14565, 8479, 14553, 8415, 14541, 8355, 14529, 8298, 14517, 8244, 14505, 8186,
+		14494, 8086, 14483, 7990, 14471, 7899, 14460, 7809, 14449, 7732, 14438, 7648, 14427, 7570, 14417, 7503,
+		14407, 7433, 14397, 7367, 14386, 7300, 14376, 7242, 14366, 7182, 14357, 7102, 14347, 6993, 14337, 6885,
+		14319, 6794, 14300, 6702, 14282, 6621, 14264, 6538, 14245, 6455, 14227, 6379, 14209, 6310, 14192, 6242,
+		14175, 6187, 14158, 6108, 14142, 6003, 14125, 5896, 14108, 5784, 14093, 5691, 14076, 5594, 14060, 5503,
+		14045, 5431, 14029, 5346, 14014, 5274, 13999, 5198, 13984, 5134, 13969, 5024, 13955, 4899, 13940, 4787,
+		13926, 4680, 13912, 4579, 13898, 4486, 13884, 4400, 13870, 4311, 13857, 4241, 13843, 4154, 13830, 4074,
+		13817, 3949, 13804, 3815, 13791, 3689, 13779, 3594, 13767, 3484, 13754, 3382, 13743, 3298, 13731, 3211,
+		13719, 3123, 13707, 3025, 13695, 2873, 13684, 2746, 13672, 2609, 13661, 2489, 13650, 2387, 13639, 2273,
+		13629, 2178, 13618, 2098, 13608, 1992, 13597, 1826, 13587, 1643, 13576, 1524, 13567, 1414, 13557, 1280,
+		13546, 1153, 13536, 1043, 13527, 950, 13517, 860, 13508, 779, 13499, 712, 13489, 636, 13480, 566,
+		13471, 500, 13462, 440, 13453, 390, 13444, 344, 13436, 299, 13427, 259, 13419, 220, 13410, 184,
+		15965, 18791, 15981, 18524, 15996, 18315, 16011, 18109, 16024, 17953, 16039, 17832, 16052, 17731, 16064, 17643,
+		16077, 17568, 16088, 17501, 16100, 17446, 16109, 17371, 16119, 17277, 16128, 17188, 16137, 17110, 16146, 17036,
+		16153, 16967, 16160, 16901, 16167, 16840, 16172, 16783, 16177, 16728, 16182, 16678, 16185, 16628, 16188, 16582,
+		16191, 16538, 16193, 16494, 16194, 16454, 16195, 16416, 16196, 16375, 16196, 16304, 16195, 16236, 16193, 16170,
+		16191, 16105, 16189, 16045, 16185, 15985, 16183, 15931, 16179, 15877, 16175, 15825, 16170, 15774, 16164, 15723,
+		16159, 15677, 16153, 15632, 16147, 15588, 16139, 15544, 16132, 15503, 16125, 15464, 16117, 15425, 16108, 15388,
+		16099, 15342, 16091, 15275, 16082, 15207, 16072, 15142, 16063, 15080, 16053, 15018, 16043, 14960, 16033, 14903,
+		16022, 14847, 16012, 14795, 16001, 14744, 15989, 14692, 15979, 14645, 15967, 14598, 15956, 14554, 15944, 14510,
+		15932, 14468, 15921, 14427, 15909, 14388, 15897, 14350, 15885, 14290, 15873, 14219, 15861, 14151, 15849, 14085,
+		15836, 14020, 15823, 13957, 15811, 13899, 15799, 13841, 15786, 13784, 15774, 13731, 15762, 13678, 15749, 13628,
+		15738, 13580, 15725, 13532, 15712, 13486, 15700, 13443, 15688, 13400, 15675, 13359, 15663, 13320, 15651, 13253,
+		15639, 13180, 15627, 13109, 15615, 13038, 15603, 12973, 15591, 12907, 15579, 12847, 15567, 12787, 15555, 12729,
+		15543, 12673, 15532, 12622, 15521, 12570, 15509, 12521, 15498, 12473, 15487, 12427, 15476, 12383, 15464, 12339,
+		15453, 12298, 15442, 12227, 15431, 12148, 15420, 12076, 15410, 12004, 15399, 11935, 15389, 11871, 15378, 11806,
+		15368, 11743, 15356, 11686, 15335, 11628, 15314, 11571, 15294, 11516, 15273, 11464, 15255, 11419, 15235, 11371,
+		15216, 11326, 15197, 11280, 15178, 11213, 15159, 11131, 15141, 11054, 15122, 10977, 15104, 10905, 15086, 10836,
+		15069, 10769, 15050, 10703, 15033, 10642, 15015, 10581, 14998, 10524, 14981, 10468, 14965, 10416, 14948, 10365,
+		14931, 10315, 14916, 10269, 14899, 10206, 14883, 10120, 14867, 10035, 14852, 9957, 14837, 9880, 14822, 9806,
+		14807, 9737, 14792, 9667, 14777, 9600, 14763, 9540, 14749, 9479, 14734, 9421, 14720, 9367, 14706, 9310,
+		14692, 9260, 14679, 9209, 14665, 9112, 14653, 9028, 14639, 8938, 14626, 8857, 14613, 8781, 14601, 8703,
+		14588, 8630, 14576, 8563, 14563, 8495, 14551, 8432, 14540, 8373, 14528, 8315, 14516, 8258, 14504, 8204,
+		14493, 8117, 14481, 8017, 14470, 7926, 14459, 7835, 14448, 7751, 14438, 7670, 14427, 7594, 14417, 7527,
+		14406, 7452, 14396, 7384, 14386, 7323, 14376, 7261, 14366, 7204, 14357, 7127, 14347, 7019, 14337, 6920,
+		14320, 6833, 14301, 6736, 14283, 6650, 14265, 6567, 14247, 6486, 14229, 6417, 14212, 6348, 14194, 6277,
+		14176, 6209, 14160, 6148, 14142, 6025, 14126, 5920, 14110, 5824, 14094, 5727, 14079, 5639, 14063, 5547,
+		14047, 5463, 14031, 5376, 14016, 5299, 14001, 5232, 13986, 5163, 13972, 5080, 13956, 4939, 13942, 4837,
+		13928, 4728, 13914, 4628, 13900, 4528, 13886, 4433, 13872, 4344, 13859, 4267, 13846, 4189, 13833, 4118,
+		13820, 4016, 13807, 3865, 13794, 3740, 13782, 3643, 13770, 3533, 13757, 3417, 13745, 3336, 13733, 3250,
+		13721, 3147, 13710, 3079, 13699, 2957, 13687, 2793, 13675, 2665, 13665, 2569, 13654, 2434, 13643, 2330,
+		13632, 2232, 13621, 2139, 13610, 2031, 13600, 1866, 13590, 1753, 13580, 1587, 13569, 1430, 13560, 1330,
+		13550, 1215, 13540, 1105, 13530, 1005, 13520, 901, 13511, 801, 13501, 724, 13492, 658, 13483, 585,
+		13474, 521, 13465, 462, 13456, 410, 13447, 358, 13439, 310, 13430, 267, 13421, 225, 13413, 191,
+		15942, 18744, 15957, 18494, 15971, 18257, 15985, 18060, 15999, 17909, 16011, 17789, 16024, 17691, 16036, 17608,
+		16048, 17534, 16059, 17473, 16068, 17413, 16080, 17321, 16088, 17225, 16098, 17141, 16106, 17062, 16113, 16990,
+		16121, 16922, 16127, 16859, 16133, 16799, 16138, 16743, 16143, 16691, 16148, 16643, 16151, 16594, 16154, 16549,
+		16157, 16506, 16159, 16465, 16160, 16427, 16161, 16389, 16162, 16323, 16161, 16254, 16161, 16189, 16160, 16125,
+		16158, 16065, 16156, 16005, 16153, 15948, 16149, 15892, 16146, 15840, 16142, 15790, 16137, 15741, 16133, 15693,
+		16127, 15647, 16121, 15603, 16115, 15560, 16109, 15520, 16102, 15478, 16094, 15440, 16087, 15403, 16079, 15366,
+		16071, 15304, 16062, 15234, 16055, 15172, 16045, 15107, 16036, 15046, 16026, 14987, 16017, 14930, 16007, 14874,
+		15997, 14821, 15987, 14770, 15977, 14720, 15966, 14670, 15955, 14624, 15944, 14578, 15933, 14535, 15922, 14492,
+		15911, 14451, 15900, 14411, 15888, 14373, 15876, 14335, 15865, 14265, 15853, 14193, 15841, 14126, 15830, 14062,
+		15818, 13998, 15806, 13938, 15794, 13880, 15782, 13822, 15770, 13768, 15758, 13715, 15746, 13662, 15734, 13616,
+		15722, 13567, 15710, 13520, 15698, 13475, 15686, 13432, 15674, 13390, 15662, 13351, 15650, 13312, 15638, 13236,
+		15627, 13165, 15615, 13095, 15603, 13027, 15592, 12964, 15580, 12899, 15568, 12838, 15556, 12777, 15545, 12723,
+		15534, 12668, 15522, 12615, 15511, 12564, 15500, 12514, 15489, 12467, 15478, 12421, 15467, 12379, 15456, 12336,
+		15445, 12295, 15434, 12222, 15424, 12145, 15413, 12073, 15403, 12000, 15393, 11934, 15382, 11867, 15371, 11802,
+		15361, 11742, 15343, 11683, 15323, 11627, 15303, 11572, 15284, 11520, 15265, 11470, 15244, 11418, 15225, 11370,
+		15206, 11325, 15188, 11282, 15169, 11219, 15151, 11136, 15132, 11056, 15114, 10983, 15096, 10910, 15078, 10840,
+		15060, 10773, 15043, 10708, 15026, 10648, 15009, 10588, 14992, 10530, 14976, 10476, 14958, 10420, 14943, 10371,
+		14926, 10322, 14910, 10275, 14894, 10218, 14879, 10134, 14863, 10050, 14848, 9970, 14833, 9893, 14818, 9818,
+		14803, 9745, 14788, 9679, 14773, 9612, 14760, 9552, 14745, 9490, 14731, 9431, 14717, 9376, 14704, 9324,
+		14690, 9274, 14677, 9223, 14664, 9138, 14650, 9047, 14637, 8957, 14624, 8875, 14612, 8799, 14599, 8721,
+		14587, 8648, 14575, 8581, 14562, 8512, 14550, 8447, 14538, 8389, 14527, 8330, 14515, 8272, 14503, 8221,
+		14492, 8147, 14481, 8046, 14470, 7956, 14459, 7865, 14448, 7777, 14438, 7701, 14427, 7621, 14416, 7545,
+		14406, 7472, 14396, 7404, 14386, 7345, 14376, 7281, 14366, 7221, 14357, 7162, 14347, 7059, 14338, 6959,
+		14321, 6860, 14301, 6763, 14284, 6679, 14266, 6603, 14248, 6516, 14229, 6438, 14212, 6365, 14195, 6300,
+		14179, 6240, 14162, 6174, 14145, 6093, 14128, 5973, 14111, 5862, 14094, 5752, 14079, 5666, 14063, 5572,
+		14048, 5491, 14033, 5410, 14018, 5334, 14003, 5263, 13988, 5188, 13973, 5124, 13959, 5008, 13944, 4889,
+		13930, 4780, 13916, 4667, 13902, 4569, 13888, 4476, 13875, 4393, 13862, 4309, 13848, 4225, 13835, 4145,
+		13822, 4065, 13809, 3922, 13797, 3807, 13785, 3698, 13772, 3576, 13760, 3478, 13748, 3373, 13736, 3279,
+		13724, 3196, 13713, 3114, 13701, 3000, 13689, 2843, 13678, 2732, 13667, 2599, 13656, 2473, 13645, 2369,
+		13635, 2273, 13624, 2170, 13613, 2076, 13603, 1944, 13592, 1780, 13582, 1619, 13572, 1492, 13562, 1379,
+		13552, 1232, 13542, 1123, 13533, 1031, 13523, 932, 13514, 844, 13505, 764, 13495, 682, 13486, 606,
+		13477, 543, 13468, 484, 13459, 423, 13450, 367, 13441, 319, 13433, 280, 13425, 238, 13416, 198,
+		15919, 18704, 15934, 18459, 15947, 18203, 15961, 18013, 15973, 17866, 15985, 17749, 15997, 17653, 16009, 17572,
+		16020, 17503, 16029, 17439, 16040, 17362, 16050, 17264, 16058, 17173, 16067, 17092, 16075, 17015, 16082, 16946,
+		16089, 16879, 16095, 16818, 16102, 16762, 16107, 16709, 16111, 16657, 16115, 16608, 16119, 16562, 16122, 16519,
+		16124, 16477, 16126, 16438, 16127, 16400, 16128, 16342, 16128, 16272, 16129, 16207, 16128, 16143, 16126, 16080,
+		16125, 16021, 16123, 15964, 16121, 15910, 16117, 15857, 16114, 15806, 16110, 15757, 16106, 15708, 16101, 15662,
+		16096, 15618, 16091, 15576, 16084, 15533, 16079, 15493, 16073, 15456, 16065, 15417, 16058, 15380, 16051, 15332,
+		16043, 15262, 16035, 15199, 16026, 15132, 16019, 15076, 16009, 15014, 16000, 14956, 15991, 14901, 15981, 14846,
+		15972, 14795, 15962, 14744, 15952, 14695, 15942, 14648, 15932, 14602, 15921, 14558, 15911, 14515, 15901, 14474,
+		15890, 14434, 15879, 14395, 15867, 14357, 15857, 14307, 15845, 14236, 15834, 14167, 15823, 14102, 15811, 14040,
+		15800, 13978, 15788, 13918, 15777, 13861, 15765, 13806, 15753, 13751, 15742, 13699, 15730, 13649, 15718, 13600,
+		15706, 13552, 15695, 13508, 15684, 13466, 15672, 13422, 15660, 13381, 15649, 13342, 15637, 13293, 15626, 13222,
+		15614, 13150, 15603, 13080, 15592, 13015, 15580, 12949, 15569, 12888, 15558, 12829, 15546, 12770, 15535, 12714,
+		15524, 12660, 15513, 12608, 15502, 12558, 15491, 12509, 15480, 12462, 15469, 12416, 15459, 12374, 15447, 12330,
+		15437, 12291, 15427, 12215, 15417, 12142, 15406, 12068, 15396, 11998, 15386, 11932, 15375, 11865, 15365, 11802,
+		15351, 11741, 15331, 11682, 15311, 11624, 15292, 11573, 15272, 11519, 15253, 11467, 15234, 11419, 15216, 11375,
+		15197, 11329, 15178, 11283, 15159, 11216, 15141, 11138, 15124, 11063, 15106, 10987, 15088, 10915, 15070, 10843,
+		15053, 10778, 15036, 10715, 15019, 10652, 15003, 10594, 14985, 10535, 14969, 10481, 14953, 10428, 14937, 10377,
+		14921, 10329, 14905, 10280, 14889, 10232, 14874, 10144, 14859, 10062, 14843, 9980, 14828, 9903, 14814, 9830,
+		14799, 9758, 14784, 9690, 14770, 9626, 14756, 9560, 14742, 9501, 14728, 9442, 14715, 9389, 14701, 9334,
+		14688, 9283, 14674, 9233, 14661, 9156, 14648, 9068, 14635, 8981, 14623, 8899, 14610, 8817, 14597, 8739,
+		14585, 8665, 14573, 8600, 14560, 8527, 14549, 8467, 14537, 8406, 14525, 8345, 14514, 8289, 14503, 8236,
+		14491, 8176, 14480, 8077, 14470, 7985, 14459, 7894, 14448, 7807, 14437, 7725, 14427, 7645, 14417, 7569,
+		14406, 7500, 14396, 7432, 14386, 7364, 14376, 7299, 14366, 7239, 14357, 7187, 14347, 7098, 14338, 6991,
+		14320, 6888, 14302, 6799, 14284, 6715, 14266, 6622, 14248, 6540, 14230, 6463, 14214, 6402, 14196, 6324,
+		14179, 6258, 14162, 6191, 14145, 6114, 14130, 6021, 14113, 5909, 14098, 5815, 14082, 5712, 14065, 5615,
+		14049, 5520, 14034, 5439, 14019, 5359, 14004, 5286, 13989, 5214, 13974, 5147, 13960, 5057, 13946, 4934,
+		13932, 4815, 13918, 4709, 13904, 4610, 13891, 4518, 13877, 4419, 13864, 4334, 13850, 4252, 13838, 4181,
+		13825, 4113, 13812, 3989, 13799, 3856, 13787, 3731, 13774, 3614, 13762, 3519, 13751, 3425, 13738, 3314,
+		13727, 3238, 13716, 3155, 13703, 3050, 13692, 2912, 13681, 2793, 13669, 2635, 13659, 2526, 13648, 2422,
+		13637, 2307, 13626, 2194, 13616, 2118, 13605, 1992, 13595, 1848, 13585, 1694, 13575, 1552, 13565, 1400,
+		13555, 1290, 13545, 1193, 13536, 1069, 13526, 955, 13516, 873, 13507, 781, 13498, 712, 13489, 626,
+		13480, 561, 13471, 497, 13462, 436, 13453, 379, 13444, 330, 13436, 288, 13428, 249, 13419, 205,
+		15898, 18671, 15911, 18422, 15924, 18153, 15937, 17967, 15949, 17827, 15960, 17713, 15971, 17619, 15982, 17540,
+		15993, 17472, 16002, 17412, 16012, 17308, 16021, 17212, 16030, 17124, 16037, 17042, 16044, 16967, 16052, 16902,
+		16058, 16838, 16065, 16780, 16070, 16724, 16075, 16671, 16079, 16621, 16083, 16574, 16087, 16531, 16090, 16489,
+		16092, 16448, 16093, 16409, 16094, 16360, 16096, 16291, 16096, 16224, 16096, 16158, 16096, 16098, 16095, 16037,
+		16093, 15980, 16091, 15925, 16089, 15872, 16086, 15820, 16083, 15771, 16079, 15724, 16075, 15677, 16070, 15632,
+		16065, 15588, 16061, 15548, 16056, 15508, 16049, 15468, 16043, 15431, 16038, 15396, 16030, 15359, 16023, 15292,
+		16016, 15226, 16008, 15161, 16000, 15100, 15992, 15039, 15984, 14983, 15975, 14926, 15965, 14870, 15957, 14819,
+		15947, 14768, 15938, 14719, 15928, 14671, 15919, 14626, 15910, 14582, 15899, 14538, 15889, 14496, 15879, 14456,
+		15868, 14417, 15858, 14379, 15847, 14342, 15837, 14278, 15826, 14209, 15815, 14144, 15804, 14078, 15793, 14016,
+		15782, 13956, 15770, 13898, 15759, 13841, 15748, 13786, 15737, 13734, 15726, 13684, 15714, 13634, 15703, 13586,
+		15692, 13540, 15681, 13496, 15669, 13452, 15658, 13411, 15647, 13372, 15636, 13332, 15624, 13275, 15613, 13204,
+		15602, 13134, 15591, 13066, 15580, 13002, 15569, 12937, 15557, 12876, 15546, 12817, 15535, 12760, 15525, 12706,
+		15514, 12652, 15503, 12601, 15492, 12551, 15482, 12503, 15471, 12457, 15461, 12413, 15450, 12369, 15440, 12327,
+		15429, 12287, 15419, 12208, 15409, 12136, 15398, 12061, 15388, 11991, 15379, 11927, 15368, 11860, 15358, 11800,
+		15338, 11739, 15318, 11680, 15299, 11625, 15280, 11571, 15261, 11517, 15242, 11468, 15224, 11420, 15205, 11373,
+		15186, 11327, 15168, 11285, 15151, 11227, 15133, 11142, 15115, 11064, 15097, 10989, 15079, 10916, 15063, 10850,
+		15046, 10783, 15029, 10719, 15012, 10658, 14995, 10598, 14979, 10542, 14963, 10486, 14947, 10433, 14931, 10383,
+		14915, 10334, 14899, 10287, 14884, 10241, 14869, 10157, 14854, 10072, 14839, 9991, 14824, 9915, 14809, 9839,
+		14795, 9768, 14781, 9701, 14766, 9635, 14752, 9572, 14738, 9510, 14725, 9454, 14711, 9396, 14698, 9344,
+		14684, 9291, 14672, 9246, 14658, 9176, 14645, 9085, 14632, 8995, 14620, 8914, 14608, 8838, 14595, 8757,
+		14583, 8686, 14571, 8615, 14559, 8546, 14547, 8482, 14535, 8419, 14524, 8359, 14513, 8304, 14501, 8250,
+		14490, 8197, 14480, 8107, 14469, 8010, 14458, 7919, 14447, 7829, 14437, 7750, 14426, 7668, 14416, 7591,
+		14406, 7524, 14396, 7451, 14386, 7384, 14376, 7324, 14366, 7264, 14357, 7205, 14347, 7130, 14337, 7020,
+		14322, 6933, 14303, 6838, 14285, 6742, 14267, 6655, 14249, 6575, 14232, 6499, 14213, 6417, 14196, 6345,
+		14179, 6279, 14164, 6223, 14146, 6155, 14130, 6052, 14113, 5936, 14097, 5827, 14082, 5744, 14066, 5645,
+		14051, 5563, 14036, 5477, 14022, 5401, 14006, 5319, 13991, 5244, 13977, 5180, 13963, 5110, 13948, 4975,
+		13934, 4870, 13920, 4756, 13907, 4655, 13893, 4552, 13880, 4461, 13866, 4379, 13853, 4292, 13840, 4212,
+		13827, 4135, 13814, 4034, 13802, 3917, 13789, 3781, 13777, 3667, 13765, 3567, 13753, 3457, 13741, 3352,
+		13729, 3268, 13717, 3184, 13706, 3101, 13695, 2975, 13684, 2846, 13672, 2703, 13662, 2586, 13650, 2449,
+		13639, 2335, 13629, 2252, 13619, 2149, 13608, 2058, 13598, 1924, 13588, 1737, 13578, 1599, 13568, 1463,
+		13558, 1348, 13548, 1204, 13538, 1095, 13530, 1018, 13520, 912, 13510, 812, 13501, 728, 13492, 648,
+		13483, 585, 13474, 517, 13465, 452, 13456, 397, 13447, 345, 13439, 295, 13430, 253, 13422, 212,
+		15876, 18632, 15889, 18363, 15901, 18105, 15913, 17921, 15925, 17786, 15936, 17676, 15946, 17584, 15956, 17508,
+		15966, 17441, 15976, 17361, 15984, 17253, 15994, 17163, 16001, 17077, 16009, 16998, 16016, 16928, 16023, 16861,
+		16029, 16800, 16034, 16741, 16040, 16688, 16044, 16637, 16049, 16590, 16052, 16543, 16056, 16500, 16059, 16460,
+		16060, 16419, 16062, 16382, 16064, 16310, 16065, 16244, 16065, 16178, 16065, 16114, 16065, 16055, 16064, 15997,
+		16062, 15941, 16060, 15887, 16058, 15836, 16055, 15785, 16052, 15736, 16049, 15692, 16045, 15647, 16041, 15603,
+		16037, 15562, 16031, 15521, 16026, 15482, 16021, 15445, 16014, 15407, 16008, 15372, 16003, 15319, 15995, 15250,
+		15989, 15188, 15981, 15124, 15973, 15064, 15966, 15008, 15957, 14949, 15949, 14894, 15942, 14844, 15932, 14792,
+		15924, 14743, 15915, 14695, 15905, 14648, 15896, 14603, 15887, 14560, 15877, 14519, 15868, 14478, 15857, 14438,
+		15848, 14400, 15837, 14363, 15827, 14319, 15817, 14250, 15806, 14183, 15796, 14117, 15785, 14053, 15774, 13993,
+		15764, 13934, 15753, 13878, 15742, 13821, 15732, 13770, 15721, 13718, 15709, 13666, 15699, 13619, 15688, 13573,
+		15677, 13527, 15666, 13483, 15655, 13441, 15644, 13400, 15633, 13360, 15622, 13322, 15611, 13260, 15600, 13188,
+		15589, 13116, 15579, 13052, 15568, 12987, 15557, 12924, 15546, 12865, 15535, 12806, 15525, 12750, 15514, 12696,
+		15504, 12643, 15493, 12593, 15483, 12544, 15472, 12497, 15462, 12452, 15451, 12407, 15441, 12364, 15431, 12323,
+		15421, 12279, 15411, 12201, 15401, 12129, 15391, 12054, 15381, 11987, 15371, 11920, 15361, 11855, 15343, 11794,
+		15324, 11735, 15306, 11678, 15287, 11624, 15268, 11567, 15250, 11519, 15231, 11468, 15212, 11419, 15194, 11372,
+		15176, 11329, 15158, 11285, 15140, 11221, 15123, 11144, 15106, 11069, 15089, 10996, 15071, 10922, 15054, 10849,
+		15038, 10787, 15021, 10723, 15005, 10663, 14988, 10603, 14972, 10545, 14956, 10491, 14940, 10438, 14924, 10386,
+		14909, 10339, 14894, 10292, 14879, 10246, 14864, 10166, 14849, 10082, 14835, 10006, 14819, 9925, 14805, 9851,
+		14790, 9780, 14776, 9712, 14762, 9646, 14748, 9583, 14734, 9519, 14721, 9463, 14707, 9408, 14694, 9352,
+		14681, 9302, 14668, 9251, 14655, 9194, 14642, 9099, 14630, 9017, 14617, 8931, 14605, 8852, 14592, 8770,
+		14580, 8699, 14569, 8632, 14557, 8560, 14546, 8499, 14534, 8434, 14523, 8375, 14511, 8317, 14500, 8263,
+		14489, 8209, 14478, 8130, 14468, 8034, 14457, 7939, 14447, 7858, 14436, 7772, 14426, 7691, 14415, 7613,
+		14405, 7543, 14395, 7471, 14385, 7402, 14376, 7346, 14366, 7279, 14356, 7218, 14347, 7169, 14338, 7062,
+		14321, 6964, 14303, 6865, 14284, 6769, 14267, 6690, 14249, 6604, 14232, 6522, 14214, 6446, 14198, 6378,
+		14182, 6312, 14164, 6239, 14148, 6177, 14131, 6095, 14116, 5999, 14099, 5880, 14084, 5782, 14068, 5676,
+		14052, 5581, 14038, 5505, 14023, 5427, 14008, 5347, 13993, 5275, 13979, 5203, 13965, 5138, 13950, 5024,
+		13936, 4912, 13923, 4802, 13909, 4694, 13895, 4598, 13882, 4499, 13868, 4410, 13855, 4323, 13842, 4245,
+		13829, 4175, 13816, 4097, 13804, 3966, 13791, 3822, 13779, 3713, 13767, 3604, 13755, 3493, 13743, 3398,
+		13732, 3302, 13720, 3212, 13709, 3134, 13698, 3046, 13686, 2896, 13675, 2759, 13664, 2631, 13653, 2509,
+		13643, 2397, 13632, 2284, 13621, 2185, 13611, 2092, 13601, 1962, 13590, 1800, 13581, 1679, 13570, 1510,
+		13560, 1371, 13550, 1250, 13541, 1136, 13531, 1009, 13522, 919, 13513, 842, 13504, 757, 13495, 678,
+		13486, 604, 13476, 524, 13468, 467, 13459, 410, 13450, 354, 13441, 301, 13433, 256, 13425, 221,
+		15855, 18597, 15867, 18311, 15880, 18060, 15891, 17881, 15901, 17746, 15912, 17640, 15921, 17552, 15931, 17478,
+		15941, 17413, 15949, 17305, 15958, 17205, 15966, 17111, 15974, 17031, 15981, 16954, 15988, 16887, 15994, 16821,
+		16000, 16760, 16006, 16706, 16010, 16653, 16015, 16604, 16019, 16556, 16022, 16512, 16025, 16470, 16028, 16431,
+		16031, 16394, 16032, 16330, 16033, 16261, 16035, 16196, 16034, 16130, 16034, 16070, 16033, 16011, 16033, 15956,
+		16032, 15902, 16030, 15850, 16028, 15801, 16026, 15752, 16023, 15705, 16019, 15659, 16016, 15617, 16011, 15574,
+		16008, 15535, 16003, 15495, 15998, 15457, 15993, 15421, 15987, 15386, 15981, 15340, 15975, 15275, 15969, 15213,
+		15962, 15149, 15955, 15089, 15948, 15030, 15941, 14975, 15933, 14920, 15925, 14866, 15916, 14813, 15909, 14766,
+		15900, 14717, 15891, 14671, 15882, 14625, 15873, 14581, 15864, 14539, 15855, 14498, 15845, 14458, 15836, 14419,
+		15826, 14382, 15817, 14347, 15806, 14286, 15796, 14218, 15787, 14153, 15777, 14090, 15767, 14030, 15756, 13970,
+		15746, 13913, 15736, 13857, 15725, 13801, 15715, 13751, 15704, 13699, 15693, 13651, 15683, 13604, 15672, 13558,
+		15662, 13514, 15651, 13471, 15641, 13429, 15630, 13389, 15619, 13350, 15609, 13312, 15598, 13241, 15587, 13169,
+		15577, 13103, 15567, 13038, 15556, 12973, 15545, 12912, 15535, 12853, 15524, 12794, 15514, 12740, 15504, 12686,
+		15493, 12635, 15483, 12584, 15473, 12536, 15463, 12490, 15453, 12444, 15442, 12400, 15433, 12359, 15423, 12318,
+		15413, 12271, 15403, 12193, 15393, 12121, 15383, 12050, 15374, 11982, 15364, 11915, 15349, 11851, 15331, 11792,
+		15311, 11731, 15293, 11675, 15274, 11619, 15255, 11564, 15238, 11517, 15219, 11466, 15201, 11418, 15184, 11373,
+		15166, 11329, 15147, 11284, 15130, 11224, 15113, 11145, 15096, 11067, 15078, 10992, 15062, 10924, 15046, 10858,
+		15029, 10790, 15013, 10727, 14997, 10665, 14980, 10605, 14965, 10549, 14950, 10496, 14933, 10441, 14919, 10393,
+		14903, 10343, 14888, 10296, 14873, 10251, 14858, 10174, 14843, 10093, 14829, 10012, 14815, 9936, 14800, 9858,
+		14786, 9792, 14772, 9721, 14758, 9655, 14744, 9592, 14731, 9532, 14717, 9473, 14704, 9417, 14691, 9362,
+		14678, 9314, 14665, 9263, 14652, 9213, 14639, 9120, 14627, 9030, 14615, 8949, 14602, 8868, 14591, 8791,
+		14579, 8716, 14567, 8647, 14555, 8575, 14544, 8512, 14533, 8451, 14521, 8389, 14510, 8335, 14499, 8278,
+		14488, 8223, 14477, 8158, 14466, 8056, 14455, 7962, 14445, 7878, 14435, 7792, 14424, 7712, 14414, 7638,
+		14404, 7561, 14394, 7491, 14385, 7425, 14375, 7362, 14366, 7299, 14356, 7238, 14347, 7186, 14337, 7092,
+		14319, 6982, 14302, 6893, 14284, 6798, 14267, 6714, 14249, 6626, 14232, 6548, 14216, 6476, 14199, 6400,
+		14181, 6329, 14165, 6265, 14148, 6201, 14133, 6146, 14116, 6027, 14101, 5917, 14085, 5818, 14070, 5728,
+		14055, 5636, 14039, 5542, 14024, 5454, 14009, 5372, 13994, 5295, 13980, 5229, 13967, 5168, 13952, 5081,
+		13938, 4956, 13924, 4852, 13910, 4729, 13897, 4632, 13883, 4531, 13870, 4442, 13857, 4357, 13844, 4276,
+		13832, 4202, 13819, 4127, 13807, 4020, 13794, 3882, 13782, 3762, 13770, 3660, 13758, 3532, 13746, 3442,
+		13735, 3350, 13723, 3247, 13711, 3167, 13700, 3084, 13689, 2958, 13677, 2805, 13666, 2652, 13656, 2564,
+		13645, 2437, 13634, 2322, 13624, 2232, 13613, 2125, 13603, 2031, 13593, 1862, 13583, 1696, 13573, 1532,
+		13564, 1437, 13554, 1304, 13544, 1181, 13535, 1072, 13526, 966, 13515, 856, 13506, 770, 13497, 693,
+		13488, 620, 13480, 551, 13471, 488, 13462, 423, 13453, 365, 13444, 316, 13436, 272, 13428, 228,
+		15835, 18564, 15846, 18257, 15858, 18012, 15869, 17842, 15878, 17709, 15888, 17606, 15898, 17520, 15907, 17449,
+		15916, 17365, 15924, 17253, 15932, 17154, 15940, 17067, 15946, 16984, 15954, 16913, 15960, 16844, 15966, 16781,
+		15973, 16726, 15977, 16669, 15981, 16618, 15986, 16572, 15990, 16526, 15994, 16483, 15997, 16442, 15999, 16404,
+		16001, 16350, 16002, 16279, 16003, 16212, 16005, 16149, 16005, 16086, 16005, 16029, 16005, 15972, 16003, 15916,
+		16002, 15863, 16000, 15813, 15998, 15765, 15997, 15719, 15994, 15675, 15991, 15631, 15987, 15588, 15983, 15546,
+		15979, 15507, 15975, 15470, 15971, 15433, 15965, 15397, 15961, 15364, 15955, 15300, 15948, 15233, 15942, 15171,
+		15936, 15113, 15929, 15053, 15923, 14997, 15915, 14941, 15908, 14889, 15901, 14837, 15893, 14788, 15884, 14737,
+		15877, 14693, 15869, 14647, 15860, 14603, 15852, 14561, 15843, 14518, 15834, 14479, 15825, 14440, 15815, 14403,
+		15806, 14366, 15797, 14325, 15787, 14257, 15778, 14192, 15768, 14127, 15758, 14065, 15748, 14004, 15739, 13948,
+		15728, 13891, 15718, 13835, 15708, 13783, 15698, 13732, 15688, 13683, 15678, 13635, 15667, 13587, 15657, 13543,
+		15647, 13500, 15637, 13458, 15627, 13417, 15616, 13378, 15606, 13340, 15596, 13295, 15585, 13222, 15575, 13152,
+		15565, 13088, 15554, 13021, 15544, 12959, 15534, 12900, 15524, 12840, 15513, 12783, 15504, 12730, 15493, 12676,
+		15483, 12626, 15473, 12576, 15463, 12528, 15453, 12482, 15443, 12437, 15434, 12395, 15424, 12353, 15414, 12313,
+		15404, 12261, 15395, 12185, 15385, 12113, 15376, 12042, 15367, 11978, 15354, 11911, 15336, 11849, 15317, 11789,
+		15298, 11728, 15280, 11673, 15261, 11617, 15243, 11565, 15225, 11513, 15207, 11464, 15189, 11416, 15172, 11372,
+		15155, 11327, 15138, 11286, 15121, 11226, 15104, 11147, 15087, 11070, 15071, 11000, 15054, 10926, 15037, 10855,
+		15021, 10792, 15005, 10728, 14990, 10670, 14974, 10610, 14958, 10552, 14942, 10498, 14927, 10445, 14912, 10397,
+		14897, 10349, 14882, 10301, 14867, 10256, 14853, 10187, 14838, 10102, 14824, 10024, 14809, 9944, 14795, 9870,
+		14781, 9799, 14767, 9729, 14754, 9665, 14740, 9602, 14727, 9542, 14714, 9482, 14701, 9427, 14688, 9374,
+		14675, 9322, 14662, 9270, 14649, 9224, 14637, 9141, 14625, 9052, 14613, 8968, 14600, 8885, 14588, 8808,
+		14576, 8731, 14565, 8662, 14553, 8594, 14542, 8528, 14531, 8466, 14519, 8401, 14508, 8347, 14498, 8292,
+		14486, 8236, 14476, 8187, 14465, 8087, 14455, 7996, 14445, 7909, 14434, 7818, 14424, 7734, 14414, 7660,
+		14404, 7584, 14394, 7510, 14384, 7446, 14375, 7381, 14365, 7316, 14356, 7260, 14346, 7202, 14337, 7124,
+		14320, 7025, 14303, 6932, 14285, 6831, 14267, 6737, 14250, 6659, 14232, 6574, 14215, 6497, 14198, 6421,
+		14182, 6355, 14166, 6290, 14149, 6224, 14132, 6159, 14117, 6064, 14102, 5959, 14086, 5856, 14071, 5760,
+		14056, 5658, 14041, 5572, 14026, 5490, 14012, 5417, 13997, 5334, 13982, 5260, 13967, 5185, 13953, 5121,
+		13939, 4999, 13926, 4886, 13912, 4781, 13899, 4675, 13886, 4575, 13873, 4481, 13860, 4395, 13847, 4309,
+		13834, 4234, 13821, 4150, 13809, 4079, 13796, 3937, 13784, 3816, 13772, 3694, 13760, 3585, 13748, 3478,
+		13737, 3383, 13725, 3283, 13714, 3200, 13702, 3119, 13691, 3013, 13680, 2860, 13669, 2727, 13659, 2607,
+		13648, 2473, 13637, 2364, 13627, 2265, 13616, 2159, 13607, 2082, 13597, 1935, 13586, 1757, 13576, 1614,
+		13567, 1475, 13557, 1332, 13548, 1228, 13537, 1090, 13528, 994, 13519, 908, 13510, 817, 13500, 721,
+		13491, 636, 13483, 572, 13474, 505, 13465, 440, 13456, 383, 13448, 333, 13439, 284, 13431, 236,
+		15815, 18534, 15826, 18207, 15837, 17970, 15847, 17801, 15856, 17674, 15866, 17575, 15875, 17492, 15883, 17420,
+		15891, 17308, 15900, 17204, 15907, 17106, 15915, 17022, 15921, 16943, 15928, 16871, 15934, 16805, 15940, 16746,
+		15944, 16688, 15950, 16636, 15954, 16586, 15958, 16539, 15962, 16495, 15965, 16454, 15967, 16414, 15970, 16369,
+		15972, 16298, 15974, 16232, 15975, 16167, 15976, 16104, 15977, 16045, 15976, 15988, 15976, 15932, 15975, 15879,
+		15974, 15828, 15972, 15779, 15970, 15732, 15968, 15686, 15965, 15642, 15963, 15601, 15960, 15561, 15956, 15520,
+		15952, 15481, 15948, 15445, 15944, 15409, 15939, 15375, 15934, 15322, 15929, 15260, 15923, 15197, 15916, 15133,
+		15911, 15075, 15904, 15019, 15898, 14964, 15891, 14911, 15883, 14857, 15877, 14809, 15869, 14759, 15863, 14715,
+		15854, 14667, 15846, 14623, 15838, 14581, 15829, 14538, 15821, 14498, 15812, 14459, 15804, 14421, 15795, 14385,
+		15786, 14350, 15777, 14294, 15768, 14227, 15758, 14162, 15749, 14099, 15740, 14038, 15730, 13980, 15720, 13922,
+		15711, 13868, 15701, 13815, 15691, 13763, 15682, 13714, 15672, 13665, 15662, 13617, 15652, 13572, 15642, 13528,
+		15632, 13486, 15622, 13445, 15612, 13404, 15602, 13366, 15592, 13329, 15583, 13274, 15572, 13202, 15563, 13136,
+		15553, 13071, 15543, 13006, 15533, 12945, 15523, 12886, 15513, 12827, 15503, 12773, 15493, 12718, 15483, 12665,
+		15473, 12616, 15463, 12567, 15454, 12521, 15444, 12474, 15434, 12432, 15425, 12389, 15415, 12347, 15405, 12307,
+		15396, 12251, 15387, 12176, 15377, 12106, 15368, 12035, 15358, 11969, 15339, 11905, 15321, 11844, 15302, 11783,
+		15284, 11724, 15266, 11669, 15248, 11614, 15231, 11563, 15214, 11512, 15196, 11463, 15179, 11417, 15161, 11369,
+		15144, 11327, 15128, 11286, 15110, 11222, 15094, 11146, 15078, 11072, 15062, 10999, 15045, 10928, 15029, 10861,
+		15014, 10798, 14998, 10733, 14981, 10669, 14966, 10614, 14951, 10557, 14936, 10504, 14921, 10451, 14905, 10400,
+		14890, 10351, 14875, 10303, 14861, 10261, 14846, 10194, 14832, 10112, 14818, 10029, 14804, 9955, 14790, 9880,
+		14777, 9810, 14763, 9741, 14750, 9675, 14737, 9613, 14723, 9549, 14710, 9494, 14697, 9436, 14684, 9381,
+		14671, 9329, 14659, 9281, 14646, 9232, 14634, 9159, 14621, 9065, 14610, 8983, 14598, 8905, 14586, 8826,
+		14575, 8752, 14563, 8680, 14552, 8609, 14540, 8541, 14529, 8481, 14518, 8418, 14507, 8362, 14496, 8307,
+		14485, 8249, 14475, 8202, 14464, 8108, 14454, 8018, 14443, 7930, 14433, 7842, 14423, 7761, 14413, 7684,
+		14403, 7604, 14393, 7534, 14384, 7466, 14374, 7399, 14365, 7335, 14355, 7276, 14346, 7220, 14337, 7163,
+		14321, 7059, 14303, 6958, 14284, 6861, 14267, 6771, 14250, 6693, 14233, 6606, 14216, 6523, 14199, 6453,
+		14183, 6380, 14166, 6310, 14150, 6240, 14134, 6186, 14119, 6118, 14103, 5995, 14087, 5884, 14071, 5785,
+		14056, 5695, 14041, 5604, 14026, 5515, 14011, 5425, 13997, 5357, 13983, 5284, 13970, 5224, 13956, 5156,
+		13942, 5055, 13928, 4931, 13915, 4825, 13901, 4712, 13888, 4615, 13875, 4517, 13862, 4435, 13849, 4338,
+		13836, 4260, 13824, 4190, 13811, 4112, 13799, 4000, 13786, 3857, 13775, 3749, 13763, 3626, 13751, 3523,
+		13739, 3412, 13727, 3323, 13716, 3235, 13705, 3153, 13694, 3080, 13683, 2922, 13672, 2784, 13661, 2649,
+		13650, 2514, 13640, 2408, 13630, 2299, 13619, 2196, 13609, 2107, 13599, 1973, 13589, 1832, 13579, 1659,
+		13569, 1510, 13559, 1378, 13550, 1256, 13540, 1138, 13531, 1035, 13522, 928, 13512, 820, 13503, 744,
+		13494, 667, 13485, 587, 13477, 520, 13468, 456, 13459, 397, 13451, 343, 13442, 290, 13434, 243,
+		15796, 18505, 15806, 18159, 15816, 17923, 15825, 17762, 15835, 17641, 15843, 17541, 15852, 17460, 15860, 17377,
+		15868, 17259, 15876, 17154, 15884, 17064, 15890, 16976, 15896, 16901, 15903, 16834, 15908, 16768, 15914, 16710,
+		15919, 16655, 15922, 16601, 15927, 16555, 15931, 16509, 15935, 16467, 15938, 16427, 15940, 16388, 15942, 16319,
+		15944, 16248, 15946, 16183, 15947, 16121, 15948, 16060, 15948, 16002, 15948, 15947, 15947, 15892, 15947, 15842,
+		15946, 15793, 15944, 15745, 15943, 15700, 15941, 15656, 15938, 15611, 15935, 15571, 15932, 15532, 15930, 15494,
+		15926, 15457, 15921, 15420, 15917, 15386, 15913, 15346, 15908, 15280, 15902, 15216, 15898, 15157, 15892, 15099,
+		15885, 15038, 15880, 14985, 15873, 14931, 15867, 14880, 15861, 14830, 15853, 14779, 15846, 14733, 15839, 14687,
+		15832, 14644, 15824, 14599, 15816, 14557, 15808, 14518, 15800, 14478, 15792, 14441, 15783, 14403, 15775, 14367,
+		15766, 14329, 15757, 14263, 15748, 14196, 15740, 14134, 15730, 14072, 15721, 14013, 15712, 13957, 15703, 13901,
+		15694, 13848, 15684, 13795, 15675, 13745, 15666, 13696, 15656, 13647, 15646, 13601, 15637, 13557, 15627, 13514,
+		15618, 13472, 15608, 13431, 15598, 13392, 15589, 13355, 15579, 13318, 15569, 13252, 15559, 13184, 15550, 13117,
+		15540, 13052, 15530, 12990, 15521, 12930, 15511, 12871, 15501, 12816, 15491, 12759, 15482, 12707, 15473, 12657,
+		15463, 12607, 15453, 12558, 15444, 12512, 15434, 12466, 15425, 12425, 15415, 12381, 15406, 12341, 15397, 12303,
+		15388, 12240, 15378, 12166, 15369, 12097, 15360, 12026, 15342, 11963, 15324, 11898, 15306, 11837, 15288, 11776,
+		15271, 11721, 15253, 11665, 15235, 11610, 15219, 11560, 15201, 11508, 15184, 11461, 15167, 11415, 15150, 11369,
+		15134, 11327, 15117, 11285, 15100, 11222, 15084, 11146, 15068, 11071, 15052, 10997, 15036, 10929, 15021, 10864,
+		15005, 10796, 14989, 10735, 14975, 10678, 14959, 10618, 14943, 10559, 14928, 10504, 14914, 10455, 14899, 10404,
+		14885, 10357, 14870, 10310, 14855, 10265, 14841, 10204, 14827, 10119, 14813, 10040, 14799, 9963, 14785, 9889,
+		14772, 9819, 14758, 9748, 14745, 9685, 14732, 9620, 14719, 9559, 14706, 9500, 14693, 9445, 14680, 9389,
+		14668, 9340, 14655, 9288, 14643, 9240, 14631, 9173, 14619, 9087, 14607, 8998, 14596, 8920, 14583, 8837,
+		14572, 8764, 14561, 8693, 14549, 8625, 14538, 8558, 14527, 8495, 14516, 8435, 14505, 8375, 14494, 8319,
+		14483, 8264, 14473, 8214, 14463, 8139, 14452, 8038, 14442, 7953, 14432, 7861, 14422, 7781, 14412, 7704,
+		14402, 7625, 14393, 7554, 14383, 7487, 14373, 7416, 14364, 7355, 14356, 7298, 14346, 7237, 14337, 7182,
+		14320, 7090, 14302, 6992, 14284, 6892, 14267, 6801, 14250, 6716, 14233, 6627, 14216, 6550, 14200, 6477,
+		14183, 6405, 14167, 6332, 14151, 6271, 14135, 6208, 14119, 6148, 14103, 6033, 14088, 5931, 14074, 5836,
+		14058, 5731, 14043, 5636, 14028, 5548, 14014, 5467, 13999, 5386, 13985, 5310, 13970, 5235, 13956, 5167,
+		13942, 5086, 13931, 4994, 13917, 4878, 13904, 4764, 13890, 4657, 13877, 4553, 13864, 4461, 13851, 4376,
+		13838, 4291, 13826, 4214, 13813, 4138, 13801, 4046, 13789, 3915, 13777, 3789, 13765, 3676, 13753, 3566,
+		13742, 3460, 13730, 3365, 13719, 3270, 13707, 3177, 13696, 3094, 13686, 2972, 13675, 2850, 13664, 2701,
+		13654, 2574, 13643, 2461, 13632, 2334, 13622, 2232, 13611, 2133, 13602, 2037, 13592, 1874, 13581, 1707,
+		13572, 1573, 13562, 1415, 13553, 1300, 13543, 1180, 13534, 1052, 13525, 960, 13516, 867, 13506, 768,
+		13497, 681, 13488, 597, 13479, 533, 13471, 470, 13462, 408, 13454, 353, 13445, 297, 13437, 252,
+		15777, 18477, 15787, 18113, 15796, 17884, 15805, 17724, 15814, 17606, 15822, 17511, 15830, 17433, 15838, 17326,
+		15845, 17208, 15852, 17106, 15860, 17019, 15866, 16937, 15872, 16861, 15878, 16795, 15883, 16732, 15888, 16673,
+		15893, 16620, 15897, 16571, 15901, 16525, 15905, 16480, 15908, 16438, 15911, 16399, 15913, 16339, 15915, 16268,
+		15917, 16202, 15919, 16137, 15920, 16076, 15922, 16020, 15921, 15962, 15921, 15908, 15920, 15856, 15920, 15808,
+		15919, 15759, 15917, 15712, 15916, 15668, 15914, 15625, 15912, 15584, 15909, 15544, 15906, 15505, 15903, 15467,
+		15899, 15431, 15896, 15398, 15892, 15364, 15887, 15301, 15882, 15238, 15878, 15177, 15872, 15117, 15867, 15061,
+		15862, 15008, 15856, 14951, 15850, 14900, 15843, 14848, 15837, 14799, 15831, 14753, 15824, 14706, 15817, 14662,
+		15809, 14617, 15802, 14577, 15795, 14537, 15786, 14496, 15779, 14459, 15771, 14421, 15763, 14385, 15755, 14351,
+		15747, 14297, 15738, 14232, 15729, 14167, 15721, 14106, 15712, 14046, 15704, 13989, 15695, 13932, 15686, 13879,
+		15677, 13825, 15668, 13774, 15658, 13724, 15650, 13677, 15641, 13631, 15631, 13586, 15622, 13542, 15612, 13499,
+		15603, 13459, 15594, 13419, 15584, 13381, 15575, 13343, 15565, 13302, 15556, 13231, 15547, 13164, 15537, 13099,
+		15528, 13035, 15518, 12973, 15509, 12914, 15499, 12856, 15490, 12801, 15480, 12746, 15471, 12695, 15462, 12644,
+		15453, 12596, 15444, 12550, 15434, 12504, 15425, 12459, 15416, 12417, 15406, 12374, 15398, 12335, 15388, 12296,
+		15379, 12230, 15370, 12159, 15361, 12088, 15344, 12019, 15327, 11956, 15308, 11889, 15292, 11833, 15274, 11772,
+		15257, 11715, 15240, 11659, 15222, 11606, 15206, 11555, 15189, 11506, 15172, 11459, 15155, 11412, 15139, 11368,
+		15123, 11325, 15106, 11283, 15092, 11227, 15075, 11148, 15058, 11069, 15043, 11000, 15027, 10931, 15011, 10862,
+		14996, 10796, 14980, 10734, 14966, 10676, 14951, 10618, 14936, 10563, 14922, 10512, 14907, 10458, 14891, 10405,
+		14877, 10357, 14863, 10312, 14849, 10269, 14835, 10210, 14821, 10128, 14807, 10048, 14793, 9971, 14780, 9897,
+		14767, 9826, 14754, 9759, 14740, 9691, 14727, 9628, 14714, 9566, 14702, 9509, 14689, 9453, 14676, 9398,
+		14664, 9347, 14652, 9296, 14640, 9250, 14628, 9190, 14616, 9102, 14604, 9013, 14592, 8933, 14581, 8858,
+		14570, 8782, 14558, 8710, 14547, 8638, 14536, 8572, 14524, 8507, 14514, 8446, 14503, 8387, 14492, 8331,
+		14482, 8278, 14471, 8227, 14461, 8160, 14451, 8064, 14441, 7976, 14431, 7887, 14421, 7801, 14411, 7724,
+		14401, 7646, 14392, 7573, 14382, 7504, 14373, 7433, 14364, 7375, 14354, 7310, 14345, 7253, 14336, 7195,
+		14319, 7120, 14301, 7019, 14284, 6922, 14267, 6830, 14250, 6739, 14233, 6660, 14216, 6577, 14200, 6501,
+		14183, 6423, 14167, 6358, 14151, 6292, 14135, 6227, 14119, 6162, 14104, 6078, 14089, 5971, 14074, 5865,
+		14059, 5768, 14045, 5674, 14030, 5588, 14015, 5499, 14001, 5414, 13987, 5341, 13973, 5269, 13959, 5202,
+		13945, 5130, 13931, 5017, 13917, 4893, 13904, 4784, 13891, 4688, 13879, 4597, 13865, 4497, 13853, 4413,
+		13840, 4324, 13828, 4243, 13815, 4168, 13803, 4098, 13791, 3958, 13779, 3844, 13768, 3716, 13756, 3605,
+		13744, 3496, 13733, 3392, 13722, 3304, 13710, 3210, 13699, 3132, 13688, 3028, 13677, 2882, 13666, 2735,
+		13656, 2617, 13645, 2498, 13635, 2382, 13625, 2279, 13614, 2168, 13604, 2076, 13594, 1924, 13585, 1772,
+		13575, 1614, 13565, 1462, 13556, 1354, 13546, 1209, 13537, 1099, 13528, 997, 13518, 878, 13509, 790,
+		13501, 718, 13492, 632, 13483, 554, 13474, 484, 13465, 421, 13457, 369, 13448, 309, 13440, 260,
+		15759, 18448, 15768, 18067, 15776, 17842, 15785, 17689, 15793, 17574, 15801, 17483, 15809, 17405, 15816, 17273,
+		15823, 17160, 15830, 17063, 15836, 16973, 15842, 16895, 15849, 16825, 15853, 16756, 15859, 16697, 15863, 16640,
+		15868, 16591, 15872, 16540, 15876, 16495, 15880, 16453, 15883, 16412, 15885, 16362, 15888, 16291, 15890, 16222,
+		15891, 16157, 15892, 16092, 15894, 16034, 15894, 15978, 15894, 15922, 15894, 15870, 15894, 15821, 15894, 15772,
+		15893, 15727, 15891, 15681, 15890, 15637, 15888, 15595, 15885, 15555, 15883, 15516, 15880, 15479, 15877, 15443,
+		15873, 15407, 15870, 15374, 15866, 15322, 15863, 15260, 15858, 15197, 15853, 15138, 15848, 15081, 15843, 15025,
+		15838, 14972, 15833, 14920, 15827, 14868, 15821, 14820, 15814, 14770, 15808, 14725, 15801, 14681, 15795, 14637,
+		15788, 14595, 15780, 14553, 15773, 14513, 15766, 14476, 15758, 14438, 15751, 14402, 15743, 14367, 15735, 14330,
+		15727, 14264, 15719, 14200, 15711, 14139, 15703, 14079, 15695, 14021, 15686, 13964, 15677, 13908, 15669, 13855,
+		15660, 13804, 15651, 13754, 15642, 13705, 15634, 13658, 15625, 13613, 15616, 13570, 15607, 13527, 15598, 13484,
+		15589, 13445, 15580, 13406, 15570, 13368, 15561, 13332, 15552, 13279, 15543, 13212, 15534, 13145, 15525, 13080,
+		15515, 13017, 15506, 12959, 15497, 12899, 15488, 12842, 15479, 12787, 15469, 12734, 15460, 12683, 15451, 12633,
+		15442, 12585, 15433, 12538, 15424, 12494, 15415, 12450, 15407, 12410, 15397, 12367, 15389, 12329, 15379, 12290,
+		15371, 12219, 15362, 12147, 15347, 12079, 15330, 12013, 15312, 11948, 15295, 11885, 15277, 11825, 15261, 11766,
+		15244, 11711, 15227, 11656, 15210, 11604, 15193, 11552, 15177, 11503, 15160, 11456, 15144, 11410, 15128, 11365,
+		15112, 11324, 15096, 11282, 15081, 11223, 15065, 11145, 15049, 11069, 15034, 11001, 15018, 10931, 15003, 10863,
+		14988, 10801, 14972, 10735, 14957, 10676, 14943, 10620, 14928, 10565, 14913, 10510, 14899, 10459, 14885, 10411,
+		14871, 10365, 14857, 10317, 14842, 10271, 14829, 10217, 14815, 10132, 14802, 10057, 14788, 9978, 14775, 9905,
+		14761, 9833, 14749, 9767, 14736, 9701, 14723, 9636, 14710, 9576, 14697, 9517, 14685, 9460, 14673, 9407,
+		14660, 9353, 14649, 9306, 14636, 9256, 14625, 9207, 14612, 9114, 14601, 9030, 14589, 8947, 14578, 8869,
+		14566, 8792, 14555, 8720, 14544, 8651, 14533, 8586, 14522, 8522, 14511, 8457, 14501, 8401, 14490, 8345,
+		14480, 8290, 14469, 8238, 14459, 8182, 14449, 8088, 14440, 7999, 14430, 7908, 14420, 7827, 14410, 7748,
+		14400, 7665, 14391, 7592, 14381, 7523, 14372, 7455, 14363, 7390, 14354, 7330, 14345, 7270, 14336, 7217,
+		14318, 7153, 14301, 7050, 14283, 6952, 14266, 6856, 14249, 6765, 14233, 6687, 14216, 6604, 14199, 6522,
+		14184, 6456, 14167, 6381, 14151, 6310, 14135, 6245, 14120, 6190, 14105, 6119, 14090, 6005, 14075, 5901,
+		14060, 5801, 14046, 5705, 14030, 5605, 14016, 5524, 14003, 5449, 13988, 5369, 13974, 5293, 13960, 5223,
+		13947, 5159, 13933, 5074, 13920, 4960, 13906, 4841, 13893, 4726, 13880, 4619, 13867, 4523, 13855, 4441,
+		13842, 4352, 13830, 4274, 13818, 4197, 13806, 4124, 13793, 4007, 13782, 3885, 13770, 3761, 13758, 3643,
+		13746, 3528, 13735, 3439, 13723, 3331, 13712, 3241, 13701, 3160, 13690, 3077, 13680, 2949, 13669, 2790,
+		13658, 2664, 13648, 2532, 13637, 2416, 13627, 2306, 13617, 2207, 13607, 2113, 13597, 1990, 13588, 1833,
+		13577, 1651, 13568, 1516, 13558, 1372, 13549, 1242, 13540, 1142, 13530, 1017, 13521, 914, 13512, 821,
+		13503, 722, 13494, 641, 13485, 574, 13477, 502, 13468, 432, 13459, 373, 13451, 316, 13443, 269,
+		15740, 18408, 15749, 18022, 15757, 17806, 15765, 17656, 15773, 17543, 15781, 17455, 15788, 17353, 15795, 17224,
+		15801, 17115, 15808, 17019, 15815, 16935, 15819, 16855, 15825, 16785, 15831, 16724, 15836, 16665, 15840, 16608,
+		15843, 16557, 15847, 16510, 15852, 16467, 15854, 16423, 15858, 16386, 15860, 16313, 15862, 16242, 15864, 16174,
+		15865, 16110, 15867, 16051, 15868, 15994, 15868, 15936, 15868, 15883, 15868, 15833, 15868, 15784, 15868, 15737,
+		15866, 15691, 15866, 15649, 15865, 15608, 15862, 15566, 15860, 15527, 15858, 15489, 15855, 15453, 15852, 15418,
+		15849, 15384, 15846, 15343, 15842, 15280, 15838, 15219, 15835, 15161, 15829, 15100, 15824, 15044, 15820, 14990,
+		15815, 14938, 15809, 14887, 15804, 14838, 15798, 14789, 15792, 14743, 15785, 14697, 15779, 14654, 15773, 14612,
+		15767, 14572, 15760, 14531, 15753, 14493, 15745, 14454, 15738, 14419, 15731, 14384, 15723, 14349, 15716, 14298,
+		15708, 14231, 15701, 14170, 15692, 14109, 15684, 14050, 15676, 13993, 15668, 13939, 15660, 13885, 15652, 13832,
+		15644, 13783, 15635, 13733, 15627, 13686, 15618, 13639, 15609, 13595, 15600, 13551, 15592, 13510, 15583, 13470,
+		15574, 13431, 15565, 13392, 15556, 13355, 15548, 13320, 15539, 13258, 15530, 13191, 15521, 13124, 15512, 13062,
+		15503, 13001, 15494, 12941, 15485, 12883, 15477, 12829, 15468, 12775, 15459, 12722, 15450, 12671, 15441, 12623,
+		15432, 12575, 15423, 12528, 15414, 12483, 15406, 12442, 15397, 12400, 15388, 12360, 15379, 12321, 15371, 12278,
+		15362, 12208, 15347, 12135, 15331, 12069, 15313, 12002, 15297, 11940, 15280, 11877, 15264, 11819, 15246, 11760,
+		15230, 11704, 15213, 11651, 15197, 11599, 15181, 11549, 15165, 11500, 15149, 11454, 15132, 11408, 15117, 11364,
+		15101, 11322, 15085, 11280, 15070, 11218, 15054, 11140, 15039, 11070, 15024, 10998, 15008, 10927, 14993, 10864,
+		14979, 10801, 14964, 10738, 14949, 10680, 14935, 10623, 14920, 10566, 14906, 10513, 14891, 10461, 14877, 10411,
+		14862, 10360, 14850, 10318, 14837, 10277, 14823, 10228, 14809, 10142, 14795, 10060, 14783, 9986, 14769, 9912,
+		14756, 9840, 14744, 9775, 14731, 9707, 14718, 9643, 14706, 9583, 14693, 9526, 14681, 9467, 14669, 9415,
+		14656, 9362, 14644, 9311, 14632, 9265, 14620, 9216, 14609, 9130, 14598, 9045, 14586, 8962, 14574, 8881,
+		14564, 8809, 14553, 8738, 14541, 8664, 14531, 8599, 14520, 8534, 14509, 8473, 14499, 8413, 14488, 8355,
+		14478, 8301, 14468, 8248, 14458, 8202, 14448, 8110, 14438, 8018, 14428, 7931, 14419, 7845, 14409, 7767,
+		14399, 7684, 14390, 7614, 14381, 7545, 14372, 7474, 14363, 7413, 14353, 7345, 14344, 7284, 14335, 7233,
+		14317, 7175, 14300, 7080, 14283, 6986, 14266, 6887, 14249, 6797, 14232, 6712, 14216, 6626, 14199, 6547,
+		14183, 6474, 14167, 6402, 14151, 6332, 14136, 6270, 14121, 6209, 14106, 6147, 14091, 6037, 14076, 5938,
+		14061, 5835, 14046, 5732, 14031, 5643, 14017, 5560, 14003, 5476, 13988, 5388, 13975, 5316, 13961, 5251,
+		13947, 5179, 13934, 5108, 13920, 4979, 13907, 4873, 13895, 4771, 13882, 4672, 13869, 4574, 13856, 4468,
+		13844, 4387, 13832, 4302, 13819, 4222, 13807, 4150, 13795, 4066, 13783, 3931, 13771, 3802, 13760, 3691,
+		13749, 3579, 13737, 3466, 13726, 3367, 13715, 3284, 13704, 3193, 13693, 3104, 13682, 2986, 13672, 2837,
+		13661, 2711, 13651, 2573, 13640, 2461, 13630, 2342, 13620, 2234, 13610, 2140, 13600, 2041, 13590, 1886,
+		13580, 1696, 13571, 1573, 13561, 1422, 13552, 1291, 13542, 1158, 13533, 1052, 13524, 941, 13515, 843,
+		13506, 757, 13498, 675, 13488, 585, 13480, 518, 13471, 446, 13463, 390, 13454, 327, 13446, 277,
+		15723, 18355, 15731, 17980, 15739, 17772, 15747, 17626, 15754, 17515, 15761, 17427, 15768, 17302, 15774, 17177,
+		15781, 17073, 15786, 16977, 15792, 16893, 15798, 16821, 15803, 16750, 15807, 16686, 15812, 16630, 15817, 16578,
+		15819, 16526, 15824, 16482, 15827, 16439, 15831, 16398, 15833, 16337, 15836, 16264, 15838, 16196, 15840, 16131,
+		15841, 16068, 15842, 16010, 15843, 15952, 15843, 15898, 15843, 15847, 15844, 15799, 15843, 15751, 15843, 15704,
+		15841, 15660, 15840, 15618, 15840, 15578, 15838, 15538, 15836, 15501, 15834, 15465, 15831, 15429, 15828, 15394,
+		15825, 15361, 15821, 15298, 15818, 15237, 15814, 15177, 15810, 15120, 15806, 15065, 15801, 15008, 15797, 14956,
+		15792, 14905, 15787, 14855, 15782, 14808, 15775, 14760, 15770, 14715, 15764, 14672, 15758, 14628, 15752, 14588,
+		15745, 14547, 15739, 14510, 15732, 14471, 15726, 14436, 15718, 14399, 15712, 14366, 15704, 14328, 15697, 14261,
+		15690, 14201, 15682, 14141, 15674, 14080, 15667, 14023, 15659, 13966, 15651, 13913, 15643, 13860, 15635, 13810,
+		15627, 13761, 15619, 13713, 15610, 13666, 15602, 13621, 15594, 13578, 15586, 13536, 15577, 13495, 15568, 13454,
+		15560, 13416, 15551, 13378, 15543, 13343, 15535, 13304, 15525, 13234, 15517, 13169, 15508, 13105, 15500, 13044,
+		15491, 12982, 15482, 12924, 15474, 12867, 15465, 12813, 15456, 12759, 15448, 12709, 15439, 12660, 15430, 12611,
+		15422, 12564, 15413, 12520, 15405, 12475, 15396, 12433, 15387, 12391, 15379, 12353, 15371, 12314, 15362, 12266,
+		15348, 12195, 15331, 12125, 15314, 12059, 15297, 11992, 15281, 11929, 15264, 11867, 15248, 11810, 15232, 11753,
+		15216, 11700, 15199, 11644, 15184, 11595, 15168, 11544, 15152, 11496, 15136, 11450, 15121, 11405, 15106, 11363,
+		15090, 11319, 15075, 11280, 15059, 11214, 15044, 11140, 15029, 11069, 15013, 10996, 14998, 10927, 14984, 10864,
+		14969, 10799, 14955, 10740, 14941, 10681, 14926, 10622, 14913, 10569, 14899, 10518, 14885, 10465, 14871, 10416,
+		14857, 10368, 14843, 10322, 14829, 10277, 14815, 10223, 14803, 10145, 14790, 10073, 14777, 9995, 14764, 9920,
+		14751, 9847, 14738, 9778, 14726, 9716, 14713, 9651, 14701, 9589, 14689, 9534, 14676, 9477, 14664, 9422,
+		14652, 9369, 14641, 9320, 14629, 9272, 14617, 9225, 14605, 9144, 14594, 9059, 14583, 8979, 14572, 8898,
+		14561, 8822, 14550, 8748, 14539, 8680, 14529, 8613, 14518, 8550, 14507, 8485, 14497, 8425, 14486, 8367,
+		14476, 8315, 14466, 8262, 14457, 8212, 14446, 8133, 14437, 8040, 14427, 7956, 14417, 7863, 14408, 7785,
+		14398, 7702, 14389, 7634, 14380, 7564, 14370, 7490, 14361, 7426, 14352, 7363, 14344, 7305, 14334, 7248,
+		14316, 7192, 14299, 7110, 14282, 7012, 14265, 6911, 14249, 6825, 14233, 6739, 14215, 6652, 14200, 6575,
+		14184, 6502, 14168, 6425, 14153, 6358, 14137, 6292, 14121, 6225, 14106, 6167, 14091, 6078, 14076, 5974,
+		14061, 5866, 14047, 5767, 14033, 5679, 14018, 5588, 14003, 5501, 13990, 5420, 13976, 5350, 13962, 5269,
+		13949, 5201, 13936, 5139, 13923, 5038, 13909, 4912, 13896, 4802, 13883, 4696, 13871, 4604, 13859, 4508,
+		13847, 4424, 13834, 4339, 13822, 4254, 13809, 4172, 13798, 4107, 13786, 3975, 13774, 3859, 13762, 3726,
+		13751, 3620, 13739, 3507, 13729, 3418, 13718, 3315, 13706, 3221, 13696, 3140, 13685, 3061, 13674, 2899,
+		13664, 2753, 13653, 2625, 13643, 2505, 13632, 2382, 13623, 2282, 13612, 2174, 13603, 2082, 13593, 1919,
+		13583, 1753, 13574, 1610, 13564, 1450, 13555, 1325, 13545, 1199, 13536, 1084, 13527, 963, 13518, 882,
+		13509, 774, 13500, 684, 13491, 608, 13483, 530, 13474, 465, 13465, 398, 13457, 336, 13449, 286,
+		15705, 18301, 15713, 17943, 15721, 17736, 15728, 17595, 15735, 17487, 15741, 17393, 15748, 17251, 15754, 17134,
+		15760, 17027, 15766, 16937, 15771, 16854, 15777, 16784, 15781, 16717, 15786, 16655, 15789, 16597, 15794, 16547,
+		15797, 16499, 15802, 16457, 15804, 16412, 15807, 16360, 15809, 16286, 15812, 16217, 15814, 16150, 15815, 16087,
+		15816, 16025, 15818, 15968, 15819, 15915, 15819, 15862, 15819, 15811, 15819, 15763, 15819, 15717, 15819, 15674,
+		15818, 15631, 15817, 15589, 15815, 15550, 15813, 15510, 15811, 15474, 15809, 15438, 15807, 15405, 15804, 15371,
+		15801, 15318, 15797, 15254, 15795, 15196, 15791, 15139, 15787, 15081, 15783, 15027, 15779, 14975, 15774, 14922,
+		15769, 14872, 15765, 14825, 15759, 14777, 15754, 14733, 15748, 14688, 15743, 14646, 15737, 14604, 15731, 14563,
+		15725, 14525, 15718, 14486, 15713, 14451, 15706, 14415, 15699, 14381, 15692, 14346, 15685, 14293, 15679, 14231,
+		15671, 14167, 15663, 14108, 15657, 14053, 15649, 13996, 15642, 13941, 15634, 13888, 15626, 13837, 15618, 13787,
+		15611, 13738, 15602, 13691, 15595, 13648, 15587, 13603, 15578, 13560, 15570, 13518, 15562, 13478, 15554, 13439,
+		15546, 13401, 15537, 13365, 15529, 13330, 15520, 13277, 15512, 13211, 15504, 13147, 15496, 13084, 15487, 13024,
+		15479, 12965, 15471, 12907, 15462, 12852, 15454, 12798, 15445, 12746, 15437, 12695, 15428, 12646, 15420, 12599,
+		15412, 12554, 15403, 12509, 15395, 12466, 15387, 12426, 15378, 12384, 15370, 12345, 15362, 12306, 15347, 12252,
+		15330, 12182, 15314, 12112, 15298, 12046, 15281, 11982, 15266, 11922, 15250, 11861, 15234, 11803, 15217, 11744,
+		15202, 11692, 15185, 11637, 15170, 11588, 15154, 11538, 15140, 11492, 15124, 11445, 15108, 11401, 15093, 11358,
+		15078, 11316, 15063, 11277, 15048, 11211, 15033, 11138, 15019, 11065, 15004, 10995, 14989, 10927, 14974, 10861,
+		14960, 10798, 14946, 10739, 14932, 10679, 14918, 10622, 14904, 10568, 14890, 10516, 14876, 10464, 14863, 10417,
+		14850, 10370, 14836, 10323, 14823, 10280, 14810, 10237, 14797, 10153, 14783, 10070, 14770, 9995, 14758, 9924,
+		14746, 9857, 14733, 9788, 14721, 9721, 14708, 9658, 14696, 9597, 14684, 9538, 14672, 9484, 14660, 9429,
+		14648, 9376, 14637, 9328, 14625, 9279, 14613, 9232, 14602, 9159, 14591, 9075, 14580, 8991, 14569, 8915,
+		14558, 8835, 14547, 8762, 14537, 8693, 14526, 8624, 14515, 8559, 14505, 8498, 14495, 8438, 14485, 8382,
+		14475, 8326, 14465, 8274, 14454, 8221, 14445, 8156, 14435, 8062, 14425, 7973, 14416, 7886, 14406, 7808,
+		14397, 7729, 14388, 7653, 14379, 7579, 14369, 7505, 14361, 7446, 14352, 7380, 14343, 7323, 14333, 7265,
+		14315, 7207, 14298, 7140, 14281, 7041, 14264, 6942, 14248, 6852, 14231, 6761, 14215, 6676, 14200, 6603,
+		14183, 6522, 14168, 6446, 14152, 6376, 14137, 6313, 14122, 6248, 14107, 6191, 14092, 6119, 14076, 5997,
+		14062, 5905, 14048, 5805, 14033, 5707, 14019, 5616, 14005, 5534, 13992, 5456, 13977, 5371, 13964, 5302,
+		13951, 5231, 13938, 5168, 13924, 5074, 13911, 4951, 13899, 4854, 13886, 4752, 13872, 4636, 13859, 4530,
+		13847, 4438, 13835, 4359, 13823, 4282, 13811, 4209, 13799, 4131, 13788, 4029, 13776, 3897, 13764, 3769,
+		13753, 3654, 13742, 3540, 13731, 3447, 13720, 3347, 13709, 3256, 13698, 3167, 13687, 3089, 13676, 2932,
+		13666, 2805, 13655, 2663, 13645, 2539, 13635, 2422, 13625, 2314, 13616, 2207, 13606, 2111, 13596, 1985,
+		13586, 1822, 13576, 1660, 13567, 1504, 13557, 1364, 13548, 1251, 13539, 1103, 13530, 1002, 13521, 896,
+		13512, 799, 13503, 716, 13494, 626, 13485, 544, 13477, 477, 13469, 412, 13460, 350, 13452, 295,
+		15689, 18252, 15696, 17899, 15703, 17700, 15710, 17562, 15716, 17458, 15722, 17340, 15729, 17205, 15734, 17088,
+		15740, 16985, 15745, 16897, 15750, 16819, 15755, 16745, 15760, 16682, 15764, 16623, 15768, 16569, 15772, 16519,
+		15775, 16471, 15778, 16426, 15782, 16387, 15784, 16313, 15787, 16241, 15789, 16171, 15791, 16108, 15792, 16046,
+		15794, 15986, 15794, 15931, 15795, 15876, 15795, 15826, 15796, 15777, 15796, 15731, 15795, 15685, 15795, 15642,
+		15794, 15600, 15793, 15560, 15791, 15521, 15790, 15486, 15788, 15449, 15786, 15415, 15784, 15381, 15781, 15337,
+		15778, 15274, 15775, 15214, 15771, 15154, 15769, 15100, 15765, 15045, 15760, 14989, 15756, 14938, 15752, 14891,
+		15747, 14840, 15742, 14794, 15738, 14749, 15732, 14703, 15727, 14662, 15722, 14619, 15716, 14580, 15710, 14540,
+		15704, 14502, 15699, 14466, 15692, 14428, 15686, 14395, 15680, 14361, 15673, 14321, 15666, 14257, 15659, 14194,
+		15653, 14136, 15646, 14078, 15638, 14021, 15632, 13968, 15624, 13915, 15617, 13863, 15610, 13813, 15602, 13765,
+		15595, 13718, 15587, 13672, 15579, 13628, 15571, 13585, 15563, 13543, 15556, 13502, 15548, 13463, 15540, 13425,
+		15531, 13387, 15524, 13352, 15515, 13317, 15507, 13253, 15499, 13189, 15491, 13126, 15483, 13063, 15475, 13003,
+		15467, 12946, 15459, 12890, 15450, 12835, 15442, 12783, 15434, 12732, 15426, 12682, 15418, 12634, 15410, 12587,
+		15402, 12542, 15393, 12498, 15385, 12457, 15377, 12416, 15369, 12376, 15361, 12338, 15346, 12300, 15330, 12241,
+		15314, 12170, 15298, 12102, 15282, 12037, 15266, 11973, 15250, 11912, 15234, 11851, 15219, 11796, 15203, 11739,
+		15188, 11686, 15172, 11632, 15157, 11583, 15141, 11533, 15127, 11487, 15111, 11441, 15096, 11397, 15081, 11355,
+		15066, 11313, 15052, 11274, 15037, 11205, 15022, 11133, 15008, 11062, 14994, 10991, 14980, 10928, 14965, 10860,
+		14951, 10799, 14938, 10739, 14923, 10678, 14910, 10624, 14896, 10570, 14882, 10515, 14868, 10466, 14856, 10418,
+		14842, 10370, 14829, 10324, 14816, 10282, 14803, 10239, 14790, 10156, 14778, 10080, 14765, 10005, 14752, 9931,
+		14739, 9857, 14727, 9788, 14715, 9724, 14703, 9666, 14691, 9605, 14679, 9546, 14667, 9489, 14655, 9436,
+		14644, 9383, 14632, 9332, 14621, 9285, 14610, 9238, 14599, 9175, 14588, 9086, 14576, 9002, 14566, 8925,
+		14555, 8847, 14544, 8775, 14534, 8705, 14524, 8640, 14513, 8571, 14503, 8511, 14493, 8451, 14482, 8391,
+		14472, 8336, 14462, 8285, 14452, 8233, 14443, 8180, 14433, 8085, 14424, 7996, 14414, 7906, 14405, 7825,
+		14396, 7745, 14386, 7667, 14377, 7596, 14368, 7525, 14359, 7461, 14351, 7398, 14342, 7335, 14330, 7278,
+		14312, 7218, 14297, 7171, 14280, 7070, 14263, 6968, 14247, 6879, 14231, 6792, 14215, 6701, 14199, 6622,
+		14183, 6541, 14167, 6464, 14152, 6397, 14137, 6332, 14121, 6265, 14106, 6206, 14091, 6148, 14076, 6039,
+		14063, 5943, 14048, 5832, 14033, 5731, 14020, 5646, 14006, 5559, 13992, 5474, 13978, 5396, 13965, 5329,
+		13952, 5252, 13938, 5184, 13925, 5121, 13913, 5010, 13900, 4889, 13887, 4778, 13874, 4668, 13862, 4580,
+		13850, 4492, 13837, 4400, 13825, 4307, 13813, 4227, 13801, 4150, 13790, 4072, 13778, 3944, 13767, 3822,
+		13756, 3700, 13744, 3584, 13733, 3477, 13721, 3374, 13711, 3289, 13700, 3195, 13689, 3118, 13679, 3008,
+		13669, 2860, 13658, 2708, 13648, 2583, 13638, 2455, 13627, 2331, 13617, 2228, 13607, 2139, 13598, 2036,
+		13588, 1872, 13578, 1692, 13570, 1553, 13560, 1407, 13551, 1269, 13541, 1137, 13533, 1037, 13523, 918,
+		13514, 819, 13505, 720, 13497, 642, 13488, 564, 13480, 488, 13471, 421, 13463, 360, 13455, 304,
+		15672, 18200, 15679, 17857, 15685, 17663, 15692, 17532, 15698, 17430, 15704, 17293, 15710, 17161, 15715, 17041,
+		15721, 16949, 15726, 16859, 15730, 16783, 15735, 16713, 15739, 16648, 15743, 16591, 15747, 16538, 15750, 16490,
+		15754, 16444, 15756, 16400, 15760, 16340, 15761, 16261, 15765, 16195, 15767, 16129, 15768, 16064, 15769, 16003,
+		15771, 15947, 15771, 15891, 15772, 15839, 15772, 15791, 15773, 15743, 15772, 15698, 15772, 15654, 15772, 15612,
+		15771, 15571, 15770, 15532, 15768, 15495, 15767, 15458, 15765, 15423, 15763, 15390, 15761, 15354, 15758, 15293,
+		15755, 15229, 15752, 15173, 15750, 15118, 15746, 15060, 15742, 15007, 15739, 14956, 15734, 14905, 15730, 14856,
+		15726, 14811, 15721, 14764, 15716, 14720, 15712, 14678, 15706, 14635, 15702, 14595, 15696, 14555, 15690, 14517,
+		15685, 14481, 15679, 14445, 15673, 14409, 15667, 14376, 15661, 14342, 15654, 14285, 15648, 14225, 15642, 14165,
+		15635, 14105, 15628, 14048, 15622, 13996, 15614, 13940, 15607, 13888, 15600, 13838, 15593, 13790, 15586, 13742,
+		15579, 13697, 15571, 13652, 15564, 13608, 15556, 13566, 15548, 13524, 15541, 13486, 15533, 13447, 15526, 13410,
+		15518, 13374, 15510, 13339, 15502, 13296, 15494, 13229, 15487, 13166, 15479, 13104, 15471, 13043, 15463, 12984,
+		15455, 12928, 15447, 12871, 15439, 12819, 15431, 12767, 15423, 12717, 15415, 12668, 15407, 12621, 15400, 12577,
+		15391, 12531, 15383, 12488, 15375, 12446, 15368, 12405, 15359, 12366, 15344, 12329, 15327, 12291, 15313, 12227,
+		15296, 12155, 15281, 12091, 15265, 12024, 15250, 11962, 15235, 11902, 15219, 11843, 15204, 11787, 15189, 11731,
+		15174, 11679, 15158, 11626, 15144, 11578, 15128, 11529, 15114, 11482, 15098, 11437, 15084, 11394, 15069, 11350,
+		15054, 11310, 15040, 11271, 15025, 11200, 15012, 11129, 14997, 11056, 14983, 10989, 14969, 10923, 14955, 10857,
+		14942, 10797, 14928, 10736, 14915, 10679, 14901, 10625, 14887, 10569, 14874, 10518, 14861, 10468, 14848, 10418,
+		14835, 10372, 14822, 10327, 14809, 10282, 14796, 10239, 14784, 10163, 14771, 10084, 14758, 10007, 14746, 9935,
+		14734, 9867, 14722, 9801, 14709, 9730, 14697, 9668, 14685, 9607, 14674, 9549, 14663, 9496, 14651, 9442,
+		14640, 9389, 14628, 9339, 14617, 9291, 14606, 9245, 14595, 9184, 14584, 9097, 14573, 9016, 14563, 8939,
+		14551, 8859, 14541, 8785, 14531, 8717, 14520, 8646, 14510, 8583, 14500, 8522, 14489, 8460, 14480, 8403,
+		14470, 8347, 14460, 8295, 14450, 8243, 14440, 8193, 14431, 8100, 14421, 8009, 14412, 7925, 14403, 7842,
+		14394, 7765, 14385, 7686, 14376, 7613, 14367, 7544, 14358, 7480, 14349, 7413, 14341, 7353, 14329, 7295,
+		14311, 7234, 14295, 7183, 14279, 7097, 14262, 6993, 14246, 6906, 14230, 6815, 14214, 6726, 14198, 6645,
+		14183, 6569, 14167, 6493, 14151, 6424, 14136, 6352, 14121, 6287, 14106, 6226, 14092, 6167, 14077, 6079,
+		14063, 5967, 14048, 5862, 14034, 5766, 14021, 5680, 14007, 5587, 13992, 5499, 13979, 5422, 13965, 5345,
+		13952, 5268, 13939, 5204, 13926, 5144, 13913, 5037, 13900, 4917, 13887, 4807, 13875, 4710, 13863, 4604,
+		13851, 4509, 13839, 4418, 13827, 4344, 13816, 4268, 13804, 4191, 13792, 4110, 13779, 3975, 13768, 3854,
+		13757, 3737, 13746, 3625, 13734, 3511, 13724, 3414, 13713, 3316, 13702, 3225, 13692, 3144, 13681, 3050,
+		13671, 2905, 13660, 2758, 13650, 2627, 13640, 2498, 13630, 2378, 13620, 2273, 13611, 2173, 13601, 2075,
+		13591, 1921, 13582, 1751, 13572, 1592, 13562, 1440, 13553, 1307, 13544, 1178, 13535, 1053, 13526, 954,
+		13518, 847, 13509, 757, 13500, 666, 13491, 579, 13483, 509, 13474, 435, 13466, 370, 13457, 313,
+		15656, 18152, 15662, 17822, 15668, 17631, 15675, 17504, 15680, 17402, 15686, 17245, 15691, 17114, 15697, 17004,
+		15701, 16905, 15707, 16824, 15711, 16747, 15715, 16679, 15720, 16620, 15723, 16562, 15726, 16509, 15729, 16461,
+		15733, 16418, 15736, 16371, 15738, 16292, 15741, 16218, 15743, 16150, 15744, 16084, 15746, 16023, 15747, 15964,
+		15749, 15910, 15749, 15856, 15750, 15806, 15750, 15757, 15751, 15712, 15750, 15666, 15749, 15623, 15749, 15581,
+		15748, 15542, 15748, 15506, 15747, 15470, 15745, 15434, 15743, 15400, 15741, 15367, 15738, 15308, 15736, 15249,
+		15733, 15190, 15730, 15132, 15727, 15077, 15725, 15026, 15721, 14972, 15717, 14920, 15713, 14873, 15709, 14824,
+		15704, 14778, 15701, 14736, 15696, 14692, 15691, 14650, 15687, 14611, 15681, 14569, 15676, 14533, 15671, 14494,
+		15665, 14459, 15660, 14423, 15654, 14390, 15648, 14357, 15643, 14314, 15636, 14250, 15630, 14191, 15624, 14132,
+		15618, 14078, 15611, 14020, 15604, 13965, 15598, 13915, 15591, 13864, 15584, 13814, 15577, 13766, 15570, 13720,
+		15563, 13676, 15555, 13631, 15548, 13589, 15541, 13547, 15534, 13508, 15527, 13470, 15519, 13431, 15511, 13395,
+		15504, 13359, 15496, 13325, 15489, 13272, 15481, 13205, 15474, 13143, 15466, 13082, 15458, 13022, 15451, 12966,
+		15443, 12908, 15435, 12855, 15428, 12803, 15420, 12751, 15412, 12702, 15404, 12655, 15397, 12607, 15389, 12563,
+		15381, 12519, 15373, 12477, 15366, 12436, 15356, 12396, 15340, 12357, 15325, 12320, 15309, 12279, 15295, 12210,
+		15279, 12141, 15264, 12076, 15248, 12011, 15234, 11950, 15219, 11891, 15204, 11832, 15189, 11777, 15174, 11722,
+		15160, 11672, 15145, 11620, 15130, 11570, 15115, 11522, 15101, 11478, 15086, 11433, 15072, 11389, 15057, 11347,
+		15044, 11308, 15029, 11268, 15015, 11197, 15001, 11124, 14987, 11053, 14974, 10987, 14959, 10918, 14946, 10855,
+		14932, 10794, 14918, 10732, 14906, 10679, 14892, 10623, 14879, 10568, 14866, 10518, 14853, 10468, 14840, 10419,
+		14828, 10374, 14815, 10328, 14802, 10285, 14790, 10243, 14777, 10165, 14764, 10085, 14752, 10011, 14741, 9942,
+		14728, 9870, 14716, 9800, 14704, 9739, 14692, 9676, 14681, 9618, 14669, 9557, 14657, 9497, 14646, 9445,
+		14635, 9395, 14624, 9346, 14613, 9298, 14602, 9251, 14591, 9196, 14580, 9110, 14570, 9029, 14559, 8950,
+		14548, 8873, 14538, 8799, 14527, 8727, 14517, 8659, 14507, 8595, 14497, 8532, 14487, 8471, 14477, 8413,
+		14468, 8360, 14458, 8303, 14449, 8255, 14439, 8205, 14429, 8123, 14420, 8031, 14411, 7949, 14401, 7857,
+		14392, 7782, 14383, 7704, 14375, 7633, 14366, 7562, 14357, 7496, 14349, 7430, 14340, 7366, 14327, 7309,
+		14310, 7250, 14294, 7198, 14278, 7126, 14261, 7020, 14245, 6930, 14229, 6838, 14213, 6753, 14197, 6665,
+		14181, 6590, 14166, 6516, 14151, 6441, 14136, 6370, 14122, 6311, 14107, 6244, 14092, 6184, 14078, 6110,
+		14063, 6002, 14049, 5903, 14035, 5805, 14021, 5703, 14007, 5615, 13994, 5533, 13980, 5452, 13967, 5370,
+		13954, 5302, 13941, 5235, 13927, 5162, 13915, 5082, 13902, 4973, 13889, 4851, 13877, 4739, 13865, 4639,
+		13853, 4549, 13841, 4459, 13828, 4359, 13816, 4277, 13804, 4197, 13793, 4134, 13782, 4045, 13771, 3910,
+		13759, 3782, 13748, 3656, 13737, 3554, 13726, 3450, 13715, 3349, 13705, 3259, 13694, 3169, 13684, 3089,
+		13673, 2954, 13663, 2803, 13653, 2673, 13642, 2532, 13632, 2415, 13623, 2305, 13613, 2201, 13604, 2104,
+		13594, 1968, 13583, 1782, 13574, 1629, 13565, 1486, 13556, 1336, 13547, 1209, 13538, 1093, 13529, 979,
+		13520, 868, 13512, 776, 13502, 674, 13494, 601, 13486, 519, 13477, 450, 13469, 382, 13460, 322,
+		15640, 18106, 15646, 17786, 15652, 17602, 15658, 17477, 15664, 17356, 15668, 17200, 15673, 17070, 15678, 16965,
+		15683, 16869, 15688, 16790, 15692, 16713, 15696, 16647, 15699, 16587, 15703, 16534, 15706, 16484, 15709, 16436,
+		15712, 16393, 15715, 16321, 15717, 16242, 15720, 16174, 15721, 16107, 15723, 16044, 15725, 15983, 15726, 15926,
+		15726, 15871, 15727, 15819, 15727, 15769, 15728, 15723, 15728, 15679, 15728, 15635, 15728, 15593, 15728, 15555,
+		15727, 15516, 15725, 15478, 15724, 15443, 15723, 15409, 15721, 15376, 15719, 15327, 15716, 15265, 15714, 15205,
+		15712, 15149, 15710, 15095, 15706, 15040, 15703, 14987, 15700, 14937, 15696, 14888, 15692, 14839, 15688, 14794,
+		15684, 14749, 15679, 14705, 15676, 14664, 15671, 14624, 15667, 14584, 15662, 14547, 15656, 14507, 15652, 14473,
+		15646, 14436, 15641, 14404, 15636, 14370, 15631, 14339, 15624, 14278, 15619, 14218, 15612, 14156, 15606, 14100,
+		15600, 14044, 15594, 13992, 15587, 13939, 15580, 13886, 15574, 13838, 15568, 13792, 15561, 13745, 15554, 13698,
+		15547, 13653, 15540, 13612, 15533, 13569, 15526, 13529, 15519, 13491, 15512, 13452, 15505, 13416, 15497, 13379,
+		15490, 13345, 15483, 13310, 15476, 13246, 15468, 13182, 15461, 13121, 15453, 13058, 15446, 13002, 15439, 12945,
+		15431, 12891, 15424, 12837, 15416, 12786, 15409, 12735, 15401, 12687, 15393, 12639, 15386, 12594, 15378, 12549,
+		15371, 12506, 15364, 12466, 15352, 12425, 15337, 12386, 15322, 12349, 15307, 12312, 15291, 12263, 15277, 12195,
+		15262, 12127, 15247, 12062, 15232, 11999, 15218, 11940, 15203, 11880, 15189, 11823, 15174, 11769, 15159, 11712,
+		15144, 11662, 15130, 11611, 15117, 11565, 15102, 11518, 15087, 11471, 15073, 11427, 15060, 11385, 15045, 11343,
+		15031, 11303, 15018, 11265, 15004, 11192, 14991, 11121, 14977, 11050, 14963, 10983, 14950, 10916, 14937, 10856,
+		14923, 10793, 14910, 10732, 14897, 10678, 14883, 10620, 14870, 10568, 14858, 10517, 14845, 10466, 14833, 10420,
+		14820, 10374, 14807, 10328, 14795, 10286, 14783, 10245, 14770, 10168, 14758, 10090, 14746, 10019, 14734, 9944,
+		14721, 9872, 14710, 9806, 14698, 9743, 14687, 9680, 14675, 9618, 14664, 9563, 14653, 9508, 14642, 9453,
+		14630, 9400, 14619, 9350, 14608, 9300, 14598, 9256, 14587, 9208, 14576, 9121, 14566, 9041, 14555, 8957,
+		14545, 8884, 14534, 8809, 14524, 8738, 14514, 8673, 14504, 8605, 14494, 8542, 14484, 8480, 14475, 8427,
+		14465, 8369, 14455, 8314, 14446, 8263, 14437, 8215, 14427, 8139, 14418, 8049, 14409, 7963, 14400, 7881,
+		14391, 7797, 14382, 7726, 14373, 7647, 14365, 7580, 14356, 7508, 14348, 7447, 14339, 7384, 14326, 7326,
+		14309, 7266, 14292, 7213, 14276, 7152, 14260, 7055, 14244, 6958, 14227, 6864, 14211, 6773, 14196, 6691,
+		14181, 6609, 14166, 6536, 14151, 6460, 14136, 6394, 14121, 6327, 14106, 6261, 14092, 6203, 14078, 6145,
+		14063, 6033, 14049, 5933, 14035, 5830, 14021, 5732, 14008, 5645, 13995, 5563, 13981, 5475, 13968, 5399,
+		13955, 5328, 13942, 5256, 13928, 5183, 13916, 5122, 13903, 5004, 13891, 4880, 13879, 4776, 13867, 4683,
+		13854, 4580, 13842, 4482, 13830, 4398, 13818, 4313, 13806, 4234, 13795, 4158, 13783, 4065, 13771, 3924,
+		13761, 3819, 13750, 3704, 13739, 3593, 13728, 3481, 13717, 3381, 13707, 3291, 13696, 3191, 13686, 3112,
+		13675, 3001, 13665, 2845, 13655, 2702, 13645, 2579, 13635, 2458, 13626, 2348, 13615, 2234, 13606, 2133,
+		13596, 2016, 13587, 1851, 13578, 1687, 13569, 1534, 13559, 1379, 13550, 1250, 13541, 1127, 13531, 989,
+		13523, 902, 13514, 791, 13506, 707, 13497, 614, 13488, 536, 13480, 459, 13472, 396, 13463, 332,
+		15624, 18057, 15630, 17751, 15636, 17573, 15641, 17449, 15646, 17304, 15651, 17154, 15656, 17030, 15661, 16925,
+		15665, 16834, 15669, 16752, 15673, 16681, 15677, 16616, 15680, 16557, 15683, 16504, 15687, 16456, 15690, 16411,
+		15693, 16352, 15695, 16272, 15697, 16199, 15700, 16131, 15701, 16065, 15702, 16002, 15704, 15943, 15705, 15888,
+		15705, 15835, 15707, 15787, 15707, 15738, 15708, 15694, 15707, 15648, 15707, 15607, 15706, 15565, 15706, 15527,
+		15705, 15489, 15704, 15453, 15702, 15418, 15701, 15385, 15699, 15345, 15697, 15283, 15695, 15223, 15693, 15166,
+		15691, 15110, 15688, 15056, 15685, 15004, 15682, 14953, 15679, 14902, 15676, 14856, 15672, 14809, 15668, 14763,
+		15664, 14720, 15660, 14679, 15656, 14636, 15652, 14598, 15647, 14558, 15642, 14522, 15638, 14486, 15633, 14450,
+		15628, 14417, 15622, 14382, 15618, 14352, 15611, 14300, 15606, 14242, 15600, 14182, 15595, 14128, 15589, 14069,
+		15583, 14015, 15577, 13961, 15570, 13910, 15565, 13864, 15558, 13813, 15551, 13765, 15545, 13720, 15538, 13676,
+		15532, 13633, 15525, 13592, 15518, 13551, 15512, 13512, 15505, 13473, 15498, 13437, 15491, 13399, 15484, 13365,
+		15477, 13332, 15470, 13284, 15463, 13219, 15455, 13156, 15448, 13097, 15441, 13038, 15434, 12981, 15427, 12926,
+		15419, 12871, 15412, 12820, 15405, 12771, 15397, 12719, 15390, 12671, 15383, 12626, 15376, 12581, 15368, 12537,
+		15361, 12495, 15347, 12455, 15332, 12415, 15318, 12376, 15303, 12338, 15288, 12302, 15274, 12246, 15259, 12179,
+		15245, 12113, 15231, 12051, 15216, 11986, 15202, 11926, 15187, 11868, 15173, 11813, 15159, 11759, 15145, 11705,
+		15131, 11656, 15116, 11603, 15102, 11556, 15088, 11509, 15075, 11466, 15061, 11422, 15047, 11380, 15033, 11339,
+		15020, 11300, 15006, 11258, 14993, 11185, 14980, 11113, 14966, 11044, 14953, 10980, 14940, 10913, 14927, 10851,
+		14913, 10790, 14900, 10731, 14888, 10675, 14875, 10619, 14862, 10568, 14849, 10515, 14836, 10466, 14825, 10420,
+		14812, 10373, 14799, 10328, 14787, 10286, 14775, 10244, 14763, 10169, 14751, 10095, 14739, 10019, 14728, 9949,
+		14716, 9878, 14705, 9812, 14693, 9746, 14681, 9684, 14671, 9627, 14659, 9567, 14647, 9507, 14637, 9457,
+		14626, 9406, 14615, 9357, 14604, 9309, 14593, 9262, 14582, 9216, 14572, 9132, 14562, 9051, 14552, 8972,
+		14541, 8894, 14531, 8821, 14521, 8752, 14511, 8681, 14502, 8619, 14491, 8552, 14482, 8493, 14472, 8434,
+		14462, 8378, 14453, 8327, 14444, 8274, 14435, 8226, 14425, 8160, 14416, 8073, 14407, 7983, 14398, 7898,
+		14389, 7816, 14380, 7738, 14372, 7665, 14363, 7595, 14354, 7524, 14346, 7459, 14338, 7398, 14322, 7338,
+		14306, 7279, 14290, 7226, 14274, 7173, 14257, 7070, 14242, 6984, 14226, 6884, 14210, 6798, 14196, 6717,
+		14180, 6635, 14166, 6560, 14150, 6480, 14135, 6411, 14120, 6344, 14106, 6278, 14092, 6225, 14078, 6163,
+		14063, 6063, 14049, 5963, 14035, 5857, 14021, 5763, 14008, 5675, 13994, 5578, 13981, 5503, 13968, 5424,
+		13955, 5346, 13942, 5273, 13930, 5208, 13917, 5142, 13904, 5036, 13892, 4924, 13879, 4817, 13867, 4705,
+		13854, 4600, 13844, 4521, 13832, 4429, 13820, 4340, 13808, 4254, 13797, 4189, 13786, 4119, 13775, 4002,
+		13763, 3857, 13751, 3725, 13741, 3619, 13730, 3512, 13720, 3416, 13709, 3319, 13698, 3225, 13688, 3146,
+		13678, 3035, 13668, 2892, 13658, 2776, 13647, 2619, 13637, 2486, 13627, 2368, 13618, 2265, 13608, 2162,
+		13599, 2057, 13589, 1894, 13580, 1725, 13571, 1568, 13561, 1415, 13552, 1275, 13544, 1154, 13535, 1031,
+		13526, 924, 13517, 814, 13508, 714, 13500, 633, 13491, 553, 13483, 474, 13474, 405, 13466, 342,
+		15609, 18018, 15615, 17716, 15620, 17544, 15625, 17425, 15629, 17252, 15634, 17109, 15639, 16990, 15643, 16885,
+		15648, 16800, 15651, 16719, 15655, 16650, 15658, 16586, 15662, 16531, 15664, 16476, 15668, 16429, 15670, 16385,
+		15673, 16303, 15675, 16229, 15678, 16158, 15679, 16086, 15681, 16025, 15683, 15965, 15684, 15907, 15684, 15853,
+		15685, 15801, 15685, 15751, 15686, 15705, 15686, 15659, 15686, 15617, 15686, 15576, 15686, 15537, 15685, 15499,
+		15684, 15463, 15683, 15428, 15682, 15394, 15681, 15362, 15679, 15303, 15677, 15242, 15675, 15182, 15673, 15125,
+		15671, 15073, 15668, 15018, 15665, 14967, 15662, 14918, 15659, 14870, 15655, 14822, 15652, 14778, 15648, 14734,
+		15645, 14692, 15641, 14650, 15637, 14612, 15632, 14572, 15628, 14535, 15623, 14498, 15619, 14463, 15615, 14429,
+		15610, 14396, 15604, 14363, 15599, 14326, 15594, 14267, 15588, 14206, 15583, 14148, 15577, 14092, 15572, 14039,
+		15566, 13986, 15560, 13934, 15554, 13883, 15548, 13834, 15542, 13789, 15536, 13743, 15529, 13697, 15523, 13655,
+		15517, 13614, 15511, 13572, 15504, 13532, 15497, 13494, 15491, 13456, 15484, 13419, 15477, 13384, 15470, 13350,
+		15464, 13317, 15457, 13257, 15450, 13193, 15443, 13133, 15436, 13074, 15429, 13016, 15422, 12961, 15415, 12906,
+		15408, 12853, 15401, 12803, 15394, 12752, 15386, 12703, 15380, 12659, 15372, 12611, 15365, 12566, 15356, 12525,
+		15342, 12484, 15327, 12442, 15313, 12403, 15300, 12367, 15284, 12329, 15270, 12293, 15257, 12231, 15242, 12163,
+		15228, 12097, 15214, 12036, 15200, 11975, 15186, 11917, 15172, 11858, 15158, 11802, 15144, 11748, 15130, 11696,
+		15116, 11646, 15103, 11597, 15090, 11551, 15075, 11503, 15061, 11458, 15048, 11415, 15035, 11375, 15022, 11335,
+		15008, 11295, 14995, 11250, 14982, 11179, 14968, 11106, 14956, 11040, 14942, 10971, 14929, 10907, 14917, 10848,
+		14903, 10786, 14891, 10728, 14878, 10672, 14866, 10618, 14854, 10567, 14841, 10515, 14828, 10466, 14816, 10420,
+		14804, 10373, 14792, 10330, 14779, 10286, 14767, 10245, 14756, 10172, 14744, 10093, 14732, 10018, 14721, 9949,
+		14709, 9879, 14698, 9812, 14687, 9751, 14676, 9691, 14665, 9630, 14654, 9570, 14643, 9516, 14632, 9463,
+		14621, 9409, 14609, 9358, 14599, 9310, 14589, 9267, 14579, 9224, 14568, 9141, 14558, 9062, 14548, 8979,
+		14538, 8903, 14528, 8831, 14518, 8758, 14508, 8694, 14498, 8627, 14488, 8564, 14479, 8502, 14469, 8445,
+		14460, 8388, 14451, 8336, 14441, 8284, 14432, 8232, 14423, 8180, 14414, 8089, 14405, 7998, 14396, 7912,
+		14388, 7837, 14379, 7756, 14370, 7681, 14361, 7608, 14353, 7541, 14344, 7475, 14336, 7413, 14320, 7351,
+		14303, 7293, 14287, 7238, 14271, 7186, 14255, 7096, 14240, 7003, 14225, 6908, 14209, 6822, 14194, 6736,
+		14179, 6657, 14164, 6582, 14149, 6500, 14134, 6432, 14119, 6362, 14105, 6297, 14091, 6240, 14077, 6176,
+		14062, 6097, 14049, 5992, 14035, 5887, 14022, 5793, 14008, 5703, 13995, 5609, 13982, 5527, 13969, 5447,
+		13955, 5363, 13943, 5299, 13931, 5231, 13917, 5159, 13905, 5080, 13893, 4966, 13880, 4842, 13868, 4741,
+		13856, 4640, 13844, 4539, 13832, 4447, 13821, 4363, 13810, 4285, 13798, 4205, 13786, 4126, 13776, 4031,
+		13765, 3899, 13755, 3791, 13743, 3667, 13732, 3542, 13721, 3442, 13710, 3342, 13700, 3251, 13690, 3164,
+		13680, 3082, 13670, 2950, 13659, 2792, 13650, 2659, 13640, 2535, 13630, 2405, 13621, 2297, 13611, 2188,
+		13601, 2084, 13592, 1941, 13582, 1762, 13573, 1605, 13564, 1466, 13555, 1310, 13546, 1182, 13537, 1059,
+		13528, 935, 13520, 844, 13511, 741, 13503, 653, 13494, 565, 13486, 486, 13477, 417, 13469, 351,
+		15594, 17979, 15600, 17685, 15605, 17519, 15609, 17390, 15613, 17208, 15618, 17067, 15622, 16953, 15626, 16851,
+		15631, 16766, 15634, 16687, 15637, 16618, 15641, 16558, 15644, 16502, 15646, 16451, 15649, 16405, 15652, 16339,
+		15654, 16258, 15656, 16183, 15658, 16112, 15659, 16044, 15661, 15984, 15662, 15924, 15663, 15868, 15664, 15816,
+		15665, 15766, 15665, 15719, 15666, 15674, 15666, 15630, 15667, 15591, 15666, 15549, 15666, 15510, 15665, 15474,
+		15664, 15438, 15663, 15404, 15662, 15372, 15660, 15319, 15658, 15257, 15657, 15199, 15655, 15142, 15653, 15087,
+		15650, 15033, 15648, 14983, 15645, 14932, 15642, 14883, 15639, 14836, 15636, 14793, 15632, 14747, 15629, 14705,
+		15626, 14664, 15622, 14625, 15618, 14585, 15614, 14549, 15609, 14511, 15605, 14476, 15601, 14441, 15596, 14407,
+		15591, 14375, 15586, 14343, 15582, 14291, 15577, 14230, 15571, 14173, 15566, 14116, 15561, 14062, 15555, 14008,
+		15550, 13957, 15544, 13908, 15538, 13857, 15532, 13810, 15526, 13763, 15521, 13720, 15515, 13677, 15508, 13633,
+		15502, 13592, 15496, 13553, 15490, 13514, 15483, 13476, 15476, 13439, 15470, 13404, 15463, 13369, 15457, 13335,
+		15451, 13295, 15444, 13230, 15437, 13168, 15430, 13108, 15424, 13051, 15417, 12995, 15410, 12939, 15403, 12885,
+		15396, 12834, 15390, 12784, 15383, 12736, 15376, 12688, 15368, 12642, 15361, 12596, 15350, 12554, 15335, 12511,
+		15322, 12471, 15308, 12432, 15294, 12393, 15280, 12357, 15266, 12319, 15253, 12283, 15239, 12214, 15225, 12147,
+		15211, 12084, 15198, 12022, 15183, 11960, 15170, 11904, 15156, 11846, 15143, 11793, 15130, 11739, 15116, 11687,
+		15102, 11637, 15089, 11589, 15076, 11543, 15062, 11496, 15050, 11455, 15035, 11410, 15022, 11369, 15009, 11328,
+		14996, 11290, 14983, 11242, 14970, 11171, 14957, 11098, 14945, 11034, 14931, 10965, 14919, 10903, 14906, 10842,
+		14893, 10781, 14882, 10726, 14869, 10669, 14856, 10615, 14844, 10563, 14831, 10512, 14820, 10465, 14808, 10418,
+		14796, 10372, 14784, 10330, 14772, 10287, 14761, 10246, 14749, 10172, 14737, 10094, 14726, 10024, 14715, 9953,
+		14703, 9881, 14692, 9816, 14681, 9753, 14669, 9688, 14659, 9631, 14648, 9573, 14638, 9521, 14627, 9466,
+		14616, 9415, 14606, 9367, 14595, 9319, 14584, 9269, 14574, 9227, 14564, 9154, 14554, 9067, 14544, 8993,
+		14534, 8916, 14524, 8838, 14514, 8769, 14504, 8701, 14495, 8637, 14485, 8572, 14476, 8513, 14467, 8454,
+		14457, 8398, 14448, 8344, 14439, 8292, 14429, 8241, 14421, 8194, 14412, 8104, 14403, 8018, 14394, 7929,
+		14386, 7852, 14376, 7769, 14368, 7699, 14360, 7626, 14352, 7559, 14343, 7489, 14333, 7426, 14317, 7365,
+		14302, 7309, 14285, 7251, 14269, 7197, 14254, 7121, 14239, 7029, 14224, 6937, 14208, 6848, 14193, 6761,
+		14177, 6670, 14163, 6598, 14148, 6520, 14134, 6453, 14119, 6384, 14105, 6319, 14091, 6257, 14077, 6195,
+		14063, 6131, 14049, 6023, 14035, 5915, 14022, 5822, 14009, 5731, 13995, 5635, 13983, 5554, 13970, 5471,
+		13956, 5392, 13944, 5324, 13931, 5248, 13918, 5181, 13907, 5123, 13894, 5001, 13882, 4882, 13870, 4785,
+		13858, 4672, 13846, 4573, 13835, 4483, 13823, 4399, 13811, 4307, 13800, 4228, 13789, 4162, 13777, 4078,
+		13766, 3930, 13755, 3805, 13744, 3687, 13734, 3587, 13724, 3480, 13713, 3374, 13703, 3287, 13692, 3194,
+		13682, 3104, 13672, 2993, 13662, 2836, 13652, 2697, 13642, 2573, 13632, 2437, 13623, 2331, 13613, 2221,
+		13604, 2114, 13594, 1996, 13586, 1829, 13576, 1651, 13567, 1503, 13557, 1338, 13549, 1212, 13540, 1091,
+		13531, 974, 13522, 855, 13514, 770, 13505, 659, 13497, 583, 13489, 503, 13480, 427, 13472, 362,
+		15580, 17945, 15585, 17654, 15590, 17490, 15594, 17344, 15598, 17165, 15602, 17029, 15606, 16913, 15610, 16816,
+		15613, 16730, 15617, 16656, 15620, 16590, 15623, 16529, 15626, 16476, 15628, 16425, 15631, 16377, 15634, 16294,
+		15636, 16216, 15637, 16139, 15639, 16071, 15641, 16009, 15642, 15946, 15644, 15890, 15645, 15837, 15645, 15784,
+		15646, 15735, 15646, 15689, 15646, 15642, 15646, 15600, 15646, 15559, 15646, 15522, 15646, 15484, 15645, 15448,
+		15644, 15414, 15643, 15380, 15642, 15335, 15641, 15276, 15639, 15215, 15637, 15157, 15635, 15102, 15633, 15048,
+		15631, 14998, 15628, 14944, 15625, 14897, 15623, 14852, 15620, 14805, 15616, 14760, 15614, 14719, 15610, 14676,
+		15607, 14637, 15603, 14599, 15600, 14561, 15595, 14523, 15592, 14488, 15587, 14453, 15583, 14420, 15578, 14386,
+		15574, 14355, 15568, 14310, 15565, 14254, 15559, 14195, 15554, 14138, 15550, 14084, 15544, 14030, 15539, 13978,
+		15534, 13928, 15528, 13877, 15523, 13832, 15517, 13785, 15511, 13741, 15505, 13696, 15499, 13652, 15494, 13613,
+		15487, 13573, 15481, 13532, 15475, 13495, 15469, 13458, 15462, 13422, 15456, 13387, 15450, 13353, 15444, 13321,
+		15437, 13264, 15431, 13201, 15424, 13143, 15418, 13084, 15412, 13028, 15405, 12971, 15398, 12918, 15392, 12866,
+		15385, 12816, 15378, 12767, 15371, 12717, 15364, 12671, 15356, 12627, 15343, 12583, 15328, 12539, 15316, 12499,
+		15302, 12459, 15288, 12419, 15275, 12382, 15262, 12346, 15248, 12310, 15235, 12263, 15221, 12195, 15208, 12131,
+		15194, 12068, 15181, 12007, 15167, 11947, 15155, 11892, 15141, 11834, 15128, 11782, 15114, 11728, 15101, 11678,
+		15089, 11630, 15074, 11580, 15062, 11535, 15048, 11488, 15036, 11446, 15022, 11403, 15010, 11364, 14997, 11324,
+		14984, 11287, 14971, 11234, 14958, 11161, 14946, 11093, 14934, 11028, 14921, 10960, 14909, 10899, 14896, 10837,
+		14884, 10778, 14871, 10722, 14859, 10665, 14847, 10612, 14835, 10561, 14823, 10511, 14811, 10463, 14799, 10415,
+		14788, 10373, 14776, 10328, 14764, 10286, 14753, 10246, 14742, 10171, 14731, 10100, 14720, 10028, 14709, 9955,
+		14698, 9889, 14687, 9822, 14675, 9756, 14664, 9695, 14654, 9637, 14643, 9578, 14632, 9520, 14621, 9469,
+		14611, 9420, 14601, 9368, 14590, 9321, 14581, 9277, 14571, 9235, 14560, 9163, 14550, 9077, 14539, 8996,
+		14530, 8922, 14520, 8849, 14510, 8780, 14501, 8712, 14491, 8644, 14482, 8581, 14473, 8522, 14463, 8461,
+		14454, 8406, 14445, 8353, 14436, 8301, 14427, 8252, 14418, 8202, 14409, 8123, 14401, 8030, 14392, 7947,
+		14383, 7864, 14375, 7789, 14367, 7715, 14358, 7638, 14350, 7569, 14342, 7508, 14332, 7443, 14316, 7381,
+		14300, 7320, 14284, 7265, 14268, 7212, 14253, 7154, 14237, 7054, 14221, 6958, 14206, 6867, 14191, 6783,
+		14177, 6698, 14162, 6620, 14147, 6540, 14133, 6471, 14118, 6401, 14104, 6332, 14091, 6275, 14076, 6210,
+		14063, 6157, 14049, 6057, 14035, 5948, 14022, 5851, 14009, 5751, 13996, 5662, 13982, 5577, 13970, 5497,
+		13957, 5416, 13944, 5340, 13931, 5269, 13920, 5208, 13907, 5143, 13895, 5034, 13883, 4919, 13871, 4812,
+		13859, 4698, 13847, 4608, 13836, 4515, 13824, 4416, 13812, 4334, 13802, 4261, 13790, 4185, 13779, 4106,
+		13768, 3979, 13758, 3869, 13747, 3736, 13736, 3616, 13724, 3498, 13715, 3410, 13704, 3307, 13694, 3214,
+		13684, 3135, 13674, 3026, 13664, 2880, 13654, 2744, 13644, 2609, 13634, 2477, 13625, 2365, 13615, 2241,
+		13606, 2146, 13597, 2037, 13587, 1867, 13578, 1678, 13569, 1538, 13560, 1384, 13551, 1247, 13542, 1114,
+		13534, 1002, 13525, 887, 13516, 779, 13508, 689, 13500, 600, 13491, 514, 13483, 442, 13475, 371,
+		15566, 17906, 15571, 17625, 15575, 17462, 15579, 17291, 15583, 17125, 15587, 16992, 15590, 16876, 15595, 16786,
+		15597, 16699, 15600, 16625, 15604, 16563, 15607, 16503, 15608, 16448, 15611, 16400, 15613, 16326, 15616, 16245,
+		15617, 16169, 15619, 16098, 15621, 16032, 15623, 15971, 15623, 15908, 15625, 15854, 15625, 15800, 15626, 15750,
+		15627, 15703, 15627, 15656, 15627, 15613, 15628, 15573, 15627, 15532, 15627, 15495, 15627, 15459, 15626, 15423,
+		15625, 15389, 15624, 15355, 15623, 15294, 15621, 15231, 15619, 15173, 15618, 15119, 15616, 15065, 15614, 15011,
+		15611, 14960, 15609, 14913, 15607, 14865, 15604, 14818, 15601, 14775, 15598, 14732, 15595, 14689, 15592, 14650,
+		15588, 14610, 15585, 14572, 15581, 14536, 15578, 14501, 15573, 14465, 15569, 14432, 15565, 14398, 15561, 14367,
+		15556, 14334, 15552, 14276, 15547, 14214, 15542, 14159, 15537, 14104, 15533, 14052, 15528, 13999, 15523, 13949,
+		15517, 13899, 15512, 13852, 15506, 13804, 15501, 13761, 15496, 13716, 15490, 13674, 15484, 13631, 15478, 13589,
+		15473, 13551, 15467, 13514, 15460, 13476, 15455, 13440, 15449, 13405, 15443, 13371, 15437, 13338, 15430, 13299,
+		15424, 13238, 15418, 13177, 15412, 13118, 15406, 13060, 15399, 13004, 15393, 12949, 15386, 12897, 15380, 12845,
+		15373, 12795, 15367, 12747, 15360, 12700, 15347, 12655, 15334, 12610, 15321, 12567, 15308, 12526, 15295, 12486,
+		15282, 12446, 15268, 12407, 15256, 12371, 15242, 12335, 15229, 12300, 15216, 12244, 15203, 12176, 15190, 12115,
+		15176, 12050, 15164, 11992, 15151, 11932, 15138, 11877, 15125, 11822, 15112, 11769, 15099, 11717, 15086, 11668,
+		15073, 11618, 15060, 11571, 15048, 11527, 15035, 11481, 15022, 11439, 15009, 11397, 14997, 11358, 14984, 11318,
+		14972, 11281, 14959, 11223, 14947, 11156, 14935, 11085, 14922, 11018, 14910, 10954, 14898, 10895, 14886, 10832,
+		14874, 10775, 14862, 10719, 14850, 10663, 14838, 10611, 14826, 10559, 14814, 10508, 14802, 10460, 14791, 10415,
+		14780, 10371, 14768, 10325, 14757, 10285, 14746, 10245, 14734, 10173, 14723, 10098, 14712, 10021, 14701, 9953,
+		14690, 9887, 14679, 9820, 14668, 9756, 14658, 9696, 14647, 9638, 14637, 9581, 14627, 9527, 14616, 9473,
+		14606, 9422, 14595, 9372, 14585, 9324, 14575, 9279, 14564, 9232, 14555, 9167, 14546, 9090, 14536, 9013,
+		14526, 8933, 14516, 8856, 14507, 8786, 14497, 8717, 14488, 8651, 14479, 8591, 14469, 8529, 14460, 8469,
+		14451, 8415, 14442, 8361, 14433, 8309, 14424, 8258, 14415, 8210, 14406, 8135, 14398, 8048, 14390, 7964,
+		14381, 7882, 14373, 7803, 14364, 7725, 14357, 7656, 14348, 7584, 14340, 7519, 14328, 7453, 14312, 7391,
+		14296, 7332, 14280, 7277, 14265, 7225, 14250, 7172, 14234, 7074, 14219, 6982, 14204, 6887, 14189, 6800,
+		14175, 6718, 14160, 6640, 14145, 6559, 14132, 6490, 14117, 6419, 14103, 6352, 14089, 6290, 14075, 6225,
+		14062, 6169, 14048, 6081, 14035, 5980, 14021, 5876, 14008, 5777, 13995, 5691, 13982, 5602, 13969, 5517,
+		13957, 5439, 13944, 5360, 13932, 5293, 13920, 5223, 13907, 5153, 13895, 5064, 13883, 4954, 13871, 4839,
+		13860, 4738, 13847, 4631, 13835, 4528, 13825, 4443, 13814, 4365, 13802, 4275, 13791, 4197, 13780, 4128,
+		13770, 4027, 13758, 3886, 13748, 3765, 13738, 3663, 13727, 3549, 13717, 3443, 13706, 3333, 13696, 3243,
+		13686, 3155, 13676, 3072, 13666, 2928, 13656, 2783, 13646, 2638, 13636, 2505, 13627, 2394, 13618, 2276,
+		13608, 2169, 13599, 2072, 13590, 1909, 13581, 1723, 13572, 1584, 13562, 1410, 13554, 1277, 13545, 1148,
+		13537, 1032, 13528, 908, 13519, 803, 13510, 705, 13502, 606, 13494, 530, 13486, 453, 13478, 381,
+		15552, 17870, 15556, 17594, 15560, 17436, 15564, 17245, 15568, 17088, 15572, 16952, 15575, 16842, 15578, 16748,
+		15581, 16669, 15584, 16597, 15587, 16533, 15590, 16478, 15592, 16425, 15594, 16372, 15597, 16285, 15598, 16202,
+		15600, 16128, 15601, 16057, 15603, 15991, 15604, 15929, 15606, 15874, 15606, 15818, 15607, 15767, 15608, 15719,
+		15608, 15672, 15609, 15628, 15609, 15586, 15609, 15544, 15609, 15506, 15608, 15469, 15608, 15434, 15607, 15400,
+		15606, 15367, 15605, 15309, 15604, 15250, 15603, 15192, 15601, 15133, 15599, 15079, 15597, 15026, 15596, 14977,
+		15593, 14927, 15590, 14878, 15588, 14832, 15586, 14789, 15583, 14745, 15580, 14704, 15577, 14663, 15574, 14622,
+		15571, 14585, 15567, 14548, 15564, 14512, 15560, 14477, 15556, 14443, 15552, 14410, 15548, 14378, 15544, 14347,
+		15540, 14298, 15535, 14238, 15531, 14182, 15525, 14124, 15521, 14072, 15516, 14018, 15512, 13970, 15506, 13919,
+		15502, 13872, 15496, 13824, 15491, 13779, 15485, 13733, 15480, 13692, 15475, 13650, 15469, 13609, 15464, 13571,
+		15458, 13532, 15452, 13493, 15447, 13459, 15441, 13424, 15435, 13388, 15430, 13355, 15423, 13322, 15417, 13269,
+		15412, 13210, 15406, 13150, 15399, 13093, 15393, 13036, 15387, 12981, 15381, 12927, 15374, 12876, 15368, 12826,
+		15362, 12776, 15351, 12730, 15338, 12683, 15325, 12638, 15313, 12594, 15300, 12552, 15288, 12512, 15275, 12471,
+		15262, 12433, 15250, 12396, 15236, 12358, 15224, 12323, 15211, 12290, 15199, 12226, 15185, 12159, 15173, 12098,
+		15159, 12034, 15147, 11977, 15135, 11919, 15121, 11862, 15109, 11809, 15096, 11756, 15084, 11706, 15071, 11657,
+		15058, 11608, 15046, 11563, 15034, 11517, 15021, 11474, 15009, 11432, 14996, 11389, 14984, 11351, 14971, 11311,
+		14959, 11275, 14947, 11213, 14936, 11146, 14923, 11075, 14911, 11011, 14899, 10948, 14887, 10887, 14875, 10826,
+		14864, 10770, 14852, 10713, 14840, 10658, 14829, 10608, 14817, 10556, 14806, 10508, 14794, 10460, 14783, 10414,
+		14772, 10369, 14760, 10326, 14750, 10286, 14738, 10244, 14727, 10172, 14716, 10098, 14705, 10023, 14695, 9956,
+		14684, 9887, 14673, 9821, 14663, 9762, 14652, 9700, 14641, 9639, 14631, 9584, 14621, 9530, 14610, 9474,
+		14600, 9424, 14591, 9378, 14580, 9329, 14570, 9282, 14560, 9239, 14551, 9176, 14541, 9092, 14531, 9009,
+		14521, 8935, 14513, 8870, 14503, 8798, 14494, 8729, 14485, 8662, 14475, 8597, 14466, 8538, 14457, 8480,
+		14448, 8423, 14440, 8371, 14430, 8316, 14422, 8267, 14413, 8220, 14405, 8154, 14396, 8065, 14387, 7978,
+		14379, 7897, 14371, 7816, 14363, 7740, 14355, 7671, 14346, 7599, 14338, 7529, 14325, 7469, 14309, 7408,
+		14293, 7345, 14277, 7287, 14262, 7234, 14247, 7183, 14231, 7095, 14217, 7002, 14202, 6910, 14188, 6826,
+		14173, 6738, 14158, 6657, 14144, 6579, 14130, 6508, 14116, 6436, 14103, 6374, 14089, 6308, 14075, 6243,
+		14061, 6187, 14047, 6110, 14034, 6004, 14020, 5901, 14008, 5804, 13996, 5721, 13982, 5626, 13970, 5543,
+		13957, 5460, 13945, 5384, 13933, 5316, 13920, 5240, 13908, 5178, 13896, 5112, 13884, 4984, 13872, 4871,
+		13861, 4769, 13849, 4663, 13837, 4563, 13827, 4481, 13815, 4381, 13804, 4304, 13793, 4232, 13782, 4151,
+		13770, 4057, 13760, 3936, 13749, 3808, 13739, 3681, 13728, 3562, 13717, 3451, 13709, 3380, 13698, 3279,
+		13688, 3187, 13678, 3100, 13668, 2973, 13658, 2813, 13648, 2682, 13639, 2541, 13629, 2431, 13620, 2308,
+		13611, 2204, 13601, 2092, 13592, 1954, 13583, 1767, 13574, 1613, 13565, 1445, 13556, 1303, 13548, 1175,
+		13538, 1046, 13530, 932, 13522, 824, 13513, 722, 13505, 629, 13497, 546, 13488, 464, 13480, 392,
+		15538, 17835, 15542, 17565, 15546, 17412, 15550, 17203, 15553, 17046, 15557, 16915, 15560, 16809, 15563, 16716,
+		15565, 16638, 15569, 16570, 15571, 16506, 15573, 16451, 15576, 16401, 15578, 16324, 15580, 16240, 15582, 16161,
+		15583, 16089, 15585, 16021, 15585, 15954, 15587, 15895, 15589, 15841, 15589, 15786, 15589, 15736, 15590, 15687,
+		15590, 15642, 15591, 15599, 15591, 15557, 15591, 15517, 15591, 15481, 15590, 15444, 15589, 15409, 15588, 15375,
+		15587, 15326, 15586, 15266, 15585, 15206, 15584, 15149, 15582, 15093, 15580, 15040, 15579, 14989, 15576, 14939,
+		15575, 14892, 15572, 14846, 15570, 14801, 15568, 14757, 15565, 14717, 15563, 14676, 15559, 14635, 15556, 14597,
+		15553, 14560, 15550, 14523, 15546, 14489, 15542, 14453, 15539, 14421, 15535, 14389, 15531, 14357, 15527, 14318,
+		15523, 14259, 15519, 14203, 15514, 14146, 15510, 14092, 15505, 14039, 15501, 13990, 15496, 13938, 15491, 13891,
+		15486, 13843, 15481, 13800, 15476, 13754, 15471, 13712, 15466, 13668, 15460, 13627, 15455, 13589, 15449, 13548,
+		15444, 13513, 15439, 13476, 15433, 13439, 15428, 13406, 15423, 13373, 15416, 13339, 15411, 13304, 15405, 13242,
+		15399, 13182, 15393, 13124, 15387, 13067, 15381, 13011, 15375, 12958, 15369, 12906, 15363, 12856, 15354, 12807,
+		15341, 12758, 15330, 12713, 15317, 12667, 15305, 12623, 15292, 12579, 15280, 12539, 15268, 12499, 15255, 12459,
+		15243, 12421, 15231, 12385, 15218, 12349, 15206, 12314, 15193, 12271, 15181, 12206, 15168, 12141, 15156, 12081,
+		15144, 12020, 15131, 11962, 15118, 11905, 15106, 11851, 15094, 11797, 15081, 11745, 15069, 11694, 15057, 11646,
+		15044, 11599, 15032, 11554, 15019, 11507, 15007, 11465, 14995, 11424, 14983, 11383, 14971, 11344, 14959, 11306,
+		14947, 11270, 14935, 11202, 14923, 11135, 14911, 11066, 14900, 11003, 14888, 10939, 14876, 10878, 14864, 10818,
+		14854, 10764, 14842, 10707, 14831, 10655, 14819, 10602, 14808, 10551, 14797, 10506, 14785, 10455, 14774, 10411,
+		14764, 10369, 14752, 10325, 14741, 10284, 14730, 10243, 14720, 10172, 14709, 10098, 14698, 10025, 14688, 9958,
+		14677, 9886, 14666, 9821, 14656, 9762, 14645, 9698, 14635, 9639, 14625, 9585, 14614, 9528, 14605, 9478,
+		14595, 9428, 14585, 9378, 14575, 9328, 14566, 9288, 14556, 9243, 14546, 9183, 14537, 9101, 14527, 9023,
+		14518, 8948, 14508, 8868, 14499, 8798, 14490, 8734, 14481, 8669, 14472, 8609, 14463, 8545, 14454, 8486,
+		14445, 8432, 14436, 8375, 14428, 8324, 14419, 8274, 14410, 8225, 14402, 8170, 14394, 8079, 14385, 7992,
+		14377, 7913, 14369, 7830, 14360, 7754, 14352, 7682, 14344, 7613, 14336, 7543, 14321, 7480, 14305, 7418,
+		14290, 7358, 14275, 7303, 14260, 7247, 14245, 7195, 14230, 7119, 14215, 7025, 14200, 6932, 14186, 6845,
+		14171, 6756, 14156, 6675, 14143, 6601, 14129, 6527, 14115, 6456, 14101, 6387, 14088, 6325, 14073, 6257,
+		14060, 6202, 14047, 6143, 14035, 6044, 14021, 5934, 14008, 5828, 13995, 5742, 13983, 5648, 13971, 5572,
+		13958, 5486, 13945, 5403, 13933, 5337, 13920, 5259, 13908, 5195, 13896, 5131, 13884, 5019, 13873, 4909,
+		13862, 4803, 13850, 4690, 13839, 4602, 13827, 4502, 13816, 4413, 13805, 4336, 13794, 4247, 13783, 4169,
+		13773, 4108, 13762, 3975, 13751, 3837, 13741, 3725, 13730, 3609, 13720, 3502, 13709, 3388, 13699, 3288,
+		13689, 3207, 13680, 3127, 13670, 3010, 13660, 2863, 13650, 2718, 13641, 2578, 13632, 2465, 13622, 2335,
+		13613, 2226, 13603, 2125, 13595, 2014, 13585, 1816, 13576, 1654, 13568, 1501, 13558, 1344, 13550, 1203,
+		13541, 1077, 13533, 959, 13524, 848, 13516, 737, 13508, 649, 13500, 562, 13491, 481, 13483, 402,
+		15525, 17805, 15529, 17538, 15532, 17370, 15536, 17161, 15539, 17010, 15542, 16879, 15545, 16777, 15548, 16686,
+		15550, 16610, 15553, 16543, 15555, 16480, 15557, 16425, 15559, 16368, 15562, 16280, 15563, 16194, 15565, 16116,
+		15566, 16045, 15568, 15980, 15569, 15918, 15570, 15859, 15570, 15804, 15571, 15754, 15571, 15702, 15572, 15657,
+		15572, 15612, 15573, 15570, 15574, 15531, 15573, 15492, 15573, 15455, 15572, 15420, 15571, 15386, 15571, 15347,
+		15570, 15285, 15568, 15223, 15567, 15166, 15566, 15110, 15565, 15057, 15563, 15004, 15561, 14954, 15559, 14905,
+		15556, 14858, 15554, 14813, 15552, 14770, 15550, 14728, 15547, 14686, 15545, 14647, 15542, 14609, 15539, 14570,
+		15536, 14535, 15533, 14500, 15529, 14465, 15526, 14433, 15522, 14399, 15518, 14368, 15515, 14338, 15511, 14280,
+		15507, 14223, 15502, 14165, 15498, 14113, 15494, 14059, 15489, 14008, 15485, 13958, 15481, 13911, 15476, 13862,
+		15471, 13818, 15466, 13772, 15462, 13731, 15457, 13687, 15451, 13646, 15447, 13607, 15441, 13566, 15436, 13530,
+		15430, 13492, 15425, 13457, 15420, 13424, 15414, 13388, 15408, 13354, 15404, 13324, 15398, 13274, 15392, 13213,
+		15387, 13155, 15381, 13098, 15375, 13041, 15369, 12987, 15363, 12935, 15355, 12885, 15343, 12834, 15332, 12786,
+		15320, 12739, 15308, 12694, 15296, 12650, 15284, 12606, 15272, 12565, 15260, 12524, 15248, 12484, 15236, 12445,
+		15224, 12409, 15212, 12372, 15199, 12336, 15188, 12303, 15175, 12251, 15163, 12187, 15151, 12124, 15139, 12063,
+		15127, 12004, 15115, 11947, 15103, 11891, 15091, 11837, 15078, 11784, 15067, 11734, 15054, 11683, 15042, 11637,
+		15030, 11589, 15018, 11543, 15005, 11499, 14994, 11458, 14982, 11416, 14970, 11376, 14959, 11338, 14947, 11300,
+		14936, 11265, 14924, 11194, 14912, 11126, 14900, 11057, 14889, 10994, 14877, 10931, 14866, 10873, 14854, 10813,
+		14843, 10757, 14832, 10700, 14821, 10651, 14810, 10598, 14799, 10549, 14788, 10501, 14776, 10452, 14766, 10409,
+		14754, 10364, 14744, 10321, 14733, 10282, 14723, 10243, 14712, 10171, 14701, 10093, 14691, 10024, 14681, 9957,
+		14670, 9886, 14660, 9827, 14649, 9762, 14639, 9700, 14629, 9645, 14619, 9587, 14609, 9532, 14600, 9482,
+		14590, 9430, 14580, 9380, 14570, 9335, 14561, 9289, 14551, 9244, 14541, 9188, 14533, 9111, 14523, 9030,
+		14514, 8953, 14505, 8882, 14495, 8812, 14486, 8743, 14477, 8675, 14468, 8609, 14459, 8551, 14451, 8496,
+		14442, 8440, 14433, 8385, 14424, 8330, 14416, 8281, 14408, 8233, 14399, 8182, 14391, 8092, 14383, 8008,
+		14375, 7926, 14366, 7844, 14358, 7768, 14350, 7696, 14342, 7625, 14333, 7558, 14317, 7492, 14302, 7429,
+		14287, 7371, 14271, 7312, 14256, 7258, 14241, 7203, 14227, 7143, 14213, 7045, 14198, 6953, 14184, 6865,
+		14169, 6776, 14155, 6696, 14142, 6621, 14127, 6543, 14113, 6470, 14099, 6404, 14086, 6338, 14072, 6271,
+		14060, 6218, 14046, 6157, 14034, 6065, 14020, 5958, 14008, 5861, 13995, 5768, 13982, 5672, 13969, 5591,
+		13957, 5505, 13944, 5426, 13933, 5356, 13920, 5280, 13909, 5212, 13897, 5150, 13885, 5054, 13874, 4945,
+		13862, 4822, 13851, 4722, 13840, 4626, 13828, 4525, 13817, 4444, 13806, 4352, 13795, 4270, 13784, 4192,
+		13773, 4121, 13763, 4003, 13752, 3883, 13742, 3759, 13731, 3637, 13721, 3525, 13712, 3428, 13702, 3340,
+		13692, 3241, 13682, 3148, 13672, 3051, 13662, 2904, 13653, 2763, 13643, 2622, 13634, 2489, 13624, 2364,
+		13615, 2262, 13606, 2150, 13596, 2044, 13588, 1868, 13579, 1694, 13570, 1527, 13561, 1369, 13552, 1232,
+		13544, 1098, 13535, 981, 13527, 873, 13518, 761, 13510, 659, 13502, 573, 13494, 489, 13486, 413,
+		15512, 17769, 15516, 17515, 15519, 17326, 15522, 17122, 15525, 16969, 15528, 16846, 15530, 16743, 15533, 16656,
+		15535, 16581, 15538, 16515, 15540, 16455, 15542, 16403, 15544, 16324, 15545, 16233, 15548, 16153, 15549, 16078,
+		15550, 16008, 15551, 15945, 15552, 15883, 15553, 15825, 15553, 15771, 15555, 15722, 15555, 15673, 15556, 15629,
+		15556, 15586, 15556, 15542, 15556, 15504, 15556, 15466, 15555, 15431, 15555, 15397, 15554, 15363, 15552, 15299,
+		15552, 15239, 15551, 15182, 15550, 15127, 15548, 15070, 15547, 15020, 15545, 14969, 15544, 14920, 15542, 14873,
+		15540, 14827, 15537, 14783, 15535, 14740, 15533, 14698, 15530, 14659, 15527, 14618, 15525, 14582, 15522, 14546,
+		15519, 14510, 15516, 14476, 15512, 14442, 15509, 14410, 15506, 14379, 15502, 14348, 15498, 14301, 15494, 14242,
+		15491, 14186, 15487, 14131, 15482, 14077, 15478, 14027, 15474, 13977, 15470, 13929, 15465, 13881, 15461, 13836,
+		15456, 13790, 15452, 13747, 15446, 13703, 15442, 13663, 15437, 13623, 15432, 13585, 15427, 13547, 15422, 13509,
+		15417, 13473, 15412, 13439, 15406, 13404, 15402, 13372, 15397, 13341, 15390, 13302, 15385, 13242, 15380, 13187,
+		15374, 13127, 15369, 13071, 15363, 13015, 15355, 12964, 15344, 12914, 15332, 12862, 15321, 12815, 15309, 12766,
+		15298, 12721, 15286, 12676, 15275, 12632, 15263, 12589, 15252, 12550, 15240, 12508, 15228, 12470, 15216, 12432,
+		15205, 12397, 15192, 12360, 15181, 12325, 15170, 12293, 15157, 12228, 15145, 12166, 15134, 12106, 15122, 12045,
+		15110, 11987, 15098, 11931, 15086, 11874, 15074, 11822, 15063, 11771, 15051, 11720, 15039, 11671, 15028, 11626,
+		15016, 11579, 15005, 11536, 14993, 11492, 14981, 11449, 14969, 11408, 14958, 11369, 14946, 11331, 14934, 11293,
+		14923, 11251, 14912, 11183, 14900, 11115, 14889, 11048, 14878, 10987, 14867, 10924, 14856, 10866, 14844, 10807,
+		14834, 10753, 14822, 10697, 14811, 10645, 14800, 10592, 14789, 10544, 14778, 10495, 14768, 10451, 14757, 10406,
+		14746, 10361, 14736, 10321, 14725, 10279, 14714, 10240, 14704, 10165, 14694, 10093, 14684, 10024, 14673, 9953,
+		14663, 9887, 14653, 9825, 14642, 9759, 14633, 9702, 14623, 9646, 14613, 9587, 14604, 9536, 14594, 9484,
+		14584, 9431, 14575, 9385, 14565, 9338, 14556, 9291, 14546, 9248, 14537, 9194, 14527, 9112, 14518, 9032,
+		14509, 8960, 14500, 8888, 14491, 8814, 14482, 8750, 14474, 8685, 14465, 8625, 14456, 8561, 14447, 8499,
+		14438, 8443, 14430, 8390, 14422, 8340, 14413, 8290, 14405, 8241, 14396, 8194, 14388, 8107, 14380, 8017,
+		14372, 7941, 14364, 7858, 14356, 7780, 14348, 7710, 14340, 7635, 14329, 7572, 14313, 7504, 14298, 7441,
+		14284, 7382, 14269, 7327, 14254, 7271, 14239, 7217, 14224, 7164, 14210, 7063, 14195, 6973, 14181, 6878,
+		14167, 6797, 14153, 6712, 14140, 6640, 14125, 6558, 14111, 6487, 14098, 6419, 14085, 6356, 14071, 6288,
+		14058, 6231, 14045, 6172, 14032, 6088, 14019, 5980, 14006, 5882, 13995, 5798, 13981, 5698, 13969, 5612,
+		13957, 5528, 13945, 5451, 13933, 5376, 13921, 5299, 13909, 5231, 13897, 5169, 13885, 5085, 13874, 4969,
+		13862, 4856, 13851, 4760, 13840, 4648, 13829, 4556, 13818, 4466, 13807, 4374, 13796, 4296, 13785, 4217,
+		13775, 4143, 13764, 4044, 13753, 3915, 13743, 3780, 13733, 3672, 13723, 3565, 13712, 3446, 13703, 3350,
+		13693, 3262, 13683, 3173, 13673, 3089, 13664, 2943, 13654, 2792, 13644, 2651, 13635, 2515, 13626, 2401,
+		13617, 2286, 13608, 2177, 13599, 2074, 13589, 1905, 13581, 1725, 13572, 1567, 13563, 1405, 13555, 1262,
+		13546, 1129, 13538, 1001, 13529, 892, 13521, 788, 13513, 683, 13505, 590, 13496, 503, 13488, 424,
+		15499, 17736, 15503, 17491, 15506, 17281, 15509, 17081, 15511, 16931, 15514, 16814, 15517, 16713, 15520, 16631,
+		15521, 16552, 15523, 16487, 15525, 16431, 15527, 16376, 15529, 16282, 15531, 16195, 15533, 16117, 15533, 16042,
+		15535, 15974, 15535, 15909, 15537, 15850, 15538, 15794, 15538, 15742, 15538, 15691, 15539, 15644, 15539, 15598,
+		15539, 15556, 15539, 15516, 15539, 15479, 15539, 15442, 15539, 15408, 15537, 15372, 15537, 15323, 15536, 15261,
+		15536, 15202, 15535, 15145, 15532, 15085, 15531, 15034, 15530, 14983, 15528, 14932, 15526, 14885, 15525, 14840,
+		15523, 14795, 15520, 14752, 15519, 14711, 15517, 14671, 15514, 14631, 15511, 14593, 15508, 14556, 15505, 14520,
+		15503, 14488, 15499, 14452, 15496, 14420, 15493, 14388, 15490, 14358, 15486, 14321, 15482, 14261, 15479, 14205,
+		15475, 14150, 15471, 14098, 15467, 14045, 15463, 13994, 15459, 13947, 15455, 13898, 15450, 13853, 15446, 13807,
+		15442, 13765, 15437, 13722, 15432, 13680, 15428, 13640, 15423, 13599, 15419, 13564, 15413, 13525, 15409, 13490,
+		15404, 13455, 15399, 13421, 15394, 13388, 15388, 13354, 15383, 13324, 15379, 13277, 15373, 13214, 15367, 13155,
+		15362, 13101, 15353, 13046, 15342, 12991, 15332, 12942, 15321, 12890, 15310, 12841, 15298, 12792, 15287, 12746,
+		15276, 12702, 15264, 12657, 15253, 12615, 15242, 12573, 15231, 12534, 15220, 12495, 15208, 12456, 15197, 12419,
+		15186, 12384, 15174, 12348, 15162, 12314, 15152, 12277, 15139, 12210, 15128, 12147, 15116, 12087, 15104, 12027,
+		15093, 11969, 15082, 11915, 15069, 11859, 15058, 11809, 15047, 11757, 15035, 11707, 15024, 11660, 15012, 11613,
+		15001, 11567, 14990, 11525, 14978, 11481, 14967, 11441, 14956, 11401, 14944, 11361, 14934, 11325, 14922, 11288,
+		14911, 11238, 14899, 11169, 14889, 11104, 14878, 11041, 14867, 10977, 14855, 10915, 14845, 10858, 14834, 10799,
+		14823, 10744, 14812, 10691, 14802, 10641, 14791, 10588, 14781, 10541, 14769, 10493, 14759, 10448, 14748, 10402,
+		14738, 10359, 14727, 10319, 14717, 10277, 14707, 10239, 14697, 10163, 14686, 10092, 14676, 10018, 14665, 9949,
+		14656, 9887, 14646, 9823, 14636, 9760, 14626, 9702, 14617, 9643, 14607, 9588, 14598, 9535, 14588, 9483,
+		14579, 9435, 14569, 9385, 14560, 9338, 14551, 9294, 14542, 9252, 14532, 9200, 14523, 9117, 14514, 9043,
+		14505, 8967, 14495, 8890, 14486, 8819, 14478, 8757, 14469, 8690, 14460, 8623, 14452, 8567, 14444, 8510,
+		14435, 8453, 14427, 8398, 14418, 8344, 14410, 8292, 14402, 8245, 14394, 8203, 14385, 8119, 14378, 8036,
+		14369, 7949, 14361, 7869, 14354, 7793, 14346, 7720, 14339, 7651, 14326, 7582, 14310, 7515, 14295, 7455,
+		14281, 7394, 14265, 7336, 14250, 7278, 14237, 7229, 14222, 7175, 14207, 7085, 14194, 6995, 14179, 6907,
+		14165, 6816, 14151, 6732, 14137, 6655, 14123, 6577, 14110, 6509, 14097, 6436, 14084, 6371, 14070, 6302,
+		14057, 6247, 14044, 6184, 14031, 6121, 14019, 6013, 14006, 5909, 13994, 5816, 13981, 5721, 13969, 5634,
+		13957, 5550, 13945, 5472, 13933, 5393, 13921, 5320, 13909, 5251, 13897, 5185, 13885, 5120, 13874, 5004,
+		13863, 4893, 13852, 4779, 13841, 4678, 13830, 4589, 13819, 4487, 13808, 4405, 13797, 4319, 13786, 4232,
+		13776, 4162, 13766, 4091, 13755, 3952, 13745, 3832, 13735, 3709, 13724, 3591, 13714, 3480, 13705, 3390,
+		13695, 3288, 13685, 3196, 13675, 3108, 13665, 2986, 13656, 2828, 13647, 2690, 13638, 2559, 13628, 2434,
+		13619, 2313, 13610, 2203, 13601, 2095, 13592, 1951, 13583, 1764, 13575, 1608, 13566, 1448, 13557, 1293,
+		13548, 1156, 13540, 1023, 13532, 911, 13523, 802, 13515, 699, 13507, 598, 13499, 514, 13491, 435,
+		15487, 17708, 15490, 17468, 15493, 17239, 15496, 17047, 15498, 16896, 15500, 16780, 15503, 16683, 15505, 16600,
+		15507, 16528, 15509, 16463, 15511, 16407, 15512, 16326, 15514, 16237, 15516, 16152, 15517, 16074, 15518, 16003,
+		15519, 15937, 15520, 15872, 15521, 15816, 15521, 15762, 15521, 15709, 15522, 15659, 15523, 15616, 15523, 15572,
+		15523, 15532, 15524, 15493, 15523, 15454, 15522, 15418, 15522, 15383, 15521, 15341, 15521, 15279, 15519, 15217,
+		15518, 15158, 15517, 15103, 15517, 15051, 15515, 15000, 15513, 14948, 15512, 14901, 15510, 14854, 15508, 14808,
+		15506, 14765, 15504, 14723, 15502, 14681, 15500, 14642, 15497, 14605, 15495, 14567, 15492, 14532, 15489, 14497,
+		15486, 14462, 15483, 14431, 15480, 14397, 15477, 14368, 15474, 14338, 15470, 14280, 15467, 14225, 15463, 14169,
+		15460, 14117, 15456, 14064, 15452, 14014, 15448, 13964, 15444, 13916, 15440, 13870, 15436, 13824, 15432, 13782,
+		15427, 13738, 15423, 13698, 15419, 13657, 15414, 13616, 15409, 13579, 15404, 13540, 15400, 13505, 15395, 13470,
+		15391, 13437, 15386, 13403, 15381, 13370, 15376, 13339, 15370, 13301, 15365, 13242, 15361, 13186, 15351, 13130,
+		15339, 13072, 15328, 13017, 15319, 12967, 15309, 12917, 15298, 12867, 15287, 12818, 15276, 12772, 15265, 12727,
+		15255, 12683, 15244, 12640, 15233, 12598, 15222, 12557, 15211, 12518, 15200, 12479, 15188, 12441, 15178, 12406,
+		15166, 12370, 15155, 12335, 15144, 12303, 15132, 12250, 15121, 12187, 15110, 12128, 15099, 12067, 15088, 12010,
+		15076, 11953, 15065, 11898, 15054, 11846, 15043, 11794, 15031, 11743, 15020, 11694, 15010, 11649, 14998, 11602,
+		14987, 11557, 14976, 11514, 14964, 11472, 14954, 11432, 14942, 11391, 14931, 11353, 14921, 11316, 14909, 11279,
+		14899, 11229, 14888, 11158, 14877, 11094, 14866, 11029, 14856, 10969, 14844, 10904, 14834, 10849, 14823, 10792,
+		14813, 10738, 14802, 10684, 14791, 10633, 14781, 10582, 14771, 10536, 14760, 10488, 14750, 10444, 14739, 10398,
+		14730, 10358, 14719, 10316, 14709, 10276, 14699, 10235, 14688, 10159, 14679, 10087, 14669, 10020, 14659, 9952,
+		14649, 9886, 14639, 9820, 14630, 9762, 14620, 9701, 14611, 9644, 14601, 9591, 14592, 9535, 14582, 9484,
+		14573, 9435, 14563, 9386, 14554, 9339, 14545, 9294, 14536, 9251, 14527, 9205, 14518, 9127, 14509, 9046,
+		14500, 8971, 14491, 8897, 14483, 8832, 14474, 8759, 14465, 8693, 14457, 8634, 14448, 8572, 14440, 8511,
+		14431, 8456, 14424, 8405, 14415, 8351, 14407, 8305, 14399, 8253, 14390, 8205, 14383, 8131, 14375, 8045,
+		14367, 7963, 14359, 7883, 14351, 7804, 14344, 7733, 14336, 7661, 14321, 7593, 14306, 7529, 14291, 7466,
+		14276, 7403, 14261, 7344, 14247, 7292, 14233, 7238, 14218, 7185, 14203, 7103, 14189, 7006, 14175, 6920,
+		14161, 6830, 14149, 6753, 14135, 6672, 14122, 6598, 14108, 6521, 14095, 6452, 14081, 6383, 14068, 6321,
+		14056, 6262, 14043, 6200, 14031, 6146, 14018, 6040, 14005, 5937, 13993, 5841, 13981, 5746, 13969, 5658,
+		13956, 5572, 13945, 5494, 13932, 5409, 13921, 5342, 13909, 5270, 13897, 5200, 13886, 5140, 13875, 5035,
+		13864, 4925, 13852, 4806, 13841, 4709, 13830, 4608, 13818, 4508, 13808, 4426, 13798, 4341, 13787, 4257,
+		13777, 4185, 13766, 4109, 13756, 3989, 13745, 3858, 13735, 3733, 13725, 3621, 13716, 3514, 13706, 3403,
+		13696, 3308, 13687, 3227, 13677, 3135, 13667, 3027, 13657, 2864, 13649, 2730, 13639, 2588, 13630, 2463,
+		13621, 2340, 13612, 2226, 13603, 2118, 13594, 2001, 13585, 1823, 13577, 1642, 13568, 1473, 13559, 1317,
+		13551, 1184, 13542, 1050, 13534, 927, 13526, 818, 13518, 716, 13510, 622, 13502, 530, 13493, 445,
+		15475, 17678, 15478, 17443, 15480, 17197, 15482, 17008, 15485, 16864, 15487, 16746, 15489, 16653, 15491, 16571,
+		15493, 16502, 15495, 16441, 15496, 16384, 15498, 16284, 15499, 16192, 15501, 16111, 15502, 16035, 15503, 15966,
+		15503, 15899, 15505, 15840, 15506, 15783, 15506, 15731, 15506, 15680, 15506, 15632, 15507, 15588, 15507, 15546,
+		15507, 15505, 15507, 15467, 15507, 15429, 15506, 15394, 15506, 15361, 15506, 15301, 15504, 15236, 15503, 15177,
+		15503, 15122, 15501, 15067, 15500, 15012, 15499, 14964, 15497, 14914, 15495, 14866, 15494, 14822, 15492, 14778,
+		15491, 14736, 15488, 14694, 15486, 14655, 15483, 14615, 15481, 14578, 15479, 14543, 15476, 14507, 15473, 14473,
+		15471, 14441, 15467, 14407, 15465, 14377, 15461, 14346, 15458, 14299, 15455, 14242, 15451, 14187, 15448, 14135,
+		15445, 14082, 15441, 14032, 15437, 13982, 15434, 13935, 15430, 13887, 15426, 13842, 15421, 13797, 15417, 13754,
+		15414, 13714, 15409, 13673, 15404, 13633, 15401, 13596, 15396, 13557, 15392, 13521, 15386, 13484, 15382, 13451,
+		15377, 13417, 15373, 13384, 15368, 13353, 15363, 13322, 15356, 13272, 15347, 13214, 15336, 13155, 15326, 13099,
+		15317, 13049, 15306, 12994, 15296, 12942, 15286, 12894, 15276, 12845, 15265, 12798, 15255, 12752, 15244, 12708,
+		15234, 12664, 15223, 12621, 15212, 12580, 15202, 12541, 15191, 12502, 15179, 12464, 15169, 12427, 15158, 12392,
+		15147, 12356, 15136, 12323, 15125, 12290, 15115, 12230, 15103, 12166, 15092, 12106, 15081, 12047, 15070, 11990,
+		15060, 11936, 15049, 11883, 15038, 11830, 15028, 11781, 15016, 11730, 15005, 11682, 14994, 11634, 14983, 11590,
+		14972, 11546, 14962, 11504, 14951, 11462, 14940, 11422, 14929, 11383, 14919, 11346, 14908, 11308, 14897, 11272,
+		14886, 11213, 14875, 11145, 14865, 11082, 14854, 11017, 14844, 10957, 14833, 10896, 14823, 10841, 14812, 10782,
+		14802, 10730, 14792, 10677, 14782, 10627, 14771, 10577, 14761, 10530, 14751, 10483, 14741, 10439, 14730, 10395,
+		14721, 10354, 14710, 10312, 14700, 10272, 14691, 10232, 14681, 10154, 14671, 10083, 14661, 10014, 14652, 9947,
+		14642, 9884, 14633, 9822, 14623, 9760, 14614, 9700, 14604, 9645, 14595, 9591, 14585, 9536, 14576, 9484,
+		14567, 9435, 14558, 9387, 14549, 9343, 14539, 9296, 14530, 9252, 14521, 9207, 14513, 9126, 14504, 9046,
+		14495, 8972, 14486, 8901, 14478, 8833, 14470, 8767, 14461, 8702, 14453, 8638, 14445, 8578, 14436, 8520,
+		14428, 8466, 14420, 8409, 14411, 8355, 14403, 8304, 14395, 8258, 14388, 8214, 14380, 8144, 14372, 8054,
+		14364, 7973, 14356, 7893, 14349, 7818, 14341, 7741, 14331, 7672, 14316, 7604, 14301, 7536, 14287, 7475,
+		14272, 7415, 14257, 7355, 14244, 7303, 14228, 7245, 14215, 7196, 14201, 7123, 14187, 7028, 14173, 6938,
+		14160, 6853, 14146, 6770, 14132, 6681, 14119, 6609, 14106, 6536, 14092, 6464, 14080, 6400, 14067, 6335,
+		14054, 6273, 14042, 6214, 14029, 6160, 14017, 6068, 14004, 5954, 13992, 5865, 13979, 5765, 13968, 5683,
+		13955, 5590, 13943, 5512, 13931, 5427, 13920, 5359, 13908, 5284, 13897, 5218, 13886, 5157, 13874, 5062,
+		13863, 4951, 13852, 4836, 13841, 4738, 13830, 4631, 13820, 4541, 13810, 4451, 13798, 4359, 13788, 4283,
+		13778, 4203, 13767, 4130, 13757, 4032, 13747, 3887, 13737, 3773, 13727, 3657, 13717, 3532, 13707, 3438,
+		13697, 3331, 13687, 3240, 13678, 3148, 13669, 3070, 13660, 2918, 13650, 2763, 13641, 2626, 13632, 2488,
+		13623, 2367, 13613, 2249, 13605, 2146, 13596, 2052, 13587, 1851, 13578, 1671, 13570, 1512, 13561, 1350,
+		13553, 1210, 13545, 1078, 13536, 951, 13528, 833, 13520, 731, 13512, 637, 13504, 538, 13496, 456,
+		15463, 17648, 15466, 17417, 15468, 17157, 15470, 16969, 15472, 16828, 15474, 16717, 15476, 16625, 15477, 16544,
+		15479, 16474, 15481, 16415, 15483, 16342, 15484, 16242, 15485, 16155, 15487, 16074, 15487, 15998, 15488, 15931,
+		15489, 15869, 15490, 15810, 15491, 15753, 15491, 15701, 15491, 15653, 15492, 15608, 15492, 15561, 15492, 15520,
+		15492, 15479, 15492, 15444, 15491, 15407, 15491, 15372, 15490, 15320, 15489, 15255, 15489, 15196, 15488, 15137,
+		15486, 15082, 15486, 15029, 15485, 14980, 15483, 14930, 15481, 14879, 15480, 14835, 15478, 14790, 15476, 14748,
+		15475, 14706, 15472, 14666, 15470, 14628, 15468, 14590, 15466, 14554, 15463, 14517, 15461, 14484, 15458, 14451,
+		15455, 14418, 15453, 14387, 15449, 14356, 15447, 14320, 15443, 14261, 15440, 14203, 15437, 14151, 15433, 14098,
+		15430, 14050, 15426, 13999, 15423, 13952, 15419, 13904, 15416, 13860, 15411, 13814, 15408, 13771, 15403, 13729,
+		15399, 13687, 15395, 13648, 15391, 13611, 15387, 13572, 15383, 13536, 15378, 13500, 15374, 13466, 15369, 13432,
+		15365, 13399, 15360, 13367, 15350, 13334, 15342, 13300, 15332, 13241, 15322, 13183, 15314, 13130, 15303, 13072,
+		15293, 13019, 15283, 12968, 15274, 12921, 15263, 12870, 15253, 12821, 15243, 12776, 15233, 12731, 15223, 12689,
+		15212, 12644, 15202, 12603, 15191, 12563, 15181, 12524, 15171, 12487, 15161, 12450, 15150, 12413, 15140, 12379,
+		15128, 12343, 15118, 12311, 15107, 12270, 15097, 12207, 15085, 12144, 15076, 12089, 15065, 12029, 15054, 11973,
+		15044, 11920, 15033, 11865, 15022, 11814, 15012, 11765, 15001, 11716, 14990, 11668, 14980, 11623, 14969, 11580,
+		14959, 11536, 14948, 11493, 14937, 11452, 14927, 11413, 14916, 11375, 14906, 11338, 14895, 11301, 14885, 11267,
+		14874, 11200, 14864, 11133, 14854, 11069, 14843, 11006, 14833, 10948, 14823, 10887, 14812, 10831, 14801, 10772,
+		14792, 10723, 14781, 10669, 14771, 10620, 14761, 10571, 14752, 10525, 14741, 10478, 14731, 10434, 14721, 10390,
+		14712, 10349, 14701, 10308, 14692, 10269, 14682, 10224, 14672, 10148, 14664, 10081, 14653, 10009, 14644, 9943,
+		14635, 9879, 14625, 9817, 14616, 9757, 14606, 9698, 14597, 9643, 14588, 9587, 14578, 9533, 14570, 9485,
+		14561, 9435, 14552, 9388, 14543, 9343, 14534, 9297, 14525, 9256, 14517, 9213, 14507, 9127, 14499, 9054,
+		14491, 8980, 14482, 8904, 14473, 8834, 14466, 8771, 14457, 8702, 14448, 8640, 14440, 8582, 14433, 8528,
+		14424, 8468, 14416, 8414, 14408, 8366, 14401, 8317, 14392, 8264, 14384, 8215, 14377, 8153, 14369, 8069,
+		14361, 7981, 14354, 7908, 14346, 7827, 14338, 7750, 14326, 7683, 14311, 7613, 14297, 7549, 14282, 7485,
+		14268, 7424, 14254, 7367, 14239, 7310, 14225, 7255, 14211, 7204, 14198, 7144, 14185, 7048, 14171, 6954,
+		14157, 6866, 14144, 6785, 14130, 6704, 14117, 6627, 14104, 6552, 14091, 6482, 14078, 6414, 14066, 6351,
+		14053, 6287, 14040, 6227, 14027, 6168, 14015, 6089, 14003, 5984, 13991, 5887, 13978, 5786, 13966, 5700,
+		13955, 5612, 13944, 5535, 13931, 5450, 13920, 5380, 13909, 5304, 13897, 5236, 13886, 5171, 13875, 5097,
+		13864, 4985, 13852, 4865, 13842, 4763, 13831, 4660, 13821, 4568, 13810, 4472, 13799, 4384, 13789, 4303,
+		13778, 4218, 13768, 4148, 13758, 4057, 13748, 3923, 13739, 3811, 13728, 3681, 13718, 3569, 13709, 3467,
+		13699, 3360, 13690, 3270, 13680, 3180, 13670, 3090, 13661, 2934, 13651, 2793, 13642, 2657, 13633, 2524,
+		13625, 2406, 13615, 2280, 13607, 2171, 13598, 2063, 13589, 1890, 13580, 1704, 13572, 1540, 13563, 1376,
+		13555, 1234, 13547, 1098, 13538, 969, 13530, 853, 13522, 745, 13514, 643, 13506, 551, 13498, 468,
+		15451, 17615, 15453, 17375, 15456, 17117, 15457, 16935, 15460, 16799, 15461, 16689, 15464, 16599, 15465, 16520,
+		15466, 16452, 15468, 16393, 15469, 16299, 15470, 16204, 15472, 16116, 15473, 16037, 15474, 15966, 15474, 15898,
+		15475, 15836, 15476, 15779, 15476, 15721, 15476, 15669, 15476, 15622, 15477, 15577, 15477, 15535, 15477, 15494,
+		15477, 15456, 15477, 15419, 15476, 15384, 15475, 15338, 15474, 15274, 15474, 15215, 15473, 15157, 15473, 15101,
+		15471, 15045, 15470, 14992, 15469, 14943, 15467, 14892, 15466, 14849, 15465, 14805, 15463, 14761, 15461, 14717,
+		15459, 14679, 15457, 14637, 15455, 14601, 15453, 14564, 15450, 14528, 15448, 14494, 15445, 14460, 15443, 14428,
+		15440, 14396, 15437, 14365, 15434, 14336, 15431, 14278, 15429, 14224, 15425, 14170, 15422, 14115, 15419, 14065,
+		15415, 14014, 15412, 13967, 15408, 13920, 15405, 13875, 15401, 13830, 15398, 13788, 15394, 13745, 15390, 13704,
+		15386, 13664, 15382, 13626, 15378, 13586, 15374, 13550, 15369, 13513, 15365, 13480, 15361, 13446, 15353, 13414,
+		15345, 13382, 15335, 13350, 15326, 13319, 15316, 13265, 15307, 13208, 15299, 13155, 15289, 13098, 15280, 13045,
+		15270, 12994, 15260, 12941, 15251, 12895, 15241, 12847, 15232, 12801, 15221, 12754, 15212, 12711, 15202, 12669,
+		15192, 12627, 15182, 12586, 15172, 12547, 15162, 12509, 15151, 12471, 15141, 12434, 15131, 12399, 15120, 12365,
+		15109, 12330, 15100, 12299, 15089, 12245, 15079, 12184, 15069, 12125, 15059, 12067, 15048, 12009, 15038, 11955,
+		15027, 11901, 15017, 11849, 15007, 11800, 14996, 11749, 14986, 11702, 14976, 11656, 14965, 11611, 14954, 11566,
+		14945, 11525, 14934, 11484, 14924, 11443, 14914, 11405, 14903, 11366, 14893, 11329, 14882, 11293, 14872, 11252,
+		14862, 11184, 14852, 11121, 14842, 11057, 14832, 10995, 14822, 10936, 14811, 10877, 14802, 10823, 14791, 10767,
+		14782, 10715, 14771, 10661, 14762, 10614, 14751, 10564, 14742, 10519, 14732, 10473, 14722, 10430, 14713, 10387,
+		14703, 10346, 14693, 10305, 14684, 10267, 14674, 10216, 14665, 10146, 14656, 10075, 14646, 10005, 14637, 9941,
+		14627, 9874, 14618, 9814, 14609, 9755, 14599, 9696, 14591, 9641, 14581, 9587, 14573, 9536, 14564, 9486,
+		14555, 9435, 14546, 9389, 14537, 9341, 14528, 9298, 14520, 9257, 14511, 9212, 14503, 9135, 14495, 9059,
+		14486, 8982, 14478, 8911, 14470, 8844, 14461, 8775, 14453, 8709, 14445, 8648, 14436, 8587, 14428, 8528,
+		14420, 8472, 14412, 8420, 14404, 8366, 14397, 8316, 14389, 8269, 14382, 8227, 14374, 8169, 14366, 8078,
+		14358, 7992, 14351, 7913, 14343, 7839, 14336, 7766, 14322, 7695, 14306, 7624, 14293, 7561, 14278, 7495,
+		14264, 7435, 14250, 7376, 14236, 7320, 14223, 7268, 14208, 7213, 14195, 7162, 14181, 7065, 14167, 6972,
+		14154, 6888, 14141, 6802, 14127, 6718, 14115, 6641, 14101, 6566, 14089, 6498, 14076, 6430, 14063, 6362,
+		14050, 6298, 14039, 6243, 14025, 6180, 14014, 6114, 14001, 6005, 13989, 5908, 13977, 5811, 13966, 5724,
+		13954, 5628, 13943, 5554, 13931, 5467, 13920, 5400, 13908, 5320, 13897, 5256, 13885, 5187, 13875, 5125,
+		13864, 5009, 13853, 4896, 13842, 4791, 13831, 4681, 13821, 4591, 13810, 4494, 13800, 4412, 13789, 4322,
+		13779, 4243, 13769, 4169, 13758, 4088, 13749, 3969, 13738, 3828, 13729, 3708, 13719, 3599, 13709, 3480,
+		13700, 3386, 13691, 3292, 13680, 3191, 13671, 3111, 13663, 2991, 13654, 2845, 13644, 2687, 13635, 2555,
+		13626, 2429, 13617, 2306, 13608, 2194, 13599, 2086, 13591, 1935, 13582, 1745, 13574, 1579, 13565, 1414,
+		13557, 1261, 13549, 1125, 13540, 993, 13532, 874, 13525, 767, 13516, 655, 13509, 569, 13501, 479,
+		15439, 17591, 15442, 17329, 15444, 17078, 15445, 16902, 15447, 16768, 15449, 16663, 15451, 16572, 15452, 16496,
+		15453, 16429, 15455, 16357, 15456, 16254, 15457, 16162, 15458, 16076, 15459, 15999, 15460, 15928, 15460, 15864,
+		15461, 15803, 15461, 15743, 15461, 15692, 15462, 15643, 15462, 15596, 15462, 15552, 15463, 15511, 15462, 15469,
+		15462, 15433, 15461, 15394, 15461, 15361, 15461, 15299, 15460, 15234, 15459, 15175, 15458, 15116, 15457, 15062,
+		15456, 15009, 15455, 14958, 15454, 14909, 15453, 14864, 15451, 14816, 15449, 14772, 15448, 14730, 15446, 14689,
+		15444, 14649, 15442, 14613, 15440, 14575, 15438, 14538, 15435, 14504, 15433, 14469, 15431, 14438, 15428, 14405,
+		15426, 14376, 15423, 14345, 15420, 14296, 15417, 14241, 15414, 14186, 15411, 14134, 15408, 14082, 15405, 14032,
+		15402, 13984, 15398, 13936, 15394, 13889, 15391, 13845, 15388, 13803, 15384, 13759, 15380, 13719, 15376, 13678,
+		15373, 13640, 15369, 13601, 15365, 13566, 15360, 13528, 15353, 13494, 15344, 13459, 15336, 13426, 15328, 13395,
+		15320, 13363, 15311, 13333, 15301, 13292, 15294, 13238, 15284, 13180, 15275, 13124, 15265, 13070, 15257, 13019,
+		15247, 12968, 15239, 12922, 15229, 12872, 15219, 12822, 15210, 12780, 15201, 12735, 15191, 12692, 15181, 12650,
+		15171, 12608, 15162, 12569, 15152, 12531, 15142, 12492, 15132, 12456, 15122, 12420, 15112, 12386, 15102, 12352,
+		15092, 12319, 15082, 12285, 15072, 12223, 15062, 12162, 15052, 12105, 15042, 12048, 15031, 11990, 15021, 11937,
+		15012, 11885, 15001, 11832, 14991, 11782, 14981, 11735, 14971, 11688, 14960, 11642, 14950, 11597, 14940, 11555,
+		14931, 11514, 14919, 11470, 14910, 11433, 14900, 11395, 14890, 11356, 14880, 11320, 14871, 11286, 14860, 11238,
+		14850, 11172, 14840, 11107, 14830, 11045, 14820, 10985, 14810, 10926, 14800, 10867, 14791, 10813, 14780, 10756,
+		14771, 10707, 14761, 10656, 14752, 10608, 14742, 10558, 14732, 10512, 14722, 10466, 14713, 10424, 14704, 10382,
+		14695, 10342, 14685, 10302, 14676, 10263, 14667, 10212, 14657, 10141, 14648, 10071, 14639, 10003, 14630, 9938,
+		14620, 9873, 14611, 9813, 14602, 9752, 14593, 9696, 14584, 9641, 14575, 9586, 14566, 9534, 14557, 9483,
+		14549, 9435, 14540, 9389, 14531, 9342, 14523, 9298, 14515, 9256, 14506, 9213, 14498, 9137, 14489, 9058,
+		14481, 8983, 14473, 8917, 14465, 8846, 14456, 8778, 14449, 8715, 14440, 8653, 14432, 8591, 14425, 8536,
+		14417, 8479, 14409, 8424, 14401, 8371, 14393, 8323, 14386, 8275, 14377, 8224, 14370, 8169, 14363, 8090,
+		14356, 8009, 14348, 7930, 14341, 7848, 14330, 7770, 14316, 7704, 14302, 7635, 14287, 7566, 14274, 7507,
+		14260, 7445, 14246, 7386, 14232, 7328, 14218, 7275, 14204, 7221, 14190, 7172, 14177, 7082, 14164, 6992,
+		14151, 6902, 14137, 6815, 14124, 6734, 14112, 6657, 14099, 6586, 14086, 6509, 14073, 6440, 14061, 6377,
+		14049, 6313, 14037, 6254, 14024, 6194, 14012, 6141, 14000, 6028, 13988, 5928, 13976, 5831, 13965, 5747,
+		13953, 5648, 13941, 5568, 13930, 5484, 13919, 5414, 13907, 5335, 13896, 5270, 13885, 5201, 13875, 5144,
+		13864, 5039, 13853, 4925, 13842, 4814, 13831, 4710, 13820, 4611, 13810, 4520, 13800, 4428, 13789, 4339,
+		13780, 4269, 13769, 4185, 13759, 4113, 13750, 3997, 13740, 3856, 13731, 3750, 13720, 3621, 13710, 3512,
+		13701, 3413, 13692, 3309, 13682, 3218, 13673, 3136, 13663, 3017, 13654, 2852, 13646, 2721, 13637, 2579,
+		13628, 2458, 13619, 2331, 13610, 2217, 13601, 2107, 13592, 1970, 13584, 1788, 13576, 1613, 13567, 1445,
+		13559, 1294, 13551, 1152, 13543, 1020, 13535, 900, 13527, 783, 13519, 680, 13510, 577, 13503, 490,
+		15428, 17565, 15430, 17288, 15432, 17043, 15434, 16869, 15436, 16740, 15437, 16636, 15438, 16545, 15439, 16471,
+		15441, 16408, 15442, 16315, 15443, 16212, 15444, 16121, 15445, 16039, 15445, 15962, 15446, 15894, 15446, 15829,
+		15447, 15769, 15448, 15716, 15448, 15665, 15448, 15615, 15448, 15569, 15448, 15527, 15448, 15485, 15448, 15444,
+		15448, 15409, 15447, 15374, 15446, 15319, 15446, 15255, 15445, 15193, 15444, 15134, 15444, 15080, 15442, 15025,
+		15442, 14975, 15440, 14924, 15439, 14877, 15437, 14828, 15437, 14788, 15434, 14742, 15433, 14700, 15431, 14661,
+		15429, 14622, 15427, 14584, 15425, 14550, 15423, 14515, 15421, 14481, 15419, 14449, 15416, 14415, 15414, 14384,
+		15411, 14355, 15408, 14315, 15406, 14258, 15403, 14202, 15400, 14150, 15397, 14099, 15394, 14048, 15391, 14000,
+		15387, 13951, 15385, 13907, 15381, 13861, 15377, 13816, 15374, 13773, 15371, 13735, 15367, 13693, 15363, 13654,
+		15359, 13616, 15351, 13579, 15344, 13543, 15336, 13509, 15328, 13473, 15320, 13440, 15311, 13407, 15303, 13376,
+		15295, 13346, 15286, 13315, 15278, 13262, 15269, 13204, 15260, 13149, 15253, 13098, 15243, 13043, 15234, 12992,
+		15225, 12942, 15215, 12893, 15207, 12848, 15199, 12803, 15188, 12755, 15179, 12712, 15170, 12672, 15160, 12630,
+		15151, 12589, 15141, 12551, 15132, 12514, 15122, 12476, 15112, 12440, 15103, 12406, 15094, 12372, 15084, 12338,
+		15074, 12306, 15064, 12261, 15055, 12200, 15045, 12140, 15035, 12083, 15025, 12026, 15015, 11972, 15005, 11919,
+		14995, 11867, 14985, 11816, 14976, 11769, 14965, 11720, 14956, 11674, 14946, 11628, 14936, 11585, 14925, 11541,
+		14916, 11502, 14906, 11461, 14897, 11423, 14886, 11383, 14877, 11348, 14868, 11313, 14857, 11276, 14847, 11221,
+		14837, 11157, 14827, 11092, 14818, 11034, 14808, 10971, 14799, 10913, 14789, 10856, 14780, 10804, 14770, 10748,
+		14761, 10698, 14750, 10646, 14741, 10598, 14732, 10552, 14723, 10507, 14713, 10461, 14704, 10419, 14695, 10376,
+		14686, 10337, 14676, 10296, 14667, 10260, 14658, 10205, 14649, 10134, 14639, 10064, 14631, 9998, 14622, 9933,
+		14613, 9871, 14604, 9809, 14595, 9748, 14586, 9695, 14577, 9637, 14569, 9585, 14560, 9534, 14552, 9484,
+		14544, 9438, 14534, 9388, 14526, 9343, 14518, 9300, 14509, 9256, 14501, 9216, 14493, 9138, 14484, 9058,
+		14476, 8987, 14468, 8915, 14459, 8844, 14452, 8781, 14444, 8717, 14436, 8653, 14428, 8594, 14420, 8538,
+		14412, 8481, 14405, 8427, 14398, 8380, 14390, 8327, 14382, 8276, 14375, 8233, 14367, 8184, 14360, 8096,
+		14352, 8010, 14344, 7929, 14338, 7857, 14326, 7788, 14311, 7714, 14297, 7643, 14283, 7578, 14269, 7512,
+		14255, 7451, 14241, 7395, 14227, 7337, 14213, 7282, 14200, 7231, 14187, 7181, 14174, 7099, 14160, 7003,
+		14147, 6916, 14135, 6835, 14122, 6748, 14109, 6672, 14097, 6597, 14084, 6525, 14072, 6460, 14059, 6390,
+		14047, 6327, 14035, 6265, 14023, 6207, 14011, 6154, 13999, 6053, 13987, 5953, 13975, 5856, 13963, 5761,
+		13951, 5667, 13941, 5593, 13929, 5507, 13919, 5433, 13907, 5355, 13896, 5288, 13884, 5216, 13874, 5157,
+		13862, 5062, 13852, 4951, 13842, 4841, 13832, 4741, 13821, 4634, 13811, 4543, 13801, 4453, 13790, 4364,
+		13780, 4281, 13770, 4204, 13761, 4137, 13750, 4028, 13741, 3895, 13731, 3779, 13721, 3651, 13712, 3545,
+		13702, 3436, 13693, 3336, 13684, 3248, 13674, 3152, 13665, 3064, 13657, 2918, 13648, 2763, 13638, 2614,
+		13630, 2486, 13620, 2358, 13612, 2244, 13603, 2135, 13595, 2023, 13586, 1824, 13578, 1644, 13569, 1475,
+		13561, 1326, 13553, 1174, 13545, 1042, 13536, 910, 13529, 800, 13521, 700, 13513, 594, 13505, 502,
+		15417, 17539, 15419, 17245, 15421, 17009, 15422, 16838, 15424, 16708, 15426, 16610, 15427, 16521, 15427, 16447,
+		15429, 16388, 15430, 16276, 15430, 16175, 15431, 16086, 15432, 16004, 15432, 15929, 15433, 15863, 15433, 15799,
+		15434, 15742, 15434, 15689, 15434, 15637, 15434, 15587, 15434, 15542, 15433, 15498, 15434, 15460, 15434, 15423,
+		15433, 15385, 15433, 15344, 15432, 15276, 15432, 15215, 15431, 15155, 15430, 15098, 15429, 15044, 15428, 14990,
+		15427, 14940, 15426, 14890, 15425, 14848, 15424, 14801, 15422, 14756, 15420, 14713, 15419, 14674, 15417, 14636,
+		15415, 14597, 15413, 14560, 15411, 14524, 15408, 14488, 15406, 14457, 15404, 14425, 15402, 14395, 15399, 14363,
+		15397, 14332, 15394, 14276, 15392, 14220, 15389, 14168, 15386, 14115, 15383, 14065, 15380, 14015, 15377, 13968,
+		15374, 13922, 15371, 13877, 15368, 13833, 15364, 13789, 15361, 13747, 15354, 13706, 15348, 13670, 15340, 13629,
+		15333, 13593, 15325, 13555, 15318, 13521, 15310, 13486, 15303, 13455, 15295, 13421, 15287, 13389, 15280, 13359,
+		15270, 13327, 15263, 13286, 15254, 13227, 15246, 13172, 15238, 13120, 15229, 13066, 15221, 13017, 15212, 12965,
+		15203, 12916, 15194, 12870, 15185, 12822, 15176, 12778, 15169, 12737, 15159, 12694, 15149, 12651, 15140, 12611,
+		15131, 12571, 15122, 12534, 15112, 12497, 15103, 12460, 15093, 12424, 15085, 12391, 15075, 12357, 15065, 12324,
+		15056, 12293, 15047, 12238, 15037, 12177, 15027, 12117, 15018, 12061, 15008, 12006, 14998, 11951, 14989, 11900,
+		14979, 11849, 14970, 11800, 14960, 11752, 14950, 11703, 14940, 11658, 14931, 11615, 14921, 11571, 14911, 11530,
+		14902, 11490, 14892, 11449, 14883, 11412, 14873, 11374, 14864, 11338, 14854, 11302, 14844, 11268, 14835, 11209,
+		14825, 11141, 14816, 11079, 14806, 11019, 14797, 10958, 14788, 10903, 14778, 10845, 14769, 10792, 14759, 10738,
+		14750, 10689, 14741, 10639, 14732, 10591, 14722, 10543, 14713, 10501, 14704, 10455, 14695, 10414, 14685, 10371,
+		14677, 10333, 14667, 10292, 14658, 10255, 14649, 10195, 14640, 10128, 14631, 10058, 14623, 9992, 14613, 9926,
+		14605, 9865, 14596, 9803, 14588, 9748, 14579, 9690, 14570, 9633, 14562, 9584, 14554, 9531, 14545, 9480,
+		14537, 9433, 14528, 9387, 14521, 9345, 14512, 9299, 14503, 9257, 14495, 9217, 14487, 9135, 14479, 9061,
+		14471, 8991, 14463, 8916, 14455, 8851, 14447, 8785, 14439, 8718, 14432, 8657, 14424, 8599, 14416, 8539,
+		14409, 8485, 14401, 8432, 14394, 8382, 14386, 8329, 14378, 8283, 14371, 8237, 14364, 8191, 14357, 8107,
+		14349, 8023, 14342, 7948, 14334, 7866, 14318, 7786, 14304, 7716, 14291, 7653, 14278, 7588, 14263, 7521,
+		14250, 7461, 14236, 7403, 14223, 7345, 14209, 7292, 14196, 7238, 14183, 7189, 14170, 7116, 14157, 7020,
+		14145, 6935, 14132, 6847, 14119, 6765, 14106, 6688, 14093, 6606, 14081, 6536, 14068, 6468, 14056, 6401,
+		14044, 6338, 14032, 6276, 14020, 6220, 14008, 6161, 13996, 6071, 13985, 5975, 13973, 5876, 13962, 5784,
+		13950, 5692, 13939, 5607, 13928, 5521, 13917, 5447, 13906, 5369, 13895, 5302, 13884, 5234, 13874, 5175,
+		13863, 5094, 13852, 4982, 13842, 4863, 13832, 4764, 13821, 4661, 13810, 4562, 13800, 4469, 13790, 4385,
+		13780, 4301, 13770, 4223, 13760, 4150, 13750, 4056, 13741, 3931, 13731, 3794, 13722, 3674, 13712, 3564,
+		13703, 3457, 13693, 3358, 13684, 3259, 13675, 3173, 13666, 3088, 13656, 2929, 13648, 2784, 13640, 2654,
+		13631, 2515, 13622, 2390, 13613, 2264, 13605, 2157, 13596, 2054, 13588, 1864, 13580, 1680, 13571, 1515,
+		13563, 1353, 13555, 1205, 13547, 1062, 13539, 936, 13531, 819, 13523, 711, 13515, 607, 13507, 513,
+		15406, 17512, 15408, 17208, 15410, 16975, 15411, 16805, 15412, 16678, 15413, 16581, 15415, 16496, 15415, 16424,
+		15416, 16341, 15418, 16239, 15418, 16137, 15419, 16049, 15420, 15971, 15420, 15899, 15420, 15830, 15421, 15770,
+		15421, 15712, 15420, 15657, 15421, 15608, 15421, 15562, 15421, 15520, 15421, 15476, 15421, 15437, 15421, 15402,
+		15420, 15364, 15419, 15298, 15419, 15240, 15418, 15175, 15417, 15117, 15416, 15060, 15415, 15006, 15415, 14958,
+		15413, 14906, 15412, 14858, 15411, 14813, 15409, 14768, 15407, 14726, 15407, 14687, 15405, 14647, 15403, 14607,
+		15401, 14572, 15399, 14535, 15397, 14501, 15395, 14468, 15392, 14433, 15390, 14404, 15388, 14373, 15386, 14344,
+		15383, 14294, 15381, 14237, 15378, 14183, 15375, 14131, 15373, 14080, 15370, 14031, 15367, 13983, 15364, 13937,
+		15361, 13891, 15356, 13847, 15348, 13803, 15342, 13762, 15335, 13721, 15329, 13682, 15321, 13641, 15316, 13607,
+		15308, 13569, 15300, 13534, 15293, 13499, 15286, 13466, 15278, 13433, 15271, 13401, 15264, 13371, 15255, 13341,
+		15247, 13311, 15239, 13253, 15232, 13199, 15223, 13143, 15215, 13090, 15207, 13039, 15198, 12989, 15190, 12939,
+		15182, 12893, 15173, 12845, 15165, 12801, 15156, 12758, 15146, 12712, 15138, 12673, 15131, 12635, 15120, 12592,
+		15110, 12552, 15102, 12517, 15093, 12479, 15084, 12444, 15075, 12409, 15066, 12376, 15057, 12343, 15047, 12310,
+		15038, 12272, 15029, 12213, 15020, 12153, 15010, 12095, 15001, 12041, 14991, 11986, 14982, 11932, 14973, 11881,
+		14963, 11830, 14954, 11782, 14945, 11737, 14935, 11690, 14925, 11645, 14917, 11602, 14907, 11558, 14897, 11517,
+		14888, 11478, 14878, 11438, 14870, 11402, 14860, 11363, 14850, 11328, 14841, 11294, 14832, 11257, 14823, 11191,
+		14812, 11124, 14804, 11064, 14795, 11005, 14785, 10946, 14776, 10891, 14767, 10834, 14758, 10782, 14749, 10729,
+		14740, 10680, 14730, 10629, 14722, 10584, 14712, 10536, 14703, 10492, 14694, 10447, 14685, 10407, 14676, 10365,
+		14668, 10327, 14658, 10287, 14650, 10252, 14640, 10186, 14632, 10120, 14623, 10048, 14615, 9986, 14606, 9921,
+		14597, 9860, 14588, 9799, 14580, 9743, 14572, 9685, 14564, 9633, 14555, 9581, 14546, 9527, 14539, 9480,
+		14530, 9432, 14522, 9385, 14514, 9341, 14505, 9297, 14498, 9257, 14490, 9215, 14482, 9138, 14474, 9064,
+		14466, 8990, 14458, 8919, 14450, 8852, 14443, 8786, 14435, 8723, 14427, 8662, 14420, 8601, 14412, 8544,
+		14404, 8490, 14397, 8435, 14389, 8382, 14382, 8334, 14375, 8285, 14367, 8239, 14360, 8196, 14353, 8117,
+		14346, 8028, 14338, 7947, 14328, 7875, 14314, 7804, 14300, 7733, 14285, 7658, 14271, 7591, 14258, 7528,
+		14245, 7470, 14232, 7412, 14218, 7353, 14205, 7299, 14192, 7247, 14179, 7196, 14166, 7125, 14153, 7034,
+		14141, 6947, 14128, 6860, 14116, 6780, 14103, 6699, 14090, 6622, 14078, 6553, 14066, 6481, 14054, 6415,
+		14042, 6351, 14030, 6291, 14018, 6231, 14006, 6172, 13995, 6102, 13983, 5994, 13972, 5899, 13961, 5801,
+		13949, 5709, 13939, 5627, 13927, 5540, 13916, 5466, 13905, 5388, 13895, 5322, 13883, 5248, 13873, 5185,
+		13863, 5123, 13852, 5006, 13841, 4894, 13831, 4788, 13820, 4677, 13810, 4585, 13800, 4493, 13790, 4402,
+		13780, 4321, 13770, 4241, 13760, 4164, 13751, 4097, 13742, 3961, 13732, 3828, 13723, 3715, 13713, 3592,
+		13704, 3483, 13695, 3380, 13686, 3283, 13677, 3196, 13667, 3101, 13659, 2984, 13650, 2835, 13641, 2673,
+		13632, 2535, 13623, 2408, 13615, 2295, 13606, 2184, 13598, 2071, 13589, 1895, 13581, 1717, 13573, 1551,
+		13565, 1376, 13557, 1234, 13548, 1086, 13541, 958, 13533, 836, 13525, 726, 13517, 623, 13509, 525,
+		15396, 17487, 15397, 17168, 15399, 16938, 15400, 16776, 15401, 16653, 15402, 16553, 15403, 16474, 15404, 16403,
+		15405, 16298, 15405, 16190, 15406, 16100, 15407, 16015, 15407, 15937, 15408, 15867, 15408, 15800, 15408, 15739,
+		15408, 15683, 15408, 15630, 15408, 15582, 15408, 15537, 15408, 15494, 15408, 15454, 15407, 15414, 15407, 15377,
+		15406, 15328, 15406, 15260, 15405, 15200, 15404, 15136, 15403, 15079, 15403, 15026, 15402, 14974, 15401, 14923,
+		15399, 14874, 15398, 14827, 15396, 14781, 15395, 14739, 15394, 14698, 15392, 14657, 15390, 14619, 15389, 14581,
+		15387, 14545, 15385, 14511, 15383, 14477, 15381, 14444, 15379, 14413, 15377, 14381, 15374, 14352, 15372, 14310,
+		15370, 14254, 15367, 14200, 15365, 14147, 15362, 14097, 15359, 14048, 15353, 13999, 15348, 13952, 15341, 13905,
+		15335, 13862, 15329, 13818, 15323, 13777, 15316, 13735, 15310, 13695, 15303, 13656, 15297, 13619, 15289, 13582,
+		15283, 13548, 15276, 13512, 15268, 13478, 15261, 13445, 15254, 13413, 15247, 13383, 15239, 13351, 15232, 13324,
+		15224, 13275, 15217, 13223, 15209, 13166, 15201, 13113, 15193, 13061, 15185, 13011, 15177, 12962, 15168, 12913,
+		15160, 12867, 15153, 12824, 15144, 12779, 15135, 12734, 15126, 12693, 15117, 12651, 15108, 12610, 15101, 12575,
+		15092, 12536, 15083, 12498, 15074, 12464, 15065, 12427, 15056, 12394, 15048, 12362, 15038, 12329, 15029, 12297,
+		15021, 12249, 15011, 12186, 15002, 12128, 14993, 12072, 14984, 12019, 14975, 11964, 14966, 11914, 14957, 11862,
+		14948, 11813, 14938, 11766, 14929, 11719, 14920, 11674, 14911, 11630, 14902, 11587, 14893, 11546, 14884, 11506,
+		14874, 11466, 14865, 11427, 14856, 11389, 14847, 11354, 14838, 11319, 14828, 11284, 14819, 11237, 14811, 11175,
+		14801, 11111, 14792, 11051, 14783, 10991, 14774, 10933, 14765, 10879, 14756, 10822, 14747, 10771, 14738, 10718,
+		14729, 10670, 14720, 10620, 14712, 10576, 14702, 10528, 14694, 10487, 14685, 10442, 14676, 10401, 14667, 10359,
+		14658, 10321, 14649, 10282, 14641, 10247, 14633, 10181, 14624, 10113, 14615, 10042, 14607, 9980, 14598, 9916,
+		14590, 9856, 14582, 9796, 14574, 9739, 14565, 9682, 14557, 9629, 14549, 9578, 14540, 9526, 14532, 9478,
+		14523, 9428, 14516, 9384, 14508, 9341, 14500, 9298, 14492, 9257, 14483, 9211, 14476, 9137, 14468, 9061,
+		14460, 8988, 14453, 8920, 14445, 8851, 14437, 8784, 14430, 8725, 14423, 8663, 14415, 8606, 14407, 8545,
+		14400, 8492, 14393, 8439, 14386, 8391, 14378, 8338, 14371, 8290, 14364, 8245, 14357, 8201, 14349, 8120,
+		14342, 8035, 14335, 7959, 14322, 7883, 14307, 7805, 14294, 7734, 14280, 7669, 14268, 7607, 14253, 7537,
+		14240, 7477, 14227, 7416, 14214, 7361, 14201, 7308, 14188, 7254, 14175, 7203, 14162, 7143, 14149, 7046,
+		14136, 6958, 14124, 6875, 14111, 6789, 14099, 6710, 14088, 6642, 14075, 6563, 14063, 6492, 14051, 6427,
+		14040, 6363, 14028, 6302, 14016, 6241, 14005, 6185, 13993, 6119, 13981, 6010, 13970, 5914, 13959, 5818,
+		13948, 5732, 13937, 5647, 13926, 5559, 13915, 5481, 13904, 5404, 13893, 5334, 13883, 5263, 13872, 5200,
+		13861, 5134, 13851, 5027, 13841, 4920, 13831, 4814, 13820, 4706, 13811, 4610, 13801, 4513, 13791, 4424,
+		13781, 4341, 13771, 4261, 13761, 4184, 13752, 4114, 13742, 3988, 13733, 3861, 13723, 3738, 13714, 3619,
+		13705, 3511, 13695, 3401, 13686, 3307, 13677, 3207, 13669, 3123, 13660, 3016, 13650, 2850, 13642, 2707,
+		13634, 2573, 13625, 2440, 13616, 2318, 13608, 2205, 13599, 2096, 13591, 1926, 13583, 1750, 13575, 1571,
+		13567, 1414, 13558, 1253, 13550, 1111, 13542, 976, 13535, 856, 13527, 741, 13519, 636, 13511, 537,
+		15385, 17465, 15387, 17125, 15388, 16901, 15389, 16747, 15390, 16627, 15391, 16527, 15392, 16449, 15392, 16379,
+		15393, 16260, 15394, 16155, 15394, 16064, 15395, 15978, 15395, 15901, 15395, 15832, 15395, 15768, 15395, 15709,
+		15396, 15655, 15395, 15603, 15396, 15560, 15396, 15514, 15395, 15470, 15395, 15429, 15394, 15391, 15393, 15348,
+		15394, 15289, 15393, 15222, 15392, 15159, 15391, 15102, 15390, 15044, 15389, 14989, 15388, 14939, 15387, 14888,
+		15386, 14843, 15385, 14798, 15383, 14753, 15382, 14711, 15381, 14670, 15379, 14631, 15377, 14594, 15375, 14556,
+		15374, 14521, 15372, 14488, 15370, 14454, 15367, 14421, 15365, 14390, 15363, 14361, 15361, 14328, 15359, 14273,
+		15353, 14217, 15348, 14162, 15343, 14112, 15338, 14062, 15333, 14014, 15327, 13967, 15321, 13920, 15316, 13876,
+		15309, 13831, 15304, 13791, 15297, 13748, 15291, 13709, 15285, 13671, 15278, 13632, 15272, 13595, 15266, 13561,
+		15259, 13525, 15252, 13492, 15245, 13459, 15238, 13425, 15231, 13395, 15224, 13364, 15217, 13335, 15209, 13299,
+		15202, 13244, 15194, 13188, 15187, 13136, 15179, 13084, 15171, 13034, 15164, 12986, 15155, 12934, 15147, 12889,
+		15138, 12841, 15131, 12797, 15123, 12755, 15115, 12713, 15106, 12671, 15098, 12633, 15089, 12594, 15079, 12552,
+		15071, 12515, 15065, 12484, 15056, 12447, 15047, 12412, 15038, 12380, 15030, 12348, 15021, 12315, 15011, 12280,
+		15003, 12221, 14994, 12164, 14986, 12108, 14976, 12050, 14968, 11998, 14959, 11945, 14950, 11893, 14941, 11845,
+		14932, 11797, 14923, 11749, 14915, 11705, 14906, 11660, 14897, 11616, 14887, 11573, 14878, 11532, 14870, 11493,
+		14860, 11453, 14852, 11417, 14843, 11381, 14834, 11344, 14825, 11309, 14816, 11276, 14807, 11222, 14798, 11159,
+		14789, 11095, 14780, 11036, 14771, 10976, 14763, 10922, 14754, 10866, 14745, 10811, 14736, 10761, 14727, 10707,
+		14719, 10660, 14710, 10611, 14701, 10566, 14693, 10520, 14684, 10478, 14675, 10434, 14667, 10396, 14658, 10354,
+		14650, 10317, 14641, 10278, 14633, 10241, 14624, 10171, 14616, 10103, 14608, 10038, 14600, 9975, 14591, 9909,
+		14583, 9850, 14574, 9789, 14566, 9735, 14558, 9679, 14550, 9626, 14542, 9574, 14534, 9524, 14526, 9478,
+		14517, 9428, 14510, 9385, 14502, 9339, 14493, 9294, 14486, 9254, 14478, 9214, 14471, 9139, 14463, 9060,
+		14455, 8990, 14448, 8923, 14440, 8853, 14433, 8789, 14425, 8724, 14418, 8663, 14410, 8606, 14403, 8548,
+		14395, 8490, 14389, 8441, 14381, 8389, 14374, 8338, 14367, 8295, 14360, 8248, 14353, 8202, 14346, 8127,
+		14340, 8050, 14329, 7966, 14315, 7888, 14302, 7818, 14288, 7749, 14274, 7672, 14261, 7607, 14248, 7545,
+		14235, 7484, 14222, 7425, 14210, 7370, 14196, 7313, 14183, 7261, 14171, 7211, 14158, 7155, 14146, 7068,
+		14133, 6975, 14121, 6887, 14109, 6805, 14097, 6729, 14085, 6651, 14072, 6577, 14061, 6507, 14049, 6438,
+		14037, 6372, 14025, 6312, 14014, 6254, 14002, 6196, 13991, 6136, 13980, 6036, 13969, 5939, 13957, 5839,
+		13946, 5745, 13934, 5659, 13924, 5578, 13913, 5497, 13903, 5424, 13892, 5348, 13881, 5275, 13871, 5212,
+		13860, 5147, 13850, 5058, 13840, 4941, 13830, 4836, 13820, 4722, 13810, 4630, 13800, 4534, 13791, 4448,
+		13781, 4359, 13771, 4278, 13761, 4198, 13752, 4130, 13742, 4018, 13733, 3893, 13723, 3756, 13714, 3643,
+		13705, 3526, 13696, 3428, 13687, 3330, 13678, 3228, 13669, 3146, 13660, 3049, 13652, 2893, 13643, 2744,
+		13634, 2584, 13626, 2466, 13617, 2339, 13609, 2221, 13601, 2116, 13592, 1977, 13584, 1786, 13576, 1606,
+		13568, 1438, 13560, 1281, 13552, 1136, 13544, 998, 13537, 877, 13529, 756, 13521, 650, 13513, 549,
+		15375, 17444, 15376, 17088, 15377, 16871, 15379, 16720, 15379, 16600, 15380, 16503, 15380, 16426, 15381, 16338,
+		15382, 16223, 15382, 16118, 15383, 16028, 15383, 15943, 15383, 15870, 15384, 15804, 15383, 15741, 15384, 15683,
+		15383, 15630, 15383, 15579, 15383, 15532, 15382, 15487, 15383, 15446, 15382, 15408, 15381, 15370, 15381, 15313,
+		15380, 15244, 15380, 15182, 15379, 15120, 15379, 15066, 15378, 15010, 15377, 14957, 15375, 14908, 15374, 14859,
+		15373, 14814, 15372, 14767, 15370, 14725, 15369, 14683, 15367, 14643, 15366, 14605, 15364, 14566, 15363, 14533,
+		15361, 14499, 15357, 14463, 15354, 14432, 15349, 14400, 15345, 14370, 15341, 14341, 15336, 14286, 15331, 14232,
+		15327, 14180, 15323, 14129, 15317, 14076, 15312, 14028, 15306, 13980, 15301, 13935, 15296, 13890, 15290, 13845,
+		15285, 13804, 15278, 13761, 15273, 13723, 15266, 13682, 15261, 13646, 15255, 13609, 15248, 13572, 15242, 13537,
+		15235, 13504, 15229, 13470, 15223, 13439, 15215, 13408, 15208, 13376, 15201, 13347, 15194, 13318, 15187, 13267,
+		15179, 13211, 15171, 13156, 15164, 13105, 15157, 13054, 15150, 13005, 15142, 12956, 15135, 12912, 15126, 12864,
+		15118, 12818, 15110, 12775, 15102, 12732, 15093, 12690, 15086, 12651, 15077, 12611, 15070, 12575, 15063, 12538,
+		15053, 12500, 15044, 12463, 15036, 12429, 15029, 12398, 15020, 12364, 15011, 12332, 15002, 12300, 14994, 12254,
+		14986, 12196, 14977, 12138, 14968, 12083, 14960, 12028, 14951, 11975, 14943, 11924, 14934, 11874, 14925, 11825,
+		14917, 11778, 14908, 11731, 14899, 11688, 14890, 11643, 14882, 11601, 14873, 11559, 14865, 11520, 14856, 11481,
+		14846, 11441, 14838, 11404, 14829, 11368, 14821, 11334, 14812, 11300, 14804, 11267, 14794, 11203, 14786, 11142,
+		14777, 11081, 14769, 11021, 14760, 10964, 14751, 10906, 14743, 10853, 14734, 10801, 14725, 10748, 14716, 10696,
+		14708, 10650, 14700, 10602, 14691, 10556, 14682, 10512, 14674, 10470, 14665, 10427, 14657, 10388, 14648, 10347,
+		14641, 10310, 14632, 10273, 14624, 10233, 14616, 10162, 14607, 10095, 14599, 10030, 14591, 9966, 14582, 9902,
+		14575, 9844, 14566, 9784, 14558, 9728, 14550, 9674, 14543, 9623, 14534, 9570, 14526, 9520, 14519, 9472,
+		14511, 9425, 14503, 9382, 14496, 9336, 14488, 9296, 14481, 9254, 14473, 9211, 14465, 9135, 14458, 9061,
+		14451, 8993, 14443, 8919, 14435, 8852, 14428, 8792, 14420, 8725, 14413, 8667, 14406, 8607, 14399, 8550,
+		14392, 8498, 14384, 8444, 14377, 8390, 14370, 8342, 14363, 8295, 14356, 8249, 14349, 8204, 14342, 8133,
+		14335, 8050, 14322, 7972, 14308, 7895, 14295, 7823, 14282, 7748, 14269, 7682, 14257, 7621, 14243, 7554,
+		14229, 7490, 14215, 7428, 14203, 7374, 14191, 7320, 14178, 7270, 14166, 7218, 14153, 7166, 14141, 7076,
+		14129, 6983, 14117, 6900, 14104, 6817, 14093, 6738, 14081, 6662, 14070, 6592, 14057, 6516, 14046, 6451,
+		14034, 6384, 14022, 6321, 14011, 6263, 14000, 6207, 13989, 6153, 13977, 6058, 13966, 5950, 13955, 5857,
+		13945, 5768, 13934, 5676, 13923, 5593, 13912, 5513, 13902, 5439, 13892, 5364, 13881, 5294, 13871, 5229,
+		13860, 5160, 13850, 5089, 13840, 4966, 13830, 4862, 13819, 4743, 13810, 4652, 13800, 4551, 13790, 4464,
+		13780, 4375, 13771, 4297, 13761, 4219, 13752, 4145, 13743, 4053, 13734, 3921, 13724, 3785, 13715, 3676,
+		13706, 3556, 13697, 3457, 13688, 3348, 13679, 3259, 13671, 3163, 13662, 3080, 13653, 2928, 13644, 2768,
+		13636, 2637, 13628, 2501, 13618, 2359, 13610, 2243, 13602, 2137, 13594, 2007, 13586, 1828, 13578, 1638,
+		13570, 1468, 13561, 1301, 13554, 1168, 13546, 1019, 13538, 892, 13530, 772, 13523, 659, 13515, 561,
+		15365, 17424, 15366, 17055, 15367, 16838, 15368, 16691, 15369, 16575, 15369, 16480, 15370, 16406, 15371, 16299,
+		15371, 16186, 15371, 16085, 15371, 15991, 15372, 15912, 15372, 15842, 15372, 15773, 15372, 15712, 15372, 15656,
+		15371, 15603, 15371, 15554, 15371, 15507, 15371, 15465, 15370, 15424, 15370, 15386, 15370, 15342, 15368, 15269,
+		15367, 15202, 15368, 15147, 15367, 15085, 15366, 15028, 15365, 14975, 15364, 14924, 15362, 14874, 15361, 14827,
+		15360, 14781, 15358, 14739, 15355, 14697, 15353, 14656, 15349, 14617, 15346, 14580, 15344, 14545, 15339, 14508,
+		15335, 14474, 15331, 14441, 15327, 14409, 15324, 14380, 15320, 14350, 15316, 14306, 15312, 14252, 15307, 14197,
+		15302, 14144, 15297, 14093, 15293, 14045, 15287, 13995, 15282, 13948, 15276, 13903, 15271, 13860, 15265, 13817,
+		15260, 13776, 15255, 13736, 15248, 13695, 15243, 13659, 15237, 13621, 15231, 13586, 15225, 13550, 15219, 13517,
+		15212, 13482, 15206, 13450, 15199, 13418, 15193, 13389, 15186, 13358, 15178, 13329, 15172, 13289, 15164, 13232,
+		15157, 13179, 15150, 13126, 15143, 13075, 15135, 13025, 15127, 12975, 15120, 12929, 15113, 12884, 15106, 12839,
+		15098, 12796, 15089, 12751, 15082, 12711, 15075, 12671, 15066, 12629, 15059, 12593, 15051, 12555, 15042, 12517,
+		15035, 12483, 15028, 12450, 15018, 12413, 15009, 12380, 15002, 12350, 14994, 12319, 14986, 12288, 14977, 12228,
+		14969, 12171, 14960, 12114, 14952, 12060, 14944, 12007, 14936, 11957, 14927, 11906, 14918, 11855, 14910, 11808,
+		14901, 11760, 14893, 11715, 14885, 11672, 14876, 11627, 14867, 11586, 14859, 11545, 14850, 11504, 14841, 11466,
+		14833, 11430, 14825, 11393, 14816, 11358, 14808, 11323, 14799, 11289, 14790, 11247, 14782, 11184, 14774, 11126,
+		14765, 11065, 14757, 11007, 14748, 10949, 14739, 10893, 14731, 10839, 14723, 10789, 14714, 10737, 14706, 10689,
+		14698, 10642, 14689, 10592, 14681, 10548, 14672, 10504, 14664, 10461, 14656, 10421, 14648, 10381, 14640, 10341,
+		14631, 10303, 14624, 10268, 14615, 10223, 14607, 10152, 14599, 10086, 14591, 10021, 14583, 9957, 14575, 9897,
+		14567, 9836, 14559, 9779, 14551, 9722, 14543, 9669, 14536, 9618, 14528, 9566, 14520, 9518, 14512, 9468,
+		14505, 9422, 14497, 9378, 14489, 9333, 14482, 9294, 14474, 9252, 14467, 9212, 14459, 9134, 14452, 9059,
+		14444, 8988, 14437, 8919, 14430, 8855, 14423, 8790, 14416, 8727, 14409, 8668, 14401, 8607, 14394, 8553,
+		14388, 8500, 14380, 8445, 14373, 8395, 14367, 8347, 14359, 8297, 14353, 8253, 14346, 8210, 14339, 8138,
+		14328, 8056, 14316, 7979, 14302, 7902, 14288, 7821, 14275, 7755, 14263, 7690, 14249, 7620, 14237, 7558,
+		14225, 7504, 14212, 7442, 14199, 7384, 14185, 7326, 14173, 7272, 14161, 7224, 14150, 7177, 14137, 7089,
+		14125, 6996, 14113, 6912, 14101, 6830, 14089, 6747, 14078, 6677, 14065, 6599, 14054, 6531, 14043, 6463,
+		14031, 6395, 14019, 6332, 14008, 6272, 13997, 6216, 13986, 6161, 13974, 6070, 13964, 5973, 13953, 5876,
+		13943, 5782, 13931, 5691, 13921, 5612, 13910, 5525, 13900, 5452, 13889, 5375, 13879, 5308, 13869, 5241,
+		13859, 5176, 13849, 5109, 13838, 4986, 13829, 4887, 13819, 4771, 13810, 4674, 13799, 4573, 13790, 4484,
+		13780, 4393, 13770, 4312, 13762, 4237, 13752, 4160, 13742, 4078, 13734, 3950, 13724, 3818, 13716, 3701,
+		13706, 3579, 13697, 3470, 13688, 3367, 13679, 3270, 13670, 3179, 13662, 3095, 13653, 2940, 13644, 2795,
+		13636, 2652, 13627, 2506, 13619, 2390, 13612, 2271, 13604, 2160, 13595, 2048, 13587, 1851, 13579, 1668,
+		13571, 1493, 13563, 1323, 13555, 1178, 13548, 1040, 13540, 911, 13532, 790, 13525, 676, 13517, 573,
+		15351, 17400, 15353, 17023, 15354, 16811, 15355, 16661, 15356, 16549, 15358, 16460, 15358, 16384, 15360, 16260,
+		15360, 16147, 15360, 16052, 15361, 15963, 15361, 15882, 15360, 15809, 15361, 15746, 15361, 15685, 15361, 15630,
+		15359, 15576, 15359, 15529, 15358, 15483, 15358, 15443, 15358, 15404, 15356, 15363, 15354, 15299, 15353, 15232,
+		15351, 15169, 15350, 15107, 15350, 15053, 15347, 14994, 15346, 14944, 15343, 14892, 15340, 14844, 15338, 14799,
+		15335, 14752, 15334, 14712, 15331, 14670, 15327, 14630, 15324, 14591, 15321, 14555, 15317, 14519, 15314, 14485,
+		15311, 14453, 15306, 14419, 15303, 14389, 15299, 14359, 15295, 14324, 15291, 14268, 15286, 14212, 15282, 14162,
+		15277, 14109, 15273, 14060, 15267, 14010, 15263, 13965, 15258, 13921, 15252, 13874, 15247, 13832, 15242, 13789,
+		15236, 13747, 15231, 13709, 15226, 13672, 15219, 13633, 15214, 13598, 15208, 13562, 15202, 13529, 15195, 13494,
+		15190, 13462, 15182, 13429, 15176, 13400, 15170, 13369, 15163, 13340, 15156, 13311, 15150, 13255, 15143, 13202,
+		15135, 13146, 15129, 13097, 15122, 13046, 15115, 12998, 15108, 12951, 15099, 12902, 15092, 12858, 15084, 12812,
+		15077, 12770, 15070, 12730, 15062, 12688, 15055, 12650, 15048, 12611, 15039, 12572, 15031, 12535, 15024, 12501,
+		15015, 12464, 15008, 12431, 15001, 12400, 14992, 12366, 14984, 12334, 14976, 12304, 14969, 12262, 14960, 12202,
+		14952, 12146, 14944, 12090, 14936, 12037, 14927, 11984, 14919, 11933, 14911, 11883, 14903, 11836, 14895, 11789,
+		14886, 11743, 14878, 11698, 14869, 11654, 14861, 11613, 14853, 11572, 14845, 11532, 14836, 11491, 14828, 11455,
+		14820, 11417, 14811, 11381, 14803, 11347, 14795, 11313, 14786, 11280, 14778, 11230, 14769, 11167, 14761, 11105,
+		14753, 11047, 14745, 10990, 14736, 10933, 14728, 10879, 14720, 10827, 14712, 10775, 14703, 10725, 14695, 10675,
+		14687, 10629, 14679, 10583, 14671, 10539, 14663, 10496, 14655, 10454, 14646, 10412, 14638, 10373, 14630, 10335,
+		14622, 10297, 14615, 10261, 14606, 10208, 14599, 10145, 14591, 10078, 14583, 10012, 14575, 9949, 14567, 9891,
+		14559, 9830, 14551, 9773, 14544, 9716, 14536, 9665, 14528, 9610, 14521, 9563, 14513, 9512, 14506, 9466,
+		14499, 9422, 14491, 9374, 14484, 9333, 14476, 9290, 14468, 9249, 14461, 9209, 14453, 9130, 14446, 9057,
+		14439, 8988, 14432, 8916, 14425, 8853, 14417, 8785, 14410, 8726, 14403, 8667, 14396, 8608, 14390, 8555,
+		14383, 8499, 14376, 8445, 14369, 8396, 14362, 8347, 14355, 8299, 14349, 8258, 14342, 8210, 14335, 8143,
+		14322, 8064, 14309, 7985, 14295, 7905, 14283, 7837, 14269, 7763, 14255, 7689, 14243, 7628, 14230, 7564,
+		14217, 7501, 14205, 7442, 14192, 7385, 14182, 7335, 14170, 7283, 14157, 7232, 14144, 7180, 14132, 7099,
+		14121, 7012, 14109, 6925, 14097, 6838, 14085, 6763, 14073, 6683, 14061, 6607, 14050, 6540, 14039, 6470,
+		14028, 6406, 14017, 6345, 14005, 6282, 13994, 6224, 13983, 6169, 13973, 6089, 13962, 5991, 13951, 5890,
+		13940, 5797, 13930, 5712, 13920, 5628, 13908, 5542, 13898, 5470, 13888, 5389, 13878, 5321, 13868, 5252,
+		13857, 5185, 13848, 5125, 13838, 5013, 13828, 4904, 13818, 4788, 13809, 4693, 13799, 4598, 13790, 4506,
+		13780, 4414, 13771, 4330, 13761, 4251, 13751, 4172, 13742, 4103, 13733, 3971, 13724, 3851, 13715, 3718,
+		13706, 3600, 13697, 3489, 13689, 3400, 13680, 3286, 13672, 3204, 13663, 3112, 13654, 2984, 13646, 2839,
+		13637, 2681, 13629, 2554, 13621, 2414, 13612, 2288, 13604, 2176, 13597, 2072, 13588, 1882, 13580, 1696,
+		13573, 1524, 13565, 1363, 13557, 1202, 13549, 1066, 13541, 927, 13534, 807, 13526, 689, 13519, 585,
+		15333, 17367, 15333, 16989, 15335, 16779, 15335, 16634, 15337, 16528, 15337, 16436, 15338, 16348, 15339, 16220,
+		15339, 16109, 15338, 16013, 15339, 15929, 15339, 15850, 15339, 15782, 15338, 15717, 15338, 15656, 15337, 15601,
+		15336, 15552, 15336, 15505, 15336, 15463, 15334, 15419, 15333, 15380, 15332, 15328, 15331, 15260, 15331, 15197,
+		15328, 15131, 15325, 15069, 15325, 15017, 15323, 14962, 15321, 14909, 15318, 14861, 15316, 14814, 15314, 14768,
+		15311, 14724, 15309, 14683, 15306, 14644, 15302, 14603, 15300, 14566, 15297, 14530, 15292, 14495, 15289, 14462,
+		15285, 14428, 15283, 14399, 15279, 14369, 15274, 14338, 15271, 14285, 15267, 14232, 15262, 14177, 15258, 14126,
+		15253, 14075, 15248, 14025, 15244, 13979, 15238, 13931, 15234, 13889, 15229, 13846, 15223, 13802, 15218, 13762,
+		15213, 13721, 15208, 13685, 15202, 13646, 15197, 13611, 15191, 13574, 15185, 13540, 15179, 13506, 15173, 13474,
+		15166, 13441, 15161, 13411, 15153, 13378, 15147, 13349, 15141, 13322, 15134, 13275, 15128, 13220, 15120, 13166,
+		15115, 13118, 15107, 13065, 15101, 13017, 15094, 12970, 15087, 12923, 15079, 12878, 15072, 12832, 15065, 12789,
+		15057, 12748, 15049, 12705, 15043, 12668, 15036, 12628, 15028, 12590, 15021, 12553, 15013, 12518, 15005, 12481,
+		14998, 12448, 14990, 12415, 14982, 12382, 14975, 12351, 14968, 12322, 14959, 12291, 14951, 12233, 14943, 12175,
+		14936, 12122, 14928, 12069, 14920, 12015, 14911, 11962, 14903, 11913, 14895, 11863, 14887, 11816, 14879, 11771,
+		14871, 11725, 14863, 11681, 14855, 11639, 14846, 11596, 14839, 11558, 14831, 11517, 14822, 11478, 14814, 11442,
+		14806, 11404, 14798, 11370, 14790, 11335, 14781, 11301, 14773, 11269, 14765, 11212, 14757, 11148, 14749, 11090,
+		14742, 11033, 14733, 10974, 14725, 10920, 14717, 10865, 14709, 10812, 14701, 10763, 14693, 10712, 14685, 10666,
+		14677, 10620, 14669, 10573, 14661, 10529, 14653, 10486, 14645, 10446, 14637, 10405, 14629, 10366, 14621, 10328,
+		14613, 10289, 14606, 10256, 14598, 10199, 14590, 10133, 14582, 10066, 14574, 10004, 14567, 9940, 14560, 9884,
+		14552, 9823, 14544, 9767, 14536, 9712, 14529, 9658, 14522, 9608, 14514, 9557, 14507, 9510, 14499, 9462,
+		14492, 9416, 14484, 9372, 14477, 9331, 14470, 9288, 14462, 9250, 14455, 9204, 14447, 9125, 14441, 9056,
+		14434, 8984, 14427, 8917, 14419, 8851, 14412, 8788, 14406, 8727, 14399, 8666, 14392, 8608, 14385, 8553,
+		14378, 8497, 14372, 8450, 14365, 8397, 14357, 8346, 14351, 8301, 14344, 8255, 14338, 8212, 14327, 8150,
+		14313, 8064, 14300, 7984, 14288, 7912, 14276, 7841, 14262, 7767, 14250, 7700, 14238, 7637, 14225, 7569,
+		14213, 7509, 14201, 7453, 14189, 7394, 14176, 7337, 14163, 7282, 14151, 7233, 14140, 7188, 14129, 7117,
+		14116, 7023, 14104, 6935, 14092, 6851, 14081, 6772, 14070, 6695, 14058, 6619, 14047, 6551, 14035, 6480,
+		14025, 6419, 14013, 6352, 14003, 6293, 13992, 6236, 13981, 6180, 13970, 6111, 13959, 6008, 13949, 5906,
+		13938, 5816, 13927, 5726, 13917, 5638, 13907, 5558, 13897, 5482, 13887, 5405, 13876, 5335, 13867, 5266,
+		13857, 5202, 13847, 5139, 13837, 5030, 13827, 4924, 13817, 4812, 13807, 4712, 13797, 4608, 13789, 4520,
+		13779, 4430, 13769, 4344, 13761, 4268, 13751, 4188, 13742, 4118, 13733, 3996, 13725, 3873, 13715, 3743,
+		13707, 3633, 13698, 3518, 13689, 3412, 13681, 3312, 13672, 3221, 13663, 3125, 13655, 3023, 13646, 2856,
+		13638, 2719, 13630, 2564, 13622, 2435, 13614, 2320, 13606, 2202, 13597, 2085, 13590, 1926, 13582, 1733,
+		13574, 1551, 13566, 1384, 13558, 1225, 13551, 1083, 13543, 945, 13535, 818, 13528, 702, 13520, 597,
+		15314, 17329, 15315, 16957, 15315, 16750, 15316, 16610, 15317, 16504, 15318, 16417, 15318, 16310, 15318, 16178,
+		15318, 16075, 15317, 15975, 15318, 15894, 15317, 15819, 15316, 15750, 15317, 15689, 15317, 15632, 15315, 15578,
+		15315, 15530, 15314, 15484, 15312, 15438, 15312, 15398, 15311, 15360, 15309, 15287, 15307, 15220, 15307, 15157,
+		15305, 15094, 15303, 15037, 15302, 14982, 15301, 14932, 15297, 14878, 15295, 14832, 15293, 14785, 15290, 14740,
+		15288, 14699, 15285, 14656, 15282, 14617, 15279, 14580, 15277, 14543, 15272, 14507, 15269, 14473, 15265, 14440,
+		15263, 14409, 15258, 14377, 15254, 14347, 15251, 14303, 15247, 14246, 15242, 14192, 15238, 14140, 15234, 14091,
+		15230, 14041, 15225, 13992, 15220, 13947, 15215, 13902, 15210, 13858, 15205, 13815, 15200, 13775, 15195, 13735,
+		15190, 13696, 15184, 13657, 15179, 13622, 15174, 13586, 15168, 13551, 15163, 13518, 15157, 13485, 15150, 13452,
+		15145, 13422, 15138, 13391, 15132, 13362, 15126, 13332, 15119, 13294, 15113, 13242, 15106, 13188, 15099, 13135,
+		15093, 13083, 15088, 13039, 15080, 12988, 15073, 12941, 15066, 12897, 15059, 12852, 15053, 12809, 15045, 12765,
+		15038, 12724, 15032, 12685, 15024, 12645, 15016, 12606, 15010, 12571, 15001, 12532, 14995, 12500, 14988, 12467,
+		14980, 12431, 14973, 12399, 14965, 12367, 14957, 12335, 14949, 12305, 14942, 12264, 14935, 12208, 14927, 12151,
+		14918, 12095, 14910, 12041, 14903, 11990, 14895, 11940, 14887, 11891, 14880, 11844, 14872, 11798, 14864, 11751,
+		14856, 11707, 14848, 11665, 14840, 11622, 14832, 11581, 14825, 11543, 14817, 11502, 14809, 11465, 14801, 11430,
+		14793, 11393, 14785, 11358, 14777, 11325, 14769, 11292, 14761, 11255, 14753, 11192, 14745, 11132, 14738, 11073,
+		14730, 11015, 14722, 10958, 14714, 10904, 14705, 10850, 14698, 10801, 14690, 10751, 14682, 10702, 14674, 10652,
+		14666, 10607, 14659, 10564, 14651, 10521, 14643, 10479, 14635, 10437, 14628, 10398, 14620, 10358, 14612, 10322,
+		14604, 10284, 14597, 10250, 14589, 10186, 14582, 10123, 14574, 10055, 14566, 9993, 14559, 9932, 14551, 9875,
+		14544, 9813, 14537, 9762, 14529, 9706, 14522, 9655, 14515, 9603, 14507, 9553, 14500, 9505, 14492, 9457,
+		14485, 9413, 14478, 9370, 14470, 9328, 14463, 9285, 14456, 9247, 14449, 9196, 14442, 9126, 14435, 9055,
+		14428, 8983, 14421, 8918, 14414, 8849, 14408, 8788, 14401, 8727, 14394, 8666, 14387, 8610, 14380, 8554,
+		14374, 8500, 14367, 8449, 14360, 8396, 14354, 8352, 14347, 8304, 14340, 8256, 14332, 8213, 14319, 8151,
+		14306, 8070, 14294, 7995, 14281, 7916, 14268, 7840, 14256, 7772, 14243, 7705, 14231, 7637, 14218, 7572,
+		14208, 7517, 14194, 7455, 14182, 7399, 14171, 7346, 14159, 7295, 14147, 7243, 14134, 7190, 14122, 7118,
+		14111, 7031, 14100, 6952, 14088, 6862, 14077, 6782, 14066, 6707, 14054, 6629, 14043, 6558, 14032, 6492,
+		14021, 6425, 14010, 6360, 14000, 6305, 13989, 6244, 13978, 6189, 13967, 6127, 13956, 6022, 13945, 5921,
+		13936, 5833, 13925, 5738, 13915, 5655, 13905, 5577, 13894, 5492, 13885, 5417, 13875, 5348, 13865, 5279,
+		13855, 5211, 13845, 5152, 13835, 5056, 13825, 4946, 13816, 4834, 13807, 4740, 13797, 4634, 13788, 4540,
+		13778, 4445, 13769, 4362, 13761, 4284, 13752, 4208, 13743, 4136, 13733, 4025, 13725, 3903, 13715, 3770,
+		13707, 3652, 13698, 3533, 13689, 3434, 13681, 3331, 13672, 3234, 13664, 3147, 13656, 3052, 13647, 2891,
+		13639, 2742, 13631, 2600, 13623, 2469, 13614, 2329, 13606, 2212, 13598, 2106, 13590, 1956, 13583, 1769,
+		13575, 1580, 13567, 1410, 13560, 1254, 13552, 1101, 13544, 964, 13537, 837, 13529, 717, 13522, 609,
+		15296, 17291, 15296, 16930, 15296, 16724, 15297, 16586, 15297, 16481, 15299, 16397, 15297, 16265, 15298, 16142,
+		15298, 16040, 15297, 15946, 15297, 15865, 15296, 15790, 15295, 15720, 15295, 15660, 15295, 15606, 15294, 15555,
+		15293, 15506, 15291, 15458, 15291, 15418, 15290, 15377, 15290, 15324, 15286, 15248, 15285, 15183, 15284, 15120,
+		15282, 15061, 15281, 15006, 15278, 14947, 15277, 14899, 15274, 14848, 15272, 14800, 15269, 14755, 15267, 14712,
+		15264, 14670, 15262, 14631, 15258, 14591, 15255, 14553, 15251, 14516, 15249, 14484, 15245, 14450, 15242, 14418,
+		15238, 14386, 15235, 14357, 15232, 14321, 15227, 14262, 15224, 14210, 15219, 14157, 15215, 14107, 15211, 14056,
+		15206, 14006, 15202, 13962, 15197, 13916, 15192, 13872, 15188, 13830, 15183, 13789, 15178, 13748, 15173, 13709,
+		15168, 13671, 15162, 13634, 15157, 13597, 15152, 13563, 15146, 13528, 15140, 13495, 15135, 13465, 15129, 13433,
+		15122, 13401, 15117, 13373, 15111, 13343, 15105, 13315, 15098, 13261, 15091, 13204, 15086, 13157, 15079, 13104,
+		15073, 13055, 15066, 13006, 15060, 12960, 15053, 12914, 15046, 12868, 15040, 12827, 15032, 12782, 15026, 12743,
+		15020, 12704, 15013, 12664, 15005, 12625, 14999, 12588, 14991, 12551, 14984, 12516, 14976, 12479, 14969, 12447,
+		14963, 12415, 14955, 12383, 14947, 12351, 14941, 12322, 14932, 12290, 14924, 12233, 14918, 12181, 14910, 12124,
+		14903, 12073, 14895, 12019, 14887, 11967, 14879, 11918, 14872, 11872, 14864, 11823, 14857, 11777, 14849, 11733,
+		14842, 11690, 14834, 11647, 14826, 11607, 14819, 11567, 14810, 11527, 14803, 11489, 14795, 11451, 14787, 11415,
+		14779, 11379, 14772, 11346, 14764, 11314, 14757, 11281, 14749, 11234, 14741, 11173, 14733, 11110, 14726, 11055,
+		14718, 10999, 14710, 10944, 14702, 10888, 14694, 10837, 14687, 10787, 14679, 10736, 14672, 10690, 14664, 10643,
+		14656, 10598, 14648, 10552, 14640, 10509, 14633, 10468, 14626, 10429, 14618, 10390, 14610, 10349, 14603, 10314,
+		14595, 10278, 14588, 10243, 14580, 10176, 14573, 10112, 14566, 10046, 14558, 9984, 14550, 9922, 14543, 9864,
+		14536, 9805, 14529, 9753, 14521, 9697, 14514, 9645, 14507, 9595, 14500, 9548, 14492, 9500, 14485, 9453,
+		14478, 9408, 14471, 9366, 14464, 9324, 14457, 9284, 14450, 9244, 14443, 9193, 14436, 9124, 14429, 9046,
+		14423, 8979, 14416, 8913, 14409, 8848, 14402, 8786, 14395, 8724, 14389, 8666, 14382, 8610, 14375, 8551,
+		14369, 8501, 14362, 8447, 14356, 8398, 14349, 8351, 14343, 8303, 14337, 8261, 14325, 8217, 14311, 8154,
+		14299, 8075, 14287, 7999, 14274, 7920, 14262, 7849, 14250, 7778, 14237, 7707, 14225, 7642, 14213, 7582,
+		14200, 7518, 14187, 7457, 14177, 7407, 14164, 7349, 14152, 7294, 14141, 7245, 14130, 7198, 14119, 7142,
+		14107, 7043, 14095, 6950, 14083, 6867, 14073, 6793, 14062, 6714, 14051, 6642, 14040, 6571, 14028, 6499,
+		14018, 6434, 14007, 6373, 13996, 6312, 13985, 6251, 13975, 6199, 13964, 6144, 13954, 6037, 13944, 5942,
+		13934, 5852, 13923, 5754, 13913, 5673, 13903, 5586, 13893, 5505, 13883, 5434, 13873, 5359, 13863, 5291,
+		13853, 5224, 13844, 5162, 13834, 5083, 13825, 4971, 13816, 4854, 13806, 4752, 13796, 4649, 13788, 4561,
+		13778, 4467, 13769, 4384, 13760, 4298, 13750, 4218, 13742, 4146, 13733, 4058, 13724, 3924, 13715, 3793,
+		13707, 3674, 13698, 3562, 13690, 3452, 13681, 3354, 13673, 3252, 13664, 3168, 13656, 3075, 13648, 2925,
+		13639, 2764, 13631, 2621, 13623, 2481, 13615, 2356, 13607, 2239, 13600, 2130, 13592, 1993, 13584, 1795,
+		13576, 1610, 13569, 1434, 13561, 1276, 13553, 1123, 13546, 984, 13538, 857, 13531, 736, 13524, 622,
+		15277, 17247, 15278, 16897, 15278, 16697, 15278, 16561, 15278, 16459, 15279, 16369, 15277, 16224, 15279, 16110,
+		15277, 16005, 15277, 15915, 15277, 15834, 15276, 15761, 15275, 15696, 15275, 15636, 15275, 15582, 15272, 15530,
+		15271, 15480, 15270, 15437, 15269, 15395, 15269, 15358, 15266, 15280, 15264, 15210, 15264, 15147, 15261, 15083,
+		15261, 15029, 15258, 14970, 15256, 14917, 15253, 14865, 15252, 14820, 15248, 14770, 15246, 14727, 15244, 14685,
+		15242, 14644, 15238, 14604, 15235, 14566, 15232, 14529, 15229, 14495, 15226, 14461, 15222, 14428, 15219, 14396,
+		15216, 14367, 15212, 14338, 15208, 14280, 15204, 14226, 15200, 14174, 15196, 14121, 15192, 14071, 15188, 14022,
+		15183, 13975, 15178, 13927, 15175, 13887, 15169, 13843, 15165, 13801, 15160, 13759, 15155, 13721, 15150, 13682,
+		15145, 13646, 15141, 13610, 15135, 13574, 15129, 13539, 15124, 13507, 15118, 13474, 15113, 13443, 15107, 13413,
+		15102, 13384, 15095, 13352, 15090, 13326, 15083, 13281, 15078, 13230, 15072, 13176, 15065, 13123, 15060, 13077,
+		15052, 13024, 15046, 12978, 15040, 12932, 15033, 12886, 15027, 12845, 15020, 12801, 15014, 12760, 15006, 12718,
+		14999, 12678, 14994, 12642, 14987, 12603, 14980, 12567, 14973, 12532, 14965, 12496, 14959, 12462, 14952, 12430,
+		14943, 12396, 14936, 12365, 14931, 12336, 14923, 12305, 14916, 12265, 14909, 12211, 14900, 12152, 14892, 12095,
+		14886, 12046, 14879, 11995, 14872, 11946, 14864, 11895, 14857, 11850, 14849, 11802, 14842, 11758, 14834, 11714,
+		14826, 11671, 14819, 11630, 14812, 11590, 14804, 11550, 14797, 11512, 14789, 11475, 14782, 11438, 14774, 11404,
+		14766, 11368, 14759, 11335, 14752, 11303, 14744, 11269, 14736, 11214, 14728, 11151, 14721, 11094, 14714, 11038,
+		14706, 10980, 14698, 10927, 14691, 10875, 14683, 10821, 14676, 10772, 14668, 10725, 14661, 10679, 14653, 10629,
+		14645, 10585, 14638, 10542, 14631, 10501, 14623, 10460, 14615, 10418, 14608, 10380, 14601, 10342, 14594, 10306,
+		14586, 10269, 14579, 10233, 14571, 10163, 14564, 10099, 14557, 10034, 14550, 9974, 14542, 9912, 14536, 9857,
+		14529, 9802, 14522, 9747, 14514, 9690, 14507, 9641, 14499, 9589, 14492, 9541, 14485, 9492, 14478, 9450,
+		14472, 9405, 14465, 9362, 14458, 9320, 14451, 9281, 14444, 9240, 14437, 9190, 14431, 9118, 14423, 9042,
+		14417, 8977, 14410, 8908, 14403, 8844, 14397, 8782, 14390, 8720, 14383, 8664, 14377, 8606, 14370, 8553,
+		14364, 8500, 14357, 8446, 14351, 8399, 14344, 8348, 14338, 8302, 14328, 8259, 14316, 8215, 14304, 8159,
+		14291, 8078, 14278, 7995, 14266, 7923, 14255, 7853, 14242, 7780, 14231, 7715, 14218, 7650, 14205, 7584,
+		14194, 7523, 14183, 7467, 14171, 7410, 14158, 7352, 14147, 7300, 14136, 7252, 14124, 7199, 14113, 7136,
+		14102, 7051, 14092, 6974, 14080, 6886, 14068, 6798, 14057, 6721, 14046, 6650, 14035, 6577, 14024, 6510,
+		14014, 6444, 14003, 6378, 13992, 6318, 13982, 6262, 13972, 6207, 13961, 6150, 13951, 6055, 13941, 5960,
+		13930, 5858, 13921, 5772, 13911, 5689, 13900, 5599, 13891, 5523, 13881, 5446, 13871, 5369, 13861, 5303,
+		13852, 5236, 13842, 5172, 13833, 5106, 13823, 4989, 13814, 4872, 13805, 4774, 13795, 4669, 13786, 4571,
+		13777, 4482, 13768, 4394, 13759, 4315, 13750, 4233, 13742, 4161, 13733, 4086, 13724, 3945, 13715, 3818,
+		13706, 3695, 13698, 3589, 13689, 3463, 13681, 3373, 13672, 3271, 13664, 3179, 13656, 3092, 13648, 2947,
+		13640, 2793, 13632, 2653, 13624, 2513, 13616, 2386, 13608, 2253, 13600, 2142, 13592, 2025, 13585, 1824,
+		13577, 1633, 13569, 1462, 13562, 1293, 13554, 1143, 13547, 1003, 13540, 874, 13532, 747, 13525, 634,
+		15259, 17204, 15260, 16865, 15260, 16672, 15260, 16539, 15260, 16438, 15260, 16329, 15258, 16186, 15259, 16075,
+		15258, 15972, 15258, 15887, 15258, 15807, 15256, 15736, 15255, 15669, 15255, 15611, 15254, 15557, 15251, 15506,
+		15250, 15459, 15250, 15417, 15248, 15376, 15247, 15316, 15244, 15240, 15243, 15175, 15242, 15112, 15240, 15050,
+		15238, 14992, 15236, 14936, 15235, 14889, 15231, 14834, 15228, 14785, 15227, 14743, 15224, 14700, 15221, 14657,
+		15218, 14617, 15215, 14578, 15213, 14542, 15210, 14506, 15206, 14472, 15203, 14439, 15200, 14408, 15197, 14377,
+		15194, 14347, 15190, 14299, 15186, 14245, 15182, 14190, 15178, 14138, 15174, 14088, 15169, 14036, 15166, 13991,
+		15161, 13943, 15157, 13902, 15152, 13856, 15148, 13816, 15143, 13773, 15138, 13733, 15133, 13694, 15129, 13658,
+		15123, 13621, 15119, 13586, 15114, 13551, 15108, 13518, 15102, 13484, 15097, 13454, 15091, 13422, 15086, 13393,
+		15080, 13362, 15075, 13335, 15068, 13299, 15063, 13248, 15057, 13195, 15051, 13143, 15046, 13094, 15039, 13044,
+		15033, 12999, 15027, 12951, 15021, 12906, 15015, 12863, 15008, 12818, 15002, 12778, 14995, 12736, 14989, 12697,
+		14982, 12659, 14975, 12619, 14969, 12585, 14962, 12548, 14954, 12511, 14949, 12480, 14941, 12445, 14933, 12411,
+		14927, 12382, 14920, 12349, 14913, 12320, 14906, 12291, 14899, 12237, 14891, 12180, 14885, 12129, 14878, 12076,
+		14871, 12023, 14863, 11971, 14857, 11924, 14850, 11877, 14842, 11830, 14834, 11784, 14827, 11738, 14820, 11698,
+		14813, 11656, 14805, 11613, 14798, 11575, 14790, 11535, 14783, 11498, 14775, 11461, 14768, 11425, 14761, 11390,
+		14753, 11355, 14746, 11322, 14739, 11291, 14731, 11253, 14724, 11194, 14716, 11132, 14709, 11075, 14701, 11017,
+		14694, 10962, 14687, 10910, 14679, 10859, 14672, 10809, 14665, 10760, 14657, 10709, 14650, 10664, 14642, 10618,
+		14635, 10575, 14628, 10531, 14620, 10490, 14613, 10449, 14606, 10411, 14599, 10372, 14592, 10335, 14584, 10298,
+		14577, 10262, 14570, 10217, 14562, 10148, 14556, 10087, 14549, 10024, 14542, 9963, 14535, 9906, 14527, 9846,
+		14520, 9789, 14513, 9738, 14506, 9685, 14499, 9634, 14492, 9584, 14485, 9535, 14478, 9488, 14472, 9445,
+		14465, 9398, 14458, 9358, 14451, 9316, 14445, 9276, 14438, 9238, 14431, 9186, 14424, 9111, 14418, 9041,
+		14411, 8973, 14404, 8906, 14398, 8843, 14391, 8778, 14385, 8720, 14379, 8663, 14372, 8605, 14366, 8552,
+		14359, 8497, 14353, 8447, 14347, 8400, 14340, 8350, 14333, 8306, 14319, 8259, 14307, 8216, 14295, 8160,
+		14283, 8076, 14271, 8001, 14259, 7927, 14245, 7848, 14234, 7782, 14223, 7717, 14211, 7650, 14199, 7587,
+		14188, 7530, 14176, 7468, 14164, 7412, 14154, 7360, 14143, 7308, 14131, 7254, 14119, 7206, 14108, 7157,
+		14096, 7059, 14085, 6968, 14074, 6886, 14064, 6812, 14054, 6737, 14042, 6660, 14031, 6585, 14020, 6517,
+		14010, 6450, 14000, 6390, 13989, 6328, 13979, 6268, 13969, 6213, 13958, 6159, 13948, 6068, 13937, 5967,
+		13927, 5875, 13918, 5788, 13908, 5697, 13898, 5614, 13888, 5536, 13878, 5456, 13869, 5385, 13860, 5317,
+		13850, 5250, 13840, 5183, 13831, 5121, 13822, 5005, 13813, 4900, 13803, 4790, 13793, 4684, 13785, 4595,
+		13776, 4499, 13767, 4409, 13759, 4332, 13749, 4247, 13741, 4176, 13732, 4105, 13723, 3970, 13714, 3846,
+		13706, 3716, 13698, 3607, 13689, 3488, 13681, 3389, 13673, 3292, 13665, 3195, 13657, 3112, 13648, 2973,
+		13640, 2825, 13632, 2672, 13625, 2538, 13616, 2397, 13609, 2282, 13601, 2166, 13593, 2055, 13586, 1858,
+		13578, 1663, 13570, 1489, 13563, 1321, 13556, 1167, 13548, 1024, 13541, 890, 13534, 764, 13526, 646,
+		15242, 17166, 15242, 16836, 15242, 16645, 15242, 16516, 15242, 16417, 15241, 16289, 15240, 16152, 15240, 16040,
+		15238, 15942, 15238, 15855, 15237, 15778, 15237, 15710, 15235, 15644, 15235, 15587, 15233, 15533, 15231, 15482,
+		15230, 15438, 15229, 15396, 15227, 15349, 15227, 15279, 15224, 15205, 15224, 15143, 15221, 15077, 15219, 15017,
+		15217, 14960, 15216, 14909, 15213, 14856, 15210, 14807, 15207, 14759, 15206, 14718, 15202, 14672, 15200, 14632,
+		15197, 14594, 15194, 14555, 15191, 14519, 15188, 14483, 15185, 14451, 15182, 14418, 15178, 14385, 15175, 14356,
+		15171, 14316, 15168, 14260, 15164, 14206, 15160, 14154, 15156, 14104, 15152, 14052, 15148, 14006, 15144, 13958,
+		15140, 13915, 15134, 13869, 15131, 13829, 15126, 13786, 15121, 13746, 15118, 13709, 15112, 13669, 15107, 13632,
+		15103, 13597, 15098, 13564, 15092, 13528, 15087, 13496, 15082, 13464, 15076, 13433, 15071, 13403, 15065, 13372,
+		15060, 13344, 15054, 13315, 15049, 13267, 15042, 13211, 15037, 13162, 15032, 13112, 15025, 13061, 15020, 13016,
+		15014, 12969, 15008, 12925, 15001, 12879, 14995, 12837, 14989, 12795, 14982, 12752, 14976, 12713, 14970, 12674,
+		14963, 12636, 14956, 12598, 14950, 12563, 14944, 12528, 14937, 12493, 14930, 12459, 14924, 12428, 14917, 12396,
+		14910, 12364, 14904, 12337, 14896, 12305, 14889, 12262, 14882, 12208, 14875, 12153, 14868, 12098, 14862, 12050,
+		14856, 12001, 14849, 11951, 14841, 11900, 14834, 11853, 14827, 11808, 14820, 11766, 14813, 11721, 14806, 11679,
+		14798, 11637, 14791, 11596, 14784, 11558, 14776, 11519, 14769, 11482, 14762, 11445, 14755, 11411, 14748, 11377,
+		14740, 11343, 14733, 11310, 14726, 11279, 14718, 11230, 14711, 11170, 14704, 11113, 14697, 11057, 14690, 11001,
+		14682, 10947, 14675, 10894, 14668, 10841, 14661, 10792, 14654, 10745, 14647, 10698, 14639, 10652, 14632, 10605,
+		14625, 10563, 14618, 10520, 14611, 10480, 14604, 10441, 14597, 10400, 14590, 10363, 14583, 10327, 14575, 10290,
+		14569, 10257, 14561, 10203, 14555, 10139, 14548, 10076, 14540, 10012, 14534, 9954, 14526, 9895, 14519, 9837,
+		14512, 9782, 14506, 9729, 14499, 9677, 14492, 9625, 14485, 9578, 14478, 9530, 14472, 9483, 14465, 9439,
+		14458, 9394, 14452, 9354, 14445, 9313, 14438, 9273, 14431, 9234, 14425, 9178, 14418, 9105, 14412, 9038,
+		14406, 8968, 14399, 8905, 14392, 8839, 14386, 8777, 14380, 8720, 14373, 8660, 14367, 8605, 14361, 8551,
+		14354, 8497, 14349, 8449, 14342, 8398, 14336, 8350, 14324, 8307, 14311, 8260, 14300, 8220, 14287, 8160,
+		14275, 8080, 14263, 8005, 14251, 7928, 14239, 7855, 14228, 7789, 14216, 7717, 14204, 7653, 14193, 7592,
+		14181, 7530, 14170, 7471, 14159, 7417, 14146, 7359, 14135, 7305, 14124, 7261, 14114, 7213, 14102, 7157,
+		14091, 7066, 14082, 6991, 14071, 6903, 14059, 6817, 14048, 6736, 14038, 6666, 14027, 6596, 14017, 6527,
+		14006, 6458, 13996, 6397, 13986, 6336, 13975, 6276, 13965, 6220, 13954, 6166, 13945, 6085, 13935, 5984,
+		13925, 5890, 13915, 5797, 13906, 5713, 13896, 5626, 13887, 5549, 13877, 5470, 13867, 5398, 13857, 5325,
+		13847, 5255, 13839, 5195, 13829, 5133, 13820, 5026, 13811, 4915, 13802, 4812, 13793, 4706, 13784, 4610,
+		13775, 4515, 13766, 4429, 13757, 4348, 13748, 4259, 13740, 4188, 13731, 4114, 13722, 3993, 13715, 3869,
+		13706, 3744, 13698, 3625, 13690, 3516, 13681, 3407, 13673, 3311, 13665, 3212, 13656, 3127, 13648, 3004,
+		13640, 2849, 13632, 2700, 13625, 2555, 13617, 2421, 13609, 2302, 13601, 2175, 13594, 2070, 13586, 1887,
+		13579, 1691, 13571, 1513, 13564, 1340, 13557, 1190, 13549, 1037, 13542, 903, 13535, 779, 13528, 659,
+		15225, 17129, 15225, 16813, 15224, 16619, 15225, 16494, 15224, 16396, 15223, 16247, 15222, 16118, 15221, 16008,
+		15220, 15913, 15220, 15827, 15218, 15749, 15217, 15680, 15217, 15621, 15215, 15561, 15212, 15508, 15211, 15461,
+		15210, 15417, 15209, 15375, 15207, 15310, 15204, 15235, 15204, 15171, 15202, 15104, 15200, 15042, 15198, 14984,
+		15196, 14928, 15194, 14878, 15190, 14822, 15190, 14780, 15187, 14733, 15183, 14687, 15182, 14648, 15179, 14607,
+		15175, 14568, 15174, 14533, 15170, 14495, 15166, 14461, 15163, 14428, 15160, 14398, 15158, 14367, 15153, 14336,
+		15150, 14279, 15146, 14225, 15143, 14172, 15139, 14121, 15135, 14070, 15131, 14022, 15127, 13974, 15123, 13930,
+		15118, 13883, 15114, 13843, 15109, 13799, 15105, 13759, 15101, 13720, 15096, 13681, 15092, 13646, 15087, 13610,
+		15082, 13574, 15077, 13539, 15072, 13508, 15066, 13474, 15061, 13443, 15056, 13413, 15051, 13383, 15045, 13355,
+		15040, 13326, 15035, 13287, 15028, 13230, 15024, 13182, 15017, 13128, 15012, 13080, 15006, 13033, 15000, 12985,
+		14995, 12940, 14989, 12897, 14983, 12854, 14976, 12810, 14971, 12770, 14965, 12730, 14958, 12689, 14952, 12652,
+		14946, 12615, 14939, 12577, 14933, 12542, 14926, 12508, 14919, 12474, 14913, 12442, 14906, 12410, 14899, 12378,
+		14893, 12349, 14887, 12319, 14880, 12290, 14873, 12237, 14867, 12182, 14860, 12126, 14854, 12077, 14846, 12023,
+		14839, 11971, 14833, 11926, 14827, 11883, 14819, 11833, 14812, 11788, 14805, 11744, 14798, 11701, 14791, 11661,
+		14784, 11621, 14776, 11579, 14770, 11542, 14763, 11505, 14756, 11467, 14749, 11433, 14742, 11398, 14734, 11363,
+		14727, 11330, 14720, 11298, 14713, 11267, 14706, 11208, 14699, 11152, 14692, 11093, 14685, 11038, 14678, 10982,
+		14671, 10929, 14664, 10877, 14657, 10828, 14650, 10779, 14643, 10731, 14635, 10682, 14629, 10638, 14622, 10594,
+		14615, 10552, 14608, 10509, 14601, 10469, 14594, 10430, 14587, 10391, 14580, 10354, 14573, 10318, 14566, 10283,
+		14560, 10249, 14552, 10189, 14546, 10126, 14539, 10063, 14532, 10003, 14525, 9942, 14518, 9883, 14511, 9826,
+		14505, 9774, 14497, 9718, 14491, 9669, 14484, 9616, 14478, 9570, 14471, 9522, 14465, 9481, 14458, 9433,
+		14452, 9391, 14445, 9348, 14438, 9306, 14432, 9269, 14425, 9230, 14419, 9172, 14412, 9101, 14406, 9032,
+		14399, 8960, 14393, 8900, 14387, 8833, 14381, 8775, 14374, 8713, 14368, 8656, 14362, 8604, 14356, 8548,
+		14350, 8496, 14343, 8447, 14337, 8395, 14327, 8351, 14314, 8304, 14302, 8259, 14291, 8218, 14278, 8159,
+		14267, 8087, 14255, 8006, 14243, 7928, 14232, 7858, 14220, 7789, 14209, 7722, 14198, 7660, 14186, 7593,
+		14175, 7533, 14164, 7477, 14152, 7421, 14140, 7363, 14130, 7315, 14119, 7263, 14107, 7210, 14097, 7169,
+		14086, 7076, 14075, 6984, 14064, 6898, 14054, 6826, 14045, 6755, 14034, 6678, 14023, 6600, 14012, 6531,
+		14002, 6467, 13992, 6403, 13981, 6342, 13971, 6284, 13961, 6227, 13951, 6173, 13942, 6099, 13932, 6000,
+		13922, 5904, 13912, 5809, 13903, 5723, 13892, 5635, 13883, 5557, 13874, 5479, 13864, 5406, 13854, 5334,
+		13846, 5270, 13837, 5204, 13827, 5141, 13818, 5044, 13810, 4937, 13800, 4827, 13791, 4718, 13782, 4625,
+		13774, 4534, 13765, 4442, 13757, 4360, 13748, 4278, 13740, 4203, 13731, 4128, 13722, 4016, 13714, 3890,
+		13705, 3764, 13697, 3644, 13689, 3537, 13680, 3423, 13673, 3329, 13665, 3231, 13656, 3136, 13649, 3038,
+		13641, 2871, 13633, 2732, 13625, 2577, 13618, 2450, 13609, 2314, 13602, 2204, 13595, 2088, 13587, 1909,
+		13580, 1722, 13572, 1542, 13565, 1370, 13557, 1201, 13550, 1060, 13543, 915, 13536, 790, 13529, 671,
+		15208, 17097, 15209, 16785, 15207, 16597, 15207, 16473, 15206, 16368, 15204, 16214, 15204, 16086, 15203, 15978,
+		15201, 15881, 15201, 15797, 15199, 15721, 15198, 15653, 15197, 15595, 15196, 15538, 15194, 15488, 15192, 15440,
+		15190, 15396, 15188, 15346, 15188, 15273, 15185, 15199, 15184, 15135, 15182, 15068, 15181, 15012, 15179, 14955,
+		15176, 14899, 15173, 14844, 15171, 14798, 15169, 14752, 15165, 14706, 15162, 14661, 15161, 14623, 15157, 14582,
+		15155, 14545, 15153, 14509, 15149, 14474, 15146, 14441, 15142, 14407, 15139, 14375, 15136, 14346, 15132, 14296,
+		15130, 14245, 15125, 14189, 15122, 14137, 15118, 14085, 15114, 14037, 15110, 13990, 15106, 13944, 15102, 13899,
+		15097, 13855, 15093, 13812, 15089, 13773, 15085, 13733, 15080, 13692, 15076, 13658, 15072, 13621, 15067, 13586,
+		15062, 13552, 15056, 13517, 15051, 13484, 15047, 13454, 15041, 13423, 15036, 13393, 15031, 13364, 15026, 13336,
+		15021, 13306, 15015, 13251, 15010, 13200, 15004, 13147, 14999, 13100, 14992, 13049, 14987, 13003, 14982, 12958,
+		14975, 12911, 14969, 12867, 14964, 12826, 14958, 12786, 14952, 12744, 14946, 12705, 14941, 12668, 14934, 12630,
+		14928, 12594, 14922, 12559, 14915, 12523, 14909, 12490, 14902, 12457, 14896, 12423, 14890, 12394, 14883, 12361,
+		14876, 12331, 14870, 12303, 14864, 12263, 14857, 12205, 14852, 12157, 14845, 12103, 14838, 12050, 14832, 12002,
+		14825, 11952, 14817, 11902, 14810, 11854, 14804, 11813, 14798, 11770, 14791, 11726, 14783, 11683, 14776, 11641,
+		14770, 11604, 14762, 11563, 14756, 11526, 14749, 11488, 14742, 11453, 14735, 11418, 14729, 11383, 14722, 11352,
+		14715, 11318, 14708, 11288, 14702, 11251, 14694, 11190, 14687, 11129, 14680, 11074, 14673, 11018, 14667, 10965,
+		14659, 10911, 14653, 10861, 14646, 10811, 14639, 10764, 14632, 10717, 14625, 10671, 14618, 10625, 14612, 10583,
+		14605, 10540, 14598, 10498, 14592, 10460, 14584, 10420, 14578, 10382, 14571, 10345, 14564, 10309, 14557, 10274,
+		14550, 10241, 14543, 10174, 14537, 10113, 14529, 10046, 14523, 9988, 14516, 9929, 14510, 9873, 14503, 9816,
+		14497, 9764, 14490, 9711, 14484, 9662, 14477, 9610, 14470, 9563, 14464, 9515, 14457, 9470, 14450, 9425,
+		14444, 9386, 14438, 9344, 14432, 9303, 14425, 9265, 14418, 9226, 14412, 9163, 14406, 9092, 14399, 9022,
+		14393, 8956, 14387, 8895, 14381, 8827, 14375, 8773, 14369, 8709, 14363, 8655, 14357, 8600, 14350, 8544,
+		14345, 8496, 14338, 8445, 14328, 8396, 14317, 8349, 14305, 8302, 14293, 8261, 14281, 8217, 14270, 8158,
+		14259, 8083, 14247, 8003, 14236, 7932, 14225, 7862, 14212, 7785, 14202, 7723, 14190, 7659, 14179, 7595,
+		14168, 7538, 14157, 7479, 14146, 7423, 14135, 7368, 14124, 7318, 14113, 7264, 14103, 7219, 14093, 7173,
+		14081, 7081, 14071, 7002, 14060, 6916, 14049, 6833, 14038, 6750, 14027, 6673, 14020, 6620, 14009, 6546,
+		13998, 6474, 13988, 6411, 13978, 6349, 13968, 6291, 13958, 6233, 13949, 6181, 13938, 6113, 13928, 6011,
+		13919, 5915, 13909, 5820, 13900, 5737, 13890, 5651, 13880, 5568, 13871, 5493, 13862, 5418, 13853, 5347,
+		13844, 5281, 13835, 5217, 13825, 5150, 13816, 5066, 13807, 4955, 13798, 4844, 13790, 4743, 13781, 4644,
+		13772, 4545, 13764, 4457, 13755, 4375, 13746, 4288, 13738, 4211, 13730, 4140, 13721, 4049, 13713, 3916,
+		13705, 3785, 13696, 3659, 13688, 3551, 13680, 3442, 13672, 3346, 13664, 3247, 13656, 3148, 13649, 3074,
+		13641, 2899, 13633, 2749, 13625, 2598, 13617, 2466, 13610, 2339, 13603, 2223, 13595, 2101, 13587, 1944,
+		13580, 1753, 13573, 1563, 13566, 1394, 13558, 1225, 13551, 1075, 13544, 934, 13537, 803, 13530, 684,
+		15192, 17061, 15192, 16755, 15191, 16577, 15191, 16453, 15189, 16329, 15187, 16180, 15187, 16055, 15185, 15945,
+		15183, 15849, 15183, 15770, 15181, 15697, 15180, 15629, 15179, 15571, 15179, 15519, 15174, 15466, 15173, 15420,
+		15171, 15376, 15170, 15310, 15169, 15238, 15166, 15167, 15164, 15098, 15163, 15038, 15160, 14978, 15159, 14922,
+		15156, 14869, 15153, 14816, 15151, 14771, 15147, 14720, 15145, 14679, 15143, 14638, 15140, 14596, 15137, 14558,
+		15135, 14522, 15132, 14486, 15129, 14453, 15125, 14418, 15122, 14387, 15119, 14357, 15116, 14321, 15113, 14264,
+		15108, 14206, 15105, 14155, 15101, 14100, 15098, 14053, 15094, 14005, 15089, 13957, 15085, 13912, 15081, 13868,
+		15077, 13827, 15073, 13784, 15069, 13745, 15065, 13706, 15060, 13669, 15055, 13631, 15052, 13599, 15046, 13562,
+		15042, 13530, 15036, 13496, 15032, 13465, 15026, 13433, 15022, 13404, 15017, 13374, 15011, 13345, 15006, 13318,
+		15001, 13269, 14996, 13218, 14991, 13167, 14986, 13118, 14980, 13068, 14975, 13022, 14968, 12973, 14962, 12928,
+		14958, 12887, 14951, 12842, 14945, 12800, 14940, 12761, 14934, 12721, 14928, 12682, 14922, 12644, 14916, 12609,
+		14910, 12572, 14904, 12537, 14898, 12505, 14891, 12470, 14886, 12439, 14880, 12408, 14873, 12376, 14867, 12346,
+		14861, 12318, 14854, 12286, 14848, 12233, 14842, 12180, 14835, 12124, 14829, 12075, 14823, 12025, 14816, 11975,
+		14809, 11928, 14803, 11882, 14796, 11836, 14789, 11790, 14781, 11744, 14776, 11706, 14770, 11666, 14763, 11625,
+		14755, 11584, 14749, 11546, 14743, 11510, 14736, 11474, 14729, 11438, 14723, 11404, 14716, 11371, 14709, 11337,
+		14703, 11307, 14695, 11275, 14689, 11226, 14682, 11167, 14675, 11110, 14669, 11056, 14662, 11000, 14655, 10948,
+		14648, 10894, 14641, 10844, 14635, 10796, 14628, 10748, 14621, 10702, 14615, 10657, 14608, 10612, 14601, 10570,
+		14595, 10529, 14588, 10488, 14581, 10447, 14574, 10409, 14568, 10373, 14561, 10336, 14554, 10301, 14548, 10266,
+		14541, 10227, 14534, 10159, 14528, 10097, 14521, 10033, 14515, 9979, 14508, 9917, 14502, 9863, 14495, 9805,
+		14489, 9755, 14482, 9700, 14476, 9651, 14469, 9602, 14463, 9557, 14457, 9509, 14450, 9465, 14444, 9421,
+		14438, 9380, 14431, 9337, 14425, 9299, 14419, 9259, 14413, 9224, 14406, 9159, 14400, 9089, 14394, 9019,
+		14388, 8953, 14382, 8888, 14376, 8825, 14370, 8768, 14363, 8706, 14357, 8653, 14351, 8597, 14346, 8544,
+		14340, 8493, 14331, 8442, 14320, 8397, 14308, 8347, 14296, 8303, 14285, 8260, 14273, 8216, 14262, 8162,
+		14250, 8082, 14238, 8003, 14227, 7932, 14216, 7859, 14205, 7793, 14194, 7726, 14182, 7658, 14171, 7597,
+		14160, 7536, 14150, 7481, 14139, 7426, 14128, 7372, 14118, 7318, 14107, 7268, 14096, 7221, 14085, 7172,
+		14075, 7090, 14065, 7006, 14054, 6920, 14044, 6841, 14034, 6767, 14024, 6692, 14013, 6615, 14002, 6541,
+		13993, 6478, 13984, 6421, 13974, 6355, 13964, 6298, 13954, 6240, 13944, 6186, 13934, 6121, 13925, 6022,
+		13916, 5929, 13906, 5837, 13896, 5746, 13887, 5661, 13878, 5584, 13869, 5504, 13860, 5428, 13851, 5359,
+		13842, 5292, 13832, 5225, 13823, 5162, 13814, 5085, 13806, 4973, 13797, 4859, 13789, 4757, 13780, 4662,
+		13770, 4559, 13763, 4479, 13754, 4389, 13745, 4303, 13737, 4227, 13728, 4149, 13720, 4060, 13712, 3933,
+		13704, 3807, 13696, 3682, 13688, 3577, 13680, 3461, 13672, 3360, 13664, 3267, 13656, 3168, 13648, 3083,
+		13641, 2929, 13633, 2771, 13625, 2630, 13617, 2484, 13610, 2361, 13602, 2228, 13596, 2128, 13588, 1978,
+		13581, 1774, 13573, 1590, 13566, 1416, 13559, 1249, 13552, 1093, 13545, 955, 13538, 819, 13531, 697,
+		15176, 17030, 15176, 16729, 15174, 16550, 15173, 16431, 15172, 16293, 15170, 16144, 15170, 16023, 15168, 15916,
+		15166, 15824, 15166, 15744, 15164, 15673, 15162, 15607, 15161, 15549, 15159, 15496, 15156, 15445, 15154, 15399,
+		15153, 15353, 15151, 15273, 15149, 15201, 15147, 15130, 15145, 15065, 15143, 15004, 15141, 14946, 15139, 14892,
+		15137, 14840, 15133, 14790, 15131, 14740, 15128, 14695, 15126, 14655, 15124, 14614, 15120, 14573, 15118, 14536,
+		15115, 14498, 15112, 14465, 15108, 14431, 15105, 14398, 15103, 14369, 15099, 14338, 15096, 14280, 15092, 14224,
+		15089, 14173, 15085, 14119, 15081, 14069, 15077, 14020, 15074, 13973, 15070, 13931, 15065, 13882, 15061, 13841,
+		15057, 13799, 15054, 13760, 15049, 13719, 15045, 13683, 15040, 13644, 15036, 13610, 15030, 13571, 15027, 13540,
+		15021, 13506, 15017, 13475, 15012, 13443, 15008, 13415, 15003, 13384, 14998, 13356, 14992, 13327, 14988, 13288,
+		14983, 13236, 14977, 13183, 14972, 13135, 14967, 13086, 14962, 13039, 14956, 12992, 14951, 12948, 14944, 12901,
+		14939, 12857, 14934, 12819, 14928, 12777, 14923, 12737, 14917, 12698, 14911, 12660, 14905, 12622, 14899, 12587,
+		14892, 12552, 14886, 12517, 14880, 12484, 14875, 12453, 14869, 12420, 14863, 12390, 14858, 12361, 14851, 12330,
+		14845, 12303, 14839, 12260, 14833, 12205, 14826, 12152, 14820, 12100, 14813, 12048, 14806, 11997, 14801, 11952,
+		14794, 11906, 14787, 11857, 14781, 11815, 14775, 11773, 14768, 11727, 14761, 11684, 14754, 11643, 14748, 11606,
+		14743, 11571, 14736, 11531, 14729, 11493, 14723, 11459, 14716, 11423, 14710, 11391, 14703, 11358, 14697, 11326,
+		14690, 11294, 14683, 11262, 14677, 11205, 14670, 11145, 14664, 11091, 14657, 11035, 14650, 10981, 14644, 10929,
+		14637, 10878, 14631, 10831, 14624, 10781, 14617, 10732, 14611, 10687, 14604, 10643, 14597, 10598, 14591, 10558,
+		14585, 10517, 14578, 10476, 14571, 10437, 14565, 10400, 14558, 10362, 14551, 10325, 14545, 10293, 14538, 10258,
+		14532, 10211, 14526, 10145, 14519, 10084, 14512, 10020, 14507, 9965, 14500, 9905, 14494, 9852, 14487, 9795,
+		14481, 9744, 14475, 9692, 14468, 9643, 14462, 9595, 14456, 9549, 14449, 9501, 14443, 9458, 14437, 9416,
+		14431, 9374, 14425, 9334, 14418, 9294, 14412, 9255, 14406, 9219, 14400, 9149, 14395, 9083, 14388, 9014,
+		14382, 8949, 14376, 8883, 14370, 8824, 14364, 8762, 14358, 8703, 14352, 8650, 14346, 8591, 14340, 8541,
+		14333, 8489, 14322, 8440, 14310, 8392, 14298, 8347, 14287, 8302, 14276, 8258, 14265, 8217, 14254, 8163,
+		14242, 8078, 14232, 8011, 14219, 7930, 14209, 7860, 14198, 7794, 14186, 7724, 14176, 7664, 14165, 7601,
+		14154, 7539, 14144, 7485, 14133, 7427, 14122, 7371, 14112, 7324, 14101, 7272, 14090, 7222, 14080, 7177,
+		14069, 7095, 14058, 7005, 14049, 6925, 14040, 6852, 14028, 6767, 14018, 6693, 14009, 6626, 14000, 6558,
+		13990, 6493, 13979, 6422, 13969, 6358, 13960, 6305, 13950, 6247, 13941, 6194, 13931, 6136, 13922, 6037,
+		13912, 5942, 13903, 5847, 13894, 5759, 13885, 5679, 13875, 5595, 13866, 5512, 13857, 5444, 13848, 5369,
+		13839, 5298, 13830, 5236, 13821, 5170, 13812, 5099, 13804, 4986, 13796, 4880, 13786, 4773, 13777, 4672,
+		13769, 4575, 13761, 4488, 13752, 4397, 13744, 4317, 13736, 4244, 13728, 4165, 13720, 4095, 13711, 3954,
+		13703, 3821, 13695, 3703, 13687, 3591, 13679, 3476, 13671, 3375, 13664, 3279, 13656, 3184, 13648, 3096,
+		13640, 2956, 13633, 2792, 13625, 2646, 13617, 2506, 13610, 2380, 13603, 2259, 13595, 2136, 13588, 2007,
+		13581, 1806, 13574, 1614, 13566, 1431, 13559, 1263, 13553, 1116, 13545, 971, 13538, 834, 13531, 709,
+		15160, 16998, 15159, 16698, 15158, 16532, 15157, 16412, 15156, 16258, 15153, 16109, 15153, 15991, 15151, 15887,
+		15150, 15799, 15149, 15718, 15146, 15648, 15145, 15586, 15145, 15530, 15140, 15474, 15138, 15424, 15136, 15378,
+		15135, 15317, 15134, 15240, 15130, 15165, 15129, 15096, 15127, 15034, 15124, 14973, 15122, 14914, 15120, 14863,
+		15118, 14813, 15115, 14764, 15112, 14715, 15110, 14674, 15106, 14628, 15104, 14589, 15102, 14552, 15099, 14513,
+		15095, 14477, 15092, 14443, 15089, 14410, 15086, 14378, 15083, 14348, 15080, 14301, 15076, 14244, 15072, 14189,
+		15069, 14136, 15065, 14083, 15062, 14037, 15058, 13988, 15054, 13942, 15049, 13897, 15046, 13856, 15042, 13813,
+		15038, 13772, 15034, 13732, 15029, 13693, 15025, 13654, 15021, 13621, 15016, 13585, 15012, 13551, 15006, 13515,
+		15002, 13485, 14997, 13454, 14993, 13424, 14988, 13393, 14984, 13365, 14978, 13335, 14973, 13305, 14969, 13254,
+		14964, 13201, 14959, 13151, 14953, 13103, 14948, 13054, 14943, 13008, 14938, 12963, 14932, 12917, 14927, 12876,
+		14922, 12833, 14916, 12792, 14911, 12754, 14905, 12713, 14900, 12676, 14894, 12639, 14888, 12601, 14882, 12568,
+		14876, 12531, 14870, 12498, 14865, 12467, 14858, 12434, 14853, 12402, 14847, 12372, 14840, 12342, 14835, 12314,
+		14829, 12286, 14823, 12228, 14818, 12178, 14811, 12125, 14804, 12072, 14798, 12023, 14792, 11975, 14785, 11924,
+		14779, 11881, 14773, 11836, 14766, 11791, 14760, 11748, 14754, 11709, 14748, 11669, 14742, 11629, 14735, 11587,
+		14728, 11550, 14723, 11515, 14716, 11479, 14710, 11444, 14703, 11409, 14697, 11376, 14690, 11345, 14683, 11312,
+		14678, 11283, 14671, 11240, 14664, 11179, 14658, 11125, 14651, 11068, 14645, 11012, 14639, 10962, 14632, 10910,
+		14626, 10860, 14619, 10811, 14613, 10764, 14606, 10717, 14600, 10672, 14594, 10629, 14588, 10588, 14581, 10546,
+		14574, 10503, 14568, 10465, 14561, 10426, 14555, 10389, 14549, 10353, 14542, 10317, 14536, 10285, 14529, 10249,
+		14523, 10194, 14517, 10130, 14511, 10071, 14504, 10008, 14498, 9952, 14492, 9892, 14486, 9840, 14480, 9786,
+		14473, 9734, 14467, 9683, 14461, 9635, 14455, 9587, 14448, 9540, 14442, 9495, 14436, 9451, 14430, 9408,
+		14424, 9367, 14418, 9328, 14412, 9288, 14406, 9251, 14400, 9212, 14393, 9135, 14388, 9070, 14382, 9004,
+		14376, 8940, 14370, 8876, 14364, 8815, 14358, 8754, 14352, 8700, 14347, 8643, 14341, 8590, 14334, 8538,
+		14322, 8486, 14312, 8439, 14300, 8391, 14289, 8345, 14278, 8300, 14266, 8257, 14255, 8216, 14244, 8156,
+		14233, 8078, 14223, 8005, 14210, 7927, 14201, 7865, 14189, 7792, 14179, 7726, 14168, 7662, 14157, 7600,
+		14147, 7543, 14137, 7486, 14126, 7429, 14116, 7376, 14105, 7326, 14094, 7272, 14084, 7228, 14074, 7181,
+		14063, 7097, 14054, 7018, 14044, 6934, 14033, 6847, 14023, 6772, 14014, 6702, 14004, 6628, 13994, 6557,
+		13984, 6491, 13975, 6431, 13966, 6373, 13956, 6311, 13946, 6250, 13937, 6199, 13927, 6145, 13918, 6048,
+		13908, 5951, 13899, 5858, 13890, 5774, 13881, 5684, 13871, 5603, 13863, 5525, 13854, 5454, 13845, 5376,
+		13837, 5311, 13828, 5245, 13819, 5179, 13810, 5118, 13801, 5004, 13792, 4889, 13784, 4788, 13776, 4686,
+		13767, 4593, 13759, 4502, 13751, 4413, 13743, 4330, 13735, 4256, 13726, 4174, 13718, 4106, 13710, 3978,
+		13702, 3847, 13694, 3725, 13686, 3609, 13679, 3502, 13671, 3392, 13663, 3295, 13655, 3201, 13647, 3107,
+		13640, 2986, 13633, 2823, 13625, 2670, 13618, 2538, 13610, 2394, 13603, 2279, 13595, 2152, 13589, 2046,
+		13581, 1833, 13574, 1640, 13567, 1461, 13560, 1294, 13553, 1134, 13546, 983, 13539, 849, 13532, 721,
+		15145, 16963, 15143, 16674, 15143, 16511, 15141, 16393, 15140, 16225, 15137, 16076, 15137, 15963, 15134, 15858,
+		15133, 15771, 15131, 15692, 15130, 15625, 15128, 15562, 15126, 15506, 15123, 15452, 15120, 15403, 15119, 15360,
+		15118, 15280, 15116, 15206, 15113, 15131, 15112, 15068, 15109, 15005, 15106, 14941, 15104, 14886, 15101, 14833,
+		15098, 14783, 15096, 14735, 15094, 14690, 15091, 14647, 15088, 14603, 15085, 14566, 15083, 14529, 15079, 14490,
+		15076, 14456, 15072, 14421, 15070, 14391, 15067, 14359, 15063, 14321, 15060, 14264, 15057, 14209, 15053, 14154,
+		15049, 14101, 15047, 14055, 15042, 14003, 15039, 13959, 15034, 13911, 15030, 13868, 15026, 13823, 15022, 13784,
+		15018, 13744, 15014, 13704, 15010, 13668, 15007, 13633, 15001, 13594, 14997, 13562, 14993, 13528, 14988, 13496,
+		14984, 13464, 14979, 13433, 14975, 13403, 14970, 13376, 14964, 13345, 14961, 13320, 14956, 13271, 14950, 13219,
+		14946, 13169, 14940, 13118, 14935, 13071, 14930, 13024, 14925, 12979, 14920, 12934, 14915, 12892, 14910, 12848,
+		14905, 12808, 14899, 12768, 14893, 12726, 14888, 12691, 14882, 12652, 14877, 12617, 14871, 12582, 14865, 12545,
+		14860, 12513, 14854, 12480, 14848, 12446, 14843, 12418, 14836, 12385, 14831, 12355, 14825, 12327, 14819, 12298,
+		14813, 12252, 14807, 12199, 14801, 12145, 14795, 12096, 14789, 12047, 14783, 11996, 14777, 11951, 14771, 11906,
+		14764, 11857, 14758, 11813, 14752, 11770, 14746, 11729, 14740, 11687, 14734, 11647, 14728, 11611, 14722, 11573,
+		14716, 11535, 14709, 11496, 14702, 11460, 14697, 11429, 14690, 11395, 14683, 11362, 14678, 11331, 14671, 11298,
+		14665, 11269, 14659, 11215, 14652, 11156, 14646, 11102, 14640, 11046, 14633, 10993, 14627, 10943, 14621, 10891,
+		14615, 10843, 14608, 10793, 14602, 10748, 14595, 10701, 14589, 10657, 14583, 10614, 14576, 10572, 14570, 10532,
+		14564, 10492, 14558, 10454, 14552, 10415, 14545, 10378, 14539, 10342, 14533, 10308, 14527, 10274, 14520, 10241,
+		14515, 10181, 14508, 10115, 14502, 10054, 14496, 9995, 14490, 9937, 14483, 9881, 14478, 9828, 14472, 9776,
+		14465, 9723, 14459, 9673, 14453, 9624, 14447, 9577, 14441, 9530, 14435, 9489, 14429, 9443, 14423, 9402,
+		14416, 9359, 14411, 9320, 14405, 9283, 14400, 9248, 14393, 9202, 14387, 9131, 14382, 9066, 14375, 8994,
+		14370, 8933, 14364, 8870, 14358, 8810, 14352, 8749, 14347, 8697, 14341, 8638, 14335, 8587, 14324, 8533,
+		14313, 8483, 14301, 8434, 14290, 8387, 14279, 8344, 14268, 8298, 14257, 8255, 14246, 8214, 14235, 8154,
+		14225, 8080, 14213, 8000, 14202, 7928, 14192, 7861, 14181, 7790, 14171, 7729, 14160, 7663, 14150, 7603,
+		14139, 7543, 14128, 7483, 14118, 7429, 14108, 7377, 14097, 7324, 14088, 7277, 14078, 7229, 14068, 7180,
+		14058, 7106, 14048, 7022, 14037, 6933, 14028, 6858, 14019, 6782, 14008, 6703, 13999, 6633, 13990, 6571,
+		13980, 6500, 13970, 6432, 13960, 6370, 13951, 6316, 13942, 6260, 13933, 6205, 13923, 6151, 13914, 6060,
+		13905, 5962, 13896, 5875, 13886, 5781, 13878, 5696, 13869, 5614, 13860, 5535, 13851, 5457, 13842, 5388,
+		13834, 5319, 13825, 5252, 13816, 5189, 13807, 5127, 13799, 5021, 13791, 4913, 13783, 4806, 13774, 4700,
+		13766, 4607, 13758, 4520, 13749, 4427, 13741, 4344, 13733, 4265, 13725, 4187, 13717, 4114, 13709, 4000,
+		13701, 3865, 13693, 3744, 13686, 3628, 13678, 3516, 13670, 3403, 13663, 3309, 13655, 3214, 13647, 3122,
+		13640, 3006, 13632, 2855, 13624, 2689, 13618, 2553, 13610, 2420, 13603, 2285, 13596, 2175, 13589, 2058,
+		13581, 1857, 13574, 1661, 13567, 1480, 13560, 1310, 13553, 1149, 13546, 1000, 13540, 865, 13533, 734,
+		15130, 16936, 15128, 16652, 15127, 16489, 15125, 16363, 15124, 16189, 15121, 16044, 15121, 15931, 15118, 15830,
+		15117, 15746, 15115, 15669, 15112, 15600, 15111, 15538, 15109, 15481, 15105, 15430, 15103, 15385, 15102, 15326,
+		15100, 15245, 15097, 15167, 15095, 15098, 15093, 15034, 15091, 14971, 15088, 14913, 15086, 14856, 15083, 14804,
+		15080, 14756, 15078, 14709, 15075, 14666, 15072, 14622, 15071, 14584, 15066, 14540, 15064, 14503, 15062, 14471,
+		15058, 14435, 15054, 14402, 15051, 14370, 15047, 14339, 15045, 14285, 15041, 14228, 15038, 14174, 15034, 14121,
+		15031, 14071, 15027, 14021, 15024, 13975, 15019, 13927, 15016, 13884, 15012, 13841, 15008, 13798, 15005, 13760,
+		14999, 13715, 14996, 13681, 14992, 13643, 14987, 13607, 14983, 13573, 14978, 13538, 14974, 13506, 14970, 13475,
+		14965, 13443, 14960, 13413, 14956, 13383, 14951, 13356, 14948, 13329, 14942, 13288, 14938, 13238, 14932, 13185,
+		14927, 13136, 14922, 13087, 14917, 13039, 14912, 12994, 14907, 12950, 14903, 12907, 14897, 12864, 14892, 12823,
+		14886, 12780, 14882, 12743, 14876, 12704, 14870, 12665, 14866, 12631, 14859, 12593, 14854, 12559, 14849, 12527,
+		14842, 12491, 14838, 12461, 14833, 12430, 14826, 12398, 14821, 12369, 14815, 12339, 14809, 12309, 14804, 12281,
+		14798, 12223, 14791, 12169, 14786, 12121, 14779, 12067, 14773, 12017, 14768, 11972, 14762, 11926, 14756, 11880,
+		14751, 11837, 14745, 11795, 14738, 11750, 14732, 11708, 14727, 11671, 14720, 11629, 14715, 11591, 14708, 11553,
+		14702, 11516, 14697, 11484, 14690, 11448, 14683, 11413, 14677, 11380, 14671, 11348, 14665, 11318, 14659, 11287,
+		14653, 11252, 14647, 11192, 14640, 11134, 14635, 11082, 14628, 11027, 14622, 10974, 14616, 10924, 14610, 10873,
+		14604, 10825, 14597, 10777, 14591, 10732, 14585, 10687, 14579, 10645, 14573, 10601, 14567, 10560, 14561, 10520,
+		14554, 10479, 14548, 10440, 14542, 10405, 14536, 10369, 14530, 10333, 14524, 10299, 14518, 10266, 14511, 10221,
+		14506, 10162, 14499, 10099, 14494, 10041, 14487, 9980, 14481, 9925, 14475, 9871, 14469, 9816, 14463, 9764,
+		14457, 9711, 14451, 9664, 14445, 9613, 14440, 9571, 14433, 9522, 14427, 9479, 14421, 9434, 14416, 9396,
+		14410, 9353, 14404, 9315, 14398, 9276, 14392, 9240, 14386, 9189, 14381, 9124, 14375, 9053, 14370, 8990,
+		14364, 8925, 14358, 8865, 14352, 8803, 14347, 8745, 14341, 8689, 14336, 8634, 14325, 8583, 14313, 8529,
+		14302, 8481, 14291, 8431, 14281, 8387, 14270, 8340, 14259, 8295, 14248, 8254, 14237, 8212, 14226, 8153,
+		14216, 8078, 14205, 8001, 14195, 7932, 14184, 7858, 14174, 7791, 14164, 7727, 14153, 7663, 14143, 7604,
+		14132, 7544, 14121, 7487, 14112, 7433, 14101, 7377, 14091, 7325, 14082, 7280, 14071, 7229, 14061, 7183,
+		14052, 7113, 14041, 7019, 14032, 6940, 14022, 6860, 14012, 6781, 14003, 6709, 13993, 6641, 13984, 6572,
+		13975, 6502, 13966, 6445, 13958, 6386, 13947, 6323, 13937, 6261, 13928, 6207, 13919, 6156, 13910, 6073,
+		13901, 5973, 13892, 5880, 13883, 5787, 13875, 5708, 13866, 5624, 13857, 5544, 13848, 5468, 13839, 5396,
+		13831, 5327, 13822, 5259, 13814, 5196, 13805, 5134, 13797, 5039, 13789, 4928, 13780, 4815, 13772, 4718,
+		13763, 4619, 13755, 4528, 13747, 4437, 13740, 4358, 13731, 4275, 13724, 4198, 13715, 4125, 13707, 4022,
+		13699, 3882, 13692, 3759, 13684, 3646, 13677, 3530, 13669, 3424, 13662, 3324, 13654, 3228, 13646, 3136,
+		13639, 3028, 13632, 2877, 13625, 2714, 13617, 2570, 13610, 2439, 13602, 2304, 13595, 2183, 13588, 2075,
+		13581, 1891, 13575, 1692, 13568, 1507, 13561, 1333, 13554, 1168, 13547, 1022, 13540, 876, 13533, 747,
+		15115, 16908, 15113, 16623, 15112, 16470, 15110, 16329, 15109, 16155, 15106, 16016, 15104, 15902, 15101, 15803,
+		15100, 15718, 15099, 15646, 15096, 15577, 15094, 15516, 15092, 15461, 15088, 15412, 15087, 15368, 15085, 15287,
+		15084, 15211, 15080, 15134, 15078, 15068, 15076, 15004, 15073, 14939, 15071, 14884, 15068, 14830, 15065, 14778,
+		15062, 14728, 15059, 14682, 15057, 14640, 15054, 14598, 15052, 14561, 15048, 14518, 15046, 14483, 15042, 14447,
+		15039, 14414, 15036, 14382, 15033, 14350, 15030, 14307, 15026, 14247, 15023, 14192, 15019, 14138, 15016, 14087,
+		15012, 14038, 15009, 13990, 15005, 13943, 15000, 13895, 14997, 13854, 14993, 13812, 14989, 13771, 14985, 13731,
+		14982, 13694, 14977, 13655, 14973, 13619, 14969, 13584, 14965, 13551, 14961, 13518, 14956, 13485, 14951, 13453,
+		14948, 13425, 14943, 13394, 14938, 13365, 14934, 13337, 14930, 13309, 14925, 13257, 14920, 13204, 14915, 13156,
+		14910, 13104, 14905, 13056, 14900, 13010, 14895, 12965, 14890, 12922, 14886, 12880, 14881, 12839, 14875, 12796,
+		14870, 12757, 14865, 12717, 14859, 12681, 14854, 12643, 14848, 12607, 14843, 12573, 14837, 12537, 14832, 12505,
+		14827, 12473, 14821, 12440, 14816, 12410, 14811, 12381, 14805, 12351, 14800, 12323, 14794, 12296, 14788, 12246,
+		14783, 12197, 14777, 12142, 14771, 12092, 14765, 12043, 14759, 11994, 14753, 11946, 14748, 11902, 14742, 11858,
+		14736, 11812, 14730, 11770, 14725, 11731, 14719, 11688, 14713, 11650, 14707, 11611, 14701, 11574, 14695, 11537,
+		14688, 11498, 14683, 11465, 14677, 11433, 14671, 11399, 14665, 11366, 14659, 11334, 14653, 11304, 14647, 11275,
+		14641, 11225, 14635, 11170, 14629, 11113, 14623, 11057, 14617, 11006, 14611, 10955, 14605, 10905, 14598, 10854,
+		14593, 10809, 14587, 10761, 14581, 10716, 14575, 10673, 14569, 10630, 14563, 10587, 14557, 10548, 14550, 10506,
+		14544, 10467, 14539, 10430, 14533, 10394, 14526, 10357, 14521, 10324, 14514, 10288, 14509, 10255, 14503, 10207,
+		14496, 10145, 14490, 10082, 14484, 10023, 14479, 9967, 14473, 9911, 14467, 9857, 14461, 9800, 14455, 9752,
+		14449, 9700, 14444, 9654, 14437, 9603, 14432, 9561, 14426, 9513, 14421, 9473, 14415, 9428, 14409, 9388,
+		14403, 9347, 14398, 9310, 14392, 9271, 14386, 9234, 14380, 9181, 14375, 9115, 14369, 9044, 14363, 8980,
+		14358, 8920, 14353, 8859, 14347, 8797, 14342, 8742, 14336, 8684, 14325, 8629, 14314, 8578, 14303, 8525,
+		14292, 8478, 14281, 8428, 14270, 8382, 14259, 8336, 14249, 8294, 14238, 8252, 14228, 8211, 14217, 8151,
+		14207, 8074, 14197, 8001, 14186, 7928, 14176, 7857, 14166, 7796, 14155, 7727, 14145, 7663, 14134, 7603,
+		14125, 7544, 14115, 7489, 14105, 7433, 14095, 7380, 14086, 7331, 14075, 7279, 14065, 7231, 14056, 7186,
+		14046, 7115, 14036, 7028, 14027, 6949, 14017, 6867, 14007, 6789, 13998, 6717, 13988, 6640, 13979, 6574,
+		13970, 6510, 13960, 6445, 13950, 6381, 13941, 6322, 13933, 6271, 13925, 6217, 13915, 6162, 13906, 6077,
+		13897, 5977, 13888, 5890, 13879, 5800, 13871, 5715, 13862, 5630, 13854, 5553, 13845, 5476, 13836, 5405,
+		13828, 5334, 13819, 5267, 13811, 5204, 13803, 5147, 13794, 5052, 13785, 4937, 13778, 4835, 13770, 4735,
+		13762, 4635, 13754, 4539, 13746, 4454, 13738, 4371, 13730, 4292, 13722, 4209, 13714, 4138, 13706, 4041,
+		13699, 3906, 13691, 3784, 13684, 3665, 13675, 3546, 13668, 3440, 13660, 3336, 13654, 3244, 13646, 3150,
+		13638, 3051, 13631, 2895, 13624, 2735, 13616, 2586, 13610, 2453, 13603, 2327, 13595, 2202, 13589, 2095,
+		13582, 1919, 13574, 1712, 13568, 1525, 13561, 1351, 13554, 1188, 13547, 1035, 13540, 890, 13534, 759,
+		15100, 16882, 15098, 16603, 15097, 16452, 15095, 16291, 15094, 16122, 15091, 15987, 15089, 15874, 15086, 15780,
+		15085, 15693, 15082, 15621, 15081, 15557, 15078, 15496, 15075, 15442, 15072, 15393, 15071, 15338, 15068, 15251,
+		15066, 15172, 15063, 15103, 15062, 15037, 15058, 14969, 15056, 14911, 15054, 14857, 15051, 14802, 15048, 14752,
+		15045, 14704, 15042, 14658, 15039, 14614, 15037, 14576, 15033, 14534, 15032, 14500, 15028, 14461, 15024, 14427,
+		15022, 14396, 15019, 14364, 15015, 14328, 15012, 14270, 15008, 14212, 15005, 14159, 15001, 14105, 14999, 14058,
+		14995, 14007, 14990, 13958, 14986, 13912, 14983, 13869, 14978, 13824, 14975, 13784, 14971, 13743, 14968, 13706,
+		14963, 13667, 14960, 13632, 14955, 13596, 14952, 13562, 14947, 13528, 14943, 13496, 14938, 13464, 14935, 13435,
+		14930, 13403, 14926, 13376, 14921, 13347, 14917, 13320, 14912, 13273, 14907, 13220, 14902, 13172, 14897, 13120,
+		14893, 13075, 14889, 13028, 14884, 12982, 14878, 12937, 14873, 12893, 14869, 12854, 14864, 12811, 14859, 12773,
+		14853, 12732, 14848, 12695, 14843, 12658, 14837, 12621, 14832, 12586, 14827, 12551, 14822, 12519, 14816, 12485,
+		14811, 12453, 14806, 12423, 14801, 12393, 14795, 12364, 14790, 12335, 14784, 12306, 14779, 12271, 14773, 12217,
+		14768, 12165, 14762, 12115, 14757, 12065, 14751, 12017, 14745, 11970, 14740, 11925, 14734, 11878, 14728, 11832,
+		14723, 11793, 14717, 11749, 14710, 11706, 14705, 11669, 14700, 11631, 14694, 11593, 14688, 11555, 14683, 11523,
+		14676, 11485, 14670, 11449, 14664, 11416, 14658, 11384, 14653, 11353, 14647, 11322, 14641, 11291, 14635, 11259,
+		14629, 11201, 14623, 11145, 14618, 11091, 14612, 11040, 14606, 10985, 14600, 10934, 14594, 10887, 14588, 10837,
+		14582, 10790, 14576, 10744, 14570, 10700, 14565, 10658, 14558, 10613, 14552, 10573, 14547, 10533, 14540, 10493,
+		14535, 10457, 14529, 10419, 14523, 10382, 14517, 10345, 14511, 10312, 14505, 10279, 14500, 10247, 14493, 10188,
+		14488, 10128, 14482, 10068, 14476, 10010, 14470, 9952, 14464, 9895, 14459, 9842, 14453, 9791, 14447, 9742,
+		14441, 9690, 14436, 9643, 14430, 9595, 14425, 9551, 14419, 9505, 14413, 9463, 14407, 9420, 14402, 9382,
+		14396, 9341, 14390, 9303, 14385, 9265, 14380, 9231, 14374, 9170, 14368, 9105, 14362, 9034, 14357, 8973,
+		14352, 8909, 14346, 8850, 14341, 8789, 14336, 8736, 14324, 8678, 14314, 8626, 14303, 8573, 14292, 8522,
+		14281, 8472, 14271, 8425, 14260, 8379, 14249, 8333, 14239, 8292, 14228, 8248, 14218, 8208, 14208, 8147,
+		14198, 8071, 14188, 7997, 14177, 7925, 14167, 7857, 14156, 7788, 14146, 7723, 14137, 7665, 14127, 7601,
+		14117, 7544, 14107, 7488, 14097, 7431, 14088, 7381, 14077, 7328, 14068, 7281, 14058, 7231, 14048, 7184,
+		14039, 7118, 14029, 7033, 14020, 6947, 14011, 6870, 14003, 6798, 13993, 6721, 13984, 6650, 13975, 6585,
+		13965, 6514, 13955, 6450, 13947, 6391, 13938, 6333, 13928, 6271, 13918, 6214, 13911, 6165, 13903, 6094,
+		13894, 5999, 13885, 5901, 13876, 5809, 13867, 5722, 13859, 5641, 13850, 5564, 13842, 5486, 13833, 5412,
+		13825, 5343, 13817, 5278, 13808, 5214, 13800, 5154, 13792, 5068, 13783, 4954, 13775, 4848, 13768, 4746,
+		13759, 4645, 13751, 4552, 13743, 4462, 13736, 4380, 13727, 4293, 13720, 4220, 13713, 4150, 13705, 4063,
+		13696, 3916, 13689, 3795, 13682, 3683, 13674, 3566, 13667, 3454, 13660, 3349, 13652, 3255, 13645, 3161,
+		13637, 3071, 13631, 2918, 13624, 2767, 13616, 2612, 13608, 2465, 13602, 2345, 13595, 2219, 13588, 2107,
+		13581, 1936, 13575, 1744, 13568, 1555, 13561, 1374, 13554, 1203, 13547, 1049, 13541, 905, 13534, 772,
+		15086, 16854, 15084, 16581, 15083, 16430, 15080, 16256, 15078, 16087, 15076, 15959, 15074, 15846, 15071, 15755,
+		15069, 15670, 15067, 15598, 15064, 15533, 15063, 15476, 15059, 15424, 15057, 15375, 15054, 15299, 15052, 15217,
+		15049, 15139, 15047, 15068, 15044, 15003, 15042, 14941, 15040, 14885, 15036, 14826, 15034, 14776, 15030, 14726,
+		15027, 14678, 15025, 14634, 15022, 14592, 15020, 14552, 15016, 14513, 15015, 14480, 15010, 14440, 15006, 14406,
+		15004, 14375, 15001, 14343, 14997, 14292, 14995, 14235, 14991, 14181, 14987, 14125, 14984, 14074, 14980, 14022,
+		14977, 13976, 14972, 13928, 14970, 13889, 14965, 13842, 14963, 13802, 14958, 13757, 14954, 13720, 14951, 13683,
+		14946, 13644, 14942, 13609, 14937, 13572, 14934, 13540, 14929, 13506, 14925, 13474, 14921, 13444, 14917, 13414,
+		14913, 13386, 14908, 13355, 14904, 13329, 14899, 13291, 14895, 13241, 14890, 13188, 14885, 13137, 14881, 13090,
+		14876, 13042, 14872, 12999, 14867, 12954, 14862, 12910, 14857, 12867, 14852, 12826, 14847, 12787, 14842, 12746,
+		14838, 12711, 14832, 12673, 14827, 12636, 14823, 12602, 14817, 12565, 14812, 12532, 14807, 12499, 14801, 12468,
+		14796, 12436, 14791, 12405, 14785, 12375, 14780, 12347, 14775, 12318, 14770, 12292, 14763, 12238, 14758, 12188,
+		14753, 12137, 14748, 12088, 14742, 12037, 14737, 11992, 14731, 11945, 14725, 11897, 14721, 11856, 14715, 11813,
+		14709, 11769, 14703, 11729, 14698, 11688, 14692, 11648, 14686, 11610, 14680, 11574, 14675, 11538, 14669, 11502,
+		14663, 11469, 14659, 11438, 14652, 11403, 14646, 11368, 14640, 11336, 14635, 11307, 14629, 11278, 14623, 11235,
+		14618, 11179, 14612, 11123, 14606, 11069, 14600, 11015, 14594, 10965, 14589, 10914, 14583, 10866, 14577, 10820,
+		14571, 10773, 14566, 10730, 14559, 10683, 14554, 10641, 14548, 10599, 14542, 10558, 14537, 10520, 14530, 10479,
+		14525, 10443, 14519, 10405, 14513, 10370, 14508, 10337, 14502, 10302, 14496, 10269, 14491, 10236, 14485, 10173,
+		14479, 10111, 14473, 10052, 14468, 9993, 14462, 9938, 14456, 9883, 14451, 9831, 14445, 9778, 14439, 9728,
+		14433, 9679, 14428, 9632, 14423, 9587, 14417, 9540, 14411, 9496, 14406, 9456, 14400, 9413, 14394, 9373,
+		14389, 9332, 14384, 9297, 14378, 9260, 14373, 9223, 14367, 9159, 14362, 9094, 14357, 9027, 14351, 8963,
+		14346, 8901, 14340, 8841, 14333, 8781, 14324, 8729, 14312, 8669, 14302, 8619, 14291, 8566, 14281, 8517,
+		14270, 8468, 14261, 8422, 14250, 8375, 14240, 8331, 14230, 8288, 14219, 8245, 14209, 8207, 14199, 8142,
+		14189, 8068, 14178, 7993, 14168, 7920, 14158, 7854, 14148, 7786, 14139, 7726, 14129, 7661, 14119, 7600,
+		14109, 7543, 14099, 7485, 14090, 7434, 14080, 7381, 14071, 7329, 14061, 7284, 14050, 7229, 14042, 7187,
+		14033, 7121, 14024, 7034, 14015, 6951, 14006, 6875, 13996, 6796, 13986, 6722, 13977, 6652, 13968, 6582,
+		13959, 6518, 13951, 6458, 13941, 6393, 13932, 6333, 13924, 6278, 13916, 6228, 13907, 6171, 13897, 6092,
+		13888, 5995, 13880, 5906, 13872, 5819, 13863, 5732, 13855, 5648, 13846, 5568, 13838, 5492, 13830, 5419,
+		13821, 5353, 13813, 5286, 13805, 5219, 13797, 5159, 13789, 5077, 13781, 4967, 13773, 4862, 13765, 4756,
+		13757, 4657, 13749, 4567, 13741, 4473, 13734, 4392, 13726, 4307, 13718, 4231, 13710, 4158, 13703, 4076,
+		13695, 3941, 13688, 3821, 13681, 3694, 13673, 3580, 13665, 3471, 13659, 3367, 13651, 3273, 13644, 3176,
+		13637, 3087, 13630, 2940, 13623, 2786, 13615, 2630, 13608, 2487, 13602, 2358, 13595, 2238, 13588, 2117,
+		13581, 1979, 13574, 1763, 13568, 1573, 13561, 1394, 13554, 1224, 13548, 1069, 13541, 922, 13534, 784,
+		15072, 16827, 15070, 16558, 15068, 16411, 15065, 16216, 15064, 16057, 15061, 15928, 15058, 15815, 15056, 15729,
+		15054, 15645, 15051, 15576, 15049, 15512, 15047, 15455, 15042, 15402, 15041, 15352, 15038, 15260, 15036, 15182,
+		15034, 15110, 15031, 15040, 15028, 14971, 15025, 14912, 15024, 14858, 15020, 14799, 15017, 14750, 15014, 14702,
+		15011, 14654, 15008, 14609, 15006, 14570, 15002, 14528, 15000, 14493, 14997, 14456, 14994, 14423, 14990, 14389,
+		14986, 14354, 14984, 14316, 14980, 14255, 14976, 14198, 14973, 14146, 14970, 14092, 14967, 14043, 14963, 13993,
+		14960, 13948, 14956, 13901, 14951, 13854, 14948, 13814, 14945, 13774, 14941, 13733, 14937, 13694, 14933, 13656,
+		14929, 13621, 14925, 13585, 14921, 13551, 14917, 13518, 14913, 13486, 14908, 13454, 14905, 13425, 14900, 13394,
+		14895, 13364, 14892, 13339, 14886, 13307, 14882, 13258, 14877, 13204, 14874, 13157, 14868, 13105, 14864, 13059,
+		14859, 13011, 14854, 12967, 14850, 12925, 14846, 12883, 14841, 12842, 14836, 12801, 14831, 12760, 14826, 12724,
+		14821, 12686, 14816, 12649, 14812, 12615, 14807, 12579, 14801, 12545, 14796, 12512, 14791, 12480, 14786, 12448,
+		14781, 12418, 14776, 12389, 14770, 12358, 14765, 12330, 14760, 12303, 14754, 12262, 14750, 12211, 14744, 12160,
+		14738, 12105, 14733, 12059, 14728, 12012, 14722, 11963, 14717, 11921, 14712, 11875, 14706, 11830, 14701, 11790,
+		14696, 11749, 14690, 11709, 14684, 11669, 14679, 11633, 14674, 11594, 14667, 11554, 14661, 11520, 14656, 11485,
+		14650, 11450, 14644, 11416, 14639, 11386, 14635, 11357, 14629, 11326, 14623, 11294, 14617, 11263, 14612, 11209,
+		14606, 11155, 14600, 11098, 14594, 11046, 14589, 10995, 14583, 10944, 14577, 10895, 14572, 10849, 14566, 10801,
+		14560, 10754, 14554, 10710, 14549, 10667, 14544, 10626, 14538, 10586, 14532, 10546, 14527, 10506, 14521, 10467,
+		14515, 10431, 14510, 10395, 14504, 10360, 14499, 10326, 14493, 10292, 14487, 10260, 14482, 10215, 14476, 10155,
+		14470, 10094, 14465, 10038, 14459, 9980, 14454, 9922, 14448, 9870, 14442, 9816, 14437, 9768, 14432, 9717,
+		14426, 9668, 14421, 9622, 14415, 9576, 14409, 9529, 14404, 9488, 14398, 9444, 14393, 9405, 14387, 9364,
+		14382, 9327, 14377, 9288, 14371, 9252, 14366, 9216, 14361, 9149, 14355, 9081, 14350, 9017, 14345, 8954,
+		14340, 8895, 14333, 8834, 14322, 8776, 14311, 8719, 14301, 8663, 14291, 8611, 14281, 8562, 14271, 8512,
+		14260, 8462, 14251, 8418, 14240, 8370, 14230, 8329, 14220, 8284, 14210, 8244, 14200, 8204, 14190, 8137,
+		14180, 8064, 14169, 7989, 14160, 7922, 14150, 7852, 14140, 7784, 14131, 7723, 14121, 7658, 14112, 7602,
+		14102, 7543, 14092, 7487, 14083, 7434, 14073, 7378, 14064, 7332, 14054, 7280, 14045, 7235, 14037, 7192,
+		14027, 7121, 14018, 7036, 14009, 6958, 13999, 6875, 13989, 6799, 13981, 6729, 13972, 6654, 13963, 6590,
+		13954, 6522, 13944, 6453, 13936, 6394, 13928, 6340, 13919, 6282, 13910, 6224, 13901, 6174, 13893, 6106,
+		13885, 6010, 13876, 5916, 13868, 5827, 13859, 5736, 13851, 5657, 13843, 5576, 13834, 5501, 13826, 5429,
+		13818, 5361, 13810, 5290, 13802, 5230, 13794, 5165, 13786, 5091, 13778, 4983, 13770, 4868, 13762, 4769,
+		13755, 4671, 13747, 4575, 13739, 4488, 13731, 4402, 13723, 4315, 13716, 4245, 13709, 4168, 13701, 4094,
+		13694, 3960, 13686, 3831, 13679, 3715, 13672, 3599, 13664, 3482, 13657, 3378, 13650, 3284, 13643, 3191,
+		13635, 3097, 13628, 2952, 13622, 2805, 13615, 2652, 13608, 2506, 13601, 2377, 13594, 2252, 13587, 2129,
+		13580, 1991, 13574, 1783, 13567, 1597, 13560, 1411, 13554, 1244, 13547, 1082, 13541, 935, 13534, 797,
+		15058, 16803, 15056, 16539, 15055, 16394, 15051, 16187, 15049, 16029, 15047, 15901, 15044, 15794, 15041, 15702,
+		15040, 15625, 15036, 15555, 15033, 15490, 15032, 15436, 15027, 15385, 15024, 15309, 15022, 15227, 15021, 15152,
+		15018, 15078, 15015, 15010, 15012, 14943, 15009, 14886, 15006, 14826, 15004, 14774, 15001, 14725, 14997, 14675,
+		14995, 14632, 14992, 14589, 14990, 14548, 14986, 14507, 14983, 14472, 14979, 14434, 14977, 14403, 14973, 14370,
+		14969, 14336, 14967, 14281, 14963, 14219, 14960, 14165, 14956, 14110, 14954, 14063, 14949, 14010, 14946, 13963,
+		14942, 13916, 14938, 13872, 14935, 13828, 14931, 13787, 14927, 13746, 14924, 13708, 14919, 13668, 14916, 13633,
+		14912, 13596, 14909, 13564, 14904, 13528, 14900, 13497, 14896, 13465, 14892, 13434, 14887, 13404, 14883, 13376,
+		14879, 13348, 14873, 13318, 14871, 13277, 14865, 13221, 14861, 13172, 14857, 13123, 14853, 13076, 14847, 13028,
+		14842, 12982, 14838, 12939, 14834, 12896, 14830, 12856, 14825, 12815, 14820, 12775, 14815, 12736, 14810, 12699,
+		14805, 12663, 14800, 12626, 14796, 12591, 14791, 12557, 14786, 12524, 14781, 12493, 14776, 12461, 14771, 12430,
+		14766, 12399, 14761, 12371, 14756, 12342, 14751, 12315, 14746, 12286, 14741, 12235, 14735, 12181, 14729, 12130,
+		14725, 12083, 14719, 12031, 14714, 11986, 14709, 11940, 14702, 11892, 14698, 11852, 14692, 11808, 14687, 11767,
+		14682, 11727, 14676, 11687, 14671, 11650, 14666, 11610, 14660, 11574, 14655, 11539, 14649, 11503, 14644, 11468,
+		14638, 11436, 14633, 11403, 14627, 11370, 14622, 11339, 14617, 11312, 14612, 11283, 14606, 11243, 14600, 11182,
+		14594, 11128, 14589, 11076, 14583, 11022, 14578, 10975, 14572, 10923, 14567, 10877, 14560, 10827, 14555, 10783,
+		14550, 10737, 14544, 10694, 14539, 10652, 14533, 10611, 14528, 10570, 14522, 10530, 14516, 10491, 14511, 10456,
+		14505, 10418, 14500, 10382, 14495, 10348, 14489, 10315, 14484, 10282, 14478, 10250, 14473, 10196, 14467, 10138,
+		14461, 10076, 14456, 10019, 14450, 9962, 14445, 9909, 14440, 9857, 14434, 9804, 14429, 9753, 14424, 9704,
+		14418, 9658, 14413, 9609, 14407, 9565, 14402, 9521, 14397, 9481, 14391, 9436, 14386, 9397, 14381, 9357,
+		14375, 9320, 14370, 9280, 14365, 9246, 14360, 9208, 14354, 9137, 14349, 9072, 14344, 9007, 14338, 8943,
+		14331, 8885, 14319, 8822, 14310, 8768, 14301, 8714, 14291, 8660, 14281, 8608, 14270, 8555, 14260, 8507,
+		14250, 8458, 14240, 8413, 14230, 8366, 14220, 8324, 14209, 8279, 14200, 8241, 14189, 8200, 14180, 8133,
+		14170, 8059, 14160, 7984, 14152, 7918, 14142, 7849, 14132, 7782, 14122, 7718, 14113, 7658, 14103, 7599,
+		14094, 7541, 14084, 7486, 14075, 7431, 14066, 7380, 14056, 7330, 14046, 7278, 14038, 7235, 14029, 7189,
+		14020, 7122, 14011, 7042, 14001, 6957, 13992, 6878, 13984, 6805, 13975, 6727, 13966, 6658, 13958, 6594,
+		13949, 6525, 13941, 6465, 13932, 6404, 13923, 6342, 13913, 6284, 13905, 6232, 13897, 6178, 13888, 6106,
+		13880, 6010, 13872, 5922, 13863, 5832, 13856, 5747, 13847, 5665, 13839, 5585, 13831, 5510, 13822, 5433,
+		13815, 5365, 13807, 5299, 13798, 5233, 13791, 5172, 13783, 5106, 13775, 4992, 13767, 4885, 13760, 4784,
+		13752, 4678, 13745, 4593, 13736, 4499, 13729, 4408, 13722, 4331, 13714, 4254, 13706, 4175, 13699, 4104,
+		13692, 3977, 13685, 3849, 13678, 3733, 13671, 3618, 13663, 3501, 13656, 3396, 13649, 3296, 13642, 3202,
+		13635, 3109, 13628, 2978, 13621, 2823, 13614, 2674, 13607, 2524, 13600, 2387, 13594, 2269, 13587, 2151,
+		13580, 2017, 13574, 1822, 13567, 1612, 13560, 1431, 13554, 1264, 13548, 1100, 13541, 950, 13534, 809,
+		15045, 16778, 15042, 16519, 15040, 16358, 15037, 16155, 15035, 15999, 15033, 15873, 15030, 15771, 15027, 15678,
+		15025, 15602, 15021, 15533, 15019, 15470, 15016, 15415, 15012, 15365, 15009, 15277, 15007, 15196, 15006, 15119,
+		15002, 15045, 14999, 14975, 14996, 14916, 14993, 14855, 14991, 14800, 14988, 14751, 14984, 14697, 14982, 14653,
+		14979, 14608, 14977, 14568, 14973, 14525, 14971, 14489, 14967, 14451, 14963, 14416, 14959, 14381, 14957, 14351,
+		14954, 14305, 14949, 14240, 14947, 14187, 14943, 14131, 14940, 14080, 14937, 14029, 14933, 13979, 14930, 13935,
+		14925, 13888, 14922, 13844, 14919, 13803, 14914, 13759, 14912, 13723, 14907, 13682, 14903, 13646, 14899, 13609,
+		14895, 13573, 14891, 13540, 14887, 13507, 14883, 13476, 14880, 13445, 14875, 13414, 14870, 13384, 14866, 13356,
+		14862, 13329, 14858, 13291, 14853, 13238, 14849, 13189, 14845, 13139, 14841, 13092, 14836, 13045, 14832, 13001,
+		14827, 12955, 14823, 12911, 14818, 12869, 14813, 12829, 14809, 12790, 14804, 12750, 14799, 12712, 14794, 12675,
+		14790, 12639, 14786, 12605, 14780, 12570, 14776, 12537, 14771, 12504, 14766, 12471, 14761, 12442, 14756, 12412,
+		14751, 12382, 14746, 12353, 14741, 12325, 14736, 12298, 14731, 12255, 14725, 12199, 14721, 12153, 14715, 12100,
+		14710, 12052, 14706, 12008, 14700, 11959, 14695, 11914, 14690, 11871, 14685, 11828, 14679, 11786, 14674, 11747,
+		14669, 11707, 14662, 11663, 14658, 11629, 14653, 11593, 14647, 11554, 14642, 11520, 14637, 11486, 14632, 11454,
+		14626, 11421, 14621, 11388, 14615, 11357, 14610, 11327, 14604, 11295, 14598, 11265, 14594, 11215, 14589, 11161,
+		14583, 11107, 14577, 11053, 14572, 11001, 14567, 10954, 14561, 10902, 14555, 10855, 14550, 10810, 14545, 10765,
+		14539, 10721, 14534, 10679, 14529, 10637, 14523, 10594, 14518, 10555, 14512, 10517, 14507, 10478, 14502, 10442,
+		14496, 10405, 14491, 10371, 14485, 10336, 14480, 10304, 14474, 10270, 14469, 10240, 14463, 10175, 14458, 10117,
+		14453, 10059, 14447, 10001, 14442, 9948, 14437, 9894, 14431, 9840, 14426, 9790, 14421, 9742, 14416, 9691,
+		14410, 9645, 14404, 9596, 14400, 9555, 14394, 9510, 14389, 9470, 14384, 9428, 14379, 9389, 14374, 9349,
+		14369, 9313, 14363, 9274, 14359, 9241, 14353, 9192, 14348, 9128, 14343, 9060, 14337, 8997, 14329, 8935,
+		14319, 8876, 14309, 8817, 14299, 8761, 14289, 8704, 14279, 8651, 14268, 8598, 14259, 8552, 14248, 8500,
+		14239, 8453, 14229, 8406, 14219, 8362, 14209, 8319, 14199, 8277, 14190, 8238, 14180, 8196, 14171, 8130,
+		14161, 8051, 14152, 7982, 14142, 7913, 14132, 7841, 14123, 7779, 14113, 7717, 14104, 7655, 14094, 7594,
+		14086, 7540, 14077, 7486, 14067, 7429, 14058, 7379, 14049, 7327, 14040, 7282, 14031, 7235, 14021, 7187,
+		14012, 7120, 14004, 7038, 13995, 6956, 13987, 6880, 13978, 6802, 13969, 6730, 13960, 6662, 13951, 6590,
+		13942, 6525, 13934, 6464, 13925, 6400, 13917, 6347, 13909, 6291, 13901, 6235, 13892, 6181, 13884, 6121,
+		13876, 6028, 13867, 5927, 13859, 5837, 13851, 5752, 13843, 5669, 13835, 5590, 13827, 5517, 13819, 5441,
+		13811, 5374, 13803, 5305, 13795, 5241, 13787, 5178, 13780, 5119, 13772, 5007, 13764, 4897, 13756, 4792,
+		13749, 4697, 13741, 4597, 13734, 4505, 13727, 4423, 13720, 4342, 13712, 4262, 13704, 4186, 13697, 4113,
+		13690, 3996, 13683, 3871, 13676, 3747, 13668, 3622, 13661, 3512, 13654, 3408, 13648, 3310, 13641, 3218,
+		13633, 3122, 13626, 2995, 13620, 2842, 13613, 2694, 13607, 2552, 13599, 2405, 13593, 2281, 13586, 2162,
+		13580, 2051, 13573, 1832, 13566, 1634, 13560, 1455, 13554, 1277, 13547, 1112, 13541, 965, 13534, 822,
+		15032, 16752, 15029, 16499, 15027, 16326, 15024, 16124, 15021, 15969, 15019, 15845, 15016, 15743, 15013, 15656,
+		15010, 15581, 15007, 15511, 15005, 15453, 15002, 15397, 14997, 15331, 14995, 15245, 14993, 15162, 14990, 15086,
+		14987, 15015, 14984, 14948, 14981, 14887, 14978, 14829, 14975, 14774, 14973, 14725, 14968, 14673, 14966, 14629,
+		14963, 14586, 14961, 14545, 14957, 14504, 14955, 14469, 14950, 14429, 14947, 14396, 14943, 14361, 14940, 14325,
+		14937, 14267, 14934, 14208, 14931, 14154, 14927, 14099, 14924, 14050, 14920, 13997, 14917, 13953, 14912, 13903,
+		14909, 13860, 14905, 13816, 14902, 13776, 14899, 13736, 14894, 13694, 14890, 13656, 14887, 13622, 14883, 13584,
+		14879, 13552, 14875, 13518, 14871, 13486, 14867, 13454, 14863, 13425, 14858, 13394, 14855, 13367, 14850, 13337,
+		14846, 13308, 14842, 13258, 14838, 13205, 14834, 13159, 14829, 13108, 14825, 13061, 14821, 13016, 14816, 12970,
+		14812, 12929, 14807, 12884, 14803, 12844, 14798, 12803, 14794, 12764, 14789, 12727, 14784, 12688, 14779, 12652,
+		14774, 12616, 14770, 12583, 14766, 12550, 14760, 12516, 14756, 12484, 14751, 12453, 14746, 12422, 14741, 12393,
+		14737, 12364, 14732, 12336, 14727, 12308, 14721, 12271, 14716, 12222, 14712, 12173, 14706, 12120, 14702, 12074,
+		14696, 12025, 14691, 11978, 14687, 11936, 14682, 11891, 14676, 11846, 14671, 11805, 14667, 11767, 14661, 11722,
+		14655, 11684, 14650, 11646, 14645, 11608, 14640, 11573, 14634, 11536, 14630, 11503, 14624, 11468, 14619, 11435,
+		14615, 11407, 14609, 11372, 14604, 11343, 14598, 11312, 14593, 11284, 14587, 11245, 14581, 11186, 14576, 11132,
+		14572, 11083, 14566, 11032, 14561, 10981, 14555, 10931, 14550, 10883, 14545, 10836, 14540, 10793, 14535, 10747,
+		14529, 10704, 14524, 10660, 14519, 10620, 14513, 10580, 14508, 10541, 14503, 10503, 14497, 10466, 14492, 10428,
+		14487, 10393, 14481, 10359, 14476, 10325, 14470, 10293, 14465, 10260, 14460, 10218, 14455, 10161, 14450, 10101,
+		14444, 10043, 14439, 9986, 14434, 9932, 14429, 9877, 14423, 9827, 14418, 9776, 14413, 9728, 14407, 9678,
+		14403, 9633, 14397, 9588, 14392, 9543, 14387, 9501, 14382, 9459, 14377, 9419, 14372, 9380, 14367, 9342,
+		14362, 9303, 14356, 9267, 14351, 9232, 14346, 9181, 14341, 9114, 14336, 9048, 14326, 8984, 14317, 8925,
+		14307, 8866, 14297, 8808, 14287, 8751, 14277, 8697, 14267, 8644, 14256, 8590, 14248, 8543, 14237, 8493,
+		14228, 8449, 14218, 8402, 14208, 8359, 14198, 8314, 14190, 8274, 14180, 8232, 14170, 8193, 14162, 8122,
+		14152, 8045, 14143, 7979, 14133, 7908, 14124, 7841, 14115, 7778, 14105, 7715, 14096, 7655, 14087, 7595,
+		14078, 7540, 14068, 7479, 14060, 7429, 14052, 7379, 14042, 7328, 14033, 7281, 14024, 7234, 14015, 7190,
+		14006, 7124, 13998, 7042, 13989, 6961, 13980, 6881, 13971, 6804, 13963, 6734, 13954, 6662, 13946, 6594,
+		13937, 6532, 13929, 6466, 13920, 6405, 13913, 6351, 13903, 6289, 13895, 6235, 13887, 6184, 13879, 6126,
+		13870, 6023, 13863, 5935, 13856, 5855, 13847, 5761, 13839, 5678, 13831, 5596, 13823, 5523, 13815, 5451,
+		13807, 5381, 13799, 5310, 13791, 5246, 13784, 5185, 13777, 5128, 13769, 5022, 13761, 4908, 13754, 4805,
+		13746, 4705, 13739, 4609, 13732, 4521, 13724, 4434, 13717, 4351, 13709, 4270, 13702, 4191, 13695, 4121,
+		13688, 4018, 13681, 3884, 13673, 3757, 13667, 3641, 13660, 3530, 13652, 3416, 13646, 3321, 13639, 3225,
+		13632, 3132, 13625, 3014, 13619, 2863, 13611, 2705, 13605, 2566, 13598, 2426, 13592, 2296, 13585, 2174,
+		13579, 2063, 13572, 1857, 13566, 1663, 13559, 1471, 13553, 1297, 13547, 1132, 13540, 975, 13534, 834,
+		15019, 16731, 15016, 16477, 15014, 16296, 15011, 16095, 15007, 15943, 15005, 15821, 15001, 15717, 14999, 15633,
+		14996, 15560, 14993, 15491, 14991, 15435, 14986, 15380, 14983, 15300, 14981, 15212, 14979, 15132, 14975, 15055,
+		14971, 14984, 14970, 14924, 14966, 14861, 14963, 14802, 14961, 14750, 14957, 14699, 14953, 14650, 14951, 14606,
+		14948, 14562, 14945, 14522, 14942, 14485, 14938, 14446, 14935, 14412, 14931, 14377, 14928, 14344, 14924, 14290,
+		14921, 14231, 14919, 14179, 14915, 14120, 14911, 14068, 14908, 14018, 14905, 13970, 14900, 13921, 14897, 13876,
+		14894, 13833, 14890, 13792, 14886, 13748, 14883, 13710, 14878, 13670, 14875, 13635, 14871, 13598, 14868, 13565,
+		14863, 13529, 14859, 13498, 14855, 13466, 14851, 13436, 14847, 13404, 14843, 13376, 14839, 13348, 14835, 13321,
+		14830, 13275, 14826, 13221, 14822, 13173, 14818, 13123, 14814, 13078, 14809, 13030, 14805, 12984, 14801, 12943,
+		14797, 12899, 14792, 12859, 14788, 12817, 14784, 12780, 14778, 12738, 14774, 12702, 14769, 12666, 14765, 12630,
+		14760, 12596, 14755, 12561, 14751, 12529, 14746, 12497, 14741, 12465, 14737, 12435, 14732, 12405, 14727, 12375,
+		14722, 12347, 14717, 12319, 14712, 12291, 14708, 12245, 14702, 12191, 14698, 12143, 14693, 12093, 14687, 12042,
+		14683, 11999, 14678, 11954, 14673, 11908, 14668, 11864, 14663, 11823, 14658, 11783, 14653, 11742, 14648, 11704,
+		14643, 11664, 14638, 11628, 14633, 11593, 14628, 11555, 14622, 11520, 14617, 11486, 14613, 11454, 14607, 11419,
+		14602, 11388, 14597, 11357, 14591, 11327, 14586, 11297, 14581, 11268, 14577, 11222, 14571, 11168, 14566, 11113,
+		14560, 11057, 14554, 11005, 14550, 10958, 14545, 10911, 14540, 10865, 14534, 10817, 14530, 10774, 14524, 10727,
+		14519, 10685, 14513, 10644, 14508, 10605, 14503, 10564, 14498, 10525, 14493, 10488, 14488, 10451, 14482, 10416,
+		14477, 10381, 14471, 10346, 14467, 10314, 14462, 10282, 14457, 10251, 14451, 10199, 14446, 10140, 14440, 10080,
+		14436, 10027, 14430, 9968, 14425, 9914, 14421, 9864, 14415, 9813, 14410, 9762, 14405, 9714, 14400, 9668,
+		14395, 9622, 14390, 9576, 14385, 9532, 14380, 9490, 14375, 9450, 14370, 9411, 14364, 9369, 14360, 9333,
+		14354, 9294, 14349, 9262, 14344, 9224, 14339, 9167, 14333, 9099, 14324, 9039, 14314, 8975, 14305, 8915,
+		14294, 8853, 14284, 8798, 14275, 8742, 14266, 8693, 14255, 8635, 14246, 8586, 14236, 8535, 14226, 8488,
+		14217, 8442, 14208, 8397, 14199, 8354, 14189, 8310, 14180, 8271, 14170, 8228, 14161, 8189, 14151, 8113,
+		14142, 8042, 14133, 7971, 14123, 7900, 14115, 7837, 14106, 7773, 14097, 7709, 14087, 7647, 14079, 7593,
+		14070, 7537, 14061, 7480, 14053, 7431, 14042, 7374, 14034, 7328, 14025, 7280, 14016, 7233, 14009, 7190,
+		13999, 7121, 13991, 7041, 13982, 6960, 13973, 6881, 13965, 6806, 13957, 6734, 13948, 6665, 13940, 6599,
+		13932, 6532, 13923, 6468, 13916, 6411, 13907, 6350, 13899, 6294, 13890, 6243, 13882, 6187, 13874, 6130,
+		13866, 6036, 13858, 5940, 13850, 5845, 13841, 5759, 13834, 5685, 13826, 5605, 13819, 5530, 13811, 5454,
+		13803, 5383, 13796, 5316, 13788, 5253, 13781, 5192, 13773, 5133, 13765, 5026, 13758, 4919, 13751, 4812,
+		13743, 4715, 13736, 4621, 13729, 4531, 13721, 4443, 13714, 4359, 13707, 4277, 13700, 4201, 13693, 4133,
+		13686, 4032, 13679, 3896, 13672, 3772, 13665, 3651, 13658, 3539, 13651, 3437, 13645, 3337, 13638, 3237,
+		13631, 3149, 13624, 3042, 13617, 2878, 13611, 2732, 13604, 2583, 13597, 2442, 13591, 2312, 13584, 2185,
+		13578, 2074, 13572, 1895, 13565, 1680, 13559, 1492, 13552, 1310, 13546, 1145, 13540, 993, 13534, 847,
+		15006, 16704, 15003, 16459, 15001, 16263, 14998, 16067, 14994, 15915, 14992, 15797, 14988, 15695, 14986, 15612,
+		14983, 15538, 14979, 15471, 14977, 15414, 14972, 15361, 14969, 15265, 14966, 15178, 14965, 15102, 14960, 15021,
+		14957, 14956, 14954, 14893, 14951, 14833, 14949, 14778, 14945, 14725, 14941, 14673, 14939, 14629, 14935, 14582,
+		14933, 14541, 14929, 14500, 14926, 14462, 14923, 14425, 14919, 14393, 14915, 14357, 14913, 14319, 14909, 14254,
+		14906, 14197, 14903, 14145, 14900, 14089, 14896, 14038, 14892, 13987, 14889, 13940, 14885, 13893, 14882, 13851,
+		14878, 13806, 14874, 13765, 14871, 13724, 14866, 13685, 14863, 13647, 14859, 13610, 14856, 13577, 14851, 13541,
+		14848, 13510, 14844, 13477, 14839, 13445, 14836, 13415, 14832, 13386, 14827, 13356, 14823, 13330, 14819, 13294,
+		14816, 13244, 14811, 13192, 14807, 13142, 14803, 13096, 14798, 13046, 14794, 13001, 14790, 12956, 14786, 12913,
+		14782, 12874, 14777, 12830, 14773, 12792, 14768, 12752, 14764, 12716, 14759, 12678, 14755, 12644, 14750, 12608,
+		14746, 12574, 14741, 12541, 14736, 12508, 14732, 12478, 14727, 12446, 14723, 12416, 14718, 12387, 14714, 12359,
+		14708, 12330, 14704, 12304, 14698, 12265, 14694, 12212, 14689, 12164, 14684, 12111, 14680, 12066, 14674, 12019,
+		14670, 11973, 14665, 11928, 14660, 11884, 14655, 11841, 14650, 11799, 14645, 11760, 14640, 11719, 14635, 11681,
+		14630, 11645, 14625, 11607, 14620, 11572, 14615, 11536, 14611, 11505, 14605, 11468, 14600, 11436, 14595, 11405,
+		14590, 11373, 14585, 11342, 14579, 11312, 14575, 11286, 14570, 11249, 14564, 11190, 14559, 11138, 14555, 11087,
+		14550, 11041, 14544, 10985, 14539, 10937, 14534, 10889, 14529, 10845, 14524, 10799, 14519, 10756, 14514, 10712,
+		14509, 10669, 14504, 10630, 14499, 10589, 14494, 10550, 14488, 10510, 14483, 10474, 14478, 10438, 14472, 10402,
+		14468, 10370, 14462, 10334, 14458, 10303, 14452, 10269, 14448, 10240, 14442, 10178, 14438, 10121, 14432, 10063,
+		14428, 10007, 14422, 9951, 14417, 9901, 14412, 9848, 14407, 9798, 14402, 9747, 14397, 9702, 14392, 9655,
+		14387, 9609, 14382, 9567, 14377, 9522, 14373, 9482, 14367, 9437, 14362, 9400, 14357, 9360, 14352, 9325,
+		14347, 9286, 14342, 9252, 14337, 9216, 14330, 9155, 14321, 9088, 14312, 9026, 14301, 8961, 14292, 8904,
+		14281, 8844, 14273, 8790, 14263, 8734, 14254, 8683, 14243, 8628, 14235, 8581, 14225, 8529, 14216, 8483,
+		14207, 8437, 14197, 8391, 14188, 8347, 14179, 8306, 14169, 8266, 14160, 8225, 14151, 8183, 14141, 8106,
+		14133, 8038, 14123, 7962, 14115, 7898, 14106, 7832, 14097, 7767, 14088, 7707, 14079, 7646, 14071, 7590,
+		14061, 7531, 14052, 7479, 14043, 7425, 14035, 7375, 14026, 7327, 14018, 7278, 14009, 7233, 14001, 7188,
+		13992, 7125, 13984, 7042, 13975, 6957, 13967, 6885, 13958, 6804, 13950, 6732, 13942, 6667, 13934, 6597,
+		13926, 6532, 13917, 6471, 13908, 6409, 13901, 6353, 13893, 6298, 13884, 6239, 13877, 6186, 13870, 6141,
+		13861, 6039, 13853, 5947, 13846, 5864, 13838, 5776, 13830, 5688, 13822, 5604, 13814, 5533, 13807, 5460,
+		13800, 5392, 13792, 5324, 13784, 5259, 13777, 5194, 13769, 5134, 13763, 5041, 13755, 4927, 13747, 4825,
+		13740, 4727, 13733, 4628, 13726, 4538, 13719, 4450, 13712, 4368, 13704, 4288, 13697, 4212, 13690, 4141,
+		13683, 4047, 13676, 3910, 13669, 3786, 13662, 3669, 13656, 3556, 13649, 3447, 13642, 3345, 13635, 3245,
+		13629, 3154, 13622, 3059, 13615, 2895, 13609, 2743, 13603, 2597, 13596, 2460, 13590, 2329, 13583, 2200,
+		13577, 2084, 13571, 1910, 13564, 1691, 13558, 1505, 13552, 1333, 13546, 1167, 13540, 1008, 13533, 859,
+		14994, 16681, 14991, 16443, 14988, 16230, 14985, 16036, 14981, 15891, 14979, 15774, 14975, 15673, 14972, 15590,
+		14969, 15520, 14966, 15452, 14962, 15395, 14958, 15325, 14955, 15232, 14953, 15150, 14950, 15066, 14946, 14996,
+		14943, 14930, 14940, 14866, 14936, 14805, 14934, 14751, 14931, 14700, 14927, 14651, 14924, 14607, 14920, 14560,
+		14918, 14520, 14915, 14481, 14911, 14442, 14908, 14406, 14904, 14374, 14901, 14341, 14898, 14284, 14894, 14223,
+		14891, 14165, 14887, 14108, 14885, 14063, 14881, 14008, 14877, 13959, 14873, 13911, 14869, 13866, 14865, 13821,
+		14862, 13779, 14859, 13740, 14854, 13697, 14850, 13659, 14848, 13624, 14844, 13588, 14840, 13553, 14836, 13520,
+		14832, 13489, 14828, 13456, 14825, 13426, 14820, 13395, 14817, 13368, 14813, 13341, 14809, 13314, 14804, 13260,
+		14800, 13209, 14797, 13161, 14792, 13111, 14788, 13063, 14784, 13019, 14780, 12972, 14776, 12930, 14770, 12885,
+		14767, 12847, 14762, 12804, 14758, 12766, 14753, 12729, 14748, 12690, 14745, 12656, 14740, 12620, 14736, 12587,
+		14731, 12554, 14726, 12519, 14723, 12490, 14718, 12458, 14714, 12429, 14709, 12398, 14705, 12370, 14700, 12342,
+		14694, 12314, 14690, 12286, 14686, 12237, 14680, 12184, 14675, 12131, 14671, 12085, 14666, 12037, 14661, 11992,
+		14656, 11946, 14652, 11904, 14647, 11859, 14642, 11818, 14638, 11778, 14632, 11737, 14628, 11701, 14622, 11660,
+		14617, 11623, 14613, 11587, 14608, 11552, 14603, 11517, 14597, 11482, 14594, 11453, 14588, 11419, 14583, 11388,
+		14578, 11358, 14574, 11328, 14569, 11300, 14563, 11270, 14559, 11222, 14553, 11168, 14548, 11112, 14543, 11061,
+		14538, 11012, 14534, 10966, 14529, 10918, 14524, 10871, 14518, 10821, 14513, 10777, 14508, 10734, 14503, 10693,
+		14499, 10653, 14494, 10613, 14488, 10572, 14483, 10534, 14479, 10497, 14474, 10461, 14469, 10426, 14463, 10390,
+		14459, 10357, 14453, 10322, 14449, 10291, 14444, 10260, 14439, 10219, 14434, 10158, 14429, 10104, 14424, 10044,
+		14419, 9989, 14414, 9937, 14409, 9882, 14404, 9834, 14399, 9782, 14394, 9735, 14389, 9686, 14384, 9642,
+		14379, 9596, 14374, 9552, 14370, 9510, 14365, 9470, 14360, 9431, 14355, 9392, 14350, 9354, 14346, 9316,
+		14341, 9279, 14336, 9245, 14327, 9204, 14318, 9140, 14307, 9071, 14298, 9013, 14288, 8951, 14280, 8894,
+		14270, 8834, 14260, 8779, 14250, 8723, 14242, 8672, 14232, 8619, 14223, 8572, 14213, 8520, 14205, 8476,
+		14195, 8429, 14187, 8387, 14177, 8343, 14168, 8300, 14158, 8258, 14149, 8221, 14140, 8172, 14132, 8099,
+		14123, 8029, 14114, 7956, 14106, 7895, 14096, 7824, 14088, 7765, 14079, 7701, 14070, 7643, 14062, 7587,
+		14053, 7530, 14045, 7478, 14036, 7423, 14028, 7375, 14019, 7323, 14010, 7276, 14002, 7232, 13993, 7187,
+		13985, 7124, 13977, 7038, 13969, 6964, 13961, 6883, 13952, 6807, 13944, 6739, 13936, 6665, 13927, 6596,
+		13919, 6535, 13911, 6469, 13903, 6410, 13896, 6355, 13887, 6296, 13880, 6245, 13872, 6193, 13864, 6138,
+		13856, 6040, 13849, 5954, 13841, 5865, 13833, 5771, 13826, 5698, 13819, 5620, 13811, 5543, 13803, 5466,
+		13795, 5394, 13788, 5327, 13781, 5262, 13773, 5202, 13766, 5143, 13758, 5047, 13751, 4939, 13744, 4838,
+		13737, 4734, 13730, 4639, 13723, 4546, 13715, 4457, 13708, 4376, 13702, 4295, 13695, 4222, 13688, 4148,
+		13681, 4057, 13674, 3929, 13667, 3802, 13661, 3680, 13654, 3568, 13647, 3458, 13640, 3356, 13634, 3259,
+		13627, 3167, 13620, 3077, 13614, 2918, 13608, 2763, 13601, 2611, 13595, 2476, 13589, 2343, 13582, 2216,
+		13576, 2098, 13569, 1923, 13563, 1720, 13557, 1529, 13551, 1346, 13545, 1178, 13539, 1017, 13533, 871,
+		14981, 16661, 14979, 16424, 14976, 16194, 14972, 16004, 14969, 15867, 14967, 15752, 14961, 15650, 14959, 15569,
+		14955, 15497, 14951, 15432, 14950, 15379, 14944, 15289, 14941, 15200, 14939, 15118, 14936, 15039, 14933, 14971,
+		14930, 14902, 14927, 14841, 14923, 14781, 14920, 14729, 14916, 14675, 14913, 14630, 14909, 14582, 14907, 14541,
+		14904, 14499, 14900, 14460, 14897, 14423, 14893, 14389, 14889, 14353, 14887, 14312, 14883, 14249, 14880, 14193,
+		14877, 14135, 14873, 14079, 14870, 14029, 14866, 13979, 14862, 13931, 14858, 13883, 14855, 13839, 14851, 13796,
+		14848, 13755, 14843, 13712, 14840, 13674, 14836, 13637, 14833, 13601, 14829, 13567, 14825, 13532, 14821, 13500,
+		14817, 13467, 14814, 13437, 14809, 13405, 14806, 13379, 14802, 13349, 14798, 13322, 14793, 13276, 14789, 13226,
+		14785, 13174, 14781, 13127, 14777, 13079, 14773, 13032, 14769, 12987, 14765, 12944, 14761, 12902, 14757, 12861,
+		14751, 12817, 14748, 12781, 14743, 12741, 14739, 12706, 14734, 12668, 14730, 12631, 14726, 12599, 14721, 12564,
+		14717, 12531, 14713, 12501, 14708, 12468, 14704, 12438, 14699, 12408, 14695, 12381, 14690, 12351, 14685, 12324,
+		14680, 12297, 14676, 12253, 14671, 12201, 14667, 12153, 14662, 12106, 14657, 12056, 14653, 12011, 14649, 11967,
+		14644, 11923, 14639, 11878, 14635, 11838, 14630, 11796, 14625, 11756, 14620, 11717, 14615, 11676, 14610, 11641,
+		14605, 11604, 14601, 11568, 14595, 11532, 14591, 11500, 14586, 11466, 14581, 11433, 14576, 11402, 14571, 11372,
+		14567, 11342, 14562, 11312, 14557, 11285, 14552, 11251, 14547, 11195, 14542, 11141, 14538, 11092, 14533, 11042,
+		14527, 10987, 14523, 10940, 14518, 10894, 14513, 10849, 14508, 10804, 14504, 10762, 14498, 10717, 14493, 10675,
+		14488, 10635, 14483, 10594, 14478, 10556, 14473, 10518, 14469, 10482, 14464, 10446, 14459, 10412, 14454, 10377,
+		14449, 10343, 14445, 10313, 14440, 10280, 14435, 10249, 14430, 10196, 14425, 10140, 14420, 10081, 14416, 10028,
+		14410, 9972, 14406, 9921, 14400, 9864, 14395, 9816, 14391, 9767, 14386, 9721, 14382, 9674, 14377, 9627,
+		14372, 9587, 14367, 9543, 14362, 9501, 14357, 9459, 14353, 9420, 14348, 9380, 14344, 9345, 14339, 9306,
+		14332, 9271, 14323, 9236, 14315, 9194, 14304, 9127, 14294, 9061, 14285, 9000, 14276, 8940, 14267, 8882,
+		14258, 8826, 14248, 8768, 14239, 8716, 14229, 8662, 14222, 8616, 14211, 8562, 14203, 8514, 14193, 8468,
+		14183, 8421, 14175, 8378, 14167, 8339, 14157, 8296, 14149, 8255, 14140, 8216, 14131, 8165, 14123, 8095,
+		14114, 8021, 14105, 7954, 14097, 7886, 14087, 7820, 14079, 7760, 14070, 7698, 14062, 7641, 14053, 7580,
+		14045, 7528, 14037, 7473, 14028, 7421, 14020, 7373, 14011, 7321, 14004, 7279, 13995, 7231, 13987, 7187,
+		13978, 7120, 13970, 7036, 13962, 6960, 13953, 6879, 13946, 6809, 13938, 6738, 13929, 6665, 13922, 6603,
+		13913, 6535, 13905, 6472, 13898, 6416, 13890, 6354, 13882, 6301, 13875, 6249, 13866, 6193, 13859, 6145,
+		13851, 6050, 13844, 5956, 13836, 5865, 13829, 5789, 13821, 5700, 13812, 5615, 13805, 5541, 13799, 5471,
+		13792, 5402, 13784, 5333, 13776, 5268, 13769, 5207, 13762, 5147, 13755, 5058, 13748, 4950, 13741, 4845,
+		13734, 4744, 13727, 4648, 13719, 4555, 13713, 4469, 13706, 4383, 13699, 4306, 13692, 4229, 13685, 4152,
+		13678, 4071, 13671, 3939, 13664, 3807, 13658, 3695, 13652, 3581, 13645, 3473, 13639, 3376, 13632, 3272,
+		13626, 3179, 13619, 3090, 13613, 2935, 13606, 2774, 13600, 2631, 13594, 2490, 13587, 2356, 13581, 2233,
+		13575, 2112, 13568, 1947, 13563, 1748, 13556, 1553, 13550, 1366, 13544, 1195, 13538, 1035, 13532, 884,
+		14969, 16637, 14967, 16411, 14963, 16158, 14960, 15980, 14956, 15840, 14953, 15728, 14949, 15632, 14947, 15549,
+		14942, 15478, 14939, 15416, 14936, 15357, 14931, 15259, 14928, 15171, 14926, 15087, 14922, 15010, 14919, 14942,
+		14916, 14874, 14913, 14815, 14910, 14760, 14906, 14706, 14902, 14652, 14899, 14607, 14895, 14560, 14893, 14521,
+		14889, 14479, 14886, 14441, 14882, 14404, 14878, 14369, 14875, 14337, 14873, 14278, 14868, 14215, 14865, 14158,
+		14863, 14105, 14859, 14051, 14855, 13996, 14852, 13951, 14847, 13902, 14843, 13856, 14840, 13812, 14837, 13771,
+		14832, 13728, 14829, 13690, 14825, 13651, 14822, 13615, 14818, 13579, 14814, 13544, 14811, 13512, 14806, 13478,
+		14803, 13448, 14799, 13417, 14795, 13389, 14791, 13359, 14787, 13332, 14783, 13295, 14779, 13245, 14774, 13191,
+		14771, 13143, 14766, 13095, 14762, 13048, 14759, 13004, 14755, 12958, 14751, 12917, 14746, 12873, 14742, 12835,
+		14738, 12795, 14733, 12755, 14729, 12718, 14724, 12680, 14720, 12645, 14717, 12612, 14711, 12576, 14708, 12545,
+		14703, 12511, 14699, 12480, 14695, 12451, 14690, 12419, 14686, 12391, 14680, 12361, 14676, 12336, 14672, 12308,
+		14667, 12276, 14662, 12221, 14658, 12173, 14653, 12121, 14649, 12076, 14645, 12031, 14640, 11984, 14635, 11938,
+		14631, 11897, 14626, 11854, 14622, 11812, 14617, 11774, 14612, 11733, 14608, 11695, 14603, 11658, 14598, 11620,
+		14594, 11585, 14589, 11550, 14584, 11517, 14579, 11481, 14575, 11451, 14570, 11417, 14565, 11388, 14560, 11355,
+		14556, 11329, 14550, 11298, 14545, 11269, 14541, 11223, 14537, 11169, 14532, 11119, 14527, 11065, 14523, 11018,
+		14518, 10970, 14513, 10923, 14507, 10871, 14502, 10825, 14498, 10784, 14493, 10741, 14489, 10702, 14483, 10658,
+		14478, 10618, 14473, 10578, 14469, 10540, 14464, 10505, 14460, 10469, 14455, 10432, 14450, 10398, 14445, 10365,
+		14440, 10331, 14436, 10300, 14430, 10267, 14426, 10237, 14421, 10174, 14416, 10120, 14411, 10062, 14406, 10008,
+		14401, 9952, 14397, 9900, 14392, 9851, 14388, 9803, 14383, 9754, 14379, 9706, 14374, 9659, 14369, 9615,
+		14365, 9574, 14359, 9528, 14355, 9489, 14350, 9448, 14346, 9411, 14341, 9370, 14337, 9335, 14327, 9296,
+		14319, 9265, 14308, 9227, 14300, 9176, 14290, 9109, 14281, 9049, 14272, 8988, 14263, 8928, 14253, 8869,
+		14245, 8814, 14235, 8757, 14227, 8706, 14218, 8652, 14209, 8605, 14200, 8554, 14191, 8509, 14182, 8460,
+		14174, 8418, 14165, 8373, 14156, 8332, 14147, 8290, 14139, 8252, 14131, 8213, 14121, 8157, 14113, 8086,
+		14104, 8014, 14096, 7948, 14087, 7879, 14079, 7816, 14070, 7754, 14061, 7692, 14053, 7636, 14044, 7576,
+		14036, 7524, 14028, 7469, 14019, 7419, 14011, 7367, 14003, 7319, 13994, 7273, 13986, 7227, 13979, 7185,
+		13970, 7114, 13962, 7034, 13954, 6954, 13946, 6880, 13939, 6808, 13930, 6733, 13922, 6664, 13915, 6599,
+		13907, 6534, 13899, 6475, 13891, 6413, 13883, 6355, 13876, 6302, 13868, 6245, 13861, 6195, 13854, 6147,
+		13846, 6046, 13839, 5963, 13831, 5872, 13823, 5784, 13816, 5702, 13809, 5627, 13802, 5552, 13794, 5475,
+		13786, 5403, 13779, 5339, 13773, 5275, 13765, 5211, 13758, 5149, 13751, 5063, 13744, 4961, 13737, 4854,
+		13730, 4753, 13723, 4656, 13717, 4566, 13710, 4477, 13703, 4394, 13696, 4314, 13689, 4232, 13682, 4162,
+		13676, 4085, 13668, 3952, 13662, 3827, 13656, 3711, 13650, 3599, 13643, 3487, 13636, 3379, 13629, 3277,
+		13623, 3186, 13617, 3095, 13610, 2948, 13604, 2794, 13598, 2647, 13591, 2498, 13586, 2373, 13580, 2245,
+		13573, 2123, 13567, 1975, 13561, 1756, 13555, 1569, 13549, 1378, 13543, 1209, 13537, 1044, 13531, 896,
+		14958, 16615, 14955, 16393, 14951, 16132, 14948, 15952, 14944, 15816, 14941, 15706, 14937, 15611, 14934, 15530,
+		14929, 15458, 14927, 15399, 14923, 15325, 14918, 15229, 14916, 15140, 14913, 15058, 14909, 14983, 14906, 14915,
+		14902, 14846, 14898, 14787, 14896, 14734, 14892, 14680, 14889, 14633, 14885, 14584, 14882, 14542, 14879, 14501,
+		14875, 14459, 14872, 14422, 14869, 14387, 14864, 14352, 14862, 14307, 14858, 14241, 14856, 14187, 14851, 14126,
+		14848, 14075, 14845, 14024, 14840, 13969, 14837, 13921, 14833, 13875, 14830, 13832, 14825, 13785, 14822, 13744,
+		14818, 13705, 14815, 13667, 14811, 13628, 14808, 13594, 14804, 13558, 14800, 13523, 14796, 13491, 14792, 13459,
+		14788, 13428, 14785, 13399, 14781, 13371, 14776, 13341, 14772, 13314, 14768, 13262, 14764, 13210, 14761, 13162,
+		14756, 13112, 14752, 13065, 14748, 13018, 14745, 12975, 14741, 12932, 14736, 12888, 14732, 12848, 14727, 12806,
+		14724, 12771, 14719, 12731, 14715, 12694, 14711, 12659, 14706, 12622, 14702, 12589, 14698, 12556, 14694, 12523,
+		14690, 12491, 14685, 12460, 14681, 12430, 14677, 12402, 14672, 12372, 14667, 12345, 14662, 12316, 14659, 12292,
+		14654, 12244, 14650, 12194, 14645, 12142, 14641, 12096, 14636, 12047, 14632, 12001, 14628, 11958, 14623, 11914,
+		14618, 11870, 14614, 11830, 14609, 11789, 14604, 11750, 14601, 11714, 14595, 11672, 14591, 11637, 14586, 11600,
+		14581, 11565, 14576, 11529, 14573, 11499, 14568, 11468, 14563, 11433, 14558, 11402, 14554, 11371, 14549, 11343,
+		14545, 11313, 14540, 11285, 14535, 11251, 14530, 11197, 14525, 11141, 14520, 11089, 14516, 11042, 14511, 10990,
+		14506, 10943, 14502, 10897, 14498, 10856, 14493, 10811, 14487, 10764, 14482, 10720, 14478, 10681, 14473, 10639,
+		14469, 10602, 14464, 10564, 14459, 10525, 14455, 10489, 14450, 10452, 14445, 10418, 14440, 10384, 14436, 10351,
+		14431, 10319, 14427, 10288, 14422, 10256, 14417, 10214, 14412, 10155, 14408, 10100, 14403, 10043, 14398, 9988,
+		14394, 9936, 14389, 9885, 14385, 9836, 14380, 9786, 14375, 9737, 14371, 9692, 14366, 9648, 14361, 9603,
+		14356, 9560, 14352, 9517, 14348, 9479, 14343, 9436, 14339, 9399, 14332, 9361, 14323, 9326, 14313, 9288,
+		14304, 9255, 14295, 9221, 14286, 9162, 14277, 9097, 14268, 9036, 14259, 8973, 14251, 8916, 14242, 8858,
+		14233, 8802, 14224, 8747, 14216, 8697, 14207, 8644, 14198, 8596, 14189, 8546, 14181, 8502, 14171, 8453,
+		14163, 8411, 14154, 8367, 14146, 8327, 14136, 8283, 14129, 8245, 14120, 8207, 14111, 8148, 14102, 8073,
+		14095, 8008, 14085, 7938, 14077, 7871, 14069, 7809, 14060, 7746, 14052, 7688, 14044, 7628, 14036, 7574,
+		14027, 7519, 14020, 7467, 14012, 7416, 14003, 7365, 13996, 7320, 13987, 7271, 13980, 7229, 13971, 7182,
+		13964, 7113, 13955, 7033, 13947, 6952, 13940, 6880, 13932, 6803, 13924, 6734, 13917, 6667, 13909, 6600,
+		13901, 6537, 13893, 6474, 13886, 6415, 13878, 6359, 13871, 6301, 13863, 6250, 13856, 6198, 13848, 6144,
+		13840, 6051, 13833, 5963, 13826, 5874, 13818, 5788, 13811, 5710, 13804, 5626, 13796, 5550, 13790, 5481,
+		13783, 5413, 13776, 5343, 13768, 5277, 13762, 5216, 13754, 5154, 13747, 5077, 13740, 4968, 13733, 4861,
+		13727, 4764, 13720, 4669, 13713, 4573, 13706, 4483, 13700, 4402, 13693, 4317, 13686, 4241, 13679, 4169,
+		13673, 4099, 13666, 3968, 13660, 3842, 13654, 3723, 13647, 3604, 13640, 3493, 13634, 3389, 13627, 3287,
+		13621, 3193, 13615, 3106, 13609, 2970, 13602, 2812, 13596, 2661, 13590, 2515, 13584, 2384, 13578, 2257,
+		13572, 2136, 13566, 2002, 13560, 1783, 13554, 1587, 13548, 1395, 13542, 1224, 13536, 1062, 13530, 908,
+		14946, 16597, 14943, 16366, 14940, 16105, 14936, 15927, 14932, 15791, 14929, 15681, 14925, 15589, 14922, 15510,
+		14916, 15438, 14914, 15382, 14910, 15293, 14906, 15198, 14903, 15109, 14901, 15032, 14896, 14956, 14893, 14888,
+		14889, 14822, 14886, 14765, 14883, 14709, 14878, 14657, 14875, 14609, 14872, 14564, 14870, 14523, 14866, 14479,
+		14862, 14441, 14859, 14404, 14855, 14371, 14850, 14333, 14848, 14270, 14844, 14207, 14841, 14153, 14837, 14094,
+		14834, 14042, 14831, 13991, 14827, 13942, 14822, 13890, 14819, 13848, 14815, 13803, 14812, 13761, 14808, 13720,
+		14804, 13680, 14800, 13642, 14797, 13606, 14794, 13571, 14790, 13537, 14786, 13503, 14782, 13471, 14778, 13441,
+		14774, 13409, 14771, 13381, 14767, 13351, 14763, 13326, 14758, 13279, 14754, 13230, 14750, 13176, 14747, 13130,
+		14743, 13082, 14739, 13037, 14735, 12991, 14730, 12945, 14727, 12906, 14722, 12862, 14718, 12823, 14714, 12784,
+		14709, 12742, 14706, 12709, 14701, 12670, 14697, 12635, 14693, 12601, 14689, 12567, 14685, 12536, 14681, 12503,
+		14676, 12472, 14672, 12442, 14668, 12412, 14663, 12382, 14659, 12357, 14654, 12328, 14650, 12302, 14646, 12262,
+		14641, 12212, 14637, 12162, 14633, 12117, 14628, 12066, 14624, 12020, 14620, 11976, 14615, 11930, 14611, 11890,
+		14606, 11848, 14601, 11805, 14597, 11767, 14592, 11728, 14587, 11687, 14583, 11652, 14578, 11616, 14574, 11580,
+		14569, 11545, 14565, 11513, 14561, 11479, 14556, 11447, 14552, 11416, 14547, 11386, 14542, 11355, 14538, 11328,
+		14533, 11300, 14528, 11270, 14524, 11223, 14519, 11171, 14515, 11119, 14509, 11063, 14505, 11017, 14500, 10967,
+		14496, 10923, 14491, 10872, 14486, 10828, 14482, 10790, 14478, 10748, 14474, 10706, 14468, 10661, 14464, 10623,
+		14459, 10584, 14455, 10548, 14450, 10510, 14446, 10474, 14441, 10439, 14436, 10405, 14432, 10373, 14427, 10339,
+		14422, 10306, 14417, 10275, 14413, 10245, 14408, 10191, 14404, 10137, 14399, 10078, 14395, 10026, 14390, 9970,
+		14386, 9919, 14381, 9868, 14377, 9819, 14372, 9769, 14367, 9722, 14363, 9679, 14358, 9633, 14353, 9588,
+		14349, 9548, 14345, 9507, 14341, 9467, 14336, 9427, 14327, 9389, 14317, 9351, 14308, 9315, 14299, 9280,
+		14290, 9245, 14281, 9208, 14273, 9143, 14264, 9082, 14255, 9020, 14247, 8960, 14237, 8901, 14230, 8849,
+		14220, 8789, 14212, 8737, 14203, 8684, 14194, 8634, 14186, 8585, 14178, 8540, 14168, 8491, 14160, 8447,
+		14151, 8402, 14143, 8358, 14135, 8320, 14126, 8278, 14118, 8240, 14109, 8202, 14100, 8136, 14093, 8068,
+		14085, 7999, 14076, 7929, 14068, 7866, 14059, 7800, 14052, 7743, 14044, 7683, 14036, 7626, 14027, 7568,
+		14019, 7514, 14012, 7465, 14004, 7412, 13996, 7363, 13987, 7313, 13979, 7267, 13972, 7225, 13964, 7181,
+		13956, 7116, 13948, 7030, 13941, 6953, 13933, 6878, 13925, 6804, 13918, 6735, 13910, 6663, 13902, 6599,
+		13895, 6535, 13887, 6473, 13880, 6417, 13872, 6358, 13865, 6303, 13858, 6252, 13850, 6198, 13843, 6150,
+		13836, 6062, 13828, 5966, 13822, 5883, 13814, 5796, 13806, 5707, 13799, 5632, 13792, 5559, 13785, 5481,
+		13777, 5408, 13770, 5341, 13764, 5282, 13757, 5222, 13750, 5160, 13743, 5086, 13737, 4977, 13729, 4863,
+		13723, 4768, 13716, 4669, 13709, 4581, 13703, 4492, 13696, 4410, 13690, 4327, 13683, 4251, 13676, 4177,
+		13670, 4106, 13664, 3987, 13657, 3854, 13650, 3727, 13644, 3614, 13638, 3504, 13631, 3397, 13625, 3299,
+		13619, 3207, 13613, 3116, 13606, 2986, 13601, 2824, 13594, 2674, 13588, 2530, 13583, 2396, 13576, 2266,
+		13570, 2149, 13565, 2024, 13559, 1810, 13552, 1600, 13547, 1414, 13541, 1238, 13535, 1071, 13529, 920,
+		14935, 16577, 14932, 16334, 14928, 16079, 14924, 15900, 14920, 15767, 14917, 15658, 14913, 15568, 14910, 15493,
+		14905, 15421, 14902, 15365, 14897, 15259, 14894, 15168, 14890, 15078, 14888, 15002, 14883, 14928, 14879, 14858,
+		14877, 14800, 14873, 14742, 14869, 14686, 14865, 14636, 14862, 14589, 14859, 14543, 14856, 14502, 14851, 14458,
+		14849, 14423, 14845, 14386, 14841, 14352, 14838, 14302, 14835, 14238, 14831, 14178, 14827, 14120, 14824, 14066,
+		14820, 14011, 14817, 13963, 14813, 13917, 14808, 13866, 14805, 13821, 14801, 13779, 14798, 13738, 14794, 13696,
+		14790, 13656, 14787, 13621, 14784, 13585, 14780, 13549, 14776, 13514, 14772, 13484, 14768, 13452, 14764, 13420,
+		14761, 13392, 14756, 13362, 14752, 13332, 14748, 13300, 14745, 13250, 14740, 13195, 14737, 13149, 14733, 13098,
+		14729, 13055, 14725, 13006, 14721, 12962, 14717, 12918, 14713, 12878, 14709, 12836, 14704, 12796, 14700, 12757,
+		14696, 12721, 14692, 12684, 14689, 12651, 14684, 12613, 14680, 12580, 14676, 12546, 14672, 12515, 14668, 12485,
+		14663, 12452, 14659, 12423, 14655, 12395, 14650, 12366, 14646, 12338, 14642, 12313, 14637, 12281, 14633, 12232,
+		14629, 12182, 14625, 12134, 14620, 12084, 14617, 12042, 14611, 11991, 14608, 11952, 14604, 11908, 14598, 11863,
+		14593, 11823, 14590, 11785, 14585, 11744, 14580, 11706, 14576, 11668, 14571, 11630, 14567, 11594, 14563, 11562,
+		14558, 11527, 14554, 11493, 14549, 11462, 14545, 11430, 14540, 11399, 14535, 11368, 14531, 11341, 14526, 11311,
+		14522, 11283, 14517, 11248, 14513, 11196, 14508, 11141, 14504, 11091, 14500, 11047, 14495, 10995, 14491, 10946,
+		14486, 10900, 14481, 10855, 14476, 10810, 14472, 10766, 14467, 10724, 14464, 10687, 14459, 10647, 14455, 10608,
+		14450, 10569, 14445, 10530, 14441, 10494, 14436, 10458, 14431, 10425, 14427, 10390, 14422, 10358, 14418, 10325,
+		14413, 10295, 14408, 10263, 14404, 10229, 14400, 10172, 14395, 10115, 14391, 10058, 14386, 10005, 14382, 9953,
+		14378, 9902, 14373, 9853, 14369, 9803, 14364, 9755, 14359, 9709, 14355, 9664, 14350, 9618, 14346, 9576,
+		14342, 9535, 14337, 9494, 14330, 9454, 14321, 9416, 14312, 9377, 14304, 9343, 14295, 9306, 14286, 9272,
+		14277, 9236, 14268, 9192, 14259, 9125, 14251, 9067, 14243, 9007, 14234, 8948, 14226, 8888, 14217, 8835,
+		14208, 8777, 14200, 8730, 14191, 8675, 14183, 8625, 14173, 8575, 14166, 8531, 14157, 8482, 14149, 8440,
+		14140, 8395, 14132, 8353, 14124, 8312, 14116, 8273, 14107, 8235, 14099, 8197, 14091, 8128, 14083, 8062,
+		14074, 7987, 14067, 7923, 14059, 7860, 14050, 7795, 14043, 7737, 14034, 7676, 14027, 7622, 14019, 7566,
+		14011, 7512, 14003, 7459, 13994, 7406, 13987, 7359, 13979, 7311, 13971, 7265, 13963, 7220, 13956, 7179,
+		13948, 7105, 13940, 7022, 13933, 6950, 13926, 6876, 13919, 6806, 13910, 6733, 13903, 6665, 13895, 6597,
+		13888, 6534, 13881, 6476, 13873, 6415, 13866, 6358, 13859, 6304, 13851, 6248, 13844, 6198, 13837, 6150,
+		13829, 6053, 13823, 5969, 13816, 5882, 13808, 5791, 13801, 5712, 13794, 5637, 13787, 5556, 13781, 5490,
+		13774, 5421, 13767, 5351, 13759, 5284, 13752, 5221, 13746, 5163, 13739, 5093, 13732, 4983, 13726, 4877,
+		13719, 4778, 13713, 4681, 13706, 4587, 13699, 4498, 13693, 4416, 13686, 4332, 13680, 4259, 13673, 4182,
+		13667, 4112, 13661, 3996, 13654, 3864, 13648, 3742, 13641, 3626, 13635, 3513, 13629, 3409, 13623, 3311,
+		13616, 3211, 13611, 3126, 13605, 3008, 13598, 2839, 13592, 2691, 13586, 2546, 13580, 2406, 13575, 2280,
+		13569, 2159, 13562, 2038, 13557, 1832, 13551, 1619, 13545, 1432, 13539, 1251, 13534, 1090, 13528, 932,
+		14924, 16555, 14921, 16305, 14917, 16055, 14913, 15877, 14908, 15743, 14904, 15634, 14901, 15549, 14897, 15473,
+		14893, 15404, 14890, 15332, 14884, 15227, 14881, 15137, 14878, 15051, 14876, 14977, 14871, 14904, 14867, 14835,
+		14865, 14779, 14860, 14715, 14857, 14664, 14853, 14617, 14849, 14567, 14846, 14523, 14842, 14479, 14839, 14442,
+		14836, 14404, 14832, 14368, 14827, 14331, 14825, 14269, 14821, 14205, 14818, 14151, 14813, 14088, 14811, 14037,
+		14807, 13983, 14803, 13933, 14798, 13884, 14795, 13841, 14791, 13794, 14788, 13753, 14784, 13712, 14781, 13674,
+		14778, 13637, 14774, 13598, 14770, 13562, 14767, 13530, 14762, 13496, 14758, 13463, 14755, 13432, 14751, 13403,
+		14747, 13372, 14742, 13344, 14739, 13316, 14734, 13266, 14731, 13214, 14728, 13166, 14723, 13116, 14720, 13070,
+		14716, 13022, 14713, 12981, 14708, 12933, 14703, 12891, 14700, 12852, 14695, 12811, 14691, 12773, 14687, 12734,
+		14683, 12697, 14680, 12662, 14675, 12626, 14672, 12594, 14667, 12558, 14663, 12527, 14659, 12496, 14654, 12463,
+		14650, 12435, 14646, 12405, 14641, 12376, 14637, 12349, 14633, 12322, 14629, 12294, 14625, 12253, 14621, 12200,
+		14617, 12152, 14613, 12105, 14608, 12058, 14604, 12010, 14600, 11969, 14594, 11920, 14591, 11883, 14587, 11842,
+		14582, 11800, 14577, 11759, 14573, 11723, 14568, 11683, 14564, 11647, 14560, 11611, 14556, 11578, 14552, 11542,
+		14548, 11511, 14543, 11477, 14538, 11445, 14534, 11415, 14529, 11383, 14525, 11354, 14520, 11323, 14516, 11299,
+		14511, 11268, 14507, 11219, 14502, 11167, 14499, 11121, 14494, 11066, 14489, 11016, 14485, 10970, 14480, 10925,
+		14476, 10879, 14471, 10833, 14467, 10792, 14463, 10750, 14458, 10708, 14453, 10665, 14449, 10626, 14445, 10589,
+		14441, 10555, 14436, 10515, 14431, 10480, 14426, 10443, 14422, 10410, 14418, 10377, 14413, 10345, 14409, 10313,
+		14405, 10283, 14400, 10253, 14396, 10206, 14392, 10150, 14387, 10091, 14383, 10041, 14378, 9985, 14374, 9934,
+		14369, 9882, 14365, 9833, 14360, 9783, 14356, 9740, 14351, 9692, 14348, 9650, 14343, 9604, 14339, 9563,
+		14332, 9521, 14324, 9482, 14315, 9442, 14307, 9404, 14298, 9369, 14289, 9332, 14280, 9295, 14272, 9262,
+		14264, 9229, 14256, 9179, 14247, 9113, 14238, 9052, 14229, 8990, 14221, 8933, 14212, 8875, 14204, 8823,
+		14196, 8768, 14188, 8718, 14178, 8662, 14171, 8616, 14162, 8565, 14155, 8521, 14146, 8473, 14138, 8431,
+		14129, 8386, 14122, 8349, 14113, 8305, 14105, 8267, 14097, 8227, 14089, 8189, 14081, 8118, 14074, 8050,
+		14065, 7980, 14057, 7915, 14049, 7850, 14041, 7789, 14033, 7729, 14025, 7670, 14018, 7615, 14010, 7556,
+		14002, 7505, 13994, 7453, 13986, 7404, 13979, 7356, 13971, 7308, 13963, 7263, 13956, 7220, 13949, 7178,
+		13941, 7100, 13934, 7030, 13926, 6945, 13918, 6872, 13910, 6797, 13903, 6728, 13896, 6665, 13888, 6595,
+		13882, 6533, 13875, 6473, 13867, 6414, 13860, 6360, 13853, 6303, 13846, 6250, 13839, 6202, 13831, 6149,
+		13825, 6065, 13817, 5971, 13810, 5880, 13803, 5800, 13796, 5718, 13789, 5634, 13782, 5562, 13775, 5489,
+		13768, 5414, 13761, 5351, 13755, 5288, 13749, 5229, 13742, 5166, 13735, 5097, 13728, 4990, 13722, 4883,
+		13716, 4788, 13709, 4688, 13702, 4592, 13696, 4509, 13689, 4421, 13683, 4339, 13676, 4263, 13670, 4189,
+		13664, 4119, 13657, 4002, 13651, 3877, 13645, 3750, 13639, 3635, 13633, 3524, 13626, 3417, 13620, 3317,
+		13615, 3225, 13608, 3130, 13602, 3018, 13596, 2859, 13590, 2705, 13584, 2559, 13578, 2420, 13572, 2291,
+		13567, 2169, 13561, 2052, 13555, 1840, 13549, 1636, 13544, 1448, 13538, 1268, 13533, 1101, 13527, 944,
+		14913, 16537, 14910, 16279, 14905, 16022, 14902, 15853, 14897, 15723, 14893, 15613, 14889, 15527, 14886, 15453,
+		14881, 15387, 14878, 15301, 14872, 15196, 14869, 15106, 14866, 15023, 14862, 14946, 14859, 14876, 14855, 14811,
+		14852, 14751, 14848, 14693, 14844, 14642, 14839, 14591, 14837, 14546, 14833, 14503, 14829, 14460, 14826, 14424,
+		14823, 14385, 14818, 14350, 14814, 14297, 14812, 14237, 14808, 14175, 14805, 14116, 14801, 14059, 14797, 14008,
+		14794, 13957, 14789, 13906, 14785, 13859, 14782, 13817, 14779, 13772, 14775, 13731, 14771, 13688, 14768, 13652,
+		14764, 13613, 14761, 13577, 14757, 13543, 14753, 13508, 14749, 13475, 14745, 13444, 14741, 13413, 14737, 13383,
+		14733, 13354, 14729, 13326, 14725, 13285, 14722, 13238, 14718, 13181, 14715, 13137, 14710, 13084, 14707, 13041,
+		14703, 12994, 14699, 12950, 14695, 12910, 14691, 12868, 14686, 12825, 14682, 12788, 14678, 12747, 14675, 12712,
+		14670, 12673, 14666, 12638, 14662, 12604, 14658, 12571, 14655, 12541, 14650, 12506, 14647, 12476, 14642, 12446,
+		14637, 12415, 14633, 12388, 14629, 12360, 14625, 12331, 14621, 12305, 14617, 12273, 14613, 12220, 14609, 12171,
+		14604, 12121, 14601, 12077, 14596, 12029, 14592, 11984, 14587, 11940, 14583, 11899, 14578, 11854, 14574, 11816,
+		14570, 11778, 14565, 11737, 14561, 11698, 14558, 11664, 14553, 11627, 14548, 11590, 14544, 11556, 14540, 11525,
+		14536, 11490, 14532, 11460, 14527, 11428, 14522, 11396, 14518, 11368, 14514, 11339, 14509, 11309, 14505, 11282,
+		14501, 11248, 14497, 11195, 14492, 11141, 14487, 11088, 14483, 11042, 14479, 10993, 14474, 10948, 14470, 10900,
+		14467, 10860, 14462, 10813, 14457, 10771, 14453, 10728, 14449, 10690, 14444, 10650, 14440, 10610, 14434, 10569,
+		14430, 10533, 14426, 10497, 14422, 10464, 14418, 10431, 14413, 10397, 14409, 10364, 14404, 10330, 14401, 10302,
+		14396, 10269, 14392, 10243, 14387, 10183, 14383, 10129, 14378, 10071, 14374, 10017, 14370, 9965, 14366, 9917,
+		14361, 9865, 14357, 9817, 14352, 9770, 14348, 9724, 14344, 9678, 14340, 9636, 14335, 9591, 14327, 9550,
+		14319, 9510, 14309, 9468, 14301, 9432, 14292, 9394, 14284, 9359, 14275, 9320, 14268, 9288, 14258, 9251,
+		14251, 9220, 14241, 9157, 14234, 9099, 14225, 9036, 14217, 8980, 14208, 8920, 14200, 8863, 14191, 8807,
+		14184, 8758, 14175, 8704, 14167, 8655, 14159, 8605, 14152, 8558, 14143, 8512, 14136, 8469, 14127, 8424,
+		14118, 8379, 14111, 8340, 14102, 8298, 14095, 8261, 14087, 8222, 14079, 8180, 14070, 8105, 14063, 8038,
+		14055, 7970, 14047, 7905, 14039, 7843, 14031, 7781, 14024, 7721, 14017, 7665, 14008, 7606, 14000, 7552,
+		13994, 7501, 13986, 7449, 13978, 7400, 13970, 7352, 13963, 7305, 13956, 7260, 13949, 7218, 13941, 7175,
+		13933, 7099, 13926, 7020, 13918, 6940, 13911, 6869, 13904, 6796, 13897, 6730, 13889, 6659, 13882, 6595,
+		13875, 6534, 13867, 6473, 13861, 6416, 13854, 6358, 13847, 6305, 13840, 6252, 13832, 6199, 13825, 6151,
+		13818, 6064, 13811, 5968, 13805, 5885, 13798, 5800, 13791, 5717, 13784, 5641, 13777, 5568, 13770, 5491,
+		13764, 5424, 13758, 5360, 13751, 5291, 13743, 5226, 13737, 5170, 13731, 5110, 13725, 5000, 13718, 4887,
+		13711, 4790, 13704, 4690, 13698, 4596, 13692, 4510, 13686, 4426, 13679, 4344, 13673, 4267, 13667, 4194,
+		13661, 4123, 13654, 4016, 13648, 3883, 13642, 3761, 13636, 3647, 13630, 3534, 13624, 3431, 13618, 3330,
+		13612, 3234, 13606, 3145, 13600, 3037, 13594, 2875, 13588, 2717, 13582, 2573, 13576, 2435, 13571, 2301,
+		13565, 2178, 13559, 2060, 13554, 1858, 13548, 1661, 13542, 1459, 13537, 1284, 13531, 1116, 13525, 956,
+		14902, 16522, 14899, 16248, 14894, 15995, 14890, 15824, 14886, 15701, 14882, 15593, 14878, 15508, 14874, 15433,
+		14870, 15372, 14867, 15272, 14860, 15167, 14857, 15078, 14854, 14995, 14850, 14919, 14846, 14849, 14843, 14787,
+		14839, 14728, 14836, 14672, 14831, 14621, 14827, 14571, 14824, 14525, 14820, 14482, 14816, 14441, 14814, 14404,
+		14810, 14367, 14806, 14332, 14802, 14264, 14799, 14202, 14795, 14144, 14792, 14085, 14789, 14033, 14785, 13978,
+		14781, 13930, 14776, 13880, 14771, 13830, 14769, 13789, 14766, 13748, 14761, 13704, 14758, 13665, 14754, 13626,
+		14751, 13590, 14748, 13556, 14743, 13520, 14740, 13488, 14735, 13456, 14731, 13423, 14728, 13394, 14723, 13364,
+		14719, 13334, 14716, 13304, 14712, 13252, 14708, 13200, 14705, 13151, 14701, 13103, 14698, 13060, 14693, 13007,
+		14690, 12967, 14685, 12922, 14682, 12881, 14677, 12840, 14674, 12802, 14669, 12760, 14666, 12724, 14662, 12687,
+		14658, 12652, 14653, 12616, 14650, 12583, 14646, 12550, 14641, 12517, 14638, 12487, 14633, 12455, 14629, 12426,
+		14625, 12398, 14620, 12368, 14617, 12341, 14613, 12315, 14608, 12286, 14604, 12235, 14600, 12189, 14596, 12139,
+		14592, 12094, 14588, 12044, 14584, 12001, 14579, 11957, 14575, 11914, 14570, 11871, 14567, 11834, 14562, 11789,
+		14558, 11752, 14554, 11714, 14549, 11676, 14545, 11639, 14542, 11607, 14537, 11571, 14533, 11537, 14529, 11504,
+		14525, 11473, 14519, 11440, 14516, 11410, 14511, 11380, 14507, 11352, 14503, 11322, 14499, 11296, 14495, 11269,
+		14491, 11220, 14486, 11166, 14482, 11119, 14478, 11067, 14473, 11017, 14469, 10973, 14465, 10926, 14460, 10881,
+		14455, 10833, 14451, 10792, 14447, 10750, 14443, 10712, 14438, 10666, 14434, 10630, 14430, 10593, 14426, 10558,
+		14422, 10520, 14417, 10484, 14412, 10447, 14408, 10415, 14404, 10381, 14400, 10350, 14396, 10319, 14392, 10289,
+		14387, 10257, 14383, 10217, 14378, 10159, 14374, 10104, 14370, 10049, 14366, 9999, 14362, 9948, 14357, 9894,
+		14353, 9847, 14349, 9799, 14345, 9755, 14340, 9706, 14337, 9664, 14328, 9619, 14321, 9580, 14311, 9536,
+		14303, 9496, 14294, 9456, 14287, 9422, 14278, 9381, 14270, 9346, 14261, 9311, 14253, 9277, 14244, 9242,
+		14236, 9205, 14228, 9144, 14220, 9083, 14211, 9017, 14204, 8963, 14195, 8906, 14188, 8853, 14179, 8796,
+		14171, 8744, 14163, 8691, 14156, 8646, 14148, 8595, 14140, 8550, 14131, 8502, 14123, 8460, 14115, 8415,
+		14108, 8374, 14100, 8333, 14092, 8293, 14084, 8254, 14076, 8217, 14069, 8170, 14061, 8099, 14053, 8030,
+		14045, 7963, 14037, 7896, 14029, 7833, 14022, 7774, 14015, 7717, 14007, 7658, 14000, 7600, 13993, 7551,
+		13984, 7493, 13977, 7444, 13969, 7395, 13962, 7347, 13955, 7304, 13948, 7258, 13940, 7214, 13933, 7171,
+		13926, 7097, 13918, 7014, 13911, 6938, 13903, 6864, 13896, 6790, 13889, 6725, 13882, 6654, 13874, 6593,
+		13867, 6528, 13860, 6470, 13854, 6414, 13847, 6356, 13840, 6303, 13833, 6249, 13826, 6198, 13819, 6152,
+		13812, 6059, 13805, 5973, 13799, 5885, 13792, 5799, 13785, 5722, 13778, 5640, 13771, 5564, 13765, 5495,
+		13759, 5423, 13752, 5355, 13746, 5293, 13740, 5235, 13733, 5175, 13726, 5109, 13719, 4997, 13713, 4895,
+		13707, 4797, 13701, 4700, 13694, 4603, 13688, 4520, 13682, 4433, 13676, 4352, 13670, 4277, 13663, 4200,
+		13657, 4128, 13651, 4028, 13645, 3895, 13639, 3776, 13633, 3662, 13627, 3547, 13620, 3436, 13615, 3339,
+		13609, 3242, 13603, 3149, 13597, 3052, 13592, 2890, 13586, 2735, 13580, 2589, 13574, 2446, 13568, 2312,
+		13563, 2186, 13557, 2073, 13551, 1876, 13546, 1674, 13541, 1481, 13535, 1298, 13529, 1124, 13524, 967,
+		14892, 16505, 14888, 16214, 14883, 15971, 14880, 15802, 14876, 15681, 14870, 15573, 14867, 15489, 14862, 15417,
+		14858, 15352, 14854, 15234, 14849, 15136, 14846, 15049, 14843, 14968, 14838, 14892, 14835, 14828, 14831, 14763,
+		14827, 14704, 14824, 14651, 14819, 14598, 14815, 14550, 14812, 14508, 14809, 14464, 14805, 14424, 14801, 14386,
+		14797, 14350, 14792, 14295, 14789, 14231, 14786, 14170, 14783, 14113, 14779, 14056, 14776, 14004, 14772, 13951,
+		14768, 13901, 14764, 13856, 14760, 13808, 14756, 13763, 14753, 13724, 14749, 13684, 14746, 13645, 14741, 13604,
+		14739, 13571, 14735, 13536, 14731, 13501, 14727, 13468, 14723, 13436, 14719, 13406, 14715, 13376, 14711, 13347,
+		14707, 13319, 14704, 13275, 14700, 13222, 14696, 13168, 14693, 13124, 14689, 13073, 14684, 13025, 14681, 12985,
+		14677, 12938, 14673, 12896, 14668, 12853, 14665, 12816, 14661, 12775, 14657, 12738, 14653, 12699, 14649, 12664,
+		14646, 12630, 14642, 12597, 14637, 12560, 14633, 12530, 14629, 12496, 14625, 12467, 14621, 12437, 14616, 12407,
+		14612, 12379, 14609, 12352, 14604, 12323, 14601, 12298, 14597, 12259, 14593, 12207, 14588, 12157, 14584, 12111,
+		14580, 12064, 14577, 12022, 14572, 11973, 14568, 11931, 14563, 11890, 14559, 11847, 14555, 11806, 14552, 11772,
+		14547, 11730, 14543, 11692, 14538, 11654, 14534, 11620, 14530, 11584, 14526, 11553, 14522, 11519, 14517, 11485,
+		14513, 11455, 14509, 11424, 14505, 11393, 14501, 11363, 14497, 11336, 14492, 11308, 14488, 11278, 14484, 11245,
+		14480, 11191, 14476, 11140, 14471, 11086, 14467, 11043, 14463, 10994, 14459, 10949, 14454, 10899, 14451, 10859,
+		14446, 10816, 14442, 10771, 14437, 10728, 14434, 10691, 14429, 10651, 14425, 10611, 14420, 10573, 14416, 10537,
+		14412, 10503, 14408, 10469, 14404, 10435, 14399, 10398, 14395, 10368, 14391, 10335, 14387, 10305, 14383, 10275,
+		14378, 10246, 14374, 10193, 14370, 10140, 14366, 10082, 14362, 10031, 14358, 9978, 14353, 9928, 14349, 9877,
+		14345, 9830, 14341, 9782, 14337, 9738, 14330, 9691, 14322, 9649, 14313, 9605, 14305, 9564, 14296, 9522,
+		14288, 9484, 14280, 9446, 14271, 9407, 14263, 9371, 14256, 9336, 14247, 9301, 14239, 9266, 14231, 9234,
+		14223, 9188, 14214, 9123, 14207, 9064, 14199, 9006, 14192, 8949, 14183, 8892, 14175, 8837, 14167, 8784,
+		14159, 8732, 14151, 8681, 14144, 8635, 14135, 8584, 14128, 8539, 14120, 8493, 14112, 8450, 14104, 8405,
+		14096, 8364, 14088, 8323, 14082, 8287, 14073, 8246, 14066, 8210, 14058, 8155, 14050, 8087, 14043, 8020,
+		14035, 7953, 14028, 7888, 14021, 7828, 14013, 7764, 14005, 7708, 13998, 7649, 13991, 7596, 13983, 7543,
+		13975, 7488, 13969, 7441, 13961, 7390, 13954, 7344, 13946, 7295, 13939, 7255, 13931, 7208, 13924, 7166,
+		13917, 7087, 13910, 7005, 13903, 6935, 13896, 6858, 13889, 6792, 13882, 6720, 13875, 6656, 13868, 6591,
+		13861, 6528, 13855, 6473, 13848, 6411, 13841, 6357, 13833, 6300, 13826, 6248, 13821, 6201, 13813, 6150,
+		13807, 6066, 13800, 5975, 13793, 5884, 13786, 5801, 13780, 5721, 13774, 5641, 13767, 5572, 13760, 5495,
+		13753, 5425, 13747, 5361, 13741, 5296, 13734, 5231, 13727, 5172, 13722, 5122, 13716, 5011, 13709, 4902,
+		13703, 4804, 13697, 4705, 13690, 4615, 13685, 4528, 13678, 4438, 13672, 4359, 13666, 4278, 13660, 4206,
+		13653, 4132, 13648, 4039, 13642, 3909, 13636, 3787, 13630, 3669, 13624, 3554, 13618, 3448, 13612, 3349,
+		13606, 3248, 13601, 3160, 13595, 3072, 13589, 2903, 13583, 2748, 13578, 2599, 13572, 2457, 13566, 2324,
+		13561, 2202, 13556, 2087, 13549, 1893, 13544, 1685, 13539, 1496, 13533, 1313, 13527, 1137, 13522, 978,
+		14882, 16486, 14878, 16184, 14872, 15945, 14869, 15781, 14864, 15654, 14859, 15551, 14856, 15473, 14851, 15398,
+		14848, 15324, 14843, 15205, 14838, 15112, 14835, 15023, 14832, 14945, 14827, 14868, 14823, 14800, 14819, 14738,
+		14815, 14679, 14813, 14632, 14806, 14576, 14804, 14534, 14800, 14488, 14796, 14445, 14793, 14407, 14789, 14368,
+		14784, 14333, 14781, 14263, 14778, 14200, 14773, 14139, 14771, 14083, 14767, 14027, 14763, 13973, 14760, 13927,
+		14755, 13875, 14751, 13830, 14748, 13785, 14744, 13740, 14740, 13698, 14737, 13660, 14733, 13621, 14730, 13584,
+		14725, 13547, 14722, 13513, 14718, 13482, 14714, 13448, 14710, 13417, 14706, 13389, 14702, 13357, 14699, 13330,
+		14695, 13297, 14691, 13240, 14687, 13188, 14684, 13142, 14680, 13090, 14677, 13048, 14672, 12998, 14669, 12956,
+		14664, 12911, 14660, 12870, 14656, 12829, 14652, 12787, 14649, 12752, 14644, 12713, 14640, 12676, 14637, 12641,
+		14633, 12608, 14628, 12572, 14625, 12542, 14622, 12510, 14617, 12479, 14612, 12446, 14608, 12418, 14605, 12390,
+		14601, 12362, 14597, 12336, 14593, 12309, 14588, 12274, 14585, 12225, 14581, 12178, 14577, 12130, 14573, 12083,
+		14569, 12037, 14564, 11990, 14561, 11951, 14556, 11904, 14552, 11864, 14548, 11824, 14544, 11784, 14540, 11745,
+		14536, 11709, 14532, 11671, 14528, 11637, 14524, 11600, 14519, 11566, 14515, 11532, 14511, 11500, 14507, 11470,
+		14502, 11436, 14499, 11407, 14495, 11379, 14491, 11350, 14486, 11318, 14482, 11292, 14478, 11266, 14474, 11212,
+		14469, 11161, 14465, 11111, 14461, 11064, 14456, 11012, 14452, 10967, 14449, 10925, 14445, 10881, 14440, 10833,
+		14436, 10793, 14432, 10752, 14429, 10713, 14424, 10669, 14420, 10632, 14416, 10596, 14412, 10560, 14407, 10520,
+		14403, 10485, 14399, 10451, 14395, 10418, 14391, 10388, 14387, 10355, 14382, 10322, 14378, 10292, 14374, 10262,
+		14370, 10227, 14366, 10171, 14362, 10116, 14358, 10062, 14354, 10011, 14349, 9957, 14345, 9907, 14341, 9858,
+		14337, 9812, 14331, 9767, 14322, 9719, 14315, 9676, 14306, 9632, 14298, 9593, 14288, 9548, 14281, 9511,
+		14273, 9471, 14265, 9434, 14257, 9394, 14250, 9361, 14241, 9324, 14234, 9292, 14225, 9256, 14218, 9225,
+		14210, 9169, 14203, 9111, 14194, 9046, 14186, 8990, 14178, 8930, 14171, 8878, 14163, 8824, 14155, 8771,
+		14147, 8719, 14139, 8669, 14131, 8621, 14123, 8573, 14116, 8528, 14109, 8485, 14101, 8441, 14093, 8398,
+		14086, 8357, 14078, 8316, 14071, 8279, 14063, 8241, 14055, 8204, 14048, 8143, 14040, 8073, 14033, 8008,
+		14026, 7944, 14018, 7878, 14011, 7818, 14003, 7758, 13996, 7702, 13987, 7639, 13981, 7591, 13973, 7532,
+		13966, 7484, 13960, 7435, 13952, 7384, 13945, 7339, 13938, 7293, 13931, 7250, 13923, 7204, 13917, 7161,
+		13910, 7081, 13903, 7007, 13895, 6925, 13889, 6855, 13882, 6786, 13875, 6716, 13868, 6651, 13861, 6588,
+		13855, 6530, 13847, 6466, 13841, 6410, 13834, 6355, 13827, 6298, 13821, 6250, 13814, 6198, 13807, 6150,
+		13800, 6066, 13794, 5970, 13788, 5892, 13781, 5805, 13774, 5722, 13768, 5647, 13761, 5570, 13754, 5495,
+		13749, 5432, 13743, 5363, 13736, 5297, 13730, 5239, 13724, 5179, 13717, 5118, 13710, 5007, 13704, 4907,
+		13698, 4806, 13692, 4710, 13687, 4617, 13680, 4528, 13674, 4441, 13668, 4361, 13662, 4285, 13656, 4209,
+		13650, 4140, 13644, 4048, 13638, 3919, 13632, 3794, 13627, 3677, 13621, 3565, 13614, 3453, 13609, 3356,
+		13604, 3258, 13597, 3165, 13592, 3079, 13587, 2924, 13581, 2760, 13575, 2611, 13570, 2470, 13564, 2334,
+		13559, 2212, 13553, 2092, 13548, 1920, 13542, 1704, 13537, 1508, 13531, 1324, 13526, 1156, 13521, 990,
+		14871, 16463, 14868, 16156, 14862, 15917, 14858, 15760, 14854, 15633, 14849, 15533, 14846, 15455, 14840, 15383,
+		14837, 15290, 14832, 15175, 14828, 15083, 14824, 14996, 14821, 14920, 14816, 14844, 14812, 14778, 14808, 14716,
+		14805, 14661, 14800, 14607, 14796, 14559, 14792, 14512, 14788, 14467, 14785, 14427, 14781, 14389, 14778, 14353,
+		14772, 14297, 14769, 14234, 14766, 14172, 14762, 14113, 14758, 14053, 14755, 14002, 14751, 13945, 14747, 13899,
+		14742, 13849, 14739, 13805, 14736, 13761, 14732, 13720, 14727, 13674, 14724, 13638, 14721, 13600, 14718, 13566,
+		14713, 13528, 14709, 13495, 14705, 13462, 14701, 13429, 14698, 13400, 14694, 13369, 14690, 13342, 14686, 13313,
+		14683, 13261, 14680, 13212, 14676, 13158, 14672, 13110, 14668, 13063, 14664, 13016, 14660, 12971, 14656, 12928,
+		14652, 12887, 14647, 12841, 14644, 12806, 14640, 12765, 14635, 12723, 14633, 12692, 14629, 12655, 14625, 12621,
+		14621, 12587, 14617, 12552, 14613, 12522, 14609, 12489, 14605, 12460, 14601, 12431, 14596, 12400, 14593, 12372,
+		14589, 12345, 14585, 12318, 14581, 12293, 14578, 12249, 14573, 12195, 14569, 12146, 14566, 12100, 14561, 12055,
+		14557, 12009, 14553, 11967, 14548, 11921, 14545, 11883, 14541, 11839, 14537, 11800, 14533, 11762, 14529, 11725,
+		14525, 11685, 14521, 11650, 14517, 11615, 14513, 11580, 14508, 11546, 14504, 11515, 14500, 11482, 14496, 11450,
+		14493, 11423, 14488, 11391, 14484, 11361, 14480, 11333, 14477, 11306, 14472, 11278, 14468, 11238, 14464, 11190,
+		14459, 11136, 14455, 11085, 14451, 11039, 14447, 10992, 14443, 10944, 14438, 10898, 14434, 10856, 14430, 10812,
+		14426, 10770, 14423, 10730, 14419, 10691, 14415, 10654, 14410, 10614, 14406, 10577, 14402, 10541, 14399, 10510,
+		14394, 10471, 14390, 10437, 14386, 10401, 14382, 10372, 14378, 10339, 14374, 10310, 14370, 10280, 14366, 10251,
+		14361, 10202, 14358, 10149, 14353, 10093, 14350, 10042, 14345, 9989, 14342, 9940, 14338, 9890, 14332, 9842,
+		14324, 9795, 14316, 9749, 14307, 9703, 14298, 9661, 14291, 9618, 14283, 9580, 14274, 9535, 14267, 9497,
+		14259, 9458, 14252, 9421, 14244, 9385, 14236, 9349, 14228, 9314, 14220, 9281, 14212, 9247, 14205, 9217,
+		14196, 9151, 14189, 9092, 14181, 9031, 14174, 8977, 14165, 8917, 14158, 8865, 14150, 8809, 14143, 8759,
+		14134, 8706, 14127, 8658, 14119, 8608, 14113, 8566, 14105, 8517, 14097, 8474, 14089, 8429, 14082, 8390,
+		14075, 8349, 14067, 8310, 14059, 8270, 14052, 8234, 14044, 8195, 14037, 8131, 14030, 8063, 14023, 7998,
+		14015, 7930, 14007, 7868, 14000, 7806, 13993, 7748, 13987, 7693, 13979, 7636, 13972, 7582, 13965, 7528,
+		13959, 7479, 13951, 7427, 13944, 7381, 13936, 7332, 13930, 7290, 13923, 7244, 13916, 7202, 13909, 7156,
+		13902, 7074, 13895, 6997, 13887, 6922, 13882, 6856, 13874, 6778, 13868, 6717, 13861, 6649, 13854, 6586,
+		13847, 6524, 13840, 6462, 13834, 6410, 13827, 6352, 13821, 6299, 13814, 6248, 13807, 6198, 13801, 6150,
+		13794, 6061, 13788, 5973, 13782, 5887, 13775, 5800, 13769, 5727, 13762, 5645, 13756, 5570, 13749, 5498,
+		13743, 5426, 13736, 5361, 13731, 5301, 13724, 5236, 13718, 5176, 13712, 5121, 13706, 5017, 13700, 4913,
+		13694, 4807, 13688, 4713, 13682, 4623, 13676, 4533, 13670, 4448, 13664, 4367, 13658, 4290, 13652, 4215,
+		13647, 4144, 13641, 4055, 13634, 3923, 13629, 3797, 13623, 3685, 13617, 3565, 13612, 3462, 13606, 3362,
+		13600, 3262, 13595, 3176, 13589, 3085, 13583, 2931, 13578, 2773, 13572, 2623, 13567, 2481, 13562, 2350,
+		13556, 2220, 13551, 2103, 13545, 1938, 13540, 1730, 13534, 1523, 13529, 1339, 13524, 1166, 13519, 1001,
+		14861, 16445, 14858, 16127, 14852, 15892, 14848, 15740, 14844, 15615, 14839, 15515, 14835, 15436, 14830, 15369,
+		14826, 15257, 14820, 15146, 14817, 15057, 14813, 14968, 14809, 14894, 14805, 14822, 14800, 14754, 14796, 14693,
+		14793, 14637, 14789, 14588, 14784, 14538, 14781, 14494, 14777, 14451, 14773, 14410, 14770, 14372, 14766, 14337,
+		14761, 14267, 14758, 14204, 14754, 14140, 14751, 14083, 14746, 14023, 14742, 13970, 14739, 13921, 14734, 13868,
+		14730, 13824, 14727, 13781, 14724, 13737, 14720, 13697, 14716, 13656, 14712, 13615, 14709, 13578, 14705, 13542,
+		14702, 13509, 14697, 13475, 14693, 13443, 14690, 13412, 14685, 13381, 14682, 13352, 14678, 13324, 14674, 13281,
+		14671, 13229, 14667, 13178, 14663, 13129, 14659, 13079, 14656, 13035, 14651, 12986, 14648, 12945, 14643, 12900,
+		14639, 12855, 14636, 12820, 14631, 12778, 14629, 12742, 14625, 12705, 14620, 12665, 14617, 12634, 14613, 12598,
+		14609, 12565, 14605, 12533, 14601, 12500, 14597, 12472, 14593, 12441, 14589, 12411, 14586, 12385, 14581, 12354,
+		14577, 12327, 14574, 12302, 14570, 12263, 14566, 12215, 14563, 12170, 14558, 12116, 14554, 12070, 14550, 12026,
+		14545, 11981, 14541, 11937, 14537, 11897, 14533, 11854, 14530, 11817, 14526, 11776, 14522, 11739, 14518, 11701,
+		14515, 11667, 14510, 11629, 14506, 11594, 14502, 11562, 14497, 11527, 14494, 11496, 14490, 11465, 14486, 11434,
+		14481, 11402, 14478, 11375, 14475, 11347, 14470, 11317, 14466, 11290, 14462, 11264, 14458, 11210, 14453, 11159,
+		14450, 11110, 14446, 11064, 14441, 11011, 14437, 10966, 14433, 10923, 14430, 10879, 14425, 10832, 14421, 10792,
+		14418, 10753, 14413, 10712, 14409, 10670, 14405, 10632, 14401, 10595, 14397, 10559, 14393, 10523, 14389, 10487,
+		14385, 10454, 14382, 10425, 14378, 10392, 14373, 10358, 14369, 10325, 14365, 10294, 14361, 10267, 14358, 10238,
+		14353, 10180, 14349, 10124, 14345, 10073, 14341, 10019, 14337, 9969, 14331, 9917, 14324, 9870, 14316, 9823,
+		14308, 9777, 14298, 9729, 14292, 9690, 14282, 9643, 14275, 9603, 14268, 9561, 14260, 9521, 14253, 9483,
+		14246, 9447, 14237, 9406, 14230, 9375, 14221, 9336, 14215, 9304, 14206, 9270, 14200, 9240, 14190, 9191,
+		14184, 9137, 14175, 9071, 14168, 9017, 14159, 8953, 14153, 8905, 14145, 8848, 14137, 8796, 14130, 8744,
+		14123, 8696, 14115, 8646, 14109, 8602, 14101, 8551, 14094, 8509, 14085, 8464, 14079, 8424, 14071, 8380,
+		14064, 8340, 14055, 8299, 14049, 8264, 14041, 8227, 14035, 8192, 14027, 8119, 14019, 8049, 14012, 7985,
+		14005, 7920, 13998, 7860, 13991, 7797, 13984, 7740, 13977, 7683, 13970, 7627, 13963, 7571, 13957, 7523,
+		13948, 7471, 13942, 7423, 13935, 7375, 13928, 7329, 13921, 7285, 13914, 7240, 13908, 7198, 13900, 7145,
+		13893, 7069, 13886, 6988, 13880, 6919, 13873, 6845, 13866, 6774, 13860, 6709, 13853, 6642, 13847, 6584,
+		13840, 6519, 13834, 6463, 13827, 6405, 13821, 6349, 13814, 6299, 13808, 6247, 13801, 6198, 13795, 6148,
+		13789, 6063, 13782, 5974, 13776, 5885, 13770, 5807, 13763, 5724, 13757, 5647, 13751, 5576, 13744, 5501,
+		13739, 5434, 13733, 5370, 13726, 5302, 13720, 5241, 13715, 5187, 13707, 5125, 13701, 5021, 13696, 4916,
+		13690, 4819, 13684, 4722, 13678, 4629, 13672, 4538, 13666, 4454, 13660, 4373, 13654, 4294, 13649, 4221,
+		13642, 4148, 13637, 4064, 13631, 3931, 13625, 3812, 13619, 3690, 13614, 3575, 13608, 3472, 13603, 3368,
+		13598, 3273, 13592, 3180, 13586, 3092, 13581, 2944, 13575, 2788, 13570, 2637, 13564, 2492, 13559, 2360,
+		13553, 2230, 13549, 2116, 13543, 1952, 13538, 1743, 13532, 1539, 13527, 1352, 13522, 1175, 13517, 1012,
+		14852, 16429, 14847, 16094, 14842, 15871, 14838, 15719, 14834, 15599, 14828, 15500, 14825, 15422, 14819, 15346,
+		14815, 15225, 14810, 15120, 14805, 15026, 14802, 14943, 14798, 14867, 14794, 14797, 14790, 14733, 14785, 14672,
+		14782, 14619, 14777, 14567, 14774, 14519, 14769, 14475, 14766, 14433, 14762, 14394, 14758, 14355, 14754, 14306,
+		14750, 14236, 14747, 14173, 14743, 14113, 14739, 14056, 14735, 13998, 14732, 13945, 14727, 13897, 14723, 13844,
+		14719, 13801, 14715, 13754, 14712, 13713, 14708, 13673, 14705, 13634, 14701, 13594, 14697, 13558, 14694, 13523,
+		14690, 13491, 14685, 13456, 14681, 13424, 14677, 13393, 14673, 13363, 14670, 13335, 14666, 13302, 14662, 13249,
+		14659, 13198, 14655, 13147, 14651, 13099, 14648, 13051, 14644, 13005, 14640, 12962, 14634, 12912, 14631, 12874,
+		14627, 12831, 14623, 12791, 14621, 12756, 14616, 12715, 14613, 12681, 14609, 12645, 14605, 12610, 14601, 12578,
+		14598, 12545, 14593, 12511, 14589, 12480, 14585, 12450, 14582, 12423, 14578, 12393, 14574, 12365, 14571, 12339,
+		14566, 12311, 14563, 12284, 14559, 12233, 14554, 12183, 14551, 12136, 14546, 12090, 14542, 12040, 14539, 11999,
+		14534, 11955, 14530, 11914, 14526, 11870, 14523, 11832, 14519, 11790, 14516, 11755, 14511, 11717, 14507, 11680,
+		14503, 11643, 14500, 11611, 14495, 11575, 14491, 11540, 14488, 11510, 14483, 11475, 14479, 11446, 14475, 11416,
+		14472, 11387, 14468, 11357, 14464, 11329, 14460, 11303, 14456, 11275, 14451, 11232, 14448, 11184, 14444, 11132,
+		14439, 11081, 14435, 11032, 14432, 10992, 14428, 10944, 14424, 10901, 14420, 10855, 14416, 10813, 14412, 10771,
+		14408, 10730, 14404, 10693, 14400, 10654, 14396, 10614, 14392, 10578, 14388, 10541, 14385, 10508, 14380, 10470,
+		14376, 10437, 14372, 10404, 14369, 10375, 14365, 10345, 14361, 10315, 14357, 10284, 14353, 10254, 14349, 10207,
+		14345, 10157, 14341, 10103, 14337, 10051, 14331, 9999, 14324, 9949, 14315, 9898, 14308, 9852, 14299, 9803,
+		14292, 9760, 14284, 9715, 14276, 9671, 14269, 9629, 14262, 9589, 14253, 9546, 14246, 9509, 14238, 9468,
+		14231, 9433, 14222, 9396, 14216, 9363, 14208, 9325, 14201, 9294, 14193, 9260, 14186, 9228, 14177, 9175,
+		14170, 9118, 14162, 9056, 14155, 9000, 14148, 8941, 14141, 8891, 14132, 8832, 14126, 8784, 14118, 8730,
+		14111, 8683, 14104, 8633, 14097, 8589, 14088, 8541, 14081, 8498, 14074, 8453, 14067, 8413, 14059, 8371,
+		14052, 8331, 14045, 8292, 14038, 8256, 14030, 8217, 14024, 8179, 14016, 8106, 14010, 8041, 14002, 7972,
+		13996, 7911, 13989, 7850, 13982, 7789, 13975, 7731, 13968, 7675, 13960, 7616, 13953, 7566, 13947, 7517,
+		13939, 7465, 13933, 7417, 13926, 7369, 13920, 7327, 13912, 7278, 13906, 7236, 13899, 7195, 13892, 7139,
+		13886, 7063, 13879, 6986, 13874, 6918, 13866, 6839, 13860, 6776, 13853, 6706, 13847, 6644, 13840, 6579,
+		13833, 6518, 13827, 6461, 13820, 6402, 13814, 6349, 13807, 6294, 13801, 6245, 13795, 6195, 13788, 6146,
+		13782, 6064, 13775, 5967, 13769, 5886, 13763, 5802, 13757, 5722, 13751, 5648, 13744, 5569, 13738, 5501,
+		13733, 5433, 13726, 5362, 13720, 5301, 13714, 5243, 13708, 5180, 13703, 5126, 13698, 5032, 13691, 4923,
+		13685, 4817, 13679, 4722, 13673, 4631, 13667, 4539, 13661, 4458, 13656, 4377, 13650, 4301, 13644, 4225,
+		13638, 4151, 13633, 4076, 13627, 3945, 13622, 3820, 13616, 3698, 13611, 3589, 13605, 3477, 13599, 3375,
+		13594, 3279, 13588, 3184, 13583, 3097, 13577, 2953, 13572, 2798, 13567, 2649, 13562, 2508, 13556, 2370,
+		13551, 2240, 13546, 2124, 13541, 1973, 13535, 1754, 13530, 1553, 13525, 1367, 13520, 1189, 13515, 1024,
+		14842, 16414, 14837, 16068, 14833, 15850, 14829, 15697, 14824, 15578, 14818, 15483, 14815, 15408, 14809, 15314,
+		14805, 15191, 14800, 15094, 14795, 15001, 14792, 14919, 14787, 14842, 14783, 14772, 14779, 14710, 14776, 14656,
+		14771, 14598, 14766, 14546, 14763, 14503, 14759, 14456, 14756, 14417, 14751, 14376, 14748, 14340, 14743, 14275,
+		14739, 14209, 14735, 14143, 14732, 14086, 14727, 14025, 14724, 13972, 14720, 13920, 14716, 13870, 14711, 13822,
+		14707, 13773, 14704, 13733, 14700, 13689, 14696, 13648, 14694, 13614, 14690, 13576, 14686, 13538, 14682, 13503,
+		14677, 13470, 14674, 13438, 14670, 13406, 14666, 13377, 14662, 13347, 14659, 13319, 14655, 13270, 14651, 13219,
+		14648, 13168, 14643, 13117, 14640, 13068, 14636, 13022, 14632, 12977, 14627, 12932, 14624, 12893, 14620, 12847,
+		14616, 12809, 14613, 12769, 14609, 12733, 14606, 12695, 14602, 12658, 14597, 12623, 14593, 12589, 14590, 12556,
+		14586, 12524, 14582, 12494, 14578, 12462, 14574, 12433, 14569, 12402, 14567, 12378, 14563, 12348, 14559, 12322,
+		14556, 12296, 14551, 12252, 14547, 12204, 14543, 12152, 14539, 12105, 14535, 12060, 14532, 12016, 14527, 11969,
+		14523, 11929, 14520, 11888, 14516, 11847, 14512, 11807, 14509, 11770, 14504, 11729, 14500, 11693, 14497, 11659,
+		14493, 11624, 14488, 11587, 14485, 11555, 14481, 11522, 14476, 11488, 14474, 11461, 14469, 11427, 14465, 11398,
+		14462, 11370, 14458, 11343, 14453, 11312, 14449, 11286, 14445, 11257, 14441, 11203, 14437, 11152, 14433, 11106,
+		14430, 11057, 14426, 11009, 14422, 10963, 14418, 10921, 14415, 10876, 14411, 10832, 14406, 10789, 14403, 10752,
+		14399, 10712, 14395, 10671, 14391, 10633, 14388, 10600, 14384, 10562, 14380, 10526, 14375, 10489, 14372, 10457,
+		14368, 10423, 14364, 10392, 14360, 10358, 14356, 10328, 14352, 10297, 14350, 10274, 14345, 10243, 14341, 10189,
+		14337, 10132, 14330, 10079, 14322, 10028, 14315, 9978, 14308, 9928, 14300, 9880, 14292, 9832, 14284, 9787,
+		14275, 9739, 14269, 9698, 14261, 9654, 14254, 9614, 14246, 9569, 14240, 9535, 14231, 9492, 14224, 9457,
+		14216, 9419, 14209, 9385, 14201, 9349, 14194, 9316, 14186, 9280, 14179, 9249, 14171, 9217, 14164, 9159,
+		14157, 9095, 14150, 9039, 14142, 8981, 14135, 8927, 14127, 8871, 14121, 8820, 14113, 8768, 14106, 8718,
+		14098, 8668, 14091, 8621, 14084, 8575, 14076, 8530, 14070, 8488, 14062, 8444, 14055, 8403, 14048, 8361,
+		14041, 8323, 14034, 8285, 14027, 8247, 14020, 8211, 14013, 8163, 14006, 8093, 14000, 8029, 13992, 7960,
+		13986, 7901, 13979, 7838, 13972, 7780, 13965, 7721, 13958, 7668, 13951, 7612, 13945, 7561, 13938, 7508,
+		13931, 7457, 13924, 7409, 13918, 7363, 13911, 7318, 13903, 7272, 13897, 7231, 13891, 7189, 13885, 7134,
+		13878, 7054, 13872, 6981, 13865, 6906, 13858, 6836, 13852, 6767, 13845, 6699, 13839, 6639, 13832, 6572,
+		13825, 6513, 13819, 6457, 13813, 6402, 13807, 6346, 13801, 6292, 13794, 6243, 13788, 6191, 13782, 6149,
+		13775, 6056, 13769, 5967, 13764, 5885, 13757, 5799, 13751, 5725, 13745, 5644, 13740, 5575, 13733, 5503,
+		13727, 5431, 13721, 5367, 13715, 5303, 13709, 5241, 13704, 5184, 13697, 5128, 13691, 5018, 13685, 4914,
+		13680, 4823, 13674, 4726, 13668, 4634, 13663, 4544, 13657, 4463, 13651, 4381, 13646, 4300, 13640, 4227,
+		13635, 4156, 13629, 4081, 13624, 3953, 13618, 3828, 13612, 3707, 13607, 3598, 13602, 3488, 13596, 3382,
+		13591, 3285, 13585, 3193, 13580, 3104, 13574, 2967, 13569, 2808, 13564, 2658, 13559, 2516, 13553, 2377,
+		13548, 2250, 13543, 2136, 13538, 1989, 13533, 1770, 13528, 1574, 13522, 1378, 13517, 1200, 13512, 1035,
+		14833, 16400, 14828, 16042, 14823, 15828, 14818, 15675, 14814, 15559, 14809, 15466, 14805, 15390, 14799, 15283,
+		14795, 15162, 14789, 15069, 14785, 14979, 14782, 14894, 14777, 14819, 14772, 14750, 14768, 14689, 14765, 14632,
+		14761, 14581, 14755, 14528, 14752, 14483, 14748, 14440, 14744, 14398, 14740, 14358, 14736, 14311, 14731, 14240,
+		14729, 14178, 14725, 14117, 14721, 14057, 14716, 13997, 14713, 13945, 14709, 13895, 14705, 13844, 14701, 13801,
+		14697, 13751, 14693, 13710, 14688, 13666, 14685, 13627, 14681, 13588, 14679, 13556, 14675, 13519, 14670, 13485,
+		14666, 13450, 14662, 13420, 14658, 13388, 14655, 13358, 14651, 13331, 14647, 13294, 14644, 13239, 14640, 13188,
+		14636, 13139, 14632, 13087, 14628, 13039, 14624, 12994, 14620, 12949, 14616, 12905, 14612, 12863, 14609, 12824,
+		14606, 12787, 14602, 12747, 14598, 12708, 14594, 12674, 14590, 12637, 14587, 12604, 14582, 12569, 14578, 12535,
+		14575, 12505, 14571, 12475, 14567, 12444, 14563, 12415, 14560, 12387, 14555, 12358, 14552, 12332, 14548, 12304,
+		14544, 12271, 14540, 12221, 14536, 12170, 14532, 12126, 14528, 12077, 14524, 12030, 14520, 11987, 14517, 11947,
+		14513, 11901, 14509, 11863, 14506, 11824, 14502, 11783, 14498, 11745, 14495, 11711, 14490, 11672, 14486, 11637,
+		14482, 11604, 14478, 11570, 14474, 11535, 14470, 11503, 14467, 11474, 14463, 11440, 14460, 11413, 14455, 11382,
+		14452, 11354, 14448, 11326, 14444, 11299, 14440, 11272, 14435, 11226, 14432, 11176, 14428, 11127, 14424, 11079,
+		14420, 11032, 14416, 10985, 14413, 10940, 14409, 10895, 14405, 10853, 14401, 10812, 14397, 10769, 14393, 10729,
+		14390, 10691, 14386, 10653, 14382, 10615, 14378, 10577, 14374, 10541, 14371, 10510, 14367, 10476, 14363, 10441,
+		14359, 10409, 14356, 10378, 14352, 10348, 14348, 10315, 14343, 10284, 14339, 10255, 14335, 10215, 14329, 10165,
+		14322, 10111, 14315, 10059, 14306, 10005, 14299, 9955, 14291, 9907, 14284, 9859, 14275, 9812, 14268, 9768,
+		14261, 9723, 14254, 9681, 14247, 9638, 14240, 9598, 14232, 9557, 14225, 9519, 14217, 9480, 14210, 9444,
+		14202, 9406, 14195, 9372, 14187, 9337, 14180, 9303, 14173, 9270, 14166, 9240, 14158, 9197, 14152, 9140,
+		14145, 9080, 14137, 9024, 14129, 8962, 14123, 8912, 14115, 8856, 14109, 8808, 14101, 8752, 14094, 8706,
+		14086, 8656, 14080, 8612, 14072, 8563, 14065, 8519, 14058, 8475, 14052, 8435, 14045, 8395, 14037, 8354,
+		14031, 8315, 14024, 8278, 14017, 8241, 14010, 8207, 14003, 8147, 13995, 8078, 13989, 8016, 13982, 7950,
+		13976, 7890, 13969, 7829, 13962, 7771, 13954, 7710, 13948, 7658, 13942, 7603, 13935, 7553, 13929, 7501,
+		13922, 7453, 13916, 7404, 13909, 7359, 13902, 7311, 13896, 7270, 13890, 7228, 13883, 7185, 13876, 7127,
+		13869, 7046, 13863, 6972, 13856, 6900, 13850, 6831, 13844, 6760, 13838, 6698, 13831, 6630, 13825, 6572,
+		13819, 6512, 13813, 6454, 13806, 6398, 13800, 6342, 13794, 6293, 13788, 6240, 13782, 6193, 13776, 6146,
+		13769, 6054, 13764, 5967, 13757, 5879, 13751, 5801, 13745, 5721, 13739, 5645, 13733, 5573, 13727, 5498,
+		13721, 5433, 13716, 5368, 13710, 5303, 13704, 5246, 13698, 5186, 13692, 5127, 13687, 5032, 13681, 4930,
+		13675, 4825, 13669, 4726, 13664, 4638, 13658, 4550, 13653, 4467, 13647, 4383, 13641, 4305, 13636, 4230,
+		13630, 4160, 13625, 4089, 13619, 3957, 13614, 3836, 13608, 3714, 13603, 3603, 13598, 3496, 13593, 3393,
+		13587, 3291, 13582, 3199, 13576, 3110, 13572, 2977, 13566, 2823, 13561, 2672, 13556, 2528, 13550, 2387,
+		13545, 2260, 13540, 2140, 13535, 2005, 13530, 1784, 13526, 1589, 13520, 1390, 13515, 1216, 13510, 1045,
+		14824, 16383, 14818, 16013, 14814, 15804, 14808, 15655, 14804, 15541, 14799, 15451, 14795, 15375, 14790, 15253,
+		14785, 15137, 14780, 15046, 14776, 14955, 14772, 14868, 14766, 14796, 14762, 14730, 14758, 14669, 14754, 14611,
+		14750, 14560, 14745, 14510, 14741, 14464, 14738, 14422, 14733, 14381, 14730, 14345, 14725, 14281, 14721, 14212,
+		14718, 14148, 14713, 14084, 14709, 14025, 14706, 13974, 14702, 13919, 14698, 13870, 14693, 13821, 14690, 13777,
+		14686, 13733, 14682, 13689, 14678, 13646, 14674, 13607, 14671, 13568, 14667, 13532, 14664, 13502, 14659, 13466,
+		14655, 13433, 14651, 13399, 14647, 13372, 14643, 13342, 14640, 13315, 14636, 13259, 14632, 13207, 14629, 13157,
+		14624, 13106, 14621, 13058, 14617, 13012, 14613, 12967, 14610, 12927, 14605, 12880, 14601, 12837, 14598, 12801,
+		14594, 12759, 14591, 12725, 14587, 12687, 14583, 12649, 14579, 12617, 14575, 12583, 14572, 12550, 14568, 12518,
+		14563, 12485, 14560, 12456, 14556, 12427, 14552, 12397, 14548, 12369, 14544, 12341, 14541, 12314, 14537, 12290,
+		14532, 12236, 14529, 12192, 14526, 12143, 14521, 12094, 14518, 12051, 14514, 12006, 14509, 11960, 14506, 11920,
+		14503, 11880, 14499, 11837, 14495, 11799, 14492, 11762, 14488, 11724, 14483, 11686, 14480, 11653, 14476, 11616,
+		14472, 11581, 14468, 11550, 14465, 11518, 14461, 11485, 14456, 11453, 14453, 11425, 14449, 11394, 14446, 11368,
+		14442, 11338, 14438, 11311, 14434, 11283, 14430, 11251, 14426, 11198, 14422, 11149, 14419, 11103, 14415, 11055,
+		14411, 11007, 14407, 10959, 14404, 10919, 14400, 10875, 14396, 10830, 14392, 10788, 14388, 10751, 14384, 10709,
+		14381, 10670, 14377, 10631, 14373, 10597, 14369, 10560, 14365, 10524, 14361, 10490, 14358, 10458, 14354, 10425,
+		14350, 10392, 14347, 10362, 14344, 10332, 14340, 10302, 14336, 10274, 14329, 10246, 14320, 10194, 14312, 10134,
+		14305, 10085, 14297, 10033, 14291, 9986, 14284, 9936, 14276, 9889, 14268, 9841, 14262, 9797, 14254, 9748,
+		14247, 9708, 14239, 9664, 14233, 9624, 14224, 9581, 14217, 9544, 14210, 9504, 14203, 9467, 14195, 9428,
+		14189, 9395, 14181, 9359, 14174, 9326, 14166, 9292, 14160, 9260, 14153, 9228, 14146, 9180, 14138, 9119,
+		14131, 9062, 14124, 9003, 14117, 8950, 14110, 8895, 14103, 8843, 14096, 8791, 14089, 8740, 14082, 8693,
+		14074, 8643, 14067, 8598, 14061, 8551, 14054, 8510, 14047, 8467, 14040, 8424, 14033, 8383, 14027, 8344,
+		14019, 8305, 14013, 8269, 14006, 8232, 13999, 8198, 13992, 8132, 13986, 8069, 13979, 8001, 13972, 7938,
+		13965, 7875, 13959, 7818, 13952, 7757, 13946, 7704, 13939, 7648, 13933, 7594, 13926, 7542, 13919, 7493,
+		13912, 7443, 13906, 7397, 13900, 7352, 13893, 7305, 13887, 7265, 13880, 7220, 13874, 7182, 13867, 7112,
+		13861, 7040, 13855, 6964, 13848, 6891, 13843, 6821, 13837, 6758, 13830, 6689, 13823, 6624, 13818, 6568,
+		13811, 6504, 13806, 6451, 13799, 6392, 13794, 6342, 13787, 6287, 13780, 6235, 13775, 6190, 13769, 6140,
+		13763, 6052, 13756, 5962, 13751, 5879, 13745, 5797, 13738, 5716, 13733, 5646, 13727, 5567, 13721, 5498,
+		13716, 5430, 13710, 5364, 13704, 5304, 13698, 5241, 13693, 5182, 13687, 5132, 13681, 5028, 13675, 4923,
+		13670, 4827, 13665, 4734, 13659, 4642, 13653, 4550, 13648, 4467, 13643, 4388, 13637, 4311, 13632, 4236,
+		13626, 4164, 13621, 4095, 13615, 3964, 13610, 3837, 13604, 3718, 13599, 3604, 13594, 3503, 13589, 3394,
+		13584, 3302, 13578, 3205, 13573, 3115, 13568, 2988, 13563, 2831, 13557, 2680, 13553, 2536, 13547, 2394,
+		13542, 2269, 13537, 2149, 13533, 2018, 13527, 1796, 13522, 1595, 13517, 1405, 13512, 1223, 13508, 1056,
+		14815, 16356, 14809, 15987, 14805, 15785, 14799, 15636, 14795, 15522, 14790, 15434, 14785, 15356, 14780, 15224,
+		14775, 15107, 14770, 15018, 14765, 14926, 14762, 14848, 14756, 14772, 14753, 14711, 14748, 14649, 14745, 14593,
+		14739, 14540, 14735, 14492, 14731, 14447, 14728, 14406, 14723, 14365, 14720, 14322, 14714, 14250, 14711, 14185,
+		14707, 14117, 14703, 14058, 14698, 13999, 14695, 13947, 14691, 13894, 14687, 13844, 14682, 13795, 14679, 13750,
+		14676, 13711, 14671, 13665, 14667, 13626, 14664, 13588, 14660, 13550, 14655, 13511, 14652, 13480, 14647, 13446,
+		14644, 13416, 14640, 13383, 14636, 13355, 14633, 13325, 14629, 13283, 14626, 13233, 14622, 13179, 14617, 13126,
+		14613, 13077, 14610, 13029, 14606, 12986, 14601, 12940, 14598, 12896, 14595, 12858, 14591, 12816, 14587, 12775,
+		14583, 12738, 14579, 12698, 14576, 12664, 14572, 12629, 14568, 12595, 14564, 12561, 14561, 12529, 14556, 12498,
+		14553, 12467, 14549, 12436, 14545, 12409, 14542, 12380, 14538, 12352, 14534, 12326, 14530, 12298, 14526, 12254,
+		14523, 12211, 14518, 12157, 14515, 12113, 14511, 12068, 14507, 12023, 14503, 11979, 14500, 11939, 14496, 11894,
+		14493, 11854, 14489, 11815, 14485, 11776, 14481, 11738, 14477, 11702, 14473, 11666, 14469, 11629, 14466, 11597,
+		14462, 11563, 14458, 11529, 14454, 11498, 14451, 11469, 14447, 11437, 14444, 11407, 14439, 11377, 14435, 11348,
+		14432, 11323, 14428, 11295, 14424, 11270, 14420, 11220, 14417, 11173, 14413, 11123, 14409, 11074, 14406, 11027,
+		14403, 10984, 14398, 10937, 14394, 10892, 14390, 10850, 14387, 10810, 14383, 10770, 14379, 10726, 14376, 10690,
+		14372, 10653, 14368, 10616, 14364, 10577, 14361, 10544, 14357, 10508, 14353, 10475, 14349, 10440, 14346, 10409,
+		14342, 10377, 14339, 10349, 14333, 10316, 14326, 10288, 14318, 10258, 14312, 10224, 14305, 10171, 14298, 10119,
+		14290, 10063, 14282, 10012, 14274, 9961, 14267, 9912, 14260, 9867, 14254, 9824, 14247, 9777, 14239, 9732,
+		14232, 9689, 14225, 9649, 14217, 9606, 14210, 9567, 14203, 9529, 14196, 9489, 14189, 9453, 14181, 9415,
+		14175, 9383, 14167, 9346, 14160, 9314, 14153, 9280, 14147, 9250, 14138, 9216, 14132, 9160, 14125, 9099,
+		14117, 9042, 14110, 8983, 14104, 8932, 14097, 8876, 14091, 8828, 14083, 8774, 14076, 8726, 14069, 8675,
+		14064, 8634, 14056, 8586, 14049, 8540, 14042, 8496, 14036, 8456, 14029, 8414, 14022, 8375, 14015, 8334,
+		14009, 8298, 14002, 8260, 13995, 8225, 13989, 8188, 13982, 8120, 13975, 8052, 13969, 7991, 13963, 7928,
+		13956, 7866, 13949, 7807, 13943, 7749, 13936, 7692, 13930, 7639, 13923, 7586, 13916, 7535, 13910, 7486,
+		13903, 7435, 13897, 7392, 13891, 7343, 13885, 7300, 13878, 7258, 13872, 7217, 13866, 7177, 13859, 7105,
+		13854, 7032, 13847, 6955, 13842, 6886, 13834, 6815, 13828, 6751, 13822, 6683, 13817, 6624, 13810, 6559,
+		13804, 6503, 13798, 6445, 13792, 6389, 13786, 6337, 13780, 6284, 13774, 6237, 13768, 6187, 13762, 6140,
+		13756, 6047, 13751, 5961, 13745, 5879, 13739, 5794, 13734, 5725, 13727, 5643, 13722, 5570, 13716, 5500,
+		13710, 5431, 13705, 5369, 13699, 5306, 13693, 5243, 13688, 5189, 13682, 5132, 13676, 5032, 13672, 4938,
+		13665, 4828, 13659, 4726, 13654, 4641, 13649, 4555, 13643, 4471, 13638, 4387, 13633, 4310, 13627, 4235,
+		13622, 4168, 13617, 4100, 13611, 3971, 13606, 3848, 13601, 3728, 13595, 3613, 13590, 3505, 13585, 3402,
+		13580, 3304, 13575, 3215, 13570, 3122, 13565, 3003, 13559, 2838, 13555, 2692, 13549, 2546, 13545, 2408,
+		13539, 2277, 13535, 2157, 13529, 2034, 13524, 1808, 13519, 1604, 13514, 1414, 13510, 1239, 13505, 1066,
+		14806, 16328, 14801, 15966, 14796, 15764, 14790, 15617, 14785, 15500, 14781, 15418, 14776, 15323, 14771, 15193,
+		14765, 15081, 14761, 14993, 14756, 14903, 14752, 14824, 14747, 14751, 14743, 14689, 14738, 14629, 14735, 14574,
+		14729, 14522, 14725, 14473, 14721, 14431, 14717, 14387, 14714, 14349, 14709, 14288, 14704, 14218, 14700, 14152,
+		14696, 14090, 14692, 14029, 14688, 13974, 14685, 13920, 14680, 13870, 14676, 13819, 14673, 13776, 14668, 13728,
+		14664, 13687, 14660, 13645, 14657, 13607, 14654, 13568, 14650, 13533, 14645, 13494, 14641, 13461, 14638, 13431,
+		14634, 13398, 14630, 13369, 14625, 13336, 14622, 13308, 14618, 13251, 14614, 13198, 14610, 13148, 14607, 13098,
+		14603, 13050, 14599, 13002, 14595, 12958, 14591, 12914, 14587, 12871, 14583, 12831, 14581, 12793, 14577, 12753,
+		14572, 12713, 14568, 12676, 14565, 12642, 14561, 12607, 14557, 12573, 14554, 12543, 14549, 12508, 14546, 12479,
+		14542, 12447, 14538, 12418, 14534, 12389, 14531, 12362, 14527, 12336, 14523, 12308, 14520, 12280, 14515, 12225,
+		14512, 12178, 14509, 12132, 14505, 12085, 14501, 12041, 14497, 11997, 14493, 11953, 14490, 11910, 14487, 11873,
+		14482, 11827, 14478, 11790, 14475, 11754, 14471, 11715, 14467, 11678, 14463, 11644, 14459, 11609, 14456, 11575,
+		14452, 11543, 14448, 11511, 14444, 11478, 14441, 11449, 14437, 11419, 14433, 11389, 14430, 11361, 14425, 11333,
+		14421, 11305, 14418, 11280, 14415, 11244, 14411, 11196, 14407, 11140, 14404, 11095, 14400, 11048, 14396, 11002,
+		14392, 10955, 14389, 10914, 14385, 10871, 14381, 10828, 14377, 10786, 14374, 10747, 14371, 10708, 14367, 10668,
+		14363, 10634, 14360, 10597, 14356, 10562, 14352, 10525, 14349, 10492, 14345, 10459, 14342, 10427, 14338, 10394,
+		14332, 10363, 14324, 10333, 14317, 10304, 14310, 10275, 14302, 10246, 14295, 10197, 14288, 10144, 14281, 10091,
+		14274, 10041, 14268, 9993, 14260, 9942, 14253, 9895, 14245, 9848, 14239, 9803, 14230, 9755, 14224, 9714,
+		14217, 9672, 14210, 9632, 14202, 9589, 14196, 9553, 14188, 9512, 14182, 9477, 14174, 9438, 14168, 9405,
+		14161, 9369, 14155, 9337, 14147, 9301, 14140, 9271, 14132, 9237, 14126, 9200, 14119, 9138, 14112, 9082,
+		14105, 9022, 14099, 8969, 14092, 8913, 14085, 8863, 14078, 8808, 14071, 8761, 14064, 8709, 14058, 8664,
+		14051, 8618, 14043, 8570, 14037, 8528, 14031, 8486, 14024, 8444, 14017, 8403, 14010, 8363, 14003, 8323,
+		13997, 8288, 13990, 8249, 13985, 8217, 13978, 8169, 13972, 8105, 13965, 8041, 13959, 7976, 13951, 7912,
+		13945, 7853, 13939, 7793, 13933, 7741, 13925, 7681, 13919, 7628, 13913, 7577, 13907, 7527, 13901, 7477,
+		13895, 7431, 13889, 7384, 13882, 7337, 13876, 7295, 13870, 7252, 13863, 7211, 13857, 7170, 13852, 7099,
+		13845, 7020, 13839, 6947, 13832, 6875, 13826, 6808, 13820, 6742, 13814, 6676, 13809, 6617, 13802, 6554,
+		13797, 6500, 13791, 6439, 13785, 6388, 13779, 6333, 13773, 6283, 13767, 6233, 13761, 6185, 13756, 6136,
+		13750, 6041, 13744, 5959, 13738, 5872, 13732, 5793, 13726, 5714, 13721, 5636, 13715, 5568, 13709, 5493,
+		13704, 5430, 13698, 5365, 13692, 5301, 13688, 5246, 13681, 5184, 13676, 5128, 13671, 5033, 13665, 4927,
+		13660, 4832, 13656, 4744, 13650, 4650, 13644, 4556, 13639, 4473, 13633, 4391, 13628, 4316, 13623, 4240,
+		13617, 4170, 13612, 4101, 13607, 3974, 13602, 3851, 13597, 3736, 13592, 3622, 13586, 3510, 13581, 3406,
+		13576, 3309, 13571, 3216, 13566, 3128, 13561, 3014, 13556, 2849, 13550, 2695, 13546, 2558, 13541, 2420,
+		13536, 2286, 13531, 2165, 13526, 2045, 13521, 1826, 13516, 1617, 13512, 1429, 13507, 1248, 13502, 1077,
+		14797, 16302, 14792, 15943, 14787, 15742, 14781, 15597, 14777, 15485, 14772, 15403, 14766, 15291, 14761, 15166,
+		14757, 15063, 14751, 14965, 14747, 14880, 14743, 14804, 14738, 14732, 14733, 14667, 14729, 14608, 14725, 14555,
+		14719, 14505, 14715, 14457, 14711, 14411, 14708, 14372, 14704, 14333, 14699, 14258, 14694, 14190, 14690, 14122,
+		14686, 14063, 14682, 14002, 14678, 13947, 14674, 13894, 14670, 13847, 14665, 13796, 14662, 13751, 14658, 13706,
+		14654, 13665, 14650, 13624, 14647, 13584, 14643, 13548, 14640, 13514, 14635, 13478, 14630, 13442, 14627, 13411,
+		14623, 13380, 14619, 13351, 14615, 13321, 14612, 13278, 14608, 13221, 14604, 13169, 14600, 13119, 14597, 13072,
+		14592, 13022, 14588, 12976, 14584, 12930, 14580, 12886, 14577, 12848, 14573, 12805, 14570, 12768, 14565, 12727,
+		14562, 12691, 14558, 12655, 14554, 12618, 14551, 12587, 14547, 12553, 14542, 12518, 14539, 12492, 14534, 12457,
+		14532, 12431, 14528, 12401, 14524, 12371, 14520, 12344, 14517, 12319, 14513, 12292, 14509, 12246, 14506, 12200,
+		14502, 12148, 14498, 12102, 14494, 12057, 14490, 12011, 14487, 11970, 14483, 11927, 14479, 11884, 14476, 11844,
+		14472, 11807, 14468, 11764, 14464, 11728, 14461, 11695, 14457, 11657, 14453, 11622, 14449, 11589, 14445, 11555,
+		14442, 11522, 14439, 11494, 14435, 11462, 14431, 11430, 14427, 11401, 14424, 11373, 14419, 11345, 14416, 11317,
+		14412, 11291, 14409, 11264, 14405, 11213, 14402, 11164, 14398, 11117, 14394, 11066, 14390, 11019, 14387, 10976,
+		14384, 10932, 14380, 10887, 14376, 10845, 14373, 10808, 14368, 10765, 14365, 10726, 14361, 10686, 14358, 10649,
+		14354, 10613, 14351, 10576, 14348, 10543, 14344, 10509, 14340, 10476, 14336, 10441, 14329, 10409, 14323, 10380,
+		14316, 10351, 14308, 10319, 14301, 10290, 14294, 10261, 14288, 10232, 14280, 10174, 14273, 10119, 14264, 10063,
+		14258, 10017, 14251, 9968, 14245, 9924, 14238, 9873, 14231, 9830, 14223, 9781, 14216, 9739, 14209, 9695,
+		14202, 9657, 14195, 9613, 14189, 9577, 14182, 9536, 14175, 9501, 14167, 9460, 14161, 9426, 14153, 9389,
+		14147, 9357, 14140, 9322, 14133, 9289, 14126, 9259, 14118, 9225, 14113, 9181, 14105, 9118, 14099, 9061,
+		14092, 9001, 14086, 8951, 14078, 8895, 14072, 8846, 14065, 8792, 14059, 8747, 14051, 8694, 14046, 8651,
+		14039, 8605, 14033, 8560, 14025, 8515, 14019, 8475, 14012, 8432, 14006, 8394, 14000, 8354, 13994, 8317,
+		13987, 8280, 13980, 8244, 13974, 8208, 13967, 8155, 13961, 8090, 13955, 8029, 13947, 7961, 13942, 7901,
+		13935, 7841, 13929, 7782, 13923, 7728, 13916, 7670, 13910, 7620, 13904, 7566, 13898, 7519, 13892, 7469,
+		13886, 7423, 13879, 7375, 13873, 7332, 13867, 7288, 13861, 7247, 13855, 7206, 13848, 7162, 13842, 7087,
+		13836, 7010, 13830, 6939, 13825, 6869, 13819, 6804, 13813, 6735, 13807, 6675, 13801, 6610, 13795, 6553,
+		13789, 6491, 13783, 6436, 13778, 6384, 13772, 6330, 13766, 6279, 13760, 6229, 13755, 6184, 13748, 6128,
+		13742, 6039, 13737, 5953, 13732, 5871, 13726, 5792, 13720, 5711, 13715, 5641, 13709, 5565, 13704, 5498,
+		13698, 5432, 13693, 5365, 13687, 5305, 13682, 5242, 13676, 5184, 13671, 5130, 13665, 5030, 13660, 4934,
+		13655, 4834, 13649, 4732, 13644, 4642, 13639, 4560, 13634, 4478, 13628, 4393, 13623, 4316, 13618, 4242,
+		13613, 4173, 13608, 4104, 13602, 3978, 13597, 3857, 13593, 3739, 13587, 3628, 13582, 3520, 13577, 3413,
+		13572, 3313, 13567, 3219, 13562, 3133, 13557, 3022, 13552, 2863, 13547, 2706, 13542, 2564, 13537, 2425,
+		13533, 2294, 13528, 2175, 13523, 2057, 13518, 1839, 13514, 1636, 13509, 1443, 13504, 1258, 13500, 1087,
+		14789, 16281, 14783, 15917, 14779, 15724, 14773, 15580, 14768, 15472, 14763, 15389, 14757, 15261, 14752, 15141,
+		14748, 15038, 14741, 14938, 14737, 14855, 14733, 14779, 14727, 14710, 14724, 14650, 14719, 14588, 14715, 14536,
+		14710, 14485, 14706, 14441, 14701, 14395, 14698, 14357, 14693, 14300, 14688, 14227, 14684, 14161, 14681, 14097,
+		14676, 14036, 14672, 13976, 14668, 13922, 14664, 13870, 14660, 13822, 14655, 13773, 14652, 13729, 14647, 13685,
+		14643, 13641, 14640, 13605, 14636, 13565, 14632, 13527, 14629, 13493, 14625, 13461, 14620, 13426, 14616, 13392,
+		14612, 13364, 14609, 13335, 14605, 13301, 14601, 13242, 14597, 13190, 14593, 13139, 14589, 13089, 14586, 13043,
+		14582, 12994, 14577, 12948, 14574, 12907, 14571, 12865, 14566, 12822, 14563, 12783, 14559, 12743, 14555, 12705,
+		14552, 12669, 14548, 12635, 14544, 12599, 14540, 12565, 14536, 12534, 14532, 12502, 14528, 12470, 14525, 12442,
+		14521, 12411, 14518, 12385, 14515, 12357, 14510, 12328, 14507, 12302, 14504, 12269, 14499, 12215, 14495, 12167,
+		14492, 12124, 14487, 12073, 14484, 12030, 14481, 11985, 14476, 11941, 14473, 11901, 14469, 11860, 14465, 11819,
+		14462, 11781, 14459, 11746, 14454, 11705, 14450, 11669, 14447, 11637, 14443, 11602, 14440, 11568, 14437, 11538,
+		14433, 11505, 14429, 11472, 14426, 11444, 14422, 11415, 14418, 11384, 14414, 11357, 14410, 11329, 14407, 11302,
+		14403, 11276, 14400, 11237, 14396, 11187, 14393, 11137, 14389, 11089, 14386, 11044, 14382, 10998, 14379, 10952,
+		14375, 10911, 14371, 10867, 14367, 10824, 14364, 10784, 14360, 10744, 14357, 10705, 14353, 10667, 14349, 10629,
+		14346, 10595, 14343, 10560, 14338, 10523, 14333, 10489, 14327, 10457, 14321, 10427, 14312, 10392, 14305, 10363,
+		14298, 10332, 14291, 10304, 14286, 10276, 14279, 10249, 14271, 10199, 14265, 10151, 14258, 10098, 14252, 10052,
+		14243, 9996, 14235, 9945, 14228, 9896, 14222, 9852, 14216, 9809, 14209, 9766, 14202, 9723, 14195, 9680,
+		14187, 9638, 14180, 9596, 14174, 9558, 14167, 9520, 14161, 9485, 14153, 9444, 14147, 9414, 14140, 9377,
+		14133, 9344, 14125, 9308, 14120, 9281, 14112, 9246, 14106, 9218, 14100, 9157, 14093, 9099, 14086, 9039,
+		14080, 8988, 14073, 8931, 14066, 8880, 14060, 8830, 14053, 8779, 14047, 8730, 14040, 8682, 14034, 8637,
+		14027, 8590, 14021, 8548, 14014, 8505, 14008, 8463, 14002, 8422, 13995, 8382, 13989, 8343, 13982, 8307,
+		13975, 8268, 13969, 8234, 13963, 8198, 13957, 8143, 13949, 8072, 13944, 8011, 13937, 7945, 13932, 7891,
+		13925, 7826, 13919, 7774, 13913, 7714, 13907, 7661, 13901, 7611, 13895, 7559, 13888, 7507, 13882, 7460,
+		13875, 7412, 13870, 7367, 13863, 7322, 13859, 7283, 13852, 7241, 13846, 7197, 13841, 7158, 13834, 7075,
+		13829, 7004, 13823, 6930, 13817, 6865, 13811, 6794, 13805, 6729, 13799, 6665, 13793, 6604, 13787, 6546,
+		13781, 6485, 13776, 6434, 13770, 6378, 13765, 6328, 13758, 6274, 13753, 6226, 13747, 6177, 13742, 6121,
+		13737, 6036, 13731, 5950, 13726, 5868, 13719, 5784, 13714, 5709, 13709, 5638, 13703, 5564, 13698, 5497,
+		13692, 5426, 13688, 5369, 13681, 5302, 13676, 5243, 13671, 5187, 13665, 5130, 13660, 5038, 13655, 4935,
+		13649, 4833, 13645, 4742, 13640, 4652, 13634, 4559, 13628, 4472, 13623, 4394, 13618, 4319, 13613, 4245,
+		13608, 4173, 13603, 4108, 13598, 3985, 13593, 3864, 13588, 3740, 13583, 3632, 13578, 3525, 13573, 3419,
+		13568, 3320, 13563, 3227, 13559, 3137, 13554, 3035, 13548, 2871, 13544, 2719, 13539, 2573, 13534, 2437,
+		13530, 2303, 13525, 2184, 13520, 2061, 13515, 1853, 13511, 1654, 13506, 1455, 13501, 1268, 13497, 1097,
+		14781, 16251, 14775, 15898, 14770, 15704, 14764, 15560, 14759, 15455, 14755, 15374, 14748, 15233, 14744, 15117,
+		14738, 15015, 14732, 14916, 14728, 14832, 14724, 14759, 14719, 14690, 14715, 14629, 14711, 14572, 14705, 14518,
+		14700, 14469, 14696, 14423, 14691, 14378, 14688, 14341, 14684, 14270, 14678, 14200, 14674, 14133, 14671, 14069,
+		14666, 14010, 14662, 13952, 14659, 13899, 14654, 13848, 14650, 13798, 14646, 13754, 14641, 13705, 14637, 13663,
+		14634, 13623, 14630, 13583, 14627, 13547, 14622, 13508, 14618, 13473, 14614, 13441, 14611, 13411, 14606, 13376,
+		14602, 13345, 14598, 13316, 14594, 13267, 14590, 13211, 14587, 13162, 14583, 13109, 14579, 13061, 14575, 13012,
+		14571, 12968, 14567, 12921, 14564, 12879, 14560, 12840, 14556, 12797, 14552, 12759, 14548, 12719, 14545, 12684,
+		14542, 12650, 14537, 12612, 14534, 12581, 14530, 12544, 14526, 12512, 14523, 12484, 14519, 12453, 14515, 12423,
+		14512, 12395, 14508, 12366, 14505, 12341, 14501, 12314, 14497, 12286, 14492, 12232, 14489, 12186, 14486, 12137,
+		14481, 12092, 14478, 12050, 14474, 12002, 14471, 11960, 14467, 11917, 14463, 11874, 14460, 11837, 14456, 11798,
+		14452, 11758, 14448, 11721, 14445, 11687, 14441, 11649, 14438, 11615, 14434, 11583, 14431, 11550, 14427, 11516,
+		14424, 11486, 14420, 11457, 14416, 11424, 14413, 11397, 14409, 11369, 14405, 11340, 14402, 11314, 14398, 11287,
+		14395, 11260, 14391, 11205, 14388, 11160, 14384, 11112, 14381, 11063, 14377, 11016, 14373, 10972, 14369, 10929,
+		14365, 10884, 14362, 10845, 14359, 10802, 14355, 10763, 14352, 10723, 14348, 10686, 14345, 10648, 14341, 10613,
+		14337, 10576, 14332, 10542, 14325, 10508, 14318, 10474, 14311, 10442, 14303, 10410, 14297, 10379, 14290, 10350,
+		14284, 10320, 14275, 10288, 14269, 10262, 14262, 10227, 14256, 10179, 14248, 10121, 14240, 10069, 14234, 10022,
+		14229, 9975, 14223, 9931, 14215, 9880, 14207, 9833, 14199, 9786, 14193, 9745, 14186, 9700, 14180, 9662,
+		14173, 9620, 14168, 9584, 14159, 9542, 14154, 9506, 14146, 9468, 14140, 9434, 14133, 9398, 14126, 9364,
+		14119, 9330, 14113, 9299, 14106, 9266, 14100, 9236, 14093, 9194, 14087, 9138, 14080, 9080, 14074, 9023,
+		14067, 8969, 14061, 8918, 14055, 8866, 14047, 8810, 14041, 8764, 14035, 8714, 14029, 8671, 14022, 8621,
+		14016, 8578, 14009, 8534, 14003, 8493, 13996, 8450, 13990, 8410, 13984, 8372, 13978, 8335, 13971, 8297,
+		13965, 8261, 13959, 8225, 13952, 8191, 13946, 8124, 13940, 8060, 13934, 7995, 13928, 7934, 13922, 7877,
+		13915, 7816, 13909, 7762, 13903, 7705, 13897, 7653, 13891, 7598, 13885, 7548, 13879, 7500, 13873, 7453,
+		13867, 7404, 13861, 7361, 13854, 7314, 13850, 7276, 13843, 7232, 13838, 7195, 13832, 7144, 13826, 7062,
+		13821, 6996, 13814, 6921, 13809, 6854, 13802, 6784, 13796, 6723, 13791, 6658, 13785, 6598, 13779, 6535,
+		13774, 6486, 13768, 6427, 13763, 6374, 13757, 6322, 13752, 6271, 13746, 6223, 13741, 6176, 13735, 6121,
+		13729, 6027, 13724, 5946, 13718, 5860, 13713, 5783, 13708, 5707, 13702, 5632, 13697, 5564, 13691, 5491,
+		13686, 5428, 13681, 5362, 13674, 5297, 13670, 5241, 13665, 5184, 13659, 5129, 13654, 5033, 13649, 4926,
+		13644, 4837, 13639, 4738, 13633, 4644, 13629, 4563, 13623, 4479, 13619, 4397, 13614, 4322, 13609, 4247,
+		13603, 4174, 13599, 4109, 13593, 3995, 13589, 3867, 13584, 3749, 13578, 3635, 13574, 3529, 13569, 3422,
+		13564, 3327, 13559, 3229, 13554, 3140, 13550, 3039, 13545, 2883, 13540, 2723, 13535, 2581, 13531, 2445,
+		13526, 2308, 13521, 2186, 13516, 2069, 13512, 1869, 13507, 1662, 13503, 1465, 13498, 1277, 13494, 1107,
+		14773, 16227, 14767, 15876, 14762, 15685, 14755, 15542, 14751, 15439, 14746, 15361, 14739, 15205, 14735, 15095,
+		14729, 14994, 14723, 14891, 14719, 14809, 14714, 14738, 14710, 14668, 14705, 14607, 14702, 14556, 14696, 14500,
+		14691, 14453, 14687, 14407, 14683, 14365, 14679, 14315, 14674, 14240, 14668, 14169, 14665, 14105, 14661, 14041,
+		14657, 13982, 14653, 13927, 14649, 13876, 14645, 13825, 14640, 13776, 14637, 13733, 14631, 13683, 14627, 13642,
+		14624, 13603, 14620, 13561, 14617, 13526, 14613, 13491, 14608, 13455, 14603, 13421, 14600, 13392, 14596, 13361,
+		14592, 13330, 14588, 13291, 14584, 13235, 14581, 13187, 14576, 13129, 14573, 13084, 14569, 13034, 14565, 12985,
+		14561, 12943, 14558, 12899, 14553, 12854, 14550, 12815, 14546, 12775, 14543, 12738, 14539, 12699, 14535, 12661,
+		14531, 12626, 14527, 12592, 14524, 12558, 14520, 12528, 14516, 12494, 14513, 12465, 14509, 12436, 14505, 12404,
+		14502, 12379, 14498, 12348, 14494, 12322, 14491, 12297, 14487, 12254, 14483, 12203, 14480, 12157, 14475, 12110,
+		14471, 12060, 14468, 12017, 14465, 11976, 14461, 11932, 14458, 11892, 14454, 11851, 14450, 11812, 14447, 11775,
+		14443, 11737, 14439, 11699, 14435, 11663, 14433, 11632, 14428, 11594, 14425, 11562, 14421, 11530, 14418, 11501,
+		14414, 11467, 14410, 11437, 14407, 11411, 14403, 11379, 14400, 11353, 14396, 11324, 14392, 11297, 14389, 11272,
+		14386, 11228, 14382, 11180, 14378, 11127, 14375, 11084, 14371, 11037, 14368, 10991, 14364, 10947, 14360, 10902,
+		14357, 10863, 14353, 10819, 14350, 10781, 14347, 10741, 14344, 10705, 14340, 10664, 14336, 10628, 14329, 10593,
+		14323, 10559, 14316, 10523, 14308, 10488, 14302, 10459, 14294, 10426, 14288, 10395, 14281, 10363, 14274, 10333,
+		14269, 10308, 14261, 10277, 14253, 10248, 14247, 10204, 14239, 10150, 14232, 10098, 14225, 10048, 14218, 9994,
+		14212, 9949, 14205, 9900, 14200, 9861, 14193, 9814, 14187, 9773, 14179, 9726, 14173, 9687, 14166, 9643,
+		14159, 9604, 14153, 9566, 14146, 9529, 14138, 9490, 14132, 9456, 14126, 9419, 14119, 9385, 14113, 9351,
+		14106, 9317, 14100, 9287, 14094, 9256, 14088, 9226, 14080, 9170, 14074, 9118, 14067, 9057, 14061, 9004,
+		14054, 8949, 14048, 8898, 14041, 8843, 14036, 8799, 14029, 8747, 14023, 8699, 14016, 8653, 14010, 8608,
+		14004, 8565, 13998, 8523, 13991, 8479, 13985, 8439, 13979, 8400, 13972, 8361, 13966, 8323, 13960, 8287,
+		13954, 8251, 13948, 8218, 13942, 8174, 13936, 8107, 13930, 8046, 13923, 7980, 13918, 7925, 13911, 7858,
+		13905, 7805, 13899, 7747, 13894, 7694, 13888, 7642, 13881, 7590, 13875, 7539, 13870, 7491, 13864, 7442,
+		13859, 7399, 13852, 7353, 13847, 7310, 13840, 7267, 13834, 7225, 13829, 7189, 13823, 7127, 13817, 7057,
+		13811, 6981, 13806, 6916, 13800, 6845, 13794, 6776, 13789, 6712, 13784, 6652, 13778, 6593, 13772, 6531,
+		13767, 6477, 13761, 6420, 13756, 6369, 13749, 6314, 13744, 6267, 13738, 6217, 13733, 6172, 13728, 6109,
+		13722, 6022, 13717, 5940, 13711, 5855, 13707, 5782, 13701, 5702, 13696, 5631, 13691, 5560, 13685, 5490,
+		13680, 5427, 13675, 5361, 13670, 5302, 13664, 5241, 13659, 5185, 13654, 5130, 13649, 5032, 13644, 4934,
+		13639, 4833, 13633, 4737, 13630, 4657, 13624, 4565, 13618, 4476, 13614, 4400, 13608, 4322, 13604, 4249,
+		13598, 4176, 13594, 4111, 13589, 3992, 13584, 3872, 13579, 3755, 13575, 3639, 13569, 3529, 13565, 3430,
+		13560, 3329, 13555, 3237, 13550, 3147, 13546, 3051, 13541, 2888, 13537, 2738, 13531, 2587, 13527, 2451,
+		13522, 2316, 13518, 2195, 13513, 2076, 13509, 1885, 13504, 1674, 13499, 1474, 13495, 1289, 13491, 1117,
+		14765, 16201, 14759, 15856, 14754, 15663, 14748, 15528, 14742, 15424, 14738, 15328, 14730, 15176, 14727, 15072,
+		14721, 14972, 14715, 14869, 14711, 14790, 14705, 14719, 14701, 14650, 14696, 14589, 14693, 14537, 14686, 14483,
+		14682, 14435, 14678, 14392, 14674, 14350, 14669, 14281, 14665, 14213, 14659, 14142, 14656, 14078, 14651, 14017,
+		14647, 13959, 14644, 13905, 14640, 13853, 14635, 13802, 14630, 13753, 14626, 13707, 14622, 13665, 14618, 13623,
+		14615, 13584, 14611, 13545, 14607, 13508, 14602, 13472, 14598, 13438, 14594, 13404, 14590, 13375, 14586, 13345,
+		14583, 13316, 14578, 13260, 14575, 13206, 14571, 13153, 14567, 13103, 14564, 13056, 14559, 13006, 14555, 12961,
+		14551, 12914, 14548, 12875, 14544, 12832, 14540, 12789, 14537, 12752, 14533, 12714, 14530, 12678, 14525, 12641,
+		14522, 12607, 14518, 12573, 14514, 12539, 14510, 12507, 14507, 12478, 14503, 12445, 14500, 12418, 14496, 12389,
+		14492, 12359, 14489, 12335, 14484, 12306, 14480, 12273, 14477, 12223, 14473, 12173, 14470, 12128, 14465, 12080,
+		14462, 12036, 14458, 11988, 14455, 11950, 14452, 11909, 14448, 11868, 14444, 11828, 14441, 11789, 14437, 11751,
+		14433, 11715, 14430, 11679, 14426, 11642, 14422, 11608, 14419, 11577, 14416, 11543, 14412, 11512, 14408, 11480,
+		14405, 11451, 14401, 11421, 14397, 11391, 14394, 11365, 14390, 11335, 14387, 11310, 14384, 11282, 14380, 11249,
+		14377, 11199, 14373, 11149, 14370, 11107, 14366, 11053, 14362, 11010, 14358, 10966, 14355, 10922, 14352, 10880,
+		14348, 10838, 14346, 10802, 14342, 10759, 14338, 10718, 14333, 10680, 14327, 10647, 14320, 10609, 14313, 10573,
+		14306, 10539, 14299, 10508, 14292, 10473, 14285, 10440, 14278, 10407, 14272, 10379, 14265, 10349, 14259, 10319,
+		14252, 10291, 14245, 10264, 14238, 10233, 14231, 10180, 14224, 10126, 14218, 10077, 14211, 10026, 14206, 9981,
+		14198, 9931, 14190, 9880, 14183, 9834, 14177, 9790, 14171, 9750, 14165, 9710, 14159, 9668, 14152, 9628,
+		14146, 9591, 14137, 9547, 14132, 9513, 14125, 9475, 14119, 9440, 14112, 9405, 14106, 9373, 14099, 9336,
+		14094, 9308, 14087, 9274, 14081, 9243, 14073, 9209, 14067, 9154, 14061, 9096, 14054, 9039, 14049, 8987,
+		14041, 8929, 14035, 8878, 14030, 8830, 14024, 8780, 14017, 8731, 14011, 8685, 14005, 8639, 13998, 8595,
+		13992, 8550, 13987, 8511, 13980, 8467, 13973, 8426, 13967, 8387, 13961, 8352, 13955, 8312, 13949, 8278,
+		13943, 8240, 13938, 8208, 13932, 8156, 13926, 8095, 13919, 8028, 13913, 7968, 13907, 7907, 13901, 7849,
+		13896, 7793, 13889, 7737, 13883, 7682, 13877, 7628, 13872, 7578, 13867, 7531, 13861, 7483, 13855, 7436,
+		13848, 7390, 13843, 7344, 13837, 7305, 13831, 7259, 13826, 7220, 13820, 7182, 13814, 7115, 13809, 7045,
+		13803, 6970, 13797, 6903, 13792, 6834, 13786, 6769, 13781, 6707, 13776, 6648, 13770, 6584, 13765, 6528,
+		13759, 6470, 13753, 6417, 13748, 6363, 13742, 6314, 13737, 6262, 13731, 6215, 13726, 6169, 13721, 6107,
+		13716, 6021, 13710, 5932, 13705, 5853, 13700, 5776, 13695, 5700, 13690, 5627, 13684, 5553, 13679, 5488,
+		13673, 5418, 13669, 5360, 13663, 5297, 13658, 5239, 13653, 5182, 13648, 5126, 13643, 5035, 13638, 4931,
+		13633, 4835, 13628, 4740, 13623, 4648, 13618, 4558, 13614, 4482, 13608, 4402, 13603, 4322, 13599, 4253,
+		13593, 4179, 13589, 4112, 13584, 3999, 13579, 3871, 13574, 3757, 13570, 3642, 13565, 3538, 13560, 3430,
+		13556, 3334, 13551, 3240, 13547, 3153, 13541, 3060, 13537, 2894, 13532, 2741, 13528, 2593, 13523, 2459,
+		13519, 2326, 13514, 2200, 13510, 2083, 13505, 1893, 13500, 1683, 13496, 1487, 13492, 1303, 13487, 1126,
+		14757, 16173, 14751, 15836, 14746, 15646, 14740, 15511, 14734, 15409, 14729, 15298, 14722, 15152, 14718, 15045,
+		14711, 14941, 14706, 14848, 14702, 14768, 14697, 14697, 14693, 14634, 14687, 14570, 14683, 14519, 14677, 14466,
+		14673, 14419, 14669, 14375, 14665, 14336, 14660, 14255, 14654, 14183, 14651, 14116, 14647, 14051, 14642, 13991,
+		14638, 13934, 14635, 13881, 14630, 13831, 14626, 13781, 14621, 13733, 14617, 13687, 14614, 13648, 14609, 13603,
+		14605, 13562, 14602, 13526, 14597, 13488, 14593, 13455, 14589, 13422, 14585, 13389, 14580, 13356, 14577, 13329,
+		14573, 13288, 14569, 13231, 14565, 13177, 14561, 13126, 14558, 13076, 14554, 13026, 14550, 12983, 14546, 12935,
+		14542, 12892, 14537, 12847, 14535, 12810, 14531, 12769, 14527, 12728, 14523, 12691, 14519, 12654, 14516, 12622,
+		14512, 12584, 14508, 12553, 14504, 12520, 14500, 12488, 14497, 12458, 14493, 12428, 14489, 12398, 14486, 12371,
+		14482, 12344, 14478, 12315, 14474, 12290, 14471, 12241, 14468, 12194, 14464, 12145, 14460, 12098, 14456, 12053,
+		14453, 12009, 14449, 11967, 14446, 11921, 14443, 11883, 14439, 11842, 14435, 11804, 14431, 11766, 14428, 11729,
+		14424, 11692, 14421, 11657, 14417, 11623, 14413, 11588, 14410, 11554, 14407, 11524, 14403, 11492, 14399, 11462,
+		14395, 11430, 14392, 11403, 14389, 11375, 14385, 11346, 14382, 11320, 14378, 11293, 14375, 11268, 14371, 11221,
+		14368, 11169, 14364, 11122, 14360, 11072, 14357, 11033, 14353, 10984, 14350, 10940, 14347, 10899, 14343, 10856,
+		14340, 10815, 14337, 10774, 14332, 10738, 14324, 10699, 14317, 10662, 14309, 10623, 14303, 10590, 14296, 10555,
+		14289, 10520, 14282, 10488, 14275, 10454, 14270, 10426, 14263, 10393, 14256, 10363, 14249, 10333, 14243, 10305,
+		14236, 10278, 14229, 10249, 14221, 10199, 14216, 10155, 14210, 10105, 14203, 10052, 14196, 9999, 14190, 9954,
+		14184, 9911, 14177, 9865, 14170, 9818, 14163, 9773, 14156, 9729, 14150, 9688, 14144, 9648, 14138, 9612,
+		14131, 9572, 14124, 9534, 14118, 9497, 14112, 9461, 14105, 9425, 14099, 9392, 14093, 9358, 14087, 9326,
+		14080, 9294, 14074, 9262, 14067, 9233, 14060, 9187, 14055, 9131, 14048, 9074, 14042, 9020, 14035, 8962,
+		14030, 8914, 14024, 8862, 14018, 8813, 14010, 8761, 14004, 8716, 13998, 8667, 13993, 8625, 13986, 8580,
+		13980, 8538, 13974, 8496, 13968, 8455, 13962, 8417, 13956, 8378, 13950, 8339, 13944, 8301, 13939, 8268,
+		13933, 8232, 13927, 8199, 13920, 8138, 13914, 8074, 13908, 8011, 13903, 7953, 13897, 7892, 13891, 7834,
+		13885, 7778, 13880, 7725, 13874, 7670, 13869, 7621, 13862, 7567, 13857, 7519, 13851, 7472, 13845, 7428,
+		13839, 7380, 13833, 7337, 13828, 7294, 13822, 7252, 13817, 7214, 13811, 7174, 13806, 7109, 13800, 7032,
+		13796, 6965, 13789, 6893, 13783, 6825, 13778, 6759, 13773, 6700, 13767, 6636, 13762, 6576, 13756, 6520,
+		13751, 6464, 13746, 6409, 13740, 6355, 13735, 6309, 13729, 6255, 13724, 6212, 13719, 6163, 13714, 6094,
+		13708, 6008, 13704, 5929, 13698, 5848, 13693, 5769, 13688, 5696, 13682, 5621, 13677, 5554, 13672, 5485,
+		13668, 5421, 13662, 5357, 13657, 5296, 13652, 5239, 13647, 5181, 13642, 5128, 13637, 5027, 13632, 4928,
+		13628, 4837, 13622, 4735, 13618, 4650, 13613, 4567, 13608, 4479, 13603, 4396, 13598, 4324, 13594, 4252,
+		13589, 4180, 13583, 4112, 13579, 4003, 13574, 3879, 13570, 3760, 13565, 3647, 13560, 3538, 13556, 3437,
+		13551, 3334, 13547, 3244, 13542, 3155, 13538, 3070, 13532, 2902, 13528, 2750, 13524, 2604, 13519, 2464,
+		13515, 2332, 13510, 2206, 13506, 2090, 13501, 1909, 13497, 1699, 13493, 1499, 13488, 1313, 13484, 1135,
+		14749, 16145, 14744, 15820, 14738, 15629, 14732, 15495, 14726, 15393, 14721, 15267, 14714, 15130, 14710, 15020,
+		14703, 14917, 14698, 14829, 14694, 14747, 14688, 14676, 14684, 14611, 14679, 14555, 14674, 14500, 14669, 14449,
+		14664, 14403, 14660, 14358, 14656, 14306, 14652, 14230, 14646, 14157, 14642, 14090, 14638, 14027, 14634, 13969,
+		14629, 13908, 14626, 13857, 14621, 13807, 14616, 13756, 14612, 13711, 14607, 13664, 14604, 13624, 14600, 13584,
+		14596, 13546, 14593, 13509, 14588, 13472, 14583, 13438, 14580, 13406, 14576, 13374, 14570, 13340, 14567, 13312,
+		14563, 13256, 14560, 13203, 14556, 13149, 14552, 13099, 14548, 13048, 14544, 13000, 14540, 12953, 14536, 12910,
+		14532, 12867, 14528, 12825, 14525, 12786, 14521, 12745, 14517, 12705, 14514, 12670, 14509, 12632, 14506, 12599,
+		14502, 12567, 14498, 12530, 14495, 12502, 14491, 12470, 14487, 12439, 14484, 12411, 14480, 12381, 14476, 12353,
+		14472, 12326, 14469, 12302, 14465, 12261, 14462, 12215, 14459, 12166, 14454, 12118, 14451, 12071, 14447, 12026,
+		14444, 11983, 14441, 11942, 14437, 11900, 14433, 11855, 14429, 11820, 14426, 11779, 14422, 11742, 14418, 11706,
+		14415, 11669, 14411, 11636, 14408, 11602, 14405, 11570, 14401, 11537, 14397, 11504, 14394, 11475, 14390, 11443,
+		14386, 11413, 14383, 11385, 14379, 11358, 14376, 11330, 14373, 11303, 14370, 11279, 14366, 11243, 14363, 11193,
+		14359, 11144, 14356, 11097, 14352, 11050, 14348, 11001, 14346, 10964, 14342, 10916, 14339, 10876, 14335, 10836,
+		14329, 10795, 14322, 10756, 14313, 10714, 14308, 10679, 14301, 10644, 14294, 10607, 14286, 10571, 14280, 10537,
+		14274, 10505, 14268, 10472, 14260, 10440, 14253, 10406, 14248, 10379, 14241, 10348, 14233, 10319, 14226, 10290,
+		14220, 10262, 14214, 10233, 14207, 10179, 14200, 10124, 14194, 10075, 14189, 10031, 14182, 9981, 14175, 9932,
+		14168, 9884, 14161, 9839, 14156, 9800, 14150, 9757, 14143, 9715, 14136, 9672, 14130, 9633, 14123, 9591,
+		14117, 9553, 14111, 9517, 14105, 9484, 14099, 9447, 14092, 9411, 14086, 9378, 14079, 9344, 14073, 9313,
+		14066, 9279, 14060, 9250, 14054, 9220, 14048, 9167, 14041, 9108, 14036, 9052, 14029, 8998, 14024, 8947,
+		14018, 8895, 14011, 8844, 14005, 8796, 13999, 8747, 13993, 8701, 13987, 8654, 13981, 8610, 13975, 8565,
+		13969, 8526, 13963, 8483, 13957, 8444, 13951, 8403, 13945, 8366, 13940, 8328, 13935, 8295, 13927, 8256,
+		13921, 8222, 13915, 8185, 13910, 8123, 13904, 8058, 13899, 7997, 13893, 7937, 13887, 7880, 13881, 7821,
+		13876, 7767, 13870, 7712, 13864, 7658, 13859, 7610, 13852, 7558, 13847, 7511, 13841, 7461, 13836, 7418,
+		13829, 7371, 13826, 7332, 13819, 7286, 13814, 7249, 13808, 7205, 13803, 7169, 13797, 7093, 13791, 7021,
+		13786, 6954, 13780, 6881, 13775, 6818, 13770, 6751, 13765, 6690, 13759, 6626, 13754, 6572, 13749, 6513,
+		13743, 6459, 13738, 6401, 13734, 6357, 13728, 6302, 13722, 6254, 13717, 6205, 13712, 6161, 13707, 6094,
+		13702, 6005, 13697, 5925, 13691, 5840, 13686, 5767, 13681, 5690, 13676, 5620, 13671, 5546, 13666, 5482,
+		13661, 5418, 13656, 5355, 13651, 5297, 13646, 5236, 13641, 5182, 13636, 5125, 13632, 5025, 13627, 4931,
+		13621, 4826, 13617, 4733, 13612, 4652, 13607, 4560, 13603, 4481, 13598, 4406, 13593, 4327, 13588, 4252,
+		13583, 4180, 13578, 4111, 13574, 4006, 13570, 3883, 13565, 3765, 13560, 3647, 13555, 3539, 13551, 3438,
+		13547, 3342, 13542, 3245, 13538, 3157, 13533, 3073, 13528, 2905, 13524, 2761, 13519, 2607, 13515, 2470,
+		13511, 2342, 13507, 2215, 13502, 2096, 13498, 1920, 13494, 1709, 13489, 1509, 13485, 1322, 13480, 1144,
+		14742, 16123, 14736, 15801, 14730, 15613, 14724, 15481, 14718, 15380, 14712, 15235, 14707, 15107, 14702, 14998,
+		14694, 14888, 14690, 14807, 14685, 14729, 14679, 14656, 14675, 14595, 14671, 14537, 14665, 14482, 14660, 14431,
+		14656, 14390, 14652, 14346, 14648, 14277, 14643, 14201, 14637, 14132, 14634, 14066, 14628, 14000, 14625, 13942,
+		14621, 13890, 14617, 13835, 14612, 13784, 14607, 13736, 14603, 13689, 14599, 13648, 14594, 13602, 14591, 13567,
+		14587, 13524, 14583, 13490, 14579, 13457, 14574, 13421, 14570, 13388, 14566, 13358, 14562, 13326, 14557, 13279,
+		14554, 13226, 14550, 13173, 14546, 13120, 14543, 13070, 14539, 13024, 14534, 12973, 14531, 12929, 14527, 12886,
+		14523, 12843, 14519, 12800, 14515, 12761, 14512, 12726, 14508, 12685, 14504, 12648, 14501, 12615, 14497, 12580,
+		14493, 12546, 14489, 12514, 14485, 12481, 14482, 12453, 14478, 12422, 14474, 12392, 14472, 12368, 14467, 12337,
+		14463, 12311, 14460, 12283, 14457, 12234, 14453, 12183, 14449, 12136, 14445, 12089, 14442, 12045, 14439, 12002,
+		14435, 11958, 14432, 11916, 14428, 11876, 14424, 11834, 14419, 11791, 14417, 11760, 14413, 11719, 14410, 11684,
+		14406, 11650, 14403, 11616, 14399, 11582, 14396, 11549, 14392, 11517, 14389, 11487, 14385, 11455, 14382, 11428,
+		14378, 11397, 14374, 11368, 14371, 11342, 14368, 11315, 14365, 11289, 14361, 11261, 14358, 11217, 14354, 11165,
+		14351, 11118, 14347, 11070, 14344, 11025, 14341, 10981, 14337, 10934, 14333, 10895, 14326, 10853, 14319, 10811,
+		14312, 10773, 14305, 10733, 14298, 10697, 14291, 10658, 14284, 10622, 14278, 10589, 14272, 10554, 14265, 10520,
+		14258, 10486, 14252, 10456, 14246, 10425, 14239, 10392, 14232, 10361, 14225, 10334, 14219, 10306, 14212, 10278,
+		14205, 10249, 14199, 10205, 14193, 10155, 14187, 10103, 14180, 10053, 14173, 10003, 14166, 9955, 14161, 9911,
+		14154, 9865, 14147, 9819, 14140, 9774, 14135, 9735, 14128, 9694, 14122, 9653, 14117, 9616, 14110, 9577,
+		14103, 9538, 14097, 9502, 14091, 9466, 14085, 9430, 14079, 9398, 14073, 9365, 14066, 9332, 14060, 9300,
+		14054, 9271, 14047, 9238, 14041, 9201, 14035, 9142, 14030, 9090, 14024, 9036, 14018, 8981, 14012, 8926,
+		14005, 8876, 13999, 8828, 13992, 8776, 13986, 8729, 13981, 8685, 13976, 8642, 13969, 8595, 13964, 8553,
+		13957, 8511, 13952, 8472, 13946, 8431, 13941, 8394, 13934, 8353, 13928, 8318, 13923, 8283, 13916, 8248,
+		13911, 8215, 13905, 8168, 13900, 8106, 13893, 8039, 13888, 7980, 13883, 7922, 13877, 7863, 13871, 7806,
+		13866, 7753, 13860, 7698, 13854, 7649, 13848, 7595, 13843, 7546, 13837, 7499, 13832, 7453, 13826, 7407,
+		13822, 7365, 13816, 7321, 13810, 7280, 13805, 7241, 13799, 7200, 13794, 7158, 13788, 7077, 13783, 7010,
+		13777, 6937, 13772, 6869, 13767, 6805, 13762, 6744, 13757, 6680, 13751, 6621, 13746, 6562, 13741, 6505,
+		13736, 6451, 13730, 6397, 13725, 6347, 13719, 6295, 13714, 6248, 13709, 6201, 13705, 6158, 13700, 6082,
+		13695, 6002, 13689, 5913, 13685, 5837, 13679, 5760, 13674, 5685, 13669, 5614, 13664, 5541, 13660, 5482,
+		13654, 5412, 13650, 5355, 13644, 5289, 13640, 5234, 13635, 5177, 13630, 5123, 13626, 5030, 13621, 4925,
+		13616, 4830, 13611, 4740, 13606, 4649, 13602, 4565, 13597, 4480, 13592, 4397, 13587, 4325, 13583, 4256,
+		13579, 4185, 13574, 4115, 13570, 4009, 13565, 3883, 13560, 3769, 13556, 3654, 13551, 3543, 13546, 3439,
+		13542, 3345, 13538, 3250, 13533, 3161, 13529, 3076, 13524, 2916, 13520, 2761, 13516, 2619, 13511, 2474,
+		13507, 2346, 13502, 2218, 13498, 2102, 13494, 1932, 13490, 1721, 13485, 1520, 13481, 1331, 13477, 1153,
+		14734, 16102, 14728, 15777, 14723, 15596, 14717, 15466, 14711, 15367, 14705, 15211, 14699, 15081, 14694, 14972,
+		14686, 14868, 14682, 14787, 14677, 14709, 14672, 14639, 14667, 14576, 14663, 14521, 14656, 14463, 14652, 14417,
+		14647, 14371, 14643, 14323, 14639, 14247, 14634, 14175, 14629, 14104, 14625, 14039, 14620, 13977, 14616, 13918,
+		14613, 13867, 14607, 13812, 14603, 13762, 14598, 13714, 14593, 13668, 14590, 13627, 14585, 13584, 14582, 13546,
+		14578, 13507, 14574, 13470, 14569, 13437, 14565, 13404, 14561, 13372, 14557, 13341, 14553, 13312, 14549, 13253,
+		14545, 13195, 14541, 13142, 14538, 13094, 14533, 13044, 14529, 12995, 14525, 12950, 14522, 12905, 14517, 12859,
+		14514, 12819, 14510, 12780, 14506, 12739, 14503, 12701, 14499, 12666, 14495, 12628, 14491, 12593, 14488, 12561,
+		14483, 12526, 14480, 12496, 14476, 12463, 14472, 12432, 14469, 12405, 14465, 12375, 14461, 12348, 14458, 12323,
+		14454, 12295, 14452, 12255, 14447, 12203, 14443, 12154, 14440, 12111, 14436, 12061, 14433, 12018, 14429, 11974,
+		14426, 11932, 14422, 11889, 14418, 11848, 14415, 11813, 14412, 11775, 14407, 11733, 14405, 11700, 14401, 11662,
+		14397, 11628, 14394, 11596, 14390, 11561, 14387, 11530, 14383, 11498, 14380, 11469, 14376, 11439, 14373, 11408,
+		14370, 11383, 14367, 11354, 14363, 11326, 14360, 11300, 14356, 11275, 14353, 11233, 14349, 11181, 14346, 11139,
+		14342, 11090, 14339, 11043, 14335, 10998, 14329, 10955, 14323, 10914, 14316, 10869, 14309, 10828, 14302, 10792,
+		14295, 10751, 14288, 10711, 14282, 10674, 14276, 10640, 14268, 10602, 14262, 10568, 14255, 10534, 14249, 10503,
+		14243, 10471, 14236, 10436, 14230, 10408, 14222, 10377, 14216, 10347, 14210, 10318, 14203, 10290, 14197, 10265,
+		14191, 10234, 14185, 10180, 14178, 10125, 14172, 10080, 14166, 10032, 14160, 9984, 14152, 9932, 14146, 9888,
+		14140, 9845, 14134, 9803, 14128, 9759, 14121, 9715, 14114, 9674, 14107, 9632, 14103, 9598, 14096, 9560,
+		14090, 9522, 14084, 9490, 14077, 9450, 14071, 9416, 14065, 9382, 14059, 9351, 14053, 9318, 14046, 9287,
+		14040, 9255, 14035, 9227, 14029, 9180, 14023, 9123, 14018, 9069, 14011, 9011, 14005, 8960, 13999, 8908,
+		13993, 8859, 13986, 8806, 13982, 8763, 13976, 8715, 13969, 8667, 13963, 8624, 13958, 8582, 13952, 8539,
+		13946, 8499, 13940, 8458, 13934, 8418, 13929, 8380, 13922, 8341, 13917, 8306, 13911, 8272, 13906, 8238,
+		13900, 8203, 13895, 8151, 13889, 8087, 13883, 8023, 13878, 7965, 13873, 7907, 13866, 7847, 13861, 7792,
+		13855, 7739, 13850, 7685, 13844, 7636, 13839, 7583, 13833, 7538, 13828, 7489, 13823, 7443, 13818, 7398,
+		13812, 7357, 13807, 7313, 13801, 7272, 13795, 7231, 13790, 7194, 13785, 7141, 13779, 7070, 13775, 7001,
+		13770, 6932, 13764, 6862, 13759, 6796, 13754, 6734, 13748, 6671, 13743, 6613, 13738, 6556, 13733, 6501,
+		13727, 6443, 13722, 6393, 13717, 6340, 13713, 6292, 13708, 6243, 13703, 6200, 13697, 6153, 13693, 6077,
+		13687, 5990, 13682, 5909, 13677, 5832, 13672, 5752, 13667, 5680, 13662, 5607, 13658, 5543, 13653, 5474,
+		13648, 5413, 13643, 5350, 13639, 5289, 13634, 5233, 13629, 5175, 13625, 5124, 13619, 5021, 13615, 4922,
+		13610, 4831, 13605, 4731, 13601, 4647, 13596, 4564, 13591, 4478, 13588, 4406, 13583, 4327, 13578, 4252,
+		13573, 4181, 13569, 4116, 13564, 4010, 13560, 3889, 13555, 3765, 13551, 3657, 13546, 3549, 13542, 3443,
+		13537, 3349, 13533, 3253, 13528, 3164, 13524, 3078, 13520, 2922, 13516, 2770, 13511, 2623, 13507, 2481,
+		13503, 2351, 13499, 2227, 13495, 2109, 13490, 1936, 13486, 1730, 13482, 1528, 13477, 1340, 13473, 1162,
+		14727, 16072, 14721, 15762, 14716, 15578, 14709, 15451, 14703, 15347, 14697, 15188, 14692, 15061, 14685, 14946,
+		14679, 14847, 14675, 14768, 14669, 14689, 14664, 14620, 14659, 14560, 14655, 14504, 14648, 14448, 14644, 14402,
+		14639, 14357, 14635, 14292, 14630, 14218, 14625, 14145, 14620, 14077, 14616, 14015, 14612, 13953, 14608, 13895,
+		14604, 13843, 14599, 13791, 14593, 13740, 14589, 13695, 14584, 13646, 14580, 13604, 14577, 13564, 14573, 13526,
+		14570, 13491, 14565, 13454, 14560, 13419, 14556, 13388, 14551, 13354, 14548, 13325, 14545, 13286, 14541, 13227,
+		14537, 13171, 14532, 13117, 14528, 13064, 14524, 13015, 14520, 12970, 14517, 12926, 14512, 12877, 14508, 12836,
+		14505, 12796, 14501, 12754, 14497, 12717, 14494, 12678, 14490, 12645, 14486, 12609, 14482, 12574, 14478, 12540,
+		14474, 12507, 14470, 12475, 14467, 12447, 14463, 12413, 14460, 12386, 14456, 12359, 14452, 12331, 14449, 12306,
+		14445, 12272, 14441, 12219, 14438, 12173, 14434, 12124, 14431, 12079, 14428, 12034, 14424, 11990, 14420, 11946,
+		14416, 11905, 14413, 11864, 14409, 11825, 14406, 11786, 14403, 11751, 14399, 11714, 14395, 11675, 14392, 11644,
+		14389, 11607, 14385, 11574, 14382, 11542, 14378, 11510, 14374, 11479, 14371, 11451, 14368, 11421, 14364, 11392,
+		14361, 11364, 14359, 11339, 14354, 11310, 14351, 11285, 14347, 11252, 14344, 11205, 14341, 11157, 14337, 11104,
+		14332, 11063, 14325, 11018, 14318, 10970, 14312, 10928, 14305, 10887, 14299, 10848, 14291, 10804, 14284, 10763,
+		14279, 10730, 14272, 10691, 14265, 10653, 14258, 10617, 14253, 10585, 14246, 10549, 14239, 10515, 14232, 10482,
+		14228, 10454, 14220, 10422, 14213, 10389, 14207, 10360, 14200, 10330, 14194, 10303, 14188, 10276, 14181, 10246,
+		14176, 10206, 14170, 10154, 14164, 10104, 14156, 10050, 14150, 10004, 14145, 9960, 14138, 9913, 14132, 9867,
+		14126, 9822, 14120, 9780, 14113, 9739, 14109, 9703, 14102, 9660, 14095, 9618, 14088, 9579, 14081, 9540,
+		14076, 9505, 14071, 9471, 14064, 9437, 14058, 9402, 14052, 9368, 14046, 9338, 14040, 9305, 14034, 9275,
+		14028, 9244, 14023, 9215, 14017, 9156, 14011, 9103, 14004, 9044, 13998, 8991, 13991, 8938, 13987, 8891,
+		13981, 8839, 13975, 8791, 13969, 8744, 13964, 8698, 13958, 8656, 13952, 8611, 13946, 8567, 13940, 8525,
+		13935, 8486, 13929, 8444, 13923, 8406, 13917, 8368, 13912, 8334, 13906, 8296, 13901, 8262, 13895, 8226,
+		13890, 8194, 13884, 8132, 13878, 8069, 13872, 8007, 13867, 7948, 13862, 7891, 13856, 7833, 13851, 7781,
+		13845, 7724, 13840, 7674, 13834, 7621, 13829, 7571, 13824, 7526, 13819, 7480, 13813, 7431, 13807, 7386,
+		13802, 7346, 13797, 7304, 13791, 7262, 13786, 7223, 13781, 7184, 13776, 7128, 13771, 7057, 13766, 6986,
+		13761, 6918, 13755, 6848, 13750, 6786, 13745, 6722, 13740, 6664, 13735, 6602, 13730, 6548, 13724, 6489,
+		13720, 6437, 13715, 6384, 13710, 6335, 13705, 6286, 13699, 6237, 13695, 6194, 13690, 6146, 13685, 6068,
+		13679, 5979, 13675, 5905, 13670, 5822, 13666, 5754, 13661, 5675, 13656, 5605, 13651, 5539, 13646, 5469,
+		13642, 5408, 13637, 5343, 13632, 5286, 13627, 5227, 13622, 5176, 13618, 5119, 13613, 5018, 13609, 4924,
+		13604, 4823, 13599, 4734, 13595, 4645, 13590, 4557, 13585, 4478, 13581, 4400, 13576, 4323, 13572, 4256,
+		13568, 4186, 13563, 4117, 13559, 4009, 13555, 3889, 13550, 3769, 13546, 3657, 13542, 3555, 13537, 3448,
+		13532, 3349, 13528, 3256, 13524, 3168, 13520, 3082, 13516, 2935, 13511, 2773, 13507, 2628, 13503, 2487,
+		13499, 2356, 13494, 2229, 13490, 2112, 13486, 1949, 13482, 1741, 13478, 1538, 13474, 1350, 13469, 1171,
+		14720, 16052, 14714, 15742, 14708, 15558, 14702, 15437, 14695, 15323, 14689, 15165, 14684, 15037, 14678, 14923,
+		14671, 14829, 14667, 14747, 14661, 14672, 14656, 14601, 14652, 14546, 14647, 14486, 14640, 14433, 14636, 14387,
+		14631, 14341, 14627, 14269, 14622, 14190, 14616, 14122, 14612, 14052, 14607, 13988, 14603, 13925, 14599, 13873,
+		14595, 13818, 14590, 13767, 14585, 13717, 14581, 13672, 14576, 13628, 14572, 13585, 14569, 13548, 14564, 13506,
+		14561, 13474, 14555, 13435, 14551, 13401, 14547, 13371, 14543, 13339, 14539, 13307, 14535, 13248, 14532, 13197,
+		14528, 13145, 14524, 13090, 14519, 13038, 14515, 12990, 14511, 12944, 14508, 12899, 14504, 12859, 14500, 12816,
+		14496, 12772, 14492, 12734, 14489, 12695, 14485, 12658, 14481, 12621, 14478, 12591, 14473, 12554, 14469, 12522,
+		14465, 12489, 14462, 12457, 14459, 12429, 14455, 12400, 14451, 12371, 14447, 12343, 14444, 12317, 14440, 12290,
+		14437, 12245, 14433, 12190, 14429, 12143, 14426, 12099, 14422, 12053, 14418, 12008, 14415, 11964, 14411, 11920,
+		14408, 11880, 14404, 11838, 14401, 11801, 14397, 11765, 14394, 11727, 14391, 11694, 14387, 11655, 14384, 11622,
+		14380, 11588, 14376, 11555, 14373, 11524, 14369, 11492, 14366, 11462, 14363, 11433, 14359, 11403, 14357, 11377,
+		14353, 11347, 14349, 11320, 14346, 11295, 14342, 11268, 14339, 11225, 14335, 11173, 14328, 11129, 14322, 11082,
+		14314, 11032, 14310, 10994, 14303, 10950, 14296, 10904, 14289, 10862, 14283, 10825, 14277, 10786, 14269, 10746,
+		14263, 10706, 14257, 10672, 14250, 10634, 14243, 10597, 14237, 10564, 14231, 10533, 14225, 10500, 14218, 10466,
+		14211, 10434, 14205, 10404, 14199, 10377, 14192, 10345, 14185, 10315, 14180, 10290, 14175, 10263, 14168, 10232,
+		14161, 10176, 14155, 10125, 14149, 10079, 14142, 10030, 14135, 9980, 14129, 9933, 14123, 9888, 14117, 9844,
+		14111, 9802, 14105, 9758, 14099, 9717, 14093, 9678, 14087, 9639, 14082, 9604, 14076, 9564, 14070, 9530,
+		14063, 9490, 14056, 9454, 14050, 9420, 14045, 9387, 14039, 9356, 14033, 9323, 14028, 9292, 14022, 9262,
+		14016, 9233, 14010, 9190, 14003, 9132, 13997, 9078, 13991, 9024, 13986, 8972, 13980, 8921, 13975, 8873,
+		13969, 8821, 13964, 8776, 13957, 8726, 13952, 8683, 13946, 8636, 13940, 8596, 13934, 8552, 13929, 8512,
+		13923, 8469, 13917, 8433, 13912, 8395, 13907, 8358, 13901, 8320, 13895, 8285, 13890, 8252, 13884, 8217,
+		13879, 8177, 13873, 8110, 13868, 8053, 13862, 7991, 13857, 7932, 13852, 7875, 13846, 7818, 13841, 7764,
+		13836, 7713, 13830, 7661, 13825, 7610, 13819, 7560, 13814, 7514, 13808, 7466, 13803, 7421, 13799, 7380,
+		13794, 7338, 13788, 7294, 13783, 7254, 13778, 7218, 13773, 7179, 13768, 7118, 13762, 7039, 13757, 6974,
+		13751, 6904, 13746, 6837, 13742, 6779, 13737, 6714, 13732, 6655, 13727, 6593, 13722, 6541, 13717, 6482,
+		13712, 6431, 13707, 6378, 13702, 6330, 13697, 6279, 13693, 6235, 13687, 6186, 13682, 6142, 13678, 6057,
+		13674, 5977, 13668, 5894, 13663, 5818, 13659, 5743, 13654, 5667, 13649, 5601, 13644, 5531, 13640, 5469,
+		13634, 5400, 13630, 5343, 13625, 5281, 13621, 5227, 13616, 5171, 13611, 5110, 13608, 5020, 13603, 4915,
+		13598, 4820, 13594, 4731, 13590, 4645, 13585, 4565, 13581, 4479, 13576, 4401, 13571, 4326, 13567, 4254,
+		13562, 4183, 13557, 4114, 13554, 4010, 13549, 3891, 13545, 3774, 13540, 3657, 13536, 3554, 13532, 3451,
+		13527, 3352, 13523, 3258, 13519, 3171, 13515, 3085, 13510, 2932, 13507, 2780, 13502, 2633, 13498, 2497,
+		13494, 2363, 13490, 2235, 13486, 2119, 13482, 1958, 13478, 1749, 13474, 1545, 13469, 1356, 13465, 1178,
+		14713, 16024, 14707, 15725, 14701, 15539, 14695, 15423, 14688, 15298, 14682, 15141, 14677, 15015, 14671, 14901,
+		14663, 14809, 14660, 14729, 14653, 14651, 14649, 14585, 14644, 14528, 14638, 14470, 14632, 14417, 14627, 14371,
+		14623, 14319, 14619, 14242, 14614, 14161, 14608, 14092, 14604, 14027, 14599, 13963, 14595, 13905, 14591, 13847,
+		14586, 13794, 14582, 13747, 14576, 13697, 14572, 13654, 14568, 13610, 14564, 13567, 14560, 13530, 14556, 13491,
+		14552, 13454, 14547, 13420, 14543, 13387, 14538, 13354, 14534, 13324, 14530, 13276, 14526, 13218, 14523, 13167,
+		14520, 13117, 14515, 13066, 14511, 13015, 14507, 12965, 14503, 12919, 14499, 12875, 14495, 12832, 14491, 12789,
+		14487, 12752, 14484, 12715, 14480, 12673, 14476, 12639, 14472, 12602, 14468, 12567, 14464, 12535, 14460, 12502,
+		14457, 12470, 14453, 12440, 14450, 12410, 14447, 12384, 14443, 12355, 14438, 12326, 14435, 12301, 14432, 12263,
+		14428, 12213, 14425, 12168, 14421, 12118, 14417, 12069, 14413, 12026, 14410, 11982, 14407, 11940, 14403, 11897,
+		14399, 11856, 14396, 11818, 14392, 11777, 14389, 11743, 14386, 11706, 14382, 11671, 14379, 11637, 14375, 11601,
+		14371, 11567, 14368, 11537, 14365, 11506, 14361, 11475, 14358, 11444, 14355, 11417, 14351, 11385, 14348, 11358,
+		14345, 11333, 14341, 11305, 14337, 11279, 14333, 11246, 14326, 11195, 14318, 11147, 14311, 11096, 14306, 11055,
+		14300, 11011, 14292, 10962, 14287, 10923, 14282, 10886, 14273, 10841, 14267, 10802, 14261, 10763, 14254, 10726,
+		14247, 10687, 14242, 10651, 14236, 10617, 14229, 10583, 14222, 10547, 14216, 10513, 14209, 10481, 14203, 10451,
+		14196, 10418, 14190, 10389, 14184, 10359, 14179, 10333, 14173, 10303, 14165, 10274, 14159, 10248, 14154, 10204,
+		14148, 10157, 14140, 10102, 14133, 10051, 14127, 10004, 14122, 9959, 14117, 9915, 14110, 9867, 14103, 9823,
+		14098, 9781, 14092, 9741, 14085, 9700, 14079, 9658, 14073, 9619, 14066, 9578, 14061, 9545, 14057, 9513,
+		14051, 9477, 14046, 9444, 14039, 9408, 14032, 9373, 14026, 9340, 14021, 9311, 14015, 9279, 14009, 9248,
+		14003, 9221, 13997, 9167, 13991, 9110, 13986, 9059, 13980, 9003, 13974, 8952, 13969, 8904, 13963, 8852,
+		13957, 8803, 13951, 8757, 13946, 8711, 13940, 8665, 13934, 8623, 13929, 8580, 13923, 8537, 13918, 8497,
+		13913, 8461, 13907, 8421, 13901, 8382, 13896, 8346, 13890, 8309, 13885, 8276, 13879, 8240, 13874, 8208,
+		13868, 8157, 13863, 8098, 13857, 8032, 13852, 7973, 13847, 7917, 13842, 7863, 13837, 7806, 13831, 7751,
+		13826, 7700, 13821, 7648, 13816, 7599, 13810, 7551, 13804, 7503, 13800, 7457, 13795, 7414, 13789, 7369,
+		13784, 7328, 13779, 7286, 13774, 7247, 13769, 7207, 13763, 7170, 13758, 7100, 13754, 7029, 13748, 6960,
+		13743, 6890, 13738, 6829, 13733, 6762, 13729, 6706, 13723, 6641, 13719, 6589, 13714, 6531, 13709, 6477,
+		13704, 6423, 13699, 6372, 13694, 6323, 13690, 6276, 13685, 6227, 13680, 6182, 13675, 6135, 13671, 6050,
+		13666, 5966, 13660, 5887, 13656, 5811, 13651, 5735, 13646, 5664, 13642, 5592, 13638, 5529, 13633, 5460,
+		13628, 5400, 13624, 5339, 13619, 5278, 13615, 5227, 13610, 5167, 13606, 5114, 13601, 5012, 13596, 4913,
+		13592, 4819, 13587, 4726, 13583, 4643, 13578, 4554, 13574, 4477, 13570, 4399, 13565, 4319, 13561, 4251,
+		13557, 4185, 13553, 4120, 13548, 4009, 13544, 3889, 13540, 3775, 13536, 3664, 13531, 3553, 13527, 3452,
+		13523, 3357, 13518, 3260, 13515, 3175, 13510, 3088, 13506, 2938, 13502, 2786, 13498, 2638, 13493, 2499,
+		13489, 2365, 13486, 2243, 13481, 2119, 13477, 1970, 13474, 1758, 13469, 1552, 13465, 1365, 13462, 1187,
+		14706, 16004, 14700, 15709, 14693, 15519, 14688, 15407, 14681, 15275, 14675, 15114, 14669, 14990, 14662, 14876,
+		14656, 14792, 14652, 14709, 14645, 14632, 14642, 14570, 14636, 14509, 14630, 14453, 14625, 14404, 14620, 14357,
+		14615, 14289, 14611, 14215, 14606, 14138, 14600, 14067, 14596, 14002, 14591, 13940, 14587, 13883, 14583, 13829,
+		14578, 13775, 14573, 13726, 14568, 13679, 14564, 13634, 14560, 13593, 14556, 13549, 14552, 13511, 14549, 13476,
+		14543, 13439, 14539, 13406, 14534, 13370, 14530, 13339, 14526, 13307, 14522, 13249, 14518, 13189, 14514, 13135,
+		14511, 13087, 14507, 13039, 14503, 12991, 14498, 12942, 14494, 12895, 14490, 12851, 14487, 12810, 14483, 12770,
+		14479, 12730, 14475, 12688, 14472, 12657, 14467, 12617, 14464, 12583, 14459, 12547, 14456, 12517, 14452, 12483,
+		14448, 12452, 14445, 12424, 14441, 12394, 14438, 12365, 14434, 12340, 14430, 12310, 14427, 12283, 14424, 12235,
+		14419, 12181, 14416, 12135, 14412, 12090, 14408, 12042, 14405, 11997, 14401, 11955, 14397, 11910, 14395, 11876,
+		14391, 11833, 14387, 11795, 14384, 11757, 14381, 11721, 14377, 11685, 14374, 11648, 14370, 11614, 14367, 11585,
+		14363, 11549, 14360, 11518, 14356, 11487, 14353, 11456, 14349, 11427, 14346, 11397, 14343, 11370, 14340, 11342,
+		14336, 11315, 14331, 11291, 14323, 11265, 14316, 11213, 14309, 11168, 14304, 11121, 14297, 11076, 14291, 11027,
+		14285, 10986, 14279, 10944, 14270, 10896, 14264, 10856, 14259, 10822, 14251, 10780, 14245, 10739, 14238, 10702,
+		14233, 10667, 14226, 10632, 14219, 10594, 14213, 10562, 14207, 10529, 14202, 10498, 14195, 10464, 14188, 10433,
+		14182, 10404, 14176, 10374, 14170, 10345, 14163, 10314, 14157, 10288, 14152, 10262, 14145, 10227, 14138, 10177,
+		14132, 10126, 14126, 10077, 14120, 10031, 14114, 9980, 14108, 9936, 14102, 9890, 14097, 9850, 14090, 9804,
+		14085, 9764, 14078, 9720, 14072, 9682, 14067, 9644, 14060, 9603, 14055, 9568, 14048, 9527, 14041, 9490,
+		14036, 9456, 14029, 9422, 14026, 9395, 14020, 9361, 14014, 9328, 14008, 9296, 14002, 9268, 13996, 9236,
+		13990, 9200, 13984, 9144, 13978, 9088, 13973, 9035, 13968, 8983, 13962, 8933, 13956, 8880, 13951, 8833,
+		13945, 8784, 13940, 8740, 13934, 8694, 13929, 8651, 13923, 8609, 13918, 8565, 13911, 8523, 13907, 8484,
+		13901, 8446, 13896, 8406, 13890, 8369, 13884, 8332, 13879, 8299, 13873, 8264, 13868, 8230, 13863, 8197,
+		13857, 8137, 13853, 8077, 13848, 8018, 13842, 7960, 13837, 7901, 13832, 7846, 13826, 7788, 13821, 7738,
+		13816, 7686, 13810, 7634, 13805, 7584, 13800, 7538, 13795, 7493, 13790, 7447, 13785, 7403, 13780, 7360,
+		13775, 7319, 13770, 7279, 13765, 7239, 13759, 7200, 13755, 7160, 13750, 7085, 13745, 7020, 13740, 6947,
+		13735, 6883, 13730, 6815, 13725, 6757, 13720, 6692, 13715, 6635, 13711, 6578, 13706, 6522, 13700, 6467,
+		13696, 6416, 13692, 6366, 13687, 6316, 13682, 6268, 13677, 6220, 13672, 6178, 13667, 6118, 13663, 6041,
+		13657, 5953, 13653, 5878, 13649, 5800, 13645, 5735, 13640, 5656, 13635, 5590, 13631, 5523, 13626, 5456,
+		13622, 5397, 13617, 5333, 13613, 5280, 13607, 5217, 13604, 5166, 13598, 5106, 13595, 5007, 13591, 4912,
+		13586, 4816, 13582, 4731, 13577, 4637, 13573, 4557, 13569, 4475, 13564, 4396, 13560, 4327, 13556, 4255,
+		13551, 4181, 13547, 4115, 13542, 4010, 13539, 3889, 13534, 3774, 13530, 3663, 13526, 3554, 13522, 3451,
+		13518, 3358, 13513, 3263, 13509, 3173, 13505, 3091, 13502, 2948, 13497, 2789, 13493, 2646, 13489, 2505,
+		13485, 2370, 13481, 2248, 13477, 2128, 13473, 1977, 13469, 1768, 13465, 1561, 13461, 1372, 13457, 1195,
+		14700, 15988, 14694, 15690, 14686, 15504, 14681, 15391, 14674, 15246, 14668, 15092, 14662, 14967, 14654, 14856,
+		14649, 14772, 14644, 14687, 14638, 14614, 14634, 14552, 14628, 14491, 14622, 14438, 14617, 14388, 14612, 14341,
+		14608, 14267, 14603, 14189, 14597, 14114, 14593, 14045, 14588, 13978, 14584, 13917, 14580, 13862, 14575, 13805,
+		14570, 13754, 14565, 13708, 14561, 13659, 14556, 13612, 14552, 13573, 14548, 13533, 14544, 13493, 14540, 13459,
+		14534, 13421, 14531, 13389, 14526, 13356, 14522, 13324, 14518, 13276, 14514, 13220, 14511, 13168, 14506, 13110,
+		14502, 13059, 14498, 13008, 14494, 12964, 14490, 12917, 14486, 12872, 14482, 12830, 14478, 12785, 14475, 12749,
+		14470, 12707, 14467, 12670, 14463, 12635, 14459, 12599, 14455, 12566, 14451, 12530, 14447, 12496, 14444, 12467,
+		14440, 12436, 14437, 12406, 14433, 12380, 14429, 12348, 14425, 12322, 14422, 12298, 14419, 12253, 14414, 12202,
+		14411, 12155, 14407, 12105, 14404, 12061, 14400, 12017, 14397, 11972, 14394, 11932, 14390, 11889, 14386, 11847,
+		14383, 11811, 14380, 11774, 14376, 11737, 14372, 11698, 14369, 11663, 14365, 11628, 14362, 11594, 14358, 11561,
+		14355, 11529, 14351, 11498, 14348, 11469, 14345, 11439, 14342, 11410, 14338, 11382, 14334, 11353, 14328, 11328,
+		14321, 11301, 14313, 11273, 14308, 11238, 14301, 11188, 14294, 11140, 14288, 11094, 14282, 11048, 14276, 11006,
+		14269, 10958, 14263, 10918, 14256, 10879, 14248, 10833, 14242, 10793, 14237, 10758, 14230, 10720, 14224, 10682,
+		14217, 10646, 14211, 10613, 14205, 10578, 14198, 10542, 14192, 10509, 14185, 10477, 14180, 10448, 14173, 10415,
+		14167, 10387, 14161, 10357, 14155, 10328, 14149, 10302, 14142, 10271, 14136, 10246, 14131, 10205, 14124, 10149,
+		14118, 10102, 14112, 10050, 14106, 10005, 14101, 9960, 14094, 9912, 14088, 9868, 14082, 9824, 14076, 9784,
+		14071, 9742, 14065, 9703, 14058, 9661, 14053, 9623, 14047, 9587, 14041, 9548, 14036, 9515, 14030, 9480,
+		14023, 9442, 14017, 9407, 14012, 9375, 14006, 9344, 14001, 9314, 13996, 9286, 13989, 9254, 13984, 9225,
+		13978, 9176, 13973, 9123, 13966, 9065, 13962, 9016, 13956, 8963, 13950, 8911, 13944, 8862, 13939, 8814,
+		13934, 8768, 13928, 8722, 13923, 8679, 13917, 8635, 13912, 8592, 13906, 8550, 13901, 8509, 13895, 8469,
+		13890, 8432, 13885, 8395, 13879, 8357, 13873, 8321, 13868, 8286, 13863, 8252, 13859, 8220, 13853, 8184,
+		13848, 8122, 13842, 8059, 13836, 7998, 13832, 7941, 13827, 7885, 13822, 7830, 13816, 7776, 13811, 7723,
+		13806, 7670, 13801, 7621, 13796, 7573, 13791, 7527, 13786, 7481, 13781, 7436, 13775, 7392, 13770, 7350,
+		13765, 7308, 13760, 7268, 13756, 7230, 13752, 7195, 13746, 7142, 13741, 7072, 13736, 6999, 13731, 6933,
+		13726, 6871, 13722, 6808, 13717, 6745, 13712, 6683, 13708, 6628, 13702, 6566, 13698, 6515, 13693, 6458,
+		13689, 6410, 13683, 6357, 13678, 6310, 13673, 6259, 13670, 6219, 13664, 6170, 13660, 6115, 13656, 6029,
+		13651, 5947, 13647, 5874, 13642, 5799, 13637, 5722, 13633, 5648, 13628, 5586, 13624, 5517, 13619, 5452,
+		13615, 5389, 13611, 5335, 13606, 5274, 13602, 5219, 13597, 5163, 13593, 5101, 13588, 5002, 13584, 4905,
+		13580, 4813, 13575, 4719, 13571, 4636, 13567, 4555, 13562, 4468, 13558, 4397, 13554, 4319, 13549, 4248,
+		13546, 4185, 13542, 4119, 13537, 4009, 13533, 3889, 13529, 3777, 13525, 3662, 13520, 3555, 13517, 3457,
+		13512, 3357, 13508, 3265, 13504, 3176, 13500, 3091, 13497, 2954, 13492, 2792, 13489, 2653, 13485, 2509,
+		13480, 2374, 13476, 2249, 13472, 2129, 13468, 1987, 13465, 1773, 13461, 1570, 13457, 1379, 13453, 1202,
+		14693, 15966, 14687, 15673, 14680, 15491, 14674, 15378, 14667, 15220, 14660, 15058, 14655, 14948, 14647, 14837,
+		14642, 14753, 14637, 14667, 14631, 14596, 14626, 14537, 14621, 14476, 14615, 14424, 14610, 14374, 14605, 14319,
+		14602, 14244, 14596, 14164, 14589, 14088, 14585, 14021, 14580, 13955, 14576, 13892, 14572, 13841, 14567, 13785,
+		14562, 13734, 14557, 13685, 14553, 13642, 14548, 13594, 14544, 13555, 14541, 13518, 14537, 13478, 14532, 13442,
+		14526, 13406, 14522, 13372, 14518, 13342, 14514, 13310, 14510, 13248, 14507, 13195, 14503, 13141, 14498, 13087,
+		14493, 13032, 14489, 12981, 14485, 12937, 14482, 12894, 14477, 12848, 14474, 12807, 14470, 12766, 14467, 12727,
+		14463, 12688, 14458, 12650, 14454, 12611, 14451, 12578, 14446, 12543, 14443, 12510, 14439, 12480, 14436, 12450,
+		14433, 12421, 14428, 12388, 14425, 12362, 14421, 12336, 14417, 12306, 14414, 12279, 14411, 12227, 14406, 12176,
+		14402, 12126, 14399, 12079, 14395, 12033, 14393, 11995, 14389, 11948, 14385, 11905, 14382, 11867, 14378, 11827,
+		14374, 11787, 14371, 11750, 14368, 11714, 14364, 11676, 14361, 11642, 14357, 11607, 14354, 11573, 14350, 11541,
+		14347, 11511, 14344, 11481, 14340, 11449, 14337, 11422, 14332, 11393, 14325, 11365, 14319, 11339, 14312, 11312,
+		14307, 11288, 14299, 11256, 14291, 11204, 14285, 11161, 14279, 11112, 14273, 11068, 14267, 11023, 14260, 10979,
+		14253, 10937, 14245, 10891, 14239, 10851, 14234, 10815, 14228, 10773, 14221, 10734, 14215, 10697, 14208, 10661,
+		14202, 10625, 14195, 10590, 14191, 10560, 14184, 10526, 14177, 10493, 14171, 10461, 14164, 10428, 14159, 10400,
+		14152, 10370, 14145, 10339, 14140, 10313, 14135, 10286, 14129, 10261, 14121, 10223, 14115, 10171, 14110, 10126,
+		14104, 10076, 14098, 10029, 14092, 9978, 14087, 9934, 14081, 9891, 14075, 9847, 14068, 9802, 14062, 9761,
+		14056, 9720, 14051, 9683, 14046, 9645, 14039, 9605, 14034, 9568, 14028, 9530, 14022, 9496, 14017, 9462,
+		14012, 9430, 14006, 9396, 14000, 9363, 13993, 9330, 13988, 9300, 13982, 9270, 13976, 9240, 13972, 9210,
+		13966, 9152, 13961, 9101, 13955, 9046, 13950, 8994, 13943, 8940, 13939, 8894, 13933, 8844, 13927, 8796,
+		13922, 8751, 13916, 8704, 13912, 8663, 13906, 8618, 13900, 8576, 13895, 8535, 13890, 8497, 13884, 8456,
+		13879, 8419, 13873, 8380, 13868, 8344, 13863, 8311, 13858, 8275, 13853, 8242, 13847, 8209, 13842, 8162,
+		13837, 8100, 13831, 8041, 13827, 7982, 13822, 7928, 13816, 7865, 13811, 7814, 13806, 7760, 13801, 7708,
+		13796, 7657, 13792, 7611, 13787, 7562, 13781, 7513, 13776, 7471, 13770, 7423, 13766, 7381, 13761, 7340,
+		13757, 7300, 13752, 7261, 13747, 7222, 13741, 7184, 13737, 7126, 13733, 7060, 13727, 6988, 13722, 6922,
+		13717, 6854, 13713, 6795, 13708, 6729, 13704, 6675, 13698, 6613, 13694, 6560, 13690, 6505, 13684, 6451,
+		13680, 6400, 13675, 6350, 13671, 6302, 13666, 6255, 13662, 6210, 13657, 6165, 13653, 6105, 13648, 6019,
+		13643, 5941, 13639, 5863, 13634, 5789, 13629, 5713, 13625, 5645, 13621, 5575, 13617, 5509, 13612, 5447,
+		13608, 5387, 13604, 5325, 13599, 5266, 13595, 5214, 13590, 5159, 13586, 5102, 13582, 4997, 13578, 4904,
+		13573, 4804, 13569, 4718, 13565, 4635, 13560, 4547, 13557, 4477, 13552, 4394, 13548, 4319, 13544, 4250,
+		13540, 4182, 13536, 4115, 13531, 4006, 13528, 3887, 13523, 3773, 13520, 3667, 13515, 3555, 13512, 3458,
+		13508, 3361, 13503, 3264, 13500, 3181, 13496, 3093, 13491, 2955, 13488, 2799, 13483, 2649, 13480, 2514,
+		13476, 2382, 13472, 2253, 13468, 2135, 13464, 1994, 13460, 1786, 13456, 1578, 13453, 1390, 13449, 1210,
+		14687, 15948, 14681, 15657, 14674, 15479, 14667, 15365, 14660, 15192, 14653, 15033, 14648, 14927, 14640, 14818,
+		14635, 14734, 14630, 14650, 14623, 14579, 14619, 14521, 14614, 14460, 14607, 14408, 14603, 14359, 14598, 14294,
+		14593, 14215, 14588, 14135, 14582, 14064, 14577, 13992, 14572, 13930, 14568, 13871, 14565, 13818, 14559, 13764,
+		14555, 13717, 14549, 13666, 14545, 13622, 14540, 13578, 14537, 13538, 14533, 13500, 14528, 13461, 14523, 13424,
+		14519, 13393, 14514, 13357, 14511, 13327, 14506, 13279, 14503, 13224, 14498, 13166, 14495, 13113, 14490, 13062,
+		14485, 13007, 14481, 12958, 14476, 12908, 14473, 12868, 14470, 12828, 14466, 12785, 14462, 12744, 14458, 12703,
+		14455, 12667, 14450, 12629, 14446, 12595, 14443, 12560, 14439, 12528, 14435, 12494, 14431, 12462, 14427, 12430,
+		14424, 12403, 14421, 12376, 14416, 12344, 14414, 12321, 14410, 12293, 14406, 12242, 14402, 12198, 14397, 12143,
+		14395, 12100, 14391, 12055, 14387, 12007, 14384, 11966, 14381, 11926, 14377, 11882, 14373, 11840, 14370, 11804,
+		14367, 11766, 14363, 11728, 14360, 11691, 14356, 11657, 14353, 11622, 14349, 11589, 14346, 11556, 14342, 11523,
+		14339, 11491, 14336, 11463, 14329, 11434, 14322, 11403, 14317, 11377, 14310, 11349, 14303, 11322, 14296, 11296,
+		14290, 11270, 14284, 11234, 14276, 11179, 14269, 11130, 14264, 11084, 14257, 11039, 14251, 10997, 14244, 10952,
+		14237, 10910, 14231, 10870, 14224, 10827, 14218, 10787, 14213, 10753, 14207, 10714, 14200, 10677, 14194, 10643,
+		14188, 10607, 14181, 10573, 14175, 10538, 14168, 10505, 14163, 10475, 14157, 10444, 14151, 10413, 14144, 10383,
+		14139, 10357, 14133, 10328, 14127, 10299, 14120, 10271, 14114, 10246, 14108, 10199, 14103, 10149, 14096, 10096,
+		14091, 10052, 14086, 10005, 14080, 9959, 14073, 9913, 14066, 9866, 14061, 9827, 14055, 9784, 14050, 9743,
+		14043, 9701, 14037, 9660, 14033, 9626, 14027, 9586, 14022, 9554, 14014, 9513, 14009, 9479, 14003, 9445,
+		13997, 9410, 13993, 9381, 13988, 9350, 13982, 9319, 13976, 9288, 13971, 9258, 13964, 9228, 13959, 9183,
+		13953, 9129, 13948, 9075, 13943, 9024, 13937, 8971, 13932, 8923, 13926, 8870, 13921, 8826, 13916, 8778,
+		13910, 8732, 13905, 8688, 13900, 8644, 13894, 8599, 13889, 8560, 13883, 8521, 13878, 8481, 13873, 8441,
+		13867, 8405, 13862, 8368, 13858, 8334, 13852, 8297, 13847, 8265, 13842, 8231, 13837, 8199, 13832, 8142,
+		13826, 8083, 13821, 8021, 13817, 7966, 13811, 7905, 13807, 7853, 13802, 7799, 13796, 7745, 13791, 7694,
+		13786, 7642, 13782, 7596, 13776, 7547, 13771, 7503, 13767, 7459, 13762, 7414, 13757, 7372, 13753, 7331,
+		13747, 7290, 13742, 7250, 13737, 7214, 13733, 7175, 13728, 7114, 13723, 7039, 13719, 6976, 13713, 6905,
+		13710, 6846, 13705, 6781, 13700, 6721, 13695, 6663, 13690, 6603, 13685, 6548, 13681, 6495, 13677, 6443,
+		13672, 6393, 13668, 6343, 13663, 6295, 13658, 6250, 13654, 6203, 13650, 6161, 13645, 6090, 13640, 6012,
+		13635, 5927, 13632, 5852, 13627, 5778, 13623, 5706, 13618, 5636, 13614, 5571, 13610, 5507, 13605, 5440,
+		13601, 5381, 13596, 5319, 13593, 5267, 13588, 5208, 13584, 5159, 13580, 5087, 13575, 4991, 13571, 4896,
+		13567, 4803, 13564, 4721, 13558, 4627, 13555, 4547, 13550, 4466, 13546, 4389, 13542, 4320, 13538, 4245,
+		13534, 4180, 13530, 4116, 13526, 4010, 13522, 3888, 13518, 3774, 13514, 3664, 13510, 3560, 13506, 3453,
+		13502, 3360, 13498, 3267, 13494, 3179, 13490, 3096, 13486, 2954, 13483, 2803, 13479, 2657, 13474, 2514,
+		13471, 2386, 13467, 2258, 13463, 2139, 13460, 2007, 13456, 1792, 13452, 1587, 13448, 1396, 13445, 1217,
+		14680, 15930, 14674, 15641, 14667, 15468, 14660, 15340, 14654, 15166, 14646, 15012, 14641, 14904, 14633, 14798,
+		14628, 14714, 14622, 14632, 14617, 14563, 14612, 14503, 14606, 14444, 14600, 14393, 14595, 14344, 14591, 14271,
+		14586, 14189, 14580, 14106, 14575, 14041, 14569, 13968, 14566, 13913, 14561, 13851, 14557, 13798, 14552, 13747,
+		14546, 13695, 14542, 13649, 14537, 13604, 14533, 13561, 14529, 13518, 14525, 13480, 14521, 13447, 14515, 13407,
+		14511, 13374, 14507, 13343, 14502, 13307, 14498, 13253, 14495, 13196, 14490, 13137, 14486, 13083, 14482, 13034,
+		14478, 12987, 14473, 12937, 14469, 12889, 14465, 12845, 14462, 12804, 14458, 12762, 14454, 12723, 14450, 12683,
+		14446, 12646, 14442, 12609, 14438, 12573, 14434, 12539, 14431, 12507, 14427, 12476, 14424, 12446, 14420, 12415,
+		14416, 12385, 14412, 12357, 14408, 12330, 14405, 12302, 14402, 12270, 14398, 12216, 14393, 12163, 14390, 12120,
+		14386, 12069, 14383, 12026, 14381, 11988, 14376, 11940, 14373, 11898, 14370, 11862, 14366, 11821, 14362, 11780,
+		14359, 11744, 14355, 11706, 14352, 11670, 14348, 11634, 14345, 11603, 14342, 11572, 14338, 11538, 14334, 11507,
+		14327, 11476, 14319, 11442, 14314, 11417, 14308, 11390, 14301, 11359, 14294, 11333, 14288, 11307, 14281, 11281,
+		14273, 11245, 14266, 11196, 14263, 11158, 14255, 11104, 14248, 11055, 14242, 11015, 14235, 10970, 14229, 10928,
+		14222, 10886, 14216, 10845, 14211, 10809, 14204, 10767, 14197, 10726, 14192, 10694, 14185, 10657, 14179, 10622,
+		14174, 10589, 14167, 10553, 14161, 10522, 14154, 10488, 14149, 10458, 14143, 10428, 14137, 10398, 14131, 10369,
+		14124, 10338, 14119, 10313, 14113, 10286, 14106, 10257, 14100, 10223, 14094, 10171, 14089, 10123, 14084, 10077,
+		14077, 10025, 14071, 9980, 14065, 9933, 14060, 9891, 14055, 9851, 14047, 9803, 14042, 9763, 14036, 9721,
+		14031, 9685, 14026, 9646, 14020, 9608, 14013, 9569, 14007, 9531, 14003, 9501, 13997, 9467, 13991, 9431,
+		13985, 9396, 13979, 9362, 13974, 9333, 13969, 9304, 13963, 9274, 13958, 9244, 13953, 9216, 13948, 9164,
+		13942, 9105, 13936, 9053, 13931, 9001, 13925, 8948, 13920, 8902, 13915, 8854, 13910, 8806, 13904, 8759,
+		13900, 8717, 13894, 8673, 13889, 8628, 13882, 8586, 13877, 8545, 13873, 8506, 13867, 8467, 13862, 8430,
+		13857, 8391, 13852, 8356, 13847, 8321, 13841, 8287, 13836, 8253, 13832, 8221, 13826, 8187, 13821, 8122,
+		13817, 8065, 13811, 8003, 13807, 7949, 13801, 7888, 13797, 7837, 13791, 7779, 13786, 7729, 13781, 7679,
+		13777, 7631, 13772, 7584, 13767, 7536, 13762, 7491, 13758, 7447, 13753, 7404, 13748, 7362, 13743, 7323,
+		13738, 7280, 13733, 7242, 13729, 7205, 13724, 7169, 13719, 7096, 13714, 7028, 13710, 6961, 13705, 6894,
+		13701, 6835, 13695, 6767, 13691, 6711, 13687, 6652, 13682, 6597, 13677, 6540, 13673, 6487, 13669, 6433,
+		13664, 6385, 13659, 6335, 13655, 6289, 13650, 6241, 13646, 6198, 13641, 6154, 13637, 6082, 13633, 5998,
+		13629, 5920, 13625, 5849, 13620, 5771, 13616, 5700, 13611, 5629, 13607, 5566, 13602, 5496, 13598, 5434,
+		13594, 5375, 13590, 5317, 13586, 5262, 13581, 5206, 13577, 5153, 13573, 5085, 13569, 4987, 13564, 4887,
+		13560, 4799, 13556, 4709, 13553, 4630, 13548, 4543, 13545, 4466, 13540, 4391, 13536, 4312, 13533, 4249,
+		13529, 4182, 13524, 4111, 13520, 4003, 13516, 3888, 13512, 3772, 13508, 3664, 13504, 3556, 13501, 3458,
+		13497, 3360, 13493, 3269, 13489, 3180, 13485, 3097, 13481, 2958, 13477, 2809, 13473, 2658, 13470, 2524,
+		13467, 2392, 13462, 2260, 13459, 2145, 13455, 2017, 13452, 1804, 13447, 1596, 13444, 1404, 13440, 1224,
+		14674, 15913, 14668, 15624, 14660, 15454, 14654, 15314, 14647, 15144, 14639, 14994, 14635, 14888, 14627, 14781,
+		14622, 14697, 14616, 14616, 14610, 14549, 14605, 14486, 14600, 14429, 14593, 14381, 14588, 14326, 14584, 14243,
+		14578, 14159, 14573, 14082, 14568, 14017, 14563, 13949, 14558, 13889, 14554, 13831, 14549, 13775, 14544, 13726,
+		14539, 13674, 14534, 13630, 14529, 13583, 14526, 13543, 14522, 13502, 14518, 13465, 14513, 13431, 14507, 13393,
+		14503, 13358, 14499, 13328, 14495, 13282, 14491, 13224, 14487, 13166, 14483, 13114, 14478, 13058, 14474, 13007,
+		14470, 12962, 14466, 12914, 14462, 12868, 14457, 12820, 14454, 12781, 14450, 12741, 14446, 12702, 14443, 12665,
+		14438, 12625, 14434, 12590, 14431, 12556, 14427, 12523, 14423, 12489, 14419, 12458, 14416, 12429, 14412, 12399,
+		14408, 12367, 14404, 12342, 14400, 12313, 14397, 12286, 14393, 12234, 14390, 12187, 14385, 12137, 14382, 12090,
+		14379, 12048, 14375, 11999, 14372, 11958, 14369, 11919, 14365, 11873, 14361, 11834, 14358, 11797, 14354, 11758,
+		14351, 11720, 14347, 11684, 14344, 11649, 14341, 11615, 14337, 11581, 14332, 11552, 14325, 11519, 14318, 11487,
+		14312, 11459, 14305, 11429, 14298, 11396, 14292, 11371, 14285, 11345, 14278, 11314, 14272, 11291, 14265, 11266,
+		14259, 11221, 14252, 11169, 14246, 11119, 14241, 11083, 14233, 11032, 14226, 10985, 14220, 10947, 14214, 10903,
+		14209, 10865, 14202, 10823, 14196, 10782, 14191, 10750, 14184, 10711, 14177, 10671, 14172, 10639, 14165, 10603,
+		14159, 10569, 14153, 10536, 14146, 10502, 14141, 10472, 14135, 10442, 14128, 10410, 14123, 10382, 14117, 10352,
+		14111, 10325, 14104, 10296, 14098, 10270, 14093, 10245, 14086, 10193, 14081, 10147, 14075, 10095, 14069, 10047,
+		14064, 10003, 14058, 9955, 14051, 9910, 14045, 9866, 14040, 9823, 14035, 9786, 14029, 9744, 14023, 9702,
+		14017, 9662, 14012, 9626, 14007, 9590, 14001, 9553, 13995, 9517, 13989, 9481, 13984, 9447, 13980, 9419,
+		13974, 9384, 13968, 9354, 13962, 9320, 13956, 9288, 13950, 9258, 13945, 9230, 13941, 9194, 13934, 9133,
+		13930, 9086, 13924, 9033, 13919, 8978, 13914, 8930, 13909, 8881, 13904, 8834, 13898, 8786, 13893, 8744,
+		13887, 8696, 13881, 8653, 13876, 8611, 13872, 8571, 13866, 8528, 13861, 8491, 13856, 8452, 13852, 8416,
+		13846, 8378, 13841, 8343, 13836, 8308, 13831, 8275, 13827, 8243, 13821, 8211, 13816, 8163, 13811, 8102,
+		13806, 8045, 13801, 7985, 13796, 7929, 13791, 7872, 13786, 7818, 13781, 7766, 13777, 7715, 13771, 7664,
+		13767, 7618, 13762, 7571, 13758, 7524, 13753, 7480, 13748, 7437, 13743, 7391, 13737, 7350, 13733, 7309,
+		13729, 7271, 13724, 7233, 13720, 7196, 13715, 7150, 13710, 7078, 13706, 7017, 13701, 6948, 13696, 6883,
+		13691, 6816, 13688, 6760, 13683, 6698, 13679, 6640, 13674, 6586, 13669, 6530, 13665, 6478, 13660, 6426,
+		13656, 6376, 13651, 6326, 13647, 6280, 13643, 6233, 13638, 6192, 13634, 6147, 13630, 6072, 13625, 5985,
+		13621, 5914, 13616, 5835, 13613, 5765, 13608, 5689, 13604, 5625, 13600, 5556, 13596, 5492, 13592, 5433,
+		13587, 5369, 13583, 5312, 13578, 5253, 13575, 5202, 13570, 5147, 13566, 5076, 13562, 4977, 13559, 4892,
+		13555, 4792, 13550, 4708, 13546, 4620, 13542, 4539, 13539, 4468, 13534, 4386, 13530, 4314, 13526, 4244,
+		13522, 4177, 13520, 4119, 13515, 4008, 13510, 3885, 13506, 3771, 13503, 3664, 13499, 3560, 13495, 3455,
+		13491, 3358, 13488, 3270, 13484, 3180, 13480, 3098, 13476, 2963, 13472, 2810, 13469, 2662, 13465, 2525,
+		13461, 2392, 13457, 2266, 13454, 2147, 13450, 2024, 13447, 1810, 13443, 1605, 13439, 1410, 13436, 1231,
+		14668, 15898, 14662, 15607, 14654, 15443, 14648, 15291, 14641, 15119, 14633, 14975, 14628, 14865, 14620, 14764,
+		14615, 14677, 14609, 14600, 14604, 14532, 14598, 14471, 14593, 14418, 14587, 14367, 14581, 14301, 14577, 14221,
+		14572, 14139, 14566, 14063, 14561, 13997, 14556, 13928, 14551, 13866, 14547, 13811, 14542, 13756, 14537, 13707,
+		14531, 13655, 14527, 13610, 14522, 13564, 14518, 13525, 14515, 13487, 14510, 13448, 14505, 13413, 14500, 13378,
+		14495, 13341, 14492, 13314, 14488, 13255, 14483, 13192, 14479, 13138, 14475, 13084, 14471, 13034, 14466, 12979,
+		14462, 12936, 14459, 12894, 14455, 12850, 14450, 12802, 14447, 12761, 14443, 12720, 14439, 12682, 14434, 12643,
+		14430, 12604, 14427, 12573, 14423, 12539, 14419, 12504, 14416, 12476, 14412, 12442, 14408, 12412, 14404, 12382,
+		14400, 12355, 14396, 12324, 14394, 12301, 14390, 12259, 14385, 12207, 14382, 12161, 14378, 12111, 14375, 12063,
+		14372, 12022, 14368, 11976, 14364, 11933, 14361, 11893, 14357, 11850, 14353, 11810, 14350, 11772, 14347, 11736,
+		14343, 11699, 14340, 11665, 14337, 11630, 14331, 11596, 14323, 11562, 14316, 11530, 14310, 11501, 14303, 11469,
+		14296, 11439, 14291, 11412, 14285, 11384, 14276, 11353, 14270, 11328, 14264, 11303, 14255, 11273, 14249, 11237,
+		14244, 11188, 14239, 11144, 14231, 11096, 14225, 11048, 14220, 11014, 14212, 10964, 14205, 10918, 14200, 10882,
+		14195, 10841, 14189, 10804, 14182, 10763, 14175, 10723, 14169, 10691, 14163, 10654, 14157, 10616, 14151, 10585,
+		14145, 10550, 14138, 10516, 14133, 10486, 14126, 10453, 14120, 10424, 14114, 10394, 14108, 10363, 14102, 10336,
+		14095, 10308, 14090, 10282, 14084, 10255, 14078, 10214, 14074, 10169, 14068, 10118, 14062, 10074, 14055, 10021,
+		14049, 9975, 14044, 9934, 14038, 9888, 14032, 9844, 14026, 9801, 14021, 9759, 14016, 9724, 14010, 9684,
+		14004, 9641, 13999, 9607, 13992, 9568, 13987, 9534, 13982, 9498, 13977, 9465, 13971, 9431, 13966, 9397,
+		13961, 9368, 13956, 9337, 13951, 9309, 13946, 9280, 13940, 9249, 13934, 9218, 13928, 9165, 13923, 9112,
+		13918, 9059, 13912, 9007, 13907, 8957, 13902, 8909, 13897, 8861, 13891, 8814, 13886, 8767, 13881, 8726,
+		13875, 8679, 13870, 8636, 13865, 8593, 13861, 8555, 13856, 8515, 13851, 8477, 13845, 8438, 13840, 8402,
+		13835, 8365, 13830, 8331, 13825, 8297, 13820, 8262, 13816, 8231, 13811, 8198, 13806, 8145, 13801, 8084,
+		13796, 8024, 13791, 7964, 13786, 7912, 13781, 7856, 13776, 7801, 13772, 7752, 13766, 7699, 13762, 7654,
+		13757, 7604, 13753, 7558, 13748, 7509, 13743, 7467, 13738, 7422, 13734, 7383, 13729, 7340, 13725, 7300,
+		13721, 7264, 13715, 7223, 13711, 7190, 13706, 7133, 13701, 7066, 13696, 6994, 13692, 6931, 13688, 6867,
+		13684, 6807, 13680, 6748, 13674, 6684, 13670, 6629, 13665, 6573, 13661, 6519, 13657, 6469, 13652, 6419,
+		13648, 6368, 13644, 6321, 13639, 6271, 13635, 6229, 13631, 6185, 13626, 6139, 13622, 6056, 13617, 5978,
+		13614, 5902, 13610, 5829, 13605, 5753, 13601, 5683, 13597, 5616, 13592, 5548, 13588, 5487, 13584, 5423,
+		13580, 5365, 13576, 5306, 13572, 5254, 13568, 5195, 13564, 5148, 13560, 5063, 13556, 4975, 13552, 4878,
+		13547, 4787, 13544, 4705, 13539, 4616, 13536, 4539, 13531, 4455, 13528, 4385, 13524, 4312, 13520, 4240,
+		13516, 4176, 13512, 4111, 13508, 3998, 13504, 3879, 13501, 3769, 13497, 3664, 13493, 3557, 13489, 3458,
+		13485, 3358, 13482, 3269, 13478, 3183, 13474, 3095, 13471, 2969, 13467, 2810, 13463, 2668, 13460, 2527,
+		13456, 2394, 13452, 2269, 13448, 2151, 13446, 2032, 13442, 1813, 13438, 1612, 13435, 1419, 13431, 1238,
+		14662, 15865, 14656, 15594, 14648, 15430, 14642, 15271, 14635, 15096, 14627, 14957, 14622, 14849, 14614, 14746,
+		14609, 14659, 14602, 14584, 14597, 14517, 14591, 14455, 14585, 14401, 14580, 14351, 14575, 14277, 14570, 14192,
+		14564, 14111, 14558, 14042, 14553, 13968, 14549, 13907, 14544, 13843, 14540, 13791, 14534, 13736, 14529, 13684,
+		14524, 13639, 14519, 13592, 14515, 13549, 14512, 13511, 14508, 13473, 14502, 13432, 14496, 13394, 14493, 13363,
+		14488, 13328, 14484, 13286, 14480, 13225, 14476, 13170, 14472, 13113, 14467, 13059, 14463, 13010, 14458, 12958,
+		14454, 12908, 14451, 12866, 14447, 12822, 14443, 12782, 14439, 12740, 14435, 12700, 14431, 12661, 14426, 12623,
+		14423, 12588, 14419, 12553, 14415, 12520, 14412, 12488, 14408, 12456, 14404, 12424, 14400, 12393, 14396, 12364,
+		14392, 12337, 14389, 12310, 14385, 12279, 14382, 12229, 14378, 12181, 14374, 12130, 14371, 12087, 14367, 12036,
+		14364, 11992, 14361, 11953, 14357, 11909, 14353, 11865, 14349, 11827, 14345, 11786, 14342, 11750, 14339, 11714,
+		14335, 11678, 14329, 11643, 14323, 11610, 14316, 11578, 14309, 11545, 14301, 11511, 14294, 11481, 14288, 11452,
+		14282, 11422, 14277, 11395, 14269, 11366, 14262, 11340, 14255, 11312, 14248, 11287, 14243, 11264, 14236, 11207,
+		14230, 11162, 14223, 11114, 14218, 11071, 14211, 11026, 14203, 10977, 14199, 10943, 14192, 10898, 14186, 10855,
+		14180, 10818, 14174, 10778, 14168, 10743, 14160, 10703, 14154, 10665, 14149, 10632, 14143, 10599, 14136, 10563,
+		14130, 10531, 14125, 10501, 14118, 10468, 14112, 10437, 14106, 10406, 14101, 10378, 14094, 10350, 14088, 10320,
+		14083, 10295, 14077, 10268, 14071, 10241, 14066, 10192, 14060, 10139, 14055, 10094, 14049, 10047, 14043, 10001,
+		14037, 9955, 14031, 9907, 14025, 9868, 14020, 9824, 14014, 9782, 14010, 9743, 14003, 9701, 13998, 9664,
+		13992, 9628, 13987, 9590, 13981, 9554, 13975, 9515, 13971, 9484, 13965, 9449, 13960, 9418, 13954, 9386,
+		13947, 9349, 13942, 9321, 13936, 9289, 13932, 9262, 13927, 9236, 13922, 9199, 13917, 9148, 13911, 9089,
+		13906, 9037, 13901, 8988, 13895, 8933, 13891, 8891, 13886, 8842, 13880, 8795, 13875, 8750, 13870, 8706,
+		13865, 8661, 13860, 8621, 13855, 8580, 13850, 8538, 13846, 8502, 13839, 8462, 13834, 8425, 13830, 8389,
+		13824, 8351, 13820, 8320, 13815, 8285, 13811, 8253, 13805, 8219, 13801, 8185, 13795, 8121, 13790, 8064,
+		13785, 8005, 13780, 7948, 13776, 7892, 13771, 7839, 13766, 7787, 13762, 7735, 13757, 7686, 13752, 7634,
+		13747, 7587, 13743, 7543, 13738, 7498, 13733, 7456, 13729, 7411, 13725, 7371, 13720, 7329, 13716, 7293,
+		13710, 7251, 13706, 7213, 13701, 7178, 13697, 7119, 13693, 7053, 13688, 6984, 13684, 6921, 13679, 6852,
+		13675, 6793, 13670, 6730, 13666, 6678, 13661, 6616, 13657, 6563, 13652, 6508, 13649, 6458, 13644, 6406,
+		13640, 6360, 13635, 6311, 13631, 6267, 13627, 6221, 13622, 6178, 13618, 6129, 13614, 6046, 13611, 5972,
+		13606, 5889, 13602, 5818, 13598, 5743, 13594, 5676, 13589, 5608, 13585, 5542, 13581, 5477, 13577, 5418,
+		13573, 5357, 13569, 5303, 13565, 5247, 13561, 5193, 13557, 5141, 13553, 5062, 13549, 4969, 13545, 4874,
+		13541, 4783, 13537, 4696, 13533, 4616, 13530, 4532, 13526, 4457, 13522, 4380, 13517, 4306, 13514, 4243,
+		13509, 4172, 13506, 4109, 13503, 4002, 13499, 3886, 13494, 3766, 13491, 3658, 13488, 3557, 13484, 3454,
+		13480, 3364, 13476, 3267, 13473, 3182, 13469, 3098, 13465, 2965, 13461, 2812, 13458, 2668, 13454, 2528,
+		13451, 2398, 13448, 2276, 13443, 2154, 13440, 2037, 13436, 1817, 13433, 1617, 13430, 1426, 13426, 1244,
+		14656, 15849, 14650, 15582, 14642, 15417, 14636, 15249, 14628, 15074, 14621, 14935, 14616, 14828, 14608, 14730,
+		14602, 14642, 14596, 14571, 14591, 14504, 14585, 14440, 14579, 14388, 14574, 14339, 14568, 14252, 14563, 14165,
+		14557, 14084, 14552, 14017, 14546, 13942, 14542, 13887, 14537, 13824, 14534, 13774, 14527, 13716, 14522, 13667,
+		14517, 13621, 14512, 13573, 14509, 13534, 14504, 13490, 14501, 13456, 14495, 13417, 14489, 13380, 14486, 13349,
+		14481, 13316, 14477, 13256, 14473, 13202, 14469, 13143, 14465, 13088, 14459, 13031, 14456, 12985, 14451, 12935,
+		14447, 12884, 14443, 12844, 14440, 12802, 14436, 12763, 14432, 12718, 14428, 12682, 14423, 12640, 14419, 12604,
+		14415, 12570, 14411, 12532, 14408, 12501, 14405, 12472, 14400, 12438, 14397, 12408, 14393, 12380, 14388, 12349,
+		14385, 12323, 14382, 12296, 14378, 12249, 14374, 12204, 14370, 12153, 14367, 12104, 14363, 12057, 14360, 12014,
+		14356, 11966, 14353, 11925, 14349, 11886, 14346, 11844, 14342, 11803, 14339, 11769, 14333, 11727, 14327, 11693,
+		14321, 11659, 14315, 11625, 14307, 11589, 14301, 11558, 14293, 11525, 14287, 11495, 14279, 11461, 14274, 11435,
+		14268, 11406, 14261, 11377, 14253, 11348, 14247, 11322, 14241, 11298, 14234, 11271, 14228, 11231, 14223, 11186,
+		14215, 11132, 14210, 11089, 14203, 11043, 14197, 11000, 14191, 10958, 14183, 10911, 14179, 10876, 14172, 10834,
+		14166, 10794, 14159, 10756, 14152, 10717, 14147, 10683, 14141, 10648, 14134, 10611, 14128, 10578, 14123, 10547,
+		14116, 10512, 14110, 10480, 14106, 10452, 14099, 10420, 14093, 10391, 14086, 10360, 14081, 10333, 14076, 10308,
+		14069, 10279, 14065, 10254, 14059, 10217, 14053, 10165, 14048, 10119, 14041, 10067, 14035, 10021, 14029, 9976,
+		14024, 9931, 14019, 9890, 14013, 9844, 14008, 9803, 14003, 9764, 13996, 9720, 13992, 9687, 13985, 9644,
+		13979, 9606, 13974, 9570, 13970, 9540, 13965, 9505, 13958, 9467, 13952, 9432, 13947, 9401, 13942, 9372,
+		13937, 9340, 13931, 9309, 13925, 9278, 13920, 9249, 13915, 9220, 13909, 9169, 13905, 9116, 13900, 9068,
+		13895, 9017, 13890, 8967, 13884, 8917, 13879, 8867, 13874, 8822, 13868, 8774, 13864, 8732, 13859, 8689,
+		13854, 8647, 13849, 8605, 13844, 8564, 13839, 8525, 13834, 8486, 13828, 8446, 13824, 8410, 13819, 8375,
+		13814, 8341, 13809, 8306, 13805, 8273, 13799, 8239, 13795, 8208, 13789, 8160, 13784, 8101, 13780, 8044,
+		13775, 7985, 13771, 7932, 13766, 7875, 13762, 7823, 13756, 7767, 13752, 7719, 13747, 7671, 13743, 7624,
+		13738, 7578, 13733, 7530, 13729, 7486, 13724, 7442, 13721, 7402, 13715, 7359, 13711, 7319, 13706, 7281,
+		13701, 7242, 13697, 7206, 13693, 7170, 13688, 7100, 13684, 7031, 13680, 6969, 13675, 6901, 13671, 6844,
+		13666, 6778, 13662, 6723, 13658, 6664, 13653, 6608, 13649, 6554, 13645, 6501, 13641, 6452, 13636, 6396,
+		13631, 6349, 13627, 6302, 13623, 6259, 13618, 6211, 13615, 6172, 13611, 6112, 13607, 6036, 13601, 5947,
+		13598, 5879, 13594, 5806, 13590, 5737, 13586, 5666, 13582, 5599, 13578, 5534, 13574, 5472, 13570, 5410,
+		13566, 5352, 13562, 5297, 13558, 5240, 13554, 5187, 13550, 5136, 13547, 5060, 13542, 4957, 13539, 4870,
+		13534, 4774, 13531, 4693, 13526, 4605, 13523, 4527, 13519, 4453, 13515, 4376, 13512, 4308, 13507, 4233,
+		13504, 4171, 13500, 4110, 13496, 3994, 13492, 3879, 13489, 3769, 13485, 3657, 13482, 3557, 13478, 3456,
+		13474, 3363, 13471, 3271, 13467, 3181, 13464, 3101, 13459, 2960, 13456, 2817, 13453, 2673, 13449, 2528,
+		13446, 2402, 13442, 2276, 13439, 2156, 13435, 2041, 13432, 1827, 13428, 1626, 13425, 1431, 13421, 1250,
+		14651, 15830, 14644, 15565, 14637, 15404, 14630, 15226, 14622, 15050, 14616, 14920, 14609, 14804, 14602, 14712,
+		14596, 14625, 14590, 14557, 14585, 14490, 14578, 14425, 14572, 14375, 14567, 14314, 14562, 14225, 14556, 14138,
+		14551, 14061, 14545, 13993, 14540, 13922, 14536, 13868, 14531, 13805, 14527, 13753, 14520, 13698, 14515, 13647,
+		14510, 13603, 14505, 13555, 14502, 13516, 14497, 13473, 14493, 13437, 14487, 13402, 14483, 13367, 14479, 13333,
+		14474, 13293, 14469, 13228, 14466, 13174, 14462, 13118, 14457, 13063, 14452, 13009, 14448, 12957, 14445, 12915,
+		14441, 12867, 14436, 12819, 14432, 12779, 14428, 12738, 14424, 12699, 14419, 12657, 14416, 12622, 14412, 12586,
+		14408, 12552, 14404, 12517, 14400, 12484, 14396, 12452, 14393, 12421, 14389, 12391, 14385, 12363, 14381, 12335,
+		14378, 12308, 14375, 12276, 14370, 12223, 14366, 12170, 14363, 12128, 14360, 12081, 14357, 12034, 14353, 11990,
+		14349, 11946, 14345, 11901, 14342, 11862, 14338, 11822, 14333, 11781, 14327, 11745, 14320, 11710, 14313, 11672,
+		14307, 11638, 14300, 11604, 14293, 11573, 14285, 11539, 14279, 11507, 14272, 11476, 14267, 11449, 14259, 11414,
+		14253, 11390, 14246, 11361, 14239, 11333, 14233, 11307, 14227, 11283, 14221, 11252, 14214, 11202, 14208, 11154,
+		14203, 11112, 14195, 11062, 14189, 11017, 14182, 10974, 14176, 10931, 14170, 10889, 14163, 10846, 14158, 10811,
+		14151, 10772, 14145, 10734, 14139, 10698, 14133, 10662, 14128, 10630, 14122, 10595, 14115, 10559, 14110, 10528,
+		14104, 10495, 14098, 10465, 14091, 10432, 14086, 10405, 14080, 10376, 14075, 10349, 14067, 10317, 14063, 10292,
+		14058, 10267, 14051, 10238, 14045, 10189, 14039, 10137, 14033, 10087, 14027, 10045, 14022, 9996, 14016, 9949,
+		14011, 9907, 14005, 9862, 14001, 9824, 13995, 9780, 13988, 9738, 13983, 9701, 13978, 9663, 13973, 9627,
+		13967, 9590, 13961, 9551, 13956, 9516, 13952, 9484, 13946, 9453, 13940, 9419, 13935, 9386, 13930, 9356,
+		13924, 9323, 13919, 9295, 13915, 9268, 13909, 9238, 13904, 9205, 13898, 9146, 13892, 9090, 13888, 9041,
+		13882, 8990, 13877, 8942, 13873, 8896, 13867, 8847, 13862, 8802, 13857, 8755, 13853, 8712, 13848, 8670,
+		13842, 8627, 13837, 8585, 13833, 8548, 13827, 8509, 13822, 8469, 13818, 8432, 13813, 8395, 13808, 8361,
+		13804, 8326, 13799, 8294, 13794, 8261, 13789, 8227, 13784, 8197, 13779, 8144, 13774, 8083, 13770, 8022,
+		13766, 7967, 13761, 7912, 13756, 7855, 13751, 7805, 13746, 7754, 13742, 7704, 13737, 7654, 13733, 7608,
+		13728, 7560, 13724, 7519, 13720, 7472, 13715, 7431, 13710, 7388, 13705, 7347, 13701, 7308, 13696, 7269,
+		13692, 7233, 13688, 7195, 13684, 7159, 13679, 7084, 13675, 7016, 13670, 6950, 13666, 6891, 13661, 6825,
+		13658, 6767, 13654, 6709, 13649, 6649, 13645, 6596, 13640, 6540, 13636, 6492, 13632, 6439, 13628, 6392,
+		13624, 6341, 13620, 6298, 13615, 6249, 13612, 6208, 13607, 6163, 13603, 6104, 13599, 6020, 13595, 5946,
+		13591, 5874, 13587, 5797, 13583, 5727, 13579, 5656, 13575, 5591, 13571, 5527, 13567, 5467, 13562, 5403,
+		13559, 5349, 13555, 5291, 13551, 5236, 13547, 5183, 13544, 5135, 13539, 5040, 13536, 4951, 13531, 4855,
+		13528, 4773, 13524, 4686, 13520, 4604, 13517, 4525, 13513, 4446, 13510, 4379, 13505, 4302, 13502, 4235,
+		13498, 4170, 13494, 4105, 13491, 4000, 13487, 3880, 13483, 3767, 13479, 3655, 13476, 3551, 13472, 3456,
+		13469, 3360, 13465, 3270, 13461, 3182, 13458, 3103, 13454, 2966, 13451, 2820, 13447, 2670, 13444, 2533,
+		13440, 2403, 13437, 2280, 13434, 2160, 13430, 2044, 13427, 1832, 13423, 1627, 13420, 1438, 13416, 1256,
+		14645, 15808, 14638, 15546, 14629, 15388, 14624, 15207, 14616, 15027, 14610, 14902, 14603, 14789, 14595, 14691,
+		14590, 14608, 14584, 14539, 14578, 14473, 14572, 14413, 14565, 14362, 14561, 14290, 14555, 14201, 14550, 14115,
+		14545, 14041, 14538, 13967, 14533, 13902, 14529, 13844, 14525, 13788, 14519, 13731, 14514, 13682, 14507, 13627,
+		14503, 13584, 14499, 13541, 14495, 13500, 14491, 13461, 14486, 13422, 14480, 13387, 14476, 13352, 14471, 13318,
+		14468, 13269, 14463, 13204, 14459, 13145, 14455, 13093, 14450, 13040, 14446, 12987, 14441, 12936, 14438, 12892,
+		14434, 12850, 14429, 12799, 14425, 12759, 14421, 12717, 14417, 12679, 14412, 12638, 14409, 12605, 14405, 12568,
+		14401, 12533, 14397, 12500, 14393, 12465, 14389, 12435, 14386, 12407, 14381, 12375, 14378, 12349, 14375, 12321,
+		14371, 12293, 14367, 12247, 14363, 12197, 14359, 12145, 14356, 12098, 14353, 12053, 14349, 12005, 14345, 11961,
+		14342, 11925, 14339, 11880, 14332, 11835, 14326, 11800, 14320, 11763, 14312, 11724, 14306, 11689, 14300, 11653,
+		14292, 11618, 14285, 11583, 14278, 11552, 14272, 11522, 14265, 11491, 14259, 11459, 14252, 11429, 14246, 11402,
+		14237, 11369, 14232, 11346, 14227, 11321, 14219, 11293, 14213, 11268, 14207, 11224, 14200, 11175, 14193, 11125,
+		14187, 11080, 14181, 11036, 14174, 10992, 14168, 10949, 14162, 10907, 14156, 10867, 14150, 10825, 14142, 10784,
+		14137, 10750, 14131, 10713, 14126, 10678, 14120, 10643, 14113, 10606, 14108, 10576, 14102, 10542, 14096, 10508,
+		14090, 10479, 14084, 10447, 14079, 10419, 14072, 10386, 14066, 10358, 14060, 10331, 14055, 10305, 14049, 10276,
+		14044, 10251, 14038, 10211, 14033, 10163, 14027, 10115, 14020, 10063, 14015, 10016, 14010, 9975, 14004, 9929,
+		13999, 9885, 13994, 9843, 13987, 9798, 13982, 9762, 13976, 9722, 13970, 9679, 13965, 9643, 13959, 9605,
+		13955, 9572, 13950, 9537, 13944, 9500, 13939, 9468, 13932, 9432, 13928, 9402, 13923, 9373, 13917, 9339,
+		13913, 9311, 13907, 9278, 13902, 9252, 13897, 9225, 13892, 9178, 13888, 9127, 13882, 9074, 13877, 9021,
+		13871, 8970, 13866, 8920, 13861, 8873, 13856, 8825, 13852, 8783, 13847, 8741, 13842, 8697, 13837, 8652,
+		13831, 8612, 13827, 8571, 13821, 8532, 13817, 8494, 13812, 8456, 13807, 8419, 13803, 8384, 13798, 8349,
+		13793, 8315, 13788, 8281, 13783, 8249, 13779, 8217, 13774, 8180, 13770, 8122, 13765, 8062, 13760, 8002,
+		13756, 7950, 13750, 7891, 13746, 7841, 13742, 7790, 13737, 7740, 13732, 7685, 13728, 7643, 13724, 7593,
+		13719, 7549, 13715, 7505, 13709, 7458, 13705, 7417, 13701, 7378, 13696, 7335, 13692, 7298, 13688, 7261,
+		13683, 7221, 13679, 7187, 13674, 7131, 13670, 7067, 13666, 7002, 13661, 6936, 13658, 6874, 13653, 6811,
+		13649, 6755, 13645, 6693, 13641, 6641, 13636, 6584, 13632, 6533, 13628, 6478, 13624, 6429, 13620, 6379,
+		13616, 6333, 13612, 6288, 13608, 6242, 13603, 6200, 13599, 6157, 13595, 6089, 13591, 6007, 13587, 5935,
+		13583, 5853, 13579, 5786, 13575, 5716, 13571, 5648, 13567, 5582, 13563, 5523, 13559, 5455, 13556, 5397,
+		13552, 5338, 13547, 5283, 13544, 5230, 13540, 5180, 13536, 5128, 13533, 5040, 13529, 4946, 13525, 4853,
+		13521, 4766, 13517, 4678, 13515, 4603, 13510, 4518, 13506, 4444, 13502, 4367, 13499, 4297, 13495, 4231,
+		13491, 4163, 13488, 4103, 13484, 3991, 13480, 3871, 13477, 3757, 13474, 3657, 13470, 3552, 13467, 3456,
+		13463, 3361, 13459, 3266, 13456, 3183, 13453, 3101, 13449, 2972, 13446, 2818, 13442, 2675, 13438, 2536,
+		13435, 2405, 13432, 2281, 13428, 2163, 13425, 2049, 13421, 1835, 13418, 1634, 13415, 1444, 13411, 1262,
+		14640, 15793, 14632, 15531, 14624, 15377, 14617, 15181, 14611, 15009, 14604, 14887, 14598, 14774, 14589, 14675,
+		14584, 14591, 14578, 14525, 14571, 14457, 14566, 14399, 14559, 14347, 14554, 14261, 14550, 14180, 14544, 14093,
+		14537, 14018, 14532, 13948, 14527, 13885, 14523, 13823, 14519, 13770, 14512, 13712, 14507, 13662, 14501, 13609,
+		14496, 13566, 14492, 13525, 14488, 13482, 14485, 13448, 14479, 13408, 14473, 13372, 14469, 13338, 14465, 13300,
+		14461, 13241, 14457, 13181, 14452, 13119, 14448, 13068, 14443, 13013, 14439, 12965, 14435, 12915, 14430, 12866,
+		14427, 12830, 14422, 12782, 14418, 12736, 14414, 12695, 14410, 12657, 14406, 12621, 14402, 12584, 14398, 12550,
+		14394, 12514, 14390, 12484, 14386, 12449, 14382, 12418, 14379, 12391, 14375, 12361, 14371, 12331, 14368, 12306,
+		14364, 12269, 14360, 12217, 14356, 12168, 14353, 12122, 14348, 12069, 14346, 12028, 14342, 11980, 14338, 11936,
+		14333, 11895, 14326, 11858, 14319, 11815, 14312, 11776, 14306, 11742, 14299, 11705, 14291, 11666, 14285, 11632,
+		14277, 11598, 14271, 11567, 14264, 11532, 14257, 11501, 14251, 11471, 14244, 11441, 14238, 11413, 14232, 11385,
+		14226, 11359, 14218, 11329, 14211, 11304, 14206, 11280, 14198, 11241, 14192, 11192, 14185, 11145, 14179, 11098,
+		14173, 11052, 14167, 11011, 14161, 10968, 14155, 10927, 14148, 10884, 14143, 10843, 14137, 10806, 14130, 10767,
+		14123, 10726, 14118, 10692, 14112, 10657, 14106, 10623, 14101, 10589, 14095, 10555, 14089, 10525, 14082, 10491,
+		14075, 10458, 14071, 10430, 14065, 10400, 14059, 10373, 14053, 10343, 14048, 10315, 14042, 10288, 14036, 10262,
+		14031, 10233, 14024, 10182, 14019, 10133, 14013, 10087, 14008, 10041, 14002, 9994, 13996, 9947, 13992, 9905,
+		13986, 9861, 13980, 9821, 13975, 9780, 13969, 9737, 13964, 9701, 13959, 9665, 13954, 9625, 13949, 9589,
+		13943, 9552, 13937, 9518, 13932, 9485, 13927, 9452, 13922, 9420, 13915, 9384, 13911, 9355, 13906, 9326,
+		13901, 9296, 13896, 9268, 13890, 9237, 13885, 9202, 13880, 9151, 13875, 9099, 13870, 9049, 13865, 8997,
+		13860, 8952, 13856, 8904, 13850, 8852, 13846, 8811, 13840, 8762, 13836, 8721, 13830, 8676, 13825, 8633,
+		13821, 8595, 13816, 8555, 13812, 8517, 13807, 8478, 13801, 8439, 13797, 8406, 13792, 8369, 13787, 8334,
+		13782, 8302, 13778, 8268, 13773, 8238, 13768, 8205, 13765, 8162, 13759, 8098, 13755, 8041, 13750, 7985,
+		13745, 7928, 13741, 7877, 13736, 7821, 13731, 7771, 13728, 7722, 13723, 7672, 13719, 7627, 13714, 7579,
+		13709, 7533, 13705, 7491, 13700, 7447, 13696, 7406, 13692, 7366, 13687, 7323, 13683, 7286, 13678, 7249,
+		13675, 7215, 13670, 7179, 13666, 7116, 13661, 7050, 13657, 6982, 13653, 6920, 13649, 6858, 13645, 6799,
+		13640, 6737, 13636, 6683, 13632, 6625, 13628, 6572, 13624, 6519, 13620, 6469, 13616, 6421, 13611, 6369,
+		13608, 6325, 13603, 6277, 13599, 6235, 13595, 6191, 13592, 6151, 13587, 6070, 13584, 6000, 13579, 5916,
+		13576, 5848, 13571, 5775, 13567, 5707, 13563, 5635, 13560, 5576, 13556, 5512, 13553, 5452, 13548, 5390,
+		13544, 5333, 13541, 5280, 13537, 5224, 13533, 5174, 13529, 5120, 13526, 5032, 13522, 4932, 13518, 4850,
+		13514, 4756, 13510, 4671, 13507, 4590, 13503, 4514, 13500, 4441, 13496, 4364, 13493, 4297, 13488, 4225,
+		13486, 4168, 13482, 4100, 13478, 3985, 13475, 3879, 13472, 3764, 13467, 3650, 13464, 3551, 13461, 3452,
+		13457, 3358, 13454, 3268, 13450, 3182, 13446, 3097, 13443, 2968, 13439, 2815, 13436, 2675, 13433, 2541,
+		13429, 2406, 13426, 2282, 13423, 2163, 13419, 2050, 13416, 1837, 13413, 1640, 13410, 1451, 13406, 1267,
+		14634, 15775, 14627, 15519, 14619, 15366, 14612, 15158, 14605, 14988, 14599, 14866, 14592, 14756, 14583, 14656,
+		14578, 14578, 14571, 14508, 14566, 14445, 14560, 14387, 14553, 14331, 14547, 14232, 14543, 14154, 14537, 14073,
+		14531, 13998, 14525, 13927, 14521, 13866, 14516, 13802, 14512, 13751, 14505, 13691, 14500, 13645, 14495, 13594,
+		14490, 13549, 14487, 13511, 14482, 13465, 14478, 13431, 14471, 13391, 14467, 13356, 14463, 13324, 14458, 13273,
+		14453, 13210, 14450, 13157, 14445, 13093, 14440, 13039, 14437, 12992, 14432, 12940, 14428, 12895, 14424, 12846,
+		14419, 12802, 14416, 12765, 14411, 12718, 14408, 12680, 14403, 12639, 14399, 12605, 14395, 12566, 14391, 12533,
+		14387, 12498, 14383, 12464, 14379, 12435, 14375, 12401, 14371, 12373, 14368, 12347, 14365, 12318, 14361, 12290,
+		14357, 12243, 14353, 12190, 14349, 12139, 14345, 12093, 14342, 12048, 14338, 11997, 14334, 11958, 14327, 11915,
+		14318, 11870, 14312, 11835, 14306, 11796, 14298, 11756, 14291, 11717, 14285, 11683, 14277, 11646, 14271, 11612,
+		14264, 11581, 14256, 11545, 14250, 11515, 14243, 11483, 14238, 11454, 14231, 11425, 14223, 11395, 14218, 11369,
+		14212, 11343, 14205, 11316, 14197, 11288, 14192, 11265, 14185, 11214, 14179, 11166, 14172, 11117, 14166, 11074,
+		14159, 11027, 14153, 10984, 14148, 10943, 14142, 10902, 14136, 10863, 14129, 10822, 14123, 10782, 14117, 10747,
+		14111, 10709, 14104, 10670, 14099, 10637, 14093, 10604, 14087, 10570, 14081, 10537, 14074, 10501, 14070, 10476,
+		14064, 10443, 14057, 10411, 14051, 10383, 14046, 10355, 14041, 10329, 14034, 10299, 14029, 10274, 14023, 10248,
+		14018, 10208, 14012, 10158, 14006, 10108, 14001, 10059, 13995, 10013, 13990, 9972, 13985, 9926, 13979, 9882,
+		13974, 9842, 13968, 9798, 13963, 9761, 13957, 9721, 13952, 9680, 13947, 9643, 13943, 9608, 13937, 9574,
+		13931, 9537, 13925, 9502, 13920, 9466, 13915, 9436, 13910, 9404, 13905, 9373, 13899, 9340, 13895, 9310,
+		13889, 9282, 13884, 9253, 13880, 9228, 13874, 9184, 13868, 9126, 13863, 9074, 13858, 9021, 13854, 8974,
+		13849, 8926, 13845, 8881, 13840, 8835, 13834, 8787, 13829, 8743, 13824, 8701, 13819, 8657, 13814, 8618,
+		13810, 8578, 13805, 8538, 13800, 8499, 13795, 8461, 13791, 8427, 13786, 8390, 13781, 8356, 13777, 8323,
+		13773, 8290, 13767, 8257, 13763, 8224, 13759, 8195, 13754, 8135, 13749, 8078, 13744, 8021, 13740, 7965,
+		13735, 7909, 13731, 7857, 13727, 7805, 13722, 7755, 13718, 7707, 13713, 7656, 13709, 7611, 13704, 7565,
+		13700, 7520, 13695, 7479, 13691, 7433, 13687, 7393, 13683, 7354, 13678, 7316, 13674, 7277, 13670, 7239,
+		13666, 7204, 13661, 7164, 13657, 7101, 13653, 7033, 13649, 6973, 13644, 6902, 13640, 6847, 13636, 6783,
+		13632, 6726, 13628, 6670, 13623, 6613, 13620, 6562, 13616, 6508, 13612, 6460, 13607, 6409, 13604, 6363,
+		13600, 6317, 13595, 6270, 13591, 6225, 13588, 6186, 13583, 6141, 13580, 6064, 13575, 5983, 13572, 5910,
+		13568, 5838, 13564, 5766, 13560, 5699, 13556, 5628, 13552, 5566, 13548, 5499, 13545, 5442, 13541, 5382,
+		13537, 5329, 13534, 5273, 13530, 5220, 13526, 5167, 13522, 5119, 13518, 5015, 13515, 4928, 13511, 4835,
+		13507, 4753, 13504, 4670, 13501, 4590, 13497, 4510, 13493, 4431, 13490, 4364, 13486, 4292, 13482, 4226,
+		13478, 4158, 13475, 4098, 13472, 3986, 13468, 3859, 13465, 3756, 13461, 3651, 13458, 3547, 13454, 3450,
+		13451, 3357, 13448, 3268, 13444, 3181, 13441, 3098, 13437, 2967, 13434, 2819, 13431, 2677, 13427, 2537,
+		13424, 2410, 13420, 2281, 13417, 2165, 13414, 2054, 13411, 1845, 13407, 1640, 13404, 1453, 13401, 1273,
+		14628, 15763, 14621, 15505, 14613, 15350, 14606, 15134, 14600, 14968, 14593, 14847, 14585, 14735, 14577, 14640,
+		14572, 14562, 14565, 14491, 14560, 14431, 14554, 14375, 14547, 14307, 14542, 14213, 14537, 14131, 14531, 14048,
+		14524, 13974, 14519, 13904, 14515, 13845, 14510, 13783, 14506, 13730, 14499, 13674, 14493, 13625, 14489, 13580,
+		14484, 13532, 14480, 13495, 14476, 13452, 14471, 13413, 14465, 13380, 14460, 13343, 14456, 13310, 14452, 13245,
+		14447, 13182, 14443, 13130, 14439, 13072, 14433, 13016, 14430, 12969, 14425, 12918, 14422, 12873, 14417, 12824,
+		14412, 12776, 14408, 12740, 14405, 12700, 14401, 12659, 14396, 12622, 14392, 12583, 14388, 12548, 14384, 12513,
+		14380, 12481, 14376, 12448, 14373, 12421, 14369, 12388, 14364, 12356, 14362, 12332, 14358, 12303, 14354, 12263,
+		14350, 12214, 14346, 12166, 14342, 12114, 14338, 12068, 14335, 12022, 14327, 11975, 14321, 11935, 14314, 11894,
+		14305, 11850, 14298, 11808, 14292, 11775, 14284, 11735, 14277, 11697, 14270, 11661, 14264, 11628, 14257, 11594,
+		14250, 11560, 14244, 11531, 14237, 11497, 14231, 11468, 14224, 11435, 14218, 11410, 14211, 11381, 14204, 11351,
+		14196, 11325, 14191, 11301, 14184, 11274, 14177, 11231, 14172, 11186, 14166, 11143, 14159, 11093, 14152, 11046,
+		14146, 11004, 14140, 10959, 14135, 10919, 14129, 10879, 14122, 10838, 14116, 10800, 14109, 10760, 14104, 10723,
+		14097, 10688, 14092, 10652, 14085, 10615, 14080, 10583, 14074, 10551, 14067, 10518, 14062, 10488, 14056, 10454,
+		14051, 10427, 14045, 10399, 14038, 10367, 14033, 10339, 14027, 10311, 14023, 10288, 14017, 10260, 14010, 10228,
+		14005, 10178, 13999, 10130, 13995, 10085, 13989, 10035, 13983, 9990, 13978, 9944, 13973, 9905, 13967, 9861,
+		13961, 9817, 13955, 9776, 13951, 9739, 13946, 9700, 13941, 9665, 13935, 9624, 13929, 9585, 13924, 9554,
+		13919, 9520, 13914, 9487, 13909, 9453, 13903, 9417, 13898, 9386, 13893, 9356, 13889, 9328, 13884, 9299,
+		13877, 9267, 13873, 9241, 13867, 9210, 13863, 9155, 13859, 9113, 13853, 9055, 13849, 9006, 13843, 8954,
+		13837, 8903, 13833, 8857, 13827, 8809, 13822, 8767, 13818, 8725, 13813, 8683, 13809, 8643, 13804, 8599,
+		13800, 8561, 13795, 8525, 13789, 8484, 13784, 8446, 13780, 8412, 13776, 8377, 13771, 8343, 13767, 8309,
+		13761, 8274, 13757, 8245, 13752, 8212, 13748, 8172, 13744, 8115, 13739, 8057, 13734, 7997, 13730, 7947,
+		13725, 7888, 13722, 7844, 13716, 7786, 13712, 7737, 13708, 7691, 13703, 7642, 13699, 7598, 13694, 7550,
+		13691, 7508, 13687, 7465, 13682, 7423, 13677, 7382, 13673, 7341, 13669, 7303, 13665, 7266, 13661, 7230,
+		13656, 7193, 13652, 7150, 13648, 7080, 13644, 7021, 13639, 6949, 13636, 6892, 13632, 6832, 13627, 6767,
+		13624, 6715, 13619, 6657, 13616, 6605, 13611, 6548, 13607, 6500, 13603, 6447, 13600, 6402, 13595, 6350,
+		13592, 6309, 13587, 6261, 13584, 6222, 13579, 6175, 13575, 6128, 13572, 6049, 13568, 5971, 13564, 5898,
+		13560, 5823, 13556, 5757, 13553, 5685, 13548, 5619, 13545, 5558, 13542, 5497, 13538, 5433, 13534, 5377,
+		13530, 5318, 13527, 5267, 13522, 5214, 13519, 5163, 13515, 5103, 13512, 5013, 13508, 4920, 13505, 4831,
+		13501, 4742, 13497, 4659, 13494, 4581, 13490, 4503, 13487, 4429, 13483, 4355, 13480, 4291, 13476, 4221,
+		13473, 4158, 13470, 4097, 13466, 3975, 13463, 3867, 13459, 3757, 13455, 3648, 13452, 3545, 13448, 3447,
+		13446, 3358, 13442, 3268, 13438, 3179, 13435, 3098, 13431, 2964, 13429, 2820, 13425, 2676, 13422, 2541,
+		13419, 2409, 13416, 2289, 13412, 2170, 13408, 2055, 13406, 1851, 13402, 1646, 13399, 1458, 13396, 1277,
+		14623, 15745, 14615, 15486, 14608, 15329, 14601, 15114, 14594, 14948, 14587, 14828, 14579, 14719, 14572, 14627,
+		14565, 14543, 14560, 14477, 14554, 14416, 14548, 14361, 14542, 14283, 14536, 14190, 14531, 14104, 14525, 14025,
+		14518, 13953, 14513, 13882, 14509, 13824, 14503, 13761, 14499, 13710, 14493, 13657, 14486, 13605, 14483, 13564,
+		14478, 13515, 14474, 13476, 14470, 13439, 14463, 13398, 14458, 13365, 14454, 13329, 14449, 13281, 14445, 13219,
+		14440, 13158, 14436, 13099, 14431, 13048, 14426, 12989, 14422, 12940, 14418, 12891, 14415, 12848, 14410, 12803,
+		14405, 12756, 14401, 12717, 14398, 12681, 14393, 12640, 14390, 12604, 14386, 12567, 14382, 12533, 14377, 12495,
+		14373, 12464, 14370, 12433, 14365, 12399, 14362, 12373, 14358, 12343, 14354, 12314, 14351, 12290, 14346, 12236,
+		14342, 12181, 14338, 12133, 14334, 12086, 14328, 12040, 14321, 11996, 14314, 11955, 14306, 11907, 14300, 11872,
+		14292, 11830, 14284, 11788, 14276, 11746, 14270, 11713, 14264, 11675, 14257, 11641, 14250, 11607, 14243, 11574,
+		14236, 11541, 14230, 11511, 14223, 11479, 14217, 11449, 14210, 11420, 14203, 11389, 14197, 11364, 14189, 11337,
+		14183, 11309, 14176, 11282, 14172, 11262, 14165, 11205, 14158, 11155, 14152, 11112, 14145, 11067, 14139, 11021,
+		14134, 10977, 14128, 10936, 14121, 10894, 14115, 10854, 14108, 10813, 14101, 10775, 14097, 10740, 14090, 10701,
+		14085, 10665, 14079, 10634, 14073, 10598, 14066, 10561, 14060, 10531, 14055, 10500, 14049, 10470, 14043, 10440,
+		14037, 10408, 14033, 10382, 14027, 10354, 14021, 10326, 14015, 10297, 14009, 10270, 14005, 10248, 13998, 10202,
+		13992, 10151, 13987, 10103, 13981, 10056, 13977, 10013, 13971, 9966, 13964, 9918, 13959, 9878, 13954, 9836,
+		13949, 9798, 13943, 9755, 13937, 9715, 13932, 9677, 13928, 9641, 13922, 9607, 13917, 9570, 13911, 9531,
+		13906, 9499, 13901, 9465, 13897, 9435, 13892, 9404, 13886, 9369, 13881, 9341, 13876, 9310, 13871, 9283,
+		13865, 9255, 13860, 9225, 13855, 9180, 13851, 9127, 13846, 9075, 13841, 9028, 13837, 8983, 13832, 8932,
+		13827, 8887, 13822, 8838, 13817, 8796, 13812, 8746, 13807, 8705, 13804, 8667, 13798, 8621, 13794, 8586,
+		13789, 8546, 13783, 8506, 13779, 8470, 13774, 8433, 13771, 8399, 13765, 8361, 13761, 8330, 13756, 8297,
+		13751, 8262, 13747, 8233, 13742, 8201, 13738, 8152, 13733, 8095, 13729, 8035, 13725, 7979, 13720, 7926,
+		13716, 7873, 13711, 7820, 13707, 7769, 13703, 7721, 13698, 7672, 13694, 7627, 13689, 7580, 13686, 7538,
+		13680, 7490, 13676, 7450, 13672, 7409, 13668, 7369, 13665, 7332, 13660, 7293, 13656, 7256, 13651, 7218,
+		13648, 7186, 13643, 7128, 13638, 7061, 13634, 6997, 13630, 6934, 13627, 6878, 13623, 6812, 13619, 6757,
+		13615, 6698, 13611, 6645, 13606, 6587, 13603, 6538, 13599, 6485, 13595, 6437, 13591, 6388, 13586, 6339,
+		13583, 6296, 13578, 6250, 13575, 6210, 13571, 6167, 13568, 6114, 13563, 6032, 13560, 5959, 13556, 5881,
+		13553, 5813, 13548, 5740, 13545, 5677, 13541, 5607, 13537, 5547, 13534, 5484, 13530, 5428, 13526, 5369,
+		13523, 5314, 13519, 5261, 13515, 5206, 13512, 5156, 13508, 5093, 13505, 5008, 13501, 4909, 13498, 4824,
+		13494, 4736, 13490, 4654, 13487, 4571, 13484, 4501, 13480, 4422, 13477, 4354, 13473, 4285, 13469, 4216,
+		13466, 4155, 13462, 4082, 13459, 3970, 13455, 3857, 13452, 3744, 13448, 3640, 13446, 3546, 13442, 3445,
+		13439, 3354, 13436, 3263, 13433, 3181, 13429, 3096, 13426, 2967, 13423, 2820, 13419, 2674, 13416, 2542,
+		13413, 2411, 13410, 2289, 13407, 2172, 13403, 2059, 13400, 1857, 13397, 1653, 13394, 1464, 13391, 1282,
+		14618, 15728, 14610, 15474, 14603, 15303, 14596, 15098, 14588, 14928, 14582, 14811, 14573, 14696, 14567, 14612,
+		14560, 14527, 14554, 14460, 14548, 14401, 14542, 14348, 14536, 14255, 14530, 14169, 14525, 14079, 14519, 14006,
+		14512, 13929, 14508, 13869, 14503, 13805, 14498, 13745, 14492, 13692, 14486, 13636, 14480, 13588, 14477, 13546,
+		14472, 13503, 14468, 13461, 14464, 13426, 14457, 13381, 14452, 13348, 14448, 13315, 14443, 13249, 14438, 13192,
+		14434, 13133, 14429, 13072, 14425, 13022, 14421, 12972, 14416, 12921, 14412, 12873, 14408, 12828, 14404, 12785,
+		14399, 12741, 14394, 12691, 14391, 12657, 14386, 12619, 14383, 12586, 14380, 12552, 14375, 12513, 14371, 12481,
+		14367, 12448, 14363, 12418, 14359, 12385, 14355, 12358, 14352, 12329, 14348, 12299, 14344, 12262, 14340, 12212,
+		14335, 12159, 14328, 12108, 14322, 12065, 14314, 12016, 14308, 11971, 14300, 11927, 14293, 11886, 14285, 11842,
+		14278, 11807, 14271, 11767, 14263, 11727, 14258, 11693, 14251, 11659, 14244, 11621, 14237, 11588, 14230, 11557,
+		14223, 11524, 14217, 11492, 14211, 11463, 14204, 11433, 14197, 11405, 14190, 11374, 14182, 11346, 14176, 11321,
+		14170, 11296, 14164, 11269, 14157, 11223, 14151, 11176, 14146, 11132, 14138, 11086, 14133, 11040, 14127, 10998,
+		14121, 10954, 14114, 10911, 14108, 10871, 14102, 10833, 14095, 10793, 14089, 10753, 14083, 10716, 14078, 10682,
+		14071, 10646, 14065, 10610, 14060, 10580, 14054, 10548, 14048, 10512, 14042, 10481, 14037, 10452, 14031, 10423,
+		14026, 10395, 14019, 10362, 14014, 10337, 14009, 10310, 14004, 10284, 13997, 10258, 13990, 10219, 13986, 10176,
+		13980, 10126, 13974, 10076, 13968, 10027, 13964, 9984, 13958, 9943, 13953, 9901, 13947, 9854, 13942, 9815,
+		13936, 9772, 13933, 9740, 13927, 9697, 13921, 9658, 13915, 9621, 13911, 9585, 13905, 9552, 13900, 9518,
+		13894, 9481, 13890, 9450, 13885, 9417, 13881, 9388, 13876, 9359, 13869, 9326, 13864, 9296, 13859, 9269,
+		13855, 9240, 13850, 9216, 13845, 9159, 13840, 9104, 13835, 9055, 13829, 9000, 13825, 8953, 13820, 8905,
+		13815, 8861, 13812, 8823, 13807, 8777, 13802, 8733, 13798, 8690, 13792, 8647, 13788, 8610, 13782, 8565,
+		13777, 8528, 13773, 8491, 13769, 8454, 13764, 8418, 13759, 8382, 13755, 8349, 13750, 8316, 13746, 8283,
+		13742, 8253, 13736, 8219, 13732, 8192, 13727, 8126, 13724, 8072, 13720, 8015, 13715, 7958, 13711, 7908,
+		13706, 7852, 13701, 7803, 13698, 7757, 13693, 7704, 13689, 7658, 13685, 7612, 13680, 7565, 13676, 7523,
+		13672, 7480, 13667, 7439, 13663, 7396, 13659, 7357, 13654, 7317, 13651, 7281, 13646, 7244, 13643, 7209,
+		13638, 7173, 13634, 7112, 13630, 7049, 13626, 6982, 13623, 6923, 13618, 6853, 13614, 6800, 13610, 6738,
+		13606, 6684, 13602, 6629, 13598, 6575, 13594, 6526, 13590, 6473, 13587, 6428, 13583, 6379, 13579, 6333,
+		13575, 6286, 13571, 6245, 13567, 6200, 13564, 6163, 13559, 6096, 13556, 6023, 13552, 5942, 13548, 5872,
+		13545, 5802, 13541, 5733, 13538, 5667, 13534, 5598, 13530, 5539, 13526, 5476, 13523, 5419, 13519, 5361,
+		13516, 5308, 13512, 5251, 13509, 5203, 13504, 5150, 13501, 5086, 13497, 4984, 13494, 4901, 13490, 4812,
+		13488, 4732, 13483, 4647, 13480, 4568, 13476, 4490, 13473, 4417, 13470, 4350, 13466, 4279, 13463, 4216,
+		13460, 4149, 13457, 4089, 13453, 3966, 13449, 3851, 13447, 3748, 13443, 3641, 13439, 3538, 13436, 3443,
+		13432, 3351, 13429, 3261, 13426, 3178, 13423, 3096, 13420, 2968, 13417, 2820, 13413, 2676, 13410, 2542,
+		13407, 2411, 13404, 2288, 13401, 2171, 13398, 2062, 13394, 1859, 13391, 1654, 13388, 1467, 13385, 1287,
+		14613, 15717, 14605, 15459, 14598, 15278, 14591, 15071, 14583, 14911, 14576, 14795, 14566, 14674, 14562, 14597,
+		14555, 14513, 14549, 14447, 14542, 14386, 14536, 14337, 14530, 14231, 14525, 14147, 14519, 14058, 14513, 13983,
+		14506, 13909, 14502, 13850, 14497, 13785, 14493, 13730, 14485, 13670, 14479, 13620, 14474, 13571, 14470, 13531,
+		14466, 13489, 14461, 13444, 14457, 13410, 14450, 13369, 14445, 13331, 14442, 13294, 14437, 13227, 14432, 13168,
+		14428, 13109, 14423, 13050, 14418, 13000, 14414, 12948, 14410, 12900, 14406, 12852, 14401, 12806, 14397, 12762,
+		14392, 12719, 14388, 12676, 14384, 12638, 14380, 12601, 14376, 12563, 14373, 12532, 14368, 12497, 14364, 12465,
+		14360, 12431, 14356, 12400, 14352, 12371, 14348, 12339, 14346, 12316, 14342, 12287, 14336, 12228, 14330, 12182,
+		14323, 12132, 14315, 12083, 14309, 12038, 14302, 11994, 14294, 11948, 14287, 11906, 14279, 11864, 14272, 11823,
+		14264, 11781, 14257, 11746, 14251, 11709, 14244, 11671, 14238, 11640, 14231, 11605, 14223, 11569, 14217, 11536,
+		14211, 11508, 14204, 11474, 14198, 11446, 14190, 11416, 14184, 11387, 14177, 11360, 14170, 11332, 14163, 11305,
+		14157, 11280, 14151, 11248, 14145, 11197, 14139, 11152, 14132, 11106, 14125, 11057, 14121, 11016, 14114, 10974,
+		14108, 10932, 14101, 10887, 14095, 10849, 14088, 10808, 14083, 10772, 14078, 10736, 14071, 10696, 14065, 10661,
+		14060, 10628, 14054, 10595, 14047, 10559, 14042, 10529, 14036, 10495, 14030, 10464, 14025, 10436, 14019, 10407,
+		14014, 10380, 14008, 10351, 14001, 10319, 13996, 10294, 13989, 10268, 13984, 10243, 13979, 10195, 13973, 10142,
+		13968, 10098, 13963, 10052, 13958, 10008, 13951, 9960, 13946, 9916, 13941, 9876, 13936, 9835, 13930, 9793,
+		13926, 9755, 13920, 9711, 13915, 9678, 13911, 9645, 13905, 9605, 13899, 9569, 13894, 9533, 13889, 9498,
+		13885, 9469, 13879, 9435, 13874, 9403, 13868, 9371, 13863, 9340, 13859, 9315, 13854, 9286, 13850, 9257,
+		13844, 9228, 13838, 9183, 13834, 9134, 13830, 9086, 13825, 9032, 13821, 8988, 13815, 8937, 13809, 8885,
+		13804, 8839, 13799, 8792, 13795, 8751, 13790, 8707, 13786, 8670, 13782, 8630, 13776, 8588, 13772, 8550,
+		13768, 8514, 13763, 8474, 13759, 8440, 13754, 8402, 13749, 8368, 13745, 8336, 13740, 8302, 13736, 8271,
+		13731, 8238, 13727, 8208, 13722, 8166, 13718, 8106, 13714, 8051, 13709, 7992, 13705, 7940, 13701, 7888,
+		13696, 7834, 13692, 7786, 13688, 7737, 13683, 7688, 13679, 7640, 13675, 7596, 13670, 7551, 13666, 7508,
+		13662, 7466, 13659, 7426, 13654, 7385, 13650, 7345, 13646, 7308, 13641, 7269, 13638, 7236, 13633, 7199,
+		13629, 7160, 13626, 7095, 13621, 7025, 13618, 6967, 13613, 6901, 13609, 6841, 13605, 6782, 13601, 6725,
+		13598, 6674, 13594, 6617, 13591, 6567, 13586, 6511, 13582, 6463, 13578, 6415, 13575, 6370, 13570, 6321,
+		13567, 6282, 13563, 6234, 13560, 6196, 13556, 6153, 13552, 6082, 13548, 6006, 13545, 5934, 13541, 5861,
+		13537, 5787, 13533, 5723, 13529, 5652, 13526, 5592, 13522, 5529, 13519, 5470, 13515, 5410, 13512, 5354,
+		13508, 5295, 13505, 5248, 13501, 5194, 13497, 5144, 13494, 5073, 13491, 4985, 13487, 4890, 13484, 4805,
+		13480, 4721, 13476, 4639, 13473, 4562, 13470, 4486, 13467, 4414, 13463, 4340, 13460, 4279, 13456, 4207,
+		13453, 4147, 13449, 4071, 13446, 3958, 13443, 3849, 13439, 3736, 13436, 3633, 13433, 3535, 13430, 3440,
+		13427, 3348, 13423, 3260, 13420, 3175, 13417, 3097, 13414, 2968, 13411, 2816, 13408, 2676, 13405, 2546,
+		13401, 2411, 13398, 2288, 13395, 2173, 13392, 2062, 13389, 1864, 13386, 1663, 13383, 1472, 13380, 1291,
+		14609, 15703, 14600, 15449, 14593, 15254, 14586, 15050, 14578, 14897, 14571, 14772, 14561, 14660, 14556, 14581,
+		14549, 14499, 14544, 14437, 14537, 14374, 14530, 14309, 14525, 14208, 14519, 14121, 14513, 14035, 14507, 13967,
+		14501, 13891, 14496, 13828, 14491, 13766, 14487, 13715, 14479, 13653, 14474, 13607, 14469, 13556, 14465, 13514,
+		14460, 13474, 14456, 13430, 14449, 13390, 14445, 13357, 14439, 13320, 14436, 13269, 14431, 13205, 14426, 13141,
+		14422, 13084, 14417, 13031, 14412, 12974, 14408, 12928, 14404, 12878, 14400, 12832, 14395, 12785, 14391, 12744,
+		14387, 12704, 14383, 12662, 14377, 12619, 14374, 12584, 14370, 12546, 14366, 12512, 14362, 12482, 14358, 12448,
+		14354, 12416, 14350, 12384, 14346, 12357, 14342, 12327, 14339, 12300, 14334, 12260, 14324, 12205, 14316, 12151,
+		14311, 12110, 14303, 12058, 14296, 12013, 14289, 11969, 14281, 11924, 14273, 11880, 14267, 11842, 14260, 11803,
+		14251, 11759, 14245, 11724, 14239, 11689, 14231, 11650, 14224, 11616, 14218, 11587, 14211, 11553, 14205, 11521,
+		14198, 11488, 14192, 11460, 14183, 11426, 14177, 11398, 14170, 11371, 14163, 11341, 14157, 11317, 14150, 11290,
+		14145, 11266, 14139, 11219, 14133, 11171, 14126, 11122, 14120, 11081, 14114, 11036, 14107, 10988, 14100, 10946,
+		14094, 10905, 14088, 10864, 14082, 10826, 14077, 10788, 14071, 10750, 14065, 10713, 14059, 10678, 14053, 10642,
+		14047, 10606, 14040, 10574, 14035, 10542, 14029, 10509, 14024, 10480, 14018, 10448, 14011, 10416, 14006, 10388,
+		14000, 10360, 13995, 10332, 13990, 10308, 13983, 10279, 13977, 10254, 13972, 10216, 13967, 10168, 13962, 10118,
+		13957, 10072, 13951, 10026, 13945, 9983, 13941, 9942, 13934, 9894, 13928, 9850, 13925, 9815, 13919, 9771,
+		13914, 9735, 13909, 9695, 13902, 9655, 13897, 9620, 13893, 9587, 13888, 9550, 13883, 9517, 13877, 9482,
+		13872, 9448, 13868, 9420, 13862, 9387, 13858, 9358, 13852, 9326, 13847, 9296, 13842, 9268, 13838, 9243,
+		13833, 9214, 13828, 9162, 13823, 9106, 13818, 9058, 13813, 9008, 13809, 8962, 13804, 8916, 13800, 8870,
+		13794, 8822, 13791, 8781, 13785, 8733, 13780, 8691, 13775, 8649, 13770, 8609, 13766, 8573, 13762, 8532,
+		13757, 8494, 13753, 8462, 13748, 8424, 13744, 8391, 13739, 8354, 13735, 8322, 13730, 8290, 13726, 8259,
+		13721, 8227, 13717, 8196, 13713, 8141, 13708, 8085, 13703, 8027, 13699, 7976, 13695, 7917, 13691, 7867,
+		13687, 7818, 13682, 7764, 13678, 7718, 13673, 7669, 13669, 7624, 13665, 7581, 13661, 7535, 13657, 7496,
+		13653, 7452, 13649, 7412, 13644, 7370, 13641, 7335, 13636, 7293, 13632, 7258, 13629, 7224, 13625, 7188,
+		13621, 7145, 13616, 7070, 13612, 7010, 13608, 6944, 13605, 6885, 13601, 6828, 13597, 6770, 13594, 6716,
+		13589, 6656, 13586, 6605, 13581, 6550, 13578, 6505, 13574, 6453, 13570, 6407, 13567, 6360, 13562, 6312,
+		13559, 6268, 13555, 6227, 13551, 6186, 13548, 6144, 13544, 6070, 13540, 5990, 13537, 5921, 13533, 5843,
+		13529, 5777, 13526, 5709, 13523, 5649, 13519, 5581, 13515, 5520, 13511, 5460, 13508, 5404, 13504, 5345,
+		13501, 5291, 13498, 5240, 13494, 5186, 13491, 5140, 13487, 5063, 13483, 4974, 13480, 4879, 13476, 4797,
+		13473, 4713, 13470, 4631, 13466, 4554, 13463, 4483, 13460, 4406, 13456, 4339, 13453, 4267, 13450, 4210,
+		13446, 4142, 13443, 4068, 13440, 3956, 13437, 3841, 13434, 3738, 13430, 3636, 13427, 3531, 13424, 3436,
+		13420, 3346, 13417, 3260, 13414, 3175, 13411, 3096, 13408, 2959, 13405, 2817, 13402, 2678, 13398, 2537,
+		13395, 2410, 13392, 2290, 13389, 2171, 13386, 2062, 13383, 1866, 13380, 1666, 13377, 1474, 13374, 1295,
+		14604, 15689, 14595, 15434, 14588, 15236, 14581, 15026, 14573, 14876, 14566, 14756, 14556, 14643, 14551, 14569,
+		14544, 14488, 14538, 14423, 14532, 14363, 14524, 14283, 14519, 14188, 14513, 14094, 14507, 14014, 14501, 13944,
+		14496, 13873, 14490, 13808, 14485, 13745, 14481, 13694, 14474, 13636, 14468, 13590, 14463, 13544, 14459, 13498,
+		14455, 13458, 14450, 13416, 14443, 13376, 14438, 13344, 14434, 13302, 14429, 13240, 14424, 13176, 14419, 13114,
+		14416, 13061, 14410, 13004, 14407, 12956, 14402, 12906, 14398, 12858, 14394, 12814, 14389, 12767, 14384, 12722,
+		14381, 12683, 14376, 12643, 14372, 12603, 14368, 12568, 14364, 12532, 14359, 12494, 14355, 12462, 14351, 12431,
+		14348, 12402, 14343, 12370, 14340, 12342, 14337, 12315, 14328, 12280, 14320, 12231, 14311, 12178, 14304, 12125,
+		14298, 12081, 14291, 12033, 14283, 11986, 14276, 11943, 14269, 11904, 14261, 11859, 14253, 11820, 14246, 11780,
+		14239, 11740, 14234, 11705, 14226, 11669, 14219, 11635, 14212, 11597, 14205, 11566, 14198, 11533, 14192, 11502,
+		14185, 11470, 14178, 11441, 14171, 11413, 14164, 11382, 14158, 11356, 14151, 11328, 14145, 11302, 14139, 11278,
+		14133, 11239, 14128, 11195, 14120, 11144, 14113, 11096, 14106, 11045, 14102, 11011, 14094, 10967, 14087, 10920,
+		14081, 10881, 14076, 10843, 14071, 10805, 14064, 10766, 14059, 10729, 14052, 10692, 14047, 10658, 14040, 10623,
+		14034, 10588, 14028, 10555, 14023, 10524, 14017, 10491, 14010, 10459, 14006, 10433, 13999, 10401, 13993, 10372,
+		13988, 10344, 13982, 10317, 13977, 10291, 13972, 10268, 13966, 10237, 13962, 10194, 13956, 10142, 13950, 10095,
+		13944, 10047, 13939, 10002, 13933, 9955, 13928, 9914, 13923, 9875, 13918, 9829, 13913, 9790, 13908, 9753,
+		13902, 9713, 13896, 9674, 13891, 9639, 13886, 9600, 13881, 9567, 13876, 9533, 13871, 9499, 13866, 9466,
+		13861, 9434, 13855, 9399, 13851, 9373, 13845, 9341, 13841, 9312, 13836, 9284, 13831, 9254, 13826, 9227,
+		13821, 9186, 13817, 9134, 13813, 9088, 13807, 9033, 13802, 8983, 13797, 8937, 13792, 8888, 13788, 8846,
+		13784, 8801, 13779, 8758, 13776, 8720, 13770, 8676, 13765, 8633, 13761, 8594, 13756, 8555, 13752, 8518,
+		13747, 8479, 13742, 8445, 13738, 8410, 13733, 8374, 13730, 8343, 13725, 8309, 13720, 8276, 13716, 8246,
+		13711, 8213, 13707, 8178, 13702, 8119, 13698, 8062, 13694, 8007, 13689, 7951, 13686, 7901, 13682, 7849,
+		13677, 7797, 13673, 7752, 13669, 7702, 13665, 7658, 13660, 7609, 13656, 7566, 13652, 7523, 13649, 7481,
+		13644, 7440, 13640, 7396, 13636, 7359, 13632, 7321, 13628, 7283, 13624, 7249, 13619, 7212, 13616, 7178,
+		13611, 7117, 13608, 7056, 13604, 6993, 13600, 6931, 13596, 6870, 13592, 6807, 13589, 6756, 13584, 6696,
+		13581, 6646, 13577, 6591, 13573, 6540, 13570, 6492, 13566, 6441, 13562, 6393, 13558, 6348, 13554, 6302,
+		13550, 6258, 13547, 6217, 13543, 6175, 13540, 6131, 13536, 6050, 13532, 5977, 13528, 5902, 13525, 5837,
+		13521, 5761, 13518, 5698, 13514, 5632, 13511, 5569, 13507, 5510, 13504, 5453, 13500, 5392, 13497, 5337,
+		13494, 5285, 13490, 5231, 13487, 5184, 13482, 5131, 13480, 5051, 13476, 4954, 13473, 4873, 13470, 4785,
+		13467, 4711, 13463, 4623, 13459, 4547, 13456, 4469, 13453, 4403, 13450, 4332, 13446, 4266, 13443, 4202,
+		13440, 4139, 13436, 4060, 13433, 3941, 13430, 3834, 13426, 3727, 13423, 3621, 13420, 3530, 13417, 3433,
+		13414, 3344, 13411, 3254, 13408, 3174, 13405, 3093, 13401, 2956, 13399, 2815, 13395, 2674, 13393, 2542,
+		13390, 2411, 13386, 2289, 13383, 2174, 13380, 2062, 13377, 1870, 13375, 1676, 13371, 1479, 13368, 1299,
+		14600, 15679, 14591, 15422, 14584, 15213, 14575, 15009, 14568, 14855, 14561, 14738, 14551, 14631, 14547, 14557,
+		14539, 14474, 14533, 14409, 14526, 14350, 14519, 14258, 14514, 14166, 14508, 14075, 14502, 13994, 14495, 13923,
+		14490, 13851, 14484, 13787, 14480, 13730, 14474, 13674, 14469, 13621, 14462, 13572, 14458, 13529, 14453, 13482,
+		14449, 13443, 14444, 13403, 14437, 13363, 14433, 13332, 14428, 13277, 14423, 13211, 14419, 13156, 14414, 13095,
+		14410, 13038, 14405, 12987, 14401, 12933, 14396, 12887, 14392, 12838, 14387, 12792, 14383, 12746, 14379, 12705,
+		14374, 12661, 14370, 12628, 14366, 12591, 14362, 12551, 14358, 12517, 14353, 12480, 14349, 12446, 14345, 12416,
+		14341, 12386, 14337, 12355, 14331, 12325, 14324, 12299, 14315, 12254, 14305, 12200, 14300, 12156, 14292, 12101,
+		14286, 12053, 14280, 12015, 14271, 11963, 14263, 11920, 14255, 11877, 14248, 11840, 14240, 11795, 14234, 11761,
+		14228, 11721, 14220, 11683, 14214, 11649, 14207, 11616, 14199, 11581, 14191, 11544, 14187, 11518, 14179, 11484,
+		14172, 11452, 14165, 11422, 14159, 11397, 14152, 11368, 14145, 11339, 14140, 11315, 14132, 11288, 14127, 11262,
+		14121, 11212, 14114, 11164, 14108, 11120, 14102, 11075, 14095, 11027, 14087, 10981, 14082, 10941, 14075, 10898,
+		14069, 10856, 14064, 10819, 14058, 10782, 14053, 10746, 14046, 10708, 14040, 10672, 14033, 10635, 14027, 10602,
+		14022, 10569, 14016, 10535, 14010, 10504, 14005, 10476, 13999, 10443, 13993, 10413, 13988, 10386, 13982, 10356,
+		13976, 10330, 13971, 10303, 13965, 10275, 13960, 10250, 13956, 10220, 13949, 10162, 13944, 10116, 13938, 10069,
+		13933, 10024, 13927, 9977, 13922, 9936, 13916, 9890, 13911, 9847, 13907, 9810, 13901, 9770, 13895, 9729,
+		13890, 9691, 13885, 9655, 13880, 9618, 13876, 9585, 13870, 9548, 13864, 9512, 13860, 9482, 13855, 9448,
+		13849, 9418, 13845, 9388, 13839, 9355, 13835, 9327, 13830, 9298, 13825, 9270, 13820, 9242, 13815, 9212,
+		13811, 9164, 13806, 9109, 13801, 9055, 13797, 9014, 13792, 8965, 13787, 8916, 13783, 8871, 13777, 8822,
+		13772, 8776, 13768, 8736, 13764, 8697, 13759, 8658, 13755, 8615, 13751, 8577, 13746, 8542, 13741, 8500,
+		13736, 8465, 13732, 8429, 13727, 8392, 13723, 8362, 13719, 8328, 13714, 8294, 13711, 8266, 13705, 8231,
+		13701, 8201, 13697, 8154, 13692, 8094, 13689, 8043, 13684, 7984, 13680, 7932, 13676, 7880, 13671, 7828,
+		13668, 7783, 13663, 7730, 13659, 7684, 13655, 7638, 13651, 7595, 13648, 7553, 13642, 7505, 13639, 7466,
+		13633, 7420, 13631, 7388, 13627, 7347, 13622, 7307, 13619, 7274, 13615, 7236, 13611, 7205, 13607, 7167,
+		13603, 7101, 13599, 7036, 13595, 6970, 13591, 6914, 13588, 6853, 13584, 6798, 13579, 6734, 13576, 6685,
+		13572, 6630, 13568, 6578, 13565, 6525, 13561, 6476, 13557, 6429, 13553, 6382, 13550, 6338, 13546, 6292,
+		13543, 6252, 13539, 6208, 13536, 6171, 13532, 6111, 13528, 6041, 13524, 5962, 13521, 5890, 13517, 5819,
+		13514, 5751, 13510, 5690, 13507, 5623, 13503, 5561, 13500, 5498, 13497, 5442, 13493, 5382, 13489, 5329,
+		13485, 5275, 13483, 5229, 13479, 5175, 13476, 5128, 13473, 5041, 13469, 4953, 13465, 4859, 13462, 4776,
+		13459, 4695, 13456, 4619, 13453, 4542, 13450, 4468, 13446, 4394, 13442, 4325, 13439, 4262, 13436, 4194,
+		13433, 4135, 13430, 4054, 13427, 3942, 13424, 3830, 13421, 3725, 13418, 3628, 13414, 3528, 13411, 3430,
+		13408, 3342, 13405, 3256, 13402, 3173, 13398, 3089, 13396, 2962, 13393, 2815, 13389, 2668, 13387, 2539,
+		13384, 2414, 13381, 2290, 13377, 2175, 13375, 2065, 13371, 1868, 13369, 1673, 13366, 1480, 13363, 1303,
+		14595, 15660, 14586, 15408, 14579, 15191, 14570, 14986, 14563, 14838, 14556, 14722, 14547, 14617, 14542, 14540,
+		14534, 14461, 14527, 14397, 14522, 14341, 14514, 14234, 14508, 14141, 14504, 14058, 14497, 13975, 14490, 13902,
+		14485, 13836, 14479, 13766, 14475, 13715, 14468, 13656, 14462, 13605, 14457, 13555, 14452, 13513, 14447, 13467,
+		14443, 13427, 14437, 13387, 14431, 13349, 14427, 13316, 14422, 13256, 14417, 13187, 14414, 13132, 14408, 13074,
+		14404, 13018, 14399, 12962, 14395, 12916, 14390, 12863, 14386, 12816, 14380, 12767, 14376, 12727, 14373, 12684,
+		14368, 12645, 14364, 12606, 14360, 12570, 14355, 12532, 14352, 12500, 14347, 12465, 14343, 12430, 14339, 12399,
+		14334, 12369, 14327, 12341, 14319, 12312, 14312, 12283, 14301, 12228, 14293, 12173, 14287, 12125, 14281, 12081,
+		14272, 12027, 14265, 11983, 14259, 11944, 14250, 11897, 14243, 11857, 14236, 11819, 14228, 11777, 14221, 11733,
+		14216, 11702, 14209, 11668, 14200, 11627, 14194, 11596, 14187, 11563, 14180, 11528, 14172, 11494, 14169, 11471,
+		14160, 11437, 14153, 11407, 14145, 11377, 14140, 11353, 14134, 11326, 14126, 11298, 14121, 11275, 14115, 11232,
+		14107, 11183, 14101, 11139, 14095, 11089, 14090, 11048, 14082, 11003, 14076, 10959, 14069, 10915, 14065, 10878,
+		14058, 10836, 14052, 10796, 14046, 10760, 14040, 10723, 14035, 10688, 14028, 10652, 14021, 10617, 14015, 10582,
+		14011, 10551, 14004, 10520, 13998, 10486, 13993, 10457, 13988, 10430, 13982, 10399, 13977, 10370, 13970, 10342,
+		13965, 10314, 13959, 10289, 13955, 10264, 13948, 10232, 13942, 10180, 13938, 10141, 13931, 10087, 13926, 10042,
+		13921, 9997, 13916, 9954, 13911, 9912, 13906, 9871, 13900, 9826, 13895, 9788, 13889, 9747, 13884, 9712,
+		13878, 9670, 13874, 9636, 13868, 9596, 13864, 9566, 13859, 9532, 13854, 9499, 13849, 9465, 13843, 9433,
+		13839, 9401, 13835, 9374, 13830, 9343, 13824, 9313, 13819, 9284, 13815, 9256, 13809, 9229, 13805, 9190,
+		13801, 9138, 13796, 9085, 13791, 9037, 13785, 8986, 13782, 8940, 13778, 8898, 13772, 8848, 13769, 8811,
+		13763, 8763, 13757, 8716, 13753, 8675, 13748, 8633, 13744, 8596, 13740, 8560, 13735, 8519, 13732, 8488,
+		13726, 8448, 13722, 8412, 13718, 8381, 13713, 8346, 13709, 8313, 13704, 8281, 13700, 8250, 13696, 8221,
+		13691, 8186, 13687, 8129, 13683, 8075, 13679, 8020, 13675, 7967, 13670, 7909, 13666, 7863, 13662, 7812,
+		13658, 7763, 13653, 7715, 13650, 7668, 13646, 7623, 13642, 7578, 13638, 7535, 13634, 7494, 13629, 7451,
+		13625, 7411, 13622, 7372, 13618, 7334, 13614, 7299, 13610, 7261, 13605, 7224, 13601, 7188, 13598, 7148,
+		13594, 7081, 13590, 7017, 13587, 6957, 13583, 6896, 13579, 6839, 13575, 6781, 13571, 6722, 13568, 6670,
+		13564, 6613, 13560, 6565, 13556, 6512, 13553, 6468, 13549, 6419, 13545, 6372, 13542, 6325, 13539, 6285,
+		13534, 6239, 13531, 6202, 13527, 6159, 13524, 6101, 13520, 6024, 13517, 5947, 13513, 5876, 13509, 5808,
+		13506, 5741, 13502, 5674, 13499, 5614, 13495, 5547, 13492, 5490, 13489, 5433, 13485, 5377, 13482, 5320,
+		13479, 5270, 13475, 5216, 13472, 5168, 13468, 5120, 13465, 5029, 13462, 4939, 13459, 4854, 13455, 4768,
+		13452, 4688, 13449, 4608, 13446, 4533, 13442, 4463, 13439, 4386, 13436, 4323, 13433, 4252, 13430, 4194,
+		13426, 4129, 13423, 4046, 13420, 3936, 13417, 3821, 13414, 3719, 13410, 3613, 13407, 3519, 13405, 3427,
+		13401, 3336, 13398, 3251, 13395, 3171, 13392, 3090, 13390, 2957, 13386, 2809, 13383, 2671, 13381, 2539,
+		13378, 2412, 13375, 2291, 13372, 2176, 13368, 2064, 13366, 1874, 13363, 1678, 13360, 1486, 13357, 1306,
+		14590, 15643, 14582, 15400, 14574, 15168, 14565, 14969, 14558, 14822, 14551, 14707, 14542, 14601, 14536, 14523,
+		14529, 14447, 14522, 14382, 14517, 14320, 14509, 14208, 14503, 14117, 14498, 14034, 14492, 13957, 14485, 13884,
+		14480, 13818, 14474, 13747, 14470, 13697, 14462, 13639, 14457, 13592, 14451, 13540, 14447, 13496, 14442, 13454,
+		14437, 13411, 14432, 13375, 14425, 13335, 14421, 13290, 14417, 13234, 14411, 13164, 14407, 13105, 14403, 13050,
+		14398, 12993, 14394, 12942, 14388, 12889, 14384, 12841, 14379, 12795, 14374, 12747, 14371, 12706, 14367, 12668,
+		14362, 12628, 14358, 12588, 14354, 12551, 14350, 12516, 14345, 12482, 14342, 12452, 14338, 12418, 14330, 12384,
+		14323, 12356, 14315, 12327, 14308, 12298, 14297, 12250, 14289, 12199, 14283, 12153, 14275, 12099, 14269, 12055,
+		14262, 12007, 14253, 11957, 14247, 11920, 14238, 11876, 14229, 11831, 14223, 11794, 14217, 11758, 14211, 11719,
+		14203, 11679, 14196, 11646, 14189, 11612, 14181, 11575, 14174, 11543, 14169, 11515, 14161, 11479, 14154, 11447,
+		14148, 11422, 14141, 11392, 14134, 11364, 14127, 11335, 14120, 11310, 14115, 11283, 14108, 11252, 14102, 11205,
+		14095, 11155, 14089, 11112, 14083, 11065, 14076, 11020, 14071, 10978, 14065, 10939, 14059, 10894, 14052, 10854,
+		14047, 10816, 14040, 10776, 14034, 10737, 14028, 10701, 14021, 10664, 14015, 10631, 14010, 10599, 14005, 10565,
+		13998, 10532, 13993, 10501, 13987, 10471, 13980, 10439, 13975, 10409, 13970, 10382, 13965, 10356, 13959, 10327,
+		13953, 10300, 13948, 10274, 13942, 10248, 13937, 10209, 13931, 10159, 13925, 10106, 13920, 10066, 13915, 10017,
+		13910, 9974, 13904, 9929, 13899, 9886, 13894, 9847, 13890, 9809, 13883, 9767, 13878, 9727, 13873, 9689,
+		13869, 9655, 13864, 9619, 13859, 9585, 13853, 9545, 13848, 9514, 13843, 9482, 13838, 9447, 13833, 9419,
+		13828, 9385, 13823, 9355, 13818, 9326, 13813, 9298, 13809, 9271, 13804, 9242, 13799, 9214, 13794, 9157,
+		13790, 9113, 13784, 9060, 13780, 9013, 13776, 8967, 13770, 8917, 13765, 8866, 13761, 8828, 13756, 8782,
+		13753, 8745, 13749, 8705, 13744, 8659, 13740, 8623, 13734, 8579, 13730, 8542, 13725, 8506, 13720, 8467,
+		13717, 8433, 13712, 8399, 13707, 8365, 13704, 8335, 13699, 8300, 13694, 8268, 13690, 8239, 13686, 8208,
+		13682, 8168, 13678, 8109, 13673, 8050, 13670, 8001, 13665, 7944, 13661, 7893, 13657, 7843, 13652, 7790,
+		13649, 7747, 13645, 7695, 13640, 7651, 13636, 7606, 13632, 7562, 13628, 7521, 13624, 7477, 13621, 7441,
+		13616, 7397, 13613, 7360, 13609, 7323, 13604, 7284, 13601, 7252, 13596, 7213, 13593, 7182, 13589, 7125,
+		13586, 7060, 13582, 7004, 13577, 6933, 13574, 6880, 13570, 6818, 13566, 6761, 13563, 6708, 13559, 6654,
+		13555, 6602, 13551, 6551, 13548, 6500, 13544, 6452, 13541, 6408, 13537, 6361, 13534, 6319, 13530, 6274,
+		13526, 6231, 13523, 6192, 13519, 6150, 13516, 6086, 13513, 6007, 13509, 5936, 13505, 5861, 13502, 5801,
+		13498, 5724, 13495, 5664, 13492, 5599, 13488, 5540, 13484, 5479, 13481, 5425, 13478, 5367, 13475, 5314,
+		13471, 5263, 13468, 5209, 13465, 5162, 13461, 5104, 13458, 5019, 13455, 4928, 13452, 4847, 13448, 4757,
+		13445, 4680, 13441, 4599, 13439, 4528, 13435, 4451, 13433, 4389, 13429, 4313, 13426, 4250, 13422, 4185,
+		13420, 4129, 13416, 4039, 13413, 3925, 13411, 3823, 13407, 3711, 13405, 3618, 13402, 3519, 13398, 3424,
+		13395, 3335, 13392, 3250, 13389, 3163, 13386, 3088, 13383, 2950, 13380, 2806, 13378, 2670, 13375, 2540,
+		13371, 2410, 13369, 2291, 13366, 2176, 13363, 2066, 13360, 1874, 13357, 1678, 13354, 1487, 13351, 1309,
+		14586, 15627, 14577, 15389, 14570, 15145, 14561, 14953, 14553, 14806, 14546, 14692, 14537, 14589, 14532, 14509,
+		14524, 14436, 14518, 14373, 14511, 14297, 14504, 14185, 14498, 14098, 14492, 14011, 14486, 13939, 14479, 13862,
+		14474, 13801, 14469, 13736, 14464, 13678, 14457, 13624, 14452, 13577, 14446, 13526, 14441, 13482, 14437, 13439,
+		14432, 13397, 14425, 13359, 14420, 13325, 14416, 13268, 14411, 13209, 14406, 13139, 14401, 13079, 14397, 13028,
+		14392, 12972, 14388, 12919, 14383, 12869, 14378, 12818, 14373, 12775, 14370, 12734, 14365, 12685, 14361, 12649,
+		14356, 12608, 14352, 12570, 14348, 12534, 14344, 12500, 14339, 12462, 14335, 12433, 14328, 12403, 14318, 12369,
+		14311, 12341, 14303, 12312, 14295, 12280, 14285, 12227, 14278, 12177, 14271, 12125, 14264, 12074, 14257, 12031,
+		14250, 11987, 14242, 11938, 14234, 11897, 14226, 11857, 14219, 11812, 14211, 11771, 14206, 11735, 14199, 11701,
+		14191, 11662, 14183, 11624, 14176, 11593, 14169, 11558, 14162, 11524, 14156, 11494, 14150, 11466, 14142, 11432,
+		14136, 11404, 14129, 11377, 14122, 11349, 14116, 11322, 14110, 11297, 14104, 11270, 14097, 11226, 14090, 11178,
+		14084, 11131, 14077, 11081, 14071, 11040, 14064, 10994, 14058, 10952, 14053, 10913, 14047, 10875, 14040, 10830,
+		14035, 10793, 14028, 10755, 14022, 10717, 14015, 10679, 14009, 10646, 14004, 10611, 13999, 10579, 13992, 10546,
+		13986, 10513, 13980, 10483, 13974, 10451, 13971, 10425, 13964, 10394, 13958, 10365, 13953, 10338, 13947, 10313,
+		13942, 10285, 13936, 10259, 13930, 10226, 13924, 10175, 13920, 10131, 13914, 10087, 13909, 10036, 13905, 9998,
+		13898, 9950, 13894, 9908, 13889, 9866, 13882, 9819, 13877, 9783, 13873, 9750, 13868, 9708, 13862, 9671,
+		13857, 9633, 13852, 9598, 13847, 9564, 13842, 9530, 13836, 9495, 13831, 9462, 13826, 9431, 13822, 9399,
+		13817, 9370, 13811, 9339, 13807, 9311, 13802, 9283, 13797, 9254, 13793, 9229, 13789, 9189, 13783, 9135,
+		13777, 9081, 13773, 9034, 13769, 8989, 13764, 8937, 13760, 8897, 13755, 8849, 13750, 8802, 13745, 8759,
+		13741, 8716, 13738, 8678, 13733, 8641, 13729, 8603, 13724, 8565, 13720, 8528, 13715, 8488, 13712, 8454,
+		13707, 8419, 13701, 8380, 13698, 8353, 13693, 8317, 13689, 8286, 13685, 8256, 13681, 8225, 13676, 8196,
+		13673, 8140, 13668, 8086, 13664, 8032, 13659, 7974, 13655, 7923, 13651, 7869, 13647, 7822, 13644, 7776,
+		13639, 7724, 13635, 7680, 13631, 7634, 13627, 7590, 13623, 7549, 13619, 7504, 13615, 7463, 13611, 7421,
+		13607, 7383, 13603, 7347, 13599, 7309, 13596, 7275, 13592, 7238, 13588, 7203, 13584, 7171, 13581, 7105,
+		13577, 7045, 13573, 6979, 13569, 6923, 13566, 6863, 13562, 6804, 13558, 6747, 13554, 6690, 13550, 6640,
+		13546, 6585, 13543, 6540, 13540, 6488, 13536, 6444, 13533, 6396, 13529, 6351, 13525, 6304, 13522, 6263,
+		13518, 6222, 13514, 6180, 13511, 6141, 13507, 6059, 13504, 5990, 13500, 5912, 13497, 5844, 13494, 5780,
+		13491, 5716, 13487, 5650, 13483, 5588, 13480, 5528, 13477, 5468, 13474, 5414, 13470, 5357, 13467, 5306,
+		13463, 5253, 13461, 5205, 13457, 5154, 13454, 5098, 13451, 5003, 13447, 4915, 13444, 4828, 13441, 4750,
+		13438, 4668, 13435, 4594, 13431, 4514, 13428, 4445, 13425, 4373, 13422, 4311, 13419, 4244, 13416, 4182,
+		13413, 4121, 13410, 4030, 13406, 3918, 13403, 3809, 13401, 3708, 13397, 3606, 13394, 3508, 13391, 3418,
+		13389, 3332, 13386, 3244, 13383, 3163, 13380, 3085, 13377, 2945, 13374, 2807, 13371, 2669, 13368, 2534,
+		13365, 2410, 13362, 2290, 13360, 2175, 13357, 2068, 13354, 1873, 13351, 1679, 13348, 1490, 13345, 1312,
+		14582, 15618, 14573, 15379, 14566, 15125, 14557, 14933, 14548, 14789, 14541, 14676, 14532, 14578, 14527, 14495,
+		14519, 14424, 14513, 14359, 14506, 14277, 14499, 14166, 14493, 14077, 14487, 13992, 14481, 13918, 14474, 13842,
+		14469, 13783, 14464, 13722, 14459, 13661, 14452, 13608, 14446, 13559, 14441, 13513, 14436, 13467, 14431, 13424,
+		14426, 13383, 14420, 13347, 14415, 13313, 14411, 13245, 14405, 13180, 14401, 13121, 14396, 13056, 14391, 13005,
+		14387, 12953, 14381, 12896, 14377, 12847, 14373, 12802, 14368, 12757, 14363, 12712, 14359, 12667, 14355, 12629,
+		14351, 12594, 14346, 12555, 14342, 12514, 14337, 12480, 14331, 12449, 14323, 12416, 14315, 12386, 14308, 12358,
+		14299, 12326, 14292, 12299, 14283, 12256, 14274, 12200, 14267, 12149, 14261, 12103, 14253, 12052, 14246, 12006,
+		14238, 11962, 14230, 11916, 14220, 11870, 14215, 11834, 14207, 11792, 14201, 11752, 14193, 11713, 14188, 11682,
+		14179, 11643, 14172, 11607, 14164, 11573, 14157, 11540, 14151, 11507, 14145, 11478, 14138, 11448, 14131, 11417,
+		14122, 11386, 14117, 11361, 14110, 11333, 14104, 11307, 14098, 11281, 14091, 11247, 14084, 11198, 14078, 11150,
+		14072, 11105, 14065, 11057, 14059, 11014, 14053, 10971, 14046, 10927, 14040, 10887, 14035, 10849, 14029, 10809,
+		14022, 10767, 14016, 10733, 14010, 10697, 14004, 10662, 13998, 10624, 13993, 10594, 13987, 10562, 13982, 10531,
+		13975, 10498, 13969, 10464, 13964, 10436, 13958, 10406, 13953, 10380, 13947, 10350, 13941, 10323, 13935, 10296,
+		13930, 10271, 13924, 10245, 13919, 10201, 13914, 10153, 13908, 10103, 13903, 10057, 13898, 10015, 13892, 9965,
+		13888, 9930, 13883, 9884, 13877, 9843, 13872, 9806, 13866, 9759, 13861, 9725, 13856, 9687, 13852, 9653,
+		13846, 9614, 13841, 9579, 13835, 9544, 13830, 9510, 13826, 9481, 13820, 9445, 13815, 9413, 13811, 9384,
+		13806, 9355, 13802, 9327, 13797, 9298, 13792, 9270, 13787, 9240, 13782, 9213, 13777, 9159, 13773, 9113,
+		13769, 9066, 13764, 9014, 13759, 8962, 13754, 8917, 13750, 8872, 13745, 8828, 13741, 8788, 13737, 8744,
+		13732, 8700, 13726, 8658, 13722, 8619, 13717, 8581, 13713, 8543, 13710, 8508, 13705, 8473, 13701, 8437,
+		13697, 8404, 13693, 8371, 13687, 8335, 13684, 8305, 13679, 8273, 13675, 8243, 13671, 8213, 13667, 8172,
+		13663, 8120, 13658, 8061, 13654, 8011, 13650, 7958, 13646, 7902, 13642, 7852, 13638, 7804, 13634, 7755,
+		13630, 7712, 13625, 7663, 13621, 7615, 13618, 7575, 13614, 7529, 13611, 7492, 13606, 7448, 13602, 7409,
+		13599, 7373, 13594, 7330, 13591, 7300, 13587, 7261, 13583, 7227, 13580, 7193, 13575, 7149, 13572, 7089,
+		13567, 7019, 13564, 6962, 13560, 6898, 13556, 6842, 13553, 6788, 13549, 6730, 13545, 6678, 13542, 6623,
+		13539, 6577, 13535, 6524, 13531, 6477, 13528, 6430, 13524, 6385, 13521, 6338, 13517, 6293, 13514, 6253,
+		13510, 6211, 13507, 6173, 13503, 6120, 13500, 6048, 13496, 5973, 13493, 5902, 13490, 5835, 13486, 5769,
+		13483, 5702, 13479, 5635, 13476, 5578, 13473, 5516, 13469, 5458, 13466, 5403, 13463, 5350, 13460, 5297,
+		13457, 5246, 13453, 5195, 13450, 5151, 13446, 5083, 13443, 4994, 13440, 4904, 13437, 4823, 13434, 4738,
+		13431, 4659, 13427, 4582, 13424, 4511, 13422, 4438, 13418, 4370, 13415, 4302, 13412, 4240, 13409, 4177,
+		13406, 4116, 13403, 4026, 13400, 3909, 13397, 3805, 13394, 3702, 13391, 3600, 13388, 3507, 13385, 3415,
+		13382, 3328, 13379, 3242, 13376, 3160, 13374, 3083, 13370, 2945, 13367, 2803, 13365, 2665, 13362, 2534,
+		13359, 2406, 13356, 2287, 13354, 2175, 13351, 2065, 13348, 1880, 13345, 1679, 13342, 1493, 13339, 1314,
+		14578, 15603, 14569, 15371, 14561, 15110, 14552, 14915, 14544, 14773, 14537, 14661, 14528, 14563, 14522, 14482,
+		14515, 14411, 14508, 14348, 14501, 14254, 14495, 14146, 14488, 14057, 14483, 13974, 14476, 13899, 14469, 13822,
+		14464, 13765, 14459, 13705, 14452, 13642, 14447, 13591, 14441, 13543, 14436, 13498, 14431, 13451, 14426, 13411,
+		14420, 13369, 14415, 13334, 14410, 13288, 14405, 13219, 14400, 13153, 14395, 13099, 14390, 13035, 14386, 12980,
+		14381, 12929, 14376, 12875, 14372, 12827, 14366, 12780, 14362, 12733, 14359, 12696, 14354, 12653, 14348, 12609,
+		14345, 12575, 14341, 12538, 14336, 12502, 14328, 12467, 14320, 12433, 14311, 12399, 14304, 12372, 14296, 12342,
+		14287, 12310, 14280, 12282, 14270, 12227, 14262, 12173, 14256, 12125, 14249, 12074, 14241, 12029, 14233, 11978,
+		14226, 11938, 14217, 11893, 14209, 11852, 14202, 11807, 14197, 11775, 14189, 11733, 14182, 11693, 14173, 11655,
+		14167, 11625, 14159, 11589, 14153, 11556, 14146, 11521, 14140, 11493, 14132, 11458, 14126, 11430, 14119, 11403,
+		14112, 11373, 14105, 11344, 14098, 11319, 14092, 11291, 14086, 11267, 14078, 11216, 14073, 11174, 14067, 11127,
+		14061, 11079, 14054, 11036, 14048, 10990, 14041, 10946, 14035, 10905, 14029, 10863, 14023, 10825, 14018, 10790,
+		14011, 10751, 14003, 10709, 13999, 10679, 13993, 10642, 13988, 10610, 13982, 10575, 13976, 10543, 13970, 10511,
+		13965, 10482, 13958, 10449, 13953, 10418, 13947, 10392, 13942, 10362, 13936, 10337, 13930, 10308, 13924, 10281,
+		13918, 10254, 13914, 10225, 13909, 10176, 13903, 10127, 13898, 10080, 13892, 10033, 13887, 9989, 13883, 9947,
+		13876, 9899, 13872, 9864, 13865, 9819, 13861, 9781, 13856, 9744, 13850, 9702, 13845, 9664, 13840, 9631,
+		13835, 9595, 13830, 9560, 13825, 9526, 13819, 9492, 13815, 9459, 13811, 9431, 13807, 9401, 13801, 9370,
+		13796, 9339, 13791, 9310, 13786, 9282, 13782, 9256, 13778, 9231, 13773, 9188, 13767, 9137, 13762, 9082,
+		13758, 9035, 13754, 8995, 13749, 8944, 13744, 8894, 13740, 8851, 13735, 8808, 13731, 8764, 13727, 8727,
+		13722, 8684, 13718, 8646, 13713, 8606, 13708, 8564, 13704, 8528, 13699, 8490, 13695, 8453, 13691, 8421,
+		13686, 8385, 13682, 8355, 13678, 8322, 13674, 8292, 13670, 8260, 13666, 8230, 13662, 8200, 13658, 8155,
+		13653, 8093, 13648, 8038, 13645, 7988, 13641, 7930, 13637, 7885, 13633, 7834, 13628, 7784, 13625, 7738,
+		13620, 7688, 13617, 7647, 13613, 7601, 13609, 7558, 13606, 7519, 13601, 7476, 13597, 7439, 13593, 7396,
+		13589, 7357, 13585, 7321, 13581, 7283, 13578, 7251, 13574, 7215, 13569, 7179, 13566, 7131, 13562, 7062,
+		13560, 7007, 13556, 6947, 13552, 6885, 13549, 6828, 13544, 6768, 13541, 6716, 13537, 6662, 13534, 6614,
+		13530, 6561, 13527, 6514, 13523, 6464, 13520, 6416, 13516, 6372, 13513, 6326, 13510, 6286, 13506, 6243,
+		13502, 6203, 13499, 6163, 13495, 6109, 13492, 6033, 13489, 5961, 13485, 5888, 13482, 5821, 13478, 5755,
+		13475, 5688, 13472, 5626, 13468, 5566, 13465, 5509, 13462, 5450, 13459, 5394, 13455, 5338, 13452, 5290,
+		13448, 5235, 13445, 5189, 13443, 5141, 13439, 5068, 13436, 4980, 13433, 4896, 13430, 4810, 13426, 4728,
+		13423, 4649, 13421, 4575, 13418, 4501, 13414, 4429, 13411, 4362, 13408, 4293, 13405, 4233, 13402, 4171,
+		13400, 4114, 13396, 4009, 13393, 3904, 13390, 3795, 13387, 3690, 13384, 3597, 13381, 3496, 13378, 3407,
+		13376, 3322, 13373, 3239, 13370, 3156, 13367, 3079, 13364, 2941, 13361, 2797, 13358, 2662, 13356, 2532,
+		13353, 2409, 13350, 2285, 13347, 2171, 13344, 2066, 13342, 1881, 13339, 1679, 13336, 1492, 13333, 1317,
+		14574, 15591, 14565, 15350, 14557, 15086, 14548, 14897, 14540, 14758, 14532, 14642, 14523, 14551, 14517, 14469,
+		14510, 14401, 14504, 14336, 14496, 14233, 14490, 14128, 14484, 14032, 14477, 13953, 14470, 13879, 14464, 13807,
+		14459, 13745, 14455, 13686, 14447, 13628, 14442, 13579, 14436, 13529, 14431, 13485, 14425, 13438, 14421, 13398,
+		14415, 13357, 14409, 13321, 14406, 13269, 14399, 13192, 14395, 13130, 14390, 13076, 14385, 13013, 14380, 12954,
+		14376, 12907, 14371, 12857, 14367, 12811, 14361, 12761, 14357, 12717, 14353, 12677, 14349, 12638, 14343, 12593,
+		14339, 12557, 14335, 12524, 14326, 12490, 14317, 12452, 14308, 12416, 14300, 12385, 14291, 12355, 14284, 12327,
+		14277, 12299, 14267, 12253, 14259, 12202, 14253, 12153, 14244, 12098, 14238, 12050, 14231, 12007, 14222, 11961,
+		14213, 11911, 14205, 11873, 14198, 11828, 14190, 11786, 14185, 11750, 14178, 11713, 14170, 11676, 14162, 11638,
+		14154, 11603, 14147, 11569, 14141, 11537, 14136, 11506, 14129, 11476, 14121, 11444, 14114, 11412, 14107, 11386,
+		14101, 11361, 14093, 11330, 14087, 11303, 14081, 11278, 14075, 11243, 14068, 11195, 14062, 11143, 14056, 11101,
+		14049, 11056, 14043, 11012, 14036, 10964, 14030, 10922, 14024, 10881, 14018, 10844, 14011, 10801, 14005, 10764,
+		13999, 10731, 13994, 10695, 13987, 10653, 13983, 10625, 13976, 10588, 13970, 10556, 13964, 10524, 13958, 10493,
+		13952, 10461, 13948, 10435, 13942, 10405, 13935, 10372, 13929, 10346, 13924, 10318, 13919, 10295, 13914, 10267,
+		13909, 10244, 13903, 10193, 13898, 10148, 13893, 10102, 13887, 10058, 13881, 10007, 13876, 9963, 13870, 9921,
+		13865, 9879, 13859, 9835, 13855, 9800, 13850, 9758, 13844, 9720, 13841, 9687, 13835, 9648, 13829, 9609,
+		13824, 9576, 13820, 9544, 13815, 9509, 13810, 9480, 13805, 9444, 13800, 9413, 13795, 9382, 13791, 9355,
+		13786, 9327, 13780, 9295, 13776, 9268, 13771, 9239, 13766, 9213, 13761, 9162, 13757, 9110, 13752, 9062,
+		13747, 9009, 13742, 8963, 13739, 8922, 13735, 8880, 13730, 8830, 13726, 8787, 13720, 8743, 13715, 8701,
+		13712, 8666, 13707, 8623, 13703, 8586, 13699, 8549, 13695, 8511, 13690, 8478, 13686, 8442, 13681, 8404,
+		13677, 8373, 13672, 8339, 13668, 8306, 13665, 8278, 13661, 8247, 13656, 8218, 13651, 8180, 13647, 8125,
+		13644, 8077, 13640, 8019, 13635, 7961, 13632, 7917, 13627, 7861, 13623, 7816, 13619, 7765, 13615, 7717,
+		13612, 7676, 13607, 7626, 13604, 7584, 13600, 7543, 13595, 7500, 13591, 7460, 13587, 7419, 13584, 7381,
+		13581, 7347, 13577, 7308, 13573, 7272, 13569, 7237, 13565, 7203, 13562, 7171, 13558, 7107, 13554, 7047,
+		13550, 6980, 13546, 6922, 13543, 6865, 13539, 6806, 13537, 6758, 13533, 6699, 13529, 6649, 13525, 6596,
+		13522, 6548, 13518, 6498, 13515, 6450, 13511, 6403, 13508, 6359, 13504, 6318, 13501, 6273, 13498, 6236,
+		13494, 6193, 13491, 6157, 13487, 6084, 13484, 6014, 13480, 5944, 13478, 5875, 13474, 5808, 13471, 5739,
+		13468, 5680, 13464, 5612, 13461, 5553, 13457, 5497, 13455, 5441, 13451, 5384, 13448, 5333, 13445, 5282,
+		13441, 5228, 13439, 5181, 13435, 5132, 13432, 5053, 13429, 4968, 13426, 4883, 13423, 4798, 13420, 4724,
+		13416, 4640, 13414, 4567, 13410, 4491, 13407, 4422, 13404, 4355, 13402, 4293, 13398, 4225, 13395, 4166,
+		13392, 4105, 13389, 4004, 13387, 3896, 13383, 3787, 13381, 3690, 13377, 3586, 13375, 3497, 13372, 3407,
+		13369, 3318, 13366, 3234, 13363, 3152, 13361, 3078, 13358, 2938, 13354, 2789, 13352, 2659, 13349, 2529,
+		13346, 2406, 13344, 2287, 13341, 2174, 13338, 2066, 13336, 1883, 13333, 1682, 13330, 1495, 13327, 1319,
+		14570, 15579, 14561, 15326, 14553, 15071, 14544, 14882, 14536, 14747, 14528, 14625, 14519, 14541, 14512, 14457,
+		14506, 14389, 14499, 14311, 14491, 14206, 14485, 14109, 14479, 14014, 14472, 13934, 14465, 13862, 14459, 13789,
+		14455, 13726, 14450, 13671, 14442, 13612, 14436, 13563, 14431, 13514, 14426, 13469, 14421, 13424, 14416, 13384,
+		14410, 13345, 14404, 13307, 14400, 13238, 14394, 13173, 14390, 13110, 14384, 13049, 14380, 12994, 14375, 12936,
+		14370, 12886, 14366, 12840, 14361, 12791, 14356, 12742, 14352, 12699, 14347, 12657, 14343, 12623, 14339, 12580,
+		14331, 12539, 14324, 12506, 14315, 12472, 14306, 12438, 14300, 12407, 14289, 12374, 14280, 12340, 14274, 12314,
+		14265, 12281, 14255, 12224, 14248, 12177, 14241, 12124, 14234, 12075, 14227, 12027, 14218, 11980, 14210, 11938,
+		14201, 11887, 14194, 11848, 14188, 11812, 14181, 11769, 14174, 11727, 14168, 11697, 14158, 11656, 14151, 11621,
+		14143, 11584, 14137, 11554, 14131, 11521, 14124, 11488, 14117, 11457, 14111, 11430, 14103, 11400, 14095, 11370,
+		14089, 11343, 14084, 11319, 14077, 11289, 14070, 11265, 14063, 11214, 14057, 11168, 14051, 11121, 14044, 11073,
+		14037, 11027, 14032, 10987, 14026, 10946, 14019, 10898, 14013, 10859, 14007, 10822, 14001, 10785, 13993, 10742,
+		13988, 10706, 13983, 10675, 13977, 10639, 13970, 10600, 13965, 10572, 13958, 10536, 13952, 10505, 13947, 10475,
+		13942, 10445, 13935, 10413, 13931, 10389, 13925, 10361, 13919, 10330, 13913, 10304, 13908, 10279, 13903, 10253,
+		13897, 10215, 13891, 10166, 13886, 10116, 13880, 10072, 13875, 10028, 13870, 9985, 13864, 9937, 13859, 9896,
+		13854, 9858, 13850, 9819, 13844, 9776, 13839, 9740, 13834, 9700, 13829, 9661, 13825, 9632, 13819, 9594,
+		13813, 9556, 13809, 9524, 13805, 9493, 13799, 9458, 13795, 9432, 13789, 9397, 13784, 9367, 13778, 9335,
+		13775, 9310, 13771, 9283, 13766, 9254, 13761, 9230, 13755, 9183, 13751, 9132, 13747, 9087, 13742, 9037,
+		13738, 8991, 13733, 8943, 13728, 8893, 13724, 8850, 13720, 8810, 13715, 8768, 13711, 8727, 13706, 8683,
+		13701, 8641, 13697, 8603, 13693, 8567, 13689, 8530, 13684, 8496, 13679, 8457, 13676, 8426, 13672, 8394,
+		13668, 8358, 13664, 8327, 13660, 8297, 13654, 8262, 13651, 8236, 13646, 8204, 13642, 8158, 13638, 8103,
+		13634, 8047, 13630, 7996, 13626, 7943, 13621, 7891, 13618, 7842, 13614, 7794, 13610, 7744, 13607, 7705,
+		13602, 7653, 13599, 7613, 13595, 7570, 13590, 7524, 13587, 7488, 13583, 7447, 13579, 7407, 13575, 7368,
+		13571, 7331, 13568, 7297, 13564, 7260, 13561, 7227, 13556, 7191, 13553, 7147, 13550, 7090, 13546, 7026,
+		13543, 6970, 13538, 6907, 13535, 6846, 13532, 6795, 13528, 6737, 13524, 6686, 13521, 6633, 13517, 6581,
+		13514, 6532, 13510, 6482, 13507, 6441, 13503, 6393, 13500, 6351, 13496, 6305, 13493, 6263, 13489, 6222,
+		13486, 6183, 13483, 6146, 13479, 6072, 13476, 6001, 13472, 5923, 13469, 5861, 13466, 5786, 13462, 5725,
+		13459, 5662, 13456, 5603, 13453, 5542, 13450, 5486, 13446, 5429, 13443, 5375, 13440, 5323, 13437, 5269,
+		13434, 5222, 13431, 5171, 13428, 5128, 13424, 5036, 13422, 4956, 13418, 4864, 13416, 4791, 13412, 4704,
+		13409, 4632, 13406, 4557, 13404, 4486, 13401, 4415, 13397, 4347, 13394, 4283, 13392, 4222, 13389, 4161,
+		13386, 4103, 13383, 3997, 13379, 3884, 13377, 3781, 13373, 3679, 13371, 3582, 13368, 3490, 13365, 3395,
+		13362, 3312, 13359, 3230, 13357, 3153, 13354, 3076, 13351, 2932, 13348, 2788, 13346, 2655, 13343, 2530,
+		13340, 2405, 13338, 2287, 13335, 2174, 13332, 2065, 13329, 1880, 13327, 1682, 13324, 1497, 13321, 1321,
+		14566, 15565, 14557, 15307, 14549, 15048, 14540, 14869, 14531, 14727, 14524, 14615, 14515, 14525, 14508, 14446,
+		14502, 14379, 14494, 14288, 14486, 14183, 14480, 14090, 14475, 13997, 14468, 13916, 14461, 13845, 14455, 13773,
+		14450, 13708, 14445, 13656, 14437, 13596, 14431, 13546, 14426, 13498, 14420, 13451, 14416, 13413, 14411, 13370,
+		14405, 13334, 14400, 13284, 14394, 13215, 14389, 13149, 14384, 13086, 14379, 13025, 14374, 12973, 14369, 12914,
+		14364, 12862, 14361, 12818, 14355, 12772, 14351, 12727, 14347, 12682, 14343, 12641, 14337, 12603, 14331, 12566,
+		14321, 12523, 14312, 12488, 14304, 12456, 14297, 12425, 14289, 12392, 14279, 12360, 14270, 12328, 14263, 12299,
+		14253, 12257, 14245, 12202, 14237, 12148, 14230, 12099, 14224, 12057, 14215, 12003, 14207, 11957, 14199, 11916,
+		14191, 11873, 14183, 11822, 14178, 11790, 14171, 11752, 14163, 11710, 14155, 11672, 14148, 11640, 14139, 11602,
+		14133, 11567, 14126, 11534, 14121, 11505, 14113, 11472, 14106, 11441, 14098, 11411, 14091, 11383, 14085, 11356,
+		14078, 11328, 14072, 11302, 14066, 11277, 14059, 11235, 14052, 11190, 14045, 11137, 14039, 11092, 14032, 11047,
+		14026, 11002, 14020, 10958, 14014, 10919, 14009, 10884, 14002, 10838, 13995, 10797, 13989, 10762, 13984, 10726,
+		13977, 10688, 13971, 10650, 13966, 10620, 13960, 10587, 13953, 10549, 13948, 10522, 13942, 10488, 13936, 10456,
+		13931, 10429, 13925, 10400, 13919, 10369, 13914, 10346, 13909, 10320, 13902, 10289, 13897, 10263, 13892, 10241,
+		13886, 10190, 13881, 10139, 13875, 10094, 13869, 10044, 13864, 10001, 13859, 9959, 13855, 9920, 13849, 9874,
+		13844, 9831, 13839, 9795, 13834, 9757, 13830, 9718, 13824, 9683, 13818, 9644, 13812, 9605, 13808, 9575,
+		13804, 9544, 13798, 9503, 13794, 9473, 13788, 9443, 13783, 9410, 13779, 9384, 13774, 9353, 13769, 9323,
+		13764, 9293, 13760, 9267, 13755, 9241, 13750, 9215, 13746, 9162, 13740, 9105, 13737, 9063, 13732, 9014,
+		13728, 8967, 13723, 8922, 13720, 8879, 13713, 8829, 13709, 8786, 13705, 8747, 13700, 8705, 13697, 8669,
+		13693, 8628, 13688, 8587, 13683, 8549, 13678, 8512, 13673, 8473, 13670, 8443, 13666, 8407, 13662, 8374,
+		13658, 8345, 13654, 8312, 13649, 8280, 13645, 8251, 13641, 8220, 13637, 8192, 13633, 8137, 13629, 8077,
+		13625, 8027, 13621, 7973, 13616, 7920, 13613, 7873, 13609, 7823, 13606, 7778, 13601, 7729, 13597, 7681,
+		13594, 7643, 13589, 7595, 13585, 7550, 13582, 7513, 13578, 7470, 13574, 7432, 13570, 7394, 13566, 7353,
+		13563, 7320, 13558, 7282, 13555, 7247, 13552, 7216, 13548, 7179, 13545, 7135, 13540, 7061, 13537, 7006,
+		13534, 6949, 13530, 6884, 13527, 6832, 13523, 6774, 13519, 6723, 13516, 6670, 13512, 6618, 13509, 6567,
+		13505, 6520, 13502, 6471, 13498, 6424, 13495, 6380, 13491, 6336, 13489, 6297, 13485, 6253, 13482, 6214,
+		13478, 6176, 13474, 6127, 13472, 6056, 13468, 5980, 13465, 5914, 13461, 5841, 13458, 5779, 13455, 5711,
+		13452, 5649, 13449, 5589, 13445, 5528, 13442, 5474, 13439, 5420, 13436, 5365, 13433, 5309, 13430, 5263,
+		13426, 5213, 13423, 5166, 13420, 5117, 13418, 5033, 13414, 4939, 13411, 4856, 13408, 4773, 13405, 4699,
+		13402, 4620, 13399, 4547, 13396, 4476, 13393, 4407, 13390, 4340, 13387, 4274, 13384, 4215, 13381, 4152,
+		13378, 4098, 13375, 3983, 13373, 3879, 13370, 3769, 13367, 3682, 13364, 3576, 13361, 3485, 13359, 3396,
+		13356, 3310, 13353, 3226, 13350, 3148, 13347, 3071, 13344, 2923, 13342, 2789, 13339, 2653, 13336, 2520,
+		13333, 2397, 13331, 2285, 13328, 2173, 13326, 2067, 13323, 1878, 13320, 1682, 13318, 1502, 13315, 1323,
+		14562, 15554, 14553, 15290, 14545, 15031, 14536, 14850, 14527, 14713, 14520, 14602, 14511, 14512, 14503, 14429,
+		14497, 14366, 14490, 14266, 14482, 14162, 14475, 14063, 14471, 13979, 14464, 13900, 14455, 13821, 14451, 13756,
+		14445, 13692, 14440, 13642, 14433, 13581, 14426, 13531, 14421, 13483, 14416, 13437, 14411, 13397, 14406, 13359,
+		14400, 13323, 14395, 13258, 14389, 13190, 14384, 13129, 14379, 13062, 14374, 13004, 14370, 12955, 14365, 12897,
+		14360, 12846, 14356, 12800, 14350, 12752, 14346, 12711, 14342, 12667, 14336, 12622, 14329, 12586, 14320, 12548,
+		14310, 12508, 14300, 12470, 14293, 12440, 14286, 12409, 14277, 12377, 14269, 12347, 14261, 12316, 14251, 12282,
+		14242, 12229, 14234, 12177, 14227, 12124, 14220, 12075, 14213, 12028, 14205, 11984, 14195, 11932, 14186, 11888,
+		14180, 11852, 14173, 11808, 14165, 11765, 14159, 11730, 14151, 11692, 14143, 11654, 14136, 11620, 14129, 11584,
+		14122, 11550, 14116, 11517, 14109, 11487, 14102, 11458, 14094, 11425, 14087, 11396, 14080, 11368, 14073, 11339,
+		14067, 11311, 14061, 11285, 14054, 11261, 14048, 11210, 14042, 11161, 14034, 11113, 14027, 11066, 14021, 11022,
+		14015, 10979, 14010, 10938, 14003, 10895, 13996, 10854, 13992, 10821, 13984, 10777, 13978, 10740, 13972, 10703,
+		13967, 10670, 13961, 10633, 13954, 10598, 13949, 10569, 13943, 10535, 13937, 10502, 13932, 10473, 13926, 10442,
+		13921, 10414, 13915, 10385, 13909, 10356, 13903, 10328, 13898, 10303, 13893, 10279, 13886, 10249, 13880, 10206,
+		13876, 10162, 13870, 10118, 13865, 10067, 13860, 10025, 13854, 9978, 13849, 9937, 13844, 9894, 13839, 9855,
+		13833, 9812, 13827, 9769, 13823, 9733, 13819, 9698, 13812, 9659, 13808, 9627, 13802, 9588, 13797, 9551,
+		13793, 9522, 13789, 9494, 13783, 9456, 13777, 9424, 13773, 9395, 13768, 9364, 13764, 9338, 13760, 9310,
+		13755, 9281, 13750, 9253, 13745, 9226, 13740, 9184, 13736, 9135, 13731, 9088, 13727, 9036, 13722, 8985,
+		13718, 8943, 13714, 8897, 13708, 8854, 13705, 8814, 13700, 8769, 13695, 8726, 13691, 8685, 13687, 8646,
+		13682, 8608, 13679, 8574, 13674, 8538, 13670, 8498, 13666, 8466, 13661, 8427, 13657, 8396, 13652, 8360,
+		13647, 8327, 13644, 8298, 13640, 8268, 13635, 8236, 13631, 8207, 13628, 8169, 13624, 8110, 13620, 8060,
+		13615, 8003, 13612, 7955, 13608, 7902, 13603, 7847, 13600, 7808, 13595, 7757, 13592, 7708, 13588, 7663,
+		13584, 7620, 13580, 7577, 13577, 7540, 13573, 7493, 13569, 7456, 13565, 7417, 13561, 7379, 13558, 7343,
+		13555, 7306, 13551, 7272, 13547, 7237, 13543, 7202, 13539, 7171, 13535, 7106, 13533, 7049, 13529, 6988,
+		13525, 6925, 13521, 6867, 13517, 6810, 13514, 6759, 13511, 6704, 13508, 6652, 13504, 6602, 13500, 6551,
+		13497, 6508, 13493, 6456, 13490, 6414, 13487, 6370, 13484, 6328, 13480, 6282, 13476, 6242, 13474, 6205,
+		13470, 6163, 13467, 6110, 13463, 6031, 13460, 5967, 13457, 5892, 13454, 5830, 13451, 5762, 13447, 5697,
+		13444, 5640, 13441, 5577, 13438, 5520, 13435, 5461, 13431, 5408, 13428, 5351, 13425, 5304, 13422, 5251,
+		13419, 5206, 13416, 5156, 13413, 5104, 13409, 5015, 13407, 4929, 13404, 4848, 13401, 4768, 13397, 4684,
+		13394, 4610, 13392, 4537, 13389, 4469, 13387, 4403, 13383, 4331, 13380, 4270, 13377, 4206, 13374, 4150,
+		13372, 4084, 13369, 3979, 13366, 3867, 13363, 3764, 13360, 3665, 13357, 3569, 13355, 3480, 13352, 3389,
+		13349, 3302, 13346, 3223, 13344, 3145, 13341, 3061, 13338, 2921, 13336, 2786, 13333, 2646, 13330, 2521,
+		13327, 2398, 13325, 2281, 13322, 2168, 13319, 2065, 13317, 1876, 13314, 1686, 13311, 1501, 13306, 1324,
+		14559, 15545, 14550, 15270, 14541, 15012, 14531, 14830, 14524, 14702, 14514, 14588, 14507, 14501, 14499, 14414,
+		14493, 14356, 14486, 14246, 14477, 14135, 14471, 14047, 14466, 13957, 14459, 13885, 14451, 13804, 14446, 13744,
+		14440, 13677, 14435, 13624, 14429, 13569, 14422, 13516, 14416, 13469, 14411, 13425, 14407, 13386, 14400, 13346,
+		14395, 13305, 14390, 13233, 14384, 13163, 14379, 13104, 14374, 13044, 14369, 12984, 14365, 12932, 14360, 12879,
+		14355, 12829, 14350, 12781, 14345, 12734, 14341, 12691, 14336, 12648, 14326, 12605, 14317, 12563, 14310, 12532,
+		14300, 12494, 14290, 12457, 14282, 12422, 14274, 12390, 14266, 12361, 14258, 12332, 14251, 12305, 14240, 12256,
+		14231, 12204, 14225, 12155, 14217, 12103, 14210, 12051, 14201, 12002, 14193, 11960, 14184, 11912, 14176, 11868,
+		14171, 11829, 14164, 11791, 14155, 11744, 14148, 11708, 14140, 11673, 14132, 11634, 14125, 11600, 14120, 11571,
+		14112, 11533, 14105, 11501, 14098, 11468, 14090, 11439, 14084, 11412, 14076, 11381, 14069, 11351, 14063, 11327,
+		14057, 11299, 14050, 11272, 14044, 11233, 14037, 11185, 14031, 11137, 14023, 11086, 14017, 11041, 14011, 10997,
+		14005, 10955, 13998, 10911, 13992, 10872, 13986, 10830, 13980, 10794, 13974, 10759, 13967, 10719, 13962, 10685,
+		13956, 10649, 13950, 10615, 13943, 10581, 13937, 10546, 13933, 10518, 13927, 10486, 13921, 10454, 13915, 10425,
+		13910, 10397, 13904, 10368, 13898, 10341, 13893, 10313, 13886, 10285, 13881, 10261, 13876, 10236, 13870, 10183,
+		13864, 10131, 13859, 10086, 13855, 10044, 13849, 9998, 13844, 9956, 13838, 9910, 13833, 9871, 13828, 9831,
+		13824, 9797, 13818, 9752, 13812, 9711, 13807, 9674, 13802, 9639, 13797, 9604, 13793, 9573, 13788, 9537,
+		13782, 9501, 13777, 9470, 13773, 9443, 13768, 9409, 13763, 9378, 13759, 9351, 13754, 9321, 13750, 9295,
+		13745, 9268, 13740, 9241, 13735, 9209, 13730, 9159, 13726, 9106, 13722, 9062, 13718, 9016, 13713, 8969,
+		13707, 8918, 13702, 8873, 13698, 8828, 13694, 8791, 13689, 8746, 13686, 8708, 13681, 8663, 13677, 8627,
+		13672, 8589, 13667, 8548, 13664, 8514, 13660, 8480, 13656, 8447, 13652, 8416, 13647, 8381, 13643, 8347,
+		13639, 8316, 13635, 8283, 13630, 8252, 13627, 8226, 13622, 8194, 13619, 8142, 13614, 8088, 13610, 8032,
+		13606, 7982, 13603, 7930, 13599, 7879, 13595, 7834, 13590, 7781, 13587, 7737, 13583, 7695, 13578, 7644,
+		13575, 7606, 13572, 7561, 13568, 7520, 13564, 7483, 13560, 7442, 13557, 7405, 13553, 7365, 13549, 7328,
+		13545, 7294, 13541, 7257, 13538, 7226, 13534, 7192, 13530, 7147, 13527, 7089, 13524, 7027, 13520, 6968,
+		13516, 6908, 13513, 6849, 13509, 6797, 13506, 6742, 13503, 6691, 13499, 6639, 13495, 6586, 13492, 6536,
+		13488, 6486, 13485, 6444, 13483, 6401, 13479, 6358, 13475, 6312, 13472, 6274, 13469, 6233, 13466, 6191,
+		13462, 6156, 13459, 6090, 13456, 6018, 13452, 5945, 13449, 5878, 13446, 5816, 13443, 5749, 13440, 5689,
+		13437, 5626, 13433, 5567, 13430, 5507, 13427, 5451, 13424, 5398, 13421, 5346, 13418, 5293, 13415, 5245,
+		13412, 5195, 13408, 5148, 13406, 5088, 13402, 5000, 13400, 4917, 13397, 4833, 13394, 4755, 13390, 4676,
+		13388, 4603, 13385, 4524, 13382, 4460, 13378, 4389, 13376, 4328, 13373, 4260, 13370, 4203, 13367, 4139,
+		13365, 4077, 13361, 3962, 13359, 3862, 13356, 3758, 13354, 3658, 13351, 3568, 13348, 3471, 13345, 3386,
+		13343, 3301, 13340, 3219, 13337, 3138, 13334, 3060, 13331, 2912, 13329, 2778, 13326, 2643, 13324, 2516,
+		13321, 2399, 13318, 2281, 13316, 2168, 13313, 2064, 13309, 1873, 13304, 1685, 13299, 1500, 13293, 1325,
+		14555, 15537, 14546, 15252, 14537, 14993, 14528, 14819, 14520, 14692, 14510, 14575, 14503, 14487, 14495, 14403,
+		14489, 14342, 14482, 14226, 14473, 14113, 14467, 14026, 14461, 13940, 14454, 13862, 14447, 13787, 14441, 13725,
+		14436, 13662, 14430, 13604, 14423, 13554, 14417, 13503, 14412, 13457, 14407, 13414, 14402, 13371, 14396, 13333,
+		14389, 13279, 14384, 13208, 14379, 13142, 14375, 13082, 14369, 13022, 14364, 12963, 14360, 12909, 14355, 12860,
+		14350, 12808, 14344, 12758, 14340, 12715, 14335, 12671, 14327, 12632, 14316, 12590, 14306, 12545, 14298, 12512,
+		14289, 12478, 14280, 12440, 14272, 12407, 14263, 12376, 14255, 12346, 14247, 12315, 14240, 12289, 14230, 12239,
+		14221, 12177, 14215, 12132, 14207, 12077, 14199, 12028, 14190, 11980, 14182, 11937, 14173, 11895, 14166, 11846,
+		14160, 11807, 14154, 11773, 14146, 11730, 14136, 11687, 14130, 11655, 14122, 11619, 14114, 11580, 14108, 11548,
+		14102, 11518, 14095, 11484, 14086, 11452, 14079, 11422, 14073, 11395, 14065, 11366, 14059, 11339, 14053, 11310,
+		14047, 11286, 14040, 11254, 14033, 11207, 14026, 11158, 14019, 11110, 14012, 11064, 14007, 11021, 14000, 10973,
+		13994, 10932, 13989, 10894, 13982, 10850, 13975, 10811, 13968, 10770, 13963, 10737, 13956, 10698, 13950, 10660,
+		13944, 10627, 13939, 10597, 13933, 10562, 13927, 10529, 13922, 10498, 13917, 10468, 13911, 10438, 13904, 10408,
+		13898, 10379, 13892, 10351, 13887, 10324, 13882, 10299, 13876, 10273, 13870, 10244, 13865, 10202, 13860, 10159,
+		13855, 10111, 13849, 10061, 13844, 10018, 13839, 9976, 13833, 9929, 13828, 9891, 13822, 9845, 13818, 9807,
+		13813, 9767, 13807, 9734, 13802, 9694, 13797, 9656, 13791, 9619, 13787, 9587, 13783, 9552, 13778, 9521,
+		13773, 9488, 13767, 9454, 13762, 9422, 13759, 9396, 13754, 9365, 13749, 9335, 13744, 9307, 13738, 9277,
+		13734, 9252, 13730, 9226, 13725, 9184, 13720, 9131, 13717, 9088, 13710, 9029, 13706, 8986, 13702, 8942,
+		13698, 8898, 13693, 8852, 13688, 8810, 13684, 8766, 13679, 8723, 13676, 8685, 13672, 8648, 13666, 8607,
+		13662, 8571, 13659, 8536, 13654, 8496, 13649, 8461, 13645, 8426, 13641, 8393, 13637, 8362, 13633, 8333,
+		13630, 8302, 13626, 8273, 13621, 8241, 13618, 8211, 13613, 8177, 13609, 8121, 13605, 8065, 13601, 8009,
+		13598, 7958, 13593, 7908, 13589, 7861, 13585, 7808, 13582, 7767, 13578, 7717, 13573, 7672, 13571, 7632,
+		13566, 7586, 13563, 7548, 13558, 7505, 13555, 7463, 13551, 7428, 13548, 7388, 13544, 7351, 13540, 7315,
+		13536, 7278, 13533, 7249, 13529, 7214, 13526, 7179, 13522, 7127, 13519, 7063, 13515, 7007, 13511, 6947,
+		13508, 6889, 13505, 6831, 13501, 6775, 13498, 6727, 13494, 6672, 13491, 6622, 13487, 6574, 13484, 6523,
+		13481, 6479, 13478, 6432, 13474, 6389, 13470, 6343, 13467, 6303, 13464, 6263, 13461, 6221, 13457, 6183,
+		13454, 6142, 13451, 6074, 13447, 5999, 13445, 5932, 13442, 5866, 13438, 5796, 13435, 5735, 13432, 5671,
+		13429, 5612, 13425, 5550, 13422, 5497, 13419, 5441, 13416, 5387, 13414, 5335, 13410, 5284, 13407, 5234,
+		13404, 5188, 13401, 5142, 13398, 5068, 13396, 4990, 13392, 4898, 13389, 4821, 13386, 4740, 13384, 4668,
+		13380, 4591, 13377, 4519, 13374, 4447, 13372, 4384, 13369, 4318, 13366, 4257, 13363, 4192, 13360, 4137,
+		13358, 4063, 13355, 3955, 13352, 3849, 13349, 3748, 13346, 3654, 13344, 3556, 13341, 3466, 13339, 3379,
+		13335, 3293, 13333, 3212, 13330, 3137, 13328, 3058, 13325, 2909, 13322, 2769, 13319, 2641, 13317, 2514,
+		13315, 2395, 13312, 2278, 13307, 2168, 13301, 2060, 13296, 1874, 13291, 1683, 13286, 1501, 13281, 1326,
+		14552, 15524, 14543, 15239, 14533, 14980, 14524, 14799, 14516, 14679, 14505, 14562, 14499, 14475, 14491, 14393,
+		14484, 14330, 14477, 14206, 14469, 14096, 14463, 14007, 14457, 13926, 14450, 13848, 14443, 13771, 14437, 13709,
+		14432, 13650, 14425, 13591, 14418, 13540, 14413, 13488, 14407, 13442, 14402, 13400, 14397, 13358, 14390, 13319,
+		14385, 13254, 14380, 13186, 14375, 13122, 14369, 13057, 14365, 13000, 14359, 12943, 14354, 12888, 14350, 12843,
+		14345, 12789, 14339, 12742, 14335, 12699, 14325, 12652, 14315, 12615, 14306, 12573, 14297, 12533, 14287, 12494,
+		14280, 12465, 14271, 12428, 14263, 12395, 14252, 12361, 14244, 12331, 14236, 12301, 14227, 12261, 14219, 12210,
+		14211, 12153, 14204, 12103, 14198, 12058, 14187, 12004, 14179, 11958, 14171, 11911, 14164, 11873, 14157, 11830,
+		14149, 11785, 14142, 11747, 14135, 11711, 14126, 11669, 14119, 11634, 14112, 11601, 14105, 11567, 14098, 11532,
+		14092, 11503, 14083, 11469, 14076, 11437, 14068, 11406, 14062, 11379, 14056, 11352, 14049, 11324, 14043, 11297,
+		14036, 11272, 14029, 11229, 14022, 11175, 14014, 11128, 14008, 11083, 14002, 11037, 13997, 10996, 13991, 10954,
+		13983, 10908, 13977, 10868, 13971, 10830, 13964, 10789, 13958, 10750, 13952, 10711, 13948, 10684, 13941, 10645,
+		13934, 10607, 13928, 10575, 13923, 10545, 13918, 10513, 13911, 10480, 13906, 10451, 13900, 10423, 13893, 10391,
+		13888, 10365, 13882, 10337, 13876, 10308, 13871, 10283, 13866, 10259, 13861, 10230, 13855, 10177, 13850, 10130,
+		13845, 10088, 13839, 10037, 13833, 9993, 13828, 9950, 13823, 9909, 13818, 9867, 13813, 9829, 13807, 9785,
+		13802, 9747, 13796, 9706, 13792, 9676, 13787, 9639, 13782, 9602, 13778, 9569, 13773, 9535, 13768, 9503,
+		13763, 9472, 13758, 9441, 13753, 9407, 13748, 9375, 13744, 9350, 13739, 9320, 13734, 9293, 13729, 9265,
+		13724, 9237, 13719, 9201, 13716, 9159, 13711, 9108, 13706, 9060, 13702, 9015, 13697, 8961, 13692, 8916,
+		13688, 8875, 13684, 8832, 13680, 8790, 13675, 8748, 13671, 8708, 13666, 8665, 13661, 8626, 13658, 8593,
+		13654, 8554, 13650, 8519, 13645, 8485, 13641, 8449, 13636, 8412, 13632, 8380, 13628, 8347, 13624, 8316,
+		13619, 8285, 13616, 8255, 13612, 8227, 13608, 8198, 13604, 8150, 13600, 8097, 13596, 8042, 13592, 7988,
+		13588, 7938, 13584, 7885, 13581, 7840, 13576, 7793, 13572, 7743, 13569, 7700, 13566, 7656, 13561, 7612,
+		13557, 7569, 13554, 7532, 13550, 7488, 13546, 7451, 13543, 7410, 13539, 7375, 13535, 7340, 13532, 7301,
+		13528, 7269, 13524, 7232, 13521, 7200, 13518, 7171, 13513, 7102, 13510, 7048, 13507, 6983, 13503, 6924,
+		13500, 6870, 13496, 6811, 13493, 6764, 13489, 6707, 13486, 6658, 13483, 6606, 13479, 6557, 13476, 6510,
+		13472, 6462, 13469, 6421, 13465, 6374, 13463, 6333, 13459, 6291, 13456, 6249, 13453, 6214, 13448, 6168,
+		13446, 6129, 13442, 6048, 13440, 5983, 13437, 5916, 13433, 5849, 13430, 5785, 13427, 5721, 13425, 5662,
+		13421, 5595, 13417, 5538, 13415, 5483, 13412, 5428, 13409, 5375, 13405, 5324, 13403, 5276, 13399, 5226,
+		13397, 5182, 13393, 5132, 13391, 5062, 13387, 4967, 13385, 4888, 13382, 4806, 13379, 4731, 13375, 4648,
+		13374, 4588, 13371, 4510, 13367, 4441, 13365, 4373, 13362, 4311, 13359, 4250, 13357, 4189, 13353, 4129,
+		13351, 4053, 13348, 3945, 13345, 3838, 13343, 3741, 13339, 3640, 13337, 3554, 13334, 3458, 13331, 3370,
+		13329, 3292, 13326, 3209, 13323, 3131, 13321, 3045, 13318, 2902, 13316, 2762, 13313, 2637, 13309, 2513,
+		13304, 2392, 13299, 2276, 13293, 2164, 13288, 2059, 13283, 1874, 13278, 1682, 13273, 1501, 13268, 1327,
+		14548, 15511, 14539, 15216, 14529, 14960, 14520, 14788, 14513, 14666, 14502, 14550, 14495, 14463, 14487, 14384,
+		14480, 14301, 14472, 14182, 14465, 14073, 14459, 13990, 14452, 13905, 14444, 13826, 14438, 13756, 14433, 13693,
+		14428, 13632, 14420, 13576, 14414, 13526, 14407, 13472, 14403, 13431, 14398, 13385, 14392, 13346, 14386, 13304,
+		14380, 13231, 14375, 13166, 14370, 13100, 14365, 13039, 14360, 12981, 14355, 12923, 14350, 12871, 14345, 12822,
+		14340, 12771, 14333, 12724, 14325, 12680, 14316, 12638, 14304, 12593, 14297, 12558, 14288, 12519, 14277, 12478,
+		14270, 12448, 14262, 12416, 14252, 12382, 14242, 12349, 14235, 12320, 14227, 12290, 14216, 12233, 14208, 12179,
+		14203, 12135, 14193, 12075, 14186, 12032, 14178, 11985, 14169, 11936, 14161, 11894, 14153, 11847, 14146, 11809,
+		14139, 11766, 14132, 11727, 14123, 11691, 14116, 11653, 14108, 11615, 14101, 11582, 14095, 11549, 14088, 11514,
+		14079, 11482, 14074, 11456, 14065, 11422, 14058, 11391, 14051, 11361, 14044, 11335, 14039, 11308, 14033, 11283,
+		14024, 11247, 14018, 11202, 14011, 11152, 14004, 11102, 13998, 11058, 13992, 11012, 13986, 10969, 13980, 10929,
+		13974, 10888, 13967, 10846, 13960, 10808, 13954, 10769, 13948, 10732, 13942, 10694, 13935, 10654, 13931, 10629,
+		13924, 10592, 13918, 10557, 13913, 10526, 13907, 10495, 13901, 10465, 13894, 10432, 13889, 10406, 13883, 10376,
+		13878, 10348, 13873, 10325, 13868, 10297, 13861, 10268, 13856, 10245, 13851, 10201, 13845, 10151, 13839, 10101,
+		13834, 10058, 13829, 10016, 13823, 9969, 13818, 9926, 13813, 9885, 13808, 9844, 13803, 9805, 13798, 9768,
+		13793, 9728, 13787, 9690, 13782, 9651, 13778, 9621, 13773, 9585, 13768, 9550, 13762, 9515, 13757, 9486,
+		13752, 9452, 13748, 9423, 13743, 9392, 13738, 9362, 13733, 9330, 13728, 9305, 13724, 9277, 13719, 9251,
+		13715, 9226, 13710, 9181, 13705, 9127, 13701, 9080, 13697, 9035, 13692, 8987, 13689, 8948, 13683, 8896,
+		13679, 8851, 13675, 8810, 13670, 8768, 13666, 8726, 13661, 8689, 13657, 8654, 13653, 8609, 13648, 8572,
+		13644, 8536, 13640, 8499, 13636, 8467, 13632, 8432, 13628, 8400, 13624, 8370, 13620, 8336, 13615, 8303,
+		13611, 8272, 13607, 8242, 13602, 8214, 13599, 8179, 13595, 8126, 13591, 8069, 13587, 8017, 13583, 7966,
+		13579, 7917, 13576, 7869, 13571, 7816, 13567, 7769, 13564, 7728, 13560, 7682, 13557, 7638, 13553, 7598,
+		13548, 7553, 13545, 7511, 13541, 7473, 13537, 7432, 13533, 7396, 13530, 7359, 13526, 7323, 13523, 7289,
+		13519, 7254, 13516, 7223, 13512, 7189, 13508, 7142, 13505, 7083, 13501, 7023, 13499, 6969, 13495, 6906,
+		13491, 6848, 13488, 6796, 13484, 6742, 13481, 6692, 13478, 6640, 13474, 6591, 13471, 6541, 13467, 6492,
+		13464, 6451, 13461, 6407, 13458, 6362, 13455, 6321, 13451, 6278, 13448, 6241, 13444, 6198, 13442, 6163,
+		13438, 6106, 13435, 6038, 13432, 5968, 13429, 5897, 13426, 5835, 13422, 5764, 13420, 5706, 13416, 5644,
+		13413, 5585, 13410, 5528, 13407, 5474, 13404, 5419, 13401, 5365, 13398, 5317, 13395, 5264, 13392, 5219,
+		13389, 5168, 13386, 5127, 13383, 5041, 13381, 4958, 13377, 4874, 13375, 4796, 13371, 4714, 13369, 4643,
+		13366, 4569, 13363, 4498, 13360, 4434, 13357, 4366, 13355, 4303, 13352, 4239, 13349, 4184, 13346, 4121,
+		13343, 4041, 13341, 3930, 13338, 3833, 13335, 3726, 13333, 3633, 13330, 3539, 13328, 3453, 13325, 3371,
+		13322, 3282, 13319, 3203, 13317, 3129, 13314, 3032, 13311, 2894, 13306, 2763, 13302, 2633, 13296, 2505,
+		13290, 2387, 13286, 2272, 13281, 2164, 13275, 2057, 13270, 1873, 13265, 1680, 13261, 1502, 13255, 1328,
+		14545, 15500, 14536, 15199, 14526, 14945, 14517, 14776, 14508, 14653, 14498, 14537, 14492, 14449, 14483, 14373,
+		14476, 14278, 14468, 14164, 14461, 14054, 14455, 13966, 14448, 13887, 14440, 13809, 14435, 13744, 14429, 13679,
+		14424, 13619, 14415, 13559, 14409, 13511, 14403, 13459, 14398, 13417, 14393, 13374, 14387, 13334, 14381, 13280,
+		14376, 13213, 14370, 13142, 14365, 13075, 14360, 13018, 14355, 12960, 14351, 12907, 14345, 12852, 14340, 12799,
+		14333, 12753, 14323, 12703, 14315, 12661, 14306, 12620, 14295, 12576, 14288, 12544, 14278, 12506, 14267, 12466,
+		14259, 12430, 14253, 12403, 14242, 12367, 14234, 12339, 14227, 12308, 14217, 12270, 14207, 12210, 14200, 12159,
+		14192, 12107, 14184, 12054, 14175, 12005, 14168, 11964, 14159, 11915, 14151, 11870, 14144, 11829, 14137, 11791,
+		14130, 11749, 14121, 11707, 14113, 11669, 14107, 11638, 14098, 11598, 14091, 11563, 14085, 11532, 14077, 11498,
+		14069, 11464, 14062, 11436, 14055, 11407, 14049, 11380, 14042, 11349, 14035, 11320, 14029, 11296, 14022, 11269,
+		14014, 11222, 14007, 11170, 14001, 11126, 13994, 11080, 13989, 11035, 13982, 10990, 13976, 10945, 13969, 10904,
+		13964, 10867, 13955, 10823, 13950, 10786, 13944, 10749, 13939, 10712, 13933, 10678, 13926, 10640, 13919, 10603,
+		13915, 10577, 13908, 10540, 13902, 10506, 13896, 10476, 13891, 10448, 13885, 10419, 13878, 10388, 13873, 10361,
+		13867, 10332, 13862, 10306, 13857, 10283, 13852, 10257, 13846, 10221, 13840, 10172, 13835, 10126, 13829, 10078,
+		13823, 10030, 13818, 9986, 13814, 9947, 13809, 9905, 13802, 9860, 13799, 9824, 13793, 9784, 13788, 9744,
+		13783, 9708, 13778, 9672, 13773, 9635, 13767, 9597, 13763, 9565, 13757, 9532, 13752, 9501, 13747, 9466,
+		13743, 9436, 13738, 9403, 13733, 9375, 13729, 9349, 13724, 9320, 13718, 9287, 13714, 9263, 13710, 9237,
+		13706, 9207, 13701, 9160, 13697, 9108, 13691, 9054, 13686, 9007, 13683, 8965, 13678, 8918, 13674, 8876,
+		13669, 8832, 13665, 8787, 13660, 8746, 13655, 8706, 13651, 8667, 13647, 8626, 13644, 8596, 13639, 8553,
+		13634, 8519, 13630, 8484, 13626, 8448, 13622, 8414, 13618, 8381, 13614, 8351, 13610, 8320, 13606, 8289,
+		13602, 8260, 13598, 8232, 13594, 8201, 13590, 8157, 13586, 8097, 13582, 8048, 13578, 7994, 13574, 7942,
+		13570, 7896, 13566, 7845, 13562, 7799, 13559, 7752, 13555, 7706, 13551, 7662, 13547, 7621, 13543, 7579,
+		13539, 7537, 13536, 7493, 13533, 7459, 13529, 7421, 13525, 7382, 13522, 7347, 13518, 7312, 13514, 7274,
+		13511, 7243, 13507, 7209, 13503, 7178, 13501, 7128, 13497, 7062, 13493, 7001, 13490, 6946, 13486, 6887,
+		13483, 6835, 13479, 6778, 13476, 6725, 13473, 6673, 13469, 6622, 13466, 6579, 13462, 6526, 13460, 6485,
+		13456, 6436, 13453, 6396, 13449, 6350, 13446, 6308, 13443, 6271, 13440, 6226, 13437, 6189, 13434, 6152,
+		13430, 6087, 13427, 6022, 13424, 5949, 13421, 5882, 13417, 5814, 13415, 5754, 13411, 5686, 13409, 5632,
+		13406, 5571, 13403, 5514, 13399, 5462, 13396, 5408, 13394, 5356, 13391, 5304, 13388, 5257, 13385, 5208,
+		13382, 5163, 13379, 5114, 13376, 5029, 13373, 4942, 13370, 4864, 13367, 4784, 13364, 4706, 13361, 4631,
+		13358, 4559, 13356, 4490, 13353, 4423, 13351, 4362, 13347, 4292, 13345, 4235, 13342, 4172, 13340, 4119,
+		13336, 4026, 13334, 3923, 13331, 3821, 13329, 3726, 13326, 3621, 13323, 3536, 13321, 3447, 13317, 3358,
+		13315, 3280, 13313, 3201, 13308, 3124, 13303, 3026, 13298, 2890, 13293, 2757, 13288, 2623, 13283, 2502,
+		13277, 2385, 13272, 2268, 13267, 2161, 13262, 2059, 13257, 1870, 13252, 1679, 13248, 1502, 13243, 1328,
+		14542, 15493, 14532, 15185, 14522, 14932, 14514, 14764, 14505, 14641, 14494, 14524, 14488, 14438, 14480, 14362,
+		14472, 14255, 14465, 14149, 14457, 14035, 14451, 13948, 14444, 13872, 14436, 13790, 14431, 13725, 14425, 13660,
+		14419, 13601, 14412, 13546, 14405, 13495, 14400, 13448, 14394, 13403, 14389, 13361, 14383, 13322, 14376, 13259,
+		14371, 13187, 14366, 13121, 14361, 13058, 14356, 12996, 14351, 12941, 14346, 12884, 14341, 12836, 14335, 12783,
+		14323, 12735, 14315, 12689, 14306, 12644, 14296, 12605, 14286, 12563, 14278, 12526, 14269, 12492, 14260, 12456,
+		14250, 12416, 14243, 12389, 14233, 12357, 14224, 12323, 14217, 12296, 14207, 12247, 14198, 12189, 14189, 12133,
+		14182, 12080, 14174, 12033, 14165, 11982, 14158, 11940, 14149, 11897, 14142, 11851, 14134, 11807, 14126, 11766,
+		14120, 11732, 14110, 11690, 14103, 11649, 14096, 11617, 14090, 11585, 14082, 11546, 14074, 11513, 14067, 11483,
+		14059, 11449, 14052, 11419, 14045, 11392, 14038, 11363, 14033, 11336, 14026, 11308, 14018, 11281, 14011, 11248,
+		14004, 11196, 13997, 11148, 13991, 11103, 13985, 11056, 13980, 11013, 13973, 10971, 13966, 10924, 13959, 10882,
+		13952, 10842, 13946, 10805, 13940, 10763, 13934, 10725, 13929, 10694, 13922, 10658, 13916, 10623, 13910, 10588,
+		13903, 10553, 13899, 10526, 13893, 10492, 13886, 10459, 13878, 10426, 13874, 10401, 13870, 10375, 13863, 10345,
+		13858, 10320, 13852, 10291, 13847, 10265, 13841, 10242, 13836, 10195, 13830, 10141, 13825, 10097, 13819, 10055,
+		13814, 10009, 13809, 9962, 13804, 9922, 13799, 9883, 13794, 9842, 13788, 9800, 13783, 9764, 13778, 9724,
+		13772, 9686, 13768, 9651, 13762, 9614, 13758, 9582, 13752, 9545, 13747, 9514, 13742, 9481, 13738, 9452,
+		13733, 9419, 13729, 9391, 13724, 9360, 13718, 9330, 13714, 9305, 13710, 9278, 13705, 9249, 13700, 9223,
+		13695, 9177, 13691, 9128, 13687, 9082, 13682, 9036, 13677, 8986, 13673, 8940, 13668, 8896, 13664, 8850,
+		13660, 8808, 13655, 8769, 13651, 8726, 13646, 8685, 13642, 8647, 13638, 8608, 13633, 8570, 13630, 8538,
+		13626, 8502, 13621, 8468, 13617, 8433, 13613, 8399, 13608, 8365, 13604, 8334, 13600, 8302, 13596, 8275,
+		13592, 8242, 13589, 8218, 13584, 8182, 13581, 8131, 13577, 8077, 13573, 8025, 13568, 7973, 13565, 7921,
+		13561, 7872, 13557, 7826, 13554, 7781, 13550, 7732, 13546, 7691, 13542, 7643, 13538, 7602, 13535, 7560,
+		13531, 7520, 13528, 7482, 13523, 7442, 13520, 7405, 13517, 7370, 13514, 7333, 13510, 7298, 13506, 7263,
+		13502, 7230, 13499, 7197, 13495, 7164, 13491, 7099, 13488, 7043, 13484, 6978, 13481, 6923, 13478, 6868,
+		13475, 6812, 13472, 6762, 13467, 6705, 13465, 6660, 13461, 6607, 13458, 6561, 13455, 6515, 13451, 6466,
+		13448, 6423, 13445, 6380, 13441, 6336, 13438, 6295, 13435, 6255, 13432, 6219, 13428, 6178, 13425, 6138,
+		13422, 6066, 13419, 5999, 13417, 5932, 13413, 5864, 13410, 5800, 13407, 5738, 13404, 5677, 13401, 5617,
+		13397, 5557, 13395, 5504, 13392, 5445, 13390, 5398, 13386, 5344, 13383, 5296, 13380, 5243, 13378, 5201,
+		13374, 5152, 13371, 5098, 13368, 5011, 13365, 4925, 13363, 4851, 13360, 4771, 13357, 4694, 13354, 4620,
+		13352, 4551, 13349, 4481, 13346, 4413, 13343, 4348, 13341, 4290, 13338, 4224, 13335, 4168, 13332, 4108,
+		13330, 4022, 13327, 3911, 13324, 3811, 13321, 3713, 13318, 3613, 13316, 3528, 13313, 3437, 13311, 3356,
+		13305, 3273, 13300, 3195, 13294, 3116, 13290, 3023, 13284, 2882, 13279, 2750, 13274, 2619, 13269, 2496,
+		13264, 2380, 13259, 2266, 13255, 2162, 13249, 2057, 13244, 1866, 13239, 1674, 13234, 1498, 13230, 1328,
+		14538, 15476, 14529, 15168, 14519, 14920, 14511, 14751, 14501, 14624, 14491, 14510, 14484, 14429, 14475, 14351,
+		14468, 14237, 14460, 14130, 14452, 14017, 14448, 13935, 14440, 13857, 14432, 13775, 14426, 13709, 14420, 13642,
+		14414, 13590, 14407, 13531, 14401, 13482, 14395, 13437, 14390, 13391, 14385, 13351, 14378, 13308, 14372, 13234,
+		14367, 13165, 14362, 13098, 14356, 13037, 14351, 12974, 14346, 12920, 14341, 12866, 14336, 12814, 14324, 12762,
+		14315, 12717, 14306, 12673, 14296, 12629, 14286, 12590, 14277, 12550, 14267, 12508, 14258, 12474, 14250, 12441,
+		14241, 12405, 14231, 12370, 14223, 12341, 14215, 12310, 14206, 12275, 14197, 12223, 14190, 12172, 14180, 12110,
+		14174, 12061, 14165, 12016, 14155, 11962, 14146, 11915, 14139, 11874, 14133, 11832, 14124, 11789, 14117, 11747,
+		14109, 11712, 14100, 11671, 14093, 11633, 14085, 11597, 14079, 11565, 14071, 11530, 14064, 11496, 14057, 11468,
+		14049, 11436, 14041, 11402, 14035, 11375, 14029, 11349, 14022, 11320, 14016, 11295, 14007, 11266, 14001, 11218,
+		13994, 11173, 13988, 11125, 13982, 11076, 13976, 11034, 13969, 10990, 13962, 10945, 13956, 10905, 13949, 10860,
+		13942, 10819, 13936, 10782, 13931, 10747, 13924, 10706, 13918, 10672, 13912, 10639, 13907, 10605, 13900, 10569,
+		13893, 10534, 13889, 10506, 13883, 10476, 13876, 10446, 13870, 10415, 13864, 10384, 13859, 10358, 13854, 10331,
+		13848, 10304, 13842, 10278, 13837, 10252, 13831, 10214, 13826, 10170, 13820, 10119, 13814, 10070, 13809, 10023,
+		13805, 9988, 13799, 9941, 13794, 9899, 13789, 9857, 13783, 9818, 13778, 9780, 13773, 9741, 13769, 9705,
+		13763, 9667, 13757, 9629, 13753, 9596, 13747, 9562, 13743, 9531, 13738, 9495, 13733, 9465, 13729, 9433,
+		13725, 9405, 13719, 9375, 13714, 9346, 13709, 9315, 13704, 9288, 13701, 9263, 13696, 9237, 13690, 9198,
+		13686, 9152, 13681, 9101, 13676, 9051, 13672, 9007, 13669, 8967, 13663, 8916, 13659, 8874, 13655, 8831,
+		13650, 8787, 13646, 8746, 13642, 8710, 13637, 8667, 13634, 8630, 13629, 8594, 13625, 8555, 13620, 8516,
+		13616, 8485, 13613, 8451, 13609, 8420, 13605, 8387, 13601, 8356, 13596, 8321, 13591, 8291, 13587, 8260,
+		13583, 8231, 13579, 8201, 13576, 8158, 13571, 8102, 13567, 8051, 13564, 8001, 13560, 7949, 13556, 7900,
+		13553, 7852, 13549, 7805, 13545, 7761, 13541, 7712, 13537, 7670, 13534, 7628, 13530, 7584, 13526, 7542,
+		13522, 7503, 13519, 7465, 13515, 7426, 13512, 7392, 13508, 7353, 13505, 7320, 13501, 7284, 13497, 7250,
+		13494, 7220, 13490, 7184, 13487, 7136, 13483, 7078, 13480, 7016, 13476, 6960, 13473, 6903, 13470, 6853,
+		13466, 6795, 13463, 6741, 13460, 6690, 13456, 6641, 13452, 6591, 13450, 6546, 13447, 6497, 13443, 6452,
+		13440, 6409, 13437, 6368, 13434, 6326, 13430, 6283, 13427, 6245, 13424, 6205, 13421, 6169, 13418, 6122,
+		13415, 6049, 13411, 5982, 13408, 5909, 13405, 5848, 13402, 5781, 13400, 5722, 13396, 5665, 13393, 5601,
+		13390, 5548, 13388, 5491, 13384, 5436, 13381, 5381, 13378, 5334, 13376, 5283, 13372, 5235, 13370, 5189,
+		13366, 5143, 13364, 5081, 13361, 4993, 13359, 4916, 13355, 4832, 13353, 4758, 13350, 4681, 13347, 4612,
+		13344, 4537, 13341, 4471, 13339, 4404, 13336, 4339, 13333, 4279, 13331, 4222, 13327, 4159, 13325, 4103,
+		13323, 4004, 13320, 3900, 13317, 3798, 13314, 3704, 13312, 3611, 13307, 3516, 13302, 3434, 13295, 3344,
+		13291, 3266, 13286, 3189, 13281, 3114, 13276, 3016, 13271, 2877, 13265, 2739, 13261, 2616, 13256, 2493,
+		13251, 2376, 13246, 2263, 13241, 2156, 13236, 2054, 13231, 1862, 13226, 1675, 13221, 1498, 13217, 1328,
+		14535, 15466, 14526, 15154, 14516, 14911, 14507, 14740, 14498, 14608, 14488, 14499, 14480, 14416, 14471, 14337,
+		14465, 14218, 14457, 14112, 14449, 14003, 14444, 13920, 14437, 13839, 14428, 13759, 14422, 13696, 14416, 13627,
+		14410, 13576, 14402, 13515, 14397, 13470, 14391, 13425, 14386, 13378, 14381, 13340, 14373, 13285, 14368, 13208,
+		14362, 13143, 14357, 13080, 14352, 13020, 14346, 12954, 14342, 12904, 14336, 12847, 14326, 12792, 14315, 12749,
+		14306, 12700, 14297, 12655, 14288, 12613, 14278, 12573, 14269, 12535, 14258, 12493, 14249, 12461, 14241, 12426,
+		14232, 12391, 14221, 12356, 14214, 12329, 14206, 12297, 14196, 12248, 14186, 12192, 14179, 12140, 14172, 12090,
+		14163, 12038, 14154, 11985, 14146, 11943, 14137, 11895, 14131, 11854, 14122, 11811, 14115, 11770, 14107, 11727,
+		14098, 11688, 14092, 11657, 14083, 11616, 14075, 11577, 14068, 11545, 14063, 11516, 14054, 11479, 14046, 11449,
+		14040, 11421, 14032, 11391, 14024, 11358, 14020, 11335, 14013, 11307, 14005, 11280, 13997, 11242, 13990, 11190,
+		13984, 11145, 13979, 11101, 13972, 11053, 13965, 11005, 13959, 10964, 13952, 10922, 13945, 10879, 13938, 10840,
+		13932, 10800, 13927, 10760, 13921, 10726, 13915, 10689, 13908, 10651, 13902, 10618, 13896, 10585, 13891, 10554,
+		13885, 10520, 13878, 10486, 13872, 10459, 13867, 10431, 13861, 10400, 13855, 10371, 13850, 10342, 13844, 10318,
+		13838, 10289, 13833, 10264, 13827, 10240, 13822, 10187, 13816, 10141, 13811, 10098, 13806, 10051, 13801, 10005,
+		13794, 9957, 13790, 9922, 13785, 9877, 13779, 9838, 13773, 9795, 13768, 9758, 13764, 9719, 13758, 9684,
+		13754, 9650, 13748, 9612, 13743, 9576, 13738, 9545, 13734, 9512, 13730, 9482, 13724, 9447, 13719, 9418,
+		13713, 9387, 13708, 9358, 13704, 9330, 13700, 9303, 13695, 9273, 13690, 9247, 13686, 9222, 13682, 9180,
+		13676, 9122, 13672, 9079, 13668, 9033, 13663, 8983, 13658, 8936, 13655, 8897, 13651, 8853, 13646, 8811,
+		13641, 8770, 13637, 8725, 13632, 8684, 13629, 8650, 13625, 8613, 13620, 8575, 13616, 8541, 13612, 8503,
+		13608, 8467, 13604, 8434, 13599, 8400, 13595, 8369, 13591, 8340, 13587, 8310, 13583, 8280, 13579, 8249,
+		13576, 8220, 13571, 8188, 13567, 8137, 13563, 8082, 13559, 8025, 13555, 7976, 13551, 7926, 13547, 7877,
+		13544, 7833, 13540, 7785, 13536, 7738, 13532, 7696, 13529, 7651, 13525, 7608, 13522, 7569, 13518, 7528,
+		13514, 7487, 13510, 7451, 13506, 7412, 13503, 7375, 13500, 7341, 13496, 7305, 13492, 7268, 13489, 7238,
+		13486, 7206, 13482, 7174, 13478, 7115, 13475, 7057, 13472, 7000, 13469, 6943, 13465, 6886, 13462, 6831,
+		13458, 6776, 13455, 6727, 13451, 6672, 13448, 6627, 13445, 6579, 13442, 6528, 13438, 6486, 13434, 6435,
+		13432, 6396, 13429, 6354, 13426, 6313, 13422, 6275, 13419, 6232, 13416, 6197, 13413, 6155, 13410, 6098,
+		13407, 6031, 13403, 5961, 13401, 5895, 13398, 5830, 13394, 5766, 13391, 5705, 13389, 5649, 13386, 5590,
+		13383, 5532, 13380, 5480, 13376, 5422, 13374, 5372, 13371, 5321, 13368, 5274, 13365, 5225, 13362, 5179,
+		13359, 5135, 13356, 5063, 13354, 4985, 13350, 4896, 13348, 4820, 13345, 4741, 13343, 4672, 13339, 4596,
+		13337, 4530, 13335, 4461, 13332, 4395, 13329, 4331, 13326, 4271, 13323, 4211, 13321, 4152, 13318, 4099,
+		13315, 3993, 13313, 3893, 13308, 3790, 13303, 3694, 13297, 3596, 13293, 3511, 13287, 3421, 13283, 3340,
+		13278, 3265, 13272, 3182, 13267, 3110, 13263, 3009, 13258, 2871, 13252, 2733, 13248, 2611, 13242, 2488,
+		13237, 2371, 13233, 2263, 13227, 2152, 13223, 2052, 13218, 1857, 13213, 1676, 13208, 1496, 13204, 1328,
+		14532, 15454, 14523, 15143, 14513, 14895, 14503, 14725, 14494, 14594, 14484, 14485, 14477, 14404, 14468, 14317,
+		14461, 14200, 14452, 14091, 14445, 13986, 14440, 13905, 14432, 13826, 14424, 13743, 14418, 13677, 14413, 13615,
+		14406, 13561, 14398, 13504, 14392, 13455, 14388, 13414, 14382, 13365, 14376, 13325, 14370, 13269, 14364, 13187,
+		14358, 13120, 14353, 13058, 14348, 12997, 14343, 12937, 14337, 12881, 14327, 12826, 14318, 12775, 14307, 12731,
+		14298, 12685, 14289, 12641, 14278, 12599, 14268, 12555, 14259, 12520, 14249, 12480, 14239, 12441, 14231, 12408,
+		14223, 12381, 14213, 12344, 14204, 12312, 14196, 12282, 14186, 12221, 14177, 12168, 14169, 12114, 14164, 12069,
+		14153, 12014, 14146, 11970, 14137, 11925, 14128, 11877, 14120, 11831, 14113, 11791, 14105, 11749, 14097, 11709,
+		14089, 11671, 14081, 11636, 14074, 11598, 14066, 11563, 14060, 11530, 14052, 11500, 14045, 11466, 14036, 11433,
+		14030, 11404, 14024, 11378, 14016, 11347, 14010, 11318, 14002, 11294, 13995, 11267, 13989, 11219, 13981, 11168,
+		13975, 11118, 13969, 11074, 13962, 11029, 13955, 10985, 13948, 10939, 13942, 10897, 13935, 10859, 13930, 10820,
+		13924, 10780, 13918, 10744, 13911, 10703, 13905, 10670, 13898, 10633, 13892, 10598, 13886, 10564, 13881, 10534,
+		13875, 10504, 13868, 10471, 13861, 10437, 13857, 10414, 13852, 10387, 13846, 10356, 13839, 10327, 13834, 10300,
+		13829, 10276, 13822, 10249, 13818, 10211, 13811, 10162, 13806, 10112, 13802, 10070, 13796, 10025, 13790, 9981,
+		13785, 9936, 13779, 9891, 13774, 9854, 13768, 9813, 13764, 9778, 13759, 9736, 13753, 9698, 13748, 9661,
+		13743, 9627, 13739, 9596, 13734, 9561, 13729, 9526, 13724, 9495, 13720, 9463, 13715, 9433, 13709, 9400,
+		13704, 9372, 13699, 9341, 13695, 9313, 13691, 9288, 13686, 9261, 13681, 9234, 13677, 9202, 13672, 9151,
+		13668, 9102, 13663, 9051, 13659, 9011, 13655, 8964, 13650, 8915, 13645, 8871, 13641, 8830, 13635, 8785,
+		13632, 8750, 13628, 8708, 13623, 8668, 13619, 8626, 13615, 8592, 13610, 8557, 13606, 8517, 13603, 8487,
+		13598, 8453, 13594, 8418, 13589, 8384, 13585, 8351, 13581, 8319, 13577, 8290, 13573, 8262, 13570, 8233,
+		13566, 8204, 13562, 8168, 13558, 8108, 13554, 8059, 13551, 8007, 13547, 7954, 13543, 7907, 13539, 7859,
+		13535, 7811, 13531, 7767, 13528, 7721, 13524, 7675, 13520, 7635, 13516, 7592, 13512, 7551, 13509, 7512,
+		13506, 7473, 13502, 7436, 13498, 7398, 13495, 7361, 13491, 7327, 13488, 7293, 13484, 7258, 13481, 7225,
+		13477, 7193, 13474, 7156, 13470, 7095, 13467, 7037, 13464, 6977, 13460, 6920, 13457, 6864, 13453, 6812,
+		13450, 6760, 13446, 6706, 13444, 6659, 13440, 6605, 13436, 6561, 13433, 6513, 13430, 6469, 13427, 6427,
+		13424, 6381, 13421, 6341, 13418, 6302, 13414, 6259, 13412, 6224, 13408, 6183, 13405, 6148, 13402, 6082,
+		13399, 6012, 13396, 5947, 13393, 5877, 13390, 5816, 13386, 5751, 13384, 5690, 13381, 5633, 13377, 5570,
+		13375, 5518, 13371, 5462, 13368, 5409, 13366, 5361, 13363, 5314, 13360, 5263, 13357, 5216, 13355, 5171,
+		13351, 5124, 13349, 5050, 13345, 4957, 13344, 4885, 13341, 4804, 13337, 4729, 13335, 4653, 13333, 4591,
+		13330, 4516, 13327, 4449, 13324, 4384, 13322, 4321, 13319, 4263, 13316, 4203, 13314, 4148, 13310, 4085,
+		13305, 3982, 13300, 3880, 13294, 3779, 13289, 3681, 13285, 3599, 13279, 3501, 13274, 3420, 13268, 3335,
+		13262, 3251, 13257, 3175, 13253, 3105, 13248, 2996, 13244, 2857, 13239, 2730, 13234, 2606, 13229, 2486,
+		13224, 2367, 13219, 2258, 13214, 2150, 13209, 2049, 13205, 1856, 13200, 1676, 13195, 1494, 13191, 1327,
+		14529, 15444, 14520, 15126, 14510, 14878, 14500, 14711, 14491, 14580, 14480, 14473, 14473, 14395, 14465, 14300,
+		14457, 14182, 14449, 14076, 14442, 13973, 14436, 13890, 14428, 13804, 14421, 13729, 14414, 13661, 14409, 13605,
+		14401, 13548, 14395, 13492, 14388, 13442, 14384, 13402, 14378, 13355, 14372, 13314, 14365, 13240, 14360, 13172,
+		14354, 13098, 14349, 13039, 14343, 12976, 14338, 12918, 14330, 12862, 14318, 12807, 14309, 12760, 14298, 12710,
+		14289, 12668, 14279, 12624, 14268, 12581, 14259, 12539, 14250, 12503, 14241, 12468, 14230, 12427, 14223, 12397,
+		14212, 12364, 14204, 12332, 14196, 12300, 14186, 12260, 14176, 12197, 14167, 12141, 14160, 12090, 14153, 12041,
+		14144, 11993, 14135, 11945, 14127, 11902, 14120, 11857, 14110, 11810, 14104, 11771, 14096, 11732, 14088, 11693,
+		14080, 11653, 14072, 11616, 14065, 11587, 14057, 11546, 14050, 11511, 14042, 11481, 14035, 11452, 14027, 11419,
+		14020, 11389, 14014, 11361, 14008, 11333, 13999, 11304, 13992, 11277, 13986, 11246, 13979, 11193, 13973, 11147,
+		13966, 11095, 13959, 11049, 13952, 11006, 13946, 10962, 13939, 10919, 13932, 10879, 13926, 10835, 13920, 10798,
+		13914, 10760, 13908, 10721, 13901, 10684, 13894, 10648, 13889, 10617, 13882, 10580, 13876, 10546, 13871, 10515,
+		13865, 10485, 13859, 10455, 13853, 10425, 13847, 10393, 13841, 10367, 13836, 10342, 13830, 10313, 13824, 10286,
+		13819, 10260, 13814, 10237, 13808, 10183, 13802, 10137, 13797, 10088, 13791, 10040, 13786, 10001, 13781, 9958,
+		13775, 9915, 13769, 9871, 13764, 9828, 13760, 9793, 13755, 9754, 13750, 9719, 13744, 9680, 13739, 9643,
+		13734, 9608, 13729, 9572, 13725, 9545, 13720, 9509, 13715, 9477, 13710, 9445, 13704, 9415, 13700, 9386,
+		13695, 9355, 13691, 9329, 13686, 9300, 13681, 9271, 13677, 9246, 13672, 9222, 13668, 9177, 13664, 9128,
+		13659, 9075, 13654, 9030, 13649, 8981, 13646, 8940, 13640, 8894, 13636, 8848, 13630, 8804, 13627, 8767,
+		13622, 8722, 13618, 8684, 13615, 8652, 13611, 8614, 13605, 8571, 13602, 8538, 13597, 8501, 13593, 8465,
+		13589, 8435, 13585, 8403, 13581, 8372, 13577, 8340, 13573, 8307, 13568, 8275, 13565, 8247, 13560, 8219,
+		13556, 8186, 13552, 8136, 13549, 8086, 13545, 8026, 13542, 7984, 13538, 7935, 13533, 7882, 13530, 7837,
+		13526, 7790, 13522, 7744, 13519, 7704, 13515, 7658, 13511, 7616, 13507, 7573, 13504, 7534, 13501, 7497,
+		13497, 7458, 13493, 7419, 13489, 7382, 13486, 7349, 13482, 7310, 13479, 7278, 13476, 7246, 13472, 7212,
+		13469, 7182, 13465, 7130, 13461, 7069, 13459, 7014, 13455, 6957, 13451, 6899, 13448, 6847, 13444, 6789,
+		13442, 6741, 13439, 6691, 13435, 6640, 13431, 6592, 13429, 6546, 13426, 6499, 13422, 6455, 13419, 6411,
+		13416, 6368, 13413, 6329, 13409, 6286, 13407, 6249, 13403, 6210, 13400, 6173, 13397, 6133, 13394, 6058,
+		13391, 5992, 13388, 5920, 13385, 5858, 13382, 5796, 13379, 5737, 13376, 5675, 13373, 5617, 13370, 5561,
+		13367, 5504, 13364, 5450, 13362, 5400, 13358, 5348, 13355, 5301, 13353, 5251, 13351, 5210, 13347, 5159,
+		13345, 5120, 13342, 5029, 13339, 4948, 13336, 4868, 13333, 4787, 13331, 4714, 13328, 4646, 13325, 4572,
+		13323, 4508, 13320, 4441, 13317, 4377, 13314, 4313, 13311, 4251, 13306, 4196, 13301, 4138, 13296, 4076,
+		13289, 3962, 13286, 3870, 13280, 3768, 13275, 3675, 13269, 3580, 13265, 3498, 13260, 3408, 13255, 3329,
+		13251, 3251, 13245, 3173, 13240, 3100, 13235, 2983, 13230, 2853, 13225, 2724, 13220, 2598, 13216, 2481,
+		13211, 2363, 13206, 2255, 13201, 2147, 13196, 2045, 13192, 1854, 13187, 1673, 13182, 1491, 13178, 1327,
+		14526, 15435, 14516, 15108, 14506, 14861, 14497, 14700, 14487, 14568, 14477, 14465, 14470, 14386, 14462, 14285,
+		14454, 14162, 14445, 14054, 14439, 13956, 14432, 13871, 14423, 13786, 14416, 13710, 14411, 13648, 14405, 13591,
+		14397, 13534, 14391, 13481, 14385, 13430, 14380, 13389, 14374, 13345, 14367, 13294, 14361, 13218, 14356, 13152,
+		14350, 13081, 14344, 13018, 14339, 12956, 14332, 12898, 14320, 12843, 14312, 12794, 14299, 12742, 14289, 12691,
+		14281, 12651, 14272, 12611, 14259, 12564, 14250, 12524, 14242, 12490, 14231, 12452, 14222, 12415, 14214, 12383,
+		14203, 12349, 14195, 12320, 14187, 12289, 14177, 12234, 14167, 12177, 14159, 12116, 14151, 12066, 14143, 12017,
+		14135, 11974, 14126, 11924, 14117, 11879, 14110, 11837, 14102, 11792, 14095, 11751, 14086, 11712, 14078, 11673,
+		14071, 11637, 14062, 11598, 14056, 11564, 14048, 11530, 14040, 11496, 14032, 11463, 14026, 11438, 14019, 11407,
+		14012, 11376, 14005, 11346, 13998, 11319, 13990, 11292, 13982, 11264, 13977, 11219, 13969, 11168, 13962, 11117,
+		13957, 11071, 13949, 11022, 13942, 10979, 13936, 10937, 13929, 10895, 13923, 10854, 13917, 10816, 13911, 10776,
+		13905, 10741, 13899, 10705, 13891, 10664, 13884, 10628, 13880, 10599, 13874, 10566, 13867, 10529, 13861, 10497,
+		13855, 10468, 13849, 10438, 13843, 10407, 13838, 10380, 13832, 10350, 13827, 10327, 13821, 10299, 13815, 10274,
+		13809, 10247, 13803, 10203, 13799, 10162, 13793, 10110, 13788, 10068, 13782, 10019, 13776, 9972, 13771, 9933,
+		13766, 9892, 13761, 9853, 13756, 9811, 13751, 9770, 13745, 9734, 13740, 9696, 13736, 9662, 13731, 9627,
+		13725, 9590, 13720, 9555, 13715, 9521, 13711, 9495, 13705, 9459, 13700, 9429, 13695, 9398, 13691, 9369,
+		13687, 9341, 13682, 9313, 13677, 9285, 13672, 9258, 13667, 9231, 13662, 9197, 13659, 9149, 13654, 9100,
+		13649, 9052, 13644, 9003, 13640, 8958, 13635, 8909, 13631, 8872, 13626, 8827, 13623, 8787, 13618, 8747,
+		13614, 8707, 13610, 8666, 13605, 8625, 13601, 8593, 13598, 8560, 13593, 8521, 13589, 8487, 13584, 8453,
+		13580, 8415, 13577, 8388, 13572, 8355, 13569, 8326, 13565, 8293, 13562, 8269, 13556, 8236, 13552, 8208,
+		13549, 8170, 13545, 8113, 13540, 8057, 13537, 8011, 13532, 7954, 13528, 7908, 13525, 7862, 13521, 7815,
+		13517, 7768, 13514, 7725, 13510, 7682, 13506, 7639, 13503, 7598, 13500, 7558, 13496, 7516, 13492, 7480,
+		13488, 7440, 13485, 7404, 13481, 7367, 13478, 7331, 13475, 7299, 13471, 7265, 13467, 7232, 13464, 7200,
+		13461, 7169, 13458, 7111, 13455, 7057, 13450, 6989, 13446, 6933, 13443, 6878, 13441, 6827, 13437, 6775,
+		13433, 6721, 13430, 6669, 13427, 6625, 13424, 6576, 13421, 6528, 13418, 6488, 13414, 6440, 13411, 6400,
+		13408, 6354, 13405, 6314, 13402, 6278, 13399, 6236, 13396, 6201, 13392, 6162, 13389, 6106, 13386, 6042,
+		13383, 5972, 13380, 5904, 13377, 5842, 13374, 5779, 13371, 5721, 13368, 5657, 13365, 5603, 13363, 5546,
+		13360, 5496, 13357, 5441, 13354, 5389, 13352, 5340, 13348, 5290, 13346, 5244, 13342, 5195, 13340, 5154,
+		13337, 5098, 13335, 5021, 13331, 4932, 13328, 4853, 13326, 4774, 13323, 4702, 13320, 4630, 13318, 4562,
+		13315, 4495, 13312, 4428, 13307, 4367, 13303, 4303, 13298, 4247, 13291, 4185, 13287, 4134, 13281, 4054,
+		13277, 3955, 13271, 3850, 13266, 3762, 13261, 3664, 13257, 3576, 13252, 3487, 13246, 3400, 13242, 3324,
+		13235, 3239, 13231, 3166, 13226, 3093, 13221, 2975, 13216, 2845, 13212, 2716, 13206, 2588, 13202, 2471,
+		13198, 2359, 13192, 2249, 13188, 2145, 13182, 2036, 13177, 1847, 13173, 1667, 13169, 1490, 13164, 1326,
+		14524, 15428, 14513, 15093, 14502, 14844, 14493, 14683, 14483, 14553, 14474, 14454, 14466, 14371, 14459, 14266,
+		14450, 14138, 14442, 14035, 14435, 13938, 14428, 13852, 14419, 13767, 14414, 13701, 14408, 13635, 14402, 13579,
+		14393, 13517, 14387, 13468, 14381, 13418, 14375, 13375, 14370, 13333, 14363, 13272, 14357, 13201, 14352, 13128,
+		14346, 13059, 14340, 12996, 14334, 12937, 14323, 12877, 14311, 12824, 14304, 12777, 14291, 12727, 14281, 12678,
+		14273, 12637, 14262, 12593, 14251, 12550, 14242, 12509, 14231, 12471, 14223, 12439, 14214, 12405, 14202, 12366,
+		14195, 12337, 14187, 12307, 14178, 12266, 14167, 12206, 14159, 12156, 14151, 12099, 14143, 12045, 14133, 11995,
+		14125, 11948, 14116, 11901, 14109, 11858, 14101, 11816, 14094, 11775, 14085, 11733, 14077, 11695, 14069, 11656,
+		14061, 11619, 14053, 11581, 14047, 11548, 14040, 11519, 14032, 11482, 14023, 11448, 14016, 11419, 14009, 11392,
+		14001, 11359, 13995, 11330, 13988, 11304, 13980, 11278, 13973, 11237, 13966, 11187, 13960, 11143, 13953, 11092,
+		13947, 11047, 13940, 11002, 13933, 10956, 13926, 10915, 13920, 10875, 13913, 10833, 13908, 10794, 13901, 10755,
+		13895, 10718, 13888, 10682, 13882, 10650, 13876, 10611, 13870, 10576, 13865, 10547, 13860, 10518, 13852, 10481,
+		13845, 10452, 13839, 10420, 13834, 10391, 13828, 10364, 13822, 10336, 13817, 10311, 13812, 10285, 13806, 10261,
+		13800, 10231, 13794, 10176, 13789, 10129, 13784, 10088, 13778, 10038, 13774, 10001, 13767, 9951, 13761, 9905,
+		13757, 9868, 13752, 9829, 13747, 9791, 13741, 9750, 13736, 9712, 13731, 9678, 13725, 9639, 13721, 9607,
+		13717, 9573, 13711, 9539, 13706, 9505, 13701, 9473, 13696, 9447, 13691, 9414, 13687, 9386, 13682, 9353,
+		13678, 9326, 13672, 9298, 13667, 9270, 13663, 9245, 13658, 9219, 13653, 9167, 13649, 9121, 13644, 9070,
+		13640, 9024, 13636, 8984, 13631, 8937, 13626, 8891, 13622, 8846, 13618, 8808, 13614, 8767, 13609, 8724,
+		13605, 8686, 13601, 8650, 13596, 8608, 13592, 8571, 13589, 8538, 13584, 8505, 13580, 8471, 13576, 8435,
+		13572, 8406, 13567, 8368, 13564, 8339, 13559, 8306, 13555, 8279, 13551, 8249, 13548, 8226, 13544, 8194,
+		13541, 8145, 13536, 8091, 13532, 8041, 13528, 7987, 13524, 7938, 13521, 7890, 13517, 7841, 13513, 7793,
+		13509, 7752, 13505, 7703, 13501, 7662, 13498, 7620, 13494, 7577, 13491, 7541, 13487, 7501, 13483, 7462,
+		13480, 7425, 13476, 7387, 13473, 7353, 13470, 7319, 13466, 7286, 13462, 7249, 13459, 7219, 13455, 7187,
+		13452, 7145, 13449, 7088, 13445, 7024, 13442, 6971, 13439, 6913, 13435, 6858, 13432, 6806, 13429, 6755,
+		13425, 6702, 13422, 6658, 13419, 6604, 13416, 6561, 13413, 6513, 13409, 6470, 13406, 6428, 13403, 6383,
+		13400, 6344, 13397, 6303, 13394, 6263, 13391, 6227, 13387, 6186, 13384, 6151, 13381, 6088, 13379, 6018,
+		13376, 5958, 13373, 5887, 13370, 5827, 13367, 5764, 13363, 5701, 13361, 5648, 13358, 5584, 13355, 5531,
+		13352, 5479, 13349, 5426, 13347, 5377, 13344, 5327, 13341, 5281, 13338, 5233, 13336, 5192, 13332, 5143,
+		13329, 5083, 13326, 4995, 13324, 4921, 13322, 4842, 13319, 4765, 13316, 4690, 13313, 4615, 13310, 4551,
+		13304, 4484, 13298, 4417, 13294, 4355, 13289, 4300, 13282, 4235, 13277, 4180, 13272, 4122, 13268, 4051,
+		13261, 3937, 13257, 3844, 13252, 3745, 13247, 3655, 13242, 3563, 13236, 3476, 13232, 3394, 13227, 3313,
+		13223, 3239, 13218, 3163, 13213, 3088, 13208, 2970, 13203, 2836, 13198, 2706, 13193, 2582, 13188, 2466,
+		13184, 2357, 13179, 2244, 13174, 2141, 13170, 2038, 13165, 1848, 13160, 1662, 13155, 1488, 13151, 1325,
+		14521, 15419, 14511, 15074, 14499, 14831, 14490, 14671, 14480, 14539, 14470, 14444, 14463, 14360, 14456, 14251,
+		14448, 14124, 14438, 14017, 14432, 13923, 14424, 13834, 14416, 13754, 14410, 13688, 14404, 13619, 14397, 13563,
+		14390, 13504, 14384, 13458, 14377, 13405, 14371, 13360, 14366, 13321, 14359, 13245, 14353, 13174, 14347, 13107,
+		14342, 13040, 14336, 12975, 14327, 12923, 14316, 12863, 14303, 12806, 14294, 12758, 14284, 12713, 14275, 12665,
+		14263, 12616, 14251, 12574, 14243, 12537, 14234, 12497, 14222, 12456, 14214, 12423, 14206, 12391, 14194, 12354,
+		14187, 12326, 14179, 12295, 14168, 12241, 14159, 12190, 14152, 12135, 14144, 12084, 14135, 12026, 14125, 11974,
+		14116, 11928, 14108, 11884, 14099, 11837, 14092, 11795, 14085, 11756, 14076, 11714, 14068, 11674, 14060, 11638,
+		14052, 11601, 14045, 11565, 14037, 11529, 14029, 11497, 14023, 11469, 14014, 11434, 14006, 11402, 14000, 11375,
+		13994, 11348, 13986, 11318, 13978, 11290, 13971, 11265, 13965, 11217, 13957, 11162, 13951, 11117, 13945, 11071,
+		13938, 11027, 13930, 10980, 13924, 10936, 13917, 10895, 13911, 10854, 13906, 10815, 13898, 10773, 13893, 10738,
+		13884, 10697, 13879, 10663, 13873, 10628, 13868, 10599, 13863, 10564, 13855, 10527, 13849, 10498, 13843, 10468,
+		13836, 10435, 13831, 10408, 13825, 10376, 13820, 10352, 13813, 10321, 13808, 10296, 13802, 10271, 13797, 10246,
+		13791, 10203, 13786, 10156, 13780, 10103, 13774, 10059, 13769, 10018, 13763, 9968, 13759, 9933, 13753, 9886,
+		13748, 9843, 13743, 9806, 13737, 9767, 13732, 9733, 13727, 9693, 13721, 9655, 13716, 9621, 13712, 9584,
+		13706, 9553, 13702, 9520, 13697, 9490, 13691, 9455, 13687, 9425, 13682, 9398, 13679, 9369, 13674, 9344,
+		13668, 9311, 13663, 9283, 13658, 9256, 13653, 9230, 13649, 9193, 13645, 9147, 13640, 9095, 13635, 9046,
+		13631, 9001, 13626, 8954, 13623, 8913, 13618, 8874, 13614, 8830, 13609, 8785, 13605, 8743, 13601, 8707,
+		13596, 8666, 13592, 8629, 13589, 8596, 13584, 8555, 13579, 8518, 13574, 8482, 13571, 8452, 13567, 8417,
+		13563, 8389, 13559, 8357, 13555, 8324, 13550, 8294, 13546, 8264, 13542, 8234, 13538, 8205, 13535, 8174,
+		13530, 8113, 13527, 8063, 13523, 8015, 13520, 7965, 13516, 7915, 13512, 7868, 13509, 7822, 13505, 7774,
+		13501, 7730, 13497, 7689, 13493, 7642, 13490, 7603, 13487, 7564, 13482, 7521, 13478, 7484, 13475, 7447,
+		13471, 7408, 13469, 7377, 13465, 7338, 13461, 7304, 13458, 7272, 13455, 7239, 13450, 7204, 13448, 7177,
+		13444, 7121, 13440, 7061, 13438, 7007, 13435, 6951, 13431, 6893, 13428, 6842, 13424, 6788, 13421, 6738,
+		13418, 6688, 13415, 6638, 13411, 6592, 13407, 6543, 13404, 6499, 13402, 6456, 13398, 6411, 13396, 6372,
+		13392, 6329, 13389, 6289, 13386, 6253, 13384, 6215, 13380, 6177, 13377, 6140, 13374, 6069, 13371, 6004,
+		13368, 5935, 13365, 5873, 13362, 5808, 13359, 5747, 13357, 5690, 13353, 5630, 13350, 5576, 13347, 5518,
+		13344, 5464, 13342, 5416, 13339, 5363, 13336, 5317, 13333, 5266, 13331, 5226, 13327, 5175, 13325, 5136,
+		13322, 5065, 13320, 4984, 13317, 4901, 13314, 4825, 13311, 4750, 13305, 4676, 13300, 4608, 13293, 4533,
+		13289, 4473, 13284, 4406, 13278, 4344, 13273, 4285, 13269, 4231, 13263, 4169, 13258, 4117, 13252, 4028,
+		13249, 3936, 13243, 3828, 13238, 3735, 13233, 3645, 13228, 3554, 13224, 3471, 13218, 3385, 13213, 3308,
+		13207, 3228, 13203, 3154, 13198, 3083, 13194, 2958, 13189, 2829, 13184, 2702, 13180, 2578, 13174, 2460,
+		13170, 2349, 13165, 2242, 13161, 2139, 13157, 2035, 13152, 1845, 13147, 1662, 13142, 1487, 13138, 1323,
+		14518, 15406, 14508, 15059, 14497, 14819, 14488, 14655, 14477, 14529, 14468, 14434, 14460, 14350, 14452, 14228,
+		14444, 14105, 14435, 13996, 14429, 13906, 14421, 13819, 14412, 13739, 14407, 13674, 14401, 13610, 14393, 13547,
+		14386, 13492, 14380, 13444, 14373, 13394, 14368, 13348, 14362, 13309, 14355, 13222, 14350, 13156, 14344, 13090,
+		14338, 13023, 14329, 12956, 14319, 12903, 14307, 12844, 14296, 12790, 14285, 12741, 14275, 12694, 14267, 12651,
+		14254, 12599, 14243, 12558, 14236, 12522, 14225, 12481, 14214, 12444, 14206, 12410, 14197, 12378, 14187, 12344,
+		14178, 12311, 14169, 12276, 14159, 12217, 14150, 12159, 14144, 12111, 14135, 12060, 14125, 12007, 14117, 11959,
+		14107, 11909, 14099, 11865, 14091, 11818, 14084, 11776, 14076, 11737, 14067, 11697, 14059, 11655, 14050, 11621,
+		14043, 11584, 14036, 11550, 14028, 11514, 14020, 11480, 14013, 11453, 14006, 11422, 13998, 11390, 13991, 11358,
+		13985, 11334, 13977, 11306, 13969, 11279, 13963, 11240, 13955, 11190, 13948, 11139, 13942, 11090, 13935, 11044,
+		13928, 11000, 13921, 10956, 13915, 10913, 13908, 10871, 13902, 10832, 13896, 10794, 13890, 10756, 13882, 10716,
+		13876, 10681, 13870, 10643, 13864, 10608, 13859, 10577, 13852, 10545, 13846, 10511, 13839, 10478, 13833, 10451,
+		13828, 10421, 13821, 10389, 13816, 10364, 13810, 10334, 13806, 10311, 13798, 10281, 13793, 10256, 13787, 10222,
+		13782, 10175, 13776, 10127, 13771, 10082, 13765, 10032, 13760, 9991, 13755, 9949, 13750, 9905, 13745, 9868,
+		13739, 9825, 13733, 9783, 13728, 9746, 13723, 9708, 13718, 9676, 13713, 9638, 13709, 9605, 13703, 9569,
+		13697, 9532, 13693, 9503, 13688, 9471, 13683, 9442, 13678, 9409, 13674, 9380, 13669, 9352, 13664, 9325,
+		13659, 9299, 13654, 9270, 13649, 9243, 13645, 9215, 13640, 9166, 13636, 9121, 13632, 9076, 13626, 9023,
+		13622, 8977, 13618, 8932, 13613, 8886, 13609, 8848, 13605, 8810, 13601, 8767, 13595, 8721, 13591, 8684,
+		13587, 8644, 13583, 8609, 13579, 8573, 13575, 8539, 13570, 8504, 13566, 8469, 13562, 8432, 13558, 8402,
+		13554, 8369, 13550, 8339, 13547, 8311, 13543, 8284, 13538, 8251, 13535, 8224, 13530, 8195, 13526, 8142,
+		13522, 8090, 13518, 8035, 13514, 7985, 13511, 7941, 13507, 7892, 13503, 7844, 13499, 7798, 13496, 7756,
+		13492, 7708, 13489, 7667, 13485, 7626, 13481, 7585, 13478, 7545, 13474, 7507, 13471, 7466, 13467, 7432,
+		13464, 7396, 13460, 7359, 13456, 7324, 13453, 7291, 13449, 7255, 13446, 7227, 13443, 7195, 13439, 7158,
+		13436, 7104, 13433, 7040, 13429, 6981, 13426, 6927, 13423, 6876, 13419, 6817, 13416, 6771, 13413, 6716,
+		13410, 6671, 13406, 6620, 13403, 6573, 13400, 6529, 13397, 6487, 13393, 6438, 13390, 6397, 13387, 6357,
+		13385, 6318, 13382, 6280, 13378, 6238, 13375, 6201, 13372, 6165, 13369, 6117, 13367, 6051, 13362, 5973,
+		13360, 5914, 13357, 5853, 13354, 5788, 13352, 5732, 13348, 5670, 13345, 5614, 13343, 5558, 13340, 5505,
+		13337, 5453, 13334, 5402, 13331, 5353, 13329, 5304, 13326, 5259, 13323, 5211, 13320, 5168, 13318, 5125,
+		13315, 5047, 13312, 4964, 13306, 4888, 13302, 4813, 13296, 4736, 13291, 4666, 13285, 4591, 13281, 4529,
+		13274, 4457, 13270, 4399, 13264, 4335, 13260, 4277, 13254, 4219, 13249, 4165, 13244, 4108, 13239, 4018,
+		13234, 3916, 13228, 3818, 13224, 3723, 13220, 3635, 13213, 3546, 13208, 3458, 13204, 3381, 13199, 3297,
+		13195, 3224, 13190, 3152, 13185, 3079, 13181, 2955, 13175, 2819, 13171, 2692, 13166, 2571, 13162, 2458,
+		13157, 2344, 13152, 2235, 13147, 2133, 13143, 2030, 13138, 1837, 13133, 1654, 13129, 1487, 13125, 1322,
+		14515, 15397, 14505, 15040, 14494, 14803, 14484, 14644, 14474, 14516, 14465, 14424, 14456, 14340, 14448, 14207,
+		14440, 14084, 14432, 13977, 14426, 13891, 14417, 13802, 14409, 13729, 14403, 13660, 14397, 13593, 14389, 13533,
+		14382, 13478, 14376, 13431, 14370, 13383, 14364, 13337, 14358, 13287, 14351, 13203, 14345, 13132, 14340, 13072,
+		14332, 13004, 14321, 12939, 14310, 12881, 14299, 12829, 14290, 12775, 14276, 12721, 14268, 12680, 14258, 12634,
+		14245, 12585, 14236, 12545, 14227, 12507, 14217, 12470, 14207, 12432, 14197, 12394, 14188, 12364, 14180, 12333,
+		14172, 12301, 14161, 12256, 14150, 12194, 14142, 12135, 14134, 12084, 14127, 12040, 14118, 11988, 14108, 11939,
+		14099, 11889, 14091, 11844, 14083, 11802, 14075, 11758, 14066, 11714, 14059, 11683, 14050, 11640, 14041, 11601,
+		14035, 11568, 14028, 11534, 14020, 11501, 14011, 11467, 14004, 11434, 13997, 11409, 13989, 11376, 13982, 11343,
+		13975, 11316, 13967, 11293, 13960, 11261, 13953, 11215, 13946, 11164, 13940, 11115, 13933, 11069, 13925, 11021,
+		13919, 10976, 13913, 10934, 13906, 10893, 13900, 10851, 13893, 10809, 13886, 10770, 13879, 10733, 13874, 10699,
+		13867, 10662, 13861, 10625, 13855, 10590, 13849, 10556, 13843, 10528, 13836, 10494, 13829, 10461, 13825, 10435,
+		13819, 10407, 13813, 10377, 13807, 10347, 13802, 10322, 13795, 10293, 13790, 10270, 13784, 10243, 13777, 10192,
+		13772, 10146, 13767, 10100, 13762, 10058, 13757, 10013, 13751, 9965, 13746, 9925, 13741, 9884, 13735, 9843,
+		13729, 9804, 13724, 9765, 13719, 9723, 13713, 9687, 13708, 9650, 13704, 9619, 13699, 9584, 13695, 9555,
+		13690, 9519, 13684, 9486, 13678, 9454, 13674, 9423, 13669, 9395, 13665, 9364, 13659, 9334, 13654, 9309,
+		13650, 9282, 13646, 9259, 13641, 9229, 13636, 9189, 13631, 9139, 13627, 9091, 13623, 9049, 13619, 9003,
+		13614, 8958, 13609, 8910, 13605, 8867, 13600, 8822, 13596, 8781, 13591, 8745, 13588, 8709, 13583, 8665,
+		13579, 8627, 13574, 8589, 13570, 8553, 13565, 8518, 13563, 8490, 13558, 8454, 13554, 8419, 13551, 8389,
+		13546, 8357, 13542, 8324, 13537, 8295, 13534, 8268, 13530, 8239, 13526, 8210, 13523, 8181, 13518, 8124,
+		13515, 8071, 13511, 8020, 13507, 7969, 13502, 7914, 13499, 7869, 13495, 7825, 13491, 7776, 13487, 7733,
+		13485, 7695, 13480, 7646, 13477, 7609, 13473, 7568, 13470, 7528, 13466, 7488, 13462, 7454, 13459, 7413,
+		13456, 7380, 13452, 7345, 13449, 7313, 13445, 7278, 13442, 7248, 13438, 7210, 13435, 7183, 13431, 7136,
+		13428, 7077, 13425, 7018, 13421, 6962, 13418, 6903, 13415, 6854, 13411, 6801, 13408, 6748, 13405, 6700,
+		13401, 6651, 13399, 6606, 13396, 6559, 13392, 6513, 13389, 6469, 13386, 6428, 13382, 6382, 13380, 6343,
+		13377, 6303, 13373, 6263, 13370, 6228, 13367, 6189, 13365, 6155, 13361, 6097, 13358, 6023, 13355, 5964,
+		13352, 5894, 13350, 5838, 13347, 5776, 13344, 5715, 13341, 5659, 13338, 5598, 13335, 5545, 13332, 5490,
+		13329, 5440, 13327, 5391, 13324, 5340, 13321, 5294, 13318, 5246, 13316, 5205, 13313, 5157, 13308, 5112,
+		13303, 5029, 13297, 4948, 13293, 4873, 13286, 4791, 13282, 4725, 13276, 4650, 13271, 4585, 13265, 4512,
+		13260, 4450, 13255, 4386, 13250, 4326, 13244, 4268, 13240, 4210, 13235, 4155, 13229, 4099, 13225, 4006,
+		13220, 3904, 13215, 3808, 13209, 3710, 13204, 3622, 13200, 3533, 13195, 3450, 13189, 3365, 13185, 3289,
+		13180, 3217, 13175, 3140, 13171, 3073, 13166, 2942, 13162, 2811, 13157, 2684, 13152, 2567, 13148, 2451,
+		13143, 2340, 13139, 2236, 13133, 2128, 13129, 2018, 13124, 1828, 13120, 1652, 13116, 1484, 13111, 1320,
+		14513, 15389, 14502, 15019, 14491, 14792, 14481, 14635, 14471, 14505, 14462, 14416, 14453, 14326, 14445, 14187,
+		14436, 14069, 14429, 13963, 14423, 13876, 14414, 13788, 14406, 13715, 14399, 13645, 14394, 13580, 14385, 13520,
+		14379, 13469, 14372, 13418, 14367, 13372, 14361, 13328, 14354, 13261, 14347, 13186, 14342, 13113, 14336, 13050,
+		14324, 12981, 14313, 12918, 14303, 12863, 14291, 12814, 14282, 12761, 14268, 12705, 14261, 12663, 14249, 12615,
+		14237, 12571, 14228, 12528, 14219, 12492, 14210, 12458, 14199, 12419, 14189, 12381, 14179, 12349, 14172, 12321,
+		14162, 12287, 14152, 12230, 14141, 12171, 14134, 12113, 14126, 12059, 14116, 12009, 14108, 11964, 14099, 11918,
+		14090, 11870, 14083, 11827, 14075, 11783, 14066, 11740, 14058, 11701, 14049, 11658, 14040, 11624, 14034, 11585,
+		14026, 11551, 14019, 11518, 14011, 11486, 14003, 11451, 13995, 11421, 13988, 11392, 13981, 11363, 13974, 11333,
+		13966, 11303, 13959, 11279, 13952, 11240, 13944, 11187, 13938, 11141, 13932, 11094, 13924, 11046, 13918, 11004,
+		13911, 10959, 13904, 10913, 13897, 10873, 13891, 10828, 13884, 10790, 13878, 10753, 13871, 10717, 13864, 10677,
+		13859, 10644, 13853, 10610, 13846, 10572, 13840, 10539, 13833, 10508, 13828, 10481, 13821, 10447, 13815, 10414,
+		13809, 10388, 13806, 10365, 13800, 10337, 13792, 10307, 13787, 10281, 13780, 10253, 13775, 10221, 13770, 10171,
+		13764, 10121, 13758, 10076, 13753, 10031, 13748, 9989, 13743, 9948, 13737, 9901, 13731, 9859, 13726, 9820,
+		13721, 9782, 13716, 9748, 13710, 9708, 13705, 9670, 13701, 9635, 13695, 9599, 13690, 9566, 13685, 9532,
+		13680, 9504, 13675, 9470, 13670, 9436, 13665, 9406, 13660, 9378, 13656, 9353, 13651, 9321, 13646, 9294,
+		13641, 9268, 13637, 9240, 13633, 9218, 13628, 9166, 13623, 9117, 13618, 9065, 13613, 9018, 13609, 8976,
+		13605, 8930, 13600, 8887, 13596, 8844, 13591, 8804, 13587, 8760, 13583, 8721, 13579, 8682, 13576, 8651,
+		13571, 8611, 13566, 8575, 13562, 8538, 13558, 8503, 13554, 8467, 13550, 8435, 13546, 8406, 13541, 8373,
+		13537, 8340, 13534, 8314, 13529, 8281, 13525, 8251, 13521, 8224, 13517, 8196, 13512, 8139, 13510, 8097,
+		13506, 8048, 13503, 7995, 13499, 7948, 13495, 7901, 13491, 7849, 13487, 7803, 13484, 7760, 13480, 7717,
+		13476, 7669, 13472, 7633, 13468, 7588, 13465, 7550, 13461, 7511, 13457, 7471, 13454, 7437, 13451, 7402,
+		13447, 7365, 13444, 7331, 13440, 7295, 13437, 7264, 13433, 7229, 13430, 7201, 13426, 7169, 13423, 7108,
+		13420, 7052, 13417, 6996, 13413, 6940, 13410, 6888, 13406, 6831, 13403, 6780, 13400, 6732, 13397, 6682,
+		13394, 6634, 13391, 6590, 13387, 6537, 13384, 6495, 13381, 6452, 13378, 6410, 13375, 6371, 13372, 6330,
+		13369, 6290, 13366, 6253, 13363, 6213, 13360, 6180, 13356, 6144, 13354, 6075, 13351, 6014, 13348, 5941,
+		13345, 5880, 13342, 5816, 13339, 5756, 13337, 5701, 13334, 5642, 13330, 5587, 13327, 5529, 13325, 5476,
+		13322, 5428, 13319, 5376, 13316, 5329, 13314, 5283, 13311, 5239, 13304, 5190, 13299, 5149, 13293, 5094,
+		13288, 5008, 13283, 4934, 13277, 4852, 13272, 4783, 13267, 4705, 13261, 4638, 13256, 4567, 13253, 4509,
+		13246, 4436, 13240, 4375, 13235, 4315, 13231, 4258, 13225, 4202, 13221, 4147, 13216, 4091, 13211, 3988,
+		13205, 3890, 13200, 3793, 13196, 3705, 13191, 3609, 13186, 3529, 13180, 3439, 13176, 3362, 13172, 3285,
+		13167, 3208, 13163, 3142, 13157, 3068, 13152, 2929, 13148, 2799, 13143, 2679, 13138, 2558, 13134, 2444,
+		13130, 2335, 13125, 2227, 13120, 2127, 13116, 2014, 13111, 1825, 13107, 1650, 13103, 1483, 13098, 1318,
+		14510, 15378, 14500, 15007, 14489, 14784, 14478, 14622, 14469, 14498, 14459, 14403, 14450, 14308, 14443, 14176,
+		14434, 14055, 14425, 13946, 14419, 13856, 14411, 13768, 14402, 13701, 14396, 13631, 14391, 13569, 14382, 13508,
+		14375, 13456, 14369, 13407, 14363, 13363, 14358, 13317, 14351, 13242, 14344, 13170, 14338, 13090, 14328, 13023,
+		14316, 12961, 14305, 12900, 14295, 12844, 14284, 12795, 14273, 12741, 14261, 12689, 14251, 12642, 14240, 12597,
+		14230, 12560, 14220, 12514, 14210, 12477, 14201, 12443, 14192, 12408, 14181, 12370, 14171, 12336, 14164, 12307,
+		14153, 12263, 14141, 12198, 14134, 12148, 14125, 12090, 14116, 12033, 14107, 11983, 14099, 11940, 14089, 11889,
+		14082, 11850, 14074, 11806, 14067, 11764, 14057, 11724, 14049, 11681, 14040, 11642, 14033, 11607, 14026, 11571,
+		14019, 11536, 14010, 11502, 14002, 11470, 13994, 11437, 13986, 11404, 13978, 11374, 13974, 11350, 13965, 11319,
+		13957, 11290, 13950, 11262, 13943, 11217, 13935, 11160, 13929, 11113, 13923, 11068, 13915, 11020, 13907, 10976,
+		13902, 10934, 13895, 10891, 13888, 10850, 13882, 10810, 13875, 10769, 13868, 10730, 13862, 10694, 13856, 10660,
+		13850, 10624, 13844, 10589, 13838, 10558, 13830, 10521, 13823, 10489, 13818, 10459, 13814, 10435, 13807, 10402,
+		13800, 10370, 13795, 10344, 13789, 10320, 13783, 10291, 13777, 10265, 13771, 10238, 13766, 10188, 13761, 10147,
+		13755, 10096, 13750, 10052, 13744, 10007, 13738, 9959, 13733, 9921, 13728, 9882, 13722, 9838, 13717, 9799,
+		13711, 9758, 13706, 9722, 13702, 9690, 13697, 9652, 13691, 9615, 13687, 9581, 13681, 9546, 13676, 9516,
+		13671, 9482, 13666, 9454, 13661, 9421, 13656, 9389, 13651, 9361, 13647, 9336, 13643, 9309, 13638, 9281,
+		13633, 9253, 13628, 9228, 13624, 9187, 13618, 9138, 13614, 9092, 13610, 9048, 13605, 8996, 13600, 8947,
+		13596, 8905, 13592, 8865, 13587, 8824, 13583, 8781, 13579, 8744, 13574, 8701, 13570, 8662, 13566, 8626,
+		13562, 8594, 13557, 8556, 13554, 8522, 13549, 8485, 13546, 8454, 13540, 8415, 13536, 8385, 13532, 8355,
+		13528, 8326, 13524, 8292, 13521, 8269, 13517, 8238, 13512, 8209, 13508, 8171, 13505, 8121, 13500, 8061,
+		13497, 8016, 13493, 7970, 13489, 7915, 13485, 7869, 13482, 7829, 13479, 7785, 13475, 7736, 13471, 7698,
+		13467, 7654, 13464, 7613, 13461, 7574, 13457, 7532, 13453, 7492, 13450, 7457, 13446, 7421, 13442, 7385,
+		13439, 7349, 13436, 7316, 13432, 7280, 13429, 7252, 13425, 7219, 13422, 7188, 13419, 7147, 13416, 7092,
+		13412, 7027, 13408, 6971, 13405, 6919, 13402, 6865, 13399, 6815, 13395, 6763, 13392, 6711, 13389, 6664,
+		13386, 6616, 13383, 6572, 13380, 6527, 13376, 6479, 13373, 6438, 13370, 6398, 13367, 6353, 13364, 6318,
+		13361, 6277, 13358, 6240, 13355, 6205, 13352, 6166, 13349, 6121, 13346, 6052, 13344, 5991, 13340, 5924,
+		13337, 5858, 13334, 5796, 13332, 5739, 13328, 5677, 13326, 5626, 13322, 5567, 13320, 5517, 13317, 5464,
+		13314, 5410, 13311, 5364, 13306, 5316, 13301, 5274, 13295, 5225, 13290, 5182, 13284, 5139, 13278, 5070,
+		13273, 4997, 13268, 4914, 13263, 4841, 13257, 4762, 13252, 4696, 13246, 4620, 13243, 4558, 13236, 4490,
+		13231, 4426, 13226, 4364, 13222, 4307, 13216, 4248, 13210, 4190, 13206, 4139, 13201, 4074, 13195, 3973,
+		13191, 3872, 13188, 3788, 13182, 3691, 13177, 3603, 13172, 3514, 13168, 3435, 13162, 3353, 13156, 3275,
+		13153, 3204, 13147, 3129, 13143, 3049, 13138, 2913, 13134, 2795, 13130, 2674, 13125, 2548, 13120, 2437,
+		13115, 2328, 13112, 2226, 13107, 2122, 13102, 2002, 13098, 1823, 13093, 1646, 13089, 1479, 13084, 1316,
+		14508, 15372, 14497, 14995, 14486, 14770, 14475, 14611, 14466, 14486, 14456, 14392, 14447, 14284, 14440, 14157,
+		14430, 14037, 14422, 13929, 14416, 13840, 14407, 13750, 14399, 13685, 14393, 13615, 14387, 13555, 14378, 13495,
+		14371, 13443, 14365, 13394, 14360, 13352, 14354, 13295, 14346, 13218, 14341, 13151, 14333, 13074, 14320, 13001,
+		14310, 12945, 14299, 12886, 14287, 12825, 14277, 12774, 14264, 12725, 14254, 12675, 14243, 12626, 14232, 12584,
+		14223, 12544, 14213, 12501, 14203, 12465, 14193, 12428, 14184, 12395, 14173, 12358, 14164, 12322, 14156, 12293,
+		14144, 12239, 14133, 12173, 14127, 12126, 14118, 12072, 14109, 12017, 14098, 11963, 14090, 11920, 14081, 11874,
+		14073, 11825, 14065, 11782, 14058, 11744, 14049, 11704, 14040, 11661, 14031, 11627, 14025, 11589, 14018, 11556,
+		14009, 11519, 14002, 11487, 13993, 11453, 13986, 11424, 13977, 11389, 13971, 11360, 13964, 11334, 13957, 11309,
+		13948, 11278, 13941, 11237, 13934, 11189, 13928, 11141, 13921, 11090, 13913, 11044, 13906, 10999, 13900, 10954,
+		13893, 10911, 13887, 10872, 13880, 10829, 13873, 10789, 13866, 10751, 13860, 10714, 13853, 10673, 13847, 10640,
+		13841, 10605, 13835, 10573, 13829, 10541, 13821, 10508, 13815, 10474, 13810, 10444, 13804, 10415, 13798, 10388,
+		13793, 10359, 13786, 10329, 13780, 10304, 13775, 10280, 13769, 10252, 13763, 10215, 13758, 10164, 13752, 10119,
+		13747, 10075, 13741, 10027, 13736, 9985, 13730, 9941, 13724, 9894, 13718, 9856, 13714, 9820, 13709, 9780,
+		13703, 9741, 13698, 9702, 13693, 9667, 13688, 9635, 13683, 9598, 13677, 9563, 13672, 9530, 13667, 9496,
+		13662, 9467, 13658, 9434, 13654, 9409, 13648, 9378, 13642, 9344, 13638, 9318, 13633, 9292, 13630, 9267,
+		13624, 9240, 13620, 9213, 13614, 9163, 13609, 9108, 13605, 9062, 13601, 9017, 13597, 8977, 13593, 8930,
+		13587, 8881, 13583, 8842, 13579, 8801, 13575, 8763, 13571, 8722, 13567, 8684, 13562, 8646, 13557, 8606,
+		13552, 8568, 13549, 8538, 13545, 8500, 13541, 8466, 13536, 8436, 13532, 8405, 13528, 8370, 13524, 8339,
+		13520, 8310, 13516, 8281, 13512, 8249, 13508, 8225, 13505, 8199, 13501, 8150, 13497, 8098, 13494, 8052,
+		13489, 7995, 13485, 7944, 13481, 7899, 13477, 7850, 13474, 7802, 13470, 7763, 13466, 7717, 13462, 7671,
+		13460, 7636, 13456, 7594, 13452, 7556, 13448, 7516, 13445, 7478, 13441, 7439, 13438, 7406, 13435, 7372,
+		13431, 7335, 13427, 7300, 13425, 7273, 13421, 7235, 13418, 7206, 13414, 7177, 13410, 7117, 13406, 7061,
+		13404, 7011, 13401, 6948, 13397, 6899, 13394, 6845, 13390, 6791, 13388, 6743, 13385, 6696, 13381, 6645,
+		13378, 6599, 13375, 6556, 13371, 6508, 13369, 6468, 13366, 6424, 13363, 6384, 13360, 6345, 13356, 6301,
+		13354, 6266, 13351, 6230, 13348, 6193, 13344, 6157, 13341, 6097, 13338, 6030, 13336, 5970, 13332, 5899,
+		13330, 5842, 13327, 5781, 13324, 5721, 13321, 5667, 13318, 5608, 13315, 5554, 13313, 5501, 13307, 5449,
+		13301, 5400, 13296, 5350, 13291, 5306, 13285, 5256, 13280, 5215, 13274, 5168, 13269, 5128, 13264, 5059,
+		13259, 4972, 13253, 4900, 13248, 4820, 13242, 4751, 13237, 4676, 13233, 4615, 13227, 4542, 13222, 4479,
+		13218, 4418, 13211, 4353, 13206, 4296, 13201, 4237, 13198, 4185, 13191, 4127, 13187, 4068, 13182, 3956,
+		13177, 3865, 13172, 3766, 13168, 3684, 13163, 3590, 13158, 3509, 13152, 3422, 13148, 3344, 13144, 3271,
+		13138, 3192, 13134, 3126, 13129, 3039, 13124, 2905, 13120, 2783, 13116, 2660, 13110, 2540, 13106, 2429,
+		13102, 2322, 13098, 2219, 13093, 2119, 13088, 1991, 13084, 1817, 13080, 1645, 13076, 1479, 13071, 1314,
+		14505, 15364, 14494, 14974, 14483, 14754, 14472, 14598, 14464, 14475, 14453, 14383, 14444, 14264, 14437, 14139,
+		14427, 14019, 14419, 13917, 14413, 13826, 14403, 13736, 14396, 13667, 14390, 13601, 14384, 13543, 14375, 13481,
+		14369, 13432, 14362, 13382, 14356, 13339, 14350, 13276, 14343, 13199, 14337, 13127, 14326, 13055, 14312, 12983,
+		14302, 12928, 14292, 12870, 14279, 12808, 14269, 12756, 14257, 12709, 14248, 12663, 14236, 12612, 14225, 12570,
+		14215, 12529, 14206, 12491, 14195, 12451, 14185, 12414, 14176, 12381, 14165, 12347, 14156, 12312, 14146, 12269,
+		14135, 12213, 14126, 12156, 14119, 12102, 14111, 12052, 14101, 12000, 14091, 11947, 14081, 11897, 14073, 11855,
+		14065, 11805, 14057, 11764, 14049, 11726, 14041, 11685, 14033, 11650, 14024, 11610, 14017, 11573, 14010, 11540,
+		14001, 11504, 13992, 11468, 13985, 11438, 13976, 11406, 13970, 11378, 13963, 11347, 13955, 11317, 13948, 11295,
+		13941, 11267, 13933, 11215, 13926, 11162, 13920, 11118, 13912, 11069, 13905, 11022, 13898, 10975, 13892, 10935,
+		13884, 10888, 13878, 10849, 13871, 10810, 13864, 10768, 13857, 10730, 13851, 10692, 13846, 10661, 13838, 10620,
+		13833, 10588, 13826, 10554, 13818, 10522, 13813, 10492, 13808, 10460, 13801, 10427, 13795, 10399, 13790, 10373,
+		13783, 10343, 13776, 10314, 13771, 10287, 13766, 10264, 13761, 10240, 13755, 10189, 13749, 10143, 13744, 10093,
+		13738, 10049, 13732, 10003, 13726, 9957, 13722, 9921, 13716, 9878, 13710, 9832, 13706, 9797, 13700, 9759,
+		13695, 9722, 13690, 9686, 13684, 9647, 13679, 9612, 13674, 9578, 13668, 9544, 13664, 9513, 13659, 9480,
+		13654, 9448, 13650, 9420, 13644, 9388, 13640, 9364, 13635, 9333, 13629, 9304, 13625, 9276, 13620, 9250,
+		13616, 9227, 13611, 9186, 13606, 9133, 13602, 9091, 13598, 9040, 13593, 8992, 13588, 8949, 13584, 8911,
+		13580, 8867, 13575, 8817, 13571, 8782, 13566, 8740, 13561, 8697, 13557, 8662, 13553, 8626, 13549, 8589,
+		13545, 8553, 13540, 8516, 13537, 8486, 13532, 8451, 13528, 8418, 13525, 8389, 13521, 8360, 13517, 8328,
+		13513, 8297, 13509, 8269, 13504, 8238, 13500, 8208, 13497, 8175, 13493, 8126, 13489, 8073, 13485, 8025,
+		13482, 7978, 13478, 7927, 13474, 7877, 13470, 7834, 13467, 7791, 13462, 7740, 13459, 7701, 13455, 7658,
+		13451, 7614, 13447, 7576, 13444, 7538, 13440, 7497, 13436, 7458, 13433, 7427, 13431, 7390, 13426, 7352,
+		13423, 7324, 13419, 7287, 13416, 7254, 13413, 7226, 13409, 7192, 13406, 7155, 13403, 7104, 13400, 7039,
+		13396, 6987, 13393, 6933, 13389, 6875, 13386, 6824, 13383, 6776, 13380, 6721, 13377, 6677, 13373, 6630,
+		13370, 6579, 13367, 6539, 13365, 6496, 13361, 6449, 13358, 6410, 13355, 6369, 13352, 6329, 13349, 6292,
+		13345, 6250, 13342, 6214, 13340, 6182, 13337, 6145, 13334, 6077, 13331, 6013, 13328, 5946, 13326, 5892,
+		13322, 5823, 13319, 5762, 13317, 5706, 13314, 5648, 13310, 5595, 13304, 5542, 13298, 5486, 13293, 5437,
+		13287, 5385, 13282, 5339, 13276, 5291, 13272, 5251, 13266, 5202, 13260, 5162, 13255, 5118, 13249, 5032,
+		13244, 4960, 13239, 4880, 13234, 4810, 13228, 4732, 13223, 4665, 13217, 4594, 13213, 4531, 13208, 4468,
+		13202, 4402, 13197, 4346, 13192, 4284, 13188, 4229, 13181, 4171, 13178, 4122, 13172, 4040, 13168, 3950,
+		13163, 3847, 13159, 3756, 13153, 3668, 13148, 3581, 13143, 3494, 13139, 3415, 13134, 3335, 13128, 3259,
+		13125, 3191, 13120, 3117, 13115, 3026, 13111, 2898, 13106, 2774, 13101, 2649, 13097, 2533, 13093, 2422,
+		13088, 2317, 13084, 2213, 13080, 2118, 13075, 1991, 13071, 1811, 13066, 1639, 13062, 1471, 13057, 1311,
+		14503, 15357, 14491, 14955, 14481, 14744, 14470, 14585, 14460, 14466, 14451, 14375, 14441, 14246, 14434, 14124,
+		14424, 13999, 14417, 13902, 14409, 13814, 14400, 13723, 14393, 13651, 14388, 13590, 14380, 13530, 14372, 13469,
+		14365, 13420, 14359, 13371, 14353, 13328, 14346, 13253, 14339, 13179, 14331, 13107, 14320, 13038, 14305, 12967,
+		14295, 12906, 14285, 12853, 14272, 12794, 14262, 12741, 14250, 12694, 14241, 12646, 14227, 12596, 14216, 12553,
+		14208, 12516, 14199, 12480, 14186, 12435, 14177, 12399, 14167, 12365, 14158, 12334, 14149, 12301, 14137, 12248,
+		14127, 12192, 14119, 12134, 14111, 12079, 14102, 12029, 14094, 11982, 14084, 11929, 14073, 11879, 14066, 11837,
+		14058, 11792, 14049, 11747, 14040, 11706, 14033, 11670, 14024, 11631, 14015, 11590, 14008, 11557, 14001, 11522,
+		13992, 11489, 13984, 11457, 13976, 11424, 13968, 11394, 13963, 11364, 13954, 11334, 13946, 11304, 13939, 11278,
+		13932, 11243, 13925, 11192, 13918, 11137, 13911, 11090, 13903, 11045, 13896, 10997, 13890, 10956, 13883, 10911,
+		13876, 10870, 13869, 10824, 13862, 10786, 13856, 10750, 13849, 10711, 13843, 10673, 13836, 10638, 13831, 10604,
+		13824, 10570, 13817, 10537, 13810, 10503, 13805, 10474, 13800, 10447, 13793, 10414, 13787, 10384, 13780, 10355,
+		13775, 10331, 13769, 10303, 13763, 10275, 13757, 10249, 13752, 10209, 13747, 10165, 13740, 10114, 13734, 10067,
+		13729, 10021, 13723, 9979, 13718, 9936, 13712, 9893, 13708, 9859, 13703, 9815, 13696, 9774, 13692, 9738,
+		13686, 9699, 13681, 9664, 13676, 9629, 13670, 9591, 13665, 9559, 13660, 9526, 13655, 9495, 13651, 9464,
+		13646, 9433, 13641, 9402, 13635, 9373, 13630, 9343, 13626, 9320, 13622, 9291, 13616, 9262, 13612, 9237,
+		13607, 9207, 13603, 9162, 13598, 9110, 13594, 9060, 13589, 9018, 13585, 8972, 13579, 8922, 13575, 8882,
+		13571, 8842, 13567, 8804, 13561, 8753, 13558, 8721, 13553, 8682, 13549, 8641, 13545, 8605, 13541, 8572,
+		13537, 8537, 13533, 8502, 13529, 8470, 13524, 8436, 13520, 8403, 13515, 8369, 13512, 8342, 13509, 8313,
+		13505, 8286, 13500, 8254, 13496, 8226, 13492, 8199, 13488, 8147, 13484, 8097, 13480, 8044, 13476, 7995,
+		13472, 7945, 13469, 7905, 13465, 7854, 13462, 7809, 13457, 7763, 13454, 7726, 13451, 7677, 13447, 7639,
+		13444, 7600, 13439, 7557, 13436, 7519, 13433, 7483, 13429, 7444, 13426, 7408, 13422, 7376, 13419, 7342,
+		13414, 7303, 13412, 7275, 13408, 7240, 13405, 7210, 13402, 7183, 13398, 7134, 13395, 7072, 13391, 7016,
+		13388, 6965, 13385, 6906, 13382, 6861, 13378, 6803, 13375, 6753, 13372, 6707, 13368, 6654, 13365, 6610,
+		13363, 6569, 13359, 6519, 13356, 6477, 13353, 6436, 13350, 6393, 13347, 6353, 13345, 6320, 13341, 6276,
+		13338, 6239, 13335, 6203, 13332, 6166, 13329, 6127, 13326, 6052, 13323, 5992, 13321, 5930, 13317, 5864,
+		13314, 5807, 13312, 5744, 13307, 5688, 13301, 5634, 13294, 5577, 13289, 5528, 13284, 5473, 13278, 5424,
+		13272, 5374, 13266, 5325, 13261, 5281, 13256, 5236, 13251, 5195, 13245, 5151, 13240, 5096, 13235, 5025,
+		13229, 4935, 13225, 4864, 13219, 4790, 13214, 4723, 13208, 4650, 13204, 4583, 13198, 4518, 13193, 4454,
+		13189, 4395, 13184, 4334, 13178, 4276, 13172, 4216, 13169, 4167, 13163, 4112, 13159, 4033, 13154, 3929,
+		13149, 3838, 13143, 3741, 13140, 3658, 13135, 3570, 13129, 3483, 13125, 3408, 13121, 3329, 13116, 3256,
+		13111, 3180, 13106, 3113, 13102, 3021, 13097, 2889, 13093, 2765, 13088, 2644, 13083, 2526, 13079, 2417,
+		13074, 2309, 13070, 2208, 13066, 2111, 13061, 1986, 13058, 1809, 13053, 1632, 13048, 1466, 13044, 1309,
+		14500, 15338, 14489, 14944, 14478, 14730, 14467, 14575, 14456, 14453, 14448, 14366, 14438, 14228, 14431, 14108,
+		14420, 13976, 14414, 13888, 14406, 13800, 14396, 13710, 14390, 13635, 14384, 13576, 14377, 13520, 14369, 13461,
+		14362, 13410, 14356, 13361, 14349, 13313, 14343, 13236, 14335, 13156, 14325, 13088, 14311, 13016, 14300, 12951,
+		14288, 12888, 14278, 12838, 14265, 12779, 14254, 12724, 14243, 12679, 14233, 12633, 14221, 12584, 14210, 12539,
+		14201, 12500, 14190, 12464, 14179, 12424, 14169, 12387, 14158, 12349, 14150, 12321, 14142, 12290, 14130, 12227,
+		14120, 12169, 14112, 12115, 14104, 12059, 14094, 12009, 14086, 11964, 14076, 11913, 14067, 11865, 14059, 11817,
+		14051, 11777, 14041, 11730, 14033, 11690, 14024, 11653, 14016, 11613, 14009, 11578, 14000, 11538, 13992, 11504,
+		13984, 11473, 13976, 11442, 13967, 11407, 13961, 11379, 13954, 11350, 13946, 11320, 13939, 11294, 13931, 11266,
+		13924, 11217, 13917, 11167, 13910, 11118, 13902, 11067, 13895, 11025, 13888, 10977, 13881, 10932, 13874, 10889,
+		13868, 10845, 13861, 10809, 13854, 10769, 13848, 10733, 13841, 10695, 13834, 10654, 13828, 10619, 13822, 10586,
+		13815, 10552, 13808, 10520, 13803, 10489, 13797, 10457, 13792, 10431, 13786, 10404, 13779, 10371, 13772, 10341,
+		13767, 10315, 13761, 10289, 13755, 10264, 13749, 10231, 13744, 10183, 13737, 10137, 13732, 10092, 13727, 10047,
+		13721, 10000, 13715, 9954, 13709, 9912, 13704, 9871, 13699, 9832, 13694, 9796, 13689, 9756, 13683, 9715,
+		13678, 9679, 13672, 9643, 13667, 9610, 13663, 9577, 13657, 9541, 13652, 9510, 13648, 9478, 13643, 9447,
+		13638, 9418, 13632, 9388, 13627, 9357, 13622, 9329, 13618, 9300, 13613, 9278, 13609, 9251, 13603, 9222,
+		13599, 9180, 13595, 9133, 13591, 9086, 13585, 9037, 13580, 8989, 13576, 8950, 13571, 8902, 13566, 8856,
+		13562, 8815, 13558, 8777, 13554, 8741, 13549, 8698, 13546, 8662, 13541, 8626, 13537, 8587, 13532, 8550,
+		13529, 8519, 13525, 8486, 13520, 8452, 13516, 8418, 13512, 8388, 13508, 8358, 13503, 8323, 13499, 8295,
+		13495, 8265, 13491, 8238, 13488, 8212, 13484, 8181, 13480, 8127, 13476, 8073, 13472, 8024, 13468, 7972,
+		13464, 7921, 13460, 7874, 13457, 7835, 13453, 7788, 13449, 7742, 13446, 7698, 13442, 7661, 13438, 7617,
+		13435, 7580, 13432, 7541, 13428, 7501, 13425, 7464, 13421, 7431, 13417, 7394, 13414, 7357, 13411, 7329,
+		13407, 7293, 13404, 7257, 13400, 7228, 13397, 7197, 13394, 7166, 13391, 7113, 13387, 7050, 13384, 6995,
+		13380, 6939, 13377, 6889, 13374, 6834, 13371, 6788, 13367, 6736, 13364, 6688, 13361, 6639, 13358, 6593,
+		13355, 6547, 13352, 6508, 13349, 6463, 13346, 6421, 13342, 6380, 13339, 6339, 13336, 6300, 13333, 6265,
+		13331, 6229, 13328, 6193, 13324, 6158, 13321, 6097, 13319, 6037, 13316, 5970, 13313, 5906, 13308, 5850,
+		13303, 5786, 13297, 5728, 13291, 5671, 13284, 5611, 13280, 5562, 13274, 5510, 13269, 5463, 13262, 5409,
+		13257, 5360, 13252, 5316, 13246, 5267, 13242, 5229, 13236, 5182, 13231, 5141, 13225, 5082, 13220, 4998,
+		13216, 4928, 13209, 4845, 13204, 4776, 13199, 4702, 13195, 4638, 13189, 4569, 13183, 4504, 13179, 4444,
+		13174, 4381, 13169, 4324, 13163, 4263, 13159, 4211, 13153, 4154, 13150, 4107, 13144, 4012, 13139, 3918,
+		13134, 3819, 13130, 3731, 13125, 3643, 13120, 3556, 13116, 3475, 13111, 3393, 13107, 3321, 13101, 3241,
+		13096, 3173, 13093, 3106, 13088, 3001, 13084, 2879, 13079, 2754, 13074, 2631, 13070, 2520, 13065, 2410,
+		13061, 2305, 13057, 2204, 13052, 2104, 13048, 1977, 13043, 1798, 13039, 1626, 13034, 1461, 13030, 1306,
+		14497, 15318, 14487, 14933, 14475, 14722, 14465, 14564, 14454, 14442, 14446, 14355, 14435, 14210, 14428, 14091,
+		14417, 13960, 14411, 13874, 14403, 13783, 14393, 13697, 14387, 13626, 14381, 13566, 14373, 13504, 14365, 13446,
+		14359, 13399, 14352, 13348, 14346, 13296, 14340, 13218, 14328, 13138, 14317, 13069, 14304, 12999, 14293, 12932,
+		14281, 12871, 14271, 12818, 14259, 12763, 14246, 12708, 14236, 12659, 14224, 12612, 14214, 12571, 14203, 12527,
+		14194, 12488, 14183, 12452, 14172, 12412, 14162, 12374, 14152, 12340, 14143, 12309, 14133, 12268, 14122, 12206,
+		14113, 12149, 14106, 12096, 14096, 12038, 14086, 11986, 14077, 11941, 14067, 11894, 14059, 11843, 14052, 11801,
+		14044, 11760, 14034, 11717, 14025, 11673, 14015, 11631, 14009, 11599, 14001, 11561, 13993, 11524, 13984, 11491,
+		13975, 11458, 13967, 11427, 13960, 11397, 13954, 11365, 13946, 11336, 13938, 11308, 13930, 11280, 13922, 11242,
+		13915, 11192, 13909, 11142, 13902, 11093, 13894, 11045, 13886, 10996, 13880, 10954, 13873, 10909, 13867, 10869,
+		13860, 10828, 13852, 10786, 13845, 10744, 13840, 10712, 13834, 10678, 13827, 10640, 13820, 10602, 13814, 10569,
+		13806, 10536, 13801, 10504, 13795, 10473, 13789, 10441, 13782, 10410, 13777, 10385, 13771, 10357, 13764, 10328,
+		13757, 10298, 13753, 10276, 13747, 10250, 13741, 10208, 13735, 10158, 13729, 10111, 13724, 10067, 13718, 10021,
+		13713, 9976, 13707, 9936, 13701, 9892, 13696, 9852, 13691, 9809, 13685, 9770, 13679, 9734, 13675, 9697,
+		13669, 9659, 13663, 9624, 13659, 9589, 13654, 9559, 13649, 9525, 13644, 9492, 13639, 9462, 13634, 9431,
+		13629, 9402, 13623, 9370, 13619, 9344, 13615, 9315, 13609, 9287, 13604, 9259, 13600, 9238, 13596, 9210,
+		13591, 9156, 13587, 9106, 13581, 9060, 13576, 9013, 13572, 8966, 13567, 8921, 13564, 8886, 13559, 8838,
+		13554, 8798, 13550, 8754, 13545, 8715, 13541, 8680, 13537, 8640, 13533, 8607, 13529, 8572, 13524, 8535,
+		13520, 8498, 13516, 8467, 13512, 8433, 13508, 8403, 13504, 8370, 13500, 8344, 13495, 8313, 13491, 8280,
+		13488, 8253, 13484, 8224, 13479, 8197, 13476, 8150, 13472, 8101, 13469, 8049, 13465, 8003, 13462, 7956,
+		13457, 7905, 13453, 7857, 13449, 7810, 13445, 7767, 13442, 7724, 13438, 7681, 13434, 7637, 13431, 7602,
+		13427, 7559, 13424, 7524, 13420, 7486, 13416, 7448, 13412, 7409, 13410, 7376, 13407, 7346, 13403, 7309,
+		13399, 7281, 13396, 7248, 13392, 7215, 13389, 7185, 13386, 7144, 13382, 7081, 13380, 7029, 13376, 6973,
+		13373, 6920, 13370, 6866, 13366, 6815, 13362, 6765, 13360, 6715, 13357, 6671, 13354, 6622, 13350, 6575,
+		13347, 6533, 13344, 6488, 13341, 6448, 13338, 6405, 13335, 6365, 13331, 6326, 13329, 6287, 13326, 6250,
+		13323, 6218, 13319, 6179, 13317, 6145, 13314, 6085, 13311, 6017, 13304, 5948, 13299, 5886, 13293, 5824,
+		13288, 5770, 13281, 5711, 13276, 5653, 13270, 5598, 13265, 5546, 13260, 5497, 13253, 5444, 13249, 5396,
+		13244, 5353, 13237, 5301, 13232, 5261, 13227, 5213, 13223, 5174, 13216, 5130, 13211, 5058, 13206, 4984,
+		13200, 4902, 13196, 4834, 13190, 4756, 13185, 4689, 13179, 4620, 13175, 4557, 13170, 4495, 13165, 4432,
+		13160, 4374, 13154, 4312, 13150, 4257, 13144, 4198, 13140, 4150, 13135, 4095, 13130, 4000, 13125, 3902,
+		13121, 3808, 13116, 3718, 13111, 3629, 13107, 3551, 13102, 3464, 13097, 3388, 13092, 3309, 13089, 3240,
+		13083, 3167, 13078, 3094, 13074, 2994, 13070, 2868, 13066, 2744, 13060, 2625, 13056, 2512, 13052, 2404,
+		13047, 2298, 13043, 2199, 13039, 2104, 13034, 1972, 13030, 1790, 13025, 1621, 13021, 1456, 13017, 1303,
+		14495, 15299, 14485, 14923, 14473, 14706, 14463, 14555, 14451, 14432, 14443, 14345, 14433, 14191, 14425, 14078,
+		14415, 13949, 14408, 13854, 14400, 13767, 14391, 13687, 14384, 13616, 14378, 13554, 14370, 13490, 14362, 13436,
+		14356, 13388, 14349, 13339, 14343, 13277, 14336, 13199, 14322, 13118, 14310, 13048, 14297, 12980, 14286, 12914,
+		14274, 12855, 14262, 12801, 14253, 12748, 14239, 12695, 14229, 12644, 14217, 12598, 14206, 12558, 14197, 12514,
+		14187, 12475, 14175, 12433, 14165, 12400, 14154, 12361, 14145, 12328, 14136, 12296, 14125, 12247, 14114, 12185,
+		14106, 12127, 14098, 12074, 14088, 12018, 14078, 11963, 14068, 11915, 14060, 11874, 14051, 11825, 14042, 11778,
+		14034, 11738, 14027, 11701, 14016, 11655, 14008, 11616, 14001, 11582, 13993, 11545, 13985, 11513, 13976, 11475,
+		13967, 11440, 13959, 11411, 13953, 11382, 13945, 11352, 13938, 11323, 13929, 11294, 13922, 11267, 13914, 11215,
+		13907, 11165, 13901, 11120, 13893, 11072, 13885, 11022, 13879, 10975, 13871, 10933, 13864, 10887, 13858, 10844,
+		13851, 10808, 13844, 10768, 13837, 10727, 13830, 10688, 13825, 10658, 13819, 10622, 13812, 10585, 13805, 10552,
+		13799, 10519, 13792, 10486, 13787, 10457, 13780, 10425, 13774, 10395, 13767, 10366, 13763, 10343, 13756, 10314,
+		13750, 10286, 13744, 10258, 13740, 10237, 13733, 10186, 13727, 10138, 13721, 10087, 13715, 10038, 13710, 9998,
+		13704, 9951, 13699, 9913, 13694, 9875, 13688, 9830, 13682, 9789, 13677, 9750, 13672, 9713, 13667, 9679,
+		13661, 9644, 13657, 9610, 13651, 9573, 13646, 9540, 13642, 9514, 13636, 9476, 13630, 9443, 13626, 9417,
+		13620, 9384, 13615, 9356, 13612, 9329, 13607, 9304, 13602, 9276, 13597, 9249, 13591, 9219, 13588, 9182,
+		13583, 9131, 13578, 9081, 13572, 9034, 13568, 8990, 13563, 8942, 13559, 8897, 13554, 8854, 13551, 8819,
+		13547, 8779, 13542, 8737, 13537, 8694, 13533, 8658, 13529, 8624, 13524, 8583, 13520, 8552, 13516, 8519,
+		13512, 8484, 13508, 8448, 13504, 8418, 13500, 8387, 13495, 8353, 13492, 8325, 13488, 8297, 13485, 8270,
+		13480, 8240, 13476, 8213, 13472, 8179, 13468, 8121, 13464, 8071, 13461, 8024, 13457, 7978, 13453, 7929,
+		13449, 7883, 13446, 7841, 13442, 7793, 13438, 7749, 13434, 7706, 13431, 7665, 13427, 7623, 13424, 7584,
+		13420, 7545, 13416, 7505, 13412, 7470, 13409, 7434, 13406, 7399, 13402, 7361, 13398, 7328, 13395, 7298,
+		13391, 7263, 13388, 7233, 13385, 7202, 13381, 7171, 13378, 7119, 13375, 7064, 13371, 7003, 13368, 6948,
+		13365, 6900, 13362, 6845, 13358, 6795, 13355, 6744, 13352, 6695, 13349, 6646, 13346, 6610, 13343, 6562,
+		13340, 6516, 13337, 6476, 13333, 6431, 13330, 6388, 13328, 6355, 13325, 6313, 13322, 6276, 13319, 6241,
+		13315, 6202, 13313, 6171, 13307, 6124, 13300, 6053, 13296, 5996, 13289, 5930, 13284, 5867, 13278, 5807,
+		13272, 5750, 13267, 5693, 13261, 5638, 13255, 5582, 13249, 5530, 13245, 5480, 13240, 5433, 13233, 5384,
+		13227, 5336, 13223, 5290, 13218, 5245, 13213, 5205, 13206, 5160, 13202, 5120, 13197, 5046, 13190, 4961,
+		13187, 4893, 13181, 4815, 13176, 4745, 13171, 4676, 13166, 4608, 13160, 4542, 13155, 4477, 13151, 4420,
+		13145, 4357, 13141, 4304, 13135, 4245, 13131, 4193, 13126, 4139, 13120, 4079, 13116, 3982, 13111, 3888,
+		13106, 3791, 13102, 3704, 13097, 3618, 13091, 3534, 13088, 3459, 13083, 3376, 13079, 3304, 13073, 3226,
+		13069, 3157, 13065, 3092, 13061, 2981, 13056, 2854, 13051, 2730, 13046, 2616, 13042, 2505, 13038, 2398,
+		13034, 2293, 13029, 2193, 13024, 2096, 13021, 1964, 13016, 1785, 13011, 1612, 13007, 1452, 13003, 1300,
+		14493, 15284, 14483, 14908, 14471, 14694, 14461, 14544, 14448, 14424, 14440, 14336, 14431, 14180, 14423, 14059,
+		14412, 13934, 14405, 13838, 14397, 13757, 14388, 13675, 14382, 13604, 14376, 13542, 14366, 13479, 14359, 13426,
+		14352, 13376, 14346, 13329, 14340, 13257, 14330, 13179, 14318, 13105, 14304, 13028, 14291, 12963, 14280, 12899,
+		14268, 12840, 14255, 12779, 14245, 12732, 14232, 12677, 14222, 12630, 14211, 12586, 14200, 12544, 14191, 12502,
+		14179, 12460, 14166, 12419, 14157, 12384, 14147, 12351, 14138, 12317, 14129, 12282, 14117, 12221, 14108, 12164,
+		14100, 12108, 14091, 12054, 14081, 12000, 14070, 11944, 14060, 11895, 14052, 11851, 14044, 11807, 14036, 11760,
+		14026, 11720, 14018, 11681, 14009, 11642, 14000, 11599, 13993, 11563, 13987, 11533, 13977, 11498, 13967, 11461,
+		13959, 11427, 13952, 11397, 13946, 11368, 13938, 11339, 13929, 11310, 13922, 11282, 13914, 11249, 13907, 11194,
+		13900, 11142, 13892, 11092, 13885, 11048, 13878, 11000, 13871, 10957, 13863, 10910, 13858, 10872, 13849, 10824,
+		13843, 10786, 13837, 10753, 13829, 10710, 13823, 10673, 13816, 10633, 13811, 10607, 13804, 10570, 13796, 10535,
+		13791, 10502, 13785, 10473, 13779, 10442, 13773, 10413, 13765, 10383, 13759, 10350, 13753, 10323, 13748, 10301,
+		13742, 10273, 13737, 10246, 13729, 10198, 13724, 10156, 13718, 10110, 13713, 10063, 13707, 10017, 13702, 9972,
+		13696, 9932, 13690, 9887, 13686, 9849, 13680, 9811, 13674, 9771, 13669, 9730, 13664, 9692, 13658, 9660,
+		13653, 9623, 13648, 9589, 13643, 9556, 13637, 9520, 13632, 9488, 13628, 9462, 13622, 9429, 13617, 9398,
+		13613, 9372, 13608, 9340, 13603, 9312, 13598, 9286, 13593, 9261, 13588, 9234, 13584, 9202, 13579, 9147,
+		13574, 9105, 13569, 9056, 13565, 9012, 13561, 8965, 13557, 8925, 13552, 8879, 13547, 8832, 13543, 8795,
+		13538, 8758, 13534, 8717, 13530, 8678, 13526, 8639, 13520, 8601, 13516, 8568, 13511, 8531, 13508, 8497,
+		13505, 8470, 13500, 8435, 13497, 8403, 13492, 8372, 13488, 8341, 13483, 8308, 13480, 8281, 13476, 8254,
+		13472, 8225, 13467, 8198, 13464, 8155, 13461, 8105, 13456, 8048, 13451, 7995, 13448, 7949, 13444, 7903,
+		13440, 7856, 13436, 7807, 13433, 7766, 13429, 7726, 13426, 7684, 13422, 7642, 13420, 7609, 13416, 7566,
+		13412, 7526, 13408, 7490, 13405, 7453, 13401, 7414, 13398, 7384, 13394, 7350, 13390, 7314, 13387, 7283,
+		13384, 7251, 13381, 7219, 13378, 7190, 13374, 7154, 13370, 7092, 13367, 7035, 13364, 6979, 13361, 6930,
+		13357, 6872, 13354, 6827, 13351, 6777, 13348, 6725, 13345, 6681, 13341, 6632, 13338, 6584, 13336, 6548,
+		13332, 6500, 13329, 6455, 13326, 6420, 13323, 6376, 13319, 6334, 13317, 6300, 13314, 6262, 13309, 6226,
+		13304, 6193, 13299, 6156, 13292, 6100, 13286, 6036, 13280, 5969, 13275, 5914, 13268, 5848, 13262, 5786,
+		13258, 5733, 13253, 5677, 13247, 5625, 13241, 5569, 13236, 5517, 13231, 5468, 13224, 5418, 13219, 5372,
+		13214, 5324, 13208, 5275, 13203, 5236, 13197, 5189, 13192, 5149, 13187, 5102, 13181, 5019, 13177, 4947,
+		13172, 4871, 13166, 4798, 13161, 4726, 13157, 4661, 13150, 4591, 13146, 4530, 13141, 4467, 13135, 4403,
+		13132, 4352, 13127, 4291, 13121, 4235, 13115, 4179, 13111, 4130, 13106, 4061, 13102, 3965, 13097, 3872,
+		13093, 3780, 13088, 3695, 13082, 3601, 13078, 3526, 13073, 3441, 13069, 3369, 13064, 3292, 13060, 3220,
+		13056, 3154, 13049, 3079, 13045, 2962, 13042, 2844, 13037, 2721, 13033, 2607, 13029, 2497, 13024, 2389,
+		13020, 2287, 13015, 2187, 13011, 2091, 13007, 1954, 13002, 1776, 12998, 1610, 12993, 1446, 12990, 1296,
+		14491, 15269, 14479, 14899, 14469, 14684, 14458, 14529, 14446, 14416, 14438, 14317, 14429, 14161, 14420, 14042,
+		14410, 13922, 14403, 13823, 14395, 13746, 14385, 13664, 14378, 13587, 14372, 13529, 14363, 13469, 14357, 13418,
+		14350, 13365, 14343, 13317, 14337, 13242, 14324, 13160, 14311, 13083, 14297, 13012, 14285, 12947, 14273, 12881,
+		14262, 12826, 14249, 12766, 14238, 12716, 14226, 12665, 14214, 12614, 14205, 12572, 14193, 12526, 14183, 12487,
+		14171, 12447, 14160, 12407, 14151, 12372, 14140, 12340, 14132, 12307, 14121, 12262, 14110, 12200, 14100, 12140,
+		14092, 12083, 14082, 12029, 14074, 11981, 14063, 11929, 14052, 11874, 14045, 11828, 14037, 11789, 14028, 11744,
+		14019, 11702, 14010, 11663, 14001, 11623, 13994, 11585, 13985, 11546, 13978, 11515, 13969, 11481, 13960, 11448,
+		13952, 11414, 13945, 11383, 13938, 11355, 13930, 11325, 13921, 11296, 13913, 11269, 13906, 11223, 13900, 11172,
+		13892, 11120, 13884, 11068, 13877, 11025, 13870, 10980, 13863, 10936, 13856, 10891, 13849, 10848, 13843, 10807,
+		13836, 10768, 13829, 10729, 13822, 10693, 13815, 10655, 13809, 10617, 13801, 10582, 13796, 10555, 13790, 10523,
+		13783, 10488, 13777, 10454, 13770, 10425, 13763, 10395, 13758, 10368, 13752, 10339, 13745, 10310, 13739, 10283,
+		13735, 10263, 13728, 10231, 13721, 10178, 13715, 10125, 13710, 10082, 13705, 10040, 13700, 9994, 13694, 9951,
+		13688, 9907, 13683, 9867, 13676, 9824, 13671, 9785, 13666, 9750, 13661, 9712, 13655, 9674, 13650, 9635,
+		13646, 9607, 13640, 9573, 13635, 9540, 13630, 9504, 13624, 9470, 13618, 9439, 13614, 9412, 13609, 9382,
+		13605, 9355, 13600, 9330, 13595, 9297, 13589, 9271, 13585, 9244, 13580, 9220, 13576, 9176, 13571, 9126,
+		13566, 9075, 13562, 9033, 13558, 8989, 13553, 8943, 13548, 8898, 13544, 8858, 13540, 8818, 13534, 8769,
+		13530, 8733, 13526, 8698, 13522, 8658, 13517, 8622, 13513, 8585, 13508, 8550, 13505, 8517, 13500, 8480,
+		13496, 8448, 13493, 8418, 13488, 8388, 13485, 8358, 13480, 8327, 13476, 8297, 13472, 8266, 13467, 8237,
+		13463, 8210, 13460, 8176, 13456, 8127, 13452, 8077, 13449, 8028, 13444, 7977, 13440, 7925, 13436, 7880,
+		13433, 7837, 13429, 7791, 13424, 7741, 13421, 7703, 13418, 7663, 13415, 7624, 13410, 7581, 13408, 7546,
+		13403, 7508, 13400, 7469, 13397, 7437, 13394, 7402, 13390, 7364, 13386, 7331, 13383, 7303, 13379, 7266,
+		13377, 7239, 13373, 7206, 13369, 7176, 13366, 7127, 13363, 7071, 13360, 7016, 13356, 6956, 13353, 6905,
+		13350, 6859, 13346, 6802, 13344, 6759, 13340, 6708, 13336, 6656, 13334, 6617, 13331, 6569, 13327, 6523,
+		13325, 6487, 13321, 6444, 13318, 6399, 13316, 6363, 13313, 6326, 13306, 6284, 13301, 6252, 13295, 6213,
+		13289, 6178, 13283, 6145, 13277, 6079, 13271, 6011, 13265, 5948, 13259, 5890, 13255, 5831, 13250, 5775,
+		13243, 5714, 13237, 5662, 13232, 5607, 13227, 5553, 13220, 5500, 13214, 5450, 13210, 5407, 13205, 5356,
+		13199, 5310, 13194, 5268, 13188, 5219, 13183, 5182, 13177, 5137, 13171, 5075, 13168, 5002, 13162, 4926,
+		13157, 4857, 13152, 4780, 13147, 4715, 13142, 4647, 13138, 4583, 13133, 4518, 13127, 4455, 13122, 4396,
+		13117, 4336, 13112, 4283, 13107, 4225, 13103, 4173, 13098, 4121, 13092, 4043, 13088, 3950, 13083, 3856,
+		13078, 3768, 13073, 3677, 13069, 3594, 13064, 3513, 13059, 3435, 13055, 3356, 13051, 3287, 13046, 3214,
+		13041, 3142, 13037, 3078, 13034, 2960, 13027, 2827, 13023, 2710, 13020, 2600, 13015, 2490, 13010, 2379,
+		13006, 2279, 13002, 2181, 12998, 2088, 12993, 1945, 12989, 1771, 12984, 1602, 12980, 1442, 12976, 1293,
+		14489, 15259, 14477, 14887, 14467, 14672, 14456, 14520, 14444, 14406, 14436, 14304, 14426, 14143, 14418, 14027,
+		14407, 13907, 14400, 13810, 14393, 13733, 14383, 13651, 14376, 13576, 14369, 13517, 14361, 13458, 14354, 13406,
+		14346, 13352, 14340, 13301, 14331, 13216, 14316, 13141, 14304, 13066, 14290, 12992, 14279, 12929, 14268, 12868,
+		14256, 12810, 14243, 12750, 14230, 12697, 14220, 12651, 14208, 12601, 14196, 12555, 14186, 12513, 14177, 12476,
+		14163, 12431, 14153, 12397, 14144, 12360, 14134, 12328, 14125, 12294, 14113, 12238, 14102, 12174, 14094, 12119,
+		14085, 12062, 14076, 12009, 14065, 11958, 14056, 11910, 14046, 11857, 14038, 11810, 14030, 11772, 14020, 11728,
+		14011, 11681, 14001, 11643, 13995, 11608, 13987, 11572, 13978, 11533, 13969, 11496, 13960, 11466, 13953, 11434,
+		13945, 11402, 13938, 11371, 13930, 11340, 13921, 11311, 13913, 11284, 13906, 11251, 13899, 11197, 13892, 11149,
+		13885, 11098, 13876, 11047, 13868, 10995, 13862, 10957, 13855, 10912, 13849, 10869, 13841, 10831, 13836, 10794,
+		13827, 10747, 13820, 10709, 13814, 10674, 13808, 10638, 13801, 10602, 13793, 10565, 13787, 10532, 13781, 10502,
+		13775, 10471, 13768, 10440, 13761, 10408, 13756, 10379, 13750, 10353, 13744, 10326, 13738, 10298, 13731, 10268,
+		13726, 10244, 13719, 10204, 13714, 10153, 13708, 10105, 13703, 10060, 13697, 10013, 13691, 9971, 13686, 9930,
+		13680, 9889, 13674, 9846, 13669, 9806, 13664, 9766, 13659, 9728, 13653, 9695, 13648, 9656, 13642, 9621,
+		13636, 9581, 13632, 9553, 13627, 9521, 13622, 9491, 13617, 9458, 13611, 9425, 13606, 9395, 13602, 9368,
+		13597, 9340, 13592, 9314, 13587, 9288, 13582, 9257, 13577, 9232, 13573, 9196, 13568, 9149, 13563, 9101,
+		13558, 9053, 13554, 9006, 13549, 8964, 13545, 8919, 13540, 8877, 13535, 8830, 13531, 8795, 13527, 8755,
+		13522, 8711, 13518, 8673, 13513, 8638, 13509, 8602, 13505, 8568, 13501, 8533, 13498, 8500, 13493, 8467,
+		13488, 8430, 13484, 8399, 13480, 8371, 13475, 8338, 13471, 8309, 13468, 8284, 13464, 8252, 13460, 8226,
+		13456, 8197, 13452, 8150, 13448, 8099, 13444, 8049, 13441, 8003, 13437, 7956, 13433, 7908, 13430, 7860,
+		13426, 7820, 13422, 7776, 13419, 7732, 13414, 7684, 13411, 7650, 13407, 7606, 13403, 7564, 13399, 7529,
+		13396, 7492, 13393, 7455, 13389, 7419, 13385, 7385, 13382, 7351, 13378, 7317, 13375, 7286, 13373, 7257,
+		13368, 7223, 13365, 7193, 13361, 7158, 13358, 7099, 13355, 7042, 13352, 6993, 13349, 6944, 13346, 6884,
+		13342, 6833, 13339, 6783, 13336, 6733, 13333, 6692, 13330, 6645, 13326, 6596, 13323, 6555, 13320, 6509,
+		13317, 6466, 13314, 6426, 13311, 6388, 13303, 6346, 13298, 6310, 13291, 6272, 13286, 6234, 13280, 6204,
+		13275, 6167, 13268, 6118, 13263, 6058, 13257, 5994, 13251, 5928, 13245, 5868, 13240, 5812, 13234, 5752,
+		13228, 5697, 13222, 5640, 13217, 5591, 13211, 5537, 13206, 5484, 13200, 5437, 13195, 5387, 13189, 5343,
+		13185, 5299, 13180, 5255, 13175, 5215, 13168, 5168, 13163, 5128, 13159, 5058, 13153, 4979, 13148, 4910,
+		13142, 4832, 13138, 4772, 13133, 4699, 13128, 4630, 13123, 4567, 13117, 4500, 13113, 4444, 13108, 4383,
+		13103, 4327, 13097, 4269, 13094, 4218, 13088, 4162, 13083, 4112, 13079, 4030, 13074, 3931, 13069, 3846,
+		13064, 3752, 13060, 3668, 13054, 3577, 13051, 3504, 13046, 3421, 13041, 3348, 13036, 3274, 13032, 3202,
+		13029, 3141, 13022, 3063, 13018, 2937, 13014, 2820, 13010, 2702, 13006, 2592, 13000, 2477, 12997, 2373,
+		12992, 2271, 12988, 2176, 12983, 2080, 12979, 1932, 12975, 1761, 12971, 1597, 12966, 1438, 12963, 1289,
+		14487, 15245, 14475, 14873, 14465, 14658, 14454, 14506, 14442, 14398, 14433, 14284, 14424, 14129, 14415, 14006,
+		14405, 13891, 14398, 13798, 14390, 13718, 14380, 13637, 14374, 13566, 14367, 13507, 14358, 13445, 14350, 13393,
+		14343, 13342, 14338, 13284, 14325, 13199, 14310, 13123, 14298, 13048, 14284, 12976, 14273, 12909, 14262, 12854,
+		14248, 12790, 14237, 12736, 14224, 12684, 14213, 12637, 14202, 12589, 14189, 12543, 14180, 12500, 14168, 12459,
+		14156, 12420, 14146, 12383, 14136, 12348, 14127, 12316, 14117, 12277, 14106, 12218, 14096, 12158, 14087, 12096,
+		14078, 12040, 14067, 11984, 14057, 11939, 14047, 11892, 14040, 11844, 14031, 11796, 14023, 11752, 14013, 11711,
+		14003, 11669, 13994, 11625, 13987, 11592, 13980, 11555, 13971, 11519, 13962, 11482, 13953, 11450, 13944, 11419,
+		13939, 11388, 13930, 11357, 13922, 11326, 13913, 11298, 13906, 11274, 13897, 11222, 13892, 11172, 13884, 11124,
+		13876, 11077, 13869, 11028, 13861, 10976, 13853, 10933, 13848, 10894, 13840, 10847, 13834, 10808, 13826, 10768,
+		13819, 10731, 13812, 10688, 13806, 10654, 13801, 10624, 13793, 10584, 13786, 10552, 13779, 10514, 13774, 10487,
+		13767, 10456, 13761, 10425, 13755, 10397, 13748, 10366, 13742, 10338, 13736, 10313, 13731, 10286, 13725, 10259,
+		13717, 10221, 13711, 10174, 13706, 10129, 13701, 10084, 13695, 10035, 13689, 9992, 13683, 9948, 13678, 9907,
+		13672, 9866, 13667, 9826, 13661, 9784, 13656, 9746, 13650, 9708, 13645, 9671, 13641, 9642, 13634, 9606,
+		13629, 9567, 13623, 9531, 13619, 9503, 13614, 9473, 13608, 9441, 13604, 9411, 13599, 9379, 13593, 9350,
+		13588, 9324, 13582, 9294, 13579, 9271, 13574, 9247, 13570, 9218, 13565, 9173, 13560, 9123, 13555, 9076,
+		13551, 9034, 13546, 8984, 13541, 8937, 13537, 8895, 13532, 8854, 13527, 8813, 13523, 8769, 13520, 8736,
+		13515, 8699, 13510, 8655, 13506, 8618, 13501, 8585, 13497, 8547, 13494, 8516, 13489, 8481, 13485, 8449,
+		13480, 8418, 13476, 8383, 13471, 8353, 13468, 8323, 13463, 8292, 13460, 8265, 13456, 8242, 13453, 8214,
+		13449, 8183, 13445, 8129, 13441, 8079, 13436, 8025, 13432, 7974, 13429, 7930, 13426, 7883, 13422, 7841,
+		13418, 7794, 13414, 7751, 13411, 7710, 13407, 7672, 13403, 7628, 13400, 7592, 13396, 7550, 13392, 7512,
+		13389, 7477, 13385, 7441, 13381, 7402, 13378, 7370, 13375, 7338, 13372, 7305, 13368, 7270, 13364, 7238,
+		13361, 7212, 13358, 7182, 13354, 7131, 13351, 7079, 13348, 7023, 13344, 6964, 13341, 6914, 13338, 6867,
+		13335, 6811, 13331, 6765, 13328, 6715, 13325, 6667, 13322, 6624, 13319, 6581, 13316, 6533, 13313, 6495,
+		13308, 6454, 13301, 6410, 13294, 6371, 13289, 6332, 13283, 6294, 13278, 6260, 13271, 6224, 13264, 6186,
+		13259, 6154, 13254, 6098, 13246, 6029, 13242, 5972, 13236, 5911, 13230, 5847, 13225, 5793, 13218, 5735,
+		13214, 5679, 13208, 5626, 13202, 5569, 13197, 5525, 13191, 5473, 13186, 5421, 13181, 5378, 13175, 5326,
+		13171, 5286, 13164, 5243, 13159, 5197, 13154, 5160, 13150, 5118, 13143, 5037, 13139, 4966, 13134, 4885,
+		13129, 4820, 13123, 4747, 13119, 4683, 13114, 4616, 13108, 4552, 13104, 4493, 13098, 4427, 13093, 4374,
+		13089, 4313, 13084, 4261, 13078, 4203, 13074, 4153, 13070, 4104, 13064, 4013, 13059, 3916, 13055, 3825,
+		13051, 3743, 13045, 3653, 13042, 3571, 13036, 3490, 13033, 3417, 13027, 3336, 13024, 3270, 13018, 3196,
+		13013, 3127, 13010, 3060, 13006, 2936, 13000, 2806, 12996, 2692, 12992, 2578, 12987, 2471, 12983, 2365,
+		12979, 2264, 12974, 2170, 12970, 2075, 12966, 1926, 12961, 1754, 12957, 1592, 12953, 1435, 12949, 1285,
+		14486, 15236, 14473, 14857, 14463, 14647, 14452, 14496, 14440, 14390, 14431, 14268, 14422, 14113, 14412, 13988,
+		14403, 13878, 14396, 13785, 14386, 13701, 14378, 13626, 14372, 13558, 14363, 13492, 14355, 13434, 14347, 13382,
+		14340, 13331, 14333, 13260, 14319, 13177, 14304, 13105, 14291, 13026, 14278, 12958, 14268, 12899, 14255, 12835,
+		14241, 12773, 14230, 12722, 14217, 12668, 14208, 12624, 14194, 12572, 14183, 12529, 14174, 12491, 14161, 12446,
+		14150, 12409, 14141, 12373, 14130, 12337, 14120, 12304, 14110, 12256, 14098, 12192, 14088, 12134, 14080, 12077,
+		14070, 12020, 14060, 11965, 14050, 11915, 14041, 11873, 14034, 11831, 14025, 11783, 14015, 11738, 14007, 11697,
+		13996, 11654, 13988, 11611, 13980, 11574, 13973, 11540, 13963, 11505, 13953, 11469, 13945, 11433, 13938, 11405,
+		13931, 11376, 13923, 11344, 13914, 11315, 13906, 11285, 13898, 11253, 13892, 11202, 13884, 11147, 13877, 11102,
+		13868, 11052, 13861, 11002, 13854, 10959, 13846, 10911, 13840, 10871, 13833, 10830, 13825, 10787, 13819, 10749,
+		13812, 10714, 13805, 10674, 13799, 10633, 13793, 10604, 13785, 10570, 13778, 10533, 13772, 10501, 13765, 10468,
+		13759, 10441, 13753, 10411, 13747, 10382, 13740, 10351, 13734, 10324, 13728, 10295, 13723, 10272, 13716, 10249,
+		13710, 10200, 13705, 10151, 13700, 10109, 13694, 10063, 13688, 10015, 13681, 9969, 13676, 9928, 13669, 9884,
+		13664, 9841, 13659, 9804, 13654, 9765, 13648, 9725, 13642, 9690, 13637, 9651, 13631, 9617, 13627, 9588,
+		13622, 9552, 13617, 9518, 13611, 9482, 13606, 9457, 13601, 9425, 13596, 9397, 13591, 9366, 13585, 9335,
+		13580, 9307, 13576, 9282, 13571, 9254, 13568, 9234, 13562, 9201, 13557, 9148, 13552, 9096, 13547, 9046,
+		13542, 9004, 13538, 8965, 13533, 8914, 13529, 8874, 13524, 8833, 13520, 8792, 13516, 8753, 13511, 8706,
+		13507, 8675, 13504, 8644, 13498, 8601, 13494, 8564, 13489, 8530, 13484, 8495, 13481, 8463, 13476, 8431,
+		13473, 8400, 13469, 8372, 13465, 8340, 13461, 8310, 13456, 8281, 13452, 8251, 13449, 8223, 13445, 8200,
+		13441, 8151, 13438, 8110, 13433, 8054, 13429, 8004, 13425, 7958, 13421, 7904, 13417, 7861, 13413, 7813,
+		13409, 7770, 13406, 7725, 13402, 7687, 13399, 7646, 13395, 7610, 13391, 7568, 13388, 7533, 13385, 7495,
+		13381, 7456, 13377, 7421, 13374, 7391, 13370, 7354, 13367, 7320, 13364, 7289, 13360, 7258, 13356, 7224,
+		13354, 7198, 13351, 7169, 13347, 7110, 13344, 7053, 13340, 7002, 13337, 6947, 13333, 6890, 13330, 6843,
+		13327, 6795, 13324, 6747, 13321, 6699, 13318, 6654, 13314, 6604, 13310, 6561, 13305, 6519, 13299, 6478,
+		13292, 6434, 13286, 6399, 13281, 6358, 13274, 6318, 13268, 6282, 13262, 6245, 13257, 6212, 13251, 6177,
+		13245, 6142, 13239, 6079, 13233, 6011, 13227, 5949, 13221, 5892, 13216, 5832, 13210, 5770, 13205, 5720,
+		13199, 5663, 13192, 5606, 13189, 5559, 13183, 5505, 13178, 5460, 13173, 5415, 13167, 5362, 13162, 5320,
+		13155, 5272, 13151, 5231, 13145, 5191, 13140, 5145, 13134, 5097, 13129, 5015, 13125, 4942, 13119, 4872,
+		13113, 4793, 13109, 4731, 13104, 4663, 13099, 4602, 13095, 4539, 13089, 4475, 13084, 4420, 13079, 4359,
+		13075, 4304, 13069, 4246, 13065, 4195, 13059, 4142, 13054, 4089, 13051, 3998, 13046, 3901, 13041, 3815,
+		13037, 3727, 13032, 3644, 13026, 3555, 13023, 3480, 13018, 3401, 13013, 3328, 13009, 3257, 13005, 3188,
+		13001, 3123, 12994, 3035, 12990, 2912, 12986, 2791, 12982, 2681, 12978, 2573, 12974, 2461, 12969, 2358,
+		12965, 2259, 12960, 2162, 12956, 2072, 12952, 1914, 12948, 1747, 12944, 1585, 12939, 1428, 12936, 1281,
+		14484, 15222, 14471, 14847, 14461, 14638, 14450, 14488, 14438, 14379, 14428, 14248, 14419, 14095, 14408, 13969,
+		14400, 13868, 14394, 13774, 14383, 13686, 14376, 13618, 14369, 13546, 14360, 13477, 14352, 13423, 14345, 13373,
+		14338, 13322, 14328, 13241, 14314, 13164, 14298, 13082, 14285, 13006, 14271, 12938, 14261, 12880, 14249, 12820,
+		14235, 12759, 14224, 12708, 14211, 12653, 14201, 12609, 14189, 12560, 14178, 12517, 14167, 12475, 14154, 12434,
+		14144, 12396, 14135, 12362, 14124, 12327, 14113, 12291, 14102, 12230, 14091, 12169, 14083, 12114, 14074, 12057,
+		14063, 12001, 14053, 11947, 14042, 11894, 14034, 11852, 14028, 11813, 14018, 11765, 14008, 11721, 13998, 11676,
+		13989, 11639, 13982, 11600, 13973, 11558, 13965, 11527, 13956, 11490, 13946, 11454, 13938, 11419, 13931, 11391,
+		13923, 11362, 13915, 11332, 13906, 11302, 13897, 11271, 13891, 11226, 13885, 11180, 13877, 11128, 13868, 11073,
+		13861, 11031, 13854, 10985, 13846, 10937, 13841, 10896, 13833, 10855, 13826, 10812, 13817, 10767, 13810, 10730,
+		13804, 10692, 13799, 10662, 13791, 10620, 13783, 10581, 13777, 10553, 13771, 10520, 13765, 10484, 13758, 10452,
+		13751, 10423, 13746, 10397, 13740, 10369, 13733, 10341, 13728, 10311, 13721, 10283, 13715, 10259, 13708, 10229,
+		13703, 10177, 13697, 10127, 13691, 10079, 13686, 10037, 13679, 9991, 13673, 9944, 13667, 9903, 13662, 9863,
+		13657, 9822, 13651, 9780, 13645, 9744, 13640, 9708, 13635, 9671, 13628, 9633, 13624, 9598, 13618, 9564,
+		13614, 9536, 13609, 9500, 13602, 9467, 13597, 9435, 13593, 9409, 13588, 9379, 13583, 9351, 13578, 9324,
+		13573, 9296, 13568, 9267, 13564, 9242, 13558, 9212, 13553, 9168, 13549, 9124, 13544, 9076, 13540, 9027,
+		13535, 8978, 13530, 8934, 13526, 8896, 13521, 8850, 13517, 8813, 13513, 8774, 13508, 8732, 13503, 8691,
+		13498, 8651, 13494, 8618, 13491, 8586, 13486, 8547, 13482, 8514, 13478, 8482, 13473, 8447, 13469, 8415,
+		13465, 8382, 13461, 8353, 13458, 8328, 13453, 8295, 13449, 8267, 13445, 8241, 13441, 8210, 13436, 8170,
+		13433, 8130, 13428, 8074, 13425, 8024, 13421, 7976, 13418, 7935, 13414, 7891, 13410, 7838, 13406, 7795,
+		13403, 7752, 13399, 7711, 13395, 7666, 13391, 7627, 13387, 7585, 13384, 7551, 13381, 7512, 13377, 7480,
+		13374, 7443, 13370, 7406, 13366, 7370, 13364, 7342, 13360, 7306, 13356, 7275, 13353, 7243, 13349, 7214,
+		13346, 7181, 13342, 7140, 13339, 7086, 13336, 7028, 13333, 6978, 13330, 6926, 13326, 6874, 13323, 6819,
+		13320, 6772, 13317, 6727, 13313, 6678, 13308, 6634, 13302, 6589, 13296, 6545, 13290, 6500, 13283, 6460,
+		13277, 6420, 13271, 6379, 13266, 6343, 13260, 6307, 13253, 6267, 13248, 6233, 13242, 6199, 13236, 6162,
+		13230, 6121, 13225, 6054, 13218, 5991, 13213, 5930, 13207, 5868, 13202, 5812, 13196, 5756, 13190, 5697,
+		13185, 5647, 13180, 5596, 13174, 5539, 13168, 5491, 13162, 5441, 13158, 5397, 13152, 5352, 13146, 5304,
+		13141, 5263, 13136, 5219, 13130, 5173, 13126, 5140, 13120, 5070, 13115, 4999, 13109, 4920, 13105, 4847,
+		13101, 4784, 13095, 4711, 13090, 4647, 13085, 4585, 13080, 4523, 13075, 4466, 13070, 4403, 13065, 4346,
+		13060, 4289, 13056, 4239, 13051, 4184, 13046, 4134, 13042, 4075, 13036, 3977, 13032, 3891, 13027, 3797,
+		13023, 3713, 13017, 3626, 13014, 3549, 13008, 3466, 13004, 3393, 13000, 3318, 12995, 3248, 12990, 3180,
+		12986, 3112, 12982, 3030, 12978, 2908, 12973, 2780, 12969, 2670, 12965, 2561, 12960, 2452, 12956, 2350,
+		12952, 2252, 12947, 2157, 12943, 2067, 12939, 1906, 12934, 1740, 12931, 1581, 12926, 1426, 12922, 1277,
+		14482, 15213, 14470, 14834, 14459, 14629, 14447, 14478, 14435, 14371, 14426, 14233, 14417, 14083, 14406, 13956,
+		14398, 13854, 14391, 13760, 14380, 13672, 14373, 13602, 14366, 13533, 14357, 13465, 14349, 13413, 14342, 13362,
+		14334, 13310, 14321, 13219, 14308, 13145, 14293, 13065, 14279, 12992, 14266, 12921, 14256, 12864, 14242, 12803,
+		14229, 12744, 14218, 12691, 14206, 12640, 14194, 12594, 14183, 12549, 14171, 12501, 14161, 12464, 14148, 12422,
+		14138, 12386, 14128, 12351, 14117, 12316, 14107, 12272, 14096, 12213, 14085, 12149, 14076, 12092, 14068, 12041,
+		14057, 11985, 14046, 11932, 14036, 11881, 14029, 11836, 14019, 11788, 14010, 11748, 14001, 11704, 13992, 11662,
+		13983, 11623, 13975, 11585, 13967, 11545, 13957, 11508, 13947, 11474, 13940, 11444, 13932, 11409, 13924, 11375,
+		13916, 11346, 13908, 11320, 13899, 11289, 13891, 11260, 13884, 11205, 13877, 11150, 13868, 11104, 13860, 11052,
+		13853, 11006, 13847, 10963, 13840, 10917, 13833, 10875, 13825, 10832, 13817, 10792, 13810, 10753, 13804, 10711,
+		13797, 10671, 13791, 10638, 13784, 10605, 13776, 10567, 13769, 10533, 13764, 10505, 13757, 10470, 13750, 10437,
+		13743, 10406, 13738, 10380, 13731, 10350, 13725, 10323, 13719, 10296, 13713, 10269, 13706, 10243, 13701, 10201,
+		13696, 10155, 13690, 10105, 13683, 10053, 13677, 10011, 13671, 9967, 13666, 9924, 13659, 9878, 13656, 9844,
+		13650, 9803, 13643, 9764, 13638, 9725, 13633, 9690, 13627, 9652, 13622, 9618, 13616, 9582, 13612, 9548,
+		13606, 9517, 13601, 9487, 13596, 9455, 13590, 9420, 13585, 9389, 13580, 9365, 13575, 9335, 13571, 9311,
+		13566, 9284, 13561, 9255, 13556, 9231, 13550, 9190, 13546, 9138, 13541, 9093, 13538, 9055, 13532, 9006,
+		13528, 8959, 13523, 8913, 13518, 8868, 13514, 8832, 13509, 8787, 13505, 8751, 13501, 8713, 13495, 8672,
+		13491, 8634, 13487, 8596, 13483, 8563, 13478, 8530, 13474, 8496, 13470, 8465, 13466, 8433, 13462, 8401,
+		13458, 8369, 13453, 8338, 13449, 8307, 13445, 8283, 13441, 8253, 13437, 8225, 13434, 8199, 13429, 8153,
+		13424, 8095, 13421, 8051, 13417, 8002, 13414, 7953, 13410, 7905, 13406, 7862, 13403, 7825, 13400, 7780,
+		13395, 7735, 13392, 7694, 13388, 7657, 13384, 7612, 13381, 7574, 13378, 7535, 13373, 7499, 13369, 7460,
+		13366, 7428, 13363, 7392, 13359, 7357, 13355, 7321, 13352, 7293, 13348, 7260, 13346, 7232, 13342, 7199,
+		13339, 7172, 13335, 7116, 13332, 7060, 13329, 7008, 13325, 6952, 13322, 6901, 13319, 6849, 13316, 6803,
+		13312, 6751, 13306, 6702, 13300, 6661, 13294, 6612, 13288, 6572, 13282, 6529, 13274, 6486, 13269, 6443,
+		13262, 6403, 13257, 6366, 13250, 6327, 13245, 6292, 13240, 6257, 13233, 6218, 13227, 6187, 13221, 6153,
+		13215, 6091, 13209, 6029, 13205, 5972, 13198, 5907, 13194, 5854, 13187, 5790, 13181, 5731, 13176, 5680,
+		13171, 5626, 13164, 5575, 13160, 5529, 13154, 5474, 13149, 5427, 13143, 5381, 13137, 5334, 13133, 5294,
+		13127, 5246, 13123, 5208, 13118, 5168, 13112, 5125, 13107, 5061, 13102, 4980, 13096, 4905, 13091, 4835,
+		13086, 4764, 13081, 4699, 13076, 4630, 13071, 4569, 13065, 4508, 13061, 4447, 13056, 4392, 13050, 4331,
+		13047, 4279, 13041, 4224, 13038, 4177, 13032, 4123, 13027, 4054, 13022, 3961, 13018, 3868, 13013, 3785,
+		13008, 3698, 13004, 3615, 12998, 3530, 12995, 3457, 12991, 3382, 12985, 3309, 12981, 3240, 12977, 3170,
+		12973, 3110, 12968, 3013, 12962, 2883, 12959, 2769, 12955, 2660, 12951, 2549, 12946, 2442, 12942, 2342,
+		12938, 2246, 12933, 2149, 12929, 2060, 12925, 1901, 12921, 1734, 12917, 1577, 12913, 1420, 12909, 1273,
+		14481, 15195, 14468, 14825, 14456, 14614, 14445, 14471, 14433, 14365, 14424, 14213, 14415, 14075, 14405, 13945,
+		14396, 13843, 14388, 13749, 14377, 13659, 14371, 13588, 14364, 13521, 14354, 13456, 14346, 13403, 14339, 13352,
+		14328, 13289, 14317, 13205, 14302, 13127, 14287, 13047, 14273, 12974, 14261, 12908, 14250, 12847, 14237, 12790,
+		14224, 12728, 14211, 12675, 14201, 12630, 14187, 12578, 14175, 12535, 14165, 12489, 14153, 12450, 14141, 12411,
+		14132, 12371, 14121, 12337, 14111, 12303, 14100, 12253, 14088, 12186, 14078, 12126, 14070, 12073, 14061, 12020,
+		14051, 11968, 14040, 11914, 14030, 11864, 14021, 11816, 14012, 11770, 14003, 11730, 13994, 11686, 13983, 11642,
+		13976, 11604, 13968, 11567, 13960, 11533, 13949, 11492, 13941, 11462, 13932, 11426, 13926, 11396, 13917, 11364,
+		13908, 11332, 13899, 11305, 13891, 11276, 13885, 11236, 13878, 11182, 13869, 11127, 13861, 11081, 13854, 11034,
+		13846, 10985, 13839, 10938, 13834, 10902, 13825, 10852, 13817, 10811, 13810, 10771, 13803, 10732, 13797, 10693,
+		13790, 10656, 13784, 10622, 13775, 10587, 13769, 10552, 13762, 10515, 13757, 10487, 13750, 10458, 13743, 10424,
+		13736, 10392, 13729, 10362, 13724, 10337, 13718, 10310, 13712, 10283, 13705, 10257, 13700, 10226, 13693, 10169,
+		13688, 10126, 13682, 10080, 13675, 10033, 13668, 9981, 13663, 9944, 13659, 9908, 13654, 9864, 13647, 9820,
+		13641, 9782, 13635, 9742, 13631, 9707, 13625, 9669, 13620, 9637, 13615, 9601, 13610, 9566, 13604, 9531,
+		13598, 9495, 13593, 9466, 13588, 9439, 13584, 9410, 13578, 9377, 13572, 9347, 13568, 9321, 13563, 9293,
+		13559, 9268, 13554, 9242, 13548, 9217, 13543, 9170, 13538, 9118, 13533, 9064, 13529, 9022, 13525, 8984,
+		13520, 8939, 13515, 8894, 13511, 8851, 13506, 8806, 13501, 8770, 13497, 8724, 13492, 8693, 13488, 8654,
+		13484, 8619, 13480, 8583, 13475, 8543, 13471, 8512, 13466, 8478, 13463, 8446, 13458, 8413, 13454, 8385,
+		13450, 8354, 13446, 8323, 13441, 8292, 13437, 8264, 13434, 8239, 13430, 8213, 13426, 8180, 13422, 8130,
+		13418, 8080, 13414, 8028, 13411, 7984, 13407, 7934, 13403, 7887, 13398, 7838, 13395, 7792, 13391, 7755,
+		13387, 7713, 13384, 7672, 13380, 7633, 13378, 7599, 13374, 7557, 13369, 7518, 13366, 7483, 13363, 7447,
+		13359, 7411, 13355, 7376, 13352, 7342, 13348, 7312, 13345, 7277, 13342, 7248, 13338, 7218, 13335, 7187,
+		13331, 7147, 13328, 7095, 13324, 7037, 13321, 6980, 13317, 6930, 13314, 6881, 13311, 6831, 13304, 6777,
+		13299, 6735, 13291, 6685, 13286, 6639, 13280, 6600, 13273, 6553, 13266, 6510, 13260, 6470, 13255, 6429,
+		13248, 6390, 13243, 6352, 13236, 6315, 13230, 6275, 13225, 6243, 13218, 6208, 13212, 6172, 13207, 6134,
+		13201, 6073, 13195, 6008, 13190, 5949, 13185, 5890, 13178, 5827, 13173, 5772, 13167, 5716, 13162, 5661,
+		13155, 5609, 13150, 5558, 13145, 5511, 13140, 5463, 13134, 5412, 13128, 5367, 13124, 5323, 13118, 5278,
+		13113, 5236, 13107, 5193, 13102, 5152, 13097, 5111, 13092, 5033, 13088, 4967, 13082, 4890, 13077, 4820,
+		13072, 4749, 13067, 4679, 13062, 4620, 13056, 4551, 13052, 4494, 13047, 4437, 13041, 4374, 13037, 4323,
+		13032, 4265, 13028, 4216, 13023, 4162, 13018, 4114, 13014, 4041, 13009, 3943, 13004, 3859, 12999, 3767,
+		12996, 3689, 12990, 3599, 12985, 3518, 12981, 3445, 12976, 3367, 12972, 3297, 12967, 3226, 12963, 3163,
+		12959, 3097, 12955, 2997, 12952, 2884, 12946, 2761, 12941, 2648, 12937, 2540, 12933, 2433, 12929, 2335,
+		12924, 2236, 12920, 2145, 12916, 2056, 12912, 1891, 12908, 1728, 12904, 1568, 12899, 1415, 12895, 1268,
+		14479, 15178, 14466, 14814, 14455, 14606, 14443, 14462, 14431, 14358, 14421, 14199, 14413, 14061, 14402, 13929,
+		14394, 13830, 14385, 13735, 14375, 13650, 14368, 13574, 14361, 13512, 14351, 13447, 14344, 13394, 14337, 13342,
+		14324, 13273, 14311, 13189, 14294, 13111, 14282, 13029, 14268, 12962, 14256, 12894, 14243, 12829, 14230, 12772,
+		14218, 12713, 14204, 12660, 14195, 12617, 14181, 12563, 14169, 12519, 14159, 12475, 14146, 12435, 14136, 12401,
+		14125, 12360, 14114, 12324, 14105, 12295, 14093, 12234, 14081, 12167, 14072, 12105, 14064, 12052, 14053, 11999,
+		14043, 11947, 14032, 11898, 14023, 11845, 14014, 11796, 14006, 11751, 13994, 11706, 13985, 11666, 13976, 11626,
+		13969, 11587, 13961, 11551, 13952, 11514, 13941, 11479, 13934, 11447, 13927, 11415, 13919, 11383, 13910, 11351,
+		13900, 11318, 13893, 11292, 13885, 11266, 13878, 11212, 13871, 11162, 13862, 11110, 13853, 11057, 13847, 11011,
+		13839, 10965, 13832, 10919, 13825, 10875, 13818, 10835, 13810, 10792, 13802, 10751, 13796, 10714, 13790, 10677,
+		13782, 10639, 13775, 10603, 13768, 10568, 13762, 10538, 13756, 10502, 13748, 10468, 13742, 10441, 13736, 10411,
+		13729, 10379, 13722, 10351, 13717, 10322, 13711, 10297, 13704, 10271, 13698, 10244, 13692, 10196, 13686, 10148,
+		13679, 10096, 13673, 10052, 13667, 10010, 13661, 9963, 13656, 9916, 13651, 9883, 13646, 9842, 13640, 9802,
+		13633, 9760, 13628, 9724, 13622, 9685, 13617, 9649, 13611, 9612, 13607, 9580, 13601, 9546, 13596, 9514,
+		13590, 9481, 13585, 9447, 13580, 9421, 13576, 9394, 13570, 9364, 13565, 9333, 13560, 9306, 13556, 9280,
+		13551, 9253, 13545, 9228, 13540, 9185, 13536, 9140, 13531, 9096, 13526, 9043, 13521, 8994, 13517, 8952,
+		13512, 8912, 13509, 8875, 13503, 8829, 13498, 8788, 13494, 8746, 13489, 8708, 13485, 8669, 13481, 8635,
+		13477, 8601, 13472, 8566, 13468, 8531, 13463, 8493, 13459, 8463, 13454, 8428, 13450, 8396, 13446, 8367,
+		13442, 8339, 13438, 8310, 13435, 8282, 13431, 8252, 13426, 8225, 13422, 8198, 13418, 8151, 13414, 8101,
+		13411, 8055, 13407, 8008, 13403, 7954, 13399, 7913, 13395, 7865, 13391, 7819, 13387, 7773, 13382, 7726,
+		13379, 7685, 13375, 7648, 13372, 7610, 13368, 7569, 13364, 7533, 13361, 7496, 13358, 7462, 13355, 7428,
+		13351, 7395, 13347, 7359, 13344, 7328, 13341, 7296, 13338, 7266, 13334, 7232, 13330, 7203, 13327, 7174,
+		13324, 7126, 13321, 7066, 13317, 7016, 13314, 6961, 13309, 6906, 13303, 6857, 13297, 6810, 13291, 6763,
+		13283, 6708, 13278, 6669, 13271, 6621, 13264, 6577, 13258, 6535, 13253, 6495, 13246, 6454, 13241, 6416,
+		13234, 6376, 13228, 6335, 13223, 6301, 13216, 6266, 13210, 6228, 13204, 6193, 13198, 6162, 13191, 6106,
+		13186, 6046, 13182, 5990, 13175, 5923, 13169, 5865, 13164, 5813, 13158, 5749, 13152, 5697, 13148, 5650,
+		13142, 5594, 13137, 5546, 13131, 5491, 13125, 5444, 13120, 5403, 13115, 5352, 13109, 5309, 13105, 5268,
+		13099, 5224, 13094, 5183, 13088, 5143, 13083, 5087, 13078, 5013, 13073, 4940, 13068, 4870, 13064, 4803,
+		13058, 4734, 13052, 4667, 13047, 4598, 13044, 4543, 13038, 4479, 13032, 4420, 13028, 4366, 13023, 4310,
+		13019, 4258, 13013, 4202, 13009, 4155, 13004, 4105, 12999, 4014, 12995, 3931, 12990, 3836, 12986, 3755,
+		12981, 3668, 12978, 3593, 12971, 3506, 12968, 3435, 12964, 3362, 12958, 3288, 12954, 3220, 12950, 3152,
+		12945, 3090, 12940, 2985, 12935, 2861, 12931, 2747, 12928, 2641, 12923, 2529, 12919, 2424, 12914, 2324,
+		12910, 2230, 12906, 2138, 12902, 2049, 12898, 1879, 12894, 1719, 12890, 1561, 12886, 1409, 12881, 1264,
+		14477, 15157, 14465, 14801, 14453, 14593, 14441, 14452, 14429, 14354, 14420, 14184, 14411, 14048, 14399, 13914,
+		14391, 13819, 14383, 13722, 14372, 13636, 14366, 13565, 14359, 13498, 14349, 13434, 14342, 13387, 14332, 13330,
+		14320, 13257, 14306, 13174, 14289, 13088, 14277, 13016, 14263, 12944, 14251, 12876, 14237, 12811, 14224, 12755,
+		14212, 12700, 14199, 12646, 14187, 12601, 14175, 12549, 14164, 12507, 14152, 12463, 14140, 12421, 14129, 12385,
+		14119, 12347, 14108, 12313, 14098, 12270, 14087, 12213, 14075, 12147, 14067, 12091, 14057, 12030, 14047, 11979,
+		14036, 11929, 14026, 11877, 14018, 11829, 14007, 11778, 13997, 11731, 13988, 11689, 13978, 11647, 13970, 11608,
+		13962, 11571, 13954, 11534, 13943, 11497, 13936, 11468, 13927, 11432, 13920, 11402, 13910, 11368, 13901, 11335,
+		13894, 11307, 13886, 11280, 13879, 11245, 13871, 11188, 13863, 11135, 13854, 11086, 13846, 11033, 13839, 10986,
+		13833, 10945, 13826, 10900, 13817, 10854, 13810, 10815, 13802, 10771, 13795, 10732, 13789, 10695, 13783, 10660,
+		13775, 10623, 13766, 10584, 13760, 10551, 13755, 10521, 13748, 10487, 13741, 10454, 13734, 10422, 13729, 10398,
+		13722, 10367, 13716, 10338, 13709, 10307, 13703, 10282, 13696, 10256, 13691, 10223, 13685, 10173, 13678, 10122,
+		13672, 10075, 13666, 10032, 13661, 9990, 13655, 9945, 13650, 9902, 13643, 9854, 13637, 9818, 13631, 9778,
+		13626, 9740, 13621, 9704, 13615, 9668, 13610, 9631, 13605, 9597, 13600, 9563, 13594, 9530, 13588, 9498,
+		13583, 9467, 13578, 9435, 13572, 9401, 13568, 9376, 13563, 9349, 13558, 9320, 13553, 9291, 13548, 9265,
+		13542, 9239, 13537, 9209, 13533, 9163, 13528, 9114, 13524, 9070, 13520, 9027, 13514, 8977, 13509, 8929,
+		13504, 8884, 13500, 8846, 13496, 8809, 13492, 8769, 13486, 8727, 13482, 8689, 13478, 8653, 13474, 8613,
+		13469, 8580, 13465, 8547, 13460, 8513, 13456, 8480, 13451, 8444, 13447, 8415, 13443, 8382, 13439, 8351,
+		13435, 8321, 13431, 8295, 13428, 8268, 13423, 8239, 13419, 8211, 13415, 8180, 13411, 8128, 13407, 8077,
+		13402, 8023, 13398, 7976, 13395, 7933, 13391, 7883, 13388, 7840, 13384, 7801, 13380, 7759, 13376, 7714,
+		13372, 7669, 13369, 7631, 13365, 7592, 13361, 7554, 13358, 7515, 13354, 7481, 13351, 7444, 13347, 7411,
+		13343, 7377, 13340, 7346, 13337, 7310, 13334, 7281, 13330, 7249, 13327, 7221, 13322, 7189, 13320, 7153,
+		13317, 7103, 13313, 7046, 13307, 6985, 13303, 6942, 13295, 6889, 13289, 6839, 13282, 6787, 13276, 6741,
+		13268, 6690, 13262, 6646, 13256, 6607, 13250, 6563, 13245, 6518, 13237, 6476, 13231, 6438, 13225, 6398,
+		13219, 6358, 13214, 6326, 13206, 6283, 13201, 6250, 13197, 6218, 13190, 6182, 13184, 6146, 13178, 6090,
+		13173, 6027, 13167, 5965, 13161, 5911, 13155, 5843, 13149, 5785, 13144, 5737, 13138, 5677, 13133, 5627,
+		13128, 5578, 13122, 5526, 13117, 5482, 13112, 5432, 13106, 5384, 13101, 5344, 13094, 5294, 13090, 5254,
+		13086, 5216, 13080, 5172, 13074, 5133, 13069, 5070, 13063, 4987, 13058, 4917, 13053, 4847, 13048, 4781,
+		13044, 4717, 13039, 4651, 13034, 4587, 13029, 4525, 13024, 4466, 13019, 4407, 13014, 4354, 13009, 4298,
+		13004, 4244, 13000, 4194, 12995, 4144, 12990, 4094, 12986, 4002, 12981, 3908, 12977, 3830, 12972, 3739,
+		12967, 3653, 12962, 3573, 12958, 3498, 12954, 3424, 12948, 3348, 12945, 3278, 12940, 3210, 12936, 3147,
+		12931, 3081, 12927, 2968, 12923, 2851, 12918, 2736, 12914, 2624, 12910, 2520, 12905, 2416, 12901, 2317,
+		12897, 2223, 12892, 2130, 12889, 2043, 12884, 1871, 12881, 1712, 12877, 1554, 12873, 1405, 12868, 1259,
+		14476, 15148, 14463, 14790, 14451, 14585, 14440, 14446, 14427, 14343, 14418, 14166, 14408, 14026, 14397, 13902,
+		14389, 13804, 14380, 13706, 14370, 13621, 14363, 13554, 14356, 13486, 14347, 13424, 14340, 13376, 14327, 13321,
+		14316, 13241, 14301, 13154, 14283, 13068, 14270, 12995, 14257, 12928, 14245, 12863, 14231, 12793, 14218, 12740,
+		14207, 12689, 14193, 12632, 14181, 12584, 14168, 12536, 14158, 12495, 14147, 12452, 14135, 12412, 14124, 12374,
+		14112, 12338, 14103, 12302, 14092, 12249, 14079, 12188, 14070, 12128, 14062, 12070, 14050, 12013, 14040, 11957,
+		14029, 11908, 14020, 11859, 14011, 11809, 14002, 11765, 13991, 11719, 13981, 11675, 13973, 11636, 13964, 11594,
+		13956, 11557, 13947, 11521, 13936, 11485, 13928, 11450, 13921, 11418, 13913, 11387, 13904, 11355, 13895, 11325,
+		13887, 11296, 13879, 11266, 13871, 11215, 13865, 11169, 13855, 11112, 13847, 11062, 13840, 11014, 13833, 10968,
+		13825, 10921, 13818, 10878, 13810, 10835, 13802, 10794, 13795, 10757, 13789, 10717, 13782, 10676, 13775, 10641,
+		13768, 10608, 13760, 10569, 13753, 10533, 13748, 10503, 13741, 10473, 13734, 10439, 13727, 10406, 13721, 10379,
+		13714, 10352, 13708, 10323, 13702, 10295, 13694, 10266, 13690, 10244, 13683, 10197, 13677, 10148, 13671, 10097,
+		13665, 10053, 13659, 10004, 13654, 9963, 13648, 9921, 13642, 9880, 13635, 9836, 13629, 9794, 13624, 9757,
+		13619, 9719, 13613, 9682, 13609, 9653, 13603, 9616, 13598, 9579, 13592, 9546, 13586, 9512, 13581, 9480,
+		13576, 9451, 13571, 9421, 13565, 9389, 13560, 9357, 13555, 9333, 13551, 9306, 13546, 9279, 13540, 9252,
+		13535, 9226, 13531, 9185, 13526, 9134, 13522, 9093, 13516, 9043, 13511, 8998, 13507, 8958, 13501, 8908,
+		13496, 8864, 13492, 8824, 13488, 8783, 13484, 8747, 13480, 8712, 13475, 8673, 13471, 8635, 13466, 8598,
+		13461, 8560, 13456, 8526, 13453, 8494, 13449, 8463, 13444, 8430, 13440, 8398, 13436, 8367, 13432, 8337,
+		13428, 8308, 13423, 8276, 13419, 8251, 13415, 8226, 13412, 8199, 13407, 8149, 13404, 8101, 13400, 8056,
+		13395, 8002, 13391, 7951, 13388, 7907, 13384, 7864, 13380, 7817, 13376, 7778, 13373, 7736, 13370, 7697,
+		13366, 7656, 13362, 7612, 13359, 7578, 13355, 7540, 13352, 7504, 13347, 7465, 13344, 7432, 13340, 7396,
+		13337, 7363, 13333, 7329, 13330, 7301, 13326, 7267, 13322, 7233, 13319, 7207, 13317, 7180, 13313, 7130,
+		13306, 7072, 13300, 7021, 13294, 6970, 13286, 6911, 13281, 6867, 13274, 6820, 13268, 6768, 13261, 6720,
+		13255, 6678, 13248, 6631, 13242, 6585, 13237, 6547, 13229, 6504, 13223, 6461, 13217, 6419, 13212, 6383,
+		13205, 6345, 13198, 6307, 13194, 6274, 13188, 6236, 13181, 6202, 13176, 6174, 13169, 6123, 13164, 6062,
+		13158, 6005, 13151, 5941, 13147, 5885, 13142, 5832, 13136, 5771, 13129, 5713, 13125, 5664, 13119, 5609,
+		13113, 5560, 13109, 5516, 13103, 5462, 13096, 5417, 13092, 5372, 13087, 5326, 13081, 5283, 13076, 5242,
+		13070, 5196, 13066, 5160, 13061, 5123, 13056, 5047, 13050, 4971, 13045, 4897, 13040, 4832, 13035, 4763,
+		13030, 4697, 13026, 4639, 13020, 4574, 13015, 4512, 13009, 4452, 13004, 4390, 13001, 4340, 12995, 4284,
+		12991, 4235, 12986, 4181, 12981, 4132, 12977, 4077, 12972, 3984, 12967, 3895, 12962, 3803, 12958, 3726,
+		12953, 3641, 12949, 3561, 12944, 3482, 12939, 3406, 12936, 3340, 12931, 3268, 12927, 3205, 12923, 3136,
+		12917, 3072, 12913, 2954, 12909, 2837, 12904, 2723, 12900, 2614, 12896, 2506, 12892, 2407, 12888, 2311,
+		12883, 2215, 12879, 2123, 12874, 2022, 12871, 1863, 12867, 1698, 12864, 1549, 12859, 1397, 12855, 1254,
+		14474, 15136, 14462, 14779, 14449, 14578, 14438, 14437, 14425, 14327, 14415, 14154, 14407, 14012, 14395, 13885,
+		14387, 13790, 14378, 13695, 14367, 13608, 14361, 13541, 14354, 13475, 14345, 13414, 14337, 13365, 14323, 13308,
+		14311, 13225, 14295, 13136, 14279, 13054, 14266, 12979, 14252, 12914, 14239, 12845, 14225, 12779, 14213, 12727,
+		14201, 12677, 14189, 12621, 14175, 12568, 14163, 12526, 14153, 12484, 14140, 12441, 14128, 12400, 14118, 12362,
+		14107, 12329, 14096, 12291, 14084, 12228, 14072, 12164, 14065, 12112, 14055, 12051, 14044, 11996, 14033, 11939,
+		14022, 11887, 14013, 11839, 14004, 11793, 13996, 11748, 13985, 11704, 13975, 11661, 13966, 11621, 13959, 11584,
+		13950, 11543, 13939, 11506, 13930, 11471, 13921, 11437, 13914, 11405, 13906, 11374, 13897, 11343, 13888, 11312,
+		13880, 11283, 13872, 11246, 13865, 11194, 13857, 11144, 13848, 11094, 13840, 11040, 13833, 10993, 13826, 10947,
+		13818, 10898, 13811, 10860, 13803, 10819, 13796, 10778, 13789, 10736, 13783, 10699, 13776, 10662, 13769, 10625,
+		13760, 10590, 13754, 10554, 13747, 10518, 13740, 10484, 13734, 10457, 13728, 10427, 13720, 10393, 13712, 10361,
+		13708, 10338, 13702, 10310, 13694, 10281, 13689, 10258, 13682, 10222, 13676, 10169, 13670, 10124, 13664, 10078,
+		13658, 10027, 13652, 9986, 13646, 9940, 13640, 9897, 13634, 9858, 13629, 9816, 13622, 9776, 13618, 9743,
+		13612, 9702, 13607, 9666, 13601, 9627, 13596, 9596, 13589, 9560, 13583, 9525, 13578, 9494, 13573, 9463,
+		13569, 9434, 13563, 9406, 13559, 9378, 13553, 9345, 13549, 9316, 13543, 9293, 13537, 9264, 13533, 9239,
+		13528, 9211, 13524, 9161, 13519, 9113, 13513, 9064, 13508, 9018, 13504, 8970, 13499, 8929, 13495, 8890,
+		13490, 8847, 13486, 8805, 13481, 8763, 13476, 8725, 13472, 8689, 13467, 8649, 13463, 8617, 13458, 8582,
+		13454, 8546, 13449, 8508, 13445, 8476, 13441, 8445, 13438, 8416, 13433, 8385, 13429, 8351, 13425, 8325,
+		13421, 8294, 13416, 8265, 13411, 8236, 13407, 8209, 13404, 8177, 13400, 8126, 13395, 8072, 13392, 8023,
+		13389, 7987, 13385, 7938, 13381, 7883, 13377, 7842, 13373, 7800, 13369, 7754, 13365, 7713, 13362, 7670,
+		13358, 7635, 13354, 7598, 13351, 7554, 13347, 7519, 13344, 7483, 13340, 7449, 13336, 7414, 13333, 7381,
+		13330, 7349, 13325, 7313, 13322, 7282, 13319, 7253, 13315, 7223, 13312, 7191, 13305, 7156, 13298, 7103,
+		13292, 7048, 13285, 6995, 13279, 6944, 13273, 6895, 13266, 6841, 13260, 6796, 13254, 6753, 13246, 6700,
+		13240, 6653, 13235, 6612, 13227, 6565, 13221, 6525, 13216, 6488, 13210, 6448, 13203, 6405, 13197, 6366,
+		13190, 6331, 13184, 6291, 13179, 6257, 13173, 6224, 13167, 6191, 13162, 6156, 13156, 6111, 13149, 6042,
+		13143, 5978, 13139, 5923, 13133, 5862, 13127, 5805, 13122, 5754, 13116, 5698, 13110, 5643, 13105, 5595,
+		13098, 5540, 13094, 5493, 13089, 5453, 13082, 5401, 13078, 5358, 13073, 5313, 13067, 5271, 13061, 5226,
+		13058, 5189, 13051, 5145, 13046, 5097, 13041, 5026, 13036, 4951, 13031, 4886, 13026, 4809, 13021, 4746,
+		13016, 4681, 13011, 4617, 13007, 4564, 13001, 4497, 12996, 4439, 12992, 4384, 12986, 4324, 12982, 4275,
+		12977, 4221, 12972, 4174, 12968, 4123, 12962, 4051, 12958, 3969, 12954, 3879, 12949, 3795, 12944, 3706,
+		12940, 3630, 12935, 3547, 12931, 3473, 12927, 3403, 12921, 3328, 12918, 3259, 12913, 3190, 12909, 3129,
+		12904, 3063, 12900, 2939, 12896, 2826, 12891, 2713, 12887, 2604, 12882, 2498, 12878, 2398, 12874, 2300,
+		12870, 2208, 12866, 2118, 12862, 2019, 12858, 1855, 12854, 1691, 12850, 1543, 12846, 1392, 12841, 1249,
+		14473, 15123, 14460, 14763, 14448, 14573, 14436, 14428, 14424, 14314, 14414, 14138, 14404, 13998, 14393, 13874,
+		14386, 13779, 14376, 13682, 14366, 13597, 14359, 13531, 14351, 13462, 14342, 13404, 14332, 13351, 14317, 13286,
+		14306, 13205, 14290, 13121, 14274, 13040, 14260, 12962, 14247, 12896, 14234, 12828, 14221, 12769, 14207, 12708,
+		14195, 12662, 14183, 12607, 14169, 12554, 14158, 12514, 14147, 12470, 14135, 12433, 14122, 12388, 14112, 12350,
+		14102, 12318, 14090, 12272, 14079, 12206, 14066, 12144, 14059, 12094, 14049, 12032, 14038, 11975, 14025, 11917,
+		14016, 11869, 14007, 11821, 13999, 11778, 13988, 11732, 13978, 11686, 13969, 11647, 13962, 11608, 13953, 11569,
+		13944, 11532, 13932, 11493, 13924, 11458, 13916, 11424, 13908, 11391, 13898, 11358, 13891, 11331, 13881, 11300,
+		13873, 11272, 13866, 11224, 13858, 11170, 13849, 11116, 13841, 11070, 13834, 11022, 13827, 10978, 13819, 10929,
+		13811, 10880, 13803, 10837, 13796, 10799, 13788, 10756, 13783, 10721, 13776, 10682, 13768, 10643, 13759, 10605,
+		13753, 10572, 13747, 10540, 13741, 10506, 13733, 10471, 13726, 10439, 13720, 10414, 13713, 10380, 13707, 10349,
+		13700, 10321, 13695, 10299, 13688, 10271, 13681, 10242, 13674, 10193, 13669, 10147, 13663, 10098, 13657, 10054,
+		13651, 10013, 13645, 9963, 13639, 9919, 13633, 9874, 13627, 9838, 13622, 9800, 13616, 9758, 13610, 9720,
+		13605, 9685, 13599, 9646, 13594, 9611, 13587, 9575, 13582, 9546, 13577, 9511, 13572, 9480, 13567, 9448,
+		13561, 9417, 13556, 9387, 13551, 9361, 13546, 9332, 13541, 9302, 13535, 9274, 13531, 9251, 13526, 9225,
+		13522, 9183, 13516, 9136, 13511, 9088, 13506, 9040, 13501, 8995, 13496, 8948, 13491, 8903, 13488, 8865,
+		13483, 8827, 13478, 8784, 13474, 8746, 13469, 8702, 13465, 8667, 13460, 8631, 13455, 8594, 13451, 8560,
+		13447, 8528, 13443, 8495, 13439, 8462, 13434, 8429, 13430, 8397, 13426, 8367, 13422, 8337, 13417, 8304,
+		13413, 8280, 13409, 8255, 13405, 8224, 13401, 8197, 13397, 8150, 13393, 8102, 13389, 8053, 13385, 7999,
+		13381, 7951, 13378, 7915, 13374, 7872, 13370, 7821, 13366, 7778, 13362, 7739, 13358, 7693, 13354, 7650,
+		13350, 7610, 13347, 7577, 13343, 7537, 13339, 7495, 13336, 7464, 13333, 7431, 13329, 7397, 13326, 7363,
+		13322, 7332, 13319, 7302, 13315, 7269, 13311, 7236, 13306, 7210, 13298, 7180, 13290, 7133, 13285, 7079,
+		13278, 7025, 13271, 6975, 13265, 6921, 13258, 6872, 13253, 6824, 13245, 6770, 13239, 6727, 13233, 6681,
+		13227, 6638, 13220, 6592, 13214, 6554, 13207, 6509, 13201, 6466, 13195, 6430, 13190, 6393, 13182, 6353,
+		13177, 6314, 13172, 6283, 13165, 6243, 13158, 6208, 13154, 6178, 13147, 6144, 13141, 6079, 13137, 6026,
+		13132, 5963, 13125, 5903, 13119, 5843, 13113, 5789, 13108, 5732, 13102, 5681, 13096, 5629, 13090, 5574,
+		13086, 5529, 13080, 5478, 13073, 5428, 13070, 5391, 13064, 5341, 13058, 5299, 13054, 5258, 13049, 5218,
+		13043, 5176, 13038, 5138, 13032, 5074, 13027, 5002, 13022, 4932, 13017, 4859, 13012, 4796, 13007, 4725,
+		13003, 4665, 12997, 4605, 12991, 4538, 12988, 4488, 12982, 4425, 12977, 4370, 12974, 4318, 12968, 4261,
+		12964, 4214, 12958, 4161, 12954, 4116, 12949, 4040, 12944, 3946, 12940, 3864, 12935, 3776, 12931, 3692,
+		12926, 3610, 12922, 3536, 12917, 3458, 12912, 3387, 12909, 3319, 12903, 3245, 12900, 3187, 12895, 3118,
+		12891, 3043, 12886, 2928, 12882, 2810, 12878, 2699, 12873, 2593, 12869, 2485, 12865, 2388, 12861, 2295,
+		12856, 2200, 12853, 2111, 12848, 2000, 12844, 1841, 12840, 1680, 12836, 1532, 12832, 1386, 12828, 1244,
+		14472, 15107, 14459, 14754, 14447, 14562, 14434, 14422, 14422, 14298, 14412, 14121, 14402, 13982, 14391, 13864,
+		14384, 13765, 14374, 13669, 14364, 13586, 14357, 13521, 14349, 13455, 14340, 13395, 14327, 13341, 14313, 13272,
+		14300, 13188, 14284, 13099, 14269, 13018, 14255, 12946, 14242, 12881, 14230, 12819, 14214, 12753, 14202, 12693,
+		14188, 12645, 14177, 12596, 14163, 12540, 14153, 12500, 14141, 12457, 14130, 12421, 14117, 12376, 14106, 12339,
+		14095, 12304, 14085, 12256, 14073, 12191, 14061, 12124, 14054, 12072, 14042, 12014, 14031, 11956, 14019, 11900,
+		14010, 11852, 14001, 11804, 13993, 11759, 13982, 11717, 13971, 11671, 13963, 11632, 13955, 11597, 13946, 11556,
+		13936, 11518, 13926, 11480, 13917, 11444, 13910, 11414, 13900, 11377, 13892, 11346, 13883, 11319, 13875, 11289,
+		13868, 11257, 13861, 11205, 13850, 11147, 13842, 11094, 13835, 11048, 13827, 11000, 13820, 10952, 13813, 10910,
+		13804, 10862, 13795, 10817, 13789, 10779, 13783, 10741, 13776, 10699, 13769, 10663, 13760, 10624, 13752, 10588,
+		13747, 10554, 13741, 10524, 13734, 10491, 13726, 10457, 13720, 10425, 13712, 10395, 13707, 10370, 13700, 10338,
+		13693, 10307, 13686, 10280, 13681, 10260, 13674, 10222, 13668, 10170, 13662, 10123, 13656, 10075, 13650, 10028,
+		13644, 9985, 13638, 9944, 13632, 9899, 13625, 9854, 13620, 9816, 13614, 9776, 13610, 9741, 13603, 9699,
+		13597, 9664, 13592, 9630, 13586, 9594, 13580, 9559, 13575, 9526, 13571, 9499, 13566, 9465, 13560, 9432,
+		13554, 9400, 13549, 9372, 13543, 9342, 13539, 9317, 13533, 9289, 13528, 9261, 13523, 9235, 13519, 9209,
+		13514, 9156, 13508, 9103, 13504, 9063, 13499, 9020, 13494, 8969, 13490, 8931, 13485, 8885, 13480, 8840,
+		13475, 8802, 13471, 8765, 13466, 8721, 13462, 8687, 13457, 8646, 13453, 8612, 13448, 8579, 13444, 8542,
+		13440, 8508, 13436, 8478, 13432, 8445, 13427, 8413, 13422, 8381, 13418, 8351, 13414, 8321, 13410, 8292,
+		13405, 8263, 13402, 8238, 13398, 8212, 13395, 8182, 13390, 8126, 13386, 8075, 13381, 8027, 13378, 7979,
+		13374, 7929, 13369, 7879, 13366, 7840, 13363, 7802, 13359, 7759, 13355, 7713, 13351, 7677, 13347, 7637,
+		13344, 7596, 13340, 7557, 13337, 7524, 13333, 7486, 13329, 7447, 13325, 7413, 13322, 7382, 13318, 7349,
+		13315, 7314, 13311, 7285, 13304, 7256, 13297, 7224, 13290, 7195, 13283, 7166, 13278, 7111, 13270, 7051,
+		13264, 7005, 13257, 6951, 13250, 6897, 13245, 6849, 13237, 6798, 13232, 6757, 13225, 6706, 13219, 6665,
+		13212, 6616, 13206, 6577, 13199, 6530, 13193, 6493, 13187, 6454, 13180, 6411, 13175, 6376, 13169, 6336,
+		13163, 6301, 13157, 6265, 13151, 6232, 13146, 6199, 13139, 6163, 13133, 6122, 13127, 6057, 13121, 5992,
+		13116, 5939, 13110, 5881, 13105, 5820, 13100, 5768, 13093, 5715, 13087, 5660, 13082, 5608, 13077, 5560,
+		13072, 5512, 13066, 5464, 13062, 5419, 13055, 5370, 13049, 5328, 13045, 5287, 13039, 5240, 13034, 5202,
+		13030, 5166, 13024, 5124, 13019, 5058, 13013, 4981, 13009, 4915, 13004, 4845, 12998, 4775, 12994, 4713,
+		12987, 4644, 12983, 4585, 12979, 4529, 12973, 4465, 12969, 4415, 12965, 4358, 12959, 4303, 12955, 4256,
+		12950, 4199, 12945, 4154, 12940, 4103, 12936, 4025, 12931, 3932, 12927, 3845, 12922, 3761, 12917, 3677,
+		12913, 3599, 12908, 3518, 12903, 3447, 12900, 3379, 12894, 3305, 12891, 3239, 12886, 3175, 12881, 3112,
+		12877, 3028, 12872, 2907, 12868, 2797, 12864, 2689, 12860, 2580, 12856, 2479, 12851, 2381, 12847, 2284,
+		12843, 2195, 12839, 2105, 12835, 1993, 12830, 1827, 12827, 1674, 12823, 1523, 12819, 1379, 12814, 1239,
+		14470, 15095, 14457, 14744, 14445, 14556, 14432, 14414, 14421, 14285, 14410, 14107, 14400, 13972, 14389, 13849,
+		14382, 13756, 14372, 13661, 14362, 13578, 14356, 13512, 14346, 13445, 14337, 13386, 14322, 13332, 14309, 13258,
+		14295, 13165, 14277, 13080, 14264, 13002, 14249, 12930, 14237, 12864, 14223, 12800, 14209, 12739, 14197, 12682,
+		14184, 12634, 14171, 12583, 14158, 12530, 14147, 12487, 14136, 12446, 14122, 12406, 14111, 12365, 14100, 12327,
+		14090, 12294, 14079, 12240, 14065, 12168, 14056, 12108, 14046, 12045, 14035, 11992, 14024, 11936, 14014, 11886,
+		14004, 11834, 13996, 11790, 13985, 11742, 13976, 11700, 13965, 11655, 13958, 11617, 13948, 11575, 13939, 11539,
+		13929, 11503, 13920, 11468, 13912, 11432, 13903, 11399, 13894, 11366, 13886, 11335, 13876, 11303, 13869, 11279,
+		13861, 11234, 13853, 11178, 13844, 11127, 13836, 11074, 13827, 11022, 13821, 10977, 13813, 10930, 13806, 10887,
+		13797, 10844, 13789, 10799, 13782, 10757, 13776, 10722, 13769, 10684, 13761, 10643, 13752, 10606, 13746, 10571,
+		13740, 10538, 13733, 10505, 13726, 10475, 13719, 10441, 13712, 10408, 13705, 10379, 13700, 10353, 13694, 10327,
+		13686, 10297, 13679, 10265, 13673, 10243, 13668, 10203, 13661, 10146, 13655, 10102, 13648, 10050, 13643, 10007,
+		13636, 9962, 13631, 9919, 13625, 9882, 13619, 9839, 13613, 9797, 13608, 9758, 13602, 9719, 13596, 9685,
+		13590, 9644, 13585, 9611, 13579, 9577, 13574, 9544, 13568, 9506, 13563, 9478, 13558, 9450, 13552, 9419,
+		13547, 9387, 13542, 9357, 13537, 9328, 13531, 9300, 13526, 9277, 13522, 9251, 13517, 9224, 13512, 9182,
+		13507, 9135, 13501, 9087, 13496, 9033, 13492, 8994, 13488, 8952, 13483, 8910, 13479, 8867, 13473, 8824,
+		13468, 8780, 13463, 8742, 13460, 8708, 13454, 8663, 13450, 8629, 13445, 8593, 13442, 8557, 13437, 8524,
+		13432, 8489, 13428, 8458, 13423, 8425, 13419, 8397, 13415, 8366, 13411, 8336, 13407, 8308, 13403, 8279,
+		13399, 8251, 13395, 8222, 13391, 8197, 13387, 8154, 13382, 8100, 13378, 8050, 13375, 8004, 13371, 7961,
+		13366, 7910, 13362, 7860, 13358, 7812, 13355, 7776, 13352, 7736, 13348, 7696, 13344, 7654, 13341, 7620,
+		13338, 7584, 13334, 7544, 13330, 7508, 13327, 7472, 13323, 7438, 13319, 7398, 13315, 7367, 13311, 7336,
+		13305, 7303, 13296, 7268, 13291, 7244, 13282, 7211, 13277, 7184, 13270, 7138, 13263, 7088, 13256, 7034,
+		13249, 6974, 13243, 6929, 13237, 6879, 13230, 6830, 13223, 6779, 13217, 6732, 13211, 6691, 13204, 6643,
+		13198, 6601, 13192, 6557, 13186, 6516, 13179, 6473, 13173, 6435, 13168, 6399, 13161, 6359, 13155, 6323,
+		13149, 6286, 13142, 6251, 13137, 6216, 13131, 6185, 13125, 6153, 13119, 6094, 13114, 6035, 13108, 5977,
+		13102, 5914, 13097, 5861, 13091, 5803, 13084, 5746, 13080, 5696, 13074, 5643, 13068, 5592, 13063, 5541,
+		13058, 5498, 13052, 5447, 13046, 5404, 13041, 5359, 13036, 5313, 13030, 5272, 13026, 5232, 13020, 5188,
+		13016, 5152, 13010, 5111, 13005, 5035, 13002, 4971, 12995, 4891, 12990, 4825, 12985, 4761, 12980, 4696,
+		12975, 4634, 12969, 4566, 12965, 4512, 12960, 4456, 12955, 4395, 12949, 4342, 12946, 4293, 12940, 4236,
+		12935, 4190, 12931, 4139, 12927, 4097, 12921, 4000, 12917, 3911, 12912, 3826, 12907, 3741, 12904, 3665,
+		12898, 3582, 12894, 3508, 12890, 3437, 12885, 3361, 12882, 3295, 12876, 3226, 12872, 3166, 12868, 3101,
+		12863, 3008, 12859, 2896, 12855, 2784, 12850, 2672, 12846, 2571, 12842, 2466, 12838, 2372, 12834, 2277,
+		12830, 2187, 12825, 2098, 12821, 1981, 12817, 1821, 12813, 1662, 12809, 1513, 12805, 1371, 12801, 1234,
+		14469, 15088, 14456, 14735, 14444, 14546, 14431, 14404, 14419, 14264, 14408, 14092, 14398, 13961, 14387, 13835,
+		14380, 13743, 14369, 13646, 14360, 13569, 14353, 13501, 14344, 13438, 14333, 13376, 14318, 13322, 14305, 13242,
+		14290, 13147, 14271, 13062, 14259, 12988, 14245, 12917, 14232, 12850, 14219, 12789, 14204, 12726, 14192, 12670,
+		14179, 12619, 14166, 12569, 14153, 12519, 14142, 12475, 14131, 12437, 14116, 12394, 14105, 12353, 14094, 12316,
+		14083, 12279, 14073, 12218, 14060, 12153, 14051, 12086, 14040, 12026, 14029, 11973, 14018, 11920, 14009, 11872,
+		14000, 11821, 13990, 11776, 13979, 11727, 13968, 11680, 13959, 11641, 13951, 11598, 13942, 11559, 13932, 11526,
+		13922, 11487, 13913, 11452, 13906, 11420, 13896, 11384, 13888, 11354, 13879, 11322, 13870, 11291, 13863, 11267,
+		13855, 11212, 13845, 11155, 13837, 11103, 13830, 11054, 13822, 11007, 13813, 10956, 13807, 10909, 13798, 10865,
+		13791, 10828, 13783, 10784, 13777, 10741, 13769, 10702, 13762, 10666, 13753, 10627, 13746, 10593, 13741, 10557,
+		13734, 10522, 13725, 10488, 13719, 10458, 13713, 10430, 13706, 10397, 13699, 10365, 13693, 10337, 13688, 10316,
+		13679, 10285, 13673, 10255, 13665, 10212, 13661, 10173, 13655, 10127, 13648, 10076, 13641, 10028, 13636, 9983,
+		13630, 9940, 13623, 9898, 13618, 9859, 13612, 9817, 13607, 9777, 13601, 9738, 13595, 9699, 13589, 9663,
+		13583, 9627, 13577, 9592, 13572, 9558, 13567, 9527, 13561, 9493, 13556, 9458, 13550, 9429, 13545, 9401,
+		13540, 9374, 13535, 9344, 13530, 9318, 13524, 9287, 13519, 9262, 13515, 9237, 13509, 9206, 13504, 9151,
+		13499, 9111, 13495, 9062, 13490, 9014, 13485, 8967, 13481, 8928, 13476, 8887, 13471, 8846, 13466, 8802,
+		13461, 8760, 13457, 8720, 13452, 8684, 13448, 8649, 13443, 8609, 13439, 8576, 13435, 8543, 13430, 8507,
+		13425, 8475, 13421, 8440, 13416, 8409, 13412, 8379, 13408, 8349, 13405, 8322, 13400, 8294, 13397, 8267,
+		13392, 8240, 13388, 8211, 13383, 8170, 13379, 8123, 13375, 8075, 13372, 8028, 13368, 7979, 13363, 7934,
+		13360, 7893, 13357, 7846, 13353, 7801, 13348, 7753, 13344, 7714, 13341, 7677, 13337, 7636, 13333, 7596,
+		13329, 7558, 13326, 7525, 13322, 7486, 13319, 7452, 13315, 7419, 13311, 7385, 13303, 7349, 13297, 7319,
+		13290, 7288, 13283, 7258, 13275, 7225, 13269, 7198, 13263, 7168, 13255, 7117, 13248, 7058, 13242, 7010,
+		13236, 6960, 13229, 6900, 13221, 6853, 13216, 6809, 13209, 6760, 13203, 6712, 13196, 6668, 13191, 6629,
+		13184, 6581, 13178, 6540, 13172, 6499, 13166, 6460, 13160, 6421, 13153, 6381, 13147, 6345, 13141, 6307,
+		13135, 6272, 13129, 6240, 13123, 6206, 13117, 6170, 13112, 6140, 13105, 6071, 13099, 6009, 13094, 5954,
+		13089, 5899, 13083, 5838, 13076, 5779, 13072, 5733, 13067, 5677, 13060, 5627, 13055, 5578, 13050, 5528,
+		13043, 5474, 13038, 5434, 13033, 5389, 13028, 5347, 13022, 5304, 13017, 5259, 13012, 5219, 13007, 5181,
+		13001, 5137, 12996, 5084, 12991, 5015, 12985, 4939, 12982, 4876, 12976, 4803, 12971, 4740, 12966, 4680,
+		12961, 4614, 12956, 4555, 12952, 4496, 12946, 4438, 12941, 4384, 12937, 4331, 12931, 4278, 12927, 4229,
+		12922, 4176, 12918, 4133, 12913, 4069, 12909, 3983, 12903, 3893, 12899, 3810, 12895, 3731, 12889, 3644,
+		12886, 3573, 12880, 3494, 12876, 3423, 12872, 3354, 12867, 3281, 12864, 3220, 12858, 3153, 12855, 3094,
+		12850, 2998, 12846, 2879, 12842, 2768, 12838, 2665, 12833, 2557, 12829, 2459, 12824, 2359, 12820, 2267,
+		12817, 2180, 12812, 2092, 12808, 1966, 12804, 1808, 12800, 1655, 12796, 1508, 12792, 1366, 12788, 1228,
+		14468, 15080, 14455, 14727, 14443, 14540, 14429, 14396, 14417, 14250, 14406, 14080, 14397, 13950, 14385, 13820,
+		14378, 13732, 14367, 13634, 14359, 13561, 14351, 13490, 14341, 13427, 14328, 13365, 14314, 13315, 14302, 13230,
+		14285, 13131, 14267, 13047, 14254, 12971, 14240, 12900, 14227, 12831, 14212, 12770, 14200, 12714, 14187, 12660,
+		14174, 12605, 14161, 12557, 14147, 12506, 14137, 12463, 14124, 12424, 14111, 12382, 14101, 12345, 14089, 12306,
+		14078, 12257, 14067, 12192, 14055, 12133, 14045, 12068, 14034, 12006, 14023, 11954, 14012, 11901, 14003, 11853,
+		13994, 11806, 13985, 11759, 13973, 11715, 13962, 11668, 13953, 11624, 13944, 11583, 13936, 11544, 13924, 11505,
+		13916, 11473, 13908, 11439, 13899, 11404, 13890, 11373, 13882, 11341, 13872, 11310, 13864, 11281, 13856, 11237,
+		13849, 11192, 13839, 11133, 13830, 11080, 13823, 11034, 13815, 10985, 13808, 10939, 13799, 10888, 13791, 10849,
+		13784, 10807, 13777, 10768, 13770, 10724, 13763, 10686, 13755, 10649, 13746, 10612, 13740, 10577, 13734, 10543,
+		13727, 10507, 13719, 10474, 13713, 10444, 13705, 10413, 13699, 10385, 13693, 10354, 13686, 10323, 13678, 10296,
+		13673, 10274, 13666, 10246, 13660, 10197, 13653, 10142, 13647, 10100, 13642, 10056, 13635, 10003, 13629, 9961,
+		13623, 9917, 13616, 9874, 13610, 9833, 13605, 9796, 13600, 9760, 13593, 9718, 13587, 9679, 13582, 9643,
+		13576, 9609, 13571, 9574, 13566, 9543, 13561, 9514, 13555, 9479, 13548, 9446, 13543, 9413, 13538, 9385,
+		13534, 9357, 13528, 9330, 13522, 9302, 13517, 9275, 13512, 9246, 13507, 9222, 13502, 9178, 13497, 9132,
+		13492, 9076, 13487, 9039, 13483, 8992, 13478, 8944, 13472, 8898, 13468, 8858, 13463, 8819, 13459, 8782,
+		13455, 8742, 13450, 8702, 13445, 8664, 13440, 8629, 13436, 8594, 13431, 8554, 13427, 8525, 13422, 8488,
+		13419, 8460, 13414, 8428, 13410, 8394, 13406, 8363, 13401, 8334, 13397, 8305, 13393, 8277, 13390, 8253,
+		13385, 8224, 13381, 8201, 13376, 8154, 13372, 8094, 13368, 8048, 13364, 8000, 13360, 7957, 13357, 7909,
+		13353, 7863, 13350, 7827, 13345, 7781, 13342, 7740, 13337, 7694, 13334, 7655, 13330, 7616, 13326, 7576,
+		13321, 7537, 13318, 7501, 13315, 7467, 13310, 7433, 13302, 7396, 13295, 7366, 13289, 7336, 13281, 7298,
+		13275, 7271, 13269, 7244, 13262, 7214, 13254, 7181, 13247, 7146, 13241, 7090, 13234, 7035, 13228, 6983,
+		13222, 6932, 13216, 6889, 13209, 6835, 13201, 6780, 13195, 6740, 13188, 6693, 13182, 6648, 13177, 6605,
+		13171, 6566, 13164, 6523, 13157, 6478, 13151, 6442, 13146, 6405, 13138, 6364, 13133, 6332, 13127, 6296,
+		13121, 6260, 13114, 6222, 13110, 6192, 13104, 6162, 13098, 6110, 13092, 6052, 13087, 5994, 13080, 5930,
+		13074, 5874, 13068, 5816, 13064, 5766, 13058, 5707, 13052, 5657, 13047, 5610, 13040, 5556, 13036, 5513,
+		13030, 5468, 13024, 5414, 13020, 5374, 13014, 5332, 13010, 5289, 13004, 5248, 12999, 5208, 12993, 5168,
+		12988, 5129, 12982, 5060, 12977, 4989, 12973, 4923, 12968, 4852, 12962, 4786, 12958, 4724, 12952, 4659,
+		12947, 4599, 12943, 4539, 12937, 4481, 12933, 4427, 12928, 4368, 12923, 4317, 12918, 4263, 12914, 4217,
+		12909, 4168, 12904, 4117, 12900, 4053, 12894, 3961, 12890, 3876, 12886, 3795, 12880, 3709, 12877, 3633,
+		12871, 3553, 12867, 3482, 12863, 3411, 12858, 3340, 12854, 3273, 12849, 3206, 12845, 3146, 12841, 3083,
+		12837, 2981, 12832, 2869, 12828, 2756, 12824, 2648, 12820, 2548, 12815, 2444, 12811, 2351, 12807, 2261,
+		12803, 2170, 12799, 2084, 12795, 1956, 12790, 1799, 12786, 1643, 12782, 1497, 12779, 1358, 12775, 1223,
+		14467, 15069, 14453, 14719, 14441, 14530, 14427, 14386, 14416, 14232, 14404, 14062, 14395, 13937, 14384, 13810,
+		14376, 13718, 14364, 13620, 14357, 13552, 14349, 13479, 14339, 13416, 14325, 13357, 14309, 13294, 14298, 13215,
+		14282, 13116, 14263, 13032, 14250, 12957, 14235, 12886, 14222, 12819, 14208, 12759, 14196, 12704, 14181, 12645,
+		14168, 12589, 14155, 12544, 14143, 12498, 14131, 12451, 14118, 12410, 14106, 12369, 14095, 12334, 14084, 12295,
+		14073, 12237, 14060, 12173, 14050, 12114, 14039, 12048, 14028, 11989, 14016, 11931, 14006, 11884, 13997, 11834,
+		13988, 11791, 13977, 11740, 13966, 11694, 13957, 11653, 13948, 11610, 13939, 11569, 13927, 11526, 13917, 11490,
+		13910, 11458, 13901, 11424, 13893, 11391, 13884, 11358, 13875, 11327, 13867, 11299, 13858, 11270, 13849, 11215,
+		13841, 11165, 13833, 11115, 13824, 11061, 13817, 11009, 13809, 10964, 13802, 10921, 13793, 10876, 13784, 10826,
+		13778, 10788, 13772, 10750, 13764, 10710, 13756, 10666, 13747, 10631, 13740, 10593, 13734, 10561, 13728, 10528,
+		13719, 10493, 13712, 10458, 13705, 10425, 13699, 10398, 13693, 10370, 13686, 10340, 13679, 10311, 13672, 10282,
+		13666, 10258, 13660, 10228, 13653, 10176, 13646, 10120, 13640, 10072, 13634, 10029, 13628, 9984, 13622, 9938,
+		13615, 9897, 13610, 9852, 13604, 9815, 13598, 9773, 13592, 9737, 13587, 9703, 13581, 9661, 13575, 9628,
+		13570, 9592, 13563, 9555, 13558, 9522, 13554, 9493, 13547, 9462, 13542, 9431, 13536, 9398, 13532, 9369,
+		13526, 9341, 13521, 9315, 13516, 9289, 13511, 9261, 13506, 9235, 13500, 9198, 13495, 9155, 13490, 9103,
+		13486, 9061, 13480, 9008, 13476, 8975, 13471, 8927, 13466, 8880, 13461, 8837, 13456, 8795, 13453, 8758,
+		13448, 8723, 13443, 8685, 13438, 8647, 13434, 8611, 13429, 8574, 13424, 8539, 13420, 8502, 13416, 8473,
+		13412, 8441, 13408, 8411, 13404, 8381, 13398, 8349, 13394, 8319, 13390, 8290, 13386, 8262, 13381, 8234,
+		13377, 8209, 13374, 8182, 13370, 8132, 13366, 8080, 13362, 8026, 13357, 7982, 13354, 7932, 13350, 7888,
+		13346, 7841, 13341, 7795, 13338, 7760, 13334, 7719, 13330, 7675, 13327, 7634, 13323, 7601, 13319, 7563,
+		13316, 7522, 13312, 7488, 13305, 7454, 13298, 7419, 13290, 7386, 13282, 7349, 13276, 7320, 13269, 7291,
+		13262, 7256, 13254, 7226, 13248, 7200, 13241, 7172, 13234, 7118, 13228, 7065, 13221, 7010, 13215, 6962,
+		13207, 6908, 13201, 6860, 13194, 6813, 13189, 6768, 13181, 6715, 13176, 6675, 13170, 6631, 13163, 6587,
+		13156, 6546, 13150, 6507, 13144, 6467, 13138, 6426, 13130, 6386, 13126, 6353, 13120, 6315, 13115, 6281,
+		13108, 6247, 13102, 6213, 13094, 6174, 13089, 6145, 13084, 6092, 13078, 6025, 13073, 5969, 13067, 5914,
+		13062, 5856, 13056, 5802, 13050, 5745, 13044, 5693, 13038, 5637, 13034, 5591, 13028, 5544, 13022, 5494,
+		13016, 5447, 13012, 5404, 13006, 5359, 13000, 5315, 12996, 5276, 12989, 5234, 12984, 5192, 12979, 5155,
+		12974, 5115, 12970, 5047, 12963, 4966, 12959, 4900, 12953, 4837, 12949, 4766, 12944, 4704, 12938, 4641,
+		12934, 4579, 12929, 4524, 12924, 4468, 12919, 4407, 12915, 4359, 12909, 4302, 12905, 4255, 12899, 4203,
+		12895, 4155, 12891, 4111, 12886, 4028, 12882, 3945, 12877, 3859, 12872, 3773, 12868, 3695, 12862, 3612,
+		12859, 3543, 12854, 3470, 12849, 3398, 12845, 3329, 12840, 3262, 12837, 3201, 12833, 3136, 12827, 3076,
+		12823, 2963, 12819, 2848, 12815, 2741, 12811, 2637, 12807, 2536, 12802, 2434, 12798, 2343, 12794, 2251,
+		12789, 2162, 12785, 2077, 12781, 1942, 12777, 1785, 12773, 1632, 12769, 1490, 12766, 1352, 12761, 1217,
+		14466, 15058, 14452, 14708, 14439, 14522, 14426, 14381, 14414, 14221, 14403, 14052, 14393, 13921, 14382, 13798,
+		14375, 13703, 14362, 13611, 14355, 13542, 14347, 13471, 14337, 13408, 14321, 13349, 14305, 13277, 14294, 13195,
+		14277, 13100, 14259, 13016, 14244, 12939, 14230, 12870, 14217, 12802, 14203, 12744, 14191, 12689, 14175, 12630,
+		14161, 12572, 14150, 12531, 14139, 12489, 14125, 12438, 14111, 12396, 14101, 12360, 14090, 12325, 14078, 12288,
+		14067, 12213, 14054, 12153, 14045, 12095, 14034, 12031, 14023, 11971, 14010, 11917, 14001, 11870, 13992, 11818,
+		13982, 11770, 13970, 11724, 13960, 11680, 13952, 11640, 13942, 11597, 13933, 11555, 13922, 11514, 13912, 11476,
+		13904, 11446, 13895, 11412, 13886, 11379, 13878, 11345, 13869, 11317, 13860, 11288, 13852, 11247, 13844, 11197,
+		13835, 11141, 13826, 11094, 13818, 11040, 13810, 10989, 13803, 10943, 13795, 10898, 13786, 10855, 13779, 10811,
+		13771, 10766, 13764, 10728, 13757, 10692, 13749, 10651, 13740, 10613, 13735, 10580, 13728, 10545, 13720, 10511,
+		13713, 10480, 13705, 10442, 13699, 10412, 13692, 10382, 13687, 10356, 13680, 10328, 13672, 10299, 13665, 10270,
+		13659, 10244, 13654, 10205, 13647, 10153, 13640, 10103, 13633, 10048, 13627, 10005, 13621, 9964, 13615, 9919,
+		13609, 9875, 13603, 9839, 13598, 9794, 13591, 9754, 13585, 9716, 13580, 9680, 13574, 9646, 13568, 9608,
+		13563, 9576, 13557, 9541, 13552, 9505, 13546, 9474, 13540, 9445, 13535, 9416, 13531, 9388, 13525, 9356,
+		13519, 9327, 13513, 9298, 13509, 9272, 13504, 9246, 13499, 9222, 13493, 9178, 13489, 9128, 13484, 9082,
+		13479, 9033, 13474, 8989, 13469, 8940, 13465, 8908, 13460, 8863, 13455, 8819, 13450, 8778, 13445, 8737,
+		13440, 8698, 13435, 8663, 13431, 8625, 13427, 8590, 13423, 8559, 13418, 8523, 13413, 8490, 13409, 8456,
+		13405, 8423, 13400, 8393, 13396, 8365, 13391, 8335, 13388, 8306, 13384, 8278, 13379, 8249, 13374, 8221,
+		13370, 8194, 13367, 8148, 13363, 8100, 13359, 8054, 13355, 8008, 13351, 7956, 13347, 7912, 13342, 7864,
+		13339, 7821, 13334, 7775, 13330, 7730, 13327, 7696, 13324, 7659, 13320, 7619, 13316, 7578, 13313, 7544,
+		13306, 7508, 13300, 7473, 13291, 7437, 13285, 7405, 13278, 7374, 13271, 7342, 13263, 7305, 13255, 7274,
+		13249, 7248, 13241, 7214, 13234, 7186, 13227, 7147, 13221, 7096, 13214, 7039, 13208, 6990, 13200, 6937,
+		13194, 6888, 13187, 6837, 13181, 6792, 13175, 6746, 13168, 6701, 13162, 6655, 13155, 6611, 13148, 6571,
+		13143, 6528, 13137, 6488, 13130, 6451, 13124, 6412, 13118, 6372, 13111, 6334, 13106, 6302, 13099, 6266,
+		13093, 6230, 13088, 6199, 13082, 6169, 13075, 6120, 13071, 6063, 13064, 6002, 13058, 5943, 13053, 5887,
+		13047, 5835, 13042, 5780, 13036, 5725, 13031, 5674, 13025, 5622, 13018, 5567, 13014, 5523, 13009, 5481,
+		13003, 5430, 12997, 5388, 12993, 5346, 12987, 5301, 12981, 5262, 12976, 5220, 12972, 5183, 12966, 5143,
+		12961, 5093, 12956, 5021, 12951, 4954, 12946, 4882, 12941, 4816, 12935, 4754, 12930, 4686, 12926, 4625,
+		12920, 4566, 12915, 4506, 12911, 4452, 12906, 4399, 12901, 4343, 12897, 4298, 12891, 4243, 12887, 4193,
+		12882, 4145, 12877, 4095, 12873, 4017, 12867, 3920, 12863, 3838, 12859, 3758, 12854, 3680, 12850, 3605,
+		12845, 3529, 12841, 3457, 12836, 3385, 12832, 3318, 12828, 3254, 12823, 3189, 12818, 3126, 12814, 3059,
+		12811, 2952, 12806, 2836, 12802, 2732, 12797, 2620, 12793, 2522, 12789, 2425, 12785, 2334, 12781, 2242,
+		12777, 2155, 12772, 2069, 12768, 1929, 12764, 1776, 12760, 1626, 12756, 1482, 12752, 1345, 12748, 1211,
+		14465, 15043, 14451, 14699, 14438, 14513, 14425, 14371, 14413, 14206, 14402, 14040, 14392, 13911, 14381, 13790,
+		14372, 13688, 14360, 13604, 14353, 13533, 14345, 13460, 14335, 13398, 14318, 13342, 14300, 13255, 14289, 13173,
+		14271, 13084, 14255, 13003, 14240, 12924, 14226, 12853, 14212, 12789, 14199, 12732, 14186, 12675, 14171, 12617,
+		14157, 12563, 14145, 12517, 14135, 12478, 14120, 12427, 14105, 12383, 14096, 12347, 14085, 12314, 14073, 12268,
+		14061, 12192, 14048, 12131, 14039, 12073, 14029, 12016, 14017, 11958, 14006, 11901, 13996, 11850, 13986, 11801,
+		13975, 11750, 13964, 11705, 13955, 11664, 13946, 11625, 13937, 11583, 13926, 11542, 13916, 11504, 13906, 11464,
+		13898, 11431, 13890, 11400, 13881, 11367, 13872, 11335, 13862, 11303, 13854, 11276, 13847, 11232, 13837, 11174,
+		13828, 11115, 13820, 11071, 13812, 11019, 13804, 10970, 13796, 10919, 13787, 10878, 13780, 10836, 13774, 10799,
+		13766, 10749, 13758, 10711, 13750, 10673, 13741, 10636, 13735, 10595, 13728, 10561, 13721, 10528, 13713, 10494,
+		13706, 10462, 13700, 10433, 13692, 10398, 13686, 10366, 13680, 10342, 13673, 10315, 13666, 10287, 13659, 10258,
+		13653, 10221, 13646, 10173, 13641, 10132, 13633, 10078, 13628, 10033, 13621, 9983, 13615, 9939, 13608, 9899,
+		13602, 9857, 13597, 9815, 13591, 9779, 13584, 9735, 13579, 9699, 13573, 9663, 13567, 9625, 13562, 9592,
+		13557, 9560, 13551, 9525, 13545, 9492, 13538, 9456, 13533, 9427, 13529, 9400, 13524, 9372, 13518, 9343,
+		13511, 9312, 13507, 9286, 13502, 9259, 13497, 9234, 13492, 9198, 13487, 9151, 13482, 9105, 13477, 9056,
+		13472, 9012, 13467, 8964, 13462, 8920, 13457, 8877, 13453, 8842, 13448, 8799, 13444, 8759, 13438, 8718,
+		13433, 8680, 13428, 8640, 13425, 8612, 13420, 8574, 13415, 8537, 13411, 8507, 13407, 8474, 13403, 8442,
+		13398, 8406, 13393, 8377, 13388, 8345, 13385, 8320, 13381, 8292, 13376, 8263, 13372, 8239, 13368, 8210,
+		13364, 8174, 13360, 8121, 13356, 8070, 13351, 8023, 13348, 7978, 13344, 7932, 13339, 7886, 13336, 7847,
+		13332, 7799, 13328, 7759, 13325, 7717, 13321, 7674, 13317, 7638, 13313, 7600, 13307, 7561, 13298, 7521,
+		13292, 7489, 13284, 7455, 13276, 7418, 13270, 7385, 13263, 7357, 13256, 7324, 13249, 7294, 13241, 7259,
+		13234, 7231, 13228, 7204, 13220, 7172, 13214, 7122, 13207, 7065, 13201, 7017, 13193, 6965, 13187, 6918,
+		13180, 6864, 13175, 6821, 13168, 6770, 13160, 6723, 13155, 6681, 13148, 6639, 13141, 6593, 13135, 6550,
+		13129, 6510, 13123, 6472, 13116, 6431, 13111, 6396, 13105, 6359, 13098, 6321, 13091, 6285, 13087, 6252,
+		13081, 6218, 13074, 6185, 13068, 6152, 13063, 6107, 13057, 6037, 13051, 5981, 13045, 5926, 13039, 5865,
+		13034, 5810, 13028, 5759, 13023, 5709, 13017, 5654, 13011, 5604, 13006, 5556, 13000, 5506, 12994, 5458,
+		12990, 5420, 12985, 5371, 12978, 5328, 12974, 5291, 12968, 5245, 12963, 5207, 12957, 5169, 12953, 5132,
+		12948, 5068, 12942, 4999, 12937, 4928, 12932, 4864, 12926, 4793, 12922, 4729, 12917, 4670, 12912, 4613,
+		12906, 4547, 12903, 4495, 12897, 4435, 12893, 4383, 12887, 4332, 12882, 4279, 12879, 4234, 12873, 4181,
+		12869, 4136, 12865, 4087, 12859, 3991, 12855, 3913, 12850, 3820, 12846, 3747, 12841, 3664, 12836, 3588,
+		12832, 3517, 12827, 3441, 12824, 3378, 12819, 3305, 12814, 3240, 12810, 3180, 12806, 3117, 12801, 3046,
+		12797, 2934, 12792, 2817, 12789, 2717, 12784, 2609, 12780, 2513, 12775, 2413, 12772, 2323, 12768, 2233,
+		12763, 2148, 12759, 2064, 12755, 1916, 12751, 1763, 12747, 1615, 12743, 1472, 12739, 1336, 12735, 1205,
+		14464, 15032, 14449, 14687, 14436, 14501, 14424, 14365, 14411, 14187, 14400, 14026, 14390, 13896, 14378, 13776,
+		14370, 13679, 14359, 13594, 14351, 13522, 14343, 13452, 14331, 13390, 14313, 13333, 14296, 13238, 14284, 13153,
+		14267, 13069, 14251, 12986, 14235, 12911, 14222, 12843, 14207, 12776, 14193, 12715, 14180, 12661, 14167, 12606,
+		14152, 12551, 14140, 12505, 14130, 12467, 14115, 12419, 14101, 12373, 14091, 12337, 14080, 12303, 14068, 12250,
+		14054, 12173, 14043, 12109, 14035, 12052, 14023, 11997, 14011, 11937, 14001, 11885, 13990, 11834, 13980, 11784,
+		13969, 11733, 13959, 11690, 13949, 11647, 13941, 11611, 13931, 11571, 13921, 11530, 13911, 11495, 13902, 11457,
+		13893, 11418, 13884, 11388, 13875, 11356, 13866, 11323, 13857, 11294, 13849, 11264, 13840, 11207, 13830, 11149,
+		13822, 11097, 13813, 11043, 13807, 11003, 13799, 10952, 13790, 10905, 13781, 10862, 13774, 10817, 13767, 10779,
+		13759, 10736, 13751, 10691, 13743, 10654, 13735, 10621, 13729, 10583, 13721, 10542, 13714, 10513, 13707, 10481,
+		13701, 10449, 13694, 10421, 13687, 10387, 13679, 10355, 13672, 10324, 13665, 10300, 13659, 10275, 13653, 10247,
+		13646, 10198, 13639, 10145, 13633, 10102, 13627, 10058, 13621, 10012, 13615, 9964, 13608, 9919, 13602, 9876,
+		13597, 9839, 13591, 9799, 13584, 9755, 13579, 9721, 13573, 9681, 13566, 9644, 13561, 9609, 13555, 9574,
+		13549, 9539, 13544, 9510, 13538, 9478, 13533, 9444, 13527, 9409, 13522, 9381, 13516, 9355, 13510, 9328,
+		13506, 9302, 13501, 9271, 13496, 9246, 13490, 9220, 13485, 9179, 13480, 9128, 13476, 9082, 13470, 9035,
+		13465, 8984, 13460, 8945, 13455, 8900, 13450, 8852, 13446, 8813, 13441, 8781, 13436, 8737, 13431, 8698,
+		13426, 8658, 13423, 8625, 13418, 8588, 13414, 8558, 13409, 8522, 13404, 8485, 13401, 8458, 13395, 8424,
+		13391, 8395, 13386, 8361, 13382, 8331, 13378, 8302, 13374, 8276, 13370, 8250, 13365, 8221, 13362, 8199,
+		13357, 8151, 13353, 8098, 13348, 8044, 13345, 7998, 13340, 7950, 13337, 7908, 13333, 7866, 13329, 7817,
+		13326, 7783, 13322, 7741, 13318, 7698, 13314, 7658, 13308, 7616, 13300, 7581, 13293, 7545, 13286, 7509,
+		13277, 7467, 13269, 7433, 13263, 7404, 13255, 7367, 13247, 7334, 13241, 7308, 13234, 7277, 13228, 7246,
+		13220, 7217, 13213, 7188, 13208, 7155, 13200, 7096, 13193, 7043, 13186, 6992, 13180, 6946, 13174, 6893,
+		13167, 6843, 13160, 6794, 13154, 6754, 13148, 6707, 13141, 6657, 13135, 6619, 13128, 6576, 13122, 6533,
+		13116, 6494, 13109, 6454, 13104, 6417, 13097, 6376, 13090, 6341, 13085, 6310, 13078, 6271, 13072, 6237,
+		13067, 6207, 13061, 6174, 13056, 6140, 13049, 6071, 13044, 6023, 13037, 5957, 13032, 5900, 13026, 5846,
+		13020, 5793, 13015, 5736, 13009, 5683, 13004, 5639, 12998, 5585, 12993, 5540, 12988, 5493, 12981, 5445,
+		12976, 5399, 12971, 5360, 12965, 5315, 12960, 5274, 12955, 5235, 12949, 5195, 12945, 5157, 12940, 5121,
+		12934, 5049, 12930, 4980, 12924, 4909, 12917, 4838, 12914, 4777, 12909, 4712, 12903, 4651, 12899, 4596,
+		12894, 4538, 12888, 4476, 12884, 4425, 12879, 4369, 12874, 4319, 12870, 4268, 12864, 4215, 12861, 4173,
+		12856, 4125, 12851, 4064, 12847, 3979, 12841, 3888, 12838, 3813, 12833, 3731, 12828, 3651, 12823, 3575,
+		12819, 3500, 12815, 3434, 12810, 3359, 12805, 3295, 12801, 3233, 12796, 3168, 12792, 3109, 12788, 3029,
+		12784, 2914, 12778, 2800, 12775, 2700, 12771, 2598, 12767, 2503, 12762, 2403, 12758, 2311, 12754, 2223,
+		12750, 2138, 12747, 2058, 12742, 1909, 12738, 1754, 12734, 1607, 12730, 1463, 12726, 1328, 12722, 1200,
+		14463, 15021, 14448, 14680, 14435, 14492, 14423, 14360, 14409, 14170, 14399, 14013, 14388, 13884, 14377, 13764,
+		14368, 13668, 14357, 13582, 14349, 13508, 14341, 13441, 14329, 13384, 14310, 13325, 14293, 13220, 14279, 13132,
+		14260, 13050, 14246, 12967, 14231, 12896, 14218, 12831, 14203, 12761, 14189, 12701, 14175, 12648, 14162, 12595,
+		14148, 12541, 14135, 12492, 14124, 12454, 14110, 12408, 14096, 12361, 14086, 12326, 14074, 12291, 14064, 12235,
+		14049, 12159, 14038, 12090, 14029, 12033, 14017, 11977, 14005, 11924, 13995, 11869, 13985, 11817, 13974, 11768,
+		13963, 11720, 13953, 11673, 13944, 11632, 13935, 11594, 13926, 11559, 13915, 11519, 13906, 11480, 13897, 11445,
+		13887, 11408, 13877, 11373, 13869, 11343, 13860, 11312, 13851, 11283, 13842, 11240, 13833, 11183, 13824, 11130,
+		13816, 11078, 13808, 11024, 13800, 10983, 13793, 10931, 13783, 10885, 13775, 10839, 13768, 10797, 13761, 10757,
+		13754, 10722, 13745, 10674, 13735, 10636, 13730, 10602, 13724, 10571, 13716, 10533, 13707, 10495, 13701, 10466,
+		13694, 10433, 13687, 10404, 13681, 10374, 13673, 10343, 13664, 10311, 13658, 10282, 13652, 10259, 13647, 10231,
+		13641, 10179, 13632, 10123, 13626, 10075, 13620, 10035, 13614, 9988, 13608, 9946, 13602, 9901, 13596, 9859,
+		13589, 9817, 13583, 9775, 13577, 9736, 13572, 9701, 13566, 9664, 13560, 9627, 13554, 9592, 13548, 9555,
+		13542, 9522, 13537, 9491, 13532, 9460, 13527, 9433, 13521, 9401, 13515, 9366, 13508, 9338, 13504, 9313,
+		13500, 9287, 13494, 9259, 13489, 9233, 13483, 9196, 13478, 9147, 13473, 9102, 13468, 9056, 13463, 9012,
+		13459, 8968, 13454, 8924, 13449, 8882, 13444, 8836, 13439, 8791, 13434, 8754, 13429, 8720, 13425, 8683,
+		13421, 8643, 13415, 8606, 13411, 8572, 13406, 8536, 13402, 8506, 13397, 8468, 13393, 8436, 13389, 8411,
+		13384, 8380, 13381, 8352, 13376, 8320, 13371, 8288, 13367, 8260, 13363, 8236, 13359, 8209, 13354, 8170,
+		13351, 8124, 13346, 8071, 13342, 8025, 13338, 7975, 13334, 7932, 13330, 7883, 13326, 7838, 13322, 7801,
+		13318, 7753, 13315, 7719, 13309, 7675, 13302, 7638, 13295, 7603, 13287, 7562, 13279, 7525, 13272, 7492,
+		13265, 7458, 13258, 7419, 13250, 7388, 13243, 7356, 13235, 7323, 13228, 7290, 13222, 7261, 13215, 7234,
+		13208, 7205, 13200, 7174, 13193, 7124, 13187, 7071, 13179, 7019, 13173, 6966, 13167, 6917, 13161, 6875,
+		13153, 6824, 13147, 6778, 13141, 6726, 13134, 6686, 13128, 6645, 13120, 6596, 13114, 6553, 13109, 6519,
+		13102, 6479, 13096, 6437, 13091, 6401, 13083, 6365, 13077, 6326, 13071, 6290, 13066, 6262, 13059, 6226,
+		13053, 6190, 13049, 6162, 13043, 6117, 13036, 6057, 13030, 5991, 13024, 5939, 13018, 5878, 13011, 5822,
+		13008, 5774, 13002, 5719, 12996, 5666, 12989, 5611, 12984, 5570, 12979, 5519, 12973, 5472, 12969, 5432,
+		12963, 5386, 12957, 5343, 12953, 5304, 12947, 5260, 12941, 5220, 12937, 5184, 12931, 5145, 12925, 5093,
+		12922, 5031, 12916, 4956, 12910, 4891, 12906, 4825, 12900, 4756, 12895, 4696, 12891, 4638, 12885, 4574,
+		12880, 4520, 12876, 4466, 12870, 4408, 12866, 4361, 12862, 4305, 12856, 4253, 12852, 4206, 12847, 4157,
+		12842, 4115, 12838, 4042, 12832, 3953, 12828, 3871, 12824, 3790, 12819, 3711, 12814, 3632, 12810, 3557,
+		12806, 3492, 12801, 3415, 12797, 3352, 12792, 3283, 12787, 3218, 12784, 3160, 12779, 3095, 12775, 3013,
+		12770, 2897, 12766, 2789, 12762, 2686, 12757, 2583, 12754, 2490, 12750, 2397, 12745, 2302, 12741, 2215,
+		12737, 2132, 12733, 2050, 12729, 1892, 12724, 1741, 12721, 1594, 12717, 1456, 12713, 1322, 12709, 1193,
+		14462, 15011, 14447, 14671, 14434, 14484, 14422, 14353, 14408, 14160, 14398, 13998, 14386, 13872, 14376, 13754,
+		14366, 13657, 14355, 13573, 14347, 13497, 14339, 13430, 14323, 13373, 14304, 13314, 14289, 13207, 14275, 13118,
+		14255, 13037, 14241, 12954, 14226, 12881, 14213, 12813, 14198, 12749, 14184, 12686, 14170, 12633, 14156, 12581,
+		14144, 12530, 14131, 12481, 14119, 12439, 14104, 12398, 14093, 12354, 14081, 12317, 14069, 12276, 14057, 12210,
+		14044, 12144, 14034, 12076, 14022, 12013, 14012, 11961, 14000, 11905, 13990, 11851, 13980, 11800, 13969, 11753,
+		13957, 11704, 13947, 11659, 13938, 11619, 13929, 11578, 13919, 11539, 13909, 11503, 13901, 11470, 13891, 11432,
+		13881, 11396, 13872, 11361, 13863, 11329, 13854, 11301, 13845, 11271, 13836, 11220, 13827, 11162, 13819, 11109,
+		13810, 11056, 13802, 11006, 13794, 10958, 13787, 10916, 13776, 10865, 13769, 10822, 13762, 10779, 13754, 10737,
+		13746, 10699, 13738, 10660, 13730, 10619, 13724, 10583, 13717, 10554, 13709, 10519, 13702, 10484, 13694, 10447,
+		13688, 10418, 13681, 10387, 13674, 10361, 13666, 10331, 13659, 10300, 13653, 10272, 13647, 10247, 13640, 10206,
+		13633, 10153, 13627, 10104, 13620, 10054, 13614, 10010, 13609, 9967, 13601, 9920, 13595, 9881, 13589, 9837,
+		13582, 9794, 13577, 9757, 13571, 9718, 13565, 9681, 13560, 9647, 13553, 9609, 13547, 9575, 13542, 9541,
+		13536, 9505, 13530, 9474, 13525, 9444, 13520, 9415, 13515, 9388, 13508, 9355, 13502, 9323, 13498, 9298,
+		13493, 9273, 13488, 9247, 13482, 9221, 13477, 9176, 13472, 9123, 13466, 9072, 13462, 9029, 13457, 8985,
+		13452, 8940, 13447, 8902, 13442, 8858, 13438, 8821, 13431, 8774, 13426, 8729, 13422, 8697, 13419, 8663,
+		13414, 8628, 13409, 8588, 13404, 8555, 13400, 8520, 13395, 8486, 13391, 8456, 13386, 8418, 13381, 8386,
+		13378, 8363, 13374, 8336, 13370, 8308, 13365, 8278, 13360, 8246, 13355, 8218, 13352, 8195, 13348, 8142,
+		13343, 8094, 13340, 8051, 13336, 8000, 13332, 7957, 13328, 7909, 13324, 7865, 13320, 7821, 13316, 7777,
+		13311, 7736, 13303, 7691, 13296, 7657, 13288, 7617, 13280, 7579, 13273, 7541, 13266, 7507, 13262, 7479,
+		13254, 7445, 13245, 7408, 13237, 7374, 13231, 7344, 13224, 7311, 13216, 7280, 13208, 7248, 13201, 7218,
+		13195, 7194, 13188, 7161, 13180, 7101, 13173, 7048, 13167, 6996, 13160, 6945, 13153, 6894, 13146, 6845,
+		13141, 6805, 13135, 6757, 13127, 6709, 13120, 6662, 13114, 6622, 13109, 6585, 13101, 6537, 13094, 6496,
+		13090, 6464, 13083, 6424, 13076, 6384, 13069, 6347, 13064, 6313, 13058, 6280, 13051, 6242, 13047, 6214,
+		13041, 6181, 13033, 6144, 13028, 6090, 13022, 6030, 13016, 5972, 13011, 5913, 13005, 5861, 13000, 5805,
+		12994, 5750, 12988, 5700, 12983, 5650, 12977, 5600, 12970, 5546, 12966, 5507, 12961, 5460, 12954, 5411,
+		12949, 5371, 12945, 5329, 12939, 5286, 12934, 5252, 12928, 5207, 12923, 5170, 12917, 5133, 12913, 5073,
+		12907, 5000, 12902, 4939, 12898, 4871, 12893, 4806, 12887, 4741, 12882, 4676, 12877, 4615, 12873, 4565,
+		12867, 4502, 12862, 4449, 12858, 4397, 12853, 4341, 12848, 4292, 12844, 4246, 12839, 4194, 12833, 4146,
+		12829, 4100, 12824, 4020, 12820, 3937, 12815, 3851, 12811, 3774, 12806, 3693, 12801, 3618, 12797, 3547,
+		12792, 3469, 12788, 3404, 12784, 3338, 12779, 3275, 12775, 3211, 12770, 3147, 12765, 3090, 12762, 2990,
+		12758, 2881, 12754, 2779, 12749, 2674, 12745, 2572, 12741, 2476, 12736, 2381, 12732, 2293, 12728, 2206,
+		12724, 2123, 12720, 2032, 12716, 1878, 12712, 1734, 12708, 1588, 12704, 1448, 12700, 1315, 12696, 1187,
+		14461, 14997, 14447, 14666, 14433, 14475, 14418, 14345, 14407, 14149, 14397, 13987, 14385, 13856, 14374, 13743,
+		14364, 13647, 14354, 13564, 14346, 13485, 14337, 13421, 14318, 13360, 14301, 13299, 14286, 13194, 14271, 13101,
+		14252, 13022, 14238, 12941, 14222, 12865, 14209, 12798, 14194, 12735, 14180, 12674, 14165, 12621, 14152, 12568,
+		14139, 12516, 14126, 12469, 14113, 12425, 14099, 12388, 14088, 12344, 14076, 12305, 14064, 12252, 14051, 12186,
+		14039, 12123, 14029, 12055, 14018, 11996, 14006, 11940, 13995, 11888, 13984, 11835, 13974, 11782, 13964, 11737,
+		13953, 11692, 13943, 11647, 13933, 11602, 13923, 11562, 13913, 11526, 13903, 11487, 13894, 11451, 13884, 11416,
+		13875, 11382, 13866, 11348, 13857, 11317, 13848, 11288, 13839, 11252, 13830, 11197, 13821, 11142, 13813, 11089,
+		13805, 11035, 13796, 10987, 13789, 10933, 13779, 10895, 13771, 10849, 13764, 10804, 13756, 10759, 13748, 10721,
+		13740, 10682, 13732, 10648, 13725, 10605, 13718, 10568, 13710, 10533, 13702, 10502, 13695, 10469, 13688, 10436,
+		13681, 10404, 13674, 10373, 13667, 10345, 13660, 10319, 13653, 10288, 13647, 10261, 13640, 10227, 13633, 10179,
+		13627, 10132, 13620, 10081, 13614, 10034, 13608, 9984, 13601, 9945, 13595, 9902, 13589, 9855, 13582, 9819,
+		13576, 9776, 13570, 9737, 13564, 9697, 13558, 9664, 13553, 9626, 13547, 9592, 13541, 9557, 13535, 9526,
+		13529, 9492, 13524, 9460, 13518, 9427, 13513, 9398, 13507, 9371, 13502, 9343, 13497, 9312, 13491, 9283,
+		13486, 9258, 13481, 9233, 13475, 9202, 13470, 9149, 13465, 9105, 13460, 9052, 13455, 9003, 13450, 8963,
+		13445, 8919, 13440, 8874, 13435, 8835, 13430, 8798, 13426, 8760, 13421, 8716, 13416, 8672, 13412, 8640,
+		13407, 8607, 13402, 8573, 13398, 8536, 13393, 8505, 13388, 8471, 13384, 8438, 13380, 8409, 13375, 8373,
+		13371, 8341, 13367, 8318, 13362, 8290, 13358, 8263, 13354, 8236, 13350, 8207, 13345, 8169, 13341, 8128,
+		13337, 8070, 13333, 8020, 13329, 7979, 13325, 7930, 13321, 7887, 13317, 7844, 13313, 7797, 13306, 7758,
+		13298, 7718, 13290, 7676, 13283, 7636, 13275, 7598, 13268, 7559, 13260, 7525, 13253, 7487, 13245, 7453,
+		13238, 7423, 13230, 7392, 13223, 7358, 13216, 7323, 13209, 7295, 13202, 7266, 13195, 7236, 13188, 7204,
+		13181, 7176, 13174, 7136, 13167, 7083, 13160, 7024, 13153, 6973, 13147, 6923, 13140, 6875, 13133, 6826,
+		13127, 6772, 13120, 6737, 13114, 6693, 13107, 6647, 13101, 6603, 13095, 6562, 13088, 6521, 13082, 6480,
+		13076, 6440, 13069, 6408, 13063, 6371, 13057, 6332, 13051, 6298, 13045, 6263, 13039, 6231, 13033, 6196,
+		13027, 6167, 13021, 6129, 13015, 6063, 13009, 6009, 13003, 5950, 12998, 5896, 12992, 5830, 12986, 5784,
+		12980, 5732, 12975, 5677, 12969, 5631, 12964, 5583, 12958, 5535, 12953, 5488, 12947, 5444, 12942, 5402,
+		12936, 5352, 12931, 5312, 12926, 5276, 12920, 5234, 12915, 5198, 12910, 5158, 12905, 5120, 12900, 5048,
+		12894, 4981, 12889, 4910, 12884, 4852, 12879, 4788, 12874, 4719, 12869, 4660, 12864, 4601, 12859, 4540,
+		12854, 4489, 12849, 4434, 12844, 4382, 12840, 4330, 12835, 4277, 12830, 4232, 12825, 4184, 12821, 4135,
+		12816, 4086, 12811, 3998, 12807, 3912, 12802, 3837, 12798, 3752, 12793, 3677, 12788, 3602, 12784, 3530,
+		12780, 3463, 12775, 3392, 12771, 3328, 12766, 3261, 12762, 3199, 12757, 3139, 12753, 3079, 12749, 2976,
+		12744, 2865, 12740, 2762, 12736, 2661, 12732, 2563, 12728, 2465, 12723, 2373, 12719, 2282, 12715, 2198,
+		12711, 2115, 12707, 2021, 12703, 1866, 12699, 1718, 12695, 1576, 12691, 1439, 12687, 1306, 12683, 1181,
+	};
+}
@@ -0,0 +1,156 @@
+#include "SEnvironmentSampler.h"
+
+#include "ParallelFor.h"
+#include "SSphericalHarmonics.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+	// Largest float below 1, so remapped numbers stay in [0, 1)
+	constexpr float ONE_MINUS_EPSILON = 0x1.fffffep-1f;
+
+	// Density per steradian of a unit direction drawn uniformly from the face coordinates of a texel of probability
+	// [probability]: the texel covers 4 / size^2 of the face plane at distance 1, which a direction with major
+	// component m crosses at 1 / m, tilted by m, so dw = dA m^3.
+	inline float SolidAngleDensity(float probability, uint32_t size, const XMFLOAT3& direction)
+	{
+		const float major = std::max({ fabsf(direction.x), fabsf(direction.y), fabsf(direction.z) });
+		return probability * (float)size * size / (4.0f * major * major * major);
+	}
+}
+
+void SEnvironmentSampler::BuildAliasTable(const float* weights, uint32_t count, float* outProbabilities, uint32_t* outAliases)
+{
+	double total = 0.0;
+	for (uint32_t i = 0; i < count; ++i)
+		total += std::max(weights[i], 0.0f);
+	if (!(total > 0.0) || !std::isfinite(total))
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			outProbabilities[i] = 1.0f;
+			outAliases[i] = i;
+		}
+		return;
+	}
+
+	// Weights scaled to a mean of 1. Each entry below 1 is topped up by one above it, which loses what it gave.
+	std::vector<double> scaled(count);
+	std::vector<uint32_t> small, large;
+	small.reserve(count);
+	large.reserve(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		scaled[i] = std::max(weights[i], 0.0f) * (count / total);
+		(scaled[i] < 1.0 ? small : large).push_back(i);
+	}
+	while (!small.empty() && !large.empty())
+	{
+		const uint32_t less = small.back(), more = large.back();
+		small.pop_back();
+		outProbabilities[less] = (float)scaled[less];
+		outAliases[less] = more;
+		scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+		if (scaled[more] < 1.0)
+		{
+			large.pop_back();
+			small.push_back(more);
+		}
+	}
+	// What is left is 1 up to rounding
+	for (uint32_t i : large)
+	{
+		outProbabilities[i] = 1.0f;
+		outAliases[i] = i;
+	}
+	for (uint32_t i : small)
+	{
+		outProbabilities[i] = 1.0f;
+		outAliases[i] = i;
+	}
+}
+
+uint32_t SEnvironmentSampler::SampleAliasTable(const float* probabilities, const uint32_t* aliases, uint32_t count, float u, float& outRemapped)
+{
+	const float scaled = u * count;
+	const uint32_t i = std::min((uint32_t)scaled, count - 1);
+	const float coin = std::min(scaled - i, ONE_MINUS_EPSILON);
+	if (coin < probabilities[i])
+	{
+		outRemapped = coin / probabilities[i];
+		return i;
+	}
+	outRemapped = std::min((coin - probabilities[i]) / (1.0f - probabilities[i]), ONE_MINUS_EPSILON);
+	return aliases[i];
+}
+
+void SEnvironmentSampler::Build(const float* const faces[6], uint32_t size, uint32_t maxThreads)
+{
+	const uint32_t rows = 6 * size;
+	const size_t texelCount = (size_t)rows * size;
+	m_size = size;
+	m_rowProbabilities.resize(rows);
+	m_rowAliases.resize(rows);
+	m_probabilities.resize(texelCount);
+	m_aliases.resize(texelCount);
+	m_texelProbabilities.resize(texelCount);
+
+	// Luminance times solid angle, with a table per row
+	const std::vector<float> solidAngles = SSphericalHarmonics::ComputeTexelSolidAngles(size, maxThreads);
+	std::vector<float> rowWeights(rows);
+	ParallelFor(rows, [&](uint32_t row)
+	{
+		const uint32_t face = row / size, y = row % size;
+		const float* texels = faces[face] + (size_t)y * size * 4;
+		float* weights = &m_texelProbabilities[(size_t)row * size];
+		double sum = 0.0;
+		for (uint32_t x = 0; x < size; ++x)
+		{
+			const float luminance = 0.2126f * texels[x * 4] + 0.7152f * texels[x * 4 + 1] + 0.0722f * texels[x * 4 + 2];
+			weights[x] = luminance > 0.0f && std::isfinite(luminance) ? luminance * solidAngles[(size_t)y * size + x] : 0.0f;
+			sum += weights[x];
+		}
+		rowWeights[row] = (float)sum;
+		BuildAliasTable(weights, size, &m_probabilities[(size_t)row * size], &m_aliases[(size_t)row * size]);
+	}, maxThreads);
+	BuildAliasTable(rowWeights.data(), rows, m_rowProbabilities.data(), m_rowAliases.data());
+
+	double total = 0.0;
+	for (float weight : rowWeights)
+		total += weight;
+	if (total > 0.0)
+	{
+		const float scale = (float)(1.0 / total);
+		for (float& probability : m_texelProbabilities)
+			probability *= scale;
+	}
+	else
+		std::fill(m_texelProbabilities.begin(), m_texelProbabilities.end(), 1.0f / texelCount);
+}
+
+XMFLOAT3 SEnvironmentSampler::Sample(XMFLOAT2 u, float& outPdf) const
+{
+	float jitterX, jitterY;
+	const uint32_t row = SampleAliasTable(m_rowProbabilities.data(), m_rowAliases.data(), 6 * m_size, u.x, jitterY);
+	const size_t first = (size_t)row * m_size;
+	const uint32_t x = SampleAliasTable(&m_probabilities[first], &m_aliases[first], m_size, u.y, jitterX);
+
+	const float step = 2.0f / m_size;
+	const XMFLOAT3 direction = SSphericalHarmonics::GetFaceDirection(row / m_size, (x + jitterX) * step - 1.0f, (row % m_size + jitterY) * step - 1.0f);
+	outPdf = SolidAngleDensity(m_texelProbabilities[first + x], m_size, direction);
+	return direction;
+}
+
+float SEnvironmentSampler::Pdf(const XMFLOAT3& direction) const
+{
+	float u, v;
+	const uint32_t face = SSphericalHarmonics::GetDirectionFace(direction, u, v);
+	const int32_t last = (int32_t)m_size - 1;
+	const uint32_t x = (uint32_t)std::clamp((int32_t)floorf((u + 1.0f) * 0.5f * m_size), 0, last);
+	const uint32_t y = (uint32_t)std::clamp((int32_t)floorf((v + 1.0f) * 0.5f * m_size), 0, last);
+	return SolidAngleDensity(GetTexelProbability(face, x, y), m_size, direction);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+// Importance sampling of an environment cubemap by luminance: a piecewise constant distribution over its texels,
+// each weighted by luminance times solid angle, drawn from in O(1) with Vose alias tables.
+//
+// Rows of the 6 faces (face major, as SSphericalHarmonics orders texels) have a marginal table, and every row a
+// table of its texels. A sample picks a row, then a texel, and reuses what is left of each uniform number after
+// the alias coin to place itself within the texel, so 2 numbers are enough and stratification carries through.
+class SEnvironmentSampler
+{
+	uint32_t m_size = 0;
+	std::vector<float> m_rowProbabilities;  // 6 * size rows
+	std::vector<uint32_t> m_rowAliases;
+	std::vector<float> m_probabilities;     // 6 * size * size texels, a table per row
+	std::vector<uint32_t> m_aliases;
+	std::vector<float> m_texelProbabilities;
+
+public:
+	// [faces]: 6 float RGBA faces of [size] x [size] texels, rows tightly packed, in D3D order.
+	// A black environment is sampled uniformly over the texels.
+	void Build(const float* const faces[6], uint32_t size, uint32_t maxThreads = 0);
+
+	inline bool Empty() const { return m_size == 0; }
+	inline uint32_t GetSize() const { return m_size; }
+	// Probability of drawing texel ([x], [y]) of [face]
+	inline float GetTexelProbability(uint32_t face, uint32_t x, uint32_t y) const { return m_texelProbabilities[((size_t)face * m_size + y) * m_size + x]; }
+
+	// Unit direction of the uniform numbers [u] in [0, 1), with its density per steradian
+	DirectX::XMFLOAT3 Sample(DirectX::XMFLOAT2 u, float& outPdf) const;
+	// Density per steradian of drawing the unit [direction]
+	float Pdf(const DirectX::XMFLOAT3& direction) const;
+
+	// Vose's alias table of [count] non-negative [weights]. An all zero table is uniform.
+	static void BuildAliasTable(const float* weights, uint32_t count, float* outProbabilities, uint32_t* outAliases);
+	// The entry [u] in [0, 1) draws from a table, and [outRemapped], the rest of [u] as a new uniform number
+	static uint32_t SampleAliasTable(const float* probabilities, const uint32_t* aliases, uint32_t count, float u, float& outRemapped);
+};
@@ -0,0 +1,296 @@
+#include "SFrustumCulling.h"
+
+#include "CpuInfo.h"
+#include "SMeshTypes.h"
+
+#include <cmath>
+#include <immintrin.h>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Planes with their components broadcast, in the layout the kernels load them
+	struct PlaneSet
+	{
+		float x[6], y[6], z[6], w[6];
+		float absX[6], absY[6], absZ[6];
+	};
+
+	PlaneSet MakePlaneSet(const XMFLOAT4 planes[6])
+	{
+		PlaneSet set;
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			set.x[p] = planes[p].x;
+			set.y[p] = planes[p].y;
+			set.z[p] = planes[p].z;
+			set.w[p] = planes[p].w;
+			set.absX[p] = std::fabs(planes[p].x);
+			set.absY[p] = std::fabs(planes[p].y);
+			set.absZ[p] = std::fabs(planes[p].z);
+		}
+		return set;
+	}
+
+	// The SIMD kernels evaluate the same expressions in the same order, so all kernels agree bit for bit
+	size_t CullScalar(const SSceneBounds& b, const PlaneSet& planes, size_t begin, size_t end, uint32_t* out)
+	{
+		size_t count = 0;
+		for (size_t i = begin; i < end; ++i)
+		{
+			bool outside = false;
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				const float sphereDistance = planes.x[p] * b.centerX[i] + planes.y[p] * b.centerY[i] + planes.z[p] * b.centerZ[i] + planes.w[p];
+				const float boxDistance = planes.x[p] * b.aabbCenterX[i] + planes.y[p] * b.aabbCenterY[i] + planes.z[p] * b.aabbCenterZ[i] + planes.w[p];
+				const float boxRadius = planes.absX[p] * b.aabbExtentX[i] + planes.absY[p] * b.aabbExtentY[i] + planes.absZ[p] * b.aabbExtentZ[i];
+				outside |= (sphereDistance < -b.radius[i]) | (boxDistance < -boxRadius);
+			}
+			out[count] = (uint32_t)i;
+			count += outside ? 0 : 1;
+		}
+		return count;
+	}
+
+	size_t CullSSE(const SSceneBounds& b, const PlaneSet& planes, size_t end, uint32_t* out)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		size_t count = 0;
+		size_t i = 0;
+		for (; i + 4 <= end; i += 4)
+		{
+			const __m128 cx = _mm_loadu_ps(&b.centerX[i]);
+			const __m128 cy = _mm_loadu_ps(&b.centerY[i]);
+			const __m128 cz = _mm_loadu_ps(&b.centerZ[i]);
+			const __m128 negRadius = _mm_xor_ps(_mm_loadu_ps(&b.radius[i]), signMask);
+			const __m128 ax = _mm_loadu_ps(&b.aabbCenterX[i]);
+			const __m128 ay = _mm_loadu_ps(&b.aabbCenterY[i]);
+			const __m128 az = _mm_loadu_ps(&b.aabbCenterZ[i]);
+			const __m128 ex = _mm_loadu_ps(&b.aabbExtentX[i]);
+			const __m128 ey = _mm_loadu_ps(&b.aabbExtentY[i]);
+			const __m128 ez = _mm_loadu_ps(&b.aabbExtentZ[i]);
+
+			__m128 outside = _mm_setzero_ps();
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				const __m128 px = _mm_set1_ps(planes.x[p]);
+				const __m128 py = _mm_set1_ps(planes.y[p]);
+				const __m128 pz = _mm_set1_ps(planes.z[p]);
+				const __m128 pw = _mm_set1_ps(planes.w[p]);
+				const __m128 sphereDistance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)), _mm_mul_ps(pz, cz)), pw);
+				const __m128 boxDistance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(px, ax), _mm_mul_ps(py, ay)), _mm_mul_ps(pz, az)), pw);
+				const __m128 boxRadius = _mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(_mm_set1_ps(planes.absX[p]), ex),
+					_mm_mul_ps(_mm_set1_ps(planes.absY[p]), ey)),
+					_mm_mul_ps(_mm_set1_ps(planes.absZ[p]), ez));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(sphereDistance, negRadius));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(boxDistance, _mm_xor_ps(boxRadius, signMask)));
+			}
+
+			// Branchless compaction: every lane is written, only visible ones advance the cursor
+			const int visible = ~_mm_movemask_ps(outside);
+			for (uint32_t lane = 0; lane < 4; ++lane)
+			{
+				out[count] = (uint32_t)(i + lane);
+				count += (visible >> lane) & 1;
+			}
+		}
+		return count + CullScalar(b, planes, i, end, out + count);
+	}
+
+	// For every 8 bit visibility mask: the visible lanes in order, and how many there are
+	struct CompactTable
+	{
+		uint32_t lanes[256][8];
+		uint32_t count[256];
+
+		CompactTable()
+		{
+			for (uint32_t mask = 0; mask < 256; ++mask)
+			{
+				count[mask] = 0;
+				for (uint32_t lane = 0; lane < 8; ++lane)
+				{
+					lanes[mask][lane] = 0;
+					if (mask & (1u << lane))
+						lanes[mask][count[mask]++] = lane;
+				}
+			}
+		}
+	};
+
+	CPU_TARGET_AVX2 size_t CullAVX2(const SSceneBounds& b, const PlaneSet& planes, size_t end, uint32_t* out)
+	{
+		static const CompactTable compactTable;
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		size_t count = 0;
+		size_t i = 0;
+		for (; i + 8 <= end; i += 8)
+		{
+			const __m256 cx = _mm256_loadu_ps(&b.centerX[i]);
+			const __m256 cy = _mm256_loadu_ps(&b.centerY[i]);
+			const __m256 cz = _mm256_loadu_ps(&b.centerZ[i]);
+			const __m256 negRadius = _mm256_xor_ps(_mm256_loadu_ps(&b.radius[i]), signMask);
+			const __m256 ax = _mm256_loadu_ps(&b.aabbCenterX[i]);
+			const __m256 ay = _mm256_loadu_ps(&b.aabbCenterY[i]);
+			const __m256 az = _mm256_loadu_ps(&b.aabbCenterZ[i]);
+			const __m256 ex = _mm256_loadu_ps(&b.aabbExtentX[i]);
+			const __m256 ey = _mm256_loadu_ps(&b.aabbExtentY[i]);
+			const __m256 ez = _mm256_loadu_ps(&b.aabbExtentZ[i]);
+
+			__m256 outside = _mm256_setzero_ps();
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				const __m256 px = _mm256_set1_ps(planes.x[p]);
+				const __m256 py = _mm256_set1_ps(planes.y[p]);
+				const __m256 pz = _mm256_set1_ps(planes.z[p]);
+				const __m256 pw = _mm256_set1_ps(planes.w[p]);
+				const __m256 sphereDistance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, cx), _mm256_mul_ps(py, cy)), _mm256_mul_ps(pz, cz)), pw);
+				const __m256 boxDistance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, ax), _mm256_mul_ps(py, ay)), _mm256_mul_ps(pz, az)), pw);
+				const __m256 boxRadius = _mm256_add_ps(_mm256_add_ps(
+					_mm256_mul_ps(_mm256_set1_ps(planes.absX[p]), ex),
+					_mm256_mul_ps(_mm256_set1_ps(planes.absY[p]), ey)),
+					_mm256_mul_ps(_mm256_set1_ps(planes.absZ[p]), ez));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(sphereDistance, negRadius, _CMP_LT_OQ));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(boxDistance, _mm256_xor_ps(boxRadius, signMask), _CMP_LT_OQ));
+			}
+
+			// Indices of the visible lanes are packed with a permute instead of one store per lane
+			const int visible = ~_mm256_movemask_ps(outside) & 0xFF;
+			const __m256i lanes = _mm256_add_epi32(_mm256_set1_epi32((int)i), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+			const __m256i packed = _mm256_permutevar8x32_epi32(lanes, _mm256_loadu_si256((const __m256i*)compactTable.lanes[visible]));
+			_mm256_storeu_si256((__m256i*)(out + count), packed);
+			count += compactTable.count[visible];
+		}
+		return count + CullScalar(b, planes, i, end, out + count);
+	}
+}
+
+void SSceneBounds::clear()
+{
+	meshIndex.clear();
+	sectionIndex.clear();
+	centerX.clear();
+	centerY.clear();
+	centerZ.clear();
+	radius.clear();
+	aabbCenterX.clear();
+	aabbCenterY.clear();
+	aabbCenterZ.clear();
+	aabbExtentX.clear();
+	aabbExtentY.clear();
+	aabbExtentZ.clear();
+}
+
+void SSceneBounds::reserve(size_t count)
+{
+	meshIndex.reserve(count);
+	sectionIndex.reserve(count);
+	centerX.reserve(count);
+	centerY.reserve(count);
+	centerZ.reserve(count);
+	radius.reserve(count);
+	aabbCenterX.reserve(count);
+	aabbCenterY.reserve(count);
+	aabbCenterZ.reserve(count);
+	aabbExtentX.reserve(count);
+	aabbExtentY.reserve(count);
+	aabbExtentZ.reserve(count);
+}
+
+void SSceneBounds::Add(uint32_t mesh, uint32_t section, const SMeshSectionBounds& bounds, FXMMATRIX model)
+{
+	// The sphere grows with the largest axis scale
+	const float scale = std::max(std::max(XMVectorGetX(XMVector3Length(model.r[0])), XMVectorGetX(XMVector3Length(model.r[1]))), XMVectorGetX(XMVector3Length(model.r[2])));
+	XMFLOAT3 center;
+	XMStoreFloat3(&center, XMVector3TransformCoord(XMLoadFloat3(&bounds.center), model));
+
+	// The box is re-fitted around the transformed one: each world extent sums the absolute
+	// contributions of the object space extents (Arvo)
+	XMVECTOR objectMin = XMLoadFloat3(&bounds.aabbMin);
+	XMVECTOR objectMax = XMLoadFloat3(&bounds.aabbMax);
+	XMVECTOR objectExtent = XMVectorScale(XMVectorSubtract(objectMax, objectMin), 0.5f);
+	XMVECTOR worldExtent = XMVectorAdd(XMVectorAdd(
+		XMVectorMultiply(XMVectorSplatX(objectExtent), XMVectorAbs(model.r[0])),
+		XMVectorMultiply(XMVectorSplatY(objectExtent), XMVectorAbs(model.r[1]))),
+		XMVectorMultiply(XMVectorSplatZ(objectExtent), XMVectorAbs(model.r[2])));
+	XMFLOAT3 aabbCenter, aabbExtent;
+	XMStoreFloat3(&aabbCenter, XMVector3TransformCoord(XMVectorScale(XMVectorAdd(objectMin, objectMax), 0.5f), model));
+	XMStoreFloat3(&aabbExtent, worldExtent);
+
+	meshIndex.push_back(mesh);
+	sectionIndex.push_back(section);
+	centerX.push_back(center.x);
+	centerY.push_back(center.y);
+	centerZ.push_back(center.z);
+	radius.push_back(bounds.radius * scale);
+	aabbCenterX.push_back(aabbCenter.x);
+	aabbCenterY.push_back(aabbCenter.y);
+	aabbCenterZ.push_back(aabbCenter.z);
+	aabbExtentX.push_back(aabbExtent.x);
+	aabbExtentY.push_back(aabbExtent.y);
+	aabbExtentZ.push_back(aabbExtent.z);
+}
+
+SFrustumCulling::Kernel SFrustumCulling::GetBestKernel()
+{
+	// SSE2 is part of x64
+	static const Kernel best = CpuInfo::HasAVX2() ? Kernel::AVX2 : Kernel::SSE;
+	return best;
+}
+
+const char* SFrustumCulling::GetKernelName(Kernel kernel)
+{
+	switch (kernel)
+	{
+	case Kernel::SSE:
+		return "SSE";
+	case Kernel::AVX2:
+		return "AVX2";
+	default:
+		return "Scalar";
+	}
+}
+
+void SFrustumCulling::ExtractPlanes(FXMMATRIX viewProjection, XMFLOAT4 outPlanes[6])
+{
+	// Planes from the columns of the row-vector matrix
+	XMMATRIX columns = XMMatrixTranspose(viewProjection);
+	XMVECTOR planes[6] =
+	{
+		XMVectorAdd(columns.r[3], columns.r[0]),       // Left
+		XMVectorSubtract(columns.r[3], columns.r[0]),  // Right
+		XMVectorAdd(columns.r[3], columns.r[1]),       // Bottom
+		XMVectorSubtract(columns.r[3], columns.r[1]),  // Top
+		columns.r[2],                                  // Near
+		XMVectorSubtract(columns.r[3], columns.r[2]),  // Far
+	};
+	for (uint32_t p = 0; p < 6; ++p)
+	{
+		XMStoreFloat4(&outPlanes[p], XMVectorDivide(planes[p], XMVector3Length(planes[p])));
+	}
+}
+
+void SFrustumCulling::Cull(const SSceneBounds& bounds, const XMFLOAT4 planes[6], vector<uint32_t>& outVisible, Kernel kernel)
+{
+	const PlaneSet planeSet = MakePlaneSet(planes);
+
+	// The kernels write whole vectors of indices past the visible ones, hence the slack
+	outVisible.resize(bounds.size() + 8);
+	size_t count = 0;
+	switch (kernel)
+	{
+	case Kernel::AVX2:
+		count = CullAVX2(bounds, planeSet, bounds.size(), outVisible.data());
+		break;
+	case Kernel::SSE:
+		count = CullSSE(bounds, planeSet, bounds.size(), outVisible.data());
+		break;
+	default:
+		count = CullScalar(bounds, planeSet, 0, bounds.size(), outVisible.data());
+		break;
+	}
+	outVisible.resize(count);
+}
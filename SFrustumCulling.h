@@ -0,0 +1,51 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+struct SMeshSectionBounds;
+
+// World space bounds of every drawable section in the scene, one array per component so the culling
+// kernels can load 4 or 8 objects at a time. Entry i draws section [sectionIndex[i]] of mesh [meshIndex[i]].
+struct SSceneBounds
+{
+	std::vector<uint32_t> meshIndex;
+	std::vector<uint32_t> sectionIndex;
+
+	// Bounding sphere
+	std::vector<float> centerX, centerY, centerZ, radius;
+
+	// Axis aligned bounding box as center and half extents
+	std::vector<float> aabbCenterX, aabbCenterY, aabbCenterZ;
+	std::vector<float> aabbExtentX, aabbExtentY, aabbExtentZ;
+
+	inline size_t size() const { return meshIndex.size(); }
+	void clear();
+	void reserve(size_t count);
+
+	// Appends the object space [bounds] of a section, transformed into world space by [model] (row vectors)
+	void Add(uint32_t mesh, uint32_t section, const SMeshSectionBounds& bounds, DirectX::FXMMATRIX model);
+};
+
+namespace SFrustumCulling
+{
+	enum class Kernel
+	{
+		Scalar,
+		SSE,    // 4 objects per iteration
+		AVX2,   // 8 objects per iteration
+	};
+
+	// Fastest kernel this CPU and OS support
+	Kernel GetBestKernel();
+	const char* GetKernelName(Kernel kernel);
+
+	// Normalized planes (Gribb & Hartmann) of the frustum of [viewProjection] (row vectors, as DirectXMath).
+	// Points p with dot(plane.xyz, p) + plane.w >= 0 are inside. Order: left, right, bottom, top, near, far.
+	void ExtractPlanes(DirectX::FXMMATRIX viewProjection, DirectX::XMFLOAT4 outPlanes[6]);
+
+	// Replaces [outVisible] with the ascending indices of all entries of [bounds] whose sphere and box
+	// both intersect the frustum. All kernels return the same list.
+	void Cull(const SSceneBounds& bounds, const DirectX::XMFLOAT4 planes[6], std::vector<uint32_t>& outVisible, Kernel kernel = GetBestKernel());
+}
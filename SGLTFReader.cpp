@@ -0,0 +1,412 @@
+#include "SGLTFReader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#define CGLTF_IMPLEMENTATION
+#include "cgltf.h"
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	struct GLTFPrimitiveInstance
+	{
+		const cgltf_primitive* Primitive;
+		XMFLOAT4X4 World;
+	};
+
+	void CollectGLTFPrimitives(const cgltf_node* Node, vector<GLTFPrimitiveInstance>& OutInstances)
+	{
+		if (Node->mesh)
+		{
+			// cgltf returns a column-major matrix for column vectors,
+			// which is the same memory layout as a row-major matrix for DirectXMath's row vectors.
+			XMFLOAT4X4 World;
+			cgltf_node_transform_world(Node, &World.m[0][0]);
+
+			for (cgltf_size PrimIdx = 0; PrimIdx < Node->mesh->primitives_count; ++PrimIdx)
+			{
+				const cgltf_primitive* Primitive = &Node->mesh->primitives[PrimIdx];
+				if (Primitive->type == cgltf_primitive_type_triangles)
+				{
+					OutInstances.push_back(GLTFPrimitiveInstance{ Primitive, World });
+				}
+			}
+		}
+
+		for (cgltf_size ChildIdx = 0; ChildIdx < Node->children_count; ++ChildIdx)
+		{
+			CollectGLTFPrimitives(Node->children[ChildIdx], OutInstances);
+		}
+	}
+
+	const cgltf_accessor* FindGLTFAttribute(const cgltf_primitive* Primitive, cgltf_attribute_type Type)
+	{
+		for (cgltf_size AttribIdx = 0; AttribIdx < Primitive->attributes_count; ++AttribIdx)
+		{
+			const cgltf_attribute& Attrib = Primitive->attributes[AttribIdx];
+			if (Attrib.type == Type && Attrib.index == 0)
+			{
+				return Attrib.data;
+			}
+		}
+		return nullptr;
+	}
+
+	// Decodes [NumComponents] components of one element to float.
+	// Integer components are either normalized or, with KHR_mesh_quantization, plain integers.
+	inline void DecodeGLTFElement(const uint8_t* Src, cgltf_component_type Type, bool Normalized, float* Dst, uint32_t NumComponents)
+	{
+		switch (Type)
+		{
+		case cgltf_component_type_r_32f:
+			memcpy(Dst, Src, NumComponents * sizeof(float));
+			break;
+		case cgltf_component_type_r_8:
+			for (uint32_t i = 0; i < NumComponents; ++i)
+				Dst[i] = Normalized ? std::max(((const int8_t*)Src)[i] / 127.0f, -1.0f) : (float)((const int8_t*)Src)[i];
+			break;
+		case cgltf_component_type_r_8u:
+			for (uint32_t i = 0; i < NumComponents; ++i)
+				Dst[i] = Normalized ? ((const uint8_t*)Src)[i] / 255.0f : (float)((const uint8_t*)Src)[i];
+			break;
+		case cgltf_component_type_r_16:
+			for (uint32_t i = 0; i < NumComponents; ++i)
+				Dst[i] = Normalized ? std::max(((const int16_t*)Src)[i] / 32767.0f, -1.0f) : (float)((const int16_t*)Src)[i];
+			break;
+		case cgltf_component_type_r_16u:
+			for (uint32_t i = 0; i < NumComponents; ++i)
+				Dst[i] = Normalized ? ((const uint16_t*)Src)[i] / 65535.0f : (float)((const uint16_t*)Src)[i];
+			break;
+		case cgltf_component_type_r_32u:
+			for (uint32_t i = 0; i < NumComponents; ++i)
+				Dst[i] = (float)((const uint32_t*)Src)[i];
+			break;
+		default:
+			assert(0);
+		}
+	}
+
+	inline uint32_t ReadGLTFIndex(const uint8_t* Src, cgltf_component_type Type)
+	{
+		switch (Type)
+		{
+		case cgltf_component_type_r_8u:
+			return *Src;
+		case cgltf_component_type_r_16u:
+			return *(const uint16_t*)Src;
+		case cgltf_component_type_r_32u:
+			return *(const uint32_t*)Src;
+		default:
+			assert(0);
+			return 0;
+		}
+	}
+
+	// Walks the sparse substitutions of an accessor and calls Func(element index, value address).
+	template<typename Func>
+	void ForEachGLTFSparseValue(const cgltf_accessor* Accessor, Func&& Fn)
+	{
+		const cgltf_accessor_sparse& Sparse = Accessor->sparse;
+		const uint8_t* Indices = cgltf_buffer_view_data(Sparse.indices_buffer_view) + Sparse.indices_byte_offset;
+		const uint8_t* Values = cgltf_buffer_view_data(Sparse.values_buffer_view) + Sparse.values_byte_offset;
+		const cgltf_size IndexSize = cgltf_component_size(Sparse.indices_component_type);
+		const cgltf_size ValueSize = cgltf_calc_size(Accessor->type, Accessor->component_type);
+
+		for (cgltf_size Idx = 0; Idx < Sparse.count; ++Idx)
+		{
+			Fn(ReadGLTFIndex(Indices + Idx * IndexSize, Sparse.indices_component_type), Values + Idx * ValueSize);
+		}
+	}
+
+	// Decodes a vertex attribute straight into an interleaved destination with SVertex stride.
+	// Handles interleaved/strided buffer views, normalized and quantized components and sparse accessors.
+	void ReadGLTFAttribute(const cgltf_accessor* Accessor, uint8_t* Dst, uint32_t DstComponents)
+	{
+		const uint32_t NumComponents = std::min((uint32_t)cgltf_num_components(Accessor->type), DstComponents);
+		const bool Normalized = Accessor->normalized != 0;
+
+		// Accessors without a buffer view start out as zeros, which the destination already is.
+		if (Accessor->buffer_view)
+		{
+			const uint8_t* Src = cgltf_buffer_view_data(Accessor->buffer_view) + Accessor->offset;
+			const size_t SrcStride = Accessor->stride;
+			if (Accessor->component_type == cgltf_component_type_r_32f)
+			{
+				const size_t Size = NumComponents * sizeof(float);
+				for (cgltf_size Idx = 0; Idx < Accessor->count; ++Idx, Src += SrcStride)
+				{
+					memcpy(Dst + Idx * sizeof(SVertex), Src, Size);
+				}
+			}
+			else
+			{
+				for (cgltf_size Idx = 0; Idx < Accessor->count; ++Idx, Src += SrcStride)
+				{
+					DecodeGLTFElement(Src, Accessor->component_type, Normalized, (float*)(Dst + Idx * sizeof(SVertex)), NumComponents);
+				}
+			}
+		}
+
+		if (Accessor->is_sparse)
+		{
+			ForEachGLTFSparseValue(Accessor, [&](uint32_t Idx, const uint8_t* Value)
+			{
+				DecodeGLTFElement(Value, Accessor->component_type, Normalized, (float*)(Dst + Idx * sizeof(SVertex)), NumComponents);
+			});
+		}
+	}
+
+	// Indices are in range of their primitive's vertices, which cgltf_validate checks, so they fit into 16 bits whenever
+	// it has at most 65536 of them. Indices that already have the destination's size are copied as they are.
+	template<typename Index>
+	void ReadGLTFIndices(const cgltf_accessor* Accessor, Index* Dst)
+	{
+		if (Accessor->buffer_view)
+		{
+			const uint8_t* Src = cgltf_buffer_view_data(Accessor->buffer_view) + Accessor->offset;
+			const size_t SrcStride = Accessor->stride;
+			if (SrcStride == sizeof(Index) && cgltf_component_size(Accessor->component_type) == sizeof(Index))
+			{
+				memcpy(Dst, Src, Accessor->count * sizeof(Index));
+			}
+			else
+			{
+				for (cgltf_size Idx = 0; Idx < Accessor->count; ++Idx, Src += SrcStride)
+					Dst[Idx] = (Index)ReadGLTFIndex(Src, Accessor->component_type);
+			}
+		}
+		else
+		{
+			memset(Dst, 0, Accessor->count * sizeof(Index));
+		}
+
+		if (Accessor->is_sparse)
+		{
+			ForEachGLTFSparseValue(Accessor, [&](uint32_t Idx, const uint8_t* Value)
+			{
+				Dst[Idx] = (Index)ReadGLTFIndex(Value, Accessor->component_type);
+			});
+		}
+	}
+
+	// Loads [filename] with its buffers and collects the primitives Append turns into sections. Returns null on failure,
+	// otherwise the data to cgltf_free once the primitives are read.
+	cgltf_data* LoadGLTFPrimitives(const char* filename, vector<GLTFPrimitiveInstance>& Instances)
+	{
+		cgltf_options Options = {};
+		cgltf_data* Data = nullptr;
+		if (cgltf_parse_file(&Options, filename, &Data) != cgltf_result_success)
+		{
+			return nullptr;
+		}
+		if (cgltf_load_buffers(&Options, Data, filename) != cgltf_result_success || cgltf_validate(Data) != cgltf_result_success)
+		{
+			cgltf_free(Data);
+			return nullptr;
+		}
+
+		// Every triangle primitive reachable from the scene becomes one section,
+		// baked with the world transform of the node that instances it.
+		const cgltf_scene* Scene = Data->scene ? Data->scene : (Data->scenes_count > 0 ? &Data->scenes[0] : nullptr);
+		if (Scene)
+		{
+			for (cgltf_size NodeIdx = 0; NodeIdx < Scene->nodes_count; ++NodeIdx)
+			{
+				CollectGLTFPrimitives(Scene->nodes[NodeIdx], Instances);
+			}
+		}
+		else if (Data->nodes_count > 0)
+		{
+			for (cgltf_size NodeIdx = 0; NodeIdx < Data->nodes_count; ++NodeIdx)
+			{
+				if (Data->nodes[NodeIdx].parent == nullptr)
+				{
+					CollectGLTFPrimitives(&Data->nodes[NodeIdx], Instances);
+				}
+			}
+		}
+		else
+		{
+			// A bare mesh library without any node
+			for (cgltf_size MeshIdx = 0; MeshIdx < Data->meshes_count; ++MeshIdx)
+			{
+				for (cgltf_size PrimIdx = 0; PrimIdx < Data->meshes[MeshIdx].primitives_count; ++PrimIdx)
+				{
+					const cgltf_primitive* Primitive = &Data->meshes[MeshIdx].primitives[PrimIdx];
+					if (Primitive->type == cgltf_primitive_type_triangles)
+					{
+						GLTFPrimitiveInstance Instance;
+						Instance.Primitive = Primitive;
+						XMStoreFloat4x4(&Instance.World, XMMatrixIdentity());
+						Instances.push_back(Instance);
+					}
+				}
+			}
+		}
+
+		// Primitives without positions have nothing to draw
+		Instances.erase(std::remove_if(Instances.begin(), Instances.end(), [](const GLTFPrimitiveInstance& Instance)
+		{
+			return FindGLTFAttribute(Instance.Primitive, cgltf_attribute_type_position) == nullptr;
+		}), Instances.end());
+		return Data;
+	}
+
+	template<typename Index>
+	void AppendGLTFPrimitives(const vector<GLTFPrimitiveInstance>& Instances, vector<SVertex>& vertices, vector<Index>& indices, vector<SMeshSection>& sections)
+	{
+		// Size everything up front so attributes can be decoded straight into place
+		size_t TotalNumVertices = 0;
+		size_t TotalNumIndices = 0;
+		for (const GLTFPrimitiveInstance& Instance : Instances)
+		{
+			const cgltf_accessor* Positions = FindGLTFAttribute(Instance.Primitive, cgltf_attribute_type_position);
+			TotalNumVertices += Positions->count;
+			TotalNumIndices += Instance.Primitive->indices ? Instance.Primitive->indices->count : Positions->count;
+		}
+
+		size_t VertexCursor = vertices.size();
+		size_t IndexCursor = indices.size();
+		vertices.resize(VertexCursor + TotalNumVertices, SVertex{});
+		indices.resize(IndexCursor + TotalNumIndices);
+		sections.reserve(sections.size() + Instances.size());
+
+		for (const GLTFPrimitiveInstance& Instance : Instances)
+		{
+			const cgltf_primitive* Primitive = Instance.Primitive;
+			const cgltf_accessor* Positions = FindGLTFAttribute(Primitive, cgltf_attribute_type_position);
+			const cgltf_accessor* Normals = FindGLTFAttribute(Primitive, cgltf_attribute_type_normal);
+			const cgltf_accessor* Texcoords = FindGLTFAttribute(Primitive, cgltf_attribute_type_texcoord);
+			const size_t NumVertices = Positions->count;
+
+			SMeshSection Section;
+			Section.baseVertexLocation = (uint32_t)VertexCursor;
+			Section.startIndexLocation = (uint32_t)IndexCursor;
+			Section.indexCount = (uint32_t)(Primitive->indices ? Primitive->indices->count : NumVertices);
+
+			// Indices.
+			if (Primitive->indices)
+			{
+				ReadGLTFIndices(Primitive->indices, &indices[IndexCursor]);
+			}
+			else
+			{
+				for (uint32_t Idx = 0; Idx < Section.indexCount; ++Idx)
+				{
+					indices[IndexCursor + Idx] = (Index)Idx;
+				}
+			}
+
+			// Attributes.
+			SVertex* Vertices = &vertices[VertexCursor];
+			ReadGLTFAttribute(Positions, (uint8_t*)&Vertices->position, 3);
+			if (Normals)
+			{
+				ReadGLTFAttribute(Normals, (uint8_t*)&Vertices->normal, 3);
+			}
+			if (Texcoords)
+			{
+				ReadGLTFAttribute(Texcoords, (uint8_t*)&Vertices->uv, 2);
+			}
+
+			// Node transform.
+			XMMATRIX World = XMLoadFloat4x4(&Instance.World);
+			if (!XMMatrixIsIdentity(World))
+			{
+				XMMATRIX NormalMatrix = XMMatrixTranspose(XMMatrixInverse(nullptr, World));
+				for (size_t Idx = 0; Idx < NumVertices; ++Idx)
+				{
+					XMStoreFloat3(&Vertices[Idx].position, XMVector3TransformCoord(XMLoadFloat3(&Vertices[Idx].position), World));
+					XMStoreFloat3(&Vertices[Idx].normal, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&Vertices[Idx].normal), NormalMatrix)));
+				}
+
+				// Mirroring transforms flip the winding order
+				if (XMVectorGetX(XMMatrixDeterminant(World)) < 0.0f)
+				{
+					for (uint32_t Idx = 0; Idx + 2 < Section.indexCount; Idx += 3)
+					{
+						std::swap(indices[IndexCursor + Idx + 1], indices[IndexCursor + Idx + 2]);
+					}
+				}
+			}
+
+			sections.push_back(Section);
+			VertexCursor += NumVertices;
+			IndexCursor += Section.indexCount;
+		}
+
+	}
+}
+
+bool SGLTFReader::Append(const char* filename, vector<SVertex>& vertices, vector<uint32_t>& indices, vector<SMeshSection>& sections)
+{
+	vector<GLTFPrimitiveInstance> Instances;
+	cgltf_data* Data = LoadGLTFPrimitives(filename, Instances);
+	if (!Data)
+	{
+		return false;
+	}
+
+	AppendGLTFPrimitives(Instances, vertices, indices, sections);
+	cgltf_free(Data);
+	return true;
+}
+
+bool SGLTFReader::Append(const char* filename, vector<SVertex>& vertices, vector<uint32_t>& indices, vector<uint16_t>& shortIndices,
+	vector<SMeshSection>& sections)
+{
+	vector<GLTFPrimitiveInstance> Instances;
+	cgltf_data* Data = LoadGLTFPrimitives(filename, Instances);
+	if (!Data)
+	{
+		return false;
+	}
+
+	const bool Short = indices.empty() && std::all_of(Instances.begin(), Instances.end(), [](const GLTFPrimitiveInstance& Instance)
+	{
+		return FindGLTFAttribute(Instance.Primitive, cgltf_attribute_type_position)->count <= (cgltf_size)UINT16_MAX + 1;
+	});
+	if (Short)
+	{
+		AppendGLTFPrimitives(Instances, vertices, shortIndices, sections);
+	}
+	else
+	{
+		indices.insert(indices.end(), shortIndices.begin(), shortIndices.end());
+		shortIndices.clear();
+		AppendGLTFPrimitives(Instances, vertices, indices, sections);
+	}
+	cgltf_free(Data);
+	return true;
+}
+
+bool SGLTFReader::GetBufferPaths(const char* filename, vector<std::string>& outPaths)
+{
+	cgltf_options Options = {};
+	cgltf_data* Data = nullptr;
+	if (cgltf_parse_file(&Options, filename, &Data) != cgltf_result_success)
+	{
+		return false;
+	}
+
+	// As cgltf_load_buffers does: the decoded URI after the directory of the file
+	const std::string Path = filename;
+	const size_t Slash = Path.find_last_of("/\\");
+	const std::string Directory = Slash == std::string::npos ? std::string() : Path.substr(0, Slash + 1);
+	outPaths.clear();
+	for (cgltf_size BufferIdx = 0; BufferIdx < Data->buffers_count; ++BufferIdx)
+	{
+		const char* Uri = Data->buffers[BufferIdx].uri;
+		if (!Uri || strncmp(Uri, "data:", 5) == 0)
+			continue;
+		std::string Decoded = Uri;
+		Decoded.resize(cgltf_decode_uri(&Decoded[0]));
+		outPaths.push_back(Directory + Decoded);
+	}
+	cgltf_free(Data);
+	return true;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "SMeshTypes.h"
+
+#include <string>
+#include <vector>
+
+// glTF 2.0 mesh import. Does not depend on D3D12, so it is shared by SMesh and the tests.
+namespace SGLTFReader
+{
+	// Appends a section for every triangle primitive reachable from the default scene (or the root nodes, or
+	// every mesh when there are no nodes), baked with the world transform of the node that instances it.
+	// Attributes are decoded straight into [vertices]; indices are relative to the section's baseVertexLocation.
+	// Returns false if the file or its buffers cannot be read or do not validate.
+	bool Append(const char* filename, std::vector<SVertex>& vertices, std::vector<uint32_t>& indices, std::vector<SMeshSection>& sections);
+	// Same, but the indices stay in 16 bits: they are read into [shortIndices] while [indices] is empty and no primitive
+	// has more than 65536 vertices, u16 accessors with a plain layout by a single copy. Otherwise [shortIndices] is
+	// widened into [indices] and the file is read into that. One of the two is empty afterwards, if it was before.
+	bool Append(const char* filename, std::vector<SVertex>& vertices, std::vector<uint32_t>& indices, std::vector<uint16_t>& shortIndices,
+		std::vector<SMeshSection>& sections);
+
+	// Paths of the buffer files [filename] references, relative to its directory as Append resolves them, in buffer
+	// order. Embedded buffers (data: URIs, the binary chunk of a .glb) are part of the file itself and not listed.
+	// Returns false if the file cannot be parsed.
+	bool GetBufferPaths(const char* filename, std::vector<std::string>& outPaths);
+}
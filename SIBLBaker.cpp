@@ -0,0 +1,700 @@
+#include "SIBLBaker.h"
+
+#include "FileHash.h"
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+#include "SEnvironmentSampler.h"
+#include "STextureCompression.h"
+#include "StringFormat.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <immintrin.h>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr float PI = 3.14159265359f;
+
+	// Largest environment map level PrefilterMIS builds its luminance distribution from
+	constexpr uint32_t DISTRIBUTION_SIZE = 256;
+
+	double MillisecondsSince(std::chrono::high_resolution_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	// The face a direction points into and its coordinates there in [0, 1], v down, as TextureCube addressing picks them
+	inline uint32_t DirectionToFace(float x, float y, float z, float& u, float& v)
+	{
+		const float ax = fabsf(x), ay = fabsf(y), az = fabsf(z);
+		uint32_t face;
+		float sc, tc, ma;
+		if (ax >= ay && ax >= az)
+		{
+			face = x >= 0.0f ? 0 : 1;
+			sc = x >= 0.0f ? -z : z;
+			tc = -y;
+			ma = ax;
+		}
+		else if (ay >= az)
+		{
+			face = y >= 0.0f ? 2 : 3;
+			sc = x;
+			tc = y >= 0.0f ? z : -z;
+			ma = ay;
+		}
+		else
+		{
+			face = z >= 0.0f ? 4 : 5;
+			sc = z >= 0.0f ? x : -x;
+			tc = -y;
+			ma = az;
+		}
+		u = 0.5f * (sc / ma + 1.0f);
+		v = 0.5f * (tc / ma + 1.0f);
+		return face;
+	}
+
+	// Bilinear weights and clamped texel coordinates of [u], [v] in [0, 1] on a [size] x [size] face
+	struct Bilinear
+	{
+		uint32_t x0, x1, y0, y1;
+		float fx, fy;
+	};
+	inline Bilinear GetBilinear(float u, float v, uint32_t size)
+	{
+		const float px = u * size - 0.5f, py = v * size - 0.5f;
+		const float flx = floorf(px), fly = floorf(py);
+		const int32_t last = (int32_t)size - 1;
+		Bilinear b;
+		b.fx = px - flx;
+		b.fy = py - fly;
+		b.x0 = (uint32_t)std::clamp((int32_t)flx, 0, last);
+		b.x1 = (uint32_t)std::clamp((int32_t)flx + 1, 0, last);
+		b.y0 = (uint32_t)std::clamp((int32_t)fly, 0, last);
+		b.y1 = (uint32_t)std::clamp((int32_t)fly + 1, 0, last);
+		return b;
+	}
+
+	inline __m128 Lerp(__m128 a, __m128 b, float t)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t)));
+	}
+
+	inline __m128 LoadHalf4(const uint16_t* texel, PixelConvert::Kernel kernel)
+	{
+		alignas(16) float rgba[4];
+		PixelConvert::HalfToFloat(texel, rgba, 4, kernel);
+		return _mm_load_ps(rgba);
+	}
+
+	// Levels [firstMip, mipCount) of a cubemap in float RGBA, what the pre-filter samples
+	struct FloatCubemap
+	{
+		uint32_t size = 0;
+		uint32_t firstMip = 0;
+		uint32_t mipCount = 0;
+		std::vector<std::vector<float>> levels;  // (mip - firstMip) * 6 + face
+
+		inline const float* GetTexels(uint32_t face, uint32_t mip) const { return levels[(mip - firstMip) * 6 + face].data(); }
+
+		inline __m128 Sample(float x, float y, float z, uint32_t mip) const
+		{
+			float u, v;
+			const uint32_t face = DirectionToFace(x, y, z, u, v);
+			const uint32_t mipSize = std::max(1u, size >> mip);
+			const Bilinear b = GetBilinear(u, v, mipSize);
+			const float* texels = GetTexels(face, mip);
+			const float* row0 = texels + (size_t)b.y0 * mipSize * 4;
+			const float* row1 = texels + (size_t)b.y1 * mipSize * 4;
+			const __m128 top = Lerp(_mm_loadu_ps(row0 + b.x0 * 4), _mm_loadu_ps(row0 + b.x1 * 4), b.fx);
+			const __m128 bottom = Lerp(_mm_loadu_ps(row1 + b.x0 * 4), _mm_loadu_ps(row1 + b.x1 * 4), b.fx);
+			return Lerp(top, bottom, b.fy);
+		}
+
+		// The texel a direction falls in, unfiltered
+		inline __m128 SampleNearest(float x, float y, float z, uint32_t mip) const
+		{
+			float u, v;
+			const uint32_t face = DirectionToFace(x, y, z, u, v);
+			const uint32_t mipSize = std::max(1u, size >> mip);
+			const uint32_t tx = std::min((uint32_t)(u * mipSize), mipSize - 1), ty = std::min((uint32_t)(v * mipSize), mipSize - 1);
+			return _mm_loadu_ps(GetTexels(face, mip) + ((size_t)ty * mipSize + tx) * 4);
+		}
+	};
+
+	FloatCubemap ToFloat(const SIBLBaker::Cubemap& cubemap, uint32_t firstMip, uint32_t maxThreads)
+	{
+		FloatCubemap result;
+		result.size = cubemap.size;
+		result.firstMip = firstMip;
+		result.mipCount = cubemap.mipCount;
+		result.levels.resize((size_t)(cubemap.mipCount - firstMip) * 6);
+		ParallelFor((uint32_t)result.levels.size(), [&](uint32_t i)
+		{
+			const uint32_t mip = firstMip + i / 6, face = i % 6;
+			const size_t count = (size_t)cubemap.GetMipSize(mip) * cubemap.GetMipSize(mip) * 4;
+			result.levels[i].resize(count);
+			PixelConvert::HalfToFloat(cubemap.GetTexels(face, mip), result.levels[i].data(), count);
+		}, maxThreads);
+		return result;
+	}
+
+	// One pre-filter sample around N = +Z: the light direction in tangent space, its weight NoL and the level it reads
+	struct PrefilterSample
+	{
+		float x, y, z;
+		uint32_t mip;
+	};
+
+	// One PrefilterMIS sample: the light direction, around +Z for GGX samples and in world space for environment
+	// samples, and the density its strategy draws it with
+	struct MISSample
+	{
+		float x, y, z;
+		float pdf;
+	};
+
+	// Roberts' R2 sequence. As evenly spread as Hammersley, but without its multiples of 1 / count, which alias tables
+	// would all read as the same coin.
+	inline XMFLOAT2 R2(uint32_t index)
+	{
+		const double x = 0.5 + index * 0.7548776662466927, y = 0.5 + index * 0.5698402909980532;
+		return XMFLOAT2((float)(x - floor(x)), (float)(y - floor(y)));
+	}
+
+	// Density per steradian of the GGX lobe of [alpha2] = roughness^4 around N = V = R, at the light direction of [NoL]:
+	// D(NoH) NoH / (4 VoH) with VoH = NoH and NoH^2 = (1 + NoL) / 2
+	inline float GGXLightDensity(float NoL, float alpha2)
+	{
+		const float d = (alpha2 - 1.0f) * 0.5f * (1.0f + NoL) + 1.0f;
+		return alpha2 / (4.0f * PI * d * d);
+	}
+
+	// Irradiance of 6 half RGBA faces of [size] x [size] texels, rows tightly packed
+	void ProjectHalfFaces(const uint16_t* const faces[6], uint32_t size, XMFLOAT3 outIrradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS],
+		uint32_t maxThreads)
+	{
+		const size_t faceSize = (size_t)size * size * 4;
+		std::vector<float> texels(6 * faceSize);
+		const float* floatFaces[6];
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			PixelConvert::HalfToFloat(faces[face], texels.data() + face * faceSize, faceSize);
+			floatFaces[face] = texels.data() + face * faceSize;
+		}
+
+		XMFLOAT3 radiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+		SSphericalHarmonics::ProjectCubemap(floatFaces, (size_t)size * 4 * sizeof(float), size, 3, radiance, SSphericalHarmonics::GetBestKernel(), maxThreads);
+		SSphericalHarmonics::ConvolveIrradiance(radiance, 3, outIrradiance);
+	}
+}
+
+void SIBLBaker::Cubemap::Allocate(uint32_t cubeSize, uint32_t cubeMipCount)
+{
+	size = cubeSize;
+	mipCount = cubeMipCount;
+	subresources.resize((size_t)6 * mipCount);
+	for (uint32_t face = 0; face < 6; ++face)
+	{
+		for (uint32_t mip = 0; mip < mipCount; ++mip)
+			subresources[face * mipCount + mip].resize((size_t)GetMipSize(mip) * GetMipSize(mip) * 4);
+	}
+}
+
+uint64_t SIBLBaker::HashSource(const char* filename, const Settings& settings)
+{
+	// Everything the cache depends on
+	struct BakeKey
+	{
+		uint64_t fileHash;
+		uint32_t version;
+		uint32_t resolutions[4];
+		uint32_t mips[2];
+		uint32_t prefilterSamples;
+		uint32_t prefilterMIS;
+		uint32_t BRDF[4];  // Mode, format, and the table's resolution and samples
+	};
+	const BakeKey key = { HashFile(filename), BAKE_VERSION,
+		{ settings.envMapResolution, settings.prefilteredResolution, settings.irradianceResolution, settings.BRDFResolution },
+		{ settings.envMapMips, settings.prefilteredMips }, settings.prefilterSamples, settings.prefilterMIS ? 1u : 0u,
+		{ (uint32_t)settings.BRDFMode, (uint32_t)settings.BRDFFormat, SBRDFLUT::GetTableResolution(), SBRDFLUT::GetTableSamples() } };
+	return key.fileHash != 0 ? HashBytes(&key, sizeof(key)) : 0;
+}
+
+// -------------------------------------------------------
+// Shader formulas
+// -------------------------------------------------------
+
+XMFLOAT2 SIBLBaker::Hammersley(uint32_t index, uint32_t count)
+{
+	uint32_t bits = index;
+	bits = (bits << 16u) | (bits >> 16u);
+	bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+	bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+	bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+	bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+	return XMFLOAT2(index / (float)count, (float)bits * 2.3283064365386963e-10f);
+}
+
+XMFLOAT3 SIBLBaker::ImportanceSampleGGX(XMFLOAT2 Xi, float roughness, const XMFLOAT3& N)
+{
+	const float a = roughness * roughness;
+	const float phi = 2.0f * PI * Xi.x;
+	const float cosTheta = sqrtf((1.0f - Xi.y) / (1.0f + (a * a - 1.0f) * Xi.y));
+	const float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+	const XMFLOAT3 H(sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta);
+
+	// Tangent to world space
+	const XMVECTOR normal = XMLoadFloat3(&N);
+	const XMVECTOR up = fabsf(N.z) < 0.999f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+	const XMVECTOR tangentX = XMVector3Normalize(XMVector3Cross(up, normal));
+	const XMVECTOR tangentY = XMVector3Cross(normal, tangentX);
+	XMFLOAT3 result;
+	XMStoreFloat3(&result, XMVectorAdd(XMVectorAdd(XMVectorScale(tangentX, H.x), XMVectorScale(tangentY, H.y)), XMVectorScale(normal, H.z)));
+	return result;
+}
+
+float SIBLBaker::V_SmithGGXCorrelated(float NdotL, float NdotV, float alphaG)
+{
+	const float alphaG2 = alphaG * alphaG;
+	const float lambdaV = NdotL * sqrtf((-NdotV * alphaG2 + NdotV) * NdotV + alphaG2);
+	const float lambdaL = NdotV * sqrtf((-NdotL * alphaG2 + NdotL) * NdotL + alphaG2);
+	return 0.5f / (lambdaV + lambdaL);
+}
+
+XMFLOAT2 SIBLBaker::SampleSphericalMap(const XMFLOAT3& direction)
+{
+	const float theta = acosf(std::clamp(direction.y, -1.0f, 1.0f));
+	float phi = atan2f(direction.x, direction.z);
+	phi += phi < 0.0f ? 2.0f * PI : 0.0f;
+	return XMFLOAT2(phi / (2.0f * PI), theta / PI);
+}
+
+XMFLOAT4 SIBLBaker::SampleCubemap(const Cubemap& cubemap, const XMFLOAT3& direction, float lod)
+{
+	const uint32_t mip = (uint32_t)std::clamp((int32_t)floorf(lod + 0.5f), 0, (int32_t)cubemap.mipCount - 1);
+	const uint32_t size = cubemap.GetMipSize(mip);
+	float u, v;
+	const uint32_t face = DirectionToFace(direction.x, direction.y, direction.z, u, v);
+	const Bilinear b = GetBilinear(u, v, size);
+	const uint16_t* texels = cubemap.GetTexels(face, mip);
+	const PixelConvert::Kernel kernel = PixelConvert::GetBestKernel();
+	auto load = [&](uint32_t x, uint32_t y) { return LoadHalf4(texels + ((size_t)y * size + x) * 4, kernel); };
+	const __m128 top = Lerp(load(b.x0, b.y0), load(b.x1, b.y0), b.fx);
+	const __m128 bottom = Lerp(load(b.x0, b.y1), load(b.x1, b.y1), b.fx);
+	XMFLOAT4 result;
+	_mm_storeu_ps(&result.x, Lerp(top, bottom, b.fy));
+	return result;
+}
+
+// -------------------------------------------------------
+// Stages
+// -------------------------------------------------------
+
+void SIBLBaker::ProjectPanorama(const uint16_t* panorama, uint32_t width, uint32_t height, uint32_t size, uint32_t mipCount, Cubemap& outCubemap,
+	uint32_t maxThreads)
+{
+	outCubemap.Allocate(size, mipCount);
+	std::vector<float> source((size_t)width * height * 4);
+	ParallelFor(height, [&](uint32_t y)
+	{
+		const size_t offset = (size_t)y * width * 4;
+		PixelConvert::HalfToFloat(panorama + offset, source.data() + offset, (size_t)width * 4);
+	}, maxThreads);
+
+	// spherical2Cube.hlsl: bilinear, wrapping around the horizon instead of the shader's black border
+	ParallelFor(6 * size, [&](uint32_t row)
+	{
+		const uint32_t face = row / size, y = row % size;
+		std::vector<float> result((size_t)size * 4);
+		for (uint32_t x = 0; x < size; ++x)
+		{
+			const XMFLOAT2 uv = SampleSphericalMap(SSphericalHarmonics::GetTexelDirection(face, x, y, size));
+			const float px = uv.x * width - 0.5f, py = uv.y * height - 0.5f;
+			const float flx = floorf(px), fly = floorf(py);
+			const float fx = px - flx, fy = py - fly;
+			const uint32_t x0 = (uint32_t)(((int32_t)flx % (int32_t)width + (int32_t)width) % (int32_t)width);
+			const uint32_t x1 = x0 + 1 < width ? x0 + 1 : 0;
+			const uint32_t y0 = (uint32_t)std::clamp((int32_t)fly, 0, (int32_t)height - 1);
+			const uint32_t y1 = (uint32_t)std::clamp((int32_t)fly + 1, 0, (int32_t)height - 1);
+			const float* row0 = source.data() + (size_t)y0 * width * 4;
+			const float* row1 = source.data() + (size_t)y1 * width * 4;
+			const __m128 top = Lerp(_mm_loadu_ps(row0 + x0 * 4), _mm_loadu_ps(row0 + x1 * 4), fx);
+			const __m128 bottom = Lerp(_mm_loadu_ps(row1 + x0 * 4), _mm_loadu_ps(row1 + x1 * 4), fx);
+			_mm_storeu_ps(result.data() + x * 4, Lerp(top, bottom, fy));
+			result[x * 4 + 3] = 1.0f;
+		}
+		PixelConvert::FloatToHalf(result.data(), outCubemap.GetTexels(face, 0) + (size_t)y * size * 4, result.size());
+	}, maxThreads);
+}
+
+void SIBLBaker::GenerateMips(Cubemap& cubemap, uint32_t maxThreads)
+{
+	for (uint32_t mip = 1; mip < cubemap.mipCount; ++mip)
+	{
+		const uint32_t size = cubemap.GetMipSize(mip);
+		const uint32_t sourceSize = cubemap.GetMipSize(mip - 1);
+		assert(sourceSize == 2 * size);
+		ParallelFor(6 * size, [&](uint32_t row)
+		{
+			const uint32_t face = row / size, y = row % size;
+			std::vector<float> source((size_t)sourceSize * 2 * 4);
+			std::vector<float> result((size_t)size * 4);
+			PixelConvert::HalfToFloat(cubemap.GetTexels(face, mip - 1) + (size_t)2 * y * sourceSize * 4, source.data(), source.size());
+			const float* row0 = source.data();
+			const float* row1 = source.data() + (size_t)sourceSize * 4;
+			for (uint32_t x = 0; x < size; ++x)
+			{
+				const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(row0 + x * 8), _mm_loadu_ps(row0 + x * 8 + 4)),
+					_mm_add_ps(_mm_loadu_ps(row1 + x * 8), _mm_loadu_ps(row1 + x * 8 + 4)));
+				_mm_storeu_ps(result.data() + x * 4, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+			}
+			PixelConvert::FloatToHalf(result.data(), cubemap.GetTexels(face, mip) + (size_t)y * size * 4, result.size());
+		}, maxThreads);
+	}
+}
+
+void SIBLBaker::ProjectIrradiance(const Cubemap& envMap, uint32_t maxSize, XMFLOAT3 outIrradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS],
+	uint32_t maxThreads)
+{
+	// Irradiance is smooth, a small mip projects to the same SH9 as the full map
+	uint32_t mip = 0;
+	while (mip + 1 < envMap.mipCount && envMap.GetMipSize(mip) > maxSize)
+		++mip;
+
+	const uint16_t* faces[6];
+	for (uint32_t face = 0; face < 6; ++face)
+		faces[face] = envMap.GetTexels(face, mip);
+	ProjectHalfFaces(faces, envMap.GetMipSize(mip), outIrradiance, maxThreads);
+}
+
+void SIBLBaker::ProjectIrradiance(const STextureCache::View& envMap, uint32_t maxSize, XMFLOAT3 outIrradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS],
+	uint32_t maxThreads)
+{
+	uint32_t mip = 0;
+	while (mip + 1 < envMap.mipCount && envMap.mips[mip].width > maxSize)
+		++mip;
+	const uint32_t size = envMap.mips[mip].width;
+	const size_t rowSize = (size_t)size * 4 * sizeof(uint16_t);
+
+	std::vector<uint16_t> texels((size_t)6 * size * size * 4);
+	const uint16_t* faces[6];
+	for (uint32_t face = 0; face < 6; ++face)
+	{
+		const STextureCache::Mip& source = envMap.mips[face * envMap.mipCount + mip];
+		const uint8_t* src = envMap.data + source.offset;
+		uint8_t* dst = (uint8_t*)(texels.data() + (size_t)face * size * size * 4);
+		if (envMap.format == DXGI_FORMAT_BC6H_UF16)
+		{
+			STextureCompression::Decode(STextureCompression::Format::BC6H, src, size, size, source.rowPitch, dst, rowSize);
+		}
+		else if (envMap.format == DXGI_FORMAT_R16G16B16A16_FLOAT)
+		{
+			for (uint32_t y = 0; y < size; ++y)
+				memcpy(dst + y * rowSize, src + (size_t)y * source.rowPitch, rowSize);
+		}
+		else
+		{
+			throw std::runtime_error("Unsupported environment map format for the irradiance projection");
+		}
+		faces[face] = (const uint16_t*)dst;
+	}
+	ProjectHalfFaces(faces, size, outIrradiance, maxThreads);
+}
+
+void SIBLBaker::Prefilter(const Cubemap& envMap, uint32_t size, uint32_t mipCount, uint32_t samples, Cubemap& outCubemap, uint32_t maxThreads)
+{
+	outCubemap.Allocate(size, mipCount);
+
+	// prefilterEnvMap.hlsl with V = R = N. The GGX samples around N only differ by the tangent frame, so each level's
+	// light directions, weights and source levels are computed once around +Z and rotated to every texel.
+	const float solidAngleTexel = 4.0f * PI / (6.0f * envMap.size * envMap.size);
+	const int32_t lastMip = (int32_t)envMap.mipCount - 1;
+	std::vector<std::vector<PrefilterSample>> levelSamples(mipCount);
+	uint32_t firstMip = (uint32_t)lastMip;
+	for (uint32_t mip = 0; mip < mipCount; ++mip)
+	{
+		const float roughness = mipCount > 1 ? (float)mip / (mipCount - 1) : 0.0f;
+		std::vector<PrefilterSample>& list = levelSamples[mip];
+		if (roughness == 0.0f)
+		{
+			// A mirror: every sample reads the texel's own direction, from the level as large as the output
+			// (which is where the shader's 65536 samples land)
+			uint32_t level = 0;
+			while ((int32_t)level < lastMip && envMap.GetMipSize(level) > outCubemap.GetMipSize(mip))
+				++level;
+			list.push_back({ 0.0f, 0.0f, 1.0f, level });
+		}
+		else
+		{
+			const XMFLOAT3 N(0.0f, 0.0f, 1.0f);
+			for (uint32_t i = 0; i < samples; ++i)
+			{
+				const XMFLOAT3 H = ImportanceSampleGGX(Hammersley(i, samples), roughness, N);
+				const float NoL = 2.0f * H.z * H.z - 1.0f;  // L = 2 (V.H) H - V
+				if (NoL <= 0.0f)
+					continue;
+				const float pdf = NoL / PI;
+				const float solidAngleSample = 1.0f / (samples * pdf);
+				const float lod = 0.5f * log2f(solidAngleSample / solidAngleTexel);
+				const uint32_t level = (uint32_t)std::clamp((int32_t)floorf(lod + 0.5f), 0, lastMip);
+				list.push_back({ 2.0f * H.z * H.x, 2.0f * H.z * H.y, NoL, level });
+			}
+		}
+		for (const PrefilterSample& sample : list)
+			firstMip = std::min(firstMip, sample.mip);
+	}
+	const FloatCubemap source = ToFloat(envMap, firstMip, maxThreads);
+
+	for (uint32_t mip = 0; mip < mipCount; ++mip)
+	{
+		const uint32_t mipSize = outCubemap.GetMipSize(mip);
+		const std::vector<PrefilterSample>& list = levelSamples[mip];
+		ParallelFor(6 * mipSize, [&](uint32_t row)
+		{
+			const uint32_t face = row / mipSize, y = row % mipSize;
+			std::vector<float> result((size_t)mipSize * 4);
+			for (uint32_t x = 0; x < mipSize; ++x)
+			{
+				const XMFLOAT3 N = SSphericalHarmonics::GetTexelDirection(face, x, y, mipSize);
+				const XMVECTOR normal = XMLoadFloat3(&N);
+				const XMVECTOR up = fabsf(N.z) < 0.999f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+				XMFLOAT3 tangentX, tangentY;
+				XMStoreFloat3(&tangentX, XMVector3Normalize(XMVector3Cross(up, normal)));
+				XMStoreFloat3(&tangentY, XMVector3Cross(normal, XMLoadFloat3(&tangentX)));
+				const __m128 tx = _mm_setr_ps(tangentX.x, tangentX.y, tangentX.z, 0.0f);
+				const __m128 ty = _mm_setr_ps(tangentY.x, tangentY.y, tangentY.z, 0.0f);
+				const __m128 n = _mm_setr_ps(N.x, N.y, N.z, 0.0f);
+
+				__m128 sum = _mm_setzero_ps();
+				float weightSum = 0.0f;
+				for (const PrefilterSample& sample : list)
+				{
+					alignas(16) float L[4];
+					_mm_store_ps(L, _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, _mm_set1_ps(sample.x)), _mm_mul_ps(ty, _mm_set1_ps(sample.y))),
+						_mm_mul_ps(n, _mm_set1_ps(sample.z))));
+					sum = _mm_add_ps(sum, _mm_mul_ps(source.Sample(L[0], L[1], L[2], sample.mip), _mm_set1_ps(sample.z)));
+					weightSum += sample.z;
+				}
+				_mm_storeu_ps(result.data() + x * 4, _mm_div_ps(sum, _mm_set1_ps(weightSum)));
+				result[x * 4 + 3] = 1.0f;
+			}
+			PixelConvert::FloatToHalf(result.data(), outCubemap.GetTexels(face, mip) + (size_t)y * mipSize * 4, result.size());
+		}, maxThreads);
+	}
+}
+
+void SIBLBaker::PrefilterMIS(const Cubemap& envMap, uint32_t size, uint32_t mipCount, uint32_t samples, Cubemap& outCubemap, uint32_t maxThreads)
+{
+	outCubemap.Allocate(size, mipCount);
+
+	// The mirror reads the level as large as the output, as Prefilter does. Rough levels read the level the distribution
+	// is built from, unfiltered: a filtered lookup spreads a bright texel over neighbours the distribution hardly ever
+	// samples, which leaves their light to the GGX samples alone.
+	const int32_t lastMip = (int32_t)envMap.mipCount - 1;
+	uint32_t firstMip = 0;
+	while ((int32_t)firstMip < lastMip && envMap.GetMipSize(firstMip) > std::max(size, DISTRIBUTION_SIZE))
+		++firstMip;
+	uint32_t distributionMip = firstMip;
+	while ((int32_t)distributionMip < lastMip && envMap.GetMipSize(distributionMip) > DISTRIBUTION_SIZE)
+		++distributionMip;
+	const FloatCubemap source = ToFloat(envMap, firstMip, maxThreads);
+
+	SEnvironmentSampler environment;
+	const float* distributionFaces[6];
+	for (uint32_t face = 0; face < 6; ++face)
+		distributionFaces[face] = source.GetTexels(face, distributionMip);
+	environment.Build(distributionFaces, envMap.GetMipSize(distributionMip), maxThreads);
+
+	// Half the samples follow the GGX lobe and half the environment. The environment directions are the same for
+	// every texel of every level, as the GGX ones are up to the tangent frame.
+	const uint32_t GGXCount = (samples + 1) / 2, environmentCount = samples - GGXCount;
+	std::vector<MISSample> environmentSamples(environmentCount);
+	for (uint32_t i = 0; i < environmentCount; ++i)
+	{
+		MISSample& sample = environmentSamples[i];
+		const XMFLOAT3 L = environment.Sample(R2(i), sample.pdf);
+		sample.x = L.x;
+		sample.y = L.y;
+		sample.z = L.z;
+	}
+
+	for (uint32_t mip = 0; mip < mipCount; ++mip)
+	{
+		const float roughness = mipCount > 1 ? (float)mip / (mipCount - 1) : 0.0f;
+		const float alpha = roughness * roughness, alpha2 = alpha * alpha;
+		const uint32_t mipSize = outCubemap.GetMipSize(mip);
+		uint32_t mirrorMip = firstMip;
+		while ((int32_t)mirrorMip < lastMip && envMap.GetMipSize(mirrorMip) > mipSize)
+			++mirrorMip;
+
+		std::vector<MISSample> GGXSamples;
+		if (roughness > 0.0f)
+		{
+			const XMFLOAT3 N(0.0f, 0.0f, 1.0f);
+			for (uint32_t i = 0; i < GGXCount; ++i)
+			{
+				const XMFLOAT3 H = ImportanceSampleGGX(Hammersley(i, GGXCount), roughness, N);
+				const float NoL = 2.0f * H.z * H.z - 1.0f;
+				if (NoL > 0.0f)
+					GGXSamples.push_back({ 2.0f * H.z * H.x, 2.0f * H.z * H.y, NoL, GGXLightDensity(NoL, alpha2) });
+			}
+		}
+
+		ParallelFor(6 * mipSize, [&](uint32_t row)
+		{
+			const uint32_t face = row / mipSize, y = row % mipSize;
+			std::vector<float> result((size_t)mipSize * 4);
+			for (uint32_t x = 0; x < mipSize; ++x)
+			{
+				const XMFLOAT3 N = SSphericalHarmonics::GetTexelDirection(face, x, y, mipSize);
+				const __m128 n = _mm_setr_ps(N.x, N.y, N.z, 0.0f);
+				if (roughness == 0.0f)
+				{
+					_mm_storeu_ps(result.data() + x * 4, source.Sample(N.x, N.y, N.z, mirrorMip));
+					result[x * 4 + 3] = 1.0f;
+					continue;
+				}
+
+				const XMVECTOR normal = XMLoadFloat3(&N);
+				const XMVECTOR up = fabsf(N.z) < 0.999f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+				XMFLOAT3 tangentX, tangentY;
+				XMStoreFloat3(&tangentX, XMVector3Normalize(XMVector3Cross(up, normal)));
+				XMStoreFloat3(&tangentY, XMVector3Cross(normal, XMLoadFloat3(&tangentX)));
+				const __m128 tx = _mm_setr_ps(tangentX.x, tangentX.y, tangentX.z, 0.0f);
+				const __m128 ty = _mm_setr_ps(tangentY.x, tangentY.y, tangentY.z, 0.0f);
+
+				// Balance heuristic weights of the GGX lobe times NoL, normalized by their sum as the shader does with NoL
+				__m128 sum = _mm_setzero_ps();
+				float weightSum = 0.0f;
+				for (const MISSample& sample : GGXSamples)
+				{
+					alignas(16) float L[4];
+					_mm_store_ps(L, _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, _mm_set1_ps(sample.x)), _mm_mul_ps(ty, _mm_set1_ps(sample.y))),
+						_mm_mul_ps(n, _mm_set1_ps(sample.z))));
+					const float mixture = GGXCount * sample.pdf + environmentCount * environment.Pdf(XMFLOAT3(L[0], L[1], L[2]));
+					const float weight = sample.pdf * sample.z / mixture;
+					sum = _mm_add_ps(sum, _mm_mul_ps(source.SampleNearest(L[0], L[1], L[2], distributionMip), _mm_set1_ps(weight)));
+					weightSum += weight;
+				}
+				for (const MISSample& sample : environmentSamples)
+				{
+					const float NoL = N.x * sample.x + N.y * sample.y + N.z * sample.z;
+					if (NoL <= 0.0f)
+						continue;
+					const float density = GGXLightDensity(NoL, alpha2);
+					const float mixture = GGXCount * density + environmentCount * sample.pdf;
+					const float weight = density * NoL / mixture;
+					sum = _mm_add_ps(sum, _mm_mul_ps(source.SampleNearest(sample.x, sample.y, sample.z, distributionMip), _mm_set1_ps(weight)));
+					weightSum += weight;
+				}
+				_mm_storeu_ps(result.data() + x * 4, _mm_div_ps(sum, _mm_set1_ps(weightSum)));
+				result[x * 4 + 3] = 1.0f;
+			}
+			PixelConvert::FloatToHalf(result.data(), outCubemap.GetTexels(face, mip) + (size_t)y * mipSize * 4, result.size());
+		}, maxThreads);
+	}
+}
+
+void SIBLBaker::IntegrateBRDF(uint32_t resolution, uint32_t samples, std::vector<XMFLOAT2>& outLUT, uint32_t maxThreads)
+{
+	outLUT.resize((size_t)resolution * resolution);
+	std::vector<XMFLOAT2> sequence(samples);
+	for (uint32_t i = 0; i < samples; ++i)
+		sequence[i] = Hammersley(i, samples);
+
+	// createBRDFMap.hlsl, with N = +Y. The half vectors only depend on the roughness, so a row shares them.
+	ParallelFor(resolution, [&](uint32_t y)
+	{
+		const float roughness = (y + 1) / (float)resolution;
+		const XMFLOAT3 N(0.0f, 1.0f, 0.0f);
+		std::vector<XMFLOAT3> halfVectors(samples);
+		for (uint32_t i = 0; i < samples; ++i)
+			halfVectors[i] = ImportanceSampleGGX(sequence[i], roughness, N);
+
+		for (uint32_t x = 0; x < resolution; ++x)
+		{
+			const float NoV = (x + 1) / (float)resolution;
+			const XMFLOAT3 V(0.0f, NoV, sqrtf(1.0f - NoV * NoV));
+			const float NdotV = fabsf(NoV) + 1e-5f;
+			float A = 0.0f, B = 0.0f;
+			for (const XMFLOAT3& H : halfVectors)
+			{
+				const float VoH = V.x * H.x + V.y * H.y + V.z * H.z;
+				XMFLOAT3 L(2.0f * VoH * H.x - V.x, 2.0f * VoH * H.y - V.y, 2.0f * VoH * H.z - V.z);
+				const float length = sqrtf(L.x * L.x + L.y * L.y + L.z * L.z);
+				const float NdotL = std::clamp(L.y / length, 0.0f, 1.0f);
+				if (NdotL > 0.0f)
+				{
+					const float G_Vis = V_SmithGGXCorrelated(NdotL, NdotV, roughness);
+					const float c = 1.0f - std::clamp(VoH, 0.0f, 1.0f);
+					const float Fc = c * c * c * c * c;
+					A += (1.0f - Fc) * G_Vis;
+					B += Fc * G_Vis;
+				}
+			}
+			outLUT[(size_t)y * resolution + x] = XMFLOAT2(A / samples, B / samples);
+		}
+	}, maxThreads);
+}
+
+void SIBLBaker::Bake(const uint16_t* panorama, uint32_t width, uint32_t height, const Settings& settings, Result& outResult)
+{
+	Timings& timings = outResult.timings;
+	auto start = std::chrono::high_resolution_clock::now();
+	ProjectPanorama(panorama, width, height, settings.envMapResolution, settings.envMapMips, outResult.envMap, settings.maxThreads);
+	timings.envMap = MillisecondsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	GenerateMips(outResult.envMap, settings.maxThreads);
+	timings.mips = MillisecondsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	ProjectIrradiance(outResult.envMap, settings.irradianceResolution, outResult.irradianceSH, settings.maxThreads);
+	timings.irradiance = MillisecondsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	if (settings.prefilterMIS)
+		PrefilterMIS(outResult.envMap, settings.prefilteredResolution, settings.prefilteredMips, settings.prefilterSamples, outResult.prefiltered, settings.maxThreads);
+	else
+		Prefilter(outResult.envMap, settings.prefilteredResolution, settings.prefilteredMips, settings.prefilterSamples, outResult.prefiltered, settings.maxThreads);
+	timings.prefilter = MillisecondsSince(start);
+
+	start = std::chrono::high_resolution_clock::now();
+	SBRDFLUT::Generate(settings.BRDFResolution, settings.BRDFMode, outResult.BRDF);
+	timings.BRDF = MillisecondsSince(start);
+}
+
+void SIBLBaker::CookBRDF(const Settings& settings, const std::vector<XMFLOAT2>& LUT, uint64_t key, std::vector<uint8_t>& outImage)
+{
+	std::vector<uint8_t> texels;
+	SBRDFLUT::Encode(LUT, settings.BRDFFormat, texels);
+	const STextureCache::Subresource BRDF = { texels.data(), texels.size() / settings.BRDFResolution };
+	STextureCache::CookSubresources(&BRDF, settings.BRDFFormat, settings.BRDFResolution, settings.BRDFResolution, 1, 1, false,
+		SIBLCache::GetMapSettings(SIBLCache::MAP_BRDF), key, outImage);
+}
+
+bool SIBLBaker::WriteCache(const char* filename, uint64_t key, const Settings& settings, const Result& result)
+{
+	std::vector<uint8_t> images[SIBLCache::MAP_COUNT];
+	const Cubemap* const cubemaps[] = { &result.envMap, &result.prefiltered };
+	for (uint32_t i = 0; i < sizeof(cubemaps) / sizeof(cubemaps[0]); ++i)
+	{
+		const Cubemap& cubemap = *cubemaps[i];
+		std::vector<STextureCache::Subresource> subresources(cubemap.subresources.size());
+		for (size_t s = 0; s < subresources.size(); ++s)
+			subresources[s] = { cubemap.subresources[s].data(), (size_t)cubemap.GetMipSize((uint32_t)(s % cubemap.mipCount)) * 4 * sizeof(uint16_t) };
+		STextureCache::CookSubresources(subresources.data(), DXGI_FORMAT_R16G16B16A16_FLOAT, cubemap.size, cubemap.size, cubemap.mipCount, 6, true,
+			SIBLCache::GetMapSettings(i), key, images[i]);
+	}
+
+	CookBRDF(settings, result.BRDF, key, images[SIBLCache::MAP_BRDF]);
+
+	const std::vector<uint8_t>* const imagePointers[SIBLCache::MAP_COUNT] = { &images[0], &images[1], &images[2] };
+	return SIBLCache::Write(filename, key, imagePointers, result.irradianceSH);
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "SBRDFLUT.h"
+#include "SIBLCache.h"
+#include "STextureCache.h"
+#include "SSphericalHarmonics.h"
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Image based lighting precompute on the CPU, without a device: the equirectangular HDRI projected onto the
+// environment cubemap and its mips, SH9 irradiance, the GGX pre-filtered cubemap and the split sum BRDF LUT.
+// Every stage but the optional PrefilterMIS follows the formulas of the bake shaders (spherical2Cube, generateMipmaps,
+// prefilterEnvMap and createBRDFMap.hlsl), spread over ParallelFor. The LUT the bake writes comes from SBRDFLUT,
+// which is generated with IntegrateBRDF ahead of time.
+//
+// The engine and the -bakeibl command line share the cache key below, so a .sibl cache written by
+// either one is loaded by the other.
+namespace SIBLBaker
+{
+	constexpr uint32_t BAKE_VERSION = 4;  // Bump whenever a bake stage or shader changes its output
+
+	struct Settings
+	{
+		uint32_t envMapResolution = 2048;
+		uint32_t envMapMips = 9;  // 2048 down to 8
+		uint32_t prefilteredResolution = 256;
+		uint32_t prefilteredMips = 6;  // 256 down to 8, one roughness per level
+		uint32_t irradianceResolution = 128;  // Largest environment map mip the irradiance SH are projected from
+		uint32_t BRDFResolution = 256;
+		SBRDFLUT::Mode BRDFMode = SBRDFLUT::Mode::Table;
+		DXGI_FORMAT BRDFFormat = DXGI_FORMAT_R16G16_FLOAT;  // One SBRDFLUT::Encode supports
+		// That of prefilterEnvMap.hlsl, so the CPU bake writes the cache the GPU one would
+		uint32_t prefilterSamples = 65536;
+		// PrefilterMIS instead of Prefilter, which needs about 1/32 of the samples for the same noise
+		bool prefilterMIS = false;
+
+		uint32_t maxThreads = 0;  // 0: one per core, not part of the cache key
+	};
+
+	// Half float RGBA cubemap. Subresources in D3D12 order (face * mipCount + mip), rows tightly packed.
+	struct Cubemap
+	{
+		uint32_t size = 0;
+		uint32_t mipCount = 0;
+		std::vector<std::vector<uint16_t>> subresources;
+
+		inline uint32_t GetMipSize(uint32_t mip) const { return size >> mip > 0 ? size >> mip : 1; }
+		inline const uint16_t* GetTexels(uint32_t face, uint32_t mip) const { return subresources[face * mipCount + mip].data(); }
+		inline uint16_t* GetTexels(uint32_t face, uint32_t mip) { return subresources[face * mipCount + mip].data(); }
+		void Allocate(uint32_t size, uint32_t mipCount);
+	};
+
+	// Milliseconds per stage
+	struct Timings
+	{
+		double decode = 0.0;  // Set by the caller of Bake
+		double envMap = 0.0;
+		double mips = 0.0;
+		double irradiance = 0.0;
+		double prefilter = 0.0;
+		double BRDF = 0.0;
+	};
+
+	struct Result
+	{
+		Cubemap envMap;
+		Cubemap prefiltered;
+		DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+		std::vector<DirectX::XMFLOAT2> BRDF;  // BRDFResolution^2 scale and bias; x: NoV, y: roughness
+		Timings timings;
+	};
+
+	// Cache key of [filename]: its contents, BAKE_VERSION, the BRDF table and every resolution, mip, sample count,
+	// pre-filter and BRDF option of [settings].
+	// 0 if the file can't be read.
+	uint64_t HashSource(const char* filename, const Settings& settings);
+
+	// -------------------------------------------------------
+	// Stages
+	// -------------------------------------------------------
+
+	// Samples a [width] x [height] half RGBA panorama bilinearly into mip 0 of a [size] cube with [mipCount] levels
+	void ProjectPanorama(const uint16_t* panorama, uint32_t width, uint32_t height, uint32_t size, uint32_t mipCount, Cubemap& outCubemap,
+		uint32_t maxThreads = 0);
+	// Fills every level past 0 with the 2 x 2 box filter of the one above, face by face as the GPU does
+	void GenerateMips(Cubemap& cubemap, uint32_t maxThreads = 0);
+	// SH9 irradiance over pi of the first mip of at most [maxSize] texels
+	void ProjectIrradiance(const Cubemap& envMap, uint32_t maxSize, DirectX::XMFLOAT3 outIrradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS],
+		uint32_t maxThreads = 0);
+	// The same from a cooked environment map, BC6H or half RGBA
+	void ProjectIrradiance(const STextureCache::View& envMap, uint32_t maxSize, DirectX::XMFLOAT3 outIrradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS],
+		uint32_t maxThreads = 0);
+	// GGX pre-filtered radiance, level m for roughness m / (mipCount - 1), with [samples] samples per texel
+	void Prefilter(const Cubemap& envMap, uint32_t size, uint32_t mipCount, uint32_t samples, Cubemap& outCubemap, uint32_t maxThreads = 0);
+	// The same lobes, integrated with multiple importance sampling of the GGX lobe and the luminance of the environment
+	// (SEnvironmentSampler), half the samples each, combined with the balance heuristic. Bright, small sources such as
+	// the sun are found by the environment samples rather than by chance. Rough levels read the first environment
+	// level of at most 256 texels, the one the distribution is built from, without filtering.
+	void PrefilterMIS(const Cubemap& envMap, uint32_t size, uint32_t mipCount, uint32_t samples, Cubemap& outCubemap, uint32_t maxThreads = 0);
+	// Split sum scale and bias of F0 for NoV = (x + 1) / resolution and roughness = (y + 1) / resolution
+	void IntegrateBRDF(uint32_t resolution, uint32_t samples, std::vector<DirectX::XMFLOAT2>& outLUT, uint32_t maxThreads = 0);
+
+	// Runs every stage on a [width] x [height] half RGBA panorama, such as STexture::DecodeHalfRGBA gives.
+	// Decoding is left to the caller, and so is timings.decode.
+	void Bake(const uint16_t* panorama, uint32_t width, uint32_t height, const Settings& settings, Result& outResult);
+	// The .stex image of a BRDF LUT in the format of [settings], with [key] as its source hash
+	void CookBRDF(const Settings& settings, const std::vector<DirectX::XMFLOAT2>& LUT, uint64_t key, std::vector<uint8_t>& outImage);
+	// Compresses the cubemaps of [result] to BC6H and writes them, its BRDF LUT and irradiance as the .sibl cache [filename]
+	// with [key], usually HashSource of the HDRI and [settings]. False if the file can't be written.
+	bool WriteCache(const char* filename, uint64_t key, const Settings& settings, const Result& result);
+
+	// -------------------------------------------------------
+	// Shader formulas, from helperFunctions.hlsli
+	// -------------------------------------------------------
+
+	DirectX::XMFLOAT2 Hammersley(uint32_t index, uint32_t count);
+	DirectX::XMFLOAT3 ImportanceSampleGGX(DirectX::XMFLOAT2 Xi, float roughness, const DirectX::XMFLOAT3& N);
+	float V_SmithGGXCorrelated(float NdotL, float NdotV, float alphaG);
+	// Panorama coordinates of a unit direction
+	DirectX::XMFLOAT2 SampleSphericalMap(const DirectX::XMFLOAT3& direction);
+	// A TextureCube SampleLevel with linear filtering within a level and the nearest level, clamped at face edges
+	DirectX::XMFLOAT4 SampleCubemap(const Cubemap& cubemap, const DirectX::XMFLOAT3& direction, float lod);
+}
@@ -0,0 +1,161 @@
+#include "SIBLCache.h"
+#include "FileHash.h"
+#include "StringFormat.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+	inline uint64_t AlignUp(uint64_t value)
+	{
+		return (value + SIBLCache::ALIGNMENT - 1) & ~(SIBLCache::ALIGNMENT - 1);
+	}
+}
+
+STextureCache::Settings SIBLCache::GetMapSettings(uint32_t map)
+{
+	STextureCache::Settings settings;
+	settings.generateMips = 0;  // Every level is baked
+	settings.compression = map == MAP_BRDF ? STextureCache::Compression::None : STextureCache::Compression::BC6H;
+	return settings;
+}
+
+std::string SIBLCache::GetCachePath(const char* directory, uint64_t key)
+{
+	return string_format("%s/%016llx.sibl", directory, (unsigned long long)key);
+}
+
+bool SIBLCache::Validate(const uint8_t* bytes, uint64_t size, uint64_t key, View& outView)
+{
+	if (!bytes || size < sizeof(Header))
+		return false;
+
+	Header header;
+	memcpy(&header, bytes, sizeof(Header));
+	if (header.magic != MAGIC
+		|| header.formatVersion != FORMAT_VERSION
+		|| header.key != key
+		|| header.fileSize != size)
+		return false;
+
+	// The maps are about to be read whole for the upload, so hashing them first costs little more than the page faults
+	if (header.checksum != HashBytes(bytes + sizeof(Header), (size_t)(size - sizeof(Header))))
+		return false;
+
+	View view;
+	for (uint32_t i = 0; i < MAP_COUNT; ++i)
+	{
+		const MapEntry& map = header.maps[i];
+		if (map.offset % ALIGNMENT != 0
+			|| map.offset < sizeof(Header)
+			|| map.offset > size
+			|| map.size > size - map.offset
+			|| !STextureCache::Validate(bytes + map.offset, map.size, key, STextureCache::HashSettings(GetMapSettings(i)), view.maps[i])
+			|| view.maps[i].cubemap != (i != MAP_BRDF))
+			return false;
+	}
+	memcpy(view.irradianceSH, header.irradianceSH, sizeof(view.irradianceSH));
+
+	outView = view;
+	return true;
+}
+
+bool SIBLCache::Write(const char* filename, uint64_t key, const std::vector<uint8_t>* const images[MAP_COUNT],
+	const DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS])
+{
+	Header header = {};
+	header.magic = MAGIC;
+	header.formatVersion = FORMAT_VERSION;
+	header.key = key;
+	memcpy(header.irradianceSH, irradianceSH, sizeof(header.irradianceSH));
+
+	uint64_t offset = sizeof(Header);
+	for (uint32_t i = 0; i < MAP_COUNT; ++i)
+	{
+		header.maps[i].offset = AlignUp(offset);
+		header.maps[i].size = images[i]->size();
+		offset = header.maps[i].offset + header.maps[i].size;
+	}
+	header.fileSize = offset;
+
+	// The checksum runs over the padding too, hashed in the order it is written
+	std::vector<uint8_t> body((size_t)(header.fileSize - sizeof(Header)), 0);
+	for (uint32_t i = 0; i < MAP_COUNT; ++i)
+		memcpy(body.data() + (header.maps[i].offset - sizeof(Header)), images[i]->data(), images[i]->size());
+	header.checksum = HashBytes(body.data(), body.size());
+
+	std::error_code error;
+	const std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+	if (!directory.empty())
+		std::filesystem::create_directories(directory, error);
+
+	std::string tempFilename = std::string(filename) + ".tmp";
+	FILE* file = fopen(tempFilename.c_str(), "wb");
+	if (!file)
+		return false;
+
+	bool ok = fwrite(&header, sizeof(Header), 1, file) == 1;
+	ok = ok && fwrite(body.data(), body.size(), 1, file) == 1;
+	ok = (fclose(file) == 0) && ok;
+
+	// Replaces an existing cache in one step
+	if (ok)
+		std::filesystem::rename(tempFilename, filename, error);
+	if (!ok || error)
+	{
+		std::filesystem::remove(tempFilename, error);
+		return false;
+	}
+	return true;
+}
+
+void SIBLCache::Touch(const char* filename)
+{
+	std::error_code error;
+	std::filesystem::last_write_time(filename, std::filesystem::file_time_type::clock::now(), error);
+}
+
+uint64_t SIBLCache::Evict(const char* directory, uint64_t capacity, const char* keep)
+{
+	struct Entry
+	{
+		std::filesystem::path path;
+		std::filesystem::file_time_type lastUse;
+		uint64_t size;
+	};
+	std::vector<Entry> entries;
+	uint64_t total = 0;
+
+	std::error_code error;
+	for (std::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+	{
+		std::error_code entryError;
+		if (!it->is_regular_file(entryError) || it->path().extension() != ".sibl")
+			continue;
+		Entry entry = { it->path(), it->last_write_time(entryError), it->file_size(entryError) };
+		if (entryError)
+			continue;
+		entries.push_back(entry);
+		total += entry.size;
+	}
+
+	std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+	uint64_t freed = 0;
+	for (const Entry& entry : entries)
+	{
+		if (total <= capacity)
+			break;
+		if (keep && std::filesystem::equivalent(entry.path, keep, error))
+			continue;
+		// A file still mapped by another process fails to delete and stays
+		if (std::filesystem::remove(entry.path, error))
+		{
+			total -= entry.size;
+			freed += entry.size;
+		}
+	}
+	return freed;
+}
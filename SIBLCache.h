@@ -0,0 +1,83 @@
+#pragma once
+
+#include "SSphericalHarmonics.h"
+#include "STextureCache.h"
+
+#include <DirectXMath.h>
+
+#include <string>
+#include <vector>
+
+// .sibl: everything the image based lighting of one HDRI bakes into, in a single file.
+//
+// Layout: a fixed size Header holding the SH9 irradiance, then the environment, pre-filtered and BRDF maps as
+// complete .stex images, each starting on an ALIGNMENT boundary and listed in the header's map table, so the
+// maps of a mapped file are uploaded in place. The header's checksum covers every byte after it.
+//
+// Files are named after their key, the hash of the HDRI's contents and of every bake parameter, and share one
+// directory that Evict keeps under a size budget by deleting the least recently used files.
+namespace SIBLCache
+{
+	constexpr uint32_t MAGIC = 0x4C424953; // "SIBL"
+	constexpr uint32_t FORMAT_VERSION = 1;
+
+	constexpr uint64_t ALIGNMENT = 4096;
+
+	constexpr const char* DEFAULT_DIRECTORY = "cache/ibl";
+	constexpr uint64_t DEFAULT_CAPACITY = 512ull << 20;  // About 15 HDRIs at the default resolutions
+
+	enum Map : uint32_t
+	{
+		MAP_ENVIRONMENT,  // BC6H cubemap
+		MAP_PREFILTERED,  // BC6H cubemap, one roughness per level
+		MAP_BRDF,         // SBRDFLUT, in SIBLBaker::Settings::BRDFFormat
+		MAP_COUNT
+	};
+
+	struct MapEntry
+	{
+		uint64_t offset;
+		uint64_t size;
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t formatVersion;
+		uint64_t key;
+		uint64_t fileSize;
+		uint64_t checksum;  // HashBytes (FileHash.h) of everything after the header
+		DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+		uint32_t reserved;
+		MapEntry maps[MAP_COUNT];
+	};
+
+	// Cache contents, pointing into a mapped file or an image in memory
+	struct View
+	{
+		STextureCache::View maps[MAP_COUNT];
+		DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+	};
+
+	// Cooker settings of each map; the embedded images are checked against them
+	STextureCache::Settings GetMapSettings(uint32_t map);
+
+	// "<directory>/<key in hex>.sibl"
+	std::string GetCachePath(const char* directory, uint64_t key);
+
+	// Checks the header, key, checksum and map table of a cache image, and every embedded image,
+	// and points [outView] at the maps. Returns false for stale or corrupt files.
+	bool Validate(const uint8_t* bytes, uint64_t size, uint64_t key, View& outView);
+
+	// Writes [images], .stex images cooked with GetMapSettings and [key] as their source hash, and the irradiance.
+	// Creates the directory if needed, writes to a temporary file first and moves it into place.
+	bool Write(const char* filename, uint64_t key, const std::vector<uint8_t>* const images[MAP_COUNT],
+		const DirectX::XMFLOAT3 irradianceSH[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS]);
+
+	// Marks a cache as just used, for Evict
+	void Touch(const char* filename);
+
+	// Deletes the least recently used .sibl files of [directory] until the others fit in [capacity] bytes.
+	// [keep] is never deleted. Returns the number of bytes freed.
+	uint64_t Evict(const char* directory, uint64_t capacity, const char* keep = nullptr);
+}
@@ -0,0 +1,121 @@
+#include "SInstanceBatcher.h"
+
+#include <cassert>
+#include <immintrin.h>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr uint32_t SECTION_SHIFT = 4;
+	constexpr uint32_t MESH_SHIFT = 16;
+
+	inline uint32_t MakeKey(uint32_t mesh, uint32_t section, uint32_t lod)
+	{
+		return (mesh << MESH_SHIFT) | (section << SECTION_SHIFT) | lod;
+	}
+}
+
+void SInstanceBatcher::Clear()
+{
+	m_keys.clear();
+	m_pending.clear();
+	m_order.clear();
+	m_batches.clear();
+}
+
+void SInstanceBatcher::Reserve(size_t count)
+{
+	m_keys.reserve(count);
+	m_pending.reserve(count);
+}
+
+void SInstanceBatcher::Add(uint32_t mesh, uint32_t section, uint32_t lod, const XMFLOAT4X4& model, const XMFLOAT4X4& normalMatrix, uint32_t materialIndex)
+{
+	assert(mesh < MAX_MESHES && section < MAX_SECTIONS && lod < MAX_LODS);
+
+	InstanceData instance = {};
+	instance.model = model;
+	instance.normalMatrix = normalMatrix;
+	instance.materialIndex = materialIndex;
+
+	m_keys.push_back(MakeKey(mesh, section, lod));
+	m_pending.push_back(instance);
+}
+
+void SInstanceBatcher::Build()
+{
+	const uint32_t count = (uint32_t)m_keys.size();
+	m_order.clear();
+	m_batches.clear();
+	if (count == 0)
+		return;
+
+	m_order.resize(count);
+	for (uint32_t i = 0; i < count; ++i)
+		m_order[i] = i;
+
+	// LSD radix sort over the bytes of the key, which keeps equal keys in the order they were added.
+	// Bytes every key shares are skipped, so a scene with few meshes and sections sorts in one or two passes.
+	m_orderScratch.resize(count);
+	m_sortedKeys.assign(m_keys.begin(), m_keys.end());
+	m_keysScratch.resize(count);
+	for (uint32_t shift = 0; shift < 32; shift += 8)
+	{
+		uint32_t histogram[256] = {};
+		for (uint32_t i = 0; i < count; ++i)
+			++histogram[(m_sortedKeys[i] >> shift) & 0xFF];
+		if (histogram[(m_sortedKeys[0] >> shift) & 0xFF] == count)
+			continue;
+
+		uint32_t offsets[256];
+		uint32_t sum = 0;
+		for (uint32_t b = 0; b < 256; ++b)
+		{
+			offsets[b] = sum;
+			sum += histogram[b];
+		}
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint32_t dst = offsets[(m_sortedKeys[i] >> shift) & 0xFF]++;
+			m_keysScratch[dst] = m_sortedKeys[i];
+			m_orderScratch[dst] = m_order[i];
+		}
+		m_sortedKeys.swap(m_keysScratch);
+		m_order.swap(m_orderScratch);
+	}
+
+	// Cut a batch wherever the key changes
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const uint32_t key = m_sortedKeys[i];
+		if (i == 0 || key != m_sortedKeys[i - 1])
+		{
+			SInstanceBatch batch;
+			batch.mesh = key >> MESH_SHIFT;
+			batch.section = (key >> SECTION_SHIFT) & (MAX_SECTIONS - 1);
+			batch.lod = key & (MAX_LODS - 1);
+			batch.firstInstance = i;
+			batch.instanceCount = 0;
+			m_batches.push_back(batch);
+		}
+		++m_batches.back().instanceCount;
+	}
+}
+
+void SInstanceBatcher::WriteInstances(InstanceData* dst) const
+{
+	static_assert(sizeof(InstanceData) % sizeof(__m128) == 0, "InstanceData must be a whole number of SSE registers");
+	constexpr size_t REGISTERS = sizeof(InstanceData) / sizeof(__m128);
+	assert(((uintptr_t)dst & 15) == 0);
+
+	float* out = (float*)dst;
+	for (uint32_t index : m_order)
+	{
+		const float* in = (const float*)&m_pending[index];
+		for (size_t r = 0; r < REGISTERS; ++r, in += 4, out += 4)
+			_mm_stream_ps(out, _mm_loadu_ps(in));
+	}
+	_mm_sfence();
+}
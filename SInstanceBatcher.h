@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ShaderSharedStructs.h"
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+// A run of instances drawn with one DrawIndexedInstanced: LOD [lod] of section [section] of mesh [mesh],
+// placed by the [instanceCount] consecutive instances of SInstanceBatcher from [firstInstance] on.
+struct SInstanceBatch
+{
+	uint32_t mesh;
+	uint32_t section;
+	uint32_t lod;
+	uint32_t firstInstance;
+	uint32_t instanceCount;
+};
+
+// Groups the draws of a frame by mesh, section and LOD, and packs their InstanceData in batch order
+// into the instance buffer. Knows nothing about the device: meshes are plain ids chosen by the caller.
+class SInstanceBatcher
+{
+public:
+	static constexpr uint32_t MAX_MESHES = 1u << 16;
+	static constexpr uint32_t MAX_SECTIONS = 1u << 12;
+	static constexpr uint32_t MAX_LODS = 1u << 4;
+
+private:
+	// Submitted draws, in the order of Add
+	std::vector<uint32_t> m_keys;
+	std::vector<InstanceData> m_pending;
+
+	// Radix sort buffers
+	std::vector<uint32_t> m_sortedKeys;
+	std::vector<uint32_t> m_keysScratch;
+	std::vector<uint32_t> m_order;  // Index into [m_pending] of each sorted key
+	std::vector<uint32_t> m_orderScratch;
+
+	std::vector<SInstanceBatch> m_batches;
+
+public:
+	inline size_t size() const { return m_keys.size(); }
+	void Clear();
+	void Reserve(size_t count);
+
+	// [model], [normalMatrix]: row vectors, as DirectXMath, see STransformStore
+	void Add(uint32_t mesh, uint32_t section, uint32_t lod, const DirectX::XMFLOAT4X4& model, const DirectX::XMFLOAT4X4& normalMatrix, uint32_t materialIndex);
+
+	// Sorts the draws added since Clear by mesh, then section, then LOD. Draws sharing all three keep
+	// the order they were added in and become a single batch.
+	void Build();
+
+	inline const std::vector<SInstanceBatch>& GetBatches() const { return m_batches; }
+	// Instance [index] in batch order
+	inline const InstanceData& GetInstance(uint32_t index) const { return m_pending[m_order[index]]; }
+
+	// Writes all size() instances to [dst] in batch order, with streaming stores that bypass the cache:
+	// [dst] is meant to be write-combined upload heap memory, aligned to 16 bytes, that is not read back.
+	void WriteInstances(InstanceData* dst) const;
+};
@@ -3,16 +3,24 @@
 
 #include "DXSampleHelper.h"
 #include "HelperFunctions.h"
+#include "SObjReader.h"
+#include "SGLTFReader.h"
+#include "SMeshBVH.h"
+#include "SMeshCache.h"
+#include "SMeshCook.h"
+#include "SMeshOptimizer.h"
+#include "SMeshTangents.h"
+#include "SMeshWeld.h"
+#include "VertexPacking.h"
 //#include "OBJ_Loader.h"
 
 #include <iostream>
+#include <chrono>
+#include <type_traits>
 
 #define TINYOBJLOADER_IMPLEMENTATION 
 #include "tiny_obj_loader.h"
 
-#define CGLTF_IMPLEMENTATION
-#include "cgltf.h"
-
 using namespace DirectX;
 using std::vector;
 
@@ -29,168 +37,48 @@ void SMesh::_LoadArray(const vector<SVertex>& vertices, const vector<UINT32>& in
 {
 	SMeshSection sms;
 	sms.baseVertexLocation = (UINT32)m_vertices.size();
-	sms.startIndexLocation = (UINT32)m_indices.size();
+	sms.startIndexLocation = (UINT32)(m_indices.size() + m_shortIndices.size());
 	sms.indexCount = (UINT32)indices.size();
 	m_meshSections.push_back(sms);
 	m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end());
-	m_indices.insert(m_indices.end(), indices.begin(), indices.end());
-}
-
-void SMesh::_LoadGLTF(const char* filename)
-{
-	cgltf_options Options = {};
-	cgltf_data* Data = nullptr;
+	if (m_indices.empty() && SMeshCache::FitsShortIndices(indices.data(), indices.size()))
 	{
-		cgltf_result R = cgltf_parse_file(&Options, filename, &Data);
-		assert(R == cgltf_result_success);
-		R = cgltf_load_buffers(&Options, Data, filename);
-		assert(R == cgltf_result_success);
+		for (UINT32 index : indices)
+			m_shortIndices.push_back((UINT16)index);
 	}
-
-	cgltf_mesh* Mesh = &Data->meshes[0];
-	//assert(Mesh->primitives_count <= MESH_MAX_NUM_SECTIONS);
-
-	auto sectionOffset = m_meshSections.size();
-
-	UINT32 TotalNumVertices = 0;
-	UINT32 TotalNumIndices = 0;
-
-	for (UINT32 SectionIdx = 0; SectionIdx < Mesh->primitives_count; ++SectionIdx)
+	else
 	{
-		assert(Data->meshes[0].primitives[SectionIdx].indices);
-		assert(Data->meshes[0].primitives[SectionIdx].attributes);
-
-		m_meshSections.push_back(SMeshSection());
-
-		TotalNumIndices += (UINT32)Data->meshes[0].primitives[SectionIdx].indices->count;
-		TotalNumVertices += (UINT32)Data->meshes[0].primitives[SectionIdx].attributes[0].data->count;
+		_WidenIndices();
+		m_indices.insert(m_indices.end(), indices.begin(), indices.end());
 	}
+}
 
-	//InOutVertices.reserve(InOutVertices.size() + TotalNumVertices);
-	//InOutIndices.reserve(InOutIndices.size() + TotalNumIndices);
-
-	vector<XMFLOAT3> positions;
-	vector<XMFLOAT2> texcoords;
-	vector<XMFLOAT3> normals;
-	//vector<XMFLOAT3> tangents;
-	positions.reserve(TotalNumVertices);
-	texcoords.reserve(TotalNumVertices);
-	normals.reserve(TotalNumVertices);
-	//tangents.reserve(TotalNumVertices);
-	//memset(positions.data(), 0, positions.size() * sizeof(XMFLOAT3));
-	//memset(texcoords.data(), 0, texcoords.size() * sizeof(XMFLOAT2));
-	//memset(normals.data(), 0, normals.size() * sizeof(XMFLOAT3));
-	//memset(tangents.data(), 0, tangents.size() * sizeof(XMFLOAT3));
-
-	for (UINT32 SectionIdx = 0; SectionIdx < Mesh->primitives_count; ++SectionIdx)
+void SMesh::_LoadGLTF(const char* filename)
+{
+	if (!SGLTFReader::Append(filename, m_vertices, m_indices, m_shortIndices, m_meshSections))
 	{
-		// Indices.
-		{
-			const cgltf_accessor* Accessor = Data->meshes[0].primitives[SectionIdx].indices;
-
-			assert(Accessor->buffer_view);
-			assert(Accessor->stride == Accessor->buffer_view->stride || Accessor->buffer_view->stride == 0);
-			assert((Accessor->stride * Accessor->count) == Accessor->buffer_view->size);
-
-			const auto DataAddr = (const UINT8*)Accessor->buffer_view->buffer->data + Accessor->offset + Accessor->buffer_view->offset;
-
-			m_meshSections[sectionOffset + SectionIdx].startIndexLocation = (UINT32)m_indices.size();
-			m_meshSections[sectionOffset + SectionIdx].indexCount = (UINT32)Accessor->count;
-
-			if (Accessor->stride == 1)
-			{
-				const UINT8* DataU8 = (const UINT8*)DataAddr;
-				for (UINT32 Idx = 0; Idx < Accessor->count; ++Idx)
-				{
-					m_indices.push_back((UINT32)*DataU8++);
-				}
-			}
-			else if (Accessor->stride == 2)
-			{
-				const UINT16* DataU16 = (const UINT16*)DataAddr;
-				for (UINT32 Idx = 0; Idx < Accessor->count; ++Idx)
-				{
-					m_indices.push_back((UINT32)*DataU16++);
-				}
-			}
-			else if (Accessor->stride == 4)
-			{
-				m_indices.resize(m_indices.size() + Accessor->count);
-				memcpy(&m_indices[m_indices.size() - Accessor->count], DataAddr, Accessor->count * Accessor->stride);
-			}
-			else
-			{
-				assert(0);
-			}
-		}
-
-		// Attributes.
-		{
-			const UINT32 NumAttribs = (UINT32)Data->meshes[0].primitives[SectionIdx].attributes_count;
-
-			for (UINT32 AttribIdx = 0; AttribIdx < NumAttribs; ++AttribIdx)
-			{
-				const cgltf_attribute* Attrib = &Data->meshes[0].primitives[SectionIdx].attributes[AttribIdx];
-				const cgltf_accessor* Accessor = Attrib->data;
-
-				assert(Accessor->buffer_view);
-				assert(Accessor->stride == Accessor->buffer_view->stride || Accessor->buffer_view->stride == 0);
-				assert((Accessor->stride * Accessor->count) == Accessor->buffer_view->size);
-
-				const auto DataAddr = (const UINT8*)Accessor->buffer_view->buffer->data + Accessor->offset + Accessor->buffer_view->offset;
-
-				if (Attrib->type == cgltf_attribute_type_position)
-				{
-					assert(Accessor->type == cgltf_type_vec3);
-					positions.resize(Accessor->count);
-					memcpy(positions.data(), DataAddr, Accessor->count * Accessor->stride);
-				}
-				else if (Attrib->type == cgltf_attribute_type_texcoord)
-				{
-					assert(Accessor->type == cgltf_type_vec2);
-					texcoords.resize(Accessor->count);
-					memcpy(texcoords.data(), DataAddr, Accessor->count * Accessor->stride);
-				}
-				else if (Attrib->type == cgltf_attribute_type_normal)
-				{
-					assert(Accessor->type == cgltf_type_vec3);
-					normals.resize(Accessor->count);
-					memcpy(normals.data(), DataAddr, Accessor->count * Accessor->stride);
-				}
-				//else if (Attrib->type == cgltf_attribute_type_tangent)
-				//{
-				//	assert(Accessor->type == cgltf_type_vec3);
-				//	tangents.resize(Accessor->count);
-				//	memcpy(tangents.data(), DataAddr, Accessor->count * Accessor->stride);
-				//}
-			}
-
-			assert(positions.size() > 0 && positions.size() == normals.size());
-
-			m_meshSections[sectionOffset + SectionIdx].baseVertexLocation = (UINT32)m_vertices.size();
-
-			for (UINT32 Idx = 0; Idx < positions.size(); ++Idx)
-			{
-				SVertex Vertex;
-				Vertex.position = positions[Idx];
-				Vertex.uv = texcoords[Idx];
-				Vertex.normal = normals[Idx];
-				//Vertex.tangent = tangents[Idx];
-				m_vertices.push_back(Vertex);
-			}
-
-			positions.clear();
-			texcoords.clear();
-			normals.clear();
-			//tangents.clear();
-		}
+		throw std::runtime_error(string_format("Failed to load %s", filename));
 	}
-
-	cgltf_free(Data);
 }
 
 void SMesh::_LoadOBJ(const char* filename)
 {
+	// Fast path: memory mapped, multithreaded reader for plain geometry files
+	SObjReader objReader;
+	if (objReader.Parse(filename))
+	{
+		OutputDebugStringA(string_format("SObjReader: %s, %.1f MB in %.1f ms (%.1f MB/s, %u threads)\n",
+			filename,
+			objReader.GetFileSize() / 1048576.0,
+			objReader.GetParseMilliseconds(),
+			objReader.GetFileSize() / 1048576.0 / (objReader.GetParseMilliseconds() / 1000.0),
+			objReader.GetThreadCount()).c_str());
+
+		_AppendOBJShapes(objReader.GetAttrib(), objReader.GetShapes());
+		return;
+	}
+
+	// Files with materials or other statements SObjReader does not handle go through tinyobj
 	tinyobj::ObjReaderConfig reader_config;
 	reader_config.mtl_search_path = "./"; // Path to material files
 
@@ -207,73 +95,20 @@ void SMesh::_LoadOBJ(const char* filename)
 		std::cout << "TinyObjReader: " << reader.Warning();
 	}
 
-	auto& attrib = reader.GetAttrib();
-	auto& shapes = reader.GetShapes();
-	auto& materials = reader.GetMaterials();
-
-	// Loop over shapes
-	for (size_t s = 0; s < shapes.size(); s++) {
-
-		vector<SVertex> vertices;
-		m_meshSections.push_back(SMeshSection());
-		m_meshSections.back().baseVertexLocation = (UINT32)m_vertices.size();
-		m_meshSections.back().startIndexLocation = (UINT32)m_indices.size();
-		m_meshSections.back().indexCount = (UINT32)shapes[s].mesh.indices.size();
-		m_indices.reserve(m_indices.size() + shapes[s].mesh.indices.size());
-
-		// Loop over faces(polygon)
-		size_t index_offset = 0;
-		for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-
-			// Loop over vertices in the face.
-			size_t fv = size_t(shapes[s].mesh.num_face_vertices[f]);
-			assert(fv == 3);  // Only triangle faces are supported
-
-			for (size_t v = 0; v < fv; v++) {
-
-				// Re-order vertices to fix the winding order to match DirectX 12
-				size_t reordered_v = v;
-				if (v == 1) reordered_v = 2;
-				if (v == 2) reordered_v = 1;
-				m_indices.push_back(index_offset + reordered_v);
-
-				// access to vertex
-				tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-				
-				SVertex vertex;
-				vertex.position = XMFLOAT3(
-					attrib.vertices[3 * size_t(idx.vertex_index) + 0],
-					attrib.vertices[3 * size_t(idx.vertex_index) + 1],
-					attrib.vertices[3 * size_t(idx.vertex_index) + 2]);
-
-				// Check if `normal_index` is zero or positive. negative = no normal data
-				if (idx.normal_index >= 0) {
-					vertex.normal = XMFLOAT3(
-						attrib.normals[3 * size_t(idx.normal_index) + 0],
-						attrib.normals[3 * size_t(idx.normal_index) + 1],
-						attrib.normals[3 * size_t(idx.normal_index) + 2]);
-				}
-
-				// Check if `texcoord_index` is zero or positive. negative = no texcoord data
-				if (idx.texcoord_index >= 0) {
-					vertex.uv = XMFLOAT2(
-						attrib.texcoords[2 * size_t(idx.texcoord_index) + 0],
-						attrib.texcoords[2 * size_t(idx.texcoord_index) + 1]);
-				}
-
-				m_vertices.push_back(vertex);
-			}
-			index_offset += fv;
-		}
-	}
+	_AppendOBJShapes(reader.GetAttrib(), reader.GetShapes());
 }
 
-void SMesh::Load(const vector<SVertex>& vertices, const vector<UINT32>& indices)
+void SMesh::_AppendOBJShapes(const tinyobj::attrib_t& attrib, const vector<tinyobj::shape_t>& shapes)
 {
-	_LoadArray(vertices, indices);
+	// The weld only knows the vertex count once it is done, so its indices are narrowed afterwards
+	_WidenIndices();
+	const SMeshWeld::Statistics weld = SMeshWeld::AppendOBJShapes(attrib, shapes, m_vertices, m_indices, m_meshSections);
+	_NarrowIndices();
+	OutputDebugStringA(string_format("SMeshWeld: %zu corners welded into %zu vertices, %zu triangles (%zu faces triangulated, %zu skipped)\n",
+		weld.cornerCount, weld.vertexCount, weld.triangleCount, weld.triangulatedFaceCount, weld.skippedFaceCount).c_str());
 }
 
-void SMesh::Load(const char* filename)
+void SMesh::_LoadFile(const char* filename)
 {
 	if (ends_with(filename, ".obj"))
 	{
@@ -289,110 +124,334 @@ void SMesh::Load(const char* filename)
 	}
 }
 
-void SMesh::GenerateNormals()
+bool SMesh::_LoadCache(const char* filename, uint64_t sourceHash)
+{
+	auto cacheFile = std::make_shared<MappedFile>();
+	SMeshCache::View view;
+	if (!cacheFile->Open(filename) || !SMeshCache::Validate(*cacheFile, sourceHash, view))
+		return false;
+
+	m_cacheFile = cacheFile;
+	m_cachedVertices = view.vertices;
+	m_cachedVertexCount = (size_t)view.vertexCount;
+	m_cachedIndices = view.indices;
+	m_cachedIndexCount = (size_t)view.indexCount;
+	m_cachedIndexSize = view.indexSize;
+	m_meshSections.assign(view.sections, view.sections + view.sectionCount);
+	m_lods.assign(view.lods, view.lods + view.lodCount);
+	m_lodOffsets.assign(view.lodOffsets, view.lodOffsets + view.lodOffsetCount);
+	m_boundsMin = view.boundsMin;
+	m_boundsMax = view.boundsMax;
+	m_sectionBounds.assign(view.sectionBounds, view.sectionBounds + view.sectionCount);
+	return true;
+}
+
+void SMesh::_MaterializeCache()
+{
+	if (!m_cacheFile)
+		return;
+
+	m_vertices.assign(m_cachedVertices, m_cachedVertices + m_cachedVertexCount);
+	if (m_cachedIndexSize == sizeof(UINT16))
+		m_shortIndices.assign((const UINT16*)m_cachedIndices, (const UINT16*)m_cachedIndices + m_cachedIndexCount);
+	else
+		m_indices.assign((const UINT32*)m_cachedIndices, (const UINT32*)m_cachedIndices + m_cachedIndexCount);
+	m_cachedVertices = nullptr;
+	m_cachedVertexCount = 0;
+	m_cachedIndices = nullptr;
+	m_cachedIndexCount = 0;
+	m_cachedIndexSize = sizeof(UINT32);
+	m_cacheFile = nullptr;
+}
+
+void SMesh::_NarrowIndices()
+{
+	if (m_indices.empty() || !SMeshCache::FitsShortIndices(m_indices.data(), m_indices.size()))
+		return;
+
+	m_shortIndices.resize(m_indices.size());
+	for (size_t i = 0; i < m_indices.size(); ++i)
+		m_shortIndices[i] = (UINT16)m_indices[i];
+	vector<UINT32>().swap(m_indices);
+}
+
+void SMesh::_WidenIndices()
+{
+	if (m_shortIndices.empty())
+		return;
+
+	m_indices.assign(m_shortIndices.begin(), m_shortIndices.end());
+	vector<UINT16>().swap(m_shortIndices);
+}
+
+const void* SMesh::_GetIndices(size_t& outCount, UINT32& outIndexSize) const
+{
+	if (m_cacheFile)
+	{
+		outCount = m_cachedIndexCount;
+		outIndexSize = m_cachedIndexSize;
+		return m_cachedIndices;
+	}
+	if (m_indices.empty())
+	{
+		outCount = m_shortIndices.size();
+		outIndexSize = sizeof(UINT16);
+		return m_shortIndices.data();
+	}
+	outCount = m_indices.size();
+	outIndexSize = sizeof(UINT32);
+	return m_indices.data();
+}
+
+void SMesh::_UpdateBounds()
+{
+	_WithIndices([&](auto& indices)
+	{
+		SMeshCook::ComputeBounds(m_vertices.data(), m_vertices.size(), indices.data(), m_meshSections.data(), m_meshSections.size(),
+			m_boundsMin, m_boundsMax, m_sectionBounds);
+	});
+}
+
+void SMesh::Load(const vector<SVertex>& vertices, const vector<UINT32>& indices)
+{
+	_MaterializeCache();
+	_ClearLODs();
+	_LoadArray(vertices, indices);
+	_UpdateBounds();
+	BuildMeshlets();
+}
+
+void SMesh::Load(const char* filename)
 {
-	for (UINT32 mesh_idx = 0; mesh_idx < m_meshSections.size(); ++mesh_idx)
+	auto start = std::chrono::high_resolution_clock::now();
+
+	// Only a mesh that starts out empty maps 1:1 to a cache file
+	const bool useCache = m_vertices.empty() && !m_cacheFile;
+	uint64_t sourceHash = 0;
+	std::string cachePath;
+	if (useCache)
 	{
-		SMeshSection& meshSection = m_meshSections[mesh_idx];
-		UINT32 offset = meshSection.baseVertexLocation;
-		for (UINT32 index_idx = meshSection.startIndexLocation; index_idx < meshSection.startIndexLocation + meshSection.indexCount; index_idx += 3)
+		sourceHash = SMeshCache::HashSource(filename);
+		cachePath = SMeshCache::GetCachePath(filename);
+		if (sourceHash != 0 && _LoadCache(cachePath.c_str(), sourceHash))
 		{
-			XMFLOAT3 v0 = m_vertices[offset + m_indices[index_idx + 0]].position;
-			XMFLOAT3 v1 = m_vertices[offset + m_indices[index_idx + 1]].position;
-			XMFLOAT3 v2 = m_vertices[offset + m_indices[index_idx + 2]].position;
-			XMFLOAT3 e0 = XMFLOAT3(v1.x - v0.x, v1.y - v0.y, v1.z - v0.z);
-			XMFLOAT3 e1 = XMFLOAT3(v2.x - v0.x, v2.y - v0.y, v2.z - v0.z);
-			XMFLOAT3 normal = XMFLOAT3(
-				e0.y * e1.z - e0.z * e1.y,
-				e0.z * e1.x - e0.x * e1.z,
-				e0.x * e1.y - e0.y * e1.x
-			);
-			for (UINT32 i = 0; i < 3; ++i)
-			{
-				m_vertices[offset + m_indices[index_idx + i]].normal = normal;
-			}
+			BuildMeshlets();
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+			OutputDebugStringA(string_format("SMesh: %s loaded from cache in %.2f ms\n", filename, elapsed.count()).c_str());
+			return;
 		}
 	}
+	else
+	{
+		_MaterializeCache();
+	}
+
+	_LoadFile(filename);
+	GenerateTangents();
+	Optimize();
+	GenerateLODs();
+	_UpdateBounds();
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: %s parsed in %.2f ms\n", filename, elapsed.count()).c_str());
+
+	if (useCache && sourceHash != 0 && !SaveCache(cachePath.c_str(), sourceHash))
+	{
+		OutputDebugStringA(string_format("SMesh: failed to write %s\n", cachePath.c_str()).c_str());
+	}
+}
+
+bool SMesh::SaveCache(const char* filename, uint64_t sourceHash) const
+{
+	SMeshCache::View view;
+	view.vertices = m_cacheFile ? m_cachedVertices : m_vertices.data();
+	view.vertexCount = m_cacheFile ? m_cachedVertexCount : m_vertices.size();
+	size_t indexCount;
+	view.indices = _GetIndices(indexCount, view.indexSize);
+	view.indexCount = indexCount;
+	view.sections = m_meshSections.data();
+	view.sectionCount = m_meshSections.size();
+	view.lods = m_lods.data();
+	view.lodCount = m_lods.size();
+	view.lodOffsets = m_lodOffsets.data();
+	view.lodOffsetCount = m_lodOffsets.size();
+	assert(m_sectionBounds.size() == m_meshSections.size());
+	view.sectionBounds = m_sectionBounds.data();
+	view.boundsMin = m_boundsMin;
+	view.boundsMax = m_boundsMax;
+	return SMeshCache::Write(filename, sourceHash, view);
+}
+
+void SMesh::GenerateNormals()
+{
+	_MaterializeCache();
+
+	auto start = std::chrono::high_resolution_clock::now();
+	_WithIndices([&](auto& indices)
+	{
+		SMeshTangents::GenerateNormals(m_vertices.data(), m_vertices.size(), indices.data(), m_meshSections.data(), m_meshSections.size());
+	});
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: normals of %zu vertices generated in %.2f ms\n", m_vertices.size(), elapsed.count()).c_str());
 }
 
 void SMesh::GenerateTangents()
 {
-	for (UINT32 mesh_idx = 0; mesh_idx < m_meshSections.size(); ++mesh_idx)
+	_MaterializeCache();
+
+	auto start = std::chrono::high_resolution_clock::now();
+	_WithIndices([&](auto& indices)
 	{
-		SMeshSection& meshSection = m_meshSections[mesh_idx];
-		UINT32 offset = meshSection.baseVertexLocation;
-		for (UINT32 index_idx = meshSection.startIndexLocation; index_idx < meshSection.startIndexLocation + meshSection.indexCount; index_idx += 3)
-		{
-			XMFLOAT3 v0 = m_vertices[offset + m_indices[index_idx + 0]].position;
-			XMFLOAT3 v1 = m_vertices[offset + m_indices[index_idx + 1]].position;
-			XMFLOAT3 v2 = m_vertices[offset + m_indices[index_idx + 2]].position;
-			XMFLOAT2 uv0 = m_vertices[offset + m_indices[index_idx + 0]].uv;
-			XMFLOAT2 uv1 = m_vertices[offset + m_indices[index_idx + 1]].uv;
-			XMFLOAT2 uv2 = m_vertices[offset + m_indices[index_idx + 2]].uv;
-			XMFLOAT3 e0 = XMFLOAT3(v1.x - v0.x, v1.y - v0.y, v1.z - v0.z);
-			XMFLOAT3 e1 = XMFLOAT3(v2.x - v0.x, v2.y - v0.y, v2.z - v0.z);
-			XMFLOAT2 duv0 = XMFLOAT2(uv1.x - uv0.x, uv1.y - uv0.y);
-			XMFLOAT2 duv1 = XMFLOAT2(uv2.x - uv0.x, uv2.y - uv0.y);
-			float f = 1.0f / (duv0.x * duv1.y - duv1.x * duv0.y);
-			XMFLOAT3 tangent = XMFLOAT3(
-				f * (duv1.y * e0.x - duv0.y * e1.x),
-				f * (duv1.y * e0.y - duv0.y * e1.y),
-				f * (duv1.y * e0.z - duv0.y * e1.z)
-			);
-			XMFLOAT3 bitangent = XMFLOAT3(
-				f * (duv0.x * e1.x - duv1.x * e0.x),
-				f * (duv0.x * e1.y - duv1.x * e0.y),
-				f * (duv0.x * e1.z - duv1.x * e0.z)
-			);
-			for (UINT32 i = 0; i < 3; ++i)
-			{
-				m_vertices[offset + m_indices[index_idx + i]].tangent = tangent;
-				m_vertices[offset + m_indices[index_idx + i]].bitangent = bitangent;
-			}
-		}
+		SMeshTangents::GenerateTangents(m_vertices.data(), m_vertices.size(), indices.data(), m_meshSections.data(), m_meshSections.size());
+	});
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: tangents of %zu vertices generated in %.2f ms\n", m_vertices.size(), elapsed.count()).c_str());
+}
+
+void SMesh::Optimize()
+{
+	_MaterializeCache();
+	_ClearLODs();
+
+	const UINT32 sectionCount = (UINT32)m_meshSections.size();
+	vector<SMeshOptimizer::VertexCacheStatistics> before(sectionCount);
+	vector<SMeshOptimizer::VertexCacheStatistics> after(sectionCount);
+	_WithIndices([&](auto& indices)
+	{
+		SMeshCook::Optimize(m_vertices.data(), indices.data(), m_meshSections.data(), sectionCount, before.data(), after.data());
+	});
+
+	for (UINT32 i = 0; i < sectionCount; ++i)
+	{
+		OutputDebugStringA(string_format("SMesh: section %u, %u triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+			i, after[i].triangleCount, before[i].acmr, after[i].acmr, before[i].atvr, after[i].atvr).c_str());
 	}
+
+	BuildMeshlets();
 }
 
-void SMesh::MoveTo(const XMFLOAT3& position)
+void SMesh::GenerateLODs(UINT32 maxLODCount, float reduction)
 {
-	m_translation = XMMatrixTranslation(position.x, position.y, position.z);
-	_UpdateModelMatrix();
+	_MaterializeCache();
+	_ClearLODs();
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	const UINT32 sectionCount = (UINT32)m_meshSections.size();
+	_WithIndices([&](auto& indices)
+	{
+		SMeshCook::GenerateLODs(m_vertices.data(), indices, m_meshSections.data(), sectionCount, maxLODCount, reduction, m_lods, m_lodOffsets);
+	});
+	UINT32 triangleCount = 0;
+	for (const SMeshSection& section : m_meshSections)
+		triangleCount += section.indexCount / 3;
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: %zu LODs of %u triangles generated in %.2f ms (%.2f Mtri/s)\n",
+		m_lods.size() - sectionCount, triangleCount, elapsed.count(), triangleCount / std::max(elapsed.count(), 1e-3) * 1e-3).c_str());
 }
 
-void SMesh::RotateBy(const DirectX::XMFLOAT3& rotation)
+UINT32 SMesh::SelectLOD(UINT32 section, float distance, float pixelsPerUnit) const
 {
-	m_rotation *= XMMatrixRotationX(rotation.x);
-	m_rotation *= XMMatrixRotationY(rotation.y);
-	m_rotation *= XMMatrixRotationZ(rotation.z);
-	_UpdateModelMatrix();
+	if (m_lodOffsets.size() != m_meshSections.size() + 1)
+		return 0;
+
+	const UINT32 first = m_lodOffsets[section];
+	const UINT32 last = m_lodOffsets[section + 1];
+	UINT32 lod = 0;
+	for (UINT32 i = first + 1; i < last && m_lods[i].error * pixelsPerUnit <= LOD_ERROR_PIXELS * distance; ++i)
+	{
+		lod = i - first;
+	}
+	return lod;
 }
 
-void SMesh::SetScale(const float factor)
+float SMesh::GetLODDistance(FXMMATRIX model, const XMFLOAT3& cameraPosition, float& outScale) const
 {
-	m_scaling = XMMatrixScaling(factor, factor, factor);
-	_UpdateModelMatrix();
+	// LODs are selected by the distance to the bounding sphere of the whole mesh
+	outScale = std::max(std::max(XMVectorGetX(XMVector3Length(model.r[0])), XMVectorGetX(XMVector3Length(model.r[1]))), XMVectorGetX(XMVector3Length(model.r[2])));
+	XMVECTOR boundsMin = XMLoadFloat3(&m_boundsMin);
+	XMVECTOR boundsMax = XMLoadFloat3(&m_boundsMax);
+	XMVECTOR center = XMVector3TransformCoord(XMVectorScale(XMVectorAdd(boundsMin, boundsMax), 0.5f), model);
+	const float radius = 0.5f * XMVectorGetX(XMVector3Length(XMVectorSubtract(boundsMax, boundsMin))) * outScale;
+	return std::max(XMVectorGetX(XMVector3Length(XMVectorSubtract(center, XMLoadFloat3(&cameraPosition)))) - radius, 0.0f);
 }
 
-void SMesh::_UpdateModelMatrix()
+void SMesh::_ClearLODs()
 {
-	XMMATRIX model = m_scaling * m_rotation * m_translation;
-	memcpy(&m_constants->model, &model, sizeof(XMMATRIX));
+	if (m_lods.empty())
+		return;
+
+	// Compact the section ranges, dropping the simplified ones behind them
+	_WithIndices([&](auto& indices)
+	{
+		std::remove_reference_t<decltype(indices)> compacted;
+		for (SMeshSection& section : m_meshSections)
+		{
+			const UINT32 start = (UINT32)compacted.size();
+			compacted.insert(compacted.end(), indices.begin() + section.startIndexLocation, indices.begin() + section.startIndexLocation + section.indexCount);
+			section.startIndexLocation = start;
+		}
+		indices.swap(compacted);
+	});
+	m_lods.clear();
+	m_lodOffsets.clear();
 }
 
-void SMesh::CreateConstants(DescHeapWrapper& hh)
+void SMesh::BuildMeshlets()
 {
-	UINT32 vertexCBSize = sizeof(ModelConstants);
-	m_constants = (ModelConstants*)hh.AllocateGPUMemory(vertexCBSize, m_constants_GPUAddr);
-	m_scaling = XMMatrixIdentity();
-	m_rotation = XMMatrixIdentity();
-	m_translation = XMMatrixIdentity();
-	_UpdateModelMatrix();
+	auto start = std::chrono::high_resolution_clock::now();
+
+	const SVertex* vertices = m_cacheFile ? m_cachedVertices : m_vertices.data();
+	size_t indexCount;
+	UINT32 indexSize;
+	const void* indices = _GetIndices(indexCount, indexSize);
+	if (indexSize == sizeof(UINT16))
+		SMeshlets::Build(vertices, (const UINT16*)indices, m_meshSections.data(), m_meshSections.size(), m_meshlets);
+	else
+		SMeshlets::Build(vertices, (const UINT32*)indices, m_meshSections.data(), m_meshSections.size(), m_meshlets);
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: %zu meshlets built in %.2f ms\n", m_meshlets.size(), elapsed.count()).c_str());
+}
+
+void SMesh::BuildBVH()
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	// ReleaseCPUData clears the vectors without freeing them, so only the counts tell whether the geometry is still there
+	const size_t vertexCount = m_cacheFile ? m_cachedVertexCount : m_vertices.size();
+	size_t indexCount;
+	UINT32 indexSize;
+	const void* indices = _GetIndices(indexCount, indexSize);
+	if (!m_meshSections.empty() && (vertexCount == 0 || indexCount == 0))
+		throw std::runtime_error("SMesh: BuildBVH called after ReleaseCPUData");
+
+	const SVertex* vertices = m_cacheFile ? m_cachedVertices : m_vertices.data();
+	auto bvh = std::make_shared<SMeshBVH>();
+	if (indexSize == sizeof(UINT16))
+		bvh->Build(vertices, (const UINT16*)indices, m_meshSections.data(), m_meshSections.size());
+	else
+		bvh->Build(vertices, (const UINT32*)indices, m_meshSections.data(), m_meshSections.size());
+	m_bvh = bvh;
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("SMesh: BVH with %zu nodes over %zu triangles built in %.2f ms\n",
+		m_bvh->GetNodes().size(), m_bvh->GetTriangles().size(), elapsed.count()).c_str());
 }
 
 void SMesh::CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList)
 {
+	// Cached meshes are copied straight out of the file mapping
+	const SVertex* vertexData = m_cacheFile ? m_cachedVertices : m_vertices.data();
+	const size_t vertexCount = m_cacheFile ? m_cachedVertexCount : m_vertices.size();
+	size_t indexCount;
+	UINT32 indexSize;
+	const void* indexData = _GetIndices(indexCount, indexSize);
+
 	// Vertices
-	auto verticsDataSize = m_vertices.size() * sizeof(SVertex);
+	const size_t vertexStride = m_packedVertices ? sizeof(SPackedVertex) : sizeof(SVertex);
+	auto verticsDataSize = vertexCount * vertexStride;
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 		D3D12_HEAP_FLAG_NONE,
@@ -410,19 +469,27 @@ void SMesh::CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cm
 		IID_PPV_ARGS(&m_vertexBuffer)));
 
 	m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
-	m_vertexBufferView.StrideInBytes = sizeof(SVertex);
+	m_vertexBufferView.StrideInBytes = (UINT)vertexStride;
 	m_vertexBufferView.SizeInBytes = (UINT)verticsDataSize;
 
 	void* tempPtr_vertex = nullptr;
 	ThrowIfFailed(m_stagingVertexBuffer->Map(0, &CD3DX12_RANGE(0, 0), &tempPtr_vertex));
-	memcpy(tempPtr_vertex, m_vertices.data(), verticsDataSize);
+	if (m_packedVertices)
+	{
+		// Encoded straight into the upload heap
+		VertexPacking::Encode(vertexData, vertexCount, m_boundsMin, m_boundsMax, (SPackedVertex*)tempPtr_vertex);
+	}
+	else
+	{
+		memcpy(tempPtr_vertex, vertexData, verticsDataSize);
+	}
 	m_stagingVertexBuffer->Unmap(0, nullptr);
 
 	cmdList->CopyResource(m_vertexBuffer.Get(), m_stagingVertexBuffer.Get());
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(m_vertexBuffer.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER));
 
-	// Indices
-	auto indicesDataSize = m_indices.size() * sizeof(UINT32);
+	// Indices, in 16 bits whenever they fit. The cache and the loaders already store them that way.
+	auto indicesDataSize = indexCount * indexSize;
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 		D3D12_HEAP_FLAG_NONE,
@@ -440,12 +507,12 @@ void SMesh::CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cm
 		IID_PPV_ARGS(&m_indexBuffer)));
 
 	m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
-	m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+	m_indexBufferView.Format = indexSize == sizeof(UINT16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
 	m_indexBufferView.SizeInBytes = (UINT)indicesDataSize;
 
 	void* tempPtr_index = nullptr;
 	ThrowIfFailed(m_stagingIndexBuffer->Map(0, &CD3DX12_RANGE(0, 0), &tempPtr_index));
-	memcpy(tempPtr_index, m_indices.data(), indicesDataSize);
+	memcpy(tempPtr_index, indexData, indicesDataSize);
 	m_stagingIndexBuffer->Unmap(0, nullptr);
 
 	cmdList->CopyResource(m_indexBuffer.Get(), m_stagingIndexBuffer.Get());
@@ -464,6 +531,85 @@ void SMesh::ScheduleDraw(ID3D12GraphicsCommandList* cmdList)
 	}
 }
 
+UINT32 SMesh::ScheduleDraw(ID3D12GraphicsCommandList* cmdList, FXMMATRIX model, CXMMATRIX viewProjection, const XMFLOAT3& cameraPosition,
+	float pixelsPerUnit, const UINT32* sections, size_t sectionCount)
+{
+	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	cmdList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	cmdList->IASetIndexBuffer(&m_indexBufferView);
+
+	// Cull in object space, where the meshlet bounds live
+	XMMATRIX objectToClip = model * viewProjection;
+	XMVECTOR camera = XMLoadFloat3(&cameraPosition);
+	XMFLOAT3 objectCamera;
+	XMStoreFloat3(&objectCamera, XMVector3TransformCoord(camera, XMMatrixInverse(nullptr, model)));
+
+	float scale;
+	const float distance = GetLODDistance(model, cameraPosition, scale);
+
+	if (!sections)
+		sectionCount = m_meshSections.size();
+
+	UINT32 visibleTriangles = 0;
+	for (size_t k = 0; k < sectionCount; ++k)
+	{
+		const UINT32 s = sections ? sections[k] : (UINT32)k;
+		const SMeshSection& sms = m_meshSections[s];
+		const UINT32 lod = SelectLOD(s, distance, pixelsPerUnit * scale);
+		if (lod > 0)
+		{
+			const SMeshLOD& level = m_lods[m_lodOffsets[s] + lod];
+			cmdList->DrawIndexedInstanced(level.indexCount, 1, level.startIndexLocation, sms.baseVertexLocation, 0);
+			visibleTriangles += level.indexCount / 3;
+			continue;
+		}
+
+		if (m_meshlets.size() == 0)
+		{
+			cmdList->DrawIndexedInstanced(sms.indexCount, 1, sms.startIndexLocation, sms.baseVertexLocation, 0);
+			visibleTriangles += sms.indexCount / 3;
+			continue;
+		}
+
+		const UINT32 first = m_meshlets.sectionOffsets[s];
+		const UINT32 count = m_meshlets.sectionOffsets[s + 1] - first;
+
+		m_visibleMeshlets.clear();
+		visibleTriangles += SMeshlets::Cull(m_meshlets, first, count, objectToClip, objectCamera, m_visibleMeshlets);
+
+		// Meshlets are contiguous in the index buffer, so runs of visible meshlets become a single draw
+		for (size_t i = 0; i < m_visibleMeshlets.size();)
+		{
+			const UINT32 startTriangle = m_meshlets.triangleOffset[m_visibleMeshlets[i]];
+			UINT32 triangleCount = 0;
+			size_t j = i;
+			do
+			{
+				triangleCount += m_meshlets.triangleCount[m_visibleMeshlets[j]];
+				++j;
+			} while (j < m_visibleMeshlets.size() && m_visibleMeshlets[j] == m_visibleMeshlets[j - 1] + 1);
+
+			cmdList->DrawIndexedInstanced(triangleCount * 3, 1, sms.startIndexLocation + startTriangle * 3, sms.baseVertexLocation, 0);
+			i = j;
+		}
+	}
+	return visibleTriangles;
+}
+
+UINT32 SMesh::ScheduleDrawInstanced(ID3D12GraphicsCommandList* cmdList, UINT32 section, UINT32 lod, UINT32 instanceCount)
+{
+	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	cmdList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	cmdList->IASetIndexBuffer(&m_indexBufferView);
+
+	const SMeshSection& sms = m_meshSections[section];
+	const SMeshLOD* level = lod > 0 ? &m_lods[m_lodOffsets[section] + lod] : nullptr;
+	const UINT32 indexCount = level ? level->indexCount : sms.indexCount;
+	const UINT32 startIndexLocation = level ? level->startIndexLocation : sms.startIndexLocation;
+	cmdList->DrawIndexedInstanced(indexCount, instanceCount, startIndexLocation, sms.baseVertexLocation, 0);
+	return indexCount / 3 * instanceCount;
+}
+
 void SMesh::ReleaseUploadHeaps()
 {
 	m_stagingVertexBuffer = nullptr;
@@ -474,4 +620,11 @@ void SMesh::ReleaseCPUData()
 {
 	m_vertices.clear();
 	m_indices.clear();
+	m_shortIndices.clear();
+	m_cachedVertices = nullptr;
+	m_cachedVertexCount = 0;
+	m_cachedIndices = nullptr;
+	m_cachedIndexCount = 0;
+	m_cachedIndexSize = sizeof(UINT32);
+	m_cacheFile = nullptr;
 }
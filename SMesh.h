@@ -2,82 +2,152 @@
 
 #include "ShaderSharedStructs.h"
 #include "DescHeapWrapper.h"
+#include "HelperFunctions.h"
+#include "SMeshlets.h"
+#include "SMeshTypes.h"
 
 #include <vector>
 #include <dxgi1_6.h>
 using Microsoft::WRL::ComPtr;
 
-struct SVertex
+namespace tinyobj
 {
-	DirectX::XMFLOAT3 position;
-	DirectX::XMFLOAT2 uv;
-	DirectX::XMFLOAT3 normal;
-	DirectX::XMFLOAT3 tangent;
-	DirectX::XMFLOAT3 bitangent;
-};
+	struct attrib_t;
+	struct shape_t;
+}
 
-struct SMeshSection
-{
-	UINT32 indexCount;
-	UINT32 startIndexLocation;
-	UINT32 baseVertexLocation;
-};
+class SMeshBVH;
+struct SRay;
+struct SRayHit;
 
+// Geometry and GPU buffers of a mesh. Placement and material live in SMeshInstance,
+// so any number of instances can share one SMesh (see SMeshRegistry).
 class SMesh
 {
 private:
 	// [vertices] and [indices]: stores those of all meshes combined
 	// [meshSection]: indexer for [vertices] and [indices]
+	// Indices are kept in 16 bits in [m_shortIndices] from the loader on, as long as all of them fit; [m_indices] is
+	// then empty. Otherwise they are in [m_indices] and [m_shortIndices] is empty.
 	std::vector<SVertex> m_vertices;
 	std::vector<UINT32> m_indices;
+	std::vector<UINT16> m_shortIndices;
 	std::vector<SMeshSection> m_meshSections;
 
+	// Set when the mesh was served from a .smesh cache: vertices and indices are then read in place
+	// from the mapping and [m_vertices] / [m_indices] / [m_shortIndices] stay empty until _MaterializeCache().
+	// Shared so that SMesh stays copyable.
+	std::shared_ptr<MappedFile> m_cacheFile;
+	const SVertex* m_cachedVertices = nullptr;
+	size_t m_cachedVertexCount = 0;
+	const void* m_cachedIndices = nullptr;  // UINT16 or UINT32, see m_cachedIndexSize
+	size_t m_cachedIndexCount = 0;
+	UINT32 m_cachedIndexSize = sizeof(UINT32);
+
+	// Object space bounds of all sections, and of each one. Kept after ReleaseCPUData().
+	DirectX::XMFLOAT3 m_boundsMin = {};
+	DirectX::XMFLOAT3 m_boundsMax = {};
+	std::vector<SMeshSectionBounds> m_sectionBounds;
+
+	// LODs of section s are [m_lodOffsets[s], m_lodOffsets[s + 1]), fine to coarse.
+	// Their indices are stored after those of all sections. Kept after ReleaseCPUData().
+	std::vector<SMeshLOD> m_lods;
+	std::vector<UINT32> m_lodOffsets;
+
+	// Meshlets of all sections, used for cluster culling in ScheduleDraw. Kept after ReleaseCPUData().
+	SMeshletTable m_meshlets;
+	std::vector<UINT32> m_visibleMeshlets;
+
+	// Ray query acceleration structure, only built on request. Kept after ReleaseCPUData().
+	std::shared_ptr<SMeshBVH> m_bvh;
+
+	// Upload SPackedVertex instead of SVertex, see VertexPacking.h
+	bool m_packedVertices = false;
+
 	ComPtr<ID3D12Resource> m_stagingVertexBuffer;
 	ComPtr<ID3D12Resource> m_stagingIndexBuffer;
 	ComPtr<ID3D12Resource> m_vertexBuffer;
 	ComPtr<ID3D12Resource> m_indexBuffer;
 	D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView;
-	D3D12_INDEX_BUFFER_VIEW m_indexBufferView;
-
-private:
-	DirectX::XMMATRIX m_scaling;
-	DirectX::XMMATRIX m_rotation;
-	DirectX::XMMATRIX m_translation;
-
-	// Raw pointers point to a location in Heap which is managed by the DescHeapWrapper,
-	// so we do not use smart pointer here.
-	ModelConstants* m_constants;
-	D3D12_GPU_VIRTUAL_ADDRESS m_constants_GPUAddr;
+	D3D12_INDEX_BUFFER_VIEW m_indexBufferView = {};
 
 public:
 	SMesh() = default;
 	~SMesh();
 
-	inline D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddr() { return m_constants_GPUAddr; }
+	inline const DirectX::XMFLOAT3& GetBoundsMin() const { return m_boundsMin; }
+	inline const DirectX::XMFLOAT3& GetBoundsMax() const { return m_boundsMax; }
+	inline const std::vector<SMeshSectionBounds>& GetSectionBounds() const { return m_sectionBounds; }
+
+	// Must be set before CopyToUploadHeap. Packed meshes are drawn with PSO_RenderPacked.
+	inline void SetPackedVertices(bool packed) { m_packedVertices = packed; }
+	inline bool UsesPackedVertices() const { return m_packedVertices; }
+	// Set by CopyToUploadHeap: DXGI_FORMAT_R16_UINT whenever every index fits into 16 bits
+	inline DXGI_FORMAT GetIndexFormat() const { return m_indexBufferView.Format; }
 
 private:
 	void _LoadArray(const std::vector<SVertex>& vertices, const std::vector<UINT32>& indices);
 	void _LoadGLTF(const char* filename);
 	void _LoadOBJ(const char* filename);
+	void _AppendOBJShapes(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::shape_t>& shapes);
+	void _LoadFile(const char* filename);
+	bool _LoadCache(const char* filename, uint64_t sourceHash);
+	void _MaterializeCache();
+	// Moves the indices from [m_indices] to [m_shortIndices] if they fit, or back before appending ones that don't
+	void _NarrowIndices();
+	void _WidenIndices();
+	// Calls [fn] with whichever of [m_shortIndices] and [m_indices] holds the indices
+	template<typename Fn>
+	void _WithIndices(Fn&& fn)
+	{
+		if (m_indices.empty())
+			fn(m_shortIndices);
+		else
+			fn(m_indices);
+	}
+	// Indices as uploaded: from the cache mapping, [m_shortIndices] or [m_indices]. [outIndexSize] is 2 or 4.
+	const void* _GetIndices(size_t& outCount, UINT32& outIndexSize) const;
+	void _UpdateBounds();
+	void _ClearLODs();
 
 public:
 	void Load(const std::vector<SVertex>& vertices, const std::vector<UINT32>& indices);
+	// Parses [filename], generates tangents and LODs. Meshes loaded into an empty SMesh are cached
+	// in a .smesh file next to the source and served from it while the source is unchanged.
 	void Load(const char* filename);
+	bool SaveCache(const char* filename, uint64_t sourceHash) const;
 
+	// Smooth, angle and area weighted normals and tangent frames, see SMeshTangents.h
 	void GenerateNormals();
 	void GenerateTangents();
+	// Reorders triangles and vertices of every section for the post-transform cache, overdraw and vertex fetch.
+	// Discards the LODs, since they index the old vertex order.
+	void Optimize();
+	// Simplifies every section into up to [maxLODCount] - 1 coarser LODs, each with about [reduction]
+	// times the triangles of the previous one. Sections are simplified in parallel.
+	void GenerateLODs(UINT32 maxLODCount = MAX_LOD_COUNT, float reduction = LOD_REDUCTION);
+	// Coarsest LOD of [section] whose error covers at most LOD_ERROR_PIXELS on screen, seen from [distance].
+	// [pixelsPerUnit]: pixels covered by one object space unit at distance 1.
+	UINT32 SelectLOD(UINT32 section, float distance, float pixelsPerUnit) const;
+	// Distance from [cameraPosition] (world space) to the bounding sphere of the mesh placed by [model], for SelectLOD.
+	// [outScale]: largest axis scale of [model], to multiply the world space pixelsPerUnit by.
+	float GetLODDistance(DirectX::FXMMATRIX model, const DirectX::XMFLOAT3& cameraPosition, float& outScale) const;
+	// Rebuilds the meshlet table. Called by Load and Optimize, call it again after editing the geometry by hand.
+	void BuildMeshlets();
+	// Builds the BVH for ray queries, see SMeshBVH.h and SMeshInstance::Intersect. Call it again after the geometry changed.
+	void BuildBVH();
+	inline const SMeshBVH* GetBVH() const { return m_bvh.get(); }
 
-	void MoveTo(const DirectX::XMFLOAT3& position);
-	void RotateBy(const DirectX::XMFLOAT3& rotation);
-	void SetScale(const float factor);
-
-private:
-	void _UpdateModelMatrix();
-
-public:
-	void CreateConstants(DescHeapWrapper& hh);
 	void CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
 	void ScheduleDraw(ID3D12GraphicsCommandList* cmdList);
+	// Draws every section, placed by [model], at the LOD picked by SelectLOD. At LOD 0, only the meshlets inside the frustum of
+	// [viewProjection] that are not backfacing as seen from [cameraPosition] (world space) are drawn.
+	// [pixelsPerUnit]: pixels covered by one world unit at distance 1. Returns the number of triangles drawn.
+	// [sections]: ascending list of the [sectionCount] sections to draw, e.g. those that passed SFrustumCulling. Null draws all.
+	UINT32 ScheduleDraw(ID3D12GraphicsCommandList* cmdList, DirectX::FXMMATRIX model, DirectX::CXMMATRIX viewProjection, const DirectX::XMFLOAT3& cameraPosition,
+		float pixelsPerUnit, const UINT32* sections = nullptr, size_t sectionCount = 0);
+	// Draws LOD [lod] of [section] [instanceCount] times in full, without meshlet culling. Returns the number of triangles drawn.
+	UINT32 ScheduleDrawInstanced(ID3D12GraphicsCommandList* cmdList, UINT32 section, UINT32 lod, UINT32 instanceCount);
 	void ReleaseUploadHeaps();
 	void ReleaseCPUData();
 };
@@ -0,0 +1,585 @@
+#include "SMeshBVH.h"
+
+#include "ParallelFor.h"
+
+#include <cmath>
+#include <thread>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Triangles per ParallelFor item when preparing and copying triangles
+	constexpr uint32_t BLOCK_SIZE = 16 * 1024;
+
+	// Subtrees smaller than this are never split up between threads
+	constexpr uint32_t MIN_SUBTREE_SIZE = 4 * 1024;
+
+	// SAH cost of a traversal step relative to a ray-triangle test
+	constexpr float TRAVERSAL_COST = 1.0f;
+
+	// Deeper nodes are forced into leaves so that traversal stacks can't overflow
+	constexpr uint32_t MAX_DEPTH = SMeshBVH::STACK_SIZE - 1;
+
+	// Per triangle input of the builder, indexed by the mesh-wide triangle number
+	struct BuildInput
+	{
+		vector<XMFLOAT3> boundsMin;
+		vector<XMFLOAT3> boundsMax;
+		vector<XMFLOAT3> centroids;
+	};
+
+	struct Subtree
+	{
+		uint32_t node;
+		uint32_t first;
+		uint32_t count;
+		uint32_t depth;
+	};
+
+	inline float XM_CALLCONV SurfaceArea(FXMVECTOR boundsMin, FXMVECTOR boundsMax)
+	{
+		XMFLOAT3 d;
+		XMStoreFloat3(&d, XMVectorMax(XMVectorSubtract(boundsMax, boundsMin), XMVectorZero()));
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	inline float GetComponent(const XMFLOAT3& v, uint32_t axis)
+	{
+		return (&v.x)[axis];
+	}
+
+	void ComputeBounds(const BuildInput& input, const vector<uint32_t>& order, uint32_t first, uint32_t count,
+		XMVECTOR& outMin, XMVECTOR& outMax, XMVECTOR& outCentroidMin, XMVECTOR& outCentroidMax)
+	{
+		outMin = outCentroidMin = XMVectorReplicate(FLT_MAX);
+		outMax = outCentroidMax = XMVectorReplicate(-FLT_MAX);
+		for (uint32_t i = first; i < first + count; ++i)
+		{
+			const uint32_t t = order[i];
+			XMVECTOR c = XMLoadFloat3(&input.centroids[t]);
+			outMin = XMVectorMin(outMin, XMLoadFloat3(&input.boundsMin[t]));
+			outMax = XMVectorMax(outMax, XMLoadFloat3(&input.boundsMax[t]));
+			outCentroidMin = XMVectorMin(outCentroidMin, c);
+			outCentroidMax = XMVectorMax(outCentroidMax, c);
+		}
+	}
+
+	// Binned SAH over the centroids. Returns false if a leaf is cheaper, otherwise partitions
+	// [first, first + count) of [order] and returns the start of the right half in [outMid].
+	bool Split(const BuildInput& input, vector<uint32_t>& order, uint32_t first, uint32_t count,
+		FXMVECTOR boundsMin, FXMVECTOR boundsMax, FXMVECTOR centroidMin, GXMVECTOR centroidMax, uint32_t& outMid)
+	{
+		constexpr uint32_t BINS = SMeshBVH::BIN_COUNT;
+
+		XMFLOAT3 cMin, cMax;
+		XMStoreFloat3(&cMin, centroidMin);
+		XMStoreFloat3(&cMax, centroidMax);
+
+		float bestCost = FLT_MAX;
+		uint32_t bestAxis = 0;
+		uint32_t bestBin = 0;
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			const float extent = GetComponent(cMax, axis) - GetComponent(cMin, axis);
+			if (extent <= 0.0f)
+				continue;
+
+			uint32_t binCounts[BINS] = {};
+			XMVECTOR binMin[BINS], binMax[BINS];
+			for (uint32_t b = 0; b < BINS; ++b)
+			{
+				binMin[b] = XMVectorReplicate(FLT_MAX);
+				binMax[b] = XMVectorReplicate(-FLT_MAX);
+			}
+
+			const float scale = BINS / extent;
+			for (uint32_t i = first; i < first + count; ++i)
+			{
+				const uint32_t t = order[i];
+				const uint32_t b = std::min(BINS - 1, (uint32_t)((GetComponent(input.centroids[t], axis) - GetComponent(cMin, axis)) * scale));
+				binCounts[b]++;
+				binMin[b] = XMVectorMin(binMin[b], XMLoadFloat3(&input.boundsMin[t]));
+				binMax[b] = XMVectorMax(binMax[b], XMLoadFloat3(&input.boundsMax[t]));
+			}
+
+			// Cost of splitting after bin b: sweep from the left, then from the right
+			float leftCost[BINS - 1];
+			XMVECTOR accMin = XMVectorReplicate(FLT_MAX);
+			XMVECTOR accMax = XMVectorReplicate(-FLT_MAX);
+			uint32_t accCount = 0;
+			for (uint32_t b = 0; b < BINS - 1; ++b)
+			{
+				accMin = XMVectorMin(accMin, binMin[b]);
+				accMax = XMVectorMax(accMax, binMax[b]);
+				accCount += binCounts[b];
+				leftCost[b] = accCount ? accCount * SurfaceArea(accMin, accMax) : 0.0f;
+			}
+
+			accMin = XMVectorReplicate(FLT_MAX);
+			accMax = XMVectorReplicate(-FLT_MAX);
+			accCount = 0;
+			for (uint32_t b = BINS - 1; b > 0; --b)
+			{
+				accMin = XMVectorMin(accMin, binMin[b]);
+				accMax = XMVectorMax(accMax, binMax[b]);
+				accCount += binCounts[b];
+				const float cost = leftCost[b - 1] + (accCount ? accCount * SurfaceArea(accMin, accMax) : 0.0f);
+				if (accCount > 0 && accCount < count && cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = b - 1;
+				}
+			}
+		}
+
+		const float area = SurfaceArea(boundsMin, boundsMax);
+		const float leafCost = count * area;
+		if (bestCost == FLT_MAX)
+		{
+			// All centroids coincide: split in the middle unless it fits into a leaf
+			if (count <= SMeshBVH::MAX_LEAF_SIZE)
+				return false;
+			outMid = first + count / 2;
+			return true;
+		}
+
+		if (count <= SMeshBVH::MAX_LEAF_SIZE && leafCost <= TRAVERSAL_COST * area + bestCost)
+			return false;
+
+		const float axisMin = GetComponent(cMin, bestAxis);
+		const float scale = BINS / (GetComponent(cMax, bestAxis) - axisMin);
+		auto middle = std::partition(order.begin() + first, order.begin() + first + count, [&](uint32_t t)
+		{
+			return std::min(BINS - 1, (uint32_t)((GetComponent(input.centroids[t], bestAxis) - axisMin) * scale)) <= bestBin;
+		});
+		outMid = (uint32_t)(middle - order.begin());
+		return true;
+	}
+
+	// Turns [nodes][nodeIndex] into the root of the subtree over [first, first + count)
+	void BuildNode(const BuildInput& input, vector<uint32_t>& order, vector<SBVHNode>& nodes,
+		uint32_t nodeIndex, uint32_t first, uint32_t count, uint32_t depth, vector<Subtree>* deferred, uint32_t deferSize)
+	{
+		XMVECTOR boundsMin, boundsMax, centroidMin, centroidMax;
+		ComputeBounds(input, order, first, count, boundsMin, boundsMax, centroidMin, centroidMax);
+		XMStoreFloat3(&nodes[nodeIndex].boundsMin, boundsMin);
+		XMStoreFloat3(&nodes[nodeIndex].boundsMax, boundsMax);
+
+		uint32_t mid = 0;
+		if (count == 1 || depth >= MAX_DEPTH || !Split(input, order, first, count, boundsMin, boundsMax, centroidMin, centroidMax, mid))
+		{
+			nodes[nodeIndex].leftOrFirst = first;
+			nodes[nodeIndex].count = count;
+			return;
+		}
+
+		const uint32_t left = (uint32_t)nodes.size();
+		nodes.resize(nodes.size() + 2);
+		nodes[nodeIndex].leftOrFirst = left;
+		nodes[nodeIndex].count = 0;
+
+		const uint32_t childFirst[2] = { first, mid };
+		const uint32_t childCount[2] = { mid - first, first + count - mid };
+		for (uint32_t c = 0; c < 2; ++c)
+		{
+			if (deferred && childCount[c] <= deferSize)
+				deferred->push_back(Subtree{ left + c, childFirst[c], childCount[c], depth + 1 });
+			else
+				BuildNode(input, order, nodes, left + c, childFirst[c], childCount[c], depth + 1, deferred, deferSize);
+		}
+	}
+
+	// Slab test, returns the entry distance or FLT_MAX on a miss
+	inline float XM_CALLCONV IntersectBox(const SBVHNode& node, FXMVECTOR origin, FXMVECTOR invDirection, float tMin, float tMax)
+	{
+		XMVECTOR t0 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.boundsMin), origin), invDirection);
+		XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.boundsMax), origin), invDirection);
+		XMFLOAT3 tNear, tFar;
+		XMStoreFloat3(&tNear, XMVectorMin(t0, t1));
+		XMStoreFloat3(&tFar, XMVectorMax(t0, t1));
+		const float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, tMin));
+		const float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, tMax));
+		return enter <= exit ? enter : FLT_MAX;
+	}
+
+	// Moeller-Trumbore, two-sided
+	inline bool IntersectTriangle(const SMeshBVH::Triangle& tri, const XMFLOAT3& o, const XMFLOAT3& d, float tMin, float tMax, float& outT, float& outU, float& outV)
+	{
+		const XMFLOAT3& e1 = tri.e1;
+		const XMFLOAT3& e2 = tri.e2;
+		const float px = d.y * e2.z - d.z * e2.y;
+		const float py = d.z * e2.x - d.x * e2.z;
+		const float pz = d.x * e2.y - d.y * e2.x;
+		const float det = e1.x * px + e1.y * py + e1.z * pz;
+		if (det == 0.0f)
+			return false;
+
+		const float invDet = 1.0f / det;
+		const float tx = o.x - tri.v0.x;
+		const float ty = o.y - tri.v0.y;
+		const float tz = o.z - tri.v0.z;
+		const float u = (tx * px + ty * py + tz * pz) * invDet;
+		if (u < 0.0f || u > 1.0f)
+			return false;
+
+		const float qx = ty * e1.z - tz * e1.y;
+		const float qy = tz * e1.x - tx * e1.z;
+		const float qz = tx * e1.y - ty * e1.x;
+		const float v = (d.x * qx + d.y * qy + d.z * qz) * invDet;
+		if (v < 0.0f || u + v > 1.0f)
+			return false;
+
+		const float t = (e2.x * qx + e2.y * qy + e2.z * qz) * invDet;
+		if (t < tMin || t > tMax)
+			return false;
+
+		outT = t;
+		outU = u;
+		outV = v;
+		return true;
+	}
+
+	struct StackEntry
+	{
+		uint32_t node;
+		float distance;
+	};
+
+	template<bool ANY_HIT>
+	bool Traverse(const vector<SBVHNode>& nodes, const vector<SMeshBVH::Triangle>& triangles, const SRay& ray, SRayHit* hit)
+	{
+		if (nodes.empty())
+			return false;
+
+		const XMVECTOR origin = XMLoadFloat3(&ray.origin);
+		const XMVECTOR invDirection = XMVectorReciprocal(XMLoadFloat3(&ray.direction));
+		float tMax = ray.tMax;
+		bool found = false;
+
+		StackEntry stack[SMeshBVH::STACK_SIZE];
+		uint32_t stackSize = 0;
+		const float rootDistance = IntersectBox(nodes[0], origin, invDirection, ray.tMin, tMax);
+		if (rootDistance != FLT_MAX)
+			stack[stackSize++] = StackEntry{ 0, rootDistance };
+
+		while (stackSize > 0)
+		{
+			const StackEntry entry = stack[--stackSize];
+			if (entry.distance > tMax)
+				continue;
+
+			const SBVHNode* node = &nodes[entry.node];
+			while (node->count == 0)
+			{
+				const uint32_t left = node->leftOrFirst;
+				float distance[2] =
+				{
+					IntersectBox(nodes[left], origin, invDirection, ray.tMin, tMax),
+					IntersectBox(nodes[left + 1], origin, invDirection, ray.tMin, tMax),
+				};
+				uint32_t nearChild = distance[1] < distance[0] ? 1 : 0;
+				if (distance[nearChild] == FLT_MAX)
+				{
+					node = nullptr;
+					break;
+				}
+				if (distance[1 - nearChild] != FLT_MAX)
+					stack[stackSize++] = StackEntry{ left + 1 - nearChild, distance[1 - nearChild] };
+				node = &nodes[left + nearChild];
+			}
+			if (!node)
+				continue;
+
+			for (uint32_t i = node->leftOrFirst; i < node->leftOrFirst + node->count; ++i)
+			{
+				float t, u, v;
+				if (!IntersectTriangle(triangles[i], ray.origin, ray.direction, ray.tMin, tMax, t, u, v))
+					continue;
+
+				if (ANY_HIT)
+					return true;
+
+				tMax = t;
+				found = true;
+				hit->t = t;
+				hit->u = u;
+				hit->v = v;
+				hit->section = triangles[i].section;
+				hit->triangle = triangles[i].triangle;
+			}
+		}
+		return found;
+	}
+
+	// Lane mask of the rays that enter [node] before their current closest hit
+	inline XMVECTOR XM_CALLCONV IntersectBox4(const SBVHNode& node, const XMVECTOR origin[3], const XMVECTOR invDirection[3],
+		FXMVECTOR tMin, FXMVECTOR tMax, XMVECTOR& outEnter)
+	{
+		XMVECTOR enter = tMin;
+		XMVECTOR exit = tMax;
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			XMVECTOR t0 = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(GetComponent(node.boundsMin, axis)), origin[axis]), invDirection[axis]);
+			XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(GetComponent(node.boundsMax, axis)), origin[axis]), invDirection[axis]);
+			enter = XMVectorMax(enter, XMVectorMin(t0, t1));
+			exit = XMVectorMin(exit, XMVectorMax(t0, t1));
+		}
+		XMVECTOR mask = XMVectorLessOrEqual(enter, exit);
+		outEnter = XMVectorSelect(XMVectorReplicate(FLT_MAX), enter, mask);
+		return mask;
+	}
+
+	inline bool XM_CALLCONV AnyLane(FXMVECTOR mask)
+	{
+		return !XMVector4EqualInt(mask, XMVectorZero());
+	}
+
+	inline float XM_CALLCONV MinLane(FXMVECTOR v)
+	{
+		XMFLOAT4 f;
+		XMStoreFloat4(&f, v);
+		return std::min(std::min(f.x, f.y), std::min(f.z, f.w));
+	}
+}
+
+template<typename Index>
+void SMeshBVH::BuildFromIndices(const SVertex* vertices, const Index* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	m_nodes.clear();
+	m_triangles.clear();
+
+	vector<uint32_t> firstTriangle(sectionCount + 1, 0);
+	for (size_t s = 0; s < sectionCount; ++s)
+		firstTriangle[s + 1] = firstTriangle[s] + sections[s].indexCount / 3;
+	const uint32_t triangleCount = firstTriangle[sectionCount];
+	if (triangleCount == 0)
+		return;
+
+	// Section and triangle of every mesh-wide triangle number
+	auto locate = [&](uint32_t t, uint32_t& section)
+	{
+		while (t >= firstTriangle[section + 1])
+			++section;
+		return t - firstTriangle[section];
+	};
+
+	BuildInput input;
+	input.boundsMin.resize(triangleCount);
+	input.boundsMax.resize(triangleCount);
+	input.centroids.resize(triangleCount);
+	const uint32_t blockCount = (triangleCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	ParallelFor(blockCount, [&](uint32_t block)
+	{
+		const uint32_t begin = block * BLOCK_SIZE;
+		const uint32_t end = std::min(triangleCount, begin + BLOCK_SIZE);
+		uint32_t s = (uint32_t)(std::upper_bound(firstTriangle.begin(), firstTriangle.end(), begin) - firstTriangle.begin() - 1);
+		for (uint32_t t = begin; t < end; ++t)
+		{
+			const uint32_t local = locate(t, s);
+			const SMeshSection& section = sections[s];
+			const Index* tri = indices + section.startIndexLocation + local * 3;
+			XMVECTOR p0 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[0]].position);
+			XMVECTOR p1 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[1]].position);
+			XMVECTOR p2 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[2]].position);
+			XMVECTOR bMin = XMVectorMin(XMVectorMin(p0, p1), p2);
+			XMVECTOR bMax = XMVectorMax(XMVectorMax(p0, p1), p2);
+			XMStoreFloat3(&input.boundsMin[t], bMin);
+			XMStoreFloat3(&input.boundsMax[t], bMax);
+			XMStoreFloat3(&input.centroids[t], XMVectorScale(XMVectorAdd(bMin, bMax), 0.5f));
+		}
+	});
+
+	vector<uint32_t> order(triangleCount);
+	for (uint32_t t = 0; t < triangleCount; ++t)
+		order[t] = t;
+
+	// The top levels are built here until the remaining subtrees are small enough to be handed out to threads
+	const uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+	const uint32_t subtreeSize = std::max(MIN_SUBTREE_SIZE, triangleCount / (threadCount * 8));
+	vector<Subtree> subtrees;
+	m_nodes.reserve(2 * triangleCount);
+	m_nodes.resize(1);
+	if (triangleCount <= subtreeSize)
+		subtrees.push_back(Subtree{ 0, 0, triangleCount, 0 });
+	else
+		BuildNode(input, order, m_nodes, 0, 0, triangleCount, 0, &subtrees, subtreeSize);
+
+	vector<vector<SBVHNode>> subtreeNodes(subtrees.size());
+	ParallelFor((uint32_t)subtrees.size(), [&](uint32_t i)
+	{
+		const Subtree& subtree = subtrees[i];
+		subtreeNodes[i].reserve(2 * subtree.count);
+		subtreeNodes[i].resize(1);
+		BuildNode(input, order, subtreeNodes[i], 0, subtree.first, subtree.count, subtree.depth, nullptr, 0);
+	});
+
+	// Splice the subtrees in: their roots replace the placeholders, the rest is appended
+	for (size_t i = 0; i < subtrees.size(); ++i)
+	{
+		const vector<SBVHNode>& local = subtreeNodes[i];
+		const uint32_t base = (uint32_t)m_nodes.size() - 1;
+		for (size_t n = 0; n < local.size(); ++n)
+		{
+			SBVHNode node = local[n];
+			if (node.count == 0)
+				node.leftOrFirst += base;
+			if (n == 0)
+				m_nodes[subtrees[i].node] = node;
+			else
+				m_nodes.push_back(node);
+		}
+	}
+	m_nodes.shrink_to_fit();
+
+	// Triangles in leaf order
+	m_triangles.resize(triangleCount);
+	ParallelFor(blockCount, [&](uint32_t block)
+	{
+		const uint32_t end = std::min(triangleCount, (block + 1) * BLOCK_SIZE);
+		for (uint32_t i = block * BLOCK_SIZE; i < end; ++i)
+		{
+			const uint32_t t = order[i];
+			uint32_t s = (uint32_t)(std::upper_bound(firstTriangle.begin(), firstTriangle.end(), t) - firstTriangle.begin() - 1);
+			const uint32_t local = locate(t, s);
+			const SMeshSection& section = sections[s];
+			const Index* tri = indices + section.startIndexLocation + local * 3;
+			XMVECTOR p0 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[0]].position);
+			XMVECTOR p1 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[1]].position);
+			XMVECTOR p2 = XMLoadFloat3(&vertices[section.baseVertexLocation + tri[2]].position);
+
+			Triangle& out = m_triangles[i];
+			XMStoreFloat3(&out.v0, p0);
+			XMStoreFloat3(&out.e1, XMVectorSubtract(p1, p0));
+			XMStoreFloat3(&out.e2, XMVectorSubtract(p2, p0));
+			out.section = s;
+			out.triangle = local;
+		}
+	});
+}
+
+void SMeshBVH::Build(const SVertex* vertices, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	BuildFromIndices(vertices, indices, sections, sectionCount);
+}
+
+void SMeshBVH::Build(const SVertex* vertices, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	BuildFromIndices(vertices, indices, sections, sectionCount);
+}
+
+bool SMeshBVH::Intersect(const SRay& ray, SRayHit& hit) const
+{
+	return Traverse<false>(m_nodes, m_triangles, ray, &hit);
+}
+
+bool SMeshBVH::Occluded(const SRay& ray) const
+{
+	return Traverse<true>(m_nodes, m_triangles, ray, nullptr);
+}
+
+void SMeshBVH::Intersect4(const SRay rays[4], SRayHit hits[4]) const
+{
+	if (m_nodes.empty())
+		return;
+
+	// One lane per ray
+	XMVECTOR origin[3], direction[3], invDirection[3];
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		origin[axis] = XMVectorSet(GetComponent(rays[0].origin, axis), GetComponent(rays[1].origin, axis), GetComponent(rays[2].origin, axis), GetComponent(rays[3].origin, axis));
+		direction[axis] = XMVectorSet(GetComponent(rays[0].direction, axis), GetComponent(rays[1].direction, axis), GetComponent(rays[2].direction, axis), GetComponent(rays[3].direction, axis));
+		invDirection[axis] = XMVectorReciprocal(direction[axis]);
+	}
+	const XMVECTOR tMin = XMVectorSet(rays[0].tMin, rays[1].tMin, rays[2].tMin, rays[3].tMin);
+	XMVECTOR tMax = XMVectorSet(rays[0].tMax, rays[1].tMax, rays[2].tMax, rays[3].tMax);
+
+	StackEntry stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	XMVECTOR enter;
+	if (AnyLane(IntersectBox4(m_nodes[0], origin, invDirection, tMin, tMax, enter)))
+		stack[stackSize++] = StackEntry{ 0, MinLane(enter) };
+
+	while (stackSize > 0)
+	{
+		const StackEntry entry = stack[--stackSize];
+		if (entry.distance > XMVectorGetX(XMVectorMax(XMVectorMax(XMVectorSplatX(tMax), XMVectorSplatY(tMax)), XMVectorMax(XMVectorSplatZ(tMax), XMVectorSplatW(tMax)))))
+			continue;
+
+		const SBVHNode& node = m_nodes[entry.node];
+		if (node.count == 0)
+		{
+			const uint32_t left = node.leftOrFirst;
+			XMVECTOR enterLeft, enterRight;
+			const bool hitLeft = AnyLane(IntersectBox4(m_nodes[left], origin, invDirection, tMin, tMax, enterLeft));
+			const bool hitRight = AnyLane(IntersectBox4(m_nodes[left + 1], origin, invDirection, tMin, tMax, enterRight));
+			const float distanceLeft = hitLeft ? MinLane(enterLeft) : FLT_MAX;
+			const float distanceRight = hitRight ? MinLane(enterRight) : FLT_MAX;
+
+			// The nearer child goes on top of the stack
+			if (distanceLeft <= distanceRight)
+			{
+				if (hitRight)
+					stack[stackSize++] = StackEntry{ left + 1, distanceRight };
+				if (hitLeft)
+					stack[stackSize++] = StackEntry{ left, distanceLeft };
+			}
+			else
+			{
+				if (hitLeft)
+					stack[stackSize++] = StackEntry{ left, distanceLeft };
+				stack[stackSize++] = StackEntry{ left + 1, distanceRight };
+			}
+			continue;
+		}
+
+		for (uint32_t i = node.leftOrFirst; i < node.leftOrFirst + node.count; ++i)
+		{
+			const Triangle& tri = m_triangles[i];
+			const XMVECTOR e1[3] = { XMVectorReplicate(tri.e1.x), XMVectorReplicate(tri.e1.y), XMVectorReplicate(tri.e1.z) };
+			const XMVECTOR e2[3] = { XMVectorReplicate(tri.e2.x), XMVectorReplicate(tri.e2.y), XMVectorReplicate(tri.e2.z) };
+
+			// Moeller-Trumbore per lane. A zero determinant makes u NaN, which fails every comparison.
+			XMVECTOR p[3], q[3], s[3];
+			p[0] = XMVectorSubtract(XMVectorMultiply(direction[1], e2[2]), XMVectorMultiply(direction[2], e2[1]));
+			p[1] = XMVectorSubtract(XMVectorMultiply(direction[2], e2[0]), XMVectorMultiply(direction[0], e2[2]));
+			p[2] = XMVectorSubtract(XMVectorMultiply(direction[0], e2[1]), XMVectorMultiply(direction[1], e2[0]));
+			const XMVECTOR invDet = XMVectorReciprocal(XMVectorMultiplyAdd(e1[0], p[0], XMVectorMultiplyAdd(e1[1], p[1], XMVectorMultiply(e1[2], p[2]))));
+			s[0] = XMVectorSubtract(origin[0], XMVectorReplicate(tri.v0.x));
+			s[1] = XMVectorSubtract(origin[1], XMVectorReplicate(tri.v0.y));
+			s[2] = XMVectorSubtract(origin[2], XMVectorReplicate(tri.v0.z));
+			const XMVECTOR u = XMVectorMultiply(XMVectorMultiplyAdd(s[0], p[0], XMVectorMultiplyAdd(s[1], p[1], XMVectorMultiply(s[2], p[2]))), invDet);
+			q[0] = XMVectorSubtract(XMVectorMultiply(s[1], e1[2]), XMVectorMultiply(s[2], e1[1]));
+			q[1] = XMVectorSubtract(XMVectorMultiply(s[2], e1[0]), XMVectorMultiply(s[0], e1[2]));
+			q[2] = XMVectorSubtract(XMVectorMultiply(s[0], e1[1]), XMVectorMultiply(s[1], e1[0]));
+			const XMVECTOR v = XMVectorMultiply(XMVectorMultiplyAdd(direction[0], q[0], XMVectorMultiplyAdd(direction[1], q[1], XMVectorMultiply(direction[2], q[2]))), invDet);
+			const XMVECTOR t = XMVectorMultiply(XMVectorMultiplyAdd(e2[0], q[0], XMVectorMultiplyAdd(e2[1], q[1], XMVectorMultiply(e2[2], q[2]))), invDet);
+
+			XMVECTOR mask = XMVectorAndInt(XMVectorGreaterOrEqual(u, XMVectorZero()), XMVectorGreaterOrEqual(v, XMVectorZero()));
+			mask = XMVectorAndInt(mask, XMVectorLessOrEqual(XMVectorAdd(u, v), XMVectorSplatOne()));
+			mask = XMVectorAndInt(mask, XMVectorAndInt(XMVectorGreaterOrEqual(t, tMin), XMVectorLessOrEqual(t, tMax)));
+			if (!AnyLane(mask))
+				continue;
+
+			tMax = XMVectorSelect(tMax, t, mask);
+			uint32_t lanes[4];
+			XMFLOAT4 tLanes, uLanes, vLanes;
+			XMStoreInt4(lanes, mask);
+			XMStoreFloat4(&tLanes, t);
+			XMStoreFloat4(&uLanes, u);
+			XMStoreFloat4(&vLanes, v);
+			for (uint32_t lane = 0; lane < 4; ++lane)
+			{
+				if (!lanes[lane])
+					continue;
+				hits[lane].t = (&tLanes.x)[lane];
+				hits[lane].u = (&uLanes.x)[lane];
+				hits[lane].v = (&vLanes.x)[lane];
+				hits[lane].section = tri.section;
+				hits[lane].triangle = tri.triangle;
+			}
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "SMeshTypes.h"
+
+#include <cfloat>
+#include <vector>
+
+struct SRay
+{
+	DirectX::XMFLOAT3 origin;
+	DirectX::XMFLOAT3 direction;  // Doesn't have to be normalized, t is measured in multiples of it
+	float tMin = 0.0f;
+	float tMax = FLT_MAX;
+};
+
+struct SRayHit
+{
+	float t = FLT_MAX;
+	float u = 0.0f;               // Barycentrics of the 2nd and 3rd vertex
+	float v = 0.0f;
+	uint32_t section = UINT32_MAX;  // UINT32_MAX if nothing was hit
+	uint32_t triangle = 0;          // Index of the triangle in its section
+};
+
+// 32 byte node of the flattened tree. Children of an interior node are stored next to each other.
+struct SBVHNode
+{
+	DirectX::XMFLOAT3 boundsMin;
+	uint32_t leftOrFirst;  // Interior: index of the left child, leaf: first triangle
+	DirectX::XMFLOAT3 boundsMax;
+	uint32_t count;        // Triangles in a leaf, 0 for interior nodes
+};
+
+// Binned SAH bounding volume hierarchy over the triangles of all sections of a mesh, in object space.
+//
+// Triangles are copied in leaf order (first vertex and two edges, ready for Moeller-Trumbore),
+// so the tree keeps working after SMesh::ReleaseCPUData().
+class SMeshBVH
+{
+public:
+	static constexpr uint32_t BIN_COUNT = 16;
+	static constexpr uint32_t MAX_LEAF_SIZE = 8;
+	static constexpr uint32_t STACK_SIZE = 64;
+
+	struct Triangle
+	{
+		DirectX::XMFLOAT3 v0;
+		DirectX::XMFLOAT3 e1;  // v1 - v0
+		DirectX::XMFLOAT3 e2;  // v2 - v0
+		uint32_t section;
+		uint32_t triangle;
+	};
+
+private:
+	std::vector<SBVHNode> m_nodes;
+	std::vector<Triangle> m_triangles;
+
+	template<typename Index>
+	void BuildFromIndices(const SVertex* vertices, const Index* indices, const SMeshSection* sections, size_t sectionCount);
+
+public:
+	// Subtrees below the top levels are built in parallel
+	void Build(const SVertex* vertices, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount);
+	// Same for 16 bit indices, as mapped from a .smesh cache
+	void Build(const SVertex* vertices, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount);
+
+	inline bool Empty() const { return m_nodes.empty(); }
+	inline const std::vector<SBVHNode>& GetNodes() const { return m_nodes; }
+	inline const std::vector<Triangle>& GetTriangles() const { return m_triangles; }
+
+	// Closest hit in [ray.tMin, ray.tMax]. [hit] is only written when something was hit.
+	bool Intersect(const SRay& ray, SRayHit& hit) const;
+	// Any hit in [ray.tMin, ray.tMax], for shadow and visibility rays
+	bool Occluded(const SRay& ray) const;
+
+	// Closest hits of 4 rays, traversed together with one SIMD lane per ray.
+	// Faster than 4 single rays when the rays are coherent (camera rays, picking).
+	void Intersect4(const SRay rays[4], SRayHit hits[4]) const;
+};
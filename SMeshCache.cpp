@@ -0,0 +1,246 @@
+#include "SMeshCache.h"
+
+#include "FileHash.h"
+#include "SGLTFReader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	inline uint64_t AlignUp(uint64_t value)
+	{
+		return (value + SMeshCache::ALIGNMENT - 1) & ~(SMeshCache::ALIGNMENT - 1);
+	}
+
+	bool WritePadding(FILE* file, uint64_t from, uint64_t to)
+	{
+		static const uint8_t zeros[SMeshCache::ALIGNMENT] = {};
+		return to == from || fwrite(zeros, 1, (size_t)(to - from), file) == to - from;
+	}
+
+	bool CheckChunk(const SMeshCache::ChunkEntry& chunk, uint64_t fileSize, size_t elementSize)
+	{
+		return chunk.offset % SMeshCache::ALIGNMENT == 0
+			&& chunk.offset <= fileSize
+			&& chunk.size <= fileSize - chunk.offset
+			&& chunk.size % elementSize == 0;
+	}
+
+	// Whether the [count] indices from [first], relative to [baseVertex], all name one of [vertexCount] vertices
+	template<typename Index>
+	bool CheckIndices(const Index* indices, uint64_t first, uint64_t count, uint64_t baseVertex, uint64_t vertexCount)
+	{
+		Index maxIndex = 0;
+		for (uint64_t i = first; i < first + count; ++i)
+			maxIndex = std::max(maxIndex, indices[i]);
+		return count == 0 || baseVertex + maxIndex < vertexCount;
+	}
+
+	bool CheckIndices(const SMeshCache::View& view, uint64_t first, uint64_t count, uint64_t baseVertex)
+	{
+		return view.indexSize == sizeof(uint16_t)
+			? CheckIndices((const uint16_t*)view.indices, first, count, baseVertex, view.vertexCount)
+			: CheckIndices((const uint32_t*)view.indices, first, count, baseVertex, view.vertexCount);
+	}
+}
+
+uint64_t SMeshCache::HashSource(const char* filename)
+{
+	uint64_t hash = HashFile(filename);
+	const size_t length = strlen(filename);
+	if (hash == 0 || length < 5 || strcmp(filename + length - 5, ".gltf") != 0)
+		return hash;
+
+	// A .gltf file only holds the JSON, its geometry lives in the buffers it references
+	vector<std::string> buffers;
+	if (!SGLTFReader::GetBufferPaths(filename, buffers))
+		return hash;
+	for (const std::string& buffer : buffers)
+	{
+		const uint64_t bufferHash = HashFile(buffer.c_str());
+		if (bufferHash == 0)
+			return 0;
+		hash = HashBytes(&bufferHash, sizeof(bufferHash), hash);
+	}
+	return hash;
+}
+
+bool SMeshCache::FitsShortIndices(const uint32_t* indices, size_t count)
+{
+	uint32_t maxIndex = 0;
+	for (size_t i = 0; i < count; ++i)
+		maxIndex = std::max(maxIndex, indices[i]);
+	return maxIndex <= UINT16_MAX;
+}
+
+std::string SMeshCache::GetCachePath(const char* sourceFilename)
+{
+	return std::string(sourceFilename) + ".smesh";
+}
+
+bool SMeshCache::Validate(const MappedFile& file, uint64_t sourceHash, View& outView)
+{
+	if (!file.loaded() || file.size() < sizeof(Header))
+		return false;
+
+	Header header;
+	memcpy(&header, file.data(), sizeof(Header));
+	if (header.magic != MAGIC
+		|| header.formatVersion != FORMAT_VERSION
+		|| header.toolVersion != TOOL_VERSION
+		|| header.vertexStride != sizeof(SVertex)
+		|| (header.indexStride != sizeof(uint16_t) && header.indexStride != sizeof(uint32_t))
+		|| header.sourceHash != sourceHash
+		|| header.fileSize != file.size())
+		return false;
+
+	if (!CheckChunk(header.chunks[CHUNK_VERTICES], file.size(), sizeof(SVertex))
+		|| !CheckChunk(header.chunks[CHUNK_INDICES], file.size(), header.indexStride)
+		|| !CheckChunk(header.chunks[CHUNK_SECTIONS], file.size(), sizeof(SMeshSection))
+		|| !CheckChunk(header.chunks[CHUNK_LODS], file.size(), sizeof(SMeshLOD))
+		|| !CheckChunk(header.chunks[CHUNK_LOD_OFFSETS], file.size(), sizeof(uint32_t))
+		|| !CheckChunk(header.chunks[CHUNK_SECTION_BOUNDS], file.size(), sizeof(SMeshSectionBounds)))
+		return false;
+
+	View view;
+	view.vertices = (const SVertex*)(file.data() + header.chunks[CHUNK_VERTICES].offset);
+	view.vertexCount = header.chunks[CHUNK_VERTICES].size / sizeof(SVertex);
+	view.indices = file.data() + header.chunks[CHUNK_INDICES].offset;
+	view.indexCount = header.chunks[CHUNK_INDICES].size / header.indexStride;
+	view.indexSize = header.indexStride;
+	view.sections = (const SMeshSection*)(file.data() + header.chunks[CHUNK_SECTIONS].offset);
+	view.sectionCount = header.chunks[CHUNK_SECTIONS].size / sizeof(SMeshSection);
+	view.lods = (const SMeshLOD*)(file.data() + header.chunks[CHUNK_LODS].offset);
+	view.lodCount = header.chunks[CHUNK_LODS].size / sizeof(SMeshLOD);
+	view.lodOffsets = (const uint32_t*)(file.data() + header.chunks[CHUNK_LOD_OFFSETS].offset);
+	view.lodOffsetCount = header.chunks[CHUNK_LOD_OFFSETS].size / sizeof(uint32_t);
+	view.sectionBounds = (const SMeshSectionBounds*)(file.data() + header.chunks[CHUNK_SECTION_BOUNDS].offset);
+	if (header.chunks[CHUNK_SECTION_BOUNDS].size != view.sectionCount * sizeof(SMeshSectionBounds))
+		return false;
+	view.boundsMin = header.boundsMin;
+	view.boundsMax = header.boundsMax;
+
+	// Sections must stay inside the arrays, otherwise a corrupt file could make the GPU read out of bounds
+	for (uint64_t i = 0; i < view.sectionCount; ++i)
+	{
+		const SMeshSection& section = view.sections[i];
+		if ((uint64_t)section.startIndexLocation + section.indexCount > view.indexCount
+			|| section.baseVertexLocation > view.vertexCount)
+			return false;
+	}
+
+	// Same for the LOD ranges, whose offset table must cover every section
+	if (view.lodOffsetCount != 0)
+	{
+		if (view.lodOffsetCount != view.sectionCount + 1 || view.lodOffsets[0] != 0 || view.lodOffsets[view.sectionCount] != view.lodCount)
+			return false;
+		for (uint64_t i = 0; i < view.sectionCount; ++i)
+		{
+			if (view.lodOffsets[i] > view.lodOffsets[i + 1])
+				return false;
+		}
+	}
+	else if (view.lodCount != 0)
+	{
+		return false;
+	}
+	for (uint64_t i = 0; i < view.lodCount; ++i)
+	{
+		if ((uint64_t)view.lods[i].startIndexLocation + view.lods[i].indexCount > view.indexCount)
+			return false;
+	}
+
+	// And every index a section or one of its LODs draws must name a vertex
+	for (uint64_t i = 0; i < view.sectionCount; ++i)
+	{
+		const SMeshSection& section = view.sections[i];
+		if (!CheckIndices(view, section.startIndexLocation, section.indexCount, section.baseVertexLocation))
+			return false;
+		if (view.lodOffsetCount == 0)
+			continue;
+		for (uint32_t l = view.lodOffsets[i]; l < view.lodOffsets[i + 1]; ++l)
+		{
+			const SMeshLOD& lod = view.lods[l];
+			const bool sectionRange = lod.startIndexLocation == section.startIndexLocation && lod.indexCount == section.indexCount;
+			if (!sectionRange && !CheckIndices(view, lod.startIndexLocation, lod.indexCount, section.baseVertexLocation))
+				return false;
+		}
+	}
+
+	outView = view;
+	return true;
+}
+
+bool SMeshCache::Write(const char* filename, uint64_t sourceHash, const View& view)
+{
+	Header header = {};
+	header.magic = MAGIC;
+	header.formatVersion = FORMAT_VERSION;
+	header.toolVersion = TOOL_VERSION;
+	header.vertexStride = sizeof(SVertex);
+	header.sourceHash = sourceHash;
+
+	// Narrowed once here, so that every load maps the 16 bit indices and uploads them as they are
+	vector<uint16_t> shortIndices;
+	const void* indices = view.indices;
+	header.indexStride = view.indexSize;
+	if (view.indexSize == sizeof(uint32_t) && FitsShortIndices((const uint32_t*)view.indices, (size_t)view.indexCount))
+	{
+		shortIndices.resize((size_t)view.indexCount);
+		for (size_t i = 0; i < shortIndices.size(); ++i)
+			shortIndices[i] = (uint16_t)((const uint32_t*)view.indices)[i];
+		indices = shortIndices.data();
+		header.indexStride = sizeof(uint16_t);
+	}
+	header.boundsMin = view.boundsMin;
+	header.boundsMax = view.boundsMax;
+
+	const void* chunkData[CHUNK_COUNT] = { view.vertices, indices, view.sections, view.lods, view.lodOffsets, view.sectionBounds };
+	header.chunks[CHUNK_VERTICES].size = view.vertexCount * sizeof(SVertex);
+	header.chunks[CHUNK_INDICES].size = view.indexCount * header.indexStride;
+	header.chunks[CHUNK_SECTIONS].size = view.sectionCount * sizeof(SMeshSection);
+	header.chunks[CHUNK_LODS].size = view.lodCount * sizeof(SMeshLOD);
+	header.chunks[CHUNK_LOD_OFFSETS].size = view.lodOffsetCount * sizeof(uint32_t);
+	header.chunks[CHUNK_SECTION_BOUNDS].size = view.sectionCount * sizeof(SMeshSectionBounds);
+
+	uint64_t offset = sizeof(Header);
+	for (uint32_t i = 0; i < CHUNK_COUNT; ++i)
+	{
+		header.chunks[i].offset = AlignUp(offset);
+		offset = header.chunks[i].offset + header.chunks[i].size;
+	}
+	header.fileSize = offset;
+
+	std::string tempFilename = std::string(filename) + ".tmp";
+	FILE* file = fopen(tempFilename.c_str(), "wb");
+	if (!file)
+		return false;
+
+	bool ok = fwrite(&header, sizeof(Header), 1, file) == 1;
+	offset = sizeof(Header);
+	for (uint32_t i = 0; i < CHUNK_COUNT && ok; ++i)
+	{
+		ok = WritePadding(file, offset, header.chunks[i].offset);
+		if (ok && header.chunks[i].size > 0)
+			ok = fwrite(chunkData[i], (size_t)header.chunks[i].size, 1, file) == 1;
+		offset = header.chunks[i].offset + header.chunks[i].size;
+	}
+	ok = (fclose(file) == 0) && ok;
+
+	// Replaces an existing cache in one step
+	std::error_code error;
+	if (ok)
+		std::filesystem::rename(tempFilename, filename, error);
+	if (!ok || error)
+	{
+		std::filesystem::remove(tempFilename, error);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "SMeshTypes.h"
+
+#include <string>
+
+// .smesh: binary cache of a fully processed SMesh (parsed, welded, tangents and LODs generated).
+//
+// Layout: a fixed size Header followed by the vertex, index, section, LOD and section bounds arrays.
+// Every array starts on an ALIGNMENT boundary and is listed in the header's offset table,
+// so a read-only mapping of the file can be used in place and handed to CopyToUploadHeap.
+// Indices are stored in 16 bits whenever every one of them fits.
+namespace SMeshCache
+{
+	constexpr uint32_t MAGIC = 0x48534D53; // "SMSH"
+	constexpr uint32_t FORMAT_VERSION = 4;
+
+	// Bump whenever a loader or the post-processing in SMesh::Load changes its output,
+	// so that caches written by an older build are rebuilt.
+	constexpr uint32_t TOOL_VERSION = 3;
+
+	constexpr uint64_t ALIGNMENT = 256;
+
+	enum Chunk : uint32_t
+	{
+		CHUNK_VERTICES,
+		CHUNK_INDICES,
+		CHUNK_SECTIONS,
+		CHUNK_LODS,
+		CHUNK_LOD_OFFSETS,
+		CHUNK_SECTION_BOUNDS,
+		CHUNK_COUNT
+	};
+
+	struct ChunkEntry
+	{
+		uint64_t offset;
+		uint64_t size;
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t formatVersion;
+		uint32_t toolVersion;
+		uint32_t vertexStride;
+		uint32_t indexStride;  // 2 or 4
+		uint32_t padding;
+		uint64_t sourceHash;
+		uint64_t fileSize;
+		DirectX::XMFLOAT3 boundsMin;
+		DirectX::XMFLOAT3 boundsMax;
+		ChunkEntry chunks[CHUNK_COUNT];
+	};
+
+	// Mesh data, either pointing into a mapped cache file or into SMesh's own arrays
+	struct View
+	{
+		const SVertex* vertices = nullptr;
+		uint64_t vertexCount = 0;
+		const void* indices = nullptr;  // uint16_t or uint32_t, see indexSize
+		uint64_t indexCount = 0;
+		uint32_t indexSize = sizeof(uint32_t);
+		const SMeshSection* sections = nullptr;
+		uint64_t sectionCount = 0;
+		const SMeshLOD* lods = nullptr;
+		uint64_t lodCount = 0;
+		const uint32_t* lodOffsets = nullptr;  // Empty, or one per section plus the end
+		uint64_t lodOffsetCount = 0;
+		const SMeshSectionBounds* sectionBounds = nullptr;  // One per section
+		DirectX::XMFLOAT3 boundsMin = {};
+		DirectX::XMFLOAT3 boundsMax = {};
+	};
+
+	// The key of a mesh's cache: HashFile of [filename], combined for a .gltf with that of every buffer file it
+	// references, since those hold the geometry. Returns 0 if a file can't be read.
+	uint64_t HashSource(const char* filename);
+
+	// Indices are relative to each section's baseVertexLocation, so this is all that decides
+	// whether the whole index buffer (LODs included) fits into 16 bits
+	bool FitsShortIndices(const uint32_t* indices, size_t count);
+
+	// "<source>.smesh", next to the source file
+	std::string GetCachePath(const char* sourceFilename);
+
+	// Checks the header, versions, source hash and offset table of a mapped cache
+	// and points [outView] at its arrays. Returns false for stale or corrupt files.
+	bool Validate(const MappedFile& file, uint64_t sourceHash, View& outView);
+
+	// Writes to a temporary file first and moves it into place, so readers never see a partial cache.
+	bool Write(const char* filename, uint64_t sourceHash, const View& view);
+}
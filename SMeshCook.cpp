@@ -0,0 +1,215 @@
+#include "SMeshCook.h"
+
+#include "ParallelFor.h"
+#include "SMeshSimplifier.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Section indices are relative to baseVertexLocation, the largest one gives the vertex range
+	template<typename Index>
+	uint32_t GetVertexCount(const Index* indices, size_t indexCount)
+	{
+		uint32_t vertexCount = 0;
+		for (size_t i = 0; i < indexCount; ++i)
+			vertexCount = std::max(vertexCount, (uint32_t)indices[i] + 1);
+		return vertexCount;
+	}
+
+	template<typename Index>
+	void OptimizeSections(SVertex* vertices, Index* indices, const SMeshSection* sections, size_t sectionCount,
+		SMeshOptimizer::VertexCacheStatistics* outBefore, SMeshOptimizer::VertexCacheStatistics* outAfter)
+	{
+		vector<uint32_t> vertexCounts(sectionCount);
+		for (size_t i = 0; i < sectionCount; ++i)
+			vertexCounts[i] = GetVertexCount(indices + sections[i].startIndexLocation, sections[i].indexCount);
+
+		// Vertices can only be reordered if no other section references them
+		vector<uint32_t> byBase(sectionCount);
+		for (uint32_t i = 0; i < (uint32_t)sectionCount; ++i)
+			byBase[i] = i;
+		std::stable_sort(byBase.begin(), byBase.end(), [&](uint32_t a, uint32_t b) { return sections[a].baseVertexLocation < sections[b].baseVertexLocation; });
+		vector<uint8_t> ownsVertices(sectionCount, 1);
+		for (size_t i = 1; i < sectionCount; ++i)
+		{
+			const uint32_t prev = byBase[i - 1];
+			const uint32_t curr = byBase[i];
+			if (sections[prev].baseVertexLocation + vertexCounts[prev] > sections[curr].baseVertexLocation)
+			{
+				ownsVertices[prev] = 0;
+				ownsVertices[curr] = 0;
+			}
+		}
+
+		ParallelFor((uint32_t)sectionCount, [&](uint32_t i)
+		{
+			const SMeshSection& section = sections[i];
+			Index* sectionIndices = indices + section.startIndexLocation;
+			SVertex* sectionVertices = vertices + section.baseVertexLocation;
+
+			if (outBefore)
+				outBefore[i] = SMeshOptimizer::AnalyzeVertexCache(sectionIndices, section.indexCount, vertexCounts[i]);
+
+			vector<uint32_t> clusters;
+			SMeshOptimizer::OptimizeVertexCache(sectionIndices, section.indexCount, vertexCounts[i], &clusters);
+			SMeshOptimizer::OptimizeOverdraw(sectionIndices, section.indexCount, &sectionVertices->position.x, sizeof(SVertex), vertexCounts[i], clusters);
+			if (ownsVertices[i])
+			{
+				SMeshOptimizer::OptimizeVertexFetch(sectionVertices, sizeof(SVertex), vertexCounts[i], sectionIndices, section.indexCount);
+			}
+
+			if (outAfter)
+				outAfter[i] = SMeshOptimizer::AnalyzeVertexCache(sectionIndices, section.indexCount, vertexCounts[i]);
+		});
+	}
+
+	template<typename Index>
+	void SimplifySections(const SVertex* vertices, vector<Index>& indices, const SMeshSection* sections, size_t sectionCount,
+		uint32_t maxLODCount, float reduction, vector<SMeshLOD>& outLODs, vector<uint32_t>& outLODOffsets)
+	{
+		vector<vector<vector<Index>>> lodIndices(sectionCount);
+		vector<vector<float>> lodErrors(sectionCount);
+		ParallelFor((uint32_t)sectionCount, [&](uint32_t i)
+		{
+			const SMeshSection& section = sections[i];
+			const Index* sectionIndices = indices.data() + section.startIndexLocation;
+			const SVertex* sectionVertices = vertices + section.baseVertexLocation;
+			const uint32_t vertexCount = GetVertexCount(sectionIndices, section.indexCount);
+
+			// Each LOD is simplified from the previous one, so the errors add up
+			vector<Index> previous(sectionIndices, sectionIndices + section.indexCount);
+			float error = 0.0f;
+			for (uint32_t lod = 1; lod < maxLODCount; ++lod)
+			{
+				const size_t target = (size_t)(previous.size() / 3 * reduction) * 3;
+				vector<Index> simplified(previous.size());
+				float lodError = 0.0f;
+				simplified.resize(SMeshSimplifier::Simplify(simplified.data(), previous.data(), previous.size(),
+					&sectionVertices->position.x, &sectionVertices->normal.x, sizeof(SVertex), vertexCount, target, FLT_MAX, &lodError));
+
+				// Stop once locked vertices keep the simplifier from getting halfway to the target
+				if (simplified.empty() || simplified.size() > (previous.size() + target) / 2)
+					break;
+
+				SMeshOptimizer::OptimizeVertexCache(simplified.data(), simplified.size(), vertexCount);
+				error += lodError;
+				lodErrors[i].push_back(error);
+				lodIndices[i].push_back(simplified);
+				previous = std::move(simplified);
+			}
+		});
+
+		// LOD 0 is the section itself, the others are appended after the indices of all sections
+		outLODs.clear();
+		outLODOffsets.clear();
+		outLODOffsets.reserve(sectionCount + 1);
+		for (size_t i = 0; i < sectionCount; ++i)
+		{
+			const SMeshSection& section = sections[i];
+			outLODOffsets.push_back((uint32_t)outLODs.size());
+			outLODs.push_back(SMeshLOD{ section.indexCount, section.startIndexLocation, 0.0f });
+			for (size_t lod = 0; lod < lodIndices[i].size(); ++lod)
+			{
+				outLODs.push_back(SMeshLOD{ (uint32_t)lodIndices[i][lod].size(), (uint32_t)indices.size(), lodErrors[i][lod] });
+				indices.insert(indices.end(), lodIndices[i][lod].begin(), lodIndices[i][lod].end());
+			}
+		}
+		outLODOffsets.push_back((uint32_t)outLODs.size());
+	}
+
+	template<typename Index>
+	void BoundSections(const SVertex* vertices, size_t vertexCount, const Index* indices, const SMeshSection* sections, size_t sectionCount,
+		XMFLOAT3& outMin, XMFLOAT3& outMax, vector<SMeshSectionBounds>& outSectionBounds)
+	{
+		outSectionBounds.assign(sectionCount, SMeshSectionBounds{});
+		if (vertexCount == 0)
+		{
+			outMin = outMax = XMFLOAT3(0.0f, 0.0f, 0.0f);
+			return;
+		}
+
+		XMVECTOR vMin = XMLoadFloat3(&vertices[0].position);
+		XMVECTOR vMax = vMin;
+		for (size_t i = 1; i < vertexCount; ++i)
+		{
+			XMVECTOR p = XMLoadFloat3(&vertices[i].position);
+			vMin = XMVectorMin(vMin, p);
+			vMax = XMVectorMax(vMax, p);
+		}
+		XMStoreFloat3(&outMin, vMin);
+		XMStoreFloat3(&outMax, vMax);
+
+		// Sections only cover the vertices their indices reference
+		ParallelFor((uint32_t)sectionCount, [&](uint32_t s)
+		{
+			const SMeshSection& section = sections[s];
+			SMeshSectionBounds& bounds = outSectionBounds[s];
+			if (section.indexCount == 0)
+				return;
+
+			const SVertex* sectionVertices = vertices + section.baseVertexLocation;
+			const Index* sectionIndices = indices + section.startIndexLocation;
+			XMVECTOR sMin = XMLoadFloat3(&sectionVertices[sectionIndices[0]].position);
+			XMVECTOR sMax = sMin;
+			for (uint32_t i = 1; i < section.indexCount; ++i)
+			{
+				XMVECTOR p = XMLoadFloat3(&sectionVertices[sectionIndices[i]].position);
+				sMin = XMVectorMin(sMin, p);
+				sMax = XMVectorMax(sMax, p);
+			}
+
+			XMVECTOR center = XMVectorScale(XMVectorAdd(sMin, sMax), 0.5f);
+			XMVECTOR radiusSq = XMVectorZero();
+			for (uint32_t i = 0; i < section.indexCount; ++i)
+			{
+				radiusSq = XMVectorMax(radiusSq, XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&sectionVertices[sectionIndices[i]].position), center)));
+			}
+
+			XMStoreFloat3(&bounds.center, center);
+			bounds.radius = XMVectorGetX(XMVectorSqrt(radiusSq));
+			XMStoreFloat3(&bounds.aabbMin, sMin);
+			XMStoreFloat3(&bounds.aabbMax, sMax);
+		});
+	}
+}
+
+void SMeshCook::Optimize(SVertex* vertices, uint32_t* indices, const SMeshSection* sections, size_t sectionCount,
+	SMeshOptimizer::VertexCacheStatistics* outBefore, SMeshOptimizer::VertexCacheStatistics* outAfter)
+{
+	OptimizeSections(vertices, indices, sections, sectionCount, outBefore, outAfter);
+}
+
+void SMeshCook::Optimize(SVertex* vertices, uint16_t* indices, const SMeshSection* sections, size_t sectionCount,
+	SMeshOptimizer::VertexCacheStatistics* outBefore, SMeshOptimizer::VertexCacheStatistics* outAfter)
+{
+	OptimizeSections(vertices, indices, sections, sectionCount, outBefore, outAfter);
+}
+
+void SMeshCook::GenerateLODs(const SVertex* vertices, vector<uint32_t>& indices, const SMeshSection* sections, size_t sectionCount,
+	uint32_t maxLODCount, float reduction, vector<SMeshLOD>& outLODs, vector<uint32_t>& outLODOffsets)
+{
+	SimplifySections(vertices, indices, sections, sectionCount, maxLODCount, reduction, outLODs, outLODOffsets);
+}
+
+void SMeshCook::GenerateLODs(const SVertex* vertices, vector<uint16_t>& indices, const SMeshSection* sections, size_t sectionCount,
+	uint32_t maxLODCount, float reduction, vector<SMeshLOD>& outLODs, vector<uint32_t>& outLODOffsets)
+{
+	SimplifySections(vertices, indices, sections, sectionCount, maxLODCount, reduction, outLODs, outLODOffsets);
+}
+
+void SMeshCook::ComputeBounds(const SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount,
+	XMFLOAT3& outMin, XMFLOAT3& outMax, vector<SMeshSectionBounds>& outSectionBounds)
+{
+	BoundSections(vertices, vertexCount, indices, sections, sectionCount, outMin, outMax, outSectionBounds);
+}
+
+void SMeshCook::ComputeBounds(const SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount,
+	XMFLOAT3& outMin, XMFLOAT3& outMax, vector<SMeshSectionBounds>& outSectionBounds)
+{
+	BoundSections(vertices, vertexCount, indices, sections, sectionCount, outMin, outMax, outSectionBounds);
+}
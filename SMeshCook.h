@@ -0,0 +1,37 @@
+#pragma once
+
+#include "SMeshOptimizer.h"
+#include "SMeshTypes.h"
+
+#include <cstddef>
+#include <vector>
+
+// The passes SMesh::Load runs over every section of a freshly parsed mesh before it caches it. They work on
+// plain arrays and do not depend on D3D12, so the tests and benchmarks run exactly what the engine does.
+// Each takes 32 or 16 bit indices, whichever the mesh was loaded with.
+namespace SMeshCook
+{
+	// Vertex cache, overdraw and vertex fetch order of every section (see SMeshOptimizer.h), in parallel. Vertices
+	// another section also references keep their order. [outBefore] and [outAfter], if given, receive the vertex cache
+	// statistics of each section.
+	void Optimize(SVertex* vertices, uint32_t* indices, const SMeshSection* sections, size_t sectionCount,
+		SMeshOptimizer::VertexCacheStatistics* outBefore = nullptr, SMeshOptimizer::VertexCacheStatistics* outAfter = nullptr);
+	void Optimize(SVertex* vertices, uint16_t* indices, const SMeshSection* sections, size_t sectionCount,
+		SMeshOptimizer::VertexCacheStatistics* outBefore = nullptr, SMeshOptimizer::VertexCacheStatistics* outAfter = nullptr);
+
+	// Simplifies every section into up to [maxLODCount] - 1 coarser LODs, each with about [reduction] times the
+	// triangles of the previous one, in parallel. The LODs' indices are appended to [indices]; [outLODs] and
+	// [outLODOffsets] receive the LOD table, LODs of section s being [outLODOffsets[s], outLODOffsets[s + 1]) with
+	// LOD 0 the section itself.
+	void GenerateLODs(const SVertex* vertices, std::vector<uint32_t>& indices, const SMeshSection* sections, size_t sectionCount,
+		uint32_t maxLODCount, float reduction, std::vector<SMeshLOD>& outLODs, std::vector<uint32_t>& outLODOffsets);
+	void GenerateLODs(const SVertex* vertices, std::vector<uint16_t>& indices, const SMeshSection* sections, size_t sectionCount,
+		uint32_t maxLODCount, float reduction, std::vector<SMeshLOD>& outLODs, std::vector<uint32_t>& outLODOffsets);
+
+	// Box around all [vertices], and the bounds of the vertices each section's indices reference. The sphere is
+	// centered on the box and sized by the farthest vertex, which is tighter than the half diagonal.
+	void ComputeBounds(const SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount,
+		DirectX::XMFLOAT3& outMin, DirectX::XMFLOAT3& outMax, std::vector<SMeshSectionBounds>& outSectionBounds);
+	void ComputeBounds(const SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount,
+		DirectX::XMFLOAT3& outMin, DirectX::XMFLOAT3& outMax, std::vector<SMeshSectionBounds>& outSectionBounds);
+}
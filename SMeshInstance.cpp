@@ -0,0 +1,23 @@
+#include "stdafx.h"
+#include "SMeshInstance.h"
+
+#include "SMeshBVH.h"
+
+using namespace DirectX;
+
+SMeshInstance::SMeshInstance(std::shared_ptr<SMesh> mesh, UINT32 transform)
+	: m_mesh(std::move(mesh)), m_transform(transform)
+{
+}
+
+bool SMeshInstance::Intersect(const STransformStore& transforms, const SRay& worldRay, SRayHit& hit) const
+{
+	assert(m_mesh && m_mesh->GetBVH());
+
+	// Transforming the direction along with the origin keeps t the same in both spaces
+	XMMATRIX inverseModel = XMMatrixInverse(nullptr, transforms.LoadWorldMatrix(m_transform));
+	SRay ray = worldRay;
+	XMStoreFloat3(&ray.origin, XMVector3TransformCoord(XMLoadFloat3(&worldRay.origin), inverseModel));
+	XMStoreFloat3(&ray.direction, XMVector3TransformNormal(XMLoadFloat3(&worldRay.direction), inverseModel));
+	return m_mesh->GetBVH()->Intersect(ray, hit);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "SMesh.h"
+#include "STransformStore.h"
+
+#include <memory>
+
+// One placed object: a shared SMesh, the transform that places it and its material.
+// The transform lives in an STransformStore, so copies of an instance share it.
+class SMeshInstance
+{
+private:
+	std::shared_ptr<SMesh> m_mesh;
+	UINT32 m_transform = 0;      // Index into the STransformStore of the scene
+	UINT32 m_materialIndex = 0;  // See InstanceData
+
+public:
+	SMeshInstance() = default;
+	SMeshInstance(std::shared_ptr<SMesh> mesh, UINT32 transform);
+
+	inline SMesh* GetMesh() const { return m_mesh.get(); }
+	inline UINT32 GetTransform() const { return m_transform; }
+	inline UINT32 GetMaterialIndex() const { return m_materialIndex; }
+	inline void SetMaterialIndex(UINT32 index) { m_materialIndex = index; }
+
+	// Closest hit of a world space ray, [hit.t] is measured along [worldRay.direction]. Requires SMesh::BuildBVH()
+	// and an up to date [transforms].
+	bool Intersect(const STransformStore& transforms, const SRay& worldRay, SRayHit& hit) const;
+};
@@ -0,0 +1,412 @@
+#include "SMeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using std::vector;
+
+namespace
+{
+	// Triangles around each vertex, in compressed row form
+	struct VertexTriangles
+	{
+		vector<uint32_t> counts;
+		vector<uint32_t> offsets;
+		vector<uint32_t> triangles;
+	};
+
+	template<typename Index>
+	void BuildVertexTriangles(const Index* indices, size_t indexCount, size_t vertexCount, VertexTriangles& out)
+	{
+		out.counts.assign(vertexCount, 0);
+		out.offsets.resize(vertexCount);
+		out.triangles.resize(indexCount);
+
+		for (size_t i = 0; i < indexCount; ++i)
+			out.counts[indices[i]]++;
+
+		uint32_t offset = 0;
+		for (size_t v = 0; v < vertexCount; ++v)
+		{
+			out.offsets[v] = offset;
+			offset += out.counts[v];
+		}
+
+		vector<uint32_t> fill(out.offsets);
+		for (size_t i = 0; i < indexCount; ++i)
+			out.triangles[fill[indices[i]]++] = (uint32_t)(i / 3);
+	}
+
+	// FIFO cache simulation based on insertion timestamps:
+	// a vertex is still cached if fewer than [cacheSize] vertices were inserted after it.
+	struct FIFOCache
+	{
+		vector<uint32_t> insertTime;
+		uint32_t timestamp;
+		uint32_t cacheSize;
+
+		FIFOCache(size_t vertexCount, uint32_t size) : insertTime(vertexCount, 0), timestamp(size + 1), cacheSize(size) {}
+
+		// Returns true on a miss
+		inline bool Access(uint32_t v)
+		{
+			if (timestamp - insertTime[v] > cacheSize)
+			{
+				insertTime[v] = timestamp++;
+				return true;
+			}
+			return false;
+		}
+
+		template<typename Index>
+		inline uint32_t AccessTriangle(const Index* tri)
+		{
+			return (uint32_t)Access(tri[0]) + (uint32_t)Access(tri[1]) + (uint32_t)Access(tri[2]);
+		}
+
+		inline void Flush()
+		{
+			timestamp += cacheSize + 1;
+		}
+	};
+
+	struct Float3
+	{
+		float x, y, z;
+	};
+
+	inline Float3 GetPosition(const float* positions, size_t positionStride, uint32_t v)
+	{
+		const float* p = (const float*)((const uint8_t*)positions + v * positionStride);
+		return Float3{ p[0], p[1], p[2] };
+	}
+
+	template<typename Index>
+	SMeshOptimizer::VertexCacheStatistics SimulateFIFOCache(const Index* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+	{
+		SMeshOptimizer::VertexCacheStatistics stats = {};
+		stats.triangleCount = (uint32_t)(indexCount / 3);
+
+		FIFOCache cache(vertexCount, cacheSize);
+		vector<uint8_t> referenced(vertexCount, 0);
+		for (size_t i = 0; i < stats.triangleCount * 3; ++i)
+		{
+			stats.vertexTransforms += cache.Access(indices[i]);
+			stats.vertexCount += referenced[indices[i]] == 0;
+			referenced[indices[i]] = 1;
+		}
+
+		stats.acmr = stats.triangleCount ? (float)stats.vertexTransforms / stats.triangleCount : 0.0f;
+		stats.atvr = stats.vertexCount ? (float)stats.vertexTransforms / stats.vertexCount : 0.0f;
+		return stats;
+	}
+
+	template<typename Index>
+	void Tipsify(Index* indices, size_t indexCount, size_t vertexCount, vector<uint32_t>* outClusters)
+	{
+		const size_t triangleCount = indexCount / 3;
+		if (outClusters)
+		{
+			outClusters->clear();
+			outClusters->push_back(0);
+		}
+		if (triangleCount == 0 || vertexCount == 0)
+			return;
+
+		VertexTriangles adjacency;
+		BuildVertexTriangles(indices, triangleCount * 3, vertexCount, adjacency);
+
+		const uint32_t k = SMeshOptimizer::VERTEX_CACHE_SIZE;
+		vector<uint32_t> liveTriangles(adjacency.counts);
+		vector<uint32_t> cacheTime(vertexCount, 0);
+		vector<uint8_t> emitted(triangleCount, 0);
+		vector<uint32_t> deadEndStack;
+		vector<uint32_t> candidates;
+		vector<Index> output;
+		deadEndStack.reserve(triangleCount * 3);
+		output.reserve(triangleCount * 3);
+
+		uint32_t timestamp = k + 1;
+		uint32_t cursor = 0;
+		uint32_t fanning = indices[0];
+
+		for (;;)
+		{
+			// Emit every remaining triangle around the fanning vertex
+			candidates.clear();
+			const uint32_t* fan = &adjacency.triangles[adjacency.offsets[fanning]];
+			for (uint32_t i = 0; i < adjacency.counts[fanning]; ++i)
+			{
+				const uint32_t tri = fan[i];
+				if (emitted[tri])
+					continue;
+
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const uint32_t v = indices[tri * 3 + c];
+					output.push_back((Index)v);
+					deadEndStack.push_back(v);
+					candidates.push_back(v);
+					liveTriangles[v]--;
+					if (timestamp - cacheTime[v] > k)
+						cacheTime[v] = timestamp++;
+				}
+				emitted[tri] = 1;
+			}
+
+			// Prefer the oldest candidate that will still be in the cache after its fan is emitted
+			int64_t next = -1;
+			int64_t bestPriority = -1;
+			for (uint32_t v : candidates)
+			{
+				if (liveTriangles[v] == 0)
+					continue;
+
+				int64_t priority = 0;
+				if ((int64_t)timestamp - cacheTime[v] + 2 * (int64_t)liveTriangles[v] <= k)
+					priority = timestamp - cacheTime[v];
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					next = v;
+				}
+			}
+
+			if (next == -1)
+			{
+				// Dead end: back up to a recently used vertex, then fall back to scanning in input order
+				while (!deadEndStack.empty())
+				{
+					const uint32_t v = deadEndStack.back();
+					deadEndStack.pop_back();
+					if (liveTriangles[v] > 0)
+					{
+						next = v;
+						break;
+					}
+				}
+				while (next == -1 && cursor < vertexCount)
+				{
+					if (liveTriangles[cursor] > 0)
+						next = cursor;
+					else
+						++cursor;
+				}
+				if (next == -1)
+					break;
+
+				if (outClusters && outClusters->back() != output.size())
+					outClusters->push_back((uint32_t)output.size());
+			}
+
+			fanning = (uint32_t)next;
+		}
+
+		memcpy(indices, output.data(), output.size() * sizeof(Index));
+	}
+
+	template<typename Index>
+	void SortClustersForOverdraw(Index* indices, size_t indexCount, const float* positions, size_t positionStride, size_t vertexCount,
+		const vector<uint32_t>& clusters, float threshold)
+	{
+		const size_t triangleCount = indexCount / 3;
+		if (triangleCount == 0 || vertexCount == 0)
+			return;
+
+		// Split the hard clusters wherever the running ACMR already is as good as the whole cluster's
+		vector<uint32_t> hardClusters(clusters);
+		if (hardClusters.empty() || hardClusters[0] != 0)
+			hardClusters.insert(hardClusters.begin(), 0);
+		hardClusters.push_back((uint32_t)(triangleCount * 3));
+
+		vector<uint32_t> softClusters;
+		FIFOCache cache(vertexCount, SMeshOptimizer::VERTEX_CACHE_SIZE);
+		for (size_t c = 0; c + 1 < hardClusters.size(); ++c)
+		{
+			const uint32_t start = hardClusters[c] / 3;
+			const uint32_t end = hardClusters[c + 1] / 3;
+			if (start >= end)
+				continue;
+
+			cache.Flush();
+			uint32_t misses = 0;
+			for (uint32_t tri = start; tri < end; ++tri)
+				misses += cache.AccessTriangle(&indices[tri * 3]);
+			const float limit = threshold * misses / (end - start);
+
+			cache.Flush();
+			uint32_t subStart = start;
+			misses = 0;
+			for (uint32_t tri = start; tri < end; ++tri)
+			{
+				misses += cache.AccessTriangle(&indices[tri * 3]);
+				if (tri + 1 < end && (float)misses / (tri - subStart + 1) <= limit)
+				{
+					softClusters.push_back(subStart);
+					subStart = tri + 1;
+					misses = 0;
+					cache.Flush();
+				}
+			}
+			softClusters.push_back(subStart);
+		}
+		const size_t clusterCount = softClusters.size();
+		softClusters.push_back((uint32_t)triangleCount);
+
+		// Area weighted centroid and normal per cluster, in double so the sums don't depend on magnitude
+		struct ClusterInfo
+		{
+			double centroid[3];
+			double normal[3];
+			double area;
+		};
+		vector<ClusterInfo> infos(clusterCount, ClusterInfo{});
+		double meshCentroid[3] = {};
+		double meshArea = 0.0;
+
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			ClusterInfo& info = infos[c];
+			for (uint32_t tri = softClusters[c]; tri < softClusters[c + 1]; ++tri)
+			{
+				const Float3 p0 = GetPosition(positions, positionStride, indices[tri * 3 + 0]);
+				const Float3 p1 = GetPosition(positions, positionStride, indices[tri * 3 + 1]);
+				const Float3 p2 = GetPosition(positions, positionStride, indices[tri * 3 + 2]);
+
+				const double e0[3] = { (double)p1.x - p0.x, (double)p1.y - p0.y, (double)p1.z - p0.z };
+				const double e1[3] = { (double)p2.x - p0.x, (double)p2.y - p0.y, (double)p2.z - p0.z };
+				const double n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+				const double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+				const double center[3] = { ((double)p0.x + p1.x + p2.x) / 3.0, ((double)p0.y + p1.y + p2.y) / 3.0, ((double)p0.z + p1.z + p2.z) / 3.0 };
+
+				for (int i = 0; i < 3; ++i)
+				{
+					info.centroid[i] += center[i] * area;
+					info.normal[i] += n[i];
+				}
+				info.area += area;
+			}
+
+			for (int i = 0; i < 3; ++i)
+				meshCentroid[i] += info.centroid[i];
+			meshArea += info.area;
+
+			if (info.area > 0.0)
+			{
+				for (int i = 0; i < 3; ++i)
+					info.centroid[i] /= info.area;
+			}
+			const double length = std::sqrt(info.normal[0] * info.normal[0] + info.normal[1] * info.normal[1] + info.normal[2] * info.normal[2]);
+			if (length > 0.0)
+			{
+				for (int i = 0; i < 3; ++i)
+					info.normal[i] /= length;
+			}
+		}
+
+		if (meshArea > 0.0)
+		{
+			for (int i = 0; i < 3; ++i)
+				meshCentroid[i] /= meshArea;
+		}
+
+		// The winding convention decides whether the normals point outwards.
+		// For outwards facing normals the area weighted sum below is positive (it's proportional to the enclosed volume).
+		double orientation = 0.0;
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			const ClusterInfo& info = infos[c];
+			for (int i = 0; i < 3; ++i)
+				orientation += (info.centroid[i] - meshCentroid[i]) * info.normal[i] * info.area;
+		}
+		const double sign = orientation < 0.0 ? -1.0 : 1.0;
+
+		// Clusters on the outside, facing away from the center, are likely to occlude the rest
+		vector<double> sortKeys(clusterCount);
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			const ClusterInfo& info = infos[c];
+			double key = 0.0;
+			for (int i = 0; i < 3; ++i)
+				key += (info.centroid[i] - meshCentroid[i]) * info.normal[i];
+			sortKeys[c] = key * sign;
+		}
+
+		vector<uint32_t> order(clusterCount);
+		for (uint32_t c = 0; c < clusterCount; ++c)
+			order[c] = c;
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		vector<Index> output;
+		output.reserve(triangleCount * 3);
+		for (uint32_t c : order)
+			output.insert(output.end(), indices + softClusters[c] * 3, indices + softClusters[c + 1] * 3);
+		memcpy(indices, output.data(), output.size() * sizeof(Index));
+	}
+
+	template<typename Index>
+	void RemapVerticesInUseOrder(void* vertices, size_t vertexStride, size_t vertexCount, Index* indices, size_t indexCount)
+	{
+		vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		uint32_t nextVertex = 0;
+		for (size_t i = 0; i < indexCount; ++i)
+		{
+			uint32_t& target = remap[indices[i]];
+			if (target == UINT32_MAX)
+				target = nextVertex++;
+			indices[i] = (Index)target;
+		}
+		for (size_t v = 0; v < vertexCount; ++v)
+		{
+			if (remap[v] == UINT32_MAX)
+				remap[v] = nextVertex++;
+		}
+
+		vector<uint8_t> source((const uint8_t*)vertices, (const uint8_t*)vertices + vertexCount * vertexStride);
+		for (size_t v = 0; v < vertexCount; ++v)
+			memcpy((uint8_t*)vertices + remap[v] * vertexStride, &source[v * vertexStride], vertexStride);
+	}
+}
+
+SMeshOptimizer::VertexCacheStatistics SMeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+{
+	return SimulateFIFOCache(indices, indexCount, vertexCount, cacheSize);
+}
+
+SMeshOptimizer::VertexCacheStatistics SMeshOptimizer::AnalyzeVertexCache(const uint16_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+{
+	return SimulateFIFOCache(indices, indexCount, vertexCount, cacheSize);
+}
+
+void SMeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, vector<uint32_t>* outClusters)
+{
+	Tipsify(indices, indexCount, vertexCount, outClusters);
+}
+
+void SMeshOptimizer::OptimizeVertexCache(uint16_t* indices, size_t indexCount, size_t vertexCount, vector<uint32_t>* outClusters)
+{
+	Tipsify(indices, indexCount, vertexCount, outClusters);
+}
+
+void SMeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride, size_t vertexCount,
+	const vector<uint32_t>& clusters, float threshold)
+{
+	SortClustersForOverdraw(indices, indexCount, positions, positionStride, vertexCount, clusters, threshold);
+}
+
+void SMeshOptimizer::OptimizeOverdraw(uint16_t* indices, size_t indexCount, const float* positions, size_t positionStride, size_t vertexCount,
+	const vector<uint32_t>& clusters, float threshold)
+{
+	SortClustersForOverdraw(indices, indexCount, positions, positionStride, vertexCount, clusters, threshold);
+}
+
+void SMeshOptimizer::OptimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, uint32_t* indices, size_t indexCount)
+{
+	RemapVerticesInUseOrder(vertices, vertexStride, vertexCount, indices, indexCount);
+}
+
+void SMeshOptimizer::OptimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, uint16_t* indices, size_t indexCount)
+{
+	RemapVerticesInUseOrder(vertices, vertexStride, vertexCount, indices, indexCount);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Index and vertex order optimizations for a single mesh section.
+//
+// All functions work on section-local indices (0 .. vertexCount-1) and plain arrays,
+// so they have no D3D dependency and produce the same output on every platform.
+// Each takes 32 or 16 bit indices, the latter for meshes kept in 16 bits from the loader to the index buffer.
+namespace SMeshOptimizer
+{
+	// FIFO cache size used for both optimization and analysis
+	constexpr uint32_t VERTEX_CACHE_SIZE = 16;
+
+	// Default for OptimizeOverdraw: clusters may be split as long as their ACMR grows by at most 5%
+	constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+	struct VertexCacheStatistics
+	{
+		uint32_t vertexCount;       // Vertices referenced by the indices
+		uint32_t triangleCount;
+		uint32_t vertexTransforms;  // Cache misses
+		float acmr;                 // Average cache miss ratio: transforms per triangle (0.5 - 3)
+		float atvr;                 // Average transform to vertex ratio: transforms per vertex (1 is optimal)
+	};
+
+	// Simulates a FIFO post-transform cache of [cacheSize] entries.
+	VertexCacheStatistics AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+	VertexCacheStatistics AnalyzeVertexCache(const uint16_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+	// Tipsify (Sander et al. 2007) triangle reordering for the post-transform cache.
+	// If [outClusters] is given, it receives the first index of every cluster that starts at a
+	// dead end of the traversal, which OptimizeOverdraw uses as its starting partition.
+	void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, std::vector<uint32_t>* outClusters = nullptr);
+	void OptimizeVertexCache(uint16_t* indices, size_t indexCount, size_t vertexCount, std::vector<uint32_t>* outClusters = nullptr);
+
+	// Reorders the clusters of a vertex cache optimized index buffer so that triangles likely to
+	// occlude others are drawn first. The view-independent heuristic sorts clusters by how far they
+	// face away from the mesh centroid. Clusters are split further while their ACMR stays within
+	// [threshold] of the original, so vertex cache efficiency is mostly preserved.
+	// [positions] points at the first vertex position (3 floats), [positionStride] is in bytes.
+	void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride, size_t vertexCount,
+		const std::vector<uint32_t>& clusters, float threshold = OVERDRAW_THRESHOLD);
+	void OptimizeOverdraw(uint16_t* indices, size_t indexCount, const float* positions, size_t positionStride, size_t vertexCount,
+		const std::vector<uint32_t>& clusters, float threshold = OVERDRAW_THRESHOLD);
+
+	// Reorders the vertices in order of first use and remaps the indices to match.
+	// Unreferenced vertices keep their relative order after the referenced ones.
+	void OptimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, uint32_t* indices, size_t indexCount);
+	void OptimizeVertexFetch(void* vertices, size_t vertexStride, size_t vertexCount, uint16_t* indices, size_t indexCount);
+}
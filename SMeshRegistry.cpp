@@ -0,0 +1,55 @@
+#include "stdafx.h"
+#include "SMeshRegistry.h"
+
+#include "HelperFunctions.h"
+#include "SMeshCache.h"
+
+std::shared_ptr<SMesh> SMeshRegistry::Load(const char* filename, bool packedVertices, ID3D12Device* device, ID3D12GraphicsCommandList* cmdList)
+{
+	const uint64_t sourceHash = SMeshCache::HashSource(filename);
+	if (sourceHash == 0)
+		throw std::runtime_error(string_format("SMeshRegistry: can't read %s", filename));
+
+	Entry& entry = m_entries[std::make_pair(sourceHash, packedVertices)];
+	if (std::shared_ptr<SMesh> mesh = entry.mesh.lock())
+	{
+		OutputDebugStringA(string_format("SMeshRegistry: %s shares the mesh of %s\n", filename, entry.path.c_str()).c_str());
+		return mesh;
+	}
+
+	auto mesh = std::make_shared<SMesh>();
+	mesh->Load(filename);
+	mesh->SetPackedVertices(packedVertices);
+	mesh->CopyToUploadHeap(device, cmdList);
+	mesh->ReleaseCPUData();
+
+	entry.path = filename;
+	entry.mesh = mesh;
+	return mesh;
+}
+
+void SMeshRegistry::ReleaseUploadHeaps()
+{
+	for (auto it = m_entries.begin(); it != m_entries.end();)
+	{
+		if (std::shared_ptr<SMesh> mesh = it->second.mesh.lock())
+		{
+			mesh->ReleaseUploadHeaps();
+			++it;
+		}
+		else
+		{
+			it = m_entries.erase(it);
+		}
+	}
+}
+
+size_t SMeshRegistry::size() const
+{
+	size_t count = 0;
+	for (const auto& entry : m_entries)
+	{
+		count += entry.second.mesh.expired() ? 0 : 1;
+	}
+	return count;
+}
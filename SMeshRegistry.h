@@ -0,0 +1,37 @@
+#pragma once
+
+#include "SMesh.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+// Content addressed store of uploaded meshes.
+//
+// Meshes are keyed by the hash of their source (SMeshCache::HashSource, a .gltf with its buffers) and the
+// vertex format, so loading the same file again, or an identical copy under another path, returns the SMesh
+// that is already on the GPU instead of parsing and uploading it once more. The registry only holds weak references:
+// a mesh is freed once the last SMeshInstance using it is gone.
+class SMeshRegistry
+{
+private:
+	struct Entry
+	{
+		std::string path;  // First path the mesh was loaded from
+		std::weak_ptr<SMesh> mesh;
+	};
+
+	// (source hash, packed vertices)
+	std::map<std::pair<uint64_t, bool>, Entry> m_entries;
+
+public:
+	// Returns the shared mesh of [filename], loading it (see SMesh::Load), uploading it with [cmdList]
+	// and releasing its CPU data on first use. Upload heaps stay alive until ReleaseUploadHeaps().
+	std::shared_ptr<SMesh> Load(const char* filename, bool packedVertices, ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+
+	// Call once the command lists recorded by Load have finished executing
+	void ReleaseUploadHeaps();
+
+	// Number of distinct meshes that are still in use
+	size_t size() const;
+};
@@ -0,0 +1,400 @@
+#include "SMeshSimplifier.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	struct Float3
+	{
+		float x, y, z;
+	};
+
+	inline Float3 GetVector(const float* data, size_t stride, uint32_t v)
+	{
+		const float* p = (const float*)((const uint8_t*)data + v * stride);
+		return Float3{ p[0], p[1], p[2] };
+	}
+
+	inline Float3 Sub(const Float3& a, const Float3& b) { return Float3{ a.x - b.x, a.y - b.y, a.z - b.z }; }
+	inline Float3 Cross(const Float3& a, const Float3& b) { return Float3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+	inline float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+	// Symmetric 4x4 quadric, the sum of w * (n.p + d)^2 over the planes it was built from
+	struct Quadric
+	{
+		double a00, a11, a22, a01, a02, a12;
+		double b0, b1, b2;
+		double c;
+		double w;
+	};
+
+	// [normal] doesn't have to be normalized, the plane is scaled to unit length
+	void AddPlane(Quadric& q, const Float3& normal, const Float3& point, double weight)
+	{
+		const double length = std::sqrt((double)Dot(normal, normal));
+		if (length <= 0.0)
+			return;
+
+		const double nx = normal.x / length;
+		const double ny = normal.y / length;
+		const double nz = normal.z / length;
+		const double d = -(nx * point.x + ny * point.y + nz * point.z);
+
+		q.a00 += weight * nx * nx;
+		q.a11 += weight * ny * ny;
+		q.a22 += weight * nz * nz;
+		q.a01 += weight * nx * ny;
+		q.a02 += weight * nx * nz;
+		q.a12 += weight * ny * nz;
+		q.b0 += weight * nx * d;
+		q.b1 += weight * ny * d;
+		q.b2 += weight * nz * d;
+		q.c += weight * d * d;
+		q.w += weight;
+	}
+
+	void AddQuadric(Quadric& q, const Quadric& r)
+	{
+		q.a00 += r.a00;
+		q.a11 += r.a11;
+		q.a22 += r.a22;
+		q.a01 += r.a01;
+		q.a02 += r.a02;
+		q.a12 += r.a12;
+		q.b0 += r.b0;
+		q.b1 += r.b1;
+		q.b2 += r.b2;
+		q.c += r.c;
+		q.w += r.w;
+	}
+
+	// Weighted mean of the squared distances from [p] to the planes of [q]
+	double Evaluate(const Quadric& q, const Float3& p)
+	{
+		const double x = p.x, y = p.y, z = p.z;
+		const double e = q.a00 * x * x + q.a11 * y * y + q.a22 * z * z
+			+ 2.0 * (q.a01 * x * y + q.a02 * x * z + q.a12 * y * z)
+			+ 2.0 * (q.b0 * x + q.b1 * y + q.b2 * z)
+			+ q.c;
+		return q.w > 0.0 ? std::max(e, 0.0) / q.w : 0.0;
+	}
+
+	enum VertexKind : uint8_t
+	{
+		KIND_MANIFOLD,  // Interior vertex, can collapse onto any unlocked neighbour
+		KIND_BORDER,    // On an open border, can only collapse along it
+		KIND_LOCKED     // Seam, non-manifold or bowtie vertex
+	};
+
+	// Triangles around each vertex, in compressed row form
+	struct VertexTriangles
+	{
+		vector<uint32_t> offsets;
+		vector<uint32_t> triangles;
+	};
+
+	void BuildVertexTriangles(const vector<uint32_t>& indices, size_t vertexCount, VertexTriangles& out)
+	{
+		out.offsets.assign(vertexCount + 1, 0);
+		for (uint32_t v : indices)
+			out.offsets[v + 1]++;
+		for (size_t v = 0; v < vertexCount; ++v)
+			out.offsets[v + 1] += out.offsets[v];
+
+		vector<uint32_t> fill(out.offsets.begin(), out.offsets.end() - 1);
+		out.triangles.resize(indices.size());
+		for (size_t i = 0; i < indices.size(); ++i)
+			out.triangles[fill[indices[i]]++] = (uint32_t)(i / 3);
+	}
+
+	// Number of triangles with the directed edge a -> b
+	uint32_t CountEdge(const VertexTriangles& adjacency, const vector<uint32_t>& indices, uint32_t a, uint32_t b)
+	{
+		uint32_t count = 0;
+		for (uint32_t s = adjacency.offsets[a]; s < adjacency.offsets[a + 1]; ++s)
+		{
+			const uint32_t* tri = &indices[adjacency.triangles[s] * 3];
+			count += (tri[0] == a && tri[1] == b) || (tri[1] == a && tri[2] == b) || (tri[2] == a && tri[0] == b);
+		}
+		return count;
+	}
+
+	// Vertices that share their position with another vertex carry an attribute seam
+	void LockSeams(const vector<Float3>& positions, vector<uint8_t>& outSeam)
+	{
+		const uint32_t vertexCount = (uint32_t)positions.size();
+		vector<uint32_t> order(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			order[v] = v;
+
+		auto less = [&](uint32_t a, uint32_t b)
+		{
+			const Float3& pa = positions[a];
+			const Float3& pb = positions[b];
+			if (pa.x != pb.x) return pa.x < pb.x;
+			if (pa.y != pb.y) return pa.y < pb.y;
+			return pa.z < pb.z;
+		};
+		std::sort(order.begin(), order.end(), less);
+
+		outSeam.assign(vertexCount, 0);
+		for (uint32_t i = 1; i < vertexCount; ++i)
+		{
+			if (!less(order[i - 1], order[i]))
+			{
+				outSeam[order[i - 1]] = 1;
+				outSeam[order[i]] = 1;
+			}
+		}
+	}
+
+	struct Collapse
+	{
+		uint32_t vertex;
+		uint32_t target;
+		double cost;
+	};
+
+	// Collapses edges of the triangles in [result] until it holds [targetIndexCount] indices or the next collapse costs more
+	// than [targetError]. Returns the largest error of the collapses done.
+	double SimplifyTriangles(vector<uint32_t>& result, const float* positions, const float* normals, size_t vertexStride, size_t vertexCount,
+		size_t targetIndexCount, float targetError)
+	{
+		double maxError = 0.0;
+
+		vector<Float3> vertexPositions(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			vertexPositions[v] = GetVector(positions, vertexStride, v);
+
+		vector<uint8_t> seam;
+		LockSeams(vertexPositions, seam);
+
+		VertexTriangles adjacency;
+		BuildVertexTriangles(result, vertexCount, adjacency);
+
+		// Quadrics of the input: area weighted triangle planes, plus planes perpendicular to open borders
+		vector<Quadric> quadrics(vertexCount, Quadric{});
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			const uint32_t tri[3] = { result[i], result[i + 1], result[i + 2] };
+			const Float3& p0 = vertexPositions[tri[0]];
+			const Float3 normal = Cross(Sub(vertexPositions[tri[1]], p0), Sub(vertexPositions[tri[2]], p0));
+			const double area = 0.5 * std::sqrt((double)Dot(normal, normal));
+			for (uint32_t c = 0; c < 3; ++c)
+				AddPlane(quadrics[tri[c]], normal, p0, area);
+
+			for (uint32_t e = 0; e < 3; ++e)
+			{
+				const uint32_t a = tri[e];
+				const uint32_t b = tri[(e + 1) % 3];
+				if (CountEdge(adjacency, result, b, a) > 0)
+					continue;
+
+				const Float3 edge = Sub(vertexPositions[b], vertexPositions[a]);
+				const Float3 borderNormal = Cross(edge, normal);
+				const double weight = SMeshSimplifier::BORDER_WEIGHT * Dot(edge, edge);
+				AddPlane(quadrics[a], borderNormal, vertexPositions[a], weight);
+				AddPlane(quadrics[b], borderNormal, vertexPositions[a], weight);
+			}
+		}
+
+		vector<uint8_t> kind(vertexCount);
+		vector<uint8_t> openEdges(vertexCount);
+		vector<uint32_t> bestTarget(vertexCount);
+		vector<double> bestCost(vertexCount);
+		vector<uint32_t> collapse(vertexCount);
+		vector<uint8_t> touched(vertexCount);
+		vector<Collapse> candidates;
+
+		while (result.size() > targetIndexCount)
+		{
+			const size_t triangleCount = result.size() / 3;
+			BuildVertexTriangles(result, vertexCount, adjacency);
+
+			// Classify vertices against the current connectivity
+			for (uint32_t v = 0; v < vertexCount; ++v)
+				kind[v] = seam[v] ? KIND_LOCKED : KIND_MANIFOLD;
+			std::fill(openEdges.begin(), openEdges.end(), (uint8_t)0);
+			for (size_t i = 0; i < result.size(); ++i)
+			{
+				const uint32_t a = result[i];
+				const uint32_t b = result[i - i % 3 + (i + 1) % 3];
+				if (CountEdge(adjacency, result, a, b) > 1)
+				{
+					kind[a] = kind[b] = KIND_LOCKED;
+				}
+				else if (CountEdge(adjacency, result, b, a) == 0)
+				{
+					openEdges[a] = (uint8_t)std::min(openEdges[a] + 1, 255);
+					openEdges[b] = (uint8_t)std::min(openEdges[b] + 1, 255);
+				}
+			}
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				if (kind[v] != KIND_LOCKED && openEdges[v] > 0)
+					kind[v] = openEdges[v] == 2 ? KIND_BORDER : KIND_LOCKED;
+			}
+
+			// Cheapest collapse of every vertex
+			std::fill(bestTarget.begin(), bestTarget.end(), UINT32_MAX);
+			std::fill(bestCost.begin(), bestCost.end(), DBL_MAX);
+			auto consider = [&](uint32_t v, uint32_t t)
+			{
+				if (kind[v] == KIND_LOCKED || kind[t] == KIND_LOCKED)
+					return;
+				if (kind[v] == KIND_BORDER && (kind[t] != KIND_BORDER || (CountEdge(adjacency, result, v, t) > 0) == (CountEdge(adjacency, result, t, v) > 0)))
+					return;
+
+				const Float3& pt = vertexPositions[t];
+				double cost = Evaluate(quadrics[v], pt);
+				if (normals)
+				{
+					const Float3 edge = Sub(pt, vertexPositions[v]);
+					const float deviation = 1.0f - Dot(GetVector(normals, vertexStride, v), GetVector(normals, vertexStride, t));
+					cost += (double)SMeshSimplifier::NORMAL_WEIGHT * SMeshSimplifier::NORMAL_WEIGHT * Dot(edge, edge) * std::max(deviation, 0.0f);
+				}
+				if (cost < bestCost[v])
+				{
+					bestCost[v] = cost;
+					bestTarget[v] = t;
+				}
+			};
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (uint32_t e = 0; e < 3; ++e)
+				{
+					const uint32_t a = result[i + e];
+					const uint32_t b = result[i + (e + 1) % 3];
+					consider(a, b);
+					consider(b, a);
+				}
+			}
+
+			candidates.clear();
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				if (bestTarget[v] != UINT32_MAX)
+					candidates.push_back(Collapse{ v, bestTarget[v], bestCost[v] });
+			}
+			std::sort(candidates.begin(), candidates.end(), [](const Collapse& a, const Collapse& b)
+			{
+				return a.cost < b.cost || (a.cost == b.cost && a.vertex < b.vertex);
+			});
+
+			// Apply the cheapest collapses whose neighbourhoods don't overlap
+			for (uint32_t v = 0; v < vertexCount; ++v)
+				collapse[v] = v;
+			std::fill(touched.begin(), touched.end(), (uint8_t)0);
+
+			const double errorLimit = (double)targetError * targetError;
+			size_t remainingTriangles = triangleCount;
+			size_t applied = 0;
+			for (const Collapse& candidate : candidates)
+			{
+				if (remainingTriangles * 3 <= targetIndexCount || candidate.cost > errorLimit)
+					break;
+
+				const uint32_t v = candidate.vertex;
+				const uint32_t t = candidate.target;
+				if (touched[v] || touched[t])
+					continue;
+
+				// Reject collapses that flip or degenerate a triangle that survives them
+				bool flips = false;
+				size_t removed = 0;
+				for (uint32_t s = adjacency.offsets[v]; s < adjacency.offsets[v + 1] && !flips; ++s)
+				{
+					const uint32_t* tri = &result[adjacency.triangles[s] * 3];
+					if (tri[0] == t || tri[1] == t || tri[2] == t)
+					{
+						removed++;
+						continue;
+					}
+
+					Float3 p[3], q[3];
+					Float3 shadingNormal = {};
+					for (uint32_t c = 0; c < 3; ++c)
+					{
+						p[c] = vertexPositions[tri[c]];
+						q[c] = tri[c] == v ? vertexPositions[t] : p[c];
+						if (normals)
+						{
+							const Float3 n = GetVector(normals, vertexStride, tri[c] == v ? t : tri[c]);
+							shadingNormal = Float3{ shadingNormal.x + n.x, shadingNormal.y + n.y, shadingNormal.z + n.z };
+						}
+					}
+					const Float3 before = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+					const Float3 after = Cross(Sub(q[1], q[0]), Sub(q[2], q[0]));
+					// Either winding order: the triangle has to stay on the side of its vertex normals it started on
+					flips = Dot(before, after) <= 0.0f || (normals && Dot(before, shadingNormal) * Dot(after, shadingNormal) <= 0.0f);
+				}
+				if (flips)
+					continue;
+
+				collapse[v] = t;
+				AddQuadric(quadrics[t], quadrics[v]);
+				maxError = std::max(maxError, candidate.cost);
+				for (uint32_t s = adjacency.offsets[v]; s < adjacency.offsets[v + 1]; ++s)
+				{
+					const uint32_t* tri = &result[adjacency.triangles[s] * 3];
+					touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+				}
+				remainingTriangles -= std::min(removed, remainingTriangles);
+				applied++;
+			}
+
+			if (applied == 0)
+				break;
+
+			// Remap and drop the triangles that collapsed
+			size_t write = 0;
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				const uint32_t a = collapse[result[i]];
+				const uint32_t b = collapse[result[i + 1]];
+				const uint32_t c = collapse[result[i + 2]];
+				if (a == b || b == c || c == a)
+					continue;
+
+				result[write++] = a;
+				result[write++] = b;
+				result[write++] = c;
+			}
+			result.resize(write);
+		}
+
+		return std::sqrt(maxError);
+	}
+}
+
+size_t SMeshSimplifier::Simplify(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+	const float* positions, const float* normals, size_t vertexStride, size_t vertexCount,
+	size_t targetIndexCount, float targetError, float* outError)
+{
+	vector<uint32_t> result(indices, indices + indexCount - indexCount % 3);
+	const double error = SimplifyTriangles(result, positions, normals, vertexStride, vertexCount, targetIndexCount, targetError);
+	if (!result.empty())
+		memcpy(destination, result.data(), result.size() * sizeof(uint32_t));
+	if (outError)
+		*outError = (float)error;
+	return result.size();
+}
+
+size_t SMeshSimplifier::Simplify(uint16_t* destination, const uint16_t* indices, size_t indexCount,
+	const float* positions, const float* normals, size_t vertexStride, size_t vertexCount,
+	size_t targetIndexCount, float targetError, float* outError)
+{
+	vector<uint32_t> result(indices, indices + indexCount - indexCount % 3);
+	const double error = SimplifyTriangles(result, positions, normals, vertexStride, vertexCount, targetIndexCount, targetError);
+	for (size_t i = 0; i < result.size(); ++i)
+		destination[i] = (uint16_t)result[i];
+	if (outError)
+		*outError = (float)error;
+	return result.size();
+}
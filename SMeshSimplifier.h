@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Quadric error metric (Garland & Heckbert 1997) edge collapse simplification of a single mesh section.
+//
+// Vertices are only ever collapsed onto one of their neighbours, so the result indexes the original
+// vertex buffer and every LOD of a section can share it. Like SMeshOptimizer, indices are section-local
+// and there is no D3D dependency.
+namespace SMeshSimplifier
+{
+	// Weight of the planes that keep open borders in place, relative to the triangle planes
+	constexpr float BORDER_WEIGHT = 10.0f;
+
+	// Weight of the normal deviation term: a collapse between vertices whose normals differ by
+	// 90 degrees costs as much as moving a vertex by NORMAL_WEIGHT times the edge length.
+	constexpr float NORMAL_WEIGHT = 0.5f;
+
+	// Writes a simplified version of [indices] with at most about [targetIndexCount] indices to [destination]
+	// (which must hold [indexCount] indices) and returns the number of indices written. Stops early when no
+	// collapse stays below [targetError] (object space distance) or none is left.
+	//
+	// Vertices sharing a position with another vertex (UV or normal seams) and non-manifold vertices are locked,
+	// open border vertices only slide along their border. Collapses that would flip a triangle, or with [normals],
+	// turn it to the other side of its vertex normals, are rejected. Both winding orders work.
+	// [positions] and [normals] (optional) point at the first vertex's 3 floats, [vertexStride] is in bytes.
+	// [outError] receives the largest error of any collapse, as an object space distance.
+	size_t Simplify(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+		const float* positions, const float* normals, size_t vertexStride, size_t vertexCount,
+		size_t targetIndexCount, float targetError, float* outError = nullptr);
+	// Same for 16 bit indices
+	size_t Simplify(uint16_t* destination, const uint16_t* indices, size_t indexCount,
+		const float* positions, const float* normals, size_t vertexStride, size_t vertexCount,
+		size_t targetIndexCount, float targetError, float* outError = nullptr);
+}
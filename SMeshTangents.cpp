@@ -0,0 +1,252 @@
+#include "SMeshTangents.h"
+
+#include "ParallelFor.h"
+
+#include <cassert>
+#include <cmath>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Triangles or vertices per ParallelFor item
+	constexpr uint32_t BLOCK_SIZE = 16 * 1024;
+
+	// Below this squared length a vector counts as zero
+	constexpr float EPSILON_SQ = 1e-20f;
+
+	// Triangles of all sections with mesh-wide vertex indices, and the corners around every vertex
+	struct MeshTopology
+	{
+		vector<uint32_t> corners;        // 3 vertex indices per triangle
+		vector<uint32_t> vertexOffsets;  // Corners of vertex v are vertexCorners[vertexOffsets[v] .. vertexOffsets[v + 1])
+		vector<uint32_t> vertexCorners;  // triangle * 3 + corner
+	};
+
+	struct FaceData
+	{
+		XMFLOAT3 normal;     // Unnormalized, its length is twice the area
+		float angles[3];     // Corner angles
+		XMFLOAT3 tangent;    // UV gradients, oriented by the sign of the UV determinant. Zero for degenerate UVs.
+		XMFLOAT3 bitangent;
+	};
+
+	inline uint32_t BlockCount(size_t count)
+	{
+		return (uint32_t)((count + BLOCK_SIZE - 1) / BLOCK_SIZE);
+	}
+
+	template<typename Index>
+	void BuildTopology(size_t vertexCount, const Index* indices, const SMeshSection* sections, size_t sectionCount, MeshTopology& out)
+	{
+		vector<size_t> firstTriangle(sectionCount + 1, 0);
+		for (size_t s = 0; s < sectionCount; ++s)
+			firstTriangle[s + 1] = firstTriangle[s] + sections[s].indexCount / 3;
+		const size_t triangleCount = firstTriangle[sectionCount];
+
+		out.corners.resize(triangleCount * 3);
+		ParallelFor(BlockCount(triangleCount), [&](uint32_t block)
+		{
+			const size_t begin = (size_t)block * BLOCK_SIZE;
+			const size_t end = std::min(triangleCount, begin + BLOCK_SIZE);
+			size_t s = std::upper_bound(firstTriangle.begin(), firstTriangle.end(), begin) - firstTriangle.begin() - 1;
+			for (size_t t = begin; t < end; ++t)
+			{
+				while (t >= firstTriangle[s + 1])
+					++s;
+
+				const SMeshSection& section = sections[s];
+				const Index* tri = indices + section.startIndexLocation + (t - firstTriangle[s]) * 3;
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					assert(section.baseVertexLocation + tri[c] < vertexCount);
+					out.corners[t * 3 + c] = section.baseVertexLocation + tri[c];
+				}
+			}
+		});
+
+		// Counting sort of the corners by vertex
+		out.vertexOffsets.assign(vertexCount + 1, 0);
+		for (uint32_t v : out.corners)
+			out.vertexOffsets[v + 1]++;
+		for (size_t v = 0; v < vertexCount; ++v)
+			out.vertexOffsets[v + 1] += out.vertexOffsets[v];
+
+		vector<uint32_t> fill(out.vertexOffsets.begin(), out.vertexOffsets.end() - 1);
+		out.vertexCorners.resize(out.corners.size());
+		for (size_t i = 0; i < out.corners.size(); ++i)
+			out.vertexCorners[fill[out.corners[i]]++] = (uint32_t)i;
+	}
+
+	void ComputeFaces(const SVertex* vertices, const MeshTopology& topology, bool computeTangents, vector<FaceData>& out)
+	{
+		const size_t triangleCount = topology.corners.size() / 3;
+		out.resize(triangleCount);
+		ParallelFor(BlockCount(triangleCount), [&](uint32_t block)
+		{
+			const size_t end = std::min(triangleCount, ((size_t)block + 1) * BLOCK_SIZE);
+			for (size_t t = (size_t)block * BLOCK_SIZE; t < end; ++t)
+			{
+				const SVertex* v[3];
+				XMVECTOR p[3];
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					v[c] = &vertices[topology.corners[t * 3 + c]];
+					p[c] = XMLoadFloat3(&v[c]->position);
+				}
+
+				FaceData& face = out[t];
+				XMVECTOR e0 = XMVectorSubtract(p[1], p[0]);
+				XMVECTOR e1 = XMVectorSubtract(p[2], p[0]);
+				XMStoreFloat3(&face.normal, XMVector3Cross(e0, e1));
+
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					XMVECTOR a = XMVectorSubtract(p[(c + 1) % 3], p[c]);
+					XMVECTOR b = XMVectorSubtract(p[(c + 2) % 3], p[c]);
+					const float lengthSq = XMVectorGetX(XMVector3LengthSq(a)) * XMVectorGetX(XMVector3LengthSq(b));
+					const float cosine = lengthSq > EPSILON_SQ ? XMVectorGetX(XMVector3Dot(a, b)) / std::sqrt(lengthSq) : 1.0f;
+					face.angles[c] = std::acos(std::min(std::max(cosine, -1.0f), 1.0f));
+				}
+
+				if (!computeTangents)
+					continue;
+
+				const float du0 = v[1]->uv.x - v[0]->uv.x;
+				const float dv0 = v[1]->uv.y - v[0]->uv.y;
+				const float du1 = v[2]->uv.x - v[0]->uv.x;
+				const float dv1 = v[2]->uv.y - v[0]->uv.y;
+				const float det = du0 * dv1 - du1 * dv0;
+				if (det == 0.0f)
+				{
+					face.tangent = face.bitangent = XMFLOAT3(0.0f, 0.0f, 0.0f);
+					continue;
+				}
+
+				// Only the direction matters, every corner normalizes its projection
+				const float sign = det < 0.0f ? -1.0f : 1.0f;
+				XMStoreFloat3(&face.tangent, XMVectorScale(XMVectorSubtract(XMVectorScale(e0, dv1), XMVectorScale(e1, dv0)), sign));
+				XMStoreFloat3(&face.bitangent, XMVectorScale(XMVectorSubtract(XMVectorScale(e1, du0), XMVectorScale(e0, du1)), sign));
+			}
+		});
+	}
+
+	// [v] projected onto the plane of the unit vector [n]
+	inline XMVECTOR XM_CALLCONV ProjectOntoPlane(FXMVECTOR v, FXMVECTOR n)
+	{
+		return XMVectorSubtract(v, XMVectorMultiply(n, XMVector3Dot(n, v)));
+	}
+
+	inline bool XM_CALLCONV IsZero(FXMVECTOR v)
+	{
+		return XMVectorGetX(XMVector3LengthSq(v)) <= EPSILON_SQ;
+	}
+
+	void SmoothNormals(SVertex* vertices, size_t vertexCount, const MeshTopology& topology)
+	{
+		vector<FaceData> faces;
+		ComputeFaces(vertices, topology, false, faces);
+
+		ParallelFor(BlockCount(vertexCount), [&](uint32_t block)
+		{
+			const size_t end = std::min(vertexCount, ((size_t)block + 1) * BLOCK_SIZE);
+			for (size_t v = (size_t)block * BLOCK_SIZE; v < end; ++v)
+			{
+				XMVECTOR normal = XMVectorZero();
+				for (uint32_t k = topology.vertexOffsets[v]; k < topology.vertexOffsets[v + 1]; ++k)
+				{
+					const uint32_t corner = topology.vertexCorners[k];
+					const FaceData& face = faces[corner / 3];
+					normal = XMVectorAdd(normal, XMVectorScale(XMLoadFloat3(&face.normal), face.angles[corner % 3]));
+				}
+
+				// Unreferenced vertices and vertices of degenerate triangles only keep their normal
+				if (!IsZero(normal))
+					XMStoreFloat3(&vertices[v].normal, XMVector3Normalize(normal));
+			}
+		});
+	}
+
+	void SmoothTangents(SVertex* vertices, size_t vertexCount, const MeshTopology& topology)
+	{
+		vector<FaceData> faces;
+		ComputeFaces(vertices, topology, true, faces);
+
+		ParallelFor(BlockCount(vertexCount), [&](uint32_t block)
+		{
+			const size_t end = std::min(vertexCount, ((size_t)block + 1) * BLOCK_SIZE);
+			for (size_t v = (size_t)block * BLOCK_SIZE; v < end; ++v)
+			{
+				if (topology.vertexOffsets[v] == topology.vertexOffsets[v + 1])
+					continue;
+
+				SVertex& vertex = vertices[v];
+				XMVECTOR normal = XMLoadFloat3(&vertex.normal);
+				if (IsZero(normal))
+					continue;
+				normal = XMVector3Normalize(normal);
+
+				XMVECTOR tangent = XMVectorZero();
+				XMVECTOR bitangent = XMVectorZero();
+				for (uint32_t k = topology.vertexOffsets[v]; k < topology.vertexOffsets[v + 1]; ++k)
+				{
+					const uint32_t corner = topology.vertexCorners[k];
+					const FaceData& face = faces[corner / 3];
+					const float weight = face.angles[corner % 3];
+
+					XMVECTOR t = ProjectOntoPlane(XMLoadFloat3(&face.tangent), normal);
+					if (!IsZero(t))
+						tangent = XMVectorAdd(tangent, XMVectorScale(XMVector3Normalize(t), weight));
+
+					XMVECTOR b = ProjectOntoPlane(XMLoadFloat3(&face.bitangent), normal);
+					if (!IsZero(b))
+						bitangent = XMVectorAdd(bitangent, XMVectorScale(XMVector3Normalize(b), weight));
+				}
+
+				// Gram-Schmidt. Without usable UVs, any tangent perpendicular to the normal will do.
+				tangent = ProjectOntoPlane(tangent, normal);
+				if (IsZero(tangent))
+				{
+					XMVECTOR axis = std::fabs(XMVectorGetX(normal)) < 0.9f ? XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+					tangent = XMVector3Cross(normal, axis);
+				}
+				tangent = XMVector3Normalize(tangent);
+
+				XMVECTOR cross = XMVector3Cross(normal, tangent);
+				const float handedness = XMVectorGetX(XMVector3Dot(cross, bitangent)) < 0.0f ? -1.0f : 1.0f;
+
+				XMStoreFloat3(&vertex.tangent, tangent);
+				XMStoreFloat3(&vertex.bitangent, XMVectorScale(cross, handedness));
+			}
+		});
+	}
+}
+
+void SMeshTangents::GenerateNormals(SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	MeshTopology topology;
+	BuildTopology(vertexCount, indices, sections, sectionCount, topology);
+	SmoothNormals(vertices, vertexCount, topology);
+}
+
+void SMeshTangents::GenerateNormals(SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	MeshTopology topology;
+	BuildTopology(vertexCount, indices, sections, sectionCount, topology);
+	SmoothNormals(vertices, vertexCount, topology);
+}
+
+void SMeshTangents::GenerateTangents(SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	MeshTopology topology;
+	BuildTopology(vertexCount, indices, sections, sectionCount, topology);
+	SmoothTangents(vertices, vertexCount, topology);
+}
+
+void SMeshTangents::GenerateTangents(SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount)
+{
+	MeshTopology topology;
+	BuildTopology(vertexCount, indices, sections, sectionCount, topology);
+	SmoothTangents(vertices, vertexCount, topology);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "SMeshTypes.h"
+
+// Smooth vertex normals and tangent frames for all sections of a mesh.
+//
+// Every triangle contributes to each of its vertices weighted by the corner angle, on top of the
+// face area carried by the unnormalized face normal. Contributions are gathered per vertex
+// over all sections, so sections sharing vertices through their baseVertexLocation get one
+// consistent result. Face and vertex passes both run in parallel blocks without atomics.
+namespace SMeshTangents
+{
+	void GenerateNormals(SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount);
+	void GenerateNormals(SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount);
+
+	// Uses the existing normals. As in MikkTSpace, face tangents are projected onto the tangent plane
+	// of each vertex and normalized before they are angle weighted, and the result is orthonormalized
+	// against the normal (Gram-Schmidt). The bitangent is stored as cross(normal, tangent) times the
+	// handedness sign, so it only carries the sign on top of the normal and tangent.
+	void GenerateTangents(SVertex* vertices, size_t vertexCount, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount);
+	void GenerateTangents(SVertex* vertices, size_t vertexCount, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount);
+}
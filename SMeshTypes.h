@@ -0,0 +1,44 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+
+// CPU side mesh layout shared by SMesh and the mesh processing kernels, which do not depend on D3D12
+
+struct SVertex
+{
+	DirectX::XMFLOAT3 position;
+	DirectX::XMFLOAT2 uv;
+	DirectX::XMFLOAT3 normal;
+	DirectX::XMFLOAT3 tangent;
+	DirectX::XMFLOAT3 bitangent;
+};
+
+struct SMeshSection
+{
+	uint32_t indexCount;
+	uint32_t startIndexLocation;
+	uint32_t baseVertexLocation;
+};
+
+// Object space bounds of the vertices a section references
+struct SMeshSectionBounds
+{
+	DirectX::XMFLOAT3 center;   // Bounding sphere
+	float radius;
+	DirectX::XMFLOAT3 aabbMin;  // Axis aligned bounding box
+	DirectX::XMFLOAT3 aabbMax;
+};
+
+// One level of detail of a section. LOD 0 is the section itself, coarser levels index
+// the same vertices (relative to the section's baseVertexLocation).
+struct SMeshLOD
+{
+	uint32_t indexCount;
+	uint32_t startIndexLocation;
+	float error;  // Object space distance by which the surface may deviate from LOD 0
+};
+
+constexpr uint32_t MAX_LOD_COUNT = 5;
+constexpr float LOD_REDUCTION = 0.5f;     // Triangle count of a LOD relative to the previous one
+constexpr float LOD_ERROR_PIXELS = 1.0f;  // Largest acceptable projected LOD error
@@ -0,0 +1,177 @@
+#include "SMeshWeld.h"
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Open-addressing (linear probing) hash table keyed on an OBJ index tuple.
+	// Maps each distinct (position, uv, normal) tuple to the vertex emitted for it.
+	class VertexWeldTable
+	{
+	private:
+		struct Slot
+		{
+			tinyobj::index_t key;
+			uint32_t vertex;
+		};
+
+		static constexpr uint32_t EMPTY = UINT32_MAX;
+
+		vector<Slot> m_slots;
+		size_t m_mask;
+
+		static inline uint64_t Hash(const tinyobj::index_t& key)
+		{
+			// 64-bit finalizer from MurmurHash3 over the packed tuple.
+			uint64_t h = (uint64_t)(uint32_t)key.vertex_index * 0x9E3779B97F4A7C15ull;
+			h ^= (uint64_t)(uint32_t)key.texcoord_index * 0xC2B2AE3D27D4EB4Full;
+			h ^= (uint64_t)(uint32_t)key.normal_index * 0x165667B19E3779F9ull;
+			h ^= h >> 33;
+			h *= 0xFF51AFD7ED558CCDull;
+			h ^= h >> 33;
+			h *= 0xC4CEB9FE1A85EC53ull;
+			h ^= h >> 33;
+			return h;
+		}
+
+	public:
+		explicit VertexWeldTable(size_t expectedKeys)
+		{
+			// Keep the load factor at or below 0.5.
+			size_t capacity = 16;
+			while (capacity < expectedKeys * 2)
+				capacity <<= 1;
+			m_slots.resize(capacity, Slot{ { -1, -1, -1 }, EMPTY });
+			m_mask = capacity - 1;
+		}
+
+		// Returns true if [key] was not in the table, in which case it is mapped to [candidate].
+		// [outVertex] receives the vertex the key is mapped to.
+		inline bool FindOrInsert(const tinyobj::index_t& key, uint32_t candidate, uint32_t& outVertex)
+		{
+			size_t i = (size_t)Hash(key) & m_mask;
+			while (true)
+			{
+				Slot& slot = m_slots[i];
+				if (slot.vertex == EMPTY)
+				{
+					slot.key = key;
+					slot.vertex = candidate;
+					outVertex = candidate;
+					return true;
+				}
+				if (slot.key.vertex_index == key.vertex_index &&
+					slot.key.texcoord_index == key.texcoord_index &&
+					slot.key.normal_index == key.normal_index)
+				{
+					outVertex = slot.vertex;
+					return false;
+				}
+				i = (i + 1) & m_mask;
+			}
+		}
+	};
+
+	// Whether every attribute [corner] refers to exists. Negative uv and normal indices mean the corner has none.
+	inline bool IsValidCorner(const tinyobj::attrib_t& attrib, const tinyobj::index_t& corner)
+	{
+		return corner.vertex_index >= 0 && 3 * size_t(corner.vertex_index) + 2 < attrib.vertices.size() &&
+			(corner.texcoord_index < 0 || 2 * size_t(corner.texcoord_index) + 1 < attrib.texcoords.size()) &&
+			(corner.normal_index < 0 || 3 * size_t(corner.normal_index) + 2 < attrib.normals.size());
+	}
+}
+
+SMeshWeld::Statistics SMeshWeld::AppendOBJShapes(const tinyobj::attrib_t& attrib, const vector<tinyobj::shape_t>& shapes,
+	vector<SVertex>& vertices, vector<uint32_t>& indices, vector<SMeshSection>& sections)
+{
+	Statistics statistics = {};
+
+	// Loop over shapes
+	for (size_t s = 0; s < shapes.size(); s++) {
+
+		const tinyobj::mesh_t& mesh = shapes[s].mesh;
+
+		SMeshSection section = {};
+		section.baseVertexLocation = (uint32_t)vertices.size();
+		section.startIndexLocation = (uint32_t)indices.size();
+		indices.reserve(indices.size() + mesh.indices.size());
+
+		// Every face corner is a (position, uv, normal) tuple. Corners sharing the same tuple are the
+		// same vertex and are welded into one entry of [vertices].
+		VertexWeldTable weldTable(mesh.indices.size());
+		uint32_t sectionVertexCount = 0;
+		auto weld = [&](const tinyobj::index_t& idx)
+		{
+			uint32_t vertex;
+			if (!weldTable.FindOrInsert(idx, sectionVertexCount, vertex))
+			{
+				// Seen this tuple before, reuse the vertex.
+				return vertex;
+			}
+			++sectionVertexCount;
+
+			SVertex v = {};
+			v.position = XMFLOAT3(
+				attrib.vertices[3 * size_t(idx.vertex_index) + 0],
+				attrib.vertices[3 * size_t(idx.vertex_index) + 1],
+				attrib.vertices[3 * size_t(idx.vertex_index) + 2]);
+			if (idx.normal_index >= 0) {
+				v.normal = XMFLOAT3(
+					attrib.normals[3 * size_t(idx.normal_index) + 0],
+					attrib.normals[3 * size_t(idx.normal_index) + 1],
+					attrib.normals[3 * size_t(idx.normal_index) + 2]);
+			}
+			if (idx.texcoord_index >= 0) {
+				v.uv = XMFLOAT2(
+					attrib.texcoords[2 * size_t(idx.texcoord_index) + 0],
+					attrib.texcoords[2 * size_t(idx.texcoord_index) + 1]);
+			}
+			vertices.push_back(v);
+			return vertex;
+		};
+
+		// Loop over faces(polygon)
+		size_t index_offset = 0;
+		for (size_t f = 0; f < mesh.num_face_vertices.size(); f++) {
+
+			const size_t fv = size_t(mesh.num_face_vertices[f]);
+			const tinyobj::index_t* face = &mesh.indices[index_offset];
+			index_offset += fv;
+
+			bool valid = fv >= 3 && index_offset <= mesh.indices.size();
+			for (size_t v = 0; valid && v < fv; v++)
+				valid = IsValidCorner(attrib, face[v]);
+			if (!valid)
+			{
+				// Points, lines and corrupt faces have nothing to draw
+				++statistics.skippedFaceCount;
+				if (index_offset > mesh.indices.size())
+					break;
+				continue;
+			}
+			if (fv > 3)
+				++statistics.triangulatedFaceCount;
+
+			// Fan around the first corner, re-ordering each triangle to match DirectX 12's winding
+			const uint32_t first = weld(face[0]);
+			uint32_t previous = weld(face[1]);
+			for (size_t v = 2; v < fv; v++) {
+				const uint32_t current = weld(face[v]);
+				indices.push_back(first);
+				indices.push_back(current);
+				indices.push_back(previous);
+				previous = current;
+			}
+		}
+
+		section.indexCount = (uint32_t)(indices.size() - section.startIndexLocation);
+		statistics.cornerCount += section.indexCount;
+		statistics.vertexCount += sectionVertexCount;
+		statistics.triangleCount += section.indexCount / 3;
+		if (section.indexCount)
+			sections.push_back(section);
+	}
+
+	return statistics;
+}
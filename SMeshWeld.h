@@ -0,0 +1,28 @@
+#pragma once
+
+#include "SMeshTypes.h"
+#include "tiny_obj_loader.h"
+
+#include <cstddef>
+#include <vector>
+
+// Turns OBJ shapes, which index positions, uvs and normals separately, into indexed mesh sections.
+// Does not depend on D3D12, so it is shared by SMesh and the tests.
+namespace SMeshWeld
+{
+	struct Statistics
+	{
+		size_t cornerCount;            // Corners of the triangles written, the vertex count without welding
+		size_t vertexCount;            // Vertices after welding
+		size_t triangleCount;
+		size_t triangulatedFaceCount;  // Faces of more than 3 corners, split into fans
+		size_t skippedFaceCount;       // Faces of fewer than 3 corners, or with a corner out of range
+	};
+
+	// Appends a section per shape that has triangles to [sections], its vertices to [vertices] and its indices,
+	// relative to the section's baseVertexLocation, to [indices].
+	// Corners of a shape sharing the same (position, uv, normal) tuple are welded into one vertex. Faces of
+	// more than 3 corners are split into a fan around their first corner. Triangles are flipped to D3D's clockwise winding.
+	Statistics AppendOBJShapes(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::shape_t>& shapes,
+		std::vector<SVertex>& vertices, std::vector<uint32_t>& indices, std::vector<SMeshSection>& sections);
+}
@@ -0,0 +1,268 @@
+#include "SMeshlets.h"
+
+#include "ParallelFor.h"
+#include "SFrustumCulling.h"
+#include "SMeshTypes.h"
+
+#include <cmath>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Meshlet under construction
+	struct MeshletBuilder
+	{
+		vector<uint32_t> vertices;
+		vector<uint8_t> primitives;
+		uint32_t triangleOffset = 0;
+	};
+
+	template<typename T>
+	void Append(vector<T>& dst, const vector<T>& src)
+	{
+		dst.insert(dst.end(), src.begin(), src.end());
+	}
+
+	void EmitMeshlet(const MeshletBuilder& meshlet, const SVertex* vertices, SMeshletTable& out)
+	{
+		const uint32_t vertexCount = (uint32_t)meshlet.vertices.size();
+		const uint32_t triangleCount = (uint32_t)meshlet.primitives.size() / 3;
+
+		out.triangleOffset.push_back(meshlet.triangleOffset);
+		out.triangleCount.push_back((uint8_t)triangleCount);
+		out.vertexOffset.push_back((uint32_t)out.vertices.size());
+		out.vertexCount.push_back((uint8_t)vertexCount);
+		Append(out.vertices, meshlet.vertices);
+		Append(out.primitives, meshlet.primitives);
+
+		// AABB, and a sphere around its center
+		XMVECTOR vMin = XMLoadFloat3(&vertices[meshlet.vertices[0]].position);
+		XMVECTOR vMax = vMin;
+		for (uint32_t v : meshlet.vertices)
+		{
+			XMVECTOR p = XMLoadFloat3(&vertices[v].position);
+			vMin = XMVectorMin(vMin, p);
+			vMax = XMVectorMax(vMax, p);
+		}
+		XMVECTOR center = XMVectorScale(XMVectorAdd(vMin, vMax), 0.5f);
+		float radiusSq = 0.0f;
+		for (uint32_t v : meshlet.vertices)
+		{
+			radiusSq = std::max(radiusSq, XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&vertices[v].position), center))));
+		}
+
+		XMFLOAT3 aabbMin, aabbMax, c;
+		XMStoreFloat3(&aabbMin, vMin);
+		XMStoreFloat3(&aabbMax, vMax);
+		XMStoreFloat3(&c, center);
+		out.centerX.push_back(c.x);
+		out.centerY.push_back(c.y);
+		out.centerZ.push_back(c.z);
+		out.radius.push_back(std::sqrt(radiusSq));
+		out.aabbMinX.push_back(aabbMin.x);
+		out.aabbMinY.push_back(aabbMin.y);
+		out.aabbMinZ.push_back(aabbMin.z);
+		out.aabbMaxX.push_back(aabbMax.x);
+		out.aabbMaxY.push_back(aabbMax.y);
+		out.aabbMaxZ.push_back(aabbMax.z);
+
+		// Normal cone. Geometric normals are flipped to agree with the vertex normals,
+		// so the cone doesn't depend on the winding convention.
+		XMVECTOR triangleNormals[MESHLET_MAX_TRIANGLES];
+		uint32_t normalCount = 0;
+		XMVECTOR axis = XMVectorZero();
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			const SVertex& v0 = vertices[meshlet.vertices[meshlet.primitives[t * 3 + 0]]];
+			const SVertex& v1 = vertices[meshlet.vertices[meshlet.primitives[t * 3 + 1]]];
+			const SVertex& v2 = vertices[meshlet.vertices[meshlet.primitives[t * 3 + 2]]];
+			XMVECTOR p0 = XMLoadFloat3(&v0.position);
+			XMVECTOR n = XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&v1.position), p0), XMVectorSubtract(XMLoadFloat3(&v2.position), p0));
+			if (XMVectorGetX(XMVector3LengthSq(n)) <= 0.0f)
+				continue;
+
+			XMVECTOR shadingNormal = XMVectorAdd(XMVectorAdd(XMLoadFloat3(&v0.normal), XMLoadFloat3(&v1.normal)), XMLoadFloat3(&v2.normal));
+			if (XMVectorGetX(XMVector3Dot(n, shadingNormal)) < 0.0f)
+				n = XMVectorNegate(n);
+
+			n = XMVector3Normalize(n);
+			triangleNormals[normalCount++] = n;
+			axis = XMVectorAdd(axis, n);
+		}
+
+		float cutoff = 1.0f;
+		if (normalCount > 0 && XMVectorGetX(XMVector3LengthSq(axis)) > 0.0f)
+		{
+			axis = XMVector3Normalize(axis);
+			float minDot = 1.0f;
+			for (uint32_t t = 0; t < normalCount; ++t)
+			{
+				minDot = std::min(minDot, XMVectorGetX(XMVector3Dot(axis, triangleNormals[t])));
+			}
+
+			// Cones of 90 degrees and more can't cull anything
+			if (minDot > 0.0f)
+			{
+				cutoff = std::sqrt(1.0f - minDot * minDot);
+			}
+		}
+
+		XMFLOAT3 a;
+		XMStoreFloat3(&a, axis);
+		out.coneAxisX.push_back(a.x);
+		out.coneAxisY.push_back(a.y);
+		out.coneAxisZ.push_back(a.z);
+		out.coneCutoff.push_back(cutoff);
+	}
+
+	template<typename Index>
+	void BuildSection(const SVertex* vertices, const Index* indices, uint32_t indexCount, SMeshletTable& out)
+	{
+		uint32_t vertexCount = 0;
+		for (uint32_t i = 0; i < indexCount; ++i)
+		{
+			vertexCount = std::max(vertexCount, (uint32_t)indices[i] + 1);
+		}
+
+		// Local index of each vertex in the current meshlet, valid if its stamp matches
+		vector<uint32_t> stamp(vertexCount, UINT32_MAX);
+		vector<uint8_t> localIndex(vertexCount, 0);
+		uint32_t meshletIndex = 0;
+
+		MeshletBuilder meshlet;
+		const uint32_t triangleCount = indexCount / 3;
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			const Index* tri = &indices[t * 3];
+			uint32_t newVertices = 0;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				// A repeated vertex inside a degenerate triangle is only counted once
+				const bool repeated = (c > 0 && tri[c] == tri[0]) || (c > 1 && tri[c] == tri[1]);
+				newVertices += (stamp[tri[c]] != meshletIndex && !repeated) ? 1 : 0;
+			}
+
+			if (meshlet.vertices.size() + newVertices > MESHLET_MAX_VERTICES || meshlet.primitives.size() / 3 + 1 > MESHLET_MAX_TRIANGLES)
+			{
+				EmitMeshlet(meshlet, vertices, out);
+				meshlet.vertices.clear();
+				meshlet.primitives.clear();
+				meshlet.triangleOffset = t;
+				++meshletIndex;
+			}
+
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const uint32_t v = tri[c];
+				if (stamp[v] != meshletIndex)
+				{
+					stamp[v] = meshletIndex;
+					localIndex[v] = (uint8_t)meshlet.vertices.size();
+					meshlet.vertices.push_back(v);
+				}
+				meshlet.primitives.push_back(localIndex[v]);
+			}
+		}
+
+		if (!meshlet.primitives.empty())
+		{
+			EmitMeshlet(meshlet, vertices, out);
+		}
+	}
+
+	template<typename Index>
+	void BuildSections(const SVertex* vertices, const Index* indices, const SMeshSection* sections, size_t sectionCount, SMeshletTable& out)
+	{
+		vector<SMeshletTable> perSection(sectionCount);
+		ParallelFor((uint32_t)sectionCount, [&](uint32_t s)
+		{
+			const SMeshSection& section = sections[s];
+			BuildSection(vertices + section.baseVertexLocation, indices + section.startIndexLocation, section.indexCount, perSection[s]);
+		});
+
+		out.clear();
+		out.sectionOffsets.reserve(sectionCount + 1);
+		for (SMeshletTable& table : perSection)
+		{
+			out.sectionOffsets.push_back((uint32_t)out.size());
+
+			const uint32_t vertexBase = (uint32_t)out.vertices.size();
+			for (uint32_t& offset : table.vertexOffset)
+				offset += vertexBase;
+
+			Append(out.triangleOffset, table.triangleOffset);
+			Append(out.triangleCount, table.triangleCount);
+			Append(out.vertexOffset, table.vertexOffset);
+			Append(out.vertexCount, table.vertexCount);
+			Append(out.vertices, table.vertices);
+			Append(out.primitives, table.primitives);
+			Append(out.centerX, table.centerX);
+			Append(out.centerY, table.centerY);
+			Append(out.centerZ, table.centerZ);
+			Append(out.radius, table.radius);
+			Append(out.aabbMinX, table.aabbMinX);
+			Append(out.aabbMinY, table.aabbMinY);
+			Append(out.aabbMinZ, table.aabbMinZ);
+			Append(out.aabbMaxX, table.aabbMaxX);
+			Append(out.aabbMaxY, table.aabbMaxY);
+			Append(out.aabbMaxZ, table.aabbMaxZ);
+			Append(out.coneAxisX, table.coneAxisX);
+			Append(out.coneAxisY, table.coneAxisY);
+			Append(out.coneAxisZ, table.coneAxisZ);
+			Append(out.coneCutoff, table.coneCutoff);
+		}
+		out.sectionOffsets.push_back((uint32_t)out.size());
+	}
+}
+
+void SMeshletTable::clear()
+{
+	*this = SMeshletTable();
+}
+
+void SMeshlets::Build(const SVertex* vertices, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount, SMeshletTable& out)
+{
+	BuildSections(vertices, indices, sections, sectionCount, out);
+}
+
+void SMeshlets::Build(const SVertex* vertices, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount, SMeshletTable& out)
+{
+	BuildSections(vertices, indices, sections, sectionCount, out);
+}
+
+uint32_t SMeshlets::Cull(const SMeshletTable& table, uint32_t first, uint32_t count,
+	FXMMATRIX objectToClip, const XMFLOAT3& cameraPosition, vector<uint32_t>& outVisible)
+{
+	XMFLOAT4 planes[6];
+	SFrustumCulling::ExtractPlanes(objectToClip, planes);
+
+	uint32_t visibleTriangles = 0;
+	for (uint32_t i = first; i < first + count; ++i)
+	{
+		const float cx = table.centerX[i];
+		const float cy = table.centerY[i];
+		const float cz = table.centerZ[i];
+		const float r = table.radius[i];
+
+		bool visible = true;
+		for (uint32_t p = 0; p < 6 && visible; ++p)
+		{
+			visible = planes[p].x * cx + planes[p].y * cy + planes[p].z * cz + planes[p].w >= -r;
+		}
+		if (!visible)
+			continue;
+
+		const float dx = cx - cameraPosition.x;
+		const float dy = cy - cameraPosition.y;
+		const float dz = cz - cameraPosition.z;
+		const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (dx * table.coneAxisX[i] + dy * table.coneAxisY[i] + dz * table.coneAxisZ[i] >= table.coneCutoff[i] * distance + r)
+			continue;
+
+		outVisible.push_back(i);
+		visibleTriangles += table.triangleCount[i];
+	}
+	return visibleTriangles;
+}
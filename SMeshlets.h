@@ -0,0 +1,61 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+struct SVertex;
+struct SMeshSection;
+
+constexpr uint32_t MESHLET_MAX_VERTICES = 64;
+constexpr uint32_t MESHLET_MAX_TRIANGLES = 124;
+
+// Meshlets of all sections of a mesh, one array per attribute so culling can stream through the bounds.
+//
+// Each meshlet is a contiguous run of its section's index buffer, so visible meshlets can be drawn
+// with DrawIndexedInstanced straight from the existing buffers. [vertices] and [primitives] hold the
+// same triangles in mesh shader form (unique vertices plus 8 bit local indices).
+struct SMeshletTable
+{
+	// Meshlets of section s are [sectionOffsets[s], sectionOffsets[s + 1])
+	std::vector<uint32_t> sectionOffsets;
+
+	// First triangle relative to the section's startIndexLocation
+	std::vector<uint32_t> triangleOffset;
+	std::vector<uint8_t> triangleCount;
+	std::vector<uint32_t> vertexOffset;
+	std::vector<uint8_t> vertexCount;
+
+	std::vector<uint32_t> vertices;   // Section-local vertex indices
+	std::vector<uint8_t> primitives;  // 3 meshlet-local indices per triangle
+
+	// Bounding sphere
+	std::vector<float> centerX, centerY, centerZ, radius;
+
+	// Axis aligned bounding box
+	std::vector<float> aabbMinX, aabbMinY, aabbMinZ;
+	std::vector<float> aabbMaxX, aabbMaxY, aabbMaxZ;
+
+	// Backface normal cone. Every triangle faces away from a viewer at p if
+	// dot(center - p, coneAxis) >= coneCutoff * |center - p| + radius. coneCutoff is 1 for cones that never cull.
+	std::vector<float> coneAxisX, coneAxisY, coneAxisZ, coneCutoff;
+
+	inline size_t size() const { return triangleOffset.size(); }
+	void clear();
+};
+
+namespace SMeshlets
+{
+	// Splits every section into meshlets of at most MESHLET_MAX_VERTICES vertices and MESHLET_MAX_TRIANGLES triangles,
+	// scanning the triangles in index buffer order. Sections are processed in parallel.
+	void Build(const SVertex* vertices, const uint32_t* indices, const SMeshSection* sections, size_t sectionCount, SMeshletTable& out);
+	// Same for 16 bit indices, as mapped from a .smesh cache
+	void Build(const SVertex* vertices, const uint16_t* indices, const SMeshSection* sections, size_t sectionCount, SMeshletTable& out);
+
+	// Frustum and backface cone test of meshlets [first, first + count).
+	// [objectToClip] maps object space positions to clip space (row vectors, as DirectXMath),
+	// [cameraPosition] is in object space. Appends the visible meshlets to [outVisible]
+	// and returns the number of visible triangles.
+	uint32_t Cull(const SMeshletTable& table, uint32_t first, uint32_t count,
+		DirectX::FXMMATRIX objectToClip, const DirectX::XMFLOAT3& cameraPosition, std::vector<uint32_t>& outVisible);
+}
@@ -0,0 +1,532 @@
+#include "SObjReader.h"
+
+#include "MappedFile.h"
+#include "ParallelFor.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+using std::vector;
+
+namespace
+{
+	// Chunks smaller than this are not worth a thread of their own.
+	constexpr uint64_t MIN_CHUNK_SIZE = 1 << 20;
+
+	// One face corner as written in the file.
+	// Negative (relative) OBJ indices are resolved against the attribute count of the chunk,
+	// [relative] flags the components that still need the count of all preceding chunks added.
+	struct RawCorner
+	{
+		int v, vt, vn;
+		uint8_t relative;
+	};
+
+	enum
+	{
+		Relative_V = 1 << 0,
+		Relative_VT = 1 << 1,
+		Relative_VN = 1 << 2,
+	};
+
+	// A shape starts here. [firstFace] counts triangles of the chunk so far.
+	struct ShapeBreak
+	{
+		size_t firstFace;
+		std::string name;
+	};
+
+	struct ChunkResult
+	{
+		vector<float> positions;
+		vector<float> texcoords;
+		vector<float> normals;
+		vector<RawCorner> corners;
+		vector<uint8_t> faceSizes;  // 3 or 4 corners
+		size_t triangleCount = 0;
+		vector<ShapeBreak> breaks;
+		bool supported = true;
+	};
+
+	inline bool IsSpace(char c) { return c == ' ' || c == '\t'; }
+	inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+	inline void SkipSpaces(const char*& p, const char* end)
+	{
+		while (p < end && IsSpace(*p))
+			++p;
+	}
+
+	inline void SkipLine(const char*& p, const char* end)
+	{
+		while (p < end && *p != '\n')
+			++p;
+		if (p < end)
+			++p;
+	}
+
+	// Decimal float parser for the plain "[-]123.456[e-7]" forms OBJ exporters write.
+	// Falls back to strtod for anything unusual (inf, nan, hex floats, very long mantissas).
+	inline bool ParseFloat(const char*& p, const char* end, float& out)
+	{
+		static const double POW10[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+			1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+		SkipSpaces(p, end);
+		const char* start = p;
+
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+'))
+		{
+			negative = *p == '-';
+			++p;
+		}
+
+		uint64_t mantissa = 0;
+		int digits = 0;
+		int exponent = 0;
+		while (p < end && IsDigit(*p))
+		{
+			mantissa = mantissa * 10 + (*p - '0');
+			++digits;
+			++p;
+		}
+		if (p < end && *p == '.')
+		{
+			++p;
+			while (p < end && IsDigit(*p))
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+				++digits;
+				--exponent;
+				++p;
+			}
+		}
+		if (digits == 0 || digits > 18)
+		{
+			goto slow_path;
+		}
+		if (p < end && (*p == 'e' || *p == 'E'))
+		{
+			++p;
+			bool negativeExp = false;
+			if (p < end && (*p == '-' || *p == '+'))
+			{
+				negativeExp = *p == '-';
+				++p;
+			}
+			if (p >= end || !IsDigit(*p))
+			{
+				goto slow_path;
+			}
+			int e = 0;
+			while (p < end && IsDigit(*p))
+			{
+				e = std::min(e * 10 + (*p - '0'), 1000);
+				++p;
+			}
+			exponent += negativeExp ? -e : e;
+		}
+		if (p < end && !IsSpace(*p) && *p != '\r' && *p != '\n' && *p != '/')
+		{
+			goto slow_path;
+		}
+
+		{
+			double value = (double)mantissa;
+			if (exponent < 0)
+			{
+				value = -exponent <= 22 ? value / POW10[-exponent] : value * std::pow(10.0, exponent);
+			}
+			else if (exponent > 0)
+			{
+				value = exponent <= 22 ? value * POW10[exponent] : value * std::pow(10.0, exponent);
+			}
+			out = (float)(negative ? -value : value);
+			return true;
+		}
+
+	slow_path:
+		{
+			char buffer[64];
+			size_t len = 0;
+			p = start;
+			while (p < end && !IsSpace(*p) && *p != '\r' && *p != '\n' && len < sizeof(buffer) - 1)
+				buffer[len++] = *p++;
+			buffer[len] = '\0';
+			char* parsedEnd = nullptr;
+			out = (float)strtod(buffer, &parsedEnd);
+			return len > 0 && parsedEnd == buffer + len;
+		}
+	}
+
+	inline bool ParseInt(const char*& p, const char* end, int& out)
+	{
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+'))
+		{
+			negative = *p == '-';
+			++p;
+		}
+		if (p >= end || !IsDigit(*p))
+			return false;
+		int value = 0;
+		while (p < end && IsDigit(*p))
+		{
+			value = value * 10 + (*p - '0');
+			++p;
+		}
+		out = negative ? -value : value;
+		return true;
+	}
+
+	// Converts an OBJ index (1-based, or negative relative to the current count) to 0-based.
+	// [relative] is set when the result is relative to the start of the chunk.
+	inline int ResolveIndex(int index, size_t currentCount, bool& relative)
+	{
+		if (index < 0)
+		{
+			relative = true;
+			return (int)currentCount + index;
+		}
+		relative = false;
+		return index - 1;
+	}
+
+	// Parses one "v/vt/vn", "v//vn", "v/vt" or "v" corner.
+	inline bool ParseCorner(const char*& p, const char* end, const ChunkResult& chunk, RawCorner& out)
+	{
+		bool relative;
+		int index;
+		out.relative = 0;
+		out.vt = -1;
+		out.vn = -1;
+
+		if (!ParseInt(p, end, index))
+			return false;
+		out.v = ResolveIndex(index, chunk.positions.size() / 3, relative);
+		out.relative |= relative ? Relative_V : 0;
+
+		if (p < end && *p == '/')
+		{
+			++p;
+			if (p < end && *p != '/')
+			{
+				if (!ParseInt(p, end, index))
+					return false;
+				out.vt = ResolveIndex(index, chunk.texcoords.size() / 2, relative);
+				out.relative |= relative ? Relative_VT : 0;
+			}
+			if (p < end && *p == '/')
+			{
+				++p;
+				if (!ParseInt(p, end, index))
+					return false;
+				out.vn = ResolveIndex(index, chunk.normals.size() / 3, relative);
+				out.relative |= relative ? Relative_VN : 0;
+			}
+		}
+		return true;
+	}
+
+	inline bool IsKeyword(const char* p, const char* end, const char* keyword, size_t length)
+	{
+		return (size_t)(end - p) > length && memcmp(p, keyword, length) == 0 && (IsSpace(p[length]) || p[length] == '\r' || p[length] == '\n');
+	}
+
+	void ParseChunk(const char* p, const char* end, ChunkResult& chunk)
+	{
+		RawCorner polygon[4];
+
+		while (p < end)
+		{
+			SkipSpaces(p, end);
+			if (p >= end)
+				break;
+
+			const char c = *p;
+			if (c == '\n' || c == '\r' || c == '#')
+			{
+				SkipLine(p, end);
+				continue;
+			}
+
+			if (IsKeyword(p, end, "v", 1))
+			{
+				p += 1;
+				float xyz[3];
+				for (float& f : xyz)
+				{
+					if (!ParseFloat(p, end, f))
+					{
+						chunk.supported = false;
+						return;
+					}
+				}
+				chunk.positions.insert(chunk.positions.end(), xyz, xyz + 3);
+			}
+			else if (IsKeyword(p, end, "vt", 2))
+			{
+				p += 2;
+				float uv[2];
+				for (float& f : uv)
+				{
+					if (!ParseFloat(p, end, f))
+					{
+						chunk.supported = false;
+						return;
+					}
+				}
+				chunk.texcoords.insert(chunk.texcoords.end(), uv, uv + 2);
+			}
+			else if (IsKeyword(p, end, "vn", 2))
+			{
+				p += 2;
+				float n[3];
+				for (float& f : n)
+				{
+					if (!ParseFloat(p, end, f))
+					{
+						chunk.supported = false;
+						return;
+					}
+				}
+				chunk.normals.insert(chunk.normals.end(), n, n + 3);
+			}
+			else if (IsKeyword(p, end, "f", 1))
+			{
+				p += 1;
+				uint32_t count = 0;
+				while (true)
+				{
+					SkipSpaces(p, end);
+					if (p >= end || *p == '\r' || *p == '\n' || *p == '#')
+						break;
+					if (count == std::size(polygon) || !ParseCorner(p, end, chunk, polygon[count]))
+					{
+						chunk.supported = false;
+						return;
+					}
+					++count;
+				}
+				if (count < 3)
+				{
+					chunk.supported = false;
+					return;
+				}
+
+				// Quads are split at merge time once every position is known,
+				// larger polygons are left to tinyobj's ear clipping
+				chunk.corners.insert(chunk.corners.end(), polygon, polygon + count);
+				chunk.faceSizes.push_back((uint8_t)count);
+				chunk.triangleCount += count - 2;
+			}
+			else if (IsKeyword(p, end, "o", 1) || IsKeyword(p, end, "g", 1))
+			{
+				p += 1;
+				SkipSpaces(p, end);
+				const char* nameStart = p;
+				while (p < end && *p != '\r' && *p != '\n')
+					++p;
+				chunk.breaks.push_back(ShapeBreak{ chunk.triangleCount, std::string(nameStart, p) });
+			}
+			else if (IsKeyword(p, end, "s", 1))
+			{
+				// Smoothing groups do not affect the output
+			}
+			else
+			{
+				// mtllib, usemtl, l, p, curv, ... are left to tinyobj
+				chunk.supported = false;
+				return;
+			}
+
+			SkipLine(p, end);
+		}
+	}
+}
+
+bool SObjReader::Parse(const char* filename, uint32_t maxThreads)
+{
+	auto startTime = std::chrono::high_resolution_clock::now();
+
+	m_attrib = tinyobj::attrib_t();
+	m_shapes.clear();
+
+	MappedFile file;
+	if (!file.Open(filename))
+		return false;
+
+	const char* data = (const char*)file.data();
+	const uint64_t size = file.size();
+
+	if (maxThreads == 0)
+		maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	uint32_t chunkCount = (uint32_t)std::min<uint64_t>(maxThreads, size / MIN_CHUNK_SIZE + 1);
+
+	// Line-aligned chunk boundaries
+	vector<const char*> bounds(chunkCount + 1);
+	bounds[0] = data;
+	bounds[chunkCount] = data + size;
+	for (uint32_t i = 1; i < chunkCount; ++i)
+	{
+		const char* p = std::max(bounds[i - 1], data + size * i / chunkCount);
+		while (p > data && p < data + size && p[-1] != '\n')
+			++p;
+		bounds[i] = p;
+	}
+
+	vector<ChunkResult> chunks(chunkCount);
+	ParallelFor(chunkCount, [&](uint32_t i)
+	{
+		ParseChunk(bounds[i], bounds[i + 1], chunks[i]);
+	}, maxThreads);
+
+	for (const ChunkResult& chunk : chunks)
+	{
+		if (!chunk.supported)
+			return false;
+	}
+
+	// Exclusive prefix sums of every per-chunk count
+	struct ChunkBase
+	{
+		size_t positions, texcoords, normals, faces;
+	};
+	vector<ChunkBase> bases(chunkCount + 1);
+	bases[0] = {};
+	for (uint32_t i = 0; i < chunkCount; ++i)
+	{
+		bases[i + 1].positions = bases[i].positions + chunks[i].positions.size();
+		bases[i + 1].texcoords = bases[i].texcoords + chunks[i].texcoords.size();
+		bases[i + 1].normals = bases[i].normals + chunks[i].normals.size();
+		bases[i + 1].faces = bases[i].faces + chunks[i].triangleCount;
+	}
+	const ChunkBase& totals = bases[chunkCount];
+
+	m_attrib.vertices.resize(totals.positions);
+	m_attrib.texcoords.resize(totals.texcoords);
+	m_attrib.normals.resize(totals.normals);
+	vector<tinyobj::index_t> indices(totals.faces * 3);
+
+	// Each chunk copies its attributes into its own range
+	ParallelFor(chunkCount, [&](uint32_t i)
+	{
+		const ChunkResult& chunk = chunks[i];
+		const ChunkBase& base = bases[i];
+		std::copy(chunk.positions.begin(), chunk.positions.end(), m_attrib.vertices.begin() + base.positions);
+		std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), m_attrib.texcoords.begin() + base.texcoords);
+		std::copy(chunk.normals.begin(), chunk.normals.end(), m_attrib.normals.begin() + base.normals);
+	}, maxThreads);
+
+	// Then resolves and triangulates its faces into its own range
+	std::atomic<bool> indicesValid(true);
+	ParallelFor(chunkCount, [&](uint32_t i)
+	{
+		const ChunkResult& chunk = chunks[i];
+		const ChunkBase& base = bases[i];
+
+		const int vBase = (int)(base.positions / 3);
+		const int vtBase = (int)(base.texcoords / 2);
+		const int vnBase = (int)(base.normals / 3);
+		const int vCount = (int)(totals.positions / 3);
+		const int vtCount = (int)(totals.texcoords / 2);
+		const int vnCount = (int)(totals.normals / 3);
+
+		// Missing components are stored as -1 like tinyobj does
+		auto resolve = [&](int index, bool relative, int chunkBase, int count, bool optional, int& out)
+		{
+			if (optional && index < 0 && !relative)
+			{
+				out = -1;
+				return true;
+			}
+			out = relative ? index + chunkBase : index;
+			return out >= 0 && out < count;
+		};
+
+		auto squaredDistance = [&](int a, int b)
+		{
+			const float* pa = &m_attrib.vertices[3 * (size_t)a];
+			const float* pb = &m_attrib.vertices[3 * (size_t)b];
+			float dx = pb[0] - pa[0], dy = pb[1] - pa[1], dz = pb[2] - pa[2];
+			return dx * dx + dy * dy + dz * dz;
+		};
+
+		tinyobj::index_t* out = indices.data() + base.faces * 3;
+		const RawCorner* c = chunk.corners.data();
+		for (uint8_t faceSize : chunk.faceSizes)
+		{
+			tinyobj::index_t face[4];
+			for (uint32_t k = 0; k < faceSize; ++k, ++c)
+			{
+				if (!resolve(c->v, (c->relative & Relative_V) != 0, vBase, vCount, false, face[k].vertex_index) ||
+					!resolve(c->vt, (c->relative & Relative_VT) != 0, vtBase, vtCount, true, face[k].texcoord_index) ||
+					!resolve(c->vn, (c->relative & Relative_VN) != 0, vnBase, vnCount, true, face[k].normal_index))
+				{
+					indicesValid = false;
+					return;
+				}
+			}
+
+			if (faceSize == 3)
+			{
+				*out++ = face[0]; *out++ = face[1]; *out++ = face[2];
+			}
+			else if (squaredDistance(face[0].vertex_index, face[2].vertex_index) < squaredDistance(face[1].vertex_index, face[3].vertex_index))
+			{
+				// Split along the shorter diagonal, same as tinyobj
+				*out++ = face[0]; *out++ = face[1]; *out++ = face[2];
+				*out++ = face[0]; *out++ = face[2]; *out++ = face[3];
+			}
+			else
+			{
+				*out++ = face[0]; *out++ = face[1]; *out++ = face[3];
+				*out++ = face[1]; *out++ = face[2]; *out++ = face[3];
+			}
+		}
+	}, maxThreads);
+
+	if (!indicesValid)
+		return false;
+
+	// Split the face list at every 'o' / 'g' that follows at least one face, in file order
+	vector<ShapeBreak> breaks;
+	breaks.push_back(ShapeBreak{ 0, std::string() });
+	for (uint32_t i = 0; i < chunkCount; ++i)
+	{
+		for (const ShapeBreak& b : chunks[i].breaks)
+		{
+			size_t face = bases[i].faces + b.firstFace;
+			if (face == breaks.back().firstFace)
+				breaks.back().name = b.name;
+			else
+				breaks.push_back(ShapeBreak{ face, b.name });
+		}
+	}
+	breaks.push_back(ShapeBreak{ totals.faces, std::string() });
+
+	for (size_t i = 0; i + 1 < breaks.size(); ++i)
+	{
+		size_t firstFace = breaks[i].firstFace;
+		size_t faceCount = breaks[i + 1].firstFace - firstFace;
+		if (faceCount == 0)
+			continue;
+
+		tinyobj::shape_t shape;
+		shape.name = breaks[i].name;
+		shape.mesh.indices.assign(indices.begin() + firstFace * 3, indices.begin() + (firstFace + faceCount) * 3);
+		shape.mesh.num_face_vertices.assign(faceCount, 3);
+		shape.mesh.material_ids.assign(faceCount, -1);
+		shape.mesh.smoothing_group_ids.assign(faceCount, 0);
+		m_shapes.push_back(std::move(shape));
+	}
+
+	m_fileSize = size;
+	m_threadCount = chunkCount;
+	m_parseMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+	return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "tiny_obj_loader.h"
+
+// Multithreaded OBJ reader for large scanned meshes.
+// The file is memory mapped and split into line-aligned chunks that are parsed in parallel,
+// then the chunks are merged in file order into the same attrib_t / shape_t layout tinyobj produces.
+//
+// Only geometry statements are understood (v, vt, vn, f, o, g, s and comments) and faces
+// must be triangles or quads. Parse() returns false for anything else (mtllib, usemtl,
+// n-gons, lines, curves, ...), in which case the caller is expected to fall back to tinyobj::ObjReader.
+class SObjReader
+{
+public:
+	SObjReader() = default;
+
+	bool Parse(const char* filename, uint32_t maxThreads = 0);
+
+	inline const tinyobj::attrib_t& GetAttrib() const { return m_attrib; }
+	inline const std::vector<tinyobj::shape_t>& GetShapes() const { return m_shapes; }
+
+	// Statistics of the last successful Parse()
+	inline uint64_t GetFileSize() const { return m_fileSize; }
+	inline uint32_t GetThreadCount() const { return m_threadCount; }
+	inline double GetParseMilliseconds() const { return m_parseMilliseconds; }
+
+private:
+	tinyobj::attrib_t m_attrib;
+	std::vector<tinyobj::shape_t> m_shapes;
+
+	uint64_t m_fileSize = 0;
+	uint32_t m_threadCount = 0;
+	double m_parseMilliseconds = 0.0;
+};
@@ -0,0 +1,200 @@
+#include "SSphericalHarmonics.h"
+
+#include "CpuInfo.h"
+#include "ParallelFor.h"
+#include "SSphericalHarmonicsKernels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+using namespace DirectX;
+using namespace SSphericalHarmonicsKernels;
+
+namespace
+{
+	// Cube faces in D3D order: the direction through face coordinates (u, v) in [-1, 1], v down, is normal + u * uAxis + v * vAxis
+	struct FaceAxes
+	{
+		XMFLOAT3 normal, uAxis, vAxis;
+	};
+	const FaceAxes FACES[6] = {
+		{ {  1.0f,  0.0f,  0.0f }, {  0.0f, 0.0f, -1.0f }, { 0.0f, -1.0f,  0.0f } },
+		{ { -1.0f,  0.0f,  0.0f }, {  0.0f, 0.0f,  1.0f }, { 0.0f, -1.0f,  0.0f } },
+		{ {  0.0f,  1.0f,  0.0f }, {  1.0f, 0.0f,  0.0f }, { 0.0f,  0.0f,  1.0f } },
+		{ {  0.0f, -1.0f,  0.0f }, {  1.0f, 0.0f,  0.0f }, { 0.0f,  0.0f, -1.0f } },
+		{ {  0.0f,  0.0f,  1.0f }, {  1.0f, 0.0f,  0.0f }, { 0.0f, -1.0f,  0.0f } },
+		{ {  0.0f,  0.0f, -1.0f }, { -1.0f, 0.0f,  0.0f }, { 0.0f, -1.0f,  0.0f } },
+	};
+
+	// Projected area of the face rectangle from (0, 0) to (x, y), see TexelCoordSolidAngle in helperFunctions.hlsli
+	inline double AreaElement(double x, double y)
+	{
+		return atan2(x * y, sqrt(x * x + y * y + 1.0));
+	}
+
+	// Adds [count] arrays of [stride] doubles into the first one: neighbours first, then pairs of pairs, and so on
+	void PairwiseSum(double* values, size_t count, size_t stride)
+	{
+		for (size_t step = 1; step < count; step *= 2)
+		{
+			for (size_t i = 0; i + step < count; i += 2 * step)
+			{
+				for (size_t k = 0; k < stride; ++k)
+					values[i * stride + k] += values[(i + step) * stride + k];
+			}
+		}
+	}
+}
+
+SSphericalHarmonics::Kernel SSphericalHarmonics::GetBestKernel()
+{
+	// SSE2 is part of x64
+	static const Kernel best = CpuInfo::HasAVX2() ? Kernel::AVX2 : Kernel::SSE;
+	return best;
+}
+
+const char* SSphericalHarmonics::GetKernelName(Kernel kernel)
+{
+	switch (kernel)
+	{
+	case Kernel::SSE:
+		return "SSE";
+	case Kernel::AVX2:
+		return "AVX2";
+	default:
+		return "Scalar";
+	}
+}
+
+XMFLOAT3 SSphericalHarmonics::GetTexelDirection(uint32_t face, uint32_t x, uint32_t y, uint32_t size)
+{
+	return GetFaceDirection(face, (x + 0.5f) * (2.0f / size) - 1.0f, (y + 0.5f) * (2.0f / size) - 1.0f);
+}
+
+XMFLOAT3 SSphericalHarmonics::GetFaceDirection(uint32_t face, float u, float v)
+{
+	const FaceAxes& axes = FACES[face];
+	const float x3 = axes.normal.x + u * axes.uAxis.x + v * axes.vAxis.x;
+	const float y3 = axes.normal.y + u * axes.uAxis.y + v * axes.vAxis.y;
+	const float z3 = axes.normal.z + u * axes.uAxis.z + v * axes.vAxis.z;
+	const float inverseLength = 1.0f / sqrtf(x3 * x3 + y3 * y3 + z3 * z3);
+	return XMFLOAT3(x3 * inverseLength, y3 * inverseLength, z3 * inverseLength);
+}
+
+uint32_t SSphericalHarmonics::GetDirectionFace(const XMFLOAT3& direction, float& outU, float& outV)
+{
+	const float ax = fabsf(direction.x), ay = fabsf(direction.y), az = fabsf(direction.z);
+	const uint32_t face = ax >= ay && ax >= az ? (direction.x >= 0.0f ? 0 : 1)
+		: ay >= az ? (direction.y >= 0.0f ? 2 : 3)
+		: (direction.z >= 0.0f ? 4 : 5);
+
+	// direction / major = normal + u * uAxis + v * vAxis, with orthonormal axes
+	const FaceAxes& axes = FACES[face];
+	const float major = std::max({ ax, ay, az });
+	outU = (direction.x * axes.uAxis.x + direction.y * axes.uAxis.y + direction.z * axes.uAxis.z) / major;
+	outV = (direction.x * axes.vAxis.x + direction.y * axes.vAxis.y + direction.z * axes.vAxis.z) / major;
+	return face;
+}
+
+std::vector<float> SSphericalHarmonics::ComputeTexelSolidAngles(uint32_t size, uint32_t maxThreads)
+{
+	// Corners are evaluated in double: texels are the difference of 4 of them, which in float would lose most of
+	// their digits on large faces
+	std::vector<float> weights((size_t)size * size);
+	ParallelFor(size, [&](uint32_t y)
+	{
+		const double y0 = 2.0 * y / size - 1.0;
+		const double y1 = 2.0 * (y + 1) / size - 1.0;
+		double previous0 = AreaElement(-1.0, y0), previous1 = AreaElement(-1.0, y1);
+		for (uint32_t x = 0; x < size; ++x)
+		{
+			const double x1 = 2.0 * (x + 1) / size - 1.0;
+			const double next0 = AreaElement(x1, y0), next1 = AreaElement(x1, y1);
+			weights[(size_t)y * size + x] = (float)(previous0 - previous1 - next0 + next1);
+			previous0 = next0;
+			previous1 = next1;
+		}
+	}, maxThreads);
+	return weights;
+}
+
+void SSphericalHarmonics::EvaluateBasis(uint32_t bands, const XMFLOAT3& direction, float* outBasis)
+{
+	assert(bands == 3 || bands == 4);
+	if (bands > 3)
+		Basis<4>(direction.x, direction.y, direction.z, outBasis);
+	else
+		Basis<3>(direction.x, direction.y, direction.z, outBasis);
+}
+
+void SSphericalHarmonics::ProjectCubemap(const float* const faces[6], size_t rowPitch, uint32_t size, uint32_t bands, XMFLOAT3* outCoefficients,
+	Kernel kernel, uint32_t maxThreads)
+{
+	assert(bands == 3 || bands == 4);
+	const uint32_t count = bands * bands;
+	const std::vector<float> weights = ComputeTexelSolidAngles(size, maxThreads);
+
+	RowFunction projectRow;
+	switch (kernel)
+	{
+	case Kernel::AVX2:
+		projectRow = GetRowFunctionAVX2(bands);
+		break;
+	case Kernel::SSE:
+		projectRow = GetRowFunction<Float4>(bands);
+		break;
+	default:
+		projectRow = GetRowFunction<Float1>(bands);
+		break;
+	}
+
+	// Every row keeps its own sums, so how rows are spread over threads does not change the result
+	const uint32_t rowCount = 6 * size;
+	std::vector<double> rowSums((size_t)rowCount * count * 3);
+	ParallelFor(rowCount, [&](uint32_t index)
+	{
+		const uint32_t face = index / size;
+		const uint32_t y = index % size;
+		const FaceAxes& axes = FACES[face];
+		const float v = (y + 0.5f) * (2.0f / size) - 1.0f;
+		FaceRow row;
+		row.origin = XMFLOAT3(axes.normal.x + v * axes.vAxis.x, axes.normal.y + v * axes.vAxis.y, axes.normal.z + v * axes.vAxis.z);
+		row.uAxis = axes.uAxis;
+
+		const float* texels = (const float*)((const uint8_t*)faces[face] + y * rowPitch);
+		projectRow(texels, weights.data() + (size_t)y * size, size, row, rowSums.data() + (size_t)index * count * 3);
+	}, maxThreads);
+
+	PairwiseSum(rowSums.data(), rowCount, count * 3);
+	for (uint32_t k = 0; k < count; ++k)
+		outCoefficients[k] = XMFLOAT3((float)rowSums[k * 3 + 0], (float)rowSums[k * 3 + 1], (float)rowSums[k * 3 + 2]);
+}
+
+void SSphericalHarmonics::ConvolveIrradiance(const XMFLOAT3* radiance, uint32_t bands, XMFLOAT3 outIrradiance[IRRADIANCE_COEFFICIENTS])
+{
+	// Clamped cosine lobe per band over pi (Ramamoorthi and Hanrahan 2001): pi, 2 pi / 3, pi / 4, then 0 for band 3
+	const float bandScale[3] = { 1.0f, 2.0f / 3.0f, 0.25f };
+	assert(bands >= 3);
+	(void)bands;
+	for (uint32_t k = 0; k < IRRADIANCE_COEFFICIENTS; ++k)
+	{
+		const float scale = bandScale[k == 0 ? 0 : k < 4 ? 1 : 2];
+		outIrradiance[k] = XMFLOAT3(radiance[k].x * scale, radiance[k].y * scale, radiance[k].z * scale);
+	}
+}
+
+XMFLOAT3 SSphericalHarmonics::Evaluate(const XMFLOAT3* coefficients, uint32_t bands, const XMFLOAT3& direction)
+{
+	float basis[MAX_COEFFICIENTS];
+	EvaluateBasis(bands, direction, basis);
+	XMFLOAT3 result(0.0f, 0.0f, 0.0f);
+	for (uint32_t k = 0; k < bands * bands; ++k)
+	{
+		result.x += coefficients[k].x * basis[k];
+		result.y += coefficients[k].y * basis[k];
+		result.z += coefficients[k].z * basis[k];
+	}
+	return result;
+}
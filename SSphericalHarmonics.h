@@ -0,0 +1,56 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+// Real spherical harmonics of environment cubemaps: projection of radiance with texel solid angle weights,
+// and its convolution with the clamped cosine lobe into the diffuse irradiance the shaders evaluate.
+//
+// Coefficients are ordered by band l, then m from -l to l: Y00, Y1-1, Y10, Y11, Y2-2, ..., for 3 bands (SH9)
+// or 4 (SH16). Directions are those of a D3D TextureCube lookup.
+namespace SSphericalHarmonics
+{
+	constexpr uint32_t MAX_BANDS = 4;
+	constexpr uint32_t MAX_COEFFICIENTS = MAX_BANDS * MAX_BANDS;
+	constexpr uint32_t IRRADIANCE_COEFFICIENTS = 9;
+
+	enum class Kernel
+	{
+		Scalar,
+		SSE,    // 4 texels per iteration
+		AVX2,   // 8 texels per iteration
+	};
+
+	// Fastest kernel this CPU and OS support
+	Kernel GetBestKernel();
+	const char* GetKernelName(Kernel kernel);
+
+	// Unit direction through the center of texel ([x], [y]) of a cube face, faces in D3D order
+	DirectX::XMFLOAT3 GetTexelDirection(uint32_t face, uint32_t x, uint32_t y, uint32_t size);
+	// Unit direction through ([u], [v]) of a cube face, both from -1 to 1 across it
+	DirectX::XMFLOAT3 GetFaceDirection(uint32_t face, float u, float v);
+	// The face a direction points into, and its coordinates there as GetFaceDirection takes them
+	uint32_t GetDirectionFace(const DirectX::XMFLOAT3& direction, float& outU, float& outV);
+	// Solid angle of every texel of a [size] x [size] face, row major, the same on all 6
+	std::vector<float> ComputeTexelSolidAngles(uint32_t size, uint32_t maxThreads = 0);
+
+	// The [bands]^2 basis functions at the unit vector [direction]
+	void EvaluateBasis(uint32_t bands, const DirectX::XMFLOAT3& direction, float* outBasis);
+
+	// Projects the radiance of a cubemap with [size] x [size] faces onto [bands] bands (3 or 4): the integral over
+	// the sphere of radiance times each basis function, every texel weighted by its solid angle.
+	// [faces]: RGBA float texels of the faces in D3D order (+X, -X, +Y, -Y, +Z, -Z), rows [rowPitch] bytes apart.
+	// Rows are spread over up to [maxThreads] threads (0: one per core) and their sums added pairwise in a fixed
+	// order, so a kernel gives the same coefficients for any thread count. Kernels differ in the last bits.
+	void ProjectCubemap(const float* const faces[6], size_t rowPitch, uint32_t size, uint32_t bands, DirectX::XMFLOAT3* outCoefficients,
+		Kernel kernel = GetBestKernel(), uint32_t maxThreads = 0);
+
+	// Irradiance over pi, the cosine weighted mean of the radiance around a normal (times albedo, the radiance
+	// a Lambertian surface reflects), from [bands] bands of radiance. The cosine lobe has no band 3, so SH16 input
+	// still gives IRRADIANCE_COEFFICIENTS coefficients.
+	void ConvolveIrradiance(const DirectX::XMFLOAT3* radiance, uint32_t bands, DirectX::XMFLOAT3 outIrradiance[IRRADIANCE_COEFFICIENTS]);
+
+	// The sum of [coefficients] times the basis at the unit vector [direction]
+	DirectX::XMFLOAT3 Evaluate(const DirectX::XMFLOAT3* coefficients, uint32_t bands, const DirectX::XMFLOAT3& direction);
+}
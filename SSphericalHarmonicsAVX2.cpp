@@ -0,0 +1,48 @@
+#include "SSphericalHarmonicsKernels.h"
+
+// GCC and Clang build this file with -mavx2, so nothing here may run before GetBestKernel has picked AVX2
+namespace SSphericalHarmonicsKernels
+{
+	namespace
+	{
+		struct Float8
+		{
+			static constexpr uint32_t WIDTH = 8;
+			__m256 v;
+			Float8() = default;
+			Float8(__m256 value) : v(value) {}
+			Float8(float value) : v(_mm256_set1_ps(value)) {}
+
+			static Float8 Ramp() { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+			static Float8 Load(const float* p) { return _mm256_loadu_ps(p); }
+			static void LoadRGB(const float* rgba, Float8& r, Float8& g, Float8& b)
+			{
+				// Texels i and i + 4 share a row of the 4 x 4 transpose in each 128-bit lane
+				const __m256 a0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rgba)), _mm_loadu_ps(rgba + 16), 1);
+				const __m256 a1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rgba + 4)), _mm_loadu_ps(rgba + 20), 1);
+				const __m256 a2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rgba + 8)), _mm_loadu_ps(rgba + 24), 1);
+				const __m256 a3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rgba + 12)), _mm_loadu_ps(rgba + 28), 1);
+				const __m256 rg01 = _mm256_unpacklo_ps(a0, a1), rg23 = _mm256_unpacklo_ps(a2, a3);
+				const __m256 ba01 = _mm256_unpackhi_ps(a0, a1), ba23 = _mm256_unpackhi_ps(a2, a3);
+				r = _mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(1, 0, 1, 0));
+				g = _mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(3, 2, 3, 2));
+				b = _mm256_shuffle_ps(ba01, ba23, _MM_SHUFFLE(1, 0, 1, 0));
+			}
+			static Float8 InverseSqrt(Float8 x) { return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(x.v)); }
+			static double Sum(Float8 x)
+			{
+				alignas(32) float lanes[8];
+				_mm256_store_ps(lanes, x.v);
+				return (((double)lanes[0] + lanes[1]) + ((double)lanes[2] + lanes[3])) + (((double)lanes[4] + lanes[5]) + ((double)lanes[6] + lanes[7]));
+			}
+		};
+		inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+		inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+		inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+	}
+
+	RowFunction GetRowFunctionAVX2(uint32_t bands)
+	{
+		return GetRowFunction<Float8>(bands);
+	}
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cmath>
+#include <cstdint>
+#include <immintrin.h>
+
+// The projection loop of SSphericalHarmonics, written once over lane types. Shared by SSphericalHarmonics.cpp and
+// SSphericalHarmonicsAVX2.cpp, which GCC and Clang build with AVX2 enabled.
+namespace SSphericalHarmonicsKernels
+{
+	// One texel row: direction = origin + u * uAxis
+	struct FaceRow
+	{
+		DirectX::XMFLOAT3 origin, uAxis;
+	};
+
+	using RowFunction = void (*)(const float*, const float*, uint32_t, const FaceRow&, double*);
+
+	// The rows of Kernel::AVX2, 8 texels per iteration
+	RowFunction GetRowFunctionAVX2(uint32_t bands);
+
+	// Each file instantiates its own copy, so the linker never picks an AVX2 build of a template for the other kernels
+	namespace
+	{
+		// Y = constant * polynomial in the unit direction
+		constexpr float Y00 = 0.282094792f;   // 1 / (2 sqrt(pi))
+		constexpr float Y1 = 0.488602512f;    // sqrt(3) / (2 sqrt(pi))
+		constexpr float Y2 = 1.092548431f;    // sqrt(15) / (2 sqrt(pi)): xy, yz, xz
+		constexpr float Y20 = 0.315391565f;   // sqrt(5) / (4 sqrt(pi))
+		constexpr float Y22 = 0.546274215f;   // sqrt(15) / (4 sqrt(pi))
+		constexpr float Y33 = 0.590043590f;   // sqrt(35 / 2) / (4 sqrt(pi))
+		constexpr float Y32M = 2.890611443f;  // sqrt(105) / (2 sqrt(pi))
+		constexpr float Y31 = 0.457045799f;   // sqrt(21 / 2) / (4 sqrt(pi))
+		constexpr float Y30 = 0.373176333f;   // sqrt(7) / (4 sqrt(pi))
+		constexpr float Y32 = 1.445305721f;   // sqrt(105) / (4 sqrt(pi))
+
+		// Basis at the unit vector (x, y, z), for T a float or a vector of them
+		template<uint32_t BANDS, typename T>
+		inline void Basis(const T& x, const T& y, const T& z, T* out)
+		{
+			out[0] = T(Y00);
+			out[1] = T(Y1) * y;
+			out[2] = T(Y1) * z;
+			out[3] = T(Y1) * x;
+			out[4] = T(Y2) * (x * y);
+			out[5] = T(Y2) * (y * z);
+			out[6] = T(Y20) * (T(3.0f) * (z * z) - T(1.0f));
+			out[7] = T(Y2) * (x * z);
+			out[8] = T(Y22) * (x * x - y * y);
+			if (BANDS > 3)
+			{
+				const T fiveZ2 = T(5.0f) * (z * z);
+				out[9] = T(Y33) * y * (T(3.0f) * (x * x) - y * y);
+				out[10] = T(Y32M) * (x * y) * z;
+				out[11] = T(Y31) * y * (fiveZ2 - T(1.0f));
+				out[12] = T(Y30) * z * (fiveZ2 - T(3.0f));
+				out[13] = T(Y31) * x * (fiveZ2 - T(1.0f));
+				out[14] = T(Y32) * z * (x * x - y * y);
+				out[15] = T(Y33) * x * (x * x - T(3.0f) * (y * y));
+			}
+		}
+
+		// -------------------------------------------------------
+		// Lanes: the projection is written once over these
+		// -------------------------------------------------------
+
+		struct Float1
+		{
+			static constexpr uint32_t WIDTH = 1;
+			float v;
+			Float1() = default;
+			Float1(float value) : v(value) {}
+
+			static Float1 Ramp() { return 0.0f; }
+			static Float1 Load(const float* p) { return *p; }
+			static void LoadRGB(const float* rgba, Float1& r, Float1& g, Float1& b) { r = rgba[0]; g = rgba[1]; b = rgba[2]; }
+			static Float1 InverseSqrt(Float1 x) { return 1.0f / sqrtf(x.v); }
+			static double Sum(Float1 x) { return x.v; }
+		};
+		inline Float1 operator+(Float1 a, Float1 b) { return a.v + b.v; }
+		inline Float1 operator-(Float1 a, Float1 b) { return a.v - b.v; }
+		inline Float1 operator*(Float1 a, Float1 b) { return a.v * b.v; }
+
+		struct Float4
+		{
+			static constexpr uint32_t WIDTH = 4;
+			__m128 v;
+			Float4() = default;
+			Float4(__m128 value) : v(value) {}
+			Float4(float value) : v(_mm_set1_ps(value)) {}
+
+			static Float4 Ramp() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+			static Float4 Load(const float* p) { return _mm_loadu_ps(p); }
+			static void LoadRGB(const float* rgba, Float4& r, Float4& g, Float4& b)
+			{
+				__m128 t0 = _mm_loadu_ps(rgba), t1 = _mm_loadu_ps(rgba + 4), t2 = _mm_loadu_ps(rgba + 8), t3 = _mm_loadu_ps(rgba + 12);
+				_MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+				r = t0;
+				g = t1;
+				b = t2;
+			}
+			static Float4 InverseSqrt(Float4 x) { return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x.v)); }
+			static double Sum(Float4 x)
+			{
+				alignas(16) float lanes[4];
+				_mm_store_ps(lanes, x.v);
+				return ((double)lanes[0] + lanes[1]) + ((double)lanes[2] + lanes[3]);
+			}
+		};
+		inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+		inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+		inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+
+		// Adds radiance times basis times solid angle of the [V::WIDTH] texels of a row from [x] to [sums]
+		template<typename V, uint32_t BANDS>
+		inline void AccumulateTexels(const float* texels, const float* weights, float step, uint32_t x, const FaceRow& row, V* sums)
+		{
+			constexpr uint32_t COUNT = BANDS * BANDS;
+			const V u = (V::Ramp() + V(x + 0.5f)) * V(step) - V(1.0f);
+			const V dx = V(row.origin.x) + u * V(row.uAxis.x);
+			const V dy = V(row.origin.y) + u * V(row.uAxis.y);
+			const V dz = V(row.origin.z) + u * V(row.uAxis.z);
+			const V inverseLength = V::InverseSqrt(dx * dx + dy * dy + dz * dz);
+
+			V basis[COUNT];
+			Basis<BANDS>(dx * inverseLength, dy * inverseLength, dz * inverseLength, basis);
+			V r, g, b;
+			V::LoadRGB(texels + (size_t)x * 4, r, g, b);
+			const V weight = V::Load(weights + x);
+			for (uint32_t k = 0; k < COUNT; ++k)
+			{
+				const V weighted = basis[k] * weight;
+				sums[k * 3 + 0] = sums[k * 3 + 0] + weighted * r;
+				sums[k * 3 + 1] = sums[k * 3 + 1] + weighted * g;
+				sums[k * 3 + 2] = sums[k * 3 + 2] + weighted * b;
+			}
+		}
+
+		// Sums over one row of [size] texels: [V::WIDTH] per iteration, the rest one by one.
+		// Lanes are added in a fixed order, in double.
+		template<typename V, uint32_t BANDS>
+		void ProjectRow(const float* texels, const float* weights, uint32_t size, const FaceRow& row, double* outSums)
+		{
+			constexpr uint32_t COUNT = BANDS * BANDS;
+			const float step = 2.0f / size;
+
+			V sums[COUNT * 3];
+			for (V& sum : sums)
+				sum = V(0.0f);
+			uint32_t x = 0;
+			for (; x + V::WIDTH <= size; x += V::WIDTH)
+				AccumulateTexels<V, BANDS>(texels, weights, step, x, row, sums);
+
+			Float1 tail[COUNT * 3];
+			for (Float1& sum : tail)
+				sum = 0.0f;
+			for (; x < size; ++x)
+				AccumulateTexels<Float1, BANDS>(texels, weights, step, x, row, tail);
+
+			for (uint32_t i = 0; i < COUNT * 3; ++i)
+				outSums[i] = V::Sum(sums[i]) + tail[i].v;
+		}
+
+		template<typename V>
+		RowFunction GetRowFunction(uint32_t bands)
+		{
+			return bands > 3 ? ProjectRow<V, 4> : ProjectRow<V, 3>;
+		}
+	}
+}
@@ -1,5 +1,7 @@
 #include "stdafx.h"
 #include "STexture.h"
+#include "FileHash.h"
+#include "PixelConvert.h"
 
 #include <ImfRgbaFile.h>
 #include <ImfArray.h>
@@ -9,16 +11,18 @@
 #include <ImfStringAttribute.h>
 #include <ImfIntAttribute.h>
 #include <ImfChannelList.h>
+#include <ImfThreading.h>
 #include <ImfFrameBuffer.h>
 #include <ImfNamespace.h>
 #include <ImathBox.h>
 
 #include <vector>
+#include <chrono>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-void STexture::_LoadEXR(const char* filename)
+TextureData STexture::_LoadEXR(const char* filename)
 {
 	TextureData res;
 	res.name = filename;
@@ -145,9 +149,14 @@ void STexture::_LoadEXR(const char* filename)
 	res.pixelSize = overrideChannelCount * channelSize;
 	res.reserve(res.width * res.height * res.pixelSize);
 
-	char* basePtr = static_cast<char*>(res.data())
-		- dw.min.x * res.pixelSize
-		- dw.min.y * res.width * res.pixelSize;
+	// Channels are read tightly packed, then widened when the format has more of them
+	const uint32_t readPixelSize = inputChannelCount * channelSize;
+	std::vector<char> readBuffer(readPixelSize != res.pixelSize ? (size_t)res.width * res.height * readPixelSize : 0);
+	char* readData = readBuffer.empty() ? res.data() : readBuffer.data();
+
+	char* basePtr = readData
+		- dw.min.x * readPixelSize
+		- dw.min.y * res.width * readPixelSize;
 
 	Imf::FrameBuffer frameBuffer;
 
@@ -158,8 +167,8 @@ void STexture::_LoadEXR(const char* filename)
 	{
 		frameBuffer.insert("R", Imf::Slice(pixelType,
 			basePtr + _offset * channelSize,    // Offset
-			res.pixelSize,          // Stride
-			res.width * res.pixelSize   // Row stride
+			readPixelSize,          // Stride
+			res.width * readPixelSize   // Row stride
 		));
 		++_offset;
 	}
@@ -169,8 +178,8 @@ void STexture::_LoadEXR(const char* filename)
 	{
 		frameBuffer.insert("G", Imf::Slice(pixelType,
 			basePtr + _offset * channelSize,
-			res.pixelSize,
-			res.width * res.pixelSize
+			readPixelSize,
+			res.width * readPixelSize
 		));
 		++_offset;
 	}
@@ -180,8 +189,8 @@ void STexture::_LoadEXR(const char* filename)
 	{
 		frameBuffer.insert("B", Imf::Slice(pixelType,
 			basePtr + _offset * channelSize,
-			res.pixelSize,
-			res.width * res.pixelSize
+			readPixelSize,
+			res.width * readPixelSize
 		));
 		++_offset;
 	}
@@ -191,8 +200,8 @@ void STexture::_LoadEXR(const char* filename)
 	{
 		frameBuffer.insert("A", Imf::Slice(pixelType,
 			basePtr + _offset * channelSize,
-			res.pixelSize,
-			res.width * res.pixelSize
+			readPixelSize,
+			res.width * readPixelSize
 		));
 		++_offset;
 	}
@@ -202,8 +211,8 @@ void STexture::_LoadEXR(const char* filename)
 	{
 		frameBuffer.insert("Y", Imf::Slice(pixelType,
 			basePtr + _offset * channelSize,
-			res.pixelSize,
-			res.width * res.pixelSize
+			readPixelSize,
+			res.width * readPixelSize
 		));
 		++_offset;
 	}
@@ -211,15 +220,25 @@ void STexture::_LoadEXR(const char* filename)
 	file.setFrameBuffer(frameBuffer);
 	file.readPixels(dw.min.y, dw.max.y);
 
-	m_textures.push_back(std::move(res));
+	if (!readBuffer.empty())
+	{
+		// RGB half to RGBA, alpha 1.0
+		const uint8_t map[4] = { 0, 1, 2, PixelConvert::FILL };
+		const uint32_t fill[4] = { 0, 0, 0, 0x3C00 };
+		PixelConvert::Swizzle(readData, inputChannelCount, res.data(), overrideChannelCount, channelSize, map, fill, (size_t)res.width * res.height);
+	}
+
+	return res;
 }
 
-void STexture::_LoadStbi(const char* filename)
+TextureData STexture::_LoadStbi(const char* filename)
 {
 	int width, height, pixelSize;
 	uint8_t* rgb_image = stbi_load(filename, &width, &height, &pixelSize, 0);
+	if (!rgb_image)
+		throw std::runtime_error(string_format("Failed to load texture %s: %s", filename, stbi_failure_reason()));
 
-	// Assume 8 bit sRGB RGB-A image
+	// Assume 8 bit sRGB RGB-A image. Gray is spread over RGB, missing alpha is opaque.
 	TextureData res;
 	res.width = width;
 	res.height = height;
@@ -227,54 +246,167 @@ void STexture::_LoadStbi(const char* filename)
 	res.format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
 	res.name = filename;
 	res.reserve(width * height * 4);
-	char* basePtr = res.data();
-	memset(basePtr, 255, res.size());
-	for (uint32_t i = 0; i < res.width * res.height; ++i)
-		memcpy_s(&basePtr[4 * i], pixelSize, &rgb_image[pixelSize * i], pixelSize);
+	PixelConvert::ToRGBA8(rgb_image, pixelSize, (uint8_t*)res.data(), (size_t)width * height);
 	stbi_image_free(rgb_image);
 
-	m_textures.push_back(std::move(res));
+	return res;
+}
+
+TextureData STexture::Decode(const std::string& filename)
+{
+	return ends_with(filename, ".exr") ? _LoadEXR(filename.c_str()) : _LoadStbi(filename.c_str());
+}
+
+std::vector<uint16_t> STexture::DecodeHalfRGBA(const std::string& filename, uint32_t& outWidth, uint32_t& outHeight)
+{
+	TextureData decoded = Decode(filename);
+	outWidth = decoded.width;
+	outHeight = decoded.height;
+	const size_t count = (size_t)decoded.width * decoded.height;
+	std::vector<uint16_t> result(count * 4);
+	switch (decoded.format)
+	{
+	case DXGI_FORMAT_R16G16B16A16_FLOAT:
+		memcpy(result.data(), decoded.data(), result.size() * sizeof(uint16_t));
+		break;
+	case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		PixelConvert::FloatToHalf((const float*)decoded.data(), result.data(), result.size());
+		break;
+	case DXGI_FORMAT_R32G32B32_FLOAT:
+	{
+		const uint8_t map[4] = { 0, 1, 2, PixelConvert::FILL };
+		const float one = 1.0f;
+		uint32_t fill[4] = {};
+		memcpy(&fill[3], &one, sizeof(one));
+		std::vector<float> rgba(count * 4);
+		PixelConvert::Swizzle(decoded.data(), 3, rgba.data(), 4, sizeof(float), map, fill, count);
+		PixelConvert::FloatToHalf(rgba.data(), result.data(), result.size());
+		break;
+	}
+	default:
+		throw std::runtime_error(string_format("%s is not an RGB(A) float image", filename.c_str()));
+	}
+	return result;
+}
+
+STextureCache::Texture STexture::_LoadCooked(const std::string& filename, const STextureCache::Settings& settings)
+{
+	STextureCache::Texture res;
+	res.name = filename;
+
+	const uint64_t sourceHash = HashFile(filename.c_str());
+	const uint64_t settingsHash = STextureCache::HashSettings(settings);
+	const std::string cachePath = STextureCache::GetCachePath(filename.c_str());
+
+	// A source that can't be hashed is never cached, decoding reports why it can't be read
+	if (sourceHash != 0
+		&& res.file.Open(cachePath.c_str())
+		&& STextureCache::Validate(res.file.data(), res.file.size(), sourceHash, settingsHash, res.view))
+		return res;
+	res.file.Close();
+
+	TextureData decoded = Decode(filename);
+	assert(decoded.pixelSize == STextureCache::GetPixelSize(decoded.format));
+	STextureCache::Cook(decoded.data(), decoded.format, decoded.width, decoded.height, settings, sourceHash, res.image);
+	if (!STextureCache::Validate(res.image.data(), res.image.size(), sourceHash, settingsHash, res.view))
+		throw std::runtime_error(string_format("Failed to cook texture %s", filename.c_str()));
+
+	if (sourceHash != 0 && !STextureCache::Write(cachePath.c_str(), res.image))
+		OutputDebugStringA(string_format("STexture: failed to write %s\n", cachePath.c_str()).c_str());
+	return res;
 }
 
-void STexture::AddTexture(std::string filename)
+bool STexture::CookFile(const char* source, const char* output, const STextureCache::Settings& settings)
+{
+	const uint64_t sourceHash = HashFile(source);
+	if (sourceHash == 0)
+		return false;
+
+	TextureData decoded = Decode(source);
+	std::vector<uint8_t> image;
+	STextureCache::Cook(decoded.data(), decoded.format, decoded.width, decoded.height, settings, sourceHash, image);
+	return STextureCache::Write(output, image);
+}
+
+void STexture::AddTexture(std::string filename, const STextureCache::Settings& settings)
 {
 	m_textureFilenames.push_back(filename);
+	m_textureSettings.push_back(settings);
+}
+
+void STexture::AddCooked(STextureCache::Texture texture)
+{
+	m_textures.push_back(std::move(texture));
+}
+
+void STexture::LoadTextures(uint32_t maxThreads)
+{
+	STexture* texture = this;
+	LoadTextures(&texture, 1, maxThreads);
 }
 
-void STexture::LoadTextures()
+void STexture::LoadTextures(STexture* const* textures, size_t count, uint32_t maxThreads)
 {
-	for (std::string filename : m_textureFilenames)
+	auto start = std::chrono::high_resolution_clock::now();
+
+	// One job per file, across all textures
+	struct Job
 	{
-		if (ends_with(filename, ".exr"))
-		{
-			_LoadEXR(filename.c_str());
-		}
-		else
-		{
-			_LoadStbi(filename.c_str());
-		}
+		STexture* texture;
+		const std::string* filename;
+		const STextureCache::Settings* settings;
+		STextureCache::Texture result;
+		};
+	std::vector<Job> jobs;
+	for (size_t t = 0; t < count; ++t)
+	{
+		for (size_t i = 0; i < textures[t]->m_textureFilenames.size(); ++i)
+			jobs.push_back({ textures[t], &textures[t]->m_textureFilenames[i], &textures[t]->m_textureSettings[i] });
+	}
+	if (jobs.empty())
+		return;
+
+	// OpenEXR decodes the lines of a file on its own global pool. Give it the cores our workers leave idle,
+	// and all of them to a lone file, instead of letting both pools claim every core.
+	const uint32_t threadCount = maxThreads ? maxThreads : std::max(1u, std::thread::hardware_concurrency());
+	const uint32_t workerCount = std::min(threadCount, (uint32_t)jobs.size());
+	Imf::setGlobalThreadCount(workerCount == 1 ? threadCount : threadCount - workerCount);
+
+	ParallelForRethrow((uint32_t)jobs.size(), [&](uint32_t i)
+	{
+		jobs[i].result = _LoadCooked(*jobs[i].filename, *jobs[i].settings);
+	}, workerCount);
+
+	// Jobs are in file order, so every texture's list keeps the order the files were added in
+	size_t cached = 0;
+	for (Job& job : jobs)
+	{
+		cached += job.result.file.loaded() ? 1 : 0;
+		job.texture->m_textures.push_back(std::move(job.result));
 	}
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	OutputDebugStringA(string_format("STexture: %zu files loaded (%zu from cache) in %.2f ms on %u threads\n", jobs.size(), cached, elapsed.count(), workerCount).c_str());
 }
 
 void STexture::CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, DescHeapWrapper& hh)
 {
-	std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> tex_SRVCPUHandles;
-
 	// Create upload heaps and data heaps
 	// Schedule copy
-	for (TextureData& tex : m_textures)
+	for (STextureCache::Texture& tex : m_textures)
 	{
+		const STextureCache::View& view = tex.view;
 		ComPtr<ID3D12Resource> uploadHeap;
 		ComPtr<ID3D12Resource> dataHeap;
 		D3D12_CPU_DESCRIPTOR_HANDLE SRVCPUHandle;
 
 		D3D12_RESOURCE_DESC textureDesc = {};
-		textureDesc.MipLevels = 0;  // 0: Auto calculate mipmaps level
-		textureDesc.Format = tex.format;
-		textureDesc.Width = tex.width;
-		textureDesc.Height = tex.height;
+		textureDesc.MipLevels = (UINT16)view.mipCount;  // Every level is cooked
+		textureDesc.Format = view.format;
+		textureDesc.Width = view.width;
+		textureDesc.Height = view.height;
 		textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-		textureDesc.DepthOrArraySize = 1;
+		textureDesc.DepthOrArraySize = (UINT16)view.arraySize;
 		textureDesc.SampleDesc.Count = 1;
 		textureDesc.SampleDesc.Quality = 0;
 		textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
@@ -286,43 +418,77 @@ void STexture::CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList*
 			D3D12_RESOURCE_STATE_COMMON,
 			nullptr,
 			IID_PPV_ARGS(&dataHeap)));
-		dataHeap->SetName((LPCWSTR)tex.name.c_str());
+		dataHeap->SetName(std::wstring(tex.name.begin(), tex.name.end()).c_str());
 
-		const UINT64 uploadBufferSize = GetRequiredIntermediateSize(dataHeap.Get(), 0, 1);
+		// The data block is already laid out as placed footprints: copy it whole, then each mip out of it
 		ThrowIfFailed(device->CreateCommittedResource(
 			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 			D3D12_HEAP_FLAG_NONE,
-			&CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize),
+			&CD3DX12_RESOURCE_DESC::Buffer(view.dataSize),
 			D3D12_RESOURCE_STATE_GENERIC_READ,
 			nullptr,
 			IID_PPV_ARGS(&uploadHeap)));
 
-		D3D12_SUBRESOURCE_DATA textureData = {};
-		textureData.pData = tex.data();
-		textureData.RowPitch = tex.width * tex.pixelSize;
-		textureData.SlicePitch = textureData.RowPitch * tex.height;
+		void* uploadData;
+		CD3DX12_RANGE readRange(0, 0);  // We do not intend to read from this resource on the CPU.
+		ThrowIfFailed(uploadHeap->Map(0, &readRange, &uploadData));
+		memcpy(uploadData, view.data, (size_t)view.dataSize);
+		uploadHeap->Unmap(0, nullptr);
 
 		SRVCPUHandle = hh.AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
 		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 		srvDesc.Format = textureDesc.Format;
-		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Texture2D.MipLevels = dataHeap->GetDesc().MipLevels;
+		if (view.cubemap)
+		{
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+			srvDesc.TextureCube.MipLevels = view.mipCount;
+		}
+		else if (view.arraySize > 1)
+		{
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+			srvDesc.Texture2DArray.MipLevels = view.mipCount;
+			srvDesc.Texture2DArray.ArraySize = view.arraySize;
+		}
+		else
+		{
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MipLevels = view.mipCount;
+		}
 		device->CreateShaderResourceView(dataHeap.Get(), &srvDesc, SRVCPUHandle);
 		m_SRVsSeparated.push_back(hh.CopyDescriptorsToGPUHeap(1, SRVCPUHandle));
 
-		UpdateSubresources(cmdList, dataHeap.Get(), uploadHeap.Get(), 0, 0, 1, &textureData);
+		static_assert(STextureCache::PLACEMENT_ALIGNMENT == D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+			&& STextureCache::PITCH_ALIGNMENT == D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, "The .stex layout no longer matches D3D12");
+		const bool blockCompressed = STextureCache::GetBlockSize(view.format) != 0;
+		// Subresources are stored in D3D12 order, the mips of one slice after the other
+		for (uint32_t i = 0; i < view.mipCount * view.arraySize; ++i)
+		{
+			const STextureCache::Mip& mip = view.mips[i];
+			D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = {};
+			footprint.Offset = mip.offset;
+			footprint.Footprint.Format = view.format;
+			// Block compressed footprints cover whole blocks, even for the 2 x 2 and 1 x 1 levels
+			footprint.Footprint.Width = blockCompressed ? (mip.width + 3) & ~3u : mip.width;
+			footprint.Footprint.Height = blockCompressed ? (mip.height + 3) & ~3u : mip.height;
+			footprint.Footprint.Depth = 1;
+			footprint.Footprint.RowPitch = mip.rowPitch;
+
+			CD3DX12_TEXTURE_COPY_LOCATION dst(dataHeap.Get(), i);
+			CD3DX12_TEXTURE_COPY_LOCATION src(uploadHeap.Get(), footprint);
+			cmdList->CopyTextureRegion(&dst, 0, 0, 0, &src, nullptr);
+		}
 		cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(dataHeap.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
 
 		m_textureResources.push_back(std::move(dataHeap));
 		m_uploadHeaps.push_back(std::move(uploadHeap));
-		tex_SRVCPUHandles.push_back(SRVCPUHandle);
+		m_SRVsCPU.push_back(SRVCPUHandle);
 	}
 
 	// Upload descriptors
 	CD3DX12_CPU_DESCRIPTOR_HANDLE CPUHandle;
-	hh.AllocateGPUDescriptors(tex_SRVCPUHandles.size(), CPUHandle, m_SRVCombined);
-	for (auto& handle : tex_SRVCPUHandles)
+	hh.AllocateGPUDescriptors(m_SRVsCPU.size(), CPUHandle, m_SRVCombined);
+	for (auto& handle : m_SRVsCPU)
 	{
 		device->CopyDescriptorsSimple(1, CPUHandle, handle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 		CPUHandle.Offset(1, hh.GetDescriptorSizeCBV_SRV_UAV());
@@ -343,5 +509,6 @@ void STexture::ReleaseGPUData()
 {
 	m_SRVCombined.ptr = 0;
 	m_SRVsSeparated.clear();
+	m_SRVsCPU.clear();
 	m_textureResources.clear();
 }
@@ -2,6 +2,7 @@
 
 #include "HelperFunctions.h"
 #include "DescHeapWrapper.h"
+#include "STextureCache.h"
 
 #include <string>
 
@@ -135,7 +136,9 @@ public:
 		m_uploadHeaps = other.m_uploadHeaps;
 		m_SRVCombined = other.m_SRVCombined;
 		m_SRVsSeparated = other.m_SRVsSeparated;
+		m_SRVsCPU = other.m_SRVsCPU;
 		m_textureFilenames = other.m_textureFilenames;
+		m_textureSettings = other.m_textureSettings;
 	}
 
 	// Copy Assignment operator
@@ -149,7 +152,9 @@ public:
 			m_uploadHeaps = other.m_uploadHeaps;
 			m_SRVCombined = other.m_SRVCombined;
 			m_SRVsSeparated = other.m_SRVsSeparated;
+		m_SRVsCPU = other.m_SRVsCPU;
 			m_textureFilenames = other.m_textureFilenames;
+			m_textureSettings = other.m_textureSettings;
 		}
 		return *this;
 	}
@@ -161,7 +166,9 @@ public:
 		m_uploadHeaps = std::move(other.m_uploadHeaps);
 		m_SRVCombined = std::move(other.m_SRVCombined);
 		m_SRVsSeparated = std::move(other.m_SRVsSeparated);
+		m_SRVsCPU = std::move(other.m_SRVsCPU);
 		m_textureFilenames = std::move(other.m_textureFilenames);
+		m_textureSettings = std::move(other.m_textureSettings);
 	}
 
 	// Move Assignment operator
@@ -176,42 +183,65 @@ public:
 			m_uploadHeaps = std::move(other.m_uploadHeaps);
 			m_SRVCombined = std::move(other.m_SRVCombined);
 			m_SRVsSeparated = std::move(other.m_SRVsSeparated);
+			m_SRVsCPU = std::move(other.m_SRVsCPU);
 			m_textureFilenames = std::move(other.m_textureFilenames);
+			m_textureSettings = std::move(other.m_textureSettings);
 		}
 		return *this;
 	}
 private:
-	std::vector<TextureData> m_textures;
+	std::vector<STextureCache::Texture> m_textures;
 	std::vector<ComPtr<ID3D12Resource>> m_textureResources;
 	std::vector<ComPtr<ID3D12Resource>> m_uploadHeaps;
 	D3D12_GPU_DESCRIPTOR_HANDLE m_SRVCombined;
 	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> m_SRVsSeparated;
+	std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> m_SRVsCPU;  // Sources of the GPU descriptors above
 
 	// Pending lists that stores textures to be loaded later
 	// Note textures are not loaded until LoadTextures() is called
 	std::vector<std::string> m_textureFilenames;
+	std::vector<STextureCache::Settings> m_textureSettings;  // Cooker settings of each file
 
 public:
 	inline ComPtr<ID3D12Resource>& GetTextureResource(uint32_t index) { return m_textureResources[index]; }
 	inline D3D12_GPU_DESCRIPTOR_HANDLE GetCombinedSRV() { return m_SRVCombined; }
 	inline D3D12_GPU_DESCRIPTOR_HANDLE GetSRV(uint32_t index) { return m_SRVsSeparated[index]; }
+	// Non shader visible SRV, for copying into other descriptor tables
+	inline D3D12_CPU_DESCRIPTOR_HANDLE GetCPUSRV(uint32_t index) { return m_SRVsCPU[index]; }
 	inline size_t size() { return m_textureFilenames.size(); }
 	
 
 private:
-	void _LoadEXR(const char* filename);
-	void _LoadStbi(const char* filename);
+	static TextureData _LoadEXR(const char* filename);
+	static TextureData _LoadStbi(const char* filename);
+	// The .stex cache of [filename] if it is up to date, otherwise decodes and cooks the file and refreshes the cache
+	static STextureCache::Texture _LoadCooked(const std::string& filename, const STextureCache::Settings& settings);
 	
 public:
-	// Push a texture filename to the pending list
+	// Push a texture filename to the pending list, to be cooked with [settings]
 	// Note textures are not loaded until LoadTextures() is called
-	void AddTexture(std::string filename);
-
-	// Load any added texture files into CPU memory
-	// Pending list will be cleared after loading
-	void LoadTextures();
-
-	// Copy texture data to upload heap
+	void AddTexture(std::string filename, const STextureCache::Settings& settings = {});
+	// Add a texture that is already cooked, e.g. a mapped cache or an image cooked from GPU output,
+	// to be uploaded by the next CopyToUploadHeap()
+	void AddCooked(STextureCache::Texture texture);
+
+	// Decode an image file (.exr through OpenEXR, anything else through stb_image) without cooking it
+	static TextureData Decode(const std::string& filename);
+	// Decode an HDRI to the half RGBA texels SIBLBaker::Bake takes
+	static std::vector<uint16_t> DecodeHalfRGBA(const std::string& filename, uint32_t& outWidth, uint32_t& outHeight);
+
+	// Decodes [source] and writes it cooked with [settings] to [output]
+	static bool CookFile(const char* source, const char* output, const STextureCache::Settings& settings);
+
+	// Load any added texture files into CPU memory, cooked with their whole mip chain
+	// Up to date .stex caches are mapped instead of decoding their source
+	// Files are decoded in parallel on up to [maxThreads] threads (0: one per core)
+	void LoadTextures(uint32_t maxThreads = 0);
+	// LoadTextures for [count] textures at once, so decoding is spread over the files of all of them
+	static void LoadTextures(STexture* const* textures, size_t count, uint32_t maxThreads = 0);
+
+	// Copy texture data to upload heap, every cooked mip level and array slice included
+	// Cubemaps get a TEXTURECUBE SRV, other arrays a TEXTURE2DARRAY one
 	// This function expects that the command list is in recording state
 	void CopyToUploadHeap(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, DescHeapWrapper& hh);
 
@@ -0,0 +1,541 @@
+#include "STextureCache.h"
+#include "FileHash.h"
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+#include "STextureCompression.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+	enum class ChannelType
+	{
+		UNORM8,
+		SRGB8,
+		HALF,
+		FLOAT,
+	};
+
+	struct FormatInfo
+	{
+		ChannelType type;
+		uint32_t channels;
+	};
+
+	bool GetFilterFormat(DXGI_FORMAT format, FormatInfo& out)
+	{
+		switch (format)
+		{
+		case DXGI_FORMAT_R8G8B8A8_UNORM:      out = { ChannelType::UNORM8, 4 }; return true;
+		case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB: out = { ChannelType::SRGB8, 4 }; return true;
+		case DXGI_FORMAT_R16_FLOAT:           out = { ChannelType::HALF, 1 }; return true;
+		case DXGI_FORMAT_R16G16_FLOAT:        out = { ChannelType::HALF, 2 }; return true;
+		case DXGI_FORMAT_R16G16B16A16_FLOAT:  out = { ChannelType::HALF, 4 }; return true;
+		case DXGI_FORMAT_R32_FLOAT:           out = { ChannelType::FLOAT, 1 }; return true;
+		case DXGI_FORMAT_R32G32_FLOAT:        out = { ChannelType::FLOAT, 2 }; return true;
+		case DXGI_FORMAT_R32G32B32_FLOAT:     out = { ChannelType::FLOAT, 3 }; return true;
+		case DXGI_FORMAT_R32G32B32A32_FLOAT:  out = { ChannelType::FLOAT, 4 }; return true;
+		default: return false;
+		}
+	}
+
+	inline uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	// sRGB texels are filtered in linear space. Alpha stays linear.
+	void DecodeRow(const uint8_t* src, uint32_t width, const FormatInfo& info, float* dst)
+	{
+		const uint32_t count = width * info.channels;
+		switch (info.type)
+		{
+		case ChannelType::UNORM8:
+			PixelConvert::UNorm8ToFloat(src, dst, count);
+			break;
+		case ChannelType::SRGB8:
+			PixelConvert::SRGBA8ToLinear(src, dst, width);
+			break;
+		case ChannelType::HALF:
+			PixelConvert::HalfToFloat((const uint16_t*)src, dst, count);
+			break;
+		case ChannelType::FLOAT:
+			memcpy(dst, src, count * sizeof(float));
+			break;
+		}
+	}
+
+	void EncodeRow(const float* src, uint32_t width, const FormatInfo& info, uint8_t* dst)
+	{
+		const uint32_t count = width * info.channels;
+		switch (info.type)
+		{
+		case ChannelType::UNORM8:
+			PixelConvert::FloatToUNorm8(src, dst, count);
+			break;
+		case ChannelType::SRGB8:
+			PixelConvert::LinearToSRGBA8(src, dst, width);
+			break;
+		case ChannelType::HALF:
+			PixelConvert::FloatToHalf(src, (uint16_t*)dst, count);
+			break;
+		case ChannelType::FLOAT:
+			memcpy(dst, src, count * sizeof(float));
+			break;
+		}
+	}
+
+	// Swizzle of [channels] channels to RGBA, the missing ones filled
+	inline void ExpandToRGBA(const void* src, uint32_t channels, void* dst, uint32_t channelSize, uint32_t alpha, uint32_t width)
+	{
+		const uint8_t map[4] = { 0, channels > 1 ? (uint8_t)1 : PixelConvert::FILL, channels > 2 ? (uint8_t)2 : PixelConvert::FILL, channels > 3 ? (uint8_t)3 : PixelConvert::FILL };
+		const uint32_t fill[4] = { 0, 0, 0, alpha };
+		PixelConvert::Swizzle(src, channels, dst, 4, channelSize, map, fill, width);
+	}
+
+	// Source texels covered by one destination texel, and how much of it each one covers.
+	// A box filter with fractional weights: odd sizes blend 3 texels instead of dropping a row or column.
+	struct Taps
+	{
+		uint32_t first;
+		uint32_t count;
+		float weights[4];
+	};
+
+	std::vector<Taps> MakeTaps(uint32_t srcSize, uint32_t dstSize)
+	{
+		std::vector<Taps> taps(dstSize);
+		const double ratio = (double)srcSize / dstSize;
+		for (uint32_t d = 0; d < dstSize; ++d)
+		{
+			const double begin = d * ratio;
+			const double end = (d + 1) * ratio;
+			Taps& t = taps[d];
+			t.first = (uint32_t)begin;
+			t.count = std::min((uint32_t)ceil(end), srcSize) - t.first;
+			assert(t.count <= 4);
+			for (uint32_t i = 0; i < t.count; ++i)
+			{
+				const double texel = t.first + i;
+				t.weights[i] = (float)((std::min(end, texel + 1.0) - std::max(begin, texel)) / ratio);
+			}
+		}
+		return taps;
+	}
+
+	// Filters placed mip [src] down into placed mip [dst]
+	void Downsample(const uint8_t* data, const STextureCache::Mip& src, const STextureCache::Mip& dstMip, uint8_t* out, const FormatInfo& info)
+	{
+		const std::vector<Taps> tapsX = MakeTaps(src.width, dstMip.width);
+		const std::vector<Taps> tapsY = MakeTaps(src.height, dstMip.height);
+		const uint32_t channels = info.channels;
+
+		constexpr uint32_t ROWS_PER_JOB = 32;
+		ParallelFor((dstMip.height + ROWS_PER_JOB - 1) / ROWS_PER_JOB, [&](uint32_t job)
+		{
+			std::vector<float> decoded(src.width * channels);
+			std::vector<float> column(src.width * channels);
+			std::vector<float> filtered(dstMip.width * channels);
+
+			const uint32_t yEnd = std::min((job + 1) * ROWS_PER_JOB, dstMip.height);
+			for (uint32_t y = job * ROWS_PER_JOB; y < yEnd; ++y)
+			{
+				// Vertical pass over full source rows, then horizontal
+				const Taps& ty = tapsY[y];
+				std::fill(column.begin(), column.end(), 0.0f);
+				for (uint32_t i = 0; i < ty.count; ++i)
+				{
+					DecodeRow(data + src.offset + (uint64_t)(ty.first + i) * src.rowPitch, src.width, info, decoded.data());
+					for (size_t c = 0; c < column.size(); ++c)
+						column[c] += decoded[c] * ty.weights[i];
+				}
+
+				for (uint32_t x = 0; x < dstMip.width; ++x)
+				{
+					const Taps& tx = tapsX[x];
+					for (uint32_t c = 0; c < channels; ++c)
+					{
+						float sum = 0.0f;
+						for (uint32_t i = 0; i < tx.count; ++i)
+							sum += column[(tx.first + i) * channels + c] * tx.weights[i];
+						filtered[x * channels + c] = sum;
+					}
+				}
+
+				EncodeRow(filtered.data(), dstMip.width, info, out + dstMip.offset + (uint64_t)y * dstMip.rowPitch);
+			}
+		});
+	}
+
+	STextureCache::Header MakeHeader(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t arraySize, uint32_t flags,
+		uint64_t sourceHash, uint64_t settingsHash)
+	{
+		STextureCache::Header header = {};
+		header.magic = STextureCache::MAGIC;
+		header.formatVersion = STextureCache::FORMAT_VERSION;
+		header.toolVersion = STextureCache::TOOL_VERSION;
+		header.format = format;
+		header.width = width;
+		header.height = height;
+		header.mipCount = mipCount;
+		header.arraySize = arraySize;
+		header.flags = flags;
+		header.sourceHash = sourceHash;
+		header.settingsHash = settingsHash;
+
+		uint64_t offset = 0;
+		for (uint32_t i = 0; i < mipCount * arraySize; ++i)
+		{
+			STextureCache::Mip& mip = header.mips[i];
+			mip.width = std::max(width >> (i % mipCount), 1u);
+			mip.height = std::max(height >> (i % mipCount), 1u);
+			STextureCache::GetMipLayout(format, mip.width, mip.height, mip.rowSize, mip.rowCount);
+			mip.rowPitch = (uint32_t)AlignUp(mip.rowSize, STextureCache::PITCH_ALIGNMENT);
+			mip.offset = AlignUp(offset, STextureCache::PLACEMENT_ALIGNMENT);
+			offset = mip.offset + (uint64_t)mip.rowPitch * mip.rowCount;
+		}
+		header.dataOffset = AlignUp(sizeof(STextureCache::Header), STextureCache::PLACEMENT_ALIGNMENT);
+		header.dataSize = offset;
+		header.fileSize = header.dataOffset + header.dataSize;
+		return header;
+	}
+
+	STextureCompression::Format ToCompressionFormat(STextureCache::Compression compression)
+	{
+		switch (compression)
+		{
+		case STextureCache::Compression::BC1: return STextureCompression::Format::BC1;
+		case STextureCache::Compression::BC4: return STextureCompression::Format::BC4;
+		case STextureCache::Compression::BC5: return STextureCompression::Format::BC5;
+		case STextureCache::Compression::BC6H: return STextureCompression::Format::BC6H;
+		default: return STextureCompression::Format::BC7;
+		}
+	}
+
+	// The block compressed format a texture is cooked to, or DXGI_FORMAT_UNKNOWN to keep it uncompressed.
+	// D3D12 needs the top level of a block compressed texture to be made of whole blocks.
+	DXGI_FORMAT GetCompressedFormat(DXGI_FORMAT format, uint32_t width, uint32_t height, STextureCache::Compression compression)
+	{
+		FormatInfo info = {};
+		if (compression == STextureCache::Compression::None || !GetFilterFormat(format, info) || width % 4 != 0 || height % 4 != 0)
+			return DXGI_FORMAT_UNKNOWN;
+
+		const bool sRGB = info.type == ChannelType::SRGB8;
+		const bool HDR = info.type == ChannelType::HALF || info.type == ChannelType::FLOAT;
+		switch (compression)
+		{
+		case STextureCache::Compression::BC1: return sRGB ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+		case STextureCache::Compression::BC4: return DXGI_FORMAT_BC4_UNORM;
+		case STextureCache::Compression::BC5: return DXGI_FORMAT_BC5_UNORM;
+		case STextureCache::Compression::BC6H: return HDR ? DXGI_FORMAT_BC6H_UF16 : DXGI_FORMAT_UNKNOWN;
+		case STextureCache::Compression::BC7: return sRGB ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+		default: return DXGI_FORMAT_UNKNOWN;
+		}
+	}
+
+	// A placed mip as 8-bit RGBA, the input of the block compressor. 8-bit texels are copied unchanged,
+	// so sRGB stays sRGB; float channels are clamped to [0, 1]. Missing channels are 0, alpha 255.
+	void ToRGBA8(const uint8_t* src, const STextureCache::Mip& mip, DXGI_FORMAT format, uint8_t* rgba)
+	{
+		FormatInfo info = {};
+		GetFilterFormat(format, info);
+		std::vector<float> row(mip.width * info.channels);
+		std::vector<uint8_t> bytes(mip.width * info.channels);
+		for (uint32_t y = 0; y < mip.height; ++y)
+		{
+			const uint8_t* in = src + (uint64_t)y * mip.rowPitch;
+			uint8_t* out = rgba + (uint64_t)y * mip.width * 4;
+			if (info.type == ChannelType::UNORM8 || info.type == ChannelType::SRGB8)
+			{
+				memcpy(out, in, mip.width * 4);
+				continue;
+			}
+
+			DecodeRow(in, mip.width, info, row.data());
+			PixelConvert::FloatToUNorm8(row.data(), bytes.data(), row.size());
+			ExpandToRGBA(bytes.data(), info.channels, out, 1, 255, mip.width);
+		}
+	}
+
+	// A placed mip of a half or float format as half RGBA, the input of the BC6H encoder. Missing channels are 0, alpha 1.
+	void ToRGBA16F(const uint8_t* src, const STextureCache::Mip& mip, DXGI_FORMAT format, uint8_t* rgba)
+	{
+		FormatInfo info = {};
+		GetFilterFormat(format, info);
+		std::vector<uint16_t> halves(mip.width * info.channels);
+		for (uint32_t y = 0; y < mip.height; ++y)
+		{
+			const uint8_t* in = src + (uint64_t)y * mip.rowPitch;
+			uint8_t* out = rgba + (uint64_t)y * mip.width * 8;
+			if (info.type == ChannelType::HALF)
+			{
+				ExpandToRGBA(in, info.channels, out, sizeof(uint16_t), 0x3C00, mip.width);
+				continue;
+			}
+
+			PixelConvert::FloatToHalf((const float*)in, halves.data(), halves.size());
+			ExpandToRGBA(halves.data(), info.channels, out, sizeof(uint16_t), 0x3C00, mip.width);
+		}
+	}
+
+	// Encodes every subresource of the uncompressed image [data] laid out by [header] into a complete image
+	// of [compressedFormat] in [outImage]
+	void Compress(const STextureCache::Header& header, const uint8_t* data, DXGI_FORMAT compressedFormat, const STextureCache::Settings& settings, std::vector<uint8_t>& outImage)
+	{
+		const DXGI_FORMAT format = (DXGI_FORMAT)header.format;
+		const STextureCompression::Format encoderFormat = ToCompressionFormat(settings.compression);
+		const uint32_t texelSize = STextureCompression::GetTexelSize(encoderFormat);
+
+		const STextureCache::Header compressed = MakeHeader(compressedFormat, header.width, header.height, header.mipCount, header.arraySize, header.flags,
+			header.sourceHash, header.settingsHash);
+		outImage.assign((size_t)compressed.fileSize, 0);
+		memcpy(outImage.data(), &compressed, sizeof(STextureCache::Header));
+		for (uint32_t i = 0; i < header.mipCount * header.arraySize; ++i)
+		{
+			const STextureCache::Mip& mip = header.mips[i];
+			std::vector<uint8_t> texels((size_t)mip.width * mip.height * texelSize);
+			if (encoderFormat == STextureCompression::Format::BC6H)
+				ToRGBA16F(data + mip.offset, mip, format, texels.data());
+			else
+				ToRGBA8(data + mip.offset, mip, format, texels.data());
+			STextureCompression::Encode(encoderFormat, texels.data(), mip.width, mip.height, (size_t)mip.width * texelSize,
+				outImage.data() + compressed.dataOffset + compressed.mips[i].offset, compressed.mips[i].rowPitch, settings.quality);
+		}
+	}
+}
+
+uint64_t STextureCache::HashSettings(const Settings& settings)
+{
+	return HashBytes(&settings, sizeof(Settings));
+}
+
+std::string STextureCache::GetCachePath(const char* sourceFilename)
+{
+	return std::string(sourceFilename) + ".stex";
+}
+
+uint32_t STextureCache::GetBlockSize(DXGI_FORMAT format)
+{
+	switch (format)
+	{
+	case DXGI_FORMAT_BC1_UNORM:
+	case DXGI_FORMAT_BC1_UNORM_SRGB:
+	case DXGI_FORMAT_BC4_UNORM:
+		return 8;
+	case DXGI_FORMAT_BC5_UNORM:
+	case DXGI_FORMAT_BC6H_UF16:
+	case DXGI_FORMAT_BC7_UNORM:
+	case DXGI_FORMAT_BC7_UNORM_SRGB:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+uint32_t STextureCache::GetPixelSize(DXGI_FORMAT format)
+{
+	switch (format)
+	{
+	case DXGI_FORMAT_R8G8B8A8_UNORM:
+	case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+	case DXGI_FORMAT_R16G16_FLOAT:
+	case DXGI_FORMAT_R32_FLOAT:
+	case DXGI_FORMAT_R32_UINT:
+		return 4;
+	case DXGI_FORMAT_R16_FLOAT:
+	case DXGI_FORMAT_R8G8_UNORM:
+		return 2;
+	case DXGI_FORMAT_R16G16B16A16_FLOAT:
+	case DXGI_FORMAT_R32G32_FLOAT:
+	case DXGI_FORMAT_R32G32_UINT:
+		return 8;
+	case DXGI_FORMAT_R32G32B32_FLOAT:
+	case DXGI_FORMAT_R32G32B32_UINT:
+		return 12;
+	case DXGI_FORMAT_R32G32B32A32_FLOAT:
+	case DXGI_FORMAT_R32G32B32A32_UINT:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+bool STextureCache::CanGenerateMips(DXGI_FORMAT format)
+{
+	FormatInfo info;
+	return GetFilterFormat(format, info);
+}
+
+bool STextureCache::GetMipLayout(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t& rowSize, uint32_t& rowCount)
+{
+	const uint32_t blockSize = GetBlockSize(format);
+	if (blockSize != 0)
+	{
+		rowSize = (width + 3) / 4 * blockSize;
+		rowCount = (height + 3) / 4;
+		return true;
+	}
+
+	const uint32_t pixelSize = GetPixelSize(format);
+	rowSize = width * pixelSize;
+	rowCount = height;
+	return pixelSize != 0;
+}
+
+void STextureCache::Cook(const void* pixels, DXGI_FORMAT format, uint32_t width, uint32_t height, const Settings& settings, uint64_t sourceHash, std::vector<uint8_t>& outImage)
+{
+	const uint32_t pixelSize = GetPixelSize(format);
+	if (pixelSize == 0)
+		throw std::runtime_error("STextureCache: unsupported texture format");
+	if (width == 0 || height == 0 || std::max(width, height) >= (1u << MAX_MIPS))
+		throw std::runtime_error("STextureCache: unsupported texture size");
+
+	// Full chain down to 1 x 1, as D3D12 computes it for MipLevels = 0
+	uint32_t mipCount = 1;
+	if (settings.generateMips && CanGenerateMips(format))
+	{
+		while ((std::max(width, height) >> mipCount) != 0)
+			++mipCount;
+	}
+
+	// Block compressed textures are cooked uncompressed first, then every level is compressed
+	const DXGI_FORMAT compressedFormat = GetCompressedFormat(format, width, height, settings.compression);
+	std::vector<uint8_t> uncompressed;
+	std::vector<uint8_t>& image = compressedFormat != DXGI_FORMAT_UNKNOWN ? uncompressed : outImage;
+
+	const Header header = MakeHeader(format, width, height, mipCount, 1, 0, sourceHash, HashSettings(settings));
+	image.assign((size_t)header.fileSize, 0);
+	memcpy(image.data(), &header, sizeof(Header));
+	uint8_t* data = image.data() + header.dataOffset;
+
+	const uint8_t* src = (const uint8_t*)pixels;
+	for (uint32_t y = 0; y < height; ++y)
+		memcpy(data + (uint64_t)y * header.mips[0].rowPitch, src + (uint64_t)y * header.mips[0].rowSize, header.mips[0].rowSize);
+
+	// Each level from the one above it
+	FormatInfo info;
+	if (header.mipCount > 1 && GetFilterFormat(format, info))
+	{
+		for (uint32_t i = 1; i < header.mipCount; ++i)
+			Downsample(data, header.mips[i - 1], header.mips[i], data, info);
+	}
+
+	if (compressedFormat != DXGI_FORMAT_UNKNOWN)
+		Compress(header, data, compressedFormat, settings, outImage);
+}
+
+void STextureCache::CookSubresources(const Subresource* subresources, DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t arraySize,
+	bool cubemap, const Settings& settings, uint64_t sourceHash, std::vector<uint8_t>& outImage)
+{
+	if (GetPixelSize(format) == 0)
+		throw std::runtime_error("STextureCache: unsupported texture format");
+	if (width == 0 || height == 0 || mipCount == 0 || mipCount > MAX_MIPS || (std::max(width, height) >> (mipCount - 1)) == 0
+		|| arraySize == 0 || mipCount * arraySize > MAX_SUBRESOURCES || (cubemap && arraySize % 6 != 0))
+		throw std::runtime_error("STextureCache: unsupported texture size");
+
+	const DXGI_FORMAT compressedFormat = GetCompressedFormat(format, width, height, settings.compression);
+	std::vector<uint8_t> uncompressed;
+	std::vector<uint8_t>& image = compressedFormat != DXGI_FORMAT_UNKNOWN ? uncompressed : outImage;
+
+	const Header header = MakeHeader(format, width, height, mipCount, arraySize, cubemap ? FLAG_CUBEMAP : 0, sourceHash, HashSettings(settings));
+	image.assign((size_t)header.fileSize, 0);
+	memcpy(image.data(), &header, sizeof(Header));
+	uint8_t* data = image.data() + header.dataOffset;
+
+	for (uint32_t i = 0; i < mipCount * arraySize; ++i)
+	{
+		const Mip& mip = header.mips[i];
+		const uint8_t* src = (const uint8_t*)subresources[i].data;
+		for (uint32_t y = 0; y < mip.rowCount; ++y)
+			memcpy(data + mip.offset + (uint64_t)y * mip.rowPitch, src + y * subresources[i].rowPitch, mip.rowSize);
+	}
+
+	if (compressedFormat != DXGI_FORMAT_UNKNOWN)
+		Compress(header, data, compressedFormat, settings, outImage);
+}
+
+bool STextureCache::Validate(const uint8_t* bytes, uint64_t size, uint64_t sourceHash, uint64_t settingsHash, View& outView)
+{
+	if (!bytes || size < sizeof(Header))
+		return false;
+
+	Header header;
+	memcpy(&header, bytes, sizeof(Header));
+	if (header.magic != MAGIC
+		|| header.formatVersion != FORMAT_VERSION
+		|| header.toolVersion != TOOL_VERSION
+		|| header.sourceHash != sourceHash
+		|| header.settingsHash != settingsHash
+		|| header.fileSize != size)
+		return false;
+
+	uint32_t rowSize, rowCount;
+	if (!GetMipLayout((DXGI_FORMAT)header.format, 1, 1, rowSize, rowCount)
+		|| header.mipCount == 0 || header.mipCount > MAX_MIPS
+		|| header.arraySize == 0 || header.mipCount * header.arraySize > MAX_SUBRESOURCES
+		|| (header.flags & ~FLAG_CUBEMAP) != 0
+		|| ((header.flags & FLAG_CUBEMAP) && header.arraySize % 6 != 0)
+		|| header.dataOffset < sizeof(Header)
+		|| header.dataOffset % STextureCache::PLACEMENT_ALIGNMENT != 0
+		|| header.dataOffset > size
+		|| header.dataSize != size - header.dataOffset)
+		return false;
+
+	// Every subresource must match the layout CopyToUploadHeap gives the GPU, and stay inside the data block
+	for (uint32_t i = 0; i < header.mipCount * header.arraySize; ++i)
+	{
+		const Mip& mip = header.mips[i];
+		if (mip.width != std::max(header.width >> (i % header.mipCount), 1u)
+			|| mip.height != std::max(header.height >> (i % header.mipCount), 1u)
+			|| !GetMipLayout((DXGI_FORMAT)header.format, mip.width, mip.height, rowSize, rowCount)
+			|| mip.rowSize != rowSize
+			|| mip.rowCount != rowCount
+			|| mip.rowPitch < mip.rowSize
+			|| mip.rowPitch % STextureCache::PITCH_ALIGNMENT != 0
+			|| mip.offset % STextureCache::PLACEMENT_ALIGNMENT != 0
+			|| mip.offset > header.dataSize
+			|| (uint64_t)mip.rowPitch * mip.rowCount > header.dataSize - mip.offset)
+			return false;
+	}
+
+	View view;
+	view.format = (DXGI_FORMAT)header.format;
+	view.width = header.width;
+	view.height = header.height;
+	view.mipCount = header.mipCount;
+	view.arraySize = header.arraySize;
+	view.cubemap = (header.flags & FLAG_CUBEMAP) != 0;
+	view.mips = ((const Header*)bytes)->mips;
+	view.data = bytes + header.dataOffset;
+	view.dataSize = header.dataSize;
+
+	outView = view;
+	return true;
+}
+
+bool STextureCache::Write(const char* filename, const std::vector<uint8_t>& image)
+{
+	std::string tempFilename = std::string(filename) + ".tmp";
+	FILE* file = fopen(tempFilename.c_str(), "wb");
+	if (!file)
+		return false;
+
+	bool ok = fwrite(image.data(), image.size(), 1, file) == 1;
+	ok = (fclose(file) == 0) && ok;
+
+	// Replaces an existing cache in one step
+	std::error_code error;
+	if (ok)
+		std::filesystem::rename(tempFilename, filename, error);
+	if (!ok || error)
+	{
+		std::filesystem::remove(tempFilename, error);
+		return false;
+	}
+	return true;
+}
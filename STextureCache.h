@@ -0,0 +1,148 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "STextureCompression.h"
+
+#include <dxgiformat.h>
+
+#include <string>
+#include <vector>
+
+// .stex: a texture cooked into its final DXGI format with its whole mip chain, ready to be uploaded as is.
+//
+// Layout: a fixed size Header, then one data block holding every subresource, the mips of each array slice
+// in D3D12 subresource order (slice * mipCount + mip). Subresources are placed exactly as
+// D3D12 placed subresource footprints expect them in an upload buffer (offsets aligned to
+// PLACEMENT_ALIGNMENT, rows to PITCH_ALIGNMENT), so the block of a
+// mapped file is copied into the upload heap with a single memcpy and each subresource with one CopyTextureRegion.
+namespace STextureCache
+{
+	constexpr uint32_t MAGIC = 0x58455453; // "STEX"
+	constexpr uint32_t FORMAT_VERSION = 2;
+
+	// Bump whenever a loader or the mip filter changes its output,
+	// so that caches written by an older build are rebuilt.
+	constexpr uint32_t TOOL_VERSION = 3;
+
+	constexpr uint32_t MAX_MIPS = 16;  // Up to 32768 x 32768
+	constexpr uint32_t MAX_SUBRESOURCES = MAX_MIPS * 6;  // A full cubemap
+
+	// D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT and D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, which the layout is fixed to
+	constexpr uint32_t PLACEMENT_ALIGNMENT = 512;
+	constexpr uint32_t PITCH_ALIGNMENT = 256;
+
+	constexpr uint32_t FLAG_CUBEMAP = 1;  // The array slices are cube faces, viewed as TEXTURECUBE
+
+	// Block compression of a cooked texture. Textures whose size is not a multiple of 4,
+	// or whose format can't be converted to the encoder's input, stay uncompressed.
+	// BC6H takes half or float textures only, the others take any format the cooker can filter.
+	enum class Compression : uint32_t
+	{
+		None,
+		BC1,  // RGB, sRGB if the source is
+		BC4,  // R
+		BC5,  // RG, for tangent space normals
+		BC6H, // Unsigned HDR RGB
+		BC7,  // RGBA, sRGB if the source is
+	};
+
+	// Cooker options. Part of the cache key: a cache cooked with other settings is rebuilt.
+	struct Settings
+	{
+		uint32_t generateMips = 1;  // 0: mip 0 only
+		Compression compression = Compression::None;
+		STextureCompression::Quality quality = STextureCompression::Quality::Normal;
+	};
+
+	struct Mip
+	{
+		uint64_t offset;  // From the start of the data block
+		uint32_t width;
+		uint32_t height;
+		uint32_t rowPitch;
+		uint32_t rowSize;  // Bytes of a row that hold texels, the rest of rowPitch is padding
+		uint32_t rowCount;
+		uint32_t reserved;
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t formatVersion;
+		uint32_t toolVersion;
+		uint32_t format;  // DXGI_FORMAT
+		uint32_t width;
+		uint32_t height;
+		uint32_t mipCount;
+		uint32_t arraySize;
+		uint32_t flags;
+		uint32_t reserved;
+		uint64_t sourceHash;
+		uint64_t settingsHash;
+		uint64_t fileSize;
+		uint64_t dataOffset;
+		uint64_t dataSize;
+		Mip mips[MAX_SUBRESOURCES];  // mipCount * arraySize in use
+	};
+
+	// Texture data, pointing into a mapped cache file or into a cooked image in memory
+	struct View
+	{
+		DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t mipCount = 0;
+		uint32_t arraySize = 0;
+		bool cubemap = false;
+		const Mip* mips = nullptr;  // mipCount * arraySize, slice by slice
+		const uint8_t* data = nullptr;  // The data block
+		uint64_t dataSize = 0;
+	};
+
+	// A cooked texture together with the storage its view points into
+	struct Texture
+	{
+		std::string name;  // For debugging purpose
+		MappedFile file;
+		std::vector<uint8_t> image;
+		View view;
+	};
+
+	uint64_t HashSettings(const Settings& settings);
+
+	// "<source>.stex", next to the source file
+	std::string GetCachePath(const char* sourceFilename);
+
+	// Bytes of one pixel, 0 for block compressed formats and formats the cooker does not know
+	uint32_t GetPixelSize(DXGI_FORMAT format);
+	// Bytes of one 4 x 4 block, 0 for formats that are not block compressed
+	uint32_t GetBlockSize(DXGI_FORMAT format);
+	// Bytes per row and rows of a [width] x [height] level, counting rows of blocks for block compressed formats
+	bool GetMipLayout(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t& rowSize, uint32_t& rowCount);
+	// Formats whose mips the cooker can filter; others are cooked with mip 0 only
+	bool CanGenerateMips(DXGI_FORMAT format);
+
+	// Cooks [width] x [height] tightly packed pixels of [format] into a complete .stex image in [outImage]:
+	// header, placed mip 0, and the rest of the chain box filtered from it if [settings] ask for mips.
+	// Compression happens after filtering, on every level.
+	void Cook(const void* pixels, DXGI_FORMAT format, uint32_t width, uint32_t height, const Settings& settings, uint64_t sourceHash, std::vector<uint8_t>& outImage);
+
+	// One level of one array slice, rows [rowPitch] bytes apart
+	struct Subresource
+	{
+		const void* data;
+		size_t rowPitch;
+	};
+
+	// Cooks a texture whose [mipCount] x [arraySize] subresources already exist, e.g. read back from the GPU,
+	// in D3D12 subresource order. Nothing is filtered, settings.generateMips is ignored; compression is as for Cook.
+	void CookSubresources(const Subresource* subresources, DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t arraySize,
+		bool cubemap, const Settings& settings, uint64_t sourceHash, std::vector<uint8_t>& outImage);
+
+	// Checks the header, versions, hashes and subresource table of a cache image and points [outView] at its data.
+	// Returns false for stale or corrupt files.
+	bool Validate(const uint8_t* bytes, uint64_t size, uint64_t sourceHash, uint64_t settingsHash, View& outView);
+
+	// Writes to a temporary file first and moves it into place, so readers never see a partial cache.
+	bool Write(const char* filename, const std::vector<uint8_t>& image);
+}
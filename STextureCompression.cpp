@@ -0,0 +1,1543 @@
+#include "STextureCompression.h"
+#include "ParallelFor.h"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+using namespace STextureCompression;
+
+namespace
+{
+	// The texels of a block as floats (0 - 255), and again with one SSE register per channel and 4 texels
+	struct Texels
+	{
+		float v[16][4];
+		__m128 soa[4][4];  // [channel][texels 4j .. 4j + 3]
+
+		Texels() = default;
+
+		explicit Texels(const uint8_t* rgba)
+		{
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					v[i][c] = rgba[i * 4 + c];
+			}
+			Transpose();
+		}
+
+		void Transpose()
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+			{
+				for (uint32_t j = 0; j < 4; ++j)
+					soa[c][j] = _mm_setr_ps(v[4 * j][c], v[4 * j + 1][c], v[4 * j + 2][c], v[4 * j + 3][c]);
+			}
+		}
+	};
+
+	// The colors a block interpolates from its endpoints, RGBA 0 - 255
+	typedef float Palette[16][4];
+
+	inline float Clamp255(float value)
+	{
+		return std::min(std::max(value, 0.0f), 255.0f);
+	}
+
+	// For every texel in [mask], the nearest of [entries] palette colors over channels [first, first + count)
+	// and the squared error of that color. Works on 4 texels at a time.
+	void FindNearest(const Texels& t, const Palette& palette, uint32_t entries, uint32_t first, uint32_t count, uint8_t indices[16], float errors[16], uint32_t mask = 0xFFFF)
+	{
+		for (uint32_t j = 0; j < 4; ++j)
+		{
+			if (!((mask >> (4 * j)) & 0xF))
+				continue;
+
+			__m128 best = _mm_set1_ps(FLT_MAX);
+			__m128i bestIndex = _mm_setzero_si128();
+			for (uint32_t e = 0; e < entries; ++e)
+			{
+				__m128 error = _mm_setzero_ps();
+				for (uint32_t c = first; c < first + count; ++c)
+				{
+					const __m128 d = _mm_sub_ps(t.soa[c][j], _mm_set1_ps(palette[e][c]));
+					error = _mm_add_ps(error, _mm_mul_ps(d, d));
+				}
+				const __m128i less = _mm_castps_si128(_mm_cmplt_ps(error, best));
+				best = _mm_min_ps(error, best);
+				bestIndex = _mm_or_si128(_mm_andnot_si128(less, bestIndex), _mm_and_si128(less, _mm_set1_epi32((int)e)));
+			}
+
+			alignas(16) int32_t index[4];
+			_mm_store_si128((__m128i*)index, bestIndex);
+			_mm_storeu_ps(&errors[4 * j], best);
+			for (uint32_t k = 0; k < 4; ++k)
+				indices[4 * j + k] = (uint8_t)index[k];
+		}
+	}
+
+	inline float SumErrors(const float errors[16], uint32_t mask)
+	{
+		float sum = 0.0f;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (mask & (1u << i))
+				sum += errors[i];
+		}
+		return sum;
+	}
+
+	// Endpoints of the segment of the principal axis that covers the texels in [mask],
+	// over channels [first, first + count). Other channels get the mean.
+	void FitLine(const Texels& t, uint32_t mask, uint32_t first, uint32_t count, uint32_t iterations, float e0[4], float e1[4])
+	{
+		const uint32_t last = first + count;
+		float n = 0.0f;
+		float mean[4] = {};
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (!(mask & (1u << i)))
+				continue;
+			n += 1.0f;
+			for (uint32_t c = 0; c < 4; ++c)
+				mean[c] += t.v[i][c];
+		}
+		for (uint32_t c = 0; c < 4; ++c)
+			mean[c] = n > 0.0f ? mean[c] / n : 0.0f;
+
+		float cov[4][4] = {};
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (!(mask & (1u << i)))
+				continue;
+			for (uint32_t a = first; a < last; ++a)
+			{
+				for (uint32_t b = first; b < last; ++b)
+					cov[a][b] += (t.v[i][a] - mean[a]) * (t.v[i][b] - mean[b]);
+			}
+		}
+
+		// Power iteration, from the row of the channel that varies most
+		uint32_t start = first;
+		for (uint32_t c = first; c < last; ++c)
+		{
+			if (cov[c][c] > cov[start][start])
+				start = c;
+		}
+		float axis[4] = {};
+		for (uint32_t c = first; c < last; ++c)
+			axis[c] = cov[start][c];
+		for (uint32_t k = 0; k < iterations; ++k)
+		{
+			float next[4] = {};
+			float scale = 0.0f;
+			for (uint32_t a = first; a < last; ++a)
+			{
+				for (uint32_t b = first; b < last; ++b)
+					next[a] += cov[a][b] * axis[b];
+				scale = std::max(scale, fabsf(next[a]));
+			}
+			if (scale == 0.0f)
+				break;
+			for (uint32_t c = first; c < last; ++c)
+				axis[c] = next[c] / scale;
+		}
+		float length = 0.0f;
+		for (uint32_t c = first; c < last; ++c)
+			length += axis[c] * axis[c];
+		length = sqrtf(length);
+
+		float lo = 0.0f, hi = 0.0f;
+		if (length > 0.0f)
+		{
+			for (uint32_t c = first; c < last; ++c)
+				axis[c] /= length;
+			lo = FLT_MAX;
+			hi = -FLT_MAX;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (!(mask & (1u << i)))
+					continue;
+				float p = 0.0f;
+				for (uint32_t c = first; c < last; ++c)
+					p += (t.v[i][c] - mean[c]) * axis[c];
+				lo = std::min(lo, p);
+				hi = std::max(hi, p);
+			}
+		}
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			e0[c] = Clamp255(mean[c] + lo * axis[c]);
+			e1[c] = Clamp255(mean[c] + hi * axis[c]);
+		}
+	}
+
+	// Endpoints that minimize the squared error of the texels in [mask] over channels [first, first + count),
+	// when texel i is interpolated with weight [weights][i] (0: e0, 1: e1). False if the system is singular.
+	bool Refit(const Texels& t, uint32_t mask, uint32_t first, uint32_t count, const float weights[16], float e0[4], float e1[4])
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[4] = {}, bx[4] = {};
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (!(mask & (1u << i)))
+				continue;
+			const float b = weights[i];
+			const float a = 1.0f - b;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (uint32_t c = first; c < first + count; ++c)
+			{
+				ax[c] += a * t.v[i][c];
+				bx[c] += b * t.v[i][c];
+			}
+		}
+
+		const float det = aa * bb - ab * ab;
+		if (fabsf(det) < 1e-6f)
+			return false;
+		for (uint32_t c = first; c < first + count; ++c)
+		{
+			e0[c] = Clamp255((ax[c] * bb - bx[c] * ab) / det);
+			e1[c] = Clamp255((bx[c] * aa - ax[c] * ab) / det);
+		}
+		return true;
+	}
+
+	struct BitWriter
+	{
+		uint8_t* out;
+		uint32_t position = 0;
+
+		explicit BitWriter(uint8_t* block, uint32_t size) : out(block) { memset(block, 0, size); }
+
+		void Write(uint32_t value, uint32_t bits)
+		{
+			for (uint32_t i = 0; i < bits; ++i, ++position)
+				out[position >> 3] |= (uint8_t)(((value >> i) & 1) << (position & 7));
+		}
+	};
+
+	struct BitReader
+	{
+		const uint8_t* in;
+		uint32_t position = 0;
+
+		explicit BitReader(const uint8_t* block) : in(block) {}
+
+		uint32_t Read(uint32_t bits)
+		{
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < bits; ++i, ++position)
+				value |= (uint32_t)((in[position >> 3] >> (position & 7)) & 1) << i;
+			return value;
+		}
+	};
+
+	//
+	// BC1
+	//
+
+	inline uint32_t Expand5(uint32_t v) { return (v << 3) | (v >> 2); }
+	inline uint32_t Expand6(uint32_t v) { return (v << 2) | (v >> 4); }
+
+	uint16_t Quantize565(const float color[4])
+	{
+		const uint32_t r = (uint32_t)(Clamp255(color[0]) * 31.0f / 255.0f + 0.5f);
+		const uint32_t g = (uint32_t)(Clamp255(color[1]) * 63.0f / 255.0f + 0.5f);
+		const uint32_t b = (uint32_t)(Clamp255(color[2]) * 31.0f / 255.0f + 0.5f);
+		return (uint16_t)((r << 11) | (g << 5) | b);
+	}
+
+	// 4 colors if c0 > c1, otherwise 3 colors and transparent black
+	void BC1Palette(uint16_t c0, uint16_t c1, uint8_t palette[4][4])
+	{
+		const uint32_t a[3] = { Expand5(c0 >> 11), Expand6((c0 >> 5) & 63), Expand5(c0 & 31) };
+		const uint32_t b[3] = { Expand5(c1 >> 11), Expand6((c1 >> 5) & 63), Expand5(c1 & 31) };
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			palette[0][c] = (uint8_t)a[c];
+			palette[1][c] = (uint8_t)b[c];
+			if (c0 > c1)
+			{
+				palette[2][c] = (uint8_t)((2 * a[c] + b[c]) / 3);
+				palette[3][c] = (uint8_t)((a[c] + 2 * b[c]) / 3);
+			}
+			else
+			{
+				palette[2][c] = (uint8_t)((a[c] + b[c]) / 2);
+				palette[3][c] = 0;
+			}
+		}
+		palette[0][3] = palette[1][3] = palette[2][3] = 255;
+		palette[3][3] = c0 > c1 ? 255 : 0;
+	}
+
+	// For every 8-bit value, the 5 and 6-bit endpoints whose 1/3 interpolation comes closest,
+	// so a solid block gets the nearest color BC1 can produce instead of the nearest endpoint
+	struct BC1SingleColor
+	{
+		uint8_t match5[256][2];
+		uint8_t match6[256][2];
+
+		BC1SingleColor()
+		{
+			Build(match5, 31, Expand5);
+			Build(match6, 63, Expand6);
+		}
+
+		static void Build(uint8_t match[256][2], uint32_t maxCode, uint32_t(*expand)(uint32_t))
+		{
+			for (uint32_t v = 0; v < 256; ++v)
+			{
+				uint32_t bestError = UINT32_MAX;
+				for (uint32_t hi = 0; hi <= maxCode; ++hi)
+				{
+					for (uint32_t lo = 0; lo <= maxCode; ++lo)
+					{
+						const int value = (int)((2 * expand(hi) + expand(lo)) / 3);
+						const uint32_t error = (uint32_t)abs(value - (int)v);
+						if (error < bestError)
+						{
+							bestError = error;
+							match[v][0] = (uint8_t)hi;
+							match[v][1] = (uint8_t)lo;
+						}
+					}
+				}
+			}
+		}
+	};
+
+	const BC1SingleColor& GetBC1SingleColor()
+	{
+		static const BC1SingleColor table;
+		return table;
+	}
+
+	void EncodeBC1(const Texels& t, uint8_t* out, Quality quality)
+	{
+		// Texels with alpha below 128 are transparent and force the 3 color mode
+		uint32_t opaque = 0;
+		for (uint32_t i = 0; i < 16; ++i)
+			opaque |= t.v[i][3] >= 128.0f ? 1u << i : 0;
+		const bool threeColor = opaque != 0xFFFF;
+
+		bool solid = true;
+		for (uint32_t i = 1; i < 16 && solid; ++i)
+			solid = t.v[i][0] == t.v[0][0] && t.v[i][1] == t.v[0][1] && t.v[i][2] == t.v[0][2];
+
+		uint16_t c0 = 0, c1 = 0;
+		uint8_t indices[16] = {};
+		if (opaque == 0)
+		{
+			memset(indices, 3, sizeof(indices));
+		}
+		else if (solid && !threeColor && quality != Quality::Fast)
+		{
+			const BC1SingleColor& table = GetBC1SingleColor();
+			const uint8_t* r = table.match5[(uint32_t)t.v[0][0]];
+			const uint8_t* g = table.match6[(uint32_t)t.v[0][1]];
+			const uint8_t* b = table.match5[(uint32_t)t.v[0][2]];
+			c0 = (uint16_t)((r[0] << 11) | (g[0] << 5) | b[0]);
+			c1 = (uint16_t)((r[1] << 11) | (g[1] << 5) | b[1]);
+			uint8_t index = 2;
+			if (c0 < c1)
+			{
+				std::swap(c0, c1);
+				index = 3;
+			}
+			else if (c0 == c1)
+			{
+				index = 0;
+			}
+			memset(indices, index, sizeof(indices));
+		}
+		else
+		{
+			const uint32_t refinements = quality == Quality::Fast ? 0 : quality == Quality::Normal ? 1 : 3;
+			float e0[4], e1[4];
+			FitLine(t, opaque, 0, 3, quality == Quality::Fast ? 2 : 4, e0, e1);
+
+			float bestError = FLT_MAX;
+			for (uint32_t r = 0;; ++r)
+			{
+				uint16_t q0 = Quantize565(e0);
+				uint16_t q1 = Quantize565(e1);
+				// 4 colors need c0 > c1, 3 colors c0 <= c1
+				if (threeColor ? q0 > q1 : q0 < q1)
+				{
+					std::swap(q0, q1);
+					std::swap(e0, e1);
+				}
+
+				uint8_t bytes[4][4];
+				BC1Palette(q0, q1, bytes);
+				Palette palette;
+				for (uint32_t e = 0; e < 4; ++e)
+				{
+					for (uint32_t c = 0; c < 4; ++c)
+						palette[e][c] = bytes[e][c];
+				}
+
+				uint8_t candidate[16];
+				float errors[16];
+				FindNearest(t, palette, q0 > q1 ? 4 : 3, 0, 3, candidate, errors);
+				const float error = SumErrors(errors, opaque);
+				if (error < bestError)
+				{
+					bestError = error;
+					c0 = q0;
+					c1 = q1;
+					memcpy(indices, candidate, sizeof(indices));
+				}
+				if (r == refinements || error == 0.0f)
+					break;
+
+				static const float WEIGHTS4[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+				static const float WEIGHTS3[3] = { 0.0f, 1.0f, 0.5f };
+				float weights[16];
+				for (uint32_t i = 0; i < 16; ++i)
+					weights[i] = q0 > q1 ? WEIGHTS4[candidate[i]] : WEIGHTS3[candidate[i]];
+				if (!Refit(t, opaque, 0, 3, weights, e0, e1))
+					break;
+			}
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (!(opaque & (1u << i)))
+					indices[i] = 3;
+			}
+		}
+
+		uint32_t bits = 0;
+		for (uint32_t i = 0; i < 16; ++i)
+			bits |= (uint32_t)indices[i] << (2 * i);
+		memcpy(out, &c0, 2);
+		memcpy(out + 2, &c1, 2);
+		memcpy(out + 4, &bits, 4);
+	}
+
+	void DecodeBC1(const uint8_t* block, uint8_t* rgba)
+	{
+		uint16_t c0, c1;
+		uint32_t bits;
+		memcpy(&c0, block, 2);
+		memcpy(&c1, block + 2, 2);
+		memcpy(&bits, block + 4, 4);
+
+		uint8_t palette[4][4];
+		BC1Palette(c0, c1, palette);
+		for (uint32_t i = 0; i < 16; ++i)
+			memcpy(rgba + 4 * i, palette[(bits >> (2 * i)) & 3], 4);
+	}
+
+	//
+	// BC4
+	//
+
+	// 8 values if r0 > r1, otherwise 6 values, 0 and 255
+	void BC4Palette(uint32_t r0, uint32_t r1, uint8_t palette[8])
+	{
+		palette[0] = (uint8_t)r0;
+		palette[1] = (uint8_t)r1;
+		if (r0 > r1)
+		{
+			for (uint32_t k = 1; k < 7; ++k)
+				palette[k + 1] = (uint8_t)(((7 - k) * r0 + k * r1 + 3) / 7);
+		}
+		else
+		{
+			for (uint32_t k = 1; k < 5; ++k)
+				palette[k + 1] = (uint8_t)(((5 - k) * r0 + k * r1 + 2) / 5);
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+	}
+
+	// Channel [channel] of the texels into one BC4 block
+	void EncodeBC4(const Texels& t, uint32_t channel, uint8_t* out, Quality quality)
+	{
+		float lo = 255.0f, hi = 0.0f;
+		float innerLo = 255.0f, innerHi = 0.0f;  // Without 0 and 255, which the 6 value mode has for free
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const float v = t.v[i][channel];
+			lo = std::min(lo, v);
+			hi = std::max(hi, v);
+			if (v > 0.0f && v < 255.0f)
+			{
+				innerLo = std::min(innerLo, v);
+				innerHi = std::max(innerHi, v);
+			}
+		}
+
+		uint32_t bestR0 = 0, bestR1 = 0;
+		uint8_t indices[16] = {};
+		float bestError = FLT_MAX;
+		auto evaluate = [&](int r0, int r1)
+		{
+			r0 = std::min(std::max(r0, 0), 255);
+			r1 = std::min(std::max(r1, 0), 255);
+			uint8_t bytes[8];
+			BC4Palette(r0, r1, bytes);
+			Palette palette;
+			for (uint32_t e = 0; e < 8; ++e)
+				palette[e][channel] = bytes[e];
+
+			uint8_t candidate[16];
+			float errors[16];
+			FindNearest(t, palette, 8, channel, 1, candidate, errors);
+			const float error = SumErrors(errors, 0xFFFF);
+			if (error < bestError)
+			{
+				bestError = error;
+				bestR0 = r0;
+				bestR1 = r1;
+				memcpy(indices, candidate, sizeof(indices));
+			}
+		};
+
+		evaluate((int)hi, (int)lo);
+		if (quality != Quality::Fast && bestError > 0.0f)
+		{
+			if (quality == Quality::High && innerLo <= innerHi)
+				evaluate((int)innerLo, (int)innerHi);
+
+			// Least squares fit of the best mode's interpolated values, then a search around the result
+			const uint32_t refinements = quality == Quality::Normal ? 1 : 2;
+			for (uint32_t r = 0; r < refinements && bestError > 0.0f; ++r)
+			{
+				const bool eightValues = bestR0 > bestR1;
+				uint32_t mask = 0;
+				float weights[16];
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					const uint32_t index = indices[i];
+					if (!eightValues && index >= 6)
+						continue;  // 0 and 255 don't depend on the endpoints
+					mask |= 1u << i;
+					weights[i] = index == 0 ? 0.0f : index == 1 ? 1.0f : (index - 1) / (eightValues ? 7.0f : 5.0f);
+				}
+				float e0[4] = {}, e1[4] = {};
+				if (!Refit(t, mask, channel, 1, weights, e0, e1))
+					break;
+				evaluate((int)(e0[channel] + 0.5f), (int)(e1[channel] + 0.5f));
+			}
+
+			const int radius = quality == Quality::Normal ? 1 : 3;
+			const int centerR0 = (int)bestR0, centerR1 = (int)bestR1;
+			for (int d0 = -radius; d0 <= radius && bestError > 0.0f; ++d0)
+			{
+				for (int d1 = -radius; d1 <= radius; ++d1)
+					evaluate(centerR0 + d0, centerR1 + d1);
+			}
+		}
+
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < 16; ++i)
+			bits |= (uint64_t)indices[i] << (3 * i);
+		out[0] = (uint8_t)bestR0;
+		out[1] = (uint8_t)bestR1;
+		for (uint32_t i = 0; i < 6; ++i)
+			out[2 + i] = (uint8_t)(bits >> (8 * i));
+	}
+
+	void DecodeBC4(const uint8_t* block, uint32_t channel, uint8_t* rgba)
+	{
+		uint8_t palette[8];
+		BC4Palette(block[0], block[1], palette);
+		uint64_t bits = 0;
+		for (uint32_t i = 0; i < 6; ++i)
+			bits |= (uint64_t)block[2 + i] << (8 * i);
+		for (uint32_t i = 0; i < 16; ++i)
+			rgba[4 * i + channel] = palette[(bits >> (3 * i)) & 7];
+	}
+
+	//
+	// BC7
+	//
+
+	// Subset of each texel for the 64 two subset partitions, bit i for texel i
+	const uint16_t PARTITIONS2[64] = {
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+	};
+
+	// Texel whose index of subset 1 drops its top bit, the anchor of subset 0 is texel 0
+	const uint8_t ANCHORS2[64] = {
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15,  2,  8,  2,  2,  8,  8, 15,
+		 2,  8,  2,  2,  8,  8,  2,  2,
+		15, 15,  6,  8,  2,  8, 15, 15,
+		 2,  8,  2,  2,  2, 15, 15,  6,
+		 6,  2,  6,  8, 15, 15,  2,  2,
+		15, 15, 15, 15, 15,  2,  2, 15,
+	};
+
+	const uint8_t WEIGHTS2[4] = { 0, 21, 43, 64 };
+	const uint8_t WEIGHTS3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	const uint8_t WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	struct BC7Mode
+	{
+		uint32_t mode;
+		uint32_t subsets;
+		uint32_t colorBits;  // Per channel, without the p-bit
+		uint32_t alphaBits;  // 0: alpha is 255
+		bool sharedPBit;     // One p-bit per subset instead of one per endpoint
+		uint32_t indexBits;
+	};
+
+	const BC7Mode MODE1 = { 1, 2, 6, 0, true, 3 };
+	const BC7Mode MODE3 = { 3, 2, 7, 0, false, 2 };
+	const BC7Mode MODE6 = { 6, 1, 7, 7, false, 4 };
+
+	const BC7Mode* GetBC7Mode(uint32_t mode)
+	{
+		switch (mode)
+		{
+		case 1: return &MODE1;
+		case 3: return &MODE3;
+		case 6: return &MODE6;
+		default: return nullptr;
+		}
+	}
+
+	const uint8_t* GetBC7Weights(uint32_t indexBits)
+	{
+		return indexBits == 2 ? WEIGHTS2 : indexBits == 3 ? WEIGHTS3 : WEIGHTS4;
+	}
+
+	inline uint32_t Interpolate(uint32_t e0, uint32_t e1, uint32_t weight)
+	{
+		return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+	}
+
+	// Endpoint [code] of [bits] bits with its p-bit below, expanded to 8 bits
+	inline uint32_t ExpandPBit(uint32_t code, uint32_t pbit, uint32_t bits)
+	{
+		const uint32_t n = bits + 1;
+		const uint32_t v = (code << 1) | pbit;
+		return (v << (8 - n)) | (v >> (2 * n - 8));
+	}
+
+	inline uint32_t QuantizePBit(float value, uint32_t pbit, uint32_t bits)
+	{
+		const float scaled = value * (float)((2u << bits) - 1) / 255.0f;
+		const int code = (int)floorf((scaled - pbit) * 0.5f + 0.5f);
+		return (uint32_t)std::min(std::max(code, 0), (1 << bits) - 1);
+	}
+
+	struct BC7Block
+	{
+		const BC7Mode* mode = nullptr;
+		float error = FLT_MAX;
+		uint32_t partition = 0;
+		uint8_t codes[2][2][4] = {};  // [subset][endpoint][channel]
+		uint8_t pbits[2][2] = {};     // [subset][endpoint]
+		uint8_t indices[16] = {};
+	};
+
+	inline uint32_t SubsetMask(const BC7Mode& mode, uint32_t partition, uint32_t subset)
+	{
+		if (mode.subsets == 1)
+			return 0xFFFF;
+		return subset == 0 ? ~PARTITIONS2[partition] & 0xFFFFu : PARTITIONS2[partition];
+	}
+
+	// Quantizes the endpoints of a subset with the p-bits that keep them closest
+	void QuantizeEndpoints(const BC7Mode& mode, const float e0[4], const float e1[4], uint8_t codes[2][4], uint8_t pbits[2], float expanded[2][4])
+	{
+		const uint32_t channels = mode.alphaBits ? 4 : 3;
+		const float* endpoints[2] = { e0, e1 };
+
+		auto quantize = [&](uint32_t e, uint32_t pbit, uint8_t code[4], float value[4])
+		{
+			float error = 0.0f;
+			for (uint32_t c = 0; c < channels; ++c)
+			{
+				code[c] = (uint8_t)QuantizePBit(endpoints[e][c], pbit, mode.colorBits);
+				value[c] = (float)ExpandPBit(code[c], pbit, mode.colorBits);
+				error += (value[c] - endpoints[e][c]) * (value[c] - endpoints[e][c]);
+			}
+			if (channels == 3)
+			{
+				code[3] = 0;
+				value[3] = 255.0f;
+			}
+			return error;
+		};
+
+		uint8_t tryCodes[2][2][4];  // [p-bit][endpoint]
+		float tryValues[2][2][4];
+		float errors[2][2];
+		for (uint32_t p = 0; p < 2; ++p)
+		{
+			for (uint32_t e = 0; e < 2; ++e)
+				errors[p][e] = quantize(e, p, tryCodes[p][e], tryValues[p][e]);
+		}
+
+		for (uint32_t e = 0; e < 2; ++e)
+		{
+			uint32_t p;
+			if (mode.sharedPBit)
+				p = errors[1][0] + errors[1][1] < errors[0][0] + errors[0][1] ? 1 : 0;
+			else
+				p = errors[1][e] < errors[0][e] ? 1 : 0;
+			pbits[e] = (uint8_t)p;
+			memcpy(codes[e], tryCodes[p][e], 4);
+			memcpy(expanded[e], tryValues[p][e], sizeof(float) * 4);
+		}
+	}
+
+	// Quantizes [endpoints] and picks the nearest palette color for every texel, into [block]
+	void EvaluateBC7(const Texels& t, const BC7Mode& mode, uint32_t partition, float endpoints[2][2][4], BC7Block& block)
+	{
+		const uint8_t* weights = GetBC7Weights(mode.indexBits);
+		const uint32_t entries = 1u << mode.indexBits;
+
+		block.mode = &mode;
+		block.partition = partition;
+		block.error = 0.0f;
+		for (uint32_t s = 0; s < mode.subsets; ++s)
+		{
+			float expanded[2][4];
+			QuantizeEndpoints(mode, endpoints[s][0], endpoints[s][1], block.codes[s], block.pbits[s], expanded);
+
+			Palette palette;
+			for (uint32_t e = 0; e < entries; ++e)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+					palette[e][c] = (float)Interpolate((uint32_t)expanded[0][c], (uint32_t)expanded[1][c], weights[e]);
+			}
+
+			uint8_t indices[16];
+			float errors[16];
+			const uint32_t mask = SubsetMask(mode, partition, s);
+			FindNearest(t, palette, entries, 0, 4, indices, errors, mask);
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (mask & (1u << i))
+				{
+					block.indices[i] = indices[i];
+					block.error += errors[i];
+				}
+			}
+		}
+	}
+
+	// Fits every subset of [partition] with a line, refines the endpoints by least squares, and keeps the
+	// result in [best] if it beats it
+	void FitBC7(const Texels& t, const BC7Mode& mode, uint32_t partition, uint32_t refinements, BC7Block& best)
+	{
+		const uint32_t channels = mode.alphaBits ? 4 : 3;
+		const uint8_t* weights = GetBC7Weights(mode.indexBits);
+
+		float endpoints[2][2][4];
+		for (uint32_t s = 0; s < mode.subsets; ++s)
+			FitLine(t, SubsetMask(mode, partition, s), 0, channels, 4, endpoints[s][0], endpoints[s][1]);
+
+		BC7Block candidate;
+		for (uint32_t r = 0;; ++r)
+		{
+			EvaluateBC7(t, mode, partition, endpoints, candidate);
+			if (candidate.error < best.error)
+				best = candidate;
+			if (r == refinements || candidate.error == 0.0f)
+				break;
+
+			float w[16];
+			for (uint32_t i = 0; i < 16; ++i)
+				w[i] = weights[candidate.indices[i]] / 64.0f;
+			for (uint32_t s = 0; s < mode.subsets; ++s)
+				Refit(t, SubsetMask(mode, partition, s), 0, channels, w, endpoints[s][0], endpoints[s][1]);
+		}
+	}
+
+	// Count, sums and sums of products of RGB over some texels
+	struct Moments
+	{
+		float n = 0.0f;
+		float sum[3] = {};
+		float sum2[6] = {};  // rr, rg, rb, gg, gb, bb
+
+		void Add(const float v[4])
+		{
+			n += 1.0f;
+			for (uint32_t c = 0; c < 3; ++c)
+				sum[c] += v[c];
+			sum2[0] += v[0] * v[0];
+			sum2[1] += v[0] * v[1];
+			sum2[2] += v[0] * v[2];
+			sum2[3] += v[1] * v[1];
+			sum2[4] += v[1] * v[2];
+			sum2[5] += v[2] * v[2];
+		}
+
+		Moments operator-(const Moments& other) const
+		{
+			Moments res;
+			res.n = n - other.n;
+			for (uint32_t c = 0; c < 3; ++c)
+				res.sum[c] = sum[c] - other.sum[c];
+			for (uint32_t c = 0; c < 6; ++c)
+				res.sum2[c] = sum2[c] - other.sum2[c];
+			return res;
+		}
+
+		// Squared distance of the texels from their principal axis
+		float LineResidual() const
+		{
+			if (n < 2.0f)
+				return 0.0f;
+
+			const float inv = 1.0f / n;
+			const float xx = sum2[0] - sum[0] * sum[0] * inv;
+			const float xy = sum2[1] - sum[0] * sum[1] * inv;
+			const float xz = sum2[2] - sum[0] * sum[2] * inv;
+			const float yy = sum2[3] - sum[1] * sum[1] * inv;
+			const float yz = sum2[4] - sum[1] * sum[2] * inv;
+			const float zz = sum2[5] - sum[2] * sum[2] * inv;
+
+			// Largest eigenvalue of the covariance by power iteration
+			float x = 1.0f, y = 1.0f, z = 1.0f;
+			float eigenvalue = 0.0f;
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const float nx = xx * x + xy * y + xz * z;
+				const float ny = xy * x + yy * y + yz * z;
+				const float nz = xz * x + yz * y + zz * z;
+				const float length = sqrtf(nx * nx + ny * ny + nz * nz);
+				if (length == 0.0f)
+					return 0.0f;
+				eigenvalue = length / sqrtf(x * x + y * y + z * z);
+				x = nx / length;
+				y = ny / length;
+				z = nz / length;
+			}
+			return std::max(xx + yy + zz - eigenvalue, 0.0f);
+		}
+	};
+
+	// The [count] of the first [partitionCount] two subset partitions whose subsets are closest to lines
+	void RankPartitions(const Texels& t, uint32_t partitionCount, uint32_t count, uint32_t* partitions)
+	{
+		Moments texels[16];
+		Moments total;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			texels[i].Add(t.v[i]);
+			total.Add(t.v[i]);
+		}
+
+		float residuals[64];
+		uint32_t order[64];
+		for (uint32_t p = 0; p < partitionCount; ++p)
+		{
+			Moments subset1;
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (!(PARTITIONS2[p] & (1u << i)))
+					continue;
+				subset1.n += 1.0f;
+				for (uint32_t c = 0; c < 3; ++c)
+					subset1.sum[c] += texels[i].sum[c];
+				for (uint32_t c = 0; c < 6; ++c)
+					subset1.sum2[c] += texels[i].sum2[c];
+			}
+			residuals[p] = (total - subset1).LineResidual() + subset1.LineResidual();
+			order[p] = p;
+		}
+		std::partial_sort(order, order + count, order + partitionCount, [&](uint32_t a, uint32_t b) { return residuals[a] < residuals[b]; });
+		memcpy(partitions, order, count * sizeof(uint32_t));
+	}
+
+	void WriteBC7(BC7Block block, uint8_t* out)
+	{
+		const BC7Mode& mode = *block.mode;
+		const uint32_t maxIndex = (1u << mode.indexBits) - 1;
+
+		// The anchor texel of each subset stores its index without the top bit, which must be 0
+		for (uint32_t s = 0; s < mode.subsets; ++s)
+		{
+			const uint32_t anchor = s == 0 ? 0 : ANCHORS2[block.partition];
+			if (block.indices[anchor] <= maxIndex >> 1)
+				continue;
+			std::swap(block.codes[s][0], block.codes[s][1]);
+			std::swap(block.pbits[s][0], block.pbits[s][1]);
+			const uint32_t mask = SubsetMask(mode, block.partition, s);
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (mask & (1u << i))
+					block.indices[i] = (uint8_t)(maxIndex - block.indices[i]);
+			}
+		}
+
+		BitWriter writer(out, 16);
+		writer.Write(1u << mode.mode, mode.mode + 1);
+		if (mode.subsets == 2)
+			writer.Write(block.partition, 6);
+		for (uint32_t c = 0; c < (mode.alphaBits ? 4u : 3u); ++c)
+		{
+			for (uint32_t s = 0; s < mode.subsets; ++s)
+			{
+				for (uint32_t e = 0; e < 2; ++e)
+					writer.Write(block.codes[s][e][c], c == 3 ? mode.alphaBits : mode.colorBits);
+			}
+		}
+		for (uint32_t s = 0; s < mode.subsets; ++s)
+		{
+			writer.Write(block.pbits[s][0], 1);
+			if (!mode.sharedPBit)
+				writer.Write(block.pbits[s][1], 1);
+		}
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const bool anchor = i == 0 || (mode.subsets == 2 && i == ANCHORS2[block.partition]);
+			writer.Write(block.indices[i], anchor ? mode.indexBits - 1 : mode.indexBits);
+		}
+	}
+
+	void EncodeBC7(const Texels& t, uint8_t* out, Quality quality)
+	{
+		const uint32_t refinements = quality == Quality::Fast ? 0 : quality == Quality::Normal ? 1 : 2;
+
+		BC7Block best;
+		FitBC7(t, MODE6, 0, refinements, best);
+
+		bool opaque = true;
+		for (uint32_t i = 0; i < 16 && opaque; ++i)
+			opaque = t.v[i][3] == 255.0f;
+
+		// Modes 1 and 3 have no alpha, and split the block in two subsets along one of 64 partitions
+		if (quality != Quality::Fast && opaque && best.error > 0.0f)
+		{
+			const uint32_t count = quality == Quality::Normal ? 4 : 16;
+			uint32_t partitions[64];
+			RankPartitions(t, 64, count, partitions);
+			for (uint32_t k = 0; k < count; ++k)
+			{
+				FitBC7(t, MODE1, partitions[k], refinements, best);
+				FitBC7(t, MODE3, partitions[k], refinements, best);
+			}
+		}
+
+		WriteBC7(best, out);
+	}
+
+	void DecodeBC7(const uint8_t* block, uint8_t* rgba)
+	{
+		BitReader reader(block);
+		uint32_t modeIndex = 0;
+		while (modeIndex < 8 && reader.Read(1) == 0)
+			++modeIndex;
+
+		const BC7Mode* mode = GetBC7Mode(modeIndex);
+		if (!mode)
+		{
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				rgba[4 * i + 0] = rgba[4 * i + 1] = rgba[4 * i + 2] = 0;
+				rgba[4 * i + 3] = 255;
+			}
+			return;
+		}
+
+		const uint32_t partition = mode->subsets == 2 ? reader.Read(6) : 0;
+		uint32_t codes[2][2][4] = {};
+		for (uint32_t c = 0; c < (mode->alphaBits ? 4u : 3u); ++c)
+		{
+			for (uint32_t s = 0; s < mode->subsets; ++s)
+			{
+				for (uint32_t e = 0; e < 2; ++e)
+					codes[s][e][c] = reader.Read(c == 3 ? mode->alphaBits : mode->colorBits);
+			}
+		}
+		uint32_t pbits[2][2] = {};
+		for (uint32_t s = 0; s < mode->subsets; ++s)
+		{
+			pbits[s][0] = reader.Read(1);
+			pbits[s][1] = mode->sharedPBit ? pbits[s][0] : reader.Read(1);
+		}
+
+		uint32_t endpoints[2][2][4];
+		for (uint32_t s = 0; s < mode->subsets; ++s)
+		{
+			for (uint32_t e = 0; e < 2; ++e)
+			{
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					if (c == 3 && !mode->alphaBits)
+						endpoints[s][e][c] = 255;
+					else
+						endpoints[s][e][c] = ExpandPBit(codes[s][e][c], pbits[s][e], c == 3 ? mode->alphaBits : mode->colorBits);
+				}
+			}
+		}
+
+		const uint8_t* weights = GetBC7Weights(mode->indexBits);
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const bool anchor = i == 0 || (mode->subsets == 2 && i == ANCHORS2[partition]);
+			const uint32_t index = reader.Read(anchor ? mode->indexBits - 1 : mode->indexBits);
+			const uint32_t s = mode->subsets == 2 ? (PARTITIONS2[partition] >> i) & 1 : 0;
+			for (uint32_t c = 0; c < 4; ++c)
+				rgba[4 * i + c] = (uint8_t)Interpolate(endpoints[s][0][c], endpoints[s][1][c], weights[index]);
+		}
+	}
+
+	//
+	// BC6H, unsigned half floats
+	//
+	// Texels and endpoints are handled as unquantized 16-bit values, the half bits scaled by 64 / 31, which is
+	// what the hardware interpolates. That domain is close to logarithmic, so squared errors in it follow
+	// relative errors. Texels holds them divided by 257 (0 - 255) to share the fitting code above.
+	//
+	// Modes are numbered as in the D3D specification. The encoder writes the one region modes 11 to 14 and the
+	// two region modes 1 and 10.
+
+	// Bits [from:to] of one endpoint channel in the block header, written starting with bit [to]
+	struct BC6HField
+	{
+		uint8_t endpoint;  // 0, 1: region 0. 2, 3: region 1
+		uint8_t channel;
+		uint8_t from;
+		uint8_t to;
+	};
+
+	struct BC6HMode
+	{
+		uint32_t value;  // Of the mode bits
+		uint32_t modeBits;
+		uint32_t regions;
+		bool transformed;  // Endpoints after the first are signed deltas from it
+		uint32_t endpointBits;
+		uint32_t deltaBits;
+		const BC6HField* fields;
+		uint32_t fieldCount;
+	};
+
+	const BC6HField BC6H_FIELDS1[] = {
+		{ 2, 1, 4, 4 }, { 2, 2, 4, 4 }, { 3, 2, 4, 4 }, { 0, 0, 9, 0 }, { 0, 1, 9, 0 }, { 0, 2, 9, 0 }, { 1, 0, 4, 0 },
+		{ 3, 1, 4, 4 }, { 2, 1, 3, 0 }, { 1, 1, 4, 0 }, { 3, 2, 0, 0 }, { 3, 1, 3, 0 }, { 1, 2, 4, 0 }, { 3, 2, 1, 1 },
+		{ 2, 2, 3, 0 }, { 2, 0, 4, 0 }, { 3, 2, 2, 2 }, { 3, 0, 4, 0 }, { 3, 2, 3, 3 },
+	};
+	const BC6HField BC6H_FIELDS10[] = {
+		{ 0, 0, 5, 0 }, { 3, 1, 4, 4 }, { 3, 2, 0, 0 }, { 3, 2, 1, 1 }, { 2, 2, 4, 4 }, { 0, 1, 5, 0 }, { 2, 1, 5, 5 },
+		{ 2, 2, 5, 5 }, { 3, 2, 2, 2 }, { 2, 1, 4, 4 }, { 0, 2, 5, 0 }, { 3, 1, 5, 5 }, { 3, 2, 3, 3 }, { 3, 2, 5, 5 },
+		{ 3, 2, 4, 4 }, { 1, 0, 5, 0 }, { 2, 1, 3, 0 }, { 1, 1, 5, 0 }, { 3, 1, 3, 0 }, { 1, 2, 5, 0 }, { 2, 2, 3, 0 },
+		{ 2, 0, 5, 0 }, { 3, 0, 5, 0 },
+	};
+	const BC6HField BC6H_FIELDS11[] = {
+		{ 0, 0, 9, 0 }, { 0, 1, 9, 0 }, { 0, 2, 9, 0 }, { 1, 0, 9, 0 }, { 1, 1, 9, 0 }, { 1, 2, 9, 0 },
+	};
+	const BC6HField BC6H_FIELDS12[] = {
+		{ 0, 0, 9, 0 }, { 0, 1, 9, 0 }, { 0, 2, 9, 0 }, { 1, 0, 8, 0 }, { 0, 0, 10, 10 }, { 1, 1, 8, 0 }, { 0, 1, 10, 10 },
+		{ 1, 2, 8, 0 }, { 0, 2, 10, 10 },
+	};
+	const BC6HField BC6H_FIELDS13[] = {
+		{ 0, 0, 9, 0 }, { 0, 1, 9, 0 }, { 0, 2, 9, 0 }, { 1, 0, 7, 0 }, { 0, 0, 10, 11 }, { 1, 1, 7, 0 }, { 0, 1, 10, 11 },
+		{ 1, 2, 7, 0 }, { 0, 2, 10, 11 },
+	};
+	const BC6HField BC6H_FIELDS14[] = {
+		{ 0, 0, 9, 0 }, { 0, 1, 9, 0 }, { 0, 2, 9, 0 }, { 1, 0, 3, 0 }, { 0, 0, 10, 15 }, { 1, 1, 3, 0 }, { 0, 1, 10, 15 },
+		{ 1, 2, 3, 0 }, { 0, 2, 10, 15 },
+	};
+
+	const BC6HMode BC6H_MODE1 = { 0x00, 2, 2, true, 10, 5, BC6H_FIELDS1, std::size(BC6H_FIELDS1) };
+	const BC6HMode BC6H_MODE10 = { 0x1E, 5, 2, false, 6, 6, BC6H_FIELDS10, std::size(BC6H_FIELDS10) };
+	const BC6HMode BC6H_MODE11 = { 0x03, 5, 1, false, 10, 10, BC6H_FIELDS11, std::size(BC6H_FIELDS11) };
+	const BC6HMode BC6H_MODE12 = { 0x07, 5, 1, true, 11, 9, BC6H_FIELDS12, std::size(BC6H_FIELDS12) };
+	const BC6HMode BC6H_MODE13 = { 0x0B, 5, 1, true, 12, 8, BC6H_FIELDS13, std::size(BC6H_FIELDS13) };
+	const BC6HMode BC6H_MODE14 = { 0x0F, 5, 1, true, 16, 4, BC6H_FIELDS14, std::size(BC6H_FIELDS14) };
+
+	const BC6HMode* GetBC6HMode(uint32_t value)
+	{
+		switch (value)
+		{
+		case 0x00: return &BC6H_MODE1;
+		case 0x1E: return &BC6H_MODE10;
+		case 0x03: return &BC6H_MODE11;
+		case 0x07: return &BC6H_MODE12;
+		case 0x0B: return &BC6H_MODE13;
+		case 0x0F: return &BC6H_MODE14;
+		default: return nullptr;
+		}
+	}
+
+	inline uint32_t UnquantizeBC6H(uint32_t code, uint32_t bits)
+	{
+		if (bits >= 15 || code == 0)
+			return code;
+		if (code == (1u << bits) - 1)
+			return 0xFFFF;
+		return ((code << 16) + 0x8000) >> bits;
+	}
+
+	// The code whose unquantized value is nearest [value] (0 - 65535)
+	uint32_t QuantizeBC6H(float value, uint32_t bits)
+	{
+		const int maxCode = (1 << bits) - 1;
+		const int guess = std::min(std::max((int)(value * (float)(1 << bits) / 65536.0f), 0), maxCode);
+		uint32_t best = 0;
+		float bestError = FLT_MAX;
+		for (int code = std::max(guess - 1, 0); code <= std::min(guess + 1, maxCode); ++code)
+		{
+			const float error = fabsf((float)UnquantizeBC6H(code, bits) - value);
+			if (error < bestError)
+			{
+				bestError = error;
+				best = (uint32_t)code;
+			}
+		}
+		return best;
+	}
+
+	// Half bits of an unquantized value
+	inline uint16_t FinishBC6H(uint32_t value)
+	{
+		return (uint16_t)((value * 31) >> 6);
+	}
+
+	struct BC6HBlock
+	{
+		const BC6HMode* mode = nullptr;
+		float error = FLT_MAX;
+		uint32_t partition = 0;
+		int32_t codes[4][3] = {};  // [endpoint][channel], as numbered in BC6HField
+		uint8_t indices[16] = {};
+	};
+
+	inline uint32_t RegionMask(const BC6HMode& mode, uint32_t partition, uint32_t region)
+	{
+		if (mode.regions == 1)
+			return 0xFFFF;
+		return region == 0 ? ~PARTITIONS2[partition] & 0xFFFFu : PARTITIONS2[partition];
+	}
+
+	inline uint32_t RegionAnchor(uint32_t partition, uint32_t region)
+	{
+		return region == 0 ? 0 : ANCHORS2[partition];
+	}
+
+	bool DeltasFit(const BC6HBlock& block)
+	{
+		const BC6HMode& mode = *block.mode;
+		if (!mode.transformed)
+			return true;
+		const int32_t lo = -(1 << (mode.deltaBits - 1));
+		const int32_t hi = (1 << (mode.deltaBits - 1)) - 1;
+		for (uint32_t e = 1; e < 2 * mode.regions; ++e)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const int32_t delta = block.codes[e][c] - block.codes[0][c];
+				if (delta < lo || delta > hi)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// Quantizes [endpoints] and picks the nearest palette color for every texel, into [block]
+	void EvaluateBC6H(const Texels& t, const BC6HMode& mode, uint32_t partition, float endpoints[2][2][4], BC6HBlock& block)
+	{
+		const uint32_t entries = mode.regions == 1 ? 16 : 8;
+		const uint8_t* weights = mode.regions == 1 ? WEIGHTS4 : WEIGHTS3;
+
+		block.mode = &mode;
+		block.partition = partition;
+		block.error = 0.0f;
+
+		// Each region starts at the endpoint nearer its anchor texel, whose index has no top bit
+		for (uint32_t r = 0; r < mode.regions; ++r)
+		{
+			const float* anchor = t.v[RegionAnchor(partition, r)];
+			float d0 = 0.0f, d1 = 0.0f;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				d0 += (anchor[c] - endpoints[r][0][c]) * (anchor[c] - endpoints[r][0][c]);
+				d1 += (anchor[c] - endpoints[r][1][c]) * (anchor[c] - endpoints[r][1][c]);
+			}
+			const uint32_t first = d1 < d0 ? 1 : 0;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				block.codes[2 * r][c] = (int32_t)QuantizeBC6H(endpoints[r][first][c] * 257.0f, mode.endpointBits);
+				block.codes[2 * r + 1][c] = (int32_t)QuantizeBC6H(endpoints[r][1 - first][c] * 257.0f, mode.endpointBits);
+			}
+		}
+
+		// Deltas that don't fit are clamped, the error tells whether that was acceptable
+		if (mode.transformed)
+		{
+			const int32_t maxCode = (1 << mode.endpointBits) - 1;
+			for (uint32_t e = 1; e < 2 * mode.regions; ++e)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const int32_t base = block.codes[0][c];
+					const int32_t lo = std::max(base - (1 << (mode.deltaBits - 1)), 0);
+					const int32_t hi = std::min(base + (1 << (mode.deltaBits - 1)) - 1, maxCode);
+					block.codes[e][c] = std::min(std::max(block.codes[e][c], lo), hi);
+				}
+			}
+		}
+
+		for (uint32_t r = 0; r < mode.regions; ++r)
+		{
+			Palette palette;
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const uint32_t a = UnquantizeBC6H(block.codes[2 * r][c], mode.endpointBits);
+				const uint32_t b = UnquantizeBC6H(block.codes[2 * r + 1][c], mode.endpointBits);
+				for (uint32_t e = 0; e < entries; ++e)
+					palette[e][c] = Interpolate(a, b, weights[e]) / 257.0f;
+			}
+			for (uint32_t e = 0; e < entries; ++e)
+				palette[e][3] = 0.0f;
+
+			uint8_t indices[16];
+			float errors[16];
+			const uint32_t mask = RegionMask(mode, partition, r);
+			FindNearest(t, palette, entries, 0, 3, indices, errors, mask);
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (mask & (1u << i))
+				{
+					block.indices[i] = indices[i];
+					block.error += errors[i];
+				}
+			}
+		}
+
+		// An anchor that still landed in the upper half flips its region. Weights are symmetric, so the
+		// texels decode the same, but the deltas of a transformed mode change.
+		bool flipped = false;
+		for (uint32_t r = 0; r < mode.regions; ++r)
+		{
+			if (block.indices[RegionAnchor(partition, r)] < entries / 2)
+				continue;
+			flipped = true;
+			for (uint32_t c = 0; c < 3; ++c)
+				std::swap(block.codes[2 * r][c], block.codes[2 * r + 1][c]);
+			const uint32_t mask = RegionMask(mode, partition, r);
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				if (mask & (1u << i))
+					block.indices[i] = (uint8_t)(entries - 1 - block.indices[i]);
+			}
+		}
+		if (flipped && !DeltasFit(block))
+			block.error = FLT_MAX;
+	}
+
+	// Fits every region of [partition] with a line, refines the endpoints by least squares, and keeps the
+	// result in [best] if it beats it
+	void FitBC6H(const Texels& t, const BC6HMode& mode, uint32_t partition, uint32_t refinements, BC6HBlock& best)
+	{
+		const uint8_t* weights = mode.regions == 1 ? WEIGHTS4 : WEIGHTS3;
+
+		float endpoints[2][2][4];
+		for (uint32_t r = 0; r < mode.regions; ++r)
+			FitLine(t, RegionMask(mode, partition, r), 0, 3, 4, endpoints[r][0], endpoints[r][1]);
+
+		BC6HBlock candidate;
+		for (uint32_t k = 0;; ++k)
+		{
+			EvaluateBC6H(t, mode, partition, endpoints, candidate);
+			if (candidate.error < best.error)
+				best = candidate;
+			if (k == refinements || candidate.error == 0.0f || candidate.error == FLT_MAX)
+				break;
+
+			float w[16];
+			for (uint32_t i = 0; i < 16; ++i)
+				w[i] = weights[candidate.indices[i]] / 64.0f;
+			for (uint32_t r = 0; r < mode.regions; ++r)
+			{
+				// Refit works on the endpoints as quantized, in the order the indices refer to
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					endpoints[r][0][c] = UnquantizeBC6H(candidate.codes[2 * r][c], mode.endpointBits) / 257.0f;
+					endpoints[r][1][c] = UnquantizeBC6H(candidate.codes[2 * r + 1][c], mode.endpointBits) / 257.0f;
+				}
+				Refit(t, RegionMask(mode, partition, r), 0, 3, w, endpoints[r][0], endpoints[r][1]);
+			}
+		}
+	}
+
+	void WriteBC6H(const BC6HBlock& block, uint8_t* out)
+	{
+		const BC6HMode& mode = *block.mode;
+
+		uint32_t stored[4][3] = {};
+		for (uint32_t e = 0; e < 2 * mode.regions; ++e)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const int32_t value = mode.transformed && e > 0 ? block.codes[e][c] - block.codes[0][c] : block.codes[e][c];
+				stored[e][c] = (uint32_t)value & ((1u << (e > 0 ? mode.deltaBits : mode.endpointBits)) - 1);
+			}
+		}
+
+		BitWriter writer(out, 16);
+		writer.Write(mode.value, mode.modeBits);
+		for (uint32_t f = 0; f < mode.fieldCount; ++f)
+		{
+			const BC6HField& field = mode.fields[f];
+			const int step = field.from >= field.to ? 1 : -1;
+			for (int bit = field.to;; bit += step)
+			{
+				writer.Write(stored[field.endpoint][field.channel] >> bit, 1);
+				if (bit == field.from)
+					break;
+			}
+		}
+		if (mode.regions == 2)
+			writer.Write(block.partition, 5);
+
+		const uint32_t indexBits = mode.regions == 1 ? 4 : 3;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const bool anchor = i == 0 || (mode.regions == 2 && i == ANCHORS2[block.partition]);
+			writer.Write(block.indices[i], anchor ? indexBits - 1 : indexBits);
+		}
+	}
+
+	// [texels]: 16 RGBA half floats, alpha is ignored
+	void EncodeBC6H(const uint8_t* texels, uint8_t* out, Quality quality)
+	{
+		Texels t;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				uint16_t half;
+				memcpy(&half, texels + (i * 4 + c) * sizeof(uint16_t), sizeof(uint16_t));
+
+				// Unsigned: negatives and NaN become 0, infinity the largest finite half
+				if (half & 0x8000)
+					half = 0;
+				else if ((half & 0x7C00) == 0x7C00)
+					half = (half & 0x3FF) ? 0 : 0x7BFF;
+				t.v[i][c] = (half + 0.5f) * 64.0f / 31.0f / 257.0f;
+			}
+			t.v[i][3] = 0.0f;
+		}
+		t.Transpose();
+
+		const uint32_t refinements = quality == Quality::Fast ? 1 : 2;
+		BC6HBlock best;
+		FitBC6H(t, BC6H_MODE11, 0, refinements, best);
+
+		// Transformed modes trade precision of the second endpoint for more precision of the first
+		if (quality != Quality::Fast && best.error > 0.0f)
+		{
+			FitBC6H(t, BC6H_MODE12, 0, refinements, best);
+			FitBC6H(t, BC6H_MODE13, 0, refinements, best);
+			FitBC6H(t, BC6H_MODE14, 0, refinements, best);
+		}
+
+		// Two regions, along one of the first 32 partitions
+		if (quality == Quality::High && best.error > 0.0f)
+		{
+			uint32_t partitions[32];
+			RankPartitions(t, 32, 8, partitions);
+			for (uint32_t k = 0; k < 8; ++k)
+			{
+				FitBC6H(t, BC6H_MODE1, partitions[k], refinements, best);
+				FitBC6H(t, BC6H_MODE10, partitions[k], refinements, best);
+			}
+		}
+
+		WriteBC6H(best, out);
+	}
+
+	void DecodeBC6H(const uint8_t* block, uint8_t* texels)
+	{
+		uint16_t halves[64];
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			halves[4 * i + 0] = halves[4 * i + 1] = halves[4 * i + 2] = 0;
+			halves[4 * i + 3] = 0x3C00;  // 1.0
+		}
+
+		BitReader reader(block);
+		uint32_t value = reader.Read(2);
+		if (value >= 2)
+			value |= reader.Read(3) << 2;
+		const BC6HMode* mode = GetBC6HMode(value);
+		if (!mode)
+		{
+			memcpy(texels, halves, sizeof(halves));
+			return;
+		}
+
+		uint32_t stored[4][3] = {};
+		for (uint32_t f = 0; f < mode->fieldCount; ++f)
+		{
+			const BC6HField& field = mode->fields[f];
+			const int step = field.from >= field.to ? 1 : -1;
+			for (int bit = field.to;; bit += step)
+			{
+				stored[field.endpoint][field.channel] |= reader.Read(1) << bit;
+				if (bit == field.from)
+					break;
+			}
+		}
+		const uint32_t partition = mode->regions == 2 ? reader.Read(5) : 0;
+
+		uint32_t endpoints[4][3];
+		const uint32_t mask = (1u << mode->endpointBits) - 1;
+		for (uint32_t e = 0; e < 2 * mode->regions; ++e)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				uint32_t code = stored[e][c];
+				if (mode->transformed && e > 0)
+				{
+					const int32_t delta = (int32_t)(code << (32 - mode->deltaBits)) >> (32 - mode->deltaBits);
+					code = (uint32_t)((int32_t)stored[0][c] + delta) & mask;
+				}
+				endpoints[e][c] = UnquantizeBC6H(code, mode->endpointBits);
+			}
+		}
+
+		const uint32_t indexBits = mode->regions == 1 ? 4 : 3;
+		const uint8_t* weights = mode->regions == 1 ? WEIGHTS4 : WEIGHTS3;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const bool anchor = i == 0 || (mode->regions == 2 && i == ANCHORS2[partition]);
+			const uint32_t index = reader.Read(anchor ? indexBits - 1 : indexBits);
+			const uint32_t r = mode->regions == 2 ? (PARTITIONS2[partition] >> i) & 1 : 0;
+			for (uint32_t c = 0; c < 3; ++c)
+				halves[4 * i + c] = FinishBC6H(Interpolate(endpoints[2 * r][c], endpoints[2 * r + 1][c], weights[index]));
+		}
+		memcpy(texels, halves, sizeof(halves));
+	}
+}
+
+uint32_t STextureCompression::GetBlockSize(Format format)
+{
+	return format == Format::BC1 || format == Format::BC4 ? 8 : 16;
+}
+
+uint32_t STextureCompression::GetTexelSize(Format format)
+{
+	return format == Format::BC6H ? 8 : 4;
+}
+
+void STextureCompression::EncodeBlock(Format format, const uint8_t* rgba, uint8_t* block, Quality quality)
+{
+	if (format == Format::BC6H)
+	{
+		EncodeBC6H(rgba, block, quality);
+		return;
+	}
+
+	const Texels t(rgba);
+	switch (format)
+	{
+	case Format::BC1:
+		EncodeBC1(t, block, quality);
+		break;
+	case Format::BC4:
+		EncodeBC4(t, 0, block, quality);
+		break;
+	case Format::BC5:
+		EncodeBC4(t, 0, block, quality);
+		EncodeBC4(t, 1, block + 8, quality);
+		break;
+	case Format::BC7:
+		EncodeBC7(t, block, quality);
+		break;
+	case Format::BC6H:
+		break;
+	}
+}
+
+void STextureCompression::DecodeBlock(Format format, const uint8_t* block, uint8_t* rgba)
+{
+	switch (format)
+	{
+	case Format::BC1:
+		DecodeBC1(block, rgba);
+		break;
+	case Format::BC4:
+	case Format::BC5:
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			rgba[4 * i + 1] = rgba[4 * i + 2] = 0;
+			rgba[4 * i + 3] = 255;
+		}
+		DecodeBC4(block, 0, rgba);
+		if (format == Format::BC5)
+			DecodeBC4(block + 8, 1, rgba);
+		break;
+	case Format::BC6H:
+		DecodeBC6H(block, rgba);
+		break;
+	case Format::BC7:
+		DecodeBC7(block, rgba);
+		break;
+	}
+}
+
+void STextureCompression::Encode(Format format, const uint8_t* src, uint32_t width, uint32_t height, size_t srcPitch,
+	uint8_t* dst, size_t dstPitch, Quality quality, uint32_t maxThreads)
+{
+	const uint32_t blocksX = (width + 3) / 4;
+	const uint32_t blocksY = (height + 3) / 4;
+	const uint32_t blockSize = GetBlockSize(format);
+	const uint32_t texelSize = GetTexelSize(format);
+
+	ParallelFor(blocksY, [&](uint32_t by)
+	{
+		uint8_t rgba[128];
+		for (uint32_t bx = 0; bx < blocksX; ++bx)
+		{
+			for (uint32_t y = 0; y < 4; ++y)
+			{
+				const uint8_t* row = src + std::min(by * 4 + y, height - 1) * srcPitch;
+				for (uint32_t x = 0; x < 4; ++x)
+					memcpy(rgba + (y * 4 + x) * texelSize, row + std::min(bx * 4 + x, width - 1) * texelSize, texelSize);
+			}
+			EncodeBlock(format, rgba, dst + by * dstPitch + bx * blockSize, quality);
+		}
+	}, maxThreads);
+}
+
+void STextureCompression::Decode(Format format, const uint8_t* src, uint32_t width, uint32_t height, size_t srcPitch,
+	uint8_t* dst, size_t dstPitch)
+{
+	const uint32_t blockSize = GetBlockSize(format);
+	const uint32_t texelSize = GetTexelSize(format);
+	uint8_t rgba[128];
+	for (uint32_t by = 0; by < (height + 3) / 4; ++by)
+	{
+		for (uint32_t bx = 0; bx < (width + 3) / 4; ++bx)
+		{
+			DecodeBlock(format, src + by * srcPitch + bx * blockSize, rgba);
+			for (uint32_t y = 0; y < 4 && by * 4 + y < height; ++y)
+			{
+				for (uint32_t x = 0; x < 4 && bx * 4 + x < width; ++x)
+					memcpy(dst + (by * 4 + y) * dstPitch + (bx * 4 + x) * texelSize, rgba + (y * 4 + x) * texelSize, texelSize);
+			}
+		}
+	}
+}
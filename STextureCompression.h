@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Block compression of 8-bit RGBA texels into BC1, BC4, BC5 and BC7, of half float RGBA texels into BC6H,
+// and decoders to measure the result.
+//
+// BC1: RGB (1-bit alpha), 8 bytes per 4x4 block. BC4: the R channel, 8 bytes. BC5: R and G as two BC4 blocks,
+// for tangent space normals whose Z the shader reconstructs. BC7: RGBA, 16 bytes, using modes 1, 3 and 6.
+// BC6H: unsigned HDR RGB, 16 bytes, using modes 11 to 14 and, at High quality, the two region modes 1 and 10.
+//
+// All functions work on plain arrays without D3D, so encoders produce the same blocks on every platform.
+// sRGB is a property of the DXGI format only: texels are compressed in the space they are stored in.
+namespace STextureCompression
+{
+	enum class Format
+	{
+		BC1,
+		BC4,
+		BC5,
+		BC6H,  // DXGI_FORMAT_BC6H_UF16
+		BC7,
+	};
+
+	enum class Quality
+	{
+		Fast,    // Endpoints from the principal axis; BC7 mode 6 without refinement, BC6H mode 11 with one
+		Normal,  // One least squares refinement (two for BC6H); BC7 also tries modes 1 and 3 on the 4 most promising partitions,
+		         // BC6H the other one region modes
+		High,    // Several refinements and endpoint searches; BC7 tries 16 partitions, BC6H two regions on 8
+	};
+
+	// Bytes of one 4 x 4 block
+	uint32_t GetBlockSize(Format format);
+	// Bytes of one source texel: 4 (RGBA8), or 8 (RGBA half) for BC6H
+	uint32_t GetTexelSize(Format format);
+
+	// [rgba]: 16 texels in row order. BC6H clamps negative and NaN texels to 0 and ignores alpha.
+	void EncodeBlock(Format format, const uint8_t* rgba, uint8_t* block, Quality quality);
+	// Writes 16 texels. Channels the format does not store are 0, alpha 255 (1.0 for BC6H).
+	// BC7 blocks of modes the encoder does not write (0, 2, 4, 5, 7), and BC6H blocks of modes 2 to 9, decode to black.
+	void DecodeBlock(Format format, const uint8_t* block, uint8_t* rgba);
+
+	// Encodes [width] x [height] texels, rows [srcPitch] bytes apart, into rows of blocks [dstPitch] bytes apart.
+	// Blocks past the right or bottom edge repeat the last column or row.
+	// Block rows are spread over up to [maxThreads] threads (0: one per core).
+	void Encode(Format format, const uint8_t* src, uint32_t width, uint32_t height, size_t srcPitch,
+		uint8_t* dst, size_t dstPitch, Quality quality, uint32_t maxThreads = 0);
+	void Decode(Format format, const uint8_t* src, uint32_t width, uint32_t height, size_t srcPitch,
+		uint8_t* dst, size_t dstPitch);
+}
@@ -0,0 +1,242 @@
+#include "STransformStore.h"
+
+#include <cassert>
+#include <cstring>
+#include <immintrin.h>
+
+using namespace DirectX;
+
+void STransformStore::clear()
+{
+	m_count = 0;
+	m_positionX.clear(); m_positionY.clear(); m_positionZ.clear();
+	m_rotationX.clear(); m_rotationY.clear(); m_rotationZ.clear(); m_rotationW.clear();
+	m_scaleX.clear(); m_scaleY.clear(); m_scaleZ.clear();
+	m_parent.clear();
+	m_dirty.clear();
+	m_world.clear();
+	m_normal.clear();
+	m_hasChildren = false;
+}
+
+void STransformStore::reserve(size_t count)
+{
+	count = (count + 3) & ~size_t(3);
+	m_positionX.reserve(count); m_positionY.reserve(count); m_positionZ.reserve(count);
+	m_rotationX.reserve(count); m_rotationY.reserve(count); m_rotationZ.reserve(count); m_rotationW.reserve(count);
+	m_scaleX.reserve(count); m_scaleY.reserve(count); m_scaleZ.reserve(count);
+	m_parent.reserve(count);
+	m_dirty.reserve(count);
+	m_world.reserve(count);
+	m_normal.reserve(count);
+}
+
+uint32_t STransformStore::Create(uint32_t parent)
+{
+	const uint32_t id = (uint32_t)m_count;
+	assert(parent == NO_PARENT || parent < id);
+
+	// Grow by a whole SSE block of identity transforms
+	if (m_count % 4 == 0)
+	{
+		const size_t padded = m_count + 4;
+		m_positionX.resize(padded, 0.0f); m_positionY.resize(padded, 0.0f); m_positionZ.resize(padded, 0.0f);
+		m_rotationX.resize(padded, 0.0f); m_rotationY.resize(padded, 0.0f); m_rotationZ.resize(padded, 0.0f); m_rotationW.resize(padded, 1.0f);
+		m_scaleX.resize(padded, 1.0f); m_scaleY.resize(padded, 1.0f); m_scaleZ.resize(padded, 1.0f);
+		m_parent.resize(padded, NO_PARENT);
+		m_dirty.resize(padded, 0);
+
+		XMFLOAT4X4 identity;
+		XMStoreFloat4x4(&identity, XMMatrixIdentity());
+		m_world.resize(padded, identity);
+		m_normal.resize(padded, identity);
+	}
+
+	// A padding slot may have been rotated by RotateAll since it was added
+	m_positionX[id] = 0.0f; m_positionY[id] = 0.0f; m_positionZ[id] = 0.0f;
+	m_rotationX[id] = 0.0f; m_rotationY[id] = 0.0f; m_rotationZ[id] = 0.0f; m_rotationW[id] = 1.0f;
+	m_scaleX[id] = 1.0f; m_scaleY[id] = 1.0f; m_scaleZ[id] = 1.0f;
+	m_parent[id] = parent;
+	m_hasChildren |= parent != NO_PARENT;
+	m_dirty[id] = 1;
+	++m_count;
+	return id;
+}
+
+void STransformStore::SetPosition(uint32_t id, const XMFLOAT3& position)
+{
+	m_positionX[id] = position.x;
+	m_positionY[id] = position.y;
+	m_positionZ[id] = position.z;
+	m_dirty[id] = 1;
+}
+
+void STransformStore::SetRotation(uint32_t id, FXMVECTOR quaternion)
+{
+	XMFLOAT4 q;
+	XMStoreFloat4(&q, XMQuaternionNormalize(quaternion));
+	m_rotationX[id] = q.x;
+	m_rotationY[id] = q.y;
+	m_rotationZ[id] = q.z;
+	m_rotationW[id] = q.w;
+	m_dirty[id] = 1;
+}
+
+void STransformStore::SetScale(uint32_t id, const XMFLOAT3& scale)
+{
+	assert(scale.x != 0.0f && scale.y != 0.0f && scale.z != 0.0f);  // The normal matrix divides by them
+	m_scaleX[id] = scale.x;
+	m_scaleY[id] = scale.y;
+	m_scaleZ[id] = scale.z;
+	m_dirty[id] = 1;
+}
+
+XMFLOAT3 STransformStore::GetPosition(uint32_t id) const
+{
+	return XMFLOAT3(m_positionX[id], m_positionY[id], m_positionZ[id]);
+}
+
+XMVECTOR STransformStore::GetRotation(uint32_t id) const
+{
+	return XMVectorSet(m_rotationX[id], m_rotationY[id], m_rotationZ[id], m_rotationW[id]);
+}
+
+XMFLOAT3 STransformStore::GetScale(uint32_t id) const
+{
+	return XMFLOAT3(m_scaleX[id], m_scaleY[id], m_scaleZ[id]);
+}
+
+void STransformStore::Rotate(uint32_t id, FXMVECTOR quaternion)
+{
+	SetRotation(id, XMQuaternionMultiply(GetRotation(id), quaternion));
+}
+
+void STransformStore::RotateAll(FXMVECTOR quaternion)
+{
+	XMFLOAT4 q;
+	XMStoreFloat4(&q, quaternion);
+	const __m128 ax = _mm_set1_ps(q.x), ay = _mm_set1_ps(q.y), az = _mm_set1_ps(q.z), aw = _mm_set1_ps(q.w);
+
+	// Same product as XMQuaternionMultiply(rotation, quaternion), renormalized against drift
+	for (size_t i = 0; i < m_positionX.size(); i += 4)
+	{
+		const __m128 bx = _mm_loadu_ps(&m_rotationX[i]);
+		const __m128 by = _mm_loadu_ps(&m_rotationY[i]);
+		const __m128 bz = _mm_loadu_ps(&m_rotationZ[i]);
+		const __m128 bw = _mm_loadu_ps(&m_rotationW[i]);
+
+		__m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bx), _mm_mul_ps(ax, bw)), _mm_mul_ps(ay, bz)), _mm_mul_ps(az, by));
+		__m128 y = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(aw, by), _mm_mul_ps(ax, bz)), _mm_mul_ps(ay, bw)), _mm_mul_ps(az, bx));
+		__m128 z = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(aw, bz), _mm_mul_ps(ax, by)), _mm_mul_ps(ay, bx)), _mm_mul_ps(az, bw));
+		__m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+
+		const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w))));
+		_mm_storeu_ps(&m_rotationX[i], _mm_div_ps(x, length));
+		_mm_storeu_ps(&m_rotationY[i], _mm_div_ps(y, length));
+		_mm_storeu_ps(&m_rotationZ[i], _mm_div_ps(z, length));
+		_mm_storeu_ps(&m_rotationW[i], _mm_div_ps(w, length));
+	}
+	memset(m_dirty.data(), 1, m_count);
+}
+
+void STransformStore::Update()
+{
+	// Children of dirty transforms are dirty too. Parents come first, so one pass reaches every descendant.
+	if (m_hasChildren)
+	{
+		for (size_t i = 0; i < m_count; ++i)
+		{
+			if (m_parent[i] != NO_PARENT)
+				m_dirty[i] |= m_dirty[m_parent[i]];
+		}
+	}
+
+	// Local matrices of 4 transforms at a time: world = scale * rotation * translation, and its inverse
+	// transpose, which is rotation with each row divided by its scale. Padding lanes are never dirty.
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 unitW = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	for (size_t i = 0; i < m_count; i += 4)
+	{
+		uint32_t dirtyMask;
+		memcpy(&dirtyMask, &m_dirty[i], sizeof(dirtyMask));
+		if (dirtyMask == 0)
+			continue;
+
+		const __m128 qx = _mm_loadu_ps(&m_rotationX[i]);
+		const __m128 qy = _mm_loadu_ps(&m_rotationY[i]);
+		const __m128 qz = _mm_loadu_ps(&m_rotationZ[i]);
+		const __m128 qw = _mm_loadu_ps(&m_rotationW[i]);
+		const __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+		const __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+		const __m128 xw = _mm_mul_ps(qx, qw), yw = _mm_mul_ps(qy, qw), zw = _mm_mul_ps(qz, qw);
+
+		// Rows of the rotation matrix, as XMMatrixRotationQuaternion
+		const __m128 r00 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+		const __m128 r01 = _mm_mul_ps(two, _mm_add_ps(xy, zw));
+		const __m128 r02 = _mm_mul_ps(two, _mm_sub_ps(xz, yw));
+		const __m128 r10 = _mm_mul_ps(two, _mm_sub_ps(xy, zw));
+		const __m128 r11 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+		const __m128 r12 = _mm_mul_ps(two, _mm_add_ps(yz, xw));
+		const __m128 r20 = _mm_mul_ps(two, _mm_add_ps(xz, yw));
+		const __m128 r21 = _mm_mul_ps(two, _mm_sub_ps(yz, xw));
+		const __m128 r22 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+
+		const __m128 sx = _mm_loadu_ps(&m_scaleX[i]);
+		const __m128 sy = _mm_loadu_ps(&m_scaleY[i]);
+		const __m128 sz = _mm_loadu_ps(&m_scaleZ[i]);
+		const __m128 isx = _mm_div_ps(one, sx);
+		const __m128 isy = _mm_div_ps(one, sy);
+		const __m128 isz = _mm_div_ps(one, sz);
+
+		// Transpose the SoA rows into one row per transform
+		__m128 w0 = _mm_mul_ps(sx, r00), w1 = _mm_mul_ps(sx, r01), w2 = _mm_mul_ps(sx, r02), w3 = zero;
+		__m128 w4 = _mm_mul_ps(sy, r10), w5 = _mm_mul_ps(sy, r11), w6 = _mm_mul_ps(sy, r12), w7 = zero;
+		__m128 w8 = _mm_mul_ps(sz, r20), w9 = _mm_mul_ps(sz, r21), w10 = _mm_mul_ps(sz, r22), w11 = zero;
+		__m128 t0 = _mm_loadu_ps(&m_positionX[i]), t1 = _mm_loadu_ps(&m_positionY[i]), t2 = _mm_loadu_ps(&m_positionZ[i]), t3 = one;
+		_MM_TRANSPOSE4_PS(w0, w1, w2, w3);
+		_MM_TRANSPOSE4_PS(w4, w5, w6, w7);
+		_MM_TRANSPOSE4_PS(w8, w9, w10, w11);
+		_MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+
+		__m128 n0 = _mm_mul_ps(isx, r00), n1 = _mm_mul_ps(isx, r01), n2 = _mm_mul_ps(isx, r02), n3 = zero;
+		__m128 n4 = _mm_mul_ps(isy, r10), n5 = _mm_mul_ps(isy, r11), n6 = _mm_mul_ps(isy, r12), n7 = zero;
+		__m128 n8 = _mm_mul_ps(isz, r20), n9 = _mm_mul_ps(isz, r21), n10 = _mm_mul_ps(isz, r22), n11 = zero;
+		_MM_TRANSPOSE4_PS(n0, n1, n2, n3);
+		_MM_TRANSPOSE4_PS(n4, n5, n6, n7);
+		_MM_TRANSPOSE4_PS(n8, n9, n10, n11);
+
+		const __m128 world[4][4] = { { w0, w4, w8, t0 }, { w1, w5, w9, t1 }, { w2, w6, w10, t2 }, { w3, w7, w11, t3 } };
+		const __m128 normal[4][3] = { { n0, n4, n8 }, { n1, n5, n9 }, { n2, n6, n10 }, { n3, n7, n11 } };
+		for (uint32_t lane = 0; lane < 4; ++lane)
+		{
+			if (!m_dirty[i + lane])
+				continue;
+
+			float* dstWorld = &m_world[i + lane]._11;
+			float* dstNormal = &m_normal[i + lane]._11;
+			for (uint32_t row = 0; row < 4; ++row)
+				_mm_storeu_ps(dstWorld + 4 * row, world[lane][row]);
+			for (uint32_t row = 0; row < 3; ++row)
+				_mm_storeu_ps(dstNormal + 4 * row, normal[lane][row]);
+			_mm_storeu_ps(dstNormal + 12, unitW);
+		}
+	}
+
+	// Children: local * parent. The inverse transpose of a product is the product of the inverse transposes.
+	if (m_hasChildren)
+	{
+		for (size_t i = 0; i < m_count; ++i)
+		{
+			const uint32_t parent = m_parent[i];
+			if (parent == NO_PARENT || !m_dirty[i])
+				continue;
+
+			XMStoreFloat4x4(&m_world[i], XMMatrixMultiply(XMLoadFloat4x4(&m_world[i]), XMLoadFloat4x4(&m_world[parent])));
+			XMStoreFloat4x4(&m_normal[i], XMMatrixMultiply(XMLoadFloat4x4(&m_normal[i]), XMLoadFloat4x4(&m_normal[parent])));
+		}
+	}
+
+	memset(m_dirty.data(), 0, m_count);
+}
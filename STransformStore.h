@@ -0,0 +1,58 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+// Position, rotation and scale of every object relative to its parent, one array per component, and the
+// world and normal matrices derived from them. Setters only mark a transform dirty; Update recomputes the
+// matrices of all dirty transforms and their descendants in one pass, 4 transforms per SSE iteration.
+// A parent must be created before its children, so index order visits every parent before them.
+class STransformStore
+{
+private:
+	size_t m_count = 0;
+
+	// Padded with identity transforms to a multiple of 4
+	std::vector<float> m_positionX, m_positionY, m_positionZ;
+	std::vector<float> m_rotationX, m_rotationY, m_rotationZ, m_rotationW;  // Unit quaternion
+	std::vector<float> m_scaleX, m_scaleY, m_scaleZ;
+	std::vector<uint32_t> m_parent;
+	std::vector<uint8_t> m_dirty;
+	bool m_hasChildren = false;
+
+	// Row vectors, as DirectXMath. The normal matrix is the inverse transpose of the world matrix, without translation.
+	std::vector<DirectX::XMFLOAT4X4> m_world;
+	std::vector<DirectX::XMFLOAT4X4> m_normal;
+
+public:
+	inline size_t size() const { return m_count; }
+	void clear();
+	void reserve(size_t count);
+
+	// Returns the index of a new identity transform
+	uint32_t Create(uint32_t parent = NO_PARENT);
+	inline uint32_t GetParent(uint32_t id) const { return m_parent[id]; }
+
+	void SetPosition(uint32_t id, const DirectX::XMFLOAT3& position);
+	void SetRotation(uint32_t id, DirectX::FXMVECTOR quaternion);
+	void SetScale(uint32_t id, const DirectX::XMFLOAT3& scale);
+	inline void SetScale(uint32_t id, float factor) { SetScale(id, DirectX::XMFLOAT3(factor, factor, factor)); }
+	DirectX::XMFLOAT3 GetPosition(uint32_t id) const;
+	DirectX::XMVECTOR GetRotation(uint32_t id) const;
+	DirectX::XMFLOAT3 GetScale(uint32_t id) const;
+
+	// Applies [quaternion] after the current rotation
+	void Rotate(uint32_t id, DirectX::FXMVECTOR quaternion);
+	// Rotate for every transform at once
+	void RotateAll(DirectX::FXMVECTOR quaternion);
+
+	void Update();
+
+	// Valid after Update
+	inline const DirectX::XMFLOAT4X4& GetWorldMatrix(uint32_t id) const { return m_world[id]; }
+	inline const DirectX::XMFLOAT4X4& GetNormalMatrix(uint32_t id) const { return m_normal[id]; }
+	inline DirectX::XMMATRIX LoadWorldMatrix(uint32_t id) const { return DirectX::XMLoadFloat4x4(&m_world[id]); }
+};
@@ -27,14 +27,37 @@ struct SALIGN CameraConstants
 	float4x4 projection;
 };
 
-struct SALIGN ModelConstants
+// Element of the per-frame instance buffer, read by render.hlsl through SV_InstanceID
+struct InstanceData
 {
 	float4x4 model;
+	float4x4 normalMatrix;  // Inverse transpose of [model], for normals
+	uint materialIndex;  // Into the material table, see MATERIAL_TEXTURE_COUNT
+	uint padding[3];
 };
 
+// Root constants of render.hlsl, set per draw
+struct DrawConstants
+{
+	// Dequantization of packed vertex positions: position = packed.xyz * positionScale.xyz + positionOffset.xyz
+	float4 positionScale;
+	float4 positionOffset;
+
+	// SV_InstanceID restarts at 0 in every draw, so the draw's offset into the instance buffer is passed along
+	uint firstInstance;
+};
+
+// Every material takes this many consecutive SRVs in the material table: diffuse, normal, arm and emission
+#define MATERIAL_TEXTURE_COUNT 4
+
+// Diffuse irradiance over pi as SH9 coefficients, see SSphericalHarmonics.h. RGB in xyz, w unused.
+#define IRRADIANCE_SH_COEFFICIENTS 9
+
 struct SALIGN PBRConstants
 {
 	float3 eyePosition;
+	float padding;
+	float4 irradianceSH[IRRADIANCE_SH_COEFFICIENTS];
 };
 
 struct SALIGN ToneMapperParams
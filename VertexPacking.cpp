@@ -0,0 +1,105 @@
+#include "VertexPacking.h"
+
+#include "ParallelFor.h"
+
+using namespace DirectX;
+using namespace DirectX::PackedVector;
+
+namespace
+{
+	// Vertices per ParallelFor item
+	constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+	// +1 for components >= 0, -1 otherwise
+	inline XMVECTOR XM_CALLCONV SignNotZero(FXMVECTOR v)
+	{
+		return XMVectorSelect(XMVectorReplicate(-1.0f), XMVectorSplatOne(), XMVectorGreaterOrEqual(v, XMVectorZero()));
+	}
+
+	inline XMVECTOR XM_CALLCONV GetInverseExtent(FXMVECTOR extent)
+	{
+		// Flat axes quantize to 0 instead of dividing by zero
+		return XMVectorSelect(XMVectorZero(), XMVectorReciprocal(extent), XMVectorGreater(extent, XMVectorZero()));
+	}
+}
+
+XMVECTOR XM_CALLCONV VertexPacking::EncodeOctahedral(FXMVECTOR n)
+{
+	// Project onto |x| + |y| + |z| = 1
+	XMVECTOR l1 = XMVectorMax(XMVector3Dot(XMVectorAbs(n), XMVectorSplatOne()), XMVectorReplicate(1e-20f));
+	XMVECTOR p = XMVectorDivide(n, l1);
+
+	// Fold the lower hemisphere over the diagonals
+	XMVECTOR folded = XMVectorMultiply(XMVectorSubtract(XMVectorSplatOne(), XMVectorAbs(XMVectorSwizzle<1, 0, 2, 3>(p))), SignNotZero(p));
+	return XMVectorSelect(p, folded, XMVectorLess(XMVectorSplatZ(p), XMVectorZero()));
+}
+
+XMVECTOR XM_CALLCONV VertexPacking::DecodeOctahedral(FXMVECTOR e)
+{
+	XMVECTOR absE = XMVectorAbs(e);
+	XMVECTOR n = XMVectorSetZ(e, 1.0f - XMVectorGetX(absE) - XMVectorGetY(absE));
+
+	// Unfold the lower hemisphere: xy -= sign(xy) * saturate(-z)
+	XMVECTOR t = XMVectorSaturate(XMVectorNegate(XMVectorSplatZ(n)));
+	XMVECTOR offset = XMVectorSelect(XMVectorZero(), XMVectorMultiply(t, SignNotZero(n)), XMVectorSelectControl(1, 1, 0, 0));
+	return XMVector3Normalize(XMVectorSubtract(n, offset));
+}
+
+void VertexPacking::Encode(const SVertex* vertices, size_t count, const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax, SPackedVertex* out)
+{
+	const XMVECTOR vMin = XMLoadFloat3(&boundsMin);
+	const XMVECTOR vInvExtent = GetInverseExtent(XMVectorSubtract(XMLoadFloat3(&boundsMax), vMin));
+
+	ParallelFor((uint32_t)((count + BLOCK_SIZE - 1) / BLOCK_SIZE), [&](uint32_t block)
+	{
+		const size_t end = std::min(count, (block + 1) * BLOCK_SIZE);
+		for (size_t i = block * BLOCK_SIZE; i < end; ++i)
+		{
+			const SVertex& v = vertices[i];
+			XMVECTOR n = XMVector3Normalize(XMLoadFloat3(&v.normal));
+			XMVECTOR t = XMLoadFloat3(&v.tangent);
+			XMVECTOR b = XMLoadFloat3(&v.bitangent);
+
+			// Gram-Schmidt, so that cross(n, t) is a unit bitangent again after decoding
+			t = XMVector3Normalize(XMVectorSubtract(t, XMVectorMultiply(n, XMVector3Dot(n, t))));
+			const float handedness = XMVectorGetX(XMVector3Dot(XMVector3Cross(n, t), b)) < 0.0f ? 0.0f : 1.0f;
+
+			XMVECTOR q = XMVectorSaturate(XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&v.position), vMin), vInvExtent));
+			XMStoreUShortN4(&out[i].position, XMVectorSetW(q, handedness));
+			XMStoreHalf2(&out[i].uv, XMLoadFloat2(&v.uv));
+			XMStoreShortN2(&out[i].normal, EncodeOctahedral(n));
+			XMStoreShortN2(&out[i].tangent, EncodeOctahedral(t));
+		}
+	});
+}
+
+void VertexPacking::Decode(const SPackedVertex* vertices, size_t count, const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax, SVertex* out)
+{
+	const XMVECTOR vMin = XMLoadFloat3(&boundsMin);
+	const XMVECTOR vExtent = XMVectorSubtract(XMLoadFloat3(&boundsMax), vMin);
+
+	ParallelFor((uint32_t)((count + BLOCK_SIZE - 1) / BLOCK_SIZE), [&](uint32_t block)
+	{
+		const size_t end = std::min(count, (block + 1) * BLOCK_SIZE);
+		for (size_t i = block * BLOCK_SIZE; i < end; ++i)
+		{
+			const SPackedVertex& v = vertices[i];
+			XMVECTOR q = XMLoadUShortN4(&v.position);
+			XMVECTOR n = DecodeOctahedral(XMLoadShortN2(&v.normal));
+			XMVECTOR t = DecodeOctahedral(XMLoadShortN2(&v.tangent));
+			XMVECTOR b = XMVectorScale(XMVector3Cross(n, t), XMVectorGetW(q) * 2.0f - 1.0f);
+
+			XMStoreFloat3(&out[i].position, XMVectorMultiplyAdd(q, vExtent, vMin));
+			XMStoreFloat2(&out[i].uv, XMLoadHalf2(&v.uv));
+			XMStoreFloat3(&out[i].normal, n);
+			XMStoreFloat3(&out[i].tangent, t);
+			XMStoreFloat3(&out[i].bitangent, b);
+		}
+	});
+}
+
+void VertexPacking::GetDequantization(const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax, XMFLOAT4& outScale, XMFLOAT4& outOffset)
+{
+	outScale = XMFLOAT4(boundsMax.x - boundsMin.x, boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z, 0.0f);
+	outOffset = XMFLOAT4(boundsMin.x, boundsMin.y, boundsMin.z, 0.0f);
+}
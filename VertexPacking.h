@@ -0,0 +1,31 @@
+#pragma once
+
+#include "SMeshTypes.h"
+
+#include <DirectXPackedVector.h>
+
+// 20 byte alternative to the 56 byte SVertex.
+// Positions are quantized to 16 bit inside the mesh bounds, normal and tangent are octahedral
+// encoded and the bitangent is rebuilt from cross(normal, tangent) and a handedness bit.
+struct SPackedVertex
+{
+	DirectX::PackedVector::XMUSHORTN4 position;  // xyz: position inside the bounds, w: 1 if the bitangent is cross(normal, tangent), 0 if negated
+	DirectX::PackedVector::XMHALF2 uv;
+	DirectX::PackedVector::XMSHORTN2 normal;     // Octahedral
+	DirectX::PackedVector::XMSHORTN2 tangent;    // Octahedral, orthogonalized against the normal
+};
+static_assert(sizeof(SPackedVertex) == 20, "SPackedVertex must match the packed input layout");
+
+namespace VertexPacking
+{
+	// Maps a unit vector onto the octahedron and unfolds it into [-1, 1]^2 (xy of the result).
+	DirectX::XMVECTOR XM_CALLCONV EncodeOctahedral(DirectX::FXMVECTOR n);
+	DirectX::XMVECTOR XM_CALLCONV DecodeOctahedral(DirectX::FXMVECTOR e);
+
+	// [boundsMin] and [boundsMax] must enclose every position.
+	// Dequantize with position = packed.xyz * (boundsMax - boundsMin) + boundsMin, see GetDequantization().
+	void Encode(const SVertex* vertices, size_t count, const DirectX::XMFLOAT3& boundsMin, const DirectX::XMFLOAT3& boundsMax, SPackedVertex* out);
+	void Decode(const SPackedVertex* vertices, size_t count, const DirectX::XMFLOAT3& boundsMin, const DirectX::XMFLOAT3& boundsMax, SVertex* out);
+
+	void GetDequantization(const DirectX::XMFLOAT3& boundsMin, const DirectX::XMFLOAT3& boundsMax, DirectX::XMFLOAT4& outScale, DirectX::XMFLOAT4& outOffset);
+}
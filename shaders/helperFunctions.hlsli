@@ -188,6 +188,22 @@ float TexelCoordSolidAngle(uint a_FaceIdx, float a_U, float a_V, uint a_Size)
     return SolidAngle;
 }
 
+// +--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+
+// Irradiance from spherical harmonics
+// Ref: https://cseweb.ucsd.edu/~ravir/papers/envmap/envmap.pdf
+// Coefficients are the projected radiance already convolved with the cosine
+// lobe over pi, see SSphericalHarmonics.h. Order: Y00, Y1-1, Y10, Y11, Y2-2...
+// +--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+
+float3 IrradianceSH9(float4 sh[9], float3 n)
+{
+    float3 result = sh[0].rgb * 0.282094792f;
+    result += (sh[1].rgb * n.y + sh[2].rgb * n.z + sh[3].rgb * n.x) * 0.488602512f;
+    result += (sh[4].rgb * (n.x * n.y) + sh[5].rgb * (n.y * n.z) + sh[7].rgb * (n.x * n.z)) * 1.092548431f;
+    result += sh[6].rgb * (0.315391565f * (3.0f * n.z * n.z - 1.0f));
+    result += sh[8].rgb * (0.546274215f * (n.x * n.x - n.y * n.y));
+    return result;
+}
+
 // +--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+
 // Importance sample diffuse light directions on a hemisphere
 // Ref: https://github.com/derkreature/IBLBaker/blob/72e08d1890e314a2a47ddf333eaa285f4d3820ca/data/shadersD3D11/smith.brdf#L153
@@ -209,3 +225,15 @@ float3 importanceSampleDiffuse(float2 Xi, float3 N)
 
     return TangentX * H.x + TangentY * H.y + N * H.z;
 }
+
+// +--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+
+// Octahedral unit vector decoding, inverse of VertexPacking::EncodeOctahedral
+// Ref: https://knarkowicz.wordpress.com/2014/04/16/octahedron-normal-vector-encoding/
+// +--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+--+
+float3 OctahedralDecode(float2 e)
+{
+    float3 n = float3(e.xy, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
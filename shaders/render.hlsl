@@ -4,10 +4,11 @@
 #define g_RootSignature \
     "RootFlags(ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT), " \
     "CBV(b0, visibility = SHADER_VISIBILITY_VERTEX), " \
-    "CBV(b1, visibility = SHADER_VISIBILITY_VERTEX), " \
+    "RootConstants(num32BitConstants = 9, b1, visibility = SHADER_VISIBILITY_VERTEX), " \
     "CBV(b2, visibility = SHADER_VISIBILITY_PIXEL), " \
-	"DescriptorTable(SRV(t0), SRV(t1), SRV(t2), visibility = SHADER_VISIBILITY_PIXEL), " \
-    "DescriptorTable(SRV(t3), SRV(t4), SRV(t5), SRV(t6), visibility = SHADER_VISIBILITY_PIXEL), " \
+	"DescriptorTable(SRV(t0), SRV(t1), visibility = SHADER_VISIBILITY_PIXEL), " \
+    "DescriptorTable(SRV(t0, space = 1, numDescriptors = unbounded, flags = DESCRIPTORS_VOLATILE), visibility = SHADER_VISIBILITY_PIXEL), " \
+    "SRV(t2, visibility = SHADER_VISIBILITY_VERTEX), " \
 	"StaticSampler(s0, " \
         "filter = FILTER_MIN_MAG_MIP_LINEAR, " \
 		"visibility = SHADER_VISIBILITY_PIXEL, " \
@@ -22,18 +23,27 @@
 		"addressW = TEXTURE_ADDRESS_CLAMP), " \
 
 ConstantBuffer<CameraConstants> g_camera : register(b0);
-ConstantBuffer<ModelConstants> g_model : register(b1);
+ConstantBuffer<DrawConstants> g_draw : register(b1);
 ConstantBuffer<PBRConstants> g_pbrcb : register(b2);
-TextureCube g_irradiance : register(t0);
-TextureCube g_prefilteredEnv : register(t1);
-Texture2D<float2> g_BRDF : register(t2);
-Texture2D<float4> g_diffuse : register(t3);
-Texture2D<float3> g_normal : register(t4);
-Texture2D<float3> g_arm : register(t5);  // Ambient Occlusion, Roughness, Metalness
-Texture2D<float3> g_emission : register(t6); // Emissive
+TextureCube g_prefilteredEnv : register(t0);
+Texture2D<float2> g_BRDF : register(t1);
+StructuredBuffer<InstanceData> g_instances : register(t2);
+// Material table: MATERIAL_TEXTURE_COUNT textures per material
+// Diffuse, normal, arm (Ambient Occlusion, Roughness, Metalness) and emission
+Texture2D<float4> g_materials[] : register(t0, space1);
 SamplerState g_sampler : register(s0);
 SamplerState g_sampler_BRDF : register(s1);
 
+#ifdef PACKED_VERTEX
+// SPackedVertex, see VertexPacking.h
+struct VSInput
+{
+    float4 packed_position : POSITION;  // xyz: position inside the mesh bounds, w: bitangent sign
+    float2 uv : TEXCOORD;
+    float2 oct_normal : NORMAL;
+    float2 oct_tangent : TANGENT;
+};
+#else
 struct VSInput
 {
     float3 obj_position : POSITION;
@@ -42,6 +52,7 @@ struct VSInput
     float3 obj_tangent : TANGENT;
     float3 obj_bitangent : BITANGENT;
 };
+#endif
 
 struct PSInput
 {
@@ -51,27 +62,44 @@ struct PSInput
     float3 world_normal : WORLD_NORMAL;
     float3 world_tangent : WORLD_TANGENT;
     float3 world_bitangent : WORLD_BITANGENT;
+    nointerpolation uint material : MATERIAL;
 };
 
+// Instances of one draw may use different materials, so the index can diverge within a wave
+#define MATERIAL_TEXTURE(material, slot) g_materials[NonUniformResourceIndex((material) * MATERIAL_TEXTURE_COUNT + (slot))]
+
 [RootSignature(g_RootSignature)]
-PSInput VSMain(VSInput input)
+PSInput VSMain(VSInput input, uint instanceID : SV_InstanceID)
 {
     PSInput result;
+    InstanceData instance = g_instances[g_draw.firstInstance + instanceID];
     
     //float4x4 model = mul(g_model.translation, g_model.rotation);
     //model = mul(model, g_model.scaling);
     
-    float4 world_pos = mul(g_model.model, float4(input.obj_position, 1.0f));
+#ifdef PACKED_VERTEX
+    float3 obj_position = input.packed_position.xyz * g_draw.positionScale.xyz + g_draw.positionOffset.xyz;
+    float3 obj_normal = OctahedralDecode(input.oct_normal);
+    float3 obj_tangent = OctahedralDecode(input.oct_tangent);
+    float3 obj_bitangent = cross(obj_normal, obj_tangent) * (input.packed_position.w * 2.0f - 1.0f);
+#else
+    float3 obj_position = input.obj_position;
+    float3 obj_normal = input.obj_normal;
+    float3 obj_tangent = input.obj_tangent;
+    float3 obj_bitangent = input.obj_bitangent;
+#endif
+
+    float4 world_pos = mul(instance.model, float4(obj_position, 1.0f));
     float4 clip_pos = mul(g_camera.projection, mul(g_camera.view, world_pos));
     result.clip_position = clip_pos;
     result.uv = input.uv;
     result.world_position = world_pos.xyz;
+    result.material = instance.materialIndex;
     
-    // This is wrong for now
-    // Need transform w.r.t. non identical scaling matrix
-    result.world_normal = mul(g_model.model, float4(input.obj_normal, 0.0f)).xyz;
-    result.world_tangent = mul(g_model.model, float4(input.obj_tangent, 0.0f)).xyz;
-    result.world_bitangent = mul(g_model.model, float4(input.obj_bitangent, 0.0f)).xyz;
+    // Tangents follow the surface, normals need the inverse transpose under non-uniform scaling
+    result.world_normal = mul(instance.normalMatrix, float4(obj_normal, 0.0f)).xyz;
+    result.world_tangent = mul(instance.model, float4(obj_tangent, 0.0f)).xyz;
+    result.world_bitangent = mul(instance.model, float4(obj_bitangent, 0.0f)).xyz;
     
     //result.world_normal = input.normal;
 
@@ -85,8 +113,11 @@ float4 PSMain(PSInput input) : SV_TARGET
     //float3 n3 = n2 / 2.0f;
     //return float4(n3, 1.0f);
     
-    float3 normal_color = g_normal.Sample(g_sampler, input.uv).rgb * 2.0f - 1.0f;
-    float3x3 TBN = float3x3(input.world_tangent, input.world_bitangent, input.world_normal);
+    // BC5 normal maps store X and Y, Z is reconstructed
+    float3 normal_color;
+    normal_color.xy = MATERIAL_TEXTURE(input.material, 1).Sample(g_sampler, input.uv).rg * 2.0f - 1.0f;
+    normal_color.z = sqrt(saturate(1.0f - dot(normal_color.xy, normal_color.xy)));
+    float3x3 TBN = float3x3(normalize(input.world_tangent), normalize(input.world_bitangent), normalize(input.world_normal));
     
     float3 N = normalize(mul(normal_color, TBN));
     float3 V = normalize(g_pbrcb.eyePosition - input.world_position);
@@ -94,11 +125,11 @@ float4 PSMain(PSInput input) : SV_TARGET
     float NoV = saturate(dot(N, V));
     
     // Diffuse
-    float3 albedo = g_diffuse.Sample(g_sampler, input.uv).rgb;
-    float3 diffuse = g_irradiance.SampleLevel(g_sampler, N, 0).rgb * albedo;
+    float3 albedo = MATERIAL_TEXTURE(input.material, 0).Sample(g_sampler, input.uv).rgb;
+    float3 diffuse = max(IrradianceSH9(g_pbrcb.irradianceSH, N), 0.0f) * albedo;
     
     // Specular
-    float3 arm = g_arm.Sample(g_sampler, input.uv).rgb;
+    float3 arm = MATERIAL_TEXTURE(input.material, 2).Sample(g_sampler, input.uv).rgb;
     float ao = arm.r;
     float roughness = arm.g;
     float metalness = arm.b;
@@ -114,7 +145,7 @@ float4 PSMain(PSInput input) : SV_TARGET
     float3 specular = prefilteredColor * (F0 * envBRDF.x + envBRDF.y) * INV_PI;
     
     // Emission
-    float3 emission = g_emission.Sample(g_sampler, input.uv).rgb * 20;
+    float3 emission = MATERIAL_TEXTURE(input.material, 3).Sample(g_sampler, input.uv).rgb * 20;
     
     float3 color = (kD * diffuse + specular) * ao + emission;
     return float4(color, 1.0f);
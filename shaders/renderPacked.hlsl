@@ -0,0 +1,3 @@
+// Vertex shader variant of render.hlsl for meshes uploaded as SPackedVertex
+#define PACKED_VERTEX
+#include "render.hlsl"
@@ -0,0 +1,286 @@
+#include "Tests.h"
+
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace PixelConvert;
+using std::vector;
+
+namespace
+{
+	// Kernels this CPU runs, scalar first
+	vector<Kernel> GetKernels()
+	{
+		vector<Kernel> kernels = { Kernel::Scalar };
+		const Kernel best = GetBestKernel();
+		if (best != Kernel::Scalar)
+			kernels.push_back(Kernel::SSE4);
+		if (best == Kernel::AVX2)
+			kernels.push_back(Kernel::AVX2);
+		return kernels;
+	}
+
+	// The conversions from float, checked on float bit patterns
+	enum FloatConversion
+	{
+		FLOAT_TO_HALF,
+		FLOAT_TO_UNORM8,
+		LINEAR_TO_SRGBA8,
+		TO_R11G11B10,
+		TO_RGB9E5,
+		FLOAT_CONVERSION_COUNT
+	};
+	const char* FLOAT_CONVERSION_NAMES[] = { "FloatToHalf", "FloatToUNorm8", "LinearToSRGBA8", "RGB32FToR11G11B10", "RGB32FToRGB9E5" };
+
+	constexpr uint32_t CHUNK = 1 << 16;
+
+	// Chunks of CHUNK consecutive float patterns, every [stride]th one, whose conversion by each kernel differs from the
+	// scalar kernel's, per conversion, and those where scalar sRGB encoding differs from a binary search of the thresholds
+	// between the codes. Triples are taken at 3 offsets so each value is in every channel.
+	struct FloatMismatches
+	{
+		uint64_t patterns = 0;
+		std::atomic<uint32_t> kernels[3][FLOAT_CONVERSION_COUNT] = {};
+		std::atomic<uint32_t> SRGBReference{ 0 };
+	};
+
+	void CompareFloatPatterns(uint32_t stride, const vector<Kernel>& kernels, FloatMismatches& mismatches)
+	{
+		float thresholds[255];
+		for (uint32_t i = 0; i < 255; ++i)
+			thresholds[i] = 0.5f * (SRGBToLinear((uint8_t)i) + SRGBToLinear((uint8_t)(i + 1)));
+
+		const uint64_t patterns = ((1ull << 32) + stride - 1) / stride;
+		mismatches.patterns = patterns;
+		ParallelFor((uint32_t)((patterns + CHUNK - 1) / CHUNK), [&](uint32_t chunk)
+		{
+			vector<float> values(CHUNK + 2);
+			for (uint32_t i = 0; i < CHUNK + 2; ++i)
+			{
+				const uint32_t bits = (uint32_t)(((uint64_t)chunk * CHUNK + i) % patterns * stride);
+				memcpy(&values[i], &bits, sizeof(bits));
+			}
+			const size_t pixels = CHUNK / 4;
+			const size_t triples = CHUNK / 3;
+
+			vector<uint16_t> halves[2];
+			vector<uint8_t> bytes[2], srgb[2];
+			vector<uint32_t> packed[2], shared[2];
+			for (size_t k = 0; k < kernels.size(); ++k)
+			{
+				const size_t slot = k == 0 ? 0 : 1;
+				halves[slot].resize(CHUNK);
+				bytes[slot].resize(CHUNK);
+				srgb[slot].resize(CHUNK);
+				packed[slot].resize(triples * 3);
+				shared[slot].resize(triples * 3);
+				FloatToHalf(values.data(), halves[slot].data(), CHUNK, kernels[k]);
+				FloatToUNorm8(values.data(), bytes[slot].data(), CHUNK, kernels[k]);
+				LinearToSRGBA8(values.data(), srgb[slot].data(), pixels, kernels[k]);
+				for (uint32_t offset = 0; offset < 3; ++offset)
+				{
+					RGB32FToR11G11B10(values.data() + offset, packed[slot].data() + offset * triples, triples, kernels[k]);
+					RGB32FToRGB9E5(values.data() + offset, shared[slot].data() + offset * triples, triples, kernels[k]);
+				}
+				if (k == 0)
+				{
+					// Alpha is linear
+					bool match = true;
+					for (size_t i = 0; i < CHUNK; ++i)
+					{
+						if ((i & 3) == 3)
+							continue;
+						const uint8_t expected = values[i] != values[i] ? 0 : (uint8_t)(std::upper_bound(thresholds, thresholds + 255, values[i]) - thresholds);
+						match &= srgb[0][i] == expected;
+					}
+					mismatches.SRGBReference += match ? 0 : 1;
+					continue;
+				}
+
+				std::atomic<uint32_t>* counts = mismatches.kernels[k];
+				counts[FLOAT_TO_HALF] += halves[1] != halves[0];
+				counts[FLOAT_TO_UNORM8] += bytes[1] != bytes[0];
+				counts[LINEAR_TO_SRGBA8] += srgb[1] != srgb[0];
+				counts[TO_R11G11B10] += packed[1] != packed[0];
+				counts[TO_RGB9E5] += shared[1] != shared[0];
+			}
+		});
+	}
+}
+
+// D3D12EngineTests pixel [<stride>]
+// PixelConvert with every kernel the CPU supports against the scalar one: every [stride]th float bit pattern, 257
+// by default and 1 for all of them, through the conversions from float, every half and byte through the others,
+// and assorted channel layouts through Swizzle, whose guard bytes must stay untouched. Scalar sRGB encoding is
+// checked against a binary search of the thresholds between the codes, and decoding and encoding again must give
+// every byte back.
+int Tests::TestPixelConversions(int argc, char** argv)
+{
+	Checker check("pixel");
+	const uint32_t stride = argc > 0 ? (uint32_t)std::max(1, atoi(argv[0])) : 257;
+	const vector<Kernel> kernels = GetKernels();
+
+	{
+		FloatMismatches mismatches;
+		Timer timer;
+		CompareFloatPatterns(stride, kernels, mismatches);
+		const double milliseconds = timer.Milliseconds();
+		check(mismatches.SRGBReference == 0, "LinearToSRGBA8: %u chunks differ from the thresholds", mismatches.SRGBReference.load());
+		for (size_t k = 1; k < kernels.size(); ++k)
+		{
+			for (uint32_t c = 0; c < FLOAT_CONVERSION_COUNT; ++c)
+			{
+				check(mismatches.kernels[k][c] == 0, "%s %s: %u chunks differ from the scalar kernel", GetKernelName(kernels[k]),
+					FLOAT_CONVERSION_NAMES[c], mismatches.kernels[k][c].load());
+			}
+		}
+		if (stride == 1)
+			printf("pixel: all %llu float patterns in %.1f s\n", (unsigned long long)mismatches.patterns, milliseconds / 1000.0);
+	}
+
+	// Every half, and every byte in every channel
+	vector<uint16_t> allHalves(1 << 16);
+	vector<uint8_t> allBytes(1024);
+	for (uint32_t i = 0; i < allHalves.size(); ++i)
+		allHalves[i] = (uint16_t)i;
+	for (uint32_t i = 0; i < allBytes.size(); ++i)
+		allBytes[i] = (uint8_t)(i / 4 + (i & 3) * 85);
+	vector<float> fromHalf[2], fromUNorm[2], fromSRGB[2];
+	for (size_t k = 0; k < kernels.size(); ++k)
+	{
+		const char* name = GetKernelName(kernels[k]);
+		const size_t slot = k == 0 ? 0 : 1;
+		fromHalf[slot].resize(allHalves.size());
+		fromUNorm[slot].resize(allBytes.size());
+		fromSRGB[slot].resize(allBytes.size());
+		HalfToFloat(allHalves.data(), fromHalf[slot].data(), allHalves.size(), kernels[k]);
+		UNorm8ToFloat(allBytes.data(), fromUNorm[slot].data(), allBytes.size(), kernels[k]);
+		SRGBA8ToLinear(allBytes.data(), fromSRGB[slot].data(), allBytes.size() / 4, kernels[k]);
+
+		vector<uint8_t> roundTrip(allBytes.size());
+		LinearToSRGBA8(fromSRGB[slot].data(), roundTrip.data(), allBytes.size() / 4, kernels[k]);
+		check(roundTrip == allBytes, "%s: sRGB round trip changes bytes", name);
+		if (k == 0)
+			continue;
+
+		// Compared bit for bit, as NaNs must keep their payload
+		check(memcmp(fromHalf[1].data(), fromHalf[0].data(), allHalves.size() * sizeof(float)) == 0, "%s HalfToFloat differs from the scalar kernel", name);
+		check(fromUNorm[1] == fromUNorm[0], "%s UNorm8ToFloat differs from the scalar kernel", name);
+		check(fromSRGB[1] == fromSRGB[0], "%s SRGBA8ToLinear differs from the scalar kernel", name);
+	}
+
+	// Every channel size and count, with counts around the vector widths
+	for (uint32_t channelSize : { 1u, 2u, 4u })
+	{
+		for (uint32_t srcChannels = 1; srcChannels <= 4; ++srcChannels)
+		{
+			for (uint32_t dstChannels = 1; dstChannels <= 4; ++dstChannels)
+			{
+				uint8_t map[4];
+				uint32_t fill[4];
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					map[c] = c >= srcChannels ? FILL : (uint8_t)(srcChannels - 1 - c);
+					fill[c] = 0x01020304u * (c + 1);
+				}
+				for (size_t count : { 1, 3, 5, 8, 15, 33, 1000 })
+				{
+					vector<uint8_t> src(count * srcChannels * channelSize);
+					for (size_t i = 0; i < src.size(); ++i)
+						src[i] = (uint8_t)(i * 7 + 1);
+					vector<uint8_t> dst[2];
+					for (size_t k = 0; k < kernels.size(); ++k)
+					{
+						const size_t slot = k == 0 ? 0 : 1;
+						dst[slot].assign(count * dstChannels * channelSize + 32, 0xCD);
+						Swizzle(src.data(), srcChannels, dst[slot].data(), dstChannels, channelSize, map, fill, count, kernels[k]);
+						if (k > 0)
+						{
+							check(dst[1] == dst[0], "%s Swizzle of %zu texels, %u to %u channels of %u bytes, differs from the scalar kernel",
+								GetKernelName(kernels[k]), count, srcChannels, dstChannels, channelSize);
+						}
+					}
+					check(std::all_of(dst[0].end() - 32, dst[0].end(), [](uint8_t value) { return value == 0xCD; }),
+						"Swizzle of %zu texels, %u to %u channels of %u bytes, writes past the end", count, srcChannels, dstChannels, channelSize);
+				}
+			}
+		}
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests pixelbench [<megapixels>]
+// Each conversion of PixelConvert over [megapixels] (4 by default) random RGBA pixels with every kernel the CPU
+// supports, best of 10 runs, in GB/s of source and destination bytes. Fails if a kernel's output differs from the
+// scalar one's.
+int Tests::BenchmarkPixelConversions(int argc, char** argv)
+{
+	Checker check("pixelbench");
+	const size_t pixels = (size_t)(argc > 0 ? std::max(1, atoi(argv[0])) : 4) << 20;
+	constexpr uint32_t RUNS = 10;
+
+	// RGBA float pixels in [0, 4), and every other buffer large enough for any conversion
+	std::mt19937 generator(1);
+	vector<float> floats(pixels * 4);
+	for (float& value : floats)
+		value = (generator() >> 8) * (4.0f / 16777216.0f);
+	vector<uint8_t> bytes(pixels * 4);
+	vector<uint16_t> halves(pixels * 4);
+	vector<uint32_t> packed(pixels);
+	FloatToUNorm8(floats.data(), bytes.data(), bytes.size());
+	FloatToHalf(floats.data(), halves.data(), halves.size());
+	vector<float> floatOut(pixels * 4);
+	vector<uint8_t> byteOut(pixels * 4);
+
+	// Each conversion writes one of the output buffers; [output] is its first [outputSize] bytes
+	struct Conversion
+	{
+		const char* name;
+		size_t bytesPerPixel;  // Read and written
+		std::function<void(Kernel)> run;
+		const void* output;
+		size_t outputSize;
+	};
+	const Conversion conversions[] = {
+		{ "RGB8ToRGBA8", 3 + 4, [&](Kernel k) { RGB8ToRGBA8(bytes.data(), byteOut.data(), pixels, 255, k); }, byteOut.data(), pixels * 4 },
+		{ "FloatToHalf", 16 + 8, [&](Kernel k) { FloatToHalf(floats.data(), halves.data(), pixels * 4, k); }, halves.data(), pixels * 8 },
+		{ "HalfToFloat", 8 + 16, [&](Kernel k) { HalfToFloat(halves.data(), floatOut.data(), pixels * 4, k); }, floatOut.data(), pixels * 16 },
+		{ "UNorm8ToFloat", 4 + 16, [&](Kernel k) { UNorm8ToFloat(bytes.data(), floatOut.data(), pixels * 4, k); }, floatOut.data(), pixels * 16 },
+		{ "FloatToUNorm8", 16 + 4, [&](Kernel k) { FloatToUNorm8(floats.data(), byteOut.data(), pixels * 4, k); }, byteOut.data(), pixels * 4 },
+		{ "SRGBA8ToLinear", 4 + 16, [&](Kernel k) { SRGBA8ToLinear(bytes.data(), floatOut.data(), pixels, k); }, floatOut.data(), pixels * 16 },
+		{ "LinearToSRGBA8", 16 + 4, [&](Kernel k) { LinearToSRGBA8(floats.data(), byteOut.data(), pixels, k); }, byteOut.data(), pixels * 4 },
+		{ "RGB32FToR11G11B10", 12 + 4, [&](Kernel k) { RGB32FToR11G11B10(floats.data(), packed.data(), pixels, k); }, packed.data(), pixels * 4 },
+		{ "RGB32FToRGB9E5", 12 + 4, [&](Kernel k) { RGB32FToRGB9E5(floats.data(), packed.data(), pixels, k); }, packed.data(), pixels * 4 },
+	};
+
+	for (const Conversion& conversion : conversions)
+	{
+		vector<uint8_t> scalar;
+		for (Kernel kernel : GetKernels())
+		{
+			double fastest = 1e30;
+			for (uint32_t run = 0; run < RUNS; ++run)
+			{
+				Timer timer;
+				conversion.run(kernel);
+				fastest = std::min(fastest, timer.Milliseconds());
+			}
+			const uint8_t* output = (const uint8_t*)conversion.output;
+			if (kernel == Kernel::Scalar)
+				scalar.assign(output, output + conversion.outputSize);
+			else
+				check(memcmp(output, scalar.data(), scalar.size()) == 0, "%s %s differs from the scalar kernel", conversion.name, GetKernelName(kernel));
+			printf("%-18s %-6s %8.3f ms, %6.2f GB/s\n", conversion.name, GetKernelName(kernel), fastest, pixels * conversion.bytesPerPixel / (fastest * 1e6));
+		}
+	}
+	return check.Result();
+}
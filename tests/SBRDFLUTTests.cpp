@@ -0,0 +1,224 @@
+#include "Tests.h"
+
+#include "PixelConvert.h"
+#include "SBRDFLUT.h"
+#include "SIBLBaker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace DirectX;
+using namespace SBRDFLUT;
+using std::vector;
+
+namespace
+{
+	// [LUT] as a shader reads it from a texture of [format]
+	vector<XMFLOAT2> RoundTrip(const vector<XMFLOAT2>& LUT, DXGI_FORMAT format)
+	{
+		vector<uint8_t> texels;
+		Encode(LUT, format, texels);
+		vector<XMFLOAT2> decoded(LUT.size());
+		if (format == DXGI_FORMAT_R16G16_FLOAT)
+			PixelConvert::HalfToFloat((const uint16_t*)texels.data(), &decoded[0].x, decoded.size() * 2);
+		else if (format == DXGI_FORMAT_R8G8_UNORM)
+			PixelConvert::UNorm8ToFloat(texels.data(), &decoded[0].x, decoded.size() * 2);
+		else
+			memcpy(decoded.data(), texels.data(), texels.size());
+		return decoded;
+	}
+
+	// Largest error of [LUT], relative to the reflectance at F0 = 1 (scale + bias) of [reference] or absolute
+	double Compare(const vector<XMFLOAT2>& LUT, const vector<XMFLOAT2>& reference, bool relative, double& outRMS)
+	{
+		double maxError = 0.0, sum = 0.0;
+		for (size_t i = 0; i < LUT.size(); ++i)
+		{
+			const double scale = relative ? std::max(reference[i].x + reference[i].y, 1e-6f) : 1.0;
+			const double error = std::max(fabs(LUT[i].x - reference[i].x), fabs(LUT[i].y - reference[i].y)) / scale;
+			maxError = std::max(maxError, error);
+			sum += error * error;
+		}
+		outRMS = sqrt(sum / LUT.size());
+		return maxError;
+	}
+
+	const char* GetFormatName(DXGI_FORMAT format)
+	{
+		switch (format)
+		{
+		case DXGI_FORMAT_R8G8_UNORM: return "R8G8_UNORM";
+		case DXGI_FORMAT_R16G16_FLOAT: return "R16G16_FLOAT";
+		default: return "R32G32_FLOAT";
+		}
+	}
+
+	// Karis' fit is coarse, tenths off at worst, so its bounds only catch regressions
+	void CheckAnalytic(Tests::Checker& check, uint32_t size, const vector<XMFLOAT2>& splitSum)
+	{
+		vector<XMFLOAT2> analytic;
+		Generate(size, Mode::Analytic, analytic);
+		for (DXGI_FORMAT format : { DXGI_FORMAT_R8G8_UNORM, DXGI_FORMAT_R16G16_FLOAT })
+		{
+			double RMS;
+			const double error = Compare(RoundTrip(analytic, format), splitSum, false, RMS);
+			check(error < 0.25 && RMS < 0.1, "analytic %s: max %.4f RMS %.4f against the split sum", GetFormatName(format), error, RMS);
+		}
+	}
+}
+
+// D3D12EngineTests brdf
+// The BRDF LUT: the compiled in table resampled to a quarter of its resolution lands on its own texels, which are
+// SIBLBaker::IntegrateBRDF with the table's samples in half floats, so the table matches the integral it says it
+// holds; Karis' fit stays within its measured error of the split sum it approximates in R8G8_UNORM and R16G16_FLOAT;
+// Encode keeps R32G32_FLOAT exact and throws for other formats; and WriteTable writes the header it reads.
+int Tests::TestBRDFLUT(int, char**)
+{
+	Checker check("brdf");
+	const uint32_t size = GetTableResolution() / 4;
+
+	// Texel x of the quarter table holds NoV = (x + 1) / size = (4 x + 4) / resolution, table texel 4 x + 3
+	{
+		vector<XMFLOAT2> table, integral;
+		Generate(size, Mode::Table, table);
+		SIBLBaker::IntegrateBRDF(size, GetTableSamples(), integral);
+		vector<uint8_t> expected, texels;
+		Encode(integral, DXGI_FORMAT_R16G16_FLOAT, expected);
+		Encode(table, DXGI_FORMAT_R16G16_FLOAT, texels);
+		size_t different = 0;
+		for (size_t i = 0; i < expected.size(); i += 2)
+			different += memcmp(&expected[i], &texels[i], 2) != 0;
+		check(different == 0, "%zu of %zu table values differ from IntegrateBRDF with %u samples; regenerate SBRDFLUTTable.h", different,
+			expected.size() / 2, GetTableSamples());
+
+		vector<XMFLOAT2> full;
+		Generate(GetTableResolution(), Mode::Table, full);
+		check(full.size() == (size_t)GetTableResolution() * GetTableResolution(), "the table has %zu texels", full.size());
+	}
+
+	{
+		vector<XMFLOAT2> splitSum;
+		IntegrateSplitSum(size, 4096, splitSum);
+		CheckAnalytic(check, size, splitSum);
+
+		vector<XMFLOAT2> exact;
+		Generate(size, Mode::Analytic, exact);
+		check(memcmp(RoundTrip(exact, DXGI_FORMAT_R32G32_FLOAT).data(), exact.data(), exact.size() * sizeof(XMFLOAT2)) == 0, "R32G32_FLOAT changes values");
+		bool thrown = false;
+		try
+		{
+			vector<uint8_t> texels;
+			Encode(exact, DXGI_FORMAT_R8G8B8A8_UNORM, texels);
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		check(thrown, "Encode accepts R8G8B8A8_UNORM");
+	}
+
+	// The header holds the values as the halves Encode writes
+	{
+		const std::string path = (std::filesystem::temp_directory_path() / "D3D12EngineTests_brdf.h").string();
+		vector<XMFLOAT2> LUT;
+		SIBLBaker::IntegrateBRDF(4, 64, LUT);
+		vector<uint8_t> halves;
+		Encode(LUT, DXGI_FORMAT_R16G16_FLOAT, halves);
+		std::string expected;
+		for (size_t i = 0; i < halves.size(); i += 2)
+		{
+			uint16_t half;
+			memcpy(&half, &halves[i], sizeof(half));
+			expected += std::to_string(half) + ",";
+		}
+
+		if (check(WriteTable(path.c_str(), LUT, 4, 64), "WriteTable fails on %s", path.c_str()))
+		{
+			std::stringstream contents;
+			contents << std::ifstream(path).rdbuf();
+			std::string values;
+			const std::string text = contents.str();
+			const size_t start = text.find('{', text.find("TABLE["));
+			for (size_t i = start; i != std::string::npos && i < text.size() && text[i] != '}'; ++i)
+			{
+				if (isdigit((unsigned char)text[i]) || text[i] == ',')
+					values += text[i];
+			}
+			check(text.find("TABLE_RESOLUTION = 4;") != std::string::npos && text.find("TABLE_SAMPLES = 64;") != std::string::npos,
+				"the header has another resolution or sample count");
+			check(values == expected, "the header holds other values than Encode gives");
+		}
+		std::filesystem::remove(path);
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests brdfbench [<samples>]
+// Error report of the BRDF LUT modes against high sample CPU integrals, 262144 samples per texel by default: the
+// compiled in table at its resolution and resampled to a quarter of it, in each float format, against
+// SIBLBaker::IntegrateBRDF, and Karis' analytic fit, in each format, against the split sum it approximates
+// (SBRDFLUT::IntegrateSplitSum) and against the table's integral it replaces. Errors are relative to the reflectance
+// at F0 = 1 (scale + bias) for the table, absolute for the analytic fit whose values lie in [0, 1]. Also times
+// generating each mode against integrating the reference. Fails if the table is off by more than its samples and
+// half floats allow, or the fit by more than it was measured to be. With far fewer [samples] than the table's, the
+// reference is the noisier one and the table check fails.
+int Tests::BenchmarkBRDFLUT(int argc, char** argv)
+{
+	Checker check("brdfbench");
+	const uint32_t samples = argc > 0 ? (uint32_t)std::max(1, atoi(argv[0])) : 262144;
+	const uint32_t size = GetTableResolution();
+	const uint32_t smallSize = std::max(1u, size / 4);
+
+	Timer timer;
+	vector<XMFLOAT2> reference, smallReference, splitSum;
+	SIBLBaker::IntegrateBRDF(size, samples, reference);
+	const double referenceMilliseconds = timer.Milliseconds();
+	SIBLBaker::IntegrateBRDF(smallSize, samples, smallReference);
+	IntegrateSplitSum(smallSize, samples, splitSum);
+	printf("Reference: %u x %u, %u samples integrated in %.1f ms\n", size, size, samples, referenceMilliseconds);
+
+	// The table at its resolution is the integral with fewer samples, in half floats
+	timer.Restart();
+	vector<XMFLOAT2> table;
+	Generate(size, Mode::Table, table);
+	const double tableMilliseconds = timer.Milliseconds();
+	vector<XMFLOAT2> smallTable;
+	Generate(smallSize, Mode::Table, smallTable);
+	for (DXGI_FORMAT format : { DXGI_FORMAT_R16G16_FLOAT, DXGI_FORMAT_R32G32_FLOAT })
+	{
+		double RMS, smallRMS;
+		const double error = Compare(RoundTrip(table, format), reference, true, RMS);
+		const double smallError = Compare(RoundTrip(smallTable, format), smallReference, true, smallRMS);
+		check(error < 0.01 && RMS < 0.001, "table %s: max %.3f%% RMS %.4f%% against the reference", GetFormatName(format), error * 100.0, RMS * 100.0);
+		printf("Table %s: %u x %u (%u samples) in %.2f ms, error max %.3f%% RMS %.4f%%; %u x %u resampled, max %.2f%% RMS %.3f%%\n",
+			GetFormatName(format), size, size, GetTableSamples(), tableMilliseconds, error * 100.0, RMS * 100.0, smallSize, smallSize,
+			smallError * 100.0, smallRMS * 100.0);
+	}
+
+	timer.Restart();
+	vector<XMFLOAT2> analytic;
+	Generate(size, Mode::Analytic, analytic);
+	const double analyticMilliseconds = timer.Milliseconds();
+	double tableRMS;
+	Compare(analytic, reference, true, tableRMS);
+	CheckAnalytic(check, smallSize, splitSum);
+	vector<XMFLOAT2> smallAnalytic;
+	Generate(smallSize, Mode::Analytic, smallAnalytic);
+	for (DXGI_FORMAT format : { DXGI_FORMAT_R8G8_UNORM, DXGI_FORMAT_R16G16_FLOAT })
+	{
+		double RMS;
+		const double error = Compare(RoundTrip(smallAnalytic, format), splitSum, false, RMS);
+		printf("Analytic %s: %u x %u in %.2f ms, against the split sum max %.4f RMS %.4f, against the table's integral RMS %.0f%%\n",
+			GetFormatName(format), size, size, analyticMilliseconds, error, RMS, tableRMS * 100.0);
+	}
+	return check.Result();
+}
@@ -0,0 +1,328 @@
+#include "Tests.h"
+
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+#include "SEnvironmentSampler.h"
+#include "SIBLBaker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	float Random(std::mt19937& generator)
+	{
+		return (generator() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	// A sky brightening towards the zenith over a dim ground and a sun of [sunRadius] degrees giving the light of one
+	// twice as wide as the real one at half its strength, as float faces and as the half float cubemap the baker reads,
+	// holding the same values
+	struct SunnySky
+	{
+		uint32_t size;
+		vector<float> texels;
+		const float* faces[6];
+		SIBLBaker::Cubemap envMap;
+		XMFLOAT3 sun;
+		float sunCosine;
+
+		SunnySky(uint32_t size, uint32_t mips, float sunRadius) : size(size), texels((size_t)6 * size * size * 4)
+		{
+			XMStoreFloat3(&sun, XMVector3Normalize(XMVectorSet(0.3f, 0.8f, 0.5f, 0.0f)));
+			sunCosine = cosf(XMConvertToRadians(sunRadius));
+			const float sunScale = 0.25f / (sunRadius * sunRadius);
+			const size_t faceTexels = (size_t)size * size;
+			envMap.Allocate(size, mips);
+			for (uint32_t face = 0; face < 6; ++face)
+			{
+				float* faceTexelData = texels.data() + face * faceTexels * 4;
+				for (uint32_t y = 0; y < size; ++y)
+				{
+					for (uint32_t x = 0; x < size; ++x)
+					{
+						const XMFLOAT3 direction = SSphericalHarmonics::GetTexelDirection(face, x, y, size);
+						const float up = std::max(direction.y, 0.0f);
+						const bool inSun = InSun(direction);
+						float* texel = faceTexelData + ((size_t)y * size + x) * 4;
+						texel[0] = inSun ? 36000.0f * sunScale : 0.2f + 0.3f * up;
+						texel[1] = inSun ? 34000.0f * sunScale : 0.25f + 0.4f * up;
+						texel[2] = inSun ? 31000.0f * sunScale : 0.3f + 0.7f * up;
+						texel[3] = 1.0f;
+					}
+				}
+				// The reference integrates what the half float map holds
+				PixelConvert::FloatToHalf(faceTexelData, envMap.GetTexels(face, 0), faceTexels * 4);
+				PixelConvert::HalfToFloat(envMap.GetTexels(face, 0), faceTexelData, faceTexels * 4);
+				faces[face] = faceTexelData;
+			}
+			SIBLBaker::GenerateMips(envMap);
+		}
+
+		inline bool InSun(const XMFLOAT3& direction) const
+		{
+			return direction.x * sun.x + direction.y * sun.y + direction.z * sun.z > sunCosine;
+		}
+	};
+
+	// Brute force pre-filter of every rough level: the GGX lobe around N = V = R times NoL over all texels, RGB
+	vector<vector<float>> PrefilterReference(const SunnySky& sky, uint32_t prefilteredSize, uint32_t mipCount)
+	{
+		const size_t faceTexels = (size_t)sky.size * sky.size;
+		const vector<float> solidAngles = SSphericalHarmonics::ComputeTexelSolidAngles(sky.size);
+		vector<XMFLOAT3> directions(6 * faceTexels);
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (size_t i = 0; i < faceTexels; ++i)
+				directions[face * faceTexels + i] = SSphericalHarmonics::GetTexelDirection(face, (uint32_t)(i % sky.size), (uint32_t)(i / sky.size), sky.size);
+		}
+
+		vector<vector<float>> reference(mipCount);
+		for (uint32_t mip = 1; mip < mipCount; ++mip)
+		{
+			const float roughness = (float)mip / (mipCount - 1);
+			const float alpha2 = roughness * roughness * roughness * roughness;
+			const uint32_t size = std::max(1u, prefilteredSize >> mip);
+			reference[mip].resize((size_t)6 * size * size * 3);
+			ParallelFor(6 * size * size, [&](uint32_t i)
+			{
+				const XMFLOAT3 N = SSphericalHarmonics::GetTexelDirection(i / (size * size), i % size, i / size % size, size);
+				double sum[3] = {}, weightSum = 0.0;
+				for (size_t t = 0; t < directions.size(); ++t)
+				{
+					const XMFLOAT3& L = directions[t];
+					const float NoL = N.x * L.x + N.y * L.y + N.z * L.z;
+					if (NoL <= 0.0f)
+						continue;
+					const float d = (alpha2 - 1.0f) * 0.5f * (1.0f + NoL) + 1.0f;
+					const double weight = (double)alpha2 / (d * d) * NoL * solidAngles[t % faceTexels];
+					for (uint32_t c = 0; c < 3; ++c)
+						sum[c] += weight * sky.texels[t * 4 + c];
+					weightSum += weight;
+				}
+				for (uint32_t c = 0; c < 3; ++c)
+					reference[mip][(size_t)i * 3 + c] = (float)(sum[c] / weightSum);
+			});
+		}
+		return reference;
+	}
+
+	struct PrefilterError
+	{
+		double milliseconds;
+		double total;  // RMS error over every rough level relative to the RMS of the reference
+		vector<double> levels;
+	};
+
+	// Pre-filters [sky] with Prefilter or PrefilterMIS and measures it against [reference]
+	PrefilterError MeasurePrefilter(const SunnySky& sky, const vector<vector<float>>& reference, uint32_t prefilteredSize, uint32_t mipCount,
+		uint32_t samples, bool MIS)
+	{
+		PrefilterError result;
+		SIBLBaker::Cubemap prefiltered;
+		Tests::Timer timer;
+		if (MIS)
+			SIBLBaker::PrefilterMIS(sky.envMap, prefilteredSize, mipCount, samples, prefiltered);
+		else
+			SIBLBaker::Prefilter(sky.envMap, prefilteredSize, mipCount, samples, prefiltered);
+		result.milliseconds = timer.Milliseconds();
+
+		double totalError = 0.0, totalReference = 0.0;
+		for (uint32_t mip = 1; mip < mipCount; ++mip)
+		{
+			const uint32_t size = prefiltered.GetMipSize(mip);
+			double error = 0.0, magnitude = 0.0;
+			for (uint32_t face = 0; face < 6; ++face)
+			{
+				vector<float> values((size_t)size * size * 4);
+				PixelConvert::HalfToFloat(prefiltered.GetTexels(face, mip), values.data(), values.size());
+				for (size_t t = 0; t < (size_t)size * size; ++t)
+				{
+					for (uint32_t c = 0; c < 3; ++c)
+					{
+						const double expected = reference[mip][(face * size * size + t) * 3 + c];
+						error += (values[t * 4 + c] - expected) * (values[t * 4 + c] - expected);
+						magnitude += expected * expected;
+					}
+				}
+			}
+			result.levels.push_back(sqrt(error / magnitude));
+			totalError += error;
+			totalReference += magnitude;
+		}
+		result.total = sqrt(totalError / totalReference);
+		return result;
+	}
+}
+
+// D3D12EngineTests envsampler
+// SEnvironmentSampler: alias table entries are drawn as often as their weights say, every draw has the density Pdf
+// reports, E[1 / pdf] is the sphere and the density integrates to 1, a black environment is uniform, and on a small
+// sunny sky PrefilterMIS with 1/32 of the samples is at least as close to the brute force lobe integral as Prefilter.
+int Tests::TestEnvironmentSampler(int, char**)
+{
+	Checker check("envsampler");
+	std::mt19937 generator(5);
+
+	{
+		constexpr uint32_t COUNT = 1000;
+		vector<float> weights(COUNT), probabilities(COUNT);
+		vector<uint32_t> aliases(COUNT);
+		double total = 0.0;
+		for (uint32_t i = 0; i < COUNT; ++i)
+		{
+			weights[i] = i % 7 == 0 ? 0.0f : Random(generator) * Random(generator) * 100.0f;
+			total += weights[i];
+		}
+		SEnvironmentSampler::BuildAliasTable(weights.data(), COUNT, probabilities.data(), aliases.data());
+		// An entry is drawn with its own probability, and with what every entry aliased to it gives away
+		vector<double> drawn(COUNT);
+		for (uint32_t i = 0; i < COUNT; ++i)
+		{
+			drawn[i] += probabilities[i];
+			drawn[aliases[i]] += 1.0 - probabilities[i];
+		}
+		double error = 0.0;
+		for (uint32_t i = 0; i < COUNT; ++i)
+			error = std::max(error, fabs(drawn[i] - weights[i] * COUNT / total));
+		check(error < 1e-4, "alias table: entries drawn %g off their weights", error);
+	}
+
+	constexpr uint32_t ENV_SIZE = 64;
+	auto checkSampler = [&](const char* name, const float* const faces[6], bool uniform)
+	{
+		SEnvironmentSampler sampler;
+		sampler.Build(faces, ENV_SIZE);
+
+		constexpr uint32_t DRAWS = 1 << 18;
+		// A draw on a texel's edge may round into its neighbour, which Pdf then reads
+		uint32_t wrongPdfs = 0;
+		double inverseSum = 0.0;
+		for (uint32_t i = 0; i < DRAWS; ++i)
+		{
+			float pdf;
+			const XMFLOAT3 direction = sampler.Sample(XMFLOAT2(Random(generator), Random(generator)), pdf);
+			wrongPdfs += fabsf(sampler.Pdf(direction) / pdf - 1.0f) > 1e-3f;
+			inverseSum += 1.0 / pdf;
+		}
+		check(wrongPdfs <= DRAWS / 10000, "%s: %u of %u draws have another density than Pdf reports", name, wrongPdfs, DRAWS);
+		// E[1 / pdf] is the solid angle it is spread over
+		const double sphereError = fabs(inverseSum / DRAWS / (4.0 * XM_PI) - 1.0);
+		check(sphereError < 0.02, "%s: E[1 / pdf] is %.3f%% off 4 pi", name, sphereError * 100.0);
+
+		// The densities over texels 4 times finer
+		const uint32_t fineSize = 4 * ENV_SIZE;
+		const vector<float> solidAngles = SSphericalHarmonics::ComputeTexelSolidAngles(fineSize);
+		double integral = 0.0;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t t = 0; t < fineSize * fineSize; ++t)
+				integral += sampler.Pdf(SSphericalHarmonics::GetTexelDirection(face, t % fineSize, t / fineSize, fineSize)) * solidAngles[t];
+		}
+		check(fabs(integral - 1.0) < 1e-3, "%s: the density integrates to %.5f", name, integral);
+
+		if (uniform)
+		{
+			const float expected = 1.0f / (6.0f * ENV_SIZE * ENV_SIZE);
+			float error = 0.0f;
+			for (uint32_t face = 0; face < 6; ++face)
+				error = std::max(error, fabsf(sampler.GetTexelProbability(face, face * 9 % ENV_SIZE, face * 5 % ENV_SIZE) / expected - 1.0f));
+			check(error < 1e-4f, "%s: texel probabilities are %g off uniform", name, error);
+		}
+	};
+
+	{
+		// A sun of a few texels, as the 0.5 degree one is at 256
+		const SunnySky sky(ENV_SIZE, 7, 2.0f);
+		checkSampler("sunny sky", sky.faces, false);
+		const vector<float> black((size_t)6 * ENV_SIZE * ENV_SIZE * 4, 0.0f);
+		const float* blackFaces[6];
+		for (uint32_t face = 0; face < 6; ++face)
+			blackFaces[face] = black.data() + (size_t)face * ENV_SIZE * ENV_SIZE * 4;
+		checkSampler("black", blackFaces, true);
+
+		constexpr uint32_t PREFILTERED_SIZE = 16, PREFILTERED_MIPS = 5, SAMPLES = 16384;
+		const vector<vector<float>> reference = PrefilterReference(sky, PREFILTERED_SIZE, PREFILTERED_MIPS);
+		const PrefilterError GGX = MeasurePrefilter(sky, reference, PREFILTERED_SIZE, PREFILTERED_MIPS, SAMPLES, false);
+		const PrefilterError MIS = MeasurePrefilter(sky, reference, PREFILTERED_SIZE, PREFILTERED_MIPS, SAMPLES / 32, true);
+		check(MIS.total <= GGX.total, "MIS with %u samples has %.2f%% error, GGX with %u %.2f%%", SAMPLES / 32, MIS.total * 100.0, SAMPLES,
+			GGX.total * 100.0);
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests envsamplebench [<samples>]
+// Pre-filters a 256 x 256 sunny sky into 32 x 32, 6 levels three ways: GGX importance sampling with [samples] samples
+// per texel (65536 by default, the shader's count) as prefilterEnvMap.hlsl does, the same with 1/32 of them, and
+// SIBLBaker::PrefilterMIS with 1/32 of them. Prints the time of each and its RMS error at every roughness against a
+// brute force integral of the lobe over the environment's texels, relative to the RMS of that integral, and the time
+// to build the luminance distribution and draw from it. Fails if MIS with 1/32 of the samples is noisier than GGX
+// with all of them.
+int Tests::BenchmarkEnvironmentSampler(int argc, char** argv)
+{
+	Checker check("envsamplebench");
+	const uint32_t samples = argc > 0 ? (uint32_t)std::max(32, atoi(argv[0])) : 65536;
+	constexpr uint32_t ENV_SIZE = 256, ENV_MIPS = 9;
+	constexpr uint32_t PREFILTERED_SIZE = 32, PREFILTERED_MIPS = 6;
+	constexpr uint32_t DRAWS = 1 << 22;
+	constexpr uint32_t RUNS = 5;
+
+	const SunnySky sky(ENV_SIZE, ENV_MIPS, 0.5f);
+
+	// The distribution PrefilterMIS builds, and draws from it
+	SEnvironmentSampler sampler;
+	double buildMilliseconds = 1e30;
+	for (uint32_t run = 0; run < RUNS; ++run)
+	{
+		Timer timer;
+		sampler.Build(sky.faces, ENV_SIZE);
+		buildMilliseconds = std::min(buildMilliseconds, timer.Milliseconds());
+	}
+	vector<XMFLOAT2> numbers(DRAWS);
+	std::mt19937 generator(7);
+	for (XMFLOAT2& u : numbers)
+		u = XMFLOAT2(Random(generator), Random(generator));
+	double drawMilliseconds = 1e30;
+	uint32_t inSun = 0;
+	for (uint32_t run = 0; run < RUNS; ++run)
+	{
+		inSun = 0;
+		Timer timer;
+		for (const XMFLOAT2& u : numbers)
+		{
+			float pdf;
+			inSun += sky.InSun(sampler.Sample(u, pdf)) ? 1 : 0;
+		}
+		drawMilliseconds = std::min(drawMilliseconds, timer.Milliseconds());
+	}
+	printf("Distribution of %u x %u x 6 texels: built in %.2f ms, %u draws in %.2f ms (%.1f M/s), %.1f%% on the sun\n", ENV_SIZE, ENV_SIZE,
+		buildMilliseconds, DRAWS, drawMilliseconds, DRAWS / drawMilliseconds / 1000.0, 100.0 * inSun / DRAWS);
+
+	const vector<vector<float>> reference = PrefilterReference(sky, PREFILTERED_SIZE, PREFILTERED_MIPS);
+	struct Method
+	{
+		const char* name;
+		uint32_t samples;
+		bool MIS;
+	};
+	const Method methods[] = { { "GGX", samples, false }, { "GGX", samples / 32, false }, { "MIS", samples / 32, true } };
+	double errors[3];
+	for (uint32_t m = 0; m < 3; ++m)
+	{
+		const PrefilterError error = MeasurePrefilter(sky, reference, PREFILTERED_SIZE, PREFILTERED_MIPS, methods[m].samples, methods[m].MIS);
+		errors[m] = error.total;
+		printf("%s %6u samples: %9.1f ms, relative RMS error by roughness", methods[m].name, methods[m].samples, error.milliseconds);
+		for (double level : error.levels)
+			printf(" %6.2f%%", level * 100.0);
+		printf(", overall %.2f%%\n", error.total * 100.0);
+	}
+	check(errors[2] <= errors[0], "MIS with %u samples has %.2f%% error, GGX with %u %.2f%%", samples / 32, errors[2] * 100.0, samples, errors[0] * 100.0);
+	return check.Result();
+}
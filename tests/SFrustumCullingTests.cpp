@@ -0,0 +1,238 @@
+#include "Tests.h"
+
+#include "SFrustumCulling.h"
+#include "SMeshTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	const SFrustumCulling::Kernel KERNELS[] = { SFrustumCulling::Kernel::Scalar, SFrustumCulling::Kernel::SSE, SFrustumCulling::Kernel::AVX2 };
+
+	float Random(std::mt19937& generator, float lo, float hi)
+	{
+		return lo + (hi - lo) * ((generator() >> 8) * (1.0f / 16777216.0f));
+	}
+
+	bool IsSupported(SFrustumCulling::Kernel kernel)
+	{
+		return (int)kernel <= (int)SFrustumCulling::GetBestKernel();
+	}
+
+	// A box of half extents [size], [size] / 2 and [size] / 4 in its sphere, as SMesh computes section bounds
+	SMeshSectionBounds MakeSection(float size)
+	{
+		SMeshSectionBounds section;
+		section.center = XMFLOAT3(0.0f, 0.0f, 0.0f);
+		section.aabbMin = XMFLOAT3(-size, -0.5f * size, -0.25f * size);
+		section.aabbMax = XMFLOAT3(size, 0.5f * size, 0.25f * size);
+		section.radius = XMVectorGetX(XMVector3Length(XMLoadFloat3(&section.aabbMax)));
+		return section;
+	}
+
+	// Objects of assorted sizes and orientations scattered around a camera at the origin
+	SSceneBounds MakeScene(uint32_t count, uint32_t seed)
+	{
+		std::mt19937 generator(seed);
+		SSceneBounds bounds;
+		bounds.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const SMeshSectionBounds section = MakeSection(Random(generator, 0.1f, 2.1f));
+			const float pitch = Random(generator, 0.0f, XM_2PI), yaw = Random(generator, 0.0f, XM_2PI);
+			const float x = Random(generator, -200.0f, 200.0f), y = Random(generator, -200.0f, 200.0f), z = Random(generator, -200.0f, 200.0f);
+			bounds.Add(i, 0, section, XMMatrixRotationRollPitchYaw(pitch, yaw, 0.0f) * XMMatrixTranslation(x, y, z));
+		}
+		return bounds;
+	}
+
+	// The camera of D3D12Engine::UpdateCameraBuffer, looking along +Z and a little to the right and up
+	void GetEnginePlanes(XMFLOAT4 planes[6])
+	{
+		const XMMATRIX view = XMMatrixLookToLH(XMVectorZero(), XMVectorSet(0.3f, 0.1f, 1.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const XMMATRIX projection = XMMatrixPerspectiveFovRH(XM_PIDIV4, 16.0f / 9.0f, 0.1f, 1000.0f);
+		SFrustumCulling::ExtractPlanes(view * projection, planes);
+	}
+
+	// Entries of [bounds] whose sphere and box both reach the inside of every plane, in double precision. Entries
+	// within [margin] of a plane are left out of both [outVisible] and [outHidden], as float rounding decides them.
+	void ReferenceCull(const SSceneBounds& bounds, const XMFLOAT4 planes[6], double margin, vector<uint32_t>& outVisible, vector<uint32_t>& outHidden)
+	{
+		outVisible.clear();
+		outHidden.clear();
+		for (uint32_t i = 0; i < bounds.size(); ++i)
+		{
+			bool outside = false, close = false;
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				const XMFLOAT4& plane = planes[p];
+				const double sphere = (double)plane.x * bounds.centerX[i] + (double)plane.y * bounds.centerY[i] + (double)plane.z * bounds.centerZ[i]
+					+ plane.w + bounds.radius[i];
+				const double box = (double)plane.x * bounds.aabbCenterX[i] + (double)plane.y * bounds.aabbCenterY[i] + (double)plane.z * bounds.aabbCenterZ[i]
+					+ plane.w + fabs(plane.x) * bounds.aabbExtentX[i] + fabs(plane.y) * bounds.aabbExtentY[i] + fabs(plane.z) * bounds.aabbExtentZ[i];
+				outside |= sphere < 0.0 || box < 0.0;
+				close |= fabs(sphere) < margin || fabs(box) < margin;
+			}
+			if (!close)
+				(outside ? outHidden : outVisible).push_back(i);
+		}
+	}
+}
+
+// D3D12EngineTests cull
+// SFrustumCulling: extracted planes are normalized and agree with the clip space test, objects in front of, behind,
+// beyond and beside a camera and on its left plane are culled as they should be, random objects as a double
+// precision plane test culls them, and every kernel returns what the scalar one does for counts around its width.
+int Tests::TestCulling(int, char**)
+{
+	Checker check("cull");
+	std::mt19937 generator(3);
+
+	{
+		const XMMATRIX viewProjection = XMMatrixLookToLH(XMVectorZero(), XMVectorSet(0.3f, 0.1f, 1.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f))
+			* XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, 0.1f, 100.0f);
+		XMFLOAT4 planes[6];
+		SFrustumCulling::ExtractPlanes(viewProjection, planes);
+		float lengthError = 0.0f;
+		for (const XMFLOAT4& plane : planes)
+			lengthError = std::max(lengthError, fabsf(sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z) - 1.0f));
+		check(lengthError < 1e-5f, "plane normals are %g off unit length", lengthError);
+
+		// Points clearly on one side of the clip volume: -w <= x, y <= w, 0 <= z <= w
+		uint32_t inside = 0, wrong = 0;
+		for (uint32_t i = 0; i < 100000; ++i)
+		{
+			const XMFLOAT3 point(Random(generator, -120.0f, 120.0f), Random(generator, -120.0f, 120.0f), Random(generator, -120.0f, 120.0f));
+			XMFLOAT4 clip;
+			XMStoreFloat4(&clip, XMVector4Transform(XMVectorSet(point.x, point.y, point.z, 1.0f), viewProjection));
+			const float margin = 1e-3f * fabsf(clip.w);
+			const float distances[] = { clip.w + clip.x, clip.w - clip.x, clip.w + clip.y, clip.w - clip.y, clip.z, clip.w - clip.z };
+			if (std::any_of(distances, distances + 6, [margin](float d) { return fabsf(d) < margin; }))
+				continue;
+			const bool clipInside = std::all_of(distances, distances + 6, [](float d) { return d > 0.0f; });
+			bool planeInside = true;
+			for (const XMFLOAT4& plane : planes)
+				planeInside &= plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w >= 0.0f;
+			inside += clipInside;
+			wrong += clipInside != planeInside;
+		}
+		check(inside > 100 && wrong == 0, "%u of the points disagree with the clip space test, %u inside", wrong, inside);
+	}
+
+	// A 90 degree camera at the origin looking along +Z: left plane x = -z, far plane at 100
+	{
+		const XMMATRIX viewProjection = XMMatrixLookToLH(XMVectorZero(), XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f))
+			* XMMatrixPerspectiveFovLH(XM_PIDIV2, 1.0f, 0.1f, 100.0f);
+		XMFLOAT4 planes[6];
+		SFrustumCulling::ExtractPlanes(viewProjection, planes);
+		struct Case
+		{
+			const char* name;
+			XMFLOAT3 position;
+			bool visible;
+		};
+		const Case cases[] = {
+			{ "in front", XMFLOAT3(0.0f, 0.0f, 10.0f), true },
+			{ "behind", XMFLOAT3(0.0f, 0.0f, -10.0f), false },
+			{ "beyond the far plane", XMFLOAT3(0.0f, 0.0f, 105.0f), false },
+			{ "on the far plane", XMFLOAT3(0.0f, 0.0f, 100.0f), true },
+			{ "on the left plane", XMFLOAT3(-10.0f, 0.0f, 10.0f), true },
+			{ "left of the left plane", XMFLOAT3(-15.0f, 0.0f, 10.0f), false },
+			{ "below", XMFLOAT3(0.0f, -15.0f, 10.0f), false },
+		};
+		SSceneBounds bounds;
+		for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+			bounds.Add(i, 0, MakeSection(1.0f), XMMatrixTranslation(cases[i].position.x, cases[i].position.y, cases[i].position.z));
+		for (SFrustumCulling::Kernel kernel : KERNELS)
+		{
+			if (!IsSupported(kernel))
+				continue;
+			vector<uint32_t> visible;
+			SFrustumCulling::Cull(bounds, planes, visible, kernel);
+			for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+			{
+				const bool found = std::find(visible.begin(), visible.end(), i) != visible.end();
+				check(found == cases[i].visible, "%s: an object %s is %s", SFrustumCulling::GetKernelName(kernel), cases[i].name, found ? "visible" : "culled");
+			}
+		}
+	}
+
+	XMFLOAT4 planes[6];
+	GetEnginePlanes(planes);
+	for (uint32_t count : { 0u, 1u, 7u, 9u, 1001u })
+	{
+		const SSceneBounds bounds = MakeScene(count, count + 1);
+		vector<uint32_t> expectedVisible, expectedHidden, reference;
+		ReferenceCull(bounds, planes, 1e-3, expectedVisible, expectedHidden);
+		SFrustumCulling::Cull(bounds, planes, reference, SFrustumCulling::Kernel::Scalar);
+		uint32_t missing = 0, extra = 0;
+		for (uint32_t i : expectedVisible)
+			missing += !std::binary_search(reference.begin(), reference.end(), i);
+		for (uint32_t i : expectedHidden)
+			extra += std::binary_search(reference.begin(), reference.end(), i);
+		check(missing == 0 && extra == 0 && std::is_sorted(reference.begin(), reference.end()), "%u objects: %u visible ones culled, %u hidden ones kept",
+			count, missing, extra);
+		if (count == 1001)
+			check(expectedVisible.size() > 10 && expectedHidden.size() > 10, "only %zu of 1001 objects visible", expectedVisible.size());
+
+		for (SFrustumCulling::Kernel kernel : KERNELS)
+		{
+			if (kernel == SFrustumCulling::Kernel::Scalar || !IsSupported(kernel))
+				continue;
+			// Whatever the list held before is replaced
+			vector<uint32_t> visible(3, 12345);
+			SFrustumCulling::Cull(bounds, planes, visible, kernel);
+			check(visible == reference, "%s, %u objects: %zu visible, the scalar kernel has %zu", SFrustumCulling::GetKernelName(kernel), count,
+				visible.size(), reference.size());
+		}
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests cullbench [<objects>]
+// Frustum culls [objects] random objects (100000 by default) around the engine's camera with every kernel the CPU
+// supports, best of 20 runs. Fails if a kernel's list differs from the scalar kernel's.
+int Tests::BenchmarkCulling(int argc, char** argv)
+{
+	Checker check("cullbench");
+	const uint32_t objectCount = argc > 0 ? (uint32_t)std::max(1, atoi(argv[0])) : 100000;
+	constexpr uint32_t RUNS = 20;
+
+	const SSceneBounds bounds = MakeScene(objectCount, 1);
+	XMFLOAT4 planes[6];
+	GetEnginePlanes(planes);
+
+	vector<uint32_t> reference;
+	double scalarMilliseconds = 0.0;
+	for (SFrustumCulling::Kernel kernel : KERNELS)
+	{
+		if (!IsSupported(kernel))
+			continue;
+
+		vector<uint32_t> visible;
+		double fastest = 1e30;
+		for (uint32_t run = 0; run < RUNS; ++run)
+		{
+			Timer timer;
+			SFrustumCulling::Cull(bounds, planes, visible, kernel);
+			fastest = std::min(fastest, timer.Milliseconds());
+		}
+		if (kernel == SFrustumCulling::Kernel::Scalar)
+		{
+			reference = visible;
+			scalarMilliseconds = fastest;
+		}
+		check(visible == reference, "%s: %zu visible, the scalar kernel has %zu", SFrustumCulling::GetKernelName(kernel), visible.size(), reference.size());
+		printf("%-6s %u objects, %zu visible: %8.3f ms, %.2fx scalar, %.1f M objects/s\n", SFrustumCulling::GetKernelName(kernel), objectCount,
+			visible.size(), fastest, scalarMilliseconds / fastest, objectCount / (fastest * 1000.0));
+	}
+	return check.Result();
+}
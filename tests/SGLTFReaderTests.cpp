@@ -0,0 +1,427 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SGLTFReader.h"
+
+#include "cgltf.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	struct LoadedMesh
+	{
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+	};
+
+	// Whether the baseline loader can read the first mesh of [Data] without reading out of bounds
+	bool IsBaselineReadable(const cgltf_data* Data)
+	{
+		if (Data->meshes_count == 0)
+			return false;
+		for (cgltf_size SectionIdx = 0; SectionIdx < Data->meshes[0].primitives_count; ++SectionIdx)
+		{
+			const cgltf_primitive& Primitive = Data->meshes[0].primitives[SectionIdx];
+			if (!Primitive.indices || !Primitive.indices->buffer_view || Primitive.indices->is_sparse)
+				return false;
+			for (cgltf_size AttribIdx = 0; AttribIdx < Primitive.attributes_count; ++AttribIdx)
+			{
+				const cgltf_accessor* Accessor = Primitive.attributes[AttribIdx].data;
+				if (!Accessor->buffer_view || Accessor->is_sparse || Accessor->component_type != cgltf_component_type_r_32f ||
+					Accessor->stride != cgltf_calc_size(Accessor->type, Accessor->component_type))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// SMesh::_LoadGLTF before SGLTFReader: the primitives of the first mesh only, tightly packed float attributes and
+	// 8, 16 or 32 bit indices, staged through temporary arrays. Kept as the reference for the files it could read.
+	bool LoadWithBaseline(const char* filename, LoadedMesh& out)
+	{
+		cgltf_options Options = {};
+		cgltf_data* Data = nullptr;
+		if (cgltf_parse_file(&Options, filename, &Data) != cgltf_result_success)
+			return false;
+		if (cgltf_load_buffers(&Options, Data, filename) != cgltf_result_success || !IsBaselineReadable(Data))
+		{
+			cgltf_free(Data);
+			return false;
+		}
+
+		const cgltf_mesh* Mesh = &Data->meshes[0];
+		vector<XMFLOAT3> positions;
+		vector<XMFLOAT2> texcoords;
+		vector<XMFLOAT3> normals;
+		for (cgltf_size SectionIdx = 0; SectionIdx < Mesh->primitives_count; ++SectionIdx)
+		{
+			const cgltf_primitive& Primitive = Mesh->primitives[SectionIdx];
+			SMeshSection Section;
+			Section.startIndexLocation = (uint32_t)out.indices.size();
+			Section.baseVertexLocation = (uint32_t)out.vertices.size();
+
+			const cgltf_accessor* Accessor = Primitive.indices;
+			const uint8_t* DataAddr = (const uint8_t*)Accessor->buffer_view->buffer->data + Accessor->offset + Accessor->buffer_view->offset;
+			Section.indexCount = (uint32_t)Accessor->count;
+			for (cgltf_size Idx = 0; Idx < Accessor->count; ++Idx)
+			{
+				if (Accessor->stride == 1)
+					out.indices.push_back(DataAddr[Idx]);
+				else if (Accessor->stride == 2)
+					out.indices.push_back(((const uint16_t*)DataAddr)[Idx]);
+				else
+					out.indices.push_back(((const uint32_t*)DataAddr)[Idx]);
+			}
+
+			for (cgltf_size AttribIdx = 0; AttribIdx < Primitive.attributes_count; ++AttribIdx)
+			{
+				const cgltf_attribute& Attrib = Primitive.attributes[AttribIdx];
+				Accessor = Attrib.data;
+				DataAddr = (const uint8_t*)Accessor->buffer_view->buffer->data + Accessor->offset + Accessor->buffer_view->offset;
+				if (Attrib.type == cgltf_attribute_type_position)
+				{
+					positions.resize(Accessor->count);
+					memcpy(positions.data(), DataAddr, Accessor->count * Accessor->stride);
+				}
+				else if (Attrib.type == cgltf_attribute_type_texcoord)
+				{
+					texcoords.resize(Accessor->count);
+					memcpy(texcoords.data(), DataAddr, Accessor->count * Accessor->stride);
+				}
+				else if (Attrib.type == cgltf_attribute_type_normal)
+				{
+					normals.resize(Accessor->count);
+					memcpy(normals.data(), DataAddr, Accessor->count * Accessor->stride);
+				}
+			}
+
+			// The original read uvs even when there were none; missing attributes are zero here
+			texcoords.resize(positions.size(), XMFLOAT2(0, 0));
+			normals.resize(positions.size(), XMFLOAT3(0, 0, 0));
+			for (size_t Idx = 0; Idx < positions.size(); ++Idx)
+			{
+				SVertex Vertex = {};
+				Vertex.position = positions[Idx];
+				Vertex.uv = texcoords[Idx];
+				Vertex.normal = normals[Idx];
+				out.vertices.push_back(Vertex);
+			}
+			out.sections.push_back(Section);
+			positions.clear();
+			texcoords.clear();
+			normals.clear();
+		}
+
+		cgltf_free(Data);
+		return true;
+	}
+
+	// Returns an empty string if both loads are the same, or what differs
+	std::string Compare(const LoadedMesh& mesh, const LoadedMesh& expected)
+	{
+		if (mesh.sections.size() != expected.sections.size())
+			return std::to_string(mesh.sections.size()) + " sections instead of " + std::to_string(expected.sections.size());
+		for (size_t s = 0; s < mesh.sections.size(); ++s)
+		{
+			if (memcmp(&mesh.sections[s], &expected.sections[s], sizeof(SMeshSection)) != 0)
+				return "section " + std::to_string(s) + " differs";
+		}
+		if (mesh.indices != expected.indices)
+			return "indices differ";
+		if (mesh.vertices.size() != expected.vertices.size())
+			return std::to_string(mesh.vertices.size()) + " vertices instead of " + std::to_string(expected.vertices.size());
+		for (size_t v = 0; v < mesh.vertices.size(); ++v)
+		{
+			if (memcmp(&mesh.vertices[v], &expected.vertices[v], sizeof(SVertex)) != 0)
+				return "vertex " + std::to_string(v) + " differs";
+		}
+		return std::string();
+	}
+
+	// resources/*/*_1k.gltf, the meshes the demo ships
+	vector<std::string> FindDemoMeshes()
+	{
+		vector<std::string> paths;
+		std::error_code error;
+		for (const auto& directory : std::filesystem::directory_iterator(D3D12ENGINE_RESOURCES_DIR, error))
+		{
+			for (const auto& file : std::filesystem::directory_iterator(directory.path(), error))
+			{
+				const std::string name = file.path().filename().string();
+				const std::string suffix = "_1k.gltf";
+				if (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+					paths.push_back(file.path().string());
+			}
+		}
+		std::sort(paths.begin(), paths.end());
+		return paths;
+	}
+
+	std::string EncodeBase64(const vector<uint8_t>& bytes)
+	{
+		static const char DIGITS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		std::string text;
+		for (size_t i = 0; i < bytes.size(); i += 3)
+		{
+			const uint32_t group = (uint32_t)bytes[i] << 16 | (i + 1 < bytes.size() ? (uint32_t)bytes[i + 1] << 8 : 0) | (i + 2 < bytes.size() ? bytes[i + 2] : 0);
+			text += DIGITS[group >> 18];
+			text += DIGITS[(group >> 12) & 63];
+			text += i + 1 < bytes.size() ? DIGITS[(group >> 6) & 63] : '=';
+			text += i + 2 < bytes.size() ? DIGITS[group & 63] : '=';
+		}
+		return text;
+	}
+
+	template<typename T>
+	void Put(vector<uint8_t>& bytes, size_t offset, std::initializer_list<T> values)
+	{
+		for (const T& value : values)
+		{
+			memcpy(&bytes[offset], &value, sizeof(T));
+			offset += sizeof(T);
+		}
+	}
+
+	// A file that exercises what the demo meshes do not: interleaved positions and normals, normalized 16 bit uvs,
+	// 8, 16 and 32 bit indices, a sparse accessor, a primitive without indices, a point primitive, a node hierarchy
+	// with a translation, a mirroring scale and a node outside the scene.
+	std::string MakeFeatureGLTF()
+	{
+		vector<uint8_t> buffer(124, 0);
+		Put<float>(buffer, 0, { 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1 });  // Position, normal
+		Put<uint16_t>(buffer, 72, { 0, 0, 65535, 0, 0, 65535 });
+		Put<uint8_t>(buffer, 84, { 0, 1, 2 });
+		Put<uint16_t>(buffer, 88, { 2, 1, 0 });
+		Put<uint32_t>(buffer, 96, { 0, 2, 1 });
+		Put<uint8_t>(buffer, 108, { 1 });
+		Put<float>(buffer, 112, { 5, 5, 5 });
+
+		return std::string(R"({
+"asset": { "version": "2.0" },
+"buffers": [ { "byteLength": 124, "uri": "data:application/octet-stream;base64,)") + EncodeBase64(buffer) + R"(" } ],
+"bufferViews": [
+	{ "buffer": 0, "byteOffset": 0, "byteLength": 72, "byteStride": 24 },
+	{ "buffer": 0, "byteOffset": 72, "byteLength": 12 },
+	{ "buffer": 0, "byteOffset": 84, "byteLength": 3 },
+	{ "buffer": 0, "byteOffset": 88, "byteLength": 6 },
+	{ "buffer": 0, "byteOffset": 96, "byteLength": 12 },
+	{ "buffer": 0, "byteOffset": 108, "byteLength": 1 },
+	{ "buffer": 0, "byteOffset": 112, "byteLength": 12 }
+],
+"accessors": [
+	{ "bufferView": 0, "byteOffset": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [ 0, 0, 0 ], "max": [ 1, 1, 0 ] },
+	{ "bufferView": 0, "byteOffset": 12, "componentType": 5126, "count": 3, "type": "VEC3" },
+	{ "bufferView": 1, "componentType": 5123, "normalized": true, "count": 3, "type": "VEC2" },
+	{ "bufferView": 2, "componentType": 5121, "count": 3, "type": "SCALAR" },
+	{ "bufferView": 3, "componentType": 5123, "count": 3, "type": "SCALAR" },
+	{ "bufferView": 4, "componentType": 5125, "count": 3, "type": "SCALAR" },
+	{ "bufferView": 0, "byteOffset": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [ 0, 0, 0 ], "max": [ 5, 5, 5 ],
+	  "sparse": { "count": 1, "indices": { "bufferView": 5, "componentType": 5121 }, "values": { "bufferView": 6 } } }
+],
+"meshes": [
+	{ "primitives": [
+		{ "attributes": { "POSITION": 0, "NORMAL": 1, "TEXCOORD_0": 2 }, "indices": 3 },
+		{ "attributes": { "POSITION": 0 }, "indices": 4, "mode": 0 },
+		{ "attributes": { "POSITION": 6, "NORMAL": 1 } } ] },
+	{ "primitives": [ { "attributes": { "POSITION": 0, "NORMAL": 1 }, "indices": 5 } ] }
+],
+"nodes": [
+	{ "children": [ 1 ], "translation": [ 10, 0, 0 ] },
+	{ "mesh": 0 },
+	{ "mesh": 1, "scale": [ -1, 1, 1 ] },
+	{ "mesh": 1 }
+],
+"scenes": [ { "nodes": [ 0, 2 ] } ],
+"scene": 0
+}
+)";
+	}
+
+	// A single primitive without indices over [vertexCount] vertices at the origin, its buffer in [bufferName]
+	std::string MakeUnindexedGLTF(const char* bufferName, size_t vertexCount)
+	{
+		const std::string byteLength = std::to_string(vertexCount * 12);
+		return std::string(R"({
+"asset": { "version": "2.0" },
+"buffers": [ { "byteLength": )") + byteLength + R"(, "uri": ")" + bufferName + R"(" } ],
+"bufferViews": [ { "buffer": 0, "byteLength": )" + byteLength + R"( } ],
+"accessors": [ { "bufferView": 0, "componentType": 5126, "count": )" + std::to_string(vertexCount) + R"(, "type": "VEC3", "min": [ 0, 0, 0 ], "max": [ 0, 0, 0 ] } ],
+"meshes": [ { "primitives": [ { "attributes": { "POSITION": 0 } } ] } ]
+})";
+	}
+
+	// Reads [path] with 16 bit indices and compares them with the 32 bit read
+	bool ReadsShortIndices(const std::string& path, const LoadedMesh& expected)
+	{
+		LoadedMesh mesh;
+		vector<uint16_t> shortIndices;
+		return SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, shortIndices, mesh.sections) && mesh.indices.empty() &&
+			std::equal(shortIndices.begin(), shortIndices.end(), expected.indices.begin(), expected.indices.end()) &&
+			mesh.vertices.size() == expected.vertices.size() && mesh.sections.size() == expected.sections.size();
+	}
+
+	bool IsNear(const XMFLOAT3& a, float x, float y, float z)
+	{
+		return fabsf(a.x - x) < 1e-6f && fabsf(a.y - y) < 1e-6f && fabsf(a.z - z) < 1e-6f;
+	}
+}
+
+// D3D12EngineTests gltf
+// SGLTFReader reads the demo meshes exactly like the loader it replaced, and reads the features that loader ignored.
+// Reading into 16 bit indices gives the same indices, and switches to 32 bits for primitives of more than 65536 vertices.
+int Tests::TestGLTFReader(int, char**)
+{
+	Checker check("gltf");
+
+	vector<std::string> paths = FindDemoMeshes();
+	check(!paths.empty(), "no resources/*/*_1k.gltf under %s", D3D12ENGINE_RESOURCES_DIR);
+	paths.push_back(std::string(D3D12ENGINE_RESOURCES_DIR) + "/meshes/Cube.gltf");
+	for (const std::string& path : paths)
+	{
+		LoadedMesh mesh, expected;
+		if (check(SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, mesh.sections), "failed to read %s", path.c_str()) &&
+			check(LoadWithBaseline(path.c_str(), expected), "the baseline loader failed to read %s", path.c_str()))
+		{
+			const std::string difference = Compare(mesh, expected);
+			check(difference.empty(), "%s: %s", path.c_str(), difference.c_str());
+			check(ReadsShortIndices(path, mesh), "%s: the 16 bit indices differ", path.c_str());
+		}
+	}
+
+	// Appending keeps what is already there and offsets the new sections
+	{
+		const std::string& path = paths.back();
+		LoadedMesh mesh;
+		SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, mesh.sections);
+		const size_t vertexCount = mesh.vertices.size(), indexCount = mesh.indices.size();
+		if (check(SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, mesh.sections), "failed to append %s", path.c_str()) &&
+			check(mesh.sections.size() == 2, "appended %zu sections, expected 2", mesh.sections.size()))
+		{
+			check(mesh.sections[1].baseVertexLocation == vertexCount && mesh.sections[1].startIndexLocation == indexCount,
+				"the appended section starts at vertex %u, index %u", mesh.sections[1].baseVertexLocation, mesh.sections[1].startIndexLocation);
+			check(std::equal(mesh.indices.begin(), mesh.indices.begin() + indexCount, mesh.indices.begin() + indexCount),
+				"appended indices are not relative to their section");
+		}
+	}
+
+	const std::string path = GetTempPath("D3D12EngineTests_features.gltf");
+	LoadedMesh mesh;
+	if (check(WriteTextFile(path, MakeFeatureGLTF()), "failed to write %s", path.c_str()) &&
+		check(SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, mesh.sections), "failed to read the feature file") &&
+		check(mesh.sections.size() == 3 && mesh.vertices.size() == 9 && mesh.indices.size() == 9,
+			"feature file: %zu sections, %zu vertices, %zu indices, expected 3, 9 and 9", mesh.sections.size(), mesh.vertices.size(), mesh.indices.size()))
+	{
+		const vector<SVertex>& v = mesh.vertices;
+
+		// Interleaved attributes, u8 indices, normalized u16 uvs, moved by the parent's translation
+		check(IsNear(v[0].position, 10, 0, 0) && IsNear(v[1].position, 11, 0, 0) && IsNear(v[2].position, 10, 1, 0), "interleaved positions or translation wrong");
+		check(IsNear(v[1].normal, 0, 0, 1), "interleaved normal wrong");
+		check(v[1].uv.x == 1.0f && v[1].uv.y == 0.0f && v[2].uv.x == 0.0f && v[2].uv.y == 1.0f, "normalized uvs wrong");
+		check(mesh.indices[0] == 0 && mesh.indices[1] == 1 && mesh.indices[2] == 2, "u8 indices wrong");
+
+		// The point primitive is skipped, the next one has no indices and a sparse position
+		check(mesh.sections[1].baseVertexLocation == 3 && mesh.sections[1].indexCount == 3, "primitive without indices at the wrong place");
+		check(mesh.indices[3] == 0 && mesh.indices[4] == 1 && mesh.indices[5] == 2, "implicit indices wrong");
+		check(IsNear(v[4].position, 15, 5, 5) && IsNear(v[3].position, 10, 0, 0), "sparse position wrong");
+
+		// Mirrored by its node: positions flipped, normals still unit length, winding reversed from the u32 indices' 0 2 1
+		check(IsNear(v[7].position, -1, 0, 0) && IsNear(v[8].position, 0, 1, 0), "mirrored positions wrong");
+		check(IsNear(v[7].normal, 0, 0, 1), "mirrored normal wrong");
+		check(mesh.indices[6] == 0 && mesh.indices[7] == 1 && mesh.indices[8] == 2, "mirrored winding not flipped");
+
+		// u8, u16 and u32 accessors, implicit and flipped indices all read the same in 16 bits
+		check(ReadsShortIndices(path, mesh), "feature file: the 16 bit indices differ");
+	}
+
+	// A primitive of more than 65536 vertices moves what was read in 16 bits to 32 bits before it is appended
+	const std::string largePath = GetTempPath("D3D12EngineTests_large.gltf");
+	const std::string largeBufferPath = GetTempPath("D3D12EngineTests_large.bin");
+	const size_t largeVertexCount = 65538;
+	if (check(WriteTextFile(largePath, MakeUnindexedGLTF("D3D12EngineTests_large.bin", largeVertexCount)) &&
+		WriteTextFile(largeBufferPath, std::string(largeVertexCount * 12, '\0')), "failed to write %s", largePath.c_str()))
+	{
+		LoadedMesh large;
+		vector<uint16_t> shortIndices;
+		SGLTFReader::Append(path.c_str(), large.vertices, large.indices, shortIndices, large.sections);
+		const vector<uint16_t> featureIndices = shortIndices;
+		if (check(SGLTFReader::Append(largePath.c_str(), large.vertices, large.indices, shortIndices, large.sections), "failed to read %s", largePath.c_str()))
+		{
+			check(shortIndices.empty() && large.indices.size() == featureIndices.size() + largeVertexCount &&
+				std::equal(featureIndices.begin(), featureIndices.end(), large.indices.begin()) && large.indices.back() == largeVertexCount - 1,
+				"a primitive of %zu vertices: %zu 16 bit and %zu 32 bit indices", largeVertexCount, shortIndices.size(), large.indices.size());
+		}
+
+		// Once there are 32 bit indices, everything appended stays in 32 bits
+		const size_t indexCount = large.indices.size();
+		check(SGLTFReader::Append(path.c_str(), large.vertices, large.indices, shortIndices, large.sections) && shortIndices.empty() &&
+			large.indices.size() == indexCount + featureIndices.size(), "appending to 32 bit indices read 16 bit ones");
+	}
+	remove(largePath.c_str());
+	remove(largeBufferPath.c_str());
+	remove(path.c_str());
+
+	// Files that cannot be read leave the mesh alone
+	LoadedMesh untouched;
+	check(!SGLTFReader::Append(GetTempPath("D3D12EngineTests_missing.gltf").c_str(), untouched.vertices, untouched.indices, untouched.sections),
+		"a missing file was read");
+	if (check(WriteTextFile(path, "{ \"asset\": { \"version\": \"2.0\" }, \"buffers\": [ { \"byteLength\": 16, \"uri\": \"missing.bin\" } ] }"), "failed to write %s", path.c_str()))
+	{
+		check(!SGLTFReader::Append(path.c_str(), untouched.vertices, untouched.indices, untouched.sections), "a file with a missing buffer was read");
+		remove(path.c_str());
+	}
+	check(untouched.vertices.empty() && untouched.indices.empty() && untouched.sections.empty(), "a failed read changed the mesh");
+
+	return check.Result();
+}
+
+// D3D12EngineTests gltfbench [<gltf>...]
+// Loads each glTF file (the demo's resources/*/*_1k.gltf if none is given) with SGLTFReader and with the loader it
+// replaced, best of 10 each, and prints both times. Fails if the two disagree on a file the old loader could read.
+int Tests::BenchmarkGLTFReader(int argc, char** argv)
+{
+	Checker check("gltfbench");
+	vector<std::string> paths(argv, argv + argc);
+	if (paths.empty())
+		paths = FindDemoMeshes();
+
+	for (const std::string& path : paths)
+	{
+		double best[2] = { 1e30, 1e30 };
+		LoadedMesh meshes[2];
+		bool loaded[2] = { true, true };
+		for (uint32_t run = 0; run < 10; ++run)
+		{
+			for (uint32_t loader = 0; loader < 2; ++loader)
+			{
+				LoadedMesh mesh;
+				Timer timer;
+				loaded[loader] = loader == 0 ? SGLTFReader::Append(path.c_str(), mesh.vertices, mesh.indices, mesh.sections) : LoadWithBaseline(path.c_str(), mesh);
+				best[loader] = std::min(best[loader], timer.Milliseconds());
+				meshes[loader] = std::move(mesh);
+			}
+		}
+		if (!check(loaded[0], "SGLTFReader failed to read %s", path.c_str()))
+			continue;
+
+		const LoadedMesh& mesh = meshes[0];
+		printf("%s: %zu sections, %zu vertices, %zu indices\n", path.c_str(), mesh.sections.size(), mesh.vertices.size(), mesh.indices.size());
+		printf("  SGLTFReader %8.3f ms, %7.1f M vertices/s\n", best[0], mesh.vertices.size() / best[0] / 1000.0);
+		if (loaded[1])
+		{
+			const std::string difference = Compare(mesh, meshes[1]);
+			check(difference.empty(), "%s: %s", path.c_str(), difference.c_str());
+			printf("  baseline    %8.3f ms, %7.1f M vertices/s, %.2fx\n", best[1], meshes[1].vertices.size() / best[1] / 1000.0, best[1] / best[0]);
+		}
+	}
+	return check.Result();
+}
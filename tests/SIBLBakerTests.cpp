@@ -0,0 +1,327 @@
+#include "Tests.h"
+
+#include "MappedFile.h"
+#include "PixelConvert.h"
+#include "SIBLBaker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace DirectX;
+using namespace SIBLBaker;
+using std::string;
+using std::vector;
+
+namespace
+{
+	constexpr uint32_t PANORAMA_WIDTH = 512, PANORAMA_HEIGHT = 256;
+	constexpr uint32_t ENV_SIZE = 64, ENV_MIPS = 7;
+	constexpr uint32_t PREFILTERED_SIZE = 16, PREFILTERED_MIPS = 5;
+	constexpr uint32_t SAMPLES = 256;
+	constexpr uint32_t BRDF_SIZE = 32, BRDF_SAMPLES = 4096;
+
+	// A smooth, direction dependent environment: each channel brightens towards one axis
+	XMFLOAT3 Environment(const XMFLOAT3& d)
+	{
+		return XMFLOAT3(0.5f + 0.25f * d.x, 0.5f + 0.25f * d.y, 0.5f + 0.25f * d.z);
+	}
+
+	// Its irradiance over pi: the clamped cosine integrates d . axis to 2/3 of n . axis
+	XMFLOAT3 EnvironmentIrradiance(const XMFLOAT3& n)
+	{
+		return XMFLOAT3(0.5f + n.x / 6.0f, 0.5f + n.y / 6.0f, 0.5f + n.z / 6.0f);
+	}
+
+	vector<uint16_t> MakePanorama()
+	{
+		vector<uint16_t> panorama((size_t)PANORAMA_WIDTH * PANORAMA_HEIGHT * 4);
+		for (uint32_t y = 0; y < PANORAMA_HEIGHT; ++y)
+		{
+			for (uint32_t x = 0; x < PANORAMA_WIDTH; ++x)
+			{
+				// The inverse of SampleSphericalMap at the texel center
+				const float theta = (y + 0.5f) / PANORAMA_HEIGHT * XM_PI, phi = (x + 0.5f) / PANORAMA_WIDTH * XM_2PI;
+				const XMFLOAT3 value = Environment(XMFLOAT3(sinf(theta) * sinf(phi), cosf(theta), sinf(theta) * cosf(phi)));
+				const float rgba[4] = { value.x, value.y, value.z, 1.0f };
+				PixelConvert::FloatToHalf(rgba, panorama.data() + ((size_t)y * PANORAMA_WIDTH + x) * 4, 4);
+			}
+		}
+		return panorama;
+	}
+
+	XMFLOAT4 GetTexel(const Cubemap& cubemap, uint32_t face, uint32_t mip, uint32_t x, uint32_t y)
+	{
+		float texel[4];
+		PixelConvert::HalfToFloat(cubemap.GetTexels(face, mip) + ((size_t)y * cubemap.GetMipSize(mip) + x) * 4, texel, 4);
+		return XMFLOAT4(texel[0], texel[1], texel[2], texel[3]);
+	}
+
+	bool SameTexels(const Cubemap& a, const Cubemap& b)
+	{
+		return a.size == b.size && a.mipCount == b.mipCount && a.subresources == b.subresources;
+	}
+
+	// prefilterEnvMap.hlsl at texel ([x], [y]) of [face] and [mip], sample by sample
+	XMFLOAT3 PrefilterShader(const Cubemap& envMap, uint32_t face, uint32_t mip, uint32_t x, uint32_t y)
+	{
+		const float roughness = (float)mip / (PREFILTERED_MIPS - 1);
+		const uint32_t size = std::max(1u, PREFILTERED_SIZE >> mip);
+		const XMFLOAT3 N = SSphericalHarmonics::GetTexelDirection(face, x, y, size);
+		float sum[3] = {}, weightSum = 0.0f;
+		for (uint32_t i = 0; i < SAMPLES; ++i)
+		{
+			const XMFLOAT3 H = ImportanceSampleGGX(Hammersley(i, SAMPLES), roughness, N);
+			const float VoH = N.x * H.x + N.y * H.y + N.z * H.z;
+			const XMFLOAT3 L(2.0f * VoH * H.x - N.x, 2.0f * VoH * H.y - N.y, 2.0f * VoH * H.z - N.z);
+			const float NoL = std::clamp(N.x * L.x + N.y * L.y + N.z * L.z, 0.0f, 1.0f);
+			if (NoL > 0.0f)
+			{
+				const float pdf = NoL / XM_PI;
+				const float solidAngleTexel = 4.0f * XM_PI / (6.0f * envMap.size * envMap.size);
+				const float solidAngleSample = 1.0f / (SAMPLES * pdf);
+				const XMFLOAT4 value = SampleCubemap(envMap, L, 0.5f * log2f(solidAngleSample / solidAngleTexel));
+				sum[0] += value.x * NoL;
+				sum[1] += value.y * NoL;
+				sum[2] += value.z * NoL;
+				weightSum += NoL;
+			}
+		}
+		return XMFLOAT3(sum[0] / weightSum, sum[1] / weightSum, sum[2] / weightSum);
+	}
+
+	// createBRDFMap.hlsl at NoV [NoV] and [roughness], sample by sample
+	XMFLOAT2 IntegrateBRDFShader(float NoV, float roughness)
+	{
+		const XMVECTOR V = XMVectorSet(0.0f, NoV, sqrtf(1.0f - NoV * NoV), 0.0f);
+		const XMVECTOR N = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+		float A = 0.0f, B = 0.0f;
+		for (uint32_t i = 0; i < BRDF_SAMPLES; ++i)
+		{
+			const XMFLOAT3 h = ImportanceSampleGGX(Hammersley(i, BRDF_SAMPLES), roughness, XMFLOAT3(0.0f, 1.0f, 0.0f));
+			const XMVECTOR H = XMLoadFloat3(&h);
+			const XMVECTOR L = XMVector3Normalize(XMVectorSubtract(XMVectorScale(H, 2.0f * XMVectorGetX(XMVector3Dot(V, H))), V));
+			const float NdotV = fabsf(XMVectorGetX(XMVector3Dot(N, V))) + 1e-5f;
+			const float NdotL = std::clamp(XMVectorGetX(XMVector3Dot(N, L)), 0.0f, 1.0f);
+			const float VdotH = std::clamp(XMVectorGetX(XMVector3Dot(V, H)), 0.0f, 1.0f);
+			if (NdotL > 0.0f)
+			{
+				const float G_Vis = V_SmithGGXCorrelated(NdotL, NdotV, roughness);
+				const float Fc = powf(1.0f - VdotH, 5.0f);
+				A += (1.0f - Fc) * G_Vis;
+				B += Fc * G_Vis;
+			}
+		}
+		return XMFLOAT2(A / BRDF_SAMPLES, B / BRDF_SAMPLES);
+	}
+
+	vector<uint8_t> ReadBytes(const string& path)
+	{
+		MappedFile file;
+		return file.Open(path.c_str()) ? vector<uint8_t>(file.data(), file.data() + file.size()) : vector<uint8_t>();
+	}
+}
+
+// D3D12EngineTests ibl
+// The CPU IBL bake against the bake shaders on a small generated environment: the panorama lands where the shader's
+// spherical mapping puts it, a constant environment stays constant through every stage, PrefilterMIS included, the
+// pre-filtered cubemap and the BRDF LUT match literal ports of prefilterEnvMap.hlsl and createBRDFMap.hlsl at a few
+// texels, and Bake runs the same stages with SH9 irradiance matching the closed form. Then .sibl caches of the result
+// read back, damaged ones are rejected, and eviction drops the least recently used one.
+int Tests::TestIBLBaker(int, char**)
+{
+	Checker check("ibl");
+
+	const vector<uint16_t> panorama = MakePanorama();
+	Cubemap envMap;
+	ProjectPanorama(panorama.data(), PANORAMA_WIDTH, PANORAMA_HEIGHT, ENV_SIZE, ENV_MIPS, envMap);
+	GenerateMips(envMap);
+	{
+		float error = 0.0f;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t y = 0; y < ENV_SIZE; ++y)
+			{
+				for (uint32_t x = 0; x < ENV_SIZE; ++x)
+				{
+					const XMFLOAT4 texel = GetTexel(envMap, face, 0, x, y);
+					const XMFLOAT3 expected = Environment(SSphericalHarmonics::GetTexelDirection(face, x, y, ENV_SIZE));
+					error = std::max({ error, fabsf(texel.x - expected.x), fabsf(texel.y - expected.y), fabsf(texel.z - expected.z) });
+				}
+			}
+		}
+		check(error < 4e-3f, "panorama projection: max error %g", error);
+
+		// The 2 x 2 box filter of the level above, to half precision
+		float mipError = 0.0f;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t mip = 1; mip < ENV_MIPS; ++mip)
+			{
+				const uint32_t size = envMap.GetMipSize(mip);
+				for (uint32_t t = 0; t < size * size; ++t)
+				{
+					const uint32_t x = t % size, y = t / size;
+					const XMFLOAT4 texel = GetTexel(envMap, face, mip, x, y);
+					const XMFLOAT4 a = GetTexel(envMap, face, mip - 1, 2 * x, 2 * y), b = GetTexel(envMap, face, mip - 1, 2 * x + 1, 2 * y);
+					const XMFLOAT4 c = GetTexel(envMap, face, mip - 1, 2 * x, 2 * y + 1), d = GetTexel(envMap, face, mip - 1, 2 * x + 1, 2 * y + 1);
+					mipError = std::max({ mipError, fabsf(texel.x - 0.25f * (a.x + b.x + c.x + d.x)), fabsf(texel.y - 0.25f * (a.y + b.y + c.y + d.y)),
+						fabsf(texel.z - 0.25f * (a.z + b.z + c.z + d.z)) });
+				}
+			}
+		}
+		check(mipError < 5e-4f, "mips: max error %g against the box filter", mipError);
+	}
+
+	// A constant environment gives back the constant from every stage
+	{
+		Cubemap constant;
+		constant.Allocate(ENV_SIZE, ENV_MIPS);
+		for (vector<uint16_t>& subresource : constant.subresources)
+			std::fill(subresource.begin(), subresource.end(), (uint16_t)0x3C00);
+		GenerateMips(constant);
+		for (bool MIS : { false, true })
+		{
+			Cubemap prefiltered;
+			if (MIS)
+				PrefilterMIS(constant, PREFILTERED_SIZE, PREFILTERED_MIPS, SAMPLES, prefiltered);
+			else
+				Prefilter(constant, PREFILTERED_SIZE, PREFILTERED_MIPS, SAMPLES, prefiltered);
+			float error = 0.0f;
+			for (const vector<uint16_t>& subresource : prefiltered.subresources)
+			{
+				vector<float> texels(subresource.size());
+				PixelConvert::HalfToFloat(subresource.data(), texels.data(), texels.size());
+				for (float value : texels)
+					error = std::max(error, fabsf(value - 1.0f));
+			}
+			check(error < 1e-3f, "constant environment: %s is off by %g", MIS ? "PrefilterMIS" : "Prefilter", error);
+		}
+		XMFLOAT3 irradiance[SSphericalHarmonics::IRRADIANCE_COEFFICIENTS];
+		ProjectIrradiance(constant, ENV_SIZE, irradiance);
+		float error = 0.0f;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			const XMFLOAT3 value = SSphericalHarmonics::Evaluate(irradiance, 3, SSphericalHarmonics::GetTexelDirection(face, 3, 5, 8));
+			error = std::max({ error, fabsf(value.x - 1.0f), fabsf(value.y - 1.0f), fabsf(value.z - 1.0f) });
+		}
+		check(error < 1e-4f, "constant environment: irradiance is off by %g", error);
+	}
+
+	Cubemap prefiltered;
+	Prefilter(envMap, PREFILTERED_SIZE, PREFILTERED_MIPS, SAMPLES, prefiltered);
+	{
+		float error = 0.0f;
+		for (uint32_t mip = 0; mip < PREFILTERED_MIPS; ++mip)
+		{
+			const uint32_t size = prefiltered.GetMipSize(mip);
+			for (uint32_t face = 0; face < 6; ++face)
+			{
+				const uint32_t x = (face * 7 + mip * 3) % size, y = (face * 5 + mip) % size;
+				const XMFLOAT4 texel = GetTexel(prefiltered, face, mip, x, y);
+				const XMFLOAT3 expected = PrefilterShader(envMap, face, mip, x, y);
+				error = std::max({ error, fabsf(texel.x - expected.x), fabsf(texel.y - expected.y), fabsf(texel.z - expected.z) });
+			}
+		}
+		check(error < 2e-3f, "pre-filter: max error %g against the shader", error);
+	}
+
+	vector<XMFLOAT2> LUT;
+	IntegrateBRDF(BRDF_SIZE, BRDF_SAMPLES, LUT);
+	{
+		float error = 0.0f;
+		bool bounded = true;
+		for (uint32_t y = 0; y < BRDF_SIZE; y += 5)
+		{
+			for (uint32_t x = 0; x < BRDF_SIZE; x += 3)
+			{
+				const XMFLOAT2 expected = IntegrateBRDFShader((x + 1) / (float)BRDF_SIZE, (y + 1) / (float)BRDF_SIZE);
+				const XMFLOAT2& value = LUT[(size_t)y * BRDF_SIZE + x];
+				error = std::max({ error, fabsf(value.x - expected.x), fabsf(value.y - expected.y) });
+				bounded &= value.x >= 0.0f && value.y >= 0.0f;
+			}
+		}
+		check(error < 1e-4f && bounded, "BRDF LUT: max error %g against the shader%s", error, bounded ? "" : ", negative values");
+	}
+
+	// Bake runs the stages above with the same settings
+	Settings settings;
+	settings.envMapResolution = ENV_SIZE;
+	settings.envMapMips = ENV_MIPS;
+	settings.prefilteredResolution = PREFILTERED_SIZE;
+	settings.prefilteredMips = PREFILTERED_MIPS;
+	settings.irradianceResolution = ENV_SIZE;
+	settings.BRDFResolution = BRDF_SIZE;
+	settings.prefilterSamples = SAMPLES;
+	Result baked;
+	Bake(panorama.data(), PANORAMA_WIDTH, PANORAMA_HEIGHT, settings, baked);
+	check(SameTexels(baked.envMap, envMap), "Bake: the environment map differs from ProjectPanorama and GenerateMips");
+	check(SameTexels(baked.prefiltered, prefiltered), "Bake: the pre-filtered map differs from Prefilter");
+	check(baked.BRDF.size() == (size_t)BRDF_SIZE * BRDF_SIZE, "Bake: %zu BRDF LUT entries", baked.BRDF.size());
+	{
+		float error = 0.0f;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t t = 0; t < 16; ++t)
+			{
+				const XMFLOAT3 N = SSphericalHarmonics::GetTexelDirection(face, t % 4, t / 4, 4);
+				const XMFLOAT3 value = SSphericalHarmonics::Evaluate(baked.irradianceSH, 3, N);
+				const XMFLOAT3 expected = EnvironmentIrradiance(N);
+				error = std::max({ error, fabsf(value.x - expected.x), fabsf(value.y - expected.y), fabsf(value.z - expected.z) });
+			}
+		}
+		check(error < 1e-4f, "Bake: irradiance is %g from the closed form", error);
+	}
+
+	// The .sibl cache: it gives back what was written, rejects other keys and damaged bytes, and evicts the least recently used
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "D3D12EngineTests_ibl";
+		const string directoryName = directory.string();
+		std::error_code error;
+		std::filesystem::remove_all(directory, error);
+
+		const uint64_t keys[] = { 0x1B1, 0x2B2, 0x3B3 };
+		string paths[3];
+		for (uint32_t i = 0; i < 3; ++i)
+		{
+			paths[i] = SIBLCache::GetCachePath(directoryName.c_str(), keys[i]);
+			check(WriteCache(paths[i].c_str(), keys[i], settings, baked), "cache: writing %s failed", paths[i].c_str());
+		}
+
+		vector<uint8_t> bytes = ReadBytes(paths[0]);
+		SIBLCache::View view;
+		const bool valid = SIBLCache::Validate(bytes.data(), bytes.size(), keys[0], view);
+		if (check(valid, "cache: %s doesn't validate", paths[0].c_str()))
+		{
+			check(memcmp(view.irradianceSH, baked.irradianceSH, sizeof(baked.irradianceSH)) == 0, "cache: irradiance differs");
+			check(view.maps[SIBLCache::MAP_ENVIRONMENT].format == DXGI_FORMAT_BC6H_UF16 && view.maps[SIBLCache::MAP_ENVIRONMENT].mipCount == ENV_MIPS
+				&& view.maps[SIBLCache::MAP_PREFILTERED].mipCount == PREFILTERED_MIPS, "cache: wrong cubemap formats or mips");
+			check(view.maps[SIBLCache::MAP_BRDF].format == DXGI_FORMAT_R16G16_FLOAT && view.maps[SIBLCache::MAP_BRDF].width == BRDF_SIZE,
+				"cache: wrong BRDF LUT format or size");
+		}
+		check(!SIBLCache::Validate(bytes.data(), bytes.size(), keys[1], view), "cache: another key validates");
+		if (!bytes.empty())
+		{
+			vector<uint8_t> damaged = bytes;
+			damaged[damaged.size() * 2 / 3] ^= 0x10;
+			check(!SIBLCache::Validate(damaged.data(), damaged.size(), keys[0], view), "cache: a damaged file validates");
+		}
+
+		// Oldest first by their write times, then the oldest used again: room for two leaves that and the newest
+		const auto now = std::filesystem::file_time_type::clock::now();
+		for (uint32_t i = 0; i < 3; ++i)
+			std::filesystem::last_write_time(paths[i], now - std::chrono::hours(3 - i), error);
+		SIBLCache::Touch(paths[0].c_str());
+		const uint64_t freed = SIBLCache::Evict(directoryName.c_str(), 2 * bytes.size(), paths[2].c_str());
+		check(std::filesystem::exists(paths[0]) && !std::filesystem::exists(paths[1]) && std::filesystem::exists(paths[2]) && freed == bytes.size(),
+			"cache: eviction freed %llu bytes and kept %d %d %d", (unsigned long long)freed, (int)std::filesystem::exists(paths[0]),
+			(int)std::filesystem::exists(paths[1]), (int)std::filesystem::exists(paths[2]));
+		std::filesystem::remove_all(directory, error);
+	}
+
+	return check.Result();
+}
@@ -0,0 +1,203 @@
+#include "Tests.h"
+
+#include "SInstanceBatcher.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	struct Draw
+	{
+		uint32_t mesh;
+		uint32_t section;
+		uint32_t lod;
+	};
+
+	// WriteInstances needs 16 byte aligned memory, as the upload heap is
+	struct alignas(16) AlignedInstance
+	{
+		InstanceData data;
+	};
+	static_assert(sizeof(AlignedInstance) == sizeof(InstanceData), "AlignedInstance must not pad InstanceData");
+
+	// [count] random draws over [meshes] meshes with up to 4 sections and every LOD
+	vector<Draw> MakeDraws(uint32_t count, uint32_t meshes, uint32_t seed)
+	{
+		std::mt19937 generator(seed);
+		vector<Draw> draws(count);
+		for (Draw& draw : draws)
+			draw = Draw{ (uint32_t)(generator() % meshes), (uint32_t)(generator() % 4), (uint32_t)(generator() % SInstanceBatcher::MAX_LODS) };
+		return draws;
+	}
+
+	// The model matrix records the position of a draw, so the output can be traced back to it
+	XMFLOAT4X4 MakeModel(uint32_t i)
+	{
+		XMFLOAT4X4 model;
+		XMStoreFloat4x4(&model, XMMatrixTranslation((float)i, (float)(i >> 12), 0.0f));
+		return model;
+	}
+
+	void AddDraws(SInstanceBatcher& batcher, const vector<Draw>& draws)
+	{
+		batcher.Clear();
+		batcher.Reserve(draws.size());
+		for (uint32_t i = 0; i < draws.size(); ++i)
+		{
+			const XMFLOAT4X4 model = MakeModel(i);
+			batcher.Add(draws[i].mesh, draws[i].section, draws[i].lod, model, model, i);
+		}
+	}
+
+	// Scalar reference: a stable sort of the draw numbers by mesh, section and LOD
+	vector<uint32_t> SortReference(const vector<Draw>& draws)
+	{
+		vector<uint32_t> order(draws.size());
+		for (uint32_t i = 0; i < order.size(); ++i)
+			order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+		{
+			const Draw& da = draws[a];
+			const Draw& db = draws[b];
+			if (da.mesh != db.mesh)
+				return da.mesh < db.mesh;
+			if (da.section != db.section)
+				return da.section < db.section;
+			return da.lod < db.lod;
+		});
+		return order;
+	}
+
+	// Mismatches between the batcher's batches and instances and the reference order. Each batch has to be a
+	// maximal run of one key, and the instance at each position the reference's draw with its model matrix.
+	uint32_t CompareWithReference(const SInstanceBatcher& batcher, const vector<Draw>& draws, const vector<uint32_t>& order, const InstanceData* written)
+	{
+		uint32_t mismatches = batcher.size() == draws.size() ? 0 : 1;
+		uint32_t next = 0;
+		for (const SInstanceBatch& batch : batcher.GetBatches())
+		{
+			mismatches += batch.firstInstance != next || batch.instanceCount == 0;
+			next = batch.firstInstance + batch.instanceCount;
+			if (next > order.size())
+				return mismatches + 1;
+			for (uint32_t i = batch.firstInstance; i < next; ++i)
+			{
+				const Draw& draw = draws[order[i]];
+				mismatches += draw.mesh != batch.mesh || draw.section != batch.section || draw.lod != batch.lod;
+			}
+			// Maximal: the draw after a batch has another key
+			if (next < order.size())
+			{
+				const Draw& after = draws[order[next]];
+				mismatches += after.mesh == batch.mesh && after.section == batch.section && after.lod == batch.lod;
+			}
+		}
+		mismatches += next != order.size();
+
+		for (uint32_t i = 0; i < order.size() && i < batcher.size(); ++i)
+		{
+			const InstanceData& instance = batcher.GetInstance(i);
+			const XMFLOAT4X4 model = MakeModel(order[i]);
+			mismatches += instance.materialIndex != order[i] || memcmp(&instance.model, &model, sizeof(model)) != 0
+				|| memcmp(&instance.normalMatrix, &model, sizeof(model)) != 0;
+			if (written)
+				mismatches += memcmp(&written[i], &instance, sizeof(InstanceData)) != 0;
+		}
+		return mismatches;
+	}
+}
+
+// D3D12EngineTests instancing
+// SInstanceBatcher against a stable sort of the draws: random draws over few and many meshes, keys at the largest
+// mesh, section and LOD, a single key, no draws, and a second frame after Clear. WriteInstances has to write the
+// instances in batch order.
+int Tests::TestInstancing(int, char**)
+{
+	Checker check("instancing");
+	SInstanceBatcher batcher;
+
+	auto run = [&](const char* name, const vector<Draw>& draws)
+	{
+		AddDraws(batcher, draws);
+		batcher.Build();
+		vector<AlignedInstance> written(draws.size());
+		batcher.WriteInstances(&written.data()->data);
+		const vector<uint32_t> order = SortReference(draws);
+		const uint32_t mismatches = CompareWithReference(batcher, draws, order, &written.data()->data);
+		check(mismatches == 0, "%s: %u mismatches with the reference over %zu draws in %zu batches", name, mismatches, draws.size(), batcher.GetBatches().size());
+	};
+
+	// Few meshes sort in one radix pass, many meshes in two
+	run("few meshes", MakeDraws(5000, 3, 1));
+	run("many meshes", MakeDraws(20000, 5000, 2));
+
+	// Every key bit in use
+	{
+		vector<Draw> draws = MakeDraws(1000, 8, 3);
+		for (uint32_t i = 0; i < draws.size(); i += 3)
+			draws[i] = Draw{ SInstanceBatcher::MAX_MESHES - 1 - i % 2, SInstanceBatcher::MAX_SECTIONS - 1 - i % 5, SInstanceBatcher::MAX_LODS - 1 - i % 3 };
+		run("largest keys", draws);
+	}
+
+	run("single key", vector<Draw>(100, Draw{ 7, 1, 2 }));
+	run("no draws", vector<Draw>());
+	check(batcher.GetBatches().empty(), "no draws: %zu batches", batcher.GetBatches().size());
+
+	// A frame after a frame with more draws
+	run("first frame", MakeDraws(3000, 50, 4));
+	run("second frame", MakeDraws(700, 20, 5));
+
+	return check.Result();
+}
+
+// D3D12EngineTests instancingbench [<instances>]
+// Adds, batches and writes 10K, 30K and 100K random draws over 64 meshes of 4 sections each, or [instances], best
+// of 20 runs, next to a std::stable_sort of the same draws. Fails if the batches disagree with the sort.
+int Tests::BenchmarkInstancing(int argc, char** argv)
+{
+	Checker check("instancingbench");
+	vector<uint32_t> counts = { 10000, 30000, 100000 };
+	if (argc > 0)
+		counts = { (uint32_t)std::max(1, atoi(argv[0])) };
+	constexpr uint32_t RUNS = 20;
+
+	SInstanceBatcher batcher;
+	for (uint32_t count : counts)
+	{
+		const vector<Draw> draws = MakeDraws(count, 64, 1);
+		vector<AlignedInstance> written(count);
+		double addMilliseconds = 1e30, buildMilliseconds = 1e30, writeMilliseconds = 1e30, referenceMilliseconds = 1e30;
+		vector<uint32_t> order;
+		for (uint32_t run = 0; run < RUNS; ++run)
+		{
+			Timer timer;
+			AddDraws(batcher, draws);
+			addMilliseconds = std::min(addMilliseconds, timer.Milliseconds());
+			timer.Restart();
+			batcher.Build();
+			buildMilliseconds = std::min(buildMilliseconds, timer.Milliseconds());
+			timer.Restart();
+			batcher.WriteInstances(&written.data()->data);
+			writeMilliseconds = std::min(writeMilliseconds, timer.Milliseconds());
+			timer.Restart();
+			order = SortReference(draws);
+			referenceMilliseconds = std::min(referenceMilliseconds, timer.Milliseconds());
+		}
+
+		const uint32_t mismatches = CompareWithReference(batcher, draws, order, &written.data()->data);
+		check(mismatches == 0, "%u instances: %u mismatches with the reference", count, mismatches);
+		printf("%u instances in %zu batches\n", count, batcher.GetBatches().size());
+		printf("  add        %8.3f ms\n", addMilliseconds);
+		printf("  build      %8.3f ms, %6.1f M instances/s\n", buildMilliseconds, count / (buildMilliseconds * 1000.0));
+		printf("  write      %8.3f ms, %6.2f GB/s\n", writeMilliseconds, count * sizeof(InstanceData) / (writeMilliseconds * 1e6));
+		printf("  stable_sort %7.3f ms for the same order\n", referenceMilliseconds);
+	}
+	return check.Result();
+}
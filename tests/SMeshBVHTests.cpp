@@ -0,0 +1,471 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SMeshBVH.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	float Random(std::mt19937& generator, float low, float high)
+	{
+		return low + (high - low) * ((generator() >> 8) * (1.0f / 16777216.0f));
+	}
+
+	// A sphere in two sections over the same vertices above a terrain in a third with its own base vertex
+	struct Scene
+	{
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+		XMFLOAT3 boundsMin;
+		XMFLOAT3 boundsMax;
+	};
+
+	Scene MakeScene(uint32_t subdivisions)
+	{
+		const Tests::IndexedMesh sphere = Tests::MakeCubeSphere(subdivisions);
+		Tests::IndexedMesh terrain = Tests::MakeTerrain(subdivisions * 2);
+		for (size_t v = 0; v < terrain.GetVertexCount(); ++v)
+		{
+			terrain.positions[v * 3] = terrain.positions[v * 3] * 4.0f - 2.0f;
+			terrain.positions[v * 3 + 1] = terrain.positions[v * 3 + 1] * 4.0f - 2.0f;
+			terrain.positions[v * 3 + 2] -= 1.5f;
+		}
+
+		Scene scene;
+		scene.vertices = Tests::MakeVertices(sphere);
+		const vector<SVertex> terrainVertices = Tests::MakeVertices(terrain);
+		scene.vertices.insert(scene.vertices.end(), terrainVertices.begin(), terrainVertices.end());
+		scene.indices = sphere.indices;
+		scene.indices.insert(scene.indices.end(), terrain.indices.begin(), terrain.indices.end());
+		const uint32_t half = (uint32_t)sphere.indices.size() / 6 * 3;
+		scene.sections = {
+			{ half, 0, 0 },
+			{ (uint32_t)sphere.indices.size() - half, half, 0 },
+			{ (uint32_t)terrain.indices.size(), (uint32_t)sphere.indices.size(), (uint32_t)sphere.GetVertexCount() },
+		};
+		scene.boundsMin = XMFLOAT3(-2.0f, -2.0f, -1.5f);
+		scene.boundsMax = XMFLOAT3(2.0f, 2.0f, 1.0f);
+		return scene;
+	}
+
+	// Rays from a sphere around the scene towards random points inside its bounds, as in picking and occlusion queries
+	vector<SRay> MakeRandomRays(const Scene& scene, uint32_t count, uint32_t seed)
+	{
+		std::mt19937 generator(seed);
+		vector<SRay> rays(count);
+		for (SRay& ray : rays)
+		{
+			XMVECTOR direction;
+			do
+				direction = XMVectorSet(Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f), 0.0f);
+			while (XMVectorGetX(XMVector3LengthSq(direction)) < 0.01f);
+			const XMVECTOR origin = XMVectorScale(XMVector3Normalize(direction), 6.0f);
+			const XMVECTOR target = XMVectorSet(Random(generator, scene.boundsMin.x, scene.boundsMax.x),
+				Random(generator, scene.boundsMin.y, scene.boundsMax.y), Random(generator, scene.boundsMin.z, scene.boundsMax.z), 0.0f);
+			XMStoreFloat3(&ray.origin, origin);
+			XMStoreFloat3(&ray.direction, XMVectorSubtract(target, origin));
+		}
+		return rays;
+	}
+
+	// Pinhole camera rays looking down at the scene, row by row in 2 x 2 pixel packets
+	vector<SRay> MakeCameraRays(uint32_t width, uint32_t height)
+	{
+		vector<SRay> rays;
+		rays.reserve(width * height);
+		const XMFLOAT3 eye(0.3f, -3.5f, 3.0f);
+		for (uint32_t y = 0; y < height; y += 2)
+		{
+			for (uint32_t x = 0; x < width; x += 2)
+			{
+				for (uint32_t i = 0; i < 4; ++i)
+				{
+					const float u = ((x + (i & 1)) + 0.5f) / width * 2.0f - 1.0f;
+					const float v = ((y + (i >> 1)) + 0.5f) / height * 2.0f - 1.0f;
+					SRay ray;
+					ray.origin = eye;
+					ray.direction = XMFLOAT3(u * 0.45f, 1.0f, v * 0.6f - 1.45f);
+					rays.push_back(ray);
+				}
+			}
+		}
+		return rays;
+	}
+
+	// A closest hit reduced to what two intersectors have to agree on
+	struct Hit
+	{
+		bool found = false;
+		double t = DBL_MAX;
+		double margin = 0.0;       // Smallest barycentric coordinate, how far inside its triangle the hit is
+		double uncertainty = 0.0;  // How far float rounding can move the barycentrics
+	};
+
+	// Moeller-Trumbore gets the barycentrics as differences of products of the ray's origin and direction with the
+	// edges, divided by the determinant. Rounding those products moves them by about this much, more the further
+	// away the triangle is, the smaller it is, and the more the ray grazes it.
+	double GetUncertainty(const SRay& ray, const XMFLOAT3& p0, const XMFLOAT3& p1, const XMFLOAT3& p2)
+	{
+		const XMVECTOR v0 = XMLoadFloat3(&p0);
+		const XMVECTOR e1 = XMVectorSubtract(XMLoadFloat3(&p1), v0);
+		const XMVECTOR e2 = XMVectorSubtract(XMLoadFloat3(&p2), v0);
+		const XMVECTOR d = XMLoadFloat3(&ray.direction);
+		const float det = fabsf(XMVectorGetX(XMVector3Dot(e1, XMVector3Cross(d, e2))));
+		const float distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&ray.origin), v0)));
+		const float edge = std::max(XMVectorGetX(XMVector3Length(e1)), XMVectorGetX(XMVector3Length(e2)));
+		return 16.0 * FLT_EPSILON * distance * XMVectorGetX(XMVector3Length(d)) * edge / det;
+	}
+
+	// Corners of the triangle [hit] names, false if there is no such triangle
+	bool GetTriangle(const Scene& scene, const SRayHit& hit, XMFLOAT3& p0, XMFLOAT3& p1, XMFLOAT3& p2)
+	{
+		if (hit.section >= scene.sections.size() || (hit.triangle + 1) * 3 > scene.sections[hit.section].indexCount)
+			return false;
+		const SMeshSection& section = scene.sections[hit.section];
+		const uint32_t* tri = &scene.indices[section.startIndexLocation + hit.triangle * 3];
+		p0 = scene.vertices[section.baseVertexLocation + tri[0]].position;
+		p1 = scene.vertices[section.baseVertexLocation + tri[1]].position;
+		p2 = scene.vertices[section.baseVertexLocation + tri[2]].position;
+		return true;
+	}
+
+	Hit ToHit(const Scene& scene, const SRay& ray, bool found, const SRayHit& hit)
+	{
+		Hit result;
+		XMFLOAT3 p0, p1, p2;
+		if (found && GetTriangle(scene, hit, p0, p1, p2))
+		{
+			result.found = true;
+			result.t = hit.t;
+			result.margin = std::min({ (double)hit.u, (double)hit.v, 1.0 - hit.u - hit.v });
+			result.uncertainty = GetUncertainty(ray, p0, p1, p2);
+		}
+		return result;
+	}
+
+	// Brute force closest hit over every triangle of the scene, in double precision
+	Hit IntersectReference(const Scene& scene, const SRay& ray)
+	{
+		const double o[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+		const double d[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+		Hit closest;
+		for (const SMeshSection& section : scene.sections)
+		{
+			for (uint32_t i = 0; i < section.indexCount; i += 3)
+			{
+				const uint32_t* tri = &scene.indices[section.startIndexLocation + i];
+				const XMFLOAT3& p0 = scene.vertices[section.baseVertexLocation + tri[0]].position;
+				const XMFLOAT3& p1 = scene.vertices[section.baseVertexLocation + tri[1]].position;
+				const XMFLOAT3& p2 = scene.vertices[section.baseVertexLocation + tri[2]].position;
+				const double e1[3] = { (double)p1.x - p0.x, (double)p1.y - p0.y, (double)p1.z - p0.z };
+				const double e2[3] = { (double)p2.x - p0.x, (double)p2.y - p0.y, (double)p2.z - p0.z };
+				const double s[3] = { o[0] - p0.x, o[1] - p0.y, o[2] - p0.z };
+				const double p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+				const double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+				const double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+				if (det == 0.0)
+					continue;
+				const double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) / det;
+				const double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) / det;
+				const double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+				if (u < 0.0 || v < 0.0 || u + v > 1.0 || t < ray.tMin || t > ray.tMax || t >= closest.t)
+					continue;
+				closest.found = true;
+				closest.t = t;
+				closest.margin = std::min({ u, v, 1.0 - u - v });
+				closest.uncertainty = GetUncertainty(ray, p0, p1, p2);
+			}
+		}
+		return closest;
+	}
+
+	// Whether [a] and [b] found the same closest hit, or differ only where rounding can put the nearer one of them
+	// on either side of an edge
+	bool Agree(const Hit& a, const Hit& b)
+	{
+		if (!a.found && !b.found)
+			return true;
+		if (a.found && b.found && fabs(a.t - b.t) <= 1e-4 * std::max(1.0, a.t))
+			return true;
+		const Hit& nearer = a.t < b.t ? a : b;
+		return nearer.margin < nearer.uncertainty;
+	}
+
+	// Distance between the hit point along the ray and the point the hit's section, triangle and barycentrics name
+	double GetHitPointError(const Scene& scene, const SRay& ray, const SRayHit& hit)
+	{
+		XMFLOAT3 p0, p1, p2;
+		if (!GetTriangle(scene, hit, p0, p1, p2))
+			return DBL_MAX;
+		const double w = 1.0 - hit.u - hit.v;
+		const double dx = w * p0.x + hit.u * p1.x + hit.v * p2.x - (ray.origin.x + (double)hit.t * ray.direction.x);
+		const double dy = w * p0.y + hit.u * p1.y + hit.v * p2.y - (ray.origin.y + (double)hit.t * ray.direction.y);
+		const double dz = w * p0.z + hit.u * p1.z + hit.v * p2.z - (ray.origin.z + (double)hit.t * ray.direction.z);
+		return sqrt(dx * dx + dy * dy + dz * dz);
+	}
+
+	struct Disagreements
+	{
+		uint32_t closest = 0;
+		uint32_t packet = 0;
+		uint32_t anyHit = 0;
+		uint32_t hitPoint = 0;
+		uint32_t hits = 0;
+		uint32_t uncertain = 0;  // Reference hits rounding could move off their triangle
+	};
+
+	// Intersect, Intersect4 and Occluded on every ray against the brute force reference
+	Disagreements CompareWithReference(const SMeshBVH& bvh, const Scene& scene, const vector<SRay>& rays)
+	{
+		Disagreements result;
+		for (size_t i = 0; i < rays.size(); i += 4)
+		{
+			SRayHit packet[4];
+			bvh.Intersect4(&rays[i], packet);
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				const SRay& ray = rays[i + lane];
+				const Hit expected = IntersectReference(scene, ray);
+				SRayHit hit;
+				const bool found = bvh.Intersect(ray, hit);
+				result.hits += expected.found;
+				result.uncertain += expected.found && expected.margin < expected.uncertainty;
+				result.closest += !Agree(ToHit(scene, ray, found, hit), expected);
+				result.packet += !Agree(ToHit(scene, ray, packet[lane].section != UINT32_MAX, packet[lane]), expected);
+				result.anyHit += bvh.Occluded(ray) != found;
+				result.hitPoint += found && GetHitPointError(scene, ray, hit) > 1e-4;
+				result.hitPoint += packet[lane].section != UINT32_MAX && GetHitPointError(scene, ray, packet[lane]) > 1e-4;
+			}
+		}
+		return result;
+	}
+}
+
+// D3D12EngineTests bvh
+// Closest hits of Intersect and Intersect4 and the any hits of Occluded against a brute force double precision
+// reference, on incoherent rays, camera rays, rays from inside a closed mesh, axis aligned rays and rays limited
+// by tMin and tMax; section and triangle numbers of the hits; an empty BVH; triangles with equal centroids; and
+// that 16 bit indices build the same tree.
+int Tests::TestBVH(int, char**)
+{
+	Checker check("bvh");
+
+	const Scene scene = MakeScene(12);
+	SMeshBVH bvh;
+	bvh.Build(scene.vertices.data(), scene.indices.data(), scene.sections.data(), scene.sections.size());
+	check(bvh.GetTriangles().size() == scene.indices.size() / 3, "%zu of %zu triangles in the BVH", bvh.GetTriangles().size(), scene.indices.size() / 3);
+
+	// 16 bit indices, as mapped from a .smesh cache, give the same tree
+	{
+		const vector<uint16_t> shortIndices(scene.indices.begin(), scene.indices.end());
+		SMeshBVH shortBVH;
+		shortBVH.Build(scene.vertices.data(), shortIndices.data(), scene.sections.data(), scene.sections.size());
+		const bool sameNodes = shortBVH.GetNodes().size() == bvh.GetNodes().size()
+			&& memcmp(shortBVH.GetNodes().data(), bvh.GetNodes().data(), bvh.GetNodes().size() * sizeof(SBVHNode)) == 0;
+		const bool sameTriangles = shortBVH.GetTriangles().size() == bvh.GetTriangles().size()
+			&& memcmp(shortBVH.GetTriangles().data(), bvh.GetTriangles().data(), bvh.GetTriangles().size() * sizeof(SMeshBVH::Triangle)) == 0;
+		check(sameNodes && sameTriangles, "16 bit indices give a different tree");
+	}
+
+	// Every node's bounds contain its children's, every triangle is in exactly one leaf
+	{
+		const vector<SBVHNode>& nodes = bvh.GetNodes();
+		vector<uint32_t> leafCount(bvh.GetTriangles().size(), 0);
+		uint32_t badBounds = 0;
+		auto contains = [](const SBVHNode& outer, const XMFLOAT3& p)
+		{
+			return p.x >= outer.boundsMin.x && p.y >= outer.boundsMin.y && p.z >= outer.boundsMin.z &&
+				p.x <= outer.boundsMax.x && p.y <= outer.boundsMax.y && p.z <= outer.boundsMax.z;
+		};
+		for (const SBVHNode& node : nodes)
+		{
+			if (node.count == 0)
+			{
+				for (uint32_t c = 0; c < 2; ++c)
+					badBounds += !contains(node, nodes[node.leftOrFirst + c].boundsMin) || !contains(node, nodes[node.leftOrFirst + c].boundsMax);
+				continue;
+			}
+			for (uint32_t i = node.leftOrFirst; i < node.leftOrFirst + node.count; ++i)
+			{
+				const SMeshBVH::Triangle& tri = bvh.GetTriangles()[i];
+				++leafCount[i];
+				const XMFLOAT3 p1(tri.v0.x + tri.e1.x, tri.v0.y + tri.e1.y, tri.v0.z + tri.e1.z);
+				const XMFLOAT3 p2(tri.v0.x + tri.e2.x, tri.v0.y + tri.e2.y, tri.v0.z + tri.e2.z);
+				badBounds += !contains(node, tri.v0) || !contains(node, p1) || !contains(node, p2);
+			}
+		}
+		const size_t misplaced = std::count_if(leafCount.begin(), leafCount.end(), [](uint32_t count) { return count != 1; });
+		check(badBounds == 0 && misplaced == 0, "tree: %u bounds don't contain their contents, %zu triangles aren't in exactly one leaf", badBounds, misplaced);
+	}
+
+	auto compare = [&](const char* name, const vector<SRay>& rays, uint32_t minHits)
+	{
+		const Disagreements d = CompareWithReference(bvh, scene, rays);
+		check(d.closest == 0 && d.packet == 0 && d.anyHit == 0, "%s rays: Intersect, Intersect4 and Occluded disagree with the reference on %u, %u and %u of %zu rays",
+			name, d.closest, d.packet, d.anyHit, rays.size());
+		check(d.hitPoint == 0, "%s rays: %u hits name a section, triangle or barycentrics away from the hit point", name, d.hitPoint);
+		check(d.hits >= minHits && d.uncertain * 20 < d.hits, "%s rays: only %u of %zu hit, %u of them too close to an edge to tell, the test doesn't cover much",
+			name, d.hits, rays.size(), d.uncertain);
+	};
+
+	const vector<SRay> randomRays = MakeRandomRays(scene, 2048, 1);
+	compare("random", randomRays, 1024);
+	const vector<SRay> cameraRays = MakeCameraRays(32, 32);
+	compare("camera", cameraRays, 512);
+
+	// From the sphere's center every ray has to leave through it
+	{
+		vector<SRay> rays = MakeRandomRays(scene, 512, 2);
+		for (SRay& ray : rays)
+		{
+			ray.direction = XMFLOAT3(-ray.origin.x, -ray.origin.y, -ray.origin.z);
+			ray.origin = XMFLOAT3(0.0f, 0.0f, 0.0f);
+		}
+		compare("inside", rays, 512);
+	}
+
+	// Straight down onto the terrain, with direction components of zero
+	{
+		std::mt19937 generator(3);
+		vector<SRay> rays(512);
+		for (SRay& ray : rays)
+		{
+			ray.origin = XMFLOAT3(Random(generator, -1.9f, 1.9f), Random(generator, -1.9f, 1.9f), 3.0f);
+			ray.direction = XMFLOAT3(0.0f, 0.0f, -1.0f);
+		}
+		compare("axis aligned", rays, 512);
+	}
+
+	// Limited to past the first hit, or to before it
+	{
+		vector<SRay> rays = randomRays;
+		uint32_t hits = 0;
+		for (size_t i = 0; i < rays.size(); ++i)
+		{
+			const Hit first = IntersectReference(scene, rays[i]);
+			if (!first.found)
+				continue;
+			++hits;
+			if (i & 1)
+				rays[i].tMin = (float)first.t * 1.001f;
+			else
+				rays[i].tMax = (float)first.t * 0.999f;
+		}
+		compare("limited", rays, hits / 8);
+	}
+
+	// Nothing to hit
+	{
+		SMeshBVH empty;
+		empty.Build(scene.vertices.data(), scene.indices.data(), nullptr, 0);
+		SRayHit hits[4];
+		SRayHit hit;
+		empty.Intersect4(&cameraRays[0], hits);
+		const bool found = empty.Intersect(cameraRays[0], hit) || empty.Occluded(cameraRays[0]);
+		const bool packetFound = std::any_of(hits, hits + 4, [](const SRayHit& h) { return h.section != UINT32_MAX; });
+		check(empty.Empty() && !found && !packetFound, "empty: a BVH without triangles has %zu nodes and reports hits", empty.GetNodes().size());
+	}
+
+	// Copies of one triangle can't be split by their centroids
+	{
+		const vector<SVertex> vertices = { SVertex{ XMFLOAT3(0, 0, 0) }, SVertex{ XMFLOAT3(1, 0, 0) }, SVertex{ XMFLOAT3(0, 1, 0) } };
+		vector<uint32_t> indices;
+		for (uint32_t i = 0; i < 100; ++i)
+			indices.insert(indices.end(), { 0, 1, 2 });
+		const SMeshSection section = { (uint32_t)indices.size(), 0, 0 };
+		SMeshBVH stacked;
+		stacked.Build(vertices.data(), indices.data(), &section, 1);
+		uint32_t largestLeaf = 0;
+		for (const SBVHNode& node : stacked.GetNodes())
+			largestLeaf = std::max(largestLeaf, node.count);
+
+		SRay ray;
+		ray.origin = XMFLOAT3(0.25f, 0.25f, 1.0f);
+		ray.direction = XMFLOAT3(0.0f, 0.0f, -1.0f);
+		SRayHit hit;
+		const bool found = stacked.Intersect(ray, hit);
+		check(largestLeaf <= SMeshBVH::MAX_LEAF_SIZE && found && hit.t == 1.0f && hit.triangle < 100,
+			"equal centroids: leaves of up to %u triangles, hit %d at t %f", largestLeaf, found, hit.t);
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests bvhbench [<subdivisions>] [<rays>]
+// Builds the BVH of a cube sphere of [subdivisions] quads per cube edge (400 by default) above a terrain, 3.2M
+// triangles, and measures closest hit, any hit and 4-ray packets on incoherent rays and on camera rays, best of 3.
+// Fails if Intersect4 or Occluded disagree with Intersect.
+int Tests::BenchmarkBVH(int argc, char** argv)
+{
+	Checker check("bvhbench");
+	const uint32_t subdivisions = argc > 0 ? (uint32_t)atoi(argv[0]) : 400;
+	const uint32_t rayCount = (argc > 1 ? (uint32_t)std::max(4, atoi(argv[1])) : 1 << 20) & ~3u;
+	if (!check(subdivisions > 0, "invalid subdivision count %s", argc > 0 ? argv[0] : ""))
+		return check.Result();
+
+	const Scene scene = MakeScene(subdivisions);
+	const size_t triangleCount = scene.indices.size() / 3;
+	SMeshBVH bvh;
+	double buildMilliseconds = 1e30;
+	for (uint32_t run = 0; run < 3; ++run)
+	{
+		Timer timer;
+		bvh.Build(scene.vertices.data(), scene.indices.data(), scene.sections.data(), scene.sections.size());
+		buildMilliseconds = std::min(buildMilliseconds, timer.Milliseconds());
+	}
+	printf("%zu triangles, %zu nodes\n", triangleCount, bvh.GetNodes().size());
+	printf("  build        %8.2f ms, %6.2f M triangles/s\n", buildMilliseconds, triangleCount / (buildMilliseconds * 1000.0));
+
+	const uint32_t side = (uint32_t)sqrt((double)rayCount) & ~1u;
+	const vector<SRay> rayKinds[2] = { MakeRandomRays(scene, rayCount, 1), MakeCameraRays(side, side) };
+	const char* kindNames[2] = { "random", "camera" };
+	for (uint32_t kind = 0; kind < 2; ++kind)
+	{
+		const vector<SRay>& rays = rayKinds[kind];
+		vector<SRayHit> closest(rays.size()), packets(rays.size());
+		vector<uint8_t> closestFound(rays.size()), occluded(rays.size());
+		double milliseconds[3] = { 1e30, 1e30, 1e30 };
+		for (uint32_t run = 0; run < 3; ++run)
+		{
+			Timer timer;
+			for (size_t i = 0; i < rays.size(); ++i)
+				closestFound[i] = bvh.Intersect(rays[i], closest[i]);
+			milliseconds[0] = std::min(milliseconds[0], timer.Milliseconds());
+			timer.Restart();
+			for (size_t i = 0; i < rays.size(); ++i)
+				occluded[i] = bvh.Occluded(rays[i]);
+			milliseconds[1] = std::min(milliseconds[1], timer.Milliseconds());
+			timer.Restart();
+			for (size_t i = 0; i < rays.size(); i += 4)
+				bvh.Intersect4(&rays[i], &packets[i]);
+			milliseconds[2] = std::min(milliseconds[2], timer.Milliseconds());
+		}
+
+		uint32_t hits = 0, packetDisagreements = 0, anyHitDisagreements = 0;
+		for (size_t i = 0; i < rays.size(); ++i)
+		{
+			hits += closestFound[i];
+			packetDisagreements += !Agree(ToHit(scene, rays[i], packets[i].section != UINT32_MAX, packets[i]), ToHit(scene, rays[i], closestFound[i], closest[i]));
+			anyHitDisagreements += occluded[i] != closestFound[i];
+		}
+		check(packetDisagreements == 0 && anyHitDisagreements == 0, "%s rays: Intersect4 and Occluded disagree with Intersect on %u and %u of %zu rays",
+			kindNames[kind], packetDisagreements, anyHitDisagreements, rays.size());
+
+		printf("  %s rays, %zu, %.1f%% hit\n", kindNames[kind], rays.size(), 100.0 * hits / rays.size());
+		const char* queryNames[3] = { "closest hit", "any hit", "packet" };
+		for (uint32_t query = 0; query < 3; ++query)
+			printf("    %-11s %8.2f ms, %6.2f M rays/s\n", queryNames[query], milliseconds[query], rays.size() / (milliseconds[query] * 1000.0));
+	}
+	return check.Result();
+}
@@ -0,0 +1,419 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "FileHash.h"
+#include "SGLTFReader.h"
+#include "SMeshCache.h"
+#include "SMeshCook.h"
+#include "SMeshTangents.h"
+#include "SMeshWeld.h"
+#include "SObjReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace
+{
+	constexpr uint64_t SOURCE_HASH = 0x0123456789ABCDEFull;
+
+	// A mesh in one section with one LOD over the first half of its triangles
+	struct CacheContent
+	{
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+		vector<SMeshLOD> lods;
+		vector<uint32_t> lodOffsets;
+		vector<SMeshSectionBounds> sectionBounds;
+
+		explicit CacheContent(const Tests::IndexedMesh& mesh)
+			: vertices(Tests::MakeVertices(mesh)), indices(mesh.indices)
+		{
+			const uint32_t lodIndexCount = (uint32_t)indices.size() / 6 * 3;
+			sections = { { (uint32_t)indices.size(), 0, 0 } };
+			lods = { { lodIndexCount, (uint32_t)indices.size(), 0.01f } };
+			indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.begin() + lodIndexCount);
+			lodOffsets = { 0, 1 };
+			sectionBounds.resize(1);
+		}
+
+		SMeshCache::View GetView() const
+		{
+			SMeshCache::View view;
+			view.vertices = vertices.data();
+			view.vertexCount = vertices.size();
+			view.indices = indices.data();
+			view.indexCount = indices.size();
+			view.sections = sections.data();
+			view.sectionCount = sections.size();
+			view.lods = lods.data();
+			view.lodCount = lods.size();
+			view.lodOffsets = lodOffsets.data();
+			view.lodOffsetCount = lodOffsets.size();
+			view.sectionBounds = sectionBounds.data();
+			return view;
+		}
+	};
+
+	// Whether [view] holds exactly [expected]'s indices, in whatever width it stores them
+	bool SameIndices(const SMeshCache::View& view, const vector<uint32_t>& expected)
+	{
+		if (view.indexCount != expected.size())
+			return false;
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			const uint32_t index = view.indexSize == sizeof(uint16_t) ? ((const uint16_t*)view.indices)[i] : ((const uint32_t*)view.indices)[i];
+			if (index != expected[i])
+				return false;
+		}
+		return true;
+	}
+
+	string ReadFile(const string& path)
+	{
+		MappedFile file;
+		return file.Open(path.c_str()) ? string((const char*)file.data(), (size_t)file.size()) : string();
+	}
+
+	// Validates a copy of [bytes] after [patch] changed it, false if the copy can't be written
+	template<typename Patch>
+	bool ValidatePatched(const string& bytes, const string& path, Patch&& patch)
+	{
+		string patched = bytes;
+		patch(patched);
+		if (!Tests::WriteTextFile(path, patched))
+			return false;
+		MappedFile file;
+		SMeshCache::View view;
+		return file.Open(path.c_str()) && SMeshCache::Validate(file, SOURCE_HASH, view);
+	}
+
+	// Sets index [i] of a 16 bit cache to its vertex count, one past the last vertex
+	void PatchIndexPastVertices(string& bytes, uint32_t i)
+	{
+		SMeshCache::Header header;
+		memcpy(&header, bytes.data(), sizeof(header));
+		const uint16_t index = (uint16_t)(header.chunks[SMeshCache::CHUNK_VERTICES].size / header.vertexStride);
+		memcpy(&bytes[header.chunks[SMeshCache::CHUNK_INDICES].offset + i * sizeof(index)], &index, sizeof(index));
+	}
+
+	// A triangle whose positions and indices live in [bufferURI], next to the .gltf
+	string MakeExternalGLTF(const char* bufferURI)
+	{
+		return string(R"({
+"asset": { "version": "2.0" },
+"buffers": [ { "byteLength": 42, "uri": ")") + bufferURI + R"(" } ],
+"bufferViews": [ { "buffer": 0, "byteOffset": 0, "byteLength": 36 }, { "buffer": 0, "byteOffset": 36, "byteLength": 6 } ],
+"accessors": [
+	{ "bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [ 0, 0, 0 ], "max": [ 2, 2, 0 ] },
+	{ "bufferView": 1, "componentType": 5123, "count": 3, "type": "SCALAR" }
+],
+"meshes": [ { "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 } ] } ]
+})";
+	}
+
+	string MakeTriangleBuffer(float x)
+	{
+		const float positions[9] = { 0, 0, 0, x, 0, 0, 0, 1, 0 };
+		const uint16_t indices[3] = { 0, 1, 2 };
+		return string((const char*)positions, sizeof(positions)) + string((const char*)indices, sizeof(indices));
+	}
+
+	// What SMesh::Load does with the cache of a glTF file, without the processing passes: serves it from [cachePath]
+	// if that validates against SMeshCache::HashSource, otherwise reads the source and writes the cache. False if
+	// neither works; [outRebuilt] tells which path was taken.
+	bool LoadThroughCache(const string& source, const string& cachePath, vector<SVertex>& outVertices, bool& outRebuilt)
+	{
+		const uint64_t sourceHash = SMeshCache::HashSource(source.c_str());
+		if (sourceHash == 0)
+			return false;
+		{
+			MappedFile file;
+			SMeshCache::View view;
+			outRebuilt = !file.Open(cachePath.c_str()) || !SMeshCache::Validate(file, sourceHash, view);
+			if (!outRebuilt)
+			{
+				outVertices.assign(view.vertices, view.vertices + view.vertexCount);
+				return true;
+			}
+		}
+
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+		outVertices.clear();
+		if (!SGLTFReader::Append(source.c_str(), outVertices, indices, sections))
+			return false;
+		vector<SMeshSectionBounds> sectionBounds(sections.size());
+		SMeshCache::View view;
+		view.vertices = outVertices.data();
+		view.vertexCount = outVertices.size();
+		view.indices = indices.data();
+		view.indexCount = indices.size();
+		view.sections = sections.data();
+		view.sectionCount = sections.size();
+		view.sectionBounds = sectionBounds.data();
+		return SMeshCache::Write(cachePath.c_str(), sourceHash, view);
+	}
+}
+
+// D3D12EngineTests meshcache
+// .smesh round trips: indices that fit are stored in 16 bits, larger ones in 32, and a cache written from a mapped
+// 16 bit view stays 16 bit; the source hash is checked; corrupt headers, out of range sections and indices past the
+// vertices, in a section, in an LOD or through the base vertex, are rejected. A .gltf's cache is keyed on its buffer
+// files too, so editing only the .bin rebuilds it.
+int Tests::TestMeshCache(int, char**)
+{
+	Checker check("meshcache");
+
+	const string shortPath = GetTempPath("D3D12EngineTests_short.smesh");
+	const string longPath = GetTempPath("D3D12EngineTests_long.smesh");
+	const string rewrittenPath = GetTempPath("D3D12EngineTests_rewritten.smesh");
+	const string patchedPath = GetTempPath("D3D12EngineTests_patched.smesh");
+
+	// 1.5K vertices fit into 16 bits, 66K don't
+	const CacheContent small(MakeCubeSphere(16));
+	const CacheContent large(MakeTerrain(256));
+	check(SMeshCache::Write(shortPath.c_str(), SOURCE_HASH, small.GetView()), "writing %s failed", shortPath.c_str());
+	check(SMeshCache::Write(longPath.c_str(), SOURCE_HASH, large.GetView()), "writing %s failed", longPath.c_str());
+
+	{
+		MappedFile file;
+		SMeshCache::View view;
+		const bool valid = file.Open(shortPath.c_str()) && SMeshCache::Validate(file, SOURCE_HASH, view);
+		if (check(valid, "16 bit: the cache doesn't validate"))
+		{
+			check(view.indexSize == sizeof(uint16_t) && SameIndices(view, small.indices), "16 bit: stored as %u byte indices, equal: %d",
+				view.indexSize, SameIndices(view, small.indices));
+			check(view.vertexCount == small.vertices.size() && memcmp(view.vertices, small.vertices.data(), small.vertices.size() * sizeof(SVertex)) == 0,
+				"16 bit: vertices differ");
+			check(view.lodCount == 1 && view.lods[0].startIndexLocation == small.lods[0].startIndexLocation, "16 bit: LODs differ");
+
+			// Saving a mesh that is still served from its cache writes the mapped 16 bit indices as they are
+			check(SMeshCache::Write(rewrittenPath.c_str(), SOURCE_HASH, view), "writing %s failed", rewrittenPath.c_str());
+			check(ReadFile(rewrittenPath) == ReadFile(shortPath), "16 bit: rewriting a mapped cache changed it");
+		}
+	}
+
+	{
+		MappedFile file;
+		SMeshCache::View view;
+		const bool valid = file.Open(longPath.c_str()) && SMeshCache::Validate(file, SOURCE_HASH, view);
+		if (check(valid, "32 bit: the cache doesn't validate"))
+			check(view.indexSize == sizeof(uint32_t) && SameIndices(view, large.indices), "32 bit: stored as %u byte indices", view.indexSize);
+		check(!SMeshCache::Validate(file, SOURCE_HASH + 1, view), "32 bit: validates against another source");
+	}
+
+	const string bytes = ReadFile(shortPath);
+	check(ValidatePatched(bytes, patchedPath, [](string&) {}), "an unchanged copy doesn't validate");
+	check(!ValidatePatched(bytes, patchedPath, [](string& b) { b.resize(b.size() - 1); }), "a truncated cache validates");
+	check(!ValidatePatched(bytes, patchedPath, [](string& b)
+	{
+		SMeshCache::Header header;
+		memcpy(&header, b.data(), sizeof(header));
+		header.indexStride = 3;
+		memcpy(&b[0], &header, sizeof(header));
+	}), "a cache with 3 byte indices validates");
+	check(!ValidatePatched(bytes, patchedPath, [](string& b)
+	{
+		SMeshCache::Header header;
+		memcpy(&header, b.data(), sizeof(header));
+		SMeshSection section;
+		memcpy(&section, &b[header.chunks[SMeshCache::CHUNK_SECTIONS].offset], sizeof(section));
+		section.startIndexLocation = (uint32_t)(header.chunks[SMeshCache::CHUNK_INDICES].size / header.indexStride) - 3;
+		memcpy(&b[header.chunks[SMeshCache::CHUNK_SECTIONS].offset], &section, sizeof(section));
+	}), "a section past the end of the indices validates");
+
+	// The LOD's indices follow the section's, so the first one is only drawn by the LOD
+	const uint32_t lodStart = small.lods[0].startIndexLocation;
+	check(!ValidatePatched(bytes, patchedPath, [](string& b) { PatchIndexPastVertices(b, 5); }), "a section index past the vertices validates");
+	check(!ValidatePatched(bytes, patchedPath, [lodStart](string& b) { PatchIndexPastVertices(b, lodStart); }),
+		"an LOD index past the vertices validates");
+	const uint32_t maxIndex = *std::max_element(small.indices.begin(), small.indices.end());
+	const uint32_t vertexCount = (uint32_t)small.vertices.size();
+	check(!ValidatePatched(bytes, patchedPath, [maxIndex, vertexCount](string& b)
+	{
+		SMeshCache::Header header;
+		memcpy(&header, b.data(), sizeof(header));
+		SMeshSection section;
+		memcpy(&section, &b[header.chunks[SMeshCache::CHUNK_SECTIONS].offset], sizeof(section));
+		section.baseVertexLocation = vertexCount - maxIndex;
+		memcpy(&b[header.chunks[SMeshCache::CHUNK_SECTIONS].offset], &section, sizeof(section));
+	}), "a base vertex that moves the indices past the vertices validates");
+
+	// The buffer's URI is percent encoded, as cgltf_load_buffers decodes it
+	const string gltfPath = GetTempPath("D3D12EngineTests_external.gltf");
+	const string bufferPath = GetTempPath("D3D12EngineTests external.bin");
+	const string gltfCachePath = GetTempPath("D3D12EngineTests_external.gltf.smesh");
+	std::error_code error;
+	if (check(WriteTextFile(gltfPath, MakeExternalGLTF("D3D12EngineTests%20external.bin")) && WriteTextFile(bufferPath, MakeTriangleBuffer(1.0f)),
+		"writing %s failed", gltfPath.c_str()))
+	{
+		check(SMeshCache::HashSource(gltfPath.c_str()) != HashFile(gltfPath.c_str()), "glTF: the source hash leaves out the buffer");
+		vector<SVertex> vertices;
+		bool rebuilt = false;
+		check(LoadThroughCache(gltfPath, gltfCachePath, vertices, rebuilt) && rebuilt, "glTF: the first load doesn't write the cache");
+		check(LoadThroughCache(gltfPath, gltfCachePath, vertices, rebuilt) && !rebuilt, "glTF: an unchanged source isn't served from its cache");
+
+		// Only the buffer changes, the .gltf stays the same
+		check(WriteTextFile(bufferPath, MakeTriangleBuffer(2.0f)), "writing %s failed", bufferPath.c_str());
+		const bool loaded = LoadThroughCache(gltfPath, gltfCachePath, vertices, rebuilt);
+		check(loaded && rebuilt && vertices.size() == 3 && vertices[1].position.x == 2.0f, "glTF: editing the buffer doesn't rebuild the cache");
+		check(LoadThroughCache(gltfPath, gltfCachePath, vertices, rebuilt) && !rebuilt && vertices.size() == 3 && vertices[1].position.x == 2.0f,
+			"glTF: the rebuilt cache isn't served");
+
+		std::filesystem::remove(bufferPath, error);
+		check(SMeshCache::HashSource(gltfPath.c_str()) == 0, "glTF: a missing buffer still hashes");
+	}
+
+	for (const string& path : { shortPath, longPath, rewrittenPath, patchedPath, gltfPath, bufferPath, gltfCachePath })
+		std::filesystem::remove(path, error);
+	return check.Result();
+}
+
+// D3D12EngineTests meshcachebench [<obj or gltf>...]
+// Loads each mesh (a generated OBJ grid of about half a million triangles if none is given) the way SMesh::Load does
+// on a cache miss: parse, weld, tangents, SMeshCook's optimizer, LOD and bounds passes, then writes its .smesh cache
+// and times the hit that replaces all of it, mapping the cache and validating it (best of 10). Both paths hash the
+// source first to find the cache. Fails if the cache does not validate or holds another mesh than the one cooked.
+int Tests::BenchmarkMeshCache(int argc, char** argv)
+{
+	Checker check("meshcachebench");
+	vector<string> paths(argv, argv + argc);
+	const string generated = GetTempPath("D3D12EngineTests_meshcachebench.obj");
+	if (paths.empty())
+	{
+		if (!check(WriteTextFile(generated, MakeGridOBJ(512, 4)), "failed to write %s", generated.c_str()))
+			return check.Result();
+		paths.push_back(generated);
+	}
+
+	for (const string& path : paths)
+	{
+		Timer timer;
+		const uint64_t sourceHash = SMeshCache::HashSource(path.c_str());
+		const double hashMilliseconds = timer.Milliseconds();
+		if (!check(sourceHash != 0, "cannot read %s", path.c_str()))
+			continue;
+
+		// Indices in 16 bits while they fit, as SMesh keeps them
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<uint16_t> shortIndices;
+		vector<SMeshSection> sections;
+		double parseMilliseconds, weldMilliseconds = 0.0;
+		const string extension = std::filesystem::path(path).extension().string();
+		const bool gltf = extension == ".gltf" || extension == ".glb";
+		timer.Restart();
+		if (gltf)
+		{
+			if (!check(SGLTFReader::Append(path.c_str(), vertices, indices, shortIndices, sections), "SGLTFReader cannot read %s", path.c_str()))
+				continue;
+			parseMilliseconds = timer.Milliseconds();
+		}
+		else
+		{
+			SObjReader reader;
+			if (!check(reader.Parse(path.c_str()), "SObjReader cannot read %s (not a plain geometry file)", path.c_str()))
+				continue;
+			parseMilliseconds = timer.Milliseconds();
+			timer.Restart();
+			SMeshWeld::AppendOBJShapes(reader.GetAttrib(), reader.GetShapes(), vertices, indices, sections);
+			if (SMeshCache::FitsShortIndices(indices.data(), indices.size()))
+			{
+				shortIndices.assign(indices.begin(), indices.end());
+				indices.clear();
+			}
+			weldMilliseconds = timer.Milliseconds();
+		}
+
+		double tangentsMilliseconds, optimizeMilliseconds, lodMilliseconds, boundsMilliseconds;
+		vector<SMeshLOD> lods;
+		vector<uint32_t> lodOffsets;
+		SMeshCache::View cooked;
+		vector<SMeshSectionBounds> sectionBounds;
+		auto cook = [&](auto& cookIndices)
+		{
+			timer.Restart();
+			SMeshTangents::GenerateTangents(vertices.data(), vertices.size(), cookIndices.data(), sections.data(), sections.size());
+			tangentsMilliseconds = timer.Milliseconds();
+			timer.Restart();
+			SMeshCook::Optimize(vertices.data(), cookIndices.data(), sections.data(), sections.size());
+			optimizeMilliseconds = timer.Milliseconds();
+			timer.Restart();
+			SMeshCook::GenerateLODs(vertices.data(), cookIndices, sections.data(), sections.size(), MAX_LOD_COUNT, LOD_REDUCTION, lods, lodOffsets);
+			lodMilliseconds = timer.Milliseconds();
+			timer.Restart();
+			SMeshCook::ComputeBounds(vertices.data(), vertices.size(), cookIndices.data(), sections.data(), sections.size(),
+				cooked.boundsMin, cooked.boundsMax, sectionBounds);
+			boundsMilliseconds = timer.Milliseconds();
+
+			cooked.indices = cookIndices.data();
+			cooked.indexCount = cookIndices.size();
+			cooked.indexSize = sizeof(cookIndices[0]);
+		};
+		if (indices.empty())
+			cook(shortIndices);
+		else
+			cook(indices);
+		const double coldMilliseconds = hashMilliseconds + parseMilliseconds + weldMilliseconds + tangentsMilliseconds + optimizeMilliseconds +
+			lodMilliseconds + boundsMilliseconds;
+		const vector<uint32_t> cookedIndices = indices.empty() ? vector<uint32_t>(shortIndices.begin(), shortIndices.end()) : indices;
+
+		cooked.vertices = vertices.data();
+		cooked.vertexCount = vertices.size();
+		cooked.sections = sections.data();
+		cooked.sectionCount = sections.size();
+		cooked.lods = lods.data();
+		cooked.lodCount = lods.size();
+		cooked.lodOffsets = lodOffsets.data();
+		cooked.lodOffsetCount = lodOffsets.size();
+		cooked.sectionBounds = sectionBounds.data();
+		const string cachePath = GetTempPath("D3D12EngineTests_meshcachebench.smesh");
+		timer.Restart();
+		if (!check(SMeshCache::Write(cachePath.c_str(), sourceHash, cooked), "writing %s failed", cachePath.c_str()))
+			continue;
+		const double writeMilliseconds = timer.Milliseconds();
+
+		// The file was just written, so it is in the page cache as it is on every start after the first
+		double loadMilliseconds = 1e30;
+		uint64_t cacheSize = 0;
+		for (int run = 0; run < 10; ++run)
+		{
+			timer.Restart();
+			MappedFile file;
+			SMeshCache::View view;
+			const bool valid = file.Open(cachePath.c_str()) && SMeshCache::Validate(file, sourceHash, view);
+			loadMilliseconds = std::min(loadMilliseconds, timer.Milliseconds());
+			if (!check(valid, "%s: the cache doesn't validate", path.c_str()))
+				break;
+			cacheSize = file.size();
+			if (run == 0)
+			{
+				check(view.vertexCount == vertices.size() && memcmp(view.vertices, vertices.data(), vertices.size() * sizeof(SVertex)) == 0 &&
+					SameIndices(view, cookedIndices) && view.sectionCount == sections.size() && view.lodCount == lods.size(),
+					"%s: the cache holds another mesh than the one cooked", path.c_str());
+			}
+		}
+		std::error_code error;
+		std::filesystem::remove(cachePath, error);
+
+		size_t triangleCount = 0;
+		for (const SMeshSection& section : sections)
+			triangleCount += section.indexCount / 3;
+		printf("%s: %zu vertices, %zu triangles, %zu sections, %zu LODs, %u bit indices\n", path.c_str(), vertices.size(), triangleCount, sections.size(),
+			lods.size() - sections.size(), cooked.indexSize * 8);
+		printf("  cold  %10.2f ms: hash %.2f, parse %.2f, weld %.2f, tangents %.2f, optimize %.2f, LODs %.2f, bounds %.2f (write %.2f)\n",
+			coldMilliseconds, hashMilliseconds, parseMilliseconds, weldMilliseconds, tangentsMilliseconds, optimizeMilliseconds, lodMilliseconds,
+			boundsMilliseconds, writeMilliseconds);
+		printf("  cache %10.2f ms: hash %.2f, map and validate %.1f MB %.3f, %.0fx faster\n", hashMilliseconds + loadMilliseconds, hashMilliseconds,
+			cacheSize / 1048576.0, loadMilliseconds, coldMilliseconds / std::max(hashMilliseconds + loadMilliseconds, 1e-3));
+	}
+	remove(generated.c_str());
+	return check.Result();
+}
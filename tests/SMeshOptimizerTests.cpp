@@ -0,0 +1,287 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SMeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	struct TaggedVertex
+	{
+		float position[3];
+		uint32_t id;  // Original vertex index
+	};
+
+	vector<TaggedVertex> TagVertices(const Tests::IndexedMesh& mesh)
+	{
+		vector<TaggedVertex> vertices(mesh.GetVertexCount());
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			for (uint32_t c = 0; c < 3; ++c)
+				vertices[i].position[c] = mesh.positions[i * 3 + c];
+			vertices[i].id = (uint32_t)i;
+		}
+		return vertices;
+	}
+
+	float GetACMR(const vector<uint32_t>& indices, size_t vertexCount)
+	{
+		return SMeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertexCount).acmr;
+	}
+
+	// The three passes in the order SMesh::Optimize runs them
+	void OptimizeAll(const Tests::IndexedMesh& mesh, vector<uint32_t>& indices, vector<TaggedVertex>& vertices)
+	{
+		vector<uint32_t> clusters;
+		SMeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertices.size(), &clusters);
+		SMeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), mesh.positions.data(), sizeof(float) * 3, mesh.GetVertexCount(), clusters);
+		SMeshOptimizer::OptimizeVertexFetch(vertices.data(), sizeof(TaggedVertex), vertices.size(), indices.data(), indices.size());
+	}
+}
+
+// D3D12EngineTests optimizer
+// FIFO cache statistics of hand counted index buffers, then each pass on shuffled generated meshes: the triangles
+// and their winding survive, the ACMR and overdraw reach fixed bounds, and the vertex cache order matches golden
+// hashes, so any change to the output on any platform is caught. 16 bit indices give the same results.
+int Tests::TestOptimizer(int, char**)
+{
+	Checker check("optimizer");
+
+	// Hand counted cache misses
+	{
+		struct Case
+		{
+			vector<uint32_t> indices;
+			uint32_t vertexCount;
+			uint32_t cacheSize;
+			uint32_t transforms;
+		};
+		const Case cases[] = {
+			{ { 0, 1, 2 }, 3, 16, 3 },
+			{ { 0, 1, 2, 2, 1, 3 }, 4, 16, 4 },
+			// Unreferenced vertices do not count
+			{ { 0, 1, 2, 2, 1, 3 }, 10, 16, 4 },
+			// The second triangle evicts the whole cache
+			{ { 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 3, 9 },
+			{ { 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 16, 6 },
+			// A hit does not move 0 to the back as it would in an LRU cache, so the third triangle misses it
+			{ { 0, 1, 2, 0, 3, 4, 0, 5, 6 }, 7, 4, 8 },
+		};
+		for (size_t i = 0; i < std::size(cases); ++i)
+		{
+			const Case& c = cases[i];
+			const SMeshOptimizer::VertexCacheStatistics statistics =
+				SMeshOptimizer::AnalyzeVertexCache(c.indices.data(), c.indices.size(), c.vertexCount, c.cacheSize);
+			const uint32_t triangleCount = (uint32_t)c.indices.size() / 3;
+			uint32_t referenced = 0;
+			for (uint32_t v = 0; v < c.vertexCount; ++v)
+				referenced += std::find(c.indices.begin(), c.indices.end(), v) != c.indices.end();
+			check(statistics.vertexTransforms == c.transforms && statistics.triangleCount == triangleCount && statistics.vertexCount == referenced,
+				"case %zu: %u transforms of %u vertices and %u triangles, expected %u, %u and %u", i,
+				statistics.vertexTransforms, statistics.vertexCount, statistics.triangleCount, c.transforms, referenced, triangleCount);
+			check(statistics.acmr == (float)c.transforms / triangleCount && statistics.atvr == (float)c.transforms / referenced,
+				"case %zu: ACMR %.3f, ATVR %.3f", i, statistics.acmr, statistics.atvr);
+		}
+	}
+
+	// Vertex cache order: triangles kept, a fixed ACMR bound and the same order every time
+	struct Input
+	{
+		const char* name;
+		IndexedMesh mesh;
+		float maxACMR;
+		uint64_t hash;
+	};
+	Input inputs[] = {
+		{ "cube sphere", MakeCubeSphere(32), 0.70f, 0xda6fc87b6f46d605ull },
+		{ "terrain", MakeTerrain(64), 0.70f, 0xabe282d06ff56d05ull },
+	};
+	for (Input& input : inputs)
+	{
+		vector<uint32_t> shuffled = input.mesh.indices;
+		ShuffleTriangles(shuffled, 1);
+		const vector<uint32_t> expectedTriangles = GetCanonicalTriangles(shuffled.data(), shuffled.size());
+		const size_t vertexCount = input.mesh.GetVertexCount();
+
+		vector<uint32_t> indices = shuffled;
+		SMeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertexCount);
+		check(GetCanonicalTriangles(indices.data(), indices.size()) == expectedTriangles, "%s: the vertex cache order changed the triangles", input.name);
+		const float before = GetACMR(shuffled, vertexCount), after = GetACMR(indices, vertexCount);
+		check(after <= input.maxACMR, "%s: ACMR %.3f after the vertex cache order, more than %.2f (%.3f before)", input.name, after, input.maxACMR, before);
+
+		vector<uint32_t> again = shuffled;
+		SMeshOptimizer::OptimizeVertexCache(again.data(), again.size(), vertexCount);
+		check(again == indices, "%s: the vertex cache order differs between two runs", input.name);
+		const uint64_t hash = HashIndices(indices.data(), indices.size());
+		check(hash == input.hash, "%s: the vertex cache order hashes to 0x%016llx instead of 0x%016llx", input.name,
+			(unsigned long long)hash, (unsigned long long)input.hash);
+	}
+
+	// Overdraw: an inner sphere drawn before the outer one that hides it, which the pass has to draw first
+	{
+		IndexedMesh mesh = MakeCubeSphere(24, 0.5f);
+		mesh.Append(MakeCubeSphere(24, 1.0f));
+		const size_t vertexCount = mesh.GetVertexCount();
+		const vector<uint32_t> expectedTriangles = GetCanonicalTriangles(mesh.indices.data(), mesh.indices.size());
+
+		vector<uint32_t> indices = mesh.indices;
+		vector<uint32_t> clusters;
+		SMeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertexCount, &clusters);
+		const float cacheACMR = GetACMR(indices, vertexCount);
+		const float before = MeasureOverdraw(mesh.positions.data(), indices.data(), indices.size());
+
+		SMeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), mesh.positions.data(), sizeof(float) * 3, vertexCount, clusters);
+		const float after = MeasureOverdraw(mesh.positions.data(), indices.data(), indices.size());
+		const float acmr = GetACMR(indices, vertexCount);
+		check(GetCanonicalTriangles(indices.data(), indices.size()) == expectedTriangles, "nested spheres: the overdraw order changed the triangles");
+		check(before > 1.2f, "nested spheres: overdraw %.3f before the overdraw order, the inner sphere should be drawn first", before);
+		check(after < 1.02f, "nested spheres: overdraw %.3f after the overdraw order (%.3f before)", after, before);
+		// The threshold bounds each cluster with a flushed cache; the reuse between neighbouring clusters that the new
+		// order loses is on top of it
+		check(acmr <= cacheACMR * 1.1f, "nested spheres: ACMR %.3f after the overdraw order, %.3f before", acmr, cacheACMR);
+
+		vector<uint32_t> again = mesh.indices;
+		clusters.clear();
+		SMeshOptimizer::OptimizeVertexCache(again.data(), again.size(), vertexCount, &clusters);
+		SMeshOptimizer::OptimizeOverdraw(again.data(), again.size(), mesh.positions.data(), sizeof(float) * 3, vertexCount, clusters);
+		check(again == indices, "nested spheres: the overdraw order differs between two runs");
+	}
+
+	// Vertex fetch order on a hand written buffer: first use order, unreferenced vertices 1 and 3 last
+	{
+		vector<TaggedVertex> vertices(6);
+		for (uint32_t i = 0; i < 6; ++i)
+			vertices[i] = { { (float)i, 0.0f, 0.0f }, i };
+		uint32_t indices[] = { 4, 2, 0, 2, 4, 5 };
+		SMeshOptimizer::OptimizeVertexFetch(vertices.data(), sizeof(TaggedVertex), vertices.size(), indices, std::size(indices));
+		const uint32_t expectedOrder[] = { 4, 2, 0, 5, 1, 3 };
+		const uint32_t expectedIndices[] = { 0, 1, 2, 1, 0, 3 };
+		for (uint32_t i = 0; i < 6; ++i)
+		{
+			check(vertices[i].id == expectedOrder[i] && vertices[i].position[0] == (float)expectedOrder[i], "vertex %u is %u instead of %u", i, vertices[i].id, expectedOrder[i]);
+			check(indices[i] == expectedIndices[i], "index %u is %u instead of %u", i, indices[i], expectedIndices[i]);
+		}
+	}
+
+	// All three passes on a shuffled terrain: every triangle still draws the same vertices, in first use order
+	{
+		const IndexedMesh mesh = MakeTerrain(48);
+		vector<uint32_t> indices = mesh.indices;
+		ShuffleTriangles(indices, 2);
+		const vector<uint32_t> originalIndices = indices;
+		vector<TaggedVertex> vertices = TagVertices(mesh);
+		OptimizeAll(mesh, indices, vertices);
+
+		uint32_t next = 0;
+		bool firstUseOrder = true;
+		for (uint32_t index : indices)
+		{
+			firstUseOrder &= index <= next;
+			next += index == next;
+		}
+		check(firstUseOrder, "terrain: the vertices are not in first use order");
+
+		for (uint32_t& index : indices)
+			index = vertices[index].id;
+		check(GetCanonicalTriangles(indices.data(), indices.size()) == GetCanonicalTriangles(originalIndices.data(), originalIndices.size()),
+			"terrain: the triangles changed after all passes");
+	}
+
+	// 16 bit indices, as SMesh keeps them from the loader on, come out of every pass as the 32 bit ones do
+	{
+		const IndexedMesh mesh = MakeTerrain(48);
+		vector<uint32_t> indices = mesh.indices;
+		ShuffleTriangles(indices, 3);
+		vector<uint16_t> shortIndices(indices.begin(), indices.end());
+		vector<TaggedVertex> vertices = TagVertices(mesh);
+		vector<TaggedVertex> shortVertices = vertices;
+
+		vector<uint32_t> clusters, shortClusters;
+		SMeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertices.size(), &clusters);
+		SMeshOptimizer::OptimizeVertexCache(shortIndices.data(), shortIndices.size(), shortVertices.size(), &shortClusters);
+		SMeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), mesh.positions.data(), sizeof(float) * 3, vertices.size(), clusters);
+		SMeshOptimizer::OptimizeOverdraw(shortIndices.data(), shortIndices.size(), mesh.positions.data(), sizeof(float) * 3, shortVertices.size(), shortClusters);
+		SMeshOptimizer::OptimizeVertexFetch(vertices.data(), sizeof(TaggedVertex), vertices.size(), indices.data(), indices.size());
+		SMeshOptimizer::OptimizeVertexFetch(shortVertices.data(), sizeof(TaggedVertex), shortVertices.size(), shortIndices.data(), shortIndices.size());
+
+		bool sameVertices = true;
+		for (size_t i = 0; i < vertices.size(); ++i)
+			sameVertices &= vertices[i].id == shortVertices[i].id;
+		check(clusters == shortClusters && std::equal(indices.begin(), indices.end(), shortIndices.begin(), shortIndices.end()) && sameVertices,
+			"terrain: the passes order 16 bit indices differently");
+		const SMeshOptimizer::VertexCacheStatistics statistics = SMeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertices.size());
+		const SMeshOptimizer::VertexCacheStatistics shortStatistics =
+			SMeshOptimizer::AnalyzeVertexCache(shortIndices.data(), shortIndices.size(), shortVertices.size());
+		check(statistics.vertexTransforms == shortStatistics.vertexTransforms && statistics.vertexCount == shortStatistics.vertexCount,
+			"terrain: %u transforms of 16 bit indices, %u of 32 bit ones", shortStatistics.vertexTransforms, statistics.vertexTransforms);
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests optimizerbench [<size>]
+// Times each pass on a shuffled [size] x [size] terrain (1024 by default) and on nested spheres of as many
+// triangles, printing ACMR and ATVR for a 16 entry FIFO cache before and after, and the overdraw of the spheres.
+int Tests::BenchmarkOptimizer(int argc, char** argv)
+{
+	Checker check("optimizerbench");
+	const uint32_t size = argc > 0 ? (uint32_t)atoi(argv[0]) : 1024;
+	if (!check(size > 0, "invalid size %s", argc > 0 ? argv[0] : ""))
+		return check.Result();
+
+	IndexedMesh spheres = MakeCubeSphere(std::max(1u, (uint32_t)(size / sqrtf(12.0f))), 0.5f);
+	spheres.Append(MakeCubeSphere(std::max(1u, (uint32_t)(size / sqrtf(12.0f))), 1.0f));
+	struct Input
+	{
+		const char* name;
+		IndexedMesh mesh;
+	};
+	Input inputs[] = { { "terrain", MakeTerrain(size) }, { "nested spheres", std::move(spheres) } };
+	for (Input& input : inputs)
+	{
+		const IndexedMesh& mesh = input.mesh;
+		vector<uint32_t> indices = mesh.indices;
+		ShuffleTriangles(indices, 1);
+		const vector<uint32_t> shuffled = indices;
+		vector<TaggedVertex> vertices = TagVertices(mesh);
+		const size_t vertexCount = vertices.size();
+		const SMeshOptimizer::VertexCacheStatistics before = SMeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+		Timer timer;
+		vector<uint32_t> clusters;
+		SMeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertexCount, &clusters);
+		const double cacheMilliseconds = timer.Milliseconds();
+		const SMeshOptimizer::VertexCacheStatistics cached = SMeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+		const float cachedOverdraw = MeasureOverdraw(mesh.positions.data(), indices.data(), indices.size(), 256);
+		timer.Restart();
+		SMeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), mesh.positions.data(), sizeof(float) * 3, vertexCount, clusters);
+		const double overdrawMilliseconds = timer.Milliseconds();
+		const float overdraw = MeasureOverdraw(mesh.positions.data(), indices.data(), indices.size(), 256);
+		timer.Restart();
+		SMeshOptimizer::OptimizeVertexFetch(vertices.data(), sizeof(TaggedVertex), vertexCount, indices.data(), indices.size());
+		const double fetchMilliseconds = timer.Milliseconds();
+		const SMeshOptimizer::VertexCacheStatistics after = SMeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+		for (uint32_t& index : indices)
+			index = vertices[index].id;
+		check(GetCanonicalTriangles(indices.data(), indices.size()) == GetCanonicalTriangles(shuffled.data(), shuffled.size()),
+			"%s: the triangles changed", input.name);
+
+		const size_t triangleCount = indices.size() / 3;
+		printf("%s: %zu vertices, %zu triangles\n", input.name, vertexCount, triangleCount);
+		printf("  shuffled       ACMR %.3f, ATVR %.3f\n", before.acmr, before.atvr);
+		printf("  vertex cache   ACMR %.3f, ATVR %.3f, overdraw %.3f, %8.2f ms, %6.1f M triangles/s\n", cached.acmr, cached.atvr,
+			cachedOverdraw, cacheMilliseconds, triangleCount / (cacheMilliseconds * 1000.0));
+		printf("  overdraw       ACMR %.3f, ATVR %.3f, overdraw %.3f, %8.2f ms, %6.1f M triangles/s\n", after.acmr, after.atvr,
+			overdraw, overdrawMilliseconds, triangleCount / (overdrawMilliseconds * 1000.0));
+		printf("  vertex fetch   %8.2f ms, %6.1f M vertices/s\n", fetchMilliseconds, vertexCount / (fetchMilliseconds * 1000.0));
+	}
+	return check.Result();
+}
@@ -0,0 +1,345 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SMeshSimplifier.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	struct Double3
+	{
+		double x, y, z;
+	};
+
+	Double3 GetPosition(const Tests::IndexedMesh& mesh, uint32_t v) { return { mesh.positions[v * 3], mesh.positions[v * 3 + 1], mesh.positions[v * 3 + 2] }; }
+	Double3 Sub(const Double3& a, const Double3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	Double3 Add(const Double3& a, const Double3& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+	Double3 Scale(const Double3& a, double s) { return { a.x * s, a.y * s, a.z * s }; }
+	double Dot(const Double3& a, const Double3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	Double3 Cross(const Double3& a, const Double3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+
+	// Closest point on triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5)
+	Double3 ClosestPointOnTriangle(const Double3& p, const Double3& a, const Double3& b, const Double3& c)
+	{
+		const Double3 ab = Sub(b, a), ac = Sub(c, a), ap = Sub(p, a);
+		const double d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+		if (d1 <= 0.0 && d2 <= 0.0)
+			return a;
+		const Double3 bp = Sub(p, b);
+		const double d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+		if (d3 >= 0.0 && d4 <= d3)
+			return b;
+		const double vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+			return Add(a, Scale(ab, d1 / (d1 - d3)));
+		const Double3 cp = Sub(p, c);
+		const double d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+		if (d6 >= 0.0 && d5 <= d6)
+			return c;
+		const double vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+			return Add(a, Scale(ac, d2 / (d2 - d6)));
+		const double va = d3 * d6 - d5 * d4;
+		if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0)
+			return Add(b, Scale(Sub(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6))));
+		const double denominator = 1.0 / (va + vb + vc);
+		return Add(a, Add(Scale(ab, vb * denominator), Scale(ac, vc * denominator)));
+	}
+
+	double GetDistanceToSurface(const Double3& p, const Tests::IndexedMesh& mesh, const uint32_t* indices, size_t indexCount)
+	{
+		double best = DBL_MAX;
+		for (size_t i = 0; i < indexCount; i += 3)
+		{
+			const Double3 q = ClosestPointOnTriangle(p, GetPosition(mesh, indices[i]), GetPosition(mesh, indices[i + 1]), GetPosition(mesh, indices[i + 2]));
+			const Double3 d = Sub(p, q);
+			best = std::min(best, Dot(d, d));
+		}
+		return std::sqrt(best);
+	}
+
+	// Symmetric Hausdorff distance between the original and the simplified surface, from the original vertices and
+	// from the corners, edge midpoints and centers of the simplified triangles
+	double MeasureDeviation(const Tests::IndexedMesh& mesh, const vector<uint32_t>& simplified)
+	{
+		double deviation = 0.0;
+		for (uint32_t v = 0; v < mesh.GetVertexCount(); ++v)
+			deviation = std::max(deviation, GetDistanceToSurface(GetPosition(mesh, v), mesh, simplified.data(), simplified.size()));
+		for (size_t i = 0; i < simplified.size(); i += 3)
+		{
+			const Double3 a = GetPosition(mesh, simplified[i]), b = GetPosition(mesh, simplified[i + 1]), c = GetPosition(mesh, simplified[i + 2]);
+			const Double3 samples[] = { Scale(Add(a, b), 0.5), Scale(Add(b, c), 0.5), Scale(Add(c, a), 0.5), Scale(Add(Add(a, b), c), 1.0 / 3.0) };
+			for (const Double3& sample : samples)
+				deviation = std::max(deviation, GetDistanceToSurface(sample, mesh, mesh.indices.data(), mesh.indices.size()));
+		}
+		return deviation;
+	}
+
+	struct Simplified
+	{
+		vector<uint32_t> indices;
+		float error = 0.0f;
+	};
+
+	Simplified Simplify(const Tests::IndexedMesh& mesh, size_t targetIndexCount, float targetError = FLT_MAX)
+	{
+		Simplified result;
+		result.indices.resize(mesh.indices.size());
+		result.indices.resize(SMeshSimplifier::Simplify(result.indices.data(), mesh.indices.data(), mesh.indices.size(), mesh.positions.data(),
+			mesh.normals.data(), sizeof(float) * 3, mesh.GetVertexCount(), targetIndexCount, targetError, &result.error));
+		return result;
+	}
+
+	// Triangles whose normal points to the other side of the surface than the vertex normals
+	uint32_t CountFlipped(const Tests::IndexedMesh& mesh, const vector<uint32_t>& indices)
+	{
+		uint32_t flipped = 0;
+		for (size_t i = 0; i < indices.size(); i += 3)
+		{
+			const Double3 a = GetPosition(mesh, indices[i]);
+			const Double3 normal = Cross(Sub(GetPosition(mesh, indices[i + 1]), a), Sub(GetPosition(mesh, indices[i + 2]), a));
+			Double3 vertexNormals = {};
+			for (uint32_t c = 0; c < 3; ++c)
+				vertexNormals = Add(vertexNormals, { mesh.normals[indices[i + c] * 3], mesh.normals[indices[i + c] * 3 + 1], mesh.normals[indices[i + c] * 3 + 2] });
+			flipped += Dot(normal, vertexNormals) <= 0.0;
+		}
+		return flipped;
+	}
+
+	// Area of the xy projection, which a simplified terrain keeps while its border stays in place
+	double GetProjectedArea(const Tests::IndexedMesh& mesh, const vector<uint32_t>& indices)
+	{
+		double area = 0.0;
+		for (size_t i = 0; i < indices.size(); i += 3)
+			area += 0.5 * Cross(Sub(GetPosition(mesh, indices[i + 1]), GetPosition(mesh, indices[i])), Sub(GetPosition(mesh, indices[i + 2]), GetPosition(mesh, indices[i]))).z;
+		return area;
+	}
+
+	// A terrain whose vertices in column [column] are split in two at the same position, as a UV seam would split
+	// them. Triangles right of the column use the copies.
+	Tests::IndexedMesh MakeSeamedTerrain(uint32_t size, uint32_t column, vector<uint32_t>& outSeamVertices)
+	{
+		Tests::IndexedMesh mesh = Tests::MakeTerrain(size);
+		const uint32_t rowLength = size + 1;
+		vector<uint32_t> copies(mesh.GetVertexCount(), UINT32_MAX);
+		for (uint32_t y = 0; y <= size; ++y)
+		{
+			const uint32_t v = y * rowLength + column;
+			copies[v] = (uint32_t)mesh.GetVertexCount();
+			mesh.positions.insert(mesh.positions.end(), { mesh.positions[v * 3], mesh.positions[v * 3 + 1], mesh.positions[v * 3 + 2] });
+			mesh.normals.insert(mesh.normals.end(), { mesh.normals[v * 3], mesh.normals[v * 3 + 1], mesh.normals[v * 3 + 2] });
+			outSeamVertices.push_back(v);
+			outSeamVertices.push_back(copies[v]);
+		}
+		for (size_t i = 0; i < mesh.indices.size(); i += 3)
+		{
+			uint32_t* tri = &mesh.indices[i];
+			if (std::max({ tri[0] % rowLength, tri[1] % rowLength, tri[2] % rowLength }) <= column)
+				continue;
+			for (uint32_t c = 0; c < 3; ++c)
+				tri[c] = copies[tri[c]] != UINT32_MAX ? copies[tri[c]] : tri[c];
+		}
+		return mesh;
+	}
+}
+
+// D3D12EngineTests simplifier
+// Simplifies generated meshes and checks the result against SMeshSimplifier's contract: the target triangle count
+// is reached, no collapse costs more than the target error, the output indexes the original vertices without
+// degenerate triangles or triangles facing away from their vertex normals, open borders stay in place and seam
+// vertices are kept. The reported error is a weighted RMS distance to the planes of the collapsed triangles, not a
+// bound, so the Hausdorff distance to the original is held to at most twice it, as is that of an LOD chain to the
+// summed errors SMesh::SelectLOD uses. 16 bit indices simplify exactly like 32 bit ones.
+int Tests::TestSimplifier(int, char**)
+{
+	Checker check("simplifier");
+	constexpr double DEVIATION_FACTOR = 2.0;
+
+	// Target counts on a closed sphere and an open terrain
+	struct Input
+	{
+		const char* name;
+		IndexedMesh mesh;
+	};
+	const Input inputs[] = { { "sphere", MakeCubeSphere(12) }, { "terrain", MakeTerrain(32) } };
+	for (const Input& input : inputs)
+	{
+		const IndexedMesh& mesh = input.mesh;
+		for (uint32_t divisor : { 2, 4, 16 })
+		{
+			const size_t target = mesh.indices.size() / 3 / divisor * 3;
+			const Simplified simplified = Simplify(mesh, target);
+			check(simplified.indices.size() <= target && simplified.indices.size() >= target * 9 / 10, "%s to 1/%u: %zu indices for a target of %zu",
+				input.name, divisor, simplified.indices.size(), target);
+			const uint32_t flipped = CountFlipped(mesh, simplified.indices);
+			check(flipped == 0, "%s to 1/%u: %u triangles face away from their vertex normals", input.name, divisor, flipped);
+
+			uint32_t degenerate = 0;
+			for (size_t i = 0; i < simplified.indices.size(); i += 3)
+			{
+				const uint32_t* tri = &simplified.indices[i];
+				degenerate += tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0] || std::max({ tri[0], tri[1], tri[2] }) >= mesh.GetVertexCount();
+			}
+			check(degenerate == 0, "%s to 1/%u: %u degenerate or out of range triangles", input.name, divisor, degenerate);
+
+			const double deviation = MeasureDeviation(mesh, simplified.indices);
+			check(deviation <= simplified.error * DEVIATION_FACTOR, "%s to 1/%u: deviation %.5f for an error of %.5f", input.name, divisor, deviation, simplified.error);
+
+			const Simplified again = Simplify(mesh, target);
+			check(again.indices == simplified.indices && again.error == simplified.error, "%s to 1/%u: two runs differ", input.name, divisor);
+
+			const vector<uint16_t> shortIndices(mesh.indices.begin(), mesh.indices.end());
+			vector<uint16_t> shortSimplified(shortIndices.size());
+			float shortError = 0.0f;
+			shortSimplified.resize(SMeshSimplifier::Simplify(shortSimplified.data(), shortIndices.data(), shortIndices.size(), mesh.positions.data(),
+				mesh.normals.data(), sizeof(float) * 3, mesh.GetVertexCount(), target, FLT_MAX, &shortError));
+			check(std::equal(shortSimplified.begin(), shortSimplified.end(), simplified.indices.begin(), simplified.indices.end()) &&
+				shortError == simplified.error, "%s to 1/%u: 16 bit indices simplify differently", input.name, divisor);
+		}
+	}
+
+	// SMesh's meshes are wound clockwise (SMeshWeld flips OBJ's faces), so their face normals point away from the vertex
+	// normals. They must be simplified just as far, and stay facing away.
+	{
+		IndexedMesh mesh = MakeCubeSphere(12);
+		for (size_t i = 0; i < mesh.indices.size(); i += 3)
+			std::swap(mesh.indices[i + 1], mesh.indices[i + 2]);
+		const size_t target = mesh.indices.size() / 3 / 4 * 3;
+		const Simplified simplified = Simplify(mesh, target);
+		check(simplified.indices.size() <= target && simplified.indices.size() >= target * 9 / 10, "clockwise sphere to 1/4: %zu indices for a target of %zu",
+			simplified.indices.size(), target);
+		const uint32_t flipped = CountFlipped(mesh, simplified.indices);
+		check(flipped == simplified.indices.size() / 3, "clockwise sphere to 1/4: %zu of %zu triangles turned towards their vertex normals",
+			simplified.indices.size() / 3 - flipped, simplified.indices.size() / 3);
+	}
+
+	// An error limit stops the simplification early
+	{
+		const IndexedMesh mesh = MakeTerrain(32);
+		const float limit = 0.01f;
+		const Simplified limited = Simplify(mesh, 0, limit);
+		const Simplified unlimited = Simplify(mesh, 0);
+		const double deviation = MeasureDeviation(mesh, limited.indices);
+		check(limited.error <= limit && deviation <= limit * DEVIATION_FACTOR, "an error limit of %.3f gave an error of %.5f and a deviation of %.5f",
+			limit, limited.error, deviation);
+		check(limited.indices.size() > unlimited.indices.size(), "an error limit of %.3f kept %zu indices, no limit %zu", limit,
+			limited.indices.size(), unlimited.indices.size());
+	}
+
+	// A flat grid loses its interior and the straight runs of its border for free, but keeps its corners and outline
+	{
+		IndexedMesh mesh = MakeTerrain(16);
+		for (size_t v = 0; v < mesh.GetVertexCount(); ++v)
+		{
+			mesh.positions[v * 3 + 2] = 0.0f;
+			mesh.normals[v * 3] = mesh.normals[v * 3 + 1] = 0.0f;
+			mesh.normals[v * 3 + 2] = 1.0f;
+		}
+		const Simplified simplified = Simplify(mesh, 0, 1e-4f);
+		const uint32_t corners[] = { 0, 16, 17 * 16, 17 * 17 - 1 };
+		uint32_t keptCorners = 0;
+		for (uint32_t corner : corners)
+			keptCorners += std::find(simplified.indices.begin(), simplified.indices.end(), corner) != simplified.indices.end();
+		printf("simplifier: flat grid: %zu of %zu triangles\n", simplified.indices.size() / 3, mesh.indices.size() / 3);
+		check(simplified.indices.size() / 3 <= 32 && simplified.error < 1e-5f, "flat grid: %zu triangles left, error %g", simplified.indices.size() / 3, simplified.error);
+		check(keptCorners == 4 && fabs(GetProjectedArea(mesh, simplified.indices) - 1.0) < 1e-6, "flat grid: %u corners kept, area %.7f",
+			keptCorners, GetProjectedArea(mesh, simplified.indices));
+	}
+
+	// The border of a bumpy terrain slides along itself, so its outline survives any reduction; seams are locked
+	{
+		vector<uint32_t> seamVertices;
+		const IndexedMesh mesh = MakeSeamedTerrain(32, 13, seamVertices);
+		const Simplified simplified = Simplify(mesh, mesh.indices.size() / 16 / 3 * 3);
+		const double area = GetProjectedArea(mesh, simplified.indices);
+		check(fabs(area - 1.0) < 1e-6 && CountFlipped(mesh, simplified.indices) == 0, "seamed terrain: projected area %.7f", area);
+		uint32_t lostSeamVertices = 0;
+		for (uint32_t v : seamVertices)
+			lostSeamVertices += std::find(simplified.indices.begin(), simplified.indices.end(), v) == simplified.indices.end();
+		check(lostSeamVertices == 0, "seamed terrain: %u of %zu seam vertices collapsed", lostSeamVertices, seamVertices.size());
+	}
+
+	// An LOD chain like SMesh::GenerateLODs builds: each level halves the previous one, and the errors add up
+	{
+		const IndexedMesh mesh = MakeCubeSphere(16);
+		vector<uint32_t> previous = mesh.indices;
+		float error = 0.0f;
+		for (uint32_t lod = 1; lod < 5; ++lod)
+		{
+			vector<uint32_t> simplified(previous.size());
+			float lodError = 0.0f;
+			simplified.resize(SMeshSimplifier::Simplify(simplified.data(), previous.data(), previous.size(), mesh.positions.data(), mesh.normals.data(),
+				sizeof(float) * 3, mesh.GetVertexCount(), previous.size() / 6 * 3, FLT_MAX, &lodError));
+			error += lodError;
+			const double deviation = MeasureDeviation(mesh, simplified);
+			check(deviation <= error * DEVIATION_FACTOR, "LOD %u: deviation %.5f for a summed error of %.5f", lod, deviation, error);
+			previous = std::move(simplified);
+		}
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests simplifierbench [<size>]
+// Simplifies a [size] x [size] terrain (512 by default, 524K triangles) and a sphere of about as many triangles to
+// 1/2, 1/4, 1/16 and 1/64 of their triangles, then builds the LOD chain SMesh::GenerateLODs would, printing input
+// triangles per second and the reported errors.
+int Tests::BenchmarkSimplifier(int argc, char** argv)
+{
+	Checker check("simplifierbench");
+	const uint32_t size = argc > 0 ? (uint32_t)atoi(argv[0]) : 512;
+	if (!check(size > 0, "invalid size %s", argc > 0 ? argv[0] : ""))
+		return check.Result();
+
+	struct Input
+	{
+		const char* name;
+		IndexedMesh mesh;
+	};
+	const Input inputs[] = { { "terrain", MakeTerrain(size) }, { "sphere", MakeCubeSphere(std::max(1u, (uint32_t)(size / sqrtf(6.0f)))) } };
+	for (const Input& input : inputs)
+	{
+		const IndexedMesh& mesh = input.mesh;
+		const size_t triangleCount = mesh.indices.size() / 3;
+		printf("%s: %zu vertices, %zu triangles\n", input.name, mesh.GetVertexCount(), triangleCount);
+		for (uint32_t divisor : { 2, 4, 16, 64 })
+		{
+			Timer timer;
+			const Simplified simplified = Simplify(mesh, triangleCount / divisor * 3);
+			const double milliseconds = timer.Milliseconds();
+			check(simplified.indices.size() <= triangleCount / divisor * 3, "%s to 1/%u: %zu triangles", input.name, divisor, simplified.indices.size() / 3);
+			printf("  to 1/%-2u  %8zu triangles, error %.5f, %9.2f ms, %6.2f M triangles/s\n", divisor, simplified.indices.size() / 3, simplified.error,
+				milliseconds, triangleCount / (milliseconds * 1000.0));
+		}
+
+		// Each level from the previous one, until one does not get halfway to its target
+		Timer timer;
+		vector<uint32_t> previous = mesh.indices;
+		uint32_t levels = 0;
+		float error = 0.0f;
+		for (uint32_t lod = 1; lod < 5; ++lod)
+		{
+			const size_t target = previous.size() / 6 * 3;
+			vector<uint32_t> simplified(previous.size());
+			float lodError = 0.0f;
+			simplified.resize(SMeshSimplifier::Simplify(simplified.data(), previous.data(), previous.size(), mesh.positions.data(), mesh.normals.data(),
+				sizeof(float) * 3, mesh.GetVertexCount(), target, FLT_MAX, &lodError));
+			if (simplified.empty() || simplified.size() > (previous.size() + target) / 2)
+				break;
+			error += lodError;
+			++levels;
+			previous = std::move(simplified);
+		}
+		const double milliseconds = timer.Milliseconds();
+		printf("  LOD chain  %u levels down to %zu triangles, summed error %.5f, %9.2f ms, %6.2f M triangles/s\n", levels, previous.size() / 3, error,
+			milliseconds, triangleCount / (milliseconds * 1000.0));
+	}
+	return check.Result();
+}
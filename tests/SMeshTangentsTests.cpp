@@ -0,0 +1,306 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SMeshTangents.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	struct Double3
+	{
+		double x, y, z;
+	};
+
+	Double3 ToDouble(const XMFLOAT3& v) { return { v.x, v.y, v.z }; }
+	Double3 Sub(const Double3& a, const Double3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	Double3 Add(const Double3& a, const Double3& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+	Double3 Scale(const Double3& a, double s) { return { a.x * s, a.y * s, a.z * s }; }
+	double Dot(const Double3& a, const Double3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	Double3 Cross(const Double3& a, const Double3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+	double Length(const Double3& v) { return std::sqrt(Dot(v, v)); }
+	Double3 Normalize(const Double3& v) { return Scale(v, 1.0 / Length(v)); }
+	Double3 ProjectOntoPlane(const Double3& v, const Double3& n) { return Sub(v, Scale(n, Dot(n, v))); }
+
+	// Radians between two directions, accurate for small angles unlike acos
+	double GetAngle(const Double3& a, const Double3& b)
+	{
+		return std::atan2(Length(Cross(a, b)), Dot(a, b));
+	}
+
+	// Mesh-wide triangles of all sections
+	vector<uint32_t> GetTriangles(const vector<uint32_t>& indices, const vector<SMeshSection>& sections)
+	{
+		vector<uint32_t> triangles;
+		for (const SMeshSection& section : sections)
+		{
+			for (uint32_t i = 0; i < section.indexCount; ++i)
+				triangles.push_back(section.baseVertexLocation + indices[section.startIndexLocation + i]);
+		}
+		return triangles;
+	}
+
+	// Single threaded double precision version of SMeshTangents, one triangle at a time, from the description in
+	// its header: corner angle weighted face normals; face tangents projected onto the vertex's tangent plane,
+	// normalized, angle weighted and orthonormalized; the bitangent as cross(normal, tangent) times the handedness.
+	// Returns whether each vertex's tangent frame is well conditioned: where the UV mapping folds over, the face
+	// tangents around a vertex nearly cancel out and any rounding can turn their sum or flip the handedness.
+	vector<bool> GenerateReference(vector<SVertex>& vertices, const vector<uint32_t>& triangles)
+	{
+		vector<Double3> normals(vertices.size(), Double3{}), tangents(vertices.size(), Double3{}), bitangents(vertices.size(), Double3{});
+		vector<double> weights(vertices.size(), 0.0);
+		vector<uint32_t> cornerCount(vertices.size(), 0);
+		for (size_t i = 0; i < triangles.size(); i += 3)
+		{
+			const uint32_t* tri = &triangles[i];
+			const Double3 p[3] = { ToDouble(vertices[tri[0]].position), ToDouble(vertices[tri[1]].position), ToDouble(vertices[tri[2]].position) };
+			const Double3 normal = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const Double3 a = Sub(p[(c + 1) % 3], p[c]), b = Sub(p[(c + 2) % 3], p[c]);
+				const double angle = std::acos(std::clamp(Dot(a, b) / (Length(a) * Length(b)), -1.0, 1.0));
+				normals[tri[c]] = Add(normals[tri[c]], Scale(normal, angle));
+				++cornerCount[tri[c]];
+			}
+		}
+		for (size_t v = 0; v < vertices.size(); ++v)
+		{
+			if (cornerCount[v] > 0)
+			{
+				const Double3 n = Normalize(normals[v]);
+				vertices[v].normal = XMFLOAT3((float)n.x, (float)n.y, (float)n.z);
+			}
+		}
+
+		for (size_t i = 0; i < triangles.size(); i += 3)
+		{
+			const uint32_t* tri = &triangles[i];
+			const SVertex* v[3] = { &vertices[tri[0]], &vertices[tri[1]], &vertices[tri[2]] };
+			const Double3 p0 = ToDouble(v[0]->position);
+			const Double3 e0 = Sub(ToDouble(v[1]->position), p0), e1 = Sub(ToDouble(v[2]->position), p0);
+			const double du0 = v[1]->uv.x - v[0]->uv.x, dv0 = v[1]->uv.y - v[0]->uv.y;
+			const double du1 = v[2]->uv.x - v[0]->uv.x, dv1 = v[2]->uv.y - v[0]->uv.y;
+			const double det = du0 * dv1 - du1 * dv0;
+			if (det == 0.0)
+				continue;
+			const double sign = det < 0.0 ? -1.0 : 1.0;
+			const Double3 tangent = Scale(Sub(Scale(e0, dv1), Scale(e1, dv0)), sign);
+			const Double3 bitangent = Scale(Sub(Scale(e1, du0), Scale(e0, du1)), sign);
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const Double3 a = Sub(ToDouble(v[(c + 1) % 3]->position), ToDouble(v[c]->position));
+				const Double3 b = Sub(ToDouble(v[(c + 2) % 3]->position), ToDouble(v[c]->position));
+				const double angle = std::acos(std::clamp(Dot(a, b) / (Length(a) * Length(b)), -1.0, 1.0));
+				const Double3 n = ToDouble(v[c]->normal);
+				const Double3 t = ProjectOntoPlane(tangent, n), b2 = ProjectOntoPlane(bitangent, n);
+				weights[tri[c]] += angle;
+				if (Length(t) > 1e-10)
+					tangents[tri[c]] = Add(tangents[tri[c]], Scale(Normalize(t), angle));
+				if (Length(b2) > 1e-10)
+					bitangents[tri[c]] = Add(bitangents[tri[c]], Scale(Normalize(b2), angle));
+			}
+		}
+		vector<bool> conditioned(vertices.size(), true);
+		for (size_t v = 0; v < vertices.size(); ++v)
+		{
+			if (cornerCount[v] == 0)
+				continue;
+			const Double3 n = ToDouble(vertices[v].normal);
+			Double3 t = ProjectOntoPlane(tangents[v], n);
+			conditioned[v] = Length(t) >= 0.25 * weights[v] && fabs(Dot(Cross(n, Normalize(t)), bitangents[v])) >= 0.25 * weights[v];
+			if (Length(t) < 1e-10)
+				t = Cross(n, fabs(n.x) < 0.9 ? Double3{ 1, 0, 0 } : Double3{ 0, 1, 0 });
+			t = Normalize(t);
+			const Double3 cross = Cross(n, t);
+			const Double3 b = Dot(cross, bitangents[v]) < 0.0 ? Scale(cross, -1.0) : cross;
+			vertices[v].tangent = XMFLOAT3((float)t.x, (float)t.y, (float)t.z);
+			vertices[v].bitangent = XMFLOAT3((float)b.x, (float)b.y, (float)b.z);
+		}
+		return conditioned;
+	}
+
+	struct FrameErrors
+	{
+		double normal = 0.0;  // Radians
+		double tangent = 0.0;
+		double bitangent = 0.0;
+		size_t skipped = 0;     // Ill conditioned tangent frames
+	};
+
+	FrameErrors Compare(const vector<SVertex>& vertices, const vector<SVertex>& expected, const vector<bool>& conditioned)
+	{
+		FrameErrors errors;
+		for (size_t v = 0; v < vertices.size(); ++v)
+		{
+			errors.normal = std::max(errors.normal, GetAngle(ToDouble(vertices[v].normal), ToDouble(expected[v].normal)));
+			if (!conditioned[v])
+			{
+				++errors.skipped;
+				continue;
+			}
+			errors.tangent = std::max(errors.tangent, GetAngle(ToDouble(vertices[v].tangent), ToDouble(expected[v].tangent)));
+			errors.bitangent = std::max(errors.bitangent, GetAngle(ToDouble(vertices[v].bitangent), ToDouble(expected[v].bitangent)));
+		}
+		return errors;
+	}
+
+	// Vertices with their generated attributes cleared
+	vector<SVertex> MakeInputVertices(const Tests::IndexedMesh& mesh)
+	{
+		vector<SVertex> vertices = Tests::MakeVertices(mesh);
+		for (SVertex& vertex : vertices)
+			vertex.normal = vertex.tangent = vertex.bitangent = XMFLOAT3(0.0f, 0.0f, 0.0f);
+		return vertices;
+	}
+
+	void Generate(vector<SVertex>& vertices, const vector<uint32_t>& indices, const vector<SMeshSection>& sections)
+	{
+		SMeshTangents::GenerateNormals(vertices.data(), vertices.size(), indices.data(), sections.data(), sections.size());
+		SMeshTangents::GenerateTangents(vertices.data(), vertices.size(), indices.data(), sections.data(), sections.size());
+	}
+
+	// Reference results are computed in double precision, so these only cover float rounding
+	constexpr double REFERENCE_TOLERANCE = 1e-4;
+
+	// uv = xy folds over along the sphere's silhouettes, the band of frames there mustn't cover the whole mesh
+	constexpr double MAX_ILL_CONDITIONED = 0.1;
+}
+
+// D3D12EngineTests tangents
+// Normals and tangent frames against a single threaded double precision reference, on a sphere split into sections
+// that share vertices and on a terrain; against the analytic normals of the sphere; and on a flat grid with plain
+// and mirrored UVs, where the exact frame and its handedness are known. Unreferenced vertices keep their normal, and
+// 16 bit indices give the same frames.
+int Tests::TestTangents(int, char**)
+{
+	Checker check("tangents");
+
+	// Sphere in two sections over the same vertices, and a terrain in a third with its own base vertex
+	{
+		const IndexedMesh sphere = MakeCubeSphere(24);
+		const IndexedMesh terrain = MakeTerrain(48);
+		vector<SVertex> vertices = MakeInputVertices(sphere);
+		const vector<SVertex> terrainVertices = MakeInputVertices(terrain);
+		vertices.insert(vertices.end(), terrainVertices.begin(), terrainVertices.end());
+		vertices.push_back(SVertex{ XMFLOAT3(5, 5, 5), XMFLOAT2(0, 0), XMFLOAT3(0, 1, 0) });
+
+		vector<uint32_t> indices = sphere.indices;
+		indices.insert(indices.end(), terrain.indices.begin(), terrain.indices.end());
+		const uint32_t half = (uint32_t)sphere.indices.size() / 6 * 3;
+		const vector<SMeshSection> sections = {
+			{ half, 0, 0 },
+			{ (uint32_t)sphere.indices.size() - half, half, 0 },
+			{ (uint32_t)terrain.indices.size(), (uint32_t)sphere.indices.size(), (uint32_t)sphere.GetVertexCount() },
+		};
+
+		vector<SVertex> expected = vertices;
+		vector<SVertex> shortVertices = vertices;
+		const vector<bool> conditioned = GenerateReference(expected, GetTriangles(indices, sections));
+		Generate(vertices, indices, sections);
+
+		const vector<uint16_t> shortIndices(indices.begin(), indices.end());
+		SMeshTangents::GenerateNormals(shortVertices.data(), shortVertices.size(), shortIndices.data(), sections.data(), sections.size());
+		SMeshTangents::GenerateTangents(shortVertices.data(), shortVertices.size(), shortIndices.data(), sections.data(), sections.size());
+		check(memcmp(shortVertices.data(), vertices.data(), vertices.size() * sizeof(SVertex)) == 0, "sections: 16 bit indices give other frames");
+		const FrameErrors errors = Compare(vertices, expected, conditioned);
+		check(errors.skipped < vertices.size() * MAX_ILL_CONDITIONED, "sections: %zu of %zu tangent frames are ill conditioned", errors.skipped, vertices.size());
+		check(errors.normal < REFERENCE_TOLERANCE && errors.tangent < REFERENCE_TOLERANCE && errors.bitangent < REFERENCE_TOLERANCE,
+			"sections: normal, tangent and bitangent differ from the reference by up to %.2e, %.2e and %.2e radians",
+			errors.normal, errors.tangent, errors.bitangent);
+
+		const SVertex& unreferenced = vertices.back();
+		check(unreferenced.normal.x == 0.0f && unreferenced.normal.y == 1.0f && unreferenced.normal.z == 0.0f, "the unreferenced vertex lost its normal");
+
+		// The sphere's smooth normals point away from its center, its frames are orthonormal
+		double normalError = 0.0, orthogonality = 0.0;
+		for (size_t v = 0; v < sphere.GetVertexCount(); ++v)
+		{
+			const Double3 n = ToDouble(vertices[v].normal), t = ToDouble(vertices[v].tangent), b = ToDouble(vertices[v].bitangent);
+			normalError = std::max(normalError, GetAngle(n, ToDouble(XMFLOAT3(sphere.normals[v * 3], sphere.normals[v * 3 + 1], sphere.normals[v * 3 + 2]))));
+			orthogonality = std::max({ orthogonality, fabs(Dot(n, t)), fabs(Dot(n, b)), fabs(Dot(t, b)), fabs(Length(t) - 1.0), fabs(Length(b) - 1.0) });
+		}
+		check(normalError < XMConvertToRadians(1.0f), "sphere: normals differ from the analytic ones by up to %.3f degrees", XMConvertToDegrees((float)normalError));
+		check(orthogonality < 1e-5, "sphere: tangent frames are off orthonormal by %.2e", orthogonality);
+	}
+
+	// A flat grid with uv = xy has the frame x, y, z; mirroring u flips the tangent and the handedness, not the bitangent
+	for (float mirror : { 1.0f, -1.0f })
+	{
+		const IndexedMesh grid = MakeTerrain(8);
+		vector<SVertex> vertices = MakeInputVertices(grid);
+		for (SVertex& vertex : vertices)
+		{
+			vertex.position.z = 0.0f;
+			vertex.uv.x *= mirror;
+		}
+		const vector<SMeshSection> sections = { { (uint32_t)grid.indices.size(), 0, 0 } };
+		Generate(vertices, grid.indices, sections);
+
+		double error = 0.0;
+		uint32_t wrongHandedness = 0;
+		for (const SVertex& vertex : vertices)
+		{
+			error = std::max({ error, GetAngle(ToDouble(vertex.normal), { 0, 0, 1 }), GetAngle(ToDouble(vertex.tangent), { mirror, 0, 0 }),
+				GetAngle(ToDouble(vertex.bitangent), { 0, 1, 0 }) });
+			const double handedness = Dot(Cross(ToDouble(vertex.normal), ToDouble(vertex.tangent)), ToDouble(vertex.bitangent));
+			wrongHandedness += (handedness > 0.0) != (mirror > 0.0f);
+		}
+		check(error < 1e-6 && wrongHandedness == 0, "flat grid with %s uvs: frames off by %.2e radians, %u with the wrong handedness",
+			mirror > 0.0f ? "plain" : "mirrored", error, wrongHandedness);
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests tangentsbench [<subdivisions>]
+// GenerateNormals and GenerateTangents on a cube sphere of [subdivisions] quads per cube edge (420 by default,
+// 2.1M triangles), best of 3, next to the single threaded double precision reference. Fails if they disagree.
+int Tests::BenchmarkTangents(int argc, char** argv)
+{
+	Checker check("tangentsbench");
+	const uint32_t subdivisions = argc > 0 ? (uint32_t)atoi(argv[0]) : 420;
+	if (!check(subdivisions > 0, "invalid subdivision count %s", argc > 0 ? argv[0] : ""))
+		return check.Result();
+
+	const IndexedMesh sphere = MakeCubeSphere(subdivisions);
+	const vector<SVertex> input = MakeInputVertices(sphere);
+	const vector<SMeshSection> sections = { { (uint32_t)sphere.indices.size(), 0, 0 } };
+	const size_t triangleCount = sphere.indices.size() / 3;
+
+	vector<SVertex> vertices;
+	double normalMilliseconds = 1e30, tangentMilliseconds = 1e30;
+	for (uint32_t run = 0; run < 3; ++run)
+	{
+		vertices = input;
+		Timer timer;
+		SMeshTangents::GenerateNormals(vertices.data(), vertices.size(), sphere.indices.data(), sections.data(), sections.size());
+		normalMilliseconds = std::min(normalMilliseconds, timer.Milliseconds());
+		timer.Restart();
+		SMeshTangents::GenerateTangents(vertices.data(), vertices.size(), sphere.indices.data(), sections.data(), sections.size());
+		tangentMilliseconds = std::min(tangentMilliseconds, timer.Milliseconds());
+	}
+
+	vector<SVertex> expected = input;
+	Timer timer;
+	const vector<bool> conditioned = GenerateReference(expected, sphere.indices);
+	const double referenceMilliseconds = timer.Milliseconds();
+	const FrameErrors errors = Compare(vertices, expected, conditioned);
+	check(errors.skipped < vertices.size() * MAX_ILL_CONDITIONED, "%zu of %zu tangent frames are ill conditioned", errors.skipped, vertices.size());
+	check(errors.normal < REFERENCE_TOLERANCE && errors.tangent < REFERENCE_TOLERANCE && errors.bitangent < REFERENCE_TOLERANCE,
+		"normal, tangent and bitangent differ from the reference by up to %.2e, %.2e and %.2e radians", errors.normal, errors.tangent, errors.bitangent);
+
+	printf("%zu vertices, %zu triangles\n", vertices.size(), triangleCount);
+	printf("  normals    %8.2f ms, %6.2f M triangles/s\n", normalMilliseconds, triangleCount / (normalMilliseconds * 1000.0));
+	printf("  tangents   %8.2f ms, %6.2f M triangles/s\n", tangentMilliseconds, triangleCount / (tangentMilliseconds * 1000.0));
+	printf("  reference  %8.2f ms for both, single threaded in double precision\n", referenceMilliseconds);
+	printf("  largest difference from the reference: normal %.2e, tangent %.2e, bitangent %.2e radians (%zu ill conditioned frames skipped)\n",
+		errors.normal, errors.tangent, errors.bitangent, errors.skipped);
+	return check.Result();
+}
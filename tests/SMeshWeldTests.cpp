@@ -0,0 +1,240 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SMeshOptimizer.h"
+#include "SMeshWeld.h"
+#include "SObjReader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	struct WeldedMesh
+	{
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+		SMeshWeld::Statistics statistics;
+	};
+
+	WeldedMesh Weld(const tinyobj::attrib_t& attrib, const vector<tinyobj::shape_t>& shapes)
+	{
+		WeldedMesh mesh;
+		mesh.statistics = SMeshWeld::AppendOBJShapes(attrib, shapes, mesh.vertices, mesh.indices, mesh.sections);
+		return mesh;
+	}
+
+	tinyobj::index_t Corner(int position, int texcoord = -1, int normal = -1)
+	{
+		tinyobj::index_t corner;
+		corner.vertex_index = position;
+		corner.texcoord_index = texcoord;
+		corner.normal_index = normal;
+		return corner;
+	}
+
+	void AddPosition(tinyobj::attrib_t& attrib, float x, float y, float z)
+	{
+		attrib.vertices.push_back(x);
+		attrib.vertices.push_back(y);
+		attrib.vertices.push_back(z);
+	}
+
+	// Whether welded vertex [vertex] of [section] is at source position [position]
+	bool IsAt(const WeldedMesh& mesh, const SMeshSection& section, uint32_t vertex, const tinyobj::attrib_t& attrib, int position)
+	{
+		const DirectX::XMFLOAT3& p = mesh.vertices[section.baseVertexLocation + vertex].position;
+		return p.x == attrib.vertices[3 * position] && p.y == attrib.vertices[3 * position + 1] && p.z == attrib.vertices[3 * position + 2];
+	}
+
+	// Sections are appended one after the other, so each one's vertices end where the next one's start
+	size_t GetSectionVertexCount(const WeldedMesh& mesh, size_t s)
+	{
+		const size_t end = s + 1 < mesh.sections.size() ? mesh.sections[s + 1].baseVertexLocation : mesh.vertices.size();
+		return end - mesh.sections[s].baseVertexLocation;
+	}
+
+	// ACMR of all sections, each drawn on its own
+	float ComputeACMR(const WeldedMesh& mesh)
+	{
+		size_t transforms = 0, triangles = 0;
+		for (size_t s = 0; s < mesh.sections.size(); ++s)
+		{
+			const SMeshSection& section = mesh.sections[s];
+			const SMeshOptimizer::VertexCacheStatistics statistics =
+				SMeshOptimizer::AnalyzeVertexCache(&mesh.indices[section.startIndexLocation], section.indexCount, GetSectionVertexCount(mesh, s));
+			transforms += statistics.vertexTransforms;
+			triangles += statistics.triangleCount;
+		}
+		return triangles ? (float)transforms / triangles : 0.0f;
+	}
+}
+
+// D3D12EngineTests weld
+// Shared corners become one vertex, seams stay split, polygons become fans, faces with nothing to draw are skipped,
+// and an OBJ file read by SObjReader welds back into its grid.
+int Tests::TestWeld(int, char**)
+{
+	Checker check("weld");
+
+	// Two triangles sharing an edge, then the same with a uv seam along the edge
+	{
+		tinyobj::attrib_t attrib;
+		AddPosition(attrib, 0, 0, 0);
+		AddPosition(attrib, 1, 0, 0);
+		AddPosition(attrib, 1, 1, 0);
+		AddPosition(attrib, 0, 1, 0);
+		attrib.texcoords = { 0, 0, 1, 0, 1, 1, 0, 1, 0.5f, 0.5f };
+		tinyobj::shape_t shape;
+		shape.mesh.indices = { Corner(0, 0), Corner(1, 1), Corner(2, 2), Corner(0, 0), Corner(2, 2), Corner(3, 3) };
+		shape.mesh.num_face_vertices = { 3, 3 };
+
+		const WeldedMesh shared = Weld(attrib, { shape });
+		check(shared.vertices.size() == 4 && shared.indices.size() == 6, "two triangles: %zu vertices, %zu indices, expected 4 and 6",
+			shared.vertices.size(), shared.indices.size());
+		if (shared.indices.size() == 6)
+		{
+			// Each triangle is (0, 2, 1) of its face
+			const int expected[] = { 0, 2, 1, 0, 3, 2 };
+			for (uint32_t i = 0; i < 6; ++i)
+				check(IsAt(shared, shared.sections[0], shared.indices[i], attrib, expected[i]), "two triangles: index %u is not at position %d", i, expected[i]);
+			check(shared.vertices[shared.indices[1]].uv.x == 1.0f && shared.vertices[shared.indices[1]].uv.y == 1.0f, "two triangles: uv not carried over");
+		}
+		check(shared.statistics.cornerCount == 6 && shared.statistics.vertexCount == 4 && shared.statistics.triangleCount == 2,
+			"two triangles: statistics %zu corners, %zu vertices, %zu triangles", shared.statistics.cornerCount, shared.statistics.vertexCount, shared.statistics.triangleCount);
+
+		shape.mesh.indices[4].texcoord_index = 4;
+		const WeldedMesh seam = Weld(attrib, { shape });
+		check(seam.vertices.size() == 5, "seam: %zu vertices, expected 5", seam.vertices.size());
+	}
+
+	// A quad and a pentagon are fanned, a line, a point and a face out of range are skipped
+	{
+		tinyobj::attrib_t attrib;
+		for (int i = 0; i < 5; ++i)
+			AddPosition(attrib, cosf(i * 1.2566371f), sinf(i * 1.2566371f), 0);
+		attrib.normals = { 0, 0, 1 };
+		tinyobj::shape_t shape;
+		shape.mesh.indices = {
+			Corner(0, -1, 0), Corner(1, -1, 0), Corner(2, -1, 0), Corner(3, -1, 0),
+			Corner(0, -1, 0), Corner(1, -1, 0),
+			Corner(0, -1, 0), Corner(1, -1, 0), Corner(2, -1, 0), Corner(3, -1, 0), Corner(4, -1, 0),
+			Corner(4, -1, 0),
+			Corner(0, -1, 0), Corner(1, -1, 0), Corner(5, -1, 0),
+			Corner(0, -1, 1), Corner(1, -1, 0), Corner(2, -1, 0),
+		};
+		shape.mesh.num_face_vertices = { 4, 2, 5, 1, 3, 3 };
+
+		const WeldedMesh mesh = Weld(attrib, { shape });
+		const SMeshWeld::Statistics& statistics = mesh.statistics;
+		check(statistics.triangleCount == 5 && statistics.triangulatedFaceCount == 2 && statistics.skippedFaceCount == 4,
+			"polygons: %zu triangles, %zu triangulated, %zu skipped, expected 5, 2 and 4",
+			statistics.triangleCount, statistics.triangulatedFaceCount, statistics.skippedFaceCount);
+		check(mesh.vertices.size() == 5, "polygons: %zu vertices, expected 5", mesh.vertices.size());
+		if (mesh.indices.size() == 15)
+		{
+			// Fans around the first corner, (0, k + 2, k + 1) for triangle k
+			const int expected[] = { 0, 2, 1, 0, 3, 2, 0, 2, 1, 0, 3, 2, 0, 4, 3 };
+			for (uint32_t i = 0; i < 15; ++i)
+				check(IsAt(mesh, mesh.sections[0], mesh.indices[i], attrib, expected[i]), "polygons: index %u is not at position %d", i, expected[i]);
+			check(mesh.vertices[mesh.indices[0]].normal.z == 1.0f, "polygons: normal not carried over");
+		}
+		else
+			check(false, "polygons: %zu indices, expected 15", mesh.indices.size());
+	}
+
+	// Sections per shape, with indices relative to their own vertices; shapes without triangles add none
+	{
+		tinyobj::attrib_t attrib;
+		for (int i = 0; i < 4; ++i)
+			AddPosition(attrib, (float)(i & 1), (float)(i >> 1), 0);
+		vector<tinyobj::shape_t> shapes(3);
+		shapes[0].mesh.indices = { Corner(0), Corner(1), Corner(2) };
+		shapes[0].mesh.num_face_vertices = { 3 };
+		shapes[2].mesh.indices = { Corner(1), Corner(3), Corner(2), Corner(1) };
+		shapes[2].mesh.num_face_vertices = { 4 };
+
+		const WeldedMesh mesh = Weld(attrib, shapes);
+		if (check(mesh.sections.size() == 2, "shapes: %zu sections, expected 2", mesh.sections.size()))
+		{
+			const SMeshSection& second = mesh.sections[1];
+			check(second.baseVertexLocation == 3 && second.startIndexLocation == 3 && second.indexCount == 6,
+				"shapes: second section at vertex %u, index %u, %u indices", second.baseVertexLocation, second.startIndexLocation, second.indexCount);
+			for (uint32_t i = 0; i < second.indexCount; ++i)
+				check(mesh.indices[second.startIndexLocation + i] < 3, "shapes: index %u of the second section is not local", i);
+		}
+	}
+
+	// A quad grid OBJ file in two shapes: each shape welds back into its own (size + 1) x (rows + 1) vertices
+	{
+		const uint32_t size = 24;
+		const std::string path = GetTempPath("D3D12EngineTests_weld.obj");
+		SObjReader reader;
+		if (check(WriteTextFile(path, MakeGridOBJ(size, 2)), "grid: failed to write %s", path.c_str()) &&
+			check(reader.Parse(path.c_str(), 2), "grid: SObjReader failed to parse %s", path.c_str()))
+		{
+			const WeldedMesh mesh = Weld(reader.GetAttrib(), reader.GetShapes());
+			const size_t expectedVertices = 2 * (size / 2 + 1) * (size + 1);
+			check(mesh.sections.size() == 2, "grid: %zu sections, expected 2", mesh.sections.size());
+			check(mesh.vertices.size() == expectedVertices && mesh.statistics.triangleCount == 2 * size * size,
+				"grid: %zu vertices, %zu triangles, expected %zu and %u", mesh.vertices.size(), mesh.statistics.triangleCount, expectedVertices, 2 * size * size);
+			const float acmr = ComputeACMR(mesh);
+			check(acmr < 1.2f, "grid: ACMR %.3f in file order, expected below 1.2", acmr);
+		}
+		remove(path.c_str());
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests weldbench [<obj>...]
+// Reads and welds each OBJ file (a generated grid of about a million triangles if none is given) and prints the
+// vertices before and after welding, the ACMR in file order and after vertex cache optimization, and the load time.
+int Tests::BenchmarkWeld(int argc, char** argv)
+{
+	Checker check("weldbench");
+	vector<std::string> paths(argv, argv + argc);
+	const std::string generated = GetTempPath("D3D12EngineTests_weldbench.obj");
+	if (paths.empty())
+	{
+		if (!check(WriteTextFile(generated, MakeGridOBJ(708, 4)), "failed to write %s", generated.c_str()))
+			return check.Result();
+		paths.push_back(generated);
+	}
+
+	for (const std::string& path : paths)
+	{
+		SObjReader reader;
+		Timer timer;
+		if (!check(reader.Parse(path.c_str()), "SObjReader cannot read %s (not a plain geometry file)", path.c_str()))
+			continue;
+		const double parseMilliseconds = timer.Milliseconds();
+		timer.Restart();
+		WeldedMesh mesh = Weld(reader.GetAttrib(), reader.GetShapes());
+		const double weldMilliseconds = timer.Milliseconds();
+
+		const SMeshWeld::Statistics& statistics = mesh.statistics;
+		check(statistics.cornerCount == statistics.triangleCount * 3 && mesh.indices.size() == statistics.cornerCount &&
+			mesh.vertices.size() == statistics.vertexCount, "%s: statistics do not match the mesh", path.c_str());
+		const float fileOrderACMR = ComputeACMR(mesh);
+		for (size_t s = 0; s < mesh.sections.size(); ++s)
+		{
+			const SMeshSection& section = mesh.sections[s];
+			SMeshOptimizer::OptimizeVertexCache(&mesh.indices[section.startIndexLocation], section.indexCount, GetSectionVertexCount(mesh, s));
+		}
+
+		printf("%s: %.1f MB, %zu triangles, %zu sections\n", path.c_str(), reader.GetFileSize() / 1048576.0, statistics.triangleCount, mesh.sections.size());
+		printf("  vertices  %10zu unwelded, %10zu welded (%.2fx), %.1f MB -> %.1f MB\n", statistics.cornerCount, statistics.vertexCount,
+			(double)statistics.cornerCount / std::max<size_t>(statistics.vertexCount, 1),
+			statistics.cornerCount * sizeof(SVertex) / 1048576.0, statistics.vertexCount * sizeof(SVertex) / 1048576.0);
+		printf("  ACMR      %10.3f unwelded, %10.3f welded, %.3f after OptimizeVertexCache\n", 3.0f, fileOrderACMR, ComputeACMR(mesh));
+		printf("  load      %10.2f ms parse (%u threads), %.2f ms weld, %.2f ms total\n", parseMilliseconds, reader.GetThreadCount(),
+			weldMilliseconds, parseMilliseconds + weldMilliseconds);
+	}
+	remove(generated.c_str());
+	return check.Result();
+}
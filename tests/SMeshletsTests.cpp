@@ -0,0 +1,328 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "SFrustumCulling.h"
+#include "SMeshOptimizer.h"
+#include "SMeshlets.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	struct SectionedMesh
+	{
+		vector<SVertex> vertices;
+		vector<uint32_t> indices;
+		vector<SMeshSection> sections;
+
+		void AddSection(const Tests::IndexedMesh& mesh)
+		{
+			sections.push_back({ (uint32_t)mesh.indices.size(), (uint32_t)indices.size(), (uint32_t)vertices.size() });
+			const vector<SVertex> sectionVertices = Tests::MakeVertices(mesh);
+			vertices.insert(vertices.end(), sectionVertices.begin(), sectionVertices.end());
+			indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+		}
+	};
+
+	// Vertex cache order, which SMesh::Optimize gives every mesh before its meshlets are built
+	Tests::IndexedMesh Optimized(Tests::IndexedMesh mesh)
+	{
+		SMeshOptimizer::OptimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.GetVertexCount());
+		return mesh;
+	}
+
+	// Camera at [eye] looking at [target] with a 70 degree vertical field of view
+	XMMATRIX MakeViewProjection(const XMFLOAT3& eye, const XMFLOAT3& target)
+	{
+		const XMMATRIX view = XMMatrixLookAtLH(XMLoadFloat3(&eye), XMLoadFloat3(&target), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		return XMMatrixMultiply(view, XMMatrixPerspectiveFovLH(XMConvertToRadians(70.0f), 16.0f / 9.0f, 0.05f, 100.0f));
+	}
+
+	float Random(std::mt19937& generator, float low, float high)
+	{
+		return low + (high - low) * ((generator() >> 8) * (1.0f / 16777216.0f));
+	}
+
+	// Per triangle reference for culling: whether the triangle faces [camera], with its normal flipped to agree with
+	// the vertex normals like the cones are, and whether it is inside or crosses the frustum
+	struct TriangleVisibility
+	{
+		bool frontFacing;
+		bool inFrustum;
+	};
+
+	TriangleVisibility GetVisibility(const SVertex& v0, const SVertex& v1, const SVertex& v2, const XMFLOAT4 planes[6], const XMFLOAT3& camera)
+	{
+		const XMVECTOR p0 = XMLoadFloat3(&v0.position), p1 = XMLoadFloat3(&v1.position), p2 = XMLoadFloat3(&v2.position);
+		XMVECTOR n = XMVector3Cross(XMVectorSubtract(p1, p0), XMVectorSubtract(p2, p0));
+		const XMVECTOR shadingNormal = XMVectorAdd(XMVectorAdd(XMLoadFloat3(&v0.normal), XMLoadFloat3(&v1.normal)), XMLoadFloat3(&v2.normal));
+		if (XMVectorGetX(XMVector3Dot(n, shadingNormal)) < 0.0f)
+			n = XMVectorNegate(n);
+
+		TriangleVisibility visibility;
+		// A tolerance for the rounding of the cone and sphere tests
+		const float tolerance = 1e-5f * XMVectorGetX(XMVector3Length(n));
+		visibility.frontFacing = XMVectorGetX(XMVector3Dot(n, XMVectorSubtract(XMLoadFloat3(&camera), p0))) > -tolerance;
+		visibility.inFrustum = true;
+		for (uint32_t p = 0; p < 6 && visibility.inFrustum; ++p)
+		{
+			const XMFLOAT4& plane = planes[p];
+			visibility.inFrustum = false;
+			for (const SVertex* v : { &v0, &v1, &v2 })
+				visibility.inFrustum |= plane.x * v->position.x + plane.y * v->position.y + plane.z * v->position.z + plane.w >= -1e-5f;
+		}
+		return visibility;
+	}
+}
+
+// D3D12EngineTests meshlets
+// Builds the meshlets of a sphere and a terrain with a degenerate triangle, and checks that they cover the sections
+// in index buffer order within the size limits, that their mesh shader form draws the same triangles, that their
+// bounds contain their vertices, that each meshlet is only closed when the next triangle does not fit and that
+// 16 bit indices give the same meshlets. Then culls them from random cameras: no meshlet with a triangle that faces the camera inside the frustum may be culled.
+int Tests::TestMeshlets(int, char**)
+{
+	Checker check("meshlets");
+
+	SectionedMesh mesh;
+	mesh.AddSection(Optimized(MakeCubeSphere(24)));
+	IndexedMesh terrain = Optimized(MakeTerrain(32));
+	terrain.indices.insert(terrain.indices.begin() + 300, { 5, 5, 6 });
+	mesh.AddSection(terrain);
+
+	SMeshletTable table;
+	SMeshlets::Build(mesh.vertices.data(), mesh.indices.data(), mesh.sections.data(), mesh.sections.size(), table);
+	if (!check(table.sectionOffsets.size() == mesh.sections.size() + 1 && table.sectionOffsets.back() == table.size(),
+		"%zu section offsets ending at %u for %zu sections and %zu meshlets", table.sectionOffsets.size(),
+		table.sectionOffsets.empty() ? 0 : table.sectionOffsets.back(), mesh.sections.size(), table.size()))
+		return check.Result();
+
+	// 16 bit indices, as mapped from a .smesh cache, give the same meshlets
+	{
+		const vector<uint16_t> shortIndices(mesh.indices.begin(), mesh.indices.end());
+		SMeshletTable shortTable;
+		SMeshlets::Build(mesh.vertices.data(), shortIndices.data(), mesh.sections.data(), mesh.sections.size(), shortTable);
+		check(shortTable.vertices == table.vertices && shortTable.primitives == table.primitives && shortTable.coneCutoff == table.coneCutoff,
+			"16 bit indices give different meshlets");
+	}
+
+	size_t primitiveOffset = 0;
+	for (size_t s = 0; s < mesh.sections.size(); ++s)
+	{
+		const SMeshSection& section = mesh.sections[s];
+		const uint32_t* indices = &mesh.indices[section.startIndexLocation];
+		const SVertex* vertices = &mesh.vertices[section.baseVertexLocation];
+		uint32_t nextTriangle = 0;
+		for (uint32_t m = table.sectionOffsets[s]; m < table.sectionOffsets[s + 1]; ++m)
+		{
+			const uint32_t vertexCount = table.vertexCount[m], triangleCount = table.triangleCount[m];
+			check(table.triangleOffset[m] == nextTriangle, "meshlet %u starts at triangle %u instead of %u", m, table.triangleOffset[m], nextTriangle);
+			check(vertexCount >= 1 && vertexCount <= MESHLET_MAX_VERTICES && triangleCount >= 1 && triangleCount <= MESHLET_MAX_TRIANGLES,
+				"meshlet %u has %u vertices and %u triangles", m, vertexCount, triangleCount);
+			nextTriangle = table.triangleOffset[m] + triangleCount;
+
+			// The mesh shader form draws the same triangles from unique vertices
+			const uint32_t* meshletVertices = &table.vertices[table.vertexOffset[m]];
+			vector<bool> used(vertexCount, false);
+			for (uint32_t i = 0; i < triangleCount * 3; ++i)
+			{
+				const uint8_t local = table.primitives[primitiveOffset + i];
+				if (!check(local < vertexCount, "meshlet %u uses local vertex %u of %u", m, local, vertexCount))
+					break;
+				used[local] = true;
+				const uint32_t expected = indices[table.triangleOffset[m] * 3 + i];
+				check(meshletVertices[local] == expected, "meshlet %u corner %u is vertex %u instead of %u", m, i, meshletVertices[local], expected);
+			}
+			primitiveOffset += triangleCount * 3;
+			vector<uint32_t> sorted(meshletVertices, meshletVertices + vertexCount);
+			std::sort(sorted.begin(), sorted.end());
+			check(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end() && std::count(used.begin(), used.end(), false) == 0,
+				"meshlet %u has repeated or unused vertices", m);
+
+			// Bounds, with the rounding of the sphere's center and radius
+			for (uint32_t v = 0; v < vertexCount; ++v)
+			{
+				const XMFLOAT3& p = vertices[meshletVertices[v]].position;
+				const float dx = p.x - table.centerX[m], dy = p.y - table.centerY[m], dz = p.z - table.centerZ[m];
+				const bool inSphere = sqrtf(dx * dx + dy * dy + dz * dz) <= table.radius[m] * 1.0001f + 1e-6f;
+				const bool inBox = p.x >= table.aabbMinX[m] && p.y >= table.aabbMinY[m] && p.z >= table.aabbMinZ[m] &&
+					p.x <= table.aabbMaxX[m] && p.y <= table.aabbMaxY[m] && p.z <= table.aabbMaxZ[m];
+				check(inSphere && inBox, "vertex %u of meshlet %u is outside its bounds", meshletVertices[v], m);
+			}
+
+			// Greedy: the triangle after a meshlet did not fit into it
+			if (m + 1 < table.sectionOffsets[s + 1] && triangleCount < MESHLET_MAX_TRIANGLES)
+			{
+				const uint32_t* next = &indices[nextTriangle * 3];
+				uint32_t newVertices = 0;
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const bool repeated = (c > 0 && next[c] == next[0]) || (c > 1 && next[c] == next[1]);
+					newVertices += !repeated && std::find(meshletVertices, meshletVertices + vertexCount, next[c]) == meshletVertices + vertexCount;
+				}
+				check(vertexCount + newVertices > MESHLET_MAX_VERTICES, "meshlet %u was closed although triangle %u fits", m, nextTriangle);
+			}
+		}
+		check(nextTriangle == section.indexCount / 3, "the meshlets of section %zu cover %u of %u triangles", s, nextTriangle, section.indexCount / 3);
+	}
+
+	// Culling from random cameras around and inside the meshes, against the per triangle reference
+	std::mt19937 generator(7);
+	uint32_t culledVisible = 0, culledMeshlets = 0, totalMeshlets = 0;
+	for (uint32_t view = 0; view < 64; ++view)
+	{
+		const float distance = Random(generator, 0.3f, 4.0f);
+		XMFLOAT3 eye(Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f));
+		const float length = std::max(1e-3f, sqrtf(eye.x * eye.x + eye.y * eye.y + eye.z * eye.z));
+		eye = XMFLOAT3(eye.x / length * distance, eye.y / length * distance, eye.z / length * distance);
+		const XMFLOAT3 target(Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f), Random(generator, -1.0f, 1.0f));
+		const XMMATRIX viewProjection = MakeViewProjection(eye, target);
+		XMFLOAT4 planes[6];
+		SFrustumCulling::ExtractPlanes(viewProjection, planes);
+
+		uint32_t primitiveBase = 0;
+		for (size_t s = 0; s < mesh.sections.size(); ++s)
+		{
+			const SVertex* vertices = &mesh.vertices[mesh.sections[s].baseVertexLocation];
+			const uint32_t first = table.sectionOffsets[s], count = table.sectionOffsets[s + 1] - first;
+			vector<uint32_t> visible;
+			const uint32_t visibleTriangles = SMeshlets::Cull(table, first, count, viewProjection, eye, visible);
+
+			uint32_t expectedTriangles = 0;
+			for (uint32_t m : visible)
+				expectedTriangles += table.triangleCount[m];
+			check(visibleTriangles == expectedTriangles, "view %u: %u visible triangles in meshlets of %u", view, visibleTriangles, expectedTriangles);
+
+			size_t v = 0;
+			for (uint32_t m = first; m < first + count; ++m)
+			{
+				const uint32_t* meshletVertices = &table.vertices[table.vertexOffset[m]];
+				const uint8_t* primitives = &table.primitives[primitiveBase];
+				primitiveBase += table.triangleCount[m] * 3;
+				++totalMeshlets;
+				if (v < visible.size() && visible[v] == m)
+				{
+					++v;
+					continue;
+				}
+				++culledMeshlets;
+				for (uint32_t t = 0; t < table.triangleCount[m]; ++t)
+				{
+					const TriangleVisibility visibility = GetVisibility(vertices[meshletVertices[primitives[t * 3]]],
+						vertices[meshletVertices[primitives[t * 3 + 1]]], vertices[meshletVertices[primitives[t * 3 + 2]]], planes, eye);
+					if (visibility.frontFacing && visibility.inFrustum)
+					{
+						++culledVisible;
+						break;
+					}
+				}
+			}
+			check(v == visible.size(), "view %u: the visible meshlets of section %zu are not ascending", view, s);
+		}
+	}
+	check(culledVisible == 0, "%u culled meshlets have a visible triangle", culledVisible);
+	check(culledMeshlets > totalMeshlets / 4, "only %u of %u meshlets were culled", culledMeshlets, totalMeshlets);
+
+	return check.Result();
+}
+
+// D3D12EngineTests meshletbench [<subdivisions>]
+// Builds the meshlets of a cube sphere in vertex cache order ([subdivisions] quads per cube edge, 512 by default,
+// 3.1M triangles), printing the build time and meshlet sizes. Then culls them from 16 cameras on an orbit and 16
+// close to the surface, printing the triangles the frustum and the cones cull, the best any per meshlet test could
+// do (the triangles that face the camera inside the frustum), and the culling time per meshlet.
+int Tests::BenchmarkMeshlets(int argc, char** argv)
+{
+	Checker check("meshletbench");
+	const uint32_t subdivisions = argc > 0 ? (uint32_t)atoi(argv[0]) : 512;
+	if (!check(subdivisions > 0, "invalid subdivision count %s", argc > 0 ? argv[0] : ""))
+		return check.Result();
+
+	SectionedMesh mesh;
+	mesh.AddSection(Optimized(MakeCubeSphere(subdivisions)));
+	const uint32_t triangleCount = mesh.sections[0].indexCount / 3;
+
+	SMeshletTable table;
+	double buildMilliseconds = 1e30;
+	for (uint32_t run = 0; run < 3; ++run)
+	{
+		Timer timer;
+		SMeshlets::Build(mesh.vertices.data(), mesh.indices.data(), mesh.sections.data(), mesh.sections.size(), table);
+		buildMilliseconds = std::min(buildMilliseconds, timer.Milliseconds());
+	}
+	size_t meshletVertices = 0;
+	for (size_t m = 0; m < table.size(); ++m)
+		meshletVertices += table.vertexCount[m];
+	printf("%zu vertices, %u triangles: %zu meshlets in %.2f ms (%.1f M triangles/s), %.1f vertices and %.1f triangles per meshlet\n",
+		mesh.vertices.size(), triangleCount, table.size(), buildMilliseconds, triangleCount / (buildMilliseconds * 1000.0),
+		(double)meshletVertices / table.size(), (double)triangleCount / table.size());
+
+	struct ViewSet
+	{
+		const char* name;
+		float distance;   // From the center, looking at the center
+		float lookAhead;  // Or, if not 0, along the surface, [lookAhead] ahead
+	};
+	const ViewSet viewSets[] = { { "orbit at 3", 3.0f, 0.0f }, { "surface at 1.1", 1.1f, 1.0f } };
+	for (const ViewSet& set : viewSets)
+	{
+		uint64_t frustumCulled = 0, coneCulled = 0, drawn = 0, ideal = 0, total = 0;
+		double cullMilliseconds = 0.0;
+		for (uint32_t view = 0; view < 16; ++view)
+		{
+			const float angle = XM_2PI * view / 16, height = 0.3f * sinf(angle * 3.0f);
+			const XMFLOAT3 eye(cosf(angle) * set.distance, height, sinf(angle) * set.distance);
+			const XMFLOAT3 target = set.lookAhead > 0.0f ? XMFLOAT3(eye.x - sinf(angle) * set.lookAhead, height * 0.5f, eye.z + cosf(angle) * set.lookAhead) : XMFLOAT3(0, 0, 0);
+			const XMMATRIX viewProjection = MakeViewProjection(eye, target);
+			XMFLOAT4 planes[6];
+			SFrustumCulling::ExtractPlanes(viewProjection, planes);
+
+			vector<uint32_t> visible;
+			visible.reserve(table.size());
+			Timer timer;
+			const uint32_t visibleTriangles = SMeshlets::Cull(table, 0, (uint32_t)table.size(), viewProjection, eye, visible);
+			cullMilliseconds += timer.Milliseconds();
+
+			// Split what was culled into meshlets outside the frustum and meshlets culled by their cone
+			size_t v = 0, primitiveBase = 0;
+			for (uint32_t m = 0; m < table.size(); ++m)
+			{
+				const uint32_t* vertices = &table.vertices[table.vertexOffset[m]];
+				const uint8_t* primitives = &table.primitives[primitiveBase];
+				primitiveBase += table.triangleCount[m] * 3;
+				bool inFrustum = true;
+				for (uint32_t p = 0; p < 6 && inFrustum; ++p)
+				{
+					inFrustum = planes[p].x * table.centerX[m] + planes[p].y * table.centerY[m] + planes[p].z * table.centerZ[m] + planes[p].w >= -table.radius[m];
+				}
+				const bool isVisible = v < visible.size() && visible[v] == m;
+				v += isVisible;
+				if (!inFrustum)
+					frustumCulled += table.triangleCount[m];
+				else if (!isVisible)
+					coneCulled += table.triangleCount[m];
+
+				for (uint32_t t = 0; t < table.triangleCount[m]; ++t)
+				{
+					const TriangleVisibility visibility = GetVisibility(mesh.vertices[vertices[primitives[t * 3]]],
+						mesh.vertices[vertices[primitives[t * 3 + 1]]], mesh.vertices[vertices[primitives[t * 3 + 2]]], planes, eye);
+					ideal += visibility.frontFacing && visibility.inFrustum;
+					check(isVisible || !(visibility.frontFacing && visibility.inFrustum), "%s view %u culled a visible triangle of meshlet %u", set.name, view, m);
+				}
+			}
+			total += triangleCount;
+			drawn += visibleTriangles;
+		}
+		printf("  %-15s frustum culls %5.1f%%, cones cull %5.1f%%, %5.1f%% drawn (%5.1f%% face the camera inside the frustum), %5.2f ms per view, %5.2f ns per meshlet\n",
+			set.name, 100.0 * frustumCulled / total, 100.0 * coneCulled / total, 100.0 * drawn / total,
+			100.0 * ideal / total, cullMilliseconds / 16, cullMilliseconds * 1e6 / 16 / table.size());
+	}
+	return check.Result();
+}
@@ -0,0 +1,271 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "ParallelFor.h"
+#include "SObjReader.h"
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include "tiny_obj_loader.h"
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::vector;
+
+namespace
+{
+	bool ReadWithTinyObj(const std::string& path, tinyobj::attrib_t& outAttrib, vector<tinyobj::shape_t>& outShapes)
+	{
+		tinyobj::ObjReader reader;
+		tinyobj::ObjReaderConfig config;
+		config.triangulate = true;
+		if (!reader.ParseFromFile(path, config))
+			return false;
+		outAttrib = reader.GetAttrib();
+		outShapes = reader.GetShapes();
+		return true;
+	}
+
+	bool SameCorners(const vector<tinyobj::index_t>& a, const vector<tinyobj::index_t>& b)
+	{
+		if (a.size() != b.size())
+			return false;
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (a[i].vertex_index != b[i].vertex_index || a[i].texcoord_index != b[i].texcoord_index || a[i].normal_index != b[i].normal_index)
+				return false;
+		}
+		return true;
+	}
+
+	// Returns an empty string if both readers produced the same geometry, or what differs
+	std::string Compare(const tinyobj::attrib_t& attrib, const vector<tinyobj::shape_t>& shapes,
+		const tinyobj::attrib_t& expectedAttrib, const vector<tinyobj::shape_t>& expectedShapes)
+	{
+		if (attrib.vertices != expectedAttrib.vertices)
+			return "positions differ";
+		if (attrib.texcoords != expectedAttrib.texcoords)
+			return "uvs differ";
+		if (attrib.normals != expectedAttrib.normals)
+			return "normals differ";
+		if (shapes.size() != expectedShapes.size())
+			return std::to_string(shapes.size()) + " shapes instead of " + std::to_string(expectedShapes.size());
+		for (size_t s = 0; s < shapes.size(); ++s)
+		{
+			if (shapes[s].name != expectedShapes[s].name)
+				return "shape " + std::to_string(s) + " is named " + shapes[s].name + " instead of " + expectedShapes[s].name;
+			if (!SameCorners(shapes[s].mesh.indices, expectedShapes[s].mesh.indices))
+				return "corners of shape " + std::to_string(s) + " differ";
+			if (shapes[s].mesh.num_face_vertices != expectedShapes[s].mesh.num_face_vertices)
+				return "faces of shape " + std::to_string(s) + " differ";
+		}
+		return std::string();
+	}
+
+	// Thread counts to time: 1, 2, 4, ... and the core count
+	vector<uint32_t> GetThreadCounts()
+	{
+		const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+		vector<uint32_t> counts;
+		for (uint32_t threads = 1; threads < cores; threads *= 2)
+			counts.push_back(threads);
+		counts.push_back(cores);
+		return counts;
+	}
+}
+
+// D3D12EngineTests objreader
+// SObjReader reads what tinyobj reads, from any thread count, and leaves files it does not handle to tinyobj.
+int Tests::TestObjReader(int, char**)
+{
+	Checker check("objreader");
+	const std::string path = GetTempPath("D3D12EngineTests_objreader.obj");
+
+	// Relative and absolute indices, every corner form, comments, CRLF line endings, a quad and shapes from o and g
+	const char* const handWritten =
+		"# comment\r\n"
+		"v 0 0 0\r\nv 1 0 0\r\nv 1 1 0\r\nv 0 1 0\r\n"
+		"vt 0 0\r\nvt 1 0\r\nvt 1 1\r\n"
+		"vn 0 0 1\r\n"
+		"o first\r\n"
+		"f 1 2 3\r\n"
+		"f 1/1 2/2 3/3 # trailing comment\r\n"
+		"s off\r\n"
+		"f -4//-1 -3//-1 -2//-1\r\n"
+		"g second\r\n"
+		"f 1/1/1 2/2/1 3/3/1 4/1/1\r\n"
+		"v 2 2 1.5e-1\r\n"
+		"f -1 -2 -3\n";
+	{
+		tinyobj::attrib_t expectedAttrib;
+		vector<tinyobj::shape_t> expectedShapes;
+		SObjReader reader;
+		if (check(WriteTextFile(path, handWritten), "failed to write %s", path.c_str()) &&
+			check(ReadWithTinyObj(path, expectedAttrib, expectedShapes), "tinyobj failed to read the hand written file") &&
+			check(reader.Parse(path.c_str(), 1), "SObjReader failed to read the hand written file"))
+		{
+			const std::string difference = Compare(reader.GetAttrib(), reader.GetShapes(), expectedAttrib, expectedShapes);
+			check(difference.empty(), "hand written file: %s", difference.c_str());
+		}
+	}
+
+	// A grid of several MB, so every thread count splits it into that many chunks
+	{
+		tinyobj::attrib_t expectedAttrib;
+		vector<tinyobj::shape_t> expectedShapes;
+		if (check(WriteTextFile(path, MakeGridOBJ(256, 3)), "failed to write %s", path.c_str()) &&
+			check(ReadWithTinyObj(path, expectedAttrib, expectedShapes), "tinyobj failed to read the grid"))
+		{
+			for (uint32_t threads = 1; threads <= 5; ++threads)
+			{
+				SObjReader reader;
+				if (!check(reader.Parse(path.c_str(), threads), "SObjReader failed to read the grid with %u threads", threads))
+					continue;
+				check(reader.GetThreadCount() == threads, "the grid was split into %u chunks for %u threads", reader.GetThreadCount(), threads);
+				const std::string difference = Compare(reader.GetAttrib(), reader.GetShapes(), expectedAttrib, expectedShapes);
+				check(difference.empty(), "grid with %u threads: %s", threads, difference.c_str());
+			}
+		}
+	}
+
+	// Statements and faces tinyobj has to handle
+	const char* const unsupported[] = {
+		"mtllib scene.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n",
+		"v 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl stone\nf 1 2 3\n",
+		"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 2 0\nf 1 2 3 4 5\n",
+		"v 0 0 0\nv 1 0 0\nl 1 2\n",
+		"v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n",
+		"v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 x\n",
+	};
+	for (const char* text : unsupported)
+	{
+		SObjReader reader;
+		if (check(WriteTextFile(path, text), "failed to write %s", path.c_str()))
+			check(!reader.Parse(path.c_str(), 1), "SObjReader accepted \"%s\"", text);
+	}
+	SObjReader reader;
+	check(!reader.Parse(GetTempPath("D3D12EngineTests_missing.obj").c_str()), "SObjReader opened a missing file");
+
+	remove(path.c_str());
+	return check.Result();
+}
+
+// D3D12EngineTests objbench [<obj>...]
+// Reads each OBJ file (a generated grid of about 80 MB if none is given) with tinyobj and with SObjReader at
+// 1, 2, 4, ... threads up to the core count, printing MB/s and the speedup over one thread. Fails if the
+// result depends on the thread count.
+int Tests::BenchmarkObjReader(int argc, char** argv)
+{
+	Checker check("objbench");
+	vector<std::string> paths(argv, argv + argc);
+	const std::string generated = GetTempPath("D3D12EngineTests_objbench.obj");
+	if (paths.empty())
+	{
+		if (!check(WriteTextFile(generated, MakeGridOBJ(708, 4)), "failed to write %s", generated.c_str()))
+			return check.Result();
+		paths.push_back(generated);
+	}
+
+	for (const std::string& path : paths)
+	{
+		tinyobj::attrib_t attrib;
+		vector<tinyobj::shape_t> shapes;
+		Timer timer;
+		if (!check(ReadWithTinyObj(path, attrib, shapes), "tinyobj failed to read %s", path.c_str()))
+			continue;
+		const double tinyobjMilliseconds = timer.Milliseconds();
+
+		SObjReader reference;
+		if (!check(reference.Parse(path.c_str(), 1), "SObjReader cannot read %s (not a plain geometry file)", path.c_str()))
+			continue;
+		const double megabytes = reference.GetFileSize() / 1048576.0;
+		printf("%s: %.1f MB\n", path.c_str(), megabytes);
+		printf("  tinyobj             %9.2f ms, %8.1f MB/s\n", tinyobjMilliseconds, megabytes / (tinyobjMilliseconds / 1000.0));
+
+		double singleThreaded = 0.0;
+		for (uint32_t threads : GetThreadCounts())
+		{
+			// Best of 3, the file is in the page cache after the first read
+			double best = 1e30;
+			for (uint32_t run = 0; run < 3; ++run)
+			{
+				SObjReader reader;
+				reader.Parse(path.c_str(), threads);
+				best = std::min(best, reader.GetParseMilliseconds());
+				if (run == 0)
+				{
+					const std::string difference = Compare(reader.GetAttrib(), reader.GetShapes(), reference.GetAttrib(), reference.GetShapes());
+					check(difference.empty(), "%s with %u threads: %s", path.c_str(), threads, difference.c_str());
+				}
+			}
+			if (threads == 1)
+				singleThreaded = best;
+			printf("  SObjReader %2u threads %7.2f ms, %8.1f MB/s, %5.2fx one thread, %5.2fx tinyobj\n", threads, best,
+				megabytes / (best / 1000.0), singleThreaded / best, tinyobjMilliseconds / best);
+		}
+	}
+	remove(generated.c_str());
+	return check.Result();
+}
+
+// D3D12EngineTests parallelforbench
+// ParallelFor at 1, 2, 4, ... threads up to the core count, over 256 MB in 1 MB items, which is bandwidth bound,
+// and over a million items of a few hundred instructions each, which shows the cost of handing out items.
+int Tests::BenchmarkParallelFor(int, char**)
+{
+	Checker check("parallelforbench");
+	constexpr uint32_t BLOCK_SIZE = 1 << 20, BLOCK_COUNT = 256;
+	vector<uint8_t> data((size_t)BLOCK_SIZE * BLOCK_COUNT);
+	for (size_t i = 0; i < data.size(); ++i)
+		data[i] = (uint8_t)(i * 7 + (i >> 12));
+
+	uint64_t expectedSum = 0;
+	double singleThreaded[2] = {};
+	for (uint32_t threads : GetThreadCounts())
+	{
+		// Byte sums of each block
+		vector<uint64_t> sums(BLOCK_COUNT);
+		Timer timer;
+		ParallelFor(BLOCK_COUNT, [&](uint32_t block)
+		{
+			const uint8_t* bytes = &data[(size_t)block * BLOCK_SIZE];
+			uint64_t sum = 0;
+			for (uint32_t i = 0; i < BLOCK_SIZE; ++i)
+				sum += bytes[i];
+			sums[block] = sum;
+		}, threads);
+		const double blockMilliseconds = timer.Milliseconds();
+		uint64_t sum = 0;
+		for (uint64_t s : sums)
+			sum += s;
+
+		// A short hash chain per item
+		constexpr uint32_t ITEM_COUNT = 1 << 20;
+		std::atomic<uint64_t> hashes(0);
+		timer.Restart();
+		ParallelFor(ITEM_COUNT, [&](uint32_t item)
+		{
+			uint32_t h = item;
+			for (uint32_t i = 0; i < 64; ++i)
+				h = (h ^ (h >> 15)) * 0x2c1b3c6dU;
+			if ((h & 0xFFFF) == 0)
+				hashes += h;
+		}, threads);
+		const double itemMilliseconds = timer.Milliseconds();
+
+		if (threads == 1)
+		{
+			expectedSum = sum;
+			singleThreaded[0] = blockMilliseconds;
+			singleThreaded[1] = itemMilliseconds;
+		}
+		check(sum == expectedSum, "%u threads summed %llu instead of %llu", threads, (unsigned long long)sum, (unsigned long long)expectedSum);
+		printf("%2u threads: 1 MB items %8.2f ms, %6.2f GB/s, %5.2fx one thread; small items %8.2f ms, %6.1f ns per item, %5.2fx one thread\n",
+			threads, blockMilliseconds, data.size() / (blockMilliseconds / 1000.0) / 1e9, singleThreaded[0] / blockMilliseconds,
+			itemMilliseconds, itemMilliseconds * 1e6 / ITEM_COUNT, singleThreaded[1] / itemMilliseconds);
+	}
+	return check.Result();
+}
@@ -0,0 +1,247 @@
+#include "Tests.h"
+
+#include "SSphericalHarmonics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace DirectX;
+using namespace SSphericalHarmonics;
+using std::vector;
+
+namespace
+{
+	const XMFLOAT3 NORMALS[] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, -1.0f, 0.0f },
+		{ 0.577350f, 0.577350f, 0.577350f }, { -0.6f, 0.0f, 0.8f }, { 0.0f, -0.8f, -0.6f }, { 0.48f, -0.6f, 0.64f } };
+	constexpr uint32_t NORMAL_COUNT = sizeof(NORMALS) / sizeof(NORMALS[0]);
+
+	// RGBA float faces in D3D order
+	struct Cubemap
+	{
+		uint32_t size;
+		vector<float> texels;
+		const float* faces[6];
+
+		// [radiance](direction, rgb) fills a texel
+		template<typename Radiance>
+		Cubemap(uint32_t size, Radiance&& radiance) : size(size), texels((size_t)6 * size * size * 4, 1.0f)
+		{
+			for (uint32_t face = 0; face < 6; ++face)
+			{
+				faces[face] = texels.data() + (size_t)face * size * size * 4;
+				for (uint32_t y = 0; y < size; ++y)
+				{
+					for (uint32_t x = 0; x < size; ++x)
+						radiance(GetTexelDirection(face, x, y, size), &texels[(((size_t)face * size + y) * size + x) * 4]);
+				}
+			}
+		}
+
+		inline size_t GetRowPitch() const { return (size_t)size * 4 * sizeof(float); }
+	};
+
+	// A sky brightening towards the zenith over a dim ground: low frequency, as irradiance SH assume
+	Cubemap MakeSky(uint32_t size)
+	{
+		return Cubemap(size, [](const XMFLOAT3& direction, float* rgb)
+		{
+			const float up = std::max(direction.y, 0.0f);
+			rgb[0] = 0.3f + 0.5f * up;
+			rgb[1] = 0.35f + 0.3f * up;
+			rgb[2] = 0.4f + 0.6f * up;
+		});
+	}
+
+	// Irradiance over pi of [cubemap] around [normal] in double precision: every texel weighted by its solid angle,
+	// from the closed form, and the clamped cosine
+	XMFLOAT3 IntegrateIrradiance(const Cubemap& cubemap, const XMFLOAT3& normal)
+	{
+		const uint32_t size = cubemap.size;
+		double sum[3] = {};
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t y = 0; y < size; ++y)
+			{
+				for (uint32_t x = 0; x < size; ++x)
+				{
+					const XMFLOAT3 direction = GetTexelDirection(face, x, y, size);
+					const double cosine = (double)direction.x * normal.x + (double)direction.y * normal.y + (double)direction.z * normal.z;
+					if (cosine <= 0.0)
+						continue;
+					const double u = (x + 0.5) * 2.0 / size - 1.0, v = (y + 0.5) * 2.0 / size - 1.0;
+					const double solidAngle = 4.0 / ((double)size * size) / pow(1.0 + u * u + v * v, 1.5);
+					const float* texel = cubemap.faces[face] + ((size_t)y * size + x) * 4;
+					for (uint32_t c = 0; c < 3; ++c)
+						sum[c] += texel[c] * cosine * solidAngle / XM_PI;
+				}
+			}
+		}
+		return XMFLOAT3((float)sum[0], (float)sum[1], (float)sum[2]);
+	}
+
+	float MaxDifference(const XMFLOAT3* a, const XMFLOAT3* b, uint32_t count)
+	{
+		float difference = 0.0f;
+		for (uint32_t k = 0; k < count; ++k)
+			difference = std::max({ difference, fabsf(a[k].x - b[k].x), fabsf(a[k].y - b[k].y), fabsf(a[k].z - b[k].z) });
+		return difference;
+	}
+
+	bool IsSupported(Kernel kernel)
+	{
+		return (int)kernel <= (int)GetBestKernel();
+	}
+
+	// Checks every supported kernel on [size] x [size] faces against the scalar one and the brute force integral:
+	// a constant environment gives exactly that irradiance, SIMD kernels agree with the scalar one to float rounding,
+	// one thread gives the bits all of them give, and SH9 irradiance of the sky is within 2% of the integral.
+	void CheckKernels(Tests::Checker& check, uint32_t size)
+	{
+		const Cubemap sky = MakeSky(size);
+		const Cubemap constant(size, [](const XMFLOAT3&, float*) {});
+
+		XMFLOAT3 integral[NORMAL_COUNT];
+		for (uint32_t n = 0; n < NORMAL_COUNT; ++n)
+			integral[n] = IntegrateIrradiance(sky, NORMALS[n]);
+		XMFLOAT3 reference[MAX_COEFFICIENTS];
+		ProjectCubemap(sky.faces, sky.GetRowPitch(), size, 4, reference, Kernel::Scalar);
+
+		for (Kernel kernel : { Kernel::Scalar, Kernel::SSE, Kernel::AVX2 })
+		{
+			if (!IsSupported(kernel))
+				continue;
+			const char* name = GetKernelName(kernel);
+
+			XMFLOAT3 coefficients[MAX_COEFFICIENTS], irradiance[IRRADIANCE_COEFFICIENTS];
+			ProjectCubemap(constant.faces, constant.GetRowPitch(), size, 4, coefficients, kernel);
+			ConvolveIrradiance(coefficients, 4, irradiance);
+			float constantError = 0.0f;
+			for (const XMFLOAT3& normal : NORMALS)
+				constantError = std::max(constantError, fabsf(Evaluate(irradiance, 3, normal).x - 1.0f));
+			check(constantError < 1e-4f, "%s, size %u: a constant environment is off by %g", name, size, constantError);
+
+			// Kernels sum in different orders, so they agree to float rounding of the coefficients
+			ProjectCubemap(sky.faces, sky.GetRowPitch(), size, 4, coefficients, kernel);
+			const float kernelError = MaxDifference(coefficients, reference, MAX_COEFFICIENTS);
+			check(kernelError < 1e-5f, "%s, size %u: %g from the scalar kernel", name, size, kernelError);
+
+			XMFLOAT3 singleThread[MAX_COEFFICIENTS];
+			ProjectCubemap(sky.faces, sky.GetRowPitch(), size, 4, singleThread, kernel, 1);
+			check(memcmp(singleThread, coefficients, sizeof(coefficients)) == 0, "%s, size %u: one thread gives other bits than all", name, size);
+
+			// SH9 leaves out the higher bands of the horizon's kink, a few percent at most after the cosine convolution
+			ConvolveIrradiance(coefficients, 3, irradiance);
+			float relativeError = 0.0f;
+			for (uint32_t n = 0; n < NORMAL_COUNT; ++n)
+			{
+				const XMFLOAT3 value = Evaluate(irradiance, 3, NORMALS[n]);
+				relativeError = std::max({ relativeError, fabsf(value.x - integral[n].x) / integral[n].x,
+					fabsf(value.y - integral[n].y) / integral[n].y, fabsf(value.z - integral[n].z) / integral[n].z });
+			}
+			check(relativeError < 0.02f, "%s, size %u: SH9 irradiance %.2f%% from the integral", name, size, relativeError * 100.0f);
+		}
+	}
+}
+
+// D3D12EngineTests sh
+// SH projection and irradiance: every texel direction maps back to its face and coordinates, each SH16 basis function
+// projects onto itself alone (the basis is orthonormal under the solid angle weights), and CheckKernels on faces whose
+// size is not a multiple of 8, so the SIMD kernels run their tails, and on ones that are.
+int Tests::TestSphericalHarmonics(int, char**)
+{
+	Checker check("sh");
+
+	{
+		constexpr uint32_t SIZE = 16;
+		uint32_t wrong = 0;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t t = 0; t < SIZE * SIZE; ++t)
+			{
+				const uint32_t x = t % SIZE, y = t / SIZE;
+				float u, v;
+				const uint32_t found = GetDirectionFace(GetTexelDirection(face, x, y, SIZE), u, v);
+				wrong += found != face || fabsf(u - ((x + 0.5f) * 2.0f / SIZE - 1.0f)) > 1e-5f || fabsf(v - ((y + 0.5f) * 2.0f / SIZE - 1.0f)) > 1e-5f;
+			}
+		}
+		check(wrong == 0, "%u texel directions don't map back to their texel", wrong);
+
+		const vector<float> solidAngles = ComputeTexelSolidAngles(SIZE);
+		double sphere = 0.0;
+		for (float solidAngle : solidAngles)
+			sphere += 6.0 * solidAngle;
+		check(fabs(sphere - 4.0 * XM_PI) < 1e-4, "texel solid angles add up to %.6f, not 4 pi", sphere);
+	}
+
+	// Texels sample the basis at their centers, which integrates the degree 6 products of band 3 to about 1e-4 at 64
+	{
+		constexpr uint32_t SIZE = 64;
+		float worst = 0.0f;
+		uint32_t worstBasis = 0;
+		for (uint32_t k = 0; k < MAX_COEFFICIENTS; ++k)
+		{
+			const Cubemap basis(SIZE, [k](const XMFLOAT3& direction, float* rgb)
+			{
+				float values[MAX_COEFFICIENTS];
+				EvaluateBasis(4, direction, values);
+				rgb[0] = rgb[1] = rgb[2] = values[k];
+			});
+			XMFLOAT3 coefficients[MAX_COEFFICIENTS];
+			ProjectCubemap(basis.faces, basis.GetRowPitch(), SIZE, 4, coefficients, Kernel::Scalar);
+			for (uint32_t j = 0; j < MAX_COEFFICIENTS; ++j)
+			{
+				const float error = fabsf(coefficients[j].x - (j == k ? 1.0f : 0.0f));
+				if (error > worst)
+				{
+					worst = error;
+					worstBasis = k;
+				}
+			}
+		}
+		check(worst < 1e-3f, "basis %u projects %g away from itself alone", worstBasis, worst);
+	}
+
+	CheckKernels(check, 33);
+	CheckKernels(check, 64);
+	return check.Result();
+}
+
+// D3D12EngineTests shbench [<size>]
+// SH16 projection of a sky with [size] x [size] faces, 128 by default, with every kernel the CPU supports, best of 10
+// runs, and the checks of the sh test at that size. Fails if a check does.
+int Tests::BenchmarkSphericalHarmonics(int argc, char** argv)
+{
+	Checker check("shbench");
+	const uint32_t size = argc > 0 ? (uint32_t)std::max(1, atoi(argv[0])) : 128;
+	constexpr uint32_t RUNS = 10;
+
+	CheckKernels(check, size);
+
+	const Cubemap sky = MakeSky(size);
+	double scalarMilliseconds = 0.0;
+	for (Kernel kernel : { Kernel::Scalar, Kernel::SSE, Kernel::AVX2 })
+	{
+		if (!IsSupported(kernel))
+			continue;
+
+		double fastest = 1e30, fastestSingle = 1e30;
+		XMFLOAT3 coefficients[MAX_COEFFICIENTS];
+		for (uint32_t run = 0; run < RUNS; ++run)
+		{
+			Timer timer;
+			ProjectCubemap(sky.faces, sky.GetRowPitch(), size, 4, coefficients, kernel);
+			fastest = std::min(fastest, timer.Milliseconds());
+			timer.Restart();
+			ProjectCubemap(sky.faces, sky.GetRowPitch(), size, 4, coefficients, kernel, 1);
+			fastestSingle = std::min(fastestSingle, timer.Milliseconds());
+		}
+		if (kernel == Kernel::Scalar)
+			scalarMilliseconds = fastestSingle;
+		printf("%-6s %u x %u x 6: %8.3f ms on one thread (%.2fx scalar), %8.3f ms on all, %.1f M texels/s\n", GetKernelName(kernel), size, size,
+			fastestSingle, scalarMilliseconds / fastestSingle, fastest, 6.0 * size * size / (fastest * 1000.0));
+	}
+	return check.Result();
+}
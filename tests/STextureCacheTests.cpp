@@ -0,0 +1,320 @@
+#include "Tests.h"
+#include "TestMeshes.h"
+
+#include "MappedFile.h"
+#include "STextureCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace
+{
+	constexpr uint64_t SOURCE_HASH = 0x5E7;
+
+	// The cooked formats the mip filter handles, with the byte range of one texel
+	struct TestFormat
+	{
+		DXGI_FORMAT format;
+		const char* name;
+		uint32_t channels;
+		uint32_t channelSize;
+	};
+
+	const TestFormat FORMATS[] = {
+		{ DXGI_FORMAT_R8G8B8A8_UNORM, "RGBA8", 4, 1 },
+		{ DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, "RGBA8 sRGB", 4, 1 },
+		{ DXGI_FORMAT_R32G32B32A32_FLOAT, "RGBA32F", 4, 4 },
+	};
+
+	// Odd and non-square sizes, so that filtering blends 3 texels and one side reaches 1 before the other
+	const uint32_t SIZES[][2] = { { 37, 11 }, { 5, 5 }, { 1, 7 }, { 64, 3 } };
+
+	// The sRGB transfer function in double precision
+	double SRGBToLinear(double value)
+	{
+		return value <= 0.04045 ? value / 12.92 : pow((value + 0.055) / 1.055, 2.4);
+	}
+
+	// Channel [c] of texel ([x], [y]) of a placed mip, linear
+	double Decode(const TestFormat& format, const uint8_t* mipData, const STextureCache::Mip& mip, uint32_t x, uint32_t y, uint32_t c)
+	{
+		const uint8_t* texel = mipData + (uint64_t)y * mip.rowPitch + (uint64_t)x * format.channels * format.channelSize;
+		if (format.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+		{
+			float value;
+			memcpy(&value, texel + c * sizeof(float), sizeof(float));
+			return value;
+		}
+		const double value = texel[c] / 255.0;
+		return format.format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB && c < 3 ? SRGBToLinear(value) : value;
+	}
+
+	// The byte a linear value should be stored as: rounded for UNORM, the byte whose decoded value is nearest for sRGB
+	uint8_t EncodeByte(const TestFormat& format, uint32_t c, double value)
+	{
+		if (format.format != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB || c == 3)
+			return (uint8_t)floor(std::clamp(value, 0.0, 1.0) * 255.0 + 0.5);
+
+		uint8_t best = 0;
+		for (uint32_t b = 1; b < 256; ++b)
+		{
+			if (fabs(SRGBToLinear(b / 255.0) - value) < fabs(SRGBToLinear(best / 255.0) - value))
+				best = (uint8_t)b;
+		}
+		return best;
+	}
+
+	// How much of source texel [texel] lies in [begin, end)
+	double Coverage(uint32_t texel, double begin, double end)
+	{
+		return std::max(0.0, std::min(end, texel + 1.0) - std::max(begin, (double)texel));
+	}
+
+	// Scalar box filter of destination texel ([x], [y]): every source texel weighted by the area of it the
+	// destination texel covers, so odd sizes blend partial texels
+	double BoxFilter(const TestFormat& format, const uint8_t* srcData, const STextureCache::Mip& src, const STextureCache::Mip& dst,
+		uint32_t x, uint32_t y, uint32_t c)
+	{
+		const double ratioX = (double)src.width / dst.width;
+		const double ratioY = (double)src.height / dst.height;
+		double sum = 0.0;
+		for (uint32_t sy = 0; sy < src.height; ++sy)
+		{
+			const double weightY = Coverage(sy, y * ratioY, (y + 1) * ratioY);
+			if (weightY == 0.0)
+				continue;
+			for (uint32_t sx = 0; sx < src.width; ++sx)
+			{
+				const double weightX = Coverage(sx, x * ratioX, (x + 1) * ratioX);
+				if (weightX != 0.0)
+					sum += weightX * weightY * Decode(format, srcData, src, sx, sy, c);
+			}
+		}
+		return sum / (ratioX * ratioY);
+	}
+
+	// Deterministic texels in [0, 1]
+	vector<uint8_t> MakePixels(const TestFormat& format, uint32_t width, uint32_t height)
+	{
+		vector<uint8_t> pixels((size_t)width * height * format.channels * format.channelSize);
+		uint32_t state = 12345;
+		for (size_t i = 0; i < pixels.size() / format.channelSize; ++i)
+		{
+			state = state * 1664525u + 1013904223u;
+			if (format.channelSize == 1)
+			{
+				pixels[i] = (uint8_t)(state >> 24);
+			}
+			else
+			{
+				const float value = (state >> 8) / 16777216.0f;
+				memcpy(pixels.data() + i * sizeof(float), &value, sizeof(float));
+			}
+		}
+		return pixels;
+	}
+
+	// Whether every subresource of [view] is where D3D12 expects a placed footprint: the data block and every
+	// offset on a PLACEMENT_ALIGNMENT boundary of [file], every row pitch a multiple of PITCH_ALIGNMENT
+	bool IsPlaced(const STextureCache::View& view, const uint8_t* file)
+	{
+		if ((view.data - file) % STextureCache::PLACEMENT_ALIGNMENT != 0)
+			return false;
+		for (uint32_t i = 0; i < view.mipCount * view.arraySize; ++i)
+		{
+			const STextureCache::Mip& mip = view.mips[i];
+			if (mip.offset % STextureCache::PLACEMENT_ALIGNMENT != 0 || mip.rowPitch % STextureCache::PITCH_ALIGNMENT != 0 || mip.rowPitch < mip.rowSize)
+				return false;
+		}
+		return true;
+	}
+}
+
+// D3D12EngineTests texturecache
+// .stex cooking and caches: mip counts and sizes of odd and non-square textures, and every mip against a scalar box
+// filter of the one above it, with sRGB texels filtered in linear space and UNORM ones as they are. Every subresource
+// offset and row pitch, compressed and cubemap textures included, is 512 and 256 byte aligned. A cache written with
+// Write maps back through MappedFile and validates to the same texels; truncated files, another source or settings
+// hash and a tampered mip table are rejected.
+int Tests::TestTextureCache(int, char**)
+{
+	Checker check("texturecache");
+	const STextureCache::Settings settings;
+	const uint64_t settingsHash = STextureCache::HashSettings(settings);
+
+	// Mip chains against the scalar reference
+	for (const TestFormat& format : FORMATS)
+	{
+		for (const auto& size : SIZES)
+		{
+			const uint32_t width = size[0], height = size[1];
+			const vector<uint8_t> pixels = MakePixels(format, width, height);
+			vector<uint8_t> image;
+			STextureCache::Cook(pixels.data(), format.format, width, height, settings, SOURCE_HASH, image);
+			STextureCache::View view;
+			if (!check(STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, settingsHash, view), "%s %ux%u: the cooked image doesn't validate",
+				format.name, width, height))
+				continue;
+
+			// Down to 1 x 1, halving and rounding down
+			const uint32_t mipCount = (uint32_t)floor(log2((double)std::max(width, height))) + 1;
+			check(view.mipCount == mipCount && view.arraySize == 1 && view.width == width && view.height == height, "%s %ux%u: %u mips, expected %u",
+				format.name, width, height, view.mipCount, mipCount);
+			uint32_t mipWidth = width, mipHeight = height;
+			for (uint32_t m = 0; m < std::min(view.mipCount, mipCount); ++m)
+			{
+				const STextureCache::Mip& mip = view.mips[m];
+				check(mip.width == mipWidth && mip.height == mipHeight && mip.rowSize == mipWidth * format.channels * format.channelSize && mip.rowCount == mipHeight,
+					"%s %ux%u: mip %u is %ux%u, expected %ux%u", format.name, width, height, m, mip.width, mip.height, mipWidth, mipHeight);
+				mipWidth = std::max(mipWidth / 2, 1u);
+				mipHeight = std::max(mipHeight / 2, 1u);
+			}
+			check(IsPlaced(view, image.data()), "%s %ux%u: misaligned subresources", format.name, width, height);
+
+			// Mip 0 is the source, each level after it is filtered from the one above
+			bool sameSource = true;
+			for (uint32_t y = 0; y < height; ++y)
+				sameSource &= memcmp(view.data + view.mips[0].offset + (uint64_t)y * view.mips[0].rowPitch, pixels.data() + (size_t)y * view.mips[0].rowSize, view.mips[0].rowSize) == 0;
+			check(sameSource, "%s %ux%u: mip 0 differs from the source", format.name, width, height);
+
+			double maxError = 0.0;
+			for (uint32_t m = 1; m < view.mipCount; ++m)
+			{
+				const STextureCache::Mip& src = view.mips[m - 1];
+				const STextureCache::Mip& dst = view.mips[m];
+				for (uint32_t y = 0; y < dst.height; ++y)
+				{
+					for (uint32_t x = 0; x < dst.width; ++x)
+					{
+						for (uint32_t c = 0; c < format.channels; ++c)
+						{
+							const double expected = BoxFilter(format, view.data + src.offset, src, dst, x, y, c);
+							const uint8_t* texel = view.data + dst.offset + (uint64_t)y * dst.rowPitch + (uint64_t)x * format.channels * format.channelSize;
+							if (format.channelSize == 1)
+								maxError = std::max(maxError, fabs((double)texel[c] - EncodeByte(format, c, expected)));
+							else
+								maxError = std::max(maxError, fabs(Decode(format, view.data + dst.offset, dst, x, y, c) - expected));
+						}
+					}
+				}
+			}
+			// One step of rounding for bytes, float accumulation for floats
+			const double tolerance = format.channelSize == 1 ? 1.0 : 1e-6;
+			check(maxError <= tolerance, "%s %ux%u: mips are up to %g from the box filter", format.name, width, height, maxError);
+		}
+	}
+
+	// Black and white texels average to half the light in sRGB, 188, and to half the byte range in UNORM, 128. Alpha is linear in both.
+	{
+		const uint8_t checker[2 * 2 * 4] = { 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0 };
+		const struct { DXGI_FORMAT format; const char* name; uint8_t expected; } cases[] = {
+			{ DXGI_FORMAT_R8G8B8A8_UNORM, "UNORM", 128 },
+			{ DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, "sRGB", 188 },
+		};
+		for (const auto& c : cases)
+		{
+			vector<uint8_t> image;
+			STextureCache::Cook(checker, c.format, 2, 2, settings, SOURCE_HASH, image);
+			STextureCache::View view;
+			if (check(STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, settingsHash, view) && view.mipCount == 2, "%s checker: no 1x1 mip", c.name))
+			{
+				const uint8_t* texel = view.data + view.mips[1].offset;
+				check(texel[0] == c.expected && texel[1] == c.expected && texel[2] == c.expected && texel[3] == 128,
+					"%s checker: 1x1 mip is %u %u %u %u, expected %u and alpha 128", c.name, texel[0], texel[1], texel[2], texel[3], c.expected);
+			}
+		}
+	}
+
+	// Placement of the formats and layouts the other checks don't cook: narrow texels, block compression and cube faces
+	{
+		const uint16_t halves[4 * 4 * 6] = {};
+		vector<uint8_t> image;
+		STextureCache::View view;
+		STextureCache::Cook(halves, DXGI_FORMAT_R16_FLOAT, 13, 3, settings, SOURCE_HASH, image);
+		check(STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, settingsHash, view) && IsPlaced(view, image.data()),
+			"R16F: misaligned subresources");
+
+		STextureCache::Settings compressed;
+		compressed.compression = STextureCache::Compression::BC1;
+		const vector<uint8_t> pixels = MakePixels(FORMATS[0], 20, 12);
+		STextureCache::Cook(pixels.data(), DXGI_FORMAT_R8G8B8A8_UNORM, 20, 12, compressed, SOURCE_HASH, image);
+		check(STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, STextureCache::HashSettings(compressed), view)
+			&& view.format == DXGI_FORMAT_BC1_UNORM && view.mipCount == 5 && IsPlaced(view, image.data()), "BC1: misaligned subresources or wrong format");
+
+		// 6 faces of 4x4, 2x2 and 1x1
+		vector<STextureCache::Subresource> subresources;
+		for (uint32_t face = 0; face < 6; ++face)
+		{
+			for (uint32_t mip = 0; mip < 3; ++mip)
+				subresources.push_back({ halves, (size_t)(4 >> mip) * 8 });
+		}
+		STextureCache::CookSubresources(subresources.data(), DXGI_FORMAT_R16G16B16A16_FLOAT, 4, 4, 3, 6, true, settings, SOURCE_HASH, image);
+		check(STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, settingsHash, view) && view.cubemap && view.arraySize == 6
+			&& IsPlaced(view, image.data()), "cubemap: misaligned subresources");
+	}
+
+	// Write, map and validate, then damaged copies of the same file
+	{
+		const TestFormat& format = FORMATS[1];
+		const vector<uint8_t> pixels = MakePixels(format, 37, 11);
+		vector<uint8_t> image;
+		STextureCache::Cook(pixels.data(), format.format, 37, 11, settings, SOURCE_HASH, image);
+		const string path = GetTempPath("D3D12EngineTests_texturecache.stex");
+		check(STextureCache::Write(path.c_str(), image), "failed to write %s", path.c_str());
+
+		MappedFile file;
+		STextureCache::View view;
+		if (check(file.Open(path.c_str()) && file.size() == image.size(), "%s doesn't map back", path.c_str())
+			&& check(STextureCache::Validate(file.data(), file.size(), SOURCE_HASH, settingsHash, view), "the written cache doesn't validate"))
+		{
+			check(view.format == format.format && view.width == 37 && view.height == 11 && view.mipCount == 6 && !view.cubemap && IsPlaced(view, file.data()),
+				"the written cache reads back as %ux%u with %u mips", view.width, view.height, view.mipCount);
+			check(view.dataSize == file.size() - (uint64_t)(view.data - file.data()) && memcmp(file.data(), image.data(), image.size()) == 0,
+				"the written cache differs from the cooked image");
+		}
+		file.Close();
+		std::error_code error;
+		std::filesystem::remove(path, error);
+
+		STextureCache::Header header;
+		memcpy(&header, image.data(), sizeof(header));
+		const uint64_t truncated[] = { image.size() - 1, header.dataOffset, sizeof(STextureCache::Header), sizeof(STextureCache::Header) - 1, 0 };
+		for (uint64_t size : truncated)
+			check(!STextureCache::Validate(image.data(), size, SOURCE_HASH, settingsHash, view), "a file truncated to %llu bytes validates", (unsigned long long)size);
+
+		STextureCache::Settings other;
+		other.generateMips = 0;
+		check(!STextureCache::Validate(image.data(), image.size(), SOURCE_HASH, STextureCache::HashSettings(other), view), "another settings hash validates");
+		check(!STextureCache::Validate(image.data(), image.size(), SOURCE_HASH + 1, settingsHash, view), "another source hash validates");
+
+		// Each edit of the mip table breaks the layout D3D12 would be given
+		const struct { const char* name; void (*tamper)(STextureCache::Header&); } tampers[] = {
+			{ "a wider mip", [](STextureCache::Header& h) { ++h.mips[1].width; } },
+			{ "a taller mip", [](STextureCache::Header& h) { ++h.mips[2].height; } },
+			{ "a short row pitch", [](STextureCache::Header& h) { h.mips[0].rowPitch -= STextureCache::PITCH_ALIGNMENT; } },
+			{ "an unaligned row pitch", [](STextureCache::Header& h) { h.mips[0].rowPitch += 4; } },
+			{ "an unaligned offset", [](STextureCache::Header& h) { h.mips[1].offset += 4; } },
+			{ "an offset past the data", [](STextureCache::Header& h) { h.mips[h.mipCount - 1].offset = h.dataSize; } },
+			{ "an extra row", [](STextureCache::Header& h) { ++h.mips[0].rowCount; } },
+			{ "a mip count past the table", [](STextureCache::Header& h) { h.mipCount = STextureCache::MAX_MIPS + 1; } },
+		};
+		for (const auto& t : tampers)
+		{
+			vector<uint8_t> tampered = image;
+			STextureCache::Header h;
+			memcpy(&h, tampered.data(), sizeof(h));
+			t.tamper(h);
+			memcpy(tampered.data(), &h, sizeof(h));
+			check(!STextureCache::Validate(tampered.data(), tampered.size(), SOURCE_HASH, settingsHash, view), "a mip table with %s validates", t.name);
+		}
+	}
+
+	return check.Result();
+}
@@ -0,0 +1,451 @@
+#include "Tests.h"
+
+#include "PixelConvert.h"
+#include "STextureCompression.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace STextureCompression;
+
+namespace
+{
+	const Format FORMATS[] = { Format::BC1, Format::BC4, Format::BC5, Format::BC7 };
+	const char* FORMAT_NAMES[] = { "BC1", "BC4", "BC5", "BC7" };
+	const uint32_t FORMAT_CHANNELS[] = { 3, 1, 2, 4 };
+	const Quality QUALITIES[] = { Quality::Fast, Quality::Normal, Quality::High };
+	const char* QUALITY_NAMES[] = { "fast", "normal", "high" };
+
+	const char* GetFormatName(Format format)
+	{
+		for (uint32_t f = 0; f < 4; ++f)
+		{
+			if (FORMATS[f] == format)
+				return FORMAT_NAMES[f];
+		}
+		return "BC6H";
+	}
+
+	// 4 x 4 test blocks: a smooth gradient, a hard edge, noise and an alpha ramp
+	void MakeBlock(uint32_t pattern, uint8_t* rgba)
+	{
+		uint32_t seed = 12345;
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				uint8_t* texel = rgba + (y * 4 + x) * 4;
+				const bool edge = x + y < 4;
+				switch (pattern)
+				{
+				case 0: texel[0] = (uint8_t)(x * 60 + y * 8); texel[1] = (uint8_t)(255 - x * 48 - y * 10); texel[2] = (uint8_t)(y * 60 + 20); texel[3] = 255; break;
+				case 1: texel[0] = edge ? 200 : 20; texel[1] = edge ? 40 : 90; texel[2] = edge ? 30 : 220; texel[3] = 255; break;
+				case 2:
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						seed = seed * 1103515245u + 12345u;
+						texel[c] = (uint8_t)(seed >> 24);
+					}
+					texel[3] = 255;
+					break;
+				case 3: texel[0] = 120; texel[1] = (uint8_t)(200 - x * 20); texel[2] = 80; texel[3] = (uint8_t)(x * 80 + y * 5); break;
+				}
+			}
+		}
+	}
+
+	struct Image
+	{
+		std::string name;
+		uint32_t width;
+		uint32_t height;
+		std::vector<uint8_t> rgba;
+	};
+
+	// Smooth gradients under a band of noise, with an alpha ramp
+	Image MakeImage(uint32_t width, uint32_t height)
+	{
+		Image image = { "generated", width, height };
+		image.rgba.resize((size_t)width * height * 4);
+		std::mt19937 random(1);
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				uint8_t* texel = &image.rgba[((size_t)y * width + x) * 4];
+				const uint32_t noise = y * 8 >= height * 3 && y * 8 < height * 5 ? random() % 48 : 0;
+				texel[0] = (uint8_t)std::min(255u, x * 256 / width + noise);
+				texel[1] = (uint8_t)std::min(255u, y * 256 / height + noise);
+				texel[2] = (uint8_t)std::min(255u, x * 128 / width + y * 128 / height + noise);
+				texel[3] = (uint8_t)(255 - x * 128 / width);
+			}
+		}
+		return image;
+	}
+
+	// Over the channels [format] stores
+	double ComputePSNR(uint32_t format, const Image& image, const std::vector<uint8_t>& decoded)
+	{
+		double squaredError = 0.0;
+		for (size_t i = 0; i < (size_t)image.width * image.height; ++i)
+		{
+			for (uint32_t c = 0; c < FORMAT_CHANNELS[format]; ++c)
+			{
+				const double d = (double)decoded[i * 4 + c] - image.rgba[i * 4 + c];
+				squaredError += d * d;
+			}
+		}
+		const double mse = squaredError / ((double)image.width * image.height * FORMAT_CHANNELS[format]);
+		return 10.0 * log10(255.0 * 255.0 / std::max(mse, 1e-10));
+	}
+
+	// 4 x 4 half RGBA test blocks for BC6H: a smooth gradient over two stops and a hard edge between bright and dark
+	void MakeHDRBlock(uint32_t pattern, uint16_t* texels)
+	{
+		float rgba[64];
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				float* texel = rgba + (y * 4 + x) * 4;
+				const bool edge = x + y < 4;
+				switch (pattern)
+				{
+				case 0: texel[0] = 0.5f * exp2f(x * 0.5f + y * 0.25f); texel[1] = 0.25f * exp2f(x * 0.25f); texel[2] = 0.1f + 0.05f * y; break;
+				default: texel[0] = edge ? 20.0f : 0.02f; texel[1] = edge ? 16.0f : 0.05f; texel[2] = edge ? 8.0f : 0.1f; break;
+				}
+				texel[3] = 1.0f;
+			}
+		}
+		PixelConvert::FloatToHalf(rgba, texels, 64);
+	}
+
+	struct HDRImage
+	{
+		std::string name;
+		uint32_t width;
+		uint32_t height;
+		std::vector<float> rgba;
+	};
+
+	// A sky gradient with a small sun several thousand times brighter, over a band of noisy ground
+	HDRImage MakeHDRImage(uint32_t width, uint32_t height)
+	{
+		HDRImage image = { "generated", width, height };
+		image.rgba.resize((size_t)width * height * 4);
+		std::mt19937 random(1);
+		const float sunX = width * 0.68f, sunY = height * 0.23f;
+		const float sunRadius = std::max(2.0f, 12.0f * width / 1024.0f), haloRadius = 30.0f * width / 1024.0f;
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				float* texel = &image.rgba[((size_t)y * width + x) * 4];
+				const bool ground = y * 8 >= height * 5;
+				const float sky = 0.2f + 1.5f * (1.0f - (float)y / height);
+				const float distance = sqrtf(((float)x - sunX) * ((float)x - sunX) + ((float)y - sunY) * ((float)y - sunY));
+				const float sun = distance < sunRadius ? 5000.0f : 40.0f * expf(-distance / haloRadius);
+				const float noise = ground ? (0.5f + (random() >> 8) * (1.0f / 16777216.0f)) * 0.05f : 0.0f;
+				texel[0] = ground ? noise * 1.2f : sky * 0.6f + sun;
+				texel[1] = ground ? noise : sky * 0.8f + sun * 0.9f;
+				texel[2] = ground ? noise * 0.7f : sky + sun * 0.7f;
+				texel[3] = 1.0f;
+			}
+		}
+		return image;
+	}
+
+	// Luminance of what BC6H can store: negative and NaN texels clamp to 0, and the smallest normal half keeps logs finite
+	float StoredLuminance(const float* rgb)
+	{
+		float c[3];
+		for (uint32_t i = 0; i < 3; ++i)
+			c[i] = rgb[i] > 0.0f ? std::min(rgb[i], 65504.0f) : 0.0f;
+		return std::max(0.2126f * c[0] + 0.7152f * c[1] + 0.0722f * c[2], 1.0f / 16384.0f);
+	}
+
+	struct HDRResult
+	{
+		std::vector<uint8_t> blocks;
+		double milliseconds;  // Of the encode alone
+		double RMSE, maxError;  // Of log2 of decoded over source luminance, in stops
+	};
+
+	// [image] compressed to BC6H at [quality] on [maxThreads] threads, and decoded again
+	HDRResult EncodeHDR(const HDRImage& image, Quality quality, uint32_t maxThreads)
+	{
+		HDRResult result;
+		const uint32_t width = image.width, height = image.height;
+		const size_t srcPitch = (size_t)width * 8;
+		const size_t dstPitch = (size_t)(width + 3) / 4 * GetBlockSize(Format::BC6H);
+		std::vector<uint16_t> texels(image.rgba.size());
+		PixelConvert::FloatToHalf(image.rgba.data(), texels.data(), texels.size());
+		result.blocks.resize(dstPitch * ((height + 3) / 4));
+		Tests::Timer timer;
+		Encode(Format::BC6H, (const uint8_t*)texels.data(), width, height, srcPitch, result.blocks.data(), dstPitch, quality, maxThreads);
+		result.milliseconds = timer.Milliseconds();
+
+		Decode(Format::BC6H, result.blocks.data(), width, height, dstPitch, (uint8_t*)texels.data(), srcPitch);
+		std::vector<float> decoded(texels.size());
+		PixelConvert::HalfToFloat(texels.data(), decoded.data(), decoded.size());
+		double squaredError = 0.0;
+		result.maxError = 0.0;
+		for (size_t i = 0; i < (size_t)width * height; ++i)
+		{
+			const double error = log2((double)StoredLuminance(&decoded[i * 4]) / StoredLuminance(&image.rgba[i * 4]));
+			squaredError += error * error;
+			result.maxError = std::max(result.maxError, fabs(error));
+		}
+		result.RMSE = sqrt(squaredError / ((double)width * height));
+		return result;
+	}
+}
+
+// D3D12EngineTests bc
+// Golden blocks, solid colors at every quality, and the same blocks from any thread count, for the 8-bit formats
+// and for BC6H, whose solid colors span the half range and whose error is measured in stops of luminance.
+int Tests::TestBlockCompression(int, char**)
+{
+	Checker check("bc");
+
+	// Encoded at Normal quality. The encoder sticks to integer and plain IEEE float arithmetic,
+	// so any compiler that does not contract or reorder float math produces these exact bytes.
+	struct Golden
+	{
+		uint32_t pattern;
+		Format format;
+		uint8_t block[16];
+	};
+	static const Golden golden[] = {
+		{ 0, Format::BC1, { 0x72, 0xd2, 0xaa, 0x0f, 0xbd, 0xad, 0x2d, 0x2f } },
+		{ 0, Format::BC4, { 0xce, 0x00, 0x31, 0x15, 0x53, 0xef, 0xf0, 0x0e } },
+		{ 0, Format::BC5, { 0xce, 0x00, 0x31, 0x15, 0x53, 0xef, 0xf0, 0x0e, 0xfa, 0x56, 0x58, 0x8f, 0xf5, 0xa2, 0x23, 0x3a } },
+		{ 0, Format::BC7, { 0xd8, 0x08, 0xb8, 0x64, 0x45, 0xbf, 0xb6, 0x9a, 0x67, 0x32, 0xd5, 0x2a, 0xc8, 0xc9, 0x37, 0x36 } },
+		{ 1, Format::BC1, { 0x44, 0xc1, 0xdb, 0x12, 0x00, 0x40, 0x50, 0x54 } },
+		{ 1, Format::BC4, { 0xc8, 0x14, 0x00, 0x00, 0x20, 0x40, 0x82, 0x24 } },
+		{ 1, Format::BC5, { 0xc8, 0x14, 0x00, 0x00, 0x20, 0x40, 0x82, 0x24, 0x5a, 0x28, 0x49, 0x92, 0x04, 0x09, 0x10, 0x00 } },
+		{ 1, Format::BC7, { 0x18, 0x90, 0x15, 0x0a, 0x32, 0xa5, 0xd5, 0xa2, 0x3c, 0xdc, 0xee, 0x07, 0x80, 0x01, 0x60, 0x78 } },
+		{ 2, Format::BC1, { 0xb6, 0xd3, 0xc5, 0x14, 0xf0, 0x8a, 0x3a, 0x58 } },
+		{ 2, Format::BC4, { 0xe6, 0x0a, 0xd2, 0x8f, 0x8d, 0xda, 0x01, 0x3b } },
+		{ 2, Format::BC5, { 0xe6, 0x0a, 0xd2, 0x8f, 0x8d, 0xda, 0x01, 0x3b, 0xfa, 0x03, 0xf3, 0x3c, 0x2f, 0x27, 0x58, 0x8e } },
+		{ 2, Format::BC7, { 0x76, 0x31, 0x30, 0x6f, 0x5c, 0xb9, 0xfc, 0x74, 0xf2, 0xf4, 0x82, 0x56, 0x2a, 0xd0, 0x89, 0xf9 } },
+		{ 3, Format::BC1, { 0x6a, 0x7c, 0x0a, 0x7d, 0x1f, 0x1f, 0x1f, 0x1f } },
+		{ 3, Format::BC4, { 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+		{ 3, Format::BC5, { 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x8d, 0x98, 0x83, 0x39, 0x98, 0x83, 0x39 } },
+		{ 3, Format::BC7, { 0x40, 0x1e, 0xaf, 0x5c, 0x44, 0xa1, 0x00, 0x7f, 0x50, 0xe9, 0x50, 0xea, 0x51, 0xfa, 0x61, 0xfa } },
+	};
+	for (const Golden& g : golden)
+	{
+		uint8_t rgba[64];
+		uint8_t block[16];
+		MakeBlock(g.pattern, rgba);
+		EncodeBlock(g.format, rgba, block, Quality::Normal);
+		check(memcmp(block, g.block, GetBlockSize(g.format)) == 0, "golden block %u of %s differs", g.pattern, GetFormatName(g.format));
+	}
+	static const uint8_t goldenBC6H[2][16] = {
+		{ 0xa3, 0x39, 0xd6, 0x04, 0xb3, 0x70, 0xb8, 0xd6, 0x20, 0x85, 0x52, 0xa8, 0x85, 0xda, 0xa7, 0xfc },
+		{ 0x63, 0xcf, 0x39, 0xa5, 0x94, 0xc9, 0xab, 0xbf, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xf0, 0xff },
+	};
+	for (uint32_t pattern = 0; pattern < 2; ++pattern)
+	{
+		uint16_t texels[64];
+		uint8_t block[16];
+		MakeHDRBlock(pattern, texels);
+		EncodeBlock(Format::BC6H, (const uint8_t*)texels, block, Quality::Normal);
+		check(memcmp(block, goldenBC6H[pattern], sizeof(block)) == 0, "golden block %u of BC6H differs", pattern);
+	}
+
+	// Solid colors, gray and saturated, must survive every quality
+	const int solidTolerance[] = { 4, 0, 0, 1 };  // BC1 interpolates 5:6:5 endpoints, BC7 mode 6 shares p-bits
+	for (uint32_t f = 0; f < 4; ++f)
+	{
+		int maxError = 0;
+		for (const Quality quality : QUALITIES)
+		{
+			for (uint32_t v = 0; v < 256; ++v)
+			{
+				uint8_t rgba[64];
+				uint8_t block[16];
+				uint8_t decoded[64];
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					rgba[i * 4 + 0] = (uint8_t)v;
+					rgba[i * 4 + 1] = (uint8_t)(255 - v);
+					rgba[i * 4 + 2] = (uint8_t)(v / 2);
+					rgba[i * 4 + 3] = 255;
+				}
+				EncodeBlock(FORMATS[f], rgba, block, quality);
+				DecodeBlock(FORMATS[f], block, decoded);
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					for (uint32_t c = 0; c < FORMAT_CHANNELS[f]; ++c)
+						maxError = std::max(maxError, abs((int)decoded[i * 4 + c] - (int)rgba[i * 4 + c]));
+				}
+			}
+		}
+		check(maxError <= solidTolerance[f], "solid %s blocks off by up to %d", FORMAT_NAMES[f], maxError);
+	}
+
+	// From the smallest normal half to the largest finite one, in stops. Fast keeps to the 10-bit endpoints of mode 11.
+	const double solidStops[] = { 0.025, 0.001, 0.001 };
+	for (uint32_t q = 0; q < 3; ++q)
+	{
+		double maxError = 0.0;
+		for (float v = 1.0f / 16384.0f; v < 65504.0f; v *= 1.7f)
+		{
+			float rgba[64];
+			uint16_t texels[64], decoded[64];
+			uint8_t block[16];
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				rgba[i * 4 + 0] = v;
+				rgba[i * 4 + 1] = v * 0.5f;
+				rgba[i * 4 + 2] = std::min(v * 1.3f, 65504.0f);
+				rgba[i * 4 + 3] = 1.0f;
+			}
+			PixelConvert::FloatToHalf(rgba, texels, 64);
+			EncodeBlock(Format::BC6H, (const uint8_t*)texels, block, QUALITIES[q]);
+			DecodeBlock(Format::BC6H, block, (uint8_t*)decoded);
+			float source[64], result[64];
+			PixelConvert::HalfToFloat(texels, source, 64);
+			PixelConvert::HalfToFloat(decoded, result, 64);
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+					maxError = std::max(maxError, fabs(log2((double)result[i * 4 + c] / source[i * 4 + c])));
+			}
+		}
+		check(maxError <= solidStops[q], "solid BC6H %s blocks off by up to %.4f stops", QUALITY_NAMES[q], maxError);
+	}
+
+	// Threads encode whole block rows, so the output must not depend on their count. The size is not a multiple
+	// of 4, so edge blocks repeat the last column and row, and the quality floor catches a broken encoder.
+	const double minPSNR[] = { 37.0, 48.0, 48.0, 44.0 };  // About 1.5 dB below what the encoder reaches
+	const Image image = MakeImage(126, 125);
+	const uint32_t width = image.width, height = image.height;
+	std::vector<uint8_t> decoded((size_t)width * height * 4);
+	for (uint32_t f = 0; f < 4; ++f)
+	{
+		const size_t dstPitch = (size_t)(width + 3) / 4 * GetBlockSize(FORMATS[f]);
+		std::vector<uint8_t> blocks(dstPitch * ((height + 3) / 4));
+		std::vector<uint8_t> singleThreaded(blocks.size());
+		for (uint32_t q = 0; q < 3; ++q)
+		{
+			Encode(FORMATS[f], image.rgba.data(), width, height, (size_t)width * 4, blocks.data(), dstPitch, QUALITIES[q], 4);
+			Encode(FORMATS[f], image.rgba.data(), width, height, (size_t)width * 4, singleThreaded.data(), dstPitch, QUALITIES[q], 1);
+			check(blocks == singleThreaded, "%s %s differs between 4 threads and 1", FORMAT_NAMES[f], QUALITY_NAMES[q]);
+
+			Decode(FORMATS[f], blocks.data(), width, height, dstPitch, decoded.data(), (size_t)width * 4);
+			const double psnr = ComputePSNR(f, image, decoded);
+			check(psnr >= minPSNR[f], "%s %s PSNR %.2f dB, below %.0f", FORMAT_NAMES[f], QUALITY_NAMES[q], psnr, minPSNR[f]);
+		}
+	}
+
+	const double maxRMSE[] = { 0.022, 0.021, 0.021 };  // Stops, about 10% above what the encoder reaches
+	const HDRImage hdrImage = MakeHDRImage(126, 125);
+	for (uint32_t q = 0; q < 3; ++q)
+	{
+		const HDRResult result = EncodeHDR(hdrImage, QUALITIES[q], 4);
+		check(EncodeHDR(hdrImage, QUALITIES[q], 1).blocks == result.blocks, "BC6H %s differs between 4 threads and 1", QUALITY_NAMES[q]);
+		check(result.RMSE <= maxRMSE[q], "BC6H %s log luminance RMSE %.4f stops, above %.2f", QUALITY_NAMES[q], result.RMSE, maxRMSE[q]);
+	}
+	return check.Result();
+}
+
+// D3D12EngineTests bcbench [<image>...]
+// Compresses each image (a generated one if none is given) to every format and quality and prints the throughput
+// and the PSNR of the channels the format stores. Fails if the blocks depend on the thread count.
+int Tests::BenchmarkBlockCompression(int argc, char** argv)
+{
+	Checker check("bcbench");
+	std::vector<Image> images;
+	for (int i = 0; i < argc; ++i)
+	{
+		int width, height, channels;
+		uint8_t* pixels = stbi_load(argv[i], &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			printf("bcbench: failed to load %s\n", argv[i]);
+			return 1;
+		}
+		Image image = { argv[i], (uint32_t)width, (uint32_t)height };
+		image.rgba.assign(pixels, pixels + (size_t)width * height * 4);
+		stbi_image_free(pixels);
+		images.push_back(std::move(image));
+	}
+	if (images.empty())
+		images.push_back(MakeImage(1024, 1024));
+
+	for (const Image& image : images)
+	{
+		const uint32_t width = image.width;
+		const uint32_t height = image.height;
+		std::vector<uint8_t> decoded((size_t)width * height * 4);
+		for (uint32_t f = 0; f < 4; ++f)
+		{
+			const size_t dstPitch = (size_t)(width + 3) / 4 * GetBlockSize(FORMATS[f]);
+			std::vector<uint8_t> blocks(dstPitch * ((height + 3) / 4));
+			std::vector<uint8_t> singleThreaded(blocks.size());
+			for (uint32_t q = 0; q < 3; ++q)
+			{
+				Timer timer;
+				Encode(FORMATS[f], image.rgba.data(), width, height, (size_t)width * 4, blocks.data(), dstPitch, QUALITIES[q]);
+				const double milliseconds = timer.Milliseconds();
+
+				Encode(FORMATS[f], image.rgba.data(), width, height, (size_t)width * 4, singleThreaded.data(), dstPitch, QUALITIES[q], 1);
+				check(blocks == singleThreaded, "%s %s %s differs between thread counts", image.name.c_str(), FORMAT_NAMES[f], QUALITY_NAMES[q]);
+
+				Decode(FORMATS[f], blocks.data(), width, height, dstPitch, decoded.data(), (size_t)width * 4);
+				printf("%s %s %-6s %8.2f ms, %7.2f MPix/s, PSNR %.2f dB\n", image.name.c_str(), FORMAT_NAMES[f], QUALITY_NAMES[q],
+					milliseconds, width * height / milliseconds / 1000.0, ComputePSNR(f, image, decoded));
+			}
+		}
+	}
+	return check.Result();
+}
+
+// D3D12EngineTests bc6hbench [<image>...]
+// Compresses each HDR image (a generated 1024 x 512 sky with a sun if none is given) to BC6H at every quality and
+// prints the throughput and the luminance error in stops, log2 of decoded over source luminance. Fails if the blocks
+// depend on the thread count.
+int Tests::BenchmarkBC6H(int argc, char** argv)
+{
+	Checker check("bc6hbench");
+	std::vector<HDRImage> images;
+	for (int i = 0; i < argc; ++i)
+	{
+		int width, height, channels;
+		float* pixels = stbi_loadf(argv[i], &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			printf("bc6hbench: failed to load %s\n", argv[i]);
+			return 1;
+		}
+		HDRImage image = { argv[i], (uint32_t)width, (uint32_t)height };
+		image.rgba.assign(pixels, pixels + (size_t)width * height * 4);
+		stbi_image_free(pixels);
+		images.push_back(std::move(image));
+	}
+	if (images.empty())
+		images.push_back(MakeHDRImage(1024, 512));
+
+	for (const HDRImage& image : images)
+	{
+		for (uint32_t q = 0; q < 3; ++q)
+		{
+			const HDRResult result = EncodeHDR(image, QUALITIES[q], 0);
+			check(EncodeHDR(image, QUALITIES[q], 1).blocks == result.blocks, "%s %s differs between thread counts", image.name.c_str(), QUALITY_NAMES[q]);
+			printf("%s BC6H %-6s %8.2f ms, %7.2f MPix/s, log luminance RMSE %.4f max %.4f stops\n", image.name.c_str(), QUALITY_NAMES[q],
+				result.milliseconds, image.width * image.height / result.milliseconds / 1000.0, result.RMSE, result.maxError);
+		}
+	}
+	return check.Result();
+}
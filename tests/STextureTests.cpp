@@ -0,0 +1,214 @@
+#include "Tests.h"
+
+#include "ParallelFor.h"
+#include "PixelConvert.h"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace
+{
+	// resources/*/textures/*.jpg and *.png, the 8-bit textures the demo ships
+	vector<string> FindDemoTextures()
+	{
+		vector<string> paths;
+		std::error_code error;
+		for (const auto& directory : std::filesystem::directory_iterator(D3D12ENGINE_RESOURCES_DIR, error))
+		{
+			for (const auto& file : std::filesystem::directory_iterator(directory.path() / "textures", error))
+			{
+				const string extension = file.path().extension().string();
+				if (extension == ".jpg" || extension == ".png")
+					paths.push_back(file.path().string());
+			}
+		}
+		std::sort(paths.begin(), paths.end());
+		return paths;
+	}
+
+	// STexture's 8-bit load: the file's own channels, expanded to RGBA by PixelConvert
+	vector<uint8_t> Decode(const string& path)
+	{
+		int width, height, channels;
+		uint8_t* pixels = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		if (!pixels)
+			throw std::runtime_error("Failed to load texture " + path);
+		vector<uint8_t> rgba((size_t)width * height * 4);
+		PixelConvert::ToRGBA8(pixels, channels, rgba.data(), (size_t)width * height);
+		stbi_image_free(pixels);
+		return rgba;
+	}
+
+	// stb_image's own expansion to RGBA
+	vector<uint8_t> DecodeReference(const string& path)
+	{
+		int width, height, channels;
+		uint8_t* pixels = stbi_load(path.c_str(), &width, &height, &channels, 4);
+		if (!pixels)
+			return vector<uint8_t>();
+		vector<uint8_t> rgba(pixels, pixels + (size_t)width * height * 4);
+		stbi_image_free(pixels);
+		return rgba;
+	}
+
+	// One job per file, as STexture::LoadTextures. Returns the first error in file order, empty if none.
+	string DecodeAll(const vector<string>& paths, uint32_t threads, vector<vector<uint8_t>>& images)
+	{
+		images.assign(paths.size(), vector<uint8_t>());
+		try
+		{
+			ParallelForRethrow((uint32_t)paths.size(), [&](uint32_t i) { images[i] = Decode(paths[i]); }, threads);
+		}
+		catch (const std::exception& e)
+		{
+			return e.what();
+		}
+		return string();
+	}
+
+	uint32_t CountMismatches(const vector<vector<uint8_t>>& images, const vector<vector<uint8_t>>& reference)
+	{
+		uint32_t mismatches = 0;
+		for (size_t i = 0; i < images.size(); ++i)
+			mismatches += images[i] != reference[i];
+		return mismatches;
+	}
+}
+
+// D3D12EngineTests textureload
+// The parallel 8-bit texture load: ToRGBA8 against stb_image's expansion for every channel count and kernel, a set
+// of the demo's textures decoded on 1 to 8 threads against a serial decode in file order, and the first missing
+// file in file order reported after every other file was decoded.
+int Tests::TestTextureLoading(int, char**)
+{
+	Checker check("textureload");
+
+	// 1 to 4 channels; odd counts leave a scalar tail after the SIMD kernels
+	{
+		std::mt19937 generator(1);
+		const size_t count = 1001;
+		const PixelConvert::Kernel kernels[] = { PixelConvert::Kernel::Scalar, PixelConvert::Kernel::SSE4, PixelConvert::Kernel::AVX2 };
+		for (uint32_t channels = 1; channels <= 4; ++channels)
+		{
+			vector<uint8_t> src(count * channels);
+			for (uint8_t& value : src)
+				value = (uint8_t)generator();
+			vector<uint8_t> expected(count * 4);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint8_t* in = &src[i * channels];
+				const bool gray = channels < 3;
+				expected[4 * i + 0] = in[0];
+				expected[4 * i + 1] = gray ? in[0] : in[1];
+				expected[4 * i + 2] = gray ? in[0] : in[2];
+				expected[4 * i + 3] = channels == 2 || channels == 4 ? in[channels - 1] : 255;
+			}
+			for (PixelConvert::Kernel kernel : kernels)
+			{
+				if ((int)kernel > (int)PixelConvert::GetBestKernel())
+					continue;
+				vector<uint8_t> dst(count * 4);
+				PixelConvert::ToRGBA8(src.data(), channels, dst.data(), count, kernel);
+				check(dst == expected, "ToRGBA8 %s: %u channels expand wrongly", PixelConvert::GetKernelName(kernel), channels);
+			}
+		}
+	}
+
+	vector<string> paths = FindDemoTextures();
+	if (!check(paths.size() >= 4, "only %zu textures under %s", paths.size(), D3D12ENGINE_RESOURCES_DIR))
+		return check.Result();
+	paths.resize(std::min<size_t>(paths.size(), 6));
+
+	vector<vector<uint8_t>> reference;
+	for (const string& path : paths)
+	{
+		reference.push_back(DecodeReference(path));
+		check(!reference.back().empty(), "stb_image can't read %s", path.c_str());
+	}
+
+	for (uint32_t threads : { 1u, 2u, 4u, 8u })
+	{
+		vector<vector<uint8_t>> images;
+		const string error = DecodeAll(paths, threads, images);
+		check(error.empty(), "%u threads: %s", threads, error.c_str());
+		const uint32_t mismatches = CountMismatches(images, reference);
+		check(mismatches == 0, "%u threads: %u of %zu textures differ from stb_image's", threads, mismatches, paths.size());
+	}
+
+	// Two missing files: the error names the earlier one, whichever thread got there first
+	{
+		vector<string> withMissing = paths;
+		const string first = string(D3D12ENGINE_RESOURCES_DIR) + "/missing_1.png";
+		withMissing.insert(withMissing.begin() + 4, string(D3D12ENGINE_RESOURCES_DIR) + "/missing_2.png");
+		withMissing.insert(withMissing.begin() + 1, first);
+		for (uint32_t threads : { 1u, 4u })
+		{
+			vector<vector<uint8_t>> images;
+			const string error = DecodeAll(withMissing, threads, images);
+			check(error.find(first) != string::npos, "%u threads, missing files: \"%s\" doesn't name %s", threads, error.c_str(), first.c_str());
+			uint32_t decoded = 0;
+			for (const vector<uint8_t>& image : images)
+				decoded += !image.empty();
+			check(decoded == paths.size(), "%u threads, missing files: %u of %zu textures decoded", threads, decoded, paths.size());
+		}
+	}
+
+	return check.Result();
+}
+
+// D3D12EngineTests textureloadbench [<image>...]
+// Wall clock time to decode the demo's 8-bit textures, or the given images, one job per file on 1, 2, 4, ... threads
+// up to one per core, best of 3 runs. Fails if any thread count decodes differently from one thread.
+int Tests::BenchmarkTextureLoading(int argc, char** argv)
+{
+	Checker check("textureloadbench");
+	vector<string> paths(argv, argv + argc);
+	if (paths.empty())
+		paths = FindDemoTextures();
+	if (!check(!paths.empty(), "no textures under %s", D3D12ENGINE_RESOURCES_DIR))
+		return check.Result();
+
+	constexpr uint32_t RUNS = 3;
+	const uint32_t coreCount = std::max(1u, std::thread::hardware_concurrency());
+	vector<vector<uint8_t>> serial;
+	double serialMilliseconds = 0.0;
+	for (uint32_t threads = 1;; threads = std::min(threads * 2, coreCount))
+	{
+		double fastest = 1e30;
+		vector<vector<uint8_t>> images;
+		for (uint32_t run = 0; run < RUNS; ++run)
+		{
+			Timer timer;
+			const string error = DecodeAll(paths, threads, images);
+			fastest = std::min(fastest, timer.Milliseconds());
+			if (!check(error.empty(), "%u threads: %s", threads, error.c_str()))
+				return check.Result();
+		}
+
+		if (threads == 1)
+		{
+			serial = std::move(images);
+			serialMilliseconds = fastest;
+		}
+		else
+		{
+			const uint32_t mismatches = CountMismatches(images, serial);
+			check(mismatches == 0, "%u threads: %u textures differ from one thread's", threads, mismatches);
+		}
+		printf("%zu textures on %2u threads: %8.2f ms, %.2fx\n", paths.size(), threads, fastest, serialMilliseconds / fastest);
+
+		if (threads == coreCount)
+			break;
+	}
+	return check.Result();
+}
@@ -0,0 +1,222 @@
+#include "Tests.h"
+
+#include "STransformStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	constexpr float MAX_RELATIVE_ERROR = 1e-4f;
+
+	float Random(std::mt19937& generator, float lo, float hi)
+	{
+		return lo + (hi - lo) * ((generator() >> 8) * (1.0f / 16777216.0f));
+	}
+
+	// [count] random transforms, each one in [childShare] the child of an earlier one
+	void AddRandomTransforms(STransformStore& transforms, uint32_t count, uint32_t childShare, uint32_t seed)
+	{
+		std::mt19937 generator(seed);
+		transforms.reserve(transforms.size() + count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint32_t existing = (uint32_t)transforms.size();
+			const uint32_t parent = existing > 0 && generator() % childShare == 0 ? (uint32_t)(generator() % existing) : NO_PARENT;
+			const uint32_t id = transforms.Create(parent);
+			transforms.SetPosition(id, XMFLOAT3(Random(generator, -10.0f, 10.0f), Random(generator, -10.0f, 10.0f), Random(generator, -10.0f, 10.0f)));
+			transforms.SetRotation(id, XMQuaternionRotationRollPitchYaw(Random(generator, 0.0f, XM_2PI), Random(generator, 0.0f, XM_2PI), Random(generator, 0.0f, XM_2PI)));
+			transforms.SetScale(id, XMFLOAT3(Random(generator, 0.5f, 1.5f), Random(generator, 0.5f, 1.5f), Random(generator, 0.5f, 1.5f)));
+		}
+	}
+
+	// World matrices as SMesh built them, scale * rotation * translation times the parent's, from the stored components.
+	// Parents come first, so theirs are ready when a child needs them.
+	vector<XMMATRIX> ReferenceWorldMatrices(const STransformStore& transforms)
+	{
+		vector<XMMATRIX> world(transforms.size());
+		for (uint32_t i = 0; i < transforms.size(); ++i)
+		{
+			const XMFLOAT3 position = transforms.GetPosition(i);
+			const XMFLOAT3 scale = transforms.GetScale(i);
+			world[i] = XMMatrixScaling(scale.x, scale.y, scale.z) * XMMatrixRotationQuaternion(transforms.GetRotation(i))
+				* XMMatrixTranslation(position.x, position.y, position.z);
+			if (transforms.GetParent(i) != NO_PARENT)
+				world[i] *= world[transforms.GetParent(i)];
+		}
+		return world;
+	}
+
+	float RowError(FXMVECTOR row, FXMVECTOR expected)
+	{
+		return XMVectorGetX(XMVector4Length(row - expected)) / std::max(1.0f, XMVectorGetX(XMVector4Length(expected)));
+	}
+
+	// Largest relative row error of the world and normal matrices against the reference. The expected normal
+	// matrix is the inverse transpose of the world matrix without its translation.
+	void MatrixErrors(const STransformStore& transforms, float& worldError, float& normalError)
+	{
+		const vector<XMMATRIX> reference = ReferenceWorldMatrices(transforms);
+		worldError = 0.0f;
+		normalError = 0.0f;
+		for (uint32_t i = 0; i < transforms.size(); ++i)
+		{
+			const XMMATRIX world = transforms.LoadWorldMatrix(i);
+			const XMMATRIX normal = XMLoadFloat4x4(&transforms.GetNormalMatrix(i));
+			const XMMATRIX expectedNormal = XMMatrixTranspose(XMMatrixInverse(nullptr, reference[i]));
+			for (uint32_t row = 0; row < 4; ++row)
+			{
+				worldError = std::max(worldError, RowError(world.r[row], reference[i].r[row]));
+				const XMVECTOR expected = row < 3 ? XMVectorSelect(XMVectorZero(), expectedNormal.r[row], XMVectorSelectControl(1, 1, 1, 0)) : XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+				normalError = std::max(normalError, RowError(normal.r[row], expected));
+			}
+		}
+	}
+
+	bool IsIdentity(const STransformStore& transforms, uint32_t id)
+	{
+		const XMFLOAT3 position = transforms.GetPosition(id);
+		const XMFLOAT3 scale = transforms.GetScale(id);
+		return position.x == 0.0f && position.y == 0.0f && position.z == 0.0f && scale.x == 1.0f && scale.y == 1.0f && scale.z == 1.0f
+			&& XMVector4Equal(transforms.GetRotation(id), XMQuaternionIdentity());
+	}
+}
+
+// D3D12EngineTests transforms
+// STransformStore's world and normal matrices against DirectXMath: random hierarchies of a size that isn't a multiple
+// of 4, updates after moving only a parent, Rotate and RotateAll, transforms created after RotateAll turned the
+// padding, and a store reused after clear.
+int Tests::TestTransforms(int, char**)
+{
+	Checker check("transforms");
+	STransformStore transforms;
+	float worldError, normalError;
+
+	auto checkMatrices = [&](const char* name)
+	{
+		MatrixErrors(transforms, worldError, normalError);
+		check(worldError < MAX_RELATIVE_ERROR && normalError < MAX_RELATIVE_ERROR, "%s: relative error %g (world) %g (normal) over %zu transforms",
+			name, worldError, normalError, transforms.size());
+	};
+
+	AddRandomTransforms(transforms, 1001, 4, 1);
+	transforms.Update();
+	checkMatrices("random");
+
+	{
+		const XMFLOAT3 position(1.0f, -2.0f, 3.0f);
+		const XMFLOAT3 scale(0.25f, 2.0f, 4.0f);
+		transforms.SetPosition(7, position);
+		transforms.SetScale(7, scale);
+		const XMFLOAT3 storedPosition = transforms.GetPosition(7);
+		const XMFLOAT3 storedScale = transforms.GetScale(7);
+		check(memcmp(&storedPosition, &position, sizeof(position)) == 0 && memcmp(&storedScale, &scale, sizeof(scale)) == 0, "Set and Get differ");
+	}
+
+	// Only the roots move; every descendant has to follow
+	for (uint32_t i = 0; i < transforms.size(); i += 3)
+	{
+		if (transforms.GetParent(i) == NO_PARENT)
+			transforms.SetPosition(i, XMFLOAT3((float)i * 0.01f, 1.0f, -1.0f));
+	}
+	transforms.Update();
+	checkMatrices("moved roots");
+
+	{
+		const XMVECTOR before = transforms.GetRotation(10);
+		const XMVECTOR rotation = XMQuaternionRotationRollPitchYaw(0.3f, -0.2f, 0.1f);
+		transforms.Rotate(10, rotation);
+		const float error = XMVectorGetX(XMVector4Length(transforms.GetRotation(10) - XMQuaternionMultiply(before, rotation)));
+		check(error < 1e-6f, "Rotate: %g from XMQuaternionMultiply", error);
+	}
+
+	{
+		vector<XMFLOAT4> before(transforms.size());
+		for (uint32_t i = 0; i < transforms.size(); ++i)
+			XMStoreFloat4(&before[i], transforms.GetRotation(i));
+		const XMVECTOR rotation = XMQuaternionRotationRollPitchYaw(0.0f, 0.5f, 0.25f);
+		transforms.RotateAll(rotation);
+		float error = 0.0f;
+		for (uint32_t i = 0; i < transforms.size(); ++i)
+			error = std::max(error, XMVectorGetX(XMVector4Length(transforms.GetRotation(i) - XMQuaternionMultiply(XMLoadFloat4(&before[i]), rotation))));
+		check(error < 1e-6f, "RotateAll: %g from XMQuaternionMultiply", error);
+		transforms.Update();
+		checkMatrices("RotateAll");
+	}
+
+	// 1001 transforms leave 3 padding slots, which RotateAll has just turned
+	{
+		const uint32_t first = (uint32_t)transforms.size();
+		for (uint32_t i = 0; i < 5; ++i)
+			transforms.Create(i % 2 ? first - 1 : NO_PARENT);
+		bool identity = true;
+		for (uint32_t i = first; i < transforms.size(); ++i)
+			identity &= IsIdentity(transforms, i);
+		check(identity, "a transform created after RotateAll isn't the identity");
+		transforms.Update();
+		checkMatrices("created after RotateAll");
+	}
+
+	transforms.clear();
+	check(transforms.size() == 0, "clear left %zu transforms", transforms.size());
+	AddRandomTransforms(transforms, 6, 2, 2);
+	transforms.Update();
+	checkMatrices("after clear");
+
+	return check.Result();
+}
+
+// D3D12EngineTests transformsbench [<transforms>]
+// RotateAll and Update on 100K and 1M random transforms, or [transforms], an eighth of them children of others, best
+// of 20 runs, next to building the same matrices one transform at a time with DirectXMath as SMesh did. Fails if the
+// matrices are off.
+int Tests::BenchmarkTransforms(int argc, char** argv)
+{
+	Checker check("transformsbench");
+	vector<uint32_t> counts = { 100000, 1000000 };
+	if (argc > 0)
+		counts = { (uint32_t)std::max(1, atoi(argv[0])) };
+	constexpr uint32_t RUNS = 20;
+
+	const XMVECTOR rotation = XMQuaternionRotationRollPitchYaw(0.0f, 0.01f, 0.0f);
+	for (uint32_t count : counts)
+	{
+		STransformStore transforms;
+		AddRandomTransforms(transforms, count, 8, 1);
+		transforms.Update();
+
+		double rotateMilliseconds = 1e30, updateMilliseconds = 1e30, referenceMilliseconds = 1e30;
+		for (uint32_t run = 0; run < RUNS; ++run)
+		{
+			Timer timer;
+			transforms.RotateAll(rotation);
+			rotateMilliseconds = std::min(rotateMilliseconds, timer.Milliseconds());
+			timer.Restart();
+			transforms.Update();
+			updateMilliseconds = std::min(updateMilliseconds, timer.Milliseconds());
+
+			// The reference only builds the world matrices, and keeps one so the work isn't optimized away
+			timer.Restart();
+			const vector<XMMATRIX> reference = ReferenceWorldMatrices(transforms);
+			referenceMilliseconds = std::min(referenceMilliseconds, timer.Milliseconds());
+			check(std::isfinite(XMVectorGetX(reference.back().r[3])), "%u transforms: the reference isn't finite", count);
+		}
+
+		float worldError, normalError;
+		MatrixErrors(transforms, worldError, normalError);
+		check(worldError < MAX_RELATIVE_ERROR && normalError < MAX_RELATIVE_ERROR, "%u transforms: relative error %g (world) %g (normal)",
+			count, worldError, normalError);
+		printf("%u transforms\n", count);
+		printf("  RotateAll  %8.3f ms\n", rotateMilliseconds);
+		printf("  Update     %8.3f ms, %6.1f M transforms/s (world and normal)\n", updateMilliseconds, count / (updateMilliseconds * 1000.0));
+		printf("  DirectXMath %7.3f ms, %6.1f M transforms/s (world only)\n", referenceMilliseconds, count / (referenceMilliseconds * 1000.0));
+	}
+	return check.Result();
+}
@@ -0,0 +1,82 @@
+#include "Tests.h"
+
+#include <cstring>
+
+namespace
+{
+	struct Command
+	{
+		const char* name;
+		int (*run)(int argc, char** argv);
+		const char* usage;
+	};
+
+	const Command COMMANDS[] = {
+		{ "bc", Tests::TestBlockCompression, "BC1/4/5/6H/7 golden blocks, solid colors and thread count independence" },
+		{ "bcbench", Tests::BenchmarkBlockCompression, "[<image>...]: BC1/4/5/7 throughput and PSNR per quality" },
+		{ "bc6hbench", Tests::BenchmarkBC6H, "[<image>...]: BC6H throughput and luminance error in stops per quality" },
+		{ "optimizer", Tests::TestOptimizer, "cache statistics, and the vertex cache, overdraw and fetch orders on generated meshes" },
+		{ "optimizerbench", Tests::BenchmarkOptimizer, "[<size>]: time, ACMR, ATVR and overdraw of each optimizer pass" },
+		{ "simplifier", Tests::TestSimplifier, "target counts, error bounds, borders, seams and flips of the simplifier" },
+		{ "simplifierbench", Tests::BenchmarkSimplifier, "[<size>]: simplifier triangles/s per target and for a whole LOD chain" },
+		{ "objreader", Tests::TestObjReader, "SObjReader against tinyobj, at every thread count" },
+		{ "objbench", Tests::BenchmarkObjReader, "[<obj>...]: SObjReader MB/s per thread count, and tinyobj's" },
+		{ "parallelforbench", Tests::BenchmarkParallelFor, "ParallelFor scaling over large and small items" },
+		{ "textureload", Tests::TestTextureLoading, "8-bit texture decodes on 1 to 8 threads against stb_image, in file order" },
+		{ "textureloadbench", Tests::BenchmarkTextureLoading, "[<image>...]: texture decode wall clock time per thread count" },
+		{ "pixel", Tests::TestPixelConversions, "[<stride>]: every PixelConvert kernel against the scalar one, on float patterns, halves and bytes" },
+		{ "pixelbench", Tests::BenchmarkPixelConversions, "[<megapixels>]: GB/s of each pixel conversion per kernel" },
+#ifdef D3D12ENGINE_HAS_DIRECTXMATH
+		{ "weld", Tests::TestWeld, "OBJ corner welding, polygon fans and skipped faces" },
+		{ "weldbench", Tests::BenchmarkWeld, "[<obj>...]: vertices before and after welding, ACMR and load time" },
+		{ "gltf", Tests::TestGLTFReader, "SGLTFReader against the loader it replaced, and glTF features" },
+		{ "gltfbench", Tests::BenchmarkGLTFReader, "[<gltf>...]: SGLTFReader and the loader it replaced" },
+		{ "cull", Tests::TestCulling, "frustum planes, culled objects against a double precision test, and every kernel against the scalar one" },
+		{ "cullbench", Tests::BenchmarkCulling, "[<objects>]: frustum culling time per kernel at 100K objects" },
+		{ "bvh", Tests::TestBVH, "closest, packet and any hit queries against brute force, and the tree's structure" },
+		{ "bvhbench", Tests::BenchmarkBVH, "[<subdivisions>] [<rays>]: BVH build time and M rays/s per query" },
+		{ "instancing", Tests::TestInstancing, "instance batches and their packed instances against a stable sort" },
+		{ "instancingbench", Tests::BenchmarkInstancing, "[<instances>]: add, batch and write times at 10K to 100K instances" },
+		{ "meshcache", Tests::TestMeshCache, ".smesh round trips with 16 and 32 bit indices, rejected files and index ranges, and glTF buffer edits" },
+		{ "meshcachebench", Tests::BenchmarkMeshCache, "[<obj or gltf>...]: cold parse and cook against mapping and validating the .smesh cache" },
+		{ "meshlets", Tests::TestMeshlets, "meshlet limits, bounds and mesh shader form, and conservative culling" },
+		{ "meshletbench", Tests::BenchmarkMeshlets, "[<subdivisions>]: meshlet build time and the triangles culling removes" },
+		{ "tangents", Tests::TestTangents, "normals and tangent frames against a double precision reference" },
+		{ "tangentsbench", Tests::BenchmarkTangents, "[<subdivisions>]: normal and tangent generation on 2M triangles" },
+		{ "sh", Tests::TestSphericalHarmonics, "cube directions, SH16 orthonormality, and every SH kernel against the scalar one and brute force" },
+		{ "shbench", Tests::BenchmarkSphericalHarmonics, "[<size>]: SH16 projection time per kernel, on one thread and all" },
+		{ "transforms", Tests::TestTransforms, "world and normal matrices against DirectXMath, RotateAll and reused padding" },
+		{ "transformsbench", Tests::BenchmarkTransforms, "[<transforms>]: RotateAll and Update at 100K and 1M transforms" },
+		{ "packing", Tests::TestVertexPacking, "SPackedVertex encode and decode against each attribute's error bound" },
+#ifdef D3D12ENGINE_HAS_DXGIFORMAT
+		{ "brdf", Tests::TestBRDFLUT, "the BRDF LUT table against the integral it holds, the analytic fit, formats and headers" },
+		{ "brdfbench", Tests::BenchmarkBRDFLUT, "[<samples>]: BRDF LUT modes against high sample integrals, and their times" },
+		{ "envsampler", Tests::TestEnvironmentSampler, "alias table, sample densities against Pdf, and MIS against GGX pre-filtering" },
+		{ "envsamplebench", Tests::BenchmarkEnvironmentSampler, "[<samples>]: sampler build and draw times, pre-filter error of GGX and MIS" },
+		{ "ibl", Tests::TestIBLBaker, "every CPU IBL bake stage against the bake shaders, and .sibl caches" },
+		{ "texturecache", Tests::TestTextureCache, "mip chains against a box filter, sRGB filtering, placement alignment and .stex caches" },
+#endif
+#endif
+	};
+
+	int PrintUsage()
+	{
+		printf("D3D12EngineTests <command> [<argument>...]\n");
+		for (const Command& command : COMMANDS)
+			printf("  %-17s %s\n", command.name, command.usage);
+		return 2;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+		return PrintUsage();
+	for (const Command& command : COMMANDS)
+	{
+		if (strcmp(argv[1], command.name) == 0)
+			return command.run(argc - 2, argv + 2);
+	}
+	printf("Unknown command %s\n", argv[1]);
+	return PrintUsage();
+}
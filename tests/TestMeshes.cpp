@@ -0,0 +1,323 @@
+#include "TestMeshes.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <random>
+
+using std::vector;
+
+namespace
+{
+	inline uint32_t HashCoordinates(uint32_t x, uint32_t y)
+	{
+		uint32_t h = x * 0x8da6b343u ^ y * 0xd8163841u;
+		h ^= h >> 15;
+		h *= 0x2c1b3c6du;
+		h ^= h >> 12;
+		return h;
+	}
+
+	// Bilinearly interpolated random values on an 8 x 8 lattice over [0, 1]^2, in [0, 1]
+	float ValueNoise(float x, float y)
+	{
+		const float gx = x * 8.0f, gy = y * 8.0f;
+		const uint32_t ix = std::min((uint32_t)gx, 7u), iy = std::min((uint32_t)gy, 7u);
+		const float fx = gx - ix, fy = gy - iy;
+		auto value = [](uint32_t x, uint32_t y) { return (HashCoordinates(x, y) & 0xFFFF) / 65535.0f; };
+		const float bottom = value(ix, iy) + (value(ix + 1, iy) - value(ix, iy)) * fx;
+		const float top = value(ix, iy + 1) + (value(ix + 1, iy + 1) - value(ix, iy + 1)) * fx;
+		return bottom + (top - bottom) * fy;
+	}
+}
+
+void Tests::IndexedMesh::Append(const IndexedMesh& other)
+{
+	const uint32_t base = (uint32_t)GetVertexCount();
+	positions.insert(positions.end(), other.positions.begin(), other.positions.end());
+	normals.insert(normals.end(), other.normals.begin(), other.normals.end());
+	for (uint32_t index : other.indices)
+		indices.push_back(base + index);
+}
+
+Tests::IndexedMesh Tests::MakeCubeSphere(uint32_t subdivisions, float radius, float centerX)
+{
+	IndexedMesh mesh;
+	const uint32_t n = subdivisions;
+	std::map<uint32_t, uint32_t> vertices;  // Cube lattice point to vertex
+	auto getVertex = [&](const uint32_t lattice[3])
+	{
+		const uint32_t key = (lattice[0] * (n + 1) + lattice[1]) * (n + 1) + lattice[2];
+		auto inserted = vertices.emplace(key, (uint32_t)vertices.size());
+		if (inserted.second)
+		{
+			float c[3];
+			for (uint32_t i = 0; i < 3; ++i)
+				c[i] = 2.0f * lattice[i] / n - 1.0f;
+			const float length = sqrtf(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				mesh.normals.push_back(c[i] / length);
+				mesh.positions.push_back(c[i] / length * radius + (i == 0 ? centerX : 0.0f));
+			}
+		}
+		return inserted.first->second;
+	};
+
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		const uint32_t u = (axis + 1) % 3, v = (axis + 2) % 3;
+		for (uint32_t side = 0; side < 2; ++side)
+		{
+			for (uint32_t y = 0; y < n; ++y)
+			{
+				for (uint32_t x = 0; x < n; ++x)
+				{
+					// e_u x e_v = e_axis, so this order faces outwards on the positive side
+					uint32_t corners[4];
+					const uint32_t offsets[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+					for (uint32_t c = 0; c < 4; ++c)
+					{
+						uint32_t lattice[3];
+						lattice[axis] = side ? n : 0;
+						lattice[u] = x + offsets[c][0];
+						lattice[v] = y + offsets[c][1];
+						corners[c] = getVertex(lattice);
+					}
+					if (side)
+						mesh.indices.insert(mesh.indices.end(), { corners[0], corners[1], corners[2], corners[0], corners[2], corners[3] });
+					else
+						mesh.indices.insert(mesh.indices.end(), { corners[0], corners[2], corners[1], corners[0], corners[3], corners[2] });
+				}
+			}
+		}
+	}
+	return mesh;
+}
+
+Tests::IndexedMesh Tests::MakeTerrain(uint32_t size)
+{
+	IndexedMesh mesh;
+	const float step = 1.0f / size;
+	auto height = [&](int32_t x, int32_t y)
+	{
+		return 0.1f * ValueNoise(std::clamp(x * step, 0.0f, 1.0f), std::clamp(y * step, 0.0f, 1.0f));
+	};
+	for (int32_t y = 0; y <= (int32_t)size; ++y)
+	{
+		for (int32_t x = 0; x <= (int32_t)size; ++x)
+		{
+			mesh.positions.insert(mesh.positions.end(), { x * step, y * step, height(x, y) });
+			const float dx = (height(x + 1, y) - height(x - 1, y)) / (2.0f * step);
+			const float dy = (height(x, y + 1) - height(x, y - 1)) / (2.0f * step);
+			const float length = sqrtf(dx * dx + dy * dy + 1.0f);
+			mesh.normals.insert(mesh.normals.end(), { -dx / length, -dy / length, 1.0f / length });
+		}
+	}
+	for (uint32_t y = 0; y < size; ++y)
+	{
+		for (uint32_t x = 0; x < size; ++x)
+		{
+			const uint32_t a = y * (size + 1) + x, b = a + 1, c = b + size + 1, d = a + size + 1;
+			mesh.indices.insert(mesh.indices.end(), { a, b, c, a, c, d });
+		}
+	}
+	return mesh;
+}
+
+#ifdef D3D12ENGINE_HAS_DIRECTXMATH
+vector<SVertex> Tests::MakeVertices(const IndexedMesh& mesh)
+{
+	vector<SVertex> vertices(mesh.GetVertexCount());
+	for (size_t i = 0; i < vertices.size(); ++i)
+	{
+		const float* p = &mesh.positions[i * 3];
+		const float* n = &mesh.normals[i * 3];
+		SVertex& vertex = vertices[i];
+		vertex.position = DirectX::XMFLOAT3(p[0], p[1], p[2]);
+		vertex.uv = DirectX::XMFLOAT2(p[0], p[1]);
+		vertex.normal = DirectX::XMFLOAT3(n[0], n[1], n[2]);
+
+		// Any unit vector orthogonal to the normal
+		const float length = sqrtf(n[0] * n[0] + n[2] * n[2]);
+		vertex.tangent = length > 1e-3f ? DirectX::XMFLOAT3(n[2] / length, 0.0f, -n[0] / length) : DirectX::XMFLOAT3(1.0f, 0.0f, 0.0f);
+		const DirectX::XMFLOAT3& t = vertex.tangent;
+		vertex.bitangent = DirectX::XMFLOAT3(n[1] * t.z - n[2] * t.y, n[2] * t.x - n[0] * t.z, n[0] * t.y - n[1] * t.x);
+	}
+	return vertices;
+}
+#endif
+
+std::string Tests::MakeGridOBJ(uint32_t size, uint32_t shapeCount)
+{
+	std::string text;
+	text.reserve((size_t)size * size * 160);
+	char line[160];
+
+	// Vertices row by row. A shape starting at row r repeats row r, so it has its own border vertices.
+	const uint32_t rowsPerShape = (size + shapeCount - 1) / shapeCount;
+	uint32_t first = 1;
+	for (uint32_t shape = 0; shape < shapeCount; ++shape)
+	{
+		const uint32_t y0 = shape * rowsPerShape;
+		const uint32_t y1 = std::min(size, y0 + rowsPerShape);
+		if (y0 >= y1)
+			break;
+
+		snprintf(line, sizeof(line), "o shape%u\n", shape);
+		text += line;
+		for (uint32_t y = y0; y <= y1; ++y)
+		{
+			for (uint32_t x = 0; x <= size; ++x)
+			{
+				const float u = (float)x / size, v = (float)y / size;
+				const float height = 0.1f * sinf(u * 6.2831853f) * cosf(v * 6.2831853f);
+				const float dx = 0.6283185f * cosf(u * 6.2831853f) * cosf(v * 6.2831853f);
+				const float dy = -0.6283185f * sinf(u * 6.2831853f) * sinf(v * 6.2831853f);
+				const float length = sqrtf(dx * dx + dy * dy + 1.0f);
+				snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+					u, v, height, u, v, -dx / length, -dy / length, 1.0f / length);
+				text += line;
+			}
+		}
+		for (uint32_t y = y0; y < y1; ++y)
+		{
+			for (uint32_t x = 0; x < size; ++x)
+			{
+				const uint32_t a = first + (y - y0) * (size + 1) + x, b = a + 1, c = b + size + 1, d = a + size + 1;
+				snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c, d, d, d);
+				text += line;
+			}
+		}
+		first += (y1 - y0 + 1) * (size + 1);
+	}
+	return text;
+}
+
+void Tests::ShuffleTriangles(vector<uint32_t>& indices, uint32_t seed)
+{
+	std::mt19937 random(seed);
+	const size_t triangleCount = indices.size() / 3;
+	for (size_t i = triangleCount; i > 1; --i)
+	{
+		const size_t j = random() % i;
+		std::swap_ranges(&indices[(i - 1) * 3], &indices[(i - 1) * 3] + 3, &indices[j * 3]);
+	}
+	for (size_t t = 0; t < triangleCount; ++t)
+		std::rotate(&indices[t * 3], &indices[t * 3] + random() % 3, &indices[t * 3] + 3);
+}
+
+vector<uint32_t> Tests::GetCanonicalTriangles(const uint32_t* indices, size_t indexCount)
+{
+	struct Triangle
+	{
+		uint32_t v[3];
+		bool operator<(const Triangle& other) const { return std::lexicographical_compare(v, v + 3, other.v, other.v + 3); }
+	};
+	vector<Triangle> triangles(indexCount / 3);
+	for (size_t t = 0; t < triangles.size(); ++t)
+	{
+		const uint32_t* tri = &indices[t * 3];
+		const uint32_t first = (uint32_t)(std::min_element(tri, tri + 3) - tri);
+		for (uint32_t c = 0; c < 3; ++c)
+			triangles[t].v[c] = tri[(first + c) % 3];
+	}
+	std::sort(triangles.begin(), triangles.end());
+	return vector<uint32_t>(&triangles.data()->v[0], &triangles.data()->v[0] + triangles.size() * 3);
+}
+
+uint64_t Tests::HashIndices(const uint32_t* indices, size_t indexCount)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < indexCount; ++i)
+	{
+		for (uint32_t b = 0; b < 4; ++b)
+			hash = (hash ^ ((indices[i] >> (b * 8)) & 0xFF)) * 0x100000001b3ull;
+	}
+	return hash;
+}
+
+float Tests::MeasureOverdraw(const float* positions, const uint32_t* indices, size_t indexCount, uint32_t resolution)
+{
+	float boundsMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, boundsMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (size_t i = 0; i < indexCount; ++i)
+	{
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			boundsMin[c] = std::min(boundsMin[c], positions[indices[i] * 3 + c]);
+			boundsMax[c] = std::max(boundsMax[c], positions[indices[i] * 3 + c]);
+		}
+	}
+	const float extent = std::max({ boundsMax[0] - boundsMin[0], boundsMax[1] - boundsMin[1], boundsMax[2] - boundsMin[2], 1e-6f }) * 1.01f;
+
+	uint64_t shaded = 0, covered = 0;
+	vector<float> depths((size_t)resolution * resolution);
+	for (uint32_t view = 0; view < 6; ++view)
+	{
+		// Looking along -axis from the positive side, or along +axis from the negative one
+		const uint32_t axis = view / 2, u = (axis + 1) % 3, v = (axis + 2) % 3;
+		const float sign = view & 1 ? -1.0f : 1.0f;
+		std::fill(depths.begin(), depths.end(), std::numeric_limits<float>::infinity());
+
+		for (size_t t = 0; t + 2 < indexCount; t += 3)
+		{
+			float x[3], y[3], z[3];
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const float* p = &positions[indices[t + c] * 3];
+				x[c] = (p[u] - boundsMin[u]) / extent * resolution;
+				y[c] = (p[v] - boundsMin[v]) / extent * resolution;
+				z[c] = -sign * p[axis];
+			}
+			// The normal's [axis] component, with the same sign as the projected area since (u, v, axis) is cyclic
+			const float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+			if (area * sign <= 0.0f)
+				continue;
+
+			const int32_t x0 = std::max(0, (int32_t)floorf(std::min({ x[0], x[1], x[2] })));
+			const int32_t x1 = std::min((int32_t)resolution - 1, (int32_t)ceilf(std::max({ x[0], x[1], x[2] })));
+			const int32_t y0 = std::max(0, (int32_t)floorf(std::min({ y[0], y[1], y[2] })));
+			const int32_t y1 = std::min((int32_t)resolution - 1, (int32_t)ceilf(std::max({ y[0], y[1], y[2] })));
+			for (int32_t py = y0; py <= y1; ++py)
+			{
+				for (int32_t px = x0; px <= x1; ++px)
+				{
+					const float cx = px + 0.5f, cy = py + 0.5f;
+					const float w0 = ((x[2] - x[1]) * (cy - y[1]) - (y[2] - y[1]) * (cx - x[1])) / area;
+					const float w1 = ((x[0] - x[2]) * (cy - y[2]) - (y[0] - y[2]) * (cx - x[2])) / area;
+					const float w2 = 1.0f - w0 - w1;
+					if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+						continue;
+					const float depth = w0 * z[0] + w1 * z[1] + w2 * z[2];
+					float& stored = depths[(size_t)py * resolution + px];
+					if (depth < stored)
+					{
+						stored = depth;
+						++shaded;
+					}
+				}
+			}
+		}
+		for (float depth : depths)
+			covered += depth != std::numeric_limits<float>::infinity();
+	}
+	return covered ? (float)shaded / covered : 0.0f;
+}
+
+std::string Tests::GetTempPath(const char* name)
+{
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+bool Tests::WriteTextFile(const std::string& path, const std::string& text)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file)
+		return false;
+	const bool written = fwrite(text.data(), 1, text.size(), file) == text.size();
+	return fclose(file) == 0 && written;
+}
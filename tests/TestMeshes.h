@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef D3D12ENGINE_HAS_DIRECTXMATH
+#include "SMeshTypes.h"
+#endif
+
+// Generated test geometry shared by the mesh tests and benchmarks
+namespace Tests
+{
+	// Triangle list over xyz positions and unit normals, counter-clockwise seen from the side the normals point to
+	struct IndexedMesh
+	{
+		std::vector<float> positions;
+		std::vector<float> normals;
+		std::vector<uint32_t> indices;
+
+		inline size_t GetVertexCount() const { return positions.size() / 3; }
+		// Appends [other] behind this mesh's vertices and triangles
+		void Append(const IndexedMesh& other);
+	};
+
+	// Sphere of 6 [subdivisions] x [subdivisions] quad grids projected from a cube. Vertices along the cube's edges are
+	// shared, so it is closed. Only square roots are involved, so it is bit identical on every platform.
+	IndexedMesh MakeCubeSphere(uint32_t subdivisions, float radius = 1.0f, float centerX = 0.0f);
+
+	// [size] x [size] quads of a unit height field with pseudo random bumps, facing +z, with an open border
+	IndexedMesh MakeTerrain(uint32_t size);
+
+#ifdef D3D12ENGINE_HAS_DIRECTXMATH
+	// SVertex form of [mesh], with uvs from the xy positions and a tangent frame around each normal
+	std::vector<SVertex> MakeVertices(const IndexedMesh& mesh);
+#endif
+
+	// OBJ text of a [size] x [size] quad grid on a gently curved surface, with uvs and per vertex normals.
+	// The grid is split into [shapeCount] 'o' shapes of whole rows, each of which repeats its border vertices.
+	std::string MakeGridOBJ(uint32_t size, uint32_t shapeCount = 1);
+
+	// Shuffles the triangles of [indices] and rotates their corners, keeping every triangle's winding
+	void ShuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed);
+
+	// The triangles of [indices], each rotated to start at its smallest index, sorted; equal for two index
+	// buffers that draw the same triangles with the same winding in any order
+	std::vector<uint32_t> GetCanonicalTriangles(const uint32_t* indices, size_t indexCount);
+
+	// FNV-1a over the indices
+	uint64_t HashIndices(const uint32_t* indices, size_t indexCount);
+
+	// Average number of times a covered pixel is shaded when drawing the triangles in order, with back face
+	// culling and a depth test, seen along the 6 axis directions at [resolution]^2 pixels
+	float MeasureOverdraw(const float* positions, const uint32_t* indices, size_t indexCount, uint32_t resolution = 64);
+
+	// Path of [name] in the system's temporary directory
+	std::string GetTempPath(const char* name);
+
+	// Writes [text] to [path], returning false on failure
+	bool WriteTextFile(const std::string& path, const std::string& text);
+}
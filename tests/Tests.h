@@ -0,0 +1,146 @@
+#pragma once
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+
+// D3D12EngineTests <command> [<argument>...]
+// Tests check the platform independent modules and return 1 after any failed check, printing what failed;
+// ctest runs each of them. Benchmarks print their timings and only fail if their results are wrong.
+// Every command reads its own arguments, those after its name.
+namespace Tests
+{
+	// Counts failed checks and prints them as "<test>: <message>"
+	class Checker
+	{
+		const char* m_name;
+		uint32_t m_failures = 0;
+
+	public:
+		explicit Checker(const char* name) : m_name(name) {}
+
+		// Returns [condition], printing [format] if it is false
+		bool operator()(bool condition, const char* format, ...)
+		{
+			if (condition)
+				return true;
+			va_list args;
+			va_start(args, format);
+			printf("%s: ", m_name);
+			vprintf(format, args);
+			printf("\n");
+			va_end(args);
+			++m_failures;
+			return false;
+		}
+
+		inline uint32_t GetFailures() const { return m_failures; }
+		// The exit code of the command, with a summary line
+		int Result() const
+		{
+			if (m_failures)
+				printf("%s: %u check(s) failed\n", m_name, m_failures);
+			else
+				printf("%s: passed\n", m_name);
+			return m_failures ? 1 : 0;
+		}
+	};
+
+	// Milliseconds since construction or the last Restart
+	class Timer
+	{
+		std::chrono::high_resolution_clock::time_point m_start = std::chrono::high_resolution_clock::now();
+
+	public:
+		void Restart() { m_start = std::chrono::high_resolution_clock::now(); }
+		double Milliseconds() const { return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - m_start).count(); }
+	};
+
+	// STextureCompressionTests.cpp
+	int TestBlockCompression(int argc, char** argv);
+	int BenchmarkBlockCompression(int argc, char** argv);
+	int BenchmarkBC6H(int argc, char** argv);
+
+	// SMeshOptimizerTests.cpp
+	int TestOptimizer(int argc, char** argv);
+	int BenchmarkOptimizer(int argc, char** argv);
+
+	// SMeshSimplifierTests.cpp
+	int TestSimplifier(int argc, char** argv);
+	int BenchmarkSimplifier(int argc, char** argv);
+
+	// SObjReaderTests.cpp
+	int TestObjReader(int argc, char** argv);
+	int BenchmarkObjReader(int argc, char** argv);
+	int BenchmarkParallelFor(int argc, char** argv);
+
+	// STextureTests.cpp
+	int TestTextureLoading(int argc, char** argv);
+	int BenchmarkTextureLoading(int argc, char** argv);
+
+	// PixelConvertTests.cpp
+	int TestPixelConversions(int argc, char** argv);
+	int BenchmarkPixelConversions(int argc, char** argv);
+
+#ifdef D3D12ENGINE_HAS_DIRECTXMATH
+	// SFrustumCullingTests.cpp
+	int TestCulling(int argc, char** argv);
+	int BenchmarkCulling(int argc, char** argv);
+
+	// SMeshBVHTests.cpp
+	int TestBVH(int argc, char** argv);
+	int BenchmarkBVH(int argc, char** argv);
+
+	// SInstanceBatcherTests.cpp
+	int TestInstancing(int argc, char** argv);
+	int BenchmarkInstancing(int argc, char** argv);
+
+	// SMeshCacheTests.cpp
+	int TestMeshCache(int argc, char** argv);
+	int BenchmarkMeshCache(int argc, char** argv);
+
+	// SMeshletsTests.cpp
+	int TestMeshlets(int argc, char** argv);
+	int BenchmarkMeshlets(int argc, char** argv);
+
+	// SMeshTangentsTests.cpp
+	int TestTangents(int argc, char** argv);
+	int BenchmarkTangents(int argc, char** argv);
+
+	// SMeshWeldTests.cpp
+	int TestWeld(int argc, char** argv);
+	int BenchmarkWeld(int argc, char** argv);
+
+	// SGLTFReaderTests.cpp
+	int TestGLTFReader(int argc, char** argv);
+	int BenchmarkGLTFReader(int argc, char** argv);
+
+	// SSphericalHarmonicsTests.cpp
+	int TestSphericalHarmonics(int argc, char** argv);
+	int BenchmarkSphericalHarmonics(int argc, char** argv);
+
+	// STransformStoreTests.cpp
+	int TestTransforms(int argc, char** argv);
+	int BenchmarkTransforms(int argc, char** argv);
+
+	// VertexPackingTests.cpp
+	int TestVertexPacking(int argc, char** argv);
+
+#ifdef D3D12ENGINE_HAS_DXGIFORMAT
+	// SBRDFLUTTests.cpp
+	int TestBRDFLUT(int argc, char** argv);
+	int BenchmarkBRDFLUT(int argc, char** argv);
+
+	// SEnvironmentSamplerTests.cpp
+	int TestEnvironmentSampler(int argc, char** argv);
+	int BenchmarkEnvironmentSampler(int argc, char** argv);
+
+	// SIBLBakerTests.cpp
+	int TestIBLBaker(int argc, char** argv);
+
+	// STextureCacheTests.cpp
+	int TestTextureCache(int argc, char** argv);
+#endif
+#endif
+}
@@ -0,0 +1,240 @@
+#include "Tests.h"
+
+#include "VertexPacking.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace DirectX;
+using std::vector;
+
+namespace
+{
+	// Rounding to 16 bit snorm moves each octahedral coordinate by at most half a step. Moving xy by d moves the
+	// point on the octahedron by at most sqrt(6) d, and the octahedron is at least 1 / sqrt(3) from the center,
+	// so the direction turns by at most sqrt(18) d.
+	const double OCTAHEDRAL_ANGLE_BOUND = sqrt(18.0) * 0.5 / 32767.0;
+
+	// Uniform floats from the raw generator output, which unlike the std distributions is the same everywhere
+	class Random
+	{
+		std::mt19937 m_generator;
+
+	public:
+		explicit Random(uint32_t seed) : m_generator(seed) {}
+
+		float Uniform(float low, float high) { return low + (high - low) * ((m_generator() >> 8) * (1.0f / 16777216.0f)); }
+		bool Bit() { return m_generator() & 1; }
+
+		XMFLOAT3 Direction()
+		{
+			for (;;)
+			{
+				const XMFLOAT3 v(Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f), Uniform(-1.0f, 1.0f));
+				const float lengthSquared = v.x * v.x + v.y * v.y + v.z * v.z;
+				if (lengthSquared > 1e-4f && lengthSquared <= 1.0f)
+				{
+					const float length = sqrtf(lengthSquared);
+					return XMFLOAT3(v.x / length, v.y / length, v.z / length);
+				}
+			}
+		}
+	};
+
+	struct Double3
+	{
+		double x, y, z;
+	};
+
+	Double3 ToDouble(const XMFLOAT3& v) { return { v.x, v.y, v.z }; }
+	double Dot(const Double3& a, const Double3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	Double3 Cross(const Double3& a, const Double3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+	Double3 Normalize(const Double3& v)
+	{
+		const double length = sqrt(Dot(v, v));
+		return { v.x / length, v.y / length, v.z / length };
+	}
+
+	// Radians between two directions, accurate for small angles unlike acos
+	double GetAngle(const Double3& a, const Double3& b)
+	{
+		const Double3 c = Cross(a, b);
+		return atan2(sqrt(Dot(c, c)), Dot(a, b));
+	}
+
+	struct Errors
+	{
+		double position = 0.0;  // In units of the extent
+		double uv = 0.0;        // In units of the bound
+		double normal = 0.0;    // Radians
+		double tangent = 0.0;
+		double bitangent = 0.0;
+		uint32_t flippedHandedness = 0;
+		uint32_t failures = 0;
+	};
+
+	// Checks every decoded vertex against its source, counting vertices beyond a bound in [failures]
+	Errors Measure(const vector<SVertex>& vertices, const vector<SVertex>& decoded, const XMFLOAT3& boundsMin, const XMFLOAT3& boundsMax)
+	{
+		Errors errors;
+		const float* minimum = &boundsMin.x;
+		const float* maximum = &boundsMax.x;
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			const SVertex& source = vertices[i];
+			const SVertex& result = decoded[i];
+			bool failed = false;
+
+			// Half a 16 bit step of the extent, plus the float rounding of scaling and offsetting
+			for (uint32_t c = 0; c < 3; ++c)
+			{
+				const double extent = (double)maximum[c] - minimum[c];
+				const double error = fabs((double)(&result.position.x)[c] - (&source.position.x)[c]);
+				const double bound = extent * 0.5 / 65535.0 + 4.0 * FLT_EPSILON * std::max({ fabs(minimum[c]), fabs(maximum[c]), extent });
+				failed |= error > bound;
+				if (extent > 0.0)
+					errors.position = std::max(errors.position, error / extent);
+			}
+
+			// Half precision rounding to nearest: half of an 11 bit mantissa step, or of the smallest subnormal
+			for (uint32_t c = 0; c < 2; ++c)
+			{
+				const double uv = (&source.uv.x)[c];
+				const double bound = std::max(fabs(uv) * ldexp(1.0, -11), ldexp(1.0, -25));
+				const double error = fabs((&result.uv.x)[c] - uv);
+				failed |= error > bound;
+				errors.uv = std::max(errors.uv, error / bound);
+			}
+
+			// The tangent is compared with its part orthogonal to the normal, which is what gets encoded
+			const Double3 n = Normalize(ToDouble(source.normal));
+			const Double3 t = ToDouble(source.tangent);
+			const double d = Dot(n, t);
+			const Double3 orthogonal = Normalize({ t.x - n.x * d, t.y - n.y * d, t.z - n.z * d });
+			const bool rightHanded = Dot(Cross(n, orthogonal), ToDouble(source.bitangent)) >= 0.0;
+			const Double3 cross = Cross(n, orthogonal);
+			const Double3 expectedBitangent = rightHanded ? cross : Double3{ -cross.x, -cross.y, -cross.z };
+
+			const double normalAngle = GetAngle(ToDouble(result.normal), n);
+			const double tangentAngle = GetAngle(ToDouble(result.tangent), orthogonal);
+			const double bitangentAngle = GetAngle(ToDouble(result.bitangent), expectedBitangent);
+			failed |= normalAngle > OCTAHEDRAL_ANGLE_BOUND * 1.01 || tangentAngle > OCTAHEDRAL_ANGLE_BOUND * 1.01;
+			// cross(n, t) of the decoded vectors turns by at most the sum of both
+			failed |= bitangentAngle > OCTAHEDRAL_ANGLE_BOUND * 2.02;
+			errors.normal = std::max(errors.normal, normalAngle);
+			errors.tangent = std::max(errors.tangent, tangentAngle);
+			errors.bitangent = std::max(errors.bitangent, bitangentAngle);
+			errors.flippedHandedness += Dot(ToDouble(result.bitangent), ToDouble(source.bitangent)) < 0.0;
+
+			errors.failures += failed;
+		}
+		return errors;
+	}
+
+	SVertex MakeVertex(const XMFLOAT3& position, const XMFLOAT2& uv, const XMFLOAT3& normal, const XMFLOAT3& tangent, bool rightHanded)
+	{
+		SVertex vertex = { position, uv, normal, tangent };
+		const Double3 b = Cross(ToDouble(normal), ToDouble(tangent));
+		const float sign = rightHanded ? 1.0f : -1.0f;
+		vertex.bitangent = XMFLOAT3((float)b.x * sign, (float)b.y * sign, (float)b.z * sign);
+		return vertex;
+	}
+}
+
+// D3D12EngineTests packing
+// Encodes random vertices, enough for several parallel blocks, and hand picked ones (axis and diagonal normals,
+// the lower hemisphere, vertices on the bounds, a flat axis) and checks every decoded attribute against its
+// bound: half a 16 bit step of the extent for positions, half precision rounding for UVs, the octahedral angle
+// bound for normals and tangents, twice that and the original handedness for bitangents. Each vertex must also
+// encode to the same bytes on its own as in a large parallel call.
+int Tests::TestVertexPacking(int, char**)
+{
+	Checker check("packing");
+	Random random(1);
+
+	// Random vertices in offset bounds, with the tangent at random angles to the normal
+	const XMFLOAT3 boundsMin(-3.5f, 120.0f, -0.25f), boundsMax(2.0f, 180.0f, 0.0f);
+	vector<SVertex> vertices(200000);
+	for (SVertex& vertex : vertices)
+	{
+		const XMFLOAT3 position(random.Uniform(boundsMin.x, boundsMax.x), random.Uniform(boundsMin.y, boundsMax.y), random.Uniform(boundsMin.z, boundsMax.z));
+		const XMFLOAT2 uv(random.Uniform(-4.0f, 4.0f), random.Uniform(-4.0f, 4.0f));
+		XMFLOAT3 normal = random.Direction(), tangent = random.Direction();
+		if (fabs(Dot(ToDouble(normal), ToDouble(tangent))) > 0.99)
+			tangent = XMFLOAT3(normal.y, normal.z, normal.x);
+		vertex = MakeVertex(position, uv, normal, tangent, random.Bit());
+	}
+
+	// Hand picked ones, in the same bounds
+	const XMFLOAT3 directions[] = {
+		{ 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+		{ 0.57735027f, 0.57735027f, 0.57735027f }, { -0.57735027f, 0.57735027f, -0.57735027f }, { 0.70710678f, 0, -0.70710678f },
+		{ 0, -0.70710678f, -0.70710678f }, { 1e-4f, 0, -1 }, { -0.6f, -0.8f, -1e-7f },
+	};
+	for (const XMFLOAT3& normal : directions)
+	{
+		const XMFLOAT3 tangent = fabsf(normal.x) < 0.9f ? XMFLOAT3(1, 0, 0) : XMFLOAT3(0, 1, 0);
+		vertices.push_back(MakeVertex(boundsMin, XMFLOAT2(0.0f, 1.0f), normal, tangent, true));
+		vertices.push_back(MakeVertex(boundsMax, XMFLOAT2(-65504.0f, 1e-6f), normal, tangent, false));
+	}
+	// A tangent that is nearly the normal still gives an orthogonal frame
+	vertices.push_back(MakeVertex(boundsMin, XMFLOAT2(0.5f, 0.5f), XMFLOAT3(0, 0, 1), XMFLOAT3(1e-3f, 0, 1), true));
+
+	vector<SPackedVertex> packed(vertices.size());
+	vector<SVertex> decoded(vertices.size());
+	VertexPacking::Encode(vertices.data(), vertices.size(), boundsMin, boundsMax, packed.data());
+	VertexPacking::Decode(packed.data(), packed.size(), boundsMin, boundsMax, decoded.data());
+	const Errors errors = Measure(vertices, decoded, boundsMin, boundsMax);
+	check(errors.failures == 0, "%u of %zu vertices exceed an error bound", errors.failures, vertices.size());
+	check(errors.flippedHandedness == 0, "%u bitangents changed handedness", errors.flippedHandedness);
+	printf("packing: %zu vertices, %zu bytes each instead of %zu\n", vertices.size(), sizeof(SPackedVertex), sizeof(SVertex));
+	printf("packing: largest error: position %.3g of the extent (half a step %.3g), uv %.2f of the bound, normal %.4f, tangent %.4f, bitangent %.4f degrees (octahedral bound %.4f)\n",
+		errors.position, 0.5 / 65535.0, errors.uv, XMConvertToDegrees((float)errors.normal), XMConvertToDegrees((float)errors.tangent),
+		XMConvertToDegrees((float)errors.bitangent), XMConvertToDegrees((float)OCTAHEDRAL_ANGLE_BOUND));
+
+	// Positions on the bounds decode exactly
+	for (size_t i = 200000; i + 1 < vertices.size(); i += 2)
+	{
+		check(memcmp(&decoded[i].position, &boundsMin, sizeof(XMFLOAT3)) == 0, "vertex %zu at the bounds minimum moved", i);
+		check(packed[i + 1].position.x == 65535 && packed[i + 1].position.y == 65535 && packed[i + 1].position.z == 65535,
+			"vertex %zu at the bounds maximum does not quantize to 65535", i + 1);
+	}
+
+	// Each vertex encodes the same on its own
+	uint32_t different = 0;
+	for (size_t i = 0; i < vertices.size(); i += 997)
+	{
+		SPackedVertex single;
+		VertexPacking::Encode(&vertices[i], 1, boundsMin, boundsMax, &single);
+		different += memcmp(&single, &packed[i], sizeof(SPackedVertex)) != 0;
+	}
+	check(different == 0, "%u vertices encode differently on their own", different);
+
+	// A flat axis quantizes to 0 and decodes to the bounds
+	{
+		const XMFLOAT3 flatMin(0.0f, 5.0f, -1.0f), flatMax(1.0f, 5.0f, 1.0f);
+		const SVertex vertex = MakeVertex(XMFLOAT3(0.25f, 5.0f, 0.5f), XMFLOAT2(0, 0), XMFLOAT3(0, 1, 0), XMFLOAT3(1, 0, 0), true);
+		SPackedVertex flat;
+		SVertex result;
+		VertexPacking::Encode(&vertex, 1, flatMin, flatMax, &flat);
+		VertexPacking::Decode(&flat, 1, flatMin, flatMax, &result);
+		check(flat.position.y == 0 && result.position.y == 5.0f && Measure({ vertex }, { result }, flatMin, flatMax).failures == 0,
+			"a vertex in bounds with a flat axis decodes to %f, %f, %f", result.position.x, result.position.y, result.position.z);
+	}
+
+	// What the shader gets: position = packed * scale + offset
+	{
+		XMFLOAT4 scale, offset;
+		VertexPacking::GetDequantization(boundsMin, boundsMax, scale, offset);
+		const XMVECTOR q = PackedVector::XMLoadUShortN4(&packed[0].position);
+		XMFLOAT3 position;
+		XMStoreFloat3(&position, XMVectorMultiplyAdd(q, XMLoadFloat4(&scale), XMLoadFloat4(&offset)));
+		check(memcmp(&position, &decoded[0].position, sizeof(XMFLOAT3)) == 0, "the dequantization constants decode a different position than Decode");
+	}
+
+	return check.Result();
+}